@@ -0,0 +1,78 @@
+/*
+ * This file is part of the OpenMV project.
+ * Copyright (c) 2013/2014 Ibrahim Abdelkader <i.abdalkader@gmail.com>
+ * This work is licensed under the MIT license, see the file LICENSE for details.
+ *
+ * Typed arena: fixed size elements stored back to back in a single block.
+ *
+ * Unlike array_t, which keeps a pointer per element, results are written
+ * straight into the arena, so a call that returns N results makes one heap
+ * allocation (plus a few doublings) instead of N+1.
+ *
+ */
+#include <string.h>
+#include "xalloc.h"
+#include "arena.h"
+#define ARENA_INIT_SIZE (4)
+
+void arena_alloc(arena_t *arena, int size, int length)
+{
+    arena->index  = 0;
+    arena->length = (length > 0) ? length : ARENA_INIT_SIZE;
+    arena->size   = size;
+    arena->data   = xalloc(arena->length * size);
+}
+
+void arena_free(arena_t *arena)
+{
+    xfree(arena->data);
+    arena->index  = 0;
+    arena->length = 0;
+    arena->data   = NULL;
+}
+
+int arena_length(arena_t *arena)
+{
+    return arena->index; // index is the actual length, length is the max length
+}
+
+void *arena_at(arena_t *arena, int idx)
+{
+    return arena->data + (idx * arena->size);
+}
+
+// Returns a pointer to a new (uninitialized) element at the end of the arena.
+// The arena doubles in size when full so the number of reallocs is O(log n).
+// Note: pointers returned by previous calls are invalidated if the arena grows.
+void *arena_push_back(arena_t *arena)
+{
+    if (arena->index == arena->length) {
+        arena->length = (arena->length) ? (arena->length * 2) : ARENA_INIT_SIZE;
+        arena->data   = xrealloc(arena->data, arena->length * arena->size);
+    }
+    return arena_at(arena, arena->index++);
+}
+
+void arena_pop_back(arena_t *arena)
+{
+    if (arena->index) {
+        arena->index--;
+    }
+}
+
+// Keeps the first num elements (num must be <= the current length).
+void arena_resize(arena_t *arena, int num)
+{
+    if (num < arena->index) {
+        arena->index = num;
+    }
+}
+
+// Releases unused space at the end of the arena.
+void arena_trim(arena_t *arena)
+{
+    if (arena->index != arena->length) {
+        arena->length = arena->index;
+        arena->data   = xrealloc(arena->data, arena->length * arena->size);
+    }
+}
@@ -0,0 +1,26 @@
+/*
+ * This file is part of the OpenMV project.
+ * Copyright (c) 2013/2014 Ibrahim Abdelkader <i.abdalkader@gmail.com>
+ * This work is licensed under the MIT license, see the file LICENSE for details.
+ *
+ * Typed arena: fixed size elements stored back to back in a single block.
+ *
+ */
+#ifndef __ARENA_H__
+#define __ARENA_H__
+#include <stdint.h>
+typedef struct {
+    int index;      // Number of elements in use.
+    int length;     // Number of elements allocated.
+    int size;       // Element size in bytes.
+    uint8_t *data;
+} arena_t;
+void arena_alloc(arena_t *arena, int size, int length);
+void arena_free(arena_t *arena);
+int arena_length(arena_t *arena);
+void *arena_at(arena_t *arena, int idx);
+void *arena_push_back(arena_t *arena);
+void arena_pop_back(arena_t *arena);
+void arena_resize(arena_t *arena, int num);
+void arena_trim(arena_t *arena);
+#endif //__ARENA_H__
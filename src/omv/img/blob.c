@@ -7,10 +7,11 @@
  *
  */
 #include <string.h>
+#include <limits.h>
 #include "mdefs.h"
 #include "fb_alloc.h"
-#include "xalloc.h"
 #include "imlib.h"
+#define BLOBS_INIT_SIZE (16)
 
 ALWAYS_INLINE static uint8_t *init_mask(rectangle_t *roi)
 {
@@ -107,10 +108,119 @@ ALWAYS_INLINE static bool threshold(image_t *img, int x, int y, simple_color_t l
     }
 }
 
-array_t *imlib_find_blobs(image_t *img,
-                          int num_thresholds, simple_color_t *l_thresholds, simple_color_t *h_thresholds,
-                          bool invert, rectangle_t *r,
-                          bool (*f_fun)(void*,void*,color_blob_t*), void *f_fun_arg_0, void *f_fun_arg_1)
+typedef struct blob_stats {
+    int x1, y1, x2, y2;
+    int pixels;
+    int cx, cy;
+    int a, b, c;
+} blob_stats_t;
+
+ALWAYS_INLINE static void blob_stats_init(blob_stats_t *bs)
+{
+    bs->x1 = INT_MAX;
+    bs->y1 = INT_MAX;
+    bs->x2 = INT_MIN;
+    bs->y2 = INT_MIN;
+    bs->pixels = 0;
+    bs->cx = 0;
+    bs->cy = 0;
+    bs->a = 0; // equal to (x-mx)^2
+    bs->b = 0; // equal to (x-mx)*(y-my)
+    bs->c = 0; // equal to (y-my)^2
+}
+
+ALWAYS_INLINE static void blob_stats_add(blob_stats_t *bs, int x, int y)
+{
+    bs->x1 = IM_MIN(bs->x1, x);
+    bs->y1 = IM_MIN(bs->y1, y);
+    bs->x2 = IM_MAX(bs->x2, x);
+    bs->y2 = IM_MAX(bs->y2, y);
+    bs->pixels += 1;
+    bs->cx += x;
+    bs->cy += y;
+    bs->a += x*x;
+    bs->b += x*y;
+    bs->c += y*y;
+}
+
+static void blob_stats_to_blob(blob_stats_t *bs, int n, color_blob_t *cb)
+{
+    int mx = (bs->cx/bs->pixels); // x centroid
+    int my = (bs->cy/bs->pixels); // y centroid
+    // The below equations were derived by translating the orientation
+    // calculation from a double pass algorithm to single pass.
+    int blob_a = bs->a, blob_b = bs->b, blob_c = bs->c;
+    blob_a -= (mx*bs->cx)+(mx*bs->cx);
+    blob_a += bs->pixels*mx*mx;
+    blob_b -= (mx*bs->cy)+(my*bs->cx);
+    blob_b += bs->pixels*mx*my;
+    blob_c -= (my*bs->cy)+(my*bs->cy);
+    blob_c += bs->pixels*my*my;
+    // Compute the final blob orientation from a, b, and c sums.
+    float o = ((blob_a!=blob_c)?fast_atan2f(blob_b,blob_a-blob_c):0.0)/2.0;
+    cb->x = bs->x1;
+    cb->y = bs->y1;
+    cb->w = bs->x2-bs->x1+1;
+    cb->h = bs->y2-bs->y1+1;
+    cb->pixels = bs->pixels;
+    cb->cx = mx;
+    cb->cy = my;
+    cb->rotation = o;
+    cb->code = 1<<n;
+    cb->count = 1;
+}
+
+// Burns the blob connected to (x, y) and accumulates its statistics. The
+// seed pixel must be unburned and within the threshold. The mask is relative
+// to the roi and the fill never leaves the clip rectangle (also roi relative).
+static void blob_wildfire(image_t *img, rectangle_t *roi, rectangle_t *clip, uint8_t *mask, stack_queue_t *sq,
+                          int x, int y, simple_color_t l_thresholds, simple_color_t h_thresholds, bool invert,
+                          blob_stats_t *bs)
+{
+    blob_stats_add(bs, x, y);
+    set_mask_pixel(roi, mask, x - roi->x, y - roi->y); // in roi
+    stack_queue_push(sq, x, y); // in img
+    do {
+        point_t p = stack_queue_pop(sq);
+        for (int a = -1; a <= 1; a++) {
+            for (int b = -1; b <= 1; b++) {
+                int c = (p.x + b); // in img
+                int d = (p.y + a); // in img
+                int e = (c - roi->x); // in roi
+                int f = (d - roi->y); // in roi
+                if ((clip->x <= e) && (e < (clip->x + clip->w)) // in clip
+                &&  (clip->y <= f) && (f < (clip->y + clip->h)) // in clip
+                &&  get_not_mask_pixel(roi, mask, e, f) // in roi
+                &&  threshold(img, c, d, l_thresholds, h_thresholds, invert)) { // in img
+                    blob_stats_add(bs, c, d);
+                    set_mask_pixel(roi, mask, e, f); // in roi
+                    stack_queue_push(sq, c, d); // in img
+                }
+            }
+        }
+    } while(stack_queue_not_empty(sq));
+}
+
+static void blob_push_back(arena_t *blobs_list, image_t *img, blob_stats_t *bs, int n,
+                           bool (*f_fun)(void*,void*,color_blob_t*), void *f_fun_arg_0, void *f_fun_arg_1)
+{
+    color_blob_t cb;
+    blob_stats_to_blob(bs, n, &cb);
+    if ((f_fun != NULL) && (f_fun_arg_0 != NULL) && (f_fun_arg_1 != NULL)) {
+        if (f_fun(f_fun_arg_0, f_fun_arg_1, &cb)) {
+            memcpy(arena_push_back(blobs_list), &cb, sizeof(color_blob_t));
+        }
+    } else {
+        if (bs->pixels >= ((img->w*img->h)/1000)) {
+            memcpy(arena_push_back(blobs_list), &cb, sizeof(color_blob_t));
+        }
+    }
+}
+
+bool imlib_find_blobs(arena_t *blobs_list, image_t *img,
+                      int num_thresholds, simple_color_t *l_thresholds, simple_color_t *h_thresholds,
+                      bool invert, rectangle_t *r, int x_stride, int y_stride,
+                      bool (*f_fun)(void*,void*,color_blob_t*), void *f_fun_arg_0, void *f_fun_arg_1)
 {
     // We're using a modified wildfire algorithm below where instead of using a
     // the stack we use a queue along with a burn mask to filter out already
@@ -119,115 +229,134 @@ array_t *imlib_find_blobs(image_t *img,
     // computes the bounding box around all those pixels, number of pixels in the
     // blob, centroid, and blob orientation. The algorithm then returns a list
     // of all the blobs in the image. Note that blobs can be mapped back to colors
-    // by their blob code number.
+    // by their blob code number. Blobs are written directly into the arena
+    // so the whole list is a single heap block no matter how many blobs.
+    //
+    // When a stride > 1 is given the image is first labeled on a decimated grid
+    // (one pixel every x_stride/y_stride pixels). Each coarse blob is then burned
+    // again at full resolution, seeded from its grid pixels and limited to its
+    // grid bounding box dilated by one stride, which gives the exact bounding
+    // box, pixel count and centroid while skipping all the background pixels.
+    // Blobs smaller than the stride may be missed.
 
     rectangle_t rect;
     if (!rectangle_subimg(img, r, &rect)) {
-        return NULL;
+        return false;
     }
 
+    x_stride = IM_MAX(x_stride, 1);
+    y_stride = IM_MAX(y_stride, 1);
+
     uint8_t *mask = init_mask(&rect);
     stack_queue_t *sq = init_stack_queue(&rect);
-
-    array_t *blobs_list;
-    array_alloc(&blobs_list, xfree);
-    for (int n = 0; n < num_thresholds; n++) {
-        for (int i = 0; i < rect.h; i++) {
-            for (int j = 0; j < rect.w; j++) {
-                int x = (rect.x + j); // in img
-                int y = (rect.y + i); // in img
-                if (get_not_mask_pixel(&rect, mask, j, i) // in roi
-                &&  threshold(img, x, y, l_thresholds[n], h_thresholds[n], invert)) { // in img
-                    int blob_x1 = x;
-                    int blob_y1 = y;
-                    int blob_x2 = x;
-                    int blob_y2 = y;
-                    int blob_pixels = 1;
-                    int blob_cx = x;
-                    int blob_cy = y;
-                    int blob_a = x*x; // equal to (x-mx)^2
-                    int blob_b = x*y; // equal to (x-mx)*(y-my)
-                    int blob_c = y*y; // equal to (y-my)^2
-                    set_mask_pixel(&rect, mask, j, i); // in roi
-                    stack_queue_push(sq, x, y); // in img
+    rectangle_t clip = { .x = 0, .y = 0, .w = rect.w, .h = rect.h }; // in roi
+
+    arena_alloc(blobs_list, sizeof(color_blob_t), BLOBS_INIT_SIZE);
+
+    if ((x_stride == 1) && (y_stride == 1)) {
+        for (int n = 0; n < num_thresholds; n++) {
+            for (int i = 0; i < rect.h; i++) {
+                for (int j = 0; j < rect.w; j++) {
+                    int x = (rect.x + j); // in img
+                    int y = (rect.y + i); // in img
+                    if (get_not_mask_pixel(&rect, mask, j, i) // in roi
+                    &&  threshold(img, x, y, l_thresholds[n], h_thresholds[n], invert)) { // in img
+                        blob_stats_t bs;
+                        blob_stats_init(&bs);
+                        blob_wildfire(img, &rect, &clip, mask, sq, x, y,
+                                      l_thresholds[n], h_thresholds[n], invert, &bs);
+                        blob_push_back(blobs_list, img, &bs, n, f_fun, f_fun_arg_0, f_fun_arg_1);
+                    }
+                }
+            }
+        }
+    } else {
+        // The grid is the decimated roi, grid pixel (i, j) is image pixel
+        // (rect.x + j*x_stride, rect.y + i*y_stride).
+        rectangle_t grid = { .x = 0, .y = 0,
+                             .w = (rect.w + x_stride - 1) / x_stride,
+                             .h = (rect.h + y_stride - 1) / y_stride };
+        uint8_t *grid_mask = init_mask(&grid);
+        stack_queue_t *grid_sq = init_stack_queue(&grid);
+
+        for (int n = 0; n < num_thresholds; n++) {
+            for (int i = 0; i < grid.h; i++) {
+                for (int j = 0; j < grid.w; j++) {
+                    if (!get_not_mask_pixel(&grid, grid_mask, j, i)
+                    ||  !threshold(img, rect.x + (j*x_stride), rect.y + (i*y_stride),
+                                   l_thresholds[n], h_thresholds[n], invert)) {
+                        continue;
+                    }
+                    // Label the coarse blob on the grid (bounding box only).
+                    int gx1 = j, gy1 = i, gx2 = j, gy2 = i;
+                    set_mask_pixel(&grid, grid_mask, j, i);
+                    stack_queue_push(grid_sq, j, i);
                     do {
-                        point_t p = stack_queue_pop(sq);
+                        point_t p = stack_queue_pop(grid_sq);
                         for (int a = -1; a <= 1; a++) {
                             for (int b = -1; b <= 1; b++) {
-                                int c = (p.x + b); // in img
-                                int d = (p.y + a); // in img
-                                int e = (c - rect.x); // in roi
-                                int f = (d - rect.y); // in roi
-                                if (IM_X_INSIDE(&rect, e) // in roi
-                                &&  IM_Y_INSIDE(&rect, f) // in roi
-                                &&  get_not_mask_pixel(&rect, mask, e, f) // in roi
-                                &&  threshold(img, c, d, l_thresholds[n], h_thresholds[n], invert)) { // in img
-                                    blob_x1 = IM_MIN(blob_x1, c);
-                                    blob_y1 = IM_MIN(blob_y1, d);
-                                    blob_x2 = IM_MAX(blob_x2, c);
-                                    blob_y2 = IM_MAX(blob_y2, d);
-                                    blob_pixels += 1;
-                                    blob_cx += c;
-                                    blob_cy += d;
-                                    blob_a += c*c;
-                                    blob_b += c*d;
-                                    blob_c += d*d;
-                                    set_mask_pixel(&rect, mask, e, f); // in roi
-                                    stack_queue_push(sq, c, d); // in img
+                                int c = (p.x + b); // in grid
+                                int d = (p.y + a); // in grid
+                                if (IM_X_INSIDE(&grid, c)
+                                &&  IM_Y_INSIDE(&grid, d)
+                                &&  get_not_mask_pixel(&grid, grid_mask, c, d)
+                                &&  threshold(img, rect.x + (c*x_stride), rect.y + (d*y_stride),
+                                              l_thresholds[n], h_thresholds[n], invert)) {
+                                    gx1 = IM_MIN(gx1, c);
+                                    gy1 = IM_MIN(gy1, d);
+                                    gx2 = IM_MAX(gx2, c);
+                                    gy2 = IM_MAX(gy2, d);
+                                    set_mask_pixel(&grid, grid_mask, c, d);
+                                    stack_queue_push(grid_sq, c, d);
                                 }
                             }
                         }
-                    } while(stack_queue_not_empty(sq));
-                    int mx = (blob_cx/blob_pixels); // x centroid
-                    int my = (blob_cy/blob_pixels); // y centroid
-                    // The below equations were derived by translating the orientation
-                    // calculation from a double pass algorithm to single pass.
-                    blob_a -= (mx*blob_cx)+(mx*blob_cx);
-                    blob_a += blob_pixels*mx*mx;
-                    blob_b -= (mx*blob_cy)+(my*blob_cx);
-                    blob_b += blob_pixels*mx*my;
-                    blob_c -= (my*blob_cy)+(my*blob_cy);
-                    blob_c += blob_pixels*my*my;
-                    // Compute the final blob orientation from a, b, and c sums.
-                    float o = ((blob_a!=blob_c)?fast_atan2f(blob_b,blob_a-blob_c):0.0)/2.0;
-                    color_blob_t cb;
-                    cb.x = blob_x1;
-                    cb.y = blob_y1;
-                    cb.w = blob_x2-blob_x1+1;
-                    cb.h = blob_y2-blob_y1+1;
-                    cb.pixels = blob_pixels;
-                    cb.cx = mx;
-                    cb.cy = my;
-                    cb.rotation = o;
-                    cb.code = 1<<n;
-                    cb.count = 1;
-                    // We allocate in the below code to sped things up.
-                    if ((f_fun != NULL) && (f_fun_arg_0 != NULL) && (f_fun_arg_1 != NULL)) {
-                        if (f_fun(f_fun_arg_0, f_fun_arg_1, &cb)) {
-                            color_blob_t *cb2 = xalloc(sizeof(color_blob_t));
-                            memcpy(cb2, &cb, sizeof(color_blob_t));
-                            array_push_back(blobs_list, cb2);
-                        }
-                    } else {
-                        if (blob_pixels >= ((img->w*img->h)/1000)) {
-                            color_blob_t *cb2 = xalloc(sizeof(color_blob_t));
-                            memcpy(cb2, &cb, sizeof(color_blob_t));
-                            array_push_back(blobs_list, cb2);
+                    } while(stack_queue_not_empty(grid_sq));
+
+                    // Dilate the coarse bounding box by one stride (in roi).
+                    int x1 = IM_MAX((gx1 * x_stride) - (x_stride - 1), 0);
+                    int y1 = IM_MAX((gy1 * y_stride) - (y_stride - 1), 0);
+                    int x2 = IM_MIN((gx2 * x_stride) + (x_stride - 1), rect.w - 1);
+                    int y2 = IM_MIN((gy2 * y_stride) + (y_stride - 1), rect.h - 1);
+                    rectangle_t blob_clip = { .x = x1, .y = y1, .w = x2 - x1 + 1, .h = y2 - y1 + 1 };
+
+                    // Refine at full resolution. Every grid pixel of this blob that
+                    // wasn't reached yet seeds a new fill, so pieces that are only
+                    // connected on the grid come out as separate blobs, just like
+                    // they would at full resolution.
+                    for (int gy = gy1; gy <= gy2; gy++) {
+                        for (int gx = gx1; gx <= gx2; gx++) {
+                            int e = gx * x_stride; // in roi
+                            int f = gy * y_stride; // in roi
+                            if (get_not_mask_pixel(&grid, grid_mask, gx, gy)
+                            ||  !get_not_mask_pixel(&rect, mask, e, f)
+                            ||  !threshold(img, rect.x + e, rect.y + f, l_thresholds[n], h_thresholds[n], invert)) {
+                                continue;
+                            }
+                            blob_stats_t bs;
+                            blob_stats_init(&bs);
+                            blob_wildfire(img, &rect, &blob_clip, mask, sq, rect.x + e, rect.y + f,
+                                          l_thresholds[n], h_thresholds[n], invert, &bs);
+                            blob_push_back(blobs_list, img, &bs, n, f_fun, f_fun_arg_0, f_fun_arg_1);
                         }
                     }
                 }
             }
         }
+
+        deinit_stack_queue();
+        deinit_mask();
     }
 
     deinit_stack_queue();
     deinit_mask();
 
-    return blobs_list;
+    arena_trim(blobs_list);
+    return true;
 }
 
-array_t *imlib_find_markers(array_t *blobs_list, int margin,
-                            bool (*f_fun)(void*,void*,color_blob_t*), void *f_fun_arg_0, void *f_fun_arg_1)
+bool imlib_find_markers(arena_t *blobs_list_ret, arena_t *blobs_list, int margin,
+                        bool (*f_fun)(void*,void*,color_blob_t*), void *f_fun_arg_0, void *f_fun_arg_1)
 {
     // After you have a list of blobs this function will merge blobs that
     // intersect into one blob. The new merged big blob will have a bounding box
@@ -238,23 +367,23 @@ array_t *imlib_find_markers(array_t *blobs_list, int margin,
     // provides a nice and easy user controllable way to get an idea of what
     // colors are in a merged blob.
 
-    if (!array_length(blobs_list)) return NULL;
+    if (!arena_length(blobs_list)) return false;
 
     rectangle_t rect; // reusing mask from above - so we need a fake rect obj.
     rect.x = 0;
     rect.y = 0;
-    rect.w = array_length(blobs_list);
+    rect.w = arena_length(blobs_list);
     rect.h = 1;
 
     uint8_t *mask = init_mask(&rect);
 
-    array_t *blobs_list_ret;
-    array_alloc(&blobs_list_ret, xfree);
-    for (int i = 0, ii = array_length(blobs_list); i < ii; i++) {
+    // The number of input blobs is an upper bound on the number of markers.
+    arena_alloc(blobs_list_ret, sizeof(color_blob_t), arena_length(blobs_list));
+    for (int i = 0, ii = arena_length(blobs_list); i < ii; i++) {
         if (get_not_mask_pixel(&rect, mask, i, 0)) {
             set_mask_pixel(&rect, mask, i, 0);
 
-            color_blob_t *cb0 = array_at(blobs_list, i);
+            color_blob_t *cb0 = arena_at(blobs_list, i);
 
             int blob_x = cb0->x; // rect x
             int blob_y = cb0->y; // rect y
@@ -267,10 +396,10 @@ array_t *imlib_find_markers(array_t *blobs_list, int margin,
             int blob_code = cb0->code; // code bit
             int blob_count = cb0->count; // blob count
 
-            for (int j = 0, jj = array_length(blobs_list); j < jj;) {
+            for (int j = 0, jj = arena_length(blobs_list); j < jj;) {
                 if (get_not_mask_pixel(&rect, mask, j, 0)) {
 
-                    color_blob_t *cb1 = array_at(blobs_list, j);
+                    color_blob_t *cb1 = arena_at(blobs_list, j);
 
                     rectangle_t t0, t1;
                     t0.x = blob_x - margin;
@@ -326,22 +455,18 @@ array_t *imlib_find_markers(array_t *blobs_list, int margin,
             cb.rotation = blob_rotation;
             cb.code = blob_code;
             cb.count = blob_count;
-            // We allocate in the below code to sped things up.
             if ((f_fun != NULL) && (f_fun_arg_0 != NULL) && (f_fun_arg_1 != NULL)) {
                 if (f_fun(f_fun_arg_0, f_fun_arg_1, &cb)) {
-                    color_blob_t *cb2 = xalloc(sizeof(color_blob_t));
-                    memcpy(cb2, &cb, sizeof(color_blob_t));
-                    array_push_back(blobs_list_ret, cb2);
+                    memcpy(arena_push_back(blobs_list_ret), &cb, sizeof(color_blob_t));
                 }
             } else {
-                color_blob_t *cb2 = xalloc(sizeof(color_blob_t));
-                memcpy(cb2, &cb, sizeof(color_blob_t));
-                array_push_back(blobs_list_ret, cb2);
+                memcpy(arena_push_back(blobs_list_ret), &cb, sizeof(color_blob_t));
             }
         }
     }
 
     deinit_mask();
 
-    return blobs_list_ret;
+    arena_trim(blobs_list_ret);
+    return true;
 }
@@ -1,22 +1,5269 @@
 const int frontalface_window_w=24;
 const int frontalface_window_h=24;
 const int frontalface_n_stages=25;
-const uint8_t frontalface_stages_array[]={9, 16, 27, 32, 52, 53, 62, 72, 83, 91, 99, 115, 127, 135, 136, 137, 159, 155, 169, 196, 197, 181, 199, 211, 200};
-const int16_t frontalface_stages_thresh_array[]={-1290, -1275, -1191, -1140, -1122, -1057, -1029, -994, -983, -933, -990, -951, -912, -947, -877, -899, -920, -868, -829, -821, -838, -849, -833, -862, -766};
-const int16_t frontalface_tree_thresh_array[]={-129, 50, 89, 23, 61, 407, 11, -77, 24, -86, 83, 87, 375, 148, -78, 33, 75, -28, -40, 64, -84, -563, 58, 41, 374, 285, 129, 58, 59, -12, 134, -29, 206, 192, -284, -200, 347, -7, 473, -210, -174, 1522, 79, 71, 162, -37, 7, 123, -322, 8, 110, -184, -269, 64, 596, 25, 27, 75, 81, -1136, 37, -154, 75, -45, 138, -146, -46, -267, -173, 7, -529, 93, -139, 107, 91, -23, 178, 234, 9, 53, -108, -23, -67, -279, 163, 770, 319, 0, 348, 36, 36, -96, 28, 138, -13, 119, -34, -44, -100, 15, -50, -19, 314, 117, 80, -119, -119, 80, 17, -145, -66, -90, -93, 68, -54, -138, 69, 13, 342, 1056, -149, -67, -15, -26, -15, -186, -98, -317, 96, -10, 491, 9, 285, -191, -205, 123, 373, 52, 65, 9, 130, 11, -49, 87, 124, -184, -293, 242, 27, 168, -3, -124, -52, 153, 100, 233, -66, -722, 721, -30, 249, -119, -186, 152, -99, -244, -123, 30, -8, 85, -27, 76, -181, 93, -4, 70, -141, 274, 973, -52, 43, 69, -29, 43, 25, 53, 12, -447, 33, 128, 130, 27, 107, 52, 107, -61, -159, -23, -6, -116, 271, 36, 46, -11, 46, 29, 130, 103, 30, 134, -11, -155, -159, 11, -221, -34, 138, -460, -42, -20, -38, -48, -95, 69, -98, -151, -252, 88, -15, 183, 234, -46, -49, 92, -81, 65, -37, -18, 521, 195, 219, -162, -275, 546, -856, -268, 253, -104, -142, -74, 61, 189, 63, 52, 201, 51, -76, 171, -210, -290, 68, -25, -161, 0, -91, 7, 4, 160, 254, 8, 3, -28, -97, -420, -39, 163, -53, -207, 102, -31, 175, 0, 37, 45, -214, -942, -67, -70, -150, -42, -56, 120, 98, 25, -91, -28, -166, -100, 10, -80, -121, -61, -248, -52, -82, -125, -84, -7, -128, 77, 25, -41, -5, -16, -180, -248, -134, -603, -48, 594, 210, 12, -178, 528, -373, 58, 134, 51, 60, -137, 583, -25, 74, 102, 190, -36, 167, -140, -162, 10, 112, 143, 18, 11, 144, 106, -64, -31, 85, 245, 159, 88, -112, 42, 101, -65, 199, 5, -360, 75, 144, -835, -68, 154, 9, -60, -197, -120, -189, -114, -23, -41, 46, 212, 136, -59, -140, -330, -3, 397, 149, 211, -100, 1340, 31, 662, -19, -75, 318, 77, -325, -278, -24, 130, -122, -329, 15, 137, 33, 413, -40, 29, 102, 1143, -181, -57, 564, 141, 76, 102, 234, 61, 36, 124, -180, 75, 43, -188, 339, -36, 175, -35, -17, 33, 396, -125, -249, -156, -39, 200, -170, -82, -4, -137, 79, -1, -1, -382, -318, 69, -87, -52, 32, 421, -153, 104, 2, -1182, 373, 493, -302, -135, -179, 741, -48, 18, 28, -97, -275, -267, 93, -77, -28, -164, -166, -50, -111, -361, -32, -171, 187, -577, -242, 17, -8, 1127, -108, 167, 22, 130, -169, -393, -47, 75, -139, -100, 200, -84, -94, 264, 51, -49, -108, -104, 160, -24, -139, 166, 104, 817, 50, 160, -126, -145, -252, -48, 274, -84, -91, 4, 146, 125, 22, -25, -124, -39, -233, 16, 138, -141, 192, -35, 268, -180, 70, 135, -86, 121, 226, -137, 80, -85, 133, -44, -40, -15, -171, -140, 41, -368, 106, -15, 130, 79, 7, -180, -183, -440, -526, -183, -180, -502, -81, -63, -200, 229, -40, 55, 26, 29, 19, 39, -112, -161, -125, -6, 781, 21, 98, -108, 22, 222, 0, 62, 69, 124, 26, 580, 79, -70, -25, -65, -414, -30, 181, -476, 19, 91, -49, 229, -35, 27, -74, -93, 52, -56, 128, 381, 106, 67, -7, -36, 92, -154, -22, -97, -108, 50, 395, -112, -64, -8, 49, -63, -17, -86, -69, -167, -33, -78, -181, -255, -4, 97, 87, 82, -117, 14, 233, -384, 72, 935, -749, -286, 62, 27, -65, 53, 53, -163, 61, -84, -91, -32, 62, -129, -126, -63, 144, -73, -13, 64, 122, 12, 347, -240, 183, 165, 154, 248, -81, -679, 282, 46, 6, 326, -234, 30, -73, 387, 22, 28, 141, -212, -283, -22, 280, -274, -86, 83, -192, 768, -177, 81, 33, 111, -375, -51, 60, 119, 35, -224, -60, 102, 190, 72, 668, 53, -64, 329, 144, 135, 49, 176, 124, 145, -59, 51, 41, 118, 2, 198, 132, 136, 26, -23, 52, 24, 10, -69, 115, 42, 40, 106, -104, -14, 37, 86, -209, -255, -135, -153, 508, -36, -245, 25, -72, 72, 21, -43, 855, -108, 241, -47, 188, -93, -33, 14, 202, 14, -126, 354, -559, -23, -73, -81, -235, -340, -220, -34, 226, -275, -97, 22, 87, -100, -80, -218, 29, -92, -337, 536, 58, 26, -188, 236, -24, -213, 190, 30, 88, -73, -152, -1, 102, 38, 132, -25, 210, -108, -63, 79, 137, 118, 0, -201, 313, 97, 15, -366, -61, -45, 387, 2254, 169, 101, 208, -69, -498, -14, 474, 151, 47, -82, -117, -23, -227, -60, -29, -184, 263, -60, 184, -4, 202, 119, 142, -25, 63, 11, -219, -78, -226, 230, -97, 7, -154, -98, 112, 473, -91, 54, -15, -10, 13, 154, -56, -11, -157, -142, 95, 143, -54, 52, 14, 412, 0, 47, -147, -86, 60, -21, 96, -102, -3, -165, 115, 187, 162, 206, -70, 328, 400, -63, -62, -67, -107, 36, -110, 31, -65, 85, 350, 97, -160, -319, -69, 486, 639, -188, -42, 392, 56, 9, 136, -136, 11, -269, 8, 91, -235, 27, 50, -33, 150, -1647, -90, -53, -52, 88, 48, -80, 263, 446, -139, -15, -44, -47, 106, 17, -195, 1, 472, 65, 231, -43, 508, -22, 48, -176, -135, -87, -50, -69, -10, -184, 159, 27, -67, 25, 187, 16, 0, 29, -204, -102, 126, 189, -13, -99, 49, 53, 242, -168, -344, 182, 100, -17, 100, -348, 89, -68, 133, 10, 226, -435, -32, 309, -380, 202, -48, 351, 331, -138, 63, 224, 87, 32, -153, 652, -282, -138, -259, 30, -39, -535, 235, -29, 127, 146, -129, -79, -29, 33, -178, 108, 131, -295, 128, -1, 11, 134, -59, 155, 11, -170, -101, 41, -85, 91, -152, -43, 227, 88, 0, 59, 441, 147, -16, 85, -122, 106, 43, 35, 87, 305, 19, 7, 4, 115, -133, 92, -88, 31, 59, 114, 23, -40, -16, -92, -162, -71, 36, -32, 110, -84, -294, -110, -194, -446, 55, -27, -16, -154, 35, -131, 239, -167, -81, -18, 68, 38, -80, 44, 155, 67, -81, 45, 21, -45, -43, 431, 224, 72, -127, -234, -46, 125, 7, 46, 333, 219, -98, 27, -132, 155, 63, -181, -94, 79, 425, -77, 158, 93, -128, 39, -201, -161, 196, 210, 58, -375, 26, 146, 207, -59, -158, -165, 97, 35, -544, 40, 20, -250, -1, 13, 86, 30, 101, -145, 81, 61, -94, -76, 1846, 48, -101, -183, -59, -100, 94, -102, 4, 63, -109, 5, -2, -130, -20, 127, -137, 49, -142, 40, 244, -267, -380, -168, 87, -104, -168, -72, 36, -47, -30, 3, -125, -77, -33, -142, 77, -77, -364, 28, -115, -1, -443, 65, 35, -103, -55, -31, 293, -55, 12, -208, -36, 877, 57, 174, 81, -137, 260, 89, -321, 58, -275, 534, -189, -122, -1, -91, -6, 49, 99, -193, -101, 89, 770, -318, -199, -70, -11, -404, -89, 250, -100, 138, 156, -82, 101, -99, -108, -14, 438, 184, 181, 4, 292, 146, -85, 1741, 46, -62, -62, -77, -13, 381, -51, -110, -96, -58, 115, 208, 47, -60, 935, 454, 13, 349, 90, -64, 1356, 36, 188, -154, -335, 891, 60, 214, 37, 32, -106, -12, 234, -25, -165, -83, -70, -99, 232, 1, 40, -215, -56, -124, -1230, -147, -225, 138, -33, -22, 12, 219, -513, 379, 157, -8, 39, 98, -73, -43, -29, 98, -75, 64, -199, 27, 40, 60, 397, 197, 40, -163, 93, 27, 244, 28, 64, -203, 214, 91, 168, -88, -339, 34, 323, -369, -119, 28, -33, 80, -60, 103, -64, 120, -34, 100, -138, -8, 124, 16, 113, 32, 180, -132, 85, 103, 26, -239, 130, -124, 61, -200, 340, 97, 67, -48, 0, 78, -41, -57, -422, -391, -169, 9, 439, 13, 119, 46, -49, -52, 100, 188, -111, 164, 94, -97, 317, -54, -88, -292, -22, 109, -161, 106, 200, 151, 323, 118, 25, -269, -282, -477, -5, -182, 209, -129, 86, -566, 213, 106, -49, -99, -103, 51, 234, 68, -93, 0, -31, 385, -255, 71, -90, -42, -38, -118, -86, -151, 43, 670, 388, 144, 52, 569, 48, -40, -24, -5, 132, -57, 4, 0, -1, 16, 58, -226, 383, 109, 15, -130, -92, 103, -127, -108, -56, -257, -183, -83, -32, 35, -111, -67, -56, 119, 153, -102, -261, -38, -3, -89, -73, -101, 643, 282, -45, -56, -126, 87, 381, 121, 0, -172, -92, -52, 114, -113, -25, -83, -50, -165, 121, 28, 66, 205, 8, 102, -64, 152, -324, -70, 134, -481, 493, 17, -297, 725, 34, -53, 77, 87, 259, -132, -96, 76, 127, -45, -52, -52, 281, 21, -158, 25, 717, 476, -94, -210, 920, 38, -485, 154, 90, -148, -540, -170, -135, 64, -161, -277, -109, 163, 412, -331, -87, -43, 3, 14, 77, -104, -16, -3, -202, 47, 141, -33, -91, -126, 179, 176, 111, 38, 386, 697, -193, 458, -58, 139, 88, 89, 337, 346, -225, -265, -93, 224, 0, 402, -29, 205, -23, 57, 87, -119, 1, 7, 35, 260, -114, 200, -120, 508, 32, 124, 103, 41, -68, -11, 173, -198, 118, -164, -168, 48, -87, -97, 73, -178, -37, 194, -58, 15, 14, -119, -26, -123, 32, 36, 393, -134, -54, 62, 49, -312, -49, 89, -11, -199, -42, -27, 35, 81, 90, -213, 80, 94, -61, -204, -283, 19, -138, -66, -205, 233, 167, -12, -133, 403, -156, -188, -489, -493, 289, 34, 93, 2, 141, -18, 96, 52, -46, -170, -382, -111, -89, -39, 284, 127, -203, -83, -62, -207, -84, -126, -18, -187, 68, 13, 100, -326, 182, -513, 73, 78, 163, 55, 66, 45, 160, -39, 114, -96, 110, 1, -168, 27, 196, -12, -35, -30, -7, -353, 191, 0, -66, 187, -112, -113, 31, -2, 452, 281, 7, 787, 644, -202, 212, 204, -174, -153, -152, 57, -1, 131, -17, 40, 382, 70, 34, -57, -31, 114, -77, -76, -149, 132, 244, 40, -144, 11, 33, 364, -123, -89, 154, 11, -43, 531, -72, -315, -78, -209, 8, 104, -97, -26, -154, 886, -54, 291, 229, 165, 258, 42, 256, -161, -22, 441, 69, 127, -94, -45, -19, -71, 77, 29, 77, 127, 85, 46, -233, 295, -81, -68, -163, 110, -16, 93, -282, 176, 35, 59, -47, -449, 185, -110, 73, 206, -122, 155, 760, -16, 41, -47, -26, 43, -83, 9, -6, 35, -99, 304, 69, -100, 123, 49, 355, -173, -10, -232, 96, -85, 29, 1399, 25, 133, 0, 2, 223, -41, -77, -21, -44, -204, 49, -9, 12, 16, -30, 212, 75, 716, 221, -1312, -110, 317, 97, 47, 133, -181, -239, 79, -183, -247, 47, 114, 267, 39, 10, 130, 135, 194, -80, -224, -92, 438, -149, 57, 85, 201, 148, 168, 64, -66, -12, -564, -39, -101, -571, -336, 15, -27, -65, -208, 68, 65, 14, -352, 135, -16, -98, 35, -113, -796, -445, -79, 12, 242, -222, -161, 337, -30, 30, 28, -63, -11, -289, -47, 2, -151, -133, -306, 169, -118, 189, 1041, 9, -339, -46, -528, 157, 417, -78, -248, 101, 109, 61, 107, -153, -21, 72, -139, -65, 80, -424, -78, -52, -66, -522, 78, 133, 38, 20, 169, -312, -298, 244, 83, -328, -73, 46, -104, -3, -59, 35, 224, -443, 94, 11, -8, -92, 340, -27, 313, 22, -42, 113, -95, -227, -166, -30, 69, -151, -80, -96, -177, -90, 67, -134, 292, 3, -34, -70, -76, -37, 75, -206, -96, -111, 26, 95, 53, -27, -92, -261, -204, 27, -228, 1308, 331, -61, 191, 24, -140, -143, 12, -57, -27, -216, -8, 75, 51, 52, -73, 7, -60, -61, 59, -44, -37, 18, 96, 130, -75, 80, 1685, -170, -42, 50, -35, 66, -42, -50, -206, 202, -168, 4, -205, -35, -205, 418, -58, 42, -48, 295, -77, -19, -238, 4, -202, -487, -74, -32, 212, 273, -56, -72, -172, -55, -45, -503, 195, 130, 17, -251, -11, -280, 424, 64, -40, -36, -261, 159, -163, 206, 189, 254, -265, 112, 1, -17, 193, 51, 188, 813, 68, 8, 91, -56, -31, -54, 200, 83, -68, -693, -464, -318, -63, -270, 34, 145, -159, -40, -94, 12, 53, 60, -246, 212, 101, -49, -404, 481, -77, -116, 53, -477, -15, 127, 103, -115, 149, -296, -170, 195, 269, 56, -113, -65, 303, -3, 73, -10, -37, 201, -125, 410, 13, 145, 1, 103, -21, 6, -66, -121, -6, -221, -271, 114, 118, -83, 50, 177, 762, 130, 57, -25, -22, 68, 106, -109, -69, 24, -11, -179, 211, 33, -216, 215, -51, 47, -97, -252, -7, 144, -75, -157, 408, 345, 164, 241, 612, 2, -136, 38, 176, -276, -1276, 121, 43, -118, -23, 116, -118, 102, 49, -174, 42, -283, -19, -57, -62, -41, -208, 125, -45, -25, 321, -41, 127, 164, 66, -186, -74, -57, -158, 129, -44, 49, 289, 2176, -60, -9, 204, -195, -374, 155, -63, -63, -235, -24, -286, -102, 70, -181, 180, 65, -379, 290, 236, -67, 98, 51, -222, -54, 25, 118, -90, 21, 352, -35, 27, -26, 36, 13, 169, -27, 125, -30, 364, 29, -74, -105, 447, -46, -235, 420, 110, -55, -1317, 837, -288, 154, -287, 258, 149, 16, -201, -293, -155, -12, 79, 46, -137, 376, 15, 52, -586, -396, -36, 65, 288, -155, 2113, -134, -148, 27, -66, 34, -563, 724, 32, 449, -124, -94, -12, -136, 54, 60, -54, -66, -118, -415, 154, -1169, 629, 0, -84, 153, 234, 20, -223, 103, 99, 147, -409, 345, 65, 138, -253, 286, -114, -52, 88, 411, 106, 116, 158, -190, -175, 15, 173, 80, 3, -17, 69, 147, -290, -258, 121, 155, -136, -129, 4, -293, -332, 18, -172, -268, 74, -211, -193, 71, -103, -166, -154, -54, 0, -46, 152, 13, -92, 95, -57, 30, -47, 215, 215, -48, 392, -65, 142, 142, 66, -181, -22, -269, -300, 67, -37, 24, -3, 841, -69, -78, -106, -89, -98, 193, -188, 108, -199, -76, 51, -4, -201, -71, -60, -938, -520, 42, 28, 1188, -975, 255, 19, -113, -69, -203, -306, 131, -386, -63, -16, 12, -41, -158, 141, -19, 2, 144, -96, -7, -68, 2705, 449, 55, -93, -335, -215, -103, -179, -74, 96, 140, 105, -108, 249, 592, 218, 46, -9, -121, 111, -14, -51, -363, -78, -68, 52, -55, 77, -26, -99, -121, 20, -23, 68, 156, -233, -220, -10, 1217, -364, -230, 151, -34, -9, -293, 21, -25, 63, 106, -49, -277, -60, 102, 77, -87, 38, 940, -155, -55, 148, 27, 395, -146, 44, 324, 134, -113, -16, 30, 459, -486, -170, -114, -512, 969, -120, 154, 295, 40, 213, -179, -157, -404, -499, -490, 126, 44, 232, 4, -115, -655, 20, 192, 99, 287, 40, -230, 449, 85, 143, 163, -19, 9, 103, -131, 308, -75, -52, -108, 90, 600, 14, 38, -35, -160, 101, -143, -75, -55, 25, -75, 58, -133, -10, -3, 194, -28, -176, 84, -91, 204, 253, -171, -13, 99, -70, -16, -58, -37, -506, -336, 268, -129, -326, -77, -20, -50, 5, 121, 115, 124, -70, -344, 30, 231, -21, -61, 224, -80, -275, -58, 122, 212, 168, -526, 9, 31, 186, -322, 32, -55, 118, -112, -298, -57, 177, 120, -130, 155, -91, 241, 127, 153, -85, -104, -29, -208, -84, 43, 130, -97, -24, 97, 114, 59, 445, -57, 16, -20, -348, 8, 1490, 904, -66, -197, 71, -140, -18, 528, 124, 180, 12, -107, -114, 48, 6, -14, -129, -131, 636, 360, -6, 38, 152, 328, -3, -20, 489, -18, -121, 109, 181, -99, 80, 22, -950, -104, -26, 16, -146, -58, -517, 281, 351, 63, 332, 75, -353, 296, -320, 396, -163, -39, 1, 49, -85, 237, 0, -70, 125, -3, 360, -159, 328, 161, 84, -274, 191, 321, 271, 123, 70, 82, 135, -60, -42, -117, -19, 1318, -69, -30, -122, -46, 19, 20, 792, 22, -279, -143, 20, 390, -257, -697, 43, -170, 520, 338, 349, 227, 18, 53, 237, -93, 197, 105, 28, -141, 120, -9, -392, 68, 106, 1, -27, 77, 0, -312, 205, -11, 66, 154, -50, 237, 19, 187, 87, 642, -42, 9, -95, -28, -140, -86, 8, -17, -58, -33, -38, -155, 19, -18, 21, -39, 184, 58, 670, 10, -15, -103, -79, 59, 211, -155, -121, -160, -119, -342, 1720, 245, -77, -24, -238, -50, 190, 4, -363, -94, 176, 0, 36, -72, 25, 93, -88, 252, -319, 46, -104, -155, 40, -56, 34, -292, 40, 450, 144, -457, -465, 68, -32, -135, 51, -172, 103, -99, -50, -466, -347, -100, -36, 45, -120, 26, 57, -54, 1164, -971, -457, 523, -257, 71, 5, 112, -178, 45, 85, -91, 133, 50, 34, 153, -57, 233, 20, -100, -46, 141, 99, -32, 143, 18, -340, -57, 5, -68, -314, -969, -411, 5, 90, -460, 67, 278, 65, 19, 27, 19, 10, 11, -123, 58, -247, -81, 127, 74, 4, -150, 49, 306, -961, 577, 25, -234, -226, -88, 105, -53, 9, 36, -36, 16, 102, -24, 17, -138, 182, -167, 161, -288, 146, -175, -86, -644, 32, 96, 305, -2, -66, -135, 199, 9, 185, 438, -165, 130, -235, 55, 292, -61, -41, 15, 66, -164, 110, 214, -78, -15, 310, -90};
-const int16_t frontalface_alpha1_array[]={534, -477, -386, -223, -199, 142, -432, -378, -219, 318, -414, -497, -142, 68, -684, -277, -90, 237, 296, -107, 373, 286, -89, -155, 99, -259, -421, 118, -167, -357, -129, 93, -77, -103, 269, -416, 72, -259, -42, 388, 451, -80, -25, -103, 43, 227, -95, 16, -447, -240, -13, -468, 295, -400, -147, -373, -213, -80, -111, 381, -246, -626, 44, 124, 45, -501, 253, -660, 368, -126, -596, -216, -369, 46, 17, 100, 37, 63, -193, -93, -594, 108, 284, -851, -311, -123, -276, -307, -112, -47, 77, 319, -152, 72, 123, 68, -335, 116, -443, -49, -412, 190, -68, -15, -89, -268, 211, 52, 52, -332, -335, -269, -351, -9, -255, 370, -95, -147, 4, -20, -294, 95, 67, 193, 57, -323, 222, -355, 16, -137, -90, -150, -85, 178, 220, 49, -228, -322, -220, -191, -323, -251, 164, -61, -87, 281, 402, -70, -280, 78, 66, -315, 104, -24, -105, 64, -240, 318, -83, 89, 14, -262, 263, 55, -408, -263, -378, -61, 74, -59, -309, 62, -350, 54, 83, -72, -591, 73, -69, -392, 19, 36, -282, 3, -88, 51, -104, -569, -73, -227, -285, -258, 66, -146, -141, -329, 446, -269, 145, 334, -118, -106, 92, -228, 75, -203, 39, 8, -100, 22, 141, -473, -123, -115, -216, 90, 47, -320, -208, -237, 144, 205, -217, -103, -391, 161, 150, -65, 74, -101, 53, 112, 240, 2, -259, -96, -206, -270, 51, -97, 54, -262, -263, -53, 225, 267, 35, -425, 204, -245, 50, -265, -315, -194, -99, -183, 141, -114, -279, 214, -65, 80, -268, 41, -176, 63, -129, 10, 36, -229, -116, 86, -202, -584, 100, 8, -277, -481, 37, -260, 39, -197, -29, 17, -450, 245, 119, 181, -281, -279, -67, -56, 47, -237, 502, 54, -300, -287, -43, 211, -295, -268, -279, 108, -235, -408, -169, 49, -162, -48, -27, -276, 87, 121, 249, -556, -164, -377, 108, 6, 40, -103, -510, -159, 259, -262, -291, -145, 78, -440, 59, -311, 83, -81, -28, 101, 0, 192, -212, -152, 40, 8, -133, -136, 51, 11, -233, 23, 54, -69, -26, 16, -237, 34, 50, -292, 43, -121, -553, 11, -8, -337, 94, -65, -19, -201, 435, 198, -382, -546, 145, 173, 63, 3, -2, 115, -243, -515, 101, -63, -14, 11, -125, -76, -153, -7, 95, -255, 36, -54, -337, 126, 108, -7, -202, -576, -65, -57, -73, -8, 152, -122, 58, -66, -153, 181, -143, -182, -285, -104, -97, -179, -139, -25, 216, 67, 39, -509, -82, 152, 5, -112, -228, 54, 3, 257, -376, -208, 29, 33, -301, 161, 47, -238, 9, 93, 50, -429, -787, 54, -293, 214, -71, 45, 246, 2, -136, 210, -50, -6, -347, -165, 215, 49, -186, -92, 14, 120, -290, 251, -72, -163, 95, -334, -523, 198, 44, -384, 73, 354, -57, -406, -305, -39, 66, -22, 192, 31, -93, -19, 200, -229, 211, 4, 289, -147, -5, -139, -313, 37, -71, -62, -219, 177, -42, 112, -250, -231, -202, -77, -230, -107, 117, 233, -376, -268, 74, -329, -219, 41, 40, 5, -42, -249, 252, 121, -245, -134, 43, -290, 66, 50, -13, 272, -47, -7, 255, -7, 0, -391, 8, 196, 41, -250, 118, 65, -206, -336, 51, 249, -48, -174, 48, -60, 63, -266, 131, 414, 764, 154, -158, 169, -287, -275, 207, -5, 173, 14, -33, -96, -149, -77, 151, 248, 233, -154, 11, -239, 46, -330, -11, -3, -68, -131, 106, -63, -57, 16, 48, -242, 94, 246, -785, 58, 0, 243, -25, 2, 165, -9, 177, -103, -165, 250, -26, 156, -260, -105, -149, -237, 30, -148, -98, 301, -220, -191, 235, 68, -72, -157, 147, 83, 22, 88, 60, -190, -231, -88, -239, -136, 235, -181, -222, -58, -77, 68, -302, -139, -69, -233, -112, 6, 202, 205, -51, -11, -231, 90, -50, -358, 0, -125, -312, 95, -75, -368, -577, 96, -75, -255, 12, 38, -3, -36, -4, -443, -61, 1, 9, 19, -434, 161, -85, 58, 49, 23, -446, -61, 301, 35, -139, -55, 16, 175, 445, 78, -54, -203, 95, -3, 310, -5, -271, -8, 9, -20, -491, 123, -50, 50, -49, 463, 199, 39, -42, -26, -9, -14, 71, 32, 5, 48, 18, 12, -69, 13, 97, 39, 6, 41, -157, -217, -208, -93, -304, 84, -130, -268, -129, -254, -24, 59, -26, 0, -167, 72, 39, -74, 349, 312, -209, -312, 30, -299, -273, -92, 125, 150, -19, 70, -1, 210, 33, -232, 2, 455, 146, -82, 49, 17, -99, -6, -491, -328, -103, -186, 148, 234, -132, 61, 42, -349, -437, -80, 38, 190, -104, 208, 84, -321, 353, -9, -47, -114, 173, -3, 86, -271, 37, -62, 33, -268, -387, 35, 73, -69, 47, 83, 29, -283, 205, -67, 4, 3, -78, -411, 19, -1, -61, 490, -64, -177, 46, -7, 16, 2, 38, 99, -397, 55, -12, -65, -46, 139, -177, 75, 236, -203, 84, -351, 16, 92, -39, 34, 27, -2, 0, -120, -2, -88, 383, -254, -147, -8, 102, 46, 139, 174, -230, -144, 92, -142, -274, -183, -120, 54, 171, -244, 208, 315, -78, 54, -231, 57, -101, 47, 39, 55, -378, -43, 9, 85, 1, 115, 39, -333, -62, 7, -57, 52, 175, -2, -51, 121, -283, 259, 106, 54, -296, 90, -393, 51, -6, 43, -306, -279, 71, -11, -67, 154, 97, 33, 30, -87, -43, 156, -124, -1030, -100, -22, 293, -5, 9, 144, -44, 323, 171, -105, -234, 0, -95, -108, -42, 38, 352, -86, 195, -177, -3, -26, 273, 47, -56, 65, -2, -73, -9, 84, -89, -368, -302, 566, -478, -196, -161, 218, -8, -49, 527, -29, -4, -10, -170, -14, 156, -146, 14, 44, -171, 75, -72, -27, -13, 115, -520, 43, -5, 77, -79, -460, -13, 53, -51, -244, -36, -279, 26, 15, -343, 12, -262, 21, -37, 168, -232, -127, -108, -122, 130, -59, 103, 115, -217, -238, -327, 149, -13, -222, -19, -63, -287, -371, 137, 17, 292, -63, -10, 150, 39, 43, -38, -102, 71, 0, 105, -365, -64, 11, -240, -69, -264, 161, 41, -64, -74, -2, 28, -49, 79, -1, -117, -3, -19, -68, 46, -48, -37, -134, -98, -1, -148, 5, -166, -86, 38, -64, -28, -249, 97, -266, -1410, 244, 2, 57, 42, -221, -721, -331, -208, 168, 1, 78, 65, -367, -43, -166, -13, -235, 137, -139, 39, -62, -130, -55, 29, -3, 311, -64, 57, 64, -83, -14, 0, -78, -62, 120, 98, -12, 54, -43, 29, -11, -103, -84, -185, -40, 49, 210, -110, -7, 28, 557, -12, -83, 294, -99, -429, -249, 53, -42, 60, -237, -188, 36, 2, -304, 622, 183, 40, -208, 238, -144, -202, -362, 97, -104, -61, -223, 39, -293, 39, 10, 111, 111, -24, -97, 228, 220, 153, -406, 43, 130, -110, -80, 270, -183, 63, -176, -151, 11, -157, -78, -351, -143, 1, 400, -404, -397, 44, -334, -353, -181, -10, 147, -126, -125, -154, 60, -20, -308, 59, -207, 157, -75, -156, -136, -329, -43, -28, 261, -200, -225, 29, -207, -18, -329, 121, -15, 44, -51, -17, -326, 31, 3, 158, -92, 134, -43, -304, 214, 90, -225, -36, -74, -8, 177, -165, -7, -2, 217, -531, -219, 98, -441, 140, -9, 149, -3, 38, 132, -5, -220, -116, 33, 33, -64, 5, -100, 21, -46, -158, -12, 45, -215, -48, -203, -60, -14, 67, -171, 172, 77, 37, -47, 48, 115, 34, -53, 82, -51, 40, -160, 42, -64, 39, 145, 146, -98, 56, -73, -166, -74, 116, -131, 4, 100, 304, -174, -217, -282, -50, -104, -75, -334, 60, 74, -620, 225, 205, 37, -208, -181, -186, 43, 708, 29, -1, 59, -79, -12, -297, -69, -138, 46, 160, 61, -240, -19, 10, 43, -8, 24, -101, -58, -70, -27, -12, 38, -5, -205, -53, 51, -46, 127, 299, -16, -59, -210, 155, -10, -294, -2, 96, -25, 171, 40, 97, 38, -174, 65, -7, -90, -9, -6, 27, 119, -72, -5, -83, -313, -4, 167, -133, -200, 0, -13, 4, -159, 45, 11, 116, 85, -598, -169, 117, -68, -47, -6, -8, 1, 108, -5, -8, 28, 74, 30, 37, -137, -15, -115, 310, -590, -183, 18, -313, 34, -7, 34, -37, 49, -95, 207, 214, -242, 11, -497, -54, 153, -56, 161, -59, 46, -178, 88, -224, 60, -15, -50, 247, -15, -116, 29, 463, 59, 126, 155, 102, -217, -202, -172, 9, 35, -35, 35, -51, -119, -241, 83, 70, 60, -147, -156, -144, -205, -207, 35, -42, 369, 34, -86, -29, -254, -123, 9, -278, 244, -265, 230, -259, 157, -21, 16, -239, -215, 155, -7, 33, -289, 194, 76, 5, -218, -15, 91, 0, -8, 151, 152, -300, -4, 41, -57, 70, -194, -58, 49, 42, 328, -138, 162, -127, -303, 5, 7, -53, 0, -56, -2, 114, -52, -196, -361, 49, 215, 32, -119, 132, -7, 62, 250, 51, -65, 43, -219, 143, -65, 1, -154, 107, 58, 23, -68, -185, -89, 29, -2, 52, 148, 4, -84, 351, 0, -3, 96, -703, 121, -148, -2, 89, 364, 61, -2, -4, -231, -54, 50, -23, -141, 47, 496, -67, -140, -655, -63, 41, 56, 79, -244, 32, -15, 10, -11, 10, 7, 264, -17, -152, -16, 14, -1, 37, -45, -152, -276, 199, -16, -4, -14, 87, -67, -33, 7, 6, 115, -50, -138, -3, 17, 174, -52, 182, -94, -220, -69, -88, -81, -176, -53, -126, 343, 11, -182, 257, -3, -209, 138, -86, -306, -227, 42, 160, -72, -163, -196, 116, -195, 11, -12, -5, -245, -179, -72, -64, -178, 117, 46, -161, -263, 88, -74, -113, 45, -2, 423, -1, 0, -158, 180, 100, -6, 120, 82, -314, 11, -42, 86, -218, 14, 133, 160, -157, -216, -16, -45, -7, -62, -60, 100, -68, 44, -277, 184, -304, 161, 338, -86, -65, 36, -298, -101, 126, 479, -227, -298, -171, -122, 30, -19, -51, 236, -68, -138, 4, -3, -45, 53, 5, -4, -48, 104, -52, -434, -7, -51, -115, 60, -46, -70, -118, 106, 37, 192, -48, 90, -164, 4, 270, 76, -55, 61, -8, -1, 19, 20, -35, -476, -47, 36, 411, -207, -356, 8, -141, 5, 113, 46, -16, 51, -81, 222, 163, 44, 61, 138, 612, 40, 0, -29, -269, -51, -54, 28, -439, 165, -2, 50, -221, 35, 86, -640, 129, -750, -153, 86, -283, 114, -266, 8, 135, -137, -128, -84, -81, 27, -36, 241, -139, 3, -80, -1, -195, 61, -24, -202, -26, -103, 52, 0, -1, -93, -365, -10, 67, -214, -125, -48, 59, -9, -456, -55, -45, -2, 77, -243, 8, 250, -5, -14, 167, 6, -1, 87, -1, -134, -149, 5, -93, 9, -37, -55, -277, -39, 11, -396, 42, -197, 28, 283, 70, -206, 36, 50, -12, -42, -32, -8, -16, -93, 30, -133, 166, 44, -50, -130, -17, -104, -54, -127, -52, 46, 3, -53, 63, -488, -182, -43, 48, 1, 43, -578, 616, -69, 80, -371, -4, -59, 36, -56, -29, 6, 45, -37, -134, 225, -123, -54, -18, -63, 2, -45, 33, -11, 44, -289, -57, 116, -38, -174, 166, 114, -22, -119, 74, -309, -11, -68, -33, 497, 39, -182, 235, -57, -185, 319, -370, -200, -218, -38, 140, 93, -8, -157, -16, -87, -77, 19, -249, 47, -15, 83, -75, -310, 33, -169, 42, -13, 51, -201, 73, 442, 4, -19, 81, 196, 47, -60, 44, -11, 205, -209, 38, -186, 145, 10, -507, 128, 102, -196, 221, -143, 10, -49, 47, -12, 362, 337, 12, -53, -319, 66, 58, -220, 80, 64, 68, -138, 183, -149, -190, 45, -275, 6, -115, -69, -125, 106, 41, -282, 166, 107, 90, -74, -338, -224, 66, -253, 162, 6, -144, 0, -24, -167, -119, -271, 129, -78, -285, -222, 168, -58, 46, -84, -30, 98, -228, 137, -14, -390, 19, -50, -163, 21, -110, 102, 135, -99, 224, -298, 279, 35, 34, -3, 45, -135, -28, 100, -65, -6, 202, -122, -44, 0, 4, 51, 47, -15, -83, -159, -8, 50, 52, -145, 191, 217, 42, -340, -15, 195, 57, -407, 30, -335, 0, 167, 18, -172, 85, 116, -11, 68, -212, -172, -18, 7, 34, -152, 103, -278, 74, 167, -501, -58, 40, -99, 439, -97, -791, -35, -16, -144, 64, -670, 15, 239, 35, -3, 15, 182, 37, -95, -60, -7, 47, -39, 38, -42, -18, -5, -46, -116, 68, -39, 17, 70, -787, -374, 226, 35, -263, 19, 30, 172, 54, 114, 9, -50, 34, 215, 44, -45, -36, 267, 28, -201, -155, -3, -523, -107, 6, -44, -56, -17, 330, -297, 17, -45, 56, 158, -118, -32, -77, -57, 64, 74, 49, -193, 21, -68, 34, -103, 41, 79, -68, 39, 293, -182, 106, -341, 36, -12, 163, -55, -206, -81, -164, -117, 117, 93, 6, 44, -246, -181, 18, -191, 174, -32, 18, 244, -72, 98, 0, 217, -236, -139, -1, 184, 49, 29, -13, -27, -46, 42, 52, 239, 0, 0, 185, 256, -11, 3, -241, -111, -45, 148, -5, -36, 249, -21, -529, 112, 73, -146, 88, 143, -37, 61, 110, 5, 46, 38, -50, 0, 323, 166, -264, -122, -53, 132, -54, 46, -37, -72, -114, 10, 101, 563, -71, 87, 73, 163, 20, -114, -251, 58, 214, 29, -9, -346, -45, 32, 205, 41, 39, -471, -206, -35, -6, -188, -116, 53, 102, -5, -127, 45, 11, 44, -118, 13, 38, 35, -73, -77, -251, 12, 60, 120, -53, 42, -144, -911, -9, -144, -7, -136, -56, 36, -88, 245, 445, 355, 13, -23, 9, 243, -34, 58, -56, 329, -1012, 96, -6, 43, -239, 33, -292, 126, -79, -97, -47, -151, -39, 82, -40, 193, -226, 61, -479, 33, -6, 119, 102, -400, -492, 34, 261, -24, 28, 154, -48, 29, -71, 185, -49, 39, -14, -412, -15, 41, -45, 1190, -43, 233, 56, -230, -96, -97, -46, -57, 181, 122, -47, 10, -59, -117, 85, -42, 57, 38, -380, -49, 34, -277, -151, -125, 152, -302, -156, -292, -421, -79, -177, -183, 57, 264, 115, -218, 148, -96, -67, -7, 52, 171, 44, -214, -8, 107, 17, -40, -181, -41, 99, 4, 12, -69, 216, 39, -237, 132, 35, -230, 50, 24, -15, 62, 156, 232, -80, -170, 15, 204, 48, 150, -65, -3, 52, -274, -148, -169, -123, 147, -13, 31, 28, -444, 34, -120, 178, 431, 203, -259, 36, 129, -40, -139, -44, 64, 238, -8, 89, 17, 36, -263, -50, -198, 33, -39, 38, -182, 284, 238, -50, 107, -132, -11, 13, -60, -226, -52, 34, -44, 14, 40, 182, -40, -88, -142, -924, 132, -22, 7, 60, -10, 117, -195, -957, -163, 49, -41, 5, -434, 303, -104, 39, 125, -62, -12, 111, 48, -112, -52, 79, -79, 35, -130, 122, 115, 33, -10, -88, 1, 20, 297, -82, -46, 0, -37, -101, -46, 37, -15, 87, 79, -9, -45, -258, -137, 123, 67, 9, -153, 39, -37, 3, -4, 91, 306, -158, -467, -7680, -61, -8, -39, -15, -165, 278, -66, 35, -53, 37, 7, 323, -32, -175, -122, -120, 65, -123, -61, 194, -89, -202, 120, 171, 63, -55, 71, 14, -255, -305, 38, -363, -72, 121, -15, -219, 42, -300, 67, 9, -10, 73, -360, -54, 86, -64, 10, 135, 64, 1, -127, 21, -133, -161, 329, 213, 28, -345, -346, 103, -67, 150, -42, 3, -4, -61, -137, 192, -41, -44, 59, 64, 33, -214, 603, 48, 37, -11, 45, -252, -41, -61, 36, -266, 50, -232, -7, -255, 187, 71, 1, -51, 165, -47, -74, -17, -3, -53, -91, 277, 54, 132, -112, 8, 3, 87, 84, -64, 35, -3, 48, 89, -9, -109, 170, -125, 33, -14, -147, 249, 45, -207, 71, -34, -17, -46, -40, 74, 113, -49, -2, -108, -218, 214, 25, -47, 64, -90, 41, -37, -54, -182, 8, -69, 92, -12, 33, -275, 6, -66, -454, 76, 50, -110, -130, 199, -161, -11, 30, -4, 22, 10, -486, -15, 227, -56, 147, -138, -20, -51, 106, -7, -30, 84, -5, -112, 30, 234, 28, -36, 51, 83, 40, -19, 29, -42, 57, -49, 29, -229, 91, -117, 60, -7, -130, -138, -227, 206, 3, -11, 18, -50, -1391, 114, -3, -38, 118, -422, -9, 88, 31, -15, 4, -70, -45, -82, 32, -127, 11, -10, 0, -391, 9, 25, 159, -238, -103, 24, 95, -59, 10, -127, 8, -128, 9, -16, 124, 34, -113, 7, 3, 3, 74, -103, 84, -136, -369, -202, -68, -139, 5, -127, -202, 204, -84, -69, -135, -144, -44, -23, -14, 60, 45, -109, 148, 8, 17, -321, 136, 298, 100, -188, -36, 30, -362, 113, -356, 131, -14, -20, -221, 133, -41, -43, -1, 162, -86, -8, 165, 13, 167, 49, -238, -174, 3, 257, -59, -185, -56, 42, -61, 130, 231, 35, -169, 205, -85, -142, -15, 87, 71, 300, 209, -47, 83, 50, -239, 6, -54, 189, -49, 178, 100, -18, 244, -13, 19, 13, 184, 36, 10, 137, -11, 8, -66, 40, -187, 21, -90, 72, -215, 38, -48, 113, -14, -79, 420, -199, -59, -92, 199, 302, -120, 56, -9, 107, -42, 40, -1, -7, -58, -15, -76, 56, 311, 3, -382, -98, -54, 0, -159, -108, 6, 33, 301, 8, -81, 216, 94, -133, -15, 202, -299, 10, -91, 53, -48, 65, 8, -253, -34, 86, -46, -251, -8, 298, 163, -59, -56, 41, -43, 66, -196, -69, 19, -9, -45, 48, 180, 17, 192, 49, -12, -114, 166, -14, -39, -156, -12, 28, -204, -48, -34, 124};
-const int16_t frontalface_alpha2_array[]={-567, 339, 272, 301, 322, -479, 112, 113, 218, -402, 302, 179, 442, -558, 116, 137, 238, -169, -76, 347, -50, -135, 292, 197, -387, 375, 256, -408, 212, 108, 269, -344, 371, 310, -117, 39, -400, 59, 327, -77, -13, 393, 239, 246, -757, -112, 102, -677, 72, 59, 275, 25, -274, 196, 353, 132, 149, 299, 244, -35, 70, 60, -343, -230, -418, 46, -97, 63, -75, 161, 13, 99, 25, -322, -609, -70, -291, -324, 69, 181, 9, -12, -89, 54, 277, 359, 189, 96, 323, 117, -245, 11, 138, -381, -134, -409, 39, -184, 17, 174, 19, -55, 335, 312, 217, 76, -83, -214, -171, 35, 19, 49, 17, 199, 31, 3, 135, 100, -542, 252, 24, -37, -148, -43, -163, 64, -69, 60, -323, 77, 135, 61, 132, -3, -66, -151, 267, 141, 163, 136, 92, 92, -128, 218, 292, -46, -80, 267, 50, -340, -179, 57, -131, 158, 121, -175, 29, -14, 211, -45, -396, 61, -81, -211, 13, 33, 9, 126, -146, 163, 16, -255, 9, -266, -138, 113, 0, -165, 205, 54, -270, -219, 16, 162, 144, -385, 96, 31, 173, 243, 125, 127, -320, 152, 77, 57, -25, 47, -119, -67, 106, 151, -117, 36, -249, 46, -339, -536, 131, -328, -118, 11, 88, 109, 42, -120, -427, 9, 59, 25, -48, -97, 50, 129, 59, -81, -3, 266, -213, 116, -384, -98, -27, -430, 61, 119, 45, 18, -395, 96, -317, 13, 58, 314, -11, -55, -486, 1, -21, 16, -195, 210, 75, 148, 229, 129, -180, 181, 68, -98, 66, -150, 43, -224, 60, -144, 98, -355, -273, 50, 111, -114, 57, -1, -133, -386, 47, 0, -568, 15, -303, 31, 181, -269, 49, -64, -54, -71, 62, 14, 50, 269, -440, 15, 7, -123, 41, 10, 82, -67, 38, 10, 39, -108, 47, 0, 79, -166, 39, 391, 166, 9, -25, -87, -4, -7, 42, 0, -45, -327, -388, 83, 38, 284, -157, 101, 73, 115, -174, 15, -442, 31, -207, 172, 215, -121, 242, -80, 45, 63, -109, -409, 96, 63, -369, -348, 69, -208, -191, 207, 220, -253, 39, -180, -103, 18, -184, 67, 37, -275, 311, 3, -39, 180, 85, 19, 12, -62, 31, -6, -30, -68, -165, -317, 260, -92, 52, -5, -75, 277, 311, -272, 43, 132, 63, -592, -83, 18, -441, 260, 38, -74, -86, -600, 39, -7, 60, 236, 79, -693, -8, 58, -267, 196, 71, -65, 280, 135, 103, 189, 188, 97, 93, 203, -84, -247, -271, 34, 154, -54, -375, 52, 26, -102, -411, -34, 2, 66, -183, -421, 6, -26, -137, 51, -258, -70, -136, 53, -9, -182, 4, -16, 203, -175, -55, 319, 37, -3, 276, 291, -1, 61, -52, -312, 13, 74, -171, 4, 6, 7, 151, 67, -85, 40, -6, -11, -114, 36, -97, 16, 203, 29, -1, 104, -98, 196, -57, -372, 66, 124, -56, 37, -51, 69, -48, 40, -419, 61, -1, -115, 112, 64, 6, 0, 389, -55, 5, 164, 147, 336, 74, 136, -114, -70, 52, 17, -133, 11, 47, -176, -215, -349, 66, 16, -4, -83, 51, 57, -274, 9, -183, -136, 249, -60, 117, -682, 6, -555, 191, 2, 254, -63, -156, 7, -34, -133, 38, 0, -157, -53, 122, 28, -383, 208, -17, 12, -1, -47, 24, -69, 40, -60, 50, 5, -4, -444, -14, -197, 171, 79, 65, 105, 4, -53, 10, 43, 209, 6, -87, 0, 64, -366, 85, 33, -79, 181, 49, -227, -70, 6, -44, -51, 29, -116, 100, -51, 52, -261, -23, -493, -17, 47, 56, -47, 95, -68, 147, 258, 144, 79, -286, 84, 134, -8, 30, 53, -72, -179, 187, 39, -87, -33, -245, -119, -134, 55, 16, 55, 12, 44, -56, 46, 14, 134, 143, -179, 11, 66, 148, 50, 54, 197, -63, -9, 282, 184, 11, -96, 286, 49, -297, 42, -3, -21, 152, 34, -8, 4, 136, 41, -192, -167, -314, 110, -305, 36, 138, 144, -203, 379, -7, 8, 76, -97, -135, 538, -10, 91, -45, -332, 35, 100, -184, 16, -42, -42, 187, 52, -75, 103, -44, 178, 0, 137, -191, 85, -9, 4, 186, -125, 197, 17, -47, -410, 304, 100, -412, 138, -81, -263, -202, -214, -160, 402, 98, 134, -72, -78, -223, -51, 20, 145, 114, 173, 49, -182, 29, 51, 93, 32, 147, -134, 122, -398, 48, -114, -54, 133, 7, -57, 37, 4, -252, 5, 50, 97, -37, -71, 154, -96, 264, -57, -303, 11, 274, -44, -18, 102, -311, -182, 46, -395, 42, -4, 60, 14, -4, -54, 47, -101, -657, -3, 42, 84, -124, -57, 48, -53, -153, -5, 15, -394, 95, 35, -4, -313, 0, -3, -317, 131, -181, 0, 37, -119, -106, 111, -243, -78, -506, -2, -8, 99, 150, -242, 54, -7, 297, -285, 53, -40, 46, 11, -191, -428, 195, -226, -630, -76, 41, -95, 152, 141, 104, -60, 40, -87, 24, 8, -13, -5, 234, -73, 136, -113, -655, -283, 145, 32, 223, 53, 14, -2, 43, -355, 0, -106, 4, -50, 132, 180, -171, 91, 48, 67, 68, -276, -71, 61, -63, 1, 181, -368, 12, -114, 88, -343, -132, -186, -6, 49, -224, -61, -320, -21, -124, 46, 159, 236, 198, -278, -59, 158, 258, 11, 1, 4, -73, -42, -2, -75, -7, -182, -388, -99, -5, 37, -105, 105, 141, 4, -75, -118, -132, 53, 367, -10, 34, 27, 57, 96, -50, 149, -171, -19, 298, 11, -55, 51, 10, 91, 49, 62, 325, -551, -41, 54, -50, 55, -255, 125, -44, -191, 139, -129, -245, 43, -336, 3, 61, 39, -3, 16, -11, 39, 13, 1, -341, 95, -38, 65, -267, 101, 8, 96, -53, 45, -165, -253, 8, 0, 120, 146, -487, -2, -13, -314, -277, -94, 60, 39, -486, 5, 156, 47, 550, 33, -132, 316, -8, 411, -1, 243, 495, -178, 78, 146, 148, 110, -51, 281, 14, -85, 57, 15, 47, -66, 182, 19, 232, 185, 53, -3, -29, -196, 10, 151, 83, -65, -143, -134, 75, 64, -120, -289, -67, -4, 40, -179, 59, 116, 36, -65, -453, 138, 85, -298, -638, 245, -65, -258, 49, -256, 106, 100, -92, 237, 85, 23, 62, -322, 43, -224, 33, 56, -129, 117, 142, 4, -43, 1, 28, -47, 210, -88, -356, 0, 29, -6, 30, -53, 136, -79, -13, -3, 107, 10, 162, 2, -16, 21, -102, 131, 35, 160, -698, -276, 8, 112, -61, -78, 66, -501, 189, 67, 43, -66, -73, -451, -6, 263, -319, -439, 52, 52, 51, 427, -90, -46, 31, -296, -1198, -37, 87, 78, 6, 55, 40, -2, -176, 311, -105, -4, 49, -107, 200, -8, 16, -48, -202, 150, -75, 106, 43, 6, -106, 91, 220, 25, -177, 9, -177, -247, 0, -83, 185, 77, -26, -55, -40, -5, -97, -69, 67, 142, 7, 16, -53, 16, 71, -226, 40, 108, 40, 31, 210, -43, 37, -7, -177, -6, 37, 9, 205, -63, 50, 34, 47, -89, 53, -3, -116, 3, 8, 69, 44, 17, 30, 284, 117, -47, 36, 2, -282, 0, 89, -7, -37, -634, -112, 180, 157, -6, -275, -181, 8, 44, 3, 287, 44, -46, -61, 0, 66, 66, 150, -55, 39, -290, 318, -48, 31, 2, -29, -14, -10, -276, 0, -216, -203, -54, 109, 0, 57, -98, -203, 104, 203, 29, 320, 197, 40, -471, -39, 0, 43, 1, 63, -469, -98, 5, -3, -72, -360, 204, -21, -56, -330, 139, -41, 136, -43, 10, -264, 81, -418, -51, -172, 231, -327, 193, 57, 79, -98, 70, -310, -79, -52, 52, 9, 40, 302, 84, 106, 45, -114, -28, -10, -12, -52, -290, 4, 57, 10, -285, -37, -1014, -252, -191, 77, 134, -1, 60, 20, -171, -53, -267, 0, 157, -217, -130, -325, 696, 39, 35, 87, 123, -514, -28, -298, 36, 157, -192, 256, -8, -47, 74, 152, 45, -54, 154, -6, 145, -69, 63, -52, -194, -65, -73, 8, -68, -293, 76, -339, 180, -115, -15, 112, 180, 61, 29, -280, 19, 29, 42, -218, 107, -166, 39, -87, 202, -57, -1, -15, 51, -57, 63, 186, 73, -285, 170, -67, 48, -281, -750, -70, -160, -94, 49, -498, 47, -39, 28, 5, 252, -11, -301, -239, -383, 400, -173, 27, 7, -43, 33, -133, 33, 124, 2, 138, -5, 127, -56, 4, 18, -2, -73, -571, 104, -51, 69, 22, -280, -37, -108, -52, 7, -55, 36, -3, 32, -162, -120, 499, -542, 126, 195, 101, -162, -147, -175, 70, 62, 69, 29, 61, -169, 107, -48, -234, 100, 113, 0, 43, -205, 46, -53, 56, -48, 37, -60, 55, -154, 39, 3, -23, -358, -126, -3, 0, -75, 51, 12, 38, -67, 266, -301, -14, -62, 43, -273, -342, 116, -95, 4, 60, -82, -261, -44, 61, -53, 44, -8, 257, -153, 96, -183, 82, -198, -15, 147, 32, -13, -162, -46, -543, 22, 4, -282, -98, -43, -98, 90, -233, -5, 0, 88, 89, 10, -13, -82, 2560, 85, 45, 42, -394, -255, 3, -51, 277, 50, 17, -215, 93, -70, 27, -59, 44, -214, -44, -37, 3, -194, 195, -2, 56, -91, 66, 7, -171, -37, 53, 12, 33, 102, -182, -74, 0, -2, -301, -475, 99, -284, 252, -177, 17, -639, 38, -547, 200, -184, -349, 186, 49, -10, 0, -465, 53, -362, -30, 66, 44, -156, 77, -58, 53, 17, 133, -126, 20, 128, -149, 153, 55, 156, 129, 105, 24, 60, 46, 10, -209, 57, -50, 206, 5, -19, 108, 39, 2, -232, -66, 68, 25, 57, -67, 35, -185, 131, -277, 37, 7, 64, 119, 33, -61, -157, 8, 44, -70, 61, 36, -61, -242, 24, -220, 98, 7, 12, -61, 64, -59, -52, -10, 154, 229, -69, 5, 163, -59, 8, 8, 42, -508, 97, -235, 58, 138, -32, 82, -155, -7, 7, -11, 2, -38, 43, 121, -89, -10, 40, -51, 22, -1, 36, 1, 38, -115, 71, 172, 23, 85, 35, -174, 138, 201, -122, -156, 106, 189, -34, 157, 37, -279, 57, 14, -54, 158, 64, 10, 0, -86, 2, 123, -44, 2, 81, -44, -2, 121, -68, -261, 146, -107, 737, 534, 36, 138, -400, -37, 33, -14, 147, 5, 95, -58, -104, -433, -117, 39, 8, -47, -122, -67, 13, -34, -173, -187, 78, -8, 83, 111, -1218, -15, -8, -196, -21, -6, -570, -61, 32, -50, 35, 7, -36, -12, -17, -10, 209, -48, 155, 112, 140, 118, -251, 182, -55, 64, -276, 131, -318, 52, -89, 52, 5, 140, 68, -261, -223, 205, 58, 36, -489, -83, 0, 42, 213, -18, -295, 38, 129, 74, -228, -11, -5, 247, -44, 70, -455, -6, -180, 84, -77, 148, 11, 48, -176, 39, -153, 96, 132, 36, 302, 234, -14, -256, -1, -431, -39, -47, -4, -65, -79, 107, 237, 103, -253, 65, 30, -263, 8, 0, -87, 38, 7, 47, 20, 57, 16, 56, -111, 97, 102, -68, -17, 40, 198, -154, -158, -181, -18, 21, 70, -15, -15, 129, 78, -128, 100, 51, -136, -160, 363, 40, -42, 38, 108, 37, 68, 110, 177, -86, -346, -15, -10, 60, -54, 53, -2, 11, -60, 70, 19, -5, -10, 128, 67, 81, -35, -7, -3, 11, 81, 43, -37, 31, -6, 42, 288, 9, -52, 138, 0, 107, 32, 55, -105, 28, -76, 63, -59, 39, -13, -595, -2, -171, -324, 3, -6, -7, -36, 96, -867, 4, -45, -79, 84, -46, -289, 17, -4, -47, -4, 3, -106, 30, -50, -6, -6, 16, 0, 125, 130, -41, -289, 22, -37, 219, 86, 30, -62, -75, 0, -36, -72, -72, 156, -105, 75, 36, -175, 31, -262, 54, 124, 80, -76, -255, 5, -7, -68, -96, 105, 33, 0, -54, -2, -14, -187, 42, -238, 64, 17, 41, -5, -39, 188, 46, -3, -9, 108, -252, 54, 76, -62, 36, -52, 102, -13, 318, 153, 40, -116, 57, -61, 10, 36, 21, -8, 13, -86, -104, -209, -83, 11, 56, -56, 45, -223, 5, 13, 88, -167, 150, -82, -60, -411, 38, 3, 142, -96, -109, 11, 11, -45, -76, -12, 47, -46, -16, -15, -361, -13, 113, -47, 208, 0, 14, -51, 58, -66, 33, 4, 36, -143, -75, 3, 0, -10, -64, -46, 37, 87, -258, 21, 15, 21, 30, 486, 66, 11, -10, -18, 220, -40, -654, -181, 422, -44, -20, 25, 68, -217, -143, 248, -281, 210, 73, -200, 52, 16, -45, 283, 178, -64, 29, -13, 11, -88, 29, -112, -186, -46, 9, -53, 71, 139, -28, -42, -201, 170, 41, -40, -1149, 3, 33, -187, 35, 20, 107, 165, 36, -599, 21, -13, 188, 178, -52, -45, 48, 839, 60, 76, -34, -74, -174, -3, 278, 50, -145, 36, -142, -58, 50, -87, 23, 0, 6, -12, -131, -305, 9, 126, 102, 176, 65, 79, -70, -69, -226, -139, 6, 54, -174, 60, -54, 172, -206, 4, 120, -15, -260, 1, 0, 63, -240, 2, -91, -417, -434, 132, 243, -296, -84, 0, -198, 190, -47, 8, -327, 170, -5, 59, 219, 7, -247, 132, -46, 81, -15, 5, -74, 59, -66, 15, 419, -114, -60, 206, -84, -363, 149, 99, -40, 2, -8, 41, 139, -3, 194, -189, 393, 52, 13, 75, -72, 22, 64, 4, -64, 22, -104, 44, -9, -206, -44, -503, -263, 31, 190, -113, -44, -31, -85, 37, -7, 84, -213, 45, 17, -96, -53, 116, 19, -72, -141, -53, 17, 193, -81, -291, 48, 42, -5, 135, -71, 16, 130, -371, 6, 30, -261, 47, -212, 36, 122, -156, 30, 16, -36, 16, -138, 100, -138, 9, 586, -153, 95, 12, -18, -11, -204, -161, -10, -404, -12, -8, 43, 41, 144, 30, 237, -41, 260, 8, -2, -29, -17, -172, -190, -6, -54, 36, -17, -579, -38, 106, -106, 15, 118, -338, 49, 19, 117, -127, -394, 29, -375, -28, 146, 24, 222, 14, -71, 75, 155, 100, 150, 163, -37, -74, 134, -228, 113, 45, -76, 409, -136, -107, 33, 251, -144, -2, 34, 24, -10, -7, 57, -7, 32, 65, 39, 0, -141, -44, 10, -3, -4, 35, 60, -331, -47, -50, -83, -1, 151, -60, 187, 279, 43, 257, -13, -240, 139, 103, 8, -89, 43, -51, -126, -4, -42, -106, 181, -78, 6, -42, 51, 1, 224, -44, -155, -49, 41, -196, -29, -9, 47, 1, 31, -49, 62, -99, -7680, -16, -179, 15, 0, -36, 0, -4, -107, -52, 45, 7, 77, -67, 18, -219, -12, -115, -119, -11, 73, -2, -902, 375, -333, -2, 21, -43, 64, -62, 51, -272, 127, 106, 34, 149, -805, 177, 77, -81, 14, 235, 51, 5, 33, -49, 40, -141, -11, -241, -1, -5, 28, 2, -21, 290, 195, -15, 23, 21, -281, -51, 36, -315, 3, -82, 58, 130, 18, 40, -45, 14, -18, -50, -220, -290, 40, -157, 178, -38, 44, 158, 108, 320, 36, 152, -201, -364, 7, -57, 81, 166, 28, 5, 8, -65, 232, 2, -245, 350, 55, -226, 16, -38, 32, -16, 28, 93, 70, 276, 52, 6, 14, 53, -400, 134, -335, -130, 16, 787, 99, 115, 109, -170, 71, 113, -64, 88, 8, -15, -62, -123, 184, -87, -210, 48, -7, -138, -10, 39, -56, 155, -3, -70, -10, -14, -140, 123, -84, 32, 138, 11, 106, 176, -58, -55, -185, 47, -118, 61, 8, 19, -47, -7680, -12, 40, -64, 47, -49, 58, -170, 165, 89, 53, -45, 78, 256, -16, -78, -240, -6, 21, -79, -216, -342, -155, -9, 83, 75, -384, -11, -37, -9, 153, -9, 14, -67, 91, 131, 0, 157, 46, -493, 157, 113, 62, -38, -46, -48, 58, -132, 89, -55, -73, 67, -127, -197, -82, -57, 131, 12, 1, 17, -485, -365, 46, -42, -71, -4, -1, 650, 73, 167, 69, -64, 14, 119, 65, 18, 43, -45, 611, 159, -16, 27, -234, 381, 50, 0, 267, 69, 14, -247, -89, -13, 71, 53, 29, -57, -25, 20, 41, -44, 32, -284, -1234, -163, 628, -130, 28, -362, 10, 85, 11, 0, 91, 112, -11, -235, 51, -59, 68, 12, -724, -40, -510, 334, -11, -52, -244, -541, -412, 179, -102, 113, -403, -10, -3, 6, -16, -215, 41, 1, 34, -41, 141, -275, 299, 97, 28, -47, 47, 243, 9, -16, 107, -54, -544, -380, 82, 48, 71, 68, -155, 5, 124, -238, 87, -15, 164, -101, -117, 55, 108, -162, -77, 103, -199, 41, -204, 65, -181, 189, -62, -33, 35, 229, -220, 218, -75, 49, -65, 55, -11, 48, 80, 42, -159, 49, -3, -8, 53, 47, 13, 49, 244, 63, -419, -23, -91, 51, -48, 209, -117, 36, -52, 13, -56, 36, 458, -483, -14, -26, -12, -23, -365, 82, -8, -4, 279, 79, -176, -1, 32, 100, -51, 232, -50, -132, -8, 32, -162, 16, 79, 43, 90, -190, 106, 0, -42, -133, 0, 15, 37, 33, -350, -1, -79, 21, -45, 36, -60, -5, -5, 118, 102, 7, 111, 17, -53, 92, -39, 71, -93, 106, -43, -167, -117, 18, -257, 108, 67, -266, -5, 400, 37, 0, -9, -223, 152, -14, -348, 65, -36, 43, 73, 52, -39, 19, 20, -94, -236, 20, 183, -224, -151, 123, 86, 80, 45, -75, -36, 142, -16, 50, 75, 171, 0, 30, -129, -55, -38, 102, 29, 21, -48, 40, -273, 13, -15, 169, 15, -63, 101, -24, -117, 37, 404, 19, 120, 30, -214, 20, -45, 32, 69, -110, 150, -9, -5, 36, -106, 53, 162, -131, -45, 175, -40, -62, -225, 45, -42, 88, 221, 30, -230, -277, -8, 55, 430, 0};
-const int8_t frontalface_num_rectangles_array[]={2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2, 3, 2, 2, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 3, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 2, 2, 3, 3, 2, 2, 2, 2, 2, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 3, 2, 3, 3, 2, 2, 2, 2, 3, 3, 3, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 3, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 2, 3, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 3, 2, 3, 3, 2, 2, 2, 2, 3, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 3, 3, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 3, 2, 2, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 3, 3, 3, 2, 2, 3, 2, 2, 3, 2, 2, 2, 2, 3, 2, 2, 3, 2, 2, 2, 2, 3, 3, 2, 2, 2, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 2, 3, 3, 3, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 3, 2, 2, 3, 2, 2, 2, 2, 2, 3, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 3, 2, 2, 2, 3, 2, 3, 3, 2, 2, 3, 3, 2, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 3, 3, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 2, 3, 2, 2, 3, 3, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 3, 3, 2, 2, 3, 3, 3, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 3, 3, 2, 3, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 3, 3, 3, 2, 3, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 3, 3, 3, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 2, 3, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 3, 2, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 3, 3, 2, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 3, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 3, 3, 2, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 2, 3, 3, 3, 3, 3, 2, 3, 2, 2, 3, 3, 2, 2, 3, 2, 3, 3, 3, 3, 2, 2, 2, 2, 3, 3, 2, 3, 2, 3, 2, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 2, 2, 3, 2, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 3, 2, 2, 3, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 3, 3, 3, 2, 2, 2, 3, 3, 2, 3, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 3, 2, 2, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 3, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 3, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 3, 2, 2, 2, 2, 3, 2, 2, 3, 2, 2, 3, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 3, 2, 2, 2, 3, 3, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 3, 2, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 3, 3, 2, 3, 3, 3, 2, 2, 2, 2, 3, 2, 3, 2, 2, 2, 2, 3, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 2, 2, 2, 3, 2, 2, 2, 2, 2, 3, 2, 3, 2, 3, 3, 3, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 3, 3, 3, 3, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 3, 2, 2, 3, 2, 3, 3, 3, 2, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 3, 3, 3, 3, 2, 2, 3, 3, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 2, 2, 3, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 3, 2, 2, 3, 2, 2, 3, 2, 2, 2, 2, 3, 2, 3, 2, 2, 2, 2, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2, 3, 2, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 3, 3, 3, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 2, 3, 2, 2, 2, 2, 3, 3, 2, 2, 3, 3, 2, 2, 3, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 3, 3, 2, 2, 2, 2, 3, 2, 2, 2, 3, 2, 2, 2, 3, 3, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 3, 3, 2, 2, 2, 3, 2, 2, 3, 3, 3, 2, 2, 3, 2, 2, 2, 3, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 3, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 3, 3, 3, 3, 2, 2, 3, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 2, 3, 3, 2, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 2, 2, 3, 2, 3, 3, 2, 3, 2, 2, 3, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 3, 3, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 3, 3, 2, 3, 2, 2, 2, 2, 3, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 3, 3, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 3, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 2, 2, 3, 2, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 3, 3, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3};
-const int8_t frontalface_weights_array[]={-1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, -1, 2, -1, 2, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, 2, -1, 2, -1, 3, -1, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, 2, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 2, 2, -1, 3, -1, 2, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, -1, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 2, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, 2, -1, 3, -1, 3, -1, 2, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, 2, -1, 2, -1, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 2, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, -1, 2, -1, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, 2, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, 2, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, -1, 2, -1, 2, 2, -1, 2, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 3, -1, 3, -1, 2, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, -1, 3, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 2, 2, -1, 3, -1, 2, -1, 2, -1, 2, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, 2, -1, 2, -1, 2, -1, 2, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, -1, 2, 2, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, -1, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, 2, -1, 2, -1, 2, 2, -1, 2, -1, 2, 2, -1, 3, -1, 2, 2, -1, 2, -1, 2, -1, 2, 2, -1, 2, -1, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, 2, -1, 2, -1, 2, -1, 3, -1, 2, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, 2, -1, 2, -1, 2, 2, -1, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, -1, 3, -1, 2, -1, 2, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 2, 2, -1, 2, -1, 2, 2, -1, 3, -1, 2, 2, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 2, -1, 3, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, -1, 3, -1, 2, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, 2, -1, 2, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 2, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, -1, 2, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, -1, 2, 2, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, 2, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, -1, 2, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 2, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 2, 2, -1, 2, -1, 2, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, -1, 2, 2, -1, 2, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, -1, 2, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, 2, -1, 3, -1, 3, -1, 2, 2, -1, 2, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, -1, 2, 2, -1, 3, -1, 2, -1, 3, -1, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, 2, -1, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 2, 2, -1, 2, -1, 2, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 2, 2, -1, 3, -1, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, 2, -1, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, -1, 2, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 3, -1, 2, -1, 2, 2, -1, 3, -1, 2, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 3, -1, 2, 2, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, -1, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, -1, 2, -1, 2, 2, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 2, 2, -1, 2, -1, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, -1, 2, 2, -1, 2, -1, 2, 2, -1, 3, -1, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, -1, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 2, 2, -1, 2, -1, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 2, -1, 2, 2, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, -1, 2, -1, 2, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 2, -1, 2, 2, -1, 3, -1, 3, -1, 2, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, -1, 2, -1, 2, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, -1, 2, 2, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, -1, 2, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, -1, 2, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, 2, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, -1, 2, 2, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, -1, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, -1, 2, -1, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, -1, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, 2};
-const int8_t frontalface_rectangles_array[]={6, 4, 12, 9, 6, 7, 12, 3, 6, 4, 12, 7, 10, 4, 4, 7, 3, 9, 18, 9, 3, 12, 18, 3, 8, 18, 9, 6, 8, 20, 9, 2, 3, 5, 4, 19, 5, 5, 2, 19, 6, 5, 12, 16, 6, 13, 12, 8, 5, 8, 12, 6, 5, 11, 12, 3, 11, 14, 4, 10, 11, 19, 4, 5, 4, 0, 7, 6, 4, 3, 7, 3, 6, 6, 12, 6, 6, 8, 12, 2, 6, 4, 12, 7, 10, 4, 4, 7, 1, 8, 19, 12, 1, 12, 19, 4, 0, 2, 24, 3, 8, 2, 8, 3, 9, 9, 6, 15, 9, 14, 6, 5, 5, 6, 14, 10, 5, 11, 14, 5, 5, 0, 14, 9, 5, 3, 14, 3, 13, 11, 9, 6, 16, 11, 3, 6, 7, 5, 6, 10, 9, 5, 2, 10, 10, 8, 6, 10, 12, 8, 2, 10, 2, 5, 4, 9, 4, 5, 2, 9, 18, 0, 6, 11, 20, 0, 2, 11, 0, 6, 24, 13, 8, 6, 8, 13, 9, 6, 6, 9, 11, 6, 2, 9, 7, 18, 10, 6, 7, 20, 10, 2, 5, 7, 14, 12, 5, 13, 14, 6, 0, 3, 24, 3, 8, 3, 8, 3, 5, 8, 15, 6, 5, 11, 15, 3, 9, 6, 5, 14, 9, 13, 5, 7, 9, 5, 6, 10, 11, 5, 2, 10, 6, 6, 3, 12, 6, 12, 3, 6, 3, 21, 18, 3, 9, 21, 6, 3, 5, 6, 13, 6, 5, 8, 13, 2, 18, 1, 6, 15, 18, 1, 3, 15, 1, 1, 6, 15, 4, 1, 3, 15, 0, 8, 24, 15, 8, 8, 8, 15, 5, 6, 14, 12, 5, 6, 7, 6, 12, 12, 7, 6, 2, 12, 21, 12, 2, 16, 21, 4, 8, 1, 4, 10, 10, 1, 2, 10, 2, 13, 20, 10, 2, 13, 10, 10, 0, 1, 6, 13, 2, 1, 2, 13, 20, 2, 4, 13, 20, 2, 2, 13, 0, 5, 22, 19, 11, 5, 11, 19, 18, 4, 6, 9, 20, 4, 2, 9, 0, 3, 6, 11, 2, 3, 2, 11, 12, 1, 4, 9, 12, 1, 2, 9, 0, 6, 19, 3, 0, 7, 19, 1, 12, 1, 4, 9, 12, 1, 2, 9, 8, 1, 4, 9, 10, 1, 2, 9, 5, 5, 14, 14, 12, 5, 7, 7, 5, 12, 7, 7, 1, 10, 18, 2, 1, 11, 18, 1, 17, 13, 4, 11, 17, 13, 2, 11, 0, 4, 6, 9, 0, 7, 6, 3, 6, 4, 12, 9, 6, 7, 12, 3, 6, 5, 12, 6, 10, 5, 4, 6, 0, 1, 24, 5, 8, 1, 8, 5, 4, 10, 18, 6, 4, 12, 18, 2, 2, 17, 12, 6, 2, 17, 6, 3, 8, 20, 6, 3, 19, 3, 4, 13, 19, 3, 2, 13, 1, 3, 4, 13, 3, 3, 2, 13, 0, 1, 24, 23, 8, 1, 8, 23, 1, 7, 8, 12, 1, 11, 8, 4, 14, 7, 3, 14, 14, 14, 3, 7, 3, 12, 16, 6, 3, 12, 8, 3, 11, 15, 8, 3, 6, 6, 12, 6, 6, 8, 12, 2, 8, 7, 6, 12, 8, 13, 6, 6, 15, 15, 9, 6, 15, 17, 9, 2, 1, 17, 18, 3, 1, 18, 18, 1, 4, 4, 16, 12, 4, 10, 16, 6, 0, 1, 4, 20, 2, 1, 2, 20, 3, 0, 18, 2, 3, 1, 18, 1, 1, 5, 20, 14, 1, 5, 10, 7, 11, 12, 10, 7, 5, 8, 14, 12, 5, 12, 14, 4, 3, 14, 7, 9, 3, 17, 7, 3, 14, 15, 9, 6, 14, 17, 9, 2, 1, 15, 9, 6, 1, 17, 9, 2, 11, 6, 8, 10, 15, 6, 4, 5, 11, 11, 4, 5, 5, 5, 14, 14, 5, 5, 7, 7, 12, 12, 7, 7, 6, 0, 12, 5, 10, 0, 4, 5, 9, 0, 6, 9, 9, 3, 6, 3, 9, 6, 6, 9, 11, 6, 2, 9, 7, 0, 6, 9, 9, 0, 2, 9, 10, 6, 6, 9, 12, 6, 2, 9, 8, 6, 6, 9, 10, 6, 2, 9, 3, 8, 18, 4, 9, 8, 6, 4, 6, 0, 12, 9, 6, 3, 12, 3, 0, 0, 24, 6, 8, 0, 8, 6, 4, 7, 16, 12, 4, 11, 16, 4, 11, 6, 6, 6, 11, 6, 3, 6, 0, 20, 24, 3, 8, 20, 8, 3, 11, 6, 4, 9, 11, 6, 2, 9, 4, 13, 15, 4, 9, 13, 5, 4, 11, 6, 4, 9, 11, 6, 2, 9, 9, 6, 4, 9, 11, 6, 2, 9, 9, 12, 6, 12, 9, 18, 6, 6, 1, 22, 18, 2, 1, 23, 18, 1, 10, 7, 4, 10, 10, 12, 4, 5, 6, 7, 8, 10, 6, 12, 8, 5, 7, 6, 10, 6, 7, 8, 10, 2, 0, 14, 10, 4, 0, 16, 10, 2, 6, 18, 18, 2, 6, 19, 18, 1, 1, 1, 22, 3, 1, 2, 22, 1, 6, 16, 18, 3, 6, 17, 18, 1, 2, 4, 6, 15, 5, 4, 3, 15, 20, 4, 4, 10, 20, 4, 2, 10, 0, 4, 4, 10, 2, 4, 2, 10, 2, 16, 20, 6, 12, 16, 10, 3, 2, 19, 10, 3, 0, 12, 8, 9, 4, 12, 4, 9, 12, 0, 6, 9, 14, 0, 2, 9, 5, 10, 6, 6, 8, 10, 3, 6, 11, 8, 12, 6, 17, 8, 6, 3, 11, 11, 6, 3, 0, 8, 12, 6, 0, 8, 6, 3, 6, 11, 6, 3, 12, 0, 6, 9, 14, 0, 2, 9, 6, 0, 6, 9, 8, 0, 2, 9, 8, 14, 9, 6, 8, 16, 9, 2, 0, 16, 9, 6, 0, 18, 9, 2, 10, 8, 6, 10, 12, 8, 2, 10, 3, 19, 12, 3, 9, 19, 6, 3, 2, 10, 20, 2, 2, 11, 20, 1, 2, 9, 18, 12, 2, 9, 9, 6, 11, 15, 9, 6, 3, 0, 18, 24, 3, 0, 9, 24, 5, 6, 14, 10, 5, 6, 7, 5, 12, 11, 7, 5, 9, 5, 10, 12, 14, 5, 5, 6, 9, 11, 5, 6, 4, 5, 12, 12, 4, 5, 6, 6, 10, 11, 6, 6, 4, 14, 18, 3, 4, 15, 18, 1, 6, 13, 8, 8, 6, 17, 8, 4, 3, 16, 18, 6, 3, 19, 18, 3, 0, 0, 6, 6, 3, 0, 3, 6, 6, 6, 12, 18, 10, 6, 4, 18, 6, 1, 4, 14, 8, 1, 2, 14, 3, 2, 19, 2, 3, 3, 19, 1, 1, 8, 22, 13, 12, 8, 11, 13, 8, 9, 11, 4, 8, 11, 11, 2, 0, 12, 15, 10, 5, 12, 5, 10, 12, 16, 12, 6, 16, 16, 4, 6, 0, 16, 12, 6, 4, 16, 4, 6, 19, 1, 5, 12, 19, 5, 5, 4, 0, 2, 24, 4, 8, 2, 8, 4, 6, 8, 12, 4, 6, 10, 12, 2, 7, 5, 9, 6, 10, 5, 3, 6, 9, 17, 6, 6, 9, 20, 6, 3, 0, 7, 22, 15, 0, 12, 22, 5, 4, 1, 17, 9, 4, 4, 17, 3, 7, 5, 6, 10, 9, 5, 2, 10, 18, 1, 6, 8, 18, 1, 3, 8, 0, 1, 6, 7, 3, 1, 3, 7, 18, 0, 6, 22, 18, 0, 3, 22, 0, 0, 6, 22, 3, 0, 3, 22, 16, 7, 8, 16, 16, 7, 4, 16, 2, 10, 19, 6, 2, 12, 19, 2, 9, 9, 6, 12, 9, 13, 6, 4, 2, 15, 17, 6, 2, 17, 17, 2, 14, 7, 3, 14, 14, 14, 3, 7, 5, 6, 8, 10, 5, 6, 4, 5, 9, 11, 4, 5, 15, 8, 9, 11, 18, 8, 3, 11, 0, 8, 9, 11, 3, 8, 3, 11, 8, 6, 10, 18, 8, 15, 10, 9, 7, 7, 3, 14, 7, 14, 3, 7, 0, 14, 24, 8, 8, 14, 8, 8, 1, 10, 18, 14, 10, 10, 9, 14, 14, 12, 6, 6, 14, 15, 6, 3, 7, 0, 10, 16, 7, 0, 5, 8, 12, 8, 5, 8, 10, 0, 9, 6, 13, 0, 3, 6, 4, 3, 16, 4, 12, 3, 8, 4, 10, 0, 9, 6, 13, 0, 3, 6, 1, 1, 20, 4, 1, 1, 10, 2, 11, 3, 10, 2, 10, 0, 9, 6, 13, 0, 3, 6, 5, 0, 9, 6, 8, 0, 3, 6, 8, 18, 10, 6, 8, 20, 10, 2, 6, 3, 6, 9, 8, 3, 2, 9, 7, 3, 12, 6, 7, 5, 12, 2, 0, 10, 18, 3, 0, 11, 18, 1, 1, 10, 22, 3, 1, 11, 22, 1, 5, 11, 8, 8, 9, 11, 4, 8, 12, 11, 6, 6, 12, 11, 3, 6, 6, 11, 6, 6, 9, 11, 3, 6, 7, 10, 11, 6, 7, 12, 11, 2, 0, 13, 24, 4, 0, 13, 12, 2, 12, 15, 12, 2, 2, 4, 22, 12, 13, 4, 11, 6, 2, 10, 11, 6, 2, 0, 20, 17, 12, 0, 10, 17, 14, 0, 2, 24, 14, 0, 1, 24, 8, 0, 2, 24, 9, 0, 1, 24, 14, 1, 2, 22, 14, 1, 1, 22, 8, 1, 2, 22, 9, 1, 1, 22, 17, 6, 3, 18, 18, 6, 1, 18, 6, 14, 9, 6, 6, 16, 9, 2, 13, 14, 9, 4, 13, 16, 9, 2, 3, 18, 18, 3, 3, 19, 18, 1, 9, 4, 8, 18, 13, 4, 4, 9, 9, 13, 4, 9, 0, 17, 18, 3, 0, 18, 18, 1, 0, 2, 12, 4, 6, 2, 6, 4, 6, 8, 14, 6, 6, 11, 14, 3, 7, 5, 6, 6, 10, 5, 3, 6, 10, 5, 6, 16, 10, 13, 6, 8, 1, 4, 9, 16, 4, 4, 3, 16, 5, 0, 18, 9, 5, 3, 18, 3, 9, 15, 5, 8, 9, 19, 5, 4, 20, 0, 4, 9, 20, 0, 2, 9, 2, 0, 18, 3, 2, 1, 18, 1, 5, 22, 19, 2, 5, 23, 19, 1, 0, 0, 4, 9, 2, 0, 2, 9, 5, 6, 19, 18, 5, 12, 19, 6, 0, 1, 6, 9, 2, 1, 2, 9, 6, 5, 14, 12, 13, 5, 7, 6, 6, 11, 7, 6, 0, 1, 20, 2, 0, 2, 20, 1, 1, 2, 22, 3, 1, 3, 22, 1, 2, 8, 7, 9, 2, 11, 7, 3, 2, 12, 22, 4, 13, 12, 11, 2, 2, 14, 11, 2, 0, 12, 22, 4, 0, 12, 11, 2, 11, 14, 11, 2, 9, 7, 6, 11, 11, 7, 2, 11, 7, 1, 9, 6, 10, 1, 3, 6, 11, 2, 4, 10, 11, 7, 4, 5, 6, 4, 12, 12, 6, 10, 12, 6, 18, 1, 6, 15, 18, 6, 6, 5, 3, 15, 18, 3, 3, 16, 18, 1, 18, 5, 6, 9, 18, 8, 6, 3, 1, 5, 16, 6, 1, 5, 8, 3, 9, 8, 8, 3, 11, 0, 6, 9, 13, 0, 2, 9, 0, 4, 24, 14, 0, 4, 12, 7, 12, 11, 12, 7, 13, 0, 4, 13, 13, 0, 2, 13, 7, 0, 4, 13, 9, 0, 2, 13, 11, 6, 6, 9, 13, 6, 2, 9, 8, 7, 6, 9, 10, 7, 2, 9, 13, 17, 9, 6, 13, 19, 9, 2, 2, 18, 14, 6, 2, 18, 7, 3, 9, 21, 7, 3, 3, 18, 18, 4, 12, 18, 9, 2, 3, 20, 9, 2, 0, 20, 15, 4, 5, 20, 5, 4, 9, 15, 15, 9, 14, 15, 5, 9, 4, 4, 16, 4, 4, 6, 16, 2, 7, 6, 10, 6, 7, 8, 10, 2, 0, 14, 15, 10, 5, 14, 5, 10, 7, 9, 10, 14, 12, 9, 5, 7, 7, 16, 5, 7, 7, 6, 6, 9, 9, 6, 2, 9, 3, 6, 18, 3, 3, 7, 18, 1, 0, 10, 18, 3, 0, 11, 18, 1, 3, 16, 18, 4, 12, 16, 9, 2, 3, 18, 9, 2, 4, 6, 14, 6, 4, 6, 7, 3, 11, 9, 7, 3, 13, 0, 2, 18, 13, 0, 1, 18, 9, 0, 2, 18, 10, 0, 1, 18, 5, 7, 15, 10, 10, 7, 5, 10, 1, 20, 21, 4, 8, 20, 7, 4, 10, 5, 5, 18, 10, 14, 5, 9, 0, 2, 24, 6, 0, 2, 12, 3, 12, 5, 12, 3, 1, 1, 22, 8, 12, 1, 11, 4, 1, 5, 11, 4, 4, 0, 15, 9, 4, 3, 15, 3, 0, 0, 24, 19, 8, 0, 8, 19, 2, 21, 18, 3, 11, 21, 9, 3, 9, 7, 10, 4, 9, 7, 5, 4, 5, 7, 10, 4, 10, 7, 5, 4, 17, 8, 6, 16, 20, 8, 3, 8, 17, 16, 3, 8, 1, 15, 20, 4, 1, 15, 10, 2, 11, 17, 10, 2, 14, 15, 10, 6, 14, 17, 10, 2, 3, 0, 16, 9, 3, 3, 16, 3, 15, 6, 7, 15, 15, 11, 7, 5, 9, 1, 6, 13, 11, 1, 2, 13, 17, 2, 6, 14, 17, 2, 3, 14, 3, 14, 12, 10, 3, 14, 6, 5, 9, 19, 6, 5, 7, 6, 10, 6, 7, 8, 10, 2, 1, 2, 6, 14, 4, 2, 3, 14, 10, 4, 5, 12, 10, 8, 5, 4, 0, 17, 24, 5, 8, 17, 8, 5, 15, 7, 5, 12, 15, 11, 5, 4, 3, 1, 6, 12, 3, 1, 3, 6, 6, 7, 3, 6, 12, 13, 6, 6, 12, 16, 6, 3, 6, 13, 6, 6, 6, 16, 6, 3, 14, 6, 3, 16, 14, 14, 3, 8, 1, 12, 13, 6, 1, 14, 13, 2, 13, 1, 4, 9, 13, 1, 2, 9, 7, 0, 9, 6, 10, 0, 3, 6, 12, 2, 6, 9, 12, 2, 3, 9, 6, 2, 6, 9, 9, 2, 3, 9, 6, 18, 12, 6, 6, 20, 12, 2, 7, 6, 6, 9, 9, 6, 2, 9, 7, 7, 12, 3, 7, 7, 6, 3, 8, 3, 8, 21, 8, 10, 8, 7, 7, 4, 10, 12, 7, 8, 10, 4, 0, 1, 6, 9, 0, 4, 6, 3, 15, 2, 2, 20, 15, 2, 1, 20, 0, 3, 6, 9, 0, 6, 6, 3, 15, 3, 2, 21, 15, 3, 1, 21, 7, 0, 2, 23, 8, 0, 1, 23, 15, 8, 9, 4, 15, 10, 9, 2, 0, 8, 9, 4, 0, 10, 9, 2, 8, 14, 9, 6, 8, 16, 9, 2, 0, 14, 9, 6, 0, 16, 9, 2, 3, 10, 18, 4, 9, 10, 6, 4, 0, 0, 24, 19, 8, 0, 8, 19, 9, 1, 8, 12, 9, 7, 8, 6, 10, 6, 4, 10, 12, 6, 2, 10, 7, 9, 10, 12, 12, 9, 5, 6, 7, 15, 5, 6, 5, 0, 3, 19, 6, 0, 1, 19, 14, 0, 6, 10, 16, 0, 2, 10, 2, 0, 6, 12, 2, 0, 3, 6, 5, 6, 3, 6, 0, 11, 24, 2, 0, 12, 24, 1, 4, 9, 13, 4, 4, 11, 13, 2, 9, 8, 6, 9, 9, 11, 6, 3, 0, 12, 16, 4, 0, 14, 16, 2, 18, 12, 6, 9, 18, 15, 6, 3, 0, 12, 6, 9, 0, 15, 6, 3, 8, 7, 10, 4, 8, 7, 5, 4, 8, 7, 6, 9, 10, 7, 2, 9, 11, 0, 6, 9, 13, 0, 2, 9, 7, 0, 6, 9, 9, 0, 2, 9, 12, 3, 6, 15, 14, 3, 2, 15, 6, 3, 6, 15, 8, 3, 2, 15, 15, 2, 9, 4, 15, 4, 9, 2, 5, 10, 6, 7, 8, 10, 3, 7, 9, 14, 6, 10, 9, 19, 6, 5, 7, 13, 5, 8, 7, 17, 5, 4, 14, 5, 3, 16, 14, 13, 3, 8, 2, 17, 18, 3, 2, 18, 18, 1, 5, 18, 19, 3, 5, 19, 19, 1, 9, 0, 6, 9, 11, 0, 2, 9, 12, 4, 3, 18, 13, 4, 1, 18, 9, 4, 3, 18, 10, 4, 1, 18, 3, 3, 18, 9, 9, 3, 6, 9, 6, 1, 6, 14, 8, 1, 2, 14, 12, 16, 9, 6, 12, 19, 9, 3, 1, 3, 20, 16, 1, 3, 10, 8, 11, 11, 10, 8, 12, 5, 6, 12, 15, 5, 3, 6, 12, 11, 3, 6, 1, 2, 22, 16, 1, 2, 11, 8, 12, 10, 11, 8, 10, 14, 5, 10, 10, 19, 5, 5, 3, 21, 18, 3, 3, 22, 18, 1, 10, 14, 6, 10, 12, 14, 2, 10, 0, 2, 24, 4, 8, 2, 8, 4, 6, 4, 12, 9, 6, 7, 12, 3, 6, 6, 12, 5, 10, 6, 4, 5, 5, 8, 14, 12, 5, 12, 14, 4, 4, 14, 8, 10, 4, 14, 4, 5, 8, 19, 4, 5, 11, 6, 5, 14, 11, 13, 5, 7, 7, 6, 3, 16, 7, 14, 3, 8, 3, 7, 18, 8, 9, 7, 6, 8, 2, 3, 20, 2, 2, 4, 20, 1, 3, 12, 19, 6, 3, 14, 19, 2, 8, 6, 6, 9, 10, 6, 2, 9, 16, 6, 6, 14, 16, 6, 3, 14, 7, 9, 6, 12, 9, 9, 2, 12, 18, 6, 6, 18, 21, 6, 3, 9, 18, 15, 3, 9, 0, 6, 6, 18, 0, 6, 3, 9, 3, 15, 3, 9, 18, 2, 6, 9, 18, 5, 6, 3, 3, 18, 15, 6, 3, 20, 15, 2, 18, 2, 6, 9, 18, 5, 6, 3, 0, 2, 6, 9, 0, 5, 6, 3, 5, 10, 18, 2, 5, 11, 18, 1, 6, 0, 12, 6, 6, 2, 12, 2, 10, 0, 6, 9, 12, 0, 2, 9, 8, 0, 6, 9, 10, 0, 2, 9, 15, 12, 9, 6, 15, 14, 9, 2, 3, 6, 13, 6, 3, 8, 13, 2, 15, 12, 9, 6, 15, 14, 9, 2, 2, 5, 6, 15, 5, 5, 3, 15, 8, 8, 9, 6, 11, 8, 3, 6, 8, 6, 3, 14, 8, 13, 3, 7, 15, 12, 9, 6, 15, 14, 9, 2, 4, 12, 10, 4, 9, 12, 5, 4, 13, 1, 4, 19, 13, 1, 2, 19, 7, 1, 4, 19, 9, 1, 2, 19, 18, 9, 6, 9, 18, 12, 6, 3, 1, 21, 18, 3, 1, 22, 18, 1, 14, 13, 10, 9, 14, 16, 10, 3, 1, 13, 22, 4, 1, 13, 11, 2, 12, 15, 11, 2, 4, 6, 16, 6, 12, 6, 8, 3, 4, 9, 8, 3, 1, 0, 18, 22, 1, 0, 9, 11, 10, 11, 9, 11, 10, 7, 8, 14, 14, 7, 4, 7, 10, 14, 4, 7, 0, 4, 6, 20, 0, 4, 3, 10, 3, 14, 3, 10, 15, 0, 6, 9, 17, 0, 2, 9, 3, 0, 6, 9, 5, 0, 2, 9, 15, 12, 6, 12, 18, 12, 3, 6, 15, 18, 3, 6, 3, 12, 6, 12, 3, 12, 3, 6, 6, 18, 3, 6, 15, 12, 9, 6, 15, 14, 9, 2, 0, 12, 9, 6, 0, 14, 9, 2, 4, 14, 19, 3, 4, 15, 19, 1, 2, 13, 19, 3, 2, 14, 19, 1, 14, 15, 10, 6, 14, 17, 10, 2, 6, 0, 10, 12, 6, 0, 5, 6, 11, 6, 5, 6, 17, 1, 6, 12, 20, 1, 3, 6, 17, 7, 3, 6, 1, 1, 6, 12, 1, 1, 3, 6, 4, 7, 3, 6, 16, 14, 6, 9, 16, 17, 6, 3, 7, 3, 9, 12, 7, 9, 9, 6, 12, 1, 4, 12, 12, 7, 4, 6, 4, 0, 14, 8, 4, 4, 14, 4, 10, 6, 6, 9, 12, 6, 2, 9, 2, 10, 18, 3, 8, 10, 6, 3, 15, 15, 9, 6, 15, 17, 9, 2, 0, 1, 21, 23, 7, 1, 7, 23, 6, 9, 17, 4, 6, 11, 17, 2, 1, 0, 11, 18, 1, 6, 11, 6, 6, 15, 13, 6, 6, 17, 13, 2, 0, 15, 9, 6, 0, 17, 9, 2, 8, 7, 15, 4, 13, 7, 5, 4, 9, 12, 6, 9, 9, 15, 6, 3, 6, 8, 18, 3, 12, 8, 6, 3, 0, 14, 24, 4, 8, 14, 8, 4, 16, 10, 3, 12, 16, 16, 3, 6, 0, 3, 24, 3, 0, 4, 24, 1, 14, 17, 10, 6, 14, 19, 10, 2, 1, 13, 18, 3, 7, 13, 6, 3, 5, 0, 18, 9, 5, 3, 18, 3, 4, 3, 16, 9, 4, 6, 16, 3, 16, 5, 3, 12, 16, 11, 3, 6, 0, 7, 18, 4, 6, 7, 6, 4, 10, 6, 6, 9, 12, 6, 2, 9, 9, 8, 6, 10, 11, 8, 2, 10, 9, 15, 6, 9, 11, 15, 2, 9, 3, 1, 18, 21, 12, 1, 9, 21, 6, 8, 12, 7, 6, 8, 6, 7, 8, 5, 6, 9, 10, 5, 2, 9, 0, 2, 24, 4, 8, 2, 8, 4, 14, 7, 5, 12, 14, 11, 5, 4, 5, 7, 5, 12, 5, 11, 5, 4, 9, 6, 6, 9, 11, 6, 2, 9, 0, 1, 6, 17, 3, 1, 3, 17, 3, 1, 19, 9, 3, 4, 19, 3, 3, 18, 12, 6, 3, 18, 6, 3, 9, 21, 6, 3, 20, 4, 4, 19, 20, 4, 2, 19, 0, 16, 10, 7, 5, 16, 5, 7, 8, 7, 10, 12, 13, 7, 5, 6, 8, 13, 5, 6, 6, 7, 10, 12, 6, 7, 5, 6, 11, 13, 5, 6, 9, 2, 9, 6, 12, 2, 3, 6, 1, 20, 21, 4, 8, 20, 7, 4, 9, 12, 9, 6, 9, 14, 9, 2, 7, 2, 9, 6, 10, 2, 3, 6, 13, 0, 4, 14, 13, 0, 2, 14, 7, 0, 4, 14, 9, 0, 2, 14, 14, 15, 9, 6, 14, 17, 9, 2, 2, 8, 18, 5, 8, 8, 6, 5, 18, 3, 6, 11, 20, 3, 2, 11, 6, 5, 11, 14, 6, 12, 11, 7, 18, 4, 6, 9, 18, 7, 6, 3, 7, 6, 9, 6, 7, 8, 9, 2, 18, 4, 6, 9, 18, 7, 6, 3, 0, 4, 6, 9, 0, 7, 6, 3, 9, 4, 9, 4, 9, 6, 9, 2, 0, 22, 19, 2, 0, 23, 19, 1, 17, 14, 6, 9, 17, 17, 6, 3, 1, 14, 6, 9, 1, 17, 6, 3, 14, 11, 4, 9, 14, 11, 2, 9, 6, 11, 4, 9, 8, 11, 2, 9, 3, 9, 18, 7, 9, 9, 6, 7, 9, 12, 6, 10, 9, 17, 6, 5, 12, 0, 6, 9, 14, 0, 2, 9, 6, 0, 6, 9, 8, 0, 2, 9, 6, 17, 18, 3, 6, 18, 18, 1, 1, 17, 18, 3, 1, 18, 18, 1, 10, 6, 11, 12, 10, 12, 11, 6, 5, 6, 14, 6, 5, 6, 7, 3, 12, 9, 7, 3, 5, 4, 15, 4, 5, 6, 15, 2, 0, 0, 22, 2, 0, 1, 22, 1, 0, 0, 24, 24, 8, 0, 8, 24, 1, 15, 18, 4, 10, 15, 9, 4, 6, 8, 12, 9, 6, 11, 12, 3, 4, 12, 7, 12, 4, 16, 7, 4, 1, 2, 22, 6, 12, 2, 11, 3, 1, 5, 11, 3, 5, 20, 14, 3, 12, 20, 7, 3, 0, 0, 24, 16, 12, 0, 12, 8, 0, 8, 12, 8, 3, 13, 18, 4, 3, 13, 9, 2, 12, 15, 9, 2, 2, 10, 22, 2, 2, 11, 22, 1, 6, 3, 11, 8, 6, 7, 11, 4, 14, 5, 6, 6, 14, 8, 6, 3, 0, 7, 24, 6, 0, 9, 24, 2, 14, 0, 10, 10, 19, 0, 5, 5, 14, 5, 5, 5, 0, 0, 10, 10, 0, 0, 5, 5, 5, 5, 5, 5, 0, 1, 24, 4, 12, 1, 12, 2, 0, 3, 12, 2, 0, 17, 18, 3, 0, 18, 18, 1, 5, 15, 16, 6, 13, 15, 8, 3, 5, 18, 8, 3, 3, 15, 16, 6, 3, 15, 8, 3, 11, 18, 8, 3, 6, 16, 18, 3, 6, 17, 18, 1, 0, 13, 21, 10, 0, 18, 21, 5, 13, 0, 6, 24, 15, 0, 2, 24, 7, 4, 6, 11, 9, 4, 2, 11, 9, 5, 9, 6, 12, 5, 3, 6, 1, 4, 2, 20, 1, 14, 2, 10, 13, 0, 6, 24, 15, 0, 2, 24, 5, 0, 6, 24, 7, 0, 2, 24, 16, 7, 6, 14, 19, 7, 3, 7, 16, 14, 3, 7, 4, 7, 4, 12, 6, 7, 2, 12, 0, 5, 24, 14, 8, 5, 8, 14, 5, 13, 10, 6, 5, 15, 10, 2, 12, 0, 6, 9, 14, 0, 2, 9, 2, 7, 6, 14, 2, 7, 3, 7, 5, 14, 3, 7, 15, 2, 9, 15, 18, 2, 3, 15, 0, 2, 6, 9, 2, 2, 2, 9, 12, 2, 10, 14, 17, 2, 5, 7, 12, 9, 5, 7, 11, 6, 2, 18, 12, 6, 1, 18, 9, 5, 15, 6, 14, 5, 5, 6, 8, 6, 6, 10, 10, 6, 2, 10, 12, 0, 6, 9, 14, 0, 2, 9, 3, 3, 9, 7, 6, 3, 3, 7, 6, 7, 14, 3, 6, 7, 7, 3, 7, 7, 8, 6, 11, 7, 4, 6, 12, 7, 7, 12, 12, 13, 7, 6, 10, 6, 4, 18, 10, 6, 2, 9, 12, 15, 2, 9, 16, 14, 6, 9, 16, 17, 6, 3, 4, 0, 6, 13, 6, 0, 2, 13, 2, 2, 21, 3, 9, 2, 7, 3, 5, 4, 5, 12, 5, 8, 5, 4, 10, 3, 4, 10, 10, 8, 4, 5, 8, 4, 5, 8, 8, 8, 5, 4, 6, 0, 11, 9, 6, 3, 11, 3, 6, 6, 12, 5, 10, 6, 4, 5, 0, 0, 24, 5, 8, 0, 8, 5, 1, 10, 23, 6, 1, 12, 23, 2, 3, 21, 18, 3, 9, 21, 6, 3, 3, 6, 21, 6, 3, 8, 21, 2, 0, 5, 6, 12, 2, 5, 2, 12, 10, 2, 4, 15, 10, 7, 4, 5, 8, 7, 8, 10, 8, 12, 8, 5, 5, 7, 15, 12, 10, 7, 5, 12, 0, 17, 10, 6, 0, 19, 10, 2, 14, 18, 9, 6, 14, 20, 9, 2, 9, 6, 6, 16, 9, 14, 6, 8, 14, 18, 9, 6, 14, 20, 9, 2, 1, 18, 9, 6, 1, 20, 9, 2, 15, 9, 9, 6, 15, 11, 9, 2, 0, 9, 9, 6, 0, 11, 9, 2, 17, 3, 6, 9, 19, 3, 2, 9, 2, 17, 18, 3, 2, 18, 18, 1, 3, 15, 21, 6, 3, 17, 21, 2, 9, 17, 6, 6, 9, 20, 6, 3, 18, 3, 6, 9, 18, 6, 6, 3, 0, 3, 6, 9, 0, 6, 6, 3, 4, 0, 16, 10, 12, 0, 8, 5, 4, 5, 8, 5, 2, 0, 10, 16, 2, 0, 5, 8, 7, 8, 5, 8, 14, 0, 10, 5, 14, 0, 5, 5, 0, 0, 10, 5, 5, 0, 5, 5, 18, 3, 6, 10, 18, 3, 3, 10, 5, 11, 12, 6, 5, 11, 6, 3, 11, 14, 6, 3, 21, 0, 3, 18, 22, 0, 1, 18, 6, 0, 6, 9, 8, 0, 2, 9, 8, 8, 9, 7, 11, 8, 3, 7, 7, 12, 8, 10, 7, 12, 4, 5, 11, 17, 4, 5, 21, 0, 3, 18, 22, 0, 1, 18, 10, 6, 4, 9, 12, 6, 2, 9, 15, 0, 9, 6, 15, 2, 9, 2, 0, 2, 24, 3, 0, 3, 24, 1, 11, 7, 6, 9, 13, 7, 2, 9, 7, 6, 6, 10, 9, 6, 2, 10, 12, 1, 6, 12, 14, 1, 2, 12, 6, 4, 12, 12, 6, 10, 12, 6, 14, 3, 2, 21, 14, 3, 1, 21, 6, 1, 12, 8, 6, 5, 12, 4, 3, 0, 18, 8, 3, 4, 18, 4, 3, 0, 18, 3, 3, 1, 18, 1, 0, 13, 24, 4, 12, 13, 12, 2, 0, 15, 12, 2, 10, 5, 4, 9, 12, 5, 2, 9, 11, 1, 6, 9, 13, 1, 2, 9, 6, 2, 6, 22, 8, 2, 2, 22, 16, 10, 8, 14, 20, 10, 4, 7, 16, 17, 4, 7, 3, 4, 16, 15, 3, 9, 16, 5, 16, 10, 8, 14, 20, 10, 4, 7, 16, 17, 4, 7, 0, 10, 8, 14, 0, 10, 4, 7, 4, 17, 4, 7, 10, 14, 11, 6, 10, 17, 11, 3, 0, 7, 24, 9, 8, 7, 8, 9, 13, 1, 4, 16, 13, 1, 2, 16, 7, 1, 4, 16, 9, 1, 2, 16, 5, 5, 16, 8, 13, 5, 8, 4, 5, 9, 8, 4, 0, 9, 6, 9, 0, 12, 6, 3, 6, 16, 18, 3, 6, 17, 18, 1, 3, 12, 6, 9, 3, 15, 6, 3, 8, 14, 9, 6, 8, 16, 9, 2, 2, 13, 8, 10, 2, 13, 4, 5, 6, 18, 4, 5, 15, 5, 3, 18, 15, 11, 3, 6, 3, 5, 18, 3, 3, 6, 18, 1, 17, 5, 6, 11, 19, 5, 2, 11, 1, 5, 6, 11, 3, 5, 2, 11, 19, 1, 4, 9, 19, 1, 2, 9, 1, 1, 4, 9, 3, 1, 2, 9, 4, 15, 18, 9, 4, 15, 9, 9, 6, 9, 12, 4, 6, 11, 12, 2, 15, 2, 9, 6, 15, 4, 9, 2, 0, 2, 9, 6, 0, 4, 9, 2, 15, 0, 6, 17, 17, 0, 2, 17, 3, 0, 6, 17, 5, 0, 2, 17, 8, 17, 9, 4, 8, 19, 9, 2, 6, 5, 3, 18, 6, 11, 3, 6, 5, 2, 14, 12, 5, 8, 14, 6, 10, 2, 3, 12, 10, 8, 3, 6, 10, 7, 14, 15, 10, 12, 14, 5, 0, 7, 14, 15, 0, 12, 14, 5, 15, 0, 9, 6, 15, 2, 9, 2, 0, 0, 9, 6, 0, 2, 9, 2, 12, 6, 6, 14, 14, 6, 2, 14, 9, 7, 6, 9, 11, 7, 2, 9, 12, 6, 6, 15, 14, 6, 2, 15, 6, 6, 6, 15, 8, 6, 2, 15, 15, 3, 8, 9, 15, 3, 4, 9, 0, 0, 9, 21, 3, 0, 3, 21, 11, 9, 8, 12, 11, 13, 8, 4, 6, 7, 10, 12, 6, 7, 5, 6, 11, 13, 5, 6, 10, 6, 4, 18, 12, 6, 2, 9, 10, 15, 2, 9, 0, 0, 6, 9, 0, 3, 6, 3, 3, 14, 18, 3, 3, 15, 18, 1, 3, 14, 8, 10, 3, 14, 4, 5, 7, 19, 4, 5, 0, 12, 24, 4, 12, 12, 12, 2, 0, 14, 12, 2, 0, 2, 3, 20, 1, 2, 1, 20, 12, 16, 10, 8, 17, 16, 5, 4, 12, 20, 5, 4, 2, 16, 10, 8, 2, 16, 5, 4, 7, 20, 5, 4, 7, 0, 10, 9, 7, 3, 10, 3, 0, 0, 24, 3, 8, 0, 8, 3, 3, 8, 15, 4, 3, 10, 15, 2, 6, 5, 12, 6, 10, 5, 4, 6, 5, 13, 14, 6, 5, 16, 14, 3, 11, 14, 4, 10, 11, 19, 4, 5, 0, 6, 6, 7, 3, 6, 3, 7, 18, 0, 6, 6, 18, 0, 3, 6, 3, 1, 18, 3, 3, 2, 18, 1, 9, 6, 14, 18, 9, 12, 14, 6, 0, 0, 6, 6, 3, 0, 3, 6, 13, 11, 6, 6, 13, 11, 3, 6, 0, 20, 24, 3, 8, 20, 8, 3, 13, 11, 6, 7, 13, 11, 3, 7, 4, 12, 10, 6, 4, 14, 10, 2, 13, 11, 6, 6, 13, 11, 3, 6, 5, 11, 6, 7, 8, 11, 3, 7, 7, 4, 11, 12, 7, 8, 11, 4, 6, 15, 10, 4, 6, 17, 10, 2, 14, 0, 6, 9, 16, 0, 2, 9, 4, 0, 6, 9, 6, 0, 2, 9, 11, 2, 4, 15, 11, 7, 4, 5, 0, 0, 20, 3, 0, 1, 20, 1, 13, 18, 10, 6, 13, 20, 10, 2, 2, 7, 6, 11, 5, 7, 3, 11, 10, 14, 10, 9, 10, 17, 10, 3, 8, 2, 4, 9, 10, 2, 2, 9, 14, 3, 10, 4, 14, 3, 5, 4, 6, 6, 12, 6, 6, 6, 6, 3, 12, 9, 6, 3, 8, 8, 8, 10, 12, 8, 4, 5, 8, 13, 4, 5, 7, 4, 4, 16, 7, 12, 4, 8, 8, 8, 9, 4, 8, 10, 9, 2, 5, 2, 14, 9, 5, 5, 14, 3, 3, 16, 19, 8, 3, 20, 19, 4, 0, 0, 10, 8, 5, 0, 5, 8, 5, 2, 16, 18, 5, 2, 8, 18, 0, 11, 24, 11, 8, 11, 8, 11, 3, 3, 18, 5, 3, 3, 9, 5, 1, 16, 18, 3, 1, 17, 18, 1, 5, 17, 18, 3, 5, 18, 18, 1, 1, 13, 9, 6, 1, 15, 9, 2, 1, 9, 23, 10, 1, 14, 23, 5, 3, 7, 18, 3, 3, 8, 18, 1, 6, 8, 12, 3, 6, 8, 6, 3, 6, 2, 3, 22, 7, 2, 1, 22, 14, 17, 10, 6, 14, 19, 10, 2, 1, 18, 10, 6, 1, 20, 10, 2, 11, 3, 6, 12, 13, 3, 2, 12, 10, 6, 4, 9, 12, 6, 2, 9, 11, 0, 6, 9, 13, 0, 2, 9, 7, 0, 6, 9, 9, 0, 2, 9, 12, 10, 9, 6, 15, 10, 3, 6, 2, 11, 6, 9, 5, 11, 3, 9, 14, 5, 3, 19, 15, 5, 1, 19, 6, 6, 9, 6, 6, 8, 9, 2, 14, 5, 3, 19, 15, 5, 1, 19, 0, 3, 6, 9, 0, 6, 6, 3, 5, 21, 18, 3, 5, 22, 18, 1, 1, 10, 18, 4, 7, 10, 6, 4, 13, 4, 8, 10, 17, 4, 4, 5, 13, 9, 4, 5, 7, 8, 9, 6, 10, 8, 3, 6, 12, 9, 9, 8, 15, 9, 3, 8, 0, 6, 5, 12, 0, 10, 5, 4, 7, 6, 14, 6, 14, 6, 7, 3, 7, 9, 7, 3, 7, 5, 3, 19, 8, 5, 1, 19, 8, 4, 15, 20, 13, 4, 5, 20, 1, 4, 15, 20, 6, 4, 5, 20, 13, 10, 6, 6, 13, 10, 3, 6, 5, 10, 6, 6, 8, 10, 3, 6, 14, 2, 6, 14, 17, 2, 3, 7, 14, 9, 3, 7, 4, 2, 6, 14, 4, 2, 3, 7, 7, 9, 3, 7, 12, 4, 6, 7, 12, 4, 3, 7, 9, 4, 6, 9, 11, 4, 2, 9, 11, 4, 8, 10, 11, 4, 4, 10, 5, 4, 8, 10, 9, 4, 4, 10, 8, 18, 10, 6, 8, 20, 10, 2, 1, 18, 21, 6, 1, 20, 21, 2, 9, 2, 12, 6, 9, 2, 6, 6, 3, 2, 12, 6, 9, 2, 6, 6, 12, 5, 12, 6, 18, 5, 6, 3, 12, 8, 6, 3, 8, 8, 6, 9, 8, 11, 6, 3, 2, 7, 20, 6, 2, 9, 20, 2, 0, 5, 12, 6, 0, 5, 6, 3, 6, 8, 6, 3, 14, 14, 8, 10, 18, 14, 4, 5, 14, 19, 4, 5, 2, 14, 8, 10, 2, 14, 4, 5, 6, 19, 4, 5, 2, 11, 20, 13, 2, 11, 10, 13, 6, 9, 12, 5, 12, 9, 6, 5, 5, 6, 16, 6, 13, 6, 8, 3, 5, 9, 8, 3, 1, 19, 9, 4, 1, 21, 9, 2, 7, 5, 12, 5, 11, 5, 4, 5, 3, 5, 14, 12, 3, 5, 7, 6, 10, 11, 7, 6, 9, 4, 9, 6, 12, 4, 3, 6, 2, 6, 19, 3, 2, 7, 19, 1, 18, 10, 6, 9, 18, 13, 6, 3, 3, 7, 18, 2, 3, 8, 18, 1, 20, 2, 4, 18, 22, 2, 2, 9, 20, 11, 2, 9, 2, 18, 20, 3, 2, 19, 20, 1, 1, 9, 22, 3, 1, 10, 22, 1, 0, 2, 4, 18, 0, 2, 2, 9, 2, 11, 2, 9, 19, 0, 4, 23, 19, 0, 2, 23, 0, 3, 6, 19, 3, 3, 3, 19, 18, 2, 6, 9, 20, 2, 2, 9, 0, 5, 10, 6, 0, 7, 10, 2, 7, 0, 12, 12, 13, 0, 6, 6, 7, 6, 6, 6, 0, 3, 24, 6, 0, 3, 12, 3, 12, 6, 12, 3, 10, 14, 4, 10, 10, 19, 4, 5, 8, 9, 4, 15, 8, 14, 4, 5, 4, 11, 17, 6, 4, 14, 17, 3, 2, 5, 18, 8, 2, 5, 9, 4, 11, 9, 9, 4, 7, 6, 14, 6, 14, 6, 7, 3, 7, 9, 7, 3, 3, 6, 14, 6, 3, 6, 7, 3, 10, 9, 7, 3, 16, 5, 3, 18, 17, 5, 1, 18, 5, 5, 3, 18, 6, 5, 1, 18, 10, 10, 14, 4, 10, 12, 14, 2, 4, 10, 9, 4, 4, 12, 9, 2, 2, 0, 18, 9, 2, 3, 18, 3, 6, 3, 12, 8, 10, 3, 4, 8, 1, 1, 8, 5, 5, 1, 4, 5, 12, 7, 7, 8, 12, 11, 7, 4, 0, 12, 22, 4, 0, 14, 22, 2, 15, 6, 4, 15, 15, 11, 4, 5, 5, 7, 7, 8, 5, 11, 7, 4, 8, 18, 9, 4, 8, 20, 9, 2, 1, 2, 22, 4, 1, 4, 22, 2, 17, 3, 6, 17, 19, 3, 2, 17, 8, 2, 8, 18, 8, 11, 8, 9, 17, 0, 6, 12, 20, 0, 3, 6, 17, 6, 3, 6, 7, 0, 6, 9, 9, 0, 2, 9, 15, 5, 9, 12, 15, 11, 9, 6, 2, 22, 18, 2, 2, 23, 18, 1, 10, 10, 12, 6, 16, 10, 6, 3, 10, 13, 6, 3, 0, 1, 4, 11, 2, 1, 2, 11, 20, 0, 4, 10, 20, 0, 2, 10, 1, 3, 6, 17, 3, 3, 2, 17, 15, 15, 9, 6, 15, 17, 9, 2, 0, 13, 8, 9, 0, 16, 8, 3, 16, 8, 6, 12, 16, 12, 6, 4, 2, 8, 6, 12, 2, 12, 6, 4, 10, 2, 4, 15, 10, 7, 4, 5, 1, 5, 19, 3, 1, 6, 19, 1, 11, 8, 9, 7, 14, 8, 3, 7, 3, 8, 12, 9, 3, 11, 12, 3, 3, 6, 18, 3, 3, 7, 18, 1, 10, 0, 4, 12, 10, 6, 4, 6, 3, 9, 18, 14, 3, 9, 9, 14, 0, 0, 4, 9, 2, 0, 2, 9, 12, 5, 4, 18, 12, 5, 2, 18, 8, 5, 4, 18, 10, 5, 2, 18, 10, 5, 6, 10, 12, 5, 2, 10, 9, 4, 4, 11, 11, 4, 2, 11, 4, 16, 18, 3, 4, 17, 18, 1, 0, 16, 20, 3, 0, 17, 20, 1, 9, 9, 6, 12, 9, 13, 6, 4, 8, 13, 8, 8, 8, 17, 8, 4, 13, 10, 3, 12, 13, 16, 3, 6, 5, 9, 14, 14, 5, 9, 7, 7, 12, 16, 7, 7, 0, 0, 24, 10, 12, 0, 12, 5, 0, 5, 12, 5, 1, 11, 18, 2, 1, 12, 18, 1, 19, 5, 5, 12, 19, 9, 5, 4, 0, 5, 5, 12, 0, 9, 5, 4, 16, 6, 8, 18, 20, 6, 4, 9, 16, 15, 4, 9, 0, 6, 8, 18, 0, 6, 4, 9, 4, 15, 4, 9, 12, 5, 12, 12, 18, 5, 6, 6, 12, 11, 6, 6, 7, 6, 6, 9, 9, 6, 2, 9, 9, 13, 6, 11, 11, 13, 2, 11, 0, 5, 12, 12, 0, 5, 6, 6, 6, 11, 6, 6, 1, 2, 23, 3, 1, 3, 23, 1, 1, 15, 19, 3, 1, 16, 19, 1, 13, 17, 11, 4, 13, 19, 11, 2, 0, 13, 8, 5, 4, 13, 4, 5, 12, 10, 10, 4, 12, 10, 5, 4, 4, 6, 9, 9, 4, 9, 9, 3, 15, 14, 9, 6, 15, 16, 9, 2, 1, 12, 9, 6, 1, 14, 9, 2, 3, 10, 20, 8, 13, 10, 10, 4, 3, 14, 10, 4, 2, 0, 9, 18, 5, 0, 3, 18, 13, 11, 9, 10, 16, 11, 3, 10, 1, 2, 8, 5, 5, 2, 4, 5, 3, 4, 21, 6, 10, 4, 7, 6, 7, 0, 10, 14, 7, 0, 5, 7, 12, 7, 5, 7, 12, 17, 12, 4, 12, 19, 12, 2, 0, 6, 23, 4, 0, 8, 23, 2, 13, 10, 8, 10, 17, 10, 4, 5, 13, 15, 4, 5, 0, 16, 18, 3, 0, 17, 18, 1, 15, 16, 9, 4, 15, 18, 9, 2, 0, 16, 9, 4, 0, 18, 9, 2, 13, 11, 6, 6, 13, 11, 3, 6, 5, 11, 6, 6, 8, 11, 3, 6, 0, 3, 24, 6, 12, 3, 12, 3, 0, 6, 12, 3, 2, 4, 18, 3, 2, 5, 18, 1, 0, 0, 24, 4, 12, 0, 12, 2, 0, 2, 12, 2, 1, 16, 18, 3, 1, 17, 18, 1, 15, 15, 9, 6, 15, 17, 9, 2, 0, 15, 9, 6, 0, 17, 9, 2, 6, 17, 18, 3, 6, 18, 18, 1, 8, 8, 6, 10, 10, 8, 2, 10, 10, 6, 6, 9, 12, 6, 2, 9, 8, 8, 5, 8, 8, 12, 5, 4, 12, 8, 6, 8, 12, 12, 6, 4, 6, 5, 6, 11, 8, 5, 2, 11, 13, 6, 8, 9, 13, 9, 8, 3, 1, 7, 21, 6, 1, 9, 21, 2, 15, 5, 3, 12, 15, 11, 3, 6, 6, 9, 11, 12, 6, 13, 11, 4, 13, 8, 10, 8, 18, 8, 5, 4, 13, 12, 5, 4, 5, 8, 12, 3, 11, 8, 6, 3, 6, 11, 18, 4, 12, 11, 6, 4, 0, 0, 22, 22, 0, 11, 22, 11, 11, 2, 6, 8, 11, 6, 6, 4, 9, 0, 6, 9, 11, 0, 2, 9, 10, 0, 6, 9, 12, 0, 2, 9, 8, 3, 6, 14, 8, 3, 3, 7, 11, 10, 3, 7, 3, 10, 18, 8, 9, 10, 6, 8, 10, 0, 3, 14, 10, 7, 3, 7, 4, 3, 16, 20, 4, 13, 16, 10, 9, 4, 6, 10, 11, 4, 2, 10, 5, 0, 16, 4, 5, 2, 16, 2, 2, 5, 18, 4, 8, 5, 6, 4, 13, 0, 6, 9, 15, 0, 2, 9, 8, 4, 8, 5, 12, 4, 4, 5, 12, 10, 10, 4, 12, 10, 5, 4, 2, 10, 10, 4, 7, 10, 5, 4, 7, 11, 12, 5, 11, 11, 4, 5, 3, 10, 8, 10, 3, 10, 4, 5, 7, 15, 4, 5, 11, 12, 9, 8, 14, 12, 3, 8, 0, 21, 24, 3, 8, 21, 8, 3, 3, 20, 18, 4, 9, 20, 6, 4, 1, 15, 9, 6, 1, 17, 9, 2, 11, 17, 10, 4, 11, 19, 10, 2, 9, 12, 4, 12, 9, 18, 4, 6, 9, 6, 9, 6, 12, 6, 3, 6, 1, 13, 6, 9, 1, 16, 6, 3, 6, 16, 12, 4, 6, 18, 12, 2, 1, 5, 20, 3, 1, 6, 20, 1, 8, 1, 9, 9, 8, 4, 9, 3, 2, 19, 9, 4, 2, 21, 9, 2, 11, 1, 4, 18, 11, 7, 4, 6, 7, 2, 8, 12, 7, 2, 4, 6, 11, 8, 4, 6, 11, 10, 9, 8, 14, 10, 3, 8, 5, 11, 12, 5, 9, 11, 4, 5, 11, 9, 9, 6, 14, 9, 3, 6, 5, 10, 6, 9, 7, 10, 2, 9, 4, 7, 5, 12, 4, 11, 5, 4, 2, 0, 21, 6, 9, 0, 7, 6, 7, 6, 10, 6, 7, 8, 10, 2, 9, 0, 6, 15, 11, 0, 2, 15, 2, 2, 18, 2, 2, 3, 18, 1, 8, 17, 8, 6, 8, 20, 8, 3, 3, 0, 18, 2, 3, 1, 18, 1, 8, 0, 9, 6, 11, 0, 3, 6, 0, 17, 18, 3, 0, 18, 18, 1, 6, 7, 12, 5, 10, 7, 4, 5, 0, 3, 6, 9, 2, 3, 2, 9, 20, 2, 4, 9, 20, 2, 2, 9, 0, 2, 4, 9, 2, 2, 2, 9, 0, 1, 24, 4, 12, 1, 12, 2, 0, 3, 12, 2, 0, 16, 9, 6, 0, 18, 9, 2, 14, 13, 9, 6, 14, 15, 9, 2, 0, 15, 19, 3, 0, 16, 19, 1, 1, 5, 22, 12, 12, 5, 11, 6, 1, 11, 11, 6, 5, 13, 6, 6, 8, 13, 3, 6, 4, 2, 20, 3, 4, 3, 20, 1, 8, 14, 6, 10, 10, 14, 2, 10, 6, 12, 16, 6, 14, 12, 8, 3, 6, 15, 8, 3, 2, 13, 8, 9, 2, 16, 8, 3, 11, 8, 6, 14, 14, 8, 3, 7, 11, 15, 3, 7, 2, 12, 16, 6, 2, 12, 8, 3, 10, 15, 8, 3, 5, 16, 16, 8, 5, 20, 16, 4, 9, 1, 4, 12, 9, 7, 4, 6, 8, 2, 8, 10, 12, 2, 4, 5, 8, 7, 4, 5, 6, 6, 12, 6, 6, 6, 6, 3, 12, 9, 6, 3, 10, 7, 6, 9, 12, 7, 2, 9, 0, 0, 8, 12, 0, 0, 4, 6, 4, 6, 4, 6, 18, 8, 6, 9, 18, 11, 6, 3, 2, 12, 6, 6, 5, 12, 3, 6, 3, 21, 21, 3, 10, 21, 7, 3, 2, 0, 16, 6, 2, 3, 16, 3, 13, 6, 7, 6, 13, 9, 7, 3, 6, 4, 4, 14, 6, 11, 4, 7, 9, 7, 6, 9, 11, 7, 2, 9, 7, 8, 6, 14, 7, 8, 3, 7, 10, 15, 3, 7, 18, 8, 4, 16, 18, 16, 4, 8, 9, 14, 6, 10, 11, 14, 2, 10, 6, 11, 12, 5, 10, 11, 4, 5, 0, 12, 23, 3, 0, 13, 23, 1, 13, 0, 6, 12, 15, 0, 2, 12, 0, 10, 12, 5, 4, 10, 4, 5, 13, 2, 10, 4, 13, 4, 10, 2, 5, 0, 6, 12, 7, 0, 2, 12, 11, 6, 9, 6, 14, 6, 3, 6, 4, 6, 9, 6, 7, 6, 3, 6, 6, 11, 18, 13, 12, 11, 6, 13, 0, 11, 18, 13, 6, 11, 6, 13, 12, 16, 12, 6, 16, 16, 4, 6, 0, 6, 21, 3, 0, 7, 21, 1, 12, 16, 12, 6, 16, 16, 4, 6, 5, 7, 6, 14, 5, 14, 6, 7, 5, 10, 19, 2, 5, 11, 19, 1, 5, 4, 14, 4, 5, 6, 14, 2, 3, 18, 18, 4, 9, 18, 6, 4, 7, 0, 4, 9, 9, 0, 2, 9, 13, 3, 11, 4, 13, 5, 11, 2, 2, 0, 9, 6, 5, 0, 3, 6, 19, 1, 4, 23, 19, 1, 2, 23, 1, 1, 4, 23, 3, 1, 2, 23, 5, 16, 18, 3, 5, 17, 18, 1, 0, 3, 11, 4, 0, 5, 11, 2, 2, 16, 20, 3, 2, 17, 20, 1, 5, 3, 13, 4, 5, 5, 13, 2, 1, 9, 22, 15, 1, 9, 11, 15, 3, 4, 14, 3, 10, 4, 7, 3, 8, 7, 10, 4, 8, 7, 5, 4, 6, 7, 10, 4, 11, 7, 5, 4, 10, 4, 6, 9, 12, 4, 2, 9, 1, 12, 9, 6, 4, 12, 3, 6, 8, 3, 8, 10, 12, 3, 4, 5, 8, 8, 4, 5, 3, 6, 16, 6, 3, 6, 8, 3, 11, 9, 8, 3, 5, 6, 14, 6, 5, 9, 14, 3, 4, 3, 9, 6, 4, 5, 9, 2, 6, 3, 18, 2, 6, 4, 18, 1, 7, 6, 9, 6, 10, 6, 3, 6, 0, 1, 24, 3, 0, 2, 24, 1, 0, 17, 10, 6, 0, 19, 10, 2, 3, 18, 18, 3, 3, 19, 18, 1, 2, 5, 6, 16, 2, 5, 3, 8, 5, 13, 3, 8, 7, 6, 11, 6, 7, 8, 11, 2, 5, 2, 12, 22, 5, 13, 12, 11, 10, 7, 4, 10, 10, 12, 4, 5, 9, 0, 4, 18, 9, 6, 4, 6, 18, 8, 6, 9, 18, 11, 6, 3, 4, 7, 15, 10, 9, 7, 5, 10, 10, 5, 6, 9, 12, 5, 2, 9, 9, 9, 6, 10, 11, 9, 2, 10, 11, 14, 6, 10, 13, 14, 2, 10, 7, 14, 6, 10, 9, 14, 2, 10, 4, 8, 16, 9, 4, 11, 16, 3, 2, 11, 20, 3, 2, 12, 20, 1, 13, 0, 4, 13, 13, 0, 2, 13, 7, 0, 4, 13, 9, 0, 2, 13, 3, 1, 18, 7, 9, 1, 6, 7, 1, 11, 6, 9, 1, 14, 6, 3, 8, 18, 9, 6, 8, 20, 9, 2, 3, 9, 15, 6, 3, 11, 15, 2, 5, 10, 19, 2, 5, 11, 19, 1, 8, 6, 7, 16, 8, 14, 7, 8, 9, 14, 9, 6, 9, 16, 9, 2, 0, 7, 8, 12, 0, 11, 8, 4, 6, 4, 18, 3, 6, 5, 18, 1, 0, 16, 12, 6, 4, 16, 4, 6, 13, 13, 9, 4, 13, 15, 9, 2, 5, 8, 14, 14, 5, 8, 7, 7, 12, 15, 7, 7, 1, 16, 22, 6, 12, 16, 11, 3, 1, 19, 11, 3, 9, 0, 6, 9, 11, 0, 2, 9, 9, 5, 10, 10, 14, 5, 5, 5, 9, 10, 5, 5, 5, 5, 10, 10, 5, 5, 5, 5, 10, 10, 5, 5, 4, 6, 16, 6, 12, 6, 8, 3, 4, 9, 8, 3, 0, 7, 6, 9, 0, 10, 6, 3, 16, 10, 8, 14, 20, 10, 4, 7, 16, 17, 4, 7, 9, 12, 6, 12, 9, 18, 6, 6, 8, 10, 8, 12, 12, 10, 4, 6, 8, 16, 4, 6, 8, 0, 4, 9, 10, 0, 2, 9, 10, 4, 8, 16, 14, 4, 4, 8, 10, 12, 4, 8, 7, 10, 10, 6, 7, 12, 10, 2, 5, 6, 14, 14, 12, 6, 7, 7, 5, 13, 7, 7, 2, 11, 20, 2, 2, 12, 20, 1, 18, 8, 4, 16, 18, 16, 4, 8, 1, 11, 12, 10, 1, 11, 6, 5, 7, 16, 6, 5, 6, 9, 12, 4, 6, 11, 12, 2, 9, 12, 6, 7, 12, 12, 3, 7, 10, 4, 8, 16, 14, 4, 4, 8, 10, 12, 4, 8, 6, 4, 8, 16, 6, 4, 4, 8, 10, 12, 4, 8, 8, 9, 9, 6, 11, 9, 3, 6, 1, 5, 16, 12, 1, 5, 8, 6, 9, 11, 8, 6, 9, 9, 6, 8, 9, 9, 3, 8, 6, 0, 3, 18, 7, 0, 1, 18, 17, 9, 5, 14, 17, 16, 5, 7, 2, 9, 5, 14, 2, 16, 5, 7, 7, 4, 10, 6, 7, 7, 10, 3, 1, 3, 23, 18, 1, 9, 23, 6, 1, 1, 21, 3, 8, 1, 7, 3, 9, 6, 6, 9, 11, 6, 2, 9, 3, 18, 12, 6, 3, 18, 6, 3, 9, 21, 6, 3, 16, 8, 8, 16, 20, 8, 4, 8, 16, 16, 4, 8, 0, 19, 24, 4, 8, 19, 8, 4, 16, 8, 8, 16, 20, 8, 4, 8, 16, 16, 4, 8, 0, 8, 8, 16, 0, 8, 4, 8, 4, 16, 4, 8, 8, 12, 8, 10, 8, 17, 8, 5, 5, 7, 5, 8, 5, 11, 5, 4, 4, 1, 19, 2, 4, 2, 19, 1, 0, 12, 24, 9, 8, 12, 8, 9, 6, 0, 13, 8, 6, 4, 13, 4, 0, 0, 24, 3, 0, 1, 24, 1, 20, 3, 4, 11, 20, 3, 2, 11, 8, 6, 6, 9, 10, 6, 2, 9, 6, 11, 12, 8, 12, 11, 6, 4, 6, 15, 6, 4, 0, 8, 12, 6, 0, 8, 6, 3, 6, 11, 6, 3, 6, 17, 18, 3, 6, 18, 18, 1, 0, 14, 9, 6, 0, 16, 9, 2, 20, 3, 4, 9, 20, 3, 2, 9, 0, 3, 4, 9, 2, 3, 2, 9, 15, 0, 9, 19, 18, 0, 3, 19, 0, 0, 9, 19, 3, 0, 3, 19, 13, 11, 6, 8, 13, 11, 3, 8, 5, 11, 6, 8, 8, 11, 3, 8, 5, 11, 19, 3, 5, 12, 19, 1, 3, 20, 18, 4, 9, 20, 6, 4, 6, 6, 16, 6, 6, 8, 16, 2, 6, 0, 9, 6, 9, 0, 3, 6, 10, 3, 4, 14, 10, 10, 4, 7, 1, 5, 15, 12, 1, 11, 15, 6, 11, 12, 8, 5, 11, 12, 4, 5, 5, 0, 6, 9, 7, 0, 2, 9, 12, 0, 6, 9, 14, 0, 2, 9, 5, 5, 12, 8, 5, 5, 6, 4, 11, 9, 6, 4, 13, 12, 11, 6, 13, 14, 11, 2, 0, 13, 21, 3, 0, 14, 21, 1, 8, 1, 8, 12, 12, 1, 4, 6, 8, 7, 4, 6, 1, 0, 6, 12, 1, 0, 3, 6, 4, 6, 3, 6, 2, 2, 21, 2, 2, 3, 21, 1, 2, 2, 19, 3, 2, 3, 19, 1, 17, 10, 6, 14, 20, 10, 3, 7, 17, 17, 3, 7, 1, 10, 6, 14, 1, 10, 3, 7, 4, 17, 3, 7, 7, 6, 14, 14, 14, 6, 7, 7, 7, 13, 7, 7, 0, 12, 9, 6, 0, 14, 9, 2, 15, 14, 8, 9, 15, 17, 8, 3, 1, 1, 22, 4, 1, 1, 11, 2, 12, 3, 11, 2, 9, 11, 9, 6, 9, 13, 9, 2, 0, 15, 18, 3, 0, 16, 18, 1, 16, 14, 7, 9, 16, 17, 7, 3, 4, 3, 16, 4, 12, 3, 8, 4, 7, 6, 12, 5, 7, 6, 6, 5, 9, 6, 4, 9, 11, 6, 2, 9, 12, 1, 4, 10, 12, 1, 2, 10, 8, 1, 4, 10, 10, 1, 2, 10, 15, 15, 6, 9, 15, 18, 6, 3, 3, 15, 6, 9, 3, 18, 6, 3, 15, 1, 3, 19, 16, 1, 1, 19, 1, 3, 6, 9, 3, 3, 2, 9, 15, 0, 3, 19, 16, 0, 1, 19, 6, 3, 12, 4, 12, 3, 6, 4, 10, 5, 4, 9, 10, 5, 2, 9, 6, 0, 3, 19, 7, 0, 1, 19, 11, 1, 3, 12, 11, 7, 3, 6, 6, 7, 10, 5, 11, 7, 5, 5, 11, 3, 3, 18, 12, 3, 1, 18, 9, 3, 6, 12, 11, 3, 2, 12, 3, 7, 19, 3, 3, 8, 19, 1, 2, 7, 18, 3, 2, 8, 18, 1, 3, 13, 18, 4, 12, 13, 9, 2, 3, 15, 9, 2, 3, 5, 6, 9, 5, 5, 2, 9, 4, 1, 20, 4, 14, 1, 10, 2, 4, 3, 10, 2, 0, 1, 20, 4, 0, 1, 10, 2, 10, 3, 10, 2, 10, 15, 6, 6, 10, 15, 3, 6, 0, 2, 24, 8, 8, 2, 8, 8, 5, 5, 18, 3, 5, 6, 18, 1, 8, 15, 6, 6, 11, 15, 3, 6, 11, 12, 8, 5, 11, 12, 4, 5, 5, 12, 8, 5, 9, 12, 4, 5, 5, 0, 14, 6, 5, 2, 14, 2, 10, 2, 4, 15, 10, 7, 4, 5, 10, 7, 5, 12, 10, 11, 5, 4, 7, 9, 8, 14, 7, 9, 4, 7, 11, 16, 4, 7, 1, 5, 22, 6, 12, 5, 11, 3, 1, 8, 11, 3, 0, 5, 6, 6, 0, 8, 6, 3, 12, 17, 9, 4, 12, 19, 9, 2, 2, 18, 19, 3, 2, 19, 19, 1, 12, 17, 9, 4, 12, 19, 9, 2, 1, 17, 18, 3, 1, 18, 18, 1, 12, 17, 9, 4, 12, 19, 9, 2, 0, 0, 24, 3, 0, 1, 24, 1, 5, 0, 14, 4, 5, 2, 14, 2, 6, 14, 9, 6, 6, 16, 9, 2, 14, 13, 6, 9, 14, 16, 6, 3, 5, 20, 13, 4, 5, 22, 13, 2, 9, 9, 6, 12, 9, 13, 6, 4, 1, 10, 21, 3, 8, 10, 7, 3, 8, 8, 9, 6, 11, 8, 3, 6, 3, 10, 9, 7, 6, 10, 3, 7, 12, 10, 10, 8, 17, 10, 5, 4, 12, 14, 5, 4, 0, 15, 24, 3, 8, 15, 8, 3, 8, 5, 9, 6, 8, 7, 9, 2, 4, 13, 6, 9, 4, 16, 6, 3, 12, 17, 9, 4, 12, 19, 9, 2, 9, 12, 6, 6, 9, 15, 6, 3, 9, 9, 14, 10, 16, 9, 7, 5, 9, 14, 7, 5, 1, 9, 14, 10, 1, 9, 7, 5, 8, 14, 7, 5, 8, 7, 9, 17, 11, 7, 3, 17, 3, 4, 6, 20, 3, 4, 3, 10, 6, 14, 3, 10, 7, 8, 10, 4, 7, 8, 5, 4, 10, 7, 4, 9, 12, 7, 2, 9, 10, 15, 6, 9, 12, 15, 2, 9, 3, 8, 6, 16, 3, 8, 3, 8, 6, 16, 3, 8, 12, 17, 9, 4, 12, 19, 9, 2, 3, 17, 9, 4, 3, 19, 9, 2, 10, 1, 9, 6, 13, 1, 3, 6, 5, 7, 4, 10, 5, 12, 4, 5, 7, 5, 12, 6, 11, 5, 4, 6, 6, 4, 9, 8, 9, 4, 3, 8, 12, 16, 10, 8, 17, 16, 5, 4, 12, 20, 5, 4, 2, 16, 10, 8, 2, 16, 5, 4, 7, 20, 5, 4, 0, 0, 24, 4, 12, 0, 12, 2, 0, 2, 12, 2, 0, 6, 9, 6, 0, 8, 9, 2, 0, 4, 24, 6, 12, 4, 12, 3, 0, 7, 12, 3, 5, 0, 11, 4, 5, 2, 11, 2, 1, 1, 22, 4, 12, 1, 11, 2, 1, 3, 11, 2, 9, 6, 6, 18, 9, 15, 6, 9, 2, 9, 20, 4, 2, 11, 20, 2, 5, 2, 14, 14, 5, 9, 14, 7, 4, 2, 16, 6, 4, 5, 16, 3, 2, 3, 19, 3, 2, 4, 19, 1, 7, 1, 10, 4, 7, 3, 10, 2, 0, 9, 4, 15, 0, 14, 4, 5, 2, 10, 21, 3, 2, 11, 21, 1, 3, 0, 6, 6, 6, 0, 3, 6, 6, 4, 14, 9, 6, 7, 14, 3, 9, 1, 6, 9, 11, 1, 2, 9, 15, 8, 9, 9, 15, 11, 9, 3, 8, 0, 4, 21, 8, 7, 4, 7, 3, 22, 19, 2, 3, 23, 19, 1, 2, 15, 20, 3, 2, 16, 20, 1, 19, 0, 4, 13, 19, 0, 2, 13, 1, 7, 8, 8, 1, 11, 8, 4, 14, 14, 6, 9, 14, 17, 6, 3, 4, 14, 6, 9, 4, 17, 6, 3, 14, 5, 4, 10, 14, 5, 2, 10, 6, 5, 4, 10, 8, 5, 2, 10, 14, 5, 6, 6, 14, 8, 6, 3, 4, 5, 6, 6, 4, 8, 6, 3, 0, 2, 24, 21, 8, 2, 8, 21, 1, 2, 6, 13, 3, 2, 2, 13, 20, 0, 4, 21, 20, 0, 2, 21, 0, 4, 4, 20, 2, 4, 2, 20, 8, 16, 9, 6, 8, 18, 9, 2, 7, 0, 6, 9, 9, 0, 2, 9, 16, 12, 7, 9, 16, 15, 7, 3, 5, 21, 14, 3, 12, 21, 7, 3, 11, 5, 6, 9, 11, 5, 3, 9, 10, 5, 4, 10, 12, 5, 2, 10, 10, 6, 6, 9, 12, 6, 2, 9, 7, 5, 6, 9, 10, 5, 3, 9, 14, 14, 10, 4, 14, 16, 10, 2, 5, 5, 14, 14, 5, 5, 7, 7, 12, 12, 7, 7, 12, 8, 12, 6, 18, 8, 6, 3, 12, 11, 6, 3, 6, 6, 12, 12, 6, 6, 6, 6, 12, 12, 6, 6, 11, 13, 6, 10, 13, 13, 2, 10, 1, 10, 20, 8, 1, 10, 10, 4, 11, 14, 10, 4, 15, 13, 9, 6, 15, 15, 9, 2, 9, 0, 6, 9, 9, 3, 6, 3, 10, 1, 5, 14, 10, 8, 5, 7, 3, 4, 16, 6, 3, 6, 16, 2, 16, 3, 8, 9, 16, 6, 8, 3, 7, 13, 6, 10, 9, 13, 2, 10, 15, 13, 9, 6, 15, 15, 9, 2, 0, 13, 9, 6, 0, 15, 9, 2, 13, 16, 9, 6, 13, 18, 9, 2, 2, 16, 9, 6, 2, 18, 9, 2, 5, 16, 18, 3, 5, 17, 18, 1, 1, 16, 18, 3, 1, 17, 18, 1, 5, 0, 18, 3, 5, 1, 18, 1, 1, 1, 19, 2, 1, 2, 19, 1, 14, 2, 6, 11, 16, 2, 2, 11, 4, 15, 15, 6, 9, 15, 5, 6, 14, 2, 6, 11, 16, 2, 2, 11, 4, 2, 6, 11, 6, 2, 2, 11, 18, 2, 6, 9, 18, 5, 6, 3, 1, 2, 22, 4, 1, 2, 11, 2, 12, 4, 11, 2, 2, 0, 21, 12, 9, 0, 7, 12, 0, 12, 18, 3, 0, 13, 18, 1, 12, 2, 6, 9, 14, 2, 2, 9, 3, 10, 18, 3, 3, 11, 18, 1, 16, 3, 8, 9, 16, 6, 8, 3, 3, 7, 18, 3, 3, 8, 18, 1, 9, 11, 6, 9, 11, 11, 2, 9, 9, 8, 6, 9, 11, 8, 2, 9, 15, 0, 2, 18, 15, 0, 1, 18, 7, 0, 2, 18, 8, 0, 1, 18, 17, 3, 7, 9, 17, 6, 7, 3, 3, 18, 9, 6, 3, 20, 9, 2, 3, 18, 21, 3, 3, 19, 21, 1, 0, 3, 7, 9, 0, 6, 7, 3, 2, 7, 22, 3, 2, 8, 22, 1, 0, 3, 24, 16, 0, 3, 12, 8, 12, 11, 12, 8, 13, 17, 9, 4, 13, 19, 9, 2, 5, 5, 12, 8, 5, 5, 6, 4, 11, 9, 6, 4, 5, 6, 14, 6, 12, 6, 7, 3, 5, 9, 7, 3, 5, 16, 14, 6, 5, 16, 7, 3, 12, 19, 7, 3, 18, 2, 6, 9, 18, 5, 6, 3, 0, 2, 6, 9, 0, 5, 6, 3, 3, 4, 20, 10, 13, 4, 10, 5, 3, 9, 10, 5, 2, 13, 9, 8, 5, 13, 3, 8, 2, 1, 21, 15, 9, 1, 7, 15, 5, 12, 14, 8, 12, 12, 7, 8, 6, 7, 12, 4, 6, 7, 6, 4, 6, 5, 9, 6, 9, 5, 3, 6, 13, 11, 6, 6, 13, 11, 3, 6, 5, 11, 6, 6, 8, 11, 3, 6, 6, 4, 18, 2, 6, 5, 18, 1, 0, 2, 6, 11, 2, 2, 2, 11, 18, 0, 6, 15, 20, 0, 2, 15, 0, 0, 6, 13, 2, 0, 2, 13, 12, 0, 6, 9, 14, 0, 2, 9, 6, 0, 6, 9, 8, 0, 2, 9, 0, 2, 24, 4, 8, 2, 8, 4, 3, 13, 18, 4, 12, 13, 9, 4, 9, 7, 10, 4, 9, 7, 5, 4, 5, 8, 12, 3, 11, 8, 6, 3, 4, 14, 19, 3, 4, 15, 19, 1, 10, 0, 4, 20, 10, 10, 4, 10, 8, 15, 9, 6, 8, 17, 9, 2, 2, 9, 15, 4, 7, 9, 5, 4, 8, 4, 12, 7, 12, 4, 4, 7, 0, 10, 6, 9, 0, 13, 6, 3, 18, 5, 6, 9, 18, 8, 6, 3, 0, 18, 16, 6, 0, 18, 8, 3, 8, 21, 8, 3, 9, 18, 14, 6, 16, 18, 7, 3, 9, 21, 7, 3, 1, 20, 20, 4, 1, 20, 10, 2, 11, 22, 10, 2, 2, 8, 20, 6, 12, 8, 10, 3, 2, 11, 10, 3, 7, 8, 6, 9, 9, 8, 2, 9, 8, 5, 12, 8, 12, 5, 4, 8, 4, 5, 12, 8, 8, 5, 4, 8, 10, 6, 6, 9, 12, 6, 2, 9, 2, 0, 6, 16, 4, 0, 2, 16, 15, 4, 6, 12, 15, 8, 6, 4, 3, 4, 6, 12, 3, 8, 6, 4, 15, 12, 9, 6, 15, 14, 9, 2, 4, 0, 15, 22, 4, 11, 15, 11, 15, 12, 9, 6, 15, 14, 9, 2, 0, 12, 9, 6, 0, 14, 9, 2, 15, 15, 9, 6, 15, 17, 9, 2, 0, 15, 9, 6, 0, 17, 9, 2, 10, 0, 8, 10, 14, 0, 4, 5, 10, 5, 4, 5, 1, 0, 4, 16, 3, 0, 2, 16, 7, 6, 10, 6, 7, 8, 10, 2, 10, 12, 4, 10, 10, 17, 4, 5, 8, 4, 10, 6, 8, 6, 10, 2, 3, 22, 18, 2, 12, 22, 9, 2, 7, 7, 11, 6, 7, 9, 11, 2, 0, 0, 12, 10, 0, 0, 6, 5, 6, 5, 6, 5, 10, 1, 12, 6, 16, 1, 6, 3, 10, 4, 6, 3, 7, 16, 9, 4, 7, 18, 9, 2, 5, 7, 15, 16, 10, 7, 5, 16, 5, 10, 12, 13, 11, 10, 6, 13, 6, 2, 12, 6, 12, 2, 6, 3, 6, 5, 6, 3, 3, 9, 12, 9, 3, 12, 12, 3, 16, 2, 8, 6, 16, 5, 8, 3, 0, 2, 8, 6, 0, 5, 8, 3, 0, 3, 24, 11, 0, 3, 12, 11, 0, 13, 8, 10, 0, 13, 4, 5, 4, 18, 4, 5, 10, 14, 4, 10, 10, 19, 4, 5, 10, 2, 4, 21, 10, 9, 4, 7, 4, 4, 15, 9, 4, 7, 15, 3, 0, 1, 24, 6, 8, 1, 8, 6, 9, 6, 5, 16, 9, 14, 5, 8, 3, 21, 18, 3, 9, 21, 6, 3, 6, 5, 3, 12, 6, 11, 3, 6, 11, 6, 4, 9, 11, 6, 2, 9, 5, 6, 9, 8, 8, 6, 3, 8, 4, 3, 20, 2, 4, 4, 20, 1, 2, 10, 18, 3, 8, 10, 6, 3, 7, 15, 10, 6, 7, 17, 10, 2, 1, 4, 4, 18, 1, 4, 2, 9, 3, 13, 2, 9, 13, 0, 6, 9, 15, 0, 2, 9, 5, 0, 6, 9, 7, 0, 2, 9, 11, 0, 6, 9, 13, 0, 2, 9, 6, 7, 9, 6, 9, 7, 3, 6, 3, 0, 18, 2, 3, 1, 18, 1, 0, 10, 20, 4, 0, 10, 10, 2, 10, 12, 10, 2, 10, 2, 4, 12, 10, 8, 4, 6, 6, 5, 6, 12, 6, 5, 3, 6, 9, 11, 3, 6, 6, 0, 18, 22, 15, 0, 9, 11, 6, 11, 9, 11, 0, 0, 18, 22, 0, 0, 9, 11, 9, 11, 9, 11, 18, 2, 6, 11, 20, 2, 2, 11, 0, 2, 6, 11, 2, 2, 2, 11, 11, 0, 6, 9, 13, 0, 2, 9, 0, 0, 20, 3, 0, 1, 20, 1, 2, 2, 20, 2, 2, 3, 20, 1, 1, 10, 18, 2, 1, 11, 18, 1, 18, 7, 6, 9, 18, 10, 6, 3, 0, 0, 22, 9, 0, 3, 22, 3, 17, 3, 6, 9, 17, 6, 6, 3, 0, 7, 6, 9, 0, 10, 6, 3, 0, 6, 24, 6, 0, 8, 24, 2, 0, 2, 6, 10, 2, 2, 2, 10, 10, 6, 6, 9, 12, 6, 2, 9, 7, 0, 6, 9, 9, 0, 2, 9, 15, 0, 6, 9, 17, 0, 2, 9, 3, 0, 6, 9, 5, 0, 2, 9, 15, 17, 9, 6, 15, 19, 9, 2, 0, 17, 18, 3, 0, 18, 18, 1, 15, 14, 9, 6, 15, 16, 9, 2, 0, 15, 23, 6, 0, 17, 23, 2, 5, 15, 18, 3, 5, 16, 18, 1, 0, 14, 9, 6, 0, 16, 9, 2, 9, 8, 8, 10, 13, 8, 4, 5, 9, 13, 4, 5, 3, 7, 15, 6, 8, 7, 5, 6, 9, 8, 8, 10, 13, 8, 4, 5, 9, 13, 4, 5, 5, 0, 6, 12, 8, 0, 3, 12, 9, 8, 8, 10, 13, 8, 4, 5, 9, 13, 4, 5, 8, 5, 6, 9, 10, 5, 2, 9, 10, 6, 4, 18, 12, 6, 2, 9, 10, 15, 2, 9, 5, 7, 12, 4, 11, 7, 6, 4, 9, 8, 8, 10, 13, 8, 4, 5, 9, 13, 4, 5, 7, 8, 8, 10, 7, 8, 4, 5, 11, 13, 4, 5, 11, 10, 6, 14, 14, 10, 3, 7, 11, 17, 3, 7, 9, 5, 6, 19, 12, 5, 3, 19, 6, 12, 12, 6, 12, 12, 6, 3, 6, 15, 6, 3, 1, 9, 18, 6, 1, 9, 9, 3, 10, 12, 9, 3, 16, 14, 8, 10, 20, 14, 4, 5, 16, 19, 4, 5, 0, 9, 22, 8, 0, 9, 11, 4, 11, 13, 11, 4, 8, 18, 12, 6, 14, 18, 6, 3, 8, 21, 6, 3, 0, 6, 20, 18, 0, 6, 10, 9, 10, 15, 10, 9, 3, 6, 20, 12, 13, 6, 10, 6, 3, 12, 10, 6, 0, 16, 10, 8, 0, 16, 5, 4, 5, 20, 5, 4, 6, 16, 18, 3, 6, 17, 18, 1, 0, 11, 19, 3, 0, 12, 19, 1, 14, 6, 6, 9, 14, 9, 6, 3, 1, 7, 22, 4, 1, 7, 11, 2, 12, 9, 11, 2, 13, 6, 7, 12, 13, 10, 7, 4, 4, 7, 11, 9, 4, 10, 11, 3, 12, 10, 10, 8, 17, 10, 5, 4, 12, 14, 5, 4, 2, 12, 9, 7, 5, 12, 3, 7, 16, 14, 6, 9, 16, 17, 6, 3, 3, 12, 6, 12, 3, 16, 6, 4, 14, 13, 6, 6, 14, 16, 6, 3, 8, 0, 6, 9, 10, 0, 2, 9, 9, 1, 6, 23, 11, 1, 2, 23, 0, 16, 9, 6, 0, 18, 9, 2, 4, 17, 18, 3, 4, 18, 18, 1, 5, 2, 13, 14, 5, 9, 13, 7, 15, 0, 8, 12, 19, 0, 4, 6, 15, 6, 4, 6, 0, 0, 8, 12, 0, 0, 4, 6, 4, 6, 4, 6, 8, 2, 8, 7, 8, 2, 4, 7, 1, 1, 6, 9, 3, 1, 2, 9, 14, 8, 6, 12, 17, 8, 3, 6, 14, 14, 3, 6, 4, 8, 6, 12, 4, 8, 3, 6, 7, 14, 3, 6, 16, 5, 5, 15, 16, 10, 5, 5, 3, 5, 5, 15, 3, 10, 5, 5, 18, 4, 6, 9, 18, 7, 6, 3, 1, 7, 6, 15, 1, 12, 6, 5, 11, 15, 12, 8, 17, 15, 6, 4, 11, 19, 6, 4, 0, 2, 24, 4, 0, 2, 12, 2, 12, 4, 12, 2, 15, 1, 2, 19, 15, 1, 1, 19, 7, 1, 2, 19, 8, 1, 1, 19, 22, 1, 2, 20, 22, 1, 1, 20, 0, 1, 2, 20, 1, 1, 1, 20, 18, 11, 6, 12, 20, 11, 2, 12, 0, 11, 6, 12, 2, 11, 2, 12, 3, 6, 18, 14, 3, 13, 18, 7, 6, 10, 7, 8, 6, 14, 7, 4, 7, 9, 12, 12, 7, 13, 12, 4, 2, 18, 18, 5, 11, 18, 9, 5, 4, 21, 20, 3, 4, 22, 20, 1, 9, 12, 6, 12, 9, 12, 3, 6, 12, 18, 3, 6, 4, 6, 18, 3, 4, 7, 18, 1, 3, 6, 18, 3, 3, 7, 18, 1, 18, 4, 6, 9, 18, 7, 6, 3, 2, 12, 9, 6, 2, 14, 9, 2, 4, 14, 18, 4, 13, 14, 9, 2, 4, 16, 9, 2, 7, 7, 6, 14, 7, 7, 3, 7, 10, 14, 3, 7, 7, 13, 12, 6, 13, 13, 6, 3, 7, 16, 6, 3, 6, 7, 12, 9, 10, 7, 4, 9, 12, 12, 6, 6, 12, 12, 3, 6, 0, 2, 4, 10, 0, 7, 4, 5, 8, 0, 9, 6, 11, 0, 3, 6, 2, 9, 12, 6, 2, 12, 12, 3, 13, 10, 6, 9, 13, 13, 6, 3, 5, 10, 6, 9, 5, 13, 6, 3, 9, 15, 9, 6, 9, 17, 9, 2, 5, 16, 12, 6, 5, 19, 12, 3, 3, 2, 20, 3, 3, 3, 20, 1, 2, 5, 12, 6, 6, 5, 4, 6, 11, 0, 3, 24, 12, 0, 1, 24, 3, 16, 15, 4, 8, 16, 5, 4, 9, 12, 6, 12, 9, 18, 6, 6, 1, 15, 12, 8, 1, 15, 6, 4, 7, 19, 6, 4, 15, 10, 8, 14, 19, 10, 4, 7, 15, 17, 4, 7, 1, 9, 8, 14, 1, 9, 4, 7, 5, 16, 4, 7, 9, 11, 9, 10, 9, 16, 9, 5, 6, 7, 12, 6, 6, 9, 12, 2, 10, 15, 6, 9, 12, 15, 2, 9, 7, 8, 9, 7, 10, 8, 3, 7, 10, 4, 8, 10, 14, 4, 4, 5, 10, 9, 4, 5, 4, 6, 6, 9, 4, 9, 6, 3, 0, 6, 24, 12, 8, 6, 8, 12, 3, 7, 6, 14, 6, 7, 3, 14, 19, 8, 5, 8, 19, 12, 5, 4, 0, 8, 5, 8, 0, 12, 5, 4, 17, 3, 6, 6, 17, 6, 6, 3, 1, 3, 6, 6, 1, 6, 6, 3, 18, 2, 6, 9, 18, 5, 6, 3, 0, 2, 6, 9, 0, 5, 6, 3, 3, 3, 18, 6, 3, 5, 18, 2, 2, 3, 9, 6, 2, 5, 9, 2, 9, 3, 10, 8, 14, 3, 5, 4, 9, 7, 5, 4, 5, 3, 10, 8, 5, 3, 5, 4, 10, 7, 5, 4, 10, 11, 6, 12, 10, 11, 3, 12, 8, 11, 6, 11, 11, 11, 3, 11, 7, 8, 10, 4, 7, 8, 5, 4, 9, 6, 6, 7, 12, 6, 3, 7, 5, 18, 18, 3, 5, 19, 18, 1, 8, 4, 6, 9, 10, 4, 2, 9, 8, 1, 9, 7, 11, 1, 3, 7, 6, 11, 6, 6, 9, 11, 3, 6, 14, 12, 4, 11, 14, 12, 2, 11, 6, 12, 4, 11, 8, 12, 2, 11, 8, 0, 12, 18, 12, 0, 4, 18, 2, 12, 10, 5, 7, 12, 5, 5, 2, 20, 22, 3, 2, 21, 22, 1, 0, 4, 2, 20, 1, 4, 1, 20, 0, 2, 24, 4, 8, 2, 8, 4, 7, 8, 10, 4, 7, 10, 10, 2, 6, 7, 8, 10, 6, 7, 4, 5, 10, 12, 4, 5, 14, 0, 6, 14, 17, 0, 3, 7, 14, 7, 3, 7, 4, 11, 5, 8, 4, 15, 5, 4, 2, 0, 20, 9, 2, 3, 20, 3, 6, 7, 12, 8, 6, 7, 6, 4, 12, 11, 6, 4, 9, 17, 6, 6, 9, 20, 6, 3, 7, 10, 10, 4, 7, 12, 10, 2, 6, 5, 12, 9, 10, 5, 4, 9, 5, 11, 6, 8, 8, 11, 3, 8, 18, 4, 4, 17, 18, 4, 2, 17, 0, 0, 6, 6, 3, 0, 3, 6, 18, 4, 4, 17, 18, 4, 2, 17, 2, 4, 4, 17, 4, 4, 2, 17, 5, 18, 19, 3, 5, 19, 19, 1, 11, 0, 2, 18, 11, 9, 2, 9, 15, 4, 2, 18, 15, 13, 2, 9, 7, 4, 2, 18, 7, 13, 2, 9, 7, 11, 10, 8, 12, 11, 5, 4, 7, 15, 5, 4, 10, 6, 4, 9, 12, 6, 2, 9, 10, 0, 6, 9, 12, 0, 2, 9, 2, 9, 16, 8, 2, 9, 8, 4, 10, 13, 8, 4, 14, 15, 6, 9, 14, 18, 6, 3, 8, 7, 6, 9, 10, 7, 2, 9, 14, 15, 6, 9, 14, 18, 6, 3, 3, 12, 12, 6, 3, 14, 12, 2, 14, 12, 9, 6, 14, 14, 9, 2, 1, 12, 9, 6, 1, 14, 9, 2, 3, 7, 18, 3, 3, 8, 18, 1, 1, 7, 22, 6, 1, 9, 22, 2, 18, 4, 6, 6, 18, 7, 6, 3, 0, 4, 6, 6, 0, 7, 6, 3, 5, 11, 16, 6, 5, 14, 16, 3, 6, 16, 9, 4, 6, 18, 9, 2, 14, 15, 6, 9, 14, 18, 6, 3, 4, 15, 6, 9, 4, 18, 6, 3, 15, 1, 6, 23, 17, 1, 2, 23, 0, 21, 24, 3, 8, 21, 8, 3, 0, 20, 24, 4, 8, 20, 8, 4, 3, 1, 6, 23, 5, 1, 2, 23, 3, 17, 18, 3, 3, 18, 18, 1, 0, 16, 18, 3, 0, 17, 18, 1, 1, 16, 22, 4, 12, 16, 11, 2, 1, 18, 11, 2, 0, 16, 9, 6, 0, 18, 9, 2, 2, 10, 21, 3, 9, 10, 7, 3, 2, 18, 12, 6, 2, 18, 6, 3, 8, 21, 6, 3, 0, 5, 24, 4, 0, 7, 24, 2, 10, 2, 4, 15, 10, 7, 4, 5, 10, 7, 6, 12, 10, 13, 6, 6, 6, 6, 6, 9, 8, 6, 2, 9, 11, 0, 6, 9, 13, 0, 2, 9, 9, 7, 6, 9, 11, 7, 2, 9, 2, 1, 20, 3, 2, 2, 20, 1, 1, 18, 12, 6, 1, 18, 6, 3, 7, 21, 6, 3, 13, 2, 4, 13, 13, 2, 2, 13, 6, 7, 12, 4, 12, 7, 6, 4, 10, 1, 4, 13, 10, 1, 2, 13, 6, 0, 3, 18, 7, 0, 1, 18, 14, 3, 10, 5, 14, 3, 5, 5, 6, 15, 12, 8, 10, 15, 4, 8, 9, 10, 6, 9, 11, 10, 2, 9, 8, 3, 4, 9, 10, 3, 2, 9, 17, 0, 6, 14, 20, 0, 3, 7, 17, 7, 3, 7, 1, 0, 6, 14, 1, 0, 3, 7, 4, 7, 3, 7, 14, 0, 6, 16, 17, 0, 3, 8, 14, 8, 3, 8, 7, 4, 4, 10, 9, 4, 2, 10, 3, 17, 18, 6, 12, 17, 9, 3, 3, 20, 9, 3, 1, 20, 22, 4, 12, 20, 11, 4, 14, 3, 10, 5, 14, 3, 5, 5, 0, 3, 10, 5, 5, 3, 5, 5, 12, 6, 12, 16, 16, 6, 4, 16, 0, 6, 12, 16, 4, 6, 4, 16, 10, 9, 5, 15, 10, 14, 5, 5, 1, 18, 21, 2, 1, 19, 21, 1, 15, 0, 9, 6, 15, 2, 9, 2, 6, 1, 12, 4, 12, 1, 6, 4, 6, 0, 12, 12, 12, 0, 6, 6, 6, 6, 6, 6, 8, 10, 8, 12, 8, 10, 4, 6, 12, 16, 4, 6, 14, 16, 10, 8, 19, 16, 5, 4, 14, 20, 5, 4, 0, 16, 10, 8, 0, 16, 5, 4, 5, 20, 5, 4, 10, 12, 12, 5, 14, 12, 4, 5, 6, 16, 10, 8, 6, 16, 5, 4, 11, 20, 5, 4, 7, 6, 12, 6, 13, 6, 6, 3, 7, 9, 6, 3, 9, 6, 4, 18, 9, 6, 2, 9, 11, 15, 2, 9, 10, 9, 6, 14, 13, 9, 3, 7, 10, 16, 3, 7, 8, 9, 6, 14, 8, 9, 3, 7, 11, 16, 3, 7, 7, 4, 11, 12, 7, 10, 11, 6, 4, 8, 6, 16, 4, 8, 3, 8, 7, 16, 3, 8, 17, 3, 4, 21, 17, 10, 4, 7, 3, 3, 4, 21, 3, 10, 4, 7, 10, 1, 8, 18, 14, 1, 4, 9, 10, 10, 4, 9, 2, 5, 16, 8, 2, 5, 8, 4, 10, 9, 8, 4, 3, 6, 18, 12, 3, 10, 18, 4, 4, 10, 16, 12, 4, 14, 16, 4, 15, 4, 8, 20, 19, 4, 4, 10, 15, 14, 4, 10, 7, 2, 9, 6, 10, 2, 3, 6, 15, 4, 8, 20, 19, 4, 4, 10, 15, 14, 4, 10, 1, 4, 8, 20, 1, 4, 4, 10, 5, 14, 4, 10, 11, 8, 8, 14, 15, 8, 4, 7, 11, 15, 4, 7, 5, 8, 8, 14, 5, 8, 4, 7, 9, 15, 4, 7, 10, 13, 5, 8, 10, 17, 5, 4, 4, 13, 7, 9, 4, 16, 7, 3, 0, 13, 24, 10, 0, 18, 24, 5, 4, 2, 8, 11, 8, 2, 4, 11, 10, 2, 8, 16, 14, 2, 4, 8, 10, 10, 4, 8, 0, 2, 24, 6, 0, 2, 12, 3, 12, 5, 12, 3, 6, 0, 12, 9, 6, 3, 12, 3, 1, 2, 12, 12, 1, 2, 6, 6, 7, 8, 6, 6, 18, 5, 6, 9, 18, 8, 6, 3, 4, 3, 8, 10, 4, 3, 4, 5, 8, 8, 4, 5, 6, 21, 18, 3, 6, 22, 18, 1, 1, 10, 18, 2, 1, 11, 18, 1, 1, 10, 22, 3, 1, 11, 22, 1, 2, 8, 12, 9, 2, 11, 12, 3, 12, 8, 12, 6, 18, 8, 6, 3, 12, 11, 6, 3, 0, 8, 12, 6, 0, 8, 6, 3, 6, 11, 6, 3, 10, 15, 6, 9, 12, 15, 2, 9, 7, 13, 9, 6, 7, 15, 9, 2, 9, 8, 7, 12, 9, 14, 7, 6, 4, 13, 9, 6, 7, 13, 3, 6, 6, 15, 18, 4, 12, 15, 6, 4, 5, 4, 4, 16, 7, 4, 2, 16, 10, 15, 6, 9, 12, 15, 2, 9, 8, 15, 6, 9, 10, 15, 2, 9, 9, 11, 12, 10, 15, 11, 6, 5, 9, 16, 6, 5, 3, 6, 14, 6, 3, 8, 14, 2, 4, 2, 17, 8, 4, 6, 17, 4, 6, 2, 12, 21, 6, 9, 12, 7, 8, 1, 9, 9, 8, 4, 9, 3, 0, 7, 24, 3, 12, 7, 12, 3, 11, 6, 9, 10, 11, 11, 9, 5, 2, 11, 18, 3, 2, 12, 18, 1, 8, 16, 9, 4, 8, 18, 9, 2, 0, 0, 9, 6, 0, 2, 9, 2, 0, 11, 24, 6, 0, 13, 24, 2, 2, 9, 20, 6, 2, 12, 20, 3, 4, 5, 16, 12, 12, 5, 8, 6, 4, 11, 8, 6, 10, 2, 4, 15, 10, 7, 4, 5, 7, 3, 10, 4, 7, 5, 10, 2, 9, 15, 6, 8, 9, 19, 6, 4, 17, 0, 7, 10, 17, 5, 7, 5, 0, 0, 7, 10, 0, 5, 7, 5, 16, 1, 6, 12, 19, 1, 3, 6, 16, 7, 3, 6, 1, 0, 19, 8, 1, 4, 19, 4, 12, 2, 9, 4, 12, 4, 9, 2, 3, 2, 9, 4, 3, 4, 9, 2, 12, 2, 10, 6, 12, 4, 10, 2, 3, 4, 18, 2, 12, 4, 9, 2, 12, 1, 4, 9, 12, 1, 2, 9, 8, 1, 4, 9, 10, 1, 2, 9, 10, 5, 8, 10, 14, 5, 4, 5, 10, 10, 4, 5, 6, 4, 12, 13, 10, 4, 4, 13, 13, 5, 6, 6, 13, 5, 3, 6, 1, 5, 12, 3, 7, 5, 6, 3, 7, 5, 10, 6, 7, 7, 10, 2, 2, 0, 21, 5, 9, 0, 7, 5, 0, 8, 9, 9, 0, 11, 9, 3, 9, 6, 6, 9, 11, 6, 2, 9, 0, 3, 6, 7, 3, 3, 3, 7, 9, 18, 12, 6, 15, 18, 6, 3, 9, 21, 6, 3, 2, 8, 20, 6, 2, 8, 10, 3, 12, 11, 10, 3, 13, 2, 10, 4, 13, 4, 10, 2, 4, 5, 5, 18, 4, 11, 5, 6, 20, 4, 4, 9, 20, 4, 2, 9, 8, 6, 8, 14, 8, 13, 8, 7, 0, 1, 24, 6, 12, 1, 12, 3, 0, 4, 12, 3, 0, 4, 4, 9, 2, 4, 2, 9, 3, 6, 18, 3, 3, 7, 18, 1, 3, 17, 16, 6, 3, 19, 16, 2, 13, 6, 6, 9, 13, 9, 6, 3, 5, 6, 14, 6, 5, 6, 7, 3, 12, 9, 7, 3, 13, 5, 8, 10, 17, 5, 4, 5, 13, 10, 4, 5, 2, 2, 20, 3, 2, 3, 20, 1, 9, 2, 9, 6, 12, 2, 3, 6, 8, 6, 6, 9, 10, 6, 2, 9, 12, 3, 4, 11, 12, 3, 2, 11, 8, 3, 4, 11, 10, 3, 2, 11, 8, 3, 8, 10, 12, 3, 4, 5, 8, 8, 4, 5, 11, 1, 2, 18, 12, 1, 1, 18, 9, 2, 9, 6, 12, 2, 3, 6, 0, 2, 19, 3, 0, 3, 19, 1, 9, 14, 9, 6, 9, 16, 9, 2, 1, 8, 18, 5, 7, 8, 6, 5, 12, 0, 6, 9, 14, 0, 2, 9, 6, 0, 6, 9, 8, 0, 2, 9, 13, 6, 4, 15, 13, 11, 4, 5, 1, 5, 18, 3, 1, 6, 18, 1, 9, 7, 14, 6, 9, 9, 14, 2, 2, 16, 18, 3, 2, 17, 18, 1, 15, 17, 9, 6, 15, 19, 9, 2, 0, 8, 12, 6, 0, 8, 6, 3, 6, 11, 6, 3, 9, 13, 7, 8, 9, 17, 7, 4, 2, 17, 20, 3, 2, 18, 20, 1, 15, 17, 9, 6, 15, 19, 9, 2, 4, 0, 15, 4, 4, 2, 15, 2, 17, 2, 6, 6, 17, 5, 6, 3, 0, 3, 6, 9, 0, 6, 6, 3, 15, 17, 9, 6, 15, 19, 9, 2, 0, 17, 9, 6, 0, 19, 9, 2, 9, 18, 12, 6, 15, 18, 6, 3, 9, 21, 6, 3, 3, 15, 6, 9, 3, 18, 6, 3, 16, 13, 8, 10, 20, 13, 4, 5, 16, 18, 4, 5, 0, 14, 24, 4, 8, 14, 8, 4, 13, 18, 6, 6, 13, 18, 3, 6, 0, 13, 8, 10, 0, 13, 4, 5, 4, 18, 4, 5, 0, 14, 24, 6, 0, 17, 24, 3, 5, 2, 12, 8, 5, 2, 6, 4, 11, 6, 6, 4, 8, 9, 9, 6, 11, 9, 3, 6, 4, 3, 16, 4, 4, 5, 16, 2, 10, 2, 4, 10, 10, 7, 4, 5, 8, 4, 5, 8, 8, 8, 5, 4, 11, 5, 9, 12, 11, 9, 9, 4, 4, 5, 9, 12, 4, 9, 9, 4, 14, 6, 6, 9, 14, 9, 6, 3, 2, 4, 20, 12, 2, 8, 20, 4, 4, 4, 17, 16, 4, 12, 17, 8, 8, 7, 7, 6, 8, 10, 7, 3, 1, 9, 23, 2, 1, 10, 23, 1, 7, 0, 6, 9, 9, 0, 2, 9, 13, 3, 4, 9, 13, 3, 2, 9, 8, 1, 6, 13, 10, 1, 2, 13, 4, 22, 18, 2, 4, 23, 18, 1, 3, 10, 9, 6, 6, 10, 3, 6, 14, 0, 2, 24, 14, 0, 1, 24, 8, 0, 2, 24, 9, 0, 1, 24, 3, 2, 18, 10, 9, 2, 6, 10, 4, 13, 15, 6, 9, 13, 5, 6, 3, 21, 18, 3, 9, 21, 6, 3, 9, 1, 4, 11, 11, 1, 2, 11, 9, 7, 10, 4, 9, 7, 5, 4, 7, 0, 10, 18, 12, 0, 5, 18, 12, 1, 6, 16, 14, 1, 2, 16, 6, 1, 6, 16, 8, 1, 2, 16, 18, 2, 6, 6, 18, 5, 6, 3, 3, 5, 18, 2, 3, 6, 18, 1, 18, 2, 6, 6, 18, 5, 6, 3, 0, 2, 6, 6, 0, 5, 6, 3, 13, 11, 11, 6, 13, 13, 11, 2, 5, 7, 10, 4, 10, 7, 5, 4, 11, 9, 10, 7, 11, 9, 5, 7, 3, 9, 10, 7, 8, 9, 5, 7, 16, 4, 6, 6, 16, 4, 3, 6, 5, 6, 10, 8, 5, 6, 5, 4, 10, 10, 5, 4, 7, 21, 16, 3, 7, 21, 8, 3, 1, 21, 16, 3, 9, 21, 8, 3, 2, 5, 22, 14, 13, 5, 11, 7, 2, 12, 11, 7, 3, 10, 8, 10, 3, 10, 4, 5, 7, 15, 4, 5, 17, 0, 6, 12, 20, 0, 3, 6, 17, 6, 3, 6, 5, 2, 6, 18, 7, 2, 2, 18, 13, 0, 6, 9, 15, 0, 2, 9, 0, 12, 7, 9, 0, 15, 7, 3, 15, 13, 8, 10, 19, 13, 4, 5, 15, 18, 4, 5, 1, 0, 6, 12, 1, 0, 3, 6, 4, 6, 3, 6, 12, 1, 3, 12, 12, 7, 3, 6, 1, 13, 8, 10, 1, 13, 4, 5, 5, 18, 4, 5, 3, 21, 19, 2, 3, 22, 19, 1, 6, 3, 4, 13, 8, 3, 2, 13, 5, 10, 18, 3, 5, 11, 18, 1, 9, 3, 5, 12, 9, 7, 5, 4, 11, 2, 4, 15, 11, 7, 4, 5, 4, 1, 16, 4, 4, 3, 16, 2, 6, 0, 18, 3, 6, 1, 18, 1, 5, 1, 10, 8, 5, 1, 5, 4, 10, 5, 5, 4, 11, 18, 12, 6, 17, 18, 6, 3, 11, 21, 6, 3, 5, 15, 12, 3, 11, 15, 6, 3, 1, 10, 22, 4, 1, 10, 11, 4, 7, 9, 9, 6, 10, 9, 3, 6, 6, 11, 12, 5, 10, 11, 4, 5, 6, 7, 10, 7, 11, 7, 5, 7, 11, 2, 8, 10, 11, 2, 4, 10, 5, 2, 8, 10, 9, 2, 4, 10, 6, 4, 18, 6, 15, 4, 9, 3, 6, 7, 9, 3, 0, 5, 10, 9, 0, 8, 10, 3, 2, 7, 21, 6, 2, 9, 21, 2, 0, 4, 22, 16, 0, 4, 11, 8, 11, 12, 11, 8, 9, 0, 6, 22, 9, 11, 6, 11, 9, 1, 3, 12, 9, 7, 3, 6, 12, 0, 12, 18, 18, 0, 6, 9, 12, 9, 6, 9, 0, 0, 12, 18, 0, 0, 6, 9, 6, 9, 6, 9, 1, 1, 22, 4, 12, 1, 11, 2, 1, 3, 11, 2, 3, 0, 18, 4, 3, 2, 18, 2, 2, 5, 22, 6, 2, 7, 22, 2, 5, 0, 6, 9, 5, 3, 6, 3, 10, 14, 6, 9, 12, 14, 2, 9, 8, 14, 6, 9, 10, 14, 2, 9, 5, 18, 18, 3, 5, 19, 18, 1, 6, 0, 6, 13, 9, 0, 3, 13, 7, 4, 12, 4, 7, 4, 6, 4, 5, 2, 12, 6, 9, 2, 4, 6, 4, 1, 18, 3, 4, 2, 18, 1, 0, 8, 6, 12, 0, 12, 6, 4, 9, 15, 6, 9, 11, 15, 2, 9, 9, 10, 6, 13, 11, 10, 2, 13, 6, 17, 18, 2, 6, 18, 18, 1, 9, 4, 6, 9, 11, 4, 2, 9, 10, 0, 6, 9, 12, 0, 2, 9, 5, 6, 10, 8, 5, 6, 5, 4, 10, 10, 5, 4, 14, 9, 5, 8, 14, 13, 5, 4, 5, 9, 5, 8, 5, 13, 5, 4, 14, 11, 9, 6, 14, 13, 9, 2, 0, 2, 23, 15, 0, 7, 23, 5, 16, 0, 8, 12, 16, 6, 8, 6, 4, 15, 6, 9, 4, 18, 6, 3, 8, 18, 9, 4, 8, 20, 9, 2, 0, 17, 18, 3, 0, 18, 18, 1, 13, 11, 11, 6, 13, 13, 11, 2, 0, 11, 11, 6, 0, 13, 11, 2, 0, 9, 24, 6, 12, 9, 12, 3, 0, 12, 12, 3, 6, 16, 8, 8, 6, 20, 8, 4, 10, 16, 14, 6, 10, 18, 14, 2, 1, 1, 21, 3, 1, 2, 21, 1, 0, 2, 24, 3, 0, 2, 12, 3, 2, 15, 8, 5, 6, 15, 4, 5, 2, 11, 21, 3, 9, 11, 7, 3, 1, 18, 12, 6, 1, 18, 6, 3, 7, 21, 6, 3, 10, 14, 4, 10, 10, 19, 4, 5, 7, 7, 4, 10, 7, 12, 4, 5, 9, 8, 6, 12, 9, 12, 6, 4, 7, 1, 9, 6, 10, 1, 3, 6, 3, 14, 19, 2, 3, 15, 19, 1, 7, 7, 10, 10, 7, 7, 5, 5, 12, 12, 5, 5, 3, 12, 18, 12, 3, 12, 9, 12, 8, 0, 6, 12, 10, 0, 2, 12, 3, 0, 17, 9, 3, 3, 17, 3, 6, 0, 12, 11, 10, 0, 4, 11, 1, 0, 6, 13, 4, 0, 3, 13, 5, 8, 16, 6, 5, 11, 16, 3, 8, 8, 5, 12, 8, 14, 5, 6, 3, 21, 18, 3, 9, 21, 6, 3, 0, 0, 6, 6, 3, 0, 3, 6, 2, 0, 20, 3, 2, 1, 20, 1, 4, 6, 15, 10, 9, 6, 5, 10, 9, 6, 6, 9, 11, 6, 2, 9, 9, 0, 6, 9, 11, 0, 2, 9, 14, 0, 6, 9, 16, 0, 2, 9, 7, 16, 9, 6, 7, 18, 9, 2, 14, 0, 6, 9, 16, 0, 2, 9, 4, 0, 6, 9, 6, 0, 2, 9, 17, 1, 6, 16, 19, 1, 2, 16, 1, 1, 6, 16, 3, 1, 2, 16, 14, 13, 6, 9, 14, 16, 6, 3, 0, 0, 6, 9, 0, 3, 6, 3, 9, 5, 6, 6, 9, 5, 3, 6, 3, 10, 9, 6, 6, 10, 3, 6, 14, 7, 3, 16, 14, 15, 3, 8, 4, 10, 14, 12, 4, 10, 7, 6, 11, 16, 7, 6, 7, 6, 12, 6, 7, 8, 12, 2, 7, 2, 4, 20, 9, 2, 2, 20, 14, 13, 6, 9, 14, 16, 6, 3, 10, 6, 4, 9, 12, 6, 2, 9, 14, 13, 6, 9, 14, 16, 6, 3, 5, 20, 14, 4, 5, 22, 14, 2, 4, 4, 16, 12, 4, 10, 16, 6, 9, 6, 6, 9, 11, 6, 2, 9, 3, 0, 21, 4, 3, 2, 21, 2, 4, 13, 6, 9, 4, 16, 6, 3, 16, 16, 5, 8, 16, 20, 5, 4, 4, 0, 16, 16, 4, 0, 8, 8, 12, 8, 8, 8, 6, 6, 14, 6, 13, 6, 7, 3, 6, 9, 7, 3, 10, 5, 4, 15, 10, 10, 4, 5, 9, 15, 12, 8, 15, 15, 6, 4, 9, 19, 6, 4, 6, 7, 12, 4, 12, 7, 6, 4, 5, 6, 14, 6, 12, 6, 7, 3, 5, 9, 7, 3, 3, 6, 18, 10, 3, 6, 9, 5, 12, 11, 9, 5, 6, 0, 18, 21, 12, 0, 6, 21, 0, 0, 24, 21, 8, 0, 8, 21, 6, 18, 18, 3, 6, 19, 18, 1, 0, 15, 9, 6, 0, 17, 9, 2, 4, 3, 19, 2, 4, 4, 19, 1, 0, 3, 24, 2, 0, 4, 24, 1, 15, 14, 9, 4, 15, 16, 9, 2, 0, 14, 9, 4, 0, 16, 9, 2, 6, 15, 18, 2, 6, 16, 18, 1, 3, 17, 18, 3, 3, 18, 18, 1, 12, 0, 3, 23, 13, 0, 1, 23, 6, 0, 8, 6, 6, 3, 8, 3, 6, 16, 18, 3, 6, 17, 18, 1, 9, 0, 3, 23, 10, 0, 1, 23, 10, 7, 4, 10, 10, 12, 4, 5, 7, 8, 10, 12, 7, 12, 10, 4, 14, 9, 6, 14, 17, 9, 3, 7, 14, 16, 3, 7, 2, 0, 10, 9, 2, 3, 10, 3, 11, 1, 5, 12, 11, 7, 5, 6, 1, 4, 12, 10, 1, 4, 6, 5, 7, 9, 6, 5, 15, 1, 9, 4, 15, 3, 9, 2, 1, 2, 8, 10, 1, 2, 4, 5, 5, 7, 4, 5, 10, 1, 5, 12, 10, 5, 5, 4, 4, 0, 14, 24, 11, 0, 7, 24, 7, 17, 10, 4, 7, 19, 10, 2, 10, 14, 4, 10, 10, 19, 4, 5, 13, 15, 6, 9, 15, 15, 2, 9, 3, 21, 18, 3, 3, 22, 18, 1, 13, 15, 6, 9, 15, 15, 2, 9, 5, 15, 6, 9, 7, 15, 2, 9, 10, 6, 4, 18, 12, 6, 2, 9, 10, 15, 2, 9, 7, 3, 6, 11, 9, 3, 2, 11, 15, 1, 9, 4, 15, 3, 9, 2, 5, 4, 14, 8, 5, 8, 14, 4, 8, 1, 15, 9, 8, 4, 15, 3, 7, 2, 8, 10, 7, 2, 4, 5, 11, 7, 4, 5, 12, 2, 6, 12, 12, 2, 3, 12, 6, 2, 6, 12, 9, 2, 3, 12, 7, 7, 12, 4, 7, 7, 6, 4, 6, 3, 12, 10, 10, 3, 4, 10, 5, 6, 16, 6, 13, 6, 8, 3, 5, 9, 8, 3, 3, 1, 18, 9, 9, 1, 6, 9, 3, 8, 18, 5, 9, 8, 6, 5, 0, 0, 24, 22, 0, 0, 12, 11, 12, 11, 12, 11, 14, 16, 9, 6, 14, 18, 9, 2, 0, 16, 24, 8, 0, 20, 24, 4, 1, 19, 22, 4, 12, 19, 11, 2, 1, 21, 11, 2, 1, 16, 9, 6, 1, 18, 9, 2, 7, 8, 10, 4, 7, 8, 5, 4, 9, 15, 6, 9, 11, 15, 2, 9, 10, 18, 12, 6, 16, 18, 6, 3, 10, 21, 6, 3, 2, 18, 12, 6, 2, 18, 6, 3, 8, 21, 6, 3, 8, 3, 16, 9, 8, 6, 16, 3, 0, 5, 10, 6, 0, 7, 10, 2, 5, 5, 18, 3, 5, 6, 18, 1, 2, 6, 9, 6, 2, 9, 9, 3, 14, 2, 10, 9, 14, 5, 10, 3, 3, 6, 18, 3, 3, 7, 18, 1, 9, 2, 15, 6, 9, 4, 15, 2, 4, 8, 15, 6, 4, 10, 15, 2, 0, 5, 24, 4, 12, 5, 12, 2, 0, 7, 12, 2, 7, 8, 6, 12, 9, 8, 2, 12, 11, 0, 6, 9, 13, 0, 2, 9, 0, 12, 6, 12, 0, 12, 3, 6, 3, 18, 3, 6, 14, 12, 10, 6, 14, 14, 10, 2, 2, 7, 18, 9, 2, 10, 18, 3, 11, 14, 10, 9, 11, 17, 10, 3, 7, 6, 10, 8, 7, 6, 5, 4, 12, 10, 5, 4, 6, 6, 14, 6, 13, 6, 7, 3, 6, 9, 7, 3, 4, 13, 9, 7, 7, 13, 3, 7, 14, 10, 6, 12, 17, 10, 3, 6, 14, 16, 3, 6, 4, 10, 6, 12, 4, 10, 3, 6, 7, 16, 3, 6, 13, 9, 8, 6, 13, 9, 4, 6, 8, 3, 4, 14, 10, 3, 2, 14, 17, 0, 3, 18, 18, 0, 1, 18, 4, 12, 16, 12, 12, 12, 8, 12, 15, 0, 6, 14, 17, 0, 2, 14, 3, 0, 6, 14, 5, 0, 2, 14, 12, 2, 12, 20, 16, 2, 4, 20, 0, 2, 12, 20, 4, 2, 4, 20, 16, 0, 6, 17, 18, 0, 2, 17, 2, 0, 6, 17, 4, 0, 2, 17, 15, 6, 9, 6, 15, 8, 9, 2, 0, 6, 9, 6, 0, 8, 9, 2, 18, 1, 6, 13, 20, 1, 2, 13, 0, 1, 6, 13, 2, 1, 2, 13, 16, 0, 4, 9, 16, 0, 2, 9, 5, 10, 12, 7, 9, 10, 4, 7, 12, 9, 12, 6, 12, 11, 12, 2, 0, 9, 12, 6, 0, 11, 12, 2, 5, 7, 14, 9, 5, 10, 14, 3, 0, 15, 20, 3, 0, 16, 20, 1, 8, 10, 8, 10, 12, 10, 4, 5, 8, 15, 4, 5, 5, 4, 13, 9, 5, 7, 13, 3, 10, 2, 6, 18, 10, 8, 6, 6, 6, 0, 6, 9, 8, 0, 2, 9, 6, 9, 12, 4, 6, 11, 12, 2, 3, 2, 15, 12, 3, 6, 15, 4, 12, 0, 12, 5, 16, 0, 4, 5, 0, 15, 18, 3, 6, 15, 6, 3, 0, 14, 24, 5, 8, 14, 8, 5, 5, 1, 3, 18, 6, 1, 1, 18, 10, 0, 4, 14, 10, 0, 2, 14, 9, 3, 4, 9, 11, 3, 2, 9, 8, 2, 12, 6, 14, 2, 6, 3, 8, 5, 6, 3, 0, 4, 17, 4, 0, 6, 17, 2, 16, 16, 5, 8, 16, 20, 5, 4, 3, 16, 5, 8, 3, 20, 5, 4, 6, 18, 18, 2, 6, 19, 18, 1, 0, 0, 12, 5, 4, 0, 4, 5, 14, 3, 6, 12, 17, 3, 3, 6, 14, 9, 3, 6, 0, 12, 6, 12, 2, 12, 2, 12, 2, 3, 21, 3, 2, 4, 21, 1, 4, 3, 6, 12, 4, 3, 3, 6, 7, 9, 3, 6, 12, 8, 12, 6, 18, 8, 6, 3, 12, 11, 6, 3, 0, 15, 16, 9, 8, 15, 8, 9, 6, 13, 18, 5, 6, 13, 9, 5, 1, 6, 15, 6, 6, 6, 5, 6, 11, 9, 9, 6, 14, 9, 3, 6, 3, 0, 15, 11, 8, 0, 5, 11, 15, 3, 3, 18, 15, 9, 3, 6, 6, 3, 3, 18, 6, 9, 3, 6, 9, 5, 10, 8, 14, 5, 5, 4, 9, 9, 5, 4, 4, 4, 16, 8, 4, 4, 8, 4, 12, 8, 8, 4, 7, 7, 12, 3, 7, 7, 6, 3, 5, 0, 9, 13, 8, 0, 3, 13, 11, 0, 6, 9, 13, 0, 2, 9, 7, 0, 6, 9, 9, 0, 2, 9, 8, 1, 10, 9, 8, 4, 10, 3, 0, 2, 18, 2, 0, 3, 18, 1, 10, 13, 14, 6, 17, 13, 7, 3, 10, 16, 7, 3, 0, 13, 14, 6, 0, 13, 7, 3, 7, 16, 7, 3, 20, 2, 3, 21, 21, 2, 1, 21, 0, 9, 5, 12, 0, 13, 5, 4, 12, 6, 12, 6, 12, 8, 12, 2, 1, 8, 20, 3, 1, 9, 20, 1, 5, 7, 19, 3, 5, 8, 19, 1, 1, 12, 9, 6, 1, 14, 9, 2, 6, 10, 14, 12, 6, 14, 14, 4, 5, 6, 14, 18, 5, 12, 14, 6, 11, 12, 9, 7, 14, 12, 3, 7, 1, 15, 18, 4, 1, 17, 18, 2, 11, 14, 6, 9, 11, 17, 6, 3, 0, 8, 18, 4, 0, 8, 9, 2, 9, 10, 9, 2, 3, 10, 20, 6, 13, 10, 10, 3, 3, 13, 10, 3, 1, 10, 20, 6, 1, 10, 10, 3, 11, 13, 10, 3, 0, 9, 24, 2, 0, 9, 12, 2, 1, 12, 20, 8, 1, 12, 10, 4, 11, 16, 10, 4, 11, 12, 9, 7, 14, 12, 3, 7, 4, 12, 9, 7, 7, 12, 3, 7, 12, 12, 8, 5, 12, 12, 4, 5, 4, 12, 8, 5, 8, 12, 4, 5, 13, 10, 4, 10, 13, 10, 2, 10, 1, 15, 20, 2, 11, 15, 10, 2, 9, 10, 6, 6, 9, 10, 3, 6, 0, 1, 21, 3, 7, 1, 7, 3, 6, 4, 13, 9, 6, 7, 13, 3, 6, 5, 12, 5, 10, 5, 4, 5, 10, 10, 10, 6, 10, 12, 10, 2, 6, 12, 5, 8, 6, 16, 5, 4, 13, 0, 6, 9, 15, 0, 2, 9, 2, 10, 18, 6, 8, 10, 6, 6, 11, 2, 9, 4, 11, 4, 9, 2, 1, 20, 21, 3, 8, 20, 7, 3, 1, 10, 22, 2, 1, 11, 22, 1, 0, 17, 18, 3, 0, 18, 18, 1, 13, 0, 6, 9, 15, 0, 2, 9, 5, 0, 6, 9, 7, 0, 2, 9, 18, 2, 6, 20, 20, 2, 2, 20, 0, 2, 6, 20, 2, 2, 2, 20, 11, 7, 6, 14, 14, 7, 3, 7, 11, 14, 3, 7, 0, 1, 4, 9, 2, 1, 2, 9, 12, 14, 9, 4, 12, 16, 9, 2, 1, 13, 9, 4, 1, 15, 9, 2, 7, 6, 15, 6, 7, 8, 15, 2, 8, 2, 3, 18, 8, 8, 3, 6, 6, 6, 12, 6, 12, 6, 6, 3, 6, 9, 6, 3, 2, 19, 20, 4, 2, 19, 10, 2, 12, 21, 10, 2, 14, 15, 6, 9, 14, 18, 6, 3, 3, 5, 18, 14, 3, 5, 9, 7, 12, 12, 9, 7, 15, 6, 4, 18, 17, 6, 2, 9, 15, 15, 2, 9, 5, 6, 4, 18, 5, 6, 2, 9, 7, 15, 2, 9, 11, 0, 6, 9, 13, 0, 2, 9, 7, 0, 6, 9, 9, 0, 2, 9, 11, 5, 6, 9, 13, 5, 2, 9, 9, 5, 6, 6, 12, 5, 3, 6, 4, 1, 16, 6, 12, 1, 8, 3, 4, 4, 8, 3, 9, 13, 6, 11, 11, 13, 2, 11, 17, 1, 6, 12, 20, 1, 3, 6, 17, 7, 3, 6, 1, 17, 18, 3, 1, 18, 18, 1, 7, 13, 10, 8, 7, 17, 10, 4, 6, 18, 10, 6, 6, 20, 10, 2, 9, 14, 9, 4, 9, 16, 9, 2, 1, 1, 6, 12, 1, 1, 3, 6, 4, 7, 3, 6, 19, 4, 5, 12, 19, 8, 5, 4, 0, 0, 8, 8, 4, 0, 4, 8, 3, 5, 19, 3, 3, 6, 19, 1, 1, 5, 12, 6, 1, 5, 6, 3, 7, 8, 6, 3, 2, 1, 21, 8, 9, 1, 7, 8, 4, 1, 16, 8, 4, 5, 16, 4, 6, 0, 18, 3, 6, 1, 18, 1, 4, 4, 10, 14, 4, 11, 10, 7, 15, 6, 4, 10, 15, 11, 4, 5, 3, 18, 18, 3, 9, 18, 6, 3, 8, 18, 12, 6, 12, 18, 4, 6, 3, 15, 6, 9, 6, 15, 3, 9, 15, 7, 6, 8, 15, 11, 6, 4, 3, 7, 6, 8, 3, 11, 6, 4, 5, 9, 18, 6, 14, 9, 9, 3, 5, 12, 9, 3, 1, 13, 12, 6, 1, 15, 12, 2, 14, 15, 10, 6, 14, 17, 10, 2, 0, 15, 10, 6, 0, 17, 10, 2, 15, 13, 6, 9, 15, 16, 6, 3, 3, 13, 6, 9, 3, 16, 6, 3, 9, 5, 8, 8, 9, 5, 4, 8, 1, 18, 12, 6, 1, 18, 6, 3, 7, 21, 6, 3, 13, 19, 10, 4, 13, 21, 10, 2, 1, 19, 10, 4, 1, 21, 10, 2, 6, 19, 18, 3, 6, 20, 18, 1, 8, 14, 4, 10, 8, 19, 4, 5, 0, 0, 24, 6, 0, 2, 24, 2, 0, 1, 6, 9, 0, 4, 6, 3, 4, 9, 20, 6, 14, 9, 10, 3, 4, 12, 10, 3, 1, 15, 19, 8, 1, 19, 19, 4, 14, 0, 10, 6, 14, 2, 10, 2, 1, 10, 21, 14, 8, 10, 7, 14, 10, 10, 8, 8, 10, 10, 4, 8, 6, 8, 10, 4, 11, 8, 5, 4, 10, 5, 4, 9, 10, 5, 2, 9, 7, 5, 6, 10, 9, 5, 2, 10, 14, 4, 4, 13, 14, 4, 2, 13, 6, 4, 4, 13, 8, 4, 2, 13, 8, 7, 9, 6, 11, 7, 3, 6, 3, 6, 16, 6, 3, 6, 8, 3, 11, 9, 8, 3, 5, 4, 16, 14, 13, 4, 8, 7, 5, 11, 8, 7, 0, 0, 24, 4, 0, 0, 12, 2, 12, 2, 12, 2, 9, 1, 9, 6, 12, 1, 3, 6, 4, 1, 14, 4, 11, 1, 7, 4, 10, 14, 7, 9, 10, 17, 7, 3, 8, 3, 8, 10, 8, 3, 4, 5, 12, 8, 4, 5, 7, 3, 12, 5, 11, 3, 4, 5, 8, 2, 4, 13, 10, 2, 2, 13, 11, 2, 3, 19, 12, 2, 1, 19, 7, 7, 9, 6, 10, 7, 3, 6, 4, 22, 20, 2, 4, 22, 10, 2, 0, 16, 24, 4, 0, 16, 12, 2, 12, 18, 12, 2, 7, 3, 12, 5, 11, 3, 4, 5, 1, 10, 8, 14, 1, 10, 4, 7, 5, 17, 4, 7, 11, 16, 6, 6, 11, 19, 6, 3, 6, 0, 10, 24, 6, 0, 5, 12, 11, 12, 5, 12, 7, 5, 14, 14, 14, 5, 7, 7, 7, 12, 7, 7, 7, 8, 10, 8, 7, 8, 5, 4, 12, 12, 5, 4, 9, 1, 9, 6, 12, 1, 3, 6, 0, 6, 24, 3, 12, 6, 12, 3, 7, 3, 12, 5, 11, 3, 4, 5, 1, 13, 22, 4, 1, 13, 11, 2, 12, 15, 11, 2, 9, 12, 12, 6, 9, 14, 12, 2, 0, 5, 9, 6, 0, 7, 9, 2, 1, 5, 23, 6, 1, 7, 23, 2, 1, 6, 19, 12, 1, 10, 19, 4, 9, 1, 6, 21, 9, 8, 6, 7, 3, 19, 18, 3, 9, 19, 6, 3, 9, 14, 6, 9, 11, 14, 2, 9, 9, 6, 4, 12, 11, 6, 2, 12, 16, 0, 6, 9, 18, 0, 2, 9, 2, 0, 6, 9, 4, 0, 2, 9, 13, 1, 4, 22, 15, 1, 2, 11, 13, 12, 2, 11, 1, 8, 8, 12, 1, 14, 8, 6, 14, 7, 7, 9, 14, 10, 7, 3, 3, 12, 18, 4, 3, 12, 9, 2, 12, 14, 9, 2, 13, 1, 4, 22, 15, 1, 2, 11, 13, 12, 2, 11, 7, 1, 4, 22, 7, 1, 2, 11, 9, 12, 2, 11, 4, 7, 20, 4, 14, 7, 10, 2, 4, 9, 10, 2, 9, 10, 6, 7, 12, 10, 3, 7, 7, 7, 10, 4, 7, 7, 5, 4, 0, 3, 4, 15, 0, 8, 4, 5, 15, 0, 8, 12, 19, 0, 4, 6, 15, 6, 4, 6, 1, 0, 8, 12, 1, 0, 4, 6, 5, 6, 4, 6, 14, 5, 6, 16, 16, 5, 2, 16, 4, 5, 6, 16, 6, 5, 2, 16, 15, 0, 6, 16, 17, 0, 2, 16, 3, 0, 6, 16, 5, 0, 2, 16, 0, 2, 24, 3, 0, 3, 24, 1, 7, 1, 10, 4, 7, 3, 10, 2, 1, 0, 23, 8, 1, 4, 23, 4, 1, 17, 19, 3, 1, 18, 19, 1, 6, 18, 18, 2, 6, 19, 18, 1, 1, 17, 9, 6, 1, 19, 9, 2, 15, 15, 6, 9, 15, 18, 6, 3, 3, 15, 6, 9, 3, 18, 6, 3, 4, 14, 20, 6, 4, 17, 20, 3, 0, 10, 6, 14, 0, 10, 3, 7, 3, 17, 3, 7, 6, 18, 18, 3, 6, 19, 18, 1, 4, 12, 9, 7, 7, 12, 3, 7, 6, 10, 18, 5, 12, 10, 6, 5, 0, 10, 18, 5, 6, 10, 6, 5, 3, 2, 18, 9, 9, 2, 6, 9, 4, 6, 10, 10, 4, 6, 5, 5, 9, 11, 5, 5, 20, 14, 4, 9, 20, 14, 2, 9, 0, 14, 4, 9, 2, 14, 2, 9, 11, 1, 4, 20, 13, 1, 2, 10, 11, 11, 2, 10, 6, 21, 12, 3, 12, 21, 6, 3, 11, 1, 4, 20, 13, 1, 2, 10, 11, 11, 2, 10, 1, 16, 10, 8, 1, 16, 5, 4, 6, 20, 5, 4, 11, 1, 4, 20, 13, 1, 2, 10, 11, 11, 2, 10, 1, 0, 3, 19, 2, 0, 1, 19, 11, 1, 4, 20, 13, 1, 2, 10, 11, 11, 2, 10, 0, 1, 6, 9, 2, 1, 2, 9, 3, 7, 19, 4, 3, 9, 19, 2, 7, 14, 9, 6, 7, 16, 9, 2, 17, 1, 7, 6, 17, 4, 7, 3, 5, 0, 14, 8, 5, 4, 14, 4, 16, 1, 8, 6, 16, 4, 8, 3, 0, 1, 8, 6, 0, 4, 8, 3, 6, 0, 18, 4, 15, 0, 9, 2, 6, 2, 9, 2, 0, 14, 9, 6, 0, 16, 9, 2, 3, 7, 18, 8, 9, 7, 6, 8, 2, 11, 6, 9, 4, 11, 2, 9, 10, 5, 6, 9, 12, 5, 2, 9, 10, 6, 4, 18, 10, 6, 2, 9, 12, 15, 2, 9, 11, 1, 4, 20, 13, 1, 2, 10, 11, 11, 2, 10, 9, 1, 4, 20, 9, 1, 2, 10, 11, 11, 2, 10, 5, 9, 18, 6, 14, 9, 9, 3, 5, 12, 9, 3, 6, 4, 6, 9, 8, 4, 2, 9, 10, 16, 8, 6, 10, 16, 4, 6, 0, 0, 18, 8, 0, 0, 9, 4, 9, 4, 9, 4, 6, 5, 14, 12, 13, 5, 7, 6, 6, 11, 7, 6, 4, 3, 15, 7, 9, 3, 5, 7, 14, 12, 10, 6, 14, 14, 10, 2, 0, 11, 4, 10, 0, 16, 4, 5, 1, 10, 22, 3, 1, 11, 22, 1, 8, 9, 6, 10, 10, 9, 2, 10, 13, 2, 6, 12, 16, 2, 3, 6, 13, 8, 3, 6, 10, 6, 4, 18, 10, 6, 2, 9, 12, 15, 2, 9, 7, 8, 10, 16, 12, 8, 5, 8, 7, 16, 5, 8, 8, 1, 8, 12, 8, 1, 4, 6, 12, 7, 4, 6, 7, 1, 12, 14, 13, 1, 6, 7, 7, 8, 6, 7, 2, 14, 12, 6, 2, 16, 12, 2, 11, 16, 6, 6, 11, 19, 6, 3, 7, 16, 6, 6, 7, 19, 6, 3, 13, 4, 4, 10, 13, 4, 2, 10, 0, 19, 19, 3, 0, 20, 19, 1, 12, 8, 6, 8, 12, 12, 6, 4, 8, 1, 8, 22, 8, 12, 8, 11, 12, 8, 6, 8, 12, 12, 6, 4, 6, 8, 6, 8, 6, 12, 6, 4, 14, 5, 6, 9, 14, 8, 6, 3, 0, 6, 24, 4, 0, 8, 24, 2, 14, 12, 10, 6, 14, 14, 10, 2, 0, 12, 10, 6, 0, 14, 10, 2, 4, 6, 19, 3, 4, 7, 19, 1, 1, 6, 19, 3, 1, 7, 19, 1, 4, 0, 16, 9, 4, 3, 16, 3, 0, 1, 24, 5, 8, 1, 8, 5, 3, 6, 6, 15, 3, 11, 6, 5, 9, 6, 6, 9, 11, 6, 2, 9, 0, 17, 18, 3, 0, 18, 18, 1, 6, 22, 18, 2, 6, 23, 18, 1, 2, 12, 6, 9, 2, 15, 6, 3, 18, 12, 6, 9, 18, 15, 6, 3, 0, 12, 6, 9, 0, 15, 6, 3, 11, 14, 4, 10, 11, 19, 4, 5, 9, 6, 6, 16, 9, 14, 6, 8, 7, 7, 10, 10, 7, 12, 10, 5, 1, 3, 6, 13, 3, 3, 2, 13, 18, 1, 6, 13, 18, 1, 3, 13, 5, 1, 6, 9, 7, 1, 2, 9, 18, 2, 6, 11, 18, 2, 3, 11, 0, 2, 6, 11, 3, 2, 3, 11, 9, 12, 15, 6, 9, 14, 15, 2, 2, 2, 20, 3, 2, 3, 20, 1, 10, 6, 4, 9, 10, 6, 2, 9, 5, 6, 12, 14, 5, 6, 6, 7, 11, 13, 6, 7, 9, 0, 6, 9, 11, 0, 2, 9, 7, 0, 9, 6, 10, 0, 3, 6, 10, 6, 6, 9, 12, 6, 2, 9, 4, 1, 12, 20, 4, 1, 6, 10, 10, 11, 6, 10, 6, 7, 18, 3, 6, 7, 9, 3, 0, 7, 18, 3, 9, 7, 9, 3, 3, 20, 18, 3, 9, 20, 6, 3, 9, 6, 6, 9, 11, 6, 2, 9, 6, 2, 12, 15, 10, 2, 4, 15, 2, 3, 18, 3, 2, 4, 18, 1, 19, 4, 4, 18, 21, 4, 2, 9, 19, 13, 2, 9, 0, 1, 19, 3, 0, 2, 19, 1, 5, 0, 15, 4, 5, 2, 15, 2, 5, 2, 14, 5, 12, 2, 7, 5, 1, 2, 22, 14, 1, 2, 11, 14, 8, 15, 6, 9, 10, 15, 2, 9, 6, 17, 18, 3, 6, 18, 18, 1, 9, 6, 3, 18, 9, 12, 3, 6, 2, 0, 20, 3, 2, 1, 20, 1, 5, 4, 5, 12, 5, 8, 5, 4, 8, 6, 12, 5, 12, 6, 4, 5, 9, 12, 6, 12, 9, 12, 3, 6, 12, 18, 3, 6, 14, 14, 8, 10, 18, 14, 4, 5, 14, 19, 4, 5, 2, 14, 8, 10, 2, 14, 4, 5, 6, 19, 4, 5, 10, 18, 12, 6, 16, 18, 6, 3, 10, 21, 6, 3, 1, 3, 6, 9, 1, 6, 6, 3, 11, 3, 3, 20, 12, 3, 1, 20, 4, 6, 14, 6, 4, 6, 7, 3, 11, 9, 7, 3, 6, 5, 12, 13, 10, 5, 4, 13, 5, 4, 4, 15, 5, 9, 4, 5, 9, 16, 15, 4, 14, 16, 5, 4, 7, 8, 6, 14, 7, 8, 3, 7, 10, 15, 3, 7, 7, 6, 10, 6, 7, 8, 10, 2, 2, 5, 18, 3, 2, 6, 18, 1, 5, 1, 15, 8, 5, 5, 15, 4, 7, 1, 8, 18, 7, 10, 8, 9, 0, 10, 24, 3, 0, 11, 24, 1, 0, 2, 6, 13, 2, 2, 2, 13, 16, 0, 8, 10, 20, 0, 4, 5, 16, 5, 4, 5, 5, 1, 10, 9, 5, 4, 10, 3, 5, 6, 18, 3, 5, 7, 18, 1, 0, 1, 24, 3, 0, 2, 24, 1, 11, 4, 6, 11, 13, 4, 2, 11, 0, 0, 8, 10, 0, 0, 4, 5, 4, 5, 4, 5, 4, 16, 18, 3, 4, 17, 18, 1, 2, 16, 18, 3, 2, 17, 18, 1, 3, 0, 18, 10, 12, 0, 9, 5, 3, 5, 9, 5, 2, 3, 20, 21, 12, 3, 10, 21, 6, 7, 14, 3, 6, 7, 7, 3, 0, 9, 12, 6, 0, 9, 6, 3, 6, 12, 6, 3, 3, 14, 21, 4, 10, 14, 7, 4, 0, 14, 21, 4, 7, 14, 7, 4, 5, 21, 18, 3, 11, 21, 6, 3, 1, 21, 18, 3, 7, 21, 6, 3, 19, 4, 4, 18, 21, 4, 2, 9, 19, 13, 2, 9, 3, 7, 18, 3, 3, 8, 18, 1, 19, 4, 4, 18, 21, 4, 2, 9, 19, 13, 2, 9, 7, 15, 10, 6, 7, 17, 10, 2, 9, 13, 11, 9, 9, 16, 11, 3, 0, 6, 4, 10, 0, 11, 4, 5, 15, 16, 9, 6, 15, 18, 9, 2, 1, 5, 4, 18, 1, 5, 2, 9, 3, 14, 2, 9, 9, 8, 8, 10, 13, 8, 4, 5, 9, 13, 4, 5, 7, 8, 8, 10, 7, 8, 4, 5, 11, 13, 4, 5, 9, 8, 12, 5, 13, 8, 4, 5, 7, 8, 9, 7, 10, 8, 3, 7, 9, 8, 12, 5, 13, 8, 4, 5, 7, 6, 9, 7, 10, 6, 3, 7, 9, 8, 12, 5, 13, 8, 4, 5, 10, 5, 4, 18, 10, 11, 4, 6, 5, 5, 14, 12, 5, 11, 14, 6, 0, 1, 11, 4, 0, 3, 11, 2, 9, 10, 6, 10, 11, 10, 2, 10, 2, 17, 11, 6, 2, 19, 11, 2, 15, 16, 9, 6, 15, 18, 9, 2, 1, 10, 18, 2, 1, 11, 18, 1, 6, 4, 12, 13, 10, 4, 4, 13, 0, 18, 18, 3, 0, 19, 18, 1, 6, 18, 18, 3, 6, 19, 18, 1, 0, 16, 9, 6, 0, 18, 9, 2, 13, 15, 9, 6, 13, 17, 9, 2, 2, 15, 9, 6, 2, 17, 9, 2, 13, 1, 6, 16, 13, 1, 3, 16, 5, 1, 6, 16, 8, 1, 3, 16, 11, 5, 6, 10, 13, 5, 2, 10, 7, 5, 6, 10, 9, 5, 2, 10, 10, 0, 6, 24, 12, 0, 2, 24, 3, 4, 4, 20, 3, 4, 2, 10, 5, 14, 2, 10, 14, 0, 6, 9, 16, 0, 2, 9, 4, 0, 6, 9, 6, 0, 2, 9, 4, 5, 18, 5, 10, 5, 6, 5, 5, 6, 6, 9, 7, 6, 2, 9, 7, 2, 15, 8, 12, 2, 5, 8, 2, 2, 15, 8, 7, 2, 5, 8, 10, 0, 4, 9, 10, 0, 2, 9, 3, 4, 6, 12, 3, 4, 3, 6, 6, 10, 3, 6, 16, 0, 8, 18, 16, 0, 4, 18, 0, 0, 8, 18, 4, 0, 4, 18, 0, 7, 24, 6, 0, 9, 24, 2, 4, 7, 14, 3, 11, 7, 7, 3, 10, 8, 8, 15, 10, 8, 4, 15, 7, 0, 10, 14, 12, 0, 5, 14, 13, 10, 8, 10, 17, 10, 4, 5, 13, 15, 4, 5, 3, 0, 4, 9, 5, 0, 2, 9, 16, 1, 6, 8, 16, 1, 3, 8, 2, 1, 6, 8, 5, 1, 3, 8, 3, 6, 18, 12, 3, 10, 18, 4, 4, 12, 16, 4, 4, 14, 16, 2, 4, 9, 16, 15, 4, 14, 16, 5, 3, 10, 8, 10, 3, 10, 4, 5, 7, 15, 4, 5, 8, 18, 16, 6, 16, 18, 8, 3, 8, 21, 8, 3, 2, 16, 12, 5, 6, 16, 4, 5, 14, 14, 9, 4, 14, 16, 9, 2, 7, 14, 9, 6, 7, 16, 9, 2, 4, 10, 16, 12, 4, 14, 16, 4, 0, 13, 19, 6, 0, 15, 19, 2, 10, 13, 9, 6, 10, 15, 9, 2, 5, 0, 3, 23, 6, 0, 1, 23, 0, 8, 24, 6, 0, 10, 24, 2, 0, 5, 5, 12, 0, 9, 5, 4, 3, 0, 19, 18, 3, 9, 19, 9, 9, 11, 6, 12, 9, 11, 3, 6, 12, 17, 3, 6, 0, 5, 24, 8, 12, 5, 12, 4, 0, 9, 12, 4, 6, 18, 9, 4, 6, 20, 9, 2, 8, 8, 10, 6, 8, 10, 10, 2, 2, 7, 20, 3, 2, 8, 20, 1, 12, 0, 7, 20, 12, 10, 7, 10, 5, 0, 7, 20, 5, 10, 7, 10, 14, 2, 2, 18, 14, 11, 2, 9, 5, 8, 10, 12, 10, 8, 5, 12, 6, 9, 12, 8, 12, 9, 6, 4, 6, 13, 6, 4, 7, 7, 3, 14, 7, 14, 3, 7, 11, 2, 12, 16, 17, 2, 6, 8, 11, 10, 6, 8, 7, 0, 6, 9, 9, 0, 2, 9, 13, 14, 9, 4, 13, 16, 9, 2, 0, 12, 22, 4, 0, 12, 11, 2, 11, 14, 11, 2, 1, 12, 22, 6, 12, 12, 11, 3, 1, 15, 11, 3, 6, 6, 9, 6, 9, 6, 3, 6, 10, 0, 4, 9, 10, 0, 2, 9, 3, 8, 18, 7, 9, 8, 6, 7, 0, 6, 24, 6, 0, 8, 24, 2, 0, 11, 24, 10, 8, 11, 8, 10, 3, 3, 18, 21, 9, 3, 6, 21, 7, 12, 4, 10, 9, 12, 2, 10, 10, 16, 10, 8, 15, 16, 5, 4, 10, 20, 5, 4, 8, 6, 6, 9, 10, 6, 2, 9, 12, 10, 6, 12, 15, 10, 3, 6, 12, 16, 3, 6, 6, 10, 6, 12, 6, 10, 3, 6, 9, 16, 3, 6, 16, 12, 6, 12, 19, 12, 3, 6, 16, 18, 3, 6, 2, 12, 6, 12, 2, 12, 3, 6, 5, 18, 3, 6, 10, 15, 6, 9, 12, 15, 2, 9, 8, 15, 6, 9, 10, 15, 2, 9, 14, 20, 10, 4, 14, 20, 5, 4, 0, 20, 10, 4, 5, 20, 5, 4, 11, 17, 9, 6, 11, 19, 9, 2, 3, 2, 14, 4, 3, 4, 14, 2, 10, 1, 10, 4, 10, 3, 10, 2, 0, 15, 10, 4, 5, 15, 5, 4, 19, 2, 3, 19, 20, 2, 1, 19, 4, 12, 9, 8, 7, 12, 3, 8, 4, 7, 5, 12, 4, 11, 5, 4, 0, 1, 24, 3, 8, 1, 8, 3, 6, 8, 12, 4, 6, 10, 12, 2, 19, 3, 4, 10, 19, 3, 2, 10, 0, 6, 9, 6, 3, 6, 3, 6, 18, 0, 6, 22, 20, 0, 2, 22, 0, 0, 6, 22, 2, 0, 2, 22, 5, 15, 19, 3, 5, 16, 19, 1, 10, 7, 4, 15, 10, 12, 4, 5, 9, 6, 6, 9, 11, 6, 2, 9, 0, 21, 18, 3, 0, 22, 18, 1, 7, 3, 10, 15, 7, 8, 10, 5, 1, 7, 18, 3, 1, 8, 18, 1, 8, 2, 9, 6, 11, 2, 3, 6, 0, 10, 24, 14, 0, 17, 24, 7, 13, 9, 8, 10, 17, 9, 4, 5, 13, 14, 4, 5, 10, 5, 4, 9, 12, 5, 2, 9, 13, 9, 8, 10, 17, 9, 4, 5, 13, 14, 4, 5, 7, 11, 10, 10, 7, 11, 5, 5, 12, 16, 5, 5, 4, 13, 18, 4, 13, 13, 9, 2, 4, 15, 9, 2, 0, 0, 19, 2, 0, 1, 19, 1, 0, 18, 24, 6, 8, 18, 8, 6, 6, 4, 8, 16, 6, 12, 8, 8, 7, 8, 10, 4, 7, 10, 10, 2, 0, 3, 6, 9, 0, 6, 6, 3, 13, 15, 7, 9, 13, 18, 7, 3, 3, 18, 12, 6, 3, 18, 6, 3, 9, 21, 6, 3, 12, 14, 6, 9, 12, 17, 6, 3, 2, 15, 15, 8, 2, 19, 15, 4, 9, 6, 6, 16, 9, 14, 6, 8, 6, 6, 7, 12, 6, 10, 7, 4, 14, 6, 6, 9, 14, 9, 6, 3, 5, 14, 6, 9, 5, 17, 6, 3, 10, 8, 6, 9, 12, 8, 2, 9, 6, 6, 4, 18, 6, 6, 2, 9, 8, 15, 2, 9, 14, 9, 6, 12, 17, 9, 3, 6, 14, 15, 3, 6, 4, 9, 6, 12, 4, 9, 3, 6, 7, 15, 3, 6, 14, 15, 9, 6, 14, 17, 9, 2, 0, 20, 18, 4, 0, 20, 9, 2, 9, 22, 9, 2, 13, 18, 9, 6, 13, 20, 9, 2, 2, 18, 9, 6, 2, 20, 9, 2, 6, 16, 18, 3, 6, 17, 18, 1, 0, 16, 18, 3, 0, 17, 18, 1, 19, 2, 4, 22, 21, 2, 2, 11, 19, 13, 2, 11, 1, 2, 4, 22, 1, 2, 2, 11, 3, 13, 2, 11, 15, 0, 2, 24, 15, 0, 1, 24, 3, 20, 16, 4, 11, 20, 8, 4, 11, 6, 4, 18, 13, 6, 2, 9, 11, 15, 2, 9, 7, 9, 10, 14, 7, 9, 5, 7, 12, 16, 5, 7, 14, 6, 6, 9, 14, 9, 6, 3, 3, 6, 7, 9, 3, 9, 7, 3, 20, 4, 4, 20, 22, 4, 2, 10, 20, 14, 2, 10, 7, 6, 6, 9, 7, 9, 6, 3, 7, 0, 10, 14, 12, 0, 5, 7, 7, 7, 5, 7, 2, 1, 18, 6, 11, 1, 9, 6, 15, 0, 2, 24, 15, 0, 1, 24, 7, 0, 2, 24, 8, 0, 1, 24, 13, 12, 6, 7, 13, 12, 3, 7, 5, 12, 6, 7, 8, 12, 3, 7, 3, 5, 18, 19, 9, 5, 6, 19, 5, 6, 9, 6, 8, 6, 3, 6, 9, 5, 9, 6, 12, 5, 3, 6, 3, 16, 10, 8, 3, 16, 5, 4, 8, 20, 5, 4, 19, 8, 5, 15, 19, 13, 5, 5, 0, 8, 5, 15, 0, 13, 5, 5, 20, 4, 4, 20, 22, 4, 2, 10, 20, 14, 2, 10, 0, 4, 4, 20, 0, 4, 2, 10, 2, 14, 2, 10, 7, 7, 10, 4, 7, 7, 5, 4, 4, 19, 14, 4, 11, 19, 7, 4, 10, 11, 12, 3, 10, 11, 6, 3, 0, 1, 24, 3, 0, 2, 24, 1, 7, 2, 14, 20, 14, 2, 7, 10, 7, 12, 7, 10, 0, 13, 6, 9, 2, 13, 2, 9, 13, 0, 4, 19, 13, 0, 2, 19, 1, 11, 14, 3, 8, 11, 7, 3, 7, 1, 16, 20, 15, 1, 8, 10, 7, 11, 8, 10, 0, 10, 21, 9, 7, 10, 7, 9, 6, 19, 15, 5, 11, 19, 5, 5, 8, 10, 6, 6, 11, 10, 3, 6, 7, 1, 16, 20, 15, 1, 8, 10, 7, 11, 8, 10, 1, 1, 16, 20, 1, 1, 8, 10, 9, 11, 8, 10, 16, 4, 3, 12, 16, 10, 3, 6, 5, 4, 3, 12, 5, 10, 3, 6, 7, 6, 10, 8, 12, 6, 5, 4, 7, 10, 5, 4, 4, 9, 6, 6, 4, 12, 6, 3, 6, 5, 12, 4, 6, 7, 12, 2, 9, 2, 5, 15, 9, 7, 5, 5, 15, 0, 9, 6, 15, 2, 9, 2, 6, 0, 11, 10, 6, 5, 11, 5, 12, 7, 4, 12, 12, 13, 4, 6, 7, 2, 9, 4, 7, 4, 9, 2, 6, 0, 13, 6, 6, 2, 13, 2, 10, 6, 4, 18, 10, 6, 2, 9, 12, 15, 2, 9, 10, 8, 6, 9, 12, 8, 2, 9, 3, 18, 10, 6, 3, 20, 10, 2, 4, 14, 20, 3, 4, 15, 20, 1, 2, 15, 9, 6, 2, 17, 9, 2, 13, 0, 4, 19, 13, 0, 2, 19, 7, 0, 4, 19, 9, 0, 2, 19, 1, 4, 22, 2, 1, 5, 22, 1, 0, 0, 9, 6, 0, 2, 9, 2, 0, 0, 24, 18, 0, 9, 24, 9, 3, 2, 16, 8, 3, 6, 16, 4, 3, 6, 18, 6, 3, 8, 18, 2, 3, 1, 6, 10, 5, 1, 2, 10, 13, 0, 9, 6, 16, 0, 3, 6, 2, 0, 9, 6, 5, 0, 3, 6, 10, 2, 4, 15, 10, 7, 4, 5, 6, 0, 7, 10, 6, 5, 7, 5, 2, 2, 20, 4, 12, 2, 10, 2, 2, 4, 10, 2, 2, 11, 19, 3, 2, 12, 19, 1, 10, 8, 6, 9, 12, 8, 2, 9, 8, 8, 6, 9, 10, 8, 2, 9, 13, 8, 4, 9, 13, 8, 2, 9, 3, 11, 9, 9, 6, 11, 3, 9, 3, 9, 18, 5, 9, 9, 6, 5, 2, 4, 2, 20, 2, 14, 2, 10, 14, 17, 8, 6, 14, 20, 8, 3, 3, 21, 18, 2, 3, 22, 18, 1, 5, 4, 15, 6, 10, 4, 5, 6, 2, 15, 12, 6, 2, 17, 12, 2, 17, 8, 6, 9, 17, 11, 6, 3, 2, 12, 20, 4, 2, 12, 10, 2, 12, 14, 10, 2, 0, 17, 24, 6, 0, 19, 24, 2, 7, 16, 9, 4, 7, 18, 9, 2, 15, 1, 4, 22, 17, 1, 2, 11, 15, 12, 2, 11, 5, 1, 4, 22, 5, 1, 2, 11, 7, 12, 2, 11, 11, 13, 8, 9, 11, 16, 8, 3, 6, 1, 6, 9, 8, 1, 2, 9, 11, 4, 3, 18, 11, 10, 3, 6, 5, 8, 12, 6, 5, 8, 6, 3, 11, 11, 6, 3, 15, 7, 5, 8, 15, 11, 5, 4, 4, 7, 5, 8, 4, 11, 5, 4, 12, 6, 6, 12, 15, 6, 3, 6, 12, 12, 3, 6, 6, 6, 6, 12, 6, 6, 3, 6, 9, 12, 3, 6, 5, 9, 14, 8, 12, 9, 7, 4, 5, 13, 7, 4, 9, 1, 3, 14, 9, 8, 3, 7, 12, 6, 6, 12, 12, 10, 6, 4, 4, 5, 4, 18, 4, 5, 2, 9, 6, 14, 2, 9, 4, 6, 16, 18, 4, 12, 16, 6, 5, 4, 7, 20, 5, 14, 7, 10, 14, 8, 8, 12, 14, 14, 8, 6, 9, 10, 6, 14, 9, 10, 3, 7, 12, 17, 3, 7, 9, 5, 9, 6, 12, 5, 3, 6, 9, 4, 3, 18, 10, 4, 1, 18, 1, 4, 22, 14, 12, 4, 11, 7, 1, 11, 11, 7, 2, 7, 18, 2, 2, 8, 18, 1, 12, 6, 6, 12, 12, 10, 6, 4, 6, 5, 9, 7, 9, 5, 3, 7, 12, 7, 4, 12, 12, 13, 4, 6, 8, 7, 4, 12, 8, 13, 4, 6, 7, 2, 10, 22, 7, 13, 10, 11, 0, 1, 3, 20, 1, 1, 1, 20, 4, 13, 18, 4, 13, 13, 9, 2, 4, 15, 9, 2, 2, 13, 18, 4, 2, 13, 9, 2, 11, 15, 9, 2, 15, 15, 9, 6, 15, 17, 9, 2, 0, 15, 9, 6, 0, 17, 9, 2, 6, 0, 18, 24, 15, 0, 9, 12, 6, 12, 9, 12, 6, 6, 6, 12, 6, 10, 6, 4, 8, 7, 10, 4, 8, 9, 10, 2, 1, 9, 18, 6, 1, 9, 9, 3, 10, 12, 9, 3, 6, 6, 18, 3, 6, 7, 18, 1, 7, 7, 9, 8, 10, 7, 3, 8, 10, 12, 6, 12, 12, 12, 2, 12, 3, 14, 18, 3, 3, 15, 18, 1, 15, 17, 9, 7, 18, 17, 3, 7, 1, 12, 10, 6, 1, 14, 10, 2, 15, 17, 9, 7, 18, 17, 3, 7, 10, 3, 3, 19, 11, 3, 1, 19, 15, 17, 9, 7, 18, 17, 3, 7, 6, 1, 11, 9, 6, 4, 11, 3, 15, 17, 9, 7, 18, 17, 3, 7, 6, 5, 11, 6, 6, 8, 11, 3, 16, 7, 8, 5, 16, 7, 4, 5, 2, 4, 20, 19, 12, 4, 10, 19, 2, 1, 21, 6, 9, 1, 7, 6, 6, 5, 12, 14, 6, 5, 6, 7, 12, 12, 6, 7, 9, 0, 6, 9, 11, 0, 2, 9, 2, 11, 8, 5, 6, 11, 4, 5, 16, 7, 8, 5, 16, 7, 4, 5, 0, 7, 8, 5, 4, 7, 4, 5, 15, 17, 9, 7, 18, 17, 3, 7, 8, 6, 8, 10, 8, 6, 4, 5, 12, 11, 4, 5, 15, 15, 9, 9, 18, 15, 3, 9, 0, 15, 9, 9, 3, 15, 3, 9, 12, 10, 9, 7, 15, 10, 3, 7, 3, 10, 9, 7, 6, 10, 3, 7, 13, 15, 10, 8, 18, 15, 5, 4, 13, 19, 5, 4, 0, 1, 6, 12, 0, 1, 3, 6, 3, 7, 3, 6, 10, 0, 6, 12, 13, 0, 3, 6, 10, 6, 3, 6, 7, 0, 10, 12, 7, 0, 5, 6, 12, 6, 5, 6, 4, 1, 16, 8, 4, 1, 8, 8, 0, 21, 19, 3, 0, 22, 19, 1, 6, 9, 18, 4, 15, 9, 9, 2, 6, 11, 9, 2, 3, 4, 9, 6, 3, 6, 9, 2, 9, 1, 6, 15, 9, 6, 6, 5, 5, 9, 6, 6, 8, 9, 3, 6, 5, 1, 14, 9, 5, 4, 14, 3, 3, 0, 8, 20, 3, 0, 4, 10, 7, 10, 4, 10, 5, 0, 7, 9, 5, 3, 7, 3, 6, 6, 12, 5, 10, 6, 4, 5, 0, 1, 8, 14, 4, 1, 4, 14, 2, 12, 22, 4, 2, 14, 22, 2, 8, 17, 6, 6, 8, 20, 6, 3, 18, 1, 6, 7, 18, 1, 3, 7, 0, 0, 6, 6, 3, 0, 3, 6, 4, 6, 17, 18, 4, 12, 17, 6, 6, 0, 12, 6, 6, 0, 6, 3, 12, 3, 6, 3, 4, 7, 18, 4, 13, 7, 9, 2, 4, 9, 9, 2, 4, 12, 10, 6, 4, 14, 10, 2, 7, 9, 10, 12, 12, 9, 5, 6, 7, 15, 5, 6, 0, 1, 24, 3, 8, 1, 8, 3, 13, 11, 6, 6, 13, 11, 3, 6, 5, 11, 6, 6, 8, 11, 3, 6, 3, 10, 19, 3, 3, 11, 19, 1, 0, 2, 6, 9, 0, 5, 6, 3, 14, 16, 10, 6, 14, 18, 10, 2, 0, 16, 10, 6, 0, 18, 10, 2, 14, 13, 9, 6, 14, 15, 9, 2, 0, 16, 18, 3, 0, 17, 18, 1, 6, 16, 18, 3, 6, 17, 18, 1, 0, 18, 9, 6, 0, 20, 9, 2, 14, 13, 9, 6, 14, 15, 9, 2, 6, 2, 6, 9, 8, 2, 2, 9, 15, 8, 4, 12, 15, 8, 2, 12, 8, 13, 8, 8, 8, 17, 8, 4, 4, 20, 18, 3, 10, 20, 6, 3, 5, 8, 4, 12, 7, 8, 2, 12, 7, 7, 12, 3, 7, 7, 6, 3, 10, 6, 4, 9, 12, 6, 2, 9, 5, 20, 18, 3, 11, 20, 6, 3, 1, 20, 18, 3, 7, 20, 6, 3, 18, 1, 6, 20, 21, 1, 3, 10, 18, 11, 3, 10, 0, 1, 6, 20, 0, 1, 3, 10, 3, 11, 3, 10, 13, 3, 4, 18, 15, 3, 2, 9, 13, 12, 2, 9, 0, 2, 6, 12, 0, 6, 6, 4, 12, 9, 12, 6, 18, 9, 6, 3, 12, 12, 6, 3, 7, 3, 4, 18, 7, 3, 2, 9, 9, 12, 2, 9, 14, 0, 6, 9, 16, 0, 2, 9, 0, 9, 12, 6, 0, 9, 6, 3, 6, 12, 6, 3, 14, 4, 8, 20, 18, 4, 4, 10, 14, 14, 4, 10, 2, 4, 8, 20, 2, 4, 4, 10, 6, 14, 4, 10, 14, 13, 9, 6, 14, 15, 9, 2, 1, 13, 9, 6, 1, 15, 9, 2, 3, 15, 18, 3, 9, 15, 6, 3, 5, 13, 9, 6, 5, 15, 9, 2, 5, 0, 18, 3, 5, 1, 18, 1, 8, 2, 6, 7, 11, 2, 3, 7, 9, 1, 9, 6, 12, 1, 3, 6, 6, 1, 9, 6, 9, 1, 3, 6, 5, 6, 14, 6, 12, 6, 7, 3, 5, 9, 7, 3, 8, 2, 6, 13, 10, 2, 2, 13, 6, 11, 12, 6, 12, 11, 6, 3, 6, 14, 6, 3, 3, 1, 18, 15, 9, 1, 6, 15, 13, 0, 6, 7, 13, 0, 3, 7, 3, 3, 16, 6, 3, 6, 16, 3, 12, 1, 3, 12, 12, 7, 3, 6, 7, 7, 6, 9, 9, 7, 2, 9, 13, 0, 4, 24, 13, 0, 2, 24, 7, 0, 4, 24, 9, 0, 2, 24, 11, 9, 5, 12, 11, 13, 5, 4, 7, 15, 9, 6, 7, 17, 9, 2, 5, 7, 18, 6, 5, 9, 18, 2, 8, 9, 5, 12, 8, 13, 5, 4, 4, 17, 17, 6, 4, 19, 17, 2, 0, 3, 18, 14, 0, 3, 9, 7, 9, 10, 9, 7, 0, 1, 24, 2, 0, 2, 24, 1, 0, 15, 18, 3, 0, 16, 18, 1, 9, 0, 6, 9, 11, 0, 2, 9, 3, 3, 14, 12, 3, 9, 14, 6, 12, 1, 3, 12, 12, 7, 3, 6, 8, 0, 6, 9, 10, 0, 2, 9, 10, 6, 6, 10, 12, 6, 2, 10, 5, 0, 6, 9, 7, 0, 2, 9, 2, 0, 21, 7, 9, 0, 7, 7, 6, 11, 12, 5, 10, 11, 4, 5, 8, 7, 9, 8, 11, 7, 3, 8, 9, 6, 6, 18, 9, 6, 3, 9, 12, 15, 3, 9, 15, 14, 8, 10, 19, 14, 4, 5, 15, 19, 4, 5, 1, 14, 8, 10, 1, 14, 4, 5, 5, 19, 4, 5, 11, 0, 8, 10, 15, 0, 4, 5, 11, 5, 4, 5, 5, 0, 8, 10, 5, 0, 4, 5, 9, 5, 4, 5, 6, 1, 12, 5, 6, 1, 6, 5, 1, 12, 18, 2, 10, 12, 9, 2, 2, 8, 20, 6, 12, 8, 10, 3, 2, 11, 10, 3, 7, 6, 9, 7, 10, 6, 3, 7, 10, 5, 8, 16, 14, 5, 4, 8, 10, 13, 4, 8, 3, 9, 16, 8, 3, 9, 8, 4, 11, 13, 8, 4, 7, 8, 10, 4, 7, 8, 5, 4, 7, 12, 10, 8, 7, 12, 5, 4, 12, 16, 5, 4, 9, 19, 15, 4, 14, 19, 5, 4, 1, 0, 18, 9, 7, 0, 6, 9, 13, 4, 10, 8, 18, 4, 5, 4, 13, 8, 5, 4, 3, 16, 18, 4, 9, 16, 6, 4, 8, 7, 10, 12, 13, 7, 5, 6, 8, 13, 5, 6, 6, 7, 10, 12, 6, 7, 5, 6, 11, 13, 5, 6, 4, 6, 18, 7, 10, 6, 6, 7, 0, 17, 18, 3, 0, 18, 18, 1, 3, 17, 18, 3, 3, 18, 18, 1, 2, 4, 6, 10, 4, 4, 2, 10, 16, 0, 8, 24, 16, 0, 4, 24, 4, 0, 8, 15, 8, 0, 4, 15, 16, 0, 8, 24, 16, 0, 4, 24, 1, 4, 18, 9, 7, 4, 6, 9, 15, 12, 9, 6, 15, 14, 9, 2, 3, 9, 18, 6, 3, 9, 9, 3, 12, 12, 9, 3, 18, 5, 6, 9, 18, 8, 6, 3, 0, 5, 6, 9, 0, 8, 6, 3, 4, 7, 18, 4, 13, 7, 9, 2, 4, 9, 9, 2, 2, 1, 12, 20, 2, 1, 6, 10, 8, 11, 6, 10, 17, 0, 6, 23, 17, 0, 3, 23, 1, 6, 2, 18, 1, 15, 2, 9, 8, 8, 10, 6, 8, 10, 10, 2, 0, 6, 20, 6, 0, 6, 10, 3, 10, 9, 10, 3, 11, 12, 12, 5, 15, 12, 4, 5, 0, 4, 3, 19, 1, 4, 1, 19, 19, 1, 3, 18, 20, 1, 1, 18, 2, 1, 3, 18, 3, 1, 1, 18, 3, 10, 18, 3, 9, 10, 6, 3, 4, 4, 10, 9, 9, 4, 5, 9, 7, 13, 14, 7, 7, 13, 7, 7, 3, 13, 14, 7, 10, 13, 7, 7, 8, 15, 9, 6, 11, 15, 3, 6, 4, 14, 8, 10, 4, 14, 4, 5, 8, 19, 4, 5, 10, 14, 4, 10, 10, 19, 4, 5, 3, 8, 5, 16, 3, 16, 5, 8, 15, 10, 9, 6, 15, 12, 9, 2, 0, 10, 9, 6, 0, 12, 9, 2, 6, 7, 12, 9, 6, 10, 12, 3, 9, 10, 5, 8, 9, 14, 5, 4, 12, 1, 3, 12, 12, 7, 3, 6, 8, 15, 6, 9, 10, 15, 2, 9, 16, 6, 7, 6, 16, 9, 7, 3, 8, 1, 4, 22, 10, 1, 2, 22, 6, 6, 14, 3, 6, 6, 7, 3, 0, 18, 19, 3, 0, 19, 19, 1, 17, 0, 6, 24, 17, 0, 3, 24, 0, 13, 15, 6, 5, 13, 5, 6, 9, 6, 10, 14, 14, 6, 5, 7, 9, 13, 5, 7, 1, 6, 8, 10, 1, 6, 4, 5, 5, 11, 4, 5, 7, 6, 12, 5, 7, 6, 6, 5, 7, 7, 9, 6, 10, 7, 3, 6, 7, 8, 14, 14, 14, 8, 7, 7, 7, 15, 7, 7, 3, 8, 14, 14, 3, 8, 7, 7, 10, 15, 7, 7, 9, 8, 13, 4, 9, 10, 13, 2, 3, 2, 6, 12, 3, 2, 3, 6, 6, 8, 3, 6, 6, 10, 17, 6, 6, 13, 17, 3, 1, 10, 17, 6, 1, 13, 17, 3, 16, 7, 8, 9, 16, 10, 8, 3, 0, 7, 8, 9, 0, 10, 8, 3, 0, 9, 24, 10, 12, 9, 12, 5, 0, 14, 12, 5, 3, 2, 15, 8, 8, 2, 5, 8, 4, 2, 18, 8, 10, 2, 6, 8, 0, 1, 18, 4, 0, 1, 9, 2, 9, 3, 9, 2, 20, 2, 3, 18, 21, 2, 1, 18, 1, 3, 3, 19, 2, 3, 1, 19, 18, 8, 6, 16, 20, 8, 2, 16, 0, 8, 6, 16, 2, 8, 2, 16, 8, 18, 11, 6, 8, 20, 11, 2, 4, 6, 12, 5, 8, 6, 4, 5, 7, 6, 12, 5, 11, 6, 4, 5, 6, 3, 9, 6, 9, 3, 3, 6, 7, 6, 12, 5, 7, 6, 6, 5, 9, 8, 6, 7, 12, 8, 3, 7, 8, 2, 9, 6, 11, 2, 3, 6, 8, 14, 6, 9, 8, 17, 6, 3, 8, 2, 9, 6, 11, 2, 3, 6, 4, 3, 16, 20, 4, 3, 8, 10, 12, 13, 8, 10, 7, 6, 10, 12, 12, 6, 5, 6, 7, 12, 5, 6, 0, 2, 7, 12, 0, 6, 7, 4, 12, 17, 11, 6, 12, 19, 11, 2, 4, 7, 12, 8, 4, 7, 6, 4, 10, 11, 6, 4, 8, 11, 8, 10, 12, 11, 4, 5, 8, 16, 4, 5, 9, 1, 4, 9, 11, 1, 2, 9, 14, 0, 3, 22, 15, 0, 1, 22, 7, 0, 3, 22, 8, 0, 1, 22, 4, 7, 18, 4, 13, 7, 9, 2, 4, 9, 9, 2, 10, 2, 4, 15, 10, 7, 4, 5, 12, 1, 3, 12, 12, 7, 3, 6, 0, 0, 18, 13, 9, 0, 9, 13, 16, 0, 3, 24, 17, 0, 1, 24, 5, 0, 3, 24, 6, 0, 1, 24, 10, 15, 5, 8, 10, 19, 5, 4, 2, 18, 18, 2, 2, 19, 18, 1, 2, 8, 20, 3, 2, 9, 20, 1, 7, 6, 9, 6, 7, 8, 9, 2, 3, 2, 19, 10, 3, 7, 19, 5, 2, 7, 19, 3, 2, 8, 19, 1, 15, 6, 9, 4, 15, 8, 9, 2, 2, 2, 18, 8, 8, 2, 6, 8, 10, 9, 14, 4, 10, 9, 7, 4, 4, 4, 6, 16, 7, 4, 3, 16, 15, 8, 9, 16, 18, 8, 3, 16, 0, 8, 9, 16, 3, 8, 3, 16, 18, 0, 6, 14, 20, 0, 2, 14, 0, 0, 6, 14, 2, 0, 2, 14, 15, 0, 6, 22, 17, 0, 2, 22, 3, 0, 6, 22, 5, 0, 2, 22, 12, 2, 12, 20, 16, 2, 4, 20, 0, 2, 12, 20, 4, 2, 4, 20, 11, 6, 4, 9, 11, 6, 2, 9, 9, 0, 6, 16, 12, 0, 3, 16, 12, 1, 3, 12, 12, 7, 3, 6, 3, 4, 18, 6, 3, 4, 9, 3, 12, 7, 9, 3, 5, 5, 16, 8, 13, 5, 8, 4, 5, 9, 8, 4, 0, 13, 10, 6, 0, 15, 10, 2, 8, 14, 9, 6, 8, 16, 9, 2, 6, 2, 9, 6, 9, 2, 3, 6, 14, 1, 10, 8, 19, 1, 5, 4, 14, 5, 5, 4, 9, 1, 3, 12, 9, 7, 3, 6, 6, 4, 12, 9, 6, 7, 12, 3, 6, 5, 12, 6, 10, 5, 4, 6, 1, 1, 8, 5, 5, 1, 4, 5, 12, 12, 6, 8, 12, 16, 6, 4, 3, 12, 12, 6, 3, 14, 12, 2, 9, 18, 12, 6, 15, 18, 6, 3, 9, 21, 6, 3, 4, 13, 6, 6, 4, 16, 6, 3, 11, 3, 7, 18, 11, 12, 7, 9, 3, 9, 18, 3, 9, 9, 6, 3, 5, 3, 19, 2, 5, 4, 19, 1, 4, 2, 12, 6, 4, 2, 6, 3, 10, 5, 6, 3, 9, 6, 6, 9, 11, 6, 2, 9, 8, 6, 6, 9, 10, 6, 2, 9, 16, 9, 5, 15, 16, 14, 5, 5, 3, 9, 5, 15, 3, 14, 5, 5, 6, 6, 14, 6, 13, 6, 7, 3, 6, 9, 7, 3, 8, 6, 3, 14, 8, 13, 3, 7, 0, 16, 24, 5, 8, 16, 8, 5, 0, 20, 20, 3, 10, 20, 10, 3, 5, 10, 18, 2, 5, 11, 18, 1, 0, 6, 6, 10, 2, 6, 2, 10, 2, 1, 20, 3, 2, 2, 20, 1, 9, 13, 6, 11, 11, 13, 2, 11, 9, 15, 6, 8, 9, 19, 6, 4, 9, 12, 6, 9, 9, 15, 6, 3, 5, 11, 18, 2, 5, 12, 18, 1, 2, 6, 15, 6, 2, 8, 15, 2, 6, 0, 18, 3, 6, 1, 18, 1, 5, 0, 3, 18, 6, 0, 1, 18, 18, 3, 6, 10, 20, 3, 2, 10, 0, 3, 6, 10, 2, 3, 2, 10, 10, 5, 8, 9, 10, 5, 4, 9, 6, 5, 8, 9, 10, 5, 4, 9, 3, 2, 20, 3, 3, 3, 20, 1, 5, 2, 13, 4, 5, 4, 13, 2, 17, 0, 7, 14, 17, 7, 7, 7, 0, 0, 7, 14, 0, 7, 7, 7, 9, 11, 10, 6, 9, 11, 5, 6, 5, 11, 10, 6, 10, 11, 5, 6, 11, 6, 3, 18, 11, 12, 3, 6, 0, 16, 18, 3, 0, 17, 18, 1, 6, 16, 18, 3, 6, 17, 18, 1, 4, 6, 9, 10, 4, 11, 9, 5, 9, 7, 15, 4, 9, 9, 15, 2, 5, 6, 12, 6, 5, 6, 6, 3, 11, 9, 6, 3, 6, 1, 12, 9, 6, 4, 12, 3, 7, 9, 6, 12, 7, 9, 3, 6, 10, 15, 3, 6, 11, 5, 13, 6, 11, 7, 13, 2, 1, 11, 22, 13, 12, 11, 11, 13, 18, 8, 6, 6, 18, 11, 6, 3, 0, 8, 6, 6, 0, 11, 6, 3, 0, 6, 24, 3, 0, 7, 24, 1, 0, 5, 10, 6, 0, 7, 10, 2, 6, 7, 18, 3, 6, 8, 18, 1, 0, 0, 10, 6, 0, 2, 10, 2, 19, 0, 3, 19, 20, 0, 1, 19, 4, 6, 12, 16, 4, 6, 6, 8, 10, 14, 6, 8, 19, 6, 4, 18, 21, 6, 2, 9, 19, 15, 2, 9, 1, 6, 4, 18, 1, 6, 2, 9, 3, 15, 2, 9, 3, 21, 18, 3, 3, 22, 18, 1, 0, 19, 9, 4, 0, 21, 9, 2, 12, 18, 12, 6, 18, 18, 6, 3, 12, 21, 6, 3, 7, 18, 9, 4, 7, 20, 9, 2, 12, 16, 10, 8, 17, 16, 5, 4, 12, 20, 5, 4, 2, 16, 10, 8, 2, 16, 5, 4, 7, 20, 5, 4, 14, 0, 10, 12, 19, 0, 5, 6, 14, 6, 5, 6, 0, 0, 10, 12, 0, 0, 5, 6, 5, 6, 5, 6, 15, 14, 9, 6, 15, 16, 9, 2, 0, 14, 9, 6, 0, 16, 9, 2, 14, 14, 10, 6, 14, 16, 10, 2, 0, 14, 10, 6, 0, 16, 10, 2, 5, 18, 18, 2, 5, 19, 18, 1, 0, 18, 18, 3, 0, 19, 18, 1, 3, 5, 18, 12, 12, 5, 9, 6, 3, 11, 9, 6, 5, 3, 7, 9, 5, 6, 7, 3, 4, 0, 19, 15, 4, 5, 19, 5, 3, 0, 16, 4, 3, 2, 16, 2, 4, 12, 16, 12, 4, 12, 8, 12, 4, 3, 12, 15, 10, 3, 6, 15, 16, 4, 2, 19, 16, 4, 1, 19, 6, 4, 2, 19, 7, 4, 1, 19, 13, 14, 8, 10, 17, 14, 4, 5, 13, 19, 4, 5, 3, 14, 8, 10, 3, 14, 4, 5, 7, 19, 4, 5, 12, 6, 3, 18, 12, 12, 3, 6, 5, 11, 12, 6, 5, 11, 6, 3, 11, 14, 6, 3, 10, 5, 8, 10, 14, 5, 4, 5, 10, 10, 4, 5, 6, 4, 12, 10, 6, 4, 6, 5, 12, 9, 6, 5, 6, 8, 18, 10, 15, 8, 9, 5, 6, 13, 9, 5, 0, 8, 18, 10, 0, 8, 9, 5, 9, 13, 9, 5, 12, 6, 3, 18, 12, 12, 3, 6, 0, 14, 18, 3, 0, 15, 18, 1, 12, 6, 3, 18, 12, 12, 3, 6, 9, 6, 3, 18, 9, 12, 3, 6, 6, 14, 18, 3, 6, 15, 18, 1, 0, 5, 18, 3, 0, 6, 18, 1, 2, 5, 22, 3, 2, 6, 22, 1, 0, 0, 21, 10, 7, 0, 7, 10, 6, 3, 18, 17, 12, 3, 6, 17, 0, 3, 18, 17, 6, 3, 6, 17, 0, 12, 24, 11, 8, 12, 8, 11, 4, 10, 16, 6, 4, 13, 16, 3, 12, 8, 6, 8, 12, 12, 6, 4, 6, 14, 8, 7, 10, 14, 4, 7, 15, 10, 6, 14, 18, 10, 3, 7, 15, 17, 3, 7, 3, 10, 6, 14, 3, 10, 3, 7, 6, 17, 3, 7, 6, 12, 18, 2, 6, 13, 18, 1, 5, 8, 10, 6, 5, 10, 10, 2, 12, 11, 9, 4, 12, 13, 9, 2, 0, 11, 9, 6, 0, 13, 9, 2, 11, 2, 3, 18, 12, 2, 1, 18, 10, 2, 3, 18, 11, 2, 1, 18, 9, 12, 6, 10, 11, 12, 2, 10, 1, 10, 6, 9, 1, 13, 6, 3, 6, 9, 16, 6, 14, 9, 8, 3, 6, 12, 8, 3, 1, 8, 9, 6, 1, 10, 9, 2, 7, 7, 16, 6, 7, 9, 16, 2, 0, 0, 18, 3, 0, 1, 18, 1, 10, 0, 6, 9, 12, 0, 2, 9, 9, 5, 6, 6, 12, 5, 3, 6, 10, 6, 4, 18, 12, 6, 2, 9, 10, 15, 2, 9, 8, 0, 6, 9, 10, 0, 2, 9, 9, 1, 6, 9, 9, 4, 6, 3, 1, 0, 18, 9, 1, 3, 18, 3, 0, 3, 24, 3, 0, 4, 24, 1, 6, 14, 9, 4, 6, 16, 9, 2, 8, 9, 8, 10, 12, 9, 4, 5, 8, 14, 4, 5, 5, 2, 13, 9, 5, 5, 13, 3, 4, 4, 16, 9, 4, 7, 16, 3, 4, 4, 14, 9, 4, 7, 14, 3, 8, 5, 9, 6, 8, 7, 9, 2, 1, 7, 16, 6, 1, 9, 16, 2, 10, 5, 13, 9, 10, 8, 13, 3, 1, 5, 13, 9, 1, 8, 13, 3, 0, 4, 24, 6, 12, 4, 12, 3, 0, 7, 12, 3, 1, 14, 10, 9, 1, 17, 10, 3, 5, 17, 18, 3, 5, 18, 18, 1, 0, 16, 18, 3, 0, 17, 18, 1, 9, 17, 9, 6, 9, 19, 9, 2, 1, 20, 22, 4, 1, 20, 11, 2, 12, 22, 11, 2, 8, 14, 8, 6, 8, 17, 8, 3, 8, 6, 8, 15, 8, 11, 8, 5, 5, 4, 18, 3, 5, 5, 18, 1, 9, 3, 5, 10, 9, 8, 5, 5, 6, 8, 12, 3, 6, 8, 6, 3, 2, 6, 18, 6, 2, 6, 9, 3, 11, 9, 9, 3, 10, 6, 4, 18, 12, 6, 2, 9, 10, 15, 2, 9, 7, 5, 6, 6, 10, 5, 3, 6, 14, 5, 2, 18, 14, 14, 2, 9, 8, 5, 2, 18, 8, 14, 2, 9, 9, 2, 10, 6, 9, 2, 5, 6, 3, 1, 18, 12, 12, 1, 9, 12, 5, 2, 17, 22, 5, 13, 17, 11, 4, 0, 12, 6, 4, 2, 12, 2, 6, 9, 16, 6, 14, 9, 8, 3, 6, 12, 8, 3, 9, 0, 5, 18, 9, 9, 5, 9, 12, 0, 6, 9, 14, 0, 2, 9, 6, 0, 6, 9, 8, 0, 2, 9, 9, 1, 6, 12, 11, 1, 2, 12, 5, 9, 13, 4, 5, 11, 13, 2, 5, 8, 19, 3, 5, 9, 19, 1, 9, 9, 6, 8, 9, 13, 6, 4, 11, 9, 4, 15, 11, 14, 4, 5, 2, 0, 6, 14, 2, 0, 3, 7, 5, 7, 3, 7, 15, 1, 6, 14, 18, 1, 3, 7, 15, 8, 3, 7, 3, 1, 6, 14, 3, 1, 3, 7, 6, 8, 3, 7, 3, 20, 18, 4, 12, 20, 9, 2, 3, 22, 9, 2, 5, 0, 4, 20, 5, 0, 2, 10, 7, 10, 2, 10, 16, 8, 8, 12, 20, 8, 4, 6, 16, 14, 4, 6, 0, 8, 8, 12, 0, 8, 4, 6, 4, 14, 4, 6, 13, 13, 10, 8, 18, 13, 5, 4, 13, 17, 5, 4, 1, 13, 10, 8, 1, 13, 5, 4, 6, 17, 5, 4, 15, 8, 4, 15, 15, 13, 4, 5, 5, 8, 4, 15, 5, 13, 4, 5, 6, 11, 16, 12, 6, 15, 16, 4, 2, 11, 16, 12, 2, 15, 16, 4, 14, 12, 7, 9, 14, 15, 7, 3, 10, 1, 3, 21, 10, 8, 3, 7, 13, 11, 9, 4, 13, 13, 9, 2, 3, 10, 17, 9, 3, 13, 17, 3, 13, 8, 8, 15, 13, 13, 8, 5, 3, 8, 8, 15, 3, 13, 8, 5, 11, 14, 10, 8, 16, 14, 5, 4, 11, 18, 5, 4, 0, 18, 22, 6, 0, 18, 11, 3, 11, 21, 11, 3, 0, 16, 24, 4, 0, 16, 12, 4, 6, 20, 12, 3, 12, 20, 6, 3, 18, 12, 6, 12, 21, 12, 3, 6, 18, 18, 3, 6, 0, 12, 6, 12, 0, 12, 3, 6, 3, 18, 3, 6, 15, 17, 9, 6, 15, 19, 9, 2, 1, 6, 22, 10, 1, 6, 11, 5, 12, 11, 11, 5, 15, 17, 9, 6, 15, 19, 9, 2, 0, 18, 18, 2, 0, 19, 18, 1, 3, 15, 19, 3, 3, 16, 19, 1, 0, 13, 18, 3, 0, 14, 18, 1, 15, 17, 9, 6, 15, 19, 9, 2, 0, 17, 9, 6, 0, 19, 9, 2, 12, 17, 9, 6, 12, 19, 9, 2, 3, 17, 9, 6, 3, 19, 9, 2, 16, 2, 3, 20, 17, 2, 1, 20, 0, 13, 24, 8, 0, 17, 24, 4, 9, 1, 6, 22, 12, 1, 3, 11, 9, 12, 3, 11};
+const uint8_t frontalface_stages[] __attribute__((aligned(4))) = {
+    0xf6, 0xfa, 0x09, 0x00, 0x7f, 0xff, 0x16, 0x02, 0xc9, 0xfd, 0x02, 0x00, 0x06, 0x04, 0x0c, 0x09,
+    0x00, 0xf0, 0x06, 0x07, 0x0c, 0x03, 0x00, 0x30, 0x32, 0x00, 0x23, 0xfe, 0x53, 0x01, 0x02, 0x00,
+    0x06, 0x04, 0x0c, 0x07, 0x00, 0xf0, 0x0a, 0x04, 0x04, 0x07, 0x00, 0x30, 0x59, 0x00, 0x7e, 0xfe,
+    0x10, 0x01, 0x02, 0x00, 0x03, 0x09, 0x12, 0x09, 0x00, 0xf0, 0x03, 0x0c, 0x12, 0x03, 0x00, 0x30,
+    0x17, 0x00, 0x21, 0xff, 0x2d, 0x01, 0x02, 0x00, 0x08, 0x12, 0x09, 0x06, 0x00, 0xf0, 0x08, 0x14,
+    0x09, 0x02, 0x00, 0x30, 0x3d, 0x00, 0x39, 0xff, 0x42, 0x01, 0x02, 0x00, 0x03, 0x05, 0x04, 0x13,
+    0x00, 0xf0, 0x05, 0x05, 0x02, 0x13, 0x00, 0x20, 0x97, 0x01, 0x8e, 0x00, 0x21, 0xfe, 0x02, 0x00,
+    0x06, 0x05, 0x0c, 0x10, 0x00, 0xf0, 0x06, 0x0d, 0x0c, 0x08, 0x00, 0x20, 0x0b, 0x00, 0x50, 0xfe,
+    0x70, 0x00, 0x02, 0x00, 0x05, 0x08, 0x0c, 0x06, 0x00, 0xf0, 0x05, 0x0b, 0x0c, 0x03, 0x00, 0x20,
+    0xb3, 0xff, 0x86, 0xfe, 0x71, 0x00, 0x02, 0x00, 0x0b, 0x0e, 0x04, 0x0a, 0x00, 0xf0, 0x0b, 0x13,
+    0x04, 0x05, 0x00, 0x20, 0x18, 0x00, 0x25, 0xff, 0xda, 0x00, 0x02, 0x00, 0x04, 0x00, 0x07, 0x06,
+    0x00, 0xf0, 0x04, 0x03, 0x07, 0x03, 0x00, 0x20, 0x05, 0xfb, 0x10, 0x00, 0xaa, 0xff, 0x3e, 0x01,
+    0x6e, 0xfe, 0x02, 0x00, 0x06, 0x06, 0x0c, 0x06, 0x00, 0xf0, 0x06, 0x08, 0x0c, 0x02, 0x00, 0x30,
+    0x53, 0x00, 0x62, 0xfe, 0x2e, 0x01, 0x02, 0x00, 0x06, 0x04, 0x0c, 0x07, 0x00, 0xf0, 0x0a, 0x04,
+    0x04, 0x07, 0x00, 0x30, 0x57, 0x00, 0x0f, 0xfe, 0xb3, 0x00, 0x02, 0x00, 0x01, 0x08, 0x13, 0x0c,
+    0x00, 0xf0, 0x01, 0x0c, 0x13, 0x04, 0x00, 0x30, 0x77, 0x01, 0x72, 0xff, 0xba, 0x01, 0x02, 0x00,
+    0x00, 0x02, 0x18, 0x03, 0x00, 0xf0, 0x08, 0x02, 0x08, 0x03, 0x00, 0x30, 0x94, 0x00, 0x44, 0x00,
+    0xd2, 0xfd, 0x02, 0x00, 0x09, 0x09, 0x06, 0x0f, 0x00, 0xf0, 0x09, 0x0e, 0x06, 0x05, 0x00, 0x30,
+    0xb2, 0xff, 0x54, 0xfd, 0x74, 0x00, 0x02, 0x00, 0x05, 0x06, 0x0e, 0x0a, 0x00, 0xf0, 0x05, 0x0b,
+    0x0e, 0x05, 0x00, 0x20, 0x21, 0x00, 0xeb, 0xfe, 0x89, 0x00, 0x02, 0x00, 0x05, 0x00, 0x0e, 0x09,
+    0x00, 0xf0, 0x05, 0x03, 0x0e, 0x03, 0x00, 0x30, 0x4b, 0x00, 0xa6, 0xff, 0xee, 0x00, 0x02, 0x00,
+    0x0d, 0x0b, 0x09, 0x06, 0x00, 0xf0, 0x10, 0x0b, 0x03, 0x06, 0x00, 0x30, 0xe4, 0xff, 0xed, 0x00,
+    0x57, 0xff, 0x02, 0x00, 0x07, 0x05, 0x06, 0x0a, 0x00, 0xf0, 0x09, 0x05, 0x02, 0x0a, 0x00, 0x30,
+    0xd8, 0xff, 0x28, 0x01, 0xb4, 0xff, 0x02, 0x00, 0x0a, 0x08, 0x06, 0x0a, 0x00, 0xf0, 0x0c, 0x08,
+    0x02, 0x0a, 0x00, 0x30, 0x40, 0x00, 0x95, 0xff, 0x5b, 0x01, 0x02, 0x00, 0x02, 0x05, 0x04, 0x09,
+    0x00, 0xf0, 0x04, 0x05, 0x02, 0x09, 0x00, 0x20, 0xac, 0xff, 0x75, 0x01, 0xce, 0xff, 0x02, 0x00,
+    0x12, 0x00, 0x06, 0x0b, 0x00, 0xf0, 0x14, 0x00, 0x02, 0x0b, 0x00, 0x30, 0xcd, 0xfd, 0x1e, 0x01,
+    0x79, 0xff, 0x02, 0x00, 0x00, 0x06, 0x18, 0x0d, 0x00, 0xf0, 0x08, 0x06, 0x08, 0x0d, 0x00, 0x30,
+    0x3a, 0x00, 0xa7, 0xff, 0x24, 0x01, 0x02, 0x00, 0x09, 0x06, 0x06, 0x09, 0x00, 0xf0, 0x0b, 0x06,
+    0x02, 0x09, 0x00, 0x30, 0x29, 0x00, 0x65, 0xff, 0xc5, 0x00, 0x02, 0x00, 0x07, 0x12, 0x0a, 0x06,
+    0x00, 0xf0, 0x07, 0x14, 0x0a, 0x02, 0x00, 0x30, 0x76, 0x01, 0x63, 0x00, 0x7d, 0xfe, 0x02, 0x00,
+    0x05, 0x07, 0x0e, 0x0c, 0x00, 0xf0, 0x05, 0x0d, 0x0e, 0x06, 0x00, 0x20, 0x59, 0xfb, 0x1b, 0x00,
+    0x1d, 0x01, 0xfd, 0xfe, 0x77, 0x01, 0x02, 0x00, 0x00, 0x03, 0x18, 0x03, 0x00, 0xf0, 0x08, 0x03,
+    0x08, 0x03, 0x00, 0x30, 0x81, 0x00, 0x5b, 0xfe, 0x00, 0x01, 0x02, 0x00, 0x05, 0x08, 0x0f, 0x06,
+    0x00, 0xf0, 0x05, 0x0b, 0x0f, 0x03, 0x00, 0x20, 0x3a, 0x00, 0x76, 0x00, 0x68, 0xfe, 0x02, 0x00,
+    0x09, 0x06, 0x05, 0x0e, 0x00, 0xf0, 0x09, 0x0d, 0x05, 0x07, 0x00, 0x20, 0x3b, 0x00, 0x59, 0xff,
+    0xd4, 0x00, 0x02, 0x00, 0x09, 0x05, 0x06, 0x0a, 0x00, 0xf0, 0x0b, 0x05, 0x02, 0x0a, 0x00, 0x30,
+    0xf4, 0xff, 0x9b, 0xfe, 0x6c, 0x00, 0x02, 0x00, 0x06, 0x06, 0x03, 0x0c, 0x00, 0xf0, 0x06, 0x0c,
+    0x03, 0x06, 0x00, 0x20, 0x86, 0x00, 0x7f, 0xff, 0x0d, 0x01, 0x02, 0x00, 0x03, 0x15, 0x12, 0x03,
+    0x00, 0xf0, 0x09, 0x15, 0x06, 0x03, 0x00, 0x30, 0xe3, 0xff, 0x5d, 0x00, 0xa8, 0xfe, 0x02, 0x00,
+    0x05, 0x06, 0x0d, 0x06, 0x00, 0xf0, 0x05, 0x08, 0x0d, 0x02, 0x00, 0x30, 0xce, 0x00, 0xb3, 0xff,
+    0x73, 0x01, 0x02, 0x00, 0x12, 0x01, 0x06, 0x0f, 0x00, 0xf0, 0x12, 0x01, 0x03, 0x0f, 0x00, 0x20,
+    0xc0, 0x00, 0x99, 0xff, 0x36, 0x01, 0x02, 0x00, 0x01, 0x01, 0x06, 0x0f, 0x00, 0xf0, 0x04, 0x01,
+    0x03, 0x0f, 0x00, 0x20, 0xe4, 0xfe, 0x0d, 0x01, 0x8b, 0xff, 0x02, 0x00, 0x00, 0x08, 0x18, 0x0f,
+    0x00, 0xf0, 0x08, 0x08, 0x08, 0x0f, 0x00, 0x30, 0x38, 0xff, 0x60, 0xfe, 0x27, 0x00, 0x03, 0x00,
+    0x05, 0x06, 0x0e, 0x0c, 0x00, 0xf0, 0x05, 0x06, 0x07, 0x06, 0x00, 0x20, 0x0c, 0x0c, 0x07, 0x06,
+    0x00, 0x20, 0x5b, 0x01, 0x48, 0x00, 0x70, 0xfe, 0x02, 0x00, 0x02, 0x0c, 0x15, 0x0c, 0x00, 0xf0,
+    0x02, 0x10, 0x15, 0x04, 0x00, 0x30, 0xf9, 0xff, 0xfd, 0xfe, 0x3b, 0x00, 0x02, 0x00, 0x08, 0x01,
+    0x04, 0x0a, 0x00, 0xf0, 0x0a, 0x01, 0x02, 0x0a, 0x00, 0x20, 0xd9, 0x01, 0xd6, 0xff, 0x47, 0x01,
+    0x02, 0x00, 0x02, 0x0d, 0x14, 0x0a, 0x00, 0xf0, 0x02, 0x0d, 0x0a, 0x0a, 0x00, 0x20, 0x2e, 0xff,
+    0x84, 0x01, 0xb3, 0xff, 0x02, 0x00, 0x00, 0x01, 0x06, 0x0d, 0x00, 0xf0, 0x02, 0x01, 0x02, 0x0d,
+    0x00, 0x30, 0x52, 0xff, 0xc3, 0x01, 0xf3, 0xff, 0x02, 0x00, 0x14, 0x02, 0x04, 0x0d, 0x00, 0xf0,
+    0x14, 0x02, 0x02, 0x0d, 0x00, 0x20, 0xf2, 0x05, 0xb0, 0xff, 0x89, 0x01, 0x02, 0x00, 0x00, 0x05,
+    0x16, 0x13, 0x00, 0xf0, 0x0b, 0x05, 0x0b, 0x13, 0x00, 0x20, 0x4f, 0x00, 0xe7, 0xff, 0xef, 0x00,
+    0x02, 0x00, 0x12, 0x04, 0x06, 0x09, 0x00, 0xf0, 0x14, 0x04, 0x02, 0x09, 0x00, 0x30, 0x47, 0x00,
+    0x99, 0xff, 0xf6, 0x00, 0x02, 0x00, 0x00, 0x03, 0x06, 0x0b, 0x00, 0xf0, 0x02, 0x03, 0x02, 0x0b,
+    0x00, 0x30, 0xa2, 0x00, 0x2b, 0x00, 0x0b, 0xfd, 0x02, 0x00, 0x0c, 0x01, 0x04, 0x09, 0x00, 0xf0,
+    0x0c, 0x01, 0x02, 0x09, 0x00, 0x20, 0xdb, 0xff, 0xe3, 0x00, 0x90, 0xff, 0x02, 0x00, 0x00, 0x06,
+    0x13, 0x03, 0x00, 0xf0, 0x00, 0x07, 0x13, 0x01, 0x00, 0x30, 0x07, 0x00, 0xa1, 0xff, 0x66, 0x00,
+    0x02, 0x00, 0x0c, 0x01, 0x04, 0x09, 0x00, 0xf0, 0x0c, 0x01, 0x02, 0x09, 0x00, 0x20, 0x7b, 0x00,
+    0x10, 0x00, 0x5b, 0xfd, 0x02, 0x00, 0x08, 0x01, 0x04, 0x09, 0x00, 0xf0, 0x0a, 0x01, 0x02, 0x09,
+    0x00, 0x20, 0xbe, 0xfe, 0x41, 0xfe, 0x48, 0x00, 0x03, 0x00, 0x05, 0x05, 0x0e, 0x0e, 0x00, 0xf0,
+    0x0c, 0x05, 0x07, 0x07, 0x00, 0x20, 0x05, 0x0c, 0x07, 0x07, 0x00, 0x20, 0x08, 0x00, 0x10, 0xff,
+    0x3b, 0x00, 0x02, 0x00, 0x01, 0x0a, 0x12, 0x02, 0x00, 0xf0, 0x01, 0x0b, 0x12, 0x01, 0x00, 0x20,
+    0x6e, 0x00, 0xf3, 0xff, 0x13, 0x01, 0x02, 0x00, 0x11, 0x0d, 0x04, 0x0b, 0x00, 0xf0, 0x11, 0x0d,
+    0x02, 0x0b, 0x00, 0x20, 0x48, 0xff, 0x2c, 0xfe, 0x19, 0x00, 0x02, 0x00, 0x00, 0x04, 0x06, 0x09,
+    0x00, 0xf0, 0x00, 0x07, 0x06, 0x03, 0x00, 0x30, 0x8c, 0xfb, 0x20, 0x00, 0xf3, 0xfe, 0x27, 0x01,
+    0xee, 0xfe, 0x02, 0x00, 0x06, 0x04, 0x0c, 0x09, 0x00, 0xf0, 0x06, 0x07, 0x0c, 0x03, 0x00, 0x30,
+    0x40, 0x00, 0x70, 0xfe, 0xc4, 0x00, 0x02, 0x00, 0x06, 0x05, 0x0c, 0x06, 0x00, 0xf0, 0x0a, 0x05,
+    0x04, 0x06, 0x00, 0x30, 0x54, 0x02, 0x6d, 0xff, 0x61, 0x01, 0x02, 0x00, 0x00, 0x01, 0x18, 0x05,
+    0x00, 0xf0, 0x08, 0x01, 0x08, 0x05, 0x00, 0x30, 0x19, 0x00, 0x8b, 0xfe, 0x84, 0x00, 0x02, 0x00,
+    0x04, 0x0a, 0x12, 0x06, 0x00, 0xf0, 0x04, 0x0c, 0x12, 0x02, 0x00, 0x30, 0x1b, 0x00, 0x2b, 0xff,
+    0x95, 0x00, 0x03, 0x00, 0x02, 0x11, 0x0c, 0x06, 0x00, 0xf0, 0x02, 0x11, 0x06, 0x03, 0x00, 0x20,
+    0x08, 0x14, 0x06, 0x03, 0x00, 0x20, 0x4b, 0x00, 0xb0, 0xff, 0x2b, 0x01, 0x02, 0x00, 0x13, 0x03,
+    0x04, 0x0d, 0x00, 0xf0, 0x13, 0x03, 0x02, 0x0d, 0x00, 0x20, 0x51, 0x00, 0x91, 0xff, 0xf4, 0x00,
+    0x02, 0x00, 0x01, 0x03, 0x04, 0x0d, 0x00, 0xf0, 0x03, 0x03, 0x02, 0x0d, 0x00, 0x20, 0x90, 0xfb,
+    0x7d, 0x01, 0xdd, 0xff, 0x02, 0x00, 0x00, 0x01, 0x18, 0x17, 0x00, 0xf0, 0x08, 0x01, 0x08, 0x17,
+    0x00, 0x30, 0x25, 0x00, 0x0a, 0xff, 0x46, 0x00, 0x02, 0x00, 0x01, 0x07, 0x08, 0x0c, 0x00, 0xf0,
+    0x01, 0x0b, 0x08, 0x04, 0x00, 0x30, 0x66, 0xff, 0x8e, 0xfd, 0x3c, 0x00, 0x02, 0x00, 0x0e, 0x07,
+    0x03, 0x0e, 0x00, 0xf0, 0x0e, 0x0e, 0x03, 0x07, 0x00, 0x20, 0x4b, 0x00, 0x2c, 0x00, 0xa9, 0xfe,
+    0x03, 0x00, 0x03, 0x0c, 0x10, 0x06, 0x00, 0xf0, 0x03, 0x0c, 0x08, 0x03, 0x00, 0x20, 0x0b, 0x0f,
+    0x08, 0x03, 0x00, 0x20, 0xd3, 0xff, 0x7c, 0x00, 0x1a, 0xff, 0x02, 0x00, 0x06, 0x06, 0x0c, 0x06,
+    0x00, 0xf0, 0x06, 0x08, 0x0c, 0x02, 0x00, 0x30, 0x8a, 0x00, 0x2d, 0x00, 0x5e, 0xfe, 0x02, 0x00,
+    0x08, 0x07, 0x06, 0x0c, 0x00, 0xf0, 0x08, 0x0d, 0x06, 0x06, 0x00, 0x20, 0x6e, 0xff, 0x0b, 0xfe,
+    0x2e, 0x00, 0x02, 0x00, 0x0f, 0x0f, 0x09, 0x06, 0x00, 0xf0, 0x0f, 0x11, 0x09, 0x02, 0x00, 0x30,
+    0xd2, 0xff, 0xfd, 0x00, 0x9f, 0xff, 0x02, 0x00, 0x01, 0x11, 0x12, 0x03, 0x00, 0xf0, 0x01, 0x12,
+    0x12, 0x01, 0x00, 0x30, 0xf5, 0xfe, 0x6c, 0xfd, 0x3f, 0x00, 0x02, 0x00, 0x04, 0x04, 0x10, 0x0c,
+    0x00, 0xf0, 0x04, 0x0a, 0x10, 0x06, 0x00, 0x20, 0x53, 0xff, 0x70, 0x01, 0xb5, 0xff, 0x02, 0x00,
+    0x00, 0x01, 0x04, 0x14, 0x00, 0xf0, 0x02, 0x01, 0x02, 0x14, 0x00, 0x20, 0x07, 0x00, 0x82, 0xff,
+    0xa1, 0x00, 0x02, 0x00, 0x03, 0x00, 0x12, 0x02, 0x00, 0xf0, 0x03, 0x01, 0x12, 0x01, 0x00, 0x20,
+    0xef, 0xfd, 0xac, 0xfd, 0x0d, 0x00, 0x03, 0x00, 0x01, 0x05, 0x14, 0x0e, 0x00, 0xf0, 0x01, 0x05,
+    0x0a, 0x07, 0x00, 0x20, 0x0b, 0x0c, 0x0a, 0x07, 0x00, 0x20, 0x5d, 0x00, 0x28, 0xff, 0x63, 0x00,
+    0x02, 0x00, 0x05, 0x08, 0x0e, 0x0c, 0x00, 0xf0, 0x05, 0x0c, 0x0e, 0x04, 0x00, 0x30, 0x75, 0xff,
+    0x8f, 0xfe, 0x19, 0x00, 0x02, 0x00, 0x03, 0x0e, 0x07, 0x09, 0x00, 0xf0, 0x03, 0x11, 0x07, 0x03,
+    0x00, 0x30, 0x6b, 0x00, 0x2e, 0x00, 0xbe, 0xfe, 0x02, 0x00, 0x0e, 0x0f, 0x09, 0x06, 0x00, 0xf0,
+    0x0e, 0x11, 0x09, 0x02, 0x00, 0x30, 0x5b, 0x00, 0x11, 0x00, 0x9f, 0xfd, 0x02, 0x00, 0x01, 0x0f,
+    0x09, 0x06, 0x00, 0xf0, 0x01, 0x11, 0x09, 0x02, 0x00, 0x30, 0xe9, 0xff, 0x64, 0x00, 0xba, 0xff,
+    0x03, 0x00, 0x0b, 0x06, 0x08, 0x0a, 0x00, 0xf0, 0x0f, 0x06, 0x04, 0x05, 0x00, 0x20, 0x0b, 0x0b,
+    0x04, 0x05, 0x00, 0x20, 0xb2, 0x00, 0x25, 0x00, 0xdd, 0xfe, 0x03, 0x00, 0x05, 0x05, 0x0e, 0x0e,
+    0x00, 0xf0, 0x05, 0x05, 0x07, 0x07, 0x00, 0x20, 0x0c, 0x0c, 0x07, 0x07, 0x00, 0x20, 0xea, 0x00,
+    0x3f, 0x00, 0xbc, 0xfe, 0x02, 0x00, 0x06, 0x00, 0x0c, 0x05, 0x00, 0xf0, 0x0a, 0x00, 0x04, 0x05,
+    0x00, 0x30, 0x09, 0x00, 0x3f, 0xff, 0x45, 0x00, 0x02, 0x00, 0x09, 0x00, 0x06, 0x09, 0x00, 0xf0,
+    0x09, 0x03, 0x06, 0x03, 0x00, 0x30, 0x35, 0x00, 0xa3, 0xff, 0xb5, 0x00, 0x02, 0x00, 0x09, 0x06,
+    0x06, 0x09, 0x00, 0xf0, 0x0b, 0x06, 0x02, 0x09, 0x00, 0x30, 0x94, 0xff, 0xae, 0xfd, 0x09, 0x00,
+    0x02, 0x00, 0x07, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x09, 0x00, 0x02, 0x09, 0x00, 0x30, 0xe9, 0xff,
+    0x6c, 0x00, 0xf4, 0xff, 0x02, 0x00, 0x0a, 0x06, 0x06, 0x09, 0x00, 0xf0, 0x0c, 0x06, 0x02, 0x09,
+    0x00, 0x30, 0xbd, 0xff, 0x1c, 0x01, 0xa7, 0xff, 0x02, 0x00, 0x08, 0x06, 0x06, 0x09, 0x00, 0xf0,
+    0x0a, 0x06, 0x02, 0x09, 0x00, 0x30, 0xe9, 0xfe, 0xad, 0xfc, 0x36, 0x00, 0x02, 0x00, 0x03, 0x08,
+    0x12, 0x04, 0x00, 0xf0, 0x09, 0x08, 0x06, 0x04, 0x00, 0x30, 0x9e, 0xfb, 0x34, 0x00, 0xa3, 0x00,
+    0xc9, 0xfe, 0x15, 0x01, 0x02, 0x00, 0x06, 0x00, 0x0c, 0x09, 0x00, 0xf0, 0x06, 0x03, 0x0c, 0x03,
+    0x00, 0x30, 0x02, 0x03, 0x85, 0xff, 0x67, 0x01, 0x02, 0x00, 0x00, 0x00, 0x18, 0x06, 0x00, 0xf0,
+    0x08, 0x00, 0x08, 0x06, 0x00, 0x30, 0x3f, 0x01, 0xec, 0xfe, 0xbd, 0x00, 0x02, 0x00, 0x04, 0x07,
+    0x10, 0x0c, 0x00, 0xf0, 0x04, 0x0b, 0x10, 0x04, 0x00, 0x30, 0x00, 0x00, 0xcd, 0xfe, 0x60, 0x00,
+    0x02, 0x00, 0x0b, 0x06, 0x06, 0x06, 0x00, 0xf0, 0x0b, 0x06, 0x03, 0x06, 0x00, 0x20, 0x5c, 0x01,
+    0x90, 0xff, 0x43, 0x01, 0x02, 0x00, 0x00, 0x14, 0x18, 0x03, 0x00, 0xf0, 0x08, 0x14, 0x08, 0x03,
+    0x00, 0x30, 0x24, 0x00, 0xd1, 0xff, 0x75, 0x00, 0x02, 0x00, 0x0b, 0x06, 0x04, 0x09, 0x00, 0xf0,
+    0x0b, 0x06, 0x02, 0x09, 0x00, 0x20, 0x24, 0x00, 0x4d, 0x00, 0x0b, 0xff, 0x02, 0x00, 0x04, 0x0d,
+    0x0f, 0x04, 0x00, 0xf0, 0x09, 0x0d, 0x05, 0x04, 0x00, 0x30, 0xa0, 0xff, 0x3f, 0x01, 0x0b, 0x00,
+    0x02, 0x00, 0x0b, 0x06, 0x04, 0x09, 0x00, 0xf0, 0x0b, 0x06, 0x02, 0x09, 0x00, 0x20, 0x1c, 0x00,
+    0x68, 0xff, 0x8a, 0x00, 0x02, 0x00, 0x09, 0x06, 0x04, 0x09, 0x00, 0xf0, 0x0b, 0x06, 0x02, 0x09,
+    0x00, 0x20, 0x8a, 0x00, 0x48, 0x00, 0x83, 0xfe, 0x02, 0x00, 0x09, 0x0c, 0x06, 0x0c, 0x00, 0xf0,
+    0x09, 0x12, 0x06, 0x06, 0x00, 0x20, 0xf3, 0xff, 0x7b, 0x00, 0x7a, 0xff, 0x02, 0x00, 0x01, 0x16,
+    0x12, 0x02, 0x00, 0xf0, 0x01, 0x17, 0x12, 0x01, 0x00, 0x20, 0x77, 0x00, 0x44, 0x00, 0x67, 0xfe,
+    0x02, 0x00, 0x0a, 0x07, 0x04, 0x0a, 0x00, 0xf0, 0x0a, 0x0c, 0x04, 0x05, 0x00, 0x20, 0xde, 0xff,
+    0xb1, 0xfe, 0x27, 0x00, 0x02, 0x00, 0x06, 0x07, 0x08, 0x0a, 0x00, 0xf0, 0x06, 0x0c, 0x08, 0x05,
+    0x00, 0x20, 0xd4, 0xff, 0x74, 0x00, 0x48, 0xff, 0x02, 0x00, 0x07, 0x06, 0x0a, 0x06, 0x00, 0xf0,
+    0x07, 0x08, 0x0a, 0x02, 0x00, 0x30, 0x9c, 0xff, 0x45, 0xfe, 0x11, 0x00, 0x02, 0x00, 0x00, 0x0e,
+    0x0a, 0x04, 0x00, 0xf0, 0x00, 0x10, 0x0a, 0x02, 0x00, 0x20, 0x0f, 0x00, 0xcf, 0xff, 0xae, 0x00,
+    0x02, 0x00, 0x06, 0x12, 0x12, 0x02, 0x00, 0xf0, 0x06, 0x13, 0x12, 0x01, 0x00, 0x20, 0xce, 0xff,
+    0x64, 0xfe, 0x13, 0x00, 0x02, 0x00, 0x01, 0x01, 0x16, 0x03, 0x00, 0xf0, 0x01, 0x02, 0x16, 0x01,
+    0x00, 0x30, 0xed, 0xff, 0xbe, 0x00, 0xc9, 0xff, 0x02, 0x00, 0x06, 0x10, 0x12, 0x03, 0x00, 0xf0,
+    0x06, 0x11, 0x12, 0x01, 0x00, 0x30, 0x3a, 0x01, 0xbc, 0xff, 0x4f, 0x01, 0x02, 0x00, 0x02, 0x04,
+    0x06, 0x0f, 0x00, 0xf0, 0x05, 0x04, 0x03, 0x0f, 0x00, 0x20, 0x75, 0x00, 0xf1, 0xff, 0x38, 0x01,
+    0x02, 0x00, 0x14, 0x04, 0x04, 0x0a, 0x00, 0xf0, 0x14, 0x04, 0x02, 0x0a, 0x00, 0x20, 0x50, 0x00,
+    0xa7, 0xff, 0xd9, 0x00, 0x02, 0x00, 0x00, 0x04, 0x04, 0x0a, 0x00, 0xf0, 0x02, 0x04, 0x02, 0x0a,
+    0x00, 0x20, 0x89, 0xff, 0xf4, 0xfe, 0x4c, 0x00, 0x03, 0x00, 0x02, 0x10, 0x14, 0x06, 0x00, 0xf0,
+    0x0c, 0x10, 0x0a, 0x03, 0x00, 0x20, 0x02, 0x13, 0x0a, 0x03, 0x00, 0x20, 0x89, 0xff, 0xd3, 0x00,
+    0xad, 0xff, 0x02, 0x00, 0x00, 0x0c, 0x08, 0x09, 0x00, 0xf0, 0x04, 0x0c, 0x04, 0x09, 0x00, 0x20,
+    0x50, 0x00, 0x34, 0x00, 0x2a, 0xff, 0x02, 0x00, 0x0c, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x0e, 0x00,
+    0x02, 0x09, 0x00, 0x30, 0x11, 0x00, 0x34, 0x00, 0x55, 0xff, 0x02, 0x00, 0x05, 0x0a, 0x06, 0x06,
+    0x00, 0xf0, 0x08, 0x0a, 0x03, 0x06, 0x00, 0x20, 0x6f, 0xff, 0xb4, 0xfe, 0x23, 0x00, 0x03, 0x00,
+    0x0b, 0x08, 0x0c, 0x06, 0x00, 0xf0, 0x11, 0x08, 0x06, 0x03, 0x00, 0x20, 0x0b, 0x0b, 0x06, 0x03,
+    0x00, 0x20, 0xbe, 0xff, 0xb1, 0xfe, 0x13, 0x00, 0x03, 0x00, 0x00, 0x08, 0x0c, 0x06, 0x00, 0xf0,
+    0x00, 0x08, 0x06, 0x03, 0x00, 0x20, 0x06, 0x0b, 0x06, 0x03, 0x00, 0x20, 0xa6, 0xff, 0xf3, 0xfe,
+    0x31, 0x00, 0x02, 0x00, 0x0c, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x0e, 0x00, 0x02, 0x09, 0x00, 0x30,
+    0xa3, 0xff, 0xa1, 0xfe, 0x11, 0x00, 0x02, 0x00, 0x06, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x08, 0x00,
+    0x02, 0x09, 0x00, 0x30, 0x44, 0x00, 0xf7, 0xff, 0xc7, 0x00, 0x02, 0x00, 0x08, 0x0e, 0x09, 0x06,
+    0x00, 0xf0, 0x08, 0x10, 0x09, 0x02, 0x00, 0x30, 0xca, 0xff, 0x01, 0xff, 0x1f, 0x00, 0x02, 0x00,
+    0x00, 0x10, 0x09, 0x06, 0x00, 0xf0, 0x00, 0x12, 0x09, 0x02, 0x00, 0x30, 0x76, 0xff, 0x72, 0x01,
+    0x03, 0x00, 0x02, 0x00, 0x0a, 0x08, 0x06, 0x0a, 0x00, 0xf0, 0x0c, 0x08, 0x02, 0x0a, 0x00, 0x30,
+    0x45, 0x00, 0xa1, 0xff, 0x87, 0x00, 0x02, 0x00, 0x03, 0x13, 0x0c, 0x03, 0x00, 0xf0, 0x09, 0x13,
+    0x06, 0x03, 0x00, 0x20, 0x0d, 0x00, 0x6d, 0xff, 0x64, 0x00, 0x02, 0x00, 0x02, 0x0a, 0x14, 0x02,
+    0x00, 0xf0, 0x02, 0x0b, 0x14, 0x01, 0x00, 0x20, 0x56, 0x01, 0x04, 0x00, 0xe2, 0xfd, 0x03, 0x00,
+    0x02, 0x09, 0x12, 0x0c, 0x00, 0xf0, 0x02, 0x09, 0x09, 0x06, 0x00, 0x20, 0x0b, 0x0f, 0x09, 0x06,
+    0x00, 0x20, 0x20, 0x04, 0xec, 0xff, 0xfc, 0x00, 0x02, 0x00, 0x03, 0x00, 0x12, 0x18, 0x00, 0xf0,
+    0x03, 0x00, 0x09, 0x18, 0x00, 0x20, 0x6b, 0xff, 0xda, 0xfe, 0x18, 0x00, 0x03, 0x00, 0x05, 0x06,
+    0x0e, 0x0a, 0x00, 0xf0, 0x05, 0x06, 0x07, 0x05, 0x00, 0x20, 0x0c, 0x0b, 0x07, 0x05, 0x00, 0x20,
+    0xbd, 0xff, 0x5f, 0x00, 0xdb, 0xff, 0x03, 0x00, 0x09, 0x05, 0x0a, 0x0c, 0x00, 0xf0, 0x0e, 0x05,
+    0x05, 0x06, 0x00, 0x20, 0x09, 0x0b, 0x05, 0x06, 0x00, 0x20, 0xf1, 0xff, 0x43, 0x00, 0x6c, 0xff,
+    0x03, 0x00, 0x04, 0x05, 0x0c, 0x0c, 0x00, 0xf0, 0x04, 0x05, 0x06, 0x06, 0x00, 0x20, 0x0a, 0x0b,
+    0x06, 0x06, 0x00, 0x20, 0xe6, 0xff, 0xc1, 0x00, 0xd5, 0xff, 0x02, 0x00, 0x04, 0x0e, 0x12, 0x03,
+    0x00, 0xf0, 0x04, 0x0f, 0x12, 0x01, 0x00, 0x30, 0xf1, 0xff, 0x39, 0x00, 0x5d, 0xff, 0x02, 0x00,
+    0x06, 0x0d, 0x08, 0x08, 0x00, 0xf0, 0x06, 0x11, 0x08, 0x04, 0x00, 0x20, 0x46, 0xff, 0xbd, 0xfe,
+    0x40, 0x00, 0x02, 0x00, 0x03, 0x10, 0x12, 0x06, 0x00, 0xf0, 0x03, 0x13, 0x12, 0x03, 0x00, 0x20,
+    0x9e, 0xff, 0xde, 0x00, 0xbb, 0xff, 0x02, 0x00, 0x00, 0x00, 0x06, 0x06, 0x00, 0xf0, 0x03, 0x00,
+    0x03, 0x06, 0x00, 0x20, 0xc3, 0xfe, 0x9d, 0xfe, 0x3c, 0x00, 0x02, 0x00, 0x06, 0x06, 0x0c, 0x12,
+    0x00, 0xf0, 0x0a, 0x06, 0x04, 0x12, 0x00, 0x30, 0x60, 0x00, 0x10, 0x00, 0xbd, 0xfe, 0x02, 0x00,
+    0x06, 0x01, 0x04, 0x0e, 0x00, 0xf0, 0x08, 0x01, 0x02, 0x0e, 0x00, 0x20, 0xf6, 0xff, 0x77, 0xff,
+    0x4d, 0x00, 0x02, 0x00, 0x03, 0x02, 0x13, 0x02, 0x00, 0xf0, 0x03, 0x03, 0x13, 0x01, 0x00, 0x20,
+    0xeb, 0x01, 0xa6, 0xff, 0x87, 0x00, 0x02, 0x00, 0x01, 0x08, 0x16, 0x0d, 0x00, 0xf0, 0x0c, 0x08,
+    0x0b, 0x0d, 0x00, 0x20, 0x09, 0x00, 0x6a, 0xff, 0x3d, 0x00, 0x02, 0x00, 0x08, 0x09, 0x0b, 0x04,
+    0x00, 0xf0, 0x08, 0x0b, 0x0b, 0x02, 0x00, 0x20, 0x1d, 0x01, 0xab, 0xff, 0x84, 0x00, 0x02, 0x00,
+    0x00, 0x0c, 0x0f, 0x0a, 0x00, 0xf0, 0x05, 0x0c, 0x05, 0x0a, 0x00, 0x30, 0x41, 0xff, 0xb2, 0x00,
+    0xfd, 0xff, 0x02, 0x00, 0x0c, 0x10, 0x0c, 0x06, 0x00, 0xf0, 0x10, 0x10, 0x04, 0x06, 0x00, 0x30,
+    0x33, 0xff, 0xdc, 0x00, 0xbe, 0xff, 0x02, 0x00, 0x00, 0x10, 0x0c, 0x06, 0x00, 0xf0, 0x04, 0x10,
+    0x04, 0x06, 0x00, 0x30, 0x7b, 0x00, 0x31, 0x00, 0x69, 0xff, 0x02, 0x00, 0x13, 0x01, 0x05, 0x0c,
+    0x00, 0xf0, 0x13, 0x05, 0x05, 0x04, 0x00, 0x30, 0xdf, 0xfb, 0x35, 0x00, 0x75, 0x01, 0x1c, 0xff,
+    0x0b, 0x01, 0x02, 0x00, 0x00, 0x02, 0x18, 0x04, 0x00, 0xf0, 0x08, 0x02, 0x08, 0x04, 0x00, 0x30,
+    0x34, 0x00, 0xbe, 0xfe, 0x8d, 0x00, 0x02, 0x00, 0x06, 0x08, 0x0c, 0x04, 0x00, 0xf0, 0x06, 0x0a,
+    0x0c, 0x02, 0x00, 0x20, 0x41, 0x00, 0x24, 0xff, 0xa3, 0x00, 0x02, 0x00, 0x07, 0x05, 0x09, 0x06,
+    0x00, 0xf0, 0x0a, 0x05, 0x03, 0x06, 0x00, 0x30, 0x09, 0x00, 0x41, 0xff, 0x88, 0x00, 0x02, 0x00,
+    0x09, 0x11, 0x06, 0x06, 0x00, 0xf0, 0x09, 0x14, 0x06, 0x03, 0x00, 0x20, 0x82, 0x00, 0xbd, 0xfe,
+    0x5c, 0x00, 0x02, 0x00, 0x00, 0x07, 0x16, 0x0f, 0x00, 0xf0, 0x00, 0x0c, 0x16, 0x05, 0x00, 0x30,
+    0x0b, 0x00, 0x05, 0xff, 0x5c, 0x00, 0x02, 0x00, 0x04, 0x01, 0x11, 0x09, 0x00, 0xf0, 0x04, 0x04,
+    0x11, 0x03, 0x00, 0x30, 0xcf, 0xff, 0xa4, 0x00, 0x80, 0xff, 0x02, 0x00, 0x07, 0x05, 0x06, 0x0a,
+    0x00, 0xf0, 0x09, 0x05, 0x02, 0x0a, 0x00, 0x30, 0x57, 0x00, 0xc3, 0xff, 0xda, 0x00, 0x02, 0x00,
+    0x12, 0x01, 0x06, 0x08, 0x00, 0xf0, 0x12, 0x01, 0x03, 0x08, 0x00, 0x20, 0x7c, 0x00, 0xa9, 0xff,
+    0x24, 0x01, 0x02, 0x00, 0x00, 0x01, 0x06, 0x07, 0x00, 0xf0, 0x03, 0x01, 0x03, 0x07, 0x00, 0x20,
+    0x48, 0xff, 0x19, 0x01, 0xd2, 0xff, 0x02, 0x00, 0x12, 0x00, 0x06, 0x16, 0x00, 0xf0, 0x12, 0x00,
+    0x03, 0x16, 0x00, 0x20, 0xdb, 0xfe, 0x92, 0x01, 0xb0, 0xff, 0x02, 0x00, 0x00, 0x00, 0x06, 0x16,
+    0x00, 0xf0, 0x03, 0x00, 0x03, 0x16, 0x00, 0x20, 0xf2, 0x00, 0xba, 0xff, 0x0b, 0x01, 0x02, 0x00,
+    0x10, 0x07, 0x08, 0x10, 0x00, 0xf0, 0x10, 0x07, 0x04, 0x10, 0x00, 0x20, 0x1b, 0x00, 0xe8, 0xfe,
+    0x32, 0x00, 0x02, 0x00, 0x02, 0x0a, 0x13, 0x06, 0x00, 0xf0, 0x02, 0x0c, 0x13, 0x02, 0x00, 0x30,
+    0xa8, 0x00, 0x4e, 0x00, 0xac, 0xfe, 0x02, 0x00, 0x09, 0x09, 0x06, 0x0c, 0x00, 0xf0, 0x09, 0x0d,
+    0x06, 0x04, 0x00, 0x30, 0xfd, 0xff, 0x42, 0x00, 0x4d, 0xff, 0x02, 0x00, 0x02, 0x0f, 0x11, 0x06,
+    0x00, 0xf0, 0x02, 0x11, 0x11, 0x02, 0x00, 0x30, 0x84, 0xff, 0xc5, 0xfe, 0x39, 0x00, 0x02, 0x00,
+    0x0e, 0x07, 0x03, 0x0e, 0x00, 0xf0, 0x0e, 0x0e, 0x03, 0x07, 0x00, 0x20, 0xcc, 0xff, 0x68, 0x00,
+    0x7d, 0xff, 0x03, 0x00, 0x05, 0x06, 0x08, 0x0a, 0x00, 0xf0, 0x05, 0x06, 0x04, 0x05, 0x00, 0x20,
+    0x09, 0x0b, 0x04, 0x05, 0x00, 0x20, 0x99, 0x00, 0xe8, 0xff, 0x9e, 0x00, 0x02, 0x00, 0x0f, 0x08,
+    0x09, 0x0b, 0x00, 0xf0, 0x12, 0x08, 0x03, 0x0b, 0x00, 0x30, 0x64, 0x00, 0x97, 0xff, 0x79, 0x00,
+    0x02, 0x00, 0x00, 0x08, 0x09, 0x0b, 0x00, 0xf0, 0x03, 0x08, 0x03, 0x0b, 0x00, 0x30, 0xe9, 0x00,
+    0x40, 0x00, 0x51, 0xff, 0x02, 0x00, 0x08, 0x06, 0x0a, 0x12, 0x00, 0xf0, 0x08, 0x0f, 0x0a, 0x09,
+    0x00, 0x20, 0xbe, 0xff, 0x10, 0xff, 0x1d, 0x00, 0x02, 0x00, 0x07, 0x07, 0x03, 0x0e, 0x00, 0xf0,
+    0x07, 0x0e, 0x03, 0x07, 0x00, 0x20, 0x2e, 0xfd, 0x3e, 0x01, 0xf2, 0xff, 0x02, 0x00, 0x00, 0x0e,
+    0x18, 0x08, 0x00, 0xf0, 0x08, 0x0e, 0x08, 0x08, 0x00, 0x30, 0xd1, 0x02, 0xad, 0xff, 0xd3, 0x00,
+    0x02, 0x00, 0x01, 0x0a, 0x12, 0x0e, 0x00, 0xf0, 0x0a, 0x0a, 0x09, 0x0e, 0x00, 0x20, 0xe2, 0xff,
+    0x59, 0x00, 0xd3, 0xff, 0x02, 0x00, 0x0e, 0x0c, 0x06, 0x06, 0x00, 0xf0, 0x0e, 0x0f, 0x06, 0x03,
+    0x00, 0x20, 0xf9, 0x00, 0x0e, 0x00, 0x74, 0xfe, 0x03, 0x00, 0x07, 0x00, 0x0a, 0x10, 0x00, 0xf0,
+    0x07, 0x00, 0x05, 0x08, 0x00, 0x20, 0x0c, 0x08, 0x05, 0x08, 0x00, 0x20, 0x89, 0xff, 0xfa, 0xfe,
+    0x3d, 0x00, 0x02, 0x00, 0x0a, 0x00, 0x09, 0x06, 0x00, 0xf0, 0x0d, 0x00, 0x03, 0x06, 0x00, 0x30,
+    0x46, 0xff, 0x07, 0x01, 0xaf, 0xff, 0x02, 0x00, 0x04, 0x03, 0x10, 0x04, 0x00, 0xf0, 0x0c, 0x03,
+    0x08, 0x04, 0x00, 0x20, 0x98, 0x00, 0x37, 0x00, 0x2d, 0xff, 0x02, 0x00, 0x0a, 0x00, 0x09, 0x06,
+    0x00, 0xf0, 0x0d, 0x00, 0x03, 0x06, 0x00, 0x30, 0x9d, 0xff, 0x68, 0xfe, 0x0d, 0x00, 0x03, 0x00,
+    0x01, 0x01, 0x14, 0x04, 0x00, 0xf0, 0x01, 0x01, 0x0a, 0x02, 0x00, 0x20, 0x0b, 0x03, 0x0a, 0x02,
+    0x00, 0x20, 0x0c, 0xff, 0xf9, 0xfe, 0x21, 0x00, 0x02, 0x00, 0x0a, 0x00, 0x09, 0x06, 0x00, 0xf0,
+    0x0d, 0x00, 0x03, 0x06, 0x00, 0x30, 0x85, 0xff, 0x86, 0xfe, 0x09, 0x00, 0x02, 0x00, 0x05, 0x00,
+    0x09, 0x06, 0x00, 0xf0, 0x08, 0x00, 0x03, 0x06, 0x00, 0x30, 0x1e, 0x00, 0xc3, 0xff, 0x7e, 0x00,
+    0x02, 0x00, 0x08, 0x12, 0x0a, 0x06, 0x00, 0xf0, 0x08, 0x14, 0x0a, 0x02, 0x00, 0x30, 0xf8, 0xff,
+    0x4a, 0x00, 0x6e, 0xff, 0x02, 0x00, 0x06, 0x03, 0x06, 0x09, 0x00, 0xf0, 0x08, 0x03, 0x02, 0x09,
+    0x00, 0x30, 0x55, 0x00, 0xc5, 0xff, 0xa3, 0x00, 0x02, 0x00, 0x07, 0x03, 0x0c, 0x06, 0x00, 0xf0,
+    0x07, 0x05, 0x0c, 0x02, 0x00, 0x30, 0xe5, 0xff, 0xcb, 0xfe, 0x10, 0x00, 0x02, 0x00, 0x00, 0x0a,
+    0x12, 0x03, 0x00, 0xf0, 0x00, 0x0b, 0x12, 0x01, 0x00, 0x30, 0x4c, 0x00, 0x3e, 0x00, 0x01, 0xff,
+    0x02, 0x00, 0x01, 0x0a, 0x16, 0x03, 0x00, 0xf0, 0x01, 0x0b, 0x16, 0x01, 0x00, 0x30, 0x4b, 0xff,
+    0xa2, 0xfe, 0x09, 0x00, 0x02, 0x00, 0x05, 0x0b, 0x08, 0x08, 0x00, 0xf0, 0x09, 0x0b, 0x04, 0x08,
+    0x00, 0x20, 0x5d, 0x00, 0x36, 0x00, 0xf6, 0xfe, 0x02, 0x00, 0x0c, 0x0b, 0x06, 0x06, 0x00, 0xf0,
+    0x0c, 0x0b, 0x03, 0x06, 0x00, 0x20, 0xfc, 0xff, 0x53, 0x00, 0x76, 0xff, 0x02, 0x00, 0x06, 0x0b,
+    0x06, 0x06, 0x00, 0xf0, 0x09, 0x0b, 0x03, 0x06, 0x00, 0x20, 0x46, 0x00, 0xb8, 0xff, 0x71, 0x00,
+    0x02, 0x00, 0x07, 0x0a, 0x0b, 0x06, 0x00, 0xf0, 0x07, 0x0c, 0x0b, 0x02, 0x00, 0x30, 0x73, 0xff,
+    0xb1, 0xfd, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0d, 0x18, 0x04, 0x00, 0xf0, 0x00, 0x0d, 0x0c, 0x02,
+    0x00, 0x20, 0x0c, 0x0f, 0x0c, 0x02, 0x00, 0x20, 0x12, 0x01, 0x49, 0x00, 0x5b, 0xff, 0x03, 0x00,
+    0x02, 0x04, 0x16, 0x0c, 0x00, 0xf0, 0x0d, 0x04, 0x0b, 0x06, 0x00, 0x20, 0x02, 0x0a, 0x0b, 0x06,
+    0x00, 0x20, 0xcd, 0x03, 0xbb, 0xff, 0xcd, 0x00, 0x02, 0x00, 0x02, 0x00, 0x14, 0x11, 0x00, 0xf0,
+    0x0c, 0x00, 0x0a, 0x11, 0x00, 0x20, 0xcc, 0xff, 0x78, 0xfe, 0x36, 0x00, 0x02, 0x00, 0x0e, 0x00,
+    0x02, 0x18, 0x00, 0xf0, 0x0e, 0x00, 0x01, 0x18, 0x00, 0x20, 0x2b, 0x00, 0x13, 0x00, 0xf2, 0xfe,
+    0x02, 0x00, 0x08, 0x00, 0x02, 0x18, 0x00, 0xf0, 0x09, 0x00, 0x01, 0x18, 0x00, 0x20, 0x45, 0x00,
+    0x24, 0x00, 0x25, 0xff, 0x02, 0x00, 0x0e, 0x01, 0x02, 0x16, 0x00, 0xf0, 0x0e, 0x01, 0x01, 0x16,
+    0x00, 0x20, 0xe3, 0xff, 0xe6, 0xfe, 0x10, 0x00, 0x02, 0x00, 0x08, 0x01, 0x02, 0x16, 0x00, 0xf0,
+    0x09, 0x01, 0x01, 0x16, 0x00, 0x20, 0x2b, 0x00, 0x03, 0x00, 0xa2, 0x00, 0x02, 0x00, 0x11, 0x06,
+    0x03, 0x12, 0x00, 0xf0, 0x12, 0x06, 0x01, 0x12, 0x00, 0x30, 0x19, 0x00, 0xa8, 0xff, 0x90, 0x00,
+    0x02, 0x00, 0x06, 0x0e, 0x09, 0x06, 0x00, 0xf0, 0x06, 0x10, 0x09, 0x02, 0x00, 0x30, 0x35, 0x00,
+    0x33, 0x00, 0x7f, 0xfe, 0x02, 0x00, 0x0d, 0x0e, 0x09, 0x04, 0x00, 0xf0, 0x0d, 0x10, 0x09, 0x02,
+    0x00, 0x20, 0x0c, 0x00, 0x98, 0xff, 0x60, 0x00, 0x02, 0x00, 0x03, 0x12, 0x12, 0x03, 0x00, 0xf0,
+    0x03, 0x13, 0x12, 0x01, 0x00, 0x30, 0x41, 0xfe, 0xc7, 0xfd, 0x1f, 0x00, 0x03, 0x00, 0x09, 0x04,
+    0x08, 0x12, 0x00, 0xf0, 0x0d, 0x04, 0x04, 0x09, 0x00, 0x20, 0x09, 0x0d, 0x04, 0x09, 0x00, 0x20,
+    0x21, 0x00, 0xb7, 0xff, 0xad, 0x00, 0x02, 0x00, 0x00, 0x11, 0x12, 0x03, 0x00, 0xf0, 0x00, 0x12,
+    0x12, 0x01, 0x00, 0x30, 0xfb, 0xfb, 0x3e, 0x00, 0x80, 0x00, 0x1d, 0xff, 0xf3, 0x00, 0x02, 0x00,
+    0x00, 0x02, 0x0c, 0x04, 0x00, 0xf0, 0x06, 0x02, 0x06, 0x04, 0x00, 0x20, 0x82, 0x00, 0xe3, 0xfe,
+    0x7d, 0x00, 0x02, 0x00, 0x06, 0x08, 0x0e, 0x06, 0x00, 0xf0, 0x06, 0x0b, 0x0e, 0x03, 0x00, 0x20,
+    0x1b, 0x00, 0xfe, 0xfe, 0x7f, 0x00, 0x02, 0x00, 0x07, 0x05, 0x06, 0x06, 0x00, 0xf0, 0x0a, 0x05,
+    0x03, 0x06, 0x00, 0x20, 0x6b, 0x00, 0x42, 0x00, 0xc0, 0xfe, 0x02, 0x00, 0x0a, 0x05, 0x06, 0x10,
+    0x00, 0xf0, 0x0a, 0x0d, 0x06, 0x08, 0x00, 0x20, 0x34, 0x00, 0x6e, 0xff, 0x98, 0x00, 0x02, 0x00,
+    0x01, 0x04, 0x09, 0x10, 0x00, 0xf0, 0x04, 0x04, 0x03, 0x10, 0x00, 0x30, 0x6b, 0x00, 0x73, 0xff,
+    0x4d, 0x00, 0x02, 0x00, 0x05, 0x00, 0x12, 0x09, 0x00, 0xf0, 0x05, 0x03, 0x12, 0x03, 0x00, 0x30,
+    0xc3, 0xff, 0xb7, 0xfe, 0x39, 0x00, 0x02, 0x00, 0x09, 0x0f, 0x05, 0x08, 0x00, 0xf0, 0x09, 0x13,
+    0x05, 0x04, 0x00, 0x20, 0x61, 0xff, 0xbe, 0x01, 0xe7, 0xff, 0x02, 0x00, 0x14, 0x00, 0x04, 0x09,
+    0x00, 0xf0, 0x14, 0x00, 0x02, 0x09, 0x00, 0x20, 0xe9, 0xff, 0xf3, 0xfe, 0x2f, 0x00, 0x02, 0x00,
+    0x02, 0x00, 0x12, 0x03, 0x00, 0xf0, 0x02, 0x01, 0x12, 0x01, 0x00, 0x30, 0xfa, 0xff, 0x91, 0x00,
+    0x89, 0xff, 0x02, 0x00, 0x05, 0x16, 0x13, 0x02, 0x00, 0xf0, 0x05, 0x17, 0x13, 0x01, 0x00, 0x20,
+    0x8c, 0xff, 0x4e, 0x01, 0xbd, 0xff, 0x02, 0x00, 0x00, 0x00, 0x04, 0x09, 0x00, 0xf0, 0x02, 0x00,
+    0x02, 0x09, 0x00, 0x20, 0x0f, 0x01, 0x8a, 0xff, 0x6a, 0x00, 0x02, 0x00, 0x05, 0x06, 0x13, 0x12,
+    0x00, 0xf0, 0x05, 0x0c, 0x13, 0x06, 0x00, 0x30, 0x24, 0x00, 0x96, 0xff, 0x97, 0x00, 0x02, 0x00,
+    0x00, 0x01, 0x06, 0x09, 0x00, 0xf0, 0x02, 0x01, 0x02, 0x09, 0x00, 0x30, 0x2e, 0x00, 0x5c, 0x00,
+    0x8b, 0xff, 0x03, 0x00, 0x06, 0x05, 0x0e, 0x0c, 0x00, 0xf0, 0x0d, 0x05, 0x07, 0x06, 0x00, 0x20,
+    0x06, 0x0b, 0x07, 0x06, 0x00, 0x20, 0xf5, 0xff, 0x1c, 0xff, 0x24, 0x00, 0x02, 0x00, 0x00, 0x01,
+    0x14, 0x02, 0x00, 0xf0, 0x00, 0x02, 0x14, 0x01, 0x00, 0x20, 0x2e, 0x00, 0x4b, 0x00, 0x07, 0xff,
+    0x02, 0x00, 0x01, 0x02, 0x16, 0x03, 0x00, 0xf0, 0x01, 0x03, 0x16, 0x01, 0x00, 0x30, 0x1d, 0x00,
+    0x35, 0xff, 0x2e, 0x00, 0x02, 0x00, 0x02, 0x08, 0x07, 0x09, 0x00, 0xf0, 0x02, 0x0b, 0x07, 0x03,
+    0x00, 0x30, 0x82, 0x00, 0x27, 0x00, 0xad, 0xfe, 0x03, 0x00, 0x02, 0x0c, 0x16, 0x04, 0x00, 0xf0,
+    0x0d, 0x0c, 0x0b, 0x02, 0x00, 0x20, 0x02, 0x0e, 0x0b, 0x02, 0x00, 0x20, 0x67, 0x00, 0x08, 0x00,
+    0xe8, 0xfd, 0x03, 0x00, 0x00, 0x0c, 0x16, 0x04, 0x00, 0xf0, 0x00, 0x0c, 0x0b, 0x02, 0x00, 0x20,
+    0x0b, 0x0e, 0x0b, 0x02, 0x00, 0x20, 0x1e, 0x00, 0x9c, 0xff, 0x83, 0x00, 0x02, 0x00, 0x09, 0x07,
+    0x06, 0x0b, 0x00, 0xf0, 0x0b, 0x07, 0x02, 0x0b, 0x00, 0x30, 0x86, 0x00, 0x16, 0x00, 0xb8, 0xfe,
+    0x02, 0x00, 0x07, 0x01, 0x09, 0x06, 0x00, 0xf0, 0x0a, 0x01, 0x03, 0x06, 0x00, 0x30, 0xf5, 0xff,
+    0x8d, 0x00, 0x8a, 0xff, 0x02, 0x00, 0x0b, 0x02, 0x04, 0x0a, 0x00, 0xf0, 0x0b, 0x07, 0x04, 0x05,
+    0x00, 0x20, 0x65, 0xff, 0x27, 0xfe, 0x0b, 0x00, 0x02, 0x00, 0x06, 0x04, 0x0c, 0x0c, 0x00, 0xf0,
+    0x06, 0x0a, 0x0c, 0x06, 0x00, 0x20, 0x61, 0xff, 0x85, 0xff, 0x58, 0x00, 0x02, 0x00, 0x12, 0x01,
+    0x06, 0x0f, 0x00, 0xf0, 0x12, 0x06, 0x06, 0x05, 0x00, 0x30, 0x0b, 0x00, 0x8d, 0xff, 0x6d, 0x00,
+    0x02, 0x00, 0x03, 0x0f, 0x12, 0x03, 0x00, 0xf0, 0x03, 0x10, 0x12, 0x01, 0x00, 0x30, 0x23, 0xff,
+    0x28, 0xff, 0x2a, 0x00, 0x02, 0x00, 0x12, 0x05, 0x06, 0x09, 0x00, 0xf0, 0x12, 0x08, 0x06, 0x03,
+    0x00, 0x30, 0xde, 0xff, 0x5a, 0x00, 0x88, 0xff, 0x03, 0x00, 0x01, 0x05, 0x10, 0x06, 0x00, 0xf0,
+    0x01, 0x05, 0x08, 0x03, 0x00, 0x20, 0x09, 0x08, 0x08, 0x03, 0x00, 0x20, 0x8a, 0x00, 0x2f, 0x00,
+    0x55, 0xfe, 0x02, 0x00, 0x0b, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x0d, 0x00, 0x02, 0x09, 0x00, 0x30,
+    0x34, 0xfe, 0xc0, 0xfe, 0x09, 0x00, 0x03, 0x00, 0x00, 0x04, 0x18, 0x0e, 0x00, 0xf0, 0x00, 0x04,
+    0x0c, 0x07, 0x00, 0x20, 0x0c, 0x0b, 0x0c, 0x07, 0x00, 0x20, 0xd6, 0xff, 0x30, 0xff, 0x3b, 0x00,
+    0x02, 0x00, 0x0d, 0x00, 0x04, 0x0d, 0x00, 0xf0, 0x0d, 0x00, 0x02, 0x0d, 0x00, 0x20, 0xec, 0xff,
+    0x13, 0xff, 0x19, 0x00, 0x02, 0x00, 0x07, 0x00, 0x04, 0x0d, 0x00, 0xf0, 0x09, 0x00, 0x02, 0x0d,
+    0x00, 0x20, 0xda, 0xff, 0x90, 0x00, 0xd0, 0xff, 0x02, 0x00, 0x0b, 0x06, 0x06, 0x09, 0x00, 0xf0,
+    0x0d, 0x06, 0x02, 0x09, 0x00, 0x30, 0xd0, 0xff, 0xcd, 0x00, 0x9f, 0xff, 0x02, 0x00, 0x08, 0x07,
+    0x06, 0x09, 0x00, 0xf0, 0x0a, 0x07, 0x02, 0x09, 0x00, 0x30, 0xa1, 0xff, 0x27, 0xff, 0x32, 0x00,
+    0x02, 0x00, 0x0d, 0x11, 0x09, 0x06, 0x00, 0xf0, 0x0d, 0x13, 0x09, 0x02, 0x00, 0x30, 0x45, 0x00,
+    0x99, 0xff, 0x81, 0x00, 0x03, 0x00, 0x02, 0x12, 0x0e, 0x06, 0x00, 0xf0, 0x02, 0x12, 0x07, 0x03,
+    0x00, 0x20, 0x09, 0x15, 0x07, 0x03, 0x00, 0x20, 0x9e, 0xff, 0x79, 0xfe, 0x3b, 0x00, 0x03, 0x00,
+    0x03, 0x12, 0x12, 0x04, 0x00, 0xf0, 0x0c, 0x12, 0x09, 0x02, 0x00, 0x20, 0x03, 0x14, 0x09, 0x02,
+    0x00, 0x20, 0x69, 0xff, 0xa1, 0x00, 0xaf, 0xff, 0x02, 0x00, 0x00, 0x14, 0x0f, 0x04, 0x00, 0xf0,
+    0x05, 0x14, 0x05, 0x04, 0x00, 0x30, 0x04, 0xff, 0x96, 0x00, 0xfd, 0xff, 0x02, 0x00, 0x09, 0x0f,
+    0x0f, 0x09, 0x00, 0xf0, 0x0e, 0x0f, 0x05, 0x09, 0x00, 0x30, 0x58, 0x00, 0xbf, 0xff, 0x0a, 0x01,
+    0x02, 0x00, 0x04, 0x04, 0x10, 0x04, 0x00, 0xf0, 0x04, 0x06, 0x10, 0x02, 0x00, 0x20, 0xf1, 0xff,
+    0x4a, 0x00, 0x2b, 0xff, 0x02, 0x00, 0x07, 0x06, 0x0a, 0x06, 0x00, 0xf0, 0x07, 0x08, 0x0a, 0x02,
+    0x00, 0x30, 0xb7, 0x00, 0x9b, 0xff, 0x74, 0x00, 0x02, 0x00, 0x00, 0x0e, 0x0f, 0x0a, 0x00, 0xf0,
+    0x05, 0x0e, 0x05, 0x0a, 0x00, 0x30, 0xea, 0x00, 0x35, 0x00, 0x80, 0xfe, 0x03, 0x00, 0x07, 0x09,
+    0x0a, 0x0e, 0x00, 0xf0, 0x0c, 0x09, 0x05, 0x07, 0x00, 0x20, 0x07, 0x10, 0x05, 0x07, 0x00, 0x20,
+    0xd2, 0xff, 0x70, 0x00, 0x9e, 0xff, 0x02, 0x00, 0x07, 0x06, 0x06, 0x09, 0x00, 0xf0, 0x09, 0x06,
+    0x02, 0x09, 0x00, 0x30, 0xcf, 0xff, 0xf0, 0x00, 0xe5, 0xff, 0x02, 0x00, 0x03, 0x06, 0x12, 0x03,
+    0x00, 0xf0, 0x03, 0x07, 0x12, 0x01, 0x00, 0x30, 0x5c, 0x00, 0x02, 0x00, 0x52, 0xfe, 0x02, 0x00,
+    0x00, 0x0a, 0x12, 0x03, 0x00, 0xf0, 0x00, 0x0b, 0x12, 0x01, 0x00, 0x30, 0xaf, 0xff, 0xfd, 0xfe,
+    0x3d, 0x00, 0x03, 0x00, 0x03, 0x10, 0x12, 0x04, 0x00, 0xf0, 0x0c, 0x10, 0x09, 0x02, 0x00, 0x20,
+    0x03, 0x12, 0x09, 0x02, 0x00, 0x20, 0x41, 0x00, 0xa0, 0xff, 0x77, 0x00, 0x03, 0x00, 0x04, 0x06,
+    0x0e, 0x06, 0x00, 0xf0, 0x04, 0x06, 0x07, 0x03, 0x00, 0x20, 0x0b, 0x09, 0x07, 0x03, 0x00, 0x20,
+    0xdb, 0xff, 0x32, 0xff, 0x2d, 0x00, 0x02, 0x00, 0x0d, 0x00, 0x02, 0x12, 0x00, 0xf0, 0x0d, 0x00,
+    0x01, 0x12, 0x00, 0x20, 0xee, 0xff, 0xf2, 0xfe, 0x12, 0x00, 0x02, 0x00, 0x09, 0x00, 0x02, 0x12,
+    0x00, 0xf0, 0x0a, 0x00, 0x01, 0x12, 0x00, 0x20, 0x09, 0x02, 0x33, 0x00, 0x75, 0xfe, 0x02, 0x00,
+    0x05, 0x07, 0x0f, 0x0a, 0x00, 0xf0, 0x0a, 0x07, 0x05, 0x0a, 0x00, 0x30, 0xc3, 0x00, 0x9f, 0xff,
+    0x60, 0x00, 0x02, 0x00, 0x01, 0x14, 0x15, 0x04, 0x00, 0xf0, 0x08, 0x14, 0x07, 0x04, 0x00, 0x30,
+    0xdb, 0x00, 0x36, 0x00, 0xc3, 0xfe, 0x02, 0x00, 0x0a, 0x05, 0x05, 0x12, 0x00, 0xf0, 0x0a, 0x0e,
+    0x05, 0x09, 0x00, 0x20, 0x5e, 0xff, 0xfa, 0xfe, 0x0d, 0x00, 0x03, 0x00, 0x00, 0x02, 0x18, 0x06,
+    0x00, 0xf0, 0x00, 0x02, 0x0c, 0x03, 0x00, 0x20, 0x0c, 0x05, 0x0c, 0x03, 0x00, 0x20, 0xed, 0xfe,
+    0xf9, 0xfe, 0x3a, 0x00, 0x03, 0x00, 0x01, 0x01, 0x16, 0x08, 0x00, 0xf0, 0x0c, 0x01, 0x0b, 0x04,
+    0x00, 0x20, 0x01, 0x05, 0x0b, 0x04, 0x00, 0x20, 0x22, 0x02, 0xcb, 0xff, 0x3a, 0x01, 0x02, 0x00,
+    0x04, 0x00, 0x0f, 0x09, 0x00, 0xf0, 0x04, 0x03, 0x0f, 0x03, 0x00, 0x30, 0xa8, 0xfc, 0xe1, 0x00,
+    0xf5, 0xff, 0x02, 0x00, 0x00, 0x00, 0x18, 0x13, 0x00, 0xf0, 0x08, 0x00, 0x08, 0x13, 0x00, 0x30,
+    0xf4, 0xfe, 0x0b, 0x01, 0xc9, 0xff, 0x02, 0x00, 0x02, 0x15, 0x12, 0x03, 0x00, 0xf0, 0x0b, 0x15,
+    0x09, 0x03, 0x00, 0x20, 0xfd, 0x00, 0x23, 0x00, 0x1a, 0xfe, 0x02, 0x00, 0x09, 0x07, 0x0a, 0x04,
+    0x00, 0xf0, 0x09, 0x07, 0x05, 0x04, 0x00, 0x20, 0x98, 0xff, 0x57, 0xfe, 0x01, 0x00, 0x02, 0x00,
+    0x05, 0x07, 0x0a, 0x04, 0x00, 0xf0, 0x0a, 0x07, 0x05, 0x04, 0x00, 0x20, 0x72, 0xff, 0xcc, 0x00,
+    0xeb, 0xff, 0x03, 0x00, 0x11, 0x08, 0x06, 0x10, 0x00, 0xf0, 0x14, 0x08, 0x03, 0x08, 0x00, 0x20,
+    0x11, 0x10, 0x03, 0x08, 0x00, 0x20, 0xb6, 0xff, 0x0b, 0xff, 0x10, 0x00, 0x03, 0x00, 0x01, 0x0f,
+    0x14, 0x04, 0x00, 0xf0, 0x01, 0x0f, 0x0a, 0x02, 0x00, 0x20, 0x0b, 0x11, 0x0a, 0x02, 0x00, 0x20,
+    0x3d, 0x00, 0x32, 0x00, 0x3d, 0xff, 0x02, 0x00, 0x0e, 0x0f, 0x0a, 0x06, 0x00, 0xf0, 0x0e, 0x11,
+    0x0a, 0x02, 0x00, 0x30, 0x1e, 0xfc, 0x48, 0x00, 0xbd, 0x00, 0xf7, 0xfe, 0xd2, 0x00, 0x02, 0x00,
+    0x03, 0x00, 0x10, 0x09, 0x00, 0xf0, 0x03, 0x03, 0x10, 0x03, 0x00, 0x30, 0x3f, 0x00, 0xc5, 0xfe,
+    0x4b, 0x00, 0x02, 0x00, 0x0f, 0x06, 0x07, 0x0f, 0x00, 0xf0, 0x0f, 0x0b, 0x07, 0x05, 0x00, 0x30,
+    0x34, 0x00, 0x3e, 0xff, 0x94, 0x00, 0x02, 0x00, 0x09, 0x01, 0x06, 0x0d, 0x00, 0xf0, 0x0b, 0x01,
+    0x02, 0x0d, 0x00, 0x30, 0xc9, 0x00, 0x9d, 0xff, 0xe5, 0x00, 0x02, 0x00, 0x11, 0x02, 0x06, 0x0e,
+    0x00, 0xf0, 0x11, 0x02, 0x03, 0x0e, 0x00, 0x20, 0x33, 0x00, 0x49, 0xff, 0x81, 0x00, 0x03, 0x00,
+    0x03, 0x0e, 0x0c, 0x0a, 0x00, 0xf0, 0x03, 0x0e, 0x06, 0x05, 0x00, 0x20, 0x09, 0x13, 0x06, 0x05,
+    0x00, 0x20, 0xb4, 0xff, 0x8d, 0x00, 0x4c, 0xff, 0x02, 0x00, 0x07, 0x06, 0x0a, 0x06, 0x00, 0xf0,
+    0x07, 0x08, 0x0a, 0x02, 0x00, 0x30, 0xab, 0x00, 0x8e, 0xff, 0xb5, 0x00, 0x02, 0x00, 0x01, 0x02,
+    0x06, 0x0e, 0x00, 0xf0, 0x04, 0x02, 0x03, 0x0e, 0x00, 0x20, 0x2e, 0xff, 0xe9, 0xfe, 0x44, 0x00,
+    0x02, 0x00, 0x0a, 0x04, 0x05, 0x0c, 0x00, 0xf0, 0x0a, 0x08, 0x05, 0x04, 0x00, 0x30, 0xde, 0xfe,
+    0xd6, 0x00, 0x9e, 0xff, 0x02, 0x00, 0x00, 0x11, 0x18, 0x05, 0x00, 0xf0, 0x08, 0x11, 0x08, 0x05,
+    0x00, 0x30, 0x44, 0x00, 0xbf, 0xff, 0x42, 0x00, 0x02, 0x00, 0x0f, 0x07, 0x05, 0x0c, 0x00, 0xf0,
+    0x0f, 0x0b, 0x05, 0x04, 0x00, 0x30, 0xe7, 0xff, 0x50, 0x00, 0x6a, 0xff, 0x03, 0x00, 0x03, 0x01,
+    0x06, 0x0c, 0x00, 0xf0, 0x03, 0x01, 0x03, 0x06, 0x00, 0x20, 0x06, 0x07, 0x03, 0x06, 0x00, 0x20,
+    0x5f, 0xff, 0xf4, 0xfe, 0x2b, 0x00, 0x02, 0x00, 0x0c, 0x0d, 0x06, 0x06, 0x00, 0xf0, 0x0c, 0x10,
+    0x06, 0x03, 0x00, 0x20, 0x00, 0x00, 0x29, 0x00, 0x20, 0xff, 0x02, 0x00, 0x06, 0x0d, 0x06, 0x06,
+    0x00, 0xf0, 0x06, 0x10, 0x06, 0x03, 0x00, 0x20, 0xa5, 0xff, 0x50, 0xff, 0x3c, 0x00, 0x02, 0x00,
+    0x0e, 0x06, 0x03, 0x10, 0x00, 0xf0, 0x0e, 0x0e, 0x03, 0x08, 0x00, 0x20, 0x07, 0x00, 0x3f, 0x00,
+    0x70, 0xff, 0x02, 0x00, 0x01, 0x0c, 0x0d, 0x06, 0x00, 0xf0, 0x01, 0x0e, 0x0d, 0x02, 0x00, 0x30,
+    0x04, 0x00, 0x7f, 0xff, 0x62, 0x00, 0x02, 0x00, 0x0d, 0x01, 0x04, 0x09, 0x00, 0xf0, 0x0d, 0x01,
+    0x02, 0x09, 0x00, 0x20, 0xa0, 0x00, 0x0a, 0x00, 0x9d, 0xfe, 0x02, 0x00, 0x07, 0x00, 0x09, 0x06,
+    0x00, 0xf0, 0x0a, 0x00, 0x03, 0x06, 0x00, 0x30, 0xfe, 0x00, 0x24, 0x00, 0xef, 0xfe, 0x02, 0x00,
+    0x0c, 0x02, 0x06, 0x09, 0x00, 0xf0, 0x0c, 0x02, 0x03, 0x09, 0x00, 0x20, 0x08, 0x00, 0x1b, 0xff,
+    0x32, 0x00, 0x02, 0x00, 0x06, 0x02, 0x06, 0x09, 0x00, 0xf0, 0x09, 0x02, 0x03, 0x09, 0x00, 0x20,
+    0x03, 0x00, 0x8c, 0xff, 0x6f, 0x00, 0x02, 0x00, 0x06, 0x12, 0x0c, 0x06, 0x00, 0xf0, 0x06, 0x14,
+    0x0c, 0x02, 0x00, 0x30, 0xe4, 0xff, 0x56, 0x00, 0x8e, 0xff, 0x02, 0x00, 0x07, 0x06, 0x06, 0x09,
+    0x00, 0xf0, 0x09, 0x06, 0x02, 0x09, 0x00, 0x30, 0x9f, 0xff, 0x36, 0xff, 0x39, 0x00, 0x02, 0x00,
+    0x07, 0x07, 0x0c, 0x03, 0x00, 0xf0, 0x07, 0x07, 0x06, 0x03, 0x00, 0x20, 0x5c, 0xfe, 0xb8, 0xfd,
+    0xff, 0xff, 0x02, 0x00, 0x08, 0x03, 0x08, 0x15, 0x00, 0xf0, 0x08, 0x0a, 0x08, 0x07, 0x00, 0x30,
+    0xd9, 0xff, 0x64, 0x00, 0x7b, 0xff, 0x02, 0x00, 0x07, 0x04, 0x0a, 0x0c, 0x00, 0xf0, 0x07, 0x08,
+    0x0a, 0x04, 0x00, 0x30, 0xa3, 0x00, 0x08, 0x00, 0x7e, 0xfe, 0x02, 0x00, 0x00, 0x01, 0x06, 0x09,
+    0x00, 0xf0, 0x00, 0x04, 0x06, 0x03, 0x00, 0x30, 0xcb, 0xff, 0xeb, 0xfe, 0x2f, 0x00, 0x02, 0x00,
+    0x0f, 0x02, 0x02, 0x14, 0x00, 0xf0, 0x0f, 0x02, 0x01, 0x14, 0x00, 0x20, 0x31, 0xff, 0x1f, 0xfe,
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x06, 0x09, 0x00, 0xf0, 0x00, 0x06, 0x06, 0x03, 0x00, 0x30,
+    0x66, 0x00, 0x25, 0x00, 0xc8, 0xfd, 0x02, 0x00, 0x0f, 0x03, 0x02, 0x15, 0x00, 0xf0, 0x0f, 0x03,
+    0x01, 0x15, 0x00, 0x20, 0xe1, 0xff, 0xfc, 0xfe, 0x0f, 0x00, 0x02, 0x00, 0x07, 0x00, 0x02, 0x17,
+    0x00, 0xf0, 0x08, 0x00, 0x01, 0x17, 0x00, 0x20, 0xaf, 0x00, 0x27, 0x00, 0xd1, 0xfe, 0x02, 0x00,
+    0x0f, 0x08, 0x09, 0x04, 0x00, 0xf0, 0x0f, 0x0a, 0x09, 0x02, 0x00, 0x20, 0x00, 0x00, 0x3b, 0xff,
+    0x1f, 0x00, 0x02, 0x00, 0x00, 0x08, 0x09, 0x04, 0x00, 0xf0, 0x00, 0x0a, 0x09, 0x02, 0x00, 0x20,
+    0x25, 0x00, 0xe3, 0xff, 0xb5, 0x00, 0x02, 0x00, 0x08, 0x0e, 0x09, 0x06, 0x00, 0xf0, 0x08, 0x10,
+    0x09, 0x02, 0x00, 0x30, 0x2d, 0x00, 0x11, 0x00, 0xf3, 0xfe, 0x02, 0x00, 0x00, 0x0e, 0x09, 0x06,
+    0x00, 0xf0, 0x00, 0x10, 0x09, 0x02, 0x00, 0x30, 0x2a, 0xff, 0x3e, 0xfe, 0x31, 0x00, 0x02, 0x00,
+    0x03, 0x0a, 0x12, 0x04, 0x00, 0xf0, 0x09, 0x0a, 0x06, 0x04, 0x00, 0x30, 0x52, 0xfc, 0xf5, 0x00,
+    0xc0, 0xff, 0x02, 0x00, 0x00, 0x00, 0x18, 0x13, 0x00, 0xf0, 0x08, 0x00, 0x08, 0x13, 0x00, 0x30,
+    0xbd, 0xff, 0x77, 0x00, 0xca, 0xff, 0x02, 0x00, 0x09, 0x01, 0x08, 0x0c, 0x00, 0xf0, 0x09, 0x07,
+    0x08, 0x06, 0x00, 0x20, 0xba, 0xff, 0xb5, 0x00, 0xb9, 0xff, 0x02, 0x00, 0x0a, 0x06, 0x04, 0x0a,
+    0x00, 0xf0, 0x0c, 0x06, 0x02, 0x0a, 0x00, 0x20, 0x6a, 0xff, 0xe7, 0xfe, 0x3e, 0x00, 0x03, 0x00,
+    0x07, 0x09, 0x0a, 0x0c, 0x00, 0xf0, 0x0c, 0x09, 0x05, 0x06, 0x00, 0x20, 0x07, 0x0f, 0x05, 0x06,
+    0x00, 0x20, 0xd6, 0xff, 0xe9, 0xfe, 0x0e, 0x00, 0x02, 0x00, 0x05, 0x00, 0x03, 0x13, 0x00, 0xf0,
+    0x06, 0x00, 0x01, 0x13, 0x00, 0x30, 0xc8, 0xff, 0xbd, 0xff, 0x32, 0x00, 0x02, 0x00, 0x0e, 0x00,
+    0x06, 0x0a, 0x00, 0xf0, 0x10, 0x00, 0x02, 0x0a, 0x00, 0x30, 0x78, 0x00, 0xc8, 0xff, 0x0d, 0x01,
+    0x03, 0x00, 0x02, 0x00, 0x06, 0x0c, 0x00, 0xf0, 0x02, 0x00, 0x03, 0x06, 0x00, 0x20, 0x05, 0x06,
+    0x03, 0x06, 0x00, 0x20, 0x62, 0x00, 0x2f, 0x00, 0x48, 0xfe, 0x02, 0x00, 0x00, 0x0b, 0x18, 0x02,
+    0x00, 0xf0, 0x00, 0x0c, 0x18, 0x01, 0x00, 0x20, 0x19, 0x00, 0x13, 0xff, 0x0f, 0x00, 0x02, 0x00,
+    0x04, 0x09, 0x0d, 0x04, 0x00, 0xf0, 0x04, 0x0b, 0x0d, 0x02, 0x00, 0x20, 0xa5, 0xff, 0xf6, 0x01,
+    0x07, 0x00, 0x02, 0x00, 0x09, 0x08, 0x06, 0x09, 0x00, 0xf0, 0x09, 0x0b, 0x06, 0x03, 0x00, 0x30,
+    0xe4, 0xff, 0x36, 0x00, 0x85, 0xff, 0x02, 0x00, 0x00, 0x0c, 0x10, 0x04, 0x00, 0xf0, 0x00, 0x0e,
+    0x10, 0x02, 0x00, 0x20, 0x5a, 0xff, 0xd4, 0xfe, 0x29, 0x00, 0x02, 0x00, 0x12, 0x0c, 0x06, 0x09,
+    0x00, 0xf0, 0x12, 0x0f, 0x06, 0x03, 0x00, 0x30, 0x9c, 0xff, 0xe1, 0xfe, 0x0a, 0x00, 0x02, 0x00,
+    0x00, 0x0c, 0x06, 0x09, 0x00, 0xf0, 0x00, 0x0f, 0x06, 0x03, 0x00, 0x30, 0x0a, 0x00, 0xd5, 0xff,
+    0x52, 0x00, 0x02, 0x00, 0x08, 0x07, 0x0a, 0x04, 0x00, 0xf0, 0x08, 0x07, 0x05, 0x04, 0x00, 0x20,
+    0xb0, 0xff, 0xd3, 0x00, 0xbd, 0xff, 0x02, 0x00, 0x08, 0x07, 0x06, 0x09, 0x00, 0xf0, 0x0a, 0x07,
+    0x02, 0x09, 0x00, 0x30, 0x87, 0xff, 0xd9, 0xfe, 0x26, 0x00, 0x02, 0x00, 0x0b, 0x00, 0x06, 0x09,
+    0x00, 0xf0, 0x0d, 0x00, 0x02, 0x09, 0x00, 0x30, 0xc3, 0xff, 0xf4, 0xfe, 0x0a, 0x00, 0x02, 0x00,
+    0x07, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x09, 0x00, 0x02, 0x09, 0x00, 0x30, 0x08, 0xff, 0xe9, 0xfe,
+    0x27, 0x00, 0x02, 0x00, 0x0c, 0x03, 0x06, 0x0f, 0x00, 0xf0, 0x0e, 0x03, 0x02, 0x0f, 0x00, 0x30,
+    0xcc, 0xff, 0x6c, 0x00, 0x94, 0xff, 0x02, 0x00, 0x06, 0x03, 0x06, 0x0f, 0x00, 0xf0, 0x08, 0x03,
+    0x02, 0x0f, 0x00, 0x30, 0xae, 0xff, 0x15, 0xff, 0x2f, 0x00, 0x02, 0x00, 0x0f, 0x02, 0x09, 0x04,
+    0x00, 0xf0, 0x0f, 0x04, 0x09, 0x02, 0x00, 0x20, 0x83, 0xff, 0x68, 0xfe, 0x00, 0x00, 0x02, 0x00,
+    0x05, 0x0a, 0x06, 0x07, 0x00, 0xf0, 0x08, 0x0a, 0x03, 0x07, 0x00, 0x20, 0xac, 0xff, 0x57, 0xff,
+    0x4f, 0x00, 0x02, 0x00, 0x09, 0x0e, 0x06, 0x0a, 0x00, 0xf0, 0x09, 0x13, 0x06, 0x05, 0x00, 0x20,
+    0xf9, 0xff, 0x31, 0x00, 0x5a, 0xff, 0x02, 0x00, 0x07, 0x0d, 0x05, 0x08, 0x00, 0xf0, 0x07, 0x11,
+    0x05, 0x04, 0x00, 0x20, 0x80, 0xff, 0x5e, 0xff, 0x27, 0x00, 0x02, 0x00, 0x0e, 0x05, 0x03, 0x10,
+    0x00, 0xf0, 0x0e, 0x0d, 0x03, 0x08, 0x00, 0x20, 0x4d, 0x00, 0xd0, 0xff, 0x87, 0x01, 0x02, 0x00,
+    0x02, 0x11, 0x12, 0x03, 0x00, 0xf0, 0x02, 0x12, 0x12, 0x01, 0x00, 0x30, 0x19, 0x00, 0xe5, 0xff,
+    0xa6, 0x00, 0x02, 0x00, 0x05, 0x12, 0x13, 0x03, 0x00, 0xf0, 0x05, 0x13, 0x13, 0x01, 0x00, 0x30,
+    0xd7, 0xff, 0xec, 0xfe, 0x09, 0x00, 0x02, 0x00, 0x09, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x0b, 0x00,
+    0x02, 0x09, 0x00, 0x30, 0xfb, 0xff, 0x57, 0x00, 0xe7, 0xff, 0x02, 0x00, 0x0c, 0x04, 0x03, 0x12,
+    0x00, 0xf0, 0x0d, 0x04, 0x01, 0x12, 0x00, 0x30, 0xf0, 0xff, 0x79, 0x00, 0xa9, 0xff, 0x02, 0x00,
+    0x09, 0x04, 0x03, 0x12, 0x00, 0xf0, 0x0a, 0x04, 0x01, 0x12, 0x00, 0x30, 0x4c, 0xff, 0xf9, 0x00,
+    0xfc, 0xff, 0x02, 0x00, 0x03, 0x03, 0x12, 0x09, 0x00, 0xf0, 0x09, 0x03, 0x06, 0x09, 0x00, 0x30,
+    0x08, 0xff, 0xd4, 0xfd, 0xf9, 0xff, 0x02, 0x00, 0x06, 0x01, 0x06, 0x0e, 0x00, 0xf0, 0x08, 0x01,
+    0x02, 0x0e, 0x00, 0x30, 0x7a, 0xff, 0x5c, 0xff, 0x2a, 0x00, 0x02, 0x00, 0x0c, 0x10, 0x09, 0x06,
+    0x00, 0xf0, 0x0c, 0x13, 0x09, 0x03, 0x00, 0x20, 0xa5, 0xfd, 0x87, 0xfe, 0x00, 0x00, 0x03, 0x00,
+    0x01, 0x03, 0x14, 0x10, 0x00, 0xf0, 0x01, 0x03, 0x0a, 0x08, 0x00, 0x20, 0x0b, 0x0b, 0x0a, 0x08,
+    0x00, 0x20, 0xd0, 0xff, 0x6c, 0x00, 0xd3, 0xff, 0x03, 0x00, 0x0c, 0x05, 0x06, 0x0c, 0x00, 0xf0,
+    0x0f, 0x05, 0x03, 0x06, 0x00, 0x20, 0x0c, 0x0b, 0x03, 0x06, 0x00, 0x20, 0x52, 0x02, 0x06, 0x00,
+    0xb9, 0xfe, 0x03, 0x00, 0x01, 0x02, 0x16, 0x10, 0x00, 0xf0, 0x01, 0x02, 0x0b, 0x08, 0x00, 0x20,
+    0x0c, 0x0a, 0x0b, 0x08, 0x00, 0x20, 0xd2, 0x00, 0x28, 0x00, 0x7c, 0xfe, 0x02, 0x00, 0x0a, 0x0e,
+    0x05, 0x0a, 0x00, 0xf0, 0x0a, 0x13, 0x05, 0x05, 0x00, 0x20, 0x0c, 0x00, 0x99, 0xff, 0x53, 0x00,
+    0x02, 0x00, 0x03, 0x15, 0x12, 0x03, 0x00, 0xf0, 0x03, 0x16, 0x12, 0x01, 0x00, 0x30, 0x4e, 0xff,
+    0x02, 0xfe, 0x26, 0x00, 0x02, 0x00, 0x0a, 0x0e, 0x06, 0x0a, 0x00, 0xf0, 0x0c, 0x0e, 0x02, 0x0a,
+    0x00, 0x30, 0x29, 0xfc, 0x53, 0x00, 0x10, 0x02, 0x61, 0xff, 0x1c, 0x01, 0x02, 0x00, 0x00, 0x02,
+    0x18, 0x04, 0x00, 0xf0, 0x08, 0x02, 0x08, 0x04, 0x00, 0x30, 0x8b, 0xfe, 0x03, 0x01, 0x63, 0xff,
+    0x02, 0x00, 0x06, 0x04, 0x0c, 0x09, 0x00, 0xf0, 0x06, 0x07, 0x0c, 0x03, 0x00, 0x30, 0x3a, 0x00,
+    0xfa, 0xfe, 0x65, 0x00, 0x02, 0x00, 0x06, 0x06, 0x0c, 0x05, 0x00, 0xf0, 0x0a, 0x06, 0x04, 0x05,
+    0x00, 0x30, 0x86, 0x00, 0xdd, 0xfe, 0x49, 0x00, 0x02, 0x00, 0x05, 0x08, 0x0e, 0x0c, 0x00, 0xf0,
+    0x05, 0x0c, 0x0e, 0x04, 0x00, 0x30, 0x33, 0x00, 0x6f, 0xff, 0x73, 0x00, 0x03, 0x00, 0x04, 0x0e,
+    0x08, 0x0a, 0x00, 0xf0, 0x04, 0x0e, 0x04, 0x05, 0x00, 0x20, 0x08, 0x13, 0x04, 0x05, 0x00, 0x20,
+    0x3c, 0x00, 0x4e, 0x00, 0x52, 0xff, 0x02, 0x00, 0x0b, 0x06, 0x05, 0x0e, 0x00, 0xf0, 0x0b, 0x0d,
+    0x05, 0x07, 0x00, 0x20, 0x77, 0xff, 0x48, 0xfe, 0x0f, 0x00, 0x02, 0x00, 0x07, 0x06, 0x03, 0x10,
+    0x00, 0xf0, 0x07, 0x0e, 0x03, 0x08, 0x00, 0x20, 0x47, 0x02, 0x3b, 0x00, 0x46, 0xfe, 0x02, 0x00,
+    0x03, 0x07, 0x12, 0x08, 0x00, 0xf0, 0x09, 0x07, 0x06, 0x08, 0x00, 0x30, 0xe7, 0xff, 0xc9, 0xfe,
+    0x1f, 0x00, 0x02, 0x00, 0x02, 0x03, 0x14, 0x02, 0x00, 0xf0, 0x02, 0x04, 0x14, 0x01, 0x00, 0x20,
+    0x4a, 0x00, 0x53, 0x00, 0x31, 0xff, 0x02, 0x00, 0x03, 0x0c, 0x13, 0x06, 0x00, 0xf0, 0x03, 0x0e,
+    0x13, 0x02, 0x00, 0x30, 0x66, 0x00, 0xaf, 0xff, 0xac, 0x00, 0x02, 0x00, 0x08, 0x06, 0x06, 0x09,
+    0x00, 0xf0, 0x0a, 0x06, 0x02, 0x09, 0x00, 0x30, 0xbe, 0x00, 0xe4, 0xff, 0xd7, 0x00, 0x02, 0x00,
+    0x10, 0x06, 0x06, 0x0e, 0x00, 0xf0, 0x10, 0x06, 0x03, 0x0e, 0x00, 0x20, 0xdc, 0xff, 0x65, 0x00,
+    0x87, 0xff, 0x02, 0x00, 0x07, 0x09, 0x06, 0x0c, 0x00, 0xf0, 0x09, 0x09, 0x02, 0x0c, 0x00, 0x30,
+    0xa7, 0x00, 0x00, 0x00, 0xf2, 0x00, 0x03, 0x00, 0x12, 0x06, 0x06, 0x12, 0x00, 0xf0, 0x15, 0x06,
+    0x03, 0x09, 0x00, 0x20, 0x12, 0x0f, 0x03, 0x09, 0x00, 0x20, 0x74, 0xff, 0xc0, 0x00, 0xb0, 0xff,
+    0x03, 0x00, 0x00, 0x06, 0x06, 0x12, 0x00, 0xf0, 0x00, 0x06, 0x03, 0x09, 0x00, 0x20, 0x03, 0x0f,
+    0x03, 0x09, 0x00, 0x20, 0x5e, 0xff, 0x2c, 0xff, 0x2d, 0x00, 0x02, 0x00, 0x12, 0x02, 0x06, 0x09,
+    0x00, 0xf0, 0x12, 0x05, 0x06, 0x03, 0x00, 0x30, 0x0a, 0x00, 0x68, 0xff, 0x3f, 0x00, 0x02, 0x00,
+    0x03, 0x12, 0x0f, 0x06, 0x00, 0xf0, 0x03, 0x14, 0x0f, 0x02, 0x00, 0x30, 0x70, 0x00, 0x28, 0x00,
+    0x93, 0xff, 0x02, 0x00, 0x12, 0x02, 0x06, 0x09, 0x00, 0xf0, 0x12, 0x05, 0x06, 0x03, 0x00, 0x30,
+    0x8f, 0x00, 0x08, 0x00, 0x67, 0xfe, 0x02, 0x00, 0x00, 0x02, 0x06, 0x09, 0x00, 0xf0, 0x00, 0x05,
+    0x06, 0x03, 0x00, 0x30, 0x12, 0x00, 0x7b, 0xff, 0x60, 0x00, 0x02, 0x00, 0x05, 0x0a, 0x12, 0x02,
+    0x00, 0xf0, 0x05, 0x0b, 0x12, 0x01, 0x00, 0x20, 0x0b, 0x00, 0x78, 0xff, 0x3f, 0x00, 0x02, 0x00,
+    0x06, 0x00, 0x0c, 0x06, 0x00, 0xf0, 0x06, 0x02, 0x0c, 0x02, 0x00, 0x30, 0x90, 0x00, 0x33, 0x00,
+    0x8f, 0xfe, 0x02, 0x00, 0x0a, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x0c, 0x00, 0x02, 0x09, 0x00, 0x30,
+    0x6a, 0x00, 0x0b, 0x00, 0xa4, 0xfe, 0x02, 0x00, 0x08, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x0a, 0x00,
+    0x02, 0x09, 0x00, 0x30, 0xc0, 0xff, 0x17, 0xff, 0x45, 0x00, 0x02, 0x00, 0x0f, 0x0c, 0x09, 0x06,
+    0x00, 0xf0, 0x0f, 0x0e, 0x09, 0x02, 0x00, 0x30, 0xe1, 0xff, 0x17, 0x00, 0x30, 0xff, 0x02, 0x00,
+    0x03, 0x06, 0x0d, 0x06, 0x00, 0xf0, 0x03, 0x08, 0x0d, 0x02, 0x00, 0x30, 0x55, 0x00, 0x36, 0x00,
+    0x41, 0xff, 0x02, 0x00, 0x0f, 0x0c, 0x09, 0x06, 0x00, 0xf0, 0x0f, 0x0e, 0x09, 0x02, 0x00, 0x30,
+    0xf5, 0x00, 0xbb, 0xff, 0xcf, 0x00, 0x02, 0x00, 0x02, 0x05, 0x06, 0x0f, 0x00, 0xf0, 0x05, 0x05,
+    0x03, 0x0f, 0x00, 0x20, 0x9f, 0x00, 0xe6, 0xff, 0xdc, 0x00, 0x02, 0x00, 0x08, 0x08, 0x09, 0x06,
+    0x00, 0xf0, 0x0b, 0x08, 0x03, 0x06, 0x00, 0x30, 0x58, 0x00, 0x10, 0x00, 0x03, 0xff, 0x02, 0x00,
+    0x08, 0x06, 0x03, 0x0e, 0x00, 0xf0, 0x08, 0x0d, 0x03, 0x07, 0x00, 0x20, 0x90, 0xff, 0x13, 0xff,
+    0x27, 0x00, 0x02, 0x00, 0x0f, 0x0c, 0x09, 0x06, 0x00, 0xf0, 0x0f, 0x0e, 0x09, 0x02, 0x00, 0x30,
+    0x2a, 0x00, 0x22, 0x00, 0x4c, 0xff, 0x02, 0x00, 0x04, 0x0c, 0x0a, 0x04, 0x00, 0xf0, 0x09, 0x0c,
+    0x05, 0x04, 0x00, 0x20, 0x65, 0x00, 0x32, 0x00, 0x99, 0xff, 0x02, 0x00, 0x0d, 0x01, 0x04, 0x13,
+    0x00, 0xf0, 0x0d, 0x01, 0x02, 0x13, 0x00, 0x20, 0xbf, 0xff, 0xdc, 0xfe, 0x12, 0x00, 0x02, 0x00,
+    0x07, 0x01, 0x04, 0x13, 0x00, 0xf0, 0x09, 0x01, 0x02, 0x13, 0x00, 0x20, 0xc7, 0x00, 0x2b, 0x00,
+    0x48, 0xff, 0x02, 0x00, 0x12, 0x09, 0x06, 0x09, 0x00, 0xf0, 0x12, 0x0c, 0x06, 0x03, 0x00, 0x30,
+    0x05, 0x00, 0x87, 0xff, 0x43, 0x00, 0x02, 0x00, 0x01, 0x15, 0x12, 0x03, 0x00, 0xf0, 0x01, 0x16,
+    0x12, 0x01, 0x00, 0x30, 0x98, 0xfe, 0xd7, 0xfd, 0x25, 0x00, 0x02, 0x00, 0x0e, 0x0d, 0x0a, 0x09,
+    0x00, 0xf0, 0x0e, 0x10, 0x0a, 0x03, 0x00, 0x30, 0x4b, 0x00, 0x0b, 0x00, 0xed, 0xfe, 0x03, 0x00,
+    0x01, 0x0d, 0x16, 0x04, 0x00, 0xf0, 0x01, 0x0d, 0x0b, 0x02, 0x00, 0x20, 0x0c, 0x0f, 0x0b, 0x02,
+    0x00, 0x20, 0x90, 0x00, 0xf8, 0xff, 0x37, 0x01, 0x03, 0x00, 0x04, 0x06, 0x10, 0x06, 0x00, 0xf0,
+    0x0c, 0x06, 0x08, 0x03, 0x00, 0x20, 0x04, 0x09, 0x08, 0x03, 0x00, 0x20, 0xbd, 0xfc, 0xaf, 0xfe,
+    0x03, 0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x16, 0x00, 0xf0, 0x01, 0x00, 0x09, 0x0b, 0x00, 0x20,
+    0x0a, 0x0b, 0x09, 0x0b, 0x00, 0x20, 0xbc, 0xff, 0x5e, 0x00, 0xd9, 0xff, 0x03, 0x00, 0x0a, 0x07,
+    0x08, 0x0e, 0x00, 0xf0, 0x0e, 0x07, 0x04, 0x07, 0x00, 0x20, 0x0a, 0x0e, 0x04, 0x07, 0x00, 0x20,
+    0x9a, 0x00, 0xbf, 0xff, 0xb4, 0x00, 0x03, 0x00, 0x00, 0x04, 0x06, 0x14, 0x00, 0xf0, 0x00, 0x04,
+    0x03, 0x0a, 0x00, 0x20, 0x03, 0x0e, 0x03, 0x0a, 0x00, 0x20, 0x09, 0x00, 0xed, 0xff, 0x55, 0x00,
+    0x02, 0x00, 0x0f, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x11, 0x00, 0x02, 0x09, 0x00, 0x30, 0xc4, 0xff,
+    0x37, 0xff, 0x13, 0x00, 0x02, 0x00, 0x03, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x05, 0x00, 0x02, 0x09,
+    0x00, 0x30, 0x3b, 0xff, 0xb3, 0x01, 0x0c, 0x00, 0x03, 0x00, 0x0f, 0x0c, 0x06, 0x0c, 0x00, 0xf0,
+    0x12, 0x0c, 0x03, 0x06, 0x00, 0x20, 0x0f, 0x12, 0x03, 0x06, 0x00, 0x20, 0x88, 0xff, 0xc6, 0x00,
+    0xc2, 0xff, 0x03, 0x00, 0x03, 0x0c, 0x06, 0x0c, 0x00, 0xf0, 0x03, 0x0c, 0x03, 0x06, 0x00, 0x20,
+    0x06, 0x12, 0x03, 0x06, 0x00, 0x20, 0x43, 0xff, 0x82, 0xfe, 0x1f, 0x00, 0x02, 0x00, 0x0f, 0x0c,
+    0x09, 0x06, 0x00, 0xf0, 0x0f, 0x0e, 0x09, 0x02, 0x00, 0x30, 0x8e, 0xff, 0xde, 0xfd, 0xfa, 0xff,
+    0x02, 0x00, 0x00, 0x0c, 0x09, 0x06, 0x00, 0xf0, 0x00, 0x0e, 0x09, 0x02, 0x00, 0x30, 0xe9, 0xff,
+    0x91, 0x00, 0xe2, 0xff, 0x02, 0x00, 0x04, 0x0e, 0x13, 0x03, 0x00, 0xf0, 0x04, 0x0f, 0x13, 0x01,
+    0x00, 0x30, 0xd7, 0xff, 0xad, 0x00, 0xbc, 0xff, 0x02, 0x00, 0x02, 0x0d, 0x13, 0x03, 0x00, 0xf0,
+    0x02, 0x0e, 0x13, 0x01, 0x00, 0x30, 0x2e, 0x00, 0x3f, 0x00, 0x5b, 0xff, 0x02, 0x00, 0x0e, 0x0f,
+    0x0a, 0x06, 0x00, 0xf0, 0x0e, 0x11, 0x0a, 0x02, 0x00, 0x30, 0xd4, 0x00, 0x03, 0x00, 0xc3, 0xfe,
+    0x03, 0x00, 0x06, 0x00, 0x0a, 0x0c, 0x00, 0xf0, 0x06, 0x00, 0x05, 0x06, 0x00, 0x20, 0x0b, 0x06,
+    0x05, 0x06, 0x00, 0x20, 0x88, 0x00, 0xfe, 0xff, 0x04, 0x01, 0x03, 0x00, 0x11, 0x01, 0x06, 0x0c,
+    0x00, 0xf0, 0x14, 0x01, 0x03, 0x06, 0x00, 0x20, 0x11, 0x07, 0x03, 0x06, 0x00, 0x20, 0xc5, 0xff,
+    0x73, 0x00, 0xa4, 0xff, 0x03, 0x00, 0x01, 0x01, 0x06, 0x0c, 0x00, 0xf0, 0x01, 0x01, 0x03, 0x06,
+    0x00, 0x20, 0x04, 0x07, 0x03, 0x06, 0x00, 0x20, 0x74, 0xff, 0x0d, 0xff, 0x34, 0x00, 0x02, 0x00,
+    0x10, 0x0e, 0x06, 0x09, 0x00, 0xf0, 0x10, 0x11, 0x06, 0x03, 0x00, 0x30, 0xb6, 0xfe, 0xfd, 0xfd,
+    0xfb, 0xff, 0x02, 0x00, 0x07, 0x03, 0x09, 0x0c, 0x00, 0xf0, 0x07, 0x09, 0x09, 0x06, 0x00, 0x20,
+    0xfd, 0xff, 0x65, 0x00, 0xb5, 0xff, 0x02, 0x00, 0x0c, 0x01, 0x04, 0x0c, 0x00, 0xf0, 0x0c, 0x07,
+    0x04, 0x06, 0x00, 0x20, 0x8d, 0x01, 0xc1, 0xff, 0x15, 0x01, 0x02, 0x00, 0x04, 0x00, 0x0e, 0x08,
+    0x00, 0xf0, 0x04, 0x04, 0x0e, 0x04, 0x00, 0x20, 0x95, 0x00, 0xf2, 0xff, 0x37, 0x01, 0x02, 0x00,
+    0x0a, 0x06, 0x06, 0x09, 0x00, 0xf0, 0x0c, 0x06, 0x02, 0x09, 0x00, 0x30, 0xd3, 0x00, 0x0b, 0x00,
+    0xf0, 0xfe, 0x02, 0x00, 0x02, 0x0a, 0x12, 0x03, 0x00, 0xf0, 0x08, 0x0a, 0x06, 0x03, 0x00, 0x30,
+    0x9c, 0xff, 0x83, 0xff, 0x2b, 0x00, 0x02, 0x00, 0x0f, 0x0f, 0x09, 0x06, 0x00, 0xf0, 0x0f, 0x11,
+    0x09, 0x02, 0x00, 0x30, 0x3c, 0x05, 0xb4, 0xff, 0x84, 0x00, 0x02, 0x00, 0x00, 0x01, 0x15, 0x17,
+    0x00, 0xf0, 0x07, 0x01, 0x07, 0x17, 0x00, 0x30, 0x1f, 0x00, 0x67, 0xff, 0x3f, 0x00, 0x02, 0x00,
+    0x06, 0x09, 0x11, 0x04, 0x00, 0xf0, 0x06, 0x0b, 0x11, 0x02, 0x00, 0x20, 0x96, 0x02, 0xf9, 0xff,
+    0xb0, 0xfd, 0x02, 0x00, 0x01, 0x00, 0x0b, 0x12, 0x00, 0xf0, 0x01, 0x06, 0x0b, 0x06, 0x00, 0x30,
+    0xed, 0xff, 0x5f, 0x00, 0xad, 0xff, 0x02, 0x00, 0x06, 0x0f, 0x0d, 0x06, 0x00, 0xf0, 0x06, 0x11,
+    0x0d, 0x02, 0x00, 0x30, 0xb5, 0xff, 0x01, 0xff, 0x12, 0x00, 0x02, 0x00, 0x00, 0x0f, 0x09, 0x06,
+    0x00, 0xf0, 0x00, 0x11, 0x09, 0x02, 0x00, 0x30, 0x3e, 0x01, 0x24, 0x00, 0x47, 0xfe, 0x02, 0x00,
+    0x08, 0x07, 0x0f, 0x04, 0x00, 0xf0, 0x0d, 0x07, 0x05, 0x04, 0x00, 0x30, 0x4d, 0x00, 0xca, 0xff,
+    0x04, 0x01, 0x02, 0x00, 0x09, 0x0c, 0x06, 0x09, 0x00, 0xf0, 0x09, 0x0f, 0x06, 0x03, 0x00, 0x30,
+    0xbb, 0xfe, 0xaf, 0xfe, 0x26, 0x00, 0x02, 0x00, 0x06, 0x08, 0x12, 0x03, 0x00, 0xf0, 0x0c, 0x08,
+    0x06, 0x03, 0x00, 0x30, 0xea, 0xfe, 0x7e, 0x00, 0xb6, 0xff, 0x02, 0x00, 0x00, 0x0e, 0x18, 0x04,
+    0x00, 0xf0, 0x08, 0x0e, 0x08, 0x04, 0x00, 0x30, 0xe8, 0xff, 0x6c, 0x00, 0xaa, 0xff, 0x02, 0x00,
+    0x10, 0x0a, 0x03, 0x0c, 0x00, 0xf0, 0x10, 0x10, 0x03, 0x06, 0x00, 0x20, 0x82, 0x00, 0xf9, 0xff,
+    0xa8, 0xfd, 0x02, 0x00, 0x00, 0x03, 0x18, 0x03, 0x00, 0xf0, 0x00, 0x04, 0x18, 0x01, 0x00, 0x30,
+    0x86, 0xff, 0x36, 0xff, 0x27, 0x00, 0x02, 0x00, 0x0e, 0x11, 0x0a, 0x06, 0x00, 0xf0, 0x0e, 0x13,
+    0x0a, 0x02, 0x00, 0x30, 0xb7, 0xfe, 0xc0, 0xfd, 0xf9, 0xff, 0x02, 0x00, 0x01, 0x0d, 0x12, 0x03,
+    0x00, 0xf0, 0x07, 0x0d, 0x06, 0x03, 0x00, 0x30, 0x0f, 0x00, 0xbf, 0xff, 0x3c, 0x00, 0x02, 0x00,
+    0x05, 0x00, 0x12, 0x09, 0x00, 0xf0, 0x05, 0x03, 0x12, 0x03, 0x00, 0x30, 0x89, 0x00, 0xc7, 0xff,
+    0xec, 0x00, 0x02, 0x00, 0x04, 0x03, 0x10, 0x09, 0x00, 0xf0, 0x04, 0x06, 0x10, 0x03, 0x00, 0x30,
+    0x21, 0x00, 0xb7, 0xff, 0x4f, 0x00, 0x02, 0x00, 0x10, 0x05, 0x03, 0x0c, 0x00, 0xf0, 0x10, 0x0b,
+    0x03, 0x06, 0x00, 0x20, 0x9d, 0x01, 0xf8, 0xff, 0x4b, 0xfd, 0x02, 0x00, 0x00, 0x07, 0x12, 0x04,
+    0x00, 0xf0, 0x06, 0x07, 0x06, 0x04, 0x00, 0x30, 0xd8, 0xff, 0x98, 0x00, 0xf8, 0xff, 0x02, 0x00,
+    0x0a, 0x06, 0x06, 0x09, 0x00, 0xf0, 0x0c, 0x06, 0x02, 0x09, 0x00, 0x30, 0x1d, 0x00, 0x86, 0xff,
+    0x3a, 0x00, 0x02, 0x00, 0x09, 0x08, 0x06, 0x0a, 0x00, 0xf0, 0x0b, 0x08, 0x02, 0x0a, 0x00, 0x30,
+    0x66, 0x00, 0x3a, 0x00, 0xf5, 0xfe, 0x02, 0x00, 0x09, 0x0f, 0x06, 0x09, 0x00, 0xf0, 0x0b, 0x0f,
+    0x02, 0x09, 0x00, 0x30, 0x77, 0x04, 0xbe, 0xff, 0xc4, 0x00, 0x02, 0x00, 0x03, 0x01, 0x12, 0x15,
+    0x00, 0xf0, 0x0c, 0x01, 0x09, 0x15, 0x00, 0x20, 0x4b, 0xff, 0x67, 0xff, 0x47, 0x00, 0x02, 0x00,
+    0x06, 0x08, 0x0c, 0x07, 0x00, 0xf0, 0x06, 0x08, 0x06, 0x07, 0x00, 0x20, 0xc7, 0xff, 0xb5, 0x00,
+    0xbf, 0xff, 0x02, 0x00, 0x08, 0x05, 0x06, 0x09, 0x00, 0xf0, 0x0a, 0x05, 0x02, 0x09, 0x00, 0x30,
+    0x5b, 0xfc, 0x5b, 0x00, 0x34, 0x02, 0x71, 0xff, 0x18, 0x01, 0x02, 0x00, 0x00, 0x02, 0x18, 0x04,
+    0x00, 0xf0, 0x08, 0x02, 0x08, 0x04, 0x00, 0x30, 0x8d, 0x00, 0x4a, 0xff, 0x87, 0x00, 0x02, 0x00,
+    0x0e, 0x07, 0x05, 0x0c, 0x00, 0xf0, 0x0e, 0x0b, 0x05, 0x04, 0x00, 0x30, 0x4c, 0x00, 0xe3, 0xfe,
+    0x67, 0x00, 0x02, 0x00, 0x05, 0x07, 0x05, 0x0c, 0x00, 0xf0, 0x05, 0x0b, 0x05, 0x04, 0x00, 0x30,
+    0x66, 0x00, 0x98, 0xff, 0xbd, 0x00, 0x02, 0x00, 0x09, 0x06, 0x06, 0x09, 0x00, 0xf0, 0x0b, 0x06,
+    0x02, 0x09, 0x00, 0x30, 0xea, 0x00, 0x9f, 0xff, 0xbc, 0x00, 0x02, 0x00, 0x00, 0x01, 0x06, 0x11,
+    0x00, 0xf0, 0x03, 0x01, 0x03, 0x11, 0x00, 0x20, 0x3d, 0x00, 0x4d, 0xff, 0x61, 0x00, 0x02, 0x00,
+    0x03, 0x01, 0x13, 0x09, 0x00, 0xf0, 0x03, 0x04, 0x13, 0x03, 0x00, 0x30, 0x24, 0x00, 0x75, 0xff,
+    0x5d, 0x00, 0x03, 0x00, 0x03, 0x12, 0x0c, 0x06, 0x00, 0xf0, 0x03, 0x12, 0x06, 0x03, 0x00, 0x20,
+    0x09, 0x15, 0x06, 0x03, 0x00, 0x20, 0x7c, 0x00, 0xe7, 0xff, 0xcb, 0x00, 0x02, 0x00, 0x14, 0x04,
+    0x04, 0x13, 0x00, 0xf0, 0x14, 0x04, 0x02, 0x13, 0x00, 0x20, 0x4c, 0xff, 0xd8, 0x00, 0xac, 0xff,
+    0x02, 0x00, 0x00, 0x10, 0x0a, 0x07, 0x00, 0xf0, 0x05, 0x10, 0x05, 0x07, 0x00, 0x20, 0x4b, 0x00,
+    0x43, 0x00, 0x09, 0xff, 0x03, 0x00, 0x08, 0x07, 0x0a, 0x0c, 0x00, 0xf0, 0x0d, 0x07, 0x05, 0x06,
+    0x00, 0x20, 0x08, 0x0d, 0x05, 0x06, 0x00, 0x20, 0x2b, 0x00, 0x27, 0x00, 0xf1, 0xfe, 0x03, 0x00,
+    0x06, 0x07, 0x0a, 0x0c, 0x00, 0xf0, 0x06, 0x07, 0x05, 0x06, 0x00, 0x20, 0x0b, 0x0d, 0x05, 0x06,
+    0x00, 0x20, 0x44, 0xff, 0x03, 0xfe, 0x22, 0x00, 0x02, 0x00, 0x09, 0x02, 0x09, 0x06, 0x00, 0xf0,
+    0x0c, 0x02, 0x03, 0x06, 0x00, 0x30, 0x53, 0x01, 0xae, 0xff, 0x9a, 0x00, 0x02, 0x00, 0x01, 0x14,
+    0x15, 0x04, 0x00, 0xf0, 0x08, 0x14, 0x07, 0x04, 0x00, 0x30, 0xdc, 0xff, 0x98, 0x00, 0xca, 0xff,
+    0x02, 0x00, 0x09, 0x0c, 0x09, 0x06, 0x00, 0xf0, 0x09, 0x0e, 0x09, 0x02, 0x00, 0x30, 0xaf, 0x00,
+    0x05, 0x00, 0x89, 0xfe, 0x02, 0x00, 0x07, 0x02, 0x09, 0x06, 0x00, 0xf0, 0x0a, 0x02, 0x03, 0x06,
+    0x00, 0x30, 0xdd, 0xff, 0x90, 0xff, 0x34, 0x00, 0x02, 0x00, 0x0d, 0x00, 0x04, 0x0e, 0x00, 0xf0,
+    0x0d, 0x00, 0x02, 0x0e, 0x00, 0x20, 0xef, 0xff, 0x1c, 0xff, 0x1a, 0x00, 0x02, 0x00, 0x07, 0x00,
+    0x04, 0x0e, 0x00, 0xf0, 0x09, 0x00, 0x02, 0x0e, 0x00, 0x20, 0x21, 0x00, 0x36, 0x00, 0x9a, 0xff,
+    0x02, 0x00, 0x0e, 0x0f, 0x09, 0x06, 0x00, 0xf0, 0x0e, 0x11, 0x09, 0x02, 0x00, 0x30, 0x8c, 0x01,
+    0x03, 0x00, 0x65, 0xfe, 0x02, 0x00, 0x02, 0x08, 0x12, 0x05, 0x00, 0xf0, 0x08, 0x08, 0x06, 0x05,
+    0x00, 0x30, 0x83, 0xff, 0x01, 0x01, 0xde, 0xff, 0x02, 0x00, 0x12, 0x03, 0x06, 0x0b, 0x00, 0xf0,
+    0x14, 0x03, 0x02, 0x0b, 0x00, 0x30, 0x07, 0xff, 0x88, 0xfe, 0x02, 0x00, 0x02, 0x00, 0x06, 0x05,
+    0x0b, 0x0e, 0x00, 0xf0, 0x06, 0x0c, 0x0b, 0x07, 0x00, 0x20, 0x64, 0xff, 0x30, 0xff, 0x42, 0x00,
+    0x02, 0x00, 0x12, 0x04, 0x06, 0x09, 0x00, 0xf0, 0x12, 0x07, 0x06, 0x03, 0x00, 0x30, 0xd9, 0xff,
+    0x1d, 0x00, 0x49, 0xff, 0x02, 0x00, 0x07, 0x06, 0x09, 0x06, 0x00, 0xf0, 0x07, 0x08, 0x09, 0x02,
+    0x00, 0x30, 0xc8, 0x00, 0x21, 0x00, 0x5b, 0xfe, 0x02, 0x00, 0x12, 0x04, 0x06, 0x09, 0x00, 0xf0,
+    0x12, 0x07, 0x06, 0x03, 0x00, 0x30, 0x56, 0xff, 0xd3, 0xfe, 0x06, 0x00, 0x02, 0x00, 0x00, 0x04,
+    0x06, 0x09, 0x00, 0xf0, 0x00, 0x07, 0x06, 0x03, 0x00, 0x30, 0xae, 0xff, 0xa1, 0x00, 0xe6, 0xff,
+    0x02, 0x00, 0x09, 0x04, 0x09, 0x04, 0x00, 0xf0, 0x09, 0x06, 0x09, 0x02, 0x00, 0x20, 0xfc, 0xff,
+    0x2f, 0x00, 0x77, 0xff, 0x02, 0x00, 0x00, 0x16, 0x13, 0x02, 0x00, 0xf0, 0x00, 0x17, 0x13, 0x01,
+    0x00, 0x20, 0x77, 0xff, 0x12, 0xff, 0x33, 0x00, 0x02, 0x00, 0x11, 0x0e, 0x06, 0x09, 0x00, 0xf0,
+    0x11, 0x11, 0x06, 0x03, 0x00, 0x30, 0x4f, 0x00, 0x09, 0x00, 0xfe, 0xfe, 0x02, 0x00, 0x01, 0x0e,
+    0x06, 0x09, 0x00, 0xf0, 0x01, 0x11, 0x06, 0x03, 0x00, 0x30, 0xff, 0xff, 0x5d, 0x00, 0xba, 0xff,
+    0x02, 0x00, 0x0e, 0x0b, 0x04, 0x09, 0x00, 0xf0, 0x0e, 0x0b, 0x02, 0x09, 0x00, 0x20, 0xff, 0xff,
+    0x32, 0x00, 0x78, 0xff, 0x02, 0x00, 0x06, 0x0b, 0x04, 0x09, 0x00, 0xf0, 0x08, 0x0b, 0x02, 0x09,
+    0x00, 0x20, 0x82, 0xfe, 0x53, 0xfe, 0x35, 0x00, 0x02, 0x00, 0x03, 0x09, 0x12, 0x07, 0x00, 0xf0,
+    0x09, 0x09, 0x06, 0x07, 0x00, 0x30, 0xc2, 0xfe, 0xed, 0xfc, 0xf7, 0xff, 0x02, 0x00, 0x09, 0x0c,
+    0x06, 0x0a, 0x00, 0xf0, 0x09, 0x11, 0x06, 0x05, 0x00, 0x20, 0x45, 0x00, 0x36, 0x00, 0x4a, 0xff,
+    0x02, 0x00, 0x0c, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x0e, 0x00, 0x02, 0x09, 0x00, 0x30, 0xa9, 0xff,
+    0xdb, 0xfe, 0x04, 0x00, 0x02, 0x00, 0x06, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x08, 0x00, 0x02, 0x09,
+    0x00, 0x30, 0xcc, 0xff, 0xd6, 0x00, 0xf0, 0xff, 0x02, 0x00, 0x06, 0x11, 0x12, 0x03, 0x00, 0xf0,
+    0x06, 0x12, 0x12, 0x01, 0x00, 0x30, 0x20, 0x00, 0xb9, 0xff, 0xcb, 0x00, 0x02, 0x00, 0x01, 0x11,
+    0x12, 0x03, 0x00, 0xf0, 0x01, 0x12, 0x12, 0x01, 0x00, 0x30, 0xa5, 0x01, 0x2d, 0x00, 0x51, 0xff,
+    0x02, 0x00, 0x0a, 0x06, 0x0b, 0x0c, 0x00, 0xf0, 0x0a, 0x0c, 0x0b, 0x06, 0x00, 0x20, 0x67, 0xff,
+    0xf6, 0x00, 0xc9, 0xff, 0x03, 0x00, 0x05, 0x06, 0x0e, 0x06, 0x00, 0xf0, 0x05, 0x06, 0x07, 0x03,
+    0x00, 0x20, 0x0c, 0x09, 0x07, 0x03, 0x00, 0x20, 0x68, 0x00, 0x02, 0x00, 0x3f, 0x01, 0x02, 0x00,
+    0x05, 0x04, 0x0f, 0x04, 0x00, 0xf0, 0x05, 0x06, 0x0f, 0x02, 0x00, 0x20, 0x02, 0x00, 0x78, 0xff,
+    0x25, 0x00, 0x02, 0x00, 0x00, 0x00, 0x16, 0x02, 0x00, 0xf0, 0x00, 0x01, 0x16, 0x01, 0x00, 0x20,
+    0x62, 0xfb, 0xd2, 0x00, 0xfd, 0xff, 0x02, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0xf0, 0x08, 0x00,
+    0x08, 0x18, 0x00, 0x30, 0x75, 0x01, 0xce, 0xff, 0x14, 0x01, 0x02, 0x00, 0x01, 0x0f, 0x12, 0x04,
+    0x00, 0xf0, 0x0a, 0x0f, 0x09, 0x04, 0x00, 0x20, 0xed, 0x01, 0xfa, 0xff, 0x23, 0x01, 0x02, 0x00,
+    0x06, 0x08, 0x0c, 0x09, 0x00, 0xf0, 0x06, 0x0b, 0x0c, 0x03, 0x00, 0x30, 0xd2, 0xfe, 0xa5, 0xfe,
+    0xff, 0xff, 0x02, 0x00, 0x04, 0x0c, 0x07, 0x0c, 0x00, 0xf0, 0x04, 0x10, 0x07, 0x04, 0x00, 0x30,
+    0x79, 0xff, 0x5b, 0xff, 0x3d, 0x00, 0x03, 0x00, 0x01, 0x02, 0x16, 0x06, 0x00, 0xf0, 0x0c, 0x02,
+    0x0b, 0x03, 0x00, 0x20, 0x01, 0x05, 0x0b, 0x03, 0x00, 0x20, 0x4d, 0xff, 0xd7, 0x00, 0xcc, 0xff,
+    0x02, 0x00, 0x05, 0x14, 0x0e, 0x03, 0x00, 0xf0, 0x0c, 0x14, 0x07, 0x03, 0x00, 0x20, 0xe5, 0x02,
+    0x31, 0x00, 0xc8, 0xfe, 0x03, 0x00, 0x00, 0x00, 0x18, 0x10, 0x00, 0xf0, 0x0c, 0x00, 0x0c, 0x08,
+    0x00, 0x20, 0x00, 0x08, 0x0c, 0x08, 0x00, 0x20, 0xd0, 0xff, 0x46, 0xff, 0x0d, 0x00, 0x03, 0x00,
+    0x03, 0x0d, 0x12, 0x04, 0x00, 0xf0, 0x03, 0x0d, 0x09, 0x02, 0x00, 0x20, 0x0c, 0x0f, 0x09, 0x02,
+    0x00, 0x20, 0x12, 0x00, 0xa4, 0xff, 0x4a, 0x00, 0x02, 0x00, 0x02, 0x0a, 0x16, 0x02, 0x00, 0xf0,
+    0x02, 0x0b, 0x16, 0x01, 0x00, 0x20, 0x1c, 0x00, 0x0e, 0x00, 0x55, 0xff, 0x02, 0x00, 0x06, 0x03,
+    0x0b, 0x08, 0x00, 0xf0, 0x06, 0x07, 0x0b, 0x04, 0x00, 0x20, 0x9f, 0xff, 0x78, 0x00, 0x04, 0x00,
+    0x02, 0x00, 0x0e, 0x05, 0x06, 0x06, 0x00, 0xf0, 0x0e, 0x08, 0x06, 0x03, 0x00, 0x20, 0xed, 0xfe,
+    0xde, 0xfe, 0x06, 0x00, 0x02, 0x00, 0x00, 0x07, 0x18, 0x06, 0x00, 0xf0, 0x00, 0x09, 0x18, 0x02,
+    0x00, 0x30, 0xf5, 0xfe, 0xfb, 0x00, 0x07, 0x00, 0x03, 0x00, 0x0e, 0x00, 0x0a, 0x0a, 0x00, 0xf0,
+    0x13, 0x00, 0x05, 0x05, 0x00, 0x20, 0x0e, 0x05, 0x05, 0x05, 0x00, 0x20, 0x5d, 0x00, 0xb8, 0xff,
+    0x97, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x00, 0xf0, 0x00, 0x00, 0x05, 0x05, 0x00, 0x20,
+    0x05, 0x05, 0x05, 0x05, 0x00, 0x20, 0xb3, 0xff, 0x5d, 0xff, 0x43, 0x00, 0x03, 0x00, 0x00, 0x01,
+    0x18, 0x04, 0x00, 0xf0, 0x0c, 0x01, 0x0c, 0x02, 0x00, 0x20, 0x00, 0x03, 0x0c, 0x02, 0x00, 0x20,
+    0xe4, 0xff, 0x5f, 0x00, 0xab, 0xff, 0x02, 0x00, 0x00, 0x11, 0x12, 0x03, 0x00, 0xf0, 0x00, 0x12,
+    0x12, 0x01, 0x00, 0x30, 0x5c, 0xff, 0xb2, 0xfe, 0x28, 0x00, 0x03, 0x00, 0x05, 0x0f, 0x10, 0x06,
+    0x00, 0xf0, 0x0d, 0x0f, 0x08, 0x03, 0x00, 0x20, 0x05, 0x12, 0x08, 0x03, 0x00, 0x20, 0x5a, 0xff,
+    0xf5, 0xfd, 0xfa, 0xff, 0x03, 0x00, 0x03, 0x0f, 0x10, 0x06, 0x00, 0xf0, 0x03, 0x0f, 0x08, 0x03,
+    0x00, 0x20, 0x0b, 0x12, 0x08, 0x03, 0x00, 0x20, 0xce, 0xff, 0xc6, 0x00, 0xf5, 0xff, 0x02, 0x00,
+    0x06, 0x10, 0x12, 0x03, 0x00, 0xf0, 0x06, 0x11, 0x12, 0x01, 0x00, 0x30, 0x91, 0xff, 0x2c, 0x00,
+    0x8e, 0xff, 0x02, 0x00, 0x00, 0x0d, 0x15, 0x0a, 0x00, 0xf0, 0x00, 0x12, 0x15, 0x05, 0x00, 0x20,
+    0x97, 0xfe, 0x80, 0xfe, 0x24, 0x00, 0x02, 0x00, 0x0d, 0x00, 0x06, 0x18, 0x00, 0xf0, 0x0f, 0x00,
+    0x02, 0x18, 0x00, 0x30, 0xe0, 0xff, 0x49, 0x00, 0x9f, 0xff, 0x02, 0x00, 0x07, 0x04, 0x06, 0x0b,
+    0x00, 0xf0, 0x09, 0x04, 0x02, 0x0b, 0x00, 0x30, 0x55, 0xff, 0x62, 0x01, 0x10, 0x00, 0x02, 0x00,
+    0x09, 0x05, 0x09, 0x06, 0x00, 0xf0, 0x0c, 0x05, 0x03, 0x06, 0x00, 0x30, 0xbb, 0x00, 0xc7, 0xff,
+    0xcb, 0x00, 0x02, 0x00, 0x01, 0x04, 0x02, 0x14, 0x00, 0xf0, 0x01, 0x0e, 0x02, 0x0a, 0x00, 0x20,
+    0xbf, 0xfd, 0x6a, 0xfe, 0x1d, 0x00, 0x02, 0x00, 0x0d, 0x00, 0x06, 0x18, 0x00, 0xf0, 0x0f, 0x00,
+    0x02, 0x18, 0x00, 0x30, 0x0e, 0xff, 0xcf, 0xfe, 0xff, 0xff, 0x02, 0x00, 0x05, 0x00, 0x06, 0x18,
+    0x00, 0xf0, 0x07, 0x00, 0x02, 0x18, 0x00, 0x30, 0x11, 0x00, 0xd9, 0xff, 0x68, 0x00, 0x03, 0x00,
+    0x10, 0x07, 0x06, 0x0e, 0x00, 0xf0, 0x13, 0x07, 0x03, 0x07, 0x00, 0x20, 0x10, 0x0e, 0x03, 0x07,
+    0x00, 0x20, 0xf8, 0xff, 0x42, 0x00, 0x9e, 0xff, 0x02, 0x00, 0x04, 0x07, 0x04, 0x0c, 0x00, 0xf0,
+    0x06, 0x07, 0x02, 0x0c, 0x00, 0x20, 0x67, 0x04, 0xea, 0xff, 0xc4, 0x00, 0x02, 0x00, 0x00, 0x05,
+    0x18, 0x0e, 0x00, 0xf0, 0x08, 0x05, 0x08, 0x0e, 0x00, 0x30, 0x94, 0xff, 0xc0, 0x00, 0xc7, 0xff,
+    0x02, 0x00, 0x05, 0x0d, 0x0a, 0x06, 0x00, 0xf0, 0x05, 0x0f, 0x0a, 0x02, 0x00, 0x30, 0xa7, 0x00,
+    0x1f, 0x00, 0x8c, 0xfe, 0x02, 0x00, 0x0c, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x0e, 0x00, 0x02, 0x09,
+    0x00, 0x30, 0x16, 0x00, 0xa3, 0xff, 0x42, 0x00, 0x03, 0x00, 0x02, 0x07, 0x06, 0x0e, 0x00, 0xf0,
+    0x02, 0x07, 0x03, 0x07, 0x00, 0x20, 0x05, 0x0e, 0x03, 0x07, 0x00, 0x20, 0x82, 0x00, 0xed, 0xff,
+    0x7c, 0x00, 0x02, 0x00, 0x0f, 0x02, 0x09, 0x0f, 0x00, 0xf0, 0x12, 0x02, 0x03, 0x0f, 0x00, 0x30,
+    0x57, 0xff, 0xc8, 0x00, 0xc8, 0xff, 0x02, 0x00, 0x00, 0x02, 0x06, 0x09, 0x00, 0xf0, 0x02, 0x02,
+    0x02, 0x09, 0x00, 0x30, 0x77, 0xfe, 0x1b, 0xff, 0x25, 0x00, 0x03, 0x00, 0x0c, 0x02, 0x0a, 0x0e,
+    0x00, 0xf0, 0x11, 0x02, 0x05, 0x07, 0x00, 0x20, 0x0c, 0x09, 0x05, 0x07, 0x00, 0x20, 0xd1, 0xff,
+    0xd3, 0x00, 0xcd, 0xff, 0x02, 0x00, 0x0b, 0x06, 0x02, 0x12, 0x00, 0xf0, 0x0c, 0x06, 0x01, 0x12,
+    0x00, 0x20, 0x4b, 0x00, 0x04, 0x00, 0x45, 0x00, 0x02, 0x00, 0x09, 0x05, 0x0f, 0x06, 0x00, 0xf0,
+    0x0e, 0x05, 0x05, 0x06, 0x00, 0x30, 0x75, 0xff, 0x21, 0x01, 0xd0, 0xff, 0x02, 0x00, 0x08, 0x06,
+    0x06, 0x0a, 0x00, 0xf0, 0x0a, 0x06, 0x02, 0x0a, 0x00, 0x30, 0x9c, 0xff, 0x6d, 0xff, 0x28, 0x00,
+    0x02, 0x00, 0x0c, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x0e, 0x00, 0x02, 0x09, 0x00, 0x30, 0xc8, 0x00,
+    0xfb, 0xff, 0x5d, 0xfe, 0x02, 0x00, 0x03, 0x03, 0x09, 0x07, 0x00, 0xf0, 0x06, 0x03, 0x03, 0x07,
+    0x00, 0x30, 0xac, 0xff, 0x75, 0xff, 0x3d, 0x00, 0x02, 0x00, 0x06, 0x07, 0x0e, 0x03, 0x00, 0xf0,
+    0x06, 0x07, 0x07, 0x03, 0x00, 0x20, 0xa2, 0xff, 0xc7, 0xfe, 0xff, 0xff, 0x02, 0x00, 0x07, 0x07,
+    0x08, 0x06, 0x00, 0xf0, 0x0b, 0x07, 0x04, 0x06, 0x00, 0x20, 0x08, 0x01, 0x25, 0x00, 0x8d, 0xff,
+    0x02, 0x00, 0x0c, 0x07, 0x07, 0x0c, 0x00, 0xf0, 0x0c, 0x0d, 0x07, 0x06, 0x00, 0x20, 0x33, 0x00,
+    0xb9, 0xff, 0x70, 0x00, 0x03, 0x00, 0x0a, 0x06, 0x04, 0x12, 0x00, 0xf0, 0x0a, 0x06, 0x02, 0x09,
+    0x00, 0x20, 0x0c, 0x0f, 0x02, 0x09, 0x00, 0x20, 0xcf, 0xff, 0xc2, 0xff, 0x40, 0x00, 0x02, 0x00,
+    0x10, 0x0e, 0x06, 0x09, 0x00, 0xf0, 0x10, 0x11, 0x06, 0x03, 0x00, 0x30, 0x94, 0xff, 0x25, 0xff,
+    0x06, 0x00, 0x02, 0x00, 0x04, 0x00, 0x06, 0x0d, 0x00, 0xf0, 0x06, 0x00, 0x02, 0x0d, 0x00, 0x30,
+    0x98, 0xff, 0xb1, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x02, 0x15, 0x03, 0x00, 0xf0, 0x09, 0x02,
+    0x07, 0x03, 0x00, 0x30, 0xa0, 0x00, 0xd6, 0xff, 0x85, 0x01, 0x02, 0x00, 0x05, 0x04, 0x05, 0x0c,
+    0x00, 0xf0, 0x05, 0x08, 0x05, 0x04, 0x00, 0x30, 0xe8, 0xff, 0x70, 0x00, 0xc9, 0xff, 0x02, 0x00,
+    0x0a, 0x03, 0x04, 0x0a, 0x00, 0xf0, 0x0a, 0x08, 0x04, 0x05, 0x00, 0x20, 0x75, 0xff, 0x06, 0xff,
+    0x05, 0x00, 0x02, 0x00, 0x08, 0x04, 0x05, 0x08, 0x00, 0xf0, 0x08, 0x08, 0x05, 0x04, 0x00, 0x20,
+    0x22, 0xfc, 0x63, 0x00, 0xa6, 0x00, 0x19, 0xff, 0xa4, 0x00, 0x02, 0x00, 0x06, 0x00, 0x0b, 0x09,
+    0x00, 0xf0, 0x06, 0x03, 0x0b, 0x03, 0x00, 0x30, 0x68, 0x00, 0x36, 0xff, 0x93, 0x00, 0x02, 0x00,
+    0x06, 0x06, 0x0c, 0x05, 0x00, 0xf0, 0x0a, 0x06, 0x04, 0x05, 0x00, 0x30, 0x31, 0x03, 0xb3, 0xff,
+    0x50, 0x01, 0x02, 0x00, 0x00, 0x00, 0x18, 0x05, 0x00, 0xf0, 0x08, 0x00, 0x08, 0x05, 0x00, 0x30,
+    0x32, 0x00, 0x1a, 0xff, 0x4a, 0x00, 0x02, 0x00, 0x01, 0x0a, 0x17, 0x06, 0x00, 0xf0, 0x01, 0x0c,
+    0x17, 0x02, 0x00, 0x30, 0xa0, 0x00, 0x95, 0xff, 0x88, 0x00, 0x02, 0x00, 0x03, 0x15, 0x12, 0x03,
+    0x00, 0xf0, 0x09, 0x15, 0x06, 0x03, 0x00, 0x30, 0x82, 0xff, 0x75, 0x00, 0x8e, 0xff, 0x02, 0x00,
+    0x03, 0x06, 0x15, 0x06, 0x00, 0xf0, 0x03, 0x08, 0x15, 0x02, 0x00, 0x30, 0x6f, 0xff, 0xe9, 0x00,
+    0xba, 0xff, 0x02, 0x00, 0x00, 0x05, 0x06, 0x0c, 0x00, 0xf0, 0x02, 0x05, 0x02, 0x0c, 0x00, 0x30,
+    0x04, 0xff, 0x88, 0xfe, 0x34, 0x00, 0x02, 0x00, 0x0a, 0x02, 0x04, 0x0f, 0x00, 0xf0, 0x0a, 0x07,
+    0x04, 0x05, 0x00, 0x30, 0xd0, 0xff, 0xf4, 0xfe, 0x11, 0x00, 0x02, 0x00, 0x08, 0x07, 0x08, 0x0a,
+    0x00, 0xf0, 0x08, 0x0c, 0x08, 0x05, 0x00, 0x20, 0x12, 0x01, 0x4a, 0x00, 0x7b, 0xff, 0x02, 0x00,
+    0x05, 0x07, 0x0f, 0x0c, 0x00, 0xf0, 0x0a, 0x07, 0x05, 0x0c, 0x00, 0x30, 0xac, 0xff, 0xb7, 0xfe,
+    0x0b, 0x00, 0x02, 0x00, 0x00, 0x11, 0x0a, 0x06, 0x00, 0xf0, 0x00, 0x13, 0x0a, 0x02, 0x00, 0x30,
+    0xa5, 0xff, 0x25, 0xff, 0x2f, 0x00, 0x02, 0x00, 0x0e, 0x12, 0x09, 0x06, 0x00, 0xf0, 0x0e, 0x14,
+    0x09, 0x02, 0x00, 0x30, 0x04, 0x00, 0x29, 0x00, 0x50, 0xff, 0x02, 0x00, 0x09, 0x06, 0x06, 0x10,
+    0x00, 0xf0, 0x09, 0x0e, 0x06, 0x08, 0x00, 0x20, 0x92, 0x00, 0x28, 0x00, 0x29, 0xff, 0x02, 0x00,
+    0x0e, 0x12, 0x09, 0x06, 0x00, 0xf0, 0x0e, 0x14, 0x09, 0x02, 0x00, 0x30, 0x7d, 0x00, 0x05, 0x00,
+    0xa3, 0xfe, 0x02, 0x00, 0x01, 0x12, 0x09, 0x06, 0x00, 0xf0, 0x01, 0x14, 0x09, 0x02, 0x00, 0x30,
+    0x16, 0x00, 0xd6, 0xff, 0x42, 0x00, 0x02, 0x00, 0x0f, 0x09, 0x09, 0x06, 0x00, 0xf0, 0x0f, 0x0b,
+    0x09, 0x02, 0x00, 0x30, 0xe7, 0xff, 0x07, 0xff, 0x10, 0x00, 0x02, 0x00, 0x00, 0x09, 0x09, 0x06,
+    0x00, 0xf0, 0x00, 0x0b, 0x09, 0x02, 0x00, 0x30, 0x84, 0xff, 0xfc, 0x00, 0xfc, 0xff, 0x02, 0x00,
+    0x11, 0x03, 0x06, 0x09, 0x00, 0xf0, 0x13, 0x03, 0x02, 0x09, 0x00, 0x30, 0xd9, 0xff, 0x79, 0x00,
+    0xad, 0xff, 0x02, 0x00, 0x02, 0x11, 0x12, 0x03, 0x00, 0xf0, 0x02, 0x12, 0x12, 0x01, 0x00, 0x30,
+    0x17, 0xff, 0x0b, 0xff, 0x33, 0x00, 0x02, 0x00, 0x03, 0x0f, 0x15, 0x06, 0x00, 0xf0, 0x03, 0x11,
+    0x15, 0x02, 0x00, 0x30, 0x10, 0x00, 0x7a, 0xff, 0x39, 0x00, 0x02, 0x00, 0x09, 0x11, 0x06, 0x06,
+    0x00, 0xf0, 0x09, 0x14, 0x06, 0x03, 0x00, 0x20, 0x8a, 0x00, 0x2b, 0x00, 0xee, 0xfe, 0x02, 0x00,
+    0x12, 0x03, 0x06, 0x09, 0x00, 0xf0, 0x12, 0x06, 0x06, 0x03, 0x00, 0x30, 0x73, 0xff, 0xde, 0xfe,
+    0x09, 0x00, 0x02, 0x00, 0x00, 0x03, 0x06, 0x09, 0x00, 0xf0, 0x00, 0x06, 0x06, 0x03, 0x00, 0x30,
+    0xc0, 0x00, 0x42, 0x00, 0x49, 0xff, 0x03, 0x00, 0x04, 0x00, 0x10, 0x0a, 0x00, 0xf0, 0x0c, 0x00,
+    0x08, 0x05, 0x00, 0x20, 0x04, 0x05, 0x08, 0x05, 0x00, 0x20, 0xdd, 0xff, 0x32, 0x00, 0x78, 0xff,
+    0x03, 0x00, 0x02, 0x00, 0x0a, 0x10, 0x00, 0xf0, 0x02, 0x00, 0x05, 0x08, 0x00, 0x20, 0x07, 0x08,
+    0x05, 0x08, 0x00, 0x20, 0x0c, 0x01, 0xf3, 0xff, 0xf9, 0x00, 0x02, 0x00, 0x0e, 0x00, 0x0a, 0x05,
+    0x00, 0xf0, 0x0e, 0x00, 0x05, 0x05, 0x00, 0x20, 0x4c, 0xff, 0x10, 0x01, 0xc4, 0xff, 0x02, 0x00,
+    0x00, 0x00, 0x0a, 0x05, 0x00, 0xf0, 0x05, 0x00, 0x05, 0x05, 0x00, 0x20, 0x46, 0x00, 0xd1, 0xff,
+    0x75, 0x00, 0x02, 0x00, 0x12, 0x03, 0x06, 0x0a, 0x00, 0xf0, 0x12, 0x03, 0x03, 0x0a, 0x00, 0x20,
+    0x87, 0x00, 0xf9, 0xff, 0x56, 0xfd, 0x03, 0x00, 0x05, 0x0b, 0x0c, 0x06, 0x00, 0xf0, 0x05, 0x0b,
+    0x06, 0x03, 0x00, 0x20, 0x0b, 0x0e, 0x06, 0x03, 0x00, 0x20, 0xaa, 0xff, 0xff, 0x00, 0x06, 0x00,
+    0x02, 0x00, 0x15, 0x00, 0x03, 0x12, 0x00, 0xf0, 0x16, 0x00, 0x01, 0x12, 0x00, 0x30, 0x79, 0x00,
+    0xf9, 0xff, 0xd5, 0xfd, 0x02, 0x00, 0x06, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x08, 0x00, 0x02, 0x09,
+    0x00, 0x30, 0xe2, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x02, 0x00, 0x08, 0x08, 0x09, 0x07, 0x00, 0xf0,
+    0x0b, 0x08, 0x03, 0x07, 0x00, 0x30, 0x77, 0xff, 0x79, 0xfe, 0x02, 0x00, 0x03, 0x00, 0x07, 0x0c,
+    0x08, 0x0a, 0x00, 0xf0, 0x07, 0x0c, 0x04, 0x05, 0x00, 0x20, 0x0b, 0x11, 0x04, 0x05, 0x00, 0x20,
+    0x50, 0x00, 0x08, 0x00, 0xfe, 0x00, 0x02, 0x00, 0x15, 0x00, 0x03, 0x12, 0x00, 0xf0, 0x16, 0x00,
+    0x01, 0x12, 0x00, 0x30, 0xab, 0xff, 0xc4, 0x00, 0xc1, 0xff, 0x02, 0x00, 0x0a, 0x06, 0x04, 0x09,
+    0x00, 0xf0, 0x0c, 0x06, 0x02, 0x09, 0x00, 0x20, 0x85, 0x00, 0x29, 0x00, 0x64, 0xff, 0x02, 0x00,
+    0x0f, 0x00, 0x09, 0x06, 0x00, 0xf0, 0x0f, 0x02, 0x09, 0x02, 0x00, 0x30, 0xd4, 0xff, 0x06, 0xff,
+    0x07, 0x00, 0x02, 0x00, 0x00, 0x02, 0x18, 0x03, 0x00, 0xf0, 0x00, 0x03, 0x18, 0x01, 0x00, 0x30,
+    0xd8, 0xff, 0x76, 0x00, 0xde, 0xff, 0x02, 0x00, 0x0b, 0x07, 0x06, 0x09, 0x00, 0xf0, 0x0d, 0x07,
+    0x02, 0x09, 0x00, 0x30, 0xf1, 0xff, 0x41, 0x00, 0x7b, 0xff, 0x02, 0x00, 0x07, 0x06, 0x06, 0x0a,
+    0x00, 0xf0, 0x09, 0x06, 0x02, 0x0a, 0x00, 0x30, 0x55, 0xff, 0x32, 0xff, 0x26, 0x00, 0x02, 0x00,
+    0x0c, 0x01, 0x06, 0x0c, 0x00, 0xf0, 0x0e, 0x01, 0x02, 0x0c, 0x00, 0x30, 0x74, 0xff, 0xb0, 0xfe,
+    0x00, 0x00, 0x02, 0x00, 0x06, 0x04, 0x0c, 0x0c, 0x00, 0xf0, 0x06, 0x0a, 0x0c, 0x06, 0x00, 0x20,
+    0x29, 0x00, 0x33, 0x00, 0x63, 0xff, 0x02, 0x00, 0x0e, 0x03, 0x02, 0x15, 0x00, 0xf0, 0x0e, 0x03,
+    0x01, 0x15, 0x00, 0x20, 0x90, 0xfe, 0xf9, 0x00, 0xcb, 0xff, 0x02, 0x00, 0x06, 0x01, 0x0c, 0x08,
+    0x00, 0xf0, 0x06, 0x05, 0x0c, 0x04, 0x00, 0x20, 0x6a, 0x00, 0xd0, 0xff, 0x7a, 0x00, 0x02, 0x00,
+    0x03, 0x00, 0x12, 0x08, 0x00, 0xf0, 0x03, 0x04, 0x12, 0x04, 0x00, 0x20, 0xf1, 0xff, 0x52, 0xff,
+    0x1c, 0x00, 0x02, 0x00, 0x03, 0x00, 0x12, 0x03, 0x00, 0xf0, 0x03, 0x01, 0x12, 0x01, 0x00, 0x30,
+    0x82, 0x00, 0x30, 0x00, 0x81, 0xfe, 0x03, 0x00, 0x00, 0x0d, 0x18, 0x04, 0x00, 0xf0, 0x0c, 0x0d,
+    0x0c, 0x02, 0x00, 0x20, 0x00, 0x0f, 0x0c, 0x02, 0x00, 0x20, 0x4f, 0x00, 0xc4, 0xff, 0xd0, 0x00,
+    0x02, 0x00, 0x0a, 0x05, 0x04, 0x09, 0x00, 0xf0, 0x0c, 0x05, 0x02, 0x09, 0x00, 0x20, 0x07, 0x00,
+    0x3f, 0x00, 0xef, 0xff, 0x02, 0x00, 0x0b, 0x01, 0x06, 0x09, 0x00, 0xf0, 0x0d, 0x01, 0x02, 0x09,
+    0x00, 0x30, 0x4c, 0xff, 0xf6, 0xfe, 0x0c, 0x00, 0x02, 0x00, 0x06, 0x02, 0x06, 0x16, 0x00, 0xf0,
+    0x08, 0x02, 0x02, 0x16, 0x00, 0x30, 0x49, 0xff, 0x83, 0x00, 0xff, 0xff, 0x03, 0x00, 0x10, 0x0a,
+    0x08, 0x0e, 0x00, 0xf0, 0x14, 0x0a, 0x04, 0x07, 0x00, 0x20, 0x10, 0x11, 0x04, 0x07, 0x00, 0x20,
+    0x48, 0xfe, 0x9e, 0x01, 0xd1, 0xff, 0x02, 0x00, 0x03, 0x04, 0x10, 0x0f, 0x00, 0xf0, 0x03, 0x09,
+    0x10, 0x05, 0x00, 0x30, 0xf2, 0xfd, 0xfc, 0x02, 0x18, 0x00, 0x03, 0x00, 0x10, 0x0a, 0x08, 0x0e,
+    0x00, 0xf0, 0x14, 0x0a, 0x04, 0x07, 0x00, 0x20, 0x10, 0x11, 0x04, 0x07, 0x00, 0x20, 0x49, 0xff,
+    0x9a, 0x00, 0xbb, 0xff, 0x03, 0x00, 0x00, 0x0a, 0x08, 0x0e, 0x00, 0xf0, 0x00, 0x0a, 0x04, 0x07,
+    0x00, 0x20, 0x04, 0x11, 0x04, 0x07, 0x00, 0x20, 0x4c, 0xff, 0x62, 0xff, 0x28, 0x00, 0x02, 0x00,
+    0x0a, 0x0e, 0x0b, 0x06, 0x00, 0xf0, 0x0a, 0x11, 0x0b, 0x03, 0x00, 0x20, 0x0a, 0xfe, 0xa9, 0x00,
+    0xc4, 0xff, 0x02, 0x00, 0x00, 0x07, 0x18, 0x09, 0x00, 0xf0, 0x08, 0x07, 0x08, 0x09, 0x00, 0x30,
+    0xaf, 0xff, 0xe1, 0xfe, 0x32, 0x00, 0x02, 0x00, 0x0d, 0x01, 0x04, 0x10, 0x00, 0xf0, 0x0d, 0x01,
+    0x02, 0x10, 0x00, 0x20, 0xc1, 0xff, 0xed, 0xfe, 0x05, 0x00, 0x02, 0x00, 0x07, 0x01, 0x04, 0x10,
+    0x00, 0xf0, 0x09, 0x01, 0x02, 0x10, 0x00, 0x20, 0x38, 0xff, 0xcf, 0x00, 0xfc, 0xff, 0x03, 0x00,
+    0x05, 0x05, 0x10, 0x08, 0x00, 0xf0, 0x0d, 0x05, 0x08, 0x04, 0x00, 0x20, 0x05, 0x09, 0x08, 0x04,
+    0x00, 0x20, 0xe5, 0x00, 0xfb, 0xff, 0x44, 0xfe, 0x02, 0x00, 0x00, 0x09, 0x06, 0x09, 0x00, 0xf0,
+    0x00, 0x0c, 0x06, 0x03, 0x00, 0x30, 0xd8, 0xff, 0xad, 0x00, 0xf2, 0xff, 0x02, 0x00, 0x06, 0x10,
+    0x12, 0x03, 0x00, 0xf0, 0x06, 0x11, 0x12, 0x01, 0x00, 0x30, 0x37, 0x00, 0x0e, 0x00, 0x3b, 0xff,
+    0x02, 0x00, 0x03, 0x0c, 0x06, 0x09, 0x00, 0xf0, 0x03, 0x0f, 0x06, 0x03, 0x00, 0x30, 0x1a, 0x00,
+    0xdf, 0xff, 0xab, 0x00, 0x02, 0x00, 0x08, 0x0e, 0x09, 0x06, 0x00, 0xf0, 0x08, 0x10, 0x09, 0x02,
+    0x00, 0x30, 0x1d, 0x00, 0xa0, 0xff, 0x4f, 0x00, 0x03, 0x00, 0x02, 0x0d, 0x08, 0x0a, 0x00, 0xf0,
+    0x02, 0x0d, 0x04, 0x05, 0x00, 0x20, 0x06, 0x12, 0x04, 0x05, 0x00, 0x20, 0x13, 0x00, 0x6b, 0xff,
+    0x41, 0x00, 0x02, 0x00, 0x0f, 0x05, 0x03, 0x12, 0x00, 0xf0, 0x0f, 0x0b, 0x03, 0x06, 0x00, 0x30,
+    0x27, 0x00, 0xb3, 0xff, 0x69, 0x00, 0x02, 0x00, 0x03, 0x05, 0x12, 0x03, 0x00, 0xf0, 0x03, 0x06,
+    0x12, 0x01, 0x00, 0x30, 0x90, 0xff, 0x97, 0x00, 0x04, 0x00, 0x02, 0x00, 0x11, 0x05, 0x06, 0x0b,
+    0x00, 0xf0, 0x13, 0x05, 0x02, 0x0b, 0x00, 0x30, 0x5f, 0xff, 0xf8, 0x00, 0xcb, 0xff, 0x02, 0x00,
+    0x01, 0x05, 0x06, 0x0b, 0x00, 0xf0, 0x03, 0x05, 0x02, 0x0b, 0x00, 0x30, 0x83, 0xff, 0xe9, 0x00,
+    0x0a, 0x00, 0x02, 0x00, 0x13, 0x01, 0x04, 0x09, 0x00, 0xf0, 0x13, 0x01, 0x02, 0x09, 0x00, 0x20,
+    0xfa, 0xff, 0x66, 0xff, 0x2b, 0x00, 0x02, 0x00, 0x01, 0x01, 0x04, 0x09, 0x00, 0xf0, 0x03, 0x01,
+    0x02, 0x09, 0x00, 0x20, 0x0d, 0x03, 0x0b, 0x00, 0xd1, 0x00, 0x02, 0x00, 0x04, 0x0f, 0x12, 0x09,
+    0x00, 0xf0, 0x04, 0x0f, 0x09, 0x09, 0x00, 0x20, 0x15, 0x00, 0x11, 0xff, 0x06, 0x00, 0x02, 0x00,
+    0x06, 0x09, 0x0c, 0x04, 0x00, 0xf0, 0x06, 0x0b, 0x0c, 0x02, 0x00, 0x20, 0x62, 0x00, 0x2e, 0x00,
+    0xa9, 0xff, 0x02, 0x00, 0x0f, 0x02, 0x09, 0x06, 0x00, 0xf0, 0x0f, 0x04, 0x09, 0x02, 0x00, 0x30,
+    0x94, 0xff, 0xb6, 0xfe, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x09, 0x06, 0x00, 0xf0, 0x00, 0x04,
+    0x09, 0x02, 0x00, 0x30, 0x16, 0x00, 0xf5, 0xff, 0x40, 0x00, 0x02, 0x00, 0x0f, 0x00, 0x06, 0x11,
+    0x00, 0xf0, 0x11, 0x00, 0x02, 0x11, 0x00, 0x30, 0xde, 0x00, 0xfd, 0xff, 0x92, 0xfe, 0x02, 0x00,
+    0x03, 0x00, 0x06, 0x11, 0x00, 0xf0, 0x05, 0x00, 0x02, 0x11, 0x00, 0x30, 0x00, 0x00, 0xbc, 0xff,
+    0x55, 0x00, 0x02, 0x00, 0x08, 0x11, 0x09, 0x04, 0x00, 0xf0, 0x08, 0x13, 0x09, 0x02, 0x00, 0x20,
+    0x3e, 0x00, 0x7d, 0xff, 0x21, 0x00, 0x02, 0x00, 0x06, 0x05, 0x03, 0x12, 0x00, 0xf0, 0x06, 0x0b,
+    0x03, 0x06, 0x00, 0x30, 0x45, 0x00, 0x6a, 0x00, 0xb1, 0xff, 0x02, 0x00, 0x05, 0x02, 0x0e, 0x0c,
+    0x00, 0xf0, 0x05, 0x08, 0x0e, 0x06, 0x00, 0x20, 0x7c, 0x00, 0xc1, 0xff, 0xb5, 0x00, 0x02, 0x00,
+    0x0a, 0x02, 0x03, 0x0c, 0x00, 0xf0, 0x0a, 0x08, 0x03, 0x06, 0x00, 0x20, 0x1a, 0x00, 0xc7, 0xff,
+    0x31, 0x00, 0x02, 0x00, 0x0a, 0x07, 0x0e, 0x0f, 0x00, 0xf0, 0x0a, 0x0c, 0x0e, 0x05, 0x00, 0x30,
+    0x44, 0x02, 0x10, 0x00, 0x1d, 0xff, 0x02, 0x00, 0x00, 0x07, 0x0e, 0x0f, 0x00, 0xf0, 0x00, 0x0c,
+    0x0e, 0x05, 0x00, 0x30, 0x4f, 0x00, 0x30, 0x00, 0xba, 0xff, 0x02, 0x00, 0x0f, 0x00, 0x09, 0x06,
+    0x00, 0xf0, 0x0f, 0x02, 0x09, 0x02, 0x00, 0x30, 0xba, 0xff, 0x0e, 0xff, 0x06, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x09, 0x06, 0x00, 0xf0, 0x00, 0x02, 0x09, 0x02, 0x00, 0x30, 0xe7, 0xff, 0x5e, 0x00,
+    0xd4, 0xff, 0x02, 0x00, 0x0c, 0x06, 0x06, 0x0e, 0x00, 0xf0, 0x0e, 0x06, 0x02, 0x0e, 0x00, 0x30,
+    0xbf, 0xff, 0xf6, 0x00, 0xcd, 0xff, 0x02, 0x00, 0x09, 0x07, 0x06, 0x09, 0x00, 0xf0, 0x0b, 0x07,
+    0x02, 0x09, 0x00, 0x30, 0x62, 0xfe, 0xef, 0xfc, 0x1d, 0x00, 0x02, 0x00, 0x0c, 0x06, 0x06, 0x0f,
+    0x00, 0xf0, 0x0e, 0x06, 0x02, 0x0f, 0x00, 0x30, 0xe2, 0xff, 0x3a, 0x00, 0x8c, 0xff, 0x02, 0x00,
+    0x06, 0x06, 0x06, 0x0f, 0x00, 0xf0, 0x08, 0x06, 0x02, 0x0f, 0x00, 0x30, 0xb5, 0x00, 0x00, 0x00,
+    0x64, 0x00, 0x02, 0x00, 0x0f, 0x03, 0x08, 0x09, 0x00, 0xf0, 0x0f, 0x03, 0x04, 0x09, 0x00, 0x20,
+    0x24, 0xfe, 0xf3, 0x00, 0xcd, 0xff, 0x02, 0x00, 0x00, 0x00, 0x09, 0x15, 0x00, 0xf0, 0x03, 0x00,
+    0x03, 0x15, 0x00, 0x30, 0x13, 0x00, 0xe7, 0xff, 0x34, 0x00, 0x02, 0x00, 0x0b, 0x09, 0x08, 0x0c,
+    0x00, 0xf0, 0x0b, 0x0d, 0x08, 0x04, 0x00, 0x30, 0x5b, 0x00, 0x02, 0x00, 0xfb, 0xfe, 0x03, 0x00,
+    0x06, 0x07, 0x0a, 0x0c, 0x00, 0xf0, 0x06, 0x07, 0x05, 0x06, 0x00, 0x20, 0x0b, 0x0d, 0x05, 0x06,
+    0x00, 0x20, 0xcf, 0xff, 0xa5, 0x00, 0xe9, 0xff, 0x03, 0x00, 0x0a, 0x06, 0x04, 0x12, 0x00, 0xf0,
+    0x0c, 0x06, 0x02, 0x09, 0x00, 0x20, 0x0a, 0x0f, 0x02, 0x09, 0x00, 0x20, 0xe5, 0x00, 0xf7, 0xff,
+    0x13, 0xfe, 0x02, 0x00, 0x00, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x00, 0x03, 0x06, 0x03, 0x00, 0x30,
+    0xdd, 0xff, 0xb1, 0x00, 0xef, 0xff, 0x02, 0x00, 0x03, 0x0e, 0x12, 0x03, 0x00, 0xf0, 0x03, 0x0f,
+    0x12, 0x01, 0x00, 0x30, 0x1b, 0x00, 0x99, 0xff, 0x2f, 0x00, 0x03, 0x00, 0x03, 0x0e, 0x08, 0x0a,
+    0x00, 0xf0, 0x03, 0x0e, 0x04, 0x05, 0x00, 0x20, 0x07, 0x13, 0x04, 0x05, 0x00, 0x20, 0xb6, 0xff,
+    0x5b, 0xff, 0x38, 0x00, 0x03, 0x00, 0x00, 0x0c, 0x18, 0x04, 0x00, 0xf0, 0x0c, 0x0c, 0x0c, 0x02,
+    0x00, 0x20, 0x00, 0x0e, 0x0c, 0x02, 0x00, 0x20, 0xa3, 0xff, 0xfa, 0x00, 0xd1, 0xff, 0x02, 0x00,
+    0x00, 0x02, 0x03, 0x14, 0x00, 0xf0, 0x01, 0x02, 0x01, 0x14, 0x00, 0x30, 0x34, 0x00, 0xe6, 0xff,
+    0x5f, 0x00, 0x03, 0x00, 0x0c, 0x10, 0x0a, 0x08, 0x00, 0xf0, 0x11, 0x10, 0x05, 0x04, 0x00, 0x20,
+    0x0c, 0x14, 0x05, 0x04, 0x00, 0x20, 0xc8, 0xff, 0x9c, 0x00, 0xbc, 0xff, 0x03, 0x00, 0x02, 0x10,
+    0x0a, 0x08, 0x00, 0xf0, 0x02, 0x10, 0x05, 0x04, 0x00, 0x20, 0x07, 0x14, 0x05, 0x04, 0x00, 0x20,
+    0x49, 0xfc, 0x73, 0x00, 0x80, 0x00, 0xfc, 0xfe, 0x93, 0x00, 0x02, 0x00, 0x07, 0x00, 0x0a, 0x09,
+    0x00, 0xf0, 0x07, 0x03, 0x0a, 0x03, 0x00, 0x30, 0x7d, 0x01, 0x97, 0xff, 0x02, 0x01, 0x02, 0x00,
+    0x00, 0x00, 0x18, 0x03, 0x00, 0xf0, 0x08, 0x00, 0x08, 0x03, 0x00, 0x30, 0x6a, 0x00, 0x6b, 0xff,
+    0x90, 0x00, 0x02, 0x00, 0x03, 0x08, 0x0f, 0x04, 0x00, 0xf0, 0x03, 0x0a, 0x0f, 0x02, 0x00, 0x20,
+    0x43, 0x00, 0x13, 0xff, 0x4f, 0x00, 0x02, 0x00, 0x06, 0x05, 0x0c, 0x06, 0x00, 0xf0, 0x0a, 0x05,
+    0x04, 0x06, 0x00, 0x30, 0xf9, 0xff, 0x1e, 0x00, 0xe2, 0xfe, 0x02, 0x00, 0x05, 0x0d, 0x0e, 0x06,
+    0x00, 0xf0, 0x05, 0x10, 0x0e, 0x03, 0x00, 0x20, 0xdc, 0xff, 0x6c, 0xff, 0x54, 0x00, 0x02, 0x00,
+    0x0b, 0x0e, 0x04, 0x0a, 0x00, 0xf0, 0x0b, 0x13, 0x04, 0x05, 0x00, 0x20, 0x5c, 0x00, 0x9e, 0xff,
+    0x86, 0x00, 0x02, 0x00, 0x00, 0x06, 0x06, 0x07, 0x00, 0xf0, 0x03, 0x06, 0x03, 0x07, 0x00, 0x20,
+    0x66, 0xff, 0x2d, 0x01, 0xf8, 0xff, 0x02, 0x00, 0x12, 0x00, 0x06, 0x06, 0x00, 0xf0, 0x12, 0x00,
+    0x03, 0x06, 0x00, 0x20, 0xea, 0xff, 0x24, 0xff, 0x1e, 0x00, 0x02, 0x00, 0x03, 0x01, 0x12, 0x03,
+    0x00, 0xf0, 0x03, 0x02, 0x12, 0x01, 0x00, 0x30, 0x9f, 0xff, 0x41, 0xff, 0x35, 0x00, 0x02, 0x00,
+    0x09, 0x06, 0x0e, 0x12, 0x00, 0xf0, 0x09, 0x0c, 0x0e, 0x06, 0x00, 0x30, 0x94, 0xff, 0xeb, 0x00,
+    0xb8, 0xff, 0x02, 0x00, 0x00, 0x00, 0x06, 0x06, 0x00, 0xf0, 0x03, 0x00, 0x03, 0x06, 0x00, 0x20,
+    0x32, 0x00, 0x44, 0x00, 0x4d, 0xff, 0x02, 0x00, 0x0d, 0x0b, 0x06, 0x06, 0x00, 0xf0, 0x0d, 0x0b,
+    0x03, 0x06, 0x00, 0x20, 0x8b, 0x01, 0xb8, 0xff, 0xbb, 0x00, 0x02, 0x00, 0x00, 0x14, 0x18, 0x03,
+    0x00, 0xf0, 0x08, 0x14, 0x08, 0x03, 0x00, 0x30, 0x90, 0xff, 0x63, 0xff, 0x27, 0x00, 0x02, 0x00,
+    0x0d, 0x0b, 0x06, 0x07, 0x00, 0xf0, 0x0d, 0x0b, 0x03, 0x07, 0x00, 0x20, 0xc0, 0xff, 0x93, 0x00,
+    0xa9, 0xff, 0x02, 0x00, 0x04, 0x0c, 0x0a, 0x06, 0x00, 0xf0, 0x04, 0x0e, 0x0a, 0x02, 0x00, 0x30,
+    0xf8, 0xff, 0x53, 0x00, 0xdf, 0xff, 0x02, 0x00, 0x0d, 0x0b, 0x06, 0x06, 0x00, 0xf0, 0x0d, 0x0b,
+    0x03, 0x06, 0x00, 0x20, 0x31, 0x00, 0x16, 0x00, 0x0b, 0xff, 0x02, 0x00, 0x05, 0x0b, 0x06, 0x07,
+    0x00, 0xf0, 0x08, 0x0b, 0x03, 0x07, 0x00, 0x20, 0xc1, 0xff, 0x58, 0x00, 0x89, 0xff, 0x02, 0x00,
+    0x07, 0x04, 0x0b, 0x0c, 0x00, 0xf0, 0x07, 0x08, 0x0b, 0x04, 0x00, 0x30, 0xef, 0xff, 0x3c, 0x00,
+    0x7a, 0xff, 0x02, 0x00, 0x06, 0x0f, 0x0a, 0x04, 0x00, 0xf0, 0x06, 0x11, 0x0a, 0x02, 0x00, 0x20,
+    0xaa, 0xff, 0x42, 0xff, 0x37, 0x00, 0x02, 0x00, 0x0e, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x10, 0x00,
+    0x02, 0x09, 0x00, 0x30, 0xbb, 0xff, 0x19, 0xff, 0x10, 0x00, 0x02, 0x00, 0x04, 0x00, 0x06, 0x09,
+    0x00, 0xf0, 0x06, 0x00, 0x02, 0x09, 0x00, 0x30, 0x59, 0xff, 0xa8, 0xff, 0x37, 0x00, 0x02, 0x00,
+    0x0b, 0x02, 0x04, 0x0f, 0x00, 0xf0, 0x0b, 0x07, 0x04, 0x05, 0x00, 0x30, 0xdf, 0xff, 0x11, 0xff,
+    0x0c, 0x00, 0x02, 0x00, 0x00, 0x00, 0x14, 0x03, 0x00, 0xf0, 0x00, 0x01, 0x14, 0x01, 0x00, 0x30,
+    0xb2, 0xff, 0x78, 0xff, 0x2c, 0x00, 0x02, 0x00, 0x0d, 0x12, 0x0a, 0x06, 0x00, 0xf0, 0x0d, 0x14,
+    0x0a, 0x02, 0x00, 0x30, 0x4b, 0xff, 0xeb, 0x00, 0xc8, 0xff, 0x02, 0x00, 0x02, 0x07, 0x06, 0x0b,
+    0x00, 0xf0, 0x05, 0x07, 0x03, 0x0b, 0x00, 0x20, 0x01, 0xff, 0x4b, 0xff, 0x2e, 0x00, 0x02, 0x00,
+    0x0a, 0x0e, 0x0a, 0x09, 0x00, 0xf0, 0x0a, 0x11, 0x0a, 0x03, 0x00, 0x30, 0xfc, 0xff, 0x22, 0xff,
+    0x0e, 0x00, 0x02, 0x00, 0x08, 0x02, 0x04, 0x09, 0x00, 0xf0, 0x0a, 0x02, 0x02, 0x09, 0x00, 0x20,
+    0x61, 0x00, 0xc6, 0xff, 0x86, 0x00, 0x02, 0x00, 0x0e, 0x03, 0x0a, 0x04, 0x00, 0xf0, 0x0e, 0x03,
+    0x05, 0x04, 0x00, 0x20, 0x57, 0x00, 0xb3, 0xff, 0x8f, 0x00, 0x03, 0x00, 0x06, 0x06, 0x0c, 0x06,
+    0x00, 0xf0, 0x06, 0x06, 0x06, 0x03, 0x00, 0x20, 0x0c, 0x09, 0x06, 0x03, 0x00, 0x20, 0x52, 0x00,
+    0x44, 0x00, 0x4d, 0xff, 0x03, 0x00, 0x08, 0x08, 0x08, 0x0a, 0x00, 0xf0, 0x0c, 0x08, 0x04, 0x05,
+    0x00, 0x20, 0x08, 0x0d, 0x04, 0x05, 0x00, 0x20, 0x8b, 0xff, 0xd2, 0xfe, 0x0b, 0x00, 0x02, 0x00,
+    0x07, 0x04, 0x04, 0x10, 0x00, 0xf0, 0x07, 0x0c, 0x04, 0x08, 0x00, 0x20, 0x0e, 0x00, 0x75, 0xff,
+    0x42, 0x00, 0x02, 0x00, 0x08, 0x08, 0x09, 0x04, 0x00, 0xf0, 0x08, 0x0a, 0x09, 0x02, 0x00, 0x20,
+    0xe9, 0x00, 0xbb, 0xff, 0x94, 0x00, 0x02, 0x00, 0x05, 0x02, 0x0e, 0x09, 0x00, 0xf0, 0x05, 0x05,
+    0x0e, 0x03, 0x00, 0x30, 0x80, 0xfe, 0x17, 0xff, 0x32, 0x00, 0x02, 0x00, 0x03, 0x10, 0x13, 0x08,
+    0x00, 0xf0, 0x03, 0x14, 0x13, 0x04, 0x00, 0x20, 0x48, 0x00, 0x90, 0xff, 0x36, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x0a, 0x08, 0x00, 0xf0, 0x05, 0x00, 0x05, 0x08, 0x00, 0x20, 0xa7, 0x03, 0x06, 0x00,
+    0xc5, 0x00, 0x02, 0x00, 0x05, 0x02, 0x10, 0x12, 0x00, 0xf0, 0x05, 0x02, 0x08, 0x12, 0x00, 0x20,
+    0x13, 0xfd, 0xca, 0x00, 0xc1, 0xff, 0x02, 0x00, 0x00, 0x0b, 0x18, 0x0b, 0x00, 0xf0, 0x08, 0x0b,
+    0x08, 0x0b, 0x00, 0x30, 0xe2, 0xfe, 0xcd, 0x00, 0xf7, 0xff, 0x02, 0x00, 0x03, 0x03, 0x12, 0x05,
+    0x00, 0xf0, 0x03, 0x03, 0x09, 0x05, 0x00, 0x20, 0x3e, 0x00, 0xcd, 0xff, 0x1a, 0x01, 0x02, 0x00,
+    0x01, 0x10, 0x12, 0x03, 0x00, 0xf0, 0x01, 0x11, 0x12, 0x01, 0x00, 0x30, 0x1b, 0x00, 0xf5, 0xff,
+    0xb8, 0x00, 0x02, 0x00, 0x05, 0x11, 0x12, 0x03, 0x00, 0xf0, 0x05, 0x12, 0x12, 0x01, 0x00, 0x30,
+    0xbf, 0xff, 0x19, 0xff, 0x0b, 0x00, 0x02, 0x00, 0x01, 0x0d, 0x09, 0x06, 0x00, 0xf0, 0x01, 0x0f,
+    0x09, 0x02, 0x00, 0x30, 0x35, 0x00, 0x5a, 0x00, 0xa0, 0xff, 0x02, 0x00, 0x01, 0x09, 0x17, 0x0a,
+    0x00, 0xf0, 0x01, 0x0e, 0x17, 0x05, 0x00, 0x20, 0x35, 0x00, 0xce, 0xff, 0x1e, 0x01, 0x02, 0x00,
+    0x03, 0x07, 0x12, 0x03, 0x00, 0xf0, 0x03, 0x08, 0x12, 0x01, 0x00, 0x30, 0x5d, 0xff, 0x9a, 0xfe,
+    0x31, 0x00, 0x02, 0x00, 0x06, 0x08, 0x0c, 0x03, 0x00, 0xf0, 0x06, 0x08, 0x06, 0x03, 0x00, 0x20,
+    0x3d, 0x00, 0x00, 0x00, 0xd7, 0xfe, 0x02, 0x00, 0x06, 0x02, 0x03, 0x16, 0x00, 0xf0, 0x07, 0x02,
+    0x01, 0x16, 0x00, 0x30, 0xac, 0xff, 0x83, 0xff, 0x2a, 0x00, 0x02, 0x00, 0x0e, 0x11, 0x0a, 0x06,
+    0x00, 0xf0, 0x0e, 0x13, 0x0a, 0x02, 0x00, 0x30, 0xa5, 0xff, 0xc8, 0xfe, 0xfd, 0xff, 0x02, 0x00,
+    0x01, 0x12, 0x0a, 0x06, 0x00, 0xf0, 0x01, 0x14, 0x0a, 0x02, 0x00, 0x30, 0xe0, 0xff, 0x5f, 0x00,
+    0xeb, 0xff, 0x02, 0x00, 0x0b, 0x03, 0x06, 0x0c, 0x00, 0xf0, 0x0d, 0x03, 0x02, 0x0c, 0x00, 0x30,
+    0x3e, 0x00, 0xb5, 0xff, 0x98, 0x00, 0x02, 0x00, 0x0a, 0x06, 0x04, 0x09, 0x00, 0xf0, 0x0c, 0x06,
+    0x02, 0x09, 0x00, 0x20, 0x7f, 0xff, 0x90, 0xfe, 0x22, 0x00, 0x02, 0x00, 0x0b, 0x00, 0x06, 0x09,
+    0x00, 0xf0, 0x0d, 0x00, 0x02, 0x09, 0x00, 0x30, 0x82, 0xff, 0xbf, 0xfd, 0xf8, 0xff, 0x02, 0x00,
+    0x07, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x09, 0x00, 0x02, 0x09, 0x00, 0x30, 0xc1, 0xff, 0x60, 0x00,
+    0x04, 0x00, 0x02, 0x00, 0x0c, 0x0a, 0x09, 0x06, 0x00, 0xf0, 0x0f, 0x0a, 0x03, 0x06, 0x00, 0x30,
+    0x90, 0x00, 0xb5, 0xff, 0x88, 0x00, 0x02, 0x00, 0x02, 0x0b, 0x06, 0x09, 0x00, 0xf0, 0x05, 0x0b,
+    0x03, 0x09, 0x00, 0x20, 0xb7, 0xff, 0x01, 0xff, 0x29, 0x00, 0x02, 0x00, 0x0e, 0x05, 0x03, 0x13,
+    0x00, 0xf0, 0x0f, 0x05, 0x01, 0x13, 0x00, 0x30, 0xf3, 0xff, 0x0c, 0x00, 0x40, 0xff, 0x02, 0x00,
+    0x06, 0x06, 0x09, 0x06, 0x00, 0xf0, 0x06, 0x08, 0x09, 0x02, 0x00, 0x30, 0x40, 0x00, 0x26, 0x00,
+    0x59, 0xff, 0x02, 0x00, 0x0e, 0x05, 0x03, 0x13, 0x00, 0xf0, 0x0f, 0x05, 0x01, 0x13, 0x00, 0x30,
+    0x7a, 0x00, 0xfd, 0xff, 0xc6, 0xfe, 0x02, 0x00, 0x00, 0x03, 0x06, 0x09, 0x00, 0xf0, 0x00, 0x06,
+    0x06, 0x03, 0x00, 0x30, 0x0c, 0x00, 0xdc, 0xff, 0x6e, 0x00, 0x02, 0x00, 0x05, 0x15, 0x12, 0x03,
+    0x00, 0xf0, 0x05, 0x16, 0x12, 0x01, 0x00, 0x30, 0x5b, 0x01, 0xfc, 0xff, 0xcf, 0xfe, 0x02, 0x00,
+    0x01, 0x0a, 0x12, 0x04, 0x00, 0xf0, 0x07, 0x0a, 0x06, 0x04, 0x00, 0x30, 0x10, 0xff, 0x45, 0xfe,
+    0x24, 0x00, 0x03, 0x00, 0x0d, 0x04, 0x08, 0x0a, 0x00, 0xf0, 0x11, 0x04, 0x04, 0x05, 0x00, 0x20,
+    0x0d, 0x09, 0x04, 0x05, 0x00, 0x20, 0xb7, 0x00, 0xc3, 0xff, 0x8a, 0x00, 0x02, 0x00, 0x07, 0x08,
+    0x09, 0x06, 0x00, 0xf0, 0x0a, 0x08, 0x03, 0x06, 0x00, 0x30, 0xa5, 0x00, 0x01, 0x00, 0x90, 0x00,
+    0x02, 0x00, 0x0c, 0x09, 0x09, 0x08, 0x00, 0xf0, 0x0f, 0x09, 0x03, 0x08, 0x00, 0x30, 0x9a, 0x00,
+    0x09, 0x00, 0x35, 0xff, 0x02, 0x00, 0x00, 0x06, 0x05, 0x0c, 0x00, 0xf0, 0x00, 0x0a, 0x05, 0x04,
+    0x00, 0x30, 0xf8, 0x00, 0x13, 0x00, 0x7b, 0x01, 0x03, 0x00, 0x07, 0x06, 0x0e, 0x06, 0x00, 0xf0,
+    0x0e, 0x06, 0x07, 0x03, 0x00, 0x20, 0x07, 0x09, 0x07, 0x03, 0x00, 0x20, 0xaf, 0xff, 0x4e, 0xfe,
+    0xf9, 0xff, 0x02, 0x00, 0x07, 0x05, 0x03, 0x13, 0x00, 0xf0, 0x08, 0x05, 0x01, 0x13, 0x00, 0x30,
+    0x59, 0xfd, 0xa1, 0x00, 0x08, 0x00, 0x02, 0x00, 0x08, 0x04, 0x0f, 0x14, 0x00, 0xf0, 0x0d, 0x04,
+    0x05, 0x14, 0x00, 0x30, 0x1a, 0x01, 0xab, 0xff, 0x4c, 0x00, 0x02, 0x00, 0x01, 0x04, 0x0f, 0x14,
+    0x00, 0xf0, 0x06, 0x04, 0x05, 0x14, 0x00, 0x30, 0x2e, 0x00, 0x3a, 0x00, 0x9f, 0xff, 0x02, 0x00,
+    0x0d, 0x0a, 0x06, 0x06, 0x00, 0xf0, 0x0d, 0x0a, 0x03, 0x06, 0x00, 0x20, 0x06, 0x00, 0x31, 0x00,
+    0x79, 0xff, 0x02, 0x00, 0x05, 0x0a, 0x06, 0x06, 0x00, 0xf0, 0x08, 0x0a, 0x03, 0x06, 0x00, 0x20,
+    0x46, 0x01, 0x17, 0x00, 0x1a, 0x02, 0x03, 0x00, 0x0e, 0x02, 0x06, 0x0e, 0x00, 0xf0, 0x11, 0x02,
+    0x03, 0x07, 0x00, 0x20, 0x0e, 0x09, 0x03, 0x07, 0x00, 0x20, 0x16, 0xff, 0x42, 0xfe, 0xf6, 0xff,
+    0x03, 0x00, 0x04, 0x02, 0x06, 0x0e, 0x00, 0xf0, 0x04, 0x02, 0x03, 0x07, 0x00, 0x20, 0x07, 0x09,
+    0x03, 0x07, 0x00, 0x20, 0x1e, 0x00, 0xc3, 0xff, 0x5b, 0x00, 0x02, 0x00, 0x0c, 0x04, 0x06, 0x07,
+    0x00, 0xf0, 0x0c, 0x04, 0x03, 0x07, 0x00, 0x20, 0xb7, 0xff, 0x2d, 0x01, 0xd3, 0xff, 0x02, 0x00,
+    0x09, 0x04, 0x06, 0x09, 0x00, 0xf0, 0x0b, 0x04, 0x02, 0x09, 0x00, 0x30, 0x83, 0x01, 0x23, 0x00,
+    0xb4, 0xfe, 0x02, 0x00, 0x0b, 0x04, 0x08, 0x0a, 0x00, 0xf0, 0x0b, 0x04, 0x04, 0x0a, 0x00, 0x20,
+    0x16, 0x00, 0x75, 0xff, 0x23, 0x00, 0x02, 0x00, 0x05, 0x04, 0x08, 0x0a, 0x00, 0xf0, 0x09, 0x04,
+    0x04, 0x0a, 0x00, 0x20, 0x1c, 0x00, 0xc9, 0xff, 0x64, 0x00, 0x02, 0x00, 0x08, 0x12, 0x0a, 0x06,
+    0x00, 0xf0, 0x08, 0x14, 0x0a, 0x02, 0x00, 0x30, 0x8d, 0x00, 0x10, 0x00, 0x48, 0xff, 0x02, 0x00,
+    0x01, 0x12, 0x15, 0x06, 0x00, 0xf0, 0x01, 0x14, 0x15, 0x02, 0x00, 0x30, 0x2c, 0xff, 0xaf, 0x00,
+    0x10, 0x00, 0x02, 0x00, 0x09, 0x02, 0x0c, 0x06, 0x00, 0xf0, 0x09, 0x02, 0x06, 0x06, 0x00, 0x20,
+    0xe5, 0xfe, 0xbd, 0x01, 0xd6, 0xff, 0x02, 0x00, 0x03, 0x02, 0x0c, 0x06, 0x00, 0xf0, 0x09, 0x02,
+    0x06, 0x06, 0x00, 0x20, 0xea, 0xff, 0x4e, 0x00, 0xd6, 0xff, 0x03, 0x00, 0x0c, 0x05, 0x0c, 0x06,
+    0x00, 0xf0, 0x12, 0x05, 0x06, 0x03, 0x00, 0x20, 0x0c, 0x08, 0x06, 0x03, 0x00, 0x20, 0x18, 0x01,
+    0xca, 0xff, 0xbb, 0x00, 0x02, 0x00, 0x08, 0x08, 0x06, 0x09, 0x00, 0xf0, 0x08, 0x0b, 0x06, 0x03,
+    0x00, 0x30, 0xee, 0xfe, 0x35, 0xff, 0x34, 0x00, 0x02, 0x00, 0x02, 0x07, 0x14, 0x06, 0x00, 0xf0,
+    0x02, 0x09, 0x14, 0x02, 0x00, 0x30, 0xaa, 0xff, 0x5f, 0x00, 0xb5, 0xff, 0x03, 0x00, 0x00, 0x05,
+    0x0c, 0x06, 0x00, 0xf0, 0x00, 0x05, 0x06, 0x03, 0x00, 0x20, 0x06, 0x08, 0x06, 0x03, 0x00, 0x20,
+    0x53, 0x00, 0xfd, 0xff, 0x67, 0x00, 0x03, 0x00, 0x0e, 0x0e, 0x08, 0x0a, 0x00, 0xf0, 0x12, 0x0e,
+    0x04, 0x05, 0x00, 0x20, 0x0e, 0x13, 0x04, 0x05, 0x00, 0x20, 0x40, 0xff, 0x36, 0x01, 0xd4, 0xff,
+    0x03, 0x00, 0x02, 0x0e, 0x08, 0x0a, 0x00, 0xf0, 0x02, 0x0e, 0x04, 0x05, 0x00, 0x20, 0x06, 0x13,
+    0x04, 0x05, 0x00, 0x20, 0x00, 0x03, 0xfb, 0xff, 0xb2, 0x00, 0x02, 0x00, 0x02, 0x0b, 0x14, 0x0d,
+    0x00, 0xf0, 0x02, 0x0b, 0x0a, 0x0d, 0x00, 0x20, 0x4f, 0xff, 0xf1, 0xfe, 0x00, 0x00, 0x02, 0x00,
+    0x06, 0x09, 0x0c, 0x05, 0x00, 0xf0, 0x0c, 0x09, 0x06, 0x05, 0x00, 0x20, 0x51, 0x00, 0xf8, 0xff,
+    0x89, 0x00, 0x03, 0x00, 0x05, 0x06, 0x10, 0x06, 0x00, 0xf0, 0x0d, 0x06, 0x08, 0x03, 0x00, 0x20,
+    0x05, 0x09, 0x08, 0x03, 0x00, 0x20, 0x21, 0x00, 0x09, 0x00, 0x41, 0xff, 0x02, 0x00, 0x01, 0x13,
+    0x09, 0x04, 0x00, 0xf0, 0x01, 0x15, 0x09, 0x02, 0x00, 0x20, 0x6f, 0x00, 0xec, 0xff, 0x55, 0x00,
+    0x02, 0x00, 0x07, 0x05, 0x0c, 0x05, 0x00, 0xf0, 0x0b, 0x05, 0x04, 0x05, 0x00, 0x30, 0x89, 0xfe,
+    0x15, 0xfe, 0xf7, 0xff, 0x03, 0x00, 0x03, 0x05, 0x0e, 0x0c, 0x00, 0xf0, 0x03, 0x05, 0x07, 0x06,
+    0x00, 0x20, 0x0a, 0x0b, 0x07, 0x06, 0x00, 0x20, 0xcd, 0xff, 0x7b, 0x00, 0x04, 0x00, 0x02, 0x00,
+    0x09, 0x04, 0x09, 0x06, 0x00, 0xf0, 0x0c, 0x04, 0x03, 0x06, 0x00, 0x30, 0x3c, 0x00, 0xce, 0xff,
+    0xba, 0x00, 0x02, 0x00, 0x02, 0x06, 0x13, 0x03, 0x00, 0xf0, 0x02, 0x07, 0x13, 0x01, 0x00, 0x30,
+    0x77, 0x00, 0x32, 0x00, 0x83, 0xff, 0x02, 0x00, 0x12, 0x0a, 0x06, 0x09, 0x00, 0xf0, 0x12, 0x0d,
+    0x06, 0x03, 0x00, 0x30, 0x23, 0x00, 0xcf, 0xff, 0xc5, 0x00, 0x02, 0x00, 0x03, 0x07, 0x12, 0x02,
+    0x00, 0xf0, 0x03, 0x08, 0x12, 0x01, 0x00, 0x20, 0x20, 0xff, 0xcf, 0x01, 0x11, 0x00, 0x03, 0x00,
+    0x14, 0x02, 0x04, 0x12, 0x00, 0xf0, 0x16, 0x02, 0x02, 0x09, 0x00, 0x20, 0x14, 0x0b, 0x02, 0x09,
+    0x00, 0x20, 0xc4, 0xff, 0xc7, 0x00, 0xd1, 0xff, 0x02, 0x00, 0x02, 0x12, 0x14, 0x03, 0x00, 0xf0,
+    0x02, 0x13, 0x14, 0x01, 0x00, 0x30, 0x66, 0x00, 0x27, 0x00, 0x66, 0xfe, 0x02, 0x00, 0x01, 0x09,
+    0x16, 0x03, 0x00, 0xf0, 0x01, 0x0a, 0x16, 0x01, 0x00, 0x30, 0xbe, 0x00, 0xd6, 0xff, 0x30, 0x01,
+    0x03, 0x00, 0x00, 0x02, 0x04, 0x12, 0x00, 0xf0, 0x00, 0x02, 0x02, 0x09, 0x00, 0x20, 0x02, 0x0b,
+    0x02, 0x09, 0x00, 0x20, 0x48, 0x00, 0xe6, 0xff, 0x64, 0x00, 0x02, 0x00, 0x13, 0x00, 0x04, 0x17,
+    0x00, 0xf0, 0x13, 0x00, 0x02, 0x17, 0x00, 0x20, 0x9c, 0x02, 0xf7, 0xff, 0x64, 0xfe, 0x02, 0x00,
+    0x00, 0x03, 0x06, 0x13, 0x00, 0xf0, 0x03, 0x03, 0x03, 0x13, 0x00, 0x20, 0x35, 0x00, 0xf2, 0xff,
+    0x8a, 0x00, 0x02, 0x00, 0x12, 0x02, 0x06, 0x09, 0x00, 0xf0, 0x14, 0x02, 0x02, 0x09, 0x00, 0x30,
+    0xc0, 0xff, 0x47, 0x00, 0xaf, 0xff, 0x02, 0x00, 0x00, 0x05, 0x0a, 0x06, 0x00, 0xf0, 0x00, 0x07,
+    0x0a, 0x02, 0x00, 0x30, 0x49, 0x01, 0x20, 0x00, 0xf9, 0xfe, 0x03, 0x00, 0x07, 0x00, 0x0c, 0x0c,
+    0x00, 0xf0, 0x0d, 0x00, 0x06, 0x06, 0x00, 0x20, 0x07, 0x06, 0x06, 0x06, 0x00, 0x20, 0x90, 0x00,
+    0x05, 0x00, 0x36, 0xff, 0x03, 0x00, 0x00, 0x03, 0x18, 0x06, 0x00, 0xf0, 0x00, 0x03, 0x0c, 0x03,
+    0x00, 0x20, 0x0c, 0x06, 0x0c, 0x03, 0x00, 0x20, 0x87, 0x00, 0x30, 0x00, 0x2a, 0xff, 0x02, 0x00,
+    0x0a, 0x0e, 0x04, 0x0a, 0x00, 0xf0, 0x0a, 0x13, 0x04, 0x05, 0x00, 0x20, 0x31, 0x00, 0x12, 0x00,
+    0x60, 0xff, 0x02, 0x00, 0x08, 0x09, 0x04, 0x0f, 0x00, 0xf0, 0x08, 0x0e, 0x04, 0x05, 0x00, 0x30,
+    0xb0, 0x00, 0x0c, 0x00, 0x92, 0x01, 0x02, 0x00, 0x04, 0x0b, 0x11, 0x06, 0x00, 0xf0, 0x04, 0x0e,
+    0x11, 0x03, 0x00, 0x20, 0x7c, 0x00, 0xbb, 0xff, 0x62, 0x00, 0x03, 0x00, 0x02, 0x05, 0x12, 0x08,
+    0x00, 0xf0, 0x02, 0x05, 0x09, 0x04, 0x00, 0x20, 0x0b, 0x09, 0x09, 0x04, 0x00, 0x20, 0x91, 0x00,
+    0x0d, 0x00, 0x86, 0x00, 0x03, 0x00, 0x07, 0x06, 0x0e, 0x06, 0x00, 0xf0, 0x0e, 0x06, 0x07, 0x03,
+    0x00, 0x20, 0x07, 0x09, 0x07, 0x03, 0x00, 0x20, 0xc5, 0xff, 0x61, 0x00, 0xb8, 0xff, 0x03, 0x00,
+    0x03, 0x06, 0x0e, 0x06, 0x00, 0xf0, 0x03, 0x06, 0x07, 0x03, 0x00, 0x20, 0x0a, 0x09, 0x07, 0x03,
+    0x00, 0x20, 0x33, 0x00, 0x27, 0x00, 0xb2, 0xff, 0x02, 0x00, 0x10, 0x05, 0x03, 0x12, 0x00, 0xf0,
+    0x11, 0x05, 0x01, 0x12, 0x00, 0x30, 0x29, 0x00, 0x06, 0x00, 0x21, 0xff, 0x02, 0x00, 0x05, 0x05,
+    0x03, 0x12, 0x00, 0xf0, 0x06, 0x05, 0x01, 0x12, 0x00, 0x30, 0x76, 0x00, 0x29, 0x00, 0xcd, 0xff,
+    0x02, 0x00, 0x0a, 0x0a, 0x0e, 0x04, 0x00, 0xf0, 0x0a, 0x0c, 0x0e, 0x02, 0x00, 0x20, 0x02, 0x00,
+    0x63, 0xff, 0x14, 0x00, 0x02, 0x00, 0x04, 0x0a, 0x09, 0x04, 0x00, 0xf0, 0x04, 0x0c, 0x09, 0x02,
+    0x00, 0x20, 0x70, 0xfc, 0x7f, 0x00, 0xc6, 0x00, 0x27, 0xff, 0x91, 0x00, 0x02, 0x00, 0x02, 0x00,
+    0x12, 0x09, 0x00, 0xf0, 0x02, 0x03, 0x12, 0x03, 0x00, 0x30, 0x84, 0x00, 0x30, 0xff, 0x72, 0x00,
+    0x02, 0x00, 0x06, 0x03, 0x0c, 0x08, 0x00, 0xf0, 0x0a, 0x03, 0x04, 0x08, 0x00, 0x30, 0x88, 0x00,
+    0xa3, 0xff, 0xad, 0x00, 0x02, 0x00, 0x01, 0x01, 0x08, 0x05, 0x00, 0xf0, 0x05, 0x01, 0x04, 0x05,
+    0x00, 0x20, 0x1a, 0x00, 0xd0, 0xfe, 0x31, 0x00, 0x02, 0x00, 0x0c, 0x07, 0x07, 0x08, 0x00, 0xf0,
+    0x0c, 0x0b, 0x07, 0x04, 0x00, 0x20, 0xe9, 0xff, 0x54, 0x00, 0x4a, 0xff, 0x02, 0x00, 0x00, 0x0c,
+    0x16, 0x04, 0x00, 0xf0, 0x00, 0x0e, 0x16, 0x02, 0x00, 0x20, 0x34, 0x00, 0x7e, 0xff, 0x1d, 0x00,
+    0x02, 0x00, 0x0f, 0x06, 0x04, 0x0f, 0x00, 0xf0, 0x0f, 0x0b, 0x04, 0x05, 0x00, 0x30, 0x18, 0x00,
+    0xf4, 0xfe, 0x33, 0x00, 0x02, 0x00, 0x05, 0x07, 0x07, 0x08, 0x00, 0xf0, 0x05, 0x0b, 0x07, 0x04,
+    0x00, 0x20, 0x0a, 0x00, 0x7f, 0xff, 0x5d, 0x00, 0x02, 0x00, 0x08, 0x12, 0x09, 0x04, 0x00, 0xf0,
+    0x08, 0x14, 0x09, 0x02, 0x00, 0x20, 0xbb, 0xff, 0x02, 0xff, 0x20, 0x00, 0x02, 0x00, 0x01, 0x02,
+    0x16, 0x04, 0x00, 0xf0, 0x01, 0x04, 0x16, 0x02, 0x00, 0x20, 0x73, 0x00, 0xe8, 0xff, 0x93, 0x00,
+    0x02, 0x00, 0x11, 0x03, 0x06, 0x11, 0x00, 0xf0, 0x13, 0x03, 0x02, 0x11, 0x00, 0x30, 0x2a, 0x00,
+    0x3b, 0x00, 0x7a, 0xff, 0x02, 0x00, 0x08, 0x02, 0x08, 0x12, 0x00, 0xf0, 0x08, 0x0b, 0x08, 0x09,
+    0x00, 0x20, 0x28, 0x00, 0xe6, 0xff, 0x7a, 0x00, 0x03, 0x00, 0x11, 0x00, 0x06, 0x0c, 0x00, 0xf0,
+    0x14, 0x00, 0x03, 0x06, 0x00, 0x20, 0x11, 0x06, 0x03, 0x06, 0x00, 0x20, 0x6a, 0x00, 0x00, 0x00,
+    0x72, 0xfe, 0x02, 0x00, 0x07, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x09, 0x00, 0x02, 0x09, 0x00, 0x30,
+    0x98, 0xff, 0x59, 0xff, 0x30, 0x00, 0x02, 0x00, 0x0f, 0x05, 0x09, 0x0c, 0x00, 0xf0, 0x0f, 0x0b,
+    0x09, 0x06, 0x00, 0x20, 0xf2, 0xff, 0x48, 0x00, 0x8e, 0xff, 0x02, 0x00, 0x02, 0x16, 0x12, 0x02,
+    0x00, 0xf0, 0x02, 0x17, 0x12, 0x01, 0x00, 0x20, 0x25, 0x00, 0x27, 0x00, 0xca, 0xff, 0x03, 0x00,
+    0x0a, 0x0a, 0x0c, 0x06, 0x00, 0xf0, 0x10, 0x0a, 0x06, 0x03, 0x00, 0x20, 0x0a, 0x0d, 0x06, 0x03,
+    0x00, 0x20, 0x56, 0x00, 0xb6, 0xff, 0x85, 0x00, 0x02, 0x00, 0x00, 0x01, 0x04, 0x0b, 0x00, 0xf0,
+    0x02, 0x01, 0x02, 0x0b, 0x00, 0x20, 0x2f, 0xff, 0x5d, 0x01, 0x07, 0x00, 0x02, 0x00, 0x14, 0x00,
+    0x04, 0x0a, 0x00, 0xf0, 0x14, 0x00, 0x02, 0x0a, 0x00, 0x20, 0x01, 0xff, 0x38, 0x01, 0xc7, 0xff,
+    0x02, 0x00, 0x01, 0x03, 0x06, 0x11, 0x00, 0xf0, 0x03, 0x03, 0x02, 0x11, 0x00, 0x30, 0x79, 0xff,
+    0x2f, 0xff, 0x25, 0x00, 0x02, 0x00, 0x0f, 0x0f, 0x09, 0x06, 0x00, 0xf0, 0x0f, 0x11, 0x09, 0x02,
+    0x00, 0x30, 0x67, 0xff, 0xc8, 0xfe, 0x04, 0x00, 0x02, 0x00, 0x00, 0x0d, 0x08, 0x09, 0x00, 0xf0,
+    0x00, 0x10, 0x08, 0x03, 0x00, 0x30, 0xfc, 0x01, 0x1e, 0x00, 0x04, 0xff, 0x02, 0x00, 0x10, 0x08,
+    0x06, 0x0c, 0x00, 0xf0, 0x10, 0x0c, 0x06, 0x04, 0x00, 0x30, 0xdc, 0xff, 0xd5, 0xfe, 0x05, 0x00,
+    0x02, 0x00, 0x02, 0x08, 0x06, 0x0c, 0x00, 0xf0, 0x02, 0x0c, 0x06, 0x04, 0x00, 0x30, 0x0b, 0xff,
+    0xef, 0xfe, 0x32, 0x00, 0x02, 0x00, 0x0a, 0x02, 0x04, 0x0f, 0x00, 0xf0, 0x0a, 0x07, 0x04, 0x05,
+    0x00, 0x30, 0x19, 0x00, 0xa4, 0xff, 0x61, 0x00, 0x02, 0x00, 0x01, 0x05, 0x13, 0x03, 0x00, 0xf0,
+    0x01, 0x06, 0x13, 0x01, 0x00, 0x30, 0xb8, 0xff, 0x7d, 0x00, 0xdb, 0xff, 0x02, 0x00, 0x0b, 0x08,
+    0x09, 0x07, 0x00, 0xf0, 0x0e, 0x08, 0x03, 0x07, 0x00, 0x30, 0x48, 0x00, 0x96, 0x00, 0xb9, 0xff,
+    0x02, 0x00, 0x03, 0x08, 0x0c, 0x09, 0x00, 0xf0, 0x03, 0x0b, 0x0c, 0x03, 0x00, 0x30, 0x15, 0x00,
+    0xed, 0xff, 0x9a, 0x00, 0x02, 0x00, 0x03, 0x06, 0x12, 0x03, 0x00, 0xf0, 0x03, 0x07, 0x12, 0x01,
+    0x00, 0x30, 0xd5, 0xff, 0x46, 0x00, 0xa0, 0xff, 0x02, 0x00, 0x0a, 0x00, 0x04, 0x0c, 0x00, 0xf0,
+    0x0a, 0x06, 0x04, 0x06, 0x00, 0x20, 0x57, 0x03, 0xff, 0xff, 0x08, 0x01, 0x02, 0x00, 0x03, 0x09,
+    0x12, 0x0e, 0x00, 0xf0, 0x03, 0x09, 0x09, 0x0e, 0x00, 0x20, 0x94, 0xff, 0xd2, 0x00, 0xc7, 0xff,
+    0x02, 0x00, 0x00, 0x00, 0x04, 0x09, 0x00, 0xf0, 0x02, 0x00, 0x02, 0x09, 0x00, 0x20, 0xf1, 0x00,
+    0x21, 0x00, 0xd1, 0xfe, 0x02, 0x00, 0x0c, 0x05, 0x04, 0x12, 0x00, 0xf0, 0x0c, 0x05, 0x02, 0x12,
+    0x00, 0x20, 0xd1, 0xff, 0x18, 0xff, 0x0b, 0x00, 0x02, 0x00, 0x08, 0x05, 0x04, 0x12, 0x00, 0xf0,
+    0x0a, 0x05, 0x02, 0x12, 0x00, 0x20, 0xbc, 0x00, 0x02, 0x00, 0x12, 0x01, 0x02, 0x00, 0x0a, 0x05,
+    0x06, 0x0a, 0x00, 0xf0, 0x0c, 0x05, 0x02, 0x0a, 0x00, 0x30, 0xa3, 0xff, 0xc7, 0x01, 0xd4, 0xff,
+    0x02, 0x00, 0x09, 0x04, 0x04, 0x0b, 0x00, 0xf0, 0x0b, 0x04, 0x02, 0x0b, 0x00, 0x20, 0xdf, 0xff,
+    0x92, 0x00, 0xee, 0xff, 0x02, 0x00, 0x04, 0x10, 0x12, 0x03, 0x00, 0xf0, 0x04, 0x11, 0x12, 0x01,
+    0x00, 0x30, 0x0e, 0x00, 0xae, 0xff, 0x66, 0x00, 0x02, 0x00, 0x00, 0x10, 0x14, 0x03, 0x00, 0xf0,
+    0x00, 0x11, 0x14, 0x01, 0x00, 0x30, 0xca, 0x00, 0x31, 0x00, 0xc9, 0xfe, 0x02, 0x00, 0x09, 0x09,
+    0x06, 0x0c, 0x00, 0xf0, 0x09, 0x0d, 0x06, 0x04, 0x00, 0x30, 0x0e, 0x00, 0x11, 0x00, 0x4a, 0xff,
+    0x02, 0x00, 0x08, 0x0d, 0x08, 0x08, 0x00, 0xf0, 0x08, 0x11, 0x08, 0x04, 0x00, 0x20, 0x82, 0xff,
+    0x9d, 0xff, 0x2e, 0x00, 0x02, 0x00, 0x0d, 0x0a, 0x03, 0x0c, 0x00, 0xf0, 0x0d, 0x10, 0x03, 0x06,
+    0x00, 0x20, 0x62, 0x01, 0xfa, 0xff, 0x75, 0xfe, 0x03, 0x00, 0x05, 0x09, 0x0e, 0x0e, 0x00, 0xf0,
+    0x05, 0x09, 0x07, 0x07, 0x00, 0x20, 0x0c, 0x10, 0x07, 0x07, 0x00, 0x20, 0xd1, 0xfd, 0x15, 0xfe,
+    0x2a, 0x00, 0x03, 0x00, 0x00, 0x00, 0x18, 0x0a, 0x00, 0xf0, 0x0c, 0x00, 0x0c, 0x05, 0x00, 0x20,
+    0x00, 0x05, 0x0c, 0x05, 0x00, 0x20, 0xe9, 0xff, 0xb8, 0xfe, 0xfc, 0xff, 0x02, 0x00, 0x01, 0x0b,
+    0x12, 0x02, 0x00, 0xf0, 0x01, 0x0c, 0x12, 0x01, 0x00, 0x20, 0xb7, 0xff, 0x99, 0xff, 0x3c, 0x00,
+    0x02, 0x00, 0x13, 0x05, 0x05, 0x0c, 0x00, 0xf0, 0x13, 0x09, 0x05, 0x04, 0x00, 0x30, 0xaf, 0xff,
+    0x46, 0xff, 0x0e, 0x00, 0x02, 0x00, 0x00, 0x05, 0x05, 0x0c, 0x00, 0xf0, 0x00, 0x09, 0x05, 0x04,
+    0x00, 0x30, 0x15, 0xff, 0x94, 0x00, 0xfc, 0xff, 0x03, 0x00, 0x10, 0x06, 0x08, 0x12, 0x00, 0xf0,
+    0x14, 0x06, 0x04, 0x09, 0x00, 0x20, 0x10, 0x0f, 0x04, 0x09, 0x00, 0x20, 0xac, 0xfe, 0xea, 0x00,
+    0xca, 0xff, 0x03, 0x00, 0x00, 0x06, 0x08, 0x12, 0x00, 0xf0, 0x00, 0x06, 0x04, 0x09, 0x00, 0x20,
+    0x04, 0x0f, 0x04, 0x09, 0x00, 0x20, 0x24, 0xff, 0x7c, 0xff, 0x2f, 0x00, 0x03, 0x00, 0x0c, 0x05,
+    0x0c, 0x0c, 0x00, 0xf0, 0x12, 0x05, 0x06, 0x06, 0x00, 0x20, 0x0c, 0x0b, 0x06, 0x06, 0x00, 0x20,
+    0xde, 0xff, 0x3d, 0x00, 0x9b, 0xff, 0x02, 0x00, 0x07, 0x06, 0x06, 0x09, 0x00, 0xf0, 0x09, 0x06,
+    0x02, 0x09, 0x00, 0x30, 0xe2, 0x00, 0x2a, 0x00, 0x6f, 0xfd, 0x02, 0x00, 0x09, 0x0d, 0x06, 0x0b,
+    0x00, 0xf0, 0x0b, 0x0d, 0x02, 0x0b, 0x00, 0x30, 0xed, 0xfe, 0xa3, 0xfe, 0xfd, 0xff, 0x03, 0x00,
+    0x00, 0x05, 0x0c, 0x0c, 0x00, 0xf0, 0x00, 0x05, 0x06, 0x06, 0x00, 0x20, 0x06, 0x0b, 0x06, 0x06,
+    0x00, 0x20, 0x9f, 0xff, 0x4b, 0xfe, 0x2a, 0x00, 0x02, 0x00, 0x01, 0x02, 0x17, 0x03, 0x00, 0xf0,
+    0x01, 0x03, 0x17, 0x01, 0x00, 0x30, 0x16, 0x00, 0xb0, 0xff, 0x54, 0x00, 0x02, 0x00, 0x01, 0x0f,
+    0x13, 0x03, 0x00, 0xf0, 0x01, 0x10, 0x13, 0x01, 0x00, 0x30, 0x57, 0x00, 0x26, 0x00, 0x84, 0xff,
+    0x02, 0x00, 0x0d, 0x11, 0x0b, 0x04, 0x00, 0xf0, 0x0d, 0x13, 0x0b, 0x02, 0x00, 0x20, 0x9c, 0xff,
+    0xbe, 0x00, 0xc7, 0xff, 0x02, 0x00, 0x00, 0x0d, 0x08, 0x05, 0x00, 0xf0, 0x04, 0x0d, 0x04, 0x05,
+    0x00, 0x20, 0xb0, 0xff, 0x98, 0xff, 0x30, 0x00, 0x02, 0x00, 0x0c, 0x0a, 0x0a, 0x04, 0x00, 0xf0,
+    0x0c, 0x0a, 0x05, 0x04, 0x00, 0x20, 0x26, 0xff, 0xd0, 0x00, 0xcb, 0xff, 0x02, 0x00, 0x04, 0x06,
+    0x09, 0x09, 0x00, 0xf0, 0x04, 0x09, 0x09, 0x03, 0x00, 0x30, 0x1d, 0x00, 0x54, 0x00, 0x67, 0xff,
+    0x02, 0x00, 0x0f, 0x0e, 0x09, 0x06, 0x00, 0xf0, 0x0f, 0x10, 0x09, 0x02, 0x00, 0x30, 0xa4, 0xff,
+    0xbf, 0xfe, 0xfb, 0xff, 0x02, 0x00, 0x01, 0x0c, 0x09, 0x06, 0x00, 0xf0, 0x01, 0x0e, 0x09, 0x02,
+    0x00, 0x30, 0xaf, 0xfe, 0x61, 0x01, 0x0f, 0x00, 0x03, 0x00, 0x03, 0x0a, 0x14, 0x08, 0x00, 0xf0,
+    0x0d, 0x0a, 0x0a, 0x04, 0x00, 0x20, 0x03, 0x0e, 0x0a, 0x04, 0x00, 0x20, 0x18, 0x02, 0xf7, 0xff,
+    0x76, 0xfe, 0x02, 0x00, 0x02, 0x00, 0x09, 0x12, 0x00, 0xf0, 0x05, 0x00, 0x03, 0x12, 0x00, 0x30,
+    0x3a, 0x00, 0xd1, 0xff, 0x5f, 0x00, 0x02, 0x00, 0x0d, 0x0b, 0x09, 0x0a, 0x00, 0xf0, 0x10, 0x0b,
+    0x03, 0x0a, 0x00, 0x30, 0x1a, 0x00, 0x8e, 0xff, 0x23, 0x00, 0x02, 0x00, 0x01, 0x02, 0x08, 0x05,
+    0x00, 0xf0, 0x05, 0x02, 0x04, 0x05, 0x00, 0x20, 0x44, 0xff, 0xad, 0x00, 0xfc, 0xff, 0x02, 0x00,
+    0x03, 0x04, 0x15, 0x06, 0x00, 0xf0, 0x0a, 0x04, 0x07, 0x06, 0x00, 0x30, 0xec, 0x00, 0xfd, 0xff,
+    0xc7, 0xfe, 0x03, 0x00, 0x07, 0x00, 0x0a, 0x0e, 0x00, 0xf0, 0x07, 0x00, 0x05, 0x07, 0x00, 0x20,
+    0x0c, 0x07, 0x05, 0x07, 0x00, 0x20, 0xe8, 0xff, 0x56, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0c, 0x11,
+    0x0c, 0x04, 0x00, 0xf0, 0x0c, 0x13, 0x0c, 0x02, 0x00, 0x20, 0x2b, 0xff, 0xf1, 0xfe, 0xfd, 0xff,
+    0x02, 0x00, 0x00, 0x06, 0x17, 0x04, 0x00, 0xf0, 0x00, 0x08, 0x17, 0x02, 0x00, 0x20, 0xbe, 0x00,
+    0x25, 0x00, 0xc3, 0xfe, 0x03, 0x00, 0x0d, 0x0a, 0x08, 0x0a, 0x00, 0xf0, 0x11, 0x0a, 0x04, 0x05,
+    0x00, 0x20, 0x0d, 0x0f, 0x04, 0x05, 0x00, 0x20, 0x1e, 0x00, 0xc2, 0xff, 0x83, 0x00, 0x02, 0x00,
+    0x00, 0x10, 0x12, 0x03, 0x00, 0xf0, 0x00, 0x11, 0x12, 0x01, 0x00, 0x30, 0x58, 0x00, 0x21, 0x00,
+    0x4b, 0xff, 0x02, 0x00, 0x0f, 0x10, 0x09, 0x04, 0x00, 0xf0, 0x0f, 0x12, 0x09, 0x02, 0x00, 0x20,
+    0xb7, 0xff, 0xf4, 0xfe, 0x00, 0x00, 0x02, 0x00, 0x00, 0x10, 0x09, 0x04, 0x00, 0xf0, 0x00, 0x12,
+    0x09, 0x02, 0x00, 0x20, 0x68, 0xff, 0x7d, 0xfe, 0x25, 0x00, 0x02, 0x00, 0x0d, 0x0b, 0x06, 0x06,
+    0x00, 0xf0, 0x0d, 0x0b, 0x03, 0x06, 0x00, 0x20, 0xff, 0xff, 0x23, 0x00, 0x89, 0xff, 0x02, 0x00,
+    0x05, 0x0b, 0x06, 0x06, 0x00, 0xf0, 0x08, 0x0b, 0x03, 0x06, 0x00, 0x20, 0x66, 0x00, 0x49, 0x00,
+    0x96, 0xff, 0x03, 0x00, 0x00, 0x03, 0x18, 0x06, 0x00, 0xf0, 0x0c, 0x03, 0x0c, 0x03, 0x00, 0x20,
+    0x00, 0x06, 0x0c, 0x03, 0x00, 0x20, 0x26, 0x00, 0xbb, 0xff, 0x6f, 0x00, 0x02, 0x00, 0x02, 0x04,
+    0x12, 0x03, 0x00, 0xf0, 0x02, 0x05, 0x12, 0x01, 0x00, 0x30, 0x84, 0x00, 0x2f, 0x00, 0x0d, 0xff,
+    0x03, 0x00, 0x00, 0x00, 0x18, 0x04, 0x00, 0xf0, 0x0c, 0x00, 0x0c, 0x02, 0x00, 0x20, 0x00, 0x02,
+    0x0c, 0x02, 0x00, 0x20, 0xe7, 0xff, 0x53, 0x00, 0xb2, 0xff, 0x02, 0x00, 0x01, 0x10, 0x12, 0x03,
+    0x00, 0xf0, 0x01, 0x11, 0x12, 0x01, 0x00, 0x30, 0xd2, 0x00, 0x1d, 0x00, 0x06, 0xfe, 0x02, 0x00,
+    0x0f, 0x0f, 0x09, 0x06, 0x00, 0xf0, 0x0f, 0x11, 0x09, 0x02, 0x00, 0x30, 0x94, 0xff, 0xe5, 0xfe,
+    0xfe, 0xff, 0x02, 0x00, 0x00, 0x0f, 0x09, 0x06, 0x00, 0xf0, 0x00, 0x11, 0x09, 0x02, 0x00, 0x30,
+    0xc1, 0xff, 0xcd, 0x00, 0xf8, 0xff, 0x02, 0x00, 0x06, 0x11, 0x12, 0x03, 0x00, 0xf0, 0x06, 0x12,
+    0x12, 0x01, 0x00, 0x30, 0x4f, 0x00, 0xbd, 0xff, 0x63, 0x00, 0x02, 0x00, 0x08, 0x08, 0x06, 0x0a,
+    0x00, 0xf0, 0x0a, 0x08, 0x02, 0x0a, 0x00, 0x30, 0x89, 0x00, 0x04, 0x00, 0x96, 0x00, 0x02, 0x00,
+    0x0a, 0x06, 0x06, 0x09, 0x00, 0xf0, 0x0c, 0x06, 0x02, 0x09, 0x00, 0x30, 0x76, 0x00, 0x03, 0x00,
+    0x0e, 0xff, 0x02, 0x00, 0x08, 0x08, 0x05, 0x08, 0x00, 0xf0, 0x08, 0x0c, 0x05, 0x04, 0x00, 0x20,
+    0x00, 0x00, 0xb2, 0xff, 0x36, 0x00, 0x02, 0x00, 0x0c, 0x08, 0x06, 0x08, 0x00, 0xf0, 0x0c, 0x0c,
+    0x06, 0x04, 0x00, 0x20, 0x37, 0xff, 0x65, 0xfe, 0xf9, 0xff, 0x02, 0x00, 0x06, 0x05, 0x06, 0x0b,
+    0x00, 0xf0, 0x08, 0x05, 0x02, 0x0b, 0x00, 0x30, 0x39, 0x01, 0x13, 0x00, 0x29, 0x01, 0x02, 0x00,
+    0x0d, 0x06, 0x08, 0x09, 0x00, 0xf0, 0x0d, 0x09, 0x08, 0x03, 0x00, 0x30, 0x61, 0x00, 0xff, 0xff,
+    0xe3, 0xfe, 0x02, 0x00, 0x01, 0x07, 0x15, 0x06, 0x00, 0xf0, 0x01, 0x09, 0x15, 0x02, 0x00, 0x30,
+    0x0f, 0x00, 0xc3, 0xff, 0x35, 0x00, 0x02, 0x00, 0x0f, 0x05, 0x03, 0x0c, 0x00, 0xf0, 0x0f, 0x0b,
+    0x03, 0x06, 0x00, 0x20, 0x92, 0xfe, 0xea, 0x01, 0xd8, 0xff, 0x02, 0x00, 0x06, 0x09, 0x0b, 0x0c,
+    0x00, 0xf0, 0x06, 0x0d, 0x0b, 0x04, 0x00, 0x30, 0xc3, 0xff, 0xc0, 0xff, 0x2e, 0x00, 0x03, 0x00,
+    0x0d, 0x08, 0x0a, 0x08, 0x00, 0xf0, 0x12, 0x08, 0x05, 0x04, 0x00, 0x20, 0x0d, 0x0c, 0x05, 0x04,
+    0x00, 0x20, 0xd3, 0xff, 0x4f, 0xff, 0x0b, 0x00, 0x02, 0x00, 0x05, 0x08, 0x0c, 0x03, 0x00, 0xf0,
+    0x0b, 0x08, 0x06, 0x03, 0x00, 0x20, 0x83, 0x01, 0x2e, 0x00, 0x41, 0xff, 0x02, 0x00, 0x06, 0x0b,
+    0x12, 0x04, 0x00, 0xf0, 0x0c, 0x0b, 0x06, 0x04, 0x00, 0x30, 0xce, 0x08, 0xf9, 0xff, 0x54, 0xfe,
+    0x02, 0x00, 0x00, 0x00, 0x16, 0x16, 0x00, 0xf0, 0x00, 0x0b, 0x16, 0x0b, 0x00, 0x20, 0xa9, 0x00,
+    0x10, 0x00, 0xc3, 0x00, 0x02, 0x00, 0x0b, 0x02, 0x06, 0x08, 0x00, 0xf0, 0x0b, 0x06, 0x06, 0x04,
+    0x00, 0x20, 0x65, 0x00, 0x02, 0x00, 0x1e, 0xff, 0x02, 0x00, 0x09, 0x00, 0x06, 0x09, 0x00, 0xf0,
+    0x0b, 0x00, 0x02, 0x09, 0x00, 0x30, 0xd0, 0x00, 0x26, 0x00, 0x8a, 0xfd, 0x02, 0x00, 0x0a, 0x00,
+    0x06, 0x09, 0x00, 0xf0, 0x0c, 0x00, 0x02, 0x09, 0x00, 0x30, 0xbb, 0xff, 0x63, 0x00, 0xb4, 0xff,
+    0x03, 0x00, 0x08, 0x03, 0x06, 0x0e, 0x00, 0xf0, 0x08, 0x03, 0x03, 0x07, 0x00, 0x20, 0x0b, 0x0a,
+    0x03, 0x07, 0x00, 0x20, 0x0e, 0xfe, 0x73, 0xfe, 0x29, 0x00, 0x02, 0x00, 0x03, 0x0a, 0x12, 0x08,
+    0x00, 0xf0, 0x09, 0x0a, 0x06, 0x08, 0x00, 0x30, 0xf2, 0xff, 0x37, 0x00, 0xa1, 0xff, 0x02, 0x00,
+    0x0a, 0x00, 0x03, 0x0e, 0x00, 0xf0, 0x0a, 0x07, 0x03, 0x07, 0x00, 0x20, 0xda, 0x01, 0xf4, 0xff,
+    0x98, 0x00, 0x02, 0x00, 0x04, 0x03, 0x10, 0x14, 0x00, 0xf0, 0x04, 0x0d, 0x10, 0x0a, 0x00, 0x20,
+    0x97, 0x00, 0xbf, 0xff, 0x8d, 0x00, 0x02, 0x00, 0x09, 0x04, 0x06, 0x0a, 0x00, 0xf0, 0x0b, 0x04,
+    0x02, 0x0a, 0x00, 0x30, 0x2f, 0x00, 0xd2, 0xff, 0x68, 0x00, 0x02, 0x00, 0x05, 0x00, 0x10, 0x04,
+    0x00, 0xf0, 0x05, 0x02, 0x10, 0x02, 0x00, 0x20, 0xae, 0xff, 0x8b, 0x00, 0xc4, 0xff, 0x02, 0x00,
+    0x02, 0x05, 0x12, 0x04, 0x00, 0xf0, 0x08, 0x05, 0x06, 0x04, 0x00, 0x30, 0x8b, 0xff, 0x4f, 0xff,
+    0x28, 0x00, 0x02, 0x00, 0x0d, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x0f, 0x00, 0x02, 0x09, 0x00, 0x30,
+    0xe9, 0xff, 0x4b, 0x00, 0xa9, 0xff, 0x02, 0x00, 0x08, 0x04, 0x08, 0x05, 0x00, 0xf0, 0x0c, 0x04,
+    0x04, 0x05, 0x00, 0x20, 0x1d, 0xff, 0xec, 0x00, 0x18, 0x00, 0x02, 0x00, 0x0c, 0x0a, 0x0a, 0x04,
+    0x00, 0xf0, 0x0c, 0x0a, 0x05, 0x04, 0x00, 0x20, 0xc4, 0xff, 0x35, 0xff, 0x08, 0x00, 0x02, 0x00,
+    0x02, 0x0a, 0x0a, 0x04, 0x00, 0xf0, 0x07, 0x0a, 0x05, 0x04, 0x00, 0x20, 0xe3, 0xff, 0x54, 0x00,
+    0xf3, 0xff, 0x02, 0x00, 0x07, 0x0b, 0x0c, 0x05, 0x00, 0xf0, 0x0b, 0x0b, 0x04, 0x05, 0x00, 0x30,
+    0x48, 0xff, 0xa1, 0xfe, 0xfb, 0xff, 0x03, 0x00, 0x03, 0x0a, 0x08, 0x0a, 0x00, 0xf0, 0x03, 0x0a,
+    0x04, 0x05, 0x00, 0x20, 0x07, 0x0f, 0x04, 0x05, 0x00, 0x20, 0x07, 0x01, 0x10, 0x00, 0xea, 0x00,
+    0x02, 0x00, 0x0b, 0x0c, 0x09, 0x08, 0x00, 0xf0, 0x0e, 0x0c, 0x03, 0x08, 0x00, 0x30, 0xc4, 0xff,
+    0x5c, 0x00, 0xb7, 0xff, 0x02, 0x00, 0x00, 0x15, 0x18, 0x03, 0x00, 0xf0, 0x08, 0x15, 0x08, 0x03,
+    0x00, 0x30, 0xb8, 0x00, 0xd9, 0xff, 0x88, 0x00, 0x02, 0x00, 0x03, 0x14, 0x12, 0x04, 0x00, 0xf0,
+    0x09, 0x14, 0x06, 0x04, 0x00, 0x30, 0xfc, 0xff, 0x22, 0x00, 0x8f, 0xff, 0x02, 0x00, 0x01, 0x0f,
+    0x09, 0x06, 0x00, 0xf0, 0x01, 0x11, 0x09, 0x02, 0x00, 0x30, 0xca, 0x00, 0x1b, 0x00, 0x71, 0xfd,
+    0x02, 0x00, 0x0b, 0x11, 0x0a, 0x04, 0x00, 0xf0, 0x0b, 0x13, 0x0a, 0x02, 0x00, 0x20, 0x77, 0x00,
+    0xfe, 0xff, 0xe5, 0xfe, 0x02, 0x00, 0x09, 0x0c, 0x04, 0x0c, 0x00, 0xf0, 0x09, 0x12, 0x04, 0x06,
+    0x00, 0x20, 0x8e, 0x00, 0x00, 0x00, 0x91, 0x00, 0x02, 0x00, 0x09, 0x06, 0x09, 0x06, 0x00, 0xf0,
+    0x0c, 0x06, 0x03, 0x06, 0x00, 0x30, 0xe7, 0xff, 0x88, 0xff, 0x20, 0x00, 0x02, 0x00, 0x01, 0x0d,
+    0x06, 0x09, 0x00, 0xf0, 0x01, 0x10, 0x06, 0x03, 0x00, 0x30, 0x3f, 0x00, 0xfe, 0xff, 0xdf, 0x00,
+    0x02, 0x00, 0x06, 0x10, 0x0c, 0x04, 0x00, 0xf0, 0x06, 0x12, 0x0c, 0x02, 0x00, 0x20, 0x0b, 0x00,
+    0xa8, 0xff, 0x35, 0x00, 0x02, 0x00, 0x01, 0x05, 0x14, 0x03, 0x00, 0xf0, 0x01, 0x06, 0x14, 0x01,
+    0x00, 0x30, 0x25, 0xff, 0x7f, 0x01, 0x0e, 0x00, 0x02, 0x00, 0x08, 0x01, 0x09, 0x09, 0x00, 0xf0,
+    0x08, 0x04, 0x09, 0x03, 0x00, 0x30, 0xb2, 0xff, 0x02, 0xff, 0xfe, 0xff, 0x02, 0x00, 0x02, 0x13,
+    0x09, 0x04, 0x00, 0xf0, 0x02, 0x15, 0x09, 0x02, 0x00, 0x20, 0x1e, 0xff, 0x6d, 0xff, 0x2b, 0x00,
+    0x02, 0x00, 0x0b, 0x01, 0x04, 0x12, 0x00, 0xf0, 0x0b, 0x07, 0x04, 0x06, 0x00, 0x30, 0xe6, 0x00,
+    0xf8, 0xff, 0x9d, 0xfe, 0x03, 0x00, 0x07, 0x02, 0x08, 0x0c, 0x00, 0xf0, 0x07, 0x02, 0x04, 0x06,
+    0x00, 0x20, 0x0b, 0x08, 0x04, 0x06, 0x00, 0x20, 0x9f, 0xff, 0x66, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0x0b, 0x0a, 0x09, 0x08, 0x00, 0xf0, 0x0e, 0x0a, 0x03, 0x08, 0x00, 0x30, 0x07, 0x00, 0x2e, 0x00,
+    0x96, 0xff, 0x02, 0x00, 0x05, 0x0b, 0x0c, 0x05, 0x00, 0xf0, 0x09, 0x0b, 0x04, 0x05, 0x00, 0x30,
+    0x66, 0xff, 0x8b, 0x00, 0x04, 0x00, 0x02, 0x00, 0x0b, 0x09, 0x09, 0x06, 0x00, 0xf0, 0x0e, 0x09,
+    0x03, 0x06, 0x00, 0x30, 0x9e, 0xff, 0xae, 0x00, 0xce, 0xff, 0x02, 0x00, 0x05, 0x0a, 0x06, 0x09,
+    0x00, 0xf0, 0x07, 0x0a, 0x02, 0x09, 0x00, 0x30, 0x4d, 0xfc, 0x87, 0x00, 0x70, 0x00, 0x1a, 0xff,
+    0x84, 0x00, 0x02, 0x00, 0x04, 0x07, 0x05, 0x0c, 0x00, 0xf0, 0x04, 0x0b, 0x05, 0x04, 0x00, 0x30,
+    0xd9, 0x01, 0x70, 0xff, 0xb4, 0x00, 0x02, 0x00, 0x02, 0x00, 0x15, 0x06, 0x00, 0xf0, 0x09, 0x00,
+    0x07, 0x06, 0x00, 0x30, 0xa5, 0xff, 0x5c, 0x00, 0x55, 0xff, 0x02, 0x00, 0x07, 0x06, 0x0a, 0x06,
+    0x00, 0xf0, 0x07, 0x08, 0x0a, 0x02, 0x00, 0x30, 0x36, 0x00, 0x72, 0xff, 0x5b, 0x00, 0x02, 0x00,
+    0x09, 0x00, 0x06, 0x0f, 0x00, 0xf0, 0x0b, 0x00, 0x02, 0x0f, 0x00, 0x30, 0xf1, 0xff, 0xee, 0xfe,
+    0x30, 0x00, 0x02, 0x00, 0x02, 0x02, 0x12, 0x02, 0x00, 0xf0, 0x02, 0x03, 0x12, 0x01, 0x00, 0x20,
+    0xf6, 0xff, 0x49, 0xff, 0x43, 0x00, 0x02, 0x00, 0x08, 0x11, 0x08, 0x06, 0x00, 0xf0, 0x08, 0x14,
+    0x08, 0x03, 0x00, 0x20, 0x0d, 0x00, 0x88, 0xff, 0x44, 0x00, 0x02, 0x00, 0x03, 0x00, 0x12, 0x02,
+    0x00, 0xf0, 0x03, 0x01, 0x12, 0x01, 0x00, 0x20, 0x9a, 0x00, 0x36, 0x00, 0xec, 0xfe, 0x02, 0x00,
+    0x08, 0x00, 0x09, 0x06, 0x00, 0xf0, 0x0b, 0x00, 0x03, 0x06, 0x00, 0x30, 0xc8, 0xff, 0xab, 0x00,
+    0xb9, 0xff, 0x02, 0x00, 0x00, 0x11, 0x12, 0x03, 0x00, 0xf0, 0x00, 0x12, 0x12, 0x01, 0x00, 0x30,
+    0xf5, 0xff, 0x0c, 0xff, 0x3d, 0x00, 0x02, 0x00, 0x06, 0x07, 0x0c, 0x05, 0x00, 0xf0, 0x0a, 0x07,
+    0x04, 0x05, 0x00, 0x30, 0x63, 0xff, 0xd0, 0x00, 0xc1, 0xff, 0x02, 0x00, 0x00, 0x03, 0x06, 0x09,
+    0x00, 0xf0, 0x02, 0x03, 0x02, 0x09, 0x00, 0x30, 0x72, 0xff, 0x3b, 0x01, 0x01, 0x00, 0x02, 0x00,
+    0x14, 0x02, 0x04, 0x09, 0x00, 0xf0, 0x14, 0x02, 0x02, 0x09, 0x00, 0x20, 0x5f, 0x00, 0xb2, 0xff,
+    0xb5, 0x00, 0x02, 0x00, 0x00, 0x02, 0x04, 0x09, 0x00, 0xf0, 0x02, 0x02, 0x02, 0x09, 0x00, 0x20,
+    0x8f, 0x00, 0x36, 0x00, 0x90, 0xfe, 0x03, 0x00, 0x00, 0x01, 0x18, 0x04, 0x00, 0xf0, 0x0c, 0x01,
+    0x0c, 0x02, 0x00, 0x20, 0x00, 0x03, 0x0c, 0x02, 0x00, 0x20, 0xca, 0xff, 0x19, 0xff, 0x0c, 0x00,
+    0x02, 0x00, 0x00, 0x10, 0x09, 0x06, 0x00, 0xf0, 0x00, 0x12, 0x09, 0x02, 0x00, 0x30, 0x34, 0x00,
+    0x39, 0x00, 0x8e, 0xff, 0x02, 0x00, 0x0e, 0x0d, 0x09, 0x06, 0x00, 0xf0, 0x0e, 0x0f, 0x09, 0x02,
+    0x00, 0x30, 0x0e, 0x00, 0x9b, 0xff, 0x58, 0x00, 0x02, 0x00, 0x00, 0x0f, 0x13, 0x03, 0x00, 0xf0,
+    0x00, 0x10, 0x13, 0x01, 0x00, 0x30, 0x9c, 0x01, 0x2f, 0x00, 0xa9, 0xfe, 0x03, 0x00, 0x01, 0x05,
+    0x16, 0x0c, 0x00, 0xf0, 0x0c, 0x05, 0x0b, 0x06, 0x00, 0x20, 0x01, 0x0b, 0x0b, 0x06, 0x00, 0x20,
+    0x00, 0x00, 0x27, 0x00, 0x7c, 0xff, 0x02, 0x00, 0x05, 0x0d, 0x06, 0x06, 0x00, 0xf0, 0x08, 0x0d,
+    0x03, 0x06, 0x00, 0x20, 0x2f, 0x00, 0x37, 0x00, 0x46, 0xff, 0x02, 0x00, 0x04, 0x02, 0x14, 0x03,
+    0x00, 0xf0, 0x04, 0x03, 0x14, 0x01, 0x00, 0x30, 0x6d, 0xff, 0x86, 0xfe, 0xfa, 0xff, 0x02, 0x00,
+    0x08, 0x0e, 0x06, 0x0a, 0x00, 0xf0, 0x0a, 0x0e, 0x02, 0x0a, 0x00, 0x30, 0xaa, 0xff, 0xd5, 0xff,
+    0x31, 0x00, 0x03, 0x00, 0x06, 0x0c, 0x10, 0x06, 0x00, 0xf0, 0x0e, 0x0c, 0x08, 0x03, 0x00, 0x20,
+    0x06, 0x0f, 0x08, 0x03, 0x00, 0x20, 0x3c, 0x00, 0x09, 0x00, 0x20, 0xff, 0x02, 0x00, 0x02, 0x0d,
+    0x08, 0x09, 0x00, 0xf0, 0x02, 0x10, 0x08, 0x03, 0x00, 0x30, 0xeb, 0xff, 0x55, 0x00, 0xc3, 0xff,
+    0x03, 0x00, 0x0b, 0x08, 0x06, 0x0e, 0x00, 0xf0, 0x0e, 0x08, 0x03, 0x07, 0x00, 0x20, 0x0b, 0x0f,
+    0x03, 0x07, 0x00, 0x20, 0x60, 0x00, 0x01, 0x00, 0xc0, 0xfe, 0x03, 0x00, 0x02, 0x0c, 0x10, 0x06,
+    0x00, 0xf0, 0x02, 0x0c, 0x08, 0x03, 0x00, 0x20, 0x0a, 0x0f, 0x08, 0x03, 0x00, 0x20, 0x9a, 0xff,
+    0x73, 0x00, 0xeb, 0xff, 0x02, 0x00, 0x05, 0x10, 0x10, 0x08, 0x00, 0xf0, 0x05, 0x14, 0x10, 0x04,
+    0x00, 0x20, 0xfd, 0xff, 0x27, 0x00, 0x84, 0xff, 0x02, 0x00, 0x09, 0x01, 0x04, 0x0c, 0x00, 0xf0,
+    0x09, 0x07, 0x04, 0x06, 0x00, 0x20, 0x5b, 0xff, 0xb3, 0xfe, 0x2e, 0x00, 0x03, 0x00, 0x08, 0x02,
+    0x08, 0x0a, 0x00, 0xf0, 0x0c, 0x02, 0x04, 0x05, 0x00, 0x20, 0x08, 0x07, 0x04, 0x05, 0x00, 0x20,
+    0x73, 0x00, 0xc2, 0xff, 0x9f, 0x00, 0x03, 0x00, 0x06, 0x06, 0x0c, 0x06, 0x00, 0xf0, 0x06, 0x06,
+    0x06, 0x03, 0x00, 0x20, 0x0c, 0x09, 0x06, 0x03, 0x00, 0x20, 0xbb, 0x00, 0x07, 0x00, 0xec, 0x00,
+    0x02, 0x00, 0x0a, 0x07, 0x06, 0x09, 0x00, 0xf0, 0x0c, 0x07, 0x02, 0x09, 0x00, 0x30, 0xa2, 0x00,
+    0xc7, 0xff, 0xc6, 0x00, 0x03, 0x00, 0x00, 0x00, 0x08, 0x0c, 0x00, 0xf0, 0x00, 0x00, 0x04, 0x06,
+    0x00, 0x20, 0x04, 0x06, 0x04, 0x06, 0x00, 0x20, 0xce, 0x00, 0x34, 0x00, 0xea, 0xfe, 0x02, 0x00,
+    0x12, 0x08, 0x06, 0x09, 0x00, 0xf0, 0x12, 0x0b, 0x06, 0x03, 0x00, 0x30, 0xba, 0xff, 0xaf, 0x00,
+    0xc5, 0xff, 0x02, 0x00, 0x02, 0x0c, 0x06, 0x06, 0x00, 0xf0, 0x05, 0x0c, 0x03, 0x06, 0x00, 0x20,
+    0x48, 0x01, 0xfe, 0xff, 0x9e, 0x00, 0x02, 0x00, 0x03, 0x15, 0x15, 0x03, 0x00, 0xf0, 0x0a, 0x15,
+    0x07, 0x03, 0x00, 0x30, 0x90, 0x01, 0xcd, 0xff, 0x02, 0x01, 0x02, 0x00, 0x02, 0x00, 0x10, 0x06,
+    0x00, 0xf0, 0x02, 0x03, 0x10, 0x03, 0x00, 0x20, 0xc1, 0xff, 0x79, 0x00, 0x0b, 0x00, 0x02, 0x00,
+    0x0d, 0x06, 0x07, 0x06, 0x00, 0xf0, 0x0d, 0x09, 0x07, 0x03, 0x00, 0x20, 0xc2, 0xff, 0xe5, 0xfe,
+    0x01, 0x00, 0x02, 0x00, 0x06, 0x04, 0x04, 0x0e, 0x00, 0xf0, 0x06, 0x0b, 0x04, 0x07, 0x00, 0x20,
+    0xbd, 0xff, 0x03, 0x01, 0x04, 0x00, 0x02, 0x00, 0x09, 0x07, 0x06, 0x09, 0x00, 0xf0, 0x0b, 0x07,
+    0x02, 0x09, 0x00, 0x30, 0x95, 0xff, 0x6a, 0x00, 0xb7, 0xff, 0x03, 0x00, 0x07, 0x08, 0x06, 0x0e,
+    0x00, 0xf0, 0x07, 0x08, 0x03, 0x07, 0x00, 0x20, 0x0a, 0x0f, 0x03, 0x07, 0x00, 0x20, 0x24, 0x00,
+    0x36, 0x00, 0xd6, 0xff, 0x02, 0x00, 0x12, 0x08, 0x04, 0x10, 0x00, 0xf0, 0x12, 0x10, 0x04, 0x08,
+    0x00, 0x20, 0x92, 0xff, 0xd8, 0xfe, 0xfe, 0xff, 0x02, 0x00, 0x09, 0x0e, 0x06, 0x0a, 0x00, 0xf0,
+    0x0b, 0x0e, 0x02, 0x0a, 0x00, 0x30, 0x1f, 0x00, 0x5a, 0x00, 0xb5, 0xff, 0x02, 0x00, 0x06, 0x0b,
+    0x0c, 0x05, 0x00, 0xf0, 0x0a, 0x0b, 0x04, 0x05, 0x00, 0x30, 0xbf, 0xff, 0x77, 0xfe, 0xf9, 0xff,
+    0x02, 0x00, 0x00, 0x0c, 0x17, 0x03, 0x00, 0xf0, 0x00, 0x0d, 0x17, 0x01, 0x00, 0x30, 0x55, 0x00,
+    0x33, 0x00, 0x4a, 0xff, 0x02, 0x00, 0x0d, 0x00, 0x06, 0x0c, 0x00, 0xf0, 0x0f, 0x00, 0x02, 0x0c,
+    0x00, 0x30, 0x5e, 0x01, 0xfa, 0xff, 0x7c, 0xfe, 0x02, 0x00, 0x00, 0x0a, 0x0c, 0x05, 0x00, 0xf0,
+    0x04, 0x0a, 0x04, 0x05, 0x00, 0x30, 0x61, 0x00, 0x2b, 0x00, 0x9d, 0xff, 0x02, 0x00, 0x0d, 0x02,
+    0x0a, 0x04, 0x00, 0xf0, 0x0d, 0x04, 0x0a, 0x02, 0x00, 0x20, 0x60, 0xff, 0xce, 0xfe, 0xfb, 0xff,
+    0x02, 0x00, 0x05, 0x00, 0x06, 0x0c, 0x00, 0xf0, 0x07, 0x00, 0x02, 0x0c, 0x00, 0x30, 0xc1, 0xfe,
+    0xe9, 0xfe, 0x25, 0x00, 0x02, 0x00, 0x0b, 0x06, 0x09, 0x06, 0x00, 0xf0, 0x0e, 0x06, 0x03, 0x06,
+    0x00, 0x30, 0xbb, 0xff, 0x47, 0x00, 0x97, 0xff, 0x02, 0x00, 0x04, 0x06, 0x09, 0x06, 0x00, 0xf0,
+    0x07, 0x06, 0x03, 0x06, 0x00, 0x30, 0xe6, 0x01, 0xf5, 0xff, 0x69, 0x00, 0x02, 0x00, 0x06, 0x0b,
+    0x12, 0x0d, 0x00, 0xf0, 0x0c, 0x0b, 0x06, 0x0d, 0x00, 0x30, 0x7f, 0x02, 0xbd, 0xff, 0x8d, 0x00,
+    0x02, 0x00, 0x00, 0x0b, 0x12, 0x0d, 0x00, 0xf0, 0x06, 0x0b, 0x06, 0x0d, 0x00, 0x30, 0x44, 0xff,
+    0x9a, 0x00, 0x04, 0x00, 0x02, 0x00, 0x0c, 0x10, 0x0c, 0x06, 0x00, 0xf0, 0x10, 0x10, 0x04, 0x06,
+    0x00, 0x30, 0xd6, 0xff, 0x61, 0x00, 0xb5, 0xff, 0x02, 0x00, 0x00, 0x06, 0x15, 0x03, 0x00, 0xf0,
+    0x00, 0x07, 0x15, 0x01, 0x00, 0x30, 0x88, 0x01, 0x21, 0x00, 0x8a, 0xff, 0x02, 0x00, 0x0c, 0x10,
+    0x0c, 0x06, 0x00, 0xf0, 0x10, 0x10, 0x04, 0x06, 0x00, 0x30, 0x38, 0x00, 0x1e, 0x00, 0x7c, 0xff,
+    0x02, 0x00, 0x05, 0x07, 0x06, 0x0e, 0x00, 0xf0, 0x05, 0x0e, 0x06, 0x07, 0x00, 0x20, 0x09, 0x00,
+    0xa9, 0xff, 0x35, 0x00, 0x02, 0x00, 0x05, 0x0a, 0x13, 0x02, 0x00, 0xf0, 0x05, 0x0b, 0x13, 0x01,
+    0x00, 0x20, 0x88, 0x00, 0xd5, 0xff, 0x6f, 0x01, 0x02, 0x00, 0x05, 0x04, 0x0e, 0x04, 0x00, 0xf0,
+    0x05, 0x06, 0x0e, 0x02, 0x00, 0x20, 0x78, 0xff, 0x9c, 0x00, 0xf6, 0xff, 0x02, 0x00, 0x03, 0x12,
+    0x12, 0x04, 0x00, 0xf0, 0x09, 0x12, 0x06, 0x04, 0x00, 0x30, 0x0b, 0x00, 0x84, 0xff, 0x22, 0x00,
+    0x02, 0x00, 0x07, 0x00, 0x04, 0x09, 0x00, 0xf0, 0x09, 0x00, 0x02, 0x09, 0x00, 0x20, 0xf3, 0xfe,
+    0xfa, 0xfb, 0x1b, 0x00, 0x02, 0x00, 0x0d, 0x03, 0x0b, 0x04, 0x00, 0xf0, 0x0d, 0x05, 0x0b, 0x02,
+    0x00, 0x20, 0x08, 0x00, 0x9c, 0xff, 0x39, 0x00, 0x02, 0x00, 0x02, 0x00, 0x09, 0x06, 0x00, 0xf0,
+    0x05, 0x00, 0x03, 0x06, 0x00, 0x30, 0x5b, 0x00, 0xea, 0xff, 0x60, 0x00, 0x02, 0x00, 0x13, 0x01,
+    0x04, 0x17, 0x00, 0xf0, 0x13, 0x01, 0x02, 0x17, 0x00, 0x20, 0x15, 0xff, 0x25, 0x01, 0xce, 0xff,
+    0x02, 0x00, 0x01, 0x01, 0x04, 0x17, 0x00, 0xf0, 0x03, 0x01, 0x02, 0x17, 0x00, 0x20, 0x1b, 0x00,
+    0xfb, 0xff, 0x95, 0x00, 0x02, 0x00, 0x05, 0x10, 0x12, 0x03, 0x00, 0xf0, 0x05, 0x11, 0x12, 0x01,
+    0x00, 0x30, 0x32, 0x00, 0x09, 0x00, 0x55, 0xff, 0x02, 0x00, 0x00, 0x03, 0x0b, 0x04, 0x00, 0xf0,
+    0x00, 0x05, 0x0b, 0x02, 0x00, 0x20, 0xdf, 0xff, 0x90, 0x00, 0xed, 0xff, 0x02, 0x00, 0x02, 0x10,
+    0x14, 0x03, 0x00, 0xf0, 0x02, 0x11, 0x14, 0x01, 0x00, 0x30, 0x96, 0x00, 0xd4, 0xff, 0x2a, 0x01,
+    0x02, 0x00, 0x05, 0x03, 0x0d, 0x04, 0x00, 0xf0, 0x05, 0x05, 0x0d, 0x02, 0x00, 0x20, 0x91, 0xf9,
+    0x43, 0x01, 0x0b, 0x00, 0x02, 0x00, 0x01, 0x09, 0x16, 0x0f, 0x00, 0xf0, 0x01, 0x09, 0x0b, 0x0f,
+    0x00, 0x20, 0xa6, 0xff, 0xab, 0x00, 0xc9, 0xff, 0x02, 0x00, 0x03, 0x04, 0x0e, 0x03, 0x00, 0xf0,
+    0x0a, 0x04, 0x07, 0x03, 0x00, 0x20, 0xcb, 0xff, 0x97, 0xff, 0x33, 0x00, 0x02, 0x00, 0x08, 0x07,
+    0x0a, 0x04, 0x00, 0xf0, 0x08, 0x07, 0x05, 0x04, 0x00, 0x20, 0xcc, 0xff, 0x16, 0xff, 0x0a, 0x00,
+    0x02, 0x00, 0x06, 0x07, 0x0a, 0x04, 0x00, 0xf0, 0x0b, 0x07, 0x05, 0x04, 0x00, 0x20, 0x58, 0x00,
+    0x00, 0x00, 0x5b, 0x00, 0x02, 0x00, 0x0a, 0x04, 0x06, 0x09, 0x00, 0xf0, 0x0c, 0x04, 0x02, 0x09,
+    0x00, 0x30, 0x30, 0x00, 0xa1, 0xff, 0x31, 0x00, 0x02, 0x00, 0x01, 0x0c, 0x09, 0x06, 0x00, 0xf0,
+    0x04, 0x0c, 0x03, 0x06, 0x00, 0x30, 0xb0, 0xff, 0x94, 0xff, 0x3e, 0x00, 0x03, 0x00, 0x08, 0x03,
+    0x08, 0x0a, 0x00, 0xf0, 0x0c, 0x03, 0x04, 0x05, 0x00, 0x20, 0x08, 0x08, 0x04, 0x05, 0x00, 0x20,
+    0x07, 0x01, 0xd6, 0xff, 0x45, 0x01, 0x03, 0x00, 0x03, 0x06, 0x10, 0x06, 0x00, 0xf0, 0x03, 0x06,
+    0x08, 0x03, 0x00, 0x20, 0x0b, 0x09, 0x08, 0x03, 0x00, 0x20, 0xbe, 0x01, 0x26, 0x00, 0xd9, 0xfd,
+    0x02, 0x00, 0x05, 0x06, 0x0e, 0x06, 0x00, 0xf0, 0x05, 0x09, 0x0e, 0x03, 0x00, 0x20, 0x75, 0xff,
+    0x60, 0x01, 0xd7, 0xff, 0x02, 0x00, 0x04, 0x03, 0x09, 0x06, 0x00, 0xf0, 0x04, 0x05, 0x09, 0x02,
+    0x00, 0x30, 0xf1, 0xff, 0xaa, 0xff, 0x36, 0x00, 0x02, 0x00, 0x06, 0x03, 0x12, 0x02, 0x00, 0xf0,
+    0x06, 0x04, 0x12, 0x01, 0x00, 0x20, 0xd4, 0xff, 0xc3, 0x00, 0xce, 0xff, 0x02, 0x00, 0x07, 0x06,
+    0x09, 0x06, 0x00, 0xf0, 0x0a, 0x06, 0x03, 0x06, 0x00, 0x30, 0xd1, 0xff, 0x4f, 0xff, 0x37, 0x00,
+    0x02, 0x00, 0x00, 0x01, 0x18, 0x03, 0x00, 0xf0, 0x00, 0x02, 0x18, 0x01, 0x00, 0x30, 0x6a, 0x00,
+    0xfd, 0xff, 0x01, 0xff, 0x02, 0x00, 0x00, 0x11, 0x0a, 0x06, 0x00, 0xf0, 0x00, 0x13, 0x0a, 0x02,
+    0x00, 0x30, 0x11, 0x00, 0xe6, 0xff, 0x7d, 0x00, 0x02, 0x00, 0x03, 0x12, 0x12, 0x03, 0x00, 0xf0,
+    0x03, 0x13, 0x12, 0x01, 0x00, 0x30, 0x3d, 0xff, 0x11, 0x01, 0xd4, 0xff, 0x03, 0x00, 0x02, 0x05,
+    0x06, 0x10, 0x00, 0xf0, 0x02, 0x05, 0x03, 0x08, 0x00, 0x20, 0x05, 0x0d, 0x03, 0x08, 0x00, 0x20,
+    0x01, 0x00, 0x2f, 0x00, 0x41, 0xff, 0x02, 0x00, 0x07, 0x06, 0x0b, 0x06, 0x00, 0xf0, 0x07, 0x08,
+    0x0b, 0x02, 0x00, 0x30, 0xd8, 0x01, 0xc8, 0xff, 0x8b, 0x00, 0x02, 0x00, 0x05, 0x02, 0x0c, 0x16,
+    0x00, 0xf0, 0x05, 0x0d, 0x0c, 0x0b, 0x00, 0x20, 0x41, 0x00, 0x41, 0x00, 0x7f, 0xff, 0x02, 0x00,
+    0x0a, 0x07, 0x04, 0x0a, 0x00, 0xf0, 0x0a, 0x0c, 0x04, 0x05, 0x00, 0x20, 0xe7, 0x00, 0xfe, 0xff,
+    0x0b, 0xff, 0x02, 0x00, 0x09, 0x00, 0x04, 0x12, 0x00, 0xf0, 0x09, 0x06, 0x04, 0x06, 0x00, 0x30,
+    0xd5, 0xff, 0xb7, 0xff, 0x2b, 0x00, 0x02, 0x00, 0x12, 0x08, 0x06, 0x09, 0x00, 0xf0, 0x12, 0x0b,
+    0x06, 0x03, 0x00, 0x30, 0xfc, 0x01, 0xf7, 0xff, 0xb0, 0xfe, 0x02, 0x00, 0x04, 0x07, 0x0f, 0x0a,
+    0x00, 0xf0, 0x09, 0x07, 0x05, 0x0a, 0x00, 0x30, 0xea, 0xff, 0x54, 0x00, 0x03, 0x00, 0x02, 0x00,
+    0x0a, 0x05, 0x06, 0x09, 0x00, 0xf0, 0x0c, 0x05, 0x02, 0x09, 0x00, 0x30, 0x30, 0x00, 0xa7, 0xff,
+    0x3d, 0x00, 0x02, 0x00, 0x09, 0x09, 0x06, 0x0a, 0x00, 0xf0, 0x0b, 0x09, 0x02, 0x0a, 0x00, 0x30,
+    0x50, 0xff, 0x90, 0xfe, 0x27, 0x00, 0x02, 0x00, 0x0b, 0x0e, 0x06, 0x0a, 0x00, 0xf0, 0x0d, 0x0e,
+    0x02, 0x0a, 0x00, 0x30, 0x79, 0xff, 0xd2, 0xfe, 0xfd, 0xff, 0x02, 0x00, 0x07, 0x0e, 0x06, 0x0a,
+    0x00, 0xf0, 0x09, 0x0e, 0x02, 0x0a, 0x00, 0x30, 0xa9, 0xff, 0x36, 0x02, 0x10, 0x00, 0x02, 0x00,
+    0x04, 0x08, 0x10, 0x09, 0x00, 0xf0, 0x04, 0x0b, 0x10, 0x03, 0x00, 0x30, 0xce, 0xff, 0x22, 0xfe,
+    0xf5, 0xff, 0x02, 0x00, 0x02, 0x0b, 0x14, 0x03, 0x00, 0xf0, 0x02, 0x0c, 0x14, 0x01, 0x00, 0x30,
+    0xbb, 0xff, 0x3c, 0xff, 0x27, 0x00, 0x02, 0x00, 0x0d, 0x00, 0x04, 0x0d, 0x00, 0xf0, 0x0d, 0x00,
+    0x02, 0x0d, 0x00, 0x20, 0xf6, 0xff, 0x5f, 0xff, 0x0d, 0x00, 0x02, 0x00, 0x07, 0x00, 0x04, 0x0d,
+    0x00, 0xf0, 0x09, 0x00, 0x02, 0x0d, 0x00, 0x20, 0x48, 0xff, 0xda, 0x00, 0x01, 0x00, 0x02, 0x00,
+    0x03, 0x01, 0x12, 0x07, 0x00, 0xf0, 0x09, 0x01, 0x06, 0x07, 0x00, 0x30, 0x9f, 0x00, 0xf8, 0xff,
+    0xab, 0xfe, 0x02, 0x00, 0x01, 0x0b, 0x06, 0x09, 0x00, 0xf0, 0x01, 0x0e, 0x06, 0x03, 0x00, 0x30,
+    0x1b, 0x00, 0xcf, 0xff, 0x5f, 0x00, 0x02, 0x00, 0x08, 0x12, 0x09, 0x06, 0x00, 0xf0, 0x08, 0x14,
+    0x09, 0x02, 0x00, 0x30, 0xbd, 0xff, 0x0f, 0x02, 0xda, 0xff, 0x02, 0x00, 0x03, 0x09, 0x0f, 0x06,
+    0x00, 0xf0, 0x03, 0x0b, 0x0f, 0x02, 0x00, 0x30, 0x19, 0x00, 0xe3, 0xff, 0x41, 0x00, 0x02, 0x00,
+    0x05, 0x0a, 0x13, 0x02, 0x00, 0xf0, 0x05, 0x0b, 0x13, 0x01, 0x00, 0x20, 0xbb, 0x00, 0xfc, 0xff,
+    0xf5, 0xfe, 0x02, 0x00, 0x08, 0x06, 0x07, 0x10, 0x00, 0xf0, 0x08, 0x0e, 0x07, 0x08, 0x00, 0x20,
+    0x10, 0x00, 0xf6, 0xff, 0x65, 0x00, 0x02, 0x00, 0x09, 0x0e, 0x09, 0x06, 0x00, 0xf0, 0x09, 0x10,
+    0x09, 0x02, 0x00, 0x30, 0x00, 0x00, 0x56, 0xff, 0x08, 0x00, 0x02, 0x00, 0x00, 0x07, 0x08, 0x0c,
+    0x00, 0xf0, 0x00, 0x0b, 0x08, 0x04, 0x00, 0x30, 0x1d, 0x00, 0xf2, 0xff, 0x60, 0x00, 0x02, 0x00,
+    0x06, 0x04, 0x12, 0x03, 0x00, 0xf0, 0x06, 0x05, 0x12, 0x01, 0x00, 0x30, 0x34, 0xff, 0x9c, 0x00,
+    0xcb, 0xff, 0x02, 0x00, 0x00, 0x10, 0x0c, 0x06, 0x00, 0xf0, 0x04, 0x10, 0x04, 0x06, 0x00, 0x30,
+    0x9a, 0xff, 0x6e, 0xff, 0x2d, 0x00, 0x02, 0x00, 0x0d, 0x0d, 0x09, 0x04, 0x00, 0xf0, 0x0d, 0x0f,
+    0x09, 0x02, 0x00, 0x20, 0x7e, 0x00, 0x0e, 0x00, 0x5b, 0xff, 0x03, 0x00, 0x05, 0x08, 0x0e, 0x0e,
+    0x00, 0xf0, 0x05, 0x08, 0x07, 0x07, 0x00, 0x20, 0x0c, 0x0f, 0x07, 0x07, 0x00, 0x20, 0xbd, 0x00,
+    0x2c, 0x00, 0x03, 0xff, 0x03, 0x00, 0x01, 0x10, 0x16, 0x06, 0x00, 0xf0, 0x0c, 0x10, 0x0b, 0x03,
+    0x00, 0x20, 0x01, 0x13, 0x0b, 0x03, 0x00, 0x20, 0xf3, 0xff, 0x55, 0xff, 0x08, 0x00, 0x02, 0x00,
+    0x09, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x0b, 0x00, 0x02, 0x09, 0x00, 0x30, 0x9d, 0xff, 0x4b, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0x09, 0x05, 0x0a, 0x0a, 0x00, 0xf0, 0x0e, 0x05, 0x05, 0x05, 0x00, 0x20,
+    0x09, 0x0a, 0x05, 0x05, 0x00, 0x20, 0x31, 0x00, 0xb8, 0xff, 0x78, 0x00, 0x03, 0x00, 0x05, 0x05,
+    0x0a, 0x0a, 0x00, 0xf0, 0x05, 0x05, 0x05, 0x05, 0x00, 0x20, 0x0a, 0x0a, 0x05, 0x05, 0x00, 0x20,
+    0x35, 0x00, 0xe5, 0xff, 0x92, 0x00, 0x03, 0x00, 0x04, 0x06, 0x10, 0x06, 0x00, 0xf0, 0x0c, 0x06,
+    0x08, 0x03, 0x00, 0x20, 0x04, 0x09, 0x08, 0x03, 0x00, 0x20, 0xf2, 0x00, 0xf3, 0xff, 0x19, 0xfe,
+    0x02, 0x00, 0x00, 0x07, 0x06, 0x09, 0x00, 0xf0, 0x00, 0x0a, 0x06, 0x03, 0x00, 0x30, 0x58, 0xff,
+    0x73, 0x00, 0xfe, 0xff, 0x03, 0x00, 0x10, 0x0a, 0x08, 0x0e, 0x00, 0xf0, 0x14, 0x0a, 0x04, 0x07,
+    0x00, 0x20, 0x10, 0x11, 0x04, 0x07, 0x00, 0x20, 0xa8, 0xfe, 0xf8, 0xfd, 0xf3, 0xff, 0x02, 0x00,
+    0x09, 0x0c, 0x06, 0x0c, 0x00, 0xf0, 0x09, 0x12, 0x06, 0x06, 0x00, 0x20, 0xb6, 0x00, 0x2b, 0x00,
+    0xc6, 0xfe, 0x03, 0x00, 0x08, 0x0a, 0x08, 0x0c, 0x00, 0xf0, 0x0c, 0x0a, 0x04, 0x06, 0x00, 0x20,
+    0x08, 0x10, 0x04, 0x06, 0x00, 0x20, 0x64, 0x00, 0xfb, 0xff, 0xeb, 0xfe, 0x02, 0x00, 0x08, 0x00,
+    0x04, 0x09, 0x00, 0xf0, 0x0a, 0x00, 0x02, 0x09, 0x00, 0x20, 0xef, 0xff, 0x4d, 0x00, 0xa2, 0xff,
+    0x03, 0x00, 0x0a, 0x04, 0x08, 0x10, 0x00, 0xf0, 0x0e, 0x04, 0x04, 0x08, 0x00, 0x20, 0x0a, 0x0c,
+    0x04, 0x08, 0x00, 0x20, 0x64, 0x00, 0xb1, 0xff, 0x3c, 0x00, 0x02, 0x00, 0x07, 0x0a, 0x0a, 0x06,
+    0x00, 0xf0, 0x07, 0x0c, 0x0a, 0x02, 0x00, 0x30, 0xa4, 0xfe, 0x34, 0xfe, 0x27, 0x00, 0x03, 0x00,
+    0x05, 0x06, 0x0e, 0x0e, 0x00, 0xf0, 0x0c, 0x06, 0x07, 0x07, 0x00, 0x20, 0x05, 0x0d, 0x07, 0x07,
+    0x00, 0x20, 0x59, 0x00, 0xf3, 0xff, 0x1a, 0xfe, 0x02, 0x00, 0x02, 0x0b, 0x14, 0x02, 0x00, 0xf0,
+    0x02, 0x0c, 0x14, 0x01, 0x00, 0x20, 0xbc, 0xff, 0x35, 0x00, 0x05, 0x00, 0x02, 0x00, 0x12, 0x08,
+    0x04, 0x10, 0x00, 0xf0, 0x12, 0x10, 0x04, 0x08, 0x00, 0x20, 0x85, 0x00, 0xcd, 0xff, 0x9c, 0x00,
+    0x03, 0x00, 0x01, 0x0b, 0x0c, 0x0a, 0x00, 0xf0, 0x01, 0x0b, 0x06, 0x05, 0x00, 0x20, 0x07, 0x10,
+    0x06, 0x05, 0x00, 0x20, 0x0a, 0x00, 0x0c, 0xff, 0x2f, 0x00, 0x02, 0x00, 0x06, 0x09, 0x0c, 0x04,
+    0x00, 0xf0, 0x06, 0x0b, 0x0c, 0x02, 0x00, 0x20, 0xe2, 0x00, 0xdc, 0xff, 0x26, 0x02, 0x02, 0x00,
+    0x09, 0x0c, 0x06, 0x07, 0x00, 0xf0, 0x0c, 0x0c, 0x03, 0x07, 0x00, 0x20, 0x4d, 0xfe, 0xe9, 0xfe,
+    0x21, 0x00, 0x03, 0x00, 0x0a, 0x04, 0x08, 0x10, 0x00, 0xf0, 0x0e, 0x04, 0x04, 0x08, 0x00, 0x20,
+    0x0a, 0x0c, 0x04, 0x08, 0x00, 0x20, 0xe0, 0xff, 0x1a, 0x00, 0x7c, 0xff, 0x03, 0x00, 0x06, 0x04,
+    0x08, 0x10, 0x00, 0xf0, 0x06, 0x04, 0x04, 0x08, 0x00, 0x20, 0x0a, 0x0c, 0x04, 0x08, 0x00, 0x20,
+    0x35, 0x01, 0x0f, 0x00, 0x3c, 0x01, 0x02, 0x00, 0x08, 0x09, 0x09, 0x06, 0x00, 0xf0, 0x0b, 0x09,
+    0x03, 0x06, 0x00, 0x30, 0x84, 0xfe, 0xa9, 0xfe, 0xf8, 0xff, 0x03, 0x00, 0x01, 0x05, 0x10, 0x0c,
+    0x00, 0xf0, 0x01, 0x05, 0x08, 0x06, 0x00, 0x20, 0x09, 0x0b, 0x08, 0x06, 0x00, 0x20, 0xca, 0x00,
+    0x0c, 0x00, 0x9b, 0x01, 0x02, 0x00, 0x09, 0x09, 0x06, 0x08, 0x00, 0xf0, 0x09, 0x09, 0x03, 0x08,
+    0x00, 0x20, 0xd0, 0xff, 0xfa, 0xfe, 0xff, 0xff, 0x02, 0x00, 0x06, 0x00, 0x03, 0x12, 0x00, 0xf0,
+    0x07, 0x00, 0x01, 0x12, 0x00, 0x30, 0x5f, 0x01, 0x15, 0x00, 0xf3, 0x00, 0x02, 0x00, 0x11, 0x09,
+    0x05, 0x0e, 0x00, 0xf0, 0x11, 0x10, 0x05, 0x07, 0x00, 0x20, 0x4b, 0x01, 0xdb, 0xff, 0xef, 0x01,
+    0x02, 0x00, 0x02, 0x09, 0x05, 0x0e, 0x00, 0xf0, 0x02, 0x10, 0x05, 0x07, 0x00, 0x20, 0x93, 0xfc,
+    0x88, 0x00, 0x76, 0xff, 0xa8, 0x00, 0x4e, 0xff, 0x02, 0x00, 0x07, 0x04, 0x0a, 0x06, 0x00, 0xf0,
+    0x07, 0x07, 0x0a, 0x03, 0x00, 0x20, 0x3f, 0x00, 0x18, 0xff, 0x4e, 0x00, 0x02, 0x00, 0x01, 0x03,
+    0x17, 0x12, 0x00, 0xf0, 0x01, 0x09, 0x17, 0x06, 0x00, 0x30, 0xe0, 0x00, 0x81, 0xff, 0x92, 0x00,
+    0x02, 0x00, 0x01, 0x01, 0x15, 0x03, 0x00, 0xf0, 0x08, 0x01, 0x07, 0x03, 0x00, 0x30, 0x57, 0x00,
+    0x94, 0xff, 0x94, 0x00, 0x02, 0x00, 0x09, 0x06, 0x06, 0x09, 0x00, 0xf0, 0x0b, 0x06, 0x02, 0x09,
+    0x00, 0x30, 0x20, 0x00, 0x86, 0xff, 0x6e, 0x00, 0x03, 0x00, 0x03, 0x12, 0x0c, 0x06, 0x00, 0xf0,
+    0x03, 0x12, 0x06, 0x03, 0x00, 0x20, 0x09, 0x15, 0x06, 0x03, 0x00, 0x20, 0x67, 0xff, 0x82, 0x00,
+    0xcd, 0xff, 0x03, 0x00, 0x10, 0x08, 0x08, 0x10, 0x00, 0xf0, 0x14, 0x08, 0x04, 0x08, 0x00, 0x20,
+    0x10, 0x10, 0x04, 0x08, 0x00, 0x20, 0x8c, 0x02, 0xc5, 0xff, 0x19, 0x01, 0x02, 0x00, 0x00, 0x13,
+    0x18, 0x04, 0x00, 0xf0, 0x08, 0x13, 0x08, 0x04, 0x00, 0x30, 0xe6, 0xfe, 0x67, 0x00, 0x0e, 0x00,
+    0x03, 0x00, 0x10, 0x08, 0x08, 0x10, 0x00, 0xf0, 0x14, 0x08, 0x04, 0x08, 0x00, 0x20, 0x10, 0x10,
+    0x04, 0x08, 0x00, 0x20, 0x76, 0xff, 0x73, 0x00, 0xab, 0xff, 0x03, 0x00, 0x00, 0x08, 0x08, 0x10,
+    0x00, 0xf0, 0x00, 0x08, 0x04, 0x08, 0x00, 0x20, 0x04, 0x10, 0x04, 0x08, 0x00, 0x20, 0xfd, 0xfe,
+    0x27, 0xff, 0x39, 0x00, 0x02, 0x00, 0x08, 0x0c, 0x08, 0x0a, 0x00, 0xf0, 0x08, 0x11, 0x08, 0x05,
+    0x00, 0x20, 0x1e, 0x00, 0x12, 0xff, 0x0f, 0x00, 0x02, 0x00, 0x05, 0x07, 0x05, 0x08, 0x00, 0xf0,
+    0x05, 0x0b, 0x05, 0x04, 0x00, 0x20, 0xd9, 0xff, 0xb9, 0xfe, 0x2f, 0x00, 0x02, 0x00, 0x04, 0x01,
+    0x13, 0x02, 0x00, 0xf0, 0x04, 0x02, 0x13, 0x01, 0x00, 0x20, 0xe9, 0xfd, 0x95, 0x00, 0xbe, 0xff,
+    0x02, 0x00, 0x00, 0x0c, 0x18, 0x09, 0x00, 0xf0, 0x08, 0x0c, 0x08, 0x09, 0x00, 0x30, 0xeb, 0x00,
+    0xf3, 0xff, 0xb6, 0x00, 0x02, 0x00, 0x06, 0x00, 0x0d, 0x08, 0x00, 0xf0, 0x06, 0x04, 0x0d, 0x04,
+    0x00, 0x20, 0xe3, 0xff, 0x22, 0xff, 0x13, 0x00, 0x02, 0x00, 0x00, 0x00, 0x18, 0x03, 0x00, 0xf0,
+    0x00, 0x01, 0x18, 0x01, 0x00, 0x30, 0x7f, 0x00, 0xed, 0xff, 0xe8, 0x00, 0x02, 0x00, 0x14, 0x03,
+    0x04, 0x0b, 0x00, 0xf0, 0x14, 0x03, 0x02, 0x0b, 0x00, 0x20, 0x92, 0x00, 0xc1, 0xff, 0xb9, 0x00,
+    0x02, 0x00, 0x08, 0x06, 0x06, 0x09, 0x00, 0xf0, 0x0a, 0x06, 0x02, 0x09, 0x00, 0x30, 0x7f, 0xff,
+    0xe1, 0xfe, 0x35, 0x00, 0x03, 0x00, 0x06, 0x0b, 0x0c, 0x08, 0x00, 0xf0, 0x0c, 0x0b, 0x06, 0x04,
+    0x00, 0x20, 0x06, 0x0f, 0x06, 0x04, 0x00, 0x20, 0xb1, 0xff, 0x8d, 0xfe, 0xfd, 0xff, 0x03, 0x00,
+    0x00, 0x08, 0x0c, 0x06, 0x00, 0xf0, 0x00, 0x08, 0x06, 0x03, 0x00, 0x20, 0x06, 0x0b, 0x06, 0x03,
+    0x00, 0x20, 0xe3, 0xff, 0x89, 0x00, 0xe3, 0xff, 0x02, 0x00, 0x06, 0x11, 0x12, 0x03, 0x00, 0xf0,
+    0x06, 0x12, 0x12, 0x01, 0x00, 0x30, 0x21, 0x00, 0x11, 0x00, 0x3c, 0xff, 0x02, 0x00, 0x00, 0x0e,
+    0x09, 0x06, 0x00, 0xf0, 0x00, 0x10, 0x09, 0x02, 0x00, 0x30, 0x4e, 0xff, 0x24, 0x01, 0x0a, 0x00,
+    0x02, 0x00, 0x14, 0x03, 0x04, 0x09, 0x00, 0xf0, 0x14, 0x03, 0x02, 0x09, 0x00, 0x20, 0x6c, 0x00,
+    0xc1, 0xff, 0x97, 0x00, 0x02, 0x00, 0x00, 0x03, 0x04, 0x09, 0x00, 0xf0, 0x02, 0x03, 0x02, 0x09,
+    0x00, 0x20, 0x83, 0x00, 0xf6, 0xff, 0x53, 0x00, 0x02, 0x00, 0x0f, 0x00, 0x09, 0x13, 0x00, 0xf0,
+    0x12, 0x00, 0x03, 0x13, 0x00, 0x30, 0xd9, 0xfe, 0x96, 0x00, 0xbf, 0xff, 0x02, 0x00, 0x00, 0x00,
+    0x09, 0x13, 0x00, 0xf0, 0x03, 0x00, 0x03, 0x13, 0x00, 0x30, 0x80, 0x00, 0x27, 0x00, 0x71, 0xff,
+    0x02, 0x00, 0x0d, 0x0b, 0x06, 0x08, 0x00, 0xf0, 0x0d, 0x0b, 0x03, 0x08, 0x00, 0x20, 0xff, 0xff,
+    0x2b, 0x00, 0x7a, 0xff, 0x02, 0x00, 0x05, 0x0b, 0x06, 0x08, 0x00, 0xf0, 0x08, 0x0b, 0x03, 0x08,
+    0x00, 0x20, 0x0b, 0x00, 0xda, 0xff, 0x4b, 0x00, 0x02, 0x00, 0x05, 0x0b, 0x13, 0x03, 0x00, 0xf0,
+    0x05, 0x0c, 0x13, 0x01, 0x00, 0x30, 0x86, 0x00, 0x9a, 0xff, 0x40, 0x00, 0x02, 0x00, 0x03, 0x14,
+    0x12, 0x04, 0x00, 0xf0, 0x09, 0x14, 0x06, 0x04, 0x00, 0x30, 0xc5, 0xff, 0x47, 0x00, 0x88, 0xff,
+    0x02, 0x00, 0x06, 0x06, 0x10, 0x06, 0x00, 0xf0, 0x06, 0x08, 0x10, 0x02, 0x00, 0x30, 0x9b, 0x00,
+    0x00, 0x00, 0xdf, 0xfe, 0x02, 0x00, 0x06, 0x00, 0x09, 0x06, 0x00, 0xf0, 0x09, 0x00, 0x03, 0x06,
+    0x00, 0x30, 0x0b, 0x00, 0x69, 0x00, 0xbd, 0xff, 0x02, 0x00, 0x0a, 0x03, 0x04, 0x0e, 0x00, 0xf0,
+    0x0a, 0x0a, 0x04, 0x07, 0x00, 0x20, 0x56, 0xff, 0x93, 0xfe, 0xfc, 0xff, 0x02, 0x00, 0x01, 0x05,
+    0x0f, 0x0c, 0x00, 0xf0, 0x01, 0x0b, 0x0f, 0x06, 0x00, 0x20, 0x9b, 0xff, 0xc0, 0xff, 0x28, 0x00,
+    0x02, 0x00, 0x0b, 0x0c, 0x08, 0x05, 0x00, 0xf0, 0x0b, 0x0c, 0x04, 0x05, 0x00, 0x20, 0x29, 0x00,
+    0x0b, 0x00, 0x4d, 0xff, 0x02, 0x00, 0x05, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x07, 0x00, 0x02, 0x09,
+    0x00, 0x30, 0xab, 0xff, 0x10, 0xff, 0x3b, 0x00, 0x02, 0x00, 0x0c, 0x00, 0x06, 0x09, 0x00, 0xf0,
+    0x0e, 0x00, 0x02, 0x09, 0x00, 0x30, 0x5b, 0x00, 0xbb, 0xff, 0x74, 0x00, 0x03, 0x00, 0x05, 0x05,
+    0x0c, 0x08, 0x00, 0xf0, 0x05, 0x05, 0x06, 0x04, 0x00, 0x20, 0x0b, 0x09, 0x06, 0x04, 0x00, 0x20,
+    0x68, 0xff, 0xf8, 0xfe, 0x24, 0x00, 0x02, 0x00, 0x0d, 0x0c, 0x0b, 0x06, 0x00, 0xf0, 0x0d, 0x0e,
+    0x0b, 0x02, 0x00, 0x30, 0xd5, 0xff, 0xa1, 0x00, 0xbf, 0xff, 0x02, 0x00, 0x00, 0x0d, 0x15, 0x03,
+    0x00, 0xf0, 0x00, 0x0e, 0x15, 0x01, 0x00, 0x30, 0xe3, 0x00, 0x29, 0x00, 0x3b, 0xfe, 0x03, 0x00,
+    0x08, 0x01, 0x08, 0x0c, 0x00, 0xf0, 0x0c, 0x01, 0x04, 0x06, 0x00, 0x20, 0x08, 0x07, 0x04, 0x06,
+    0x00, 0x20, 0x58, 0x00, 0xc0, 0xff, 0x8a, 0x00, 0x03, 0x00, 0x01, 0x00, 0x06, 0x0c, 0x00, 0xf0,
+    0x01, 0x00, 0x03, 0x06, 0x00, 0x20, 0x04, 0x06, 0x03, 0x06, 0x00, 0x20, 0x00, 0x00, 0xb6, 0xff,
+    0x55, 0x00, 0x02, 0x00, 0x02, 0x02, 0x15, 0x02, 0x00, 0xf0, 0x02, 0x03, 0x15, 0x01, 0x00, 0x20,
+    0x3b, 0x00, 0xfe, 0xff, 0xd6, 0xfe, 0x02, 0x00, 0x02, 0x02, 0x13, 0x03, 0x00, 0xf0, 0x02, 0x03,
+    0x13, 0x01, 0x00, 0x30, 0xb9, 0x01, 0x1c, 0x00, 0x82, 0xfd, 0x03, 0x00, 0x11, 0x0a, 0x06, 0x0e,
+    0x00, 0xf0, 0x14, 0x0a, 0x03, 0x07, 0x00, 0x20, 0x11, 0x11, 0x03, 0x07, 0x00, 0x20, 0x93, 0x00,
+    0xcf, 0xff, 0xf5, 0x00, 0x03, 0x00, 0x01, 0x0a, 0x06, 0x0e, 0x00, 0xf0, 0x01, 0x0a, 0x03, 0x07,
+    0x00, 0x20, 0x04, 0x11, 0x03, 0x07, 0x00, 0x20, 0xf0, 0xff, 0x4f, 0x00, 0xbf, 0xff, 0x03, 0x00,
+    0x07, 0x06, 0x0e, 0x0e, 0x00, 0xf0, 0x0e, 0x06, 0x07, 0x07, 0x00, 0x20, 0x07, 0x0d, 0x07, 0x07,
+    0x00, 0x20, 0x55, 0x00, 0xff, 0xff, 0xfe, 0xfe, 0x02, 0x00, 0x00, 0x0c, 0x09, 0x06, 0x00, 0xf0,
+    0x00, 0x0e, 0x09, 0x02, 0x00, 0x30, 0x86, 0xff, 0x8b, 0xff, 0x31, 0x00, 0x02, 0x00, 0x0f, 0x0e,
+    0x08, 0x09, 0x00, 0xf0, 0x0f, 0x11, 0x08, 0x03, 0x00, 0x30, 0x6a, 0x00, 0xfd, 0xff, 0x00, 0xff,
+    0x03, 0x00, 0x01, 0x01, 0x16, 0x04, 0x00, 0xf0, 0x01, 0x01, 0x0b, 0x02, 0x00, 0x20, 0x0c, 0x03,
+    0x0b, 0x02, 0x00, 0x20, 0x2b, 0x00, 0xed, 0xff, 0x6a, 0x00, 0x02, 0x00, 0x09, 0x0b, 0x09, 0x06,
+    0x00, 0xf0, 0x09, 0x0d, 0x09, 0x02, 0x00, 0x30, 0x23, 0x00, 0xbc, 0xff, 0x64, 0x00, 0x02, 0x00,
+    0x00, 0x0f, 0x12, 0x03, 0x00, 0xf0, 0x00, 0x10, 0x12, 0x01, 0x00, 0x30, 0x57, 0x00, 0x2e, 0x00,
+    0xa4, 0xff, 0x02, 0x00, 0x10, 0x0e, 0x07, 0x09, 0x00, 0xf0, 0x10, 0x11, 0x07, 0x03, 0x00, 0x30,
+    0x31, 0x01, 0xd0, 0xff, 0xed, 0x00, 0x02, 0x00, 0x04, 0x03, 0x10, 0x04, 0x00, 0xf0, 0x0c, 0x03,
+    0x08, 0x04, 0x00, 0x20, 0x13, 0x00, 0xdb, 0xff, 0x55, 0x00, 0x02, 0x00, 0x07, 0x06, 0x0c, 0x05,
+    0x00, 0xf0, 0x07, 0x06, 0x06, 0x05, 0x00, 0x20, 0x07, 0x00, 0x7a, 0xff, 0x17, 0x00, 0x02, 0x00,
+    0x09, 0x06, 0x04, 0x09, 0x00, 0xf0, 0x0b, 0x06, 0x02, 0x09, 0x00, 0x20, 0x04, 0x00, 0x9e, 0xff,
+    0x3e, 0x00, 0x02, 0x00, 0x0c, 0x01, 0x04, 0x0a, 0x00, 0xf0, 0x0c, 0x01, 0x02, 0x0a, 0x00, 0x20,
+    0x73, 0x00, 0xff, 0xff, 0xbe, 0xfe, 0x02, 0x00, 0x08, 0x01, 0x04, 0x0a, 0x00, 0xf0, 0x0a, 0x01,
+    0x02, 0x0a, 0x00, 0x20, 0x7b, 0xff, 0x6c, 0xff, 0x2b, 0x00, 0x02, 0x00, 0x0f, 0x0f, 0x06, 0x09,
+    0x00, 0xf0, 0x0f, 0x12, 0x06, 0x03, 0x00, 0x30, 0x5c, 0x00, 0x05, 0x00, 0x20, 0xff, 0x02, 0x00,
+    0x03, 0x0f, 0x06, 0x09, 0x00, 0xf0, 0x03, 0x12, 0x06, 0x03, 0x00, 0x30, 0xa8, 0xff, 0x5a, 0xff,
+    0x21, 0x00, 0x02, 0x00, 0x0f, 0x01, 0x03, 0x13, 0x00, 0xf0, 0x10, 0x01, 0x01, 0x13, 0x00, 0x30,
+    0x1f, 0x00, 0xaa, 0xff, 0x38, 0x00, 0x02, 0x00, 0x01, 0x03, 0x06, 0x09, 0x00, 0xf0, 0x03, 0x03,
+    0x02, 0x09, 0x00, 0x30, 0x3b, 0x00, 0x26, 0x00, 0x7f, 0xff, 0x02, 0x00, 0x0f, 0x00, 0x03, 0x13,
+    0x00, 0xf0, 0x10, 0x00, 0x01, 0x13, 0x00, 0x30, 0x72, 0x00, 0xc0, 0xff, 0x75, 0x00, 0x02, 0x00,
+    0x06, 0x03, 0x0c, 0x04, 0x00, 0xf0, 0x0c, 0x03, 0x06, 0x04, 0x00, 0x20, 0x17, 0x00, 0xe4, 0xff,
+    0x8e, 0x00, 0x02, 0x00, 0x0a, 0x05, 0x04, 0x09, 0x00, 0xf0, 0x0a, 0x05, 0x02, 0x09, 0x00, 0x20,
+    0xd8, 0xff, 0x07, 0xff, 0x04, 0x00, 0x02, 0x00, 0x06, 0x00, 0x03, 0x13, 0x00, 0xf0, 0x07, 0x00,
+    0x01, 0x13, 0x00, 0x30, 0xf0, 0xff, 0x61, 0x00, 0xd5, 0xff, 0x02, 0x00, 0x0b, 0x01, 0x03, 0x0c,
+    0x00, 0xf0, 0x0b, 0x07, 0x03, 0x06, 0x00, 0x20, 0xa4, 0xff, 0xf6, 0xfe, 0x01, 0x00, 0x02, 0x00,
+    0x06, 0x07, 0x0a, 0x05, 0x00, 0xf0, 0x0b, 0x07, 0x05, 0x05, 0x00, 0x20, 0x5e, 0xff, 0x7e, 0xfa,
+    0x1c, 0x00, 0x02, 0x00, 0x0b, 0x03, 0x03, 0x12, 0x00, 0xf0, 0x0c, 0x03, 0x01, 0x12, 0x00, 0x30,
+    0xb9, 0xff, 0xf4, 0x00, 0xd1, 0xff, 0x02, 0x00, 0x09, 0x03, 0x06, 0x0c, 0x00, 0xf0, 0x0b, 0x03,
+    0x02, 0x0c, 0x00, 0x30, 0x24, 0x00, 0x02, 0x00, 0xd2, 0x00, 0x02, 0x00, 0x03, 0x07, 0x13, 0x03,
+    0x00, 0xf0, 0x03, 0x08, 0x13, 0x01, 0x00, 0x30, 0xe0, 0xff, 0x39, 0x00, 0xa8, 0xff, 0x02, 0x00,
+    0x02, 0x07, 0x12, 0x03, 0x00, 0xf0, 0x02, 0x08, 0x12, 0x01, 0x00, 0x30, 0x6e, 0x00, 0x2a, 0x00,
+    0x9c, 0xfe, 0x03, 0x00, 0x03, 0x0d, 0x12, 0x04, 0x00, 0xf0, 0x0c, 0x0d, 0x09, 0x02, 0x00, 0x20,
+    0x03, 0x0f, 0x09, 0x02, 0x00, 0x20, 0xac, 0xff, 0x23, 0xff, 0x00, 0x00, 0x02, 0x00, 0x03, 0x05,
+    0x06, 0x09, 0x00, 0xf0, 0x05, 0x05, 0x02, 0x09, 0x00, 0x30, 0xda, 0xfe, 0x2f, 0xfd, 0x1d, 0x00,
+    0x03, 0x00, 0x04, 0x01, 0x14, 0x04, 0x00, 0xf0, 0x0e, 0x01, 0x0a, 0x02, 0x00, 0x20, 0x04, 0x03,
+    0x0a, 0x02, 0x00, 0x20, 0x92, 0xff, 0xb5, 0xfe, 0xfa, 0xff, 0x03, 0x00, 0x00, 0x01, 0x14, 0x04,
+    0x00, 0xf0, 0x00, 0x01, 0x0a, 0x02, 0x00, 0x20, 0x0a, 0x03, 0x0a, 0x02, 0x00, 0x20, 0x3e, 0xff,
+    0x30, 0xff, 0x1e, 0x00, 0x02, 0x00, 0x0a, 0x0f, 0x06, 0x06, 0x00, 0xf0, 0x0a, 0x0f, 0x03, 0x06,
+    0x00, 0x20, 0x42, 0xfe, 0xa8, 0x00, 0xcb, 0xff, 0x02, 0x00, 0x00, 0x02, 0x18, 0x08, 0x00, 0xf0,
+    0x08, 0x02, 0x08, 0x08, 0x00, 0x30, 0x37, 0x00, 0x01, 0x00, 0x88, 0x00, 0x02, 0x00, 0x05, 0x05,
+    0x12, 0x03, 0x00, 0xf0, 0x05, 0x06, 0x12, 0x01, 0x00, 0x30, 0xe5, 0xff, 0x4e, 0x00, 0xb1, 0xff,
+    0x02, 0x00, 0x08, 0x0f, 0x06, 0x06, 0x00, 0xf0, 0x0b, 0x0f, 0x03, 0x06, 0x00, 0x20, 0xf0, 0xff,
+    0x41, 0x00, 0xf3, 0xff, 0x02, 0x00, 0x0b, 0x0c, 0x08, 0x05, 0x00, 0xf0, 0x0b, 0x0c, 0x04, 0x05,
+    0x00, 0x20, 0x66, 0xff, 0x91, 0xfe, 0xfd, 0xff, 0x02, 0x00, 0x05, 0x0c, 0x08, 0x05, 0x00, 0xf0,
+    0x09, 0x0c, 0x04, 0x05, 0x00, 0x20, 0x23, 0x00, 0xd5, 0xff, 0x6b, 0x00, 0x02, 0x00, 0x05, 0x00,
+    0x0e, 0x06, 0x00, 0xf0, 0x05, 0x02, 0x0e, 0x02, 0x00, 0x30, 0x7d, 0xff, 0x5a, 0xff, 0x0a, 0x00,
+    0x02, 0x00, 0x0a, 0x02, 0x04, 0x0f, 0x00, 0xf0, 0x0a, 0x07, 0x04, 0x05, 0x00, 0x30, 0xef, 0x00,
+    0xf3, 0xff, 0xa2, 0x00, 0x02, 0x00, 0x0a, 0x07, 0x05, 0x0c, 0x00, 0xf0, 0x0a, 0x0b, 0x05, 0x04,
+    0x00, 0x30, 0x59, 0xff, 0x15, 0xff, 0x02, 0x00, 0x03, 0x00, 0x07, 0x09, 0x08, 0x0e, 0x00, 0xf0,
+    0x07, 0x09, 0x04, 0x07, 0x00, 0x20, 0x0b, 0x10, 0x04, 0x07, 0x00, 0x20, 0xaf, 0xff, 0x89, 0x00,
+    0xf0, 0xff, 0x03, 0x00, 0x01, 0x05, 0x16, 0x06, 0x00, 0xf0, 0x0c, 0x05, 0x0b, 0x03, 0x00, 0x20,
+    0x01, 0x08, 0x0b, 0x03, 0x00, 0x20, 0xee, 0xff, 0x75, 0xff, 0x15, 0x00, 0x02, 0x00, 0x00, 0x05,
+    0x06, 0x06, 0x00, 0xf0, 0x00, 0x08, 0x06, 0x03, 0x00, 0x20, 0x44, 0x00, 0x27, 0x00, 0x9a, 0xff,
+    0x02, 0x00, 0x0c, 0x11, 0x09, 0x04, 0x00, 0xf0, 0x0c, 0x13, 0x09, 0x02, 0x00, 0x20, 0x26, 0x00,
+    0xc2, 0xff, 0x83, 0x00, 0x02, 0x00, 0x02, 0x12, 0x13, 0x03, 0x00, 0xf0, 0x02, 0x13, 0x13, 0x01,
+    0x00, 0x30, 0xb0, 0xff, 0x7e, 0xff, 0x23, 0x00, 0x02, 0x00, 0x0c, 0x11, 0x09, 0x04, 0x00, 0xf0,
+    0x0c, 0x13, 0x09, 0x02, 0x00, 0x20, 0x2c, 0x00, 0xc9, 0xff, 0xa0, 0x00, 0x02, 0x00, 0x01, 0x11,
+    0x12, 0x03, 0x00, 0xf0, 0x01, 0x12, 0x12, 0x01, 0x00, 0x30, 0x9b, 0x00, 0x1d, 0x00, 0x46, 0xfd,
+    0x02, 0x00, 0x0c, 0x11, 0x09, 0x04, 0x00, 0xf0, 0x0c, 0x13, 0x09, 0x02, 0x00, 0x20, 0x43, 0x00,
+    0xfd, 0xff, 0xec, 0xfe, 0x02, 0x00, 0x00, 0x00, 0x18, 0x03, 0x00, 0xf0, 0x00, 0x01, 0x18, 0x01,
+    0x00, 0x30, 0xaf, 0xff, 0x37, 0x01, 0x08, 0x00, 0x02, 0x00, 0x05, 0x00, 0x0e, 0x04, 0x00, 0xf0,
+    0x05, 0x02, 0x0e, 0x02, 0x00, 0x20, 0x2d, 0x00, 0xc0, 0xff, 0x70, 0x00, 0x02, 0x00, 0x06, 0x0e,
+    0x09, 0x06, 0x00, 0xf0, 0x06, 0x10, 0x09, 0x02, 0x00, 0x30, 0x15, 0x00, 0x39, 0x00, 0xc3, 0xff,
+    0x02, 0x00, 0x0e, 0x0d, 0x06, 0x09, 0x00, 0xf0, 0x0e, 0x10, 0x06, 0x03, 0x00, 0x30, 0xd3, 0xff,
+    0x40, 0x00, 0xb2, 0xff, 0x02, 0x00, 0x05, 0x14, 0x0d, 0x04, 0x00, 0xf0, 0x05, 0x16, 0x0d, 0x02,
+    0x00, 0x20, 0xd5, 0xff, 0xad, 0xff, 0x42, 0x00, 0x02, 0x00, 0x09, 0x09, 0x06, 0x0c, 0x00, 0xf0,
+    0x09, 0x0d, 0x06, 0x04, 0x00, 0x30, 0xaf, 0x01, 0xf2, 0xff, 0x0b, 0xfe, 0x02, 0x00, 0x01, 0x0a,
+    0x15, 0x03, 0x00, 0xf0, 0x08, 0x0a, 0x07, 0x03, 0x00, 0x30, 0xe0, 0x00, 0x00, 0x00, 0xbd, 0x00,
+    0x02, 0x00, 0x08, 0x08, 0x09, 0x06, 0x00, 0xf0, 0x0b, 0x08, 0x03, 0x06, 0x00, 0x30, 0x48, 0x00,
+    0xb2, 0xff, 0x43, 0x00, 0x02, 0x00, 0x03, 0x0a, 0x09, 0x07, 0x00, 0xf0, 0x06, 0x0a, 0x03, 0x07,
+    0x00, 0x30, 0x81, 0xff, 0xc2, 0xff, 0x2b, 0x00, 0x03, 0x00, 0x0c, 0x0a, 0x0a, 0x08, 0x00, 0xf0,
+    0x11, 0x0a, 0x05, 0x04, 0x00, 0x20, 0x0c, 0x0e, 0x05, 0x04, 0x00, 0x20, 0x16, 0xff, 0x78, 0x00,
+    0xbe, 0xff, 0x02, 0x00, 0x00, 0x0f, 0x18, 0x03, 0x00, 0xf0, 0x08, 0x0f, 0x08, 0x03, 0x00, 0x30,
+    0xd2, 0xff, 0x62, 0x00, 0xb7, 0xff, 0x02, 0x00, 0x08, 0x05, 0x09, 0x06, 0x00, 0xf0, 0x08, 0x07,
+    0x09, 0x02, 0x00, 0x30, 0x7d, 0x00, 0xf4, 0xff, 0x3d, 0xfe, 0x02, 0x00, 0x04, 0x0d, 0x06, 0x09,
+    0x00, 0xf0, 0x04, 0x10, 0x06, 0x03, 0x00, 0x30, 0x07, 0x00, 0x36, 0x00, 0xfa, 0xff, 0x02, 0x00,
+    0x0c, 0x11, 0x09, 0x04, 0x00, 0xf0, 0x0c, 0x13, 0x09, 0x02, 0x00, 0x20, 0x2e, 0x00, 0xd5, 0xff,
+    0x07, 0x01, 0x02, 0x00, 0x09, 0x0c, 0x06, 0x06, 0x00, 0xf0, 0x09, 0x0f, 0x06, 0x03, 0x00, 0x20,
+    0x4d, 0x01, 0x1d, 0x00, 0xc1, 0xfe, 0x03, 0x00, 0x09, 0x09, 0x0e, 0x0a, 0x00, 0xf0, 0x10, 0x09,
+    0x07, 0x05, 0x00, 0x20, 0x09, 0x0e, 0x07, 0x05, 0x00, 0x20, 0xdb, 0x00, 0xf5, 0xff, 0x49, 0xfe,
+    0x03, 0x00, 0x01, 0x09, 0x0e, 0x0a, 0x00, 0xf0, 0x01, 0x09, 0x07, 0x05, 0x00, 0x20, 0x08, 0x0e,
+    0x07, 0x05, 0x00, 0x20, 0x9e, 0xff, 0x99, 0xff, 0x34, 0x00, 0x02, 0x00, 0x08, 0x07, 0x09, 0x11,
+    0x00, 0xf0, 0x0b, 0x07, 0x03, 0x11, 0x00, 0x30, 0x1b, 0x00, 0xac, 0xff, 0x34, 0x00, 0x03, 0x00,
+    0x03, 0x04, 0x06, 0x14, 0x00, 0xf0, 0x03, 0x04, 0x03, 0x0a, 0x00, 0x20, 0x06, 0x0e, 0x03, 0x0a,
+    0x00, 0x20, 0x7c, 0xff, 0x47, 0xff, 0x33, 0x00, 0x02, 0x00, 0x07, 0x08, 0x0a, 0x04, 0x00, 0xf0,
+    0x07, 0x08, 0x05, 0x04, 0x00, 0x20, 0x9b, 0x00, 0xd8, 0xff, 0xab, 0x01, 0x02, 0x00, 0x0a, 0x07,
+    0x04, 0x09, 0x00, 0xf0, 0x0c, 0x07, 0x02, 0x09, 0x00, 0x20, 0x3f, 0x00, 0x31, 0x00, 0xa6, 0xff,
+    0x02, 0x00, 0x0a, 0x0f, 0x06, 0x09, 0x00, 0xf0, 0x0c, 0x0f, 0x02, 0x09, 0x00, 0x30, 0x4b, 0xff,
+    0xd2, 0x00, 0xd2, 0xff, 0x03, 0x00, 0x03, 0x08, 0x06, 0x10, 0x00, 0xf0, 0x03, 0x08, 0x03, 0x08,
+    0x00, 0x20, 0x06, 0x10, 0x03, 0x08, 0x00, 0x20, 0xa2, 0xff, 0x92, 0xff, 0x1f, 0x00, 0x02, 0x00,
+    0x0c, 0x11, 0x09, 0x04, 0x00, 0xf0, 0x0c, 0x13, 0x09, 0x02, 0x00, 0x20, 0x4f, 0x00, 0xf9, 0xff,
+    0xd8, 0xfe, 0x02, 0x00, 0x03, 0x11, 0x09, 0x04, 0x00, 0xf0, 0x03, 0x13, 0x09, 0x02, 0x00, 0x20,
+    0xa9, 0x01, 0x1c, 0x00, 0x52, 0xfb, 0x02, 0x00, 0x0a, 0x01, 0x09, 0x06, 0x00, 0xf0, 0x0d, 0x01,
+    0x03, 0x06, 0x00, 0x30, 0xb3, 0xff, 0x2d, 0x02, 0xdb, 0xff, 0x02, 0x00, 0x05, 0x07, 0x04, 0x0a,
+    0x00, 0xf0, 0x05, 0x0c, 0x04, 0x05, 0x00, 0x20, 0x9e, 0x00, 0xf4, 0xff, 0x57, 0x00, 0x02, 0x00,
+    0x07, 0x05, 0x0c, 0x06, 0x00, 0xf0, 0x0b, 0x05, 0x04, 0x06, 0x00, 0x30, 0x5d, 0x00, 0xad, 0xff,
+    0x4e, 0x00, 0x02, 0x00, 0x06, 0x04, 0x09, 0x08, 0x00, 0xf0, 0x09, 0x04, 0x03, 0x08, 0x00, 0x30,
+    0x80, 0xff, 0x26, 0x01, 0x06, 0x00, 0x03, 0x00, 0x0c, 0x10, 0x0a, 0x08, 0x00, 0xf0, 0x11, 0x10,
+    0x05, 0x04, 0x00, 0x20, 0x0c, 0x14, 0x05, 0x04, 0x00, 0x20, 0x27, 0x00, 0x9d, 0xff, 0x37, 0x00,
+    0x03, 0x00, 0x02, 0x10, 0x0a, 0x08, 0x00, 0xf0, 0x02, 0x10, 0x05, 0x04, 0x00, 0x20, 0x07, 0x14,
+    0x05, 0x04, 0x00, 0x20, 0x37, 0xff, 0x53, 0xfe, 0x28, 0x00, 0x03, 0x00, 0x00, 0x00, 0x18, 0x04,
+    0x00, 0xf0, 0x0c, 0x00, 0x0c, 0x02, 0x00, 0x20, 0x00, 0x02, 0x0c, 0x02, 0x00, 0x20, 0x5f, 0xff,
+    0x07, 0xff, 0xfe, 0xff, 0x02, 0x00, 0x00, 0x06, 0x09, 0x06, 0x00, 0xf0, 0x00, 0x08, 0x09, 0x02,
+    0x00, 0x30, 0xc4, 0x00, 0x35, 0x00, 0x50, 0xff, 0x03, 0x00, 0x00, 0x04, 0x18, 0x06, 0x00, 0xf0,
+    0x0c, 0x04, 0x0c, 0x03, 0x00, 0x20, 0x00, 0x07, 0x0c, 0x03, 0x00, 0x20, 0xd2, 0x00, 0xd6, 0xff,
+    0x37, 0x01, 0x02, 0x00, 0x05, 0x00, 0x0b, 0x04, 0x00, 0xf0, 0x05, 0x02, 0x0b, 0x02, 0x00, 0x20,
+    0x3a, 0x00, 0x3c, 0x00, 0x97, 0xff, 0x03, 0x00, 0x01, 0x01, 0x16, 0x04, 0x00, 0xf0, 0x0c, 0x01,
+    0x0b, 0x02, 0x00, 0x20, 0x01, 0x03, 0x0b, 0x02, 0x00, 0x20, 0x89, 0xfe, 0x13, 0xff, 0xfc, 0xff,
+    0x02, 0x00, 0x09, 0x06, 0x06, 0x12, 0x00, 0xf0, 0x09, 0x0f, 0x06, 0x09, 0x00, 0x20, 0x1a, 0x00,
+    0x44, 0xff, 0x31, 0x00, 0x02, 0x00, 0x02, 0x09, 0x14, 0x04, 0x00, 0xf0, 0x02, 0x0b, 0x14, 0x02,
+    0x00, 0x20, 0x92, 0x00, 0x24, 0x00, 0x95, 0xff, 0x02, 0x00, 0x05, 0x02, 0x0e, 0x0e, 0x00, 0xf0,
+    0x05, 0x09, 0x0e, 0x07, 0x00, 0x20, 0xcf, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x02, 0x00, 0x04, 0x02,
+    0x10, 0x06, 0x00, 0xf0, 0x04, 0x05, 0x10, 0x03, 0x00, 0x20, 0xc5, 0xff, 0xd0, 0xfe, 0xf8, 0xff,
+    0x02, 0x00, 0x02, 0x03, 0x13, 0x03, 0x00, 0xf0, 0x02, 0x04, 0x13, 0x01, 0x00, 0x30, 0x62, 0xff,
+    0x6e, 0x02, 0x10, 0x00, 0x02, 0x00, 0x07, 0x01, 0x0a, 0x04, 0x00, 0xf0, 0x07, 0x03, 0x0a, 0x02,
+    0x00, 0x20, 0x5b, 0xff, 0xb7, 0x00, 0xd0, 0xff, 0x02, 0x00, 0x00, 0x09, 0x04, 0x0f, 0x00, 0xf0,
+    0x00, 0x0e, 0x04, 0x05, 0x00, 0x30, 0x61, 0x00, 0x28, 0x00, 0x36, 0xff, 0x02, 0x00, 0x02, 0x0a,
+    0x15, 0x03, 0x00, 0xf0, 0x02, 0x0b, 0x15, 0x01, 0x00, 0x30, 0x7d, 0xfc, 0x89, 0x00, 0x23, 0x00,
+    0x30, 0xff, 0x96, 0x00, 0x02, 0x00, 0x03, 0x00, 0x06, 0x06, 0x00, 0xf0, 0x06, 0x00, 0x03, 0x06,
+    0x00, 0x20, 0xe0, 0xfd, 0xee, 0x00, 0xb5, 0xff, 0x02, 0x00, 0x06, 0x04, 0x0e, 0x09, 0x00, 0xf0,
+    0x06, 0x07, 0x0e, 0x03, 0x00, 0x30, 0x28, 0x00, 0x70, 0xff, 0x6a, 0x00, 0x02, 0x00, 0x09, 0x01,
+    0x06, 0x09, 0x00, 0xf0, 0x0b, 0x01, 0x02, 0x09, 0x00, 0x30, 0x14, 0x00, 0x36, 0xff, 0x2b, 0x00,
+    0x02, 0x00, 0x0f, 0x08, 0x09, 0x09, 0x00, 0xf0, 0x0f, 0x0b, 0x09, 0x03, 0x00, 0x30, 0x06, 0xff,
+    0x96, 0xfe, 0x06, 0x00, 0x02, 0x00, 0x08, 0x00, 0x04, 0x15, 0x00, 0xf0, 0x08, 0x07, 0x04, 0x07,
+    0x00, 0x30, 0xff, 0xff, 0x61, 0x00, 0x96, 0xff, 0x02, 0x00, 0x03, 0x16, 0x13, 0x02, 0x00, 0xf0,
+    0x03, 0x17, 0x13, 0x01, 0x00, 0x20, 0x0d, 0x00, 0x98, 0xff, 0x5b, 0x00, 0x02, 0x00, 0x02, 0x0f,
+    0x14, 0x03, 0x00, 0xf0, 0x02, 0x10, 0x14, 0x01, 0x00, 0x30, 0x56, 0x00, 0xc3, 0xff, 0xdc, 0x00,
+    0x02, 0x00, 0x13, 0x00, 0x04, 0x0d, 0x00, 0xf0, 0x13, 0x00, 0x02, 0x0d, 0x00, 0x20, 0x1e, 0x00,
+    0x21, 0xff, 0x19, 0x00, 0x02, 0x00, 0x01, 0x07, 0x08, 0x08, 0x00, 0xf0, 0x01, 0x0b, 0x08, 0x04,
+    0x00, 0x20, 0x65, 0x00, 0x27, 0x00, 0x4f, 0xff, 0x02, 0x00, 0x0e, 0x0e, 0x06, 0x09, 0x00, 0xf0,
+    0x0e, 0x11, 0x06, 0x03, 0x00, 0x30, 0x6f, 0xff, 0xdb, 0xfe, 0x09, 0x00, 0x02, 0x00, 0x04, 0x0e,
+    0x06, 0x09, 0x00, 0xf0, 0x04, 0x11, 0x06, 0x03, 0x00, 0x30, 0x51, 0x00, 0x27, 0x00, 0x4f, 0xff,
+    0x02, 0x00, 0x0e, 0x05, 0x04, 0x0a, 0x00, 0xf0, 0x0e, 0x05, 0x02, 0x0a, 0x00, 0x20, 0x3d, 0x00,
+    0x0a, 0x00, 0x09, 0xff, 0x02, 0x00, 0x06, 0x05, 0x04, 0x0a, 0x00, 0xf0, 0x08, 0x05, 0x02, 0x0a,
+    0x00, 0x20, 0xa2, 0xff, 0x6f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0e, 0x05, 0x06, 0x06, 0x00, 0xf0,
+    0x0e, 0x08, 0x06, 0x03, 0x00, 0x20, 0xb4, 0xff, 0x6f, 0x00, 0xad, 0xff, 0x02, 0x00, 0x04, 0x05,
+    0x06, 0x06, 0x00, 0xf0, 0x04, 0x08, 0x06, 0x03, 0x00, 0x20, 0x36, 0x07, 0xe8, 0xff, 0xb9, 0x00,
+    0x02, 0x00, 0x00, 0x02, 0x18, 0x15, 0x00, 0xf0, 0x08, 0x02, 0x08, 0x15, 0x00, 0x30, 0x30, 0x00,
+    0x9f, 0xff, 0x4d, 0x00, 0x02, 0x00, 0x01, 0x02, 0x06, 0x0d, 0x00, 0xf0, 0x03, 0x02, 0x02, 0x0d,
+    0x00, 0x30, 0x9b, 0xff, 0xe4, 0x00, 0xe6, 0xff, 0x02, 0x00, 0x14, 0x00, 0x04, 0x15, 0x00, 0xf0,
+    0x14, 0x00, 0x02, 0x15, 0x00, 0x20, 0x49, 0xff, 0xdc, 0x00, 0xc9, 0xff, 0x02, 0x00, 0x00, 0x04,
+    0x04, 0x14, 0x00, 0xf0, 0x02, 0x04, 0x02, 0x14, 0x00, 0x20, 0xc5, 0xff, 0x99, 0x00, 0xd8, 0xff,
+    0x02, 0x00, 0x08, 0x10, 0x09, 0x06, 0x00, 0xf0, 0x08, 0x12, 0x09, 0x02, 0x00, 0x30, 0x9c, 0xff,
+    0x6a, 0xfe, 0xfb, 0xff, 0x02, 0x00, 0x07, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x09, 0x00, 0x02, 0x09,
+    0x00, 0x30, 0x5e, 0x00, 0x2b, 0x00, 0x9f, 0xff, 0x02, 0x00, 0x10, 0x0c, 0x07, 0x09, 0x00, 0xf0,
+    0x10, 0x0f, 0x07, 0x03, 0x00, 0x30, 0x9a, 0xff, 0x82, 0x00, 0xbb, 0xff, 0x02, 0x00, 0x05, 0x15,
+    0x0e, 0x03, 0x00, 0xf0, 0x0c, 0x15, 0x07, 0x03, 0x00, 0x20, 0x04, 0x00, 0x92, 0xff, 0x43, 0x00,
+    0x02, 0x00, 0x0b, 0x05, 0x06, 0x09, 0x00, 0xf0, 0x0b, 0x05, 0x03, 0x09, 0x00, 0x20, 0x3f, 0x00,
+    0xb0, 0xff, 0x8e, 0x00, 0x02, 0x00, 0x0a, 0x05, 0x04, 0x0a, 0x00, 0xf0, 0x0c, 0x05, 0x02, 0x0a,
+    0x00, 0x20, 0x93, 0xff, 0x0e, 0x01, 0x07, 0x00, 0x02, 0x00, 0x0a, 0x06, 0x06, 0x09, 0x00, 0xf0,
+    0x0c, 0x06, 0x02, 0x09, 0x00, 0x30, 0x05, 0x00, 0x49, 0xff, 0x10, 0x00, 0x02, 0x00, 0x07, 0x05,
+    0x06, 0x09, 0x00, 0xf0, 0x0a, 0x05, 0x03, 0x09, 0x00, 0x20, 0xfe, 0xff, 0x3f, 0x00, 0xcb, 0xff,
+    0x02, 0x00, 0x0e, 0x0e, 0x0a, 0x04, 0x00, 0xf0, 0x0e, 0x10, 0x0a, 0x02, 0x00, 0x20, 0x7e, 0xff,
+    0x50, 0xff, 0x10, 0x00, 0x03, 0x00, 0x05, 0x05, 0x0e, 0x0e, 0x00, 0xf0, 0x05, 0x05, 0x07, 0x07,
+    0x00, 0x20, 0x0c, 0x0c, 0x07, 0x07, 0x00, 0x20, 0xec, 0xff, 0x69, 0xff, 0x47, 0x00, 0x03, 0x00,
+    0x0c, 0x08, 0x0c, 0x06, 0x00, 0xf0, 0x12, 0x08, 0x06, 0x03, 0x00, 0x20, 0x0c, 0x0b, 0x06, 0x03,
+    0x00, 0x20, 0x7f, 0x00, 0x0b, 0x00, 0x1e, 0xff, 0x03, 0x00, 0x06, 0x06, 0x0c, 0x0c, 0x00, 0xf0,
+    0x06, 0x06, 0x06, 0x06, 0x00, 0x20, 0x0c, 0x0c, 0x06, 0x06, 0x00, 0x20, 0x77, 0xff, 0x63, 0xff,
+    0x28, 0x00, 0x02, 0x00, 0x0b, 0x0d, 0x06, 0x0a, 0x00, 0xf0, 0x0d, 0x0d, 0x02, 0x0a, 0x00, 0x30,
+    0x31, 0x00, 0xb2, 0xff, 0x6c, 0x00, 0x03, 0x00, 0x01, 0x0a, 0x14, 0x08, 0x00, 0xf0, 0x01, 0x0a,
+    0x0a, 0x04, 0x00, 0x20, 0x0b, 0x0e, 0x0a, 0x04, 0x00, 0x20, 0x72, 0xff, 0xa1, 0xfe, 0x28, 0x00,
+    0x02, 0x00, 0x0f, 0x0d, 0x09, 0x06, 0x00, 0xf0, 0x0f, 0x0f, 0x09, 0x02, 0x00, 0x30, 0x28, 0x00,
+    0x71, 0xff, 0x1f, 0x00, 0x02, 0x00, 0x09, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x09, 0x03, 0x06, 0x03,
+    0x00, 0x30, 0xf4, 0x00, 0x01, 0x00, 0xd2, 0x00, 0x02, 0x00, 0x0a, 0x01, 0x05, 0x0e, 0x00, 0xf0,
+    0x0a, 0x08, 0x05, 0x07, 0x00, 0x20, 0xf5, 0xfe, 0x90, 0x01, 0xd5, 0xff, 0x02, 0x00, 0x03, 0x04,
+    0x10, 0x06, 0x00, 0xf0, 0x03, 0x06, 0x10, 0x02, 0x00, 0x30, 0x84, 0xfe, 0x6c, 0xfe, 0x25, 0x00,
+    0x02, 0x00, 0x10, 0x03, 0x08, 0x09, 0x00, 0xf0, 0x10, 0x06, 0x08, 0x03, 0x00, 0x30, 0x58, 0xff,
+    0x73, 0xfe, 0xf9, 0xff, 0x02, 0x00, 0x07, 0x0d, 0x06, 0x0a, 0x00, 0xf0, 0x09, 0x0d, 0x02, 0x0a,
+    0x00, 0x30, 0x57, 0x00, 0x2c, 0x00, 0x4f, 0xff, 0x02, 0x00, 0x0f, 0x0d, 0x09, 0x06, 0x00, 0xf0,
+    0x0f, 0x0f, 0x09, 0x02, 0x00, 0x30, 0x98, 0xff, 0xb2, 0xfe, 0xfa, 0xff, 0x02, 0x00, 0x00, 0x0d,
+    0x09, 0x06, 0x00, 0xf0, 0x00, 0x0f, 0x09, 0x02, 0x00, 0x30, 0x58, 0xff, 0x9f, 0xfe, 0x25, 0x00,
+    0x02, 0x00, 0x0d, 0x10, 0x09, 0x06, 0x00, 0xf0, 0x0d, 0x12, 0x09, 0x02, 0x00, 0x30, 0xb8, 0xff,
+    0x4b, 0xff, 0x09, 0x00, 0x02, 0x00, 0x02, 0x10, 0x09, 0x06, 0x00, 0xf0, 0x02, 0x12, 0x09, 0x02,
+    0x00, 0x30, 0x24, 0x00, 0xf6, 0xff, 0xcd, 0x00, 0x02, 0x00, 0x05, 0x10, 0x12, 0x03, 0x00, 0xf0,
+    0x05, 0x11, 0x12, 0x01, 0x00, 0x30, 0xd1, 0xff, 0x93, 0x00, 0xc1, 0xff, 0x02, 0x00, 0x01, 0x10,
+    0x12, 0x03, 0x00, 0xf0, 0x01, 0x11, 0x12, 0x01, 0x00, 0x30, 0xe2, 0xff, 0x82, 0xff, 0x32, 0x00,
+    0x02, 0x00, 0x05, 0x00, 0x12, 0x03, 0x00, 0xf0, 0x05, 0x01, 0x12, 0x01, 0x00, 0x30, 0x03, 0x00,
+    0x83, 0xff, 0x22, 0x00, 0x02, 0x00, 0x01, 0x01, 0x13, 0x02, 0x00, 0xf0, 0x01, 0x02, 0x13, 0x01,
+    0x00, 0x20, 0x83, 0xff, 0x66, 0xff, 0x2f, 0x00, 0x02, 0x00, 0x0e, 0x02, 0x06, 0x0b, 0x00, 0xf0,
+    0x10, 0x02, 0x02, 0x0b, 0x00, 0x30, 0xb3, 0xff, 0x3c, 0x00, 0xa7, 0xff, 0x02, 0x00, 0x04, 0x0f,
+    0x0f, 0x06, 0x00, 0xf0, 0x09, 0x0f, 0x05, 0x06, 0x00, 0x30, 0xdf, 0xff, 0xec, 0xff, 0x35, 0x00,
+    0x02, 0x00, 0x0e, 0x02, 0x06, 0x0b, 0x00, 0xf0, 0x10, 0x02, 0x02, 0x0b, 0x00, 0x30, 0x72, 0xff,
+    0xcc, 0xfe, 0xfd, 0xff, 0x02, 0x00, 0x04, 0x02, 0x06, 0x0b, 0x00, 0xf0, 0x06, 0x02, 0x02, 0x0b,
+    0x00, 0x30, 0x4d, 0x00, 0x3b, 0x00, 0x8c, 0xff, 0x02, 0x00, 0x12, 0x02, 0x06, 0x09, 0x00, 0xf0,
+    0x12, 0x05, 0x06, 0x03, 0x00, 0x30, 0xb3, 0xff, 0x31, 0xff, 0x03, 0x00, 0x03, 0x00, 0x01, 0x02,
+    0x16, 0x04, 0x00, 0xf0, 0x01, 0x02, 0x0b, 0x02, 0x00, 0x20, 0x0c, 0x04, 0x0b, 0x02, 0x00, 0x20,
+    0x94, 0xfe, 0x9d, 0x00, 0x08, 0x00, 0x02, 0x00, 0x02, 0x00, 0x15, 0x0c, 0x00, 0xf0, 0x09, 0x00,
+    0x07, 0x0c, 0x00, 0x30, 0x1c, 0x00, 0xb5, 0xff, 0x45, 0x00, 0x02, 0x00, 0x00, 0x0c, 0x12, 0x03,
+    0x00, 0xf0, 0x00, 0x0d, 0x12, 0x01, 0x00, 0x30, 0x8d, 0xff, 0x64, 0xff, 0x2c, 0x00, 0x02, 0x00,
+    0x0c, 0x02, 0x06, 0x09, 0x00, 0xf0, 0x0e, 0x02, 0x02, 0x09, 0x00, 0x30, 0xff, 0xff, 0x78, 0xff,
+    0x11, 0x00, 0x02, 0x00, 0x03, 0x0a, 0x12, 0x03, 0x00, 0xf0, 0x03, 0x0b, 0x12, 0x01, 0x00, 0x30,
+    0x45, 0xfe, 0xb7, 0xfe, 0x1e, 0x00, 0x02, 0x00, 0x10, 0x03, 0x08, 0x09, 0x00, 0xf0, 0x10, 0x06,
+    0x08, 0x03, 0x00, 0x30, 0x41, 0x00, 0xd5, 0xff, 0x1c, 0x01, 0x02, 0x00, 0x03, 0x07, 0x12, 0x03,
+    0x00, 0xf0, 0x03, 0x08, 0x12, 0x01, 0x00, 0x30, 0x23, 0x00, 0xe4, 0xff, 0x75, 0x00, 0x02, 0x00,
+    0x09, 0x0b, 0x06, 0x09, 0x00, 0xf0, 0x0b, 0x0b, 0x02, 0x09, 0x00, 0x30, 0x99, 0xff, 0x05, 0x01,
+    0xd1, 0xff, 0x02, 0x00, 0x09, 0x08, 0x06, 0x09, 0x00, 0xf0, 0x0b, 0x08, 0x02, 0x09, 0x00, 0x30,
+    0xc9, 0xff, 0x38, 0xff, 0x24, 0x00, 0x02, 0x00, 0x0f, 0x00, 0x02, 0x12, 0x00, 0xf0, 0x0f, 0x00,
+    0x01, 0x12, 0x00, 0x20, 0xe1, 0xff, 0x1f, 0xff, 0x02, 0x00, 0x02, 0x00, 0x07, 0x00, 0x02, 0x12,
+    0x00, 0xf0, 0x08, 0x00, 0x01, 0x12, 0x00, 0x20, 0x25, 0x01, 0x1d, 0x00, 0xe6, 0xfe, 0x02, 0x00,
+    0x11, 0x03, 0x07, 0x09, 0x00, 0xf0, 0x11, 0x06, 0x07, 0x03, 0x00, 0x30, 0xc9, 0xff, 0x31, 0xff,
+    0x00, 0x00, 0x02, 0x00, 0x03, 0x12, 0x09, 0x06, 0x00, 0xf0, 0x03, 0x14, 0x09, 0x02, 0x00, 0x30,
+    0x0c, 0x00, 0xee, 0xff, 0x59, 0x00, 0x02, 0x00, 0x03, 0x12, 0x15, 0x03, 0x00, 0xf0, 0x03, 0x13,
+    0x15, 0x01, 0x00, 0x30, 0x30, 0xff, 0xb7, 0xfe, 0xf9, 0xff, 0x02, 0x00, 0x00, 0x03, 0x07, 0x09,
+    0x00, 0xf0, 0x00, 0x06, 0x07, 0x03, 0x00, 0x30, 0xdc, 0xff, 0x79, 0x00, 0xdb, 0xff, 0x02, 0x00,
+    0x02, 0x07, 0x16, 0x03, 0x00, 0xf0, 0x02, 0x08, 0x16, 0x01, 0x00, 0x30, 0x6d, 0x03, 0xf1, 0xff,
+    0x86, 0xfd, 0x03, 0x00, 0x00, 0x03, 0x18, 0x10, 0x00, 0xf0, 0x00, 0x03, 0x0c, 0x08, 0x00, 0x20,
+    0x0c, 0x0b, 0x0c, 0x08, 0x00, 0x20, 0x39, 0x00, 0x2c, 0x00, 0x90, 0xff, 0x02, 0x00, 0x0d, 0x11,
+    0x09, 0x04, 0x00, 0xf0, 0x0d, 0x13, 0x09, 0x02, 0x00, 0x20, 0xae, 0x00, 0xcd, 0xff, 0xb4, 0x00,
+    0x03, 0x00, 0x05, 0x05, 0x0c, 0x08, 0x00, 0xf0, 0x05, 0x05, 0x06, 0x04, 0x00, 0x20, 0x0b, 0x09,
+    0x06, 0x04, 0x00, 0x20, 0x51, 0x00, 0xef, 0xff, 0x9d, 0x00, 0x03, 0x00, 0x05, 0x06, 0x0e, 0x06,
+    0x00, 0xf0, 0x0c, 0x06, 0x07, 0x03, 0x00, 0x20, 0x05, 0x09, 0x07, 0x03, 0x00, 0x20, 0x77, 0xff,
+    0xba, 0xfe, 0xfa, 0xff, 0x03, 0x00, 0x05, 0x10, 0x0e, 0x06, 0x00, 0xf0, 0x05, 0x10, 0x07, 0x03,
+    0x00, 0x20, 0x0c, 0x13, 0x07, 0x03, 0x00, 0x20, 0x04, 0x01, 0x1f, 0x00, 0xed, 0xfe, 0x02, 0x00,
+    0x12, 0x02, 0x06, 0x09, 0x00, 0xf0, 0x12, 0x05, 0x06, 0x03, 0x00, 0x30, 0x59, 0x00, 0x03, 0x00,
+    0x4b, 0xff, 0x02, 0x00, 0x00, 0x02, 0x06, 0x09, 0x00, 0xf0, 0x00, 0x05, 0x06, 0x03, 0x00, 0x30,
+    0xbf, 0xfe, 0x9e, 0x00, 0x08, 0x00, 0x03, 0x00, 0x03, 0x04, 0x14, 0x0a, 0x00, 0xf0, 0x0d, 0x04,
+    0x0a, 0x05, 0x00, 0x20, 0x03, 0x09, 0x0a, 0x05, 0x00, 0x20, 0x3a, 0x00, 0xa4, 0xff, 0x2c, 0x00,
+    0x02, 0x00, 0x02, 0x0d, 0x09, 0x08, 0x00, 0xf0, 0x05, 0x0d, 0x03, 0x08, 0x00, 0x30, 0xed, 0xfe,
+    0x86, 0x00, 0x03, 0x00, 0x02, 0x00, 0x02, 0x01, 0x15, 0x0f, 0x00, 0xf0, 0x09, 0x01, 0x07, 0x0f,
+    0x00, 0x30, 0x16, 0x02, 0xd5, 0xff, 0x1f, 0x01, 0x02, 0x00, 0x05, 0x0c, 0x0e, 0x08, 0x00, 0xf0,
+    0x0c, 0x0c, 0x07, 0x08, 0x00, 0x20, 0x43, 0xff, 0xd0, 0xfe, 0x2c, 0x00, 0x02, 0x00, 0x06, 0x07,
+    0x0c, 0x04, 0x00, 0xf0, 0x06, 0x07, 0x06, 0x04, 0x00, 0x20, 0x86, 0xff, 0xd6, 0x00, 0xd2, 0xff,
+    0x02, 0x00, 0x06, 0x05, 0x09, 0x06, 0x00, 0xf0, 0x09, 0x05, 0x03, 0x06, 0x00, 0x30, 0xff, 0xff,
+    0x5a, 0x00, 0xc3, 0xff, 0x02, 0x00, 0x0d, 0x0b, 0x06, 0x06, 0x00, 0xf0, 0x0d, 0x0b, 0x03, 0x06,
+    0x00, 0x20, 0xa5, 0xff, 0x1f, 0xff, 0x00, 0x00, 0x02, 0x00, 0x05, 0x0b, 0x06, 0x06, 0x00, 0xf0,
+    0x08, 0x0b, 0x03, 0x06, 0x00, 0x20, 0xfa, 0xff, 0xdc, 0xff, 0x42, 0x00, 0x02, 0x00, 0x06, 0x04,
+    0x12, 0x02, 0x00, 0xf0, 0x06, 0x05, 0x12, 0x01, 0x00, 0x20, 0x31, 0x00, 0xb6, 0xff, 0x42, 0x00,
+    0x02, 0x00, 0x00, 0x02, 0x06, 0x0b, 0x00, 0xf0, 0x02, 0x02, 0x02, 0x0b, 0x00, 0x30, 0x63, 0x00,
+    0xf8, 0xff, 0x96, 0x00, 0x02, 0x00, 0x12, 0x00, 0x06, 0x0f, 0x00, 0xf0, 0x14, 0x00, 0x02, 0x0f,
+    0x00, 0x30, 0x3f, 0xff, 0xb1, 0x00, 0xc9, 0xff, 0x02, 0x00, 0x00, 0x00, 0x06, 0x0d, 0x00, 0xf0,
+    0x02, 0x00, 0x02, 0x0d, 0x00, 0x30, 0x9b, 0xff, 0x5b, 0xff, 0x27, 0x00, 0x02, 0x00, 0x0c, 0x00,
+    0x06, 0x09, 0x00, 0xf0, 0x0e, 0x00, 0x02, 0x09, 0x00, 0x30, 0x59, 0x00, 0xf9, 0xff, 0xde, 0xfe,
+    0x02, 0x00, 0x06, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x08, 0x00, 0x02, 0x09, 0x00, 0x30, 0x02, 0x03,
+    0xfe, 0xff, 0x3e, 0x01, 0x02, 0x00, 0x00, 0x02, 0x18, 0x04, 0x00, 0xf0, 0x08, 0x02, 0x08, 0x04,
+    0x00, 0x30, 0xc2, 0xfe, 0xd9, 0x00, 0xd0, 0xff, 0x02, 0x00, 0x03, 0x0d, 0x12, 0x04, 0x00, 0xf0,
+    0x0c, 0x0d, 0x09, 0x04, 0x00, 0x20, 0x39, 0xff, 0xed, 0xfd, 0x1f, 0x00, 0x02, 0x00, 0x09, 0x07,
+    0x0a, 0x04, 0x00, 0xf0, 0x09, 0x07, 0x05, 0x04, 0x00, 0x20, 0xba, 0xff, 0x25, 0xff, 0x02, 0x00,
+    0x02, 0x00, 0x05, 0x08, 0x0c, 0x03, 0x00, 0xf0, 0x0b, 0x08, 0x06, 0x03, 0x00, 0x20, 0xf5, 0xff,
+    0x62, 0x00, 0xe3, 0xff, 0x02, 0x00, 0x04, 0x0e, 0x13, 0x03, 0x00, 0xf0, 0x04, 0x0f, 0x13, 0x01,
+    0x00, 0x30, 0x6c, 0xfe, 0x47, 0xfe, 0xf2, 0xff, 0x02, 0x00, 0x0a, 0x00, 0x04, 0x14, 0x00, 0xf0,
+    0x0a, 0x0a, 0x04, 0x0a, 0x00, 0x20, 0xa7, 0xff, 0x8c, 0x00, 0xf6, 0xff, 0x02, 0x00, 0x08, 0x0f,
+    0x09, 0x06, 0x00, 0xf0, 0x08, 0x11, 0x09, 0x02, 0x00, 0x30, 0xfa, 0x00, 0xf7, 0xff, 0xec, 0xfe,
+    0x02, 0x00, 0x02, 0x09, 0x0f, 0x04, 0x00, 0xf0, 0x07, 0x09, 0x05, 0x04, 0x00, 0x30, 0x9c, 0xff,
+    0x95, 0x00, 0x00, 0x00, 0x02, 0x00, 0x08, 0x04, 0x0c, 0x07, 0x00, 0xf0, 0x0c, 0x04, 0x04, 0x07,
+    0x00, 0x30, 0x8a, 0x00, 0xfd, 0xff, 0x28, 0xff, 0x02, 0x00, 0x00, 0x0a, 0x06, 0x09, 0x00, 0xf0,
+    0x00, 0x0d, 0x06, 0x03, 0x00, 0x30, 0x9c, 0x00, 0x26, 0x00, 0x35, 0xff, 0x02, 0x00, 0x12, 0x05,
+    0x06, 0x09, 0x00, 0xf0, 0x12, 0x08, 0x06, 0x03, 0x00, 0x30, 0xae, 0xff, 0x84, 0x00, 0xca, 0xff,
+    0x03, 0x00, 0x00, 0x12, 0x10, 0x06, 0x00, 0xf0, 0x00, 0x12, 0x08, 0x03, 0x00, 0x20, 0x08, 0x15,
+    0x08, 0x03, 0x00, 0x20, 0x65, 0x00, 0xfb, 0xff, 0x6d, 0x00, 0x03, 0x00, 0x09, 0x12, 0x0e, 0x06,
+    0x00, 0xf0, 0x10, 0x12, 0x07, 0x03, 0x00, 0x20, 0x09, 0x15, 0x07, 0x03, 0x00, 0x20, 0x9d, 0xff,
+    0x24, 0xff, 0x00, 0x00, 0x03, 0x00, 0x01, 0x14, 0x14, 0x04, 0x00, 0xf0, 0x01, 0x14, 0x0a, 0x02,
+    0x00, 0x20, 0x0b, 0x16, 0x0a, 0x02, 0x00, 0x20, 0x94, 0xff, 0x8c, 0xff, 0x39, 0x00, 0x03, 0x00,
+    0x02, 0x08, 0x14, 0x06, 0x00, 0xf0, 0x0c, 0x08, 0x0a, 0x03, 0x00, 0x20, 0x02, 0x0b, 0x0a, 0x03,
+    0x00, 0x20, 0xf2, 0xff, 0x21, 0x00, 0x9e, 0xff, 0x02, 0x00, 0x07, 0x08, 0x06, 0x09, 0x00, 0xf0,
+    0x09, 0x08, 0x02, 0x09, 0x00, 0x30, 0xb6, 0x01, 0x21, 0x00, 0x35, 0xff, 0x02, 0x00, 0x08, 0x05,
+    0x0c, 0x08, 0x00, 0xf0, 0x0c, 0x05, 0x04, 0x08, 0x00, 0x30, 0xb8, 0x00, 0xc0, 0xff, 0x68, 0x00,
+    0x02, 0x00, 0x04, 0x05, 0x0c, 0x08, 0x00, 0xf0, 0x08, 0x05, 0x04, 0x08, 0x00, 0x30, 0xb5, 0x00,
+    0x05, 0x00, 0xcb, 0x00, 0x02, 0x00, 0x0a, 0x06, 0x06, 0x09, 0x00, 0xf0, 0x0c, 0x06, 0x02, 0x09,
+    0x00, 0x30, 0x04, 0x00, 0x9c, 0xff, 0x1d, 0x00, 0x02, 0x00, 0x02, 0x00, 0x06, 0x10, 0x00, 0xf0,
+    0x04, 0x00, 0x02, 0x10, 0x00, 0x30, 0x24, 0x01, 0x15, 0x00, 0x40, 0x01, 0x02, 0x00, 0x0f, 0x04,
+    0x06, 0x0c, 0x00, 0xf0, 0x0f, 0x08, 0x06, 0x04, 0x00, 0x30, 0x92, 0x00, 0xd2, 0xff, 0xc5, 0x00,
+    0x02, 0x00, 0x03, 0x04, 0x06, 0x0c, 0x00, 0xf0, 0x03, 0x08, 0x06, 0x04, 0x00, 0x30, 0xab, 0xff,
+    0x62, 0xff, 0x28, 0x00, 0x02, 0x00, 0x0f, 0x0c, 0x09, 0x06, 0x00, 0xf0, 0x0f, 0x0e, 0x09, 0x02,
+    0x00, 0x30, 0xcd, 0x06, 0xf4, 0xff, 0x29, 0xfe, 0x02, 0x00, 0x04, 0x00, 0x0f, 0x16, 0x00, 0xf0,
+    0x04, 0x0b, 0x0f, 0x0b, 0x00, 0x20, 0x2e, 0x00, 0x2d, 0x00, 0xd9, 0xff, 0x02, 0x00, 0x0f, 0x0c,
+    0x09, 0x06, 0x00, 0xf0, 0x0f, 0x0e, 0x09, 0x02, 0x00, 0x30, 0xc2, 0xff, 0x29, 0xff, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x0c, 0x09, 0x06, 0x00, 0xf0, 0x00, 0x0e, 0x09, 0x02, 0x00, 0x30, 0xc2, 0xff,
+    0xd0, 0xff, 0x2b, 0x00, 0x02, 0x00, 0x0f, 0x0f, 0x09, 0x06, 0x00, 0xf0, 0x0f, 0x11, 0x09, 0x02,
+    0x00, 0x30, 0xb3, 0xff, 0x35, 0xff, 0x01, 0x00, 0x02, 0x00, 0x00, 0x0f, 0x09, 0x06, 0x00, 0xf0,
+    0x00, 0x11, 0x09, 0x02, 0x00, 0x30, 0xf3, 0xff, 0xc4, 0xff, 0x3f, 0x00, 0x03, 0x00, 0x0a, 0x00,
+    0x08, 0x0a, 0x00, 0xf0, 0x0e, 0x00, 0x04, 0x05, 0x00, 0x20, 0x0a, 0x05, 0x04, 0x05, 0x00, 0x20,
+    0x7d, 0x01, 0xf2, 0xff, 0x2b, 0xfe, 0x02, 0x00, 0x01, 0x00, 0x04, 0x10, 0x00, 0xf0, 0x03, 0x00,
+    0x02, 0x10, 0x00, 0x20, 0xcd, 0xff, 0x43, 0x00, 0x9e, 0xff, 0x02, 0x00, 0x07, 0x06, 0x0a, 0x06,
+    0x00, 0xf0, 0x07, 0x08, 0x0a, 0x02, 0x00, 0x30, 0x92, 0xff, 0x55, 0xff, 0x05, 0x00, 0x02, 0x00,
+    0x0a, 0x0c, 0x04, 0x0a, 0x00, 0xf0, 0x0a, 0x11, 0x04, 0x05, 0x00, 0x20, 0xa0, 0xff, 0xac, 0x00,
+    0xfd, 0xff, 0x02, 0x00, 0x08, 0x04, 0x0a, 0x06, 0x00, 0xf0, 0x08, 0x06, 0x0a, 0x02, 0x00, 0x30,
+    0xc6, 0xff, 0x4d, 0x00, 0xb8, 0xff, 0x02, 0x00, 0x03, 0x16, 0x12, 0x02, 0x00, 0xf0, 0x0c, 0x16,
+    0x09, 0x02, 0x00, 0x20, 0x73, 0x00, 0x25, 0x00, 0x98, 0xfe, 0x02, 0x00, 0x07, 0x07, 0x0b, 0x06,
+    0x00, 0xf0, 0x07, 0x09, 0x0b, 0x02, 0x00, 0x30, 0xd0, 0x00, 0xd1, 0xff, 0xcc, 0x00, 0x03, 0x00,
+    0x00, 0x00, 0x0c, 0x0a, 0x00, 0xf0, 0x00, 0x00, 0x06, 0x05, 0x00, 0x20, 0x06, 0x05, 0x06, 0x05,
+    0x00, 0x20, 0x2f, 0x00, 0x30, 0x00, 0xeb, 0xff, 0x03, 0x00, 0x0a, 0x01, 0x0c, 0x06, 0x00, 0xf0,
+    0x10, 0x01, 0x06, 0x03, 0x00, 0x20, 0x0a, 0x04, 0x06, 0x03, 0x00, 0x20, 0xc4, 0xff, 0x73, 0x00,
+    0xc8, 0xff, 0x02, 0x00, 0x07, 0x10, 0x09, 0x04, 0x00, 0xf0, 0x07, 0x12, 0x09, 0x02, 0x00, 0x20,
+    0xa7, 0x03, 0x22, 0x00, 0xb6, 0xfe, 0x02, 0x00, 0x05, 0x07, 0x0f, 0x10, 0x00, 0xf0, 0x0a, 0x07,
+    0x05, 0x10, 0x00, 0x30, 0xc6, 0x01, 0xcb, 0xff, 0x8b, 0x00, 0x02, 0x00, 0x05, 0x0a, 0x0c, 0x0d,
+    0x00, 0xf0, 0x0b, 0x0a, 0x06, 0x0d, 0x00, 0x20, 0x0d, 0x00, 0x52, 0x00, 0xd7, 0xff, 0x03, 0x00,
+    0x06, 0x02, 0x0c, 0x06, 0x00, 0xf0, 0x0c, 0x02, 0x06, 0x03, 0x00, 0x20, 0x06, 0x05, 0x06, 0x03,
+    0x00, 0x20, 0x5d, 0x01, 0xcd, 0xff, 0x88, 0x00, 0x02, 0x00, 0x03, 0x09, 0x0c, 0x09, 0x00, 0xf0,
+    0x03, 0x0c, 0x0c, 0x03, 0x00, 0x30, 0x5a, 0x00, 0x28, 0x00, 0xd5, 0xff, 0x02, 0x00, 0x10, 0x02,
+    0x08, 0x06, 0x00, 0xf0, 0x10, 0x05, 0x08, 0x03, 0x00, 0x20, 0xc0, 0xff, 0x60, 0xff, 0x0a, 0x00,
+    0x02, 0x00, 0x00, 0x02, 0x08, 0x06, 0x00, 0xf0, 0x00, 0x05, 0x08, 0x03, 0x00, 0x20, 0x4c, 0x05,
+    0x2a, 0x00, 0xf8, 0xfe, 0x02, 0x00, 0x00, 0x03, 0x18, 0x0b, 0x00, 0xf0, 0x00, 0x03, 0x0c, 0x0b,
+    0x00, 0x20, 0x24, 0x00, 0xc0, 0xff, 0x51, 0x00, 0x03, 0x00, 0x00, 0x0d, 0x08, 0x0a, 0x00, 0xf0,
+    0x00, 0x0d, 0x04, 0x05, 0x00, 0x20, 0x04, 0x12, 0x04, 0x05, 0x00, 0x20, 0xbc, 0x00, 0x27, 0x00,
+    0x5e, 0xfe, 0x02, 0x00, 0x0a, 0x0e, 0x04, 0x0a, 0x00, 0xf0, 0x0a, 0x13, 0x04, 0x05, 0x00, 0x20,
+    0x66, 0xff, 0x91, 0x00, 0xcd, 0xff, 0x02, 0x00, 0x0a, 0x02, 0x04, 0x15, 0x00, 0xf0, 0x0a, 0x09,
+    0x04, 0x07, 0x00, 0x30, 0x68, 0xfc, 0x9f, 0x00, 0xb1, 0xfe, 0x92, 0x00, 0x54, 0xff, 0x02, 0x00,
+    0x04, 0x04, 0x0f, 0x09, 0x00, 0xf0, 0x04, 0x07, 0x0f, 0x03, 0x00, 0x30, 0x7b, 0x03, 0x9e, 0xff,
+    0xe7, 0x00, 0x02, 0x00, 0x00, 0x01, 0x18, 0x06, 0x00, 0xf0, 0x08, 0x01, 0x08, 0x06, 0x00, 0x30,
+    0x3c, 0x00, 0x38, 0x00, 0xb9, 0xfe, 0x02, 0x00, 0x09, 0x06, 0x05, 0x10, 0x00, 0xf0, 0x09, 0x0e,
+    0x05, 0x08, 0x00, 0x20, 0xd6, 0x00, 0xb7, 0xff, 0xc1, 0x00, 0x02, 0x00, 0x03, 0x15, 0x12, 0x03,
+    0x00, 0xf0, 0x09, 0x15, 0x06, 0x03, 0x00, 0x30, 0x25, 0x00, 0x5a, 0xff, 0x39, 0x00, 0x02, 0x00,
+    0x06, 0x05, 0x03, 0x0c, 0x00, 0xf0, 0x06, 0x0b, 0x03, 0x06, 0x00, 0x20, 0x20, 0x00, 0xb6, 0xff,
+    0x4f, 0x00, 0x02, 0x00, 0x0b, 0x06, 0x04, 0x09, 0x00, 0xf0, 0x0b, 0x06, 0x02, 0x09, 0x00, 0x20,
+    0x96, 0xff, 0x74, 0x00, 0x9e, 0xff, 0x02, 0x00, 0x05, 0x06, 0x09, 0x08, 0x00, 0xf0, 0x08, 0x06,
+    0x03, 0x08, 0x00, 0x30, 0xf4, 0xff, 0x7d, 0xff, 0x46, 0x00, 0x02, 0x00, 0x04, 0x03, 0x14, 0x02,
+    0x00, 0xf0, 0x04, 0x04, 0x14, 0x01, 0x00, 0x20, 0xea, 0x00, 0x04, 0x00, 0xca, 0xfe, 0x02, 0x00,
+    0x02, 0x0a, 0x12, 0x03, 0x00, 0xf0, 0x08, 0x0a, 0x06, 0x03, 0x00, 0x30, 0xe7, 0xff, 0x64, 0x00,
+    0xb1, 0xff, 0x02, 0x00, 0x07, 0x0f, 0x0a, 0x06, 0x00, 0xf0, 0x07, 0x11, 0x0a, 0x02, 0x00, 0x30,
+    0x5b, 0xff, 0x30, 0x01, 0xcc, 0xff, 0x03, 0x00, 0x01, 0x04, 0x04, 0x12, 0x00, 0xf0, 0x01, 0x04,
+    0x02, 0x09, 0x00, 0x20, 0x03, 0x0d, 0x02, 0x09, 0x00, 0x20, 0xad, 0xff, 0x52, 0xff, 0x34, 0x00,
+    0x02, 0x00, 0x0d, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x0f, 0x00, 0x02, 0x09, 0x00, 0x30, 0xba, 0xff,
+    0x27, 0xff, 0x09, 0x00, 0x02, 0x00, 0x05, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x07, 0x00, 0x02, 0x09,
+    0x00, 0x30, 0x9d, 0xff, 0xe6, 0xfe, 0x28, 0x00, 0x02, 0x00, 0x0b, 0x00, 0x06, 0x09, 0x00, 0xf0,
+    0x0d, 0x00, 0x02, 0x09, 0x00, 0x30, 0xe8, 0x00, 0xce, 0xff, 0x2e, 0x01, 0x02, 0x00, 0x06, 0x07,
+    0x09, 0x06, 0x00, 0xf0, 0x09, 0x07, 0x03, 0x06, 0x00, 0x30, 0x01, 0x00, 0x98, 0xff, 0x54, 0x00,
+    0x02, 0x00, 0x03, 0x00, 0x12, 0x02, 0x00, 0xf0, 0x03, 0x01, 0x12, 0x01, 0x00, 0x20, 0x28, 0x00,
+    0xb5, 0xff, 0x6a, 0x00, 0x03, 0x00, 0x00, 0x0a, 0x14, 0x04, 0x00, 0xf0, 0x00, 0x0a, 0x0a, 0x02,
+    0x00, 0x20, 0x0a, 0x0c, 0x0a, 0x02, 0x00, 0x20, 0x29, 0xff, 0xb2, 0xfe, 0x2d, 0x00, 0x02, 0x00,
+    0x0a, 0x02, 0x04, 0x0c, 0x00, 0xf0, 0x0a, 0x08, 0x04, 0x06, 0x00, 0x20, 0xc8, 0xff, 0x3c, 0x00,
+    0x8e, 0xff, 0x03, 0x00, 0x06, 0x05, 0x06, 0x0c, 0x00, 0xf0, 0x06, 0x05, 0x03, 0x06, 0x00, 0x20,
+    0x09, 0x0b, 0x03, 0x06, 0x00, 0x20, 0x84, 0xff, 0x4a, 0x00, 0xe4, 0xff, 0x03, 0x00, 0x06, 0x00,
+    0x12, 0x16, 0x00, 0xf0, 0x0f, 0x00, 0x09, 0x0b, 0x00, 0x20, 0x06, 0x0b, 0x09, 0x0b, 0x00, 0x20,
+    0x32, 0xfb, 0x94, 0xfd, 0xf6, 0xff, 0x03, 0x00, 0x00, 0x00, 0x12, 0x16, 0x00, 0xf0, 0x00, 0x00,
+    0x09, 0x0b, 0x00, 0x20, 0x09, 0x0b, 0x09, 0x0b, 0x00, 0x20, 0x6d, 0xff, 0xe1, 0x00, 0xf4, 0xff,
+    0x02, 0x00, 0x12, 0x02, 0x06, 0x0b, 0x00, 0xf0, 0x14, 0x02, 0x02, 0x0b, 0x00, 0x30, 0x1f, 0xff,
+    0xcd, 0x00, 0xcc, 0xff, 0x02, 0x00, 0x00, 0x02, 0x06, 0x0b, 0x00, 0xf0, 0x02, 0x02, 0x02, 0x0b,
+    0x00, 0x30, 0x8a, 0x00, 0x25, 0x00, 0xde, 0xfe, 0x02, 0x00, 0x0b, 0x00, 0x06, 0x09, 0x00, 0xf0,
+    0x0d, 0x00, 0x02, 0x09, 0x00, 0x30, 0xdf, 0xff, 0x30, 0xff, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x14, 0x03, 0x00, 0xf0, 0x00, 0x01, 0x14, 0x01, 0x00, 0x30, 0xea, 0xff, 0x4b, 0xff, 0x39, 0x00,
+    0x02, 0x00, 0x02, 0x02, 0x14, 0x02, 0x00, 0xf0, 0x02, 0x03, 0x14, 0x01, 0x00, 0x20, 0x0c, 0x00,
+    0x46, 0xff, 0x0a, 0x00, 0x02, 0x00, 0x01, 0x0a, 0x12, 0x02, 0x00, 0xf0, 0x01, 0x0b, 0x12, 0x01,
+    0x00, 0x20, 0xdb, 0x00, 0x2b, 0x00, 0xe3, 0xfe, 0x02, 0x00, 0x12, 0x07, 0x06, 0x09, 0x00, 0xf0,
+    0x12, 0x0a, 0x06, 0x03, 0x00, 0x30, 0xff, 0xfd, 0xc4, 0x02, 0xdb, 0xff, 0x02, 0x00, 0x00, 0x00,
+    0x16, 0x09, 0x00, 0xf0, 0x00, 0x03, 0x16, 0x03, 0x00, 0x30, 0x7b, 0x01, 0x1d, 0x00, 0x0a, 0xfc,
+    0x02, 0x00, 0x11, 0x03, 0x06, 0x09, 0x00, 0xf0, 0x11, 0x06, 0x06, 0x03, 0x00, 0x30, 0x9d, 0x00,
+    0xff, 0xff, 0x04, 0xff, 0x02, 0x00, 0x00, 0x07, 0x06, 0x09, 0x00, 0xf0, 0x00, 0x0a, 0x06, 0x03,
+    0x00, 0x30, 0xf8, 0xff, 0x3b, 0x00, 0x41, 0xff, 0x02, 0x00, 0x00, 0x06, 0x18, 0x06, 0x00, 0xf0,
+    0x00, 0x08, 0x18, 0x02, 0x00, 0x30, 0x27, 0x00, 0xb1, 0xff, 0x4d, 0x00, 0x02, 0x00, 0x00, 0x02,
+    0x06, 0x0a, 0x00, 0xf0, 0x02, 0x02, 0x02, 0x0a, 0x00, 0x30, 0x62, 0x00, 0xf4, 0xff, 0x86, 0x00,
+    0x02, 0x00, 0x0a, 0x06, 0x06, 0x09, 0x00, 0xf0, 0x0c, 0x06, 0x02, 0x09, 0x00, 0x30, 0xb7, 0xff,
+    0xd7, 0xfe, 0xff, 0xff, 0x02, 0x00, 0x07, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x09, 0x00, 0x02, 0x09,
+    0x00, 0x30, 0xd5, 0xff, 0xbb, 0xff, 0x3c, 0x00, 0x02, 0x00, 0x0f, 0x00, 0x06, 0x09, 0x00, 0xf0,
+    0x11, 0x00, 0x02, 0x09, 0x00, 0x30, 0xe3, 0xff, 0x76, 0xff, 0x14, 0x00, 0x02, 0x00, 0x03, 0x00,
+    0x06, 0x09, 0x00, 0xf0, 0x05, 0x00, 0x02, 0x09, 0x00, 0x30, 0x62, 0x00, 0x2e, 0x00, 0x55, 0xff,
+    0x02, 0x00, 0x0f, 0x11, 0x09, 0x06, 0x00, 0xf0, 0x0f, 0x13, 0x09, 0x02, 0x00, 0x30, 0xb5, 0xff,
+    0xa0, 0x00, 0xcb, 0xff, 0x02, 0x00, 0x00, 0x11, 0x12, 0x03, 0x00, 0xf0, 0x00, 0x12, 0x12, 0x01,
+    0x00, 0x30, 0x40, 0x00, 0x3d, 0x00, 0xf5, 0xfe, 0x02, 0x00, 0x0f, 0x0e, 0x09, 0x06, 0x00, 0xf0,
+    0x0f, 0x10, 0x09, 0x02, 0x00, 0x30, 0x39, 0xff, 0x10, 0xff, 0x00, 0x00, 0x02, 0x00, 0x00, 0x0f,
+    0x17, 0x06, 0x00, 0xf0, 0x00, 0x11, 0x17, 0x02, 0x00, 0x30, 0x1b, 0x00, 0xed, 0xff, 0x9d, 0x00,
+    0x02, 0x00, 0x05, 0x0f, 0x12, 0x03, 0x00, 0xf0, 0x05, 0x10, 0x12, 0x01, 0x00, 0x30, 0x28, 0x00,
+    0x0a, 0x00, 0x27, 0xff, 0x02, 0x00, 0x00, 0x0e, 0x09, 0x06, 0x00, 0xf0, 0x00, 0x10, 0x09, 0x02,
+    0x00, 0x30, 0x3c, 0x00, 0x2b, 0x00, 0x7e, 0xff, 0x03, 0x00, 0x09, 0x08, 0x08, 0x0a, 0x00, 0xf0,
+    0x0d, 0x08, 0x04, 0x05, 0x00, 0x20, 0x09, 0x0d, 0x04, 0x05, 0x00, 0x20, 0x8d, 0x01, 0xf8, 0xff,
+    0xbb, 0xfe, 0x02, 0x00, 0x03, 0x07, 0x0f, 0x06, 0x00, 0xf0, 0x08, 0x07, 0x05, 0x06, 0x00, 0x30,
+    0xc5, 0x00, 0x18, 0x00, 0xb8, 0x02, 0x03, 0x00, 0x09, 0x08, 0x08, 0x0a, 0x00, 0xf0, 0x0d, 0x08,
+    0x04, 0x05, 0x00, 0x20, 0x09, 0x0d, 0x04, 0x05, 0x00, 0x20, 0x28, 0x00, 0x9b, 0xff, 0x27, 0x00,
+    0x02, 0x00, 0x05, 0x00, 0x06, 0x0c, 0x00, 0xf0, 0x08, 0x00, 0x03, 0x0c, 0x00, 0x20, 0x5d, 0xff,
+    0xc6, 0xff, 0x23, 0x00, 0x03, 0x00, 0x09, 0x08, 0x08, 0x0a, 0x00, 0xf0, 0x0d, 0x08, 0x04, 0x05,
+    0x00, 0x20, 0x09, 0x0d, 0x04, 0x05, 0x00, 0x20, 0x5d, 0x00, 0xba, 0xff, 0x57, 0x00, 0x02, 0x00,
+    0x08, 0x05, 0x06, 0x09, 0x00, 0xf0, 0x0a, 0x05, 0x02, 0x09, 0x00, 0x30, 0x1b, 0x00, 0xe5, 0xff,
+    0x7b, 0x00, 0x03, 0x00, 0x0a, 0x06, 0x04, 0x12, 0x00, 0xf0, 0x0c, 0x06, 0x02, 0x09, 0x00, 0x20,
+    0x0a, 0x0f, 0x02, 0x09, 0x00, 0x20, 0xf4, 0x00, 0xf4, 0xff, 0xfe, 0xfd, 0x02, 0x00, 0x05, 0x07,
+    0x0c, 0x04, 0x00, 0xf0, 0x0b, 0x07, 0x06, 0x04, 0x00, 0x20, 0x1c, 0x00, 0x26, 0x00, 0xe4, 0xff,
+    0x03, 0x00, 0x09, 0x08, 0x08, 0x0a, 0x00, 0xf0, 0x0d, 0x08, 0x04, 0x05, 0x00, 0x20, 0x09, 0x0d,
+    0x04, 0x05, 0x00, 0x20, 0x40, 0x00, 0xfb, 0xff, 0xd6, 0xfe, 0x03, 0x00, 0x07, 0x08, 0x08, 0x0a,
+    0x00, 0xf0, 0x07, 0x08, 0x04, 0x05, 0x00, 0x20, 0x0b, 0x0d, 0x04, 0x05, 0x00, 0x20, 0x35, 0xff,
+    0x33, 0xff, 0x24, 0x00, 0x03, 0x00, 0x0b, 0x0a, 0x06, 0x0e, 0x00, 0xf0, 0x0e, 0x0a, 0x03, 0x07,
+    0x00, 0x20, 0x0b, 0x11, 0x03, 0x07, 0x00, 0x20, 0xd6, 0x00, 0xcb, 0xff, 0x9d, 0x00, 0x02, 0x00,
+    0x09, 0x05, 0x06, 0x13, 0x00, 0xf0, 0x0c, 0x05, 0x03, 0x13, 0x00, 0x20, 0x5b, 0x00, 0x33, 0x00,
+    0x40, 0xff, 0x03, 0x00, 0x06, 0x0c, 0x0c, 0x06, 0x00, 0xf0, 0x0c, 0x0c, 0x06, 0x03, 0x00, 0x20,
+    0x06, 0x0f, 0x06, 0x03, 0x00, 0x20, 0xa8, 0x00, 0xd2, 0xff, 0x00, 0x01, 0x03, 0x00, 0x01, 0x09,
+    0x12, 0x06, 0x00, 0xf0, 0x01, 0x09, 0x09, 0x03, 0x00, 0x20, 0x0a, 0x0c, 0x09, 0x03, 0x00, 0x20,
+    0xa8, 0xff, 0x7f, 0x00, 0xf8, 0xff, 0x03, 0x00, 0x10, 0x0e, 0x08, 0x0a, 0x00, 0xf0, 0x14, 0x0e,
+    0x04, 0x05, 0x00, 0x20, 0x10, 0x13, 0x04, 0x05, 0x00, 0x20, 0xad, 0xfe, 0x2b, 0x01, 0xd1, 0xff,
+    0x03, 0x00, 0x00, 0x09, 0x16, 0x08, 0x00, 0xf0, 0x00, 0x09, 0x0b, 0x04, 0x00, 0x20, 0x0b, 0x0d,
+    0x0b, 0x04, 0x00, 0x20, 0x22, 0x00, 0xf0, 0xff, 0x4a, 0x00, 0x03, 0x00, 0x08, 0x12, 0x0c, 0x06,
+    0x00, 0xf0, 0x0e, 0x12, 0x06, 0x03, 0x00, 0x20, 0x08, 0x15, 0x06, 0x03, 0x00, 0x20, 0x43, 0x01,
+    0xc5, 0xff, 0x98, 0x00, 0x03, 0x00, 0x00, 0x06, 0x14, 0x12, 0x00, 0xf0, 0x00, 0x06, 0x0a, 0x09,
+    0x00, 0x20, 0x0a, 0x0f, 0x0a, 0x09, 0x00, 0x20, 0x8f, 0xfe, 0x2e, 0xff, 0x2d, 0x00, 0x03, 0x00,
+    0x03, 0x06, 0x14, 0x0c, 0x00, 0xf0, 0x0d, 0x06, 0x0a, 0x06, 0x00, 0x20, 0x03, 0x0c, 0x0a, 0x06,
+    0x00, 0x20, 0x89, 0xff, 0x9b, 0x00, 0xca, 0xff, 0x03, 0x00, 0x00, 0x10, 0x0a, 0x08, 0x00, 0xf0,
+    0x00, 0x10, 0x05, 0x04, 0x00, 0x20, 0x05, 0x14, 0x05, 0x04, 0x00, 0x20, 0x1c, 0x00, 0xf6, 0xff,
+    0x9a, 0x00, 0x02, 0x00, 0x06, 0x10, 0x12, 0x03, 0x00, 0xf0, 0x06, 0x11, 0x12, 0x01, 0x00, 0x30,
+    0xdf, 0xff, 0xda, 0xfe, 0xfa, 0xff, 0x02, 0x00, 0x00, 0x0b, 0x13, 0x03, 0x00, 0xf0, 0x00, 0x0c,
+    0x13, 0x01, 0x00, 0x30, 0x50, 0x00, 0xfe, 0xff, 0x91, 0x00, 0x02, 0x00, 0x0e, 0x06, 0x06, 0x09,
+    0x00, 0xf0, 0x0e, 0x09, 0x06, 0x03, 0x00, 0x30, 0xc4, 0xff, 0x60, 0x00, 0xbb, 0xff, 0x03, 0x00,
+    0x01, 0x07, 0x16, 0x04, 0x00, 0xf0, 0x01, 0x07, 0x0b, 0x02, 0x00, 0x20, 0x0c, 0x09, 0x0b, 0x02,
+    0x00, 0x20, 0x67, 0x00, 0xe7, 0xff, 0x3f, 0x00, 0x02, 0x00, 0x0d, 0x06, 0x07, 0x0c, 0x00, 0xf0,
+    0x0d, 0x0a, 0x07, 0x04, 0x00, 0x30, 0xc0, 0xff, 0xab, 0x00, 0xcc, 0xff, 0x02, 0x00, 0x04, 0x07,
+    0x0b, 0x09, 0x00, 0xf0, 0x04, 0x0a, 0x0b, 0x03, 0x00, 0x30, 0x78, 0x00, 0x28, 0x00, 0x3e, 0xff,
+    0x03, 0x00, 0x0c, 0x0a, 0x0a, 0x08, 0x00, 0xf0, 0x11, 0x0a, 0x05, 0x04, 0x00, 0x20, 0x0c, 0x0e,
+    0x05, 0x04, 0x00, 0x20, 0xde, 0xff, 0x61, 0x00, 0xbf, 0xff, 0x02, 0x00, 0x02, 0x0c, 0x09, 0x07,
+    0x00, 0xf0, 0x05, 0x0c, 0x03, 0x07, 0x00, 0x30, 0x64, 0x00, 0x26, 0x00, 0xb7, 0xff, 0x02, 0x00,
+    0x10, 0x0e, 0x06, 0x09, 0x00, 0xf0, 0x10, 0x11, 0x06, 0x03, 0x00, 0x30, 0x76, 0xff, 0x52, 0xff,
+    0x08, 0x00, 0x02, 0x00, 0x03, 0x0c, 0x06, 0x0c, 0x00, 0xf0, 0x03, 0x10, 0x06, 0x04, 0x00, 0x30,
+    0xf8, 0xff, 0x41, 0x00, 0xbc, 0xff, 0x02, 0x00, 0x0e, 0x0d, 0x06, 0x06, 0x00, 0xf0, 0x0e, 0x10,
+    0x06, 0x03, 0x00, 0x20, 0x7c, 0x00, 0xf9, 0xff, 0xdb, 0xfe, 0x02, 0x00, 0x08, 0x00, 0x06, 0x09,
+    0x00, 0xf0, 0x0a, 0x00, 0x02, 0x09, 0x00, 0x30, 0x10, 0x00, 0xa6, 0xff, 0x4c, 0x00, 0x02, 0x00,
+    0x09, 0x01, 0x06, 0x17, 0x00, 0xf0, 0x0b, 0x01, 0x02, 0x17, 0x00, 0x30, 0x71, 0x00, 0xf7, 0xff,
+    0xad, 0xfe, 0x02, 0x00, 0x00, 0x10, 0x09, 0x06, 0x00, 0xf0, 0x00, 0x12, 0x09, 0x02, 0x00, 0x30,
+    0x20, 0x00, 0xfa, 0xff, 0xb4, 0x00, 0x02, 0x00, 0x04, 0x11, 0x12, 0x03, 0x00, 0xf0, 0x04, 0x12,
+    0x12, 0x01, 0x00, 0x30, 0xb4, 0x00, 0x1b, 0x00, 0x8d, 0xff, 0x02, 0x00, 0x05, 0x02, 0x0d, 0x0e,
+    0x00, 0xf0, 0x05, 0x09, 0x0d, 0x07, 0x00, 0x20, 0x7c, 0xff, 0x77, 0x00, 0xf1, 0xff, 0x03, 0x00,
+    0x0f, 0x00, 0x08, 0x0c, 0x00, 0xf0, 0x13, 0x00, 0x04, 0x06, 0x00, 0x20, 0x0f, 0x06, 0x04, 0x06,
+    0x00, 0x20, 0x55, 0x00, 0xb8, 0xff, 0x70, 0x00, 0x03, 0x00, 0x00, 0x00, 0x08, 0x0c, 0x00, 0xf0,
+    0x00, 0x00, 0x04, 0x06, 0x00, 0x20, 0x04, 0x06, 0x04, 0x06, 0x00, 0x20, 0x67, 0x00, 0xfb, 0xff,
+    0xb4, 0x00, 0x02, 0x00, 0x08, 0x02, 0x08, 0x07, 0x00, 0xf0, 0x08, 0x02, 0x04, 0x07, 0x00, 0x20,
+    0x1a, 0x00, 0xad, 0xff, 0x3d, 0x00, 0x02, 0x00, 0x01, 0x01, 0x06, 0x09, 0x00, 0xf0, 0x03, 0x01,
+    0x02, 0x09, 0x00, 0x30, 0x11, 0xff, 0xc7, 0xfe, 0x1d, 0x00, 0x03, 0x00, 0x0e, 0x08, 0x06, 0x0c,
+    0x00, 0xf0, 0x11, 0x08, 0x03, 0x06, 0x00, 0x20, 0x0e, 0x0e, 0x03, 0x06, 0x00, 0x20, 0x82, 0x00,
+    0xfc, 0xff, 0xe8, 0xfe, 0x03, 0x00, 0x04, 0x08, 0x06, 0x0c, 0x00, 0xf0, 0x04, 0x08, 0x03, 0x06,
+    0x00, 0x20, 0x07, 0x0e, 0x03, 0x06, 0x00, 0x20, 0x84, 0xff, 0xa7, 0x00, 0x13, 0x00, 0x02, 0x00,
+    0x10, 0x05, 0x05, 0x0f, 0x00, 0xf0, 0x10, 0x0a, 0x05, 0x05, 0x00, 0x30, 0x3d, 0x00, 0x7b, 0xff,
+    0x1d, 0x00, 0x02, 0x00, 0x03, 0x05, 0x05, 0x0f, 0x00, 0xf0, 0x03, 0x0a, 0x05, 0x05, 0x00, 0x30,
+    0x38, 0xff, 0x38, 0xff, 0x2a, 0x00, 0x02, 0x00, 0x12, 0x04, 0x06, 0x09, 0x00, 0xf0, 0x12, 0x07,
+    0x06, 0x03, 0x00, 0x30, 0x54, 0x01, 0x00, 0x00, 0x26, 0xff, 0x02, 0x00, 0x01, 0x07, 0x06, 0x0f,
+    0x00, 0xf0, 0x01, 0x0c, 0x06, 0x05, 0x00, 0x30, 0x61, 0x00, 0xf3, 0xff, 0x6b, 0x00, 0x03, 0x00,
+    0x0b, 0x0f, 0x0c, 0x08, 0x00, 0xf0, 0x11, 0x0f, 0x06, 0x04, 0x00, 0x20, 0x0b, 0x13, 0x06, 0x04,
+    0x00, 0x20, 0x43, 0x00, 0x04, 0x00, 0x5a, 0xff, 0x03, 0x00, 0x00, 0x02, 0x18, 0x04, 0x00, 0xf0,
+    0x00, 0x02, 0x0c, 0x02, 0x00, 0x20, 0x0c, 0x04, 0x0c, 0x02, 0x00, 0x20, 0xd0, 0xff, 0x61, 0xff,
+    0x27, 0x00, 0x02, 0x00, 0x0f, 0x01, 0x02, 0x13, 0x00, 0xf0, 0x0f, 0x01, 0x01, 0x13, 0x00, 0x20,
+    0x00, 0x00, 0x2d, 0x00, 0xa9, 0xff, 0x02, 0x00, 0x07, 0x01, 0x02, 0x13, 0x00, 0xf0, 0x08, 0x01,
+    0x01, 0x13, 0x00, 0x20, 0x4e, 0x00, 0x0b, 0x00, 0xca, 0x00, 0x02, 0x00, 0x16, 0x01, 0x02, 0x14,
+    0x00, 0xf0, 0x16, 0x01, 0x01, 0x14, 0x00, 0x20, 0xd7, 0xff, 0x74, 0x00, 0xc7, 0xff, 0x02, 0x00,
+    0x00, 0x01, 0x02, 0x14, 0x00, 0xf0, 0x01, 0x01, 0x01, 0x14, 0x00, 0x20, 0xc7, 0xff, 0x55, 0x00,
+    0xff, 0xff, 0x02, 0x00, 0x12, 0x0b, 0x06, 0x0c, 0x00, 0xf0, 0x14, 0x0b, 0x02, 0x0c, 0x00, 0x30,
+    0x5a, 0xfe, 0xaa, 0xfd, 0xf1, 0xff, 0x02, 0x00, 0x00, 0x0b, 0x06, 0x0c, 0x00, 0xf0, 0x02, 0x0b,
+    0x02, 0x0c, 0x00, 0x30, 0x79, 0xfe, 0x57, 0xff, 0x33, 0x00, 0x02, 0x00, 0x03, 0x06, 0x12, 0x0e,
+    0x00, 0xf0, 0x03, 0x0d, 0x12, 0x07, 0x00, 0x20, 0x57, 0xff, 0x75, 0x00, 0xc7, 0xff, 0x02, 0x00,
+    0x06, 0x0a, 0x07, 0x08, 0x00, 0xf0, 0x06, 0x0e, 0x07, 0x04, 0x00, 0x20, 0x09, 0x00, 0xbc, 0xff,
+    0x3f, 0x00, 0x02, 0x00, 0x07, 0x09, 0x0c, 0x0c, 0x00, 0xf0, 0x07, 0x0d, 0x0c, 0x04, 0x00, 0x30,
+    0xb7, 0x01, 0xd1, 0xff, 0xba, 0x00, 0x02, 0x00, 0x02, 0x12, 0x12, 0x05, 0x00, 0xf0, 0x0b, 0x12,
+    0x09, 0x05, 0x00, 0x20, 0x0d, 0x00, 0xfa, 0xff, 0x49, 0x00, 0x02, 0x00, 0x04, 0x15, 0x14, 0x03,
+    0x00, 0xf0, 0x04, 0x16, 0x14, 0x01, 0x00, 0x30, 0x77, 0x00, 0xf8, 0xff, 0xe3, 0xfe, 0x03, 0x00,
+    0x09, 0x0c, 0x06, 0x0c, 0x00, 0xf0, 0x09, 0x0c, 0x03, 0x06, 0x00, 0x20, 0x0c, 0x12, 0x03, 0x06,
+    0x00, 0x20, 0x2e, 0x00, 0x01, 0x00, 0xaa, 0x00, 0x02, 0x00, 0x04, 0x06, 0x12, 0x03, 0x00, 0xf0,
+    0x04, 0x07, 0x12, 0x01, 0x00, 0x30, 0xcf, 0xff, 0x6c, 0x00, 0xbd, 0xff, 0x02, 0x00, 0x03, 0x06,
+    0x12, 0x03, 0x00, 0xf0, 0x03, 0x07, 0x12, 0x01, 0x00, 0x30, 0xcc, 0xff, 0xfb, 0xff, 0x30, 0x00,
+    0x02, 0x00, 0x12, 0x04, 0x06, 0x09, 0x00, 0xf0, 0x12, 0x07, 0x06, 0x03, 0x00, 0x30, 0x64, 0x00,
+    0xf8, 0xff, 0xe7, 0xfe, 0x02, 0x00, 0x02, 0x0c, 0x09, 0x06, 0x00, 0xf0, 0x02, 0x0e, 0x09, 0x02,
+    0x00, 0x30, 0xbc, 0x00, 0x1c, 0x00, 0x12, 0xfd, 0x03, 0x00, 0x04, 0x0e, 0x12, 0x04, 0x00, 0xf0,
+    0x0d, 0x0e, 0x09, 0x02, 0x00, 0x20, 0x04, 0x10, 0x09, 0x02, 0x00, 0x20, 0x91, 0xff, 0x4a, 0x00,
+    0xba, 0xff, 0x03, 0x00, 0x07, 0x07, 0x06, 0x0e, 0x00, 0xf0, 0x07, 0x07, 0x03, 0x07, 0x00, 0x20,
+    0x0a, 0x0e, 0x03, 0x07, 0x00, 0x20, 0xa4, 0x00, 0x1e, 0x00, 0x60, 0xff, 0x03, 0x00, 0x07, 0x0d,
+    0x0c, 0x06, 0x00, 0xf0, 0x0d, 0x0d, 0x06, 0x03, 0x00, 0x20, 0x07, 0x10, 0x06, 0x03, 0x00, 0x20,
+    0x5e, 0x00, 0x25, 0x00, 0xa2, 0xff, 0x02, 0x00, 0x06, 0x07, 0x0c, 0x09, 0x00, 0xf0, 0x0a, 0x07,
+    0x04, 0x09, 0x00, 0x30, 0x9f, 0xff, 0x77, 0xff, 0x31, 0x00, 0x02, 0x00, 0x0c, 0x0c, 0x06, 0x06,
+    0x00, 0xf0, 0x0c, 0x0c, 0x03, 0x06, 0x00, 0x20, 0x3d, 0x01, 0xf1, 0xff, 0x0e, 0xfe, 0x02, 0x00,
+    0x00, 0x02, 0x04, 0x0a, 0x00, 0xf0, 0x00, 0x07, 0x04, 0x05, 0x00, 0x20, 0xca, 0xff, 0x8d, 0xff,
+    0x2f, 0x00, 0x02, 0x00, 0x08, 0x00, 0x09, 0x06, 0x00, 0xf0, 0x0b, 0x00, 0x03, 0x06, 0x00, 0x30,
+    0xa8, 0xff, 0x36, 0x01, 0xd9, 0xff, 0x02, 0x00, 0x02, 0x09, 0x0c, 0x06, 0x00, 0xf0, 0x02, 0x0c,
+    0x0c, 0x03, 0x00, 0x20, 0xdc, 0xfe, 0xb2, 0xfd, 0x1c, 0x00, 0x02, 0x00, 0x0d, 0x0a, 0x06, 0x09,
+    0x00, 0xf0, 0x0d, 0x0d, 0x06, 0x03, 0x00, 0x30, 0xea, 0xff, 0x49, 0xff, 0x05, 0x00, 0x02, 0x00,
+    0x05, 0x0a, 0x06, 0x09, 0x00, 0xf0, 0x05, 0x0d, 0x06, 0x03, 0x00, 0x30, 0x6d, 0x00, 0x12, 0x00,
+    0xfc, 0x00, 0x02, 0x00, 0x09, 0x0f, 0x09, 0x06, 0x00, 0xf0, 0x09, 0x11, 0x09, 0x02, 0x00, 0x30,
+    0x5f, 0xff, 0xc7, 0xfe, 0xf5, 0xff, 0x02, 0x00, 0x05, 0x10, 0x0c, 0x06, 0x00, 0xf0, 0x05, 0x13,
+    0x0c, 0x03, 0x00, 0x20, 0x6a, 0x00, 0x22, 0x00, 0xd3, 0xfe, 0x02, 0x00, 0x03, 0x02, 0x14, 0x03,
+    0x00, 0xf0, 0x03, 0x03, 0x14, 0x01, 0x00, 0x30, 0xc8, 0x00, 0xf9, 0xff, 0x11, 0xff, 0x02, 0x00,
+    0x02, 0x05, 0x0c, 0x06, 0x00, 0xf0, 0x06, 0x05, 0x04, 0x06, 0x00, 0x30, 0x97, 0x00, 0x22, 0x00,
+    0x81, 0xfe, 0x02, 0x00, 0x0b, 0x00, 0x03, 0x18, 0x00, 0xf0, 0x0c, 0x00, 0x01, 0x18, 0x00, 0x30,
+    0x43, 0x01, 0xdb, 0xff, 0x90, 0x01, 0x02, 0x00, 0x03, 0x10, 0x0f, 0x04, 0x00, 0xf0, 0x08, 0x10,
+    0x05, 0x04, 0x00, 0x30, 0x76, 0x00, 0x31, 0x00, 0x53, 0xff, 0x02, 0x00, 0x09, 0x0c, 0x06, 0x0c,
+    0x00, 0xf0, 0x09, 0x12, 0x06, 0x06, 0x00, 0x20, 0x19, 0x00, 0xa1, 0xff, 0x1b, 0x00, 0x03, 0x00,
+    0x01, 0x0f, 0x0c, 0x08, 0x00, 0xf0, 0x01, 0x0f, 0x06, 0x04, 0x00, 0x20, 0x07, 0x13, 0x06, 0x04,
+    0x00, 0x20, 0xf3, 0xfe, 0xcf, 0x00, 0x07, 0x00, 0x03, 0x00, 0x0f, 0x0a, 0x08, 0x0e, 0x00, 0xf0,
+    0x13, 0x0a, 0x04, 0x07, 0x00, 0x20, 0x0f, 0x11, 0x04, 0x07, 0x00, 0x20, 0xe6, 0xfe, 0xd6, 0x00,
+    0xd5, 0xff, 0x03, 0x00, 0x01, 0x09, 0x08, 0x0e, 0x00, 0xf0, 0x01, 0x09, 0x04, 0x07, 0x00, 0x20,
+    0x05, 0x10, 0x04, 0x07, 0x00, 0x20, 0x23, 0xfe, 0x0e, 0xff, 0x21, 0x00, 0x02, 0x00, 0x09, 0x0b,
+    0x09, 0x0a, 0x00, 0xf0, 0x09, 0x10, 0x09, 0x05, 0x00, 0x20, 0xfb, 0xff, 0x0b, 0x00, 0x7b, 0xff,
+    0x02, 0x00, 0x06, 0x07, 0x0c, 0x06, 0x00, 0xf0, 0x06, 0x09, 0x0c, 0x02, 0x00, 0x30, 0x4a, 0xff,
+    0x0f, 0xfe, 0x21, 0x00, 0x02, 0x00, 0x0a, 0x0f, 0x06, 0x09, 0x00, 0xf0, 0x0c, 0x0f, 0x02, 0x09,
+    0x00, 0x30, 0xd1, 0x00, 0xca, 0xff, 0x7c, 0x00, 0x02, 0x00, 0x07, 0x08, 0x09, 0x07, 0x00, 0xf0,
+    0x0a, 0x08, 0x03, 0x07, 0x00, 0x30, 0x7f, 0xff, 0x99, 0x00, 0x02, 0x00, 0x03, 0x00, 0x0a, 0x04,
+    0x08, 0x0a, 0x00, 0xf0, 0x0e, 0x04, 0x04, 0x05, 0x00, 0x20, 0x0a, 0x09, 0x04, 0x05, 0x00, 0x20,
+    0x56, 0x00, 0xc8, 0xff, 0x8a, 0x00, 0x02, 0x00, 0x04, 0x06, 0x06, 0x09, 0x00, 0xf0, 0x04, 0x09,
+    0x06, 0x03, 0x00, 0x30, 0xca, 0xfd, 0xa1, 0x00, 0xfb, 0xff, 0x02, 0x00, 0x00, 0x06, 0x18, 0x0c,
+    0x00, 0xf0, 0x08, 0x06, 0x08, 0x0c, 0x00, 0x30, 0xd5, 0x00, 0xc5, 0xff, 0x7f, 0x00, 0x02, 0x00,
+    0x03, 0x07, 0x06, 0x0e, 0x00, 0xf0, 0x06, 0x07, 0x03, 0x0e, 0x00, 0x20, 0x6a, 0x00, 0x2e, 0x00,
+    0xc8, 0xff, 0x02, 0x00, 0x13, 0x08, 0x05, 0x08, 0x00, 0xf0, 0x13, 0x0c, 0x05, 0x04, 0x00, 0x20,
+    0xcf, 0xff, 0x4e, 0xff, 0x04, 0x00, 0x02, 0x00, 0x00, 0x08, 0x05, 0x08, 0x00, 0xf0, 0x00, 0x0c,
+    0x05, 0x04, 0x00, 0x20, 0x9d, 0xff, 0x58, 0x00, 0x12, 0x00, 0x02, 0x00, 0x11, 0x03, 0x06, 0x06,
+    0x00, 0xf0, 0x11, 0x06, 0x06, 0x03, 0x00, 0x20, 0x99, 0xff, 0x20, 0xff, 0xfe, 0xff, 0x02, 0x00,
+    0x01, 0x03, 0x06, 0x06, 0x00, 0xf0, 0x01, 0x06, 0x06, 0x03, 0x00, 0x20, 0x33, 0x00, 0x3c, 0x00,
+    0xb7, 0xff, 0x02, 0x00, 0x12, 0x02, 0x06, 0x09, 0x00, 0xf0, 0x12, 0x05, 0x06, 0x03, 0x00, 0x30,
+    0xea, 0x00, 0xf1, 0xff, 0xc5, 0xfd, 0x02, 0x00, 0x00, 0x02, 0x06, 0x09, 0x00, 0xf0, 0x00, 0x05,
+    0x06, 0x03, 0x00, 0x30, 0x44, 0x00, 0xce, 0xff, 0x68, 0x00, 0x02, 0x00, 0x03, 0x03, 0x12, 0x06,
+    0x00, 0xf0, 0x03, 0x05, 0x12, 0x02, 0x00, 0x30, 0xa3, 0xff, 0xf7, 0x00, 0xcd, 0xff, 0x02, 0x00,
+    0x02, 0x03, 0x09, 0x06, 0x00, 0xf0, 0x02, 0x05, 0x09, 0x02, 0x00, 0x30, 0x00, 0x00, 0xf1, 0xff,
+    0x45, 0x00, 0x03, 0x00, 0x09, 0x03, 0x0a, 0x08, 0x00, 0xf0, 0x0e, 0x03, 0x05, 0x04, 0x00, 0x20,
+    0x09, 0x07, 0x05, 0x04, 0x00, 0x20, 0xe1, 0xff, 0x8c, 0xff, 0x16, 0x00, 0x03, 0x00, 0x05, 0x03,
+    0x0a, 0x08, 0x00, 0xf0, 0x05, 0x03, 0x05, 0x04, 0x00, 0x20, 0x0a, 0x07, 0x05, 0x04, 0x00, 0x20,
+    0x81, 0x01, 0x1d, 0x00, 0xe8, 0xfe, 0x02, 0x00, 0x0a, 0x0b, 0x06, 0x0c, 0x00, 0xf0, 0x0a, 0x0b,
+    0x03, 0x0c, 0x00, 0x20, 0x01, 0xff, 0xcf, 0x01, 0xdb, 0xff, 0x02, 0x00, 0x08, 0x0b, 0x06, 0x0b,
+    0x00, 0xf0, 0x0b, 0x0b, 0x03, 0x0b, 0x00, 0x20, 0x47, 0x00, 0x3b, 0x00, 0x94, 0xff, 0x02, 0x00,
+    0x07, 0x08, 0x0a, 0x04, 0x00, 0xf0, 0x07, 0x08, 0x05, 0x04, 0x00, 0x20, 0xa6, 0xff, 0x7e, 0x00,
+    0xcc, 0xff, 0x02, 0x00, 0x09, 0x06, 0x06, 0x07, 0x00, 0xf0, 0x0c, 0x06, 0x03, 0x07, 0x00, 0x20,
+    0xd6, 0xff, 0x9b, 0x00, 0x07, 0x00, 0x02, 0x00, 0x05, 0x12, 0x12, 0x03, 0x00, 0xf0, 0x05, 0x13,
+    0x12, 0x01, 0x00, 0x30, 0xda, 0xff, 0x66, 0x00, 0xc9, 0xff, 0x02, 0x00, 0x08, 0x04, 0x06, 0x09,
+    0x00, 0xf0, 0x0a, 0x04, 0x02, 0x09, 0x00, 0x30, 0x8a, 0xff, 0x27, 0xff, 0x24, 0x00, 0x02, 0x00,
+    0x08, 0x01, 0x09, 0x07, 0x00, 0xf0, 0x0b, 0x01, 0x03, 0x07, 0x00, 0x30, 0xaa, 0xff, 0x36, 0xff,
+    0xfd, 0xff, 0x02, 0x00, 0x06, 0x0b, 0x06, 0x06, 0x00, 0xf0, 0x09, 0x0b, 0x03, 0x06, 0x00, 0x20,
+    0x69, 0xff, 0x54, 0xff, 0x20, 0x00, 0x02, 0x00, 0x0e, 0x0c, 0x04, 0x0b, 0x00, 0xf0, 0x0e, 0x0c,
+    0x02, 0x0b, 0x00, 0x20, 0x2b, 0x00, 0x09, 0x00, 0x5e, 0xff, 0x02, 0x00, 0x06, 0x0c, 0x04, 0x0b,
+    0x00, 0xf0, 0x08, 0x0c, 0x02, 0x0b, 0x00, 0x20, 0x9e, 0x02, 0x23, 0x00, 0x88, 0xff, 0x02, 0x00,
+    0x08, 0x00, 0x0c, 0x12, 0x00, 0xf0, 0x0c, 0x00, 0x04, 0x12, 0x00, 0x30, 0x84, 0x01, 0xdd, 0xff,
+    0xf3, 0x01, 0x02, 0x00, 0x02, 0x0c, 0x0a, 0x05, 0x00, 0xf0, 0x07, 0x0c, 0x05, 0x05, 0x00, 0x20,
+    0x90, 0x00, 0x23, 0x00, 0xe2, 0xfd, 0x02, 0x00, 0x02, 0x14, 0x16, 0x03, 0x00, 0xf0, 0x02, 0x15,
+    0x16, 0x01, 0x00, 0x30, 0x34, 0x00, 0xcd, 0xff, 0x7e, 0x00, 0x02, 0x00, 0x00, 0x04, 0x02, 0x14,
+    0x00, 0xf0, 0x01, 0x04, 0x01, 0x14, 0x00, 0x20, 0x9c, 0xfc, 0x9b, 0x00, 0x39, 0x02, 0x89, 0xff,
+    0xc3, 0x00, 0x02, 0x00, 0x00, 0x02, 0x18, 0x04, 0x00, 0xf0, 0x08, 0x02, 0x08, 0x04, 0x00, 0x30,
+    0x30, 0x00, 0x0f, 0xff, 0x65, 0x00, 0x02, 0x00, 0x07, 0x08, 0x0a, 0x04, 0x00, 0xf0, 0x07, 0x0a,
+    0x0a, 0x02, 0x00, 0x20, 0xd8, 0xff, 0x53, 0x00, 0x5e, 0xff, 0x03, 0x00, 0x06, 0x07, 0x08, 0x0a,
+    0x00, 0xf0, 0x06, 0x07, 0x04, 0x05, 0x00, 0x20, 0x0a, 0x0c, 0x04, 0x05, 0x00, 0x20, 0xe8, 0xff,
+    0x46, 0x00, 0x6d, 0xff, 0x03, 0x00, 0x0e, 0x00, 0x06, 0x0e, 0x00, 0xf0, 0x11, 0x00, 0x03, 0x07,
+    0x00, 0x20, 0x0e, 0x07, 0x03, 0x07, 0x00, 0x20, 0xfb, 0xff, 0x3c, 0x00, 0x51, 0xff, 0x02, 0x00,
+    0x04, 0x0b, 0x05, 0x08, 0x00, 0xf0, 0x04, 0x0f, 0x05, 0x04, 0x00, 0x20, 0x84, 0x00, 0x6d, 0xff,
+    0x46, 0x00, 0x02, 0x00, 0x02, 0x00, 0x14, 0x09, 0x00, 0xf0, 0x02, 0x03, 0x14, 0x03, 0x00, 0x30,
+    0xc7, 0xff, 0x64, 0xff, 0x3e, 0x00, 0x03, 0x00, 0x06, 0x07, 0x0c, 0x08, 0x00, 0xf0, 0x06, 0x07,
+    0x06, 0x04, 0x00, 0x20, 0x0c, 0x0b, 0x06, 0x04, 0x00, 0x20, 0x04, 0x00, 0x70, 0xff, 0x45, 0x00,
+    0x02, 0x00, 0x09, 0x11, 0x06, 0x06, 0x00, 0xf0, 0x09, 0x14, 0x06, 0x03, 0x00, 0x20, 0x00, 0x00,
+    0x33, 0xff, 0x1d, 0x00, 0x02, 0x00, 0x07, 0x0a, 0x0a, 0x04, 0x00, 0xf0, 0x07, 0x0c, 0x0a, 0x02,
+    0x00, 0x20, 0xff, 0xff, 0x31, 0xff, 0x3d, 0x00, 0x02, 0x00, 0x06, 0x05, 0x0c, 0x09, 0x00, 0xf0,
+    0x0a, 0x05, 0x04, 0x09, 0x00, 0x30, 0x10, 0x00, 0x23, 0x00, 0x57, 0xff, 0x02, 0x00, 0x05, 0x0b,
+    0x06, 0x08, 0x00, 0xf0, 0x08, 0x0b, 0x03, 0x08, 0x00, 0x20, 0x3a, 0x00, 0xd6, 0xff, 0x6b, 0x00,
+    0x02, 0x00, 0x12, 0x04, 0x04, 0x11, 0x00, 0xf0, 0x12, 0x04, 0x02, 0x11, 0x00, 0x20, 0x1e, 0xff,
+    0x71, 0x01, 0xd0, 0xff, 0x02, 0x00, 0x00, 0x00, 0x06, 0x06, 0x00, 0xf0, 0x03, 0x00, 0x03, 0x06,
+    0x00, 0x20, 0x7f, 0x01, 0x22, 0x00, 0x16, 0xff, 0x02, 0x00, 0x12, 0x04, 0x04, 0x11, 0x00, 0xf0,
+    0x12, 0x04, 0x02, 0x11, 0x00, 0x20, 0x6d, 0x00, 0xaa, 0xff, 0x64, 0x00, 0x02, 0x00, 0x02, 0x04,
+    0x04, 0x11, 0x00, 0xf0, 0x04, 0x04, 0x02, 0x11, 0x00, 0x20, 0x0f, 0x00, 0xe3, 0xff, 0x71, 0x00,
+    0x02, 0x00, 0x05, 0x12, 0x13, 0x03, 0x00, 0xf0, 0x05, 0x13, 0x13, 0x01, 0x00, 0x30, 0x7e, 0xff,
+    0x02, 0xff, 0x00, 0x00, 0x02, 0x00, 0x0b, 0x00, 0x02, 0x12, 0x00, 0xf0, 0x0b, 0x09, 0x02, 0x09,
+    0x00, 0x20, 0xa4, 0xff, 0x85, 0xff, 0x2b, 0x00, 0x02, 0x00, 0x0f, 0x04, 0x02, 0x12, 0x00, 0xf0,
+    0x0f, 0x0d, 0x02, 0x09, 0x00, 0x20, 0x67, 0x00, 0x09, 0x00, 0x33, 0xff, 0x02, 0x00, 0x07, 0x04,
+    0x02, 0x12, 0x00, 0xf0, 0x07, 0x0d, 0x02, 0x09, 0x00, 0x20, 0x81, 0xff, 0xea, 0xfe, 0x2e, 0x00,
+    0x03, 0x00, 0x07, 0x0b, 0x0a, 0x08, 0x00, 0xf0, 0x0c, 0x0b, 0x05, 0x04, 0x00, 0x20, 0x07, 0x0f,
+    0x05, 0x04, 0x00, 0x20, 0x94, 0xff, 0xf4, 0x00, 0xcb, 0xff, 0x02, 0x00, 0x0a, 0x06, 0x04, 0x09,
+    0x00, 0xf0, 0x0c, 0x06, 0x02, 0x09, 0x00, 0x20, 0xc8, 0xff, 0xf7, 0xfe, 0x38, 0x00, 0x02, 0x00,
+    0x0a, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x0c, 0x00, 0x02, 0x09, 0x00, 0x30, 0xff, 0xfe, 0xe6, 0x00,
+    0xd0, 0xff, 0x03, 0x00, 0x02, 0x09, 0x10, 0x08, 0x00, 0xf0, 0x02, 0x09, 0x08, 0x04, 0x00, 0x20,
+    0x0a, 0x0d, 0x08, 0x04, 0x00, 0x20, 0x49, 0xff, 0xfd, 0xfe, 0x25, 0x00, 0x02, 0x00, 0x0e, 0x0f,
+    0x06, 0x09, 0x00, 0xf0, 0x0e, 0x12, 0x06, 0x03, 0x00, 0x30, 0xad, 0xff, 0x9d, 0x00, 0xc4, 0xff,
+    0x02, 0x00, 0x08, 0x07, 0x06, 0x09, 0x00, 0xf0, 0x0a, 0x07, 0x02, 0x09, 0x00, 0x30, 0xe0, 0xff,
+    0xeb, 0xff, 0x37, 0x00, 0x02, 0x00, 0x0e, 0x0f, 0x06, 0x09, 0x00, 0xf0, 0x0e, 0x12, 0x06, 0x03,
+    0x00, 0x30, 0x23, 0x00, 0x10, 0x00, 0x66, 0xff, 0x02, 0x00, 0x03, 0x0c, 0x0c, 0x06, 0x00, 0xf0,
+    0x03, 0x0e, 0x0c, 0x02, 0x00, 0x30, 0x91, 0xff, 0x11, 0xff, 0x27, 0x00, 0x02, 0x00, 0x0e, 0x0c,
+    0x09, 0x06, 0x00, 0xf0, 0x0e, 0x0e, 0x09, 0x02, 0x00, 0x30, 0xbd, 0xff, 0x29, 0xff, 0x03, 0x00,
+    0x02, 0x00, 0x01, 0x0c, 0x09, 0x06, 0x00, 0xf0, 0x01, 0x0e, 0x09, 0x02, 0x00, 0x30, 0xc8, 0xff,
+    0x9b, 0x00, 0xe9, 0xff, 0x02, 0x00, 0x03, 0x07, 0x12, 0x03, 0x00, 0xf0, 0x03, 0x08, 0x12, 0x01,
+    0x00, 0x30, 0x77, 0x00, 0xf9, 0xff, 0x9a, 0xfe, 0x02, 0x00, 0x01, 0x07, 0x16, 0x06, 0x00, 0xf0,
+    0x01, 0x09, 0x16, 0x02, 0x00, 0x30, 0x99, 0x00, 0x21, 0x00, 0x82, 0xff, 0x02, 0x00, 0x12, 0x04,
+    0x06, 0x06, 0x00, 0xf0, 0x12, 0x07, 0x06, 0x03, 0x00, 0x20, 0x9a, 0xff, 0xdf, 0xfe, 0xfd, 0xff,
+    0x02, 0x00, 0x00, 0x04, 0x06, 0x06, 0x00, 0xf0, 0x00, 0x07, 0x06, 0x03, 0x00, 0x20, 0xfb, 0xfe,
+    0xc2, 0x00, 0x00, 0x00, 0x02, 0x00, 0x05, 0x0b, 0x10, 0x06, 0x00, 0xf0, 0x05, 0x0e, 0x10, 0x03,
+    0x00, 0x20, 0xda, 0xff, 0x4c, 0x00, 0xb5, 0xff, 0x02, 0x00, 0x06, 0x10, 0x09, 0x04, 0x00, 0xf0,
+    0x06, 0x12, 0x09, 0x02, 0x00, 0x20, 0xfd, 0xff, 0x05, 0x00, 0x33, 0x00, 0x02, 0x00, 0x0e, 0x0f,
+    0x06, 0x09, 0x00, 0xf0, 0x0e, 0x12, 0x06, 0x03, 0x00, 0x30, 0xa7, 0xff, 0x26, 0xff, 0x0c, 0x00,
+    0x02, 0x00, 0x04, 0x0f, 0x06, 0x09, 0x00, 0xf0, 0x04, 0x12, 0x06, 0x03, 0x00, 0x30, 0xb7, 0xff,
+    0xf1, 0xff, 0x26, 0x00, 0x02, 0x00, 0x0f, 0x01, 0x06, 0x17, 0x00, 0xf0, 0x11, 0x01, 0x02, 0x17,
+    0x00, 0x30, 0x9b, 0xff, 0x5b, 0x00, 0xbd, 0xff, 0x02, 0x00, 0x00, 0x15, 0x18, 0x03, 0x00, 0xf0,
+    0x08, 0x15, 0x08, 0x03, 0x00, 0x30, 0x83, 0x02, 0x00, 0x00, 0x0a, 0x01, 0x02, 0x00, 0x00, 0x14,
+    0x18, 0x04, 0x00, 0xf0, 0x08, 0x14, 0x08, 0x04, 0x00, 0x30, 0x1a, 0x01, 0xf8, 0xff, 0xd3, 0xfe,
+    0x02, 0x00, 0x03, 0x01, 0x06, 0x17, 0x00, 0xf0, 0x05, 0x01, 0x02, 0x17, 0x00, 0x30, 0xd3, 0xff,
+    0x97, 0x00, 0xf2, 0xff, 0x02, 0x00, 0x03, 0x11, 0x12, 0x03, 0x00, 0xf0, 0x03, 0x12, 0x12, 0x01,
+    0x00, 0x30, 0xc8, 0xff, 0x98, 0x00, 0xc2, 0xff, 0x02, 0x00, 0x00, 0x10, 0x12, 0x03, 0x00, 0xf0,
+    0x00, 0x11, 0x12, 0x01, 0x00, 0x30, 0x82, 0xff, 0xd4, 0xfe, 0x2b, 0x00, 0x03, 0x00, 0x01, 0x10,
+    0x16, 0x04, 0x00, 0xf0, 0x0c, 0x10, 0x0b, 0x02, 0x00, 0x20, 0x01, 0x12, 0x0b, 0x02, 0x00, 0x20,
+    0x57, 0x00, 0xfc, 0xff, 0xef, 0xfe, 0x02, 0x00, 0x00, 0x10, 0x09, 0x06, 0x00, 0xf0, 0x00, 0x12,
+    0x09, 0x02, 0x00, 0x30, 0x7d, 0x01, 0x29, 0x00, 0xaa, 0xfe, 0x02, 0x00, 0x02, 0x0a, 0x15, 0x03,
+    0x00, 0xf0, 0x09, 0x0a, 0x07, 0x03, 0x00, 0x30, 0x79, 0x00, 0xc7, 0xff, 0x74, 0x00, 0x03, 0x00,
+    0x02, 0x12, 0x0c, 0x06, 0x00, 0xf0, 0x02, 0x12, 0x06, 0x03, 0x00, 0x20, 0x08, 0x15, 0x06, 0x03,
+    0x00, 0x20, 0x00, 0x00, 0x46, 0x00, 0xa1, 0xff, 0x02, 0x00, 0x00, 0x05, 0x18, 0x04, 0x00, 0xf0,
+    0x00, 0x07, 0x18, 0x02, 0x00, 0x20, 0x54, 0xff, 0x3e, 0xff, 0x04, 0x00, 0x02, 0x00, 0x0a, 0x02,
+    0x04, 0x0f, 0x00, 0xf0, 0x0a, 0x07, 0x04, 0x05, 0x00, 0x30, 0xa4, 0xff, 0xc6, 0xff, 0x3c, 0x00,
+    0x02, 0x00, 0x0a, 0x07, 0x06, 0x0c, 0x00, 0xf0, 0x0a, 0x0d, 0x06, 0x06, 0x00, 0x20, 0xcc, 0xff,
+    0x31, 0x00, 0xae, 0xff, 0x02, 0x00, 0x06, 0x06, 0x06, 0x09, 0x00, 0xf0, 0x08, 0x06, 0x02, 0x09,
+    0x00, 0x30, 0x72, 0x00, 0x2a, 0x00, 0xfb, 0xfe, 0x02, 0x00, 0x0b, 0x00, 0x06, 0x09, 0x00, 0xf0,
+    0x0d, 0x00, 0x02, 0x09, 0x00, 0x30, 0x8f, 0xff, 0x48, 0x01, 0xd4, 0xff, 0x02, 0x00, 0x09, 0x07,
+    0x06, 0x09, 0x00, 0xf0, 0x0b, 0x07, 0x02, 0x09, 0x00, 0x30, 0xe7, 0xff, 0x76, 0xff, 0x3d, 0x00,
+    0x02, 0x00, 0x02, 0x01, 0x14, 0x03, 0x00, 0xf0, 0x02, 0x02, 0x14, 0x01, 0x00, 0x30, 0xad, 0xff,
+    0xa2, 0x00, 0xcb, 0xff, 0x03, 0x00, 0x01, 0x12, 0x0c, 0x06, 0x00, 0xf0, 0x01, 0x12, 0x06, 0x03,
+    0x00, 0x20, 0x07, 0x15, 0x06, 0x03, 0x00, 0x20, 0xce, 0xff, 0x81, 0xff, 0x2c, 0x00, 0x02, 0x00,
+    0x0d, 0x02, 0x04, 0x0d, 0x00, 0xf0, 0x0d, 0x02, 0x02, 0x0d, 0x00, 0x20, 0x5b, 0xff, 0xd1, 0xfe,
+    0xf8, 0xff, 0x02, 0x00, 0x06, 0x07, 0x0c, 0x04, 0x00, 0xf0, 0x0c, 0x07, 0x06, 0x04, 0x00, 0x20,
+    0x79, 0x00, 0x05, 0x00, 0x01, 0x01, 0x02, 0x00, 0x0a, 0x01, 0x04, 0x0d, 0x00, 0xf0, 0x0a, 0x01,
+    0x02, 0x0d, 0x00, 0x20, 0x1c, 0x00, 0x07, 0x00, 0x67, 0xff, 0x02, 0x00, 0x06, 0x00, 0x03, 0x12,
+    0x00, 0xf0, 0x07, 0x00, 0x01, 0x12, 0x00, 0x30, 0x42, 0x00, 0xcb, 0xff, 0x60, 0x00, 0x02, 0x00,
+    0x0e, 0x03, 0x0a, 0x05, 0x00, 0xf0, 0x0e, 0x03, 0x05, 0x05, 0x00, 0x20, 0xcd, 0x00, 0x00, 0x00,
+    0x49, 0xff, 0x02, 0x00, 0x06, 0x0f, 0x0c, 0x08, 0x00, 0xf0, 0x0a, 0x0f, 0x04, 0x08, 0x00, 0x30,
+    0x08, 0x00, 0xc8, 0xff, 0x52, 0x00, 0x02, 0x00, 0x09, 0x0a, 0x06, 0x09, 0x00, 0xf0, 0x0b, 0x0a,
+    0x02, 0x09, 0x00, 0x30, 0x66, 0x00, 0xfe, 0xff, 0x3a, 0xff, 0x02, 0x00, 0x08, 0x03, 0x04, 0x09,
+    0x00, 0xf0, 0x0a, 0x03, 0x02, 0x09, 0x00, 0x20, 0xc0, 0xff, 0x72, 0x00, 0xf1, 0xff, 0x03, 0x00,
+    0x11, 0x00, 0x06, 0x0e, 0x00, 0xf0, 0x14, 0x00, 0x03, 0x07, 0x00, 0x20, 0x11, 0x07, 0x03, 0x07,
+    0x00, 0x20, 0x98, 0x00, 0xcc, 0xff, 0x93, 0x00, 0x03, 0x00, 0x01, 0x00, 0x06, 0x0e, 0x00, 0xf0,
+    0x01, 0x00, 0x03, 0x07, 0x00, 0x20, 0x04, 0x07, 0x03, 0x07, 0x00, 0x20, 0xbc, 0xfe, 0x3c, 0xff,
+    0x20, 0x00, 0x03, 0x00, 0x0e, 0x00, 0x06, 0x10, 0x00, 0xf0, 0x11, 0x00, 0x03, 0x08, 0x00, 0x20,
+    0x0e, 0x08, 0x03, 0x08, 0x00, 0x20, 0xba, 0xff, 0x97, 0xfe, 0xf3, 0xff, 0x02, 0x00, 0x07, 0x04,
+    0x04, 0x0a, 0x00, 0xf0, 0x09, 0x04, 0x02, 0x0a, 0x00, 0x20, 0x86, 0x00, 0x31, 0x00, 0x5e, 0xff,
+    0x03, 0x00, 0x03, 0x11, 0x12, 0x06, 0x00, 0xf0, 0x0c, 0x11, 0x09, 0x03, 0x00, 0x20, 0x03, 0x14,
+    0x09, 0x03, 0x00, 0x20, 0x1f, 0xfe, 0xd7, 0x00, 0xd2, 0xff, 0x02, 0x00, 0x01, 0x14, 0x16, 0x04,
+    0x00, 0xf0, 0x0c, 0x14, 0x0b, 0x04, 0x00, 0x20, 0xed, 0x01, 0x20, 0x00, 0xe1, 0xfd, 0x02, 0x00,
+    0x0e, 0x03, 0x0a, 0x05, 0x00, 0xf0, 0x0e, 0x03, 0x05, 0x05, 0x00, 0x20, 0x11, 0x00, 0x89, 0xff,
+    0x16, 0x00, 0x02, 0x00, 0x00, 0x03, 0x0a, 0x05, 0x00, 0xf0, 0x05, 0x03, 0x05, 0x05, 0x00, 0x20,
+    0xd7, 0xfe, 0x84, 0x00, 0x04, 0x00, 0x02, 0x00, 0x0c, 0x06, 0x0c, 0x10, 0x00, 0xf0, 0x10, 0x06,
+    0x04, 0x10, 0x00, 0x30, 0xd5, 0x02, 0xf9, 0xff, 0xe6, 0xfe, 0x02, 0x00, 0x00, 0x06, 0x0c, 0x10,
+    0x00, 0xf0, 0x04, 0x06, 0x04, 0x10, 0x00, 0x30, 0x22, 0x00, 0x3e, 0x00, 0x9e, 0xff, 0x02, 0x00,
+    0x0a, 0x09, 0x05, 0x0f, 0x00, 0xf0, 0x0a, 0x0e, 0x05, 0x05, 0x00, 0x30, 0xcb, 0xff, 0xfa, 0x00,
+    0xd5, 0xff, 0x02, 0x00, 0x01, 0x12, 0x15, 0x02, 0x00, 0xf0, 0x01, 0x13, 0x15, 0x01, 0x00, 0x20,
+    0x4d, 0x00, 0x33, 0x00, 0x9e, 0xff, 0x02, 0x00, 0x0f, 0x00, 0x09, 0x06, 0x00, 0xf0, 0x0f, 0x02,
+    0x09, 0x02, 0x00, 0x30, 0x57, 0x00, 0xbf, 0xff, 0x5a, 0x00, 0x02, 0x00, 0x06, 0x01, 0x0c, 0x04,
+    0x00, 0xf0, 0x0c, 0x01, 0x06, 0x04, 0x00, 0x20, 0x03, 0x01, 0x2b, 0x00, 0x17, 0xff, 0x03, 0x00,
+    0x06, 0x00, 0x0c, 0x0c, 0x00, 0xf0, 0x0c, 0x00, 0x06, 0x06, 0x00, 0x20, 0x06, 0x06, 0x06, 0x06,
+    0x00, 0x20, 0x7c, 0xff, 0x25, 0xff, 0xfb, 0xff, 0x03, 0x00, 0x08, 0x0a, 0x08, 0x0c, 0x00, 0xf0,
+    0x08, 0x0a, 0x04, 0x06, 0x00, 0x20, 0x0c, 0x10, 0x04, 0x06, 0x00, 0x20, 0xa0, 0xff, 0x8f, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0x0e, 0x10, 0x0a, 0x08, 0x00, 0xf0, 0x13, 0x10, 0x05, 0x04, 0x00, 0x20,
+    0x0e, 0x14, 0x05, 0x04, 0x00, 0x20, 0x4c, 0x00, 0xbf, 0xff, 0x58, 0x00, 0x03, 0x00, 0x00, 0x10,
+    0x0a, 0x08, 0x00, 0xf0, 0x00, 0x10, 0x05, 0x04, 0x00, 0x20, 0x05, 0x14, 0x05, 0x04, 0x00, 0x20,
+    0x7f, 0x00, 0x01, 0x00, 0x59, 0x00, 0x02, 0x00, 0x0a, 0x0c, 0x0c, 0x05, 0x00, 0xf0, 0x0e, 0x0c,
+    0x04, 0x05, 0x00, 0x30, 0xd3, 0xff, 0x66, 0xff, 0x0a, 0x00, 0x03, 0x00, 0x06, 0x10, 0x0a, 0x08,
+    0x00, 0xf0, 0x06, 0x10, 0x05, 0x04, 0x00, 0x20, 0x0b, 0x14, 0x05, 0x04, 0x00, 0x20, 0xcc, 0xff,
+    0x6b, 0x00, 0xf3, 0xff, 0x03, 0x00, 0x07, 0x06, 0x0c, 0x06, 0x00, 0xf0, 0x0d, 0x06, 0x06, 0x03,
+    0x00, 0x20, 0x07, 0x09, 0x06, 0x03, 0x00, 0x20, 0xcc, 0xff, 0x3a, 0x00, 0xae, 0xff, 0x03, 0x00,
+    0x09, 0x06, 0x04, 0x12, 0x00, 0xf0, 0x09, 0x06, 0x02, 0x09, 0x00, 0x20, 0x0b, 0x0f, 0x02, 0x09,
+    0x00, 0x20, 0x19, 0x01, 0x17, 0x00, 0x00, 0x0a, 0x03, 0x00, 0x0a, 0x09, 0x06, 0x0e, 0x00, 0xf0,
+    0x0d, 0x09, 0x03, 0x07, 0x00, 0x20, 0x0a, 0x10, 0x03, 0x07, 0x00, 0x20, 0x15, 0x00, 0xbc, 0xff,
+    0x55, 0x00, 0x03, 0x00, 0x08, 0x09, 0x06, 0x0e, 0x00, 0xf0, 0x08, 0x09, 0x03, 0x07, 0x00, 0x20,
+    0x0b, 0x10, 0x03, 0x07, 0x00, 0x20, 0x62, 0xff, 0x47, 0xff, 0x2d, 0x00, 0x02, 0x00, 0x07, 0x04,
+    0x0b, 0x0c, 0x00, 0xf0, 0x07, 0x0a, 0x0b, 0x06, 0x00, 0x20, 0x19, 0x00, 0xa7, 0xff, 0x2a, 0x00,
+    0x03, 0x00, 0x04, 0x08, 0x06, 0x10, 0x00, 0xf0, 0x04, 0x08, 0x03, 0x08, 0x00, 0x20, 0x07, 0x10,
+    0x03, 0x08, 0x00, 0x20, 0xcd, 0x02, 0x1d, 0x00, 0x76, 0xfe, 0x02, 0x00, 0x11, 0x03, 0x04, 0x15,
+    0x00, 0xf0, 0x11, 0x0a, 0x04, 0x07, 0x00, 0x30, 0xdc, 0x01, 0xfe, 0xff, 0x01, 0xff, 0x02, 0x00,
+    0x03, 0x03, 0x04, 0x15, 0x00, 0xf0, 0x03, 0x0a, 0x04, 0x07, 0x00, 0x30, 0xa2, 0xff, 0x34, 0x00,
+    0x03, 0x00, 0x03, 0x00, 0x0a, 0x01, 0x08, 0x12, 0x00, 0xf0, 0x0e, 0x01, 0x04, 0x09, 0x00, 0x20,
+    0x0a, 0x0a, 0x04, 0x09, 0x00, 0x20, 0x2e, 0xff, 0x94, 0x00, 0xcd, 0xff, 0x03, 0x00, 0x02, 0x05,
+    0x10, 0x08, 0x00, 0xf0, 0x02, 0x05, 0x08, 0x04, 0x00, 0x20, 0x0a, 0x09, 0x08, 0x04, 0x00, 0x20,
+    0x98, 0x03, 0x04, 0x00, 0x15, 0x01, 0x02, 0x00, 0x03, 0x06, 0x12, 0x0c, 0x00, 0xf0, 0x03, 0x0a,
+    0x12, 0x04, 0x00, 0x30, 0x26, 0x00, 0xac, 0xff, 0x32, 0x00, 0x02, 0x00, 0x04, 0x0a, 0x10, 0x0c,
+    0x00, 0xf0, 0x04, 0x0e, 0x10, 0x04, 0x00, 0x30, 0x1b, 0xfe, 0x5f, 0x01, 0x11, 0x00, 0x03, 0x00,
+    0x0f, 0x04, 0x08, 0x14, 0x00, 0xf0, 0x13, 0x04, 0x04, 0x0a, 0x00, 0x20, 0x0f, 0x0e, 0x04, 0x0a,
+    0x00, 0x20, 0x9a, 0x00, 0x00, 0x00, 0x29, 0xff, 0x02, 0x00, 0x07, 0x02, 0x09, 0x06, 0x00, 0xf0,
+    0x0a, 0x02, 0x03, 0x06, 0x00, 0x30, 0x5a, 0x00, 0xfd, 0xff, 0x5d, 0x00, 0x03, 0x00, 0x0f, 0x04,
+    0x08, 0x14, 0x00, 0xf0, 0x13, 0x04, 0x04, 0x0a, 0x00, 0x20, 0x0f, 0x0e, 0x04, 0x0a, 0x00, 0x20,
+    0x6c, 0xff, 0x60, 0x00, 0xba, 0xff, 0x03, 0x00, 0x01, 0x04, 0x08, 0x14, 0x00, 0xf0, 0x01, 0x04,
+    0x04, 0x0a, 0x00, 0x20, 0x05, 0x0e, 0x04, 0x0a, 0x00, 0x20, 0xe4, 0xfd, 0x41, 0xfd, 0x1b, 0x00,
+    0x03, 0x00, 0x0b, 0x08, 0x08, 0x0e, 0x00, 0xf0, 0x0f, 0x08, 0x04, 0x07, 0x00, 0x20, 0x0b, 0x0f,
+    0x04, 0x07, 0x00, 0x20, 0x56, 0xff, 0x79, 0x00, 0xc5, 0xff, 0x03, 0x00, 0x05, 0x08, 0x08, 0x0e,
+    0x00, 0xf0, 0x05, 0x08, 0x04, 0x07, 0x00, 0x20, 0x09, 0x0f, 0x04, 0x07, 0x00, 0x20, 0x79, 0xff,
+    0x6c, 0xff, 0x2c, 0x00, 0x02, 0x00, 0x0a, 0x0d, 0x05, 0x08, 0x00, 0xf0, 0x0a, 0x11, 0x05, 0x04,
+    0x00, 0x20, 0x40, 0x00, 0xfe, 0xff, 0x2a, 0xff, 0x02, 0x00, 0x04, 0x0d, 0x07, 0x09, 0x00, 0xf0,
+    0x04, 0x10, 0x07, 0x03, 0x00, 0x30, 0x5f, 0xff, 0x59, 0x00, 0xd4, 0xff, 0x02, 0x00, 0x00, 0x0d,
+    0x18, 0x0a, 0x00, 0xf0, 0x00, 0x12, 0x18, 0x05, 0x00, 0x20, 0xeb, 0xfe, 0x6c, 0x01, 0xdb, 0xff,
+    0x02, 0x00, 0x04, 0x02, 0x08, 0x0b, 0x00, 0xf0, 0x08, 0x02, 0x04, 0x0b, 0x00, 0x20, 0x93, 0xff,
+    0x3d, 0x00, 0x03, 0x00, 0x03, 0x00, 0x0a, 0x02, 0x08, 0x10, 0x00, 0xf0, 0x0e, 0x02, 0x04, 0x08,
+    0x00, 0x20, 0x0a, 0x0a, 0x04, 0x08, 0x00, 0x20, 0xa3, 0x00, 0xfe, 0xff, 0x3e, 0xff, 0x03, 0x00,
+    0x00, 0x02, 0x18, 0x06, 0x00, 0xf0, 0x00, 0x02, 0x0c, 0x03, 0x00, 0x20, 0x0c, 0x05, 0x0c, 0x03,
+    0x00, 0x20, 0x9c, 0x01, 0xfc, 0xff, 0xc3, 0x00, 0x02, 0x00, 0x06, 0x00, 0x0c, 0x09, 0x00, 0xf0,
+    0x06, 0x03, 0x0c, 0x03, 0x00, 0x30, 0xb5, 0xfe, 0x19, 0xff, 0xfe, 0xff, 0x03, 0x00, 0x01, 0x02,
+    0x0c, 0x0c, 0x00, 0xf0, 0x01, 0x02, 0x06, 0x06, 0x00, 0x20, 0x07, 0x08, 0x06, 0x06, 0x00, 0x20,
+    0xa9, 0xff, 0xca, 0xff, 0x38, 0x00, 0x02, 0x00, 0x12, 0x05, 0x06, 0x09, 0x00, 0xf0, 0x12, 0x08,
+    0x06, 0x03, 0x00, 0x30, 0xd5, 0xff, 0x32, 0x00, 0xa5, 0xff, 0x03, 0x00, 0x04, 0x03, 0x08, 0x0a,
+    0x00, 0xf0, 0x04, 0x03, 0x04, 0x05, 0x00, 0x20, 0x08, 0x08, 0x04, 0x05, 0x00, 0x20, 0x03, 0x00,
+    0xe9, 0xff, 0x42, 0x00, 0x02, 0x00, 0x06, 0x15, 0x12, 0x03, 0x00, 0xf0, 0x06, 0x16, 0x12, 0x01,
+    0x00, 0x30, 0x0e, 0x00, 0x73, 0xff, 0x07, 0x00, 0x02, 0x00, 0x01, 0x0a, 0x12, 0x02, 0x00, 0xf0,
+    0x01, 0x0b, 0x12, 0x01, 0x00, 0x20, 0x4d, 0x00, 0x2f, 0x00, 0x55, 0xff, 0x02, 0x00, 0x01, 0x0a,
+    0x16, 0x03, 0x00, 0xf0, 0x01, 0x0b, 0x16, 0x01, 0x00, 0x30, 0x98, 0xff, 0xf0, 0x01, 0xdb, 0xff,
+    0x02, 0x00, 0x02, 0x08, 0x0c, 0x09, 0x00, 0xf0, 0x02, 0x0b, 0x0c, 0x03, 0x00, 0x30, 0xf0, 0xff,
+    0xbd, 0xff, 0x35, 0x00, 0x03, 0x00, 0x0c, 0x08, 0x0c, 0x06, 0x00, 0xf0, 0x12, 0x08, 0x06, 0x03,
+    0x00, 0x20, 0x0c, 0x0b, 0x06, 0x03, 0x00, 0x20, 0xfd, 0xff, 0x74, 0xff, 0x0c, 0x00, 0x03, 0x00,
+    0x00, 0x08, 0x0c, 0x06, 0x00, 0xf0, 0x00, 0x08, 0x06, 0x03, 0x00, 0x20, 0x06, 0x0b, 0x06, 0x03,
+    0x00, 0x20, 0x36, 0xff, 0x71, 0xfd, 0x21, 0x00, 0x02, 0x00, 0x0a, 0x0f, 0x06, 0x09, 0x00, 0xf0,
+    0x0c, 0x0f, 0x02, 0x09, 0x00, 0x30, 0x2f, 0x00, 0xc1, 0xff, 0x66, 0x00, 0x02, 0x00, 0x07, 0x0d,
+    0x09, 0x06, 0x00, 0xf0, 0x07, 0x0f, 0x09, 0x02, 0x00, 0x30, 0x8d, 0x00, 0x29, 0x00, 0x4a, 0xff,
+    0x02, 0x00, 0x09, 0x08, 0x07, 0x0c, 0x00, 0xf0, 0x09, 0x0e, 0x07, 0x06, 0x00, 0x20, 0xdf, 0xff,
+    0x38, 0x00, 0xb6, 0xff, 0x02, 0x00, 0x04, 0x0d, 0x09, 0x06, 0x00, 0xf0, 0x07, 0x0d, 0x03, 0x06,
+    0x00, 0x30, 0xa5, 0xff, 0x4f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, 0x0f, 0x12, 0x04, 0x00, 0xf0,
+    0x0c, 0x0f, 0x06, 0x04, 0x00, 0x30, 0x82, 0xff, 0x0c, 0xff, 0xfe, 0xff, 0x02, 0x00, 0x05, 0x04,
+    0x04, 0x10, 0x00, 0xf0, 0x07, 0x04, 0x02, 0x10, 0x00, 0x20, 0xb3, 0x00, 0x20, 0x00, 0xd3, 0xfe,
+    0x02, 0x00, 0x0a, 0x0f, 0x06, 0x09, 0x00, 0xf0, 0x0c, 0x0f, 0x02, 0x09, 0x00, 0x30, 0xb0, 0x00,
+    0xf1, 0xff, 0x25, 0xfe, 0x02, 0x00, 0x08, 0x0f, 0x06, 0x09, 0x00, 0xf0, 0x0a, 0x0f, 0x02, 0x09,
+    0x00, 0x30, 0x6f, 0x00, 0x0a, 0x00, 0x63, 0x00, 0x03, 0x00, 0x09, 0x0b, 0x0c, 0x0a, 0x00, 0xf0,
+    0x0f, 0x0b, 0x06, 0x05, 0x00, 0x20, 0x09, 0x10, 0x06, 0x05, 0x00, 0x20, 0x26, 0x00, 0xf5, 0xff,
+    0xe4, 0xfe, 0x02, 0x00, 0x03, 0x06, 0x0e, 0x06, 0x00, 0xf0, 0x03, 0x08, 0x0e, 0x02, 0x00, 0x30,
+    0x82, 0x01, 0x0a, 0x00, 0xfc, 0x00, 0x02, 0x00, 0x04, 0x02, 0x11, 0x08, 0x00, 0xf0, 0x04, 0x06,
+    0x11, 0x04, 0x00, 0x20, 0xb9, 0x02, 0x07, 0x00, 0x4f, 0xff, 0x02, 0x00, 0x06, 0x02, 0x0c, 0x15,
+    0x00, 0xf0, 0x06, 0x09, 0x0c, 0x07, 0x00, 0x30, 0x3f, 0xff, 0x08, 0x01, 0x11, 0x00, 0x02, 0x00,
+    0x08, 0x01, 0x09, 0x09, 0x00, 0xf0, 0x08, 0x04, 0x09, 0x03, 0x00, 0x30, 0xca, 0x01, 0xef, 0xff,
+    0x81, 0xfd, 0x02, 0x00, 0x00, 0x07, 0x18, 0x03, 0x00, 0xf0, 0x0c, 0x07, 0x0c, 0x03, 0x00, 0x20,
+    0xc6, 0xff, 0x68, 0xff, 0x26, 0x00, 0x02, 0x00, 0x0b, 0x06, 0x09, 0x0a, 0x00, 0xf0, 0x0b, 0x0b,
+    0x09, 0x05, 0x00, 0x20, 0x8b, 0x00, 0xf0, 0xff, 0xdd, 0xfd, 0x02, 0x00, 0x02, 0x0b, 0x12, 0x03,
+    0x00, 0xf0, 0x02, 0x0c, 0x12, 0x01, 0x00, 0x30, 0x58, 0x00, 0x0e, 0x00, 0xc8, 0x00, 0x02, 0x00,
+    0x08, 0x10, 0x09, 0x04, 0x00, 0xf0, 0x08, 0x12, 0x09, 0x02, 0x00, 0x20, 0x59, 0x00, 0xff, 0xff,
+    0x48, 0xff, 0x02, 0x00, 0x00, 0x00, 0x09, 0x06, 0x00, 0xf0, 0x00, 0x02, 0x09, 0x02, 0x00, 0x30,
+    0x51, 0x01, 0x25, 0x00, 0xa3, 0xfe, 0x02, 0x00, 0x00, 0x0b, 0x18, 0x06, 0x00, 0xf0, 0x00, 0x0d,
+    0x18, 0x02, 0x00, 0x30, 0x5a, 0x01, 0xd3, 0xff, 0xba, 0x00, 0x02, 0x00, 0x02, 0x09, 0x14, 0x06,
+    0x00, 0xf0, 0x02, 0x0c, 0x14, 0x03, 0x00, 0x20, 0x1f, 0xff, 0x68, 0xff, 0x31, 0x00, 0x03, 0x00,
+    0x04, 0x05, 0x10, 0x0c, 0x00, 0xf0, 0x0c, 0x05, 0x08, 0x06, 0x00, 0x20, 0x04, 0x0b, 0x08, 0x06,
+    0x00, 0x20, 0xf7, 0xfe, 0xec, 0xfe, 0xf6, 0xff, 0x02, 0x00, 0x0a, 0x02, 0x04, 0x0f, 0x00, 0xf0,
+    0x0a, 0x07, 0x04, 0x05, 0x00, 0x30, 0xa3, 0xff, 0xc7, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0x03,
+    0x0a, 0x04, 0x00, 0xf0, 0x07, 0x05, 0x0a, 0x02, 0x00, 0x20, 0xe0, 0x00, 0xf0, 0xff, 0x2f, 0xfe,
+    0x02, 0x00, 0x09, 0x0f, 0x06, 0x08, 0x00, 0xf0, 0x09, 0x13, 0x06, 0x04, 0x00, 0x20, 0x00, 0x00,
+    0xfc, 0xff, 0x35, 0x00, 0x02, 0x00, 0x11, 0x00, 0x07, 0x0a, 0x00, 0xf0, 0x11, 0x05, 0x07, 0x05,
+    0x00, 0x20, 0x92, 0x01, 0xf2, 0xff, 0x96, 0xfe, 0x02, 0x00, 0x00, 0x00, 0x07, 0x0a, 0x00, 0xf0,
+    0x00, 0x05, 0x07, 0x05, 0x00, 0x20, 0xe3, 0xff, 0x57, 0x00, 0xe2, 0xff, 0x03, 0x00, 0x10, 0x01,
+    0x06, 0x0c, 0x00, 0xf0, 0x13, 0x01, 0x03, 0x06, 0x00, 0x20, 0x10, 0x07, 0x03, 0x06, 0x00, 0x20,
+    0xcd, 0x00, 0xbd, 0xff, 0x42, 0x00, 0x02, 0x00, 0x01, 0x00, 0x13, 0x08, 0x00, 0xf0, 0x01, 0x04,
+    0x13, 0x04, 0x00, 0x20, 0xe9, 0xff, 0xdf, 0xff, 0x2c, 0x00, 0x02, 0x00, 0x0c, 0x02, 0x09, 0x04,
+    0x00, 0xf0, 0x0c, 0x04, 0x09, 0x02, 0x00, 0x20, 0x39, 0x00, 0x07, 0x00, 0x64, 0xff, 0x02, 0x00,
+    0x03, 0x02, 0x09, 0x04, 0x00, 0xf0, 0x03, 0x04, 0x09, 0x02, 0x00, 0x20, 0x57, 0x00, 0x06, 0x00,
+    0x4d, 0x00, 0x02, 0x00, 0x0c, 0x02, 0x0a, 0x06, 0x00, 0xf0, 0x0c, 0x04, 0x0a, 0x02, 0x00, 0x30,
+    0x89, 0xff, 0x73, 0x00, 0xc6, 0xff, 0x02, 0x00, 0x03, 0x04, 0x12, 0x02, 0x00, 0xf0, 0x0c, 0x04,
+    0x09, 0x02, 0x00, 0x20, 0x01, 0x00, 0xce, 0xff, 0x35, 0x00, 0x02, 0x00, 0x0c, 0x01, 0x04, 0x09,
+    0x00, 0xf0, 0x0c, 0x01, 0x02, 0x09, 0x00, 0x20, 0x07, 0x00, 0x76, 0xff, 0x11, 0x00, 0x02, 0x00,
+    0x08, 0x01, 0x04, 0x09, 0x00, 0xf0, 0x0a, 0x01, 0x02, 0x09, 0x00, 0x20, 0x23, 0x00, 0xfd, 0xff,
+    0x85, 0x00, 0x03, 0x00, 0x0a, 0x05, 0x08, 0x0a, 0x00, 0xf0, 0x0e, 0x05, 0x04, 0x05, 0x00, 0x20,
+    0x0a, 0x0a, 0x04, 0x05, 0x00, 0x20, 0x04, 0x01, 0x11, 0x00, 0x82, 0xff, 0x02, 0x00, 0x06, 0x04,
+    0x0c, 0x0d, 0x00, 0xf0, 0x0a, 0x04, 0x04, 0x0d, 0x00, 0x30, 0x8e, 0xff, 0xae, 0x00, 0x14, 0x00,
+    0x02, 0x00, 0x0d, 0x05, 0x06, 0x06, 0x00, 0xf0, 0x0d, 0x05, 0x03, 0x06, 0x00, 0x20, 0xc8, 0x00,
+    0xcc, 0xff, 0x80, 0x00, 0x02, 0x00, 0x01, 0x05, 0x0c, 0x03, 0x00, 0xf0, 0x07, 0x05, 0x06, 0x03,
+    0x00, 0x20, 0xc3, 0xfc, 0xa9, 0x00, 0x88, 0xff, 0xb6, 0x00, 0x6b, 0xff, 0x02, 0x00, 0x07, 0x05,
+    0x0a, 0x06, 0x00, 0xf0, 0x07, 0x07, 0x0a, 0x02, 0x00, 0x30, 0xfc, 0x01, 0xa2, 0xff, 0x99, 0x00,
+    0x02, 0x00, 0x02, 0x00, 0x15, 0x05, 0x00, 0xf0, 0x09, 0x00, 0x07, 0x05, 0x00, 0x30, 0x20, 0x00,
+    0x24, 0xff, 0x37, 0x00, 0x02, 0x00, 0x00, 0x08, 0x09, 0x09, 0x00, 0xf0, 0x00, 0x0b, 0x09, 0x03,
+    0x00, 0x30, 0x7c, 0x00, 0xbb, 0xff, 0x9c, 0x00, 0x02, 0x00, 0x09, 0x06, 0x06, 0x09, 0x00, 0xf0,
+    0x0b, 0x06, 0x02, 0x09, 0x00, 0x30, 0x67, 0x00, 0xa8, 0xff, 0x81, 0x00, 0x02, 0x00, 0x00, 0x03,
+    0x06, 0x07, 0x00, 0xf0, 0x03, 0x03, 0x03, 0x07, 0x00, 0x20, 0x29, 0x00, 0xaf, 0xff, 0x69, 0x00,
+    0x03, 0x00, 0x09, 0x12, 0x0c, 0x06, 0x00, 0xf0, 0x0f, 0x12, 0x06, 0x03, 0x00, 0x20, 0x09, 0x15,
+    0x06, 0x03, 0x00, 0x20, 0xbc, 0xff, 0x50, 0xff, 0x18, 0x00, 0x03, 0x00, 0x02, 0x08, 0x14, 0x06,
+    0x00, 0xf0, 0x02, 0x08, 0x0a, 0x03, 0x00, 0x20, 0x0c, 0x0b, 0x0a, 0x03, 0x00, 0x20, 0xf5, 0xff,
+    0xcb, 0xff, 0x3c, 0x00, 0x02, 0x00, 0x0d, 0x02, 0x0a, 0x04, 0x00, 0xf0, 0x0d, 0x04, 0x0a, 0x02,
+    0x00, 0x20, 0xad, 0x00, 0x82, 0xff, 0x2e, 0x00, 0x02, 0x00, 0x04, 0x05, 0x05, 0x12, 0x00, 0xf0,
+    0x04, 0x0b, 0x05, 0x06, 0x00, 0x30, 0x3a, 0xff, 0x57, 0x01, 0x0a, 0x00, 0x02, 0x00, 0x14, 0x04,
+    0x04, 0x09, 0x00, 0xf0, 0x14, 0x04, 0x02, 0x09, 0x00, 0x20, 0x76, 0x00, 0x0b, 0x00, 0x2f, 0xff,
+    0x02, 0x00, 0x08, 0x06, 0x08, 0x0e, 0x00, 0xf0, 0x08, 0x0d, 0x08, 0x07, 0x00, 0x20, 0x5c, 0xff,
+    0x4a, 0xff, 0x39, 0x00, 0x03, 0x00, 0x00, 0x01, 0x18, 0x06, 0x00, 0xf0, 0x0c, 0x01, 0x0c, 0x03,
+    0x00, 0x20, 0x00, 0x04, 0x0c, 0x03, 0x00, 0x20, 0x58, 0xff, 0x01, 0x01, 0xce, 0xff, 0x02, 0x00,
+    0x00, 0x04, 0x04, 0x09, 0x00, 0xf0, 0x02, 0x04, 0x02, 0x09, 0x00, 0x20, 0x30, 0x00, 0xfd, 0xff,
+    0xce, 0x00, 0x02, 0x00, 0x03, 0x06, 0x12, 0x03, 0x00, 0xf0, 0x03, 0x07, 0x12, 0x01, 0x00, 0x30,
+    0xa9, 0xff, 0x2f, 0xff, 0x05, 0x00, 0x02, 0x00, 0x03, 0x11, 0x10, 0x06, 0x00, 0xf0, 0x03, 0x13,
+    0x10, 0x02, 0x00, 0x30, 0x9f, 0xff, 0x8a, 0x00, 0xed, 0xff, 0x02, 0x00, 0x0d, 0x06, 0x06, 0x09,
+    0x00, 0xf0, 0x0d, 0x09, 0x06, 0x03, 0x00, 0x30, 0x49, 0x00, 0xaa, 0xff, 0x6c, 0x00, 0x03, 0x00,
+    0x05, 0x06, 0x0e, 0x06, 0x00, 0xf0, 0x05, 0x06, 0x07, 0x03, 0x00, 0x20, 0x0c, 0x09, 0x07, 0x03,
+    0x00, 0x20, 0x4e, 0xff, 0xce, 0xfe, 0x27, 0x00, 0x03, 0x00, 0x0d, 0x05, 0x08, 0x0a, 0x00, 0xf0,
+    0x11, 0x05, 0x04, 0x05, 0x00, 0x20, 0x0d, 0x0a, 0x04, 0x05, 0x00, 0x20, 0xdb, 0xff, 0x1d, 0xff,
+    0x02, 0x00, 0x02, 0x00, 0x02, 0x02, 0x14, 0x03, 0x00, 0xf0, 0x02, 0x03, 0x14, 0x01, 0x00, 0x30,
+    0xc2, 0x00, 0x2a, 0x00, 0x18, 0xff, 0x02, 0x00, 0x09, 0x02, 0x09, 0x06, 0x00, 0xf0, 0x0c, 0x02,
+    0x03, 0x06, 0x00, 0x30, 0xc6, 0xff, 0xa0, 0x00, 0xbe, 0xff, 0x02, 0x00, 0x08, 0x06, 0x06, 0x09,
+    0x00, 0xf0, 0x0a, 0x06, 0x02, 0x09, 0x00, 0x30, 0x0f, 0x00, 0xb8, 0xff, 0x44, 0x00, 0x02, 0x00,
+    0x0c, 0x03, 0x04, 0x0b, 0x00, 0xf0, 0x0c, 0x03, 0x02, 0x0b, 0x00, 0x20, 0x0e, 0x00, 0x5d, 0xff,
+    0x19, 0x00, 0x02, 0x00, 0x08, 0x03, 0x04, 0x0b, 0x00, 0xf0, 0x0a, 0x03, 0x02, 0x0b, 0x00, 0x20,
+    0x89, 0xff, 0x3c, 0xff, 0x39, 0x00, 0x03, 0x00, 0x08, 0x03, 0x08, 0x0a, 0x00, 0xf0, 0x0c, 0x03,
+    0x04, 0x05, 0x00, 0x20, 0x08, 0x08, 0x04, 0x05, 0x00, 0x20, 0xe6, 0xff, 0x74, 0x00, 0xbd, 0xff,
+    0x02, 0x00, 0x0b, 0x01, 0x02, 0x12, 0x00, 0xf0, 0x0c, 0x01, 0x01, 0x12, 0x00, 0x20, 0x85, 0xff,
+    0x3d, 0xff, 0x23, 0x00, 0x02, 0x00, 0x09, 0x02, 0x09, 0x06, 0x00, 0xf0, 0x0c, 0x02, 0x03, 0x06,
+    0x00, 0x30, 0x20, 0x00, 0x0b, 0x00, 0x47, 0xff, 0x02, 0x00, 0x00, 0x02, 0x13, 0x03, 0x00, 0xf0,
+    0x00, 0x03, 0x13, 0x01, 0x00, 0x30, 0x24, 0x00, 0xf4, 0xff, 0x83, 0x00, 0x02, 0x00, 0x09, 0x0e,
+    0x09, 0x06, 0x00, 0xf0, 0x09, 0x10, 0x09, 0x02, 0x00, 0x30, 0x89, 0x01, 0xfb, 0xff, 0xeb, 0xfe,
+    0x02, 0x00, 0x01, 0x08, 0x12, 0x05, 0x00, 0xf0, 0x07, 0x08, 0x06, 0x05, 0x00, 0x30, 0x7a, 0xff,
+    0x0b, 0xff, 0x25, 0x00, 0x02, 0x00, 0x0c, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x0e, 0x00, 0x02, 0x09,
+    0x00, 0x30, 0xca, 0xff, 0x4d, 0xff, 0x07, 0x00, 0x02, 0x00, 0x06, 0x00, 0x06, 0x09, 0x00, 0xf0,
+    0x08, 0x00, 0x02, 0x09, 0x00, 0x30, 0x3e, 0x00, 0xb8, 0xff, 0x40, 0x00, 0x02, 0x00, 0x0d, 0x06,
+    0x04, 0x0f, 0x00, 0xf0, 0x0d, 0x0b, 0x04, 0x05, 0x00, 0x30, 0x31, 0x00, 0xc0, 0xff, 0x77, 0x00,
+    0x02, 0x00, 0x01, 0x05, 0x12, 0x03, 0x00, 0xf0, 0x01, 0x06, 0x12, 0x01, 0x00, 0x30, 0xc8, 0xfe,
+    0x4e, 0xff, 0x21, 0x00, 0x02, 0x00, 0x09, 0x07, 0x0e, 0x06, 0x00, 0xf0, 0x09, 0x09, 0x0e, 0x02,
+    0x00, 0x30, 0xcf, 0xff, 0x75, 0x00, 0xc3, 0xff, 0x02, 0x00, 0x02, 0x10, 0x12, 0x03, 0x00, 0xf0,
+    0x02, 0x11, 0x12, 0x01, 0x00, 0x30, 0x59, 0x00, 0x2e, 0x00, 0x63, 0xff, 0x02, 0x00, 0x0f, 0x11,
+    0x09, 0x06, 0x00, 0xf0, 0x0f, 0x13, 0x09, 0x02, 0x00, 0x30, 0xf5, 0xff, 0x5f, 0xff, 0x08, 0x00,
+    0x03, 0x00, 0x00, 0x08, 0x0c, 0x06, 0x00, 0xf0, 0x00, 0x08, 0x06, 0x03, 0x00, 0x20, 0x06, 0x0b,
+    0x06, 0x03, 0x00, 0x20, 0x39, 0xff, 0xf9, 0xfe, 0x2c, 0x00, 0x02, 0x00, 0x09, 0x0d, 0x07, 0x08,
+    0x00, 0xf0, 0x09, 0x11, 0x07, 0x04, 0x00, 0x20, 0xd6, 0xff, 0x58, 0x00, 0xba, 0xff, 0x02, 0x00,
+    0x02, 0x11, 0x14, 0x03, 0x00, 0xf0, 0x02, 0x12, 0x14, 0x01, 0x00, 0x30, 0xe5, 0xff, 0xb6, 0xff,
+    0x3d, 0x00, 0x02, 0x00, 0x0f, 0x11, 0x09, 0x06, 0x00, 0xf0, 0x0f, 0x13, 0x09, 0x02, 0x00, 0x30,
+    0x23, 0x00, 0x8f, 0xff, 0x24, 0x00, 0x02, 0x00, 0x04, 0x00, 0x0f, 0x04, 0x00, 0xf0, 0x04, 0x02,
+    0x0f, 0x02, 0x00, 0x20, 0x51, 0x00, 0x2d, 0x00, 0xc3, 0xff, 0x02, 0x00, 0x11, 0x02, 0x06, 0x06,
+    0x00, 0xf0, 0x11, 0x05, 0x06, 0x03, 0x00, 0x20, 0x5a, 0x00, 0xfe, 0xff, 0x0e, 0xff, 0x02, 0x00,
+    0x00, 0x03, 0x06, 0x09, 0x00, 0xf0, 0x00, 0x06, 0x06, 0x03, 0x00, 0x30, 0x2b, 0xff, 0xa7, 0x01,
+    0x18, 0x00, 0x02, 0x00, 0x0f, 0x11, 0x09, 0x06, 0x00, 0xf0, 0x0f, 0x13, 0x09, 0x02, 0x00, 0x30,
+    0x50, 0x00, 0xff, 0xff, 0x24, 0xff, 0x02, 0x00, 0x00, 0x11, 0x09, 0x06, 0x00, 0xf0, 0x00, 0x13,
+    0x09, 0x02, 0x00, 0x30, 0x5e, 0x00, 0x00, 0x00, 0x62, 0x00, 0x03, 0x00, 0x09, 0x12, 0x0c, 0x06,
+    0x00, 0xf0, 0x0f, 0x12, 0x06, 0x03, 0x00, 0x20, 0x09, 0x15, 0x06, 0x03, 0x00, 0x20, 0xc3, 0xff,
+    0x62, 0xff, 0x07, 0x00, 0x02, 0x00, 0x03, 0x0f, 0x06, 0x09, 0x00, 0xf0, 0x03, 0x12, 0x06, 0x03,
+    0x00, 0x30, 0x34, 0xff, 0xb4, 0x00, 0x0c, 0x00, 0x03, 0x00, 0x10, 0x0d, 0x08, 0x0a, 0x00, 0xf0,
+    0x14, 0x0d, 0x04, 0x05, 0x00, 0x20, 0x10, 0x12, 0x04, 0x05, 0x00, 0x20, 0xe5, 0xfe, 0x64, 0x00,
+    0xc3, 0xff, 0x02, 0x00, 0x00, 0x0e, 0x18, 0x04, 0x00, 0xf0, 0x08, 0x0e, 0x08, 0x04, 0x00, 0x30,
+    0x13, 0x00, 0xfa, 0xff, 0x40, 0x00, 0x02, 0x00, 0x0d, 0x12, 0x06, 0x06, 0x00, 0xf0, 0x0d, 0x12,
+    0x03, 0x06, 0x00, 0x20, 0x76, 0xff, 0x78, 0x00, 0xc5, 0xff, 0x03, 0x00, 0x00, 0x0d, 0x08, 0x0a,
+    0x00, 0xf0, 0x00, 0x0d, 0x04, 0x05, 0x00, 0x20, 0x04, 0x12, 0x04, 0x05, 0x00, 0x20, 0xbe, 0xff,
+    0x52, 0x00, 0xcc, 0xff, 0x02, 0x00, 0x00, 0x0e, 0x18, 0x06, 0x00, 0xf0, 0x00, 0x11, 0x18, 0x03,
+    0x00, 0x20, 0x33, 0xff, 0xc6, 0xfe, 0xf6, 0xff, 0x03, 0x00, 0x05, 0x02, 0x0c, 0x08, 0x00, 0xf0,
+    0x05, 0x02, 0x06, 0x04, 0x00, 0x20, 0x0b, 0x06, 0x06, 0x04, 0x00, 0x20, 0xe9, 0x00, 0x0b, 0x00,
+    0x9a, 0x00, 0x02, 0x00, 0x08, 0x09, 0x09, 0x06, 0x00, 0xf0, 0x0b, 0x09, 0x03, 0x06, 0x00, 0x30,
+    0xa7, 0x00, 0xd6, 0xff, 0xe5, 0x00, 0x02, 0x00, 0x04, 0x03, 0x10, 0x04, 0x00, 0xf0, 0x04, 0x05,
+    0x10, 0x02, 0x00, 0x20, 0xf4, 0xff, 0x56, 0x00, 0xbb, 0xff, 0x02, 0x00, 0x0a, 0x02, 0x04, 0x0a,
+    0x00, 0xf0, 0x0a, 0x07, 0x04, 0x05, 0x00, 0x20, 0x7b, 0xff, 0x26, 0xff, 0x05, 0x00, 0x02, 0x00,
+    0x08, 0x04, 0x05, 0x08, 0x00, 0xf0, 0x08, 0x08, 0x05, 0x04, 0x00, 0x20, 0x93, 0x01, 0x0e, 0x00,
+    0xa3, 0x00, 0x02, 0x00, 0x0b, 0x05, 0x09, 0x0c, 0x00, 0xf0, 0x0b, 0x09, 0x09, 0x04, 0x00, 0x30,
+    0x64, 0xff, 0x85, 0x00, 0xc5, 0xff, 0x02, 0x00, 0x04, 0x05, 0x09, 0x0c, 0x00, 0xf0, 0x04, 0x09,
+    0x09, 0x04, 0x00, 0x30, 0x44, 0xff, 0xa0, 0x00, 0x08, 0x00, 0x02, 0x00, 0x0e, 0x06, 0x06, 0x09,
+    0x00, 0xf0, 0x0e, 0x09, 0x06, 0x03, 0x00, 0x30, 0x17, 0xfe, 0x63, 0xff, 0x08, 0x00, 0x02, 0x00,
+    0x02, 0x04, 0x14, 0x0c, 0x00, 0xf0, 0x02, 0x08, 0x14, 0x04, 0x00, 0x30, 0x13, 0xfe, 0x28, 0xff,
+    0x2a, 0x00, 0x02, 0x00, 0x04, 0x04, 0x11, 0x10, 0x00, 0xf0, 0x04, 0x0c, 0x11, 0x08, 0x00, 0x20,
+    0x21, 0x01, 0xf0, 0xff, 0x04, 0xfe, 0x02, 0x00, 0x08, 0x07, 0x07, 0x06, 0x00, 0xf0, 0x08, 0x0a,
+    0x07, 0x03, 0x00, 0x20, 0x22, 0x00, 0xd3, 0xff, 0x61, 0x00, 0x02, 0x00, 0x01, 0x09, 0x17, 0x02,
+    0x00, 0xf0, 0x01, 0x0a, 0x17, 0x01, 0x00, 0x20, 0x5d, 0x00, 0xf9, 0xff, 0x15, 0xff, 0x02, 0x00,
+    0x07, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x09, 0x00, 0x02, 0x09, 0x00, 0x30, 0x02, 0x00, 0xc2, 0xff,
+    0x3a, 0x00, 0x02, 0x00, 0x0d, 0x03, 0x04, 0x09, 0x00, 0xf0, 0x0d, 0x03, 0x02, 0x09, 0x00, 0x20,
+    0x8d, 0x00, 0xc4, 0xff, 0x8a, 0x00, 0x02, 0x00, 0x08, 0x01, 0x06, 0x0d, 0x00, 0xf0, 0x0a, 0x01,
+    0x02, 0x0d, 0x00, 0x30, 0xee, 0xff, 0x64, 0x00, 0xe0, 0xff, 0x02, 0x00, 0x04, 0x16, 0x12, 0x02,
+    0x00, 0xf0, 0x04, 0x17, 0x12, 0x01, 0x00, 0x20, 0x60, 0x00, 0xbc, 0xff, 0x52, 0x00, 0x02, 0x00,
+    0x03, 0x0a, 0x09, 0x06, 0x00, 0xf0, 0x06, 0x0a, 0x03, 0x06, 0x00, 0x30, 0x34, 0x00, 0x2c, 0x00,
+    0x65, 0xff, 0x02, 0x00, 0x0e, 0x00, 0x02, 0x18, 0x00, 0xf0, 0x0e, 0x00, 0x01, 0x18, 0x00, 0x20,
+    0xd2, 0xff, 0xeb, 0xfe, 0xf9, 0xff, 0x02, 0x00, 0x08, 0x00, 0x02, 0x18, 0x00, 0xf0, 0x09, 0x00,
+    0x01, 0x18, 0x00, 0x20, 0x56, 0xff, 0xb8, 0x00, 0x07, 0x00, 0x02, 0x00, 0x03, 0x02, 0x12, 0x0a,
+    0x00, 0xf0, 0x09, 0x02, 0x06, 0x0a, 0x00, 0x30, 0x82, 0xfe, 0xd0, 0xfe, 0xf5, 0xff, 0x02, 0x00,
+    0x04, 0x0d, 0x0f, 0x06, 0x00, 0xf0, 0x09, 0x0d, 0x05, 0x06, 0x00, 0x30, 0x91, 0xff, 0xa1, 0x00,
+    0x02, 0x00, 0x02, 0x00, 0x03, 0x15, 0x12, 0x03, 0x00, 0xf0, 0x09, 0x15, 0x06, 0x03, 0x00, 0x30,
+    0xa7, 0xff, 0x52, 0x01, 0xda, 0xff, 0x02, 0x00, 0x09, 0x01, 0x04, 0x0b, 0x00, 0xf0, 0x0b, 0x01,
+    0x02, 0x0b, 0x00, 0x20, 0xd9, 0xff, 0xaa, 0xff, 0x2b, 0x00, 0x02, 0x00, 0x09, 0x07, 0x0a, 0x04,
+    0x00, 0xf0, 0x09, 0x07, 0x05, 0x04, 0x00, 0x20, 0x1c, 0x01, 0xbf, 0xff, 0x79, 0x00, 0x02, 0x00,
+    0x07, 0x00, 0x0a, 0x12, 0x00, 0xf0, 0x0c, 0x00, 0x05, 0x12, 0x00, 0x20, 0x7f, 0x00, 0x24, 0x00,
+    0xa7, 0xff, 0x02, 0x00, 0x0c, 0x01, 0x06, 0x10, 0x00, 0xf0, 0x0e, 0x01, 0x02, 0x10, 0x00, 0x30,
+    0x35, 0xff, 0xd6, 0xfe, 0xf6, 0xff, 0x02, 0x00, 0x06, 0x01, 0x06, 0x10, 0x00, 0xf0, 0x08, 0x01,
+    0x02, 0x10, 0x00, 0x30, 0xad, 0xff, 0x9b, 0xff, 0x28, 0x00, 0x02, 0x00, 0x12, 0x02, 0x06, 0x06,
+    0x00, 0xf0, 0x12, 0x05, 0x06, 0x03, 0x00, 0x20, 0xc2, 0xff, 0x7e, 0x00, 0xcd, 0xff, 0x02, 0x00,
+    0x03, 0x05, 0x12, 0x02, 0x00, 0xf0, 0x03, 0x06, 0x12, 0x01, 0x00, 0x20, 0x31, 0xff, 0xdf, 0x01,
+    0x16, 0x00, 0x02, 0x00, 0x12, 0x02, 0x06, 0x06, 0x00, 0xf0, 0x12, 0x05, 0x06, 0x03, 0x00, 0x20,
+    0xac, 0xff, 0x1d, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x02, 0x06, 0x06, 0x00, 0xf0, 0x00, 0x05,
+    0x06, 0x03, 0x00, 0x20, 0x82, 0xff, 0xd6, 0xfe, 0x24, 0x00, 0x02, 0x00, 0x0d, 0x0b, 0x0b, 0x06,
+    0x00, 0xf0, 0x0d, 0x0d, 0x0b, 0x02, 0x00, 0x30, 0xee, 0xff, 0x55, 0xff, 0x01, 0x00, 0x02, 0x00,
+    0x05, 0x07, 0x0a, 0x04, 0x00, 0xf0, 0x0a, 0x07, 0x05, 0x04, 0x00, 0x20, 0x45, 0xff, 0x86, 0xff,
+    0x26, 0x00, 0x02, 0x00, 0x0b, 0x09, 0x0a, 0x07, 0x00, 0xf0, 0x0b, 0x09, 0x05, 0x07, 0x00, 0x20,
+    0x44, 0x00, 0x1e, 0x00, 0x8d, 0xff, 0x02, 0x00, 0x03, 0x09, 0x0a, 0x07, 0x00, 0xf0, 0x08, 0x09,
+    0x05, 0x07, 0x00, 0x20, 0x0d, 0x00, 0xed, 0xff, 0x47, 0x00, 0x02, 0x00, 0x10, 0x04, 0x06, 0x06,
+    0x00, 0xf0, 0x10, 0x04, 0x03, 0x06, 0x00, 0x20, 0x64, 0x00, 0xcd, 0xff, 0xac, 0x00, 0x03, 0x00,
+    0x05, 0x06, 0x0a, 0x08, 0x00, 0xf0, 0x05, 0x06, 0x05, 0x04, 0x00, 0x20, 0x0a, 0x0a, 0x05, 0x04,
+    0x00, 0x20, 0xba, 0xfe, 0xec, 0x00, 0x17, 0x00, 0x02, 0x00, 0x07, 0x15, 0x10, 0x03, 0x00, 0xf0,
+    0x07, 0x15, 0x08, 0x03, 0x00, 0x20, 0xb6, 0x00, 0xbc, 0xff, 0x55, 0x00, 0x02, 0x00, 0x01, 0x15,
+    0x10, 0x03, 0x00, 0xf0, 0x09, 0x15, 0x08, 0x03, 0x00, 0x20, 0xff, 0xfd, 0x76, 0xff, 0x23, 0x00,
+    0x03, 0x00, 0x02, 0x05, 0x16, 0x0e, 0x00, 0xf0, 0x0d, 0x05, 0x0b, 0x07, 0x00, 0x20, 0x02, 0x0c,
+    0x0b, 0x07, 0x00, 0x20, 0x49, 0x00, 0x04, 0x00, 0x52, 0xff, 0x03, 0x00, 0x03, 0x0a, 0x08, 0x0a,
+    0x00, 0xf0, 0x03, 0x0a, 0x04, 0x05, 0x00, 0x20, 0x07, 0x0f, 0x04, 0x05, 0x00, 0x20, 0x4e, 0x00,
+    0xfd, 0xff, 0x8a, 0x00, 0x03, 0x00, 0x11, 0x00, 0x06, 0x0c, 0x00, 0xf0, 0x14, 0x00, 0x03, 0x06,
+    0x00, 0x20, 0x11, 0x06, 0x03, 0x06, 0x00, 0x20, 0xa3, 0x00, 0xd3, 0xff, 0xc9, 0x00, 0x02, 0x00,
+    0x05, 0x02, 0x06, 0x12, 0x00, 0xf0, 0x07, 0x02, 0x02, 0x12, 0x00, 0x30, 0x37, 0x00, 0x35, 0x00,
+    0x86, 0xff, 0x02, 0x00, 0x0d, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x0f, 0x00, 0x02, 0x09, 0x00, 0x30,
+    0x42, 0x00, 0x05, 0x00, 0x64, 0xff, 0x02, 0x00, 0x00, 0x0c, 0x07, 0x09, 0x00, 0xf0, 0x00, 0x0f,
+    0x07, 0x03, 0x00, 0x30, 0x2d, 0x00, 0xfc, 0xff, 0x6a, 0x00, 0x03, 0x00, 0x0f, 0x0d, 0x08, 0x0a,
+    0x00, 0xf0, 0x13, 0x0d, 0x04, 0x05, 0x00, 0x20, 0x0f, 0x12, 0x04, 0x05, 0x00, 0x20, 0xa0, 0x00,
+    0xd0, 0xff, 0xbd, 0x00, 0x03, 0x00, 0x01, 0x00, 0x06, 0x0c, 0x00, 0xf0, 0x01, 0x00, 0x03, 0x06,
+    0x00, 0x20, 0x04, 0x06, 0x03, 0x06, 0x00, 0x20, 0xd9, 0xff, 0x68, 0x00, 0xde, 0xff, 0x02, 0x00,
+    0x0c, 0x01, 0x03, 0x0c, 0x00, 0xf0, 0x0c, 0x07, 0x03, 0x06, 0x00, 0x20, 0x72, 0x00, 0xcc, 0xff,
+    0x9d, 0x00, 0x03, 0x00, 0x01, 0x0d, 0x08, 0x0a, 0x00, 0xf0, 0x01, 0x0d, 0x04, 0x05, 0x00, 0x20,
+    0x05, 0x12, 0x04, 0x05, 0x00, 0x20, 0xa0, 0xff, 0x4e, 0xfe, 0x25, 0x00, 0x02, 0x00, 0x03, 0x15,
+    0x13, 0x02, 0x00, 0xf0, 0x03, 0x16, 0x13, 0x01, 0x00, 0x20, 0x6e, 0x00, 0xf9, 0xff, 0xe9, 0xfe,
+    0x02, 0x00, 0x06, 0x03, 0x04, 0x0d, 0x00, 0xf0, 0x08, 0x03, 0x02, 0x0d, 0x00, 0x20, 0x01, 0x00,
+    0xcd, 0xff, 0x39, 0x00, 0x02, 0x00, 0x05, 0x0a, 0x12, 0x03, 0x00, 0xf0, 0x05, 0x0b, 0x12, 0x01,
+    0x00, 0x30, 0x58, 0xff, 0x8d, 0xff, 0x0e, 0x00, 0x02, 0x00, 0x09, 0x03, 0x05, 0x0c, 0x00, 0xf0,
+    0x09, 0x07, 0x05, 0x04, 0x00, 0x30, 0x1b, 0x00, 0x3c, 0x00, 0xca, 0xff, 0x02, 0x00, 0x0b, 0x02,
+    0x04, 0x0f, 0x00, 0xf0, 0x0b, 0x07, 0x04, 0x05, 0x00, 0x30, 0xc4, 0x00, 0xd2, 0xff, 0x9e, 0x00,
+    0x02, 0x00, 0x04, 0x01, 0x10, 0x04, 0x00, 0xf0, 0x04, 0x03, 0x10, 0x02, 0x00, 0x20, 0xf4, 0xff,
+    0xba, 0xff, 0x40, 0x00, 0x02, 0x00, 0x06, 0x00, 0x12, 0x03, 0x00, 0xf0, 0x06, 0x01, 0x12, 0x01,
+    0x00, 0x30, 0xdd, 0xff, 0x8a, 0xff, 0x0a, 0x00, 0x03, 0x00, 0x05, 0x01, 0x0a, 0x08, 0x00, 0xf0,
+    0x05, 0x01, 0x05, 0x04, 0x00, 0x20, 0x0a, 0x05, 0x05, 0x04, 0x00, 0x20, 0xe2, 0xff, 0x6a, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0x0b, 0x12, 0x0c, 0x06, 0x00, 0xf0, 0x11, 0x12, 0x06, 0x03, 0x00, 0x20,
+    0x0b, 0x15, 0x06, 0x03, 0x00, 0x20, 0xf9, 0xff, 0x25, 0x00, 0xaa, 0xff, 0x02, 0x00, 0x05, 0x0f,
+    0x0c, 0x03, 0x00, 0xf0, 0x0b, 0x0f, 0x06, 0x03, 0x00, 0x20, 0x9f, 0xfe, 0xc0, 0x00, 0x02, 0x00,
+    0x02, 0x00, 0x01, 0x0a, 0x16, 0x04, 0x00, 0xf0, 0x01, 0x0a, 0x0b, 0x04, 0x00, 0x20, 0xbf, 0x00,
+    0xd0, 0xff, 0x7b, 0x00, 0x02, 0x00, 0x07, 0x09, 0x09, 0x06, 0x00, 0xf0, 0x0a, 0x09, 0x03, 0x06,
+    0x00, 0x30, 0x00, 0x00, 0x5a, 0x00, 0xd4, 0xff, 0x02, 0x00, 0x06, 0x0b, 0x0c, 0x05, 0x00, 0xf0,
+    0x0a, 0x0b, 0x04, 0x05, 0x00, 0x30, 0xbe, 0xff, 0x5c, 0xff, 0x02, 0x00, 0x02, 0x00, 0x06, 0x07,
+    0x0a, 0x07, 0x00, 0xf0, 0x0b, 0x07, 0x05, 0x07, 0x00, 0x20, 0xbb, 0x00, 0x04, 0x00, 0x51, 0x00,
+    0x02, 0x00, 0x0b, 0x02, 0x08, 0x0a, 0x00, 0xf0, 0x0b, 0x02, 0x04, 0x0a, 0x00, 0x20, 0x90, 0xff,
+    0x0e, 0x01, 0xd4, 0xff, 0x02, 0x00, 0x05, 0x02, 0x08, 0x0a, 0x00, 0xf0, 0x09, 0x02, 0x04, 0x0a,
+    0x00, 0x20, 0x8f, 0xff, 0x4c, 0x00, 0xfe, 0xff, 0x03, 0x00, 0x06, 0x04, 0x12, 0x06, 0x00, 0xf0,
+    0x0f, 0x04, 0x09, 0x03, 0x00, 0x20, 0x06, 0x07, 0x09, 0x03, 0x00, 0x20, 0x1f, 0x00, 0xc9, 0xff,
+    0x79, 0x00, 0x02, 0x00, 0x00, 0x05, 0x0a, 0x09, 0x00, 0xf0, 0x00, 0x08, 0x0a, 0x03, 0x00, 0x30,
+    0xfe, 0xff, 0x3d, 0x00, 0xbc, 0xff, 0x02, 0x00, 0x02, 0x07, 0x15, 0x06, 0x00, 0xf0, 0x02, 0x09,
+    0x15, 0x02, 0x00, 0x30, 0xc4, 0x01, 0xf8, 0xff, 0xfb, 0xfe, 0x03, 0x00, 0x00, 0x04, 0x16, 0x10,
+    0x00, 0xf0, 0x00, 0x04, 0x0b, 0x08, 0x00, 0x20, 0x0b, 0x0c, 0x0b, 0x08, 0x00, 0x20, 0x19, 0x01,
+    0xff, 0xff, 0x92, 0x00, 0x02, 0x00, 0x09, 0x00, 0x06, 0x16, 0x00, 0xf0, 0x09, 0x0b, 0x06, 0x0b,
+    0x00, 0x20, 0x07, 0x00, 0x13, 0x00, 0x95, 0xff, 0x02, 0x00, 0x09, 0x01, 0x03, 0x0c, 0x00, 0xf0,
+    0x09, 0x07, 0x03, 0x06, 0x00, 0x20, 0x13, 0x03, 0x14, 0x00, 0xe1, 0x02, 0x03, 0x00, 0x0c, 0x00,
+    0x0c, 0x12, 0x00, 0xf0, 0x12, 0x00, 0x06, 0x09, 0x00, 0x20, 0x0c, 0x09, 0x06, 0x09, 0x00, 0x20,
+    0x84, 0x02, 0xdd, 0xff, 0x16, 0x02, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x12, 0x00, 0xf0, 0x00, 0x00,
+    0x06, 0x09, 0x00, 0x20, 0x06, 0x09, 0x06, 0x09, 0x00, 0x20, 0x36, 0xff, 0x24, 0xfe, 0x24, 0x00,
+    0x03, 0x00, 0x01, 0x01, 0x16, 0x04, 0x00, 0xf0, 0x0c, 0x01, 0x0b, 0x02, 0x00, 0x20, 0x01, 0x03,
+    0x0b, 0x02, 0x00, 0x20, 0xd4, 0x00, 0xd1, 0xff, 0x8a, 0x00, 0x02, 0x00, 0x03, 0x00, 0x12, 0x04,
+    0x00, 0xf0, 0x03, 0x02, 0x12, 0x02, 0x00, 0x20, 0xcc, 0x00, 0x24, 0x00, 0x70, 0xfe, 0x02, 0x00,
+    0x02, 0x05, 0x16, 0x06, 0x00, 0xf0, 0x02, 0x07, 0x16, 0x02, 0x00, 0x30, 0x52, 0xff, 0x9b, 0x01,
+    0xdb, 0xff, 0x02, 0x00, 0x05, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x05, 0x03, 0x06, 0x03, 0x00, 0x30,
+    0x67, 0xff, 0x31, 0xff, 0x21, 0x00, 0x02, 0x00, 0x0a, 0x0e, 0x06, 0x09, 0x00, 0xf0, 0x0c, 0x0e,
+    0x02, 0x09, 0x00, 0x30, 0x68, 0xff, 0x9c, 0xfe, 0xf2, 0xff, 0x02, 0x00, 0x08, 0x0e, 0x06, 0x09,
+    0x00, 0xf0, 0x0a, 0x0e, 0x02, 0x09, 0x00, 0x30, 0x39, 0x00, 0x08, 0x00, 0x93, 0x00, 0x02, 0x00,
+    0x05, 0x12, 0x12, 0x03, 0x00, 0xf0, 0x05, 0x13, 0x12, 0x01, 0x00, 0x30, 0xff, 0xff, 0x73, 0xff,
+    0x05, 0x00, 0x02, 0x00, 0x06, 0x00, 0x06, 0x0d, 0x00, 0xf0, 0x09, 0x00, 0x03, 0x0d, 0x00, 0x20,
+    0x83, 0x00, 0x05, 0x00, 0x5f, 0x00, 0x02, 0x00, 0x07, 0x04, 0x0c, 0x04, 0x00, 0xf0, 0x07, 0x04,
+    0x06, 0x04, 0x00, 0x20, 0xef, 0xff, 0x71, 0x00, 0xc6, 0xff, 0x02, 0x00, 0x05, 0x02, 0x0c, 0x06,
+    0x00, 0xf0, 0x09, 0x02, 0x04, 0x06, 0x00, 0x30, 0x28, 0x00, 0x2e, 0x00, 0x98, 0xff, 0x02, 0x00,
+    0x04, 0x01, 0x12, 0x03, 0x00, 0xf0, 0x04, 0x02, 0x12, 0x01, 0x00, 0x30, 0x7e, 0x01, 0xf0, 0xff,
+    0x4f, 0xfe, 0x02, 0x00, 0x00, 0x08, 0x06, 0x0c, 0x00, 0xf0, 0x00, 0x0c, 0x06, 0x04, 0x00, 0x30,
+    0x46, 0x00, 0x33, 0x00, 0x8b, 0xff, 0x02, 0x00, 0x09, 0x0f, 0x06, 0x09, 0x00, 0xf0, 0x0b, 0x0f,
+    0x02, 0x09, 0x00, 0x30, 0x22, 0x00, 0xaf, 0xff, 0x27, 0x00, 0x02, 0x00, 0x09, 0x0a, 0x06, 0x0d,
+    0x00, 0xf0, 0x0b, 0x0a, 0x02, 0x0d, 0x00, 0x30, 0xc7, 0xff, 0xde, 0x00, 0x08, 0x00, 0x02, 0x00,
+    0x06, 0x11, 0x12, 0x02, 0x00, 0xf0, 0x06, 0x12, 0x12, 0x01, 0x00, 0x20, 0xe1, 0xff, 0xa3, 0x00,
+    0xd1, 0xff, 0x02, 0x00, 0x09, 0x04, 0x06, 0x09, 0x00, 0xf0, 0x0b, 0x04, 0x02, 0x09, 0x00, 0x30,
+    0x72, 0x00, 0x2c, 0x00, 0x86, 0xff, 0x02, 0x00, 0x0a, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x0c, 0x00,
+    0x02, 0x09, 0x00, 0x30, 0xb3, 0xff, 0x3d, 0x00, 0xbd, 0xff, 0x03, 0x00, 0x05, 0x06, 0x0a, 0x08,
+    0x00, 0xf0, 0x05, 0x06, 0x05, 0x04, 0x00, 0x20, 0x0a, 0x0a, 0x05, 0x04, 0x00, 0x20, 0xb4, 0xff,
+    0x8a, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x0e, 0x09, 0x05, 0x08, 0x00, 0xf0, 0x0e, 0x0d, 0x05, 0x04,
+    0x00, 0x20, 0x6b, 0xff, 0x64, 0x02, 0xde, 0xff, 0x02, 0x00, 0x05, 0x09, 0x05, 0x08, 0x00, 0xf0,
+    0x05, 0x0d, 0x05, 0x04, 0x00, 0x20, 0x84, 0x00, 0x28, 0x00, 0x53, 0xff, 0x02, 0x00, 0x0e, 0x0b,
+    0x09, 0x06, 0x00, 0xf0, 0x0e, 0x0d, 0x09, 0x02, 0x00, 0x30, 0xf4, 0x00, 0x00, 0x00, 0x45, 0xff,
+    0x02, 0x00, 0x00, 0x02, 0x17, 0x0f, 0x00, 0xf0, 0x00, 0x07, 0x17, 0x05, 0x00, 0x30, 0x28, 0x00,
+    0xe3, 0xff, 0x4e, 0x00, 0x02, 0x00, 0x10, 0x00, 0x08, 0x0c, 0x00, 0xf0, 0x10, 0x06, 0x08, 0x06,
+    0x00, 0x20, 0x70, 0xff, 0xf3, 0xfe, 0xf8, 0xff, 0x02, 0x00, 0x04, 0x0f, 0x06, 0x09, 0x00, 0xf0,
+    0x04, 0x12, 0x06, 0x03, 0x00, 0x30, 0x0b, 0x00, 0xcd, 0xff, 0x53, 0x00, 0x02, 0x00, 0x08, 0x12,
+    0x09, 0x04, 0x00, 0xf0, 0x08, 0x14, 0x09, 0x02, 0x00, 0x20, 0x21, 0x00, 0xca, 0xff, 0x6f, 0x00,
+    0x02, 0x00, 0x00, 0x11, 0x12, 0x03, 0x00, 0xf0, 0x00, 0x12, 0x12, 0x01, 0x00, 0x30, 0x6c, 0x01,
+    0x1c, 0x00, 0x3e, 0xfb, 0x02, 0x00, 0x0d, 0x0b, 0x0b, 0x06, 0x00, 0xf0, 0x0d, 0x0d, 0x0b, 0x02,
+    0x00, 0x30, 0x85, 0xff, 0x49, 0xfe, 0xf1, 0xff, 0x02, 0x00, 0x00, 0x0b, 0x0b, 0x06, 0x00, 0xf0,
+    0x00, 0x0d, 0x0b, 0x02, 0x00, 0x30, 0xa7, 0xff, 0xa5, 0x00, 0xf8, 0xff, 0x03, 0x00, 0x00, 0x09,
+    0x18, 0x06, 0x00, 0xf0, 0x0c, 0x09, 0x0c, 0x03, 0x00, 0x20, 0x00, 0x0c, 0x0c, 0x03, 0x00, 0x20,
+    0x9a, 0x00, 0xfe, 0xff, 0x3c, 0xff, 0x02, 0x00, 0x06, 0x10, 0x08, 0x08, 0x00, 0xf0, 0x06, 0x14,
+    0x08, 0x04, 0x00, 0x20, 0x0b, 0x00, 0x32, 0x00, 0xeb, 0xff, 0x02, 0x00, 0x0a, 0x10, 0x0e, 0x06,
+    0x00, 0xf0, 0x0a, 0x12, 0x0e, 0x02, 0x00, 0x30, 0xd5, 0xff, 0x23, 0xff, 0xfa, 0xff, 0x02, 0x00,
+    0x01, 0x01, 0x15, 0x03, 0x00, 0xf0, 0x01, 0x02, 0x15, 0x01, 0x00, 0x30, 0x13, 0x02, 0x23, 0x00,
+    0xc6, 0xfd, 0x02, 0x00, 0x00, 0x02, 0x18, 0x03, 0x00, 0xf0, 0x00, 0x02, 0x0c, 0x03, 0x00, 0x20,
+    0xb8, 0xff, 0x56, 0x00, 0xc3, 0xff, 0x02, 0x00, 0x02, 0x0f, 0x08, 0x05, 0x00, 0xf0, 0x06, 0x0f,
+    0x04, 0x05, 0x00, 0x20, 0xc5, 0xfe, 0x80, 0xfd, 0x20, 0x00, 0x02, 0x00, 0x02, 0x0b, 0x15, 0x03,
+    0x00, 0xf0, 0x09, 0x0b, 0x07, 0x03, 0x00, 0x30, 0xb2, 0xff, 0x81, 0x00, 0xce, 0xff, 0x03, 0x00,
+    0x01, 0x12, 0x0c, 0x06, 0x00, 0xf0, 0x01, 0x12, 0x06, 0x03, 0x00, 0x20, 0x07, 0x15, 0x06, 0x03,
+    0x00, 0x20, 0x2f, 0xff, 0x12, 0xfd, 0x23, 0x00, 0x02, 0x00, 0x0a, 0x0e, 0x04, 0x0a, 0x00, 0xf0,
+    0x0a, 0x13, 0x04, 0x05, 0x00, 0x20, 0x08, 0x00, 0x67, 0xff, 0x07, 0x00, 0x02, 0x00, 0x07, 0x07,
+    0x04, 0x0a, 0x00, 0xf0, 0x07, 0x0c, 0x04, 0x05, 0x00, 0x20, 0x68, 0x00, 0x56, 0x00, 0xdc, 0xff,
+    0x02, 0x00, 0x09, 0x08, 0x06, 0x0c, 0x00, 0xf0, 0x09, 0x0c, 0x06, 0x04, 0x00, 0x30, 0x9f, 0xff,
+    0xe5, 0xfe, 0xf4, 0xff, 0x02, 0x00, 0x07, 0x01, 0x09, 0x06, 0x00, 0xf0, 0x0a, 0x01, 0x03, 0x06,
+    0x00, 0x30, 0xe6, 0xff, 0x72, 0x00, 0xef, 0xff, 0x02, 0x00, 0x03, 0x0e, 0x13, 0x02, 0x00, 0xf0,
+    0x03, 0x0f, 0x13, 0x01, 0x00, 0x20, 0x66, 0xff, 0xf6, 0xfe, 0xf6, 0xff, 0x03, 0x00, 0x07, 0x07,
+    0x0a, 0x0a, 0x00, 0xf0, 0x07, 0x07, 0x05, 0x05, 0x00, 0x20, 0x0c, 0x0c, 0x05, 0x05, 0x00, 0x20,
+    0x76, 0x03, 0x08, 0x00, 0xd1, 0x00, 0x02, 0x00, 0x03, 0x0c, 0x12, 0x0c, 0x00, 0xf0, 0x03, 0x0c,
+    0x09, 0x0c, 0x00, 0x20, 0xca, 0xff, 0x87, 0x00, 0xd0, 0xff, 0x02, 0x00, 0x08, 0x00, 0x06, 0x0c,
+    0x00, 0xf0, 0x0a, 0x00, 0x02, 0x0c, 0x00, 0x30, 0xcb, 0xfc, 0xc4, 0x00, 0x23, 0x01, 0x77, 0xff,
+    0x9b, 0x00, 0x02, 0x00, 0x03, 0x00, 0x11, 0x09, 0x00, 0xf0, 0x03, 0x03, 0x11, 0x03, 0x00, 0x30,
+    0xe5, 0x00, 0x80, 0xff, 0x70, 0x00, 0x02, 0x00, 0x06, 0x00, 0x0c, 0x0b, 0x00, 0xf0, 0x0a, 0x00,
+    0x04, 0x0b, 0x00, 0x30, 0xa5, 0x00, 0xac, 0xff, 0x8c, 0x00, 0x02, 0x00, 0x01, 0x00, 0x06, 0x0d,
+    0x00, 0xf0, 0x04, 0x00, 0x03, 0x0d, 0x00, 0x20, 0x02, 0x01, 0xaf, 0xff, 0x76, 0x00, 0x02, 0x00,
+    0x05, 0x08, 0x10, 0x06, 0x00, 0xf0, 0x05, 0x0b, 0x10, 0x03, 0x00, 0x20, 0x2a, 0x00, 0x1b, 0x00,
+    0x05, 0xff, 0x02, 0x00, 0x08, 0x08, 0x05, 0x0c, 0x00, 0xf0, 0x08, 0x0e, 0x05, 0x06, 0x00, 0x20,
+    0x00, 0x01, 0xdc, 0xff, 0xb6, 0x00, 0x02, 0x00, 0x03, 0x15, 0x12, 0x03, 0x00, 0xf0, 0x09, 0x15,
+    0x06, 0x03, 0x00, 0x30, 0x5f, 0xff, 0xf1, 0x00, 0xc9, 0xff, 0x02, 0x00, 0x00, 0x00, 0x06, 0x06,
+    0x00, 0xf0, 0x03, 0x00, 0x03, 0x06, 0x00, 0x20, 0xea, 0xff, 0x75, 0xff, 0x40, 0x00, 0x02, 0x00,
+    0x02, 0x00, 0x14, 0x03, 0x00, 0xf0, 0x02, 0x01, 0x14, 0x01, 0x00, 0x30, 0xb9, 0x01, 0x03, 0x00,
+    0xec, 0xfe, 0x02, 0x00, 0x04, 0x06, 0x0f, 0x0a, 0x00, 0xf0, 0x09, 0x06, 0x05, 0x0a, 0x00, 0x30,
+    0x45, 0x00, 0xb0, 0xff, 0x83, 0x00, 0x02, 0x00, 0x09, 0x06, 0x06, 0x09, 0x00, 0xf0, 0x0b, 0x06,
+    0x02, 0x09, 0x00, 0x30, 0x7f, 0x00, 0xff, 0xff, 0xc2, 0xfe, 0x02, 0x00, 0x09, 0x00, 0x06, 0x09,
+    0x00, 0xf0, 0x0b, 0x00, 0x02, 0x09, 0x00, 0x30, 0xa2, 0xff, 0x3d, 0xff, 0x34, 0x00, 0x02, 0x00,
+    0x0e, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x10, 0x00, 0x02, 0x09, 0x00, 0x30, 0xd3, 0xff, 0x3d, 0x00,
+    0xa7, 0xff, 0x02, 0x00, 0x07, 0x10, 0x09, 0x06, 0x00, 0xf0, 0x07, 0x12, 0x09, 0x02, 0x00, 0x30,
+    0xed, 0xff, 0xe8, 0xff, 0x34, 0x00, 0x02, 0x00, 0x0e, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x10, 0x00,
+    0x02, 0x09, 0x00, 0x30, 0xb9, 0xff, 0x36, 0xff, 0x05, 0x00, 0x02, 0x00, 0x04, 0x00, 0x06, 0x09,
+    0x00, 0xf0, 0x06, 0x00, 0x02, 0x09, 0x00, 0x30, 0x4d, 0x00, 0xe6, 0xff, 0x8c, 0x00, 0x02, 0x00,
+    0x11, 0x01, 0x06, 0x10, 0x00, 0xf0, 0x13, 0x01, 0x02, 0x10, 0x00, 0x30, 0x1d, 0x00, 0x99, 0xff,
+    0x44, 0x00, 0x02, 0x00, 0x01, 0x01, 0x06, 0x10, 0x00, 0xf0, 0x03, 0x01, 0x02, 0x10, 0x00, 0x30,
+    0x4d, 0x00, 0x34, 0x00, 0xfb, 0xfe, 0x02, 0x00, 0x0e, 0x0d, 0x06, 0x09, 0x00, 0xf0, 0x0e, 0x10,
+    0x06, 0x03, 0x00, 0x30, 0x7f, 0x00, 0x00, 0x00, 0x21, 0xff, 0x02, 0x00, 0x00, 0x00, 0x06, 0x09,
+    0x00, 0xf0, 0x00, 0x03, 0x06, 0x03, 0x00, 0x30, 0x55, 0x00, 0xff, 0xff, 0xcd, 0x00, 0x02, 0x00,
+    0x09, 0x05, 0x06, 0x06, 0x00, 0xf0, 0x09, 0x05, 0x03, 0x06, 0x00, 0x20, 0x2e, 0x00, 0xa3, 0xff,
+    0x3a, 0x00, 0x02, 0x00, 0x03, 0x0a, 0x09, 0x06, 0x00, 0xf0, 0x06, 0x0a, 0x03, 0x06, 0x00, 0x30,
+    0x17, 0xff, 0x93, 0xfe, 0x24, 0x00, 0x02, 0x00, 0x0e, 0x07, 0x03, 0x10, 0x00, 0xf0, 0x0e, 0x0f,
+    0x03, 0x08, 0x00, 0x20, 0x27, 0x01, 0xf6, 0xff, 0x17, 0xfe, 0x03, 0x00, 0x04, 0x0a, 0x0e, 0x0c,
+    0x00, 0xf0, 0x04, 0x0a, 0x07, 0x06, 0x00, 0x20, 0x0b, 0x10, 0x07, 0x06, 0x00, 0x20, 0xaf, 0xff,
+    0x43, 0x00, 0xad, 0xff, 0x02, 0x00, 0x07, 0x06, 0x0c, 0x06, 0x00, 0xf0, 0x07, 0x08, 0x0c, 0x02,
+    0x00, 0x30, 0xbc, 0xff, 0x2a, 0xff, 0x00, 0x00, 0x02, 0x00, 0x07, 0x02, 0x04, 0x14, 0x00, 0xf0,
+    0x09, 0x02, 0x02, 0x14, 0x00, 0x20, 0x5d, 0xff, 0x83, 0xff, 0x2a, 0x00, 0x02, 0x00, 0x0e, 0x0d,
+    0x06, 0x09, 0x00, 0xf0, 0x0e, 0x10, 0x06, 0x03, 0x00, 0x30, 0x6e, 0x00, 0xd0, 0xff, 0xd5, 0x00,
+    0x02, 0x00, 0x0a, 0x06, 0x04, 0x09, 0x00, 0xf0, 0x0c, 0x06, 0x02, 0x09, 0x00, 0x20, 0xf0, 0xff,
+    0x3b, 0x00, 0xee, 0xff, 0x02, 0x00, 0x0e, 0x0d, 0x06, 0x09, 0x00, 0xf0, 0x0e, 0x10, 0x06, 0x03,
+    0x00, 0x30, 0x5d, 0x00, 0xf7, 0xff, 0xd9, 0xfe, 0x02, 0x00, 0x05, 0x14, 0x0e, 0x04, 0x00, 0xf0,
+    0x05, 0x16, 0x0e, 0x02, 0x00, 0x20, 0xe6, 0xfe, 0x38, 0xfe, 0x26, 0x00, 0x02, 0x00, 0x04, 0x04,
+    0x10, 0x0c, 0x00, 0xf0, 0x04, 0x0a, 0x10, 0x06, 0x00, 0x20, 0xb0, 0x00, 0xc9, 0xff, 0x81, 0x00,
+    0x02, 0x00, 0x09, 0x06, 0x06, 0x09, 0x00, 0xf0, 0x0b, 0x06, 0x02, 0x09, 0x00, 0x30, 0x23, 0x00,
+    0xd3, 0xff, 0x4a, 0x00, 0x02, 0x00, 0x03, 0x00, 0x15, 0x04, 0x00, 0xf0, 0x03, 0x02, 0x15, 0x02,
+    0x00, 0x20, 0x3b, 0x00, 0xfe, 0xff, 0x1c, 0xff, 0x02, 0x00, 0x04, 0x0d, 0x06, 0x09, 0x00, 0xf0,
+    0x04, 0x10, 0x06, 0x03, 0x00, 0x30, 0xd1, 0xff, 0x4d, 0x00, 0xf5, 0xff, 0x02, 0x00, 0x10, 0x10,
+    0x05, 0x08, 0x00, 0xf0, 0x10, 0x14, 0x05, 0x04, 0x00, 0x20, 0x3f, 0xfe, 0x0d, 0xff, 0xfb, 0xff,
+    0x03, 0x00, 0x04, 0x00, 0x10, 0x10, 0x00, 0xf0, 0x04, 0x00, 0x08, 0x08, 0x00, 0x20, 0x0c, 0x08,
+    0x08, 0x08, 0x00, 0x20, 0xb9, 0x00, 0x08, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x06, 0x06, 0x0e, 0x06,
+    0x00, 0xf0, 0x0d, 0x06, 0x07, 0x03, 0x00, 0x20, 0x06, 0x09, 0x07, 0x03, 0x00, 0x20, 0x92, 0xff,
+    0xfa, 0x00, 0xd4, 0xff, 0x02, 0x00, 0x0a, 0x05, 0x04, 0x0f, 0x00, 0xf0, 0x0a, 0x0a, 0x04, 0x05,
+    0x00, 0x30, 0x49, 0x00, 0xfb, 0xff, 0x46, 0x00, 0x03, 0x00, 0x09, 0x0f, 0x0c, 0x08, 0x00, 0xf0,
+    0x0f, 0x0f, 0x06, 0x04, 0x00, 0x20, 0x09, 0x13, 0x06, 0x04, 0x00, 0x20, 0xce, 0x00, 0xf2, 0xff,
+    0x39, 0xfe, 0x02, 0x00, 0x06, 0x07, 0x0c, 0x04, 0x00, 0xf0, 0x0c, 0x07, 0x06, 0x04, 0x00, 0x20,
+    0x86, 0xff, 0xa7, 0x00, 0xfa, 0xff, 0x03, 0x00, 0x05, 0x06, 0x0e, 0x06, 0x00, 0xf0, 0x0c, 0x06,
+    0x07, 0x03, 0x00, 0x20, 0x05, 0x09, 0x07, 0x03, 0x00, 0x20, 0x9b, 0x00, 0x06, 0x00, 0x4c, 0xff,
+    0x03, 0x00, 0x03, 0x06, 0x12, 0x0a, 0x00, 0xf0, 0x03, 0x06, 0x09, 0x05, 0x00, 0x20, 0x0c, 0x0b,
+    0x09, 0x05, 0x00, 0x20, 0xf8, 0x02, 0xff, 0xff, 0x54, 0x00, 0x02, 0x00, 0x06, 0x00, 0x12, 0x15,
+    0x00, 0xf0, 0x0c, 0x00, 0x06, 0x15, 0x00, 0x30, 0xf0, 0xff, 0x57, 0x00, 0xb3, 0xff, 0x02, 0x00,
+    0x00, 0x00, 0x18, 0x15, 0x00, 0xf0, 0x08, 0x00, 0x08, 0x15, 0x00, 0x30, 0x29, 0x00, 0xff, 0xff,
+    0x94, 0x00, 0x02, 0x00, 0x06, 0x12, 0x12, 0x03, 0x00, 0xf0, 0x06, 0x13, 0x12, 0x01, 0x00, 0x30,
+    0xd1, 0xff, 0x7a, 0xff, 0x0b, 0x00, 0x02, 0x00, 0x00, 0x0f, 0x09, 0x06, 0x00, 0xf0, 0x00, 0x11,
+    0x09, 0x02, 0x00, 0x30, 0xe6, 0xff, 0x6b, 0xff, 0x30, 0x00, 0x02, 0x00, 0x04, 0x03, 0x13, 0x02,
+    0x00, 0xf0, 0x04, 0x04, 0x13, 0x01, 0x00, 0x20, 0x2b, 0x00, 0x05, 0x00, 0x50, 0xff, 0x02, 0x00,
+    0x00, 0x03, 0x18, 0x02, 0x00, 0xf0, 0x00, 0x04, 0x18, 0x01, 0x00, 0x20, 0xad, 0xff, 0xa3, 0xff,
+    0x27, 0x00, 0x02, 0x00, 0x0f, 0x0e, 0x09, 0x04, 0x00, 0xf0, 0x0f, 0x10, 0x09, 0x02, 0x00, 0x20,
+    0x09, 0x00, 0x09, 0x00, 0x67, 0xff, 0x02, 0x00, 0x00, 0x0e, 0x09, 0x04, 0x00, 0xf0, 0x00, 0x10,
+    0x09, 0x02, 0x00, 0x20, 0xfa, 0xff, 0xdb, 0xff, 0x60, 0x00, 0x02, 0x00, 0x06, 0x0f, 0x12, 0x02,
+    0x00, 0xf0, 0x06, 0x10, 0x12, 0x01, 0x00, 0x20, 0x23, 0x00, 0xc9, 0xff, 0x84, 0x00, 0x02, 0x00,
+    0x03, 0x11, 0x12, 0x03, 0x00, 0xf0, 0x03, 0x12, 0x12, 0x01, 0x00, 0x30, 0x9d, 0xff, 0xeb, 0xfe,
+    0x24, 0x00, 0x02, 0x00, 0x0c, 0x00, 0x03, 0x17, 0x00, 0xf0, 0x0d, 0x00, 0x01, 0x17, 0x00, 0x30,
+    0x30, 0x01, 0xd9, 0xff, 0x2e, 0x01, 0x02, 0x00, 0x06, 0x00, 0x08, 0x06, 0x00, 0xf0, 0x06, 0x03,
+    0x08, 0x03, 0x00, 0x20, 0x45, 0x00, 0x0b, 0x00, 0xea, 0x00, 0x02, 0x00, 0x06, 0x10, 0x12, 0x03,
+    0x00, 0xf0, 0x06, 0x11, 0x12, 0x01, 0x00, 0x30, 0x9c, 0xff, 0x74, 0xfe, 0xf2, 0xff, 0x02, 0x00,
+    0x09, 0x00, 0x03, 0x17, 0x00, 0xf0, 0x0a, 0x00, 0x01, 0x17, 0x00, 0x30, 0x7b, 0x00, 0x2a, 0x00,
+    0x00, 0xff, 0x02, 0x00, 0x0a, 0x07, 0x04, 0x0a, 0x00, 0xf0, 0x0a, 0x0c, 0x04, 0x05, 0x00, 0x20,
+    0x31, 0x00, 0x3b, 0xff, 0xff, 0xff, 0x02, 0x00, 0x07, 0x08, 0x0a, 0x0c, 0x00, 0xf0, 0x07, 0x0c,
+    0x0a, 0x04, 0x00, 0x30, 0x63, 0x01, 0x1c, 0x00, 0x51, 0xfe, 0x03, 0x00, 0x0e, 0x09, 0x06, 0x0e,
+    0x00, 0xf0, 0x11, 0x09, 0x03, 0x07, 0x00, 0x20, 0x0e, 0x10, 0x03, 0x07, 0x00, 0x20, 0x53, 0xff,
+    0x1b, 0x01, 0xd9, 0xff, 0x02, 0x00, 0x02, 0x00, 0x0a, 0x09, 0x00, 0xf0, 0x02, 0x03, 0x0a, 0x03,
+    0x00, 0x30, 0xf6, 0xff, 0x46, 0x00, 0xd1, 0xff, 0x02, 0x00, 0x0b, 0x01, 0x05, 0x0c, 0x00, 0xf0,
+    0x0b, 0x07, 0x05, 0x06, 0x00, 0x20, 0x18, 0xff, 0x32, 0xff, 0xfc, 0xff, 0x03, 0x00, 0x01, 0x04,
+    0x0c, 0x0a, 0x00, 0xf0, 0x01, 0x04, 0x06, 0x05, 0x00, 0x20, 0x07, 0x09, 0x06, 0x05, 0x00, 0x20,
+    0x60, 0x00, 0x24, 0x00, 0xbf, 0xff, 0x02, 0x00, 0x0f, 0x01, 0x09, 0x04, 0x00, 0xf0, 0x0f, 0x03,
+    0x09, 0x02, 0x00, 0x20, 0xab, 0xff, 0x32, 0x00, 0xb1, 0xff, 0x03, 0x00, 0x01, 0x02, 0x08, 0x0a,
+    0x00, 0xf0, 0x01, 0x02, 0x04, 0x05, 0x00, 0x20, 0x05, 0x07, 0x04, 0x05, 0x00, 0x20, 0x1d, 0x00,
+    0xf4, 0xff, 0x6b, 0x00, 0x02, 0x00, 0x0a, 0x01, 0x05, 0x0c, 0x00, 0xf0, 0x0a, 0x05, 0x05, 0x04,
+    0x00, 0x30, 0x77, 0x05, 0xd6, 0xff, 0xed, 0x00, 0x02, 0x00, 0x04, 0x00, 0x0e, 0x18, 0x00, 0xf0,
+    0x0b, 0x00, 0x07, 0x18, 0x00, 0x20, 0x19, 0x00, 0xe0, 0xff, 0x67, 0x00, 0x02, 0x00, 0x07, 0x11,
+    0x0a, 0x04, 0x00, 0xf0, 0x07, 0x13, 0x0a, 0x02, 0x00, 0x20, 0x85, 0x00, 0xf8, 0xff, 0x03, 0xff,
+    0x02, 0x00, 0x0a, 0x0e, 0x04, 0x0a, 0x00, 0xf0, 0x0a, 0x13, 0x04, 0x05, 0x00, 0x20, 0x00, 0x00,
+    0xf0, 0xff, 0x41, 0x00, 0x02, 0x00, 0x0d, 0x0f, 0x06, 0x09, 0x00, 0xf0, 0x0f, 0x0f, 0x02, 0x09,
+    0x00, 0x30, 0x02, 0x00, 0xa3, 0xff, 0x1e, 0x00, 0x02, 0x00, 0x03, 0x15, 0x12, 0x03, 0x00, 0xf0,
+    0x03, 0x16, 0x12, 0x01, 0x00, 0x30, 0xdf, 0x00, 0x1e, 0x00, 0xf9, 0xfe, 0x02, 0x00, 0x0d, 0x0f,
+    0x06, 0x09, 0x00, 0xf0, 0x0f, 0x0f, 0x02, 0x09, 0x00, 0x30, 0xd7, 0xff, 0x7b, 0xff, 0x08, 0x00,
+    0x02, 0x00, 0x05, 0x0f, 0x06, 0x09, 0x00, 0xf0, 0x07, 0x0f, 0x02, 0x09, 0x00, 0x30, 0xb3, 0xff,
+    0xa6, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0a, 0x06, 0x04, 0x12, 0x00, 0xf0, 0x0c, 0x06, 0x02, 0x09,
+    0x00, 0x20, 0x0a, 0x0f, 0x02, 0x09, 0x00, 0x20, 0xeb, 0xff, 0x2c, 0x00, 0xa9, 0xff, 0x02, 0x00,
+    0x07, 0x03, 0x06, 0x0b, 0x00, 0xf0, 0x09, 0x03, 0x02, 0x0b, 0x00, 0x30, 0xd4, 0xff, 0xce, 0xff,
+    0x26, 0x00, 0x02, 0x00, 0x0f, 0x01, 0x09, 0x04, 0x00, 0xf0, 0x0f, 0x03, 0x09, 0x02, 0x00, 0x20,
+    0x34, 0xff, 0x7e, 0xff, 0x07, 0x00, 0x02, 0x00, 0x05, 0x04, 0x0e, 0x08, 0x00, 0xf0, 0x05, 0x08,
+    0x0e, 0x04, 0x00, 0x20, 0x31, 0x00, 0xef, 0xff, 0x2f, 0x00, 0x02, 0x00, 0x08, 0x01, 0x0f, 0x09,
+    0x00, 0xf0, 0x08, 0x04, 0x0f, 0x03, 0x00, 0x30, 0xf7, 0xff, 0x98, 0xff, 0x14, 0x00, 0x03, 0x00,
+    0x07, 0x02, 0x08, 0x0a, 0x00, 0xf0, 0x07, 0x02, 0x04, 0x05, 0x00, 0x20, 0x0b, 0x07, 0x04, 0x05,
+    0x00, 0x20, 0x0c, 0x00, 0xca, 0xff, 0x39, 0x00, 0x02, 0x00, 0x0c, 0x02, 0x06, 0x0c, 0x00, 0xf0,
+    0x0c, 0x02, 0x03, 0x0c, 0x00, 0x20, 0x10, 0x00, 0x81, 0xff, 0x10, 0x00, 0x02, 0x00, 0x06, 0x02,
+    0x06, 0x0c, 0x00, 0xf0, 0x09, 0x02, 0x03, 0x0c, 0x00, 0x20, 0xe2, 0xff, 0xcc, 0xff, 0x38, 0x00,
+    0x02, 0x00, 0x07, 0x07, 0x0c, 0x04, 0x00, 0xf0, 0x07, 0x07, 0x06, 0x04, 0x00, 0x20, 0xd4, 0x00,
+    0x2e, 0x00, 0x91, 0xff, 0x02, 0x00, 0x06, 0x03, 0x0c, 0x0a, 0x00, 0xf0, 0x0a, 0x03, 0x04, 0x0a,
+    0x00, 0x30, 0x4b, 0x00, 0x03, 0x00, 0x61, 0x00, 0x03, 0x00, 0x05, 0x06, 0x10, 0x06, 0x00, 0xf0,
+    0x0d, 0x06, 0x08, 0x03, 0x00, 0x20, 0x05, 0x09, 0x08, 0x03, 0x00, 0x20, 0xcc, 0x02, 0xcb, 0xff,
+    0x66, 0x00, 0x02, 0x00, 0x03, 0x01, 0x12, 0x09, 0x00, 0xf0, 0x09, 0x01, 0x06, 0x09, 0x00, 0x30,
+    0xdd, 0x00, 0x3f, 0x00, 0xbc, 0xff, 0x02, 0x00, 0x03, 0x08, 0x12, 0x05, 0x00, 0xf0, 0x09, 0x08,
+    0x06, 0x05, 0x00, 0x30, 0xe0, 0xfa, 0x18, 0xfe, 0xef, 0xff, 0x03, 0x00, 0x00, 0x00, 0x18, 0x16,
+    0x00, 0xf0, 0x00, 0x00, 0x0c, 0x0b, 0x00, 0x20, 0x0c, 0x0b, 0x0c, 0x0b, 0x00, 0x20, 0x92, 0xff,
+    0x4a, 0xff, 0x28, 0x00, 0x02, 0x00, 0x0e, 0x10, 0x09, 0x06, 0x00, 0xf0, 0x0e, 0x12, 0x09, 0x02,
+    0x00, 0x30, 0x3d, 0x01, 0xd5, 0xff, 0xc6, 0x00, 0x02, 0x00, 0x00, 0x10, 0x18, 0x08, 0x00, 0xf0,
+    0x00, 0x14, 0x18, 0x04, 0x00, 0x20, 0x61, 0x00, 0x30, 0x00, 0x66, 0xff, 0x03, 0x00, 0x01, 0x13,
+    0x16, 0x04, 0x00, 0xf0, 0x0c, 0x13, 0x0b, 0x02, 0x00, 0x20, 0x01, 0x15, 0x0b, 0x02, 0x00, 0x20,
+    0x2f, 0x00, 0x01, 0x00, 0x62, 0xff, 0x02, 0x00, 0x01, 0x10, 0x09, 0x06, 0x00, 0xf0, 0x01, 0x12,
+    0x09, 0x02, 0x00, 0x30, 0x85, 0x00, 0x2b, 0x00, 0x4b, 0xff, 0x02, 0x00, 0x07, 0x08, 0x0a, 0x04,
+    0x00, 0xf0, 0x07, 0x08, 0x05, 0x04, 0x00, 0x20, 0x4b, 0xff, 0xbe, 0xfd, 0xee, 0xff, 0x02, 0x00,
+    0x09, 0x0f, 0x06, 0x09, 0x00, 0xf0, 0x0b, 0x0f, 0x02, 0x09, 0x00, 0x30, 0x11, 0xff, 0x68, 0x02,
+    0x15, 0x00, 0x03, 0x00, 0x0a, 0x12, 0x0c, 0x06, 0x00, 0xf0, 0x10, 0x12, 0x06, 0x03, 0x00, 0x20,
+    0x0a, 0x15, 0x06, 0x03, 0x00, 0x20, 0x4f, 0x00, 0xbb, 0xff, 0x46, 0x00, 0x03, 0x00, 0x02, 0x12,
+    0x0c, 0x06, 0x00, 0xf0, 0x02, 0x12, 0x06, 0x03, 0x00, 0x20, 0x08, 0x15, 0x06, 0x03, 0x00, 0x20,
+    0x49, 0xff, 0x50, 0x00, 0xf1, 0xff, 0x02, 0x00, 0x08, 0x03, 0x10, 0x09, 0x00, 0xf0, 0x08, 0x06,
+    0x10, 0x03, 0x00, 0x30, 0x09, 0xff, 0x8d, 0xfe, 0xf1, 0xff, 0x02, 0x00, 0x00, 0x05, 0x0a, 0x06,
+    0x00, 0xf0, 0x00, 0x07, 0x0a, 0x02, 0x00, 0x30, 0x2f, 0x00, 0xfc, 0xff, 0x81, 0x00, 0x02, 0x00,
+    0x05, 0x05, 0x12, 0x03, 0x00, 0xf0, 0x05, 0x06, 0x12, 0x01, 0x00, 0x30, 0x72, 0x00, 0xc5, 0xff,
+    0x4e, 0x00, 0x02, 0x00, 0x02, 0x06, 0x09, 0x06, 0x00, 0xf0, 0x02, 0x09, 0x09, 0x03, 0x00, 0x20,
+    0x0b, 0x01, 0x24, 0x00, 0x80, 0xff, 0x02, 0x00, 0x0e, 0x02, 0x0a, 0x09, 0x00, 0xf0, 0x0e, 0x05,
+    0x0a, 0x03, 0x00, 0x30, 0x27, 0x00, 0xc8, 0xff, 0x64, 0x00, 0x02, 0x00, 0x03, 0x06, 0x12, 0x03,
+    0x00, 0xf0, 0x03, 0x07, 0x12, 0x01, 0x00, 0x30, 0x0a, 0x00, 0xe3, 0xff, 0x33, 0x00, 0x02, 0x00,
+    0x09, 0x02, 0x0f, 0x06, 0x00, 0xf0, 0x09, 0x04, 0x0f, 0x02, 0x00, 0x30, 0x82, 0x00, 0x06, 0x00,
+    0x78, 0xff, 0x02, 0x00, 0x04, 0x08, 0x0f, 0x06, 0x00, 0xf0, 0x04, 0x0a, 0x0f, 0x02, 0x00, 0x30,
+    0x87, 0x00, 0x2d, 0x00, 0x60, 0xff, 0x03, 0x00, 0x00, 0x05, 0x18, 0x04, 0x00, 0xf0, 0x0c, 0x05,
+    0x0c, 0x02, 0x00, 0x20, 0x00, 0x07, 0x0c, 0x02, 0x00, 0x20, 0xc2, 0x00, 0xdb, 0xff, 0x6b, 0x01,
+    0x02, 0x00, 0x07, 0x08, 0x06, 0x0c, 0x00, 0xf0, 0x09, 0x08, 0x02, 0x0c, 0x00, 0x30, 0xb0, 0xff,
+    0x7a, 0xff, 0x28, 0x00, 0x02, 0x00, 0x0b, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x0d, 0x00, 0x02, 0x09,
+    0x00, 0x30, 0x20, 0xff, 0xe1, 0x00, 0xd6, 0xff, 0x03, 0x00, 0x00, 0x0c, 0x06, 0x0c, 0x00, 0xf0,
+    0x00, 0x0c, 0x03, 0x06, 0x00, 0x20, 0x03, 0x12, 0x03, 0x06, 0x00, 0x20, 0xa4, 0xff, 0x85, 0xff,
+    0x26, 0x00, 0x02, 0x00, 0x0e, 0x0c, 0x0a, 0x06, 0x00, 0xf0, 0x0e, 0x0e, 0x0a, 0x02, 0x00, 0x30,
+    0xb6, 0x01, 0xca, 0xff, 0x6c, 0x00, 0x02, 0x00, 0x02, 0x07, 0x12, 0x09, 0x00, 0xf0, 0x02, 0x0a,
+    0x12, 0x03, 0x00, 0x30, 0x6b, 0xff, 0xee, 0xff, 0x25, 0x00, 0x02, 0x00, 0x0b, 0x0e, 0x0a, 0x09,
+    0x00, 0xf0, 0x0b, 0x11, 0x0a, 0x03, 0x00, 0x30, 0x39, 0x00, 0xc1, 0xff, 0x44, 0x00, 0x03, 0x00,
+    0x07, 0x06, 0x0a, 0x08, 0x00, 0xf0, 0x07, 0x06, 0x05, 0x04, 0x00, 0x20, 0x0c, 0x0a, 0x05, 0x04,
+    0x00, 0x20, 0x55, 0x00, 0x02, 0x00, 0x6e, 0x00, 0x03, 0x00, 0x06, 0x06, 0x0e, 0x06, 0x00, 0xf0,
+    0x0d, 0x06, 0x07, 0x03, 0x00, 0x20, 0x06, 0x09, 0x07, 0x03, 0x00, 0x20, 0xc9, 0x00, 0xd3, 0xff,
+    0xb1, 0x00, 0x02, 0x00, 0x04, 0x0d, 0x09, 0x07, 0x00, 0xf0, 0x07, 0x0d, 0x03, 0x07, 0x00, 0x30,
+    0x94, 0x00, 0x21, 0x00, 0xaa, 0xff, 0x03, 0x00, 0x0e, 0x0a, 0x06, 0x0c, 0x00, 0xf0, 0x11, 0x0a,
+    0x03, 0x06, 0x00, 0x20, 0x0e, 0x10, 0x03, 0x06, 0x00, 0x20, 0xa8, 0x00, 0xf5, 0xff, 0xa6, 0xfe,
+    0x03, 0x00, 0x04, 0x0a, 0x06, 0x0c, 0x00, 0xf0, 0x04, 0x0a, 0x03, 0x06, 0x00, 0x20, 0x07, 0x10,
+    0x03, 0x06, 0x00, 0x20, 0x40, 0x00, 0x2c, 0x00, 0xf1, 0xff, 0x02, 0x00, 0x0d, 0x09, 0x08, 0x06,
+    0x00, 0xf0, 0x0d, 0x09, 0x04, 0x06, 0x00, 0x20, 0xbe, 0xff, 0xdf, 0xfe, 0xf6, 0xff, 0x02, 0x00,
+    0x08, 0x03, 0x04, 0x0e, 0x00, 0xf0, 0x0a, 0x03, 0x02, 0x0e, 0x00, 0x20, 0xf4, 0xff, 0xc7, 0xff,
+    0x3c, 0x00, 0x02, 0x00, 0x11, 0x00, 0x03, 0x12, 0x00, 0xf0, 0x12, 0x00, 0x01, 0x12, 0x00, 0x30,
+    0xcc, 0xfd, 0x74, 0x00, 0xca, 0xff, 0x02, 0x00, 0x04, 0x0c, 0x10, 0x0c, 0x00, 0xf0, 0x0c, 0x0c,
+    0x08, 0x0c, 0x00, 0x20, 0xd9, 0xff, 0xda, 0xff, 0x35, 0x00, 0x02, 0x00, 0x0f, 0x00, 0x06, 0x0e,
+    0x00, 0xf0, 0x11, 0x00, 0x02, 0x0e, 0x00, 0x30, 0x9b, 0xff, 0x52, 0xff, 0xfe, 0xff, 0x02, 0x00,
+    0x03, 0x00, 0x06, 0x0e, 0x00, 0xf0, 0x05, 0x00, 0x02, 0x0e, 0x00, 0x30, 0xc5, 0xfd, 0xa6, 0x00,
+    0x0b, 0x00, 0x02, 0x00, 0x0c, 0x02, 0x0c, 0x14, 0x00, 0xf0, 0x10, 0x02, 0x04, 0x14, 0x00, 0x30,
+    0xb0, 0xfe, 0x72, 0x00, 0xc4, 0xff, 0x02, 0x00, 0x00, 0x02, 0x0c, 0x14, 0x00, 0xf0, 0x04, 0x02,
+    0x04, 0x14, 0x00, 0x30, 0x0f, 0x00, 0xea, 0xff, 0x46, 0x00, 0x02, 0x00, 0x10, 0x00, 0x06, 0x11,
+    0x00, 0xf0, 0x12, 0x00, 0x02, 0x11, 0x00, 0x30, 0xe5, 0xff, 0x89, 0xff, 0x13, 0x00, 0x02, 0x00,
+    0x02, 0x00, 0x06, 0x11, 0x00, 0xf0, 0x04, 0x00, 0x02, 0x11, 0x00, 0x30, 0xbf, 0xff, 0x4a, 0x00,
+    0xfb, 0xff, 0x02, 0x00, 0x0f, 0x06, 0x09, 0x06, 0x00, 0xf0, 0x0f, 0x08, 0x09, 0x02, 0x00, 0x30,
+    0x30, 0xff, 0xcb, 0xfe, 0xf6, 0xff, 0x02, 0x00, 0x00, 0x06, 0x09, 0x06, 0x00, 0xf0, 0x00, 0x08,
+    0x09, 0x02, 0x00, 0x30, 0x44, 0x00, 0xf5, 0xff, 0x80, 0x00, 0x02, 0x00, 0x12, 0x01, 0x06, 0x0d,
+    0x00, 0xf0, 0x14, 0x01, 0x02, 0x0d, 0x00, 0x30, 0x41, 0x00, 0xbc, 0xff, 0x43, 0x00, 0x02, 0x00,
+    0x00, 0x01, 0x06, 0x0d, 0x00, 0xf0, 0x02, 0x01, 0x02, 0x0d, 0x00, 0x30, 0x0e, 0x00, 0xdf, 0xff,
+    0x51, 0x00, 0x02, 0x00, 0x10, 0x00, 0x04, 0x09, 0x00, 0xf0, 0x10, 0x00, 0x02, 0x09, 0x00, 0x20,
+    0xa0, 0xfe, 0xf1, 0x01, 0xdd, 0xff, 0x02, 0x00, 0x05, 0x0a, 0x0c, 0x07, 0x00, 0xf0, 0x09, 0x0a,
+    0x04, 0x07, 0x00, 0x30, 0x87, 0x00, 0x27, 0x00, 0xf9, 0xff, 0x02, 0x00, 0x0c, 0x09, 0x0c, 0x06,
+    0x00, 0xf0, 0x0c, 0x0b, 0x0c, 0x02, 0x00, 0x30, 0xf0, 0xff, 0x4a, 0xff, 0xfd, 0xff, 0x02, 0x00,
+    0x00, 0x09, 0x0c, 0x06, 0x00, 0xf0, 0x00, 0x0b, 0x0c, 0x02, 0x00, 0x30, 0x9e, 0xff, 0xeb, 0x00,
+    0x0b, 0x00, 0x02, 0x00, 0x05, 0x07, 0x0e, 0x09, 0x00, 0xf0, 0x05, 0x0a, 0x0e, 0x03, 0x00, 0x30,
+    0x23, 0x00, 0xc7, 0xff, 0x51, 0x00, 0x02, 0x00, 0x00, 0x0f, 0x14, 0x03, 0x00, 0xf0, 0x00, 0x10,
+    0x14, 0x01, 0x00, 0x30, 0x8f, 0xff, 0x47, 0xff, 0x2b, 0x00, 0x03, 0x00, 0x08, 0x0a, 0x08, 0x0a,
+    0x00, 0xf0, 0x0c, 0x0a, 0x04, 0x05, 0x00, 0x20, 0x08, 0x0f, 0x04, 0x05, 0x00, 0x20, 0xe4, 0xfc,
+    0x3f, 0x01, 0xdb, 0xff, 0x02, 0x00, 0x05, 0x04, 0x0d, 0x09, 0x00, 0xf0, 0x05, 0x07, 0x0d, 0x03,
+    0x00, 0x30, 0x43, 0xfe, 0x8e, 0xfe, 0x1f, 0x00, 0x02, 0x00, 0x0a, 0x02, 0x06, 0x12, 0x00, 0xf0,
+    0x0a, 0x08, 0x06, 0x06, 0x00, 0x30, 0xb1, 0xff, 0x38, 0xff, 0xfa, 0xff, 0x02, 0x00, 0x06, 0x00,
+    0x06, 0x09, 0x00, 0xf0, 0x08, 0x00, 0x02, 0x09, 0x00, 0x30, 0x0c, 0x00, 0x26, 0xff, 0x2a, 0x00,
+    0x02, 0x00, 0x06, 0x09, 0x0c, 0x04, 0x00, 0xf0, 0x06, 0x0b, 0x0c, 0x02, 0x00, 0x20, 0xf2, 0x00,
+    0xda, 0xff, 0x20, 0x01, 0x02, 0x00, 0x03, 0x02, 0x0f, 0x0c, 0x00, 0xf0, 0x03, 0x06, 0x0f, 0x04,
+    0x00, 0x30, 0x22, 0xff, 0x8c, 0x00, 0x09, 0x00, 0x02, 0x00, 0x0c, 0x00, 0x0c, 0x05, 0x00, 0xf0,
+    0x10, 0x00, 0x04, 0x05, 0x00, 0x30, 0x5f, 0xff, 0x5d, 0x00, 0xcc, 0xff, 0x02, 0x00, 0x00, 0x0f,
+    0x12, 0x03, 0x00, 0xf0, 0x06, 0x0f, 0x06, 0x03, 0x00, 0x30, 0x51, 0x01, 0xf8, 0xff, 0x8a, 0x00,
+    0x02, 0x00, 0x00, 0x0e, 0x18, 0x05, 0x00, 0xf0, 0x08, 0x0e, 0x08, 0x05, 0x00, 0x30, 0xe2, 0xff,
+    0x63, 0xff, 0x00, 0x00, 0x02, 0x00, 0x05, 0x01, 0x03, 0x12, 0x00, 0xf0, 0x06, 0x01, 0x01, 0x12,
+    0x00, 0x30, 0x1e, 0x00, 0xf0, 0xff, 0x6b, 0x00, 0x02, 0x00, 0x0a, 0x00, 0x04, 0x0e, 0x00, 0xf0,
+    0x0a, 0x00, 0x02, 0x0e, 0x00, 0x20, 0x1c, 0x00, 0xa9, 0xff, 0x20, 0x00, 0x02, 0x00, 0x09, 0x03,
+    0x04, 0x09, 0x00, 0xf0, 0x0b, 0x03, 0x02, 0x09, 0x00, 0x20, 0xc1, 0xff, 0xb3, 0xff, 0x37, 0x00,
+    0x03, 0x00, 0x08, 0x02, 0x0c, 0x06, 0x00, 0xf0, 0x0e, 0x02, 0x06, 0x03, 0x00, 0x20, 0x08, 0x05,
+    0x06, 0x03, 0x00, 0x20, 0xf5, 0xff, 0x13, 0x00, 0x97, 0xff, 0x02, 0x00, 0x00, 0x04, 0x11, 0x04,
+    0x00, 0xf0, 0x00, 0x06, 0x11, 0x02, 0x00, 0x20, 0xdf, 0xfe, 0x07, 0xff, 0x1c, 0x00, 0x02, 0x00,
+    0x10, 0x10, 0x05, 0x08, 0x00, 0xf0, 0x10, 0x14, 0x05, 0x04, 0x00, 0x20, 0xd1, 0xff, 0x2f, 0x00,
+    0xb4, 0xff, 0x02, 0x00, 0x03, 0x10, 0x05, 0x08, 0x00, 0xf0, 0x03, 0x14, 0x05, 0x04, 0x00, 0x20,
+    0x02, 0x00, 0xf1, 0xff, 0x3f, 0x00, 0x02, 0x00, 0x06, 0x12, 0x12, 0x02, 0x00, 0xf0, 0x06, 0x13,
+    0x12, 0x01, 0x00, 0x20, 0x69, 0xff, 0x53, 0x00, 0xc5, 0xff, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x05,
+    0x00, 0xf0, 0x04, 0x00, 0x04, 0x05, 0x00, 0x30, 0x7b, 0xff, 0xb5, 0xff, 0x27, 0x00, 0x03, 0x00,
+    0x0e, 0x03, 0x06, 0x0c, 0x00, 0xf0, 0x11, 0x03, 0x03, 0x06, 0x00, 0x20, 0x0e, 0x09, 0x03, 0x06,
+    0x00, 0x20, 0xce, 0xfe, 0xca, 0xfe, 0xf3, 0xff, 0x02, 0x00, 0x00, 0x0c, 0x06, 0x0c, 0x00, 0xf0,
+    0x02, 0x0c, 0x02, 0x0c, 0x00, 0x30, 0xa9, 0x00, 0x21, 0x00, 0xad, 0xfd, 0x02, 0x00, 0x02, 0x03,
+    0x15, 0x03, 0x00, 0xf0, 0x02, 0x04, 0x15, 0x01, 0x00, 0x30, 0x8a, 0xff, 0x57, 0xff, 0xfe, 0xff,
+    0x03, 0x00, 0x04, 0x03, 0x06, 0x0c, 0x00, 0xf0, 0x04, 0x03, 0x03, 0x06, 0x00, 0x20, 0x07, 0x09,
+    0x03, 0x06, 0x00, 0x20, 0xbd, 0x00, 0x2a, 0x00, 0x55, 0xff, 0x03, 0x00, 0x0c, 0x08, 0x0c, 0x06,
+    0x00, 0xf0, 0x12, 0x08, 0x06, 0x03, 0x00, 0x20, 0x0c, 0x0b, 0x06, 0x03, 0x00, 0x20, 0x11, 0x04,
+    0xf3, 0xff, 0xbc, 0xfe, 0x02, 0x00, 0x00, 0x0f, 0x10, 0x09, 0x00, 0xf0, 0x08, 0x0f, 0x08, 0x09,
+    0x00, 0x20, 0x09, 0x00, 0x33, 0x00, 0x03, 0x00, 0x02, 0x00, 0x06, 0x0d, 0x12, 0x05, 0x00, 0xf0,
+    0x06, 0x0d, 0x09, 0x05, 0x00, 0x20, 0xad, 0xfe, 0x37, 0xff, 0xfa, 0xff, 0x02, 0x00, 0x01, 0x06,
+    0x0f, 0x06, 0x00, 0xf0, 0x06, 0x06, 0x05, 0x06, 0x00, 0x30, 0xd2, 0xff, 0x49, 0x00, 0xf9, 0xff,
+    0x02, 0x00, 0x0b, 0x09, 0x09, 0x06, 0x00, 0xf0, 0x0e, 0x09, 0x03, 0x06, 0x00, 0x30, 0xf0, 0xfd,
+    0xba, 0x01, 0xdc, 0xff, 0x02, 0x00, 0x03, 0x00, 0x0f, 0x0b, 0x00, 0xf0, 0x08, 0x00, 0x05, 0x0b,
+    0x00, 0x30, 0x9d, 0x00, 0x04, 0x00, 0x60, 0x00, 0x02, 0x00, 0x0f, 0x03, 0x03, 0x12, 0x00, 0xf0,
+    0x0f, 0x09, 0x03, 0x06, 0x00, 0x30, 0xa1, 0x01, 0xed, 0xff, 0x9d, 0xfc, 0x02, 0x00, 0x06, 0x03,
+    0x03, 0x12, 0x00, 0xf0, 0x06, 0x09, 0x03, 0x06, 0x00, 0x30, 0xb2, 0xff, 0x51, 0x00, 0x04, 0x00,
+    0x03, 0x00, 0x09, 0x05, 0x0a, 0x08, 0x00, 0xf0, 0x0e, 0x05, 0x05, 0x04, 0x00, 0x20, 0x09, 0x09,
+    0x05, 0x04, 0x00, 0x20, 0x08, 0xff, 0xc4, 0x00, 0xd3, 0xff, 0x03, 0x00, 0x04, 0x04, 0x10, 0x08,
+    0x00, 0xf0, 0x04, 0x04, 0x08, 0x04, 0x00, 0x20, 0x0c, 0x08, 0x08, 0x04, 0x00, 0x20, 0x65, 0x00,
+    0x2f, 0x00, 0xb1, 0xff, 0x02, 0x00, 0x07, 0x07, 0x0c, 0x03, 0x00, 0xf0, 0x07, 0x07, 0x06, 0x03,
+    0x00, 0x20, 0x6d, 0x00, 0xc4, 0xff, 0x54, 0x00, 0x02, 0x00, 0x05, 0x00, 0x09, 0x0d, 0x00, 0xf0,
+    0x08, 0x00, 0x03, 0x0d, 0x00, 0x30, 0x3d, 0x00, 0x2c, 0x00, 0xd2, 0xff, 0x02, 0x00, 0x0b, 0x00,
+    0x06, 0x09, 0x00, 0xf0, 0x0d, 0x00, 0x02, 0x09, 0x00, 0x30, 0x6b, 0x00, 0xf5, 0xff, 0xdf, 0xfe,
+    0x02, 0x00, 0x07, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x09, 0x00, 0x02, 0x09, 0x00, 0x30, 0x67, 0xff,
+    0xcd, 0x00, 0x11, 0x00, 0x02, 0x00, 0x08, 0x01, 0x0a, 0x09, 0x00, 0xf0, 0x08, 0x04, 0x0a, 0x03,
+    0x00, 0x30, 0xeb, 0xff, 0x2f, 0xff, 0xfc, 0xff, 0x02, 0x00, 0x00, 0x02, 0x12, 0x02, 0x00, 0xf0,
+    0x00, 0x03, 0x12, 0x01, 0x00, 0x20, 0x48, 0x00, 0x26, 0x00, 0xd1, 0xff, 0x03, 0x00, 0x0a, 0x0d,
+    0x0e, 0x06, 0x00, 0xf0, 0x11, 0x0d, 0x07, 0x03, 0x00, 0x20, 0x0a, 0x10, 0x07, 0x03, 0x00, 0x20,
+    0x75, 0xff, 0x46, 0xff, 0xfc, 0xff, 0x03, 0x00, 0x00, 0x0d, 0x0e, 0x06, 0x00, 0xf0, 0x00, 0x0d,
+    0x07, 0x03, 0x00, 0x20, 0x07, 0x10, 0x07, 0x03, 0x00, 0x20, 0xbf, 0xff, 0x91, 0x00, 0x03, 0x00,
+    0x02, 0x00, 0x14, 0x02, 0x03, 0x15, 0x00, 0xf0, 0x15, 0x02, 0x01, 0x15, 0x00, 0x30, 0x50, 0x00,
+    0x0a, 0x00, 0x96, 0xff, 0x02, 0x00, 0x00, 0x09, 0x05, 0x0c, 0x00, 0xf0, 0x00, 0x0d, 0x05, 0x04,
+    0x00, 0x30, 0x58, 0xfe, 0x05, 0xfe, 0x1e, 0x00, 0x02, 0x00, 0x0c, 0x06, 0x0c, 0x06, 0x00, 0xf0,
+    0x0c, 0x08, 0x0c, 0x02, 0x00, 0x30, 0xb2, 0xff, 0x80, 0x00, 0xce, 0xff, 0x02, 0x00, 0x01, 0x08,
+    0x14, 0x03, 0x00, 0xf0, 0x01, 0x09, 0x14, 0x01, 0x00, 0x30, 0xcc, 0xff, 0x66, 0x00, 0xfa, 0xff,
+    0x02, 0x00, 0x05, 0x07, 0x13, 0x03, 0x00, 0xf0, 0x05, 0x08, 0x13, 0x01, 0x00, 0x30, 0xbe, 0xff,
+    0x3c, 0xff, 0xfa, 0xff, 0x02, 0x00, 0x01, 0x0c, 0x09, 0x06, 0x00, 0xf0, 0x01, 0x0e, 0x09, 0x02,
+    0x00, 0x30, 0xf6, 0xfd, 0xdd, 0x00, 0x10, 0x00, 0x02, 0x00, 0x06, 0x0a, 0x0e, 0x0c, 0x00, 0xf0,
+    0x06, 0x0e, 0x0e, 0x04, 0x00, 0x30, 0x4e, 0x00, 0x71, 0xff, 0x00, 0x00, 0x02, 0x00, 0x05, 0x06,
+    0x0e, 0x12, 0x00, 0xf0, 0x05, 0x0c, 0x0e, 0x06, 0x00, 0x30, 0x85, 0x00, 0x0a, 0x00, 0x7d, 0x00,
+    0x02, 0x00, 0x0b, 0x0c, 0x09, 0x07, 0x00, 0xf0, 0x0e, 0x0c, 0x03, 0x07, 0x00, 0x30, 0x26, 0x00,
+    0xcf, 0xff, 0x82, 0x00, 0x02, 0x00, 0x01, 0x0f, 0x12, 0x04, 0x00, 0xf0, 0x01, 0x11, 0x12, 0x02,
+    0x00, 0x20, 0x14, 0x00, 0x2f, 0x00, 0xd7, 0xff, 0x02, 0x00, 0x0b, 0x0e, 0x06, 0x09, 0x00, 0xf0,
+    0x0b, 0x11, 0x06, 0x03, 0x00, 0x30, 0xa9, 0x00, 0xf4, 0xff, 0xdf, 0xfe, 0x03, 0x00, 0x00, 0x08,
+    0x12, 0x04, 0x00, 0xf0, 0x00, 0x08, 0x09, 0x02, 0x00, 0x20, 0x09, 0x0a, 0x09, 0x02, 0x00, 0x20,
+    0xc8, 0xfe, 0x6a, 0x01, 0x16, 0x00, 0x03, 0x00, 0x03, 0x0a, 0x14, 0x06, 0x00, 0xf0, 0x0d, 0x0a,
+    0x0a, 0x03, 0x00, 0x20, 0x03, 0x0d, 0x0a, 0x03, 0x00, 0x20, 0xd6, 0xfe, 0x51, 0x01, 0xdb, 0xff,
+    0x03, 0x00, 0x01, 0x0a, 0x14, 0x06, 0x00, 0xf0, 0x01, 0x0a, 0x0a, 0x03, 0x00, 0x20, 0x0b, 0x0d,
+    0x0a, 0x03, 0x00, 0x20, 0xf4, 0x00, 0x0c, 0x00, 0xdb, 0x00, 0x02, 0x00, 0x00, 0x09, 0x18, 0x02,
+    0x00, 0xf0, 0x00, 0x09, 0x0c, 0x02, 0x00, 0x20, 0x53, 0x00, 0xcb, 0xff, 0x56, 0x00, 0x03, 0x00,
+    0x01, 0x0c, 0x14, 0x08, 0x00, 0xf0, 0x01, 0x0c, 0x0a, 0x04, 0x00, 0x20, 0x0b, 0x10, 0x0a, 0x04,
+    0x00, 0x20, 0xb8, 0xfe, 0xc1, 0xfe, 0x1e, 0x00, 0x02, 0x00, 0x0b, 0x0c, 0x09, 0x07, 0x00, 0xf0,
+    0x0e, 0x0c, 0x03, 0x07, 0x00, 0x30, 0xb7, 0xff, 0x42, 0x00, 0xc2, 0xff, 0x02, 0x00, 0x04, 0x0c,
+    0x09, 0x07, 0x00, 0xf0, 0x07, 0x0c, 0x03, 0x07, 0x00, 0x30, 0x2e, 0x00, 0x3a, 0x00, 0xb5, 0xff,
+    0x02, 0x00, 0x0c, 0x0c, 0x08, 0x05, 0x00, 0xf0, 0x0c, 0x0c, 0x04, 0x05, 0x00, 0x20, 0x98, 0xff,
+    0x24, 0xff, 0x00, 0x00, 0x02, 0x00, 0x04, 0x0c, 0x08, 0x05, 0x00, 0xf0, 0x08, 0x0c, 0x04, 0x05,
+    0x00, 0x20, 0xfd, 0xff, 0x50, 0x00, 0xdc, 0xff, 0x02, 0x00, 0x0d, 0x0a, 0x04, 0x0a, 0x00, 0xf0,
+    0x0d, 0x0a, 0x02, 0x0a, 0x00, 0x20, 0xc5, 0xff, 0x40, 0x00, 0xb8, 0xff, 0x02, 0x00, 0x01, 0x0f,
+    0x14, 0x02, 0x00, 0xf0, 0x0b, 0x0f, 0x0a, 0x02, 0x00, 0x20, 0x23, 0x00, 0x44, 0x00, 0xb8, 0xff,
+    0x02, 0x00, 0x09, 0x0a, 0x06, 0x06, 0x00, 0xf0, 0x09, 0x0a, 0x03, 0x06, 0x00, 0x20, 0xba, 0xfc,
+    0xc5, 0x00, 0xe0, 0x00, 0x76, 0xff, 0x9c, 0x00, 0x02, 0x00, 0x00, 0x01, 0x15, 0x03, 0x00, 0xf0,
+    0x07, 0x01, 0x07, 0x03, 0x00, 0x30, 0x45, 0xfe, 0xb7, 0x00, 0x97, 0xff, 0x02, 0x00, 0x06, 0x04,
+    0x0d, 0x09, 0x00, 0xf0, 0x06, 0x07, 0x0d, 0x03, 0x00, 0x30, 0x5e, 0x00, 0x6b, 0xff, 0x4b, 0x00,
+    0x02, 0x00, 0x06, 0x05, 0x0c, 0x05, 0x00, 0xf0, 0x0a, 0x05, 0x04, 0x05, 0x00, 0x30, 0x0b, 0x00,
+    0x42, 0xff, 0x24, 0x00, 0x02, 0x00, 0x0a, 0x0a, 0x0a, 0x06, 0x00, 0xf0, 0x0a, 0x0c, 0x0a, 0x02,
+    0x00, 0x30, 0xf8, 0xff, 0x2d, 0x00, 0x51, 0xff, 0x02, 0x00, 0x06, 0x0c, 0x05, 0x08, 0x00, 0xf0,
+    0x06, 0x10, 0x05, 0x04, 0x00, 0x20, 0xa4, 0xff, 0xed, 0xfe, 0x1f, 0x00, 0x02, 0x00, 0x0d, 0x00,
+    0x06, 0x09, 0x00, 0xf0, 0x0f, 0x00, 0x02, 0x09, 0x00, 0x30, 0x54, 0x01, 0x06, 0x00, 0xfa, 0xfe,
+    0x02, 0x00, 0x02, 0x0a, 0x12, 0x06, 0x00, 0xf0, 0x08, 0x0a, 0x06, 0x06, 0x00, 0x30, 0xe5, 0xff,
+    0x8d, 0xff, 0x36, 0x00, 0x02, 0x00, 0x0b, 0x02, 0x09, 0x04, 0x00, 0xf0, 0x0b, 0x04, 0x09, 0x02,
+    0x00, 0x20, 0x39, 0x01, 0xbb, 0xff, 0x7c, 0x00, 0x02, 0x00, 0x01, 0x14, 0x15, 0x03, 0x00, 0xf0,
+    0x08, 0x14, 0x07, 0x03, 0x00, 0x30, 0x16, 0x00, 0x83, 0xff, 0x50, 0x00, 0x02, 0x00, 0x01, 0x0a,
+    0x16, 0x02, 0x00, 0xf0, 0x01, 0x0b, 0x16, 0x01, 0x00, 0x20, 0xd6, 0xff, 0x6a, 0x00, 0xb4, 0xff,
+    0x02, 0x00, 0x00, 0x11, 0x12, 0x03, 0x00, 0xf0, 0x00, 0x12, 0x12, 0x01, 0x00, 0x30, 0x71, 0x00,
+    0x29, 0x00, 0x01, 0xff, 0x02, 0x00, 0x0d, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x0f, 0x00, 0x02, 0x09,
+    0x00, 0x30, 0xa1, 0xff, 0xe6, 0xfe, 0x05, 0x00, 0x02, 0x00, 0x05, 0x00, 0x06, 0x09, 0x00, 0xf0,
+    0x07, 0x00, 0x02, 0x09, 0x00, 0x30, 0x1d, 0xff, 0xa6, 0x00, 0xf9, 0xff, 0x02, 0x00, 0x12, 0x02,
+    0x06, 0x14, 0x00, 0xf0, 0x14, 0x02, 0x02, 0x14, 0x00, 0x30, 0x5a, 0xff, 0x6b, 0x00, 0xbc, 0xff,
+    0x02, 0x00, 0x00, 0x02, 0x06, 0x14, 0x00, 0xf0, 0x02, 0x02, 0x02, 0x14, 0x00, 0x30, 0xe2, 0xff,
+    0x5a, 0x00, 0xa0, 0xff, 0x03, 0x00, 0x0b, 0x07, 0x06, 0x0e, 0x00, 0xf0, 0x0e, 0x07, 0x03, 0x07,
+    0x00, 0x20, 0x0b, 0x0e, 0x03, 0x07, 0x00, 0x20, 0x45, 0x00, 0xb6, 0xff, 0x69, 0x00, 0x02, 0x00,
+    0x00, 0x01, 0x04, 0x09, 0x00, 0xf0, 0x02, 0x01, 0x02, 0x09, 0x00, 0x20, 0x69, 0xff, 0xae, 0xfe,
+    0x21, 0x00, 0x02, 0x00, 0x0c, 0x0e, 0x09, 0x04, 0x00, 0xf0, 0x0c, 0x10, 0x09, 0x02, 0x00, 0x20,
+    0xb0, 0xff, 0x20, 0xff, 0x00, 0x00, 0x02, 0x00, 0x01, 0x0d, 0x09, 0x04, 0x00, 0xf0, 0x01, 0x0f,
+    0x09, 0x02, 0x00, 0x20, 0xa0, 0xff, 0x42, 0x00, 0xca, 0xff, 0x02, 0x00, 0x07, 0x06, 0x0f, 0x06,
+    0x00, 0xf0, 0x07, 0x08, 0x0f, 0x02, 0x00, 0x30, 0x4f, 0xff, 0x03, 0xff, 0xfe, 0xff, 0x02, 0x00,
+    0x08, 0x02, 0x03, 0x12, 0x00, 0xf0, 0x08, 0x08, 0x03, 0x06, 0x00, 0x30, 0xa6, 0xff, 0xa2, 0x00,
+    0xf2, 0xff, 0x03, 0x00, 0x06, 0x06, 0x0c, 0x06, 0x00, 0xf0, 0x0c, 0x06, 0x06, 0x03, 0x00, 0x20,
+    0x06, 0x09, 0x06, 0x03, 0x00, 0x20, 0x43, 0x00, 0x06, 0x00, 0x45, 0xff, 0x03, 0x00, 0x02, 0x13,
+    0x14, 0x04, 0x00, 0xf0, 0x02, 0x13, 0x0a, 0x02, 0x00, 0x20, 0x0c, 0x15, 0x0a, 0x02, 0x00, 0x20,
+    0x7a, 0xff, 0x70, 0xff, 0x2a, 0x00, 0x02, 0x00, 0x0e, 0x0f, 0x06, 0x09, 0x00, 0xf0, 0x0e, 0x12,
+    0x06, 0x03, 0x00, 0x30, 0x24, 0x01, 0x00, 0x00, 0x12, 0xff, 0x03, 0x00, 0x03, 0x05, 0x12, 0x0e,
+    0x00, 0xf0, 0x03, 0x05, 0x09, 0x07, 0x00, 0x20, 0x0c, 0x0c, 0x09, 0x07, 0x00, 0x20, 0x03, 0x00,
+    0xe8, 0xff, 0x40, 0x00, 0x03, 0x00, 0x0f, 0x06, 0x04, 0x12, 0x00, 0xf0, 0x11, 0x06, 0x02, 0x09,
+    0x00, 0x20, 0x0f, 0x0f, 0x02, 0x09, 0x00, 0x20, 0xde, 0xff, 0x59, 0xff, 0x11, 0x00, 0x03, 0x00,
+    0x05, 0x06, 0x04, 0x12, 0x00, 0xf0, 0x05, 0x06, 0x02, 0x09, 0x00, 0x20, 0x07, 0x0f, 0x02, 0x09,
+    0x00, 0x20, 0xba, 0xff, 0x89, 0xff, 0x29, 0x00, 0x02, 0x00, 0x0b, 0x00, 0x06, 0x09, 0x00, 0xf0,
+    0x0d, 0x00, 0x02, 0x09, 0x00, 0x30, 0xb4, 0xff, 0xf1, 0xfe, 0xfb, 0xff, 0x02, 0x00, 0x07, 0x00,
+    0x06, 0x09, 0x00, 0xf0, 0x09, 0x00, 0x02, 0x09, 0x00, 0x30, 0xdb, 0xff, 0x81, 0x00, 0xd9, 0xff,
+    0x02, 0x00, 0x0b, 0x05, 0x06, 0x09, 0x00, 0xf0, 0x0d, 0x05, 0x02, 0x09, 0x00, 0x30, 0x4b, 0x00,
+    0xb2, 0xff, 0xbc, 0x00, 0x02, 0x00, 0x09, 0x05, 0x06, 0x06, 0x00, 0xf0, 0x0c, 0x05, 0x03, 0x06,
+    0x00, 0x20, 0x32, 0xff, 0xe3, 0xfe, 0x2e, 0x00, 0x03, 0x00, 0x04, 0x01, 0x10, 0x06, 0x00, 0xf0,
+    0x0c, 0x01, 0x08, 0x03, 0x00, 0x20, 0x04, 0x04, 0x08, 0x03, 0x00, 0x20, 0xa0, 0xff, 0x22, 0xff,
+    0xfd, 0xff, 0x02, 0x00, 0x09, 0x0d, 0x06, 0x0b, 0x00, 0xf0, 0x0b, 0x0d, 0x02, 0x0b, 0x00, 0x30,
+    0x91, 0xff, 0xa8, 0x00, 0xf7, 0xff, 0x03, 0x00, 0x11, 0x01, 0x06, 0x0c, 0x00, 0xf0, 0x14, 0x01,
+    0x03, 0x06, 0x00, 0x20, 0x11, 0x07, 0x03, 0x06, 0x00, 0x20, 0x1a, 0x00, 0xc6, 0xff, 0x6c, 0x00,
+    0x02, 0x00, 0x01, 0x11, 0x12, 0x03, 0x00, 0xf0, 0x01, 0x12, 0x12, 0x01, 0x00, 0x30, 0x5f, 0x00,
+    0x2e, 0x00, 0x04, 0xff, 0x02, 0x00, 0x07, 0x0d, 0x0a, 0x08, 0x00, 0xf0, 0x07, 0x11, 0x0a, 0x04,
+    0x00, 0x20, 0x35, 0x00, 0xac, 0xff, 0x36, 0x00, 0x02, 0x00, 0x06, 0x12, 0x0a, 0x06, 0x00, 0xf0,
+    0x06, 0x14, 0x0a, 0x02, 0x00, 0x30, 0xe5, 0xff, 0xe2, 0xff, 0x4c, 0x00, 0x02, 0x00, 0x09, 0x0e,
+    0x09, 0x04, 0x00, 0xf0, 0x09, 0x10, 0x09, 0x02, 0x00, 0x20, 0xa4, 0xff, 0x62, 0x00, 0xc2, 0xff,
+    0x03, 0x00, 0x01, 0x01, 0x06, 0x0c, 0x00, 0xf0, 0x01, 0x01, 0x03, 0x06, 0x00, 0x20, 0x04, 0x07,
+    0x03, 0x06, 0x00, 0x20, 0xfb, 0xfe, 0x1c, 0xff, 0x24, 0x00, 0x02, 0x00, 0x13, 0x04, 0x05, 0x0c,
+    0x00, 0xf0, 0x13, 0x08, 0x05, 0x04, 0x00, 0x30, 0x34, 0xff, 0x89, 0x00, 0xcc, 0xff, 0x02, 0x00,
+    0x00, 0x00, 0x08, 0x08, 0x00, 0xf0, 0x04, 0x00, 0x04, 0x08, 0x00, 0x20, 0x1b, 0x00, 0xf2, 0xff,
+    0x66, 0x00, 0x02, 0x00, 0x03, 0x05, 0x13, 0x03, 0x00, 0xf0, 0x03, 0x06, 0x13, 0x01, 0x00, 0x30,
+    0x1c, 0xff, 0x7a, 0xfe, 0xf3, 0xff, 0x03, 0x00, 0x01, 0x05, 0x0c, 0x06, 0x00, 0xf0, 0x01, 0x05,
+    0x06, 0x03, 0x00, 0x20, 0x07, 0x08, 0x06, 0x03, 0x00, 0x20, 0x1c, 0x05, 0x13, 0x00, 0x3e, 0x01,
+    0x02, 0x00, 0x02, 0x01, 0x15, 0x08, 0x00, 0xf0, 0x09, 0x01, 0x07, 0x08, 0x00, 0x30, 0x4b, 0x01,
+    0xce, 0xff, 0x99, 0x00, 0x02, 0x00, 0x04, 0x01, 0x10, 0x08, 0x00, 0xf0, 0x04, 0x05, 0x10, 0x04,
+    0x00, 0x20, 0xc3, 0xff, 0x5d, 0xff, 0x28, 0x00, 0x02, 0x00, 0x06, 0x00, 0x12, 0x03, 0x00, 0xf0,
+    0x06, 0x01, 0x12, 0x01, 0x00, 0x30, 0xbf, 0x00, 0x15, 0x00, 0x8c, 0xff, 0x02, 0x00, 0x04, 0x04,
+    0x0a, 0x0e, 0x00, 0xf0, 0x04, 0x0b, 0x0a, 0x07, 0x00, 0x20, 0x18, 0x00, 0x92, 0xff, 0x39, 0x00,
+    0x02, 0x00, 0x0f, 0x06, 0x04, 0x0a, 0x00, 0xf0, 0x0f, 0x0b, 0x04, 0x05, 0x00, 0x20, 0x74, 0xff,
+    0x66, 0x00, 0xc3, 0xff, 0x02, 0x00, 0x03, 0x12, 0x12, 0x03, 0x00, 0xf0, 0x09, 0x12, 0x06, 0x03,
+    0x00, 0x30, 0x71, 0xff, 0x87, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x08, 0x12, 0x0c, 0x06, 0x00, 0xf0,
+    0x0c, 0x12, 0x04, 0x06, 0x00, 0x30, 0x0c, 0x00, 0x9d, 0xff, 0x24, 0x00, 0x02, 0x00, 0x03, 0x0f,
+    0x06, 0x09, 0x00, 0xf0, 0x06, 0x0f, 0x03, 0x09, 0x00, 0x20, 0xc7, 0xff, 0xe0, 0x00, 0x15, 0x00,
+    0x02, 0x00, 0x0f, 0x07, 0x06, 0x08, 0x00, 0xf0, 0x0f, 0x0b, 0x06, 0x04, 0x00, 0x20, 0xe5, 0xff,
+    0xd6, 0xfe, 0xf8, 0xff, 0x02, 0x00, 0x03, 0x07, 0x06, 0x08, 0x00, 0xf0, 0x03, 0x0b, 0x06, 0x04,
+    0x00, 0x20, 0x28, 0xff, 0x17, 0x01, 0x0d, 0x00, 0x03, 0x00, 0x05, 0x09, 0x12, 0x06, 0x00, 0xf0,
+    0x0e, 0x09, 0x09, 0x03, 0x00, 0x20, 0x05, 0x0c, 0x09, 0x03, 0x00, 0x20, 0xf8, 0xff, 0x23, 0x00,
+    0xaa, 0xff, 0x02, 0x00, 0x01, 0x0d, 0x0c, 0x06, 0x00, 0xf0, 0x01, 0x0f, 0x0c, 0x02, 0x00, 0x30,
+    0x4b, 0x00, 0x22, 0x00, 0x98, 0xff, 0x02, 0x00, 0x0e, 0x0f, 0x0a, 0x06, 0x00, 0xf0, 0x0e, 0x11,
+    0x0a, 0x02, 0x00, 0x30, 0x33, 0x00, 0xfd, 0xff, 0x2f, 0xff, 0x02, 0x00, 0x00, 0x0f, 0x0a, 0x06,
+    0x00, 0xf0, 0x00, 0x11, 0x0a, 0x02, 0x00, 0x30, 0x34, 0x00, 0x2d, 0x00, 0xad, 0xff, 0x02, 0x00,
+    0x0f, 0x0d, 0x06, 0x09, 0x00, 0xf0, 0x0f, 0x10, 0x06, 0x03, 0x00, 0x30, 0xb7, 0xff, 0x79, 0xff,
+    0x0b, 0x00, 0x02, 0x00, 0x03, 0x0d, 0x06, 0x09, 0x00, 0xf0, 0x03, 0x10, 0x06, 0x03, 0x00, 0x30,
+    0x07, 0x00, 0xe4, 0xff, 0x38, 0x00, 0x02, 0x00, 0x09, 0x05, 0x08, 0x08, 0x00, 0xf0, 0x09, 0x05,
+    0x04, 0x08, 0x00, 0x20, 0xc4, 0xff, 0x64, 0x00, 0xc8, 0xff, 0x03, 0x00, 0x01, 0x12, 0x0c, 0x06,
+    0x00, 0xf0, 0x01, 0x12, 0x06, 0x03, 0x00, 0x20, 0x07, 0x15, 0x06, 0x03, 0x00, 0x20, 0xc3, 0xff,
+    0xbf, 0xff, 0x2d, 0x00, 0x02, 0x00, 0x0d, 0x13, 0x0a, 0x04, 0x00, 0xf0, 0x0d, 0x15, 0x0a, 0x02,
+    0x00, 0x20, 0x3b, 0x00, 0xfa, 0xff, 0x21, 0xff, 0x02, 0x00, 0x01, 0x13, 0x0a, 0x04, 0x00, 0xf0,
+    0x01, 0x15, 0x0a, 0x02, 0x00, 0x20, 0xd4, 0xff, 0xca, 0x00, 0x05, 0x00, 0x02, 0x00, 0x06, 0x13,
+    0x12, 0x03, 0x00, 0xf0, 0x06, 0x14, 0x12, 0x01, 0x00, 0x30, 0xdb, 0xff, 0x86, 0xff, 0x0d, 0x00,
+    0x02, 0x00, 0x08, 0x0e, 0x04, 0x0a, 0x00, 0xf0, 0x08, 0x13, 0x04, 0x05, 0x00, 0x20, 0x12, 0x00,
+    0xd4, 0xff, 0x58, 0x00, 0x02, 0x00, 0x00, 0x00, 0x18, 0x06, 0x00, 0xf0, 0x00, 0x02, 0x18, 0x02,
+    0x00, 0x30, 0x60, 0x00, 0x00, 0x00, 0x59, 0xff, 0x02, 0x00, 0x00, 0x01, 0x06, 0x09, 0x00, 0xf0,
+    0x00, 0x04, 0x06, 0x03, 0x00, 0x30, 0x82, 0x00, 0x04, 0x00, 0x96, 0x00, 0x03, 0x00, 0x04, 0x09,
+    0x14, 0x06, 0x00, 0xf0, 0x0e, 0x09, 0x0a, 0x03, 0x00, 0x20, 0x04, 0x0c, 0x0a, 0x03, 0x00, 0x20,
+    0xb5, 0xff, 0x33, 0x00, 0xae, 0xff, 0x02, 0x00, 0x01, 0x0f, 0x13, 0x08, 0x00, 0xf0, 0x01, 0x13,
+    0x13, 0x04, 0x00, 0x20, 0x50, 0x00, 0x2f, 0x00, 0xc4, 0xff, 0x02, 0x00, 0x0e, 0x00, 0x0a, 0x06,
+    0x00, 0xf0, 0x0e, 0x02, 0x0a, 0x02, 0x00, 0x30, 0x95, 0x06, 0xf1, 0xff, 0x65, 0xfe, 0x02, 0x00,
+    0x01, 0x0a, 0x15, 0x0e, 0x00, 0xf0, 0x08, 0x0a, 0x07, 0x0e, 0x00, 0x30, 0x56, 0xff, 0xad, 0xff,
+    0x26, 0x00, 0x02, 0x00, 0x0a, 0x0a, 0x08, 0x08, 0x00, 0xf0, 0x0a, 0x0a, 0x04, 0x08, 0x00, 0x20,
+    0xd6, 0xff, 0x61, 0xff, 0x03, 0x00, 0x02, 0x00, 0x06, 0x08, 0x0a, 0x04, 0x00, 0xf0, 0x0b, 0x08,
+    0x05, 0x04, 0x00, 0x20, 0x32, 0x00, 0xf8, 0xff, 0x8e, 0x00, 0x02, 0x00, 0x0a, 0x05, 0x04, 0x09,
+    0x00, 0xf0, 0x0a, 0x05, 0x02, 0x09, 0x00, 0x20, 0xdd, 0xff, 0x32, 0x00, 0xa0, 0xff, 0x02, 0x00,
+    0x07, 0x05, 0x06, 0x0a, 0x00, 0xf0, 0x09, 0x05, 0x02, 0x0a, 0x00, 0x30, 0x42, 0x00, 0x34, 0x00,
+    0x93, 0xff, 0x02, 0x00, 0x0e, 0x04, 0x04, 0x0d, 0x00, 0xf0, 0x0e, 0x04, 0x02, 0x0d, 0x00, 0x20,
+    0xd6, 0xff, 0x6f, 0xff, 0x0b, 0x00, 0x02, 0x00, 0x06, 0x04, 0x04, 0x0d, 0x00, 0xf0, 0x08, 0x04,
+    0x02, 0x0d, 0x00, 0x20, 0xce, 0xff, 0xbf, 0x00, 0x0b, 0x00, 0x02, 0x00, 0x08, 0x07, 0x09, 0x06,
+    0x00, 0xf0, 0x0b, 0x07, 0x03, 0x06, 0x00, 0x30, 0x32, 0xff, 0xd9, 0x00, 0xd3, 0xff, 0x03, 0x00,
+    0x03, 0x06, 0x10, 0x06, 0x00, 0xf0, 0x03, 0x06, 0x08, 0x03, 0x00, 0x20, 0x0b, 0x09, 0x08, 0x03,
+    0x00, 0x20, 0xca, 0x00, 0x2a, 0x00, 0xb4, 0xff, 0x03, 0x00, 0x05, 0x04, 0x10, 0x0e, 0x00, 0xf0,
+    0x0d, 0x04, 0x08, 0x07, 0x00, 0x20, 0x05, 0x0b, 0x08, 0x07, 0x00, 0x20, 0x58, 0xff, 0xac, 0xfe,
+    0xf4, 0xff, 0x03, 0x00, 0x00, 0x00, 0x18, 0x04, 0x00, 0xf0, 0x00, 0x00, 0x0c, 0x02, 0x00, 0x20,
+    0x0c, 0x02, 0x0c, 0x02, 0x00, 0x20, 0x04, 0x00, 0xf1, 0xff, 0x2f, 0x00, 0x02, 0x00, 0x09, 0x01,
+    0x09, 0x06, 0x00, 0xf0, 0x0c, 0x01, 0x03, 0x06, 0x00, 0x30, 0x33, 0xff, 0xc3, 0x00, 0xd2, 0xff,
+    0x02, 0x00, 0x04, 0x01, 0x0e, 0x04, 0x00, 0xf0, 0x0b, 0x01, 0x07, 0x04, 0x00, 0x20, 0xdd, 0xff,
+    0x39, 0x00, 0xf0, 0xff, 0x02, 0x00, 0x0a, 0x0e, 0x07, 0x09, 0x00, 0xf0, 0x0a, 0x11, 0x07, 0x03,
+    0x00, 0x30, 0x33, 0xff, 0x69, 0xfe, 0xf1, 0xff, 0x03, 0x00, 0x08, 0x03, 0x08, 0x0a, 0x00, 0xf0,
+    0x08, 0x03, 0x04, 0x05, 0x00, 0x20, 0x0c, 0x08, 0x04, 0x05, 0x00, 0x20, 0xa2, 0x01, 0x1e, 0x00,
+    0x97, 0xfe, 0x02, 0x00, 0x07, 0x03, 0x0c, 0x05, 0x00, 0xf0, 0x0b, 0x03, 0x04, 0x05, 0x00, 0x30,
+    0xc6, 0xff, 0xb1, 0xfe, 0xf3, 0xff, 0x02, 0x00, 0x08, 0x02, 0x04, 0x0d, 0x00, 0xf0, 0x0a, 0x02,
+    0x02, 0x0d, 0x00, 0x20, 0x2a, 0x00, 0x00, 0x00, 0x71, 0x00, 0x02, 0x00, 0x0b, 0x02, 0x03, 0x13,
+    0x00, 0xf0, 0x0c, 0x02, 0x01, 0x13, 0x00, 0x30, 0xd0, 0xff, 0xa7, 0x00, 0xd1, 0xff, 0x02, 0x00,
+    0x07, 0x07, 0x09, 0x06, 0x00, 0xf0, 0x0a, 0x07, 0x03, 0x06, 0x00, 0x30, 0x27, 0x01, 0x12, 0x00,
+    0xd0, 0x00, 0x02, 0x00, 0x04, 0x16, 0x14, 0x02, 0x00, 0xf0, 0x04, 0x16, 0x0a, 0x02, 0x00, 0x20,
+    0xb3, 0xff, 0x54, 0xff, 0x00, 0x00, 0x03, 0x00, 0x00, 0x10, 0x18, 0x04, 0x00, 0xf0, 0x00, 0x10,
+    0x0c, 0x02, 0x00, 0x20, 0x0c, 0x12, 0x0c, 0x02, 0x00, 0x20, 0xed, 0xff, 0x55, 0x00, 0x0e, 0x00,
+    0x02, 0x00, 0x07, 0x03, 0x0c, 0x05, 0x00, 0xf0, 0x0b, 0x03, 0x04, 0x05, 0x00, 0x30, 0x12, 0xff,
+    0x74, 0x00, 0xcd, 0xff, 0x03, 0x00, 0x01, 0x0a, 0x08, 0x0e, 0x00, 0xf0, 0x01, 0x0a, 0x04, 0x07,
+    0x00, 0x20, 0x05, 0x11, 0x04, 0x07, 0x00, 0x20, 0x04, 0x00, 0xf5, 0xff, 0x3a, 0x00, 0x02, 0x00,
+    0x0b, 0x10, 0x06, 0x06, 0x00, 0xf0, 0x0b, 0x13, 0x06, 0x03, 0x00, 0x20, 0x36, 0xff, 0x44, 0x00,
+    0xbe, 0xff, 0x03, 0x00, 0x06, 0x00, 0x0a, 0x18, 0x00, 0xf0, 0x06, 0x00, 0x05, 0x0c, 0x00, 0x20,
+    0x0b, 0x0c, 0x05, 0x0c, 0x00, 0x20, 0x19, 0xfe, 0x2c, 0xff, 0x21, 0x00, 0x03, 0x00, 0x07, 0x05,
+    0x0e, 0x0e, 0x00, 0xf0, 0x0e, 0x05, 0x07, 0x07, 0x00, 0x20, 0x07, 0x0c, 0x07, 0x07, 0x00, 0x20,
+    0xb6, 0xff, 0x54, 0xff, 0x04, 0x00, 0x03, 0x00, 0x07, 0x08, 0x0a, 0x08, 0x00, 0xf0, 0x07, 0x08,
+    0x05, 0x04, 0x00, 0x20, 0x0c, 0x0c, 0x05, 0x04, 0x00, 0x20, 0xe0, 0xff, 0xee, 0xff, 0x24, 0x00,
+    0x02, 0x00, 0x09, 0x01, 0x09, 0x06, 0x00, 0xf0, 0x0c, 0x01, 0x03, 0x06, 0x00, 0x30, 0xd4, 0x00,
+    0x07, 0x00, 0x71, 0xff, 0x02, 0x00, 0x00, 0x06, 0x18, 0x03, 0x00, 0xf0, 0x0c, 0x06, 0x0c, 0x03,
+    0x00, 0x20, 0x11, 0x01, 0x22, 0x00, 0xb5, 0xff, 0x02, 0x00, 0x07, 0x03, 0x0c, 0x05, 0x00, 0xf0,
+    0x0b, 0x03, 0x04, 0x05, 0x00, 0x30, 0xc8, 0xff, 0x68, 0xff, 0x03, 0x00, 0x03, 0x00, 0x01, 0x0d,
+    0x16, 0x04, 0x00, 0xf0, 0x01, 0x0d, 0x0b, 0x02, 0x00, 0x20, 0x0c, 0x0f, 0x0b, 0x02, 0x00, 0x20,
+    0xb8, 0xff, 0x67, 0x00, 0x00, 0x00, 0x02, 0x00, 0x09, 0x0c, 0x0c, 0x06, 0x00, 0xf0, 0x09, 0x0e,
+    0x0c, 0x02, 0x00, 0x30, 0x54, 0xff, 0xea, 0xfe, 0xf6, 0xff, 0x02, 0x00, 0x00, 0x05, 0x09, 0x06,
+    0x00, 0xf0, 0x00, 0x07, 0x09, 0x02, 0x00, 0x30, 0xc9, 0xff, 0x4a, 0x00, 0xc0, 0xff, 0x02, 0x00,
+    0x01, 0x05, 0x17, 0x06, 0x00, 0xf0, 0x01, 0x07, 0x17, 0x02, 0x00, 0x30, 0xd3, 0xff, 0xa7, 0x00,
+    0xd2, 0xff, 0x02, 0x00, 0x01, 0x06, 0x13, 0x0c, 0x00, 0xf0, 0x01, 0x0a, 0x13, 0x04, 0x00, 0x30,
+    0x09, 0xfe, 0x0b, 0xfe, 0x25, 0x00, 0x02, 0x00, 0x09, 0x01, 0x06, 0x15, 0x00, 0xf0, 0x09, 0x08,
+    0x06, 0x07, 0x00, 0x30, 0xc3, 0x00, 0xc6, 0xff, 0x57, 0x00, 0x02, 0x00, 0x03, 0x13, 0x12, 0x03,
+    0x00, 0xf0, 0x09, 0x13, 0x06, 0x03, 0x00, 0x30, 0x82, 0x00, 0x28, 0x00, 0xfe, 0xfe, 0x02, 0x00,
+    0x09, 0x0e, 0x06, 0x09, 0x00, 0xf0, 0x0b, 0x0e, 0x02, 0x09, 0x00, 0x30, 0x11, 0x00, 0x9d, 0xff,
+    0x15, 0x00, 0x02, 0x00, 0x09, 0x06, 0x04, 0x0c, 0x00, 0xf0, 0x0b, 0x06, 0x02, 0x0c, 0x00, 0x20,
+    0x05, 0xff, 0xb7, 0x01, 0x0f, 0x00, 0x02, 0x00, 0x10, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x12, 0x00,
+    0x02, 0x09, 0x00, 0x30, 0xf5, 0xff, 0x9f, 0xff, 0x15, 0x00, 0x02, 0x00, 0x02, 0x00, 0x06, 0x09,
+    0x00, 0xf0, 0x04, 0x00, 0x02, 0x09, 0x00, 0x30, 0xe8, 0xfe, 0xe9, 0xfc, 0x1e, 0x00, 0x03, 0x00,
+    0x0d, 0x01, 0x04, 0x16, 0x00, 0xf0, 0x0f, 0x01, 0x02, 0x0b, 0x00, 0x20, 0x0d, 0x0c, 0x02, 0x0b,
+    0x00, 0x20, 0xa8, 0x01, 0xdd, 0xff, 0xe6, 0x01, 0x02, 0x00, 0x01, 0x08, 0x08, 0x0c, 0x00, 0xf0,
+    0x01, 0x0e, 0x08, 0x06, 0x00, 0x20, 0x40, 0x00, 0xf0, 0xff, 0x42, 0x00, 0x02, 0x00, 0x0e, 0x07,
+    0x07, 0x09, 0x00, 0xf0, 0x0e, 0x0a, 0x07, 0x03, 0x00, 0x30, 0xd8, 0xff, 0x70, 0xff, 0x0b, 0x00,
+    0x03, 0x00, 0x03, 0x0c, 0x12, 0x04, 0x00, 0xf0, 0x03, 0x0c, 0x09, 0x02, 0x00, 0x20, 0x0c, 0x0e,
+    0x09, 0x02, 0x00, 0x20, 0xdc, 0xff, 0x40, 0x00, 0xf6, 0xff, 0x03, 0x00, 0x0d, 0x01, 0x04, 0x16,
+    0x00, 0xf0, 0x0f, 0x01, 0x02, 0x0b, 0x00, 0x20, 0x0d, 0x0c, 0x02, 0x0b, 0x00, 0x20, 0xfb, 0xfe,
+    0x62, 0xfd, 0xee, 0xff, 0x03, 0x00, 0x07, 0x01, 0x04, 0x16, 0x00, 0xf0, 0x07, 0x01, 0x02, 0x0b,
+    0x00, 0x20, 0x09, 0x0c, 0x02, 0x0b, 0x00, 0x20, 0x9f, 0x00, 0x0f, 0x00, 0xdc, 0x00, 0x03, 0x00,
+    0x04, 0x07, 0x14, 0x04, 0x00, 0xf0, 0x0e, 0x07, 0x0a, 0x02, 0x00, 0x20, 0x04, 0x09, 0x0a, 0x02,
+    0x00, 0x20, 0x5d, 0xff, 0xef, 0x00, 0xd8, 0xff, 0x02, 0x00, 0x09, 0x0a, 0x06, 0x07, 0x00, 0xf0,
+    0x0c, 0x0a, 0x03, 0x07, 0x00, 0x20, 0xce, 0x00, 0x23, 0x00, 0x72, 0xfd, 0x02, 0x00, 0x07, 0x07,
+    0x0a, 0x04, 0x00, 0xf0, 0x07, 0x07, 0x05, 0x04, 0x00, 0x20, 0xbd, 0x00, 0xfd, 0xff, 0x4b, 0xff,
+    0x02, 0x00, 0x00, 0x03, 0x04, 0x0f, 0x00, 0xf0, 0x00, 0x08, 0x04, 0x05, 0x00, 0x30, 0xfe, 0x00,
+    0x0f, 0x00, 0xa6, 0x01, 0x03, 0x00, 0x0f, 0x00, 0x08, 0x0c, 0x00, 0xf0, 0x13, 0x00, 0x04, 0x06,
+    0x00, 0x20, 0x0f, 0x06, 0x04, 0x06, 0x00, 0x20, 0xf7, 0xfe, 0xb6, 0x00, 0xd4, 0xff, 0x03, 0x00,
+    0x01, 0x00, 0x08, 0x0c, 0x00, 0xf0, 0x01, 0x00, 0x04, 0x06, 0x00, 0x20, 0x05, 0x06, 0x04, 0x06,
+    0x00, 0x20, 0x70, 0x00, 0x25, 0x00, 0xec, 0xff, 0x02, 0x00, 0x0e, 0x05, 0x06, 0x10, 0x00, 0xf0,
+    0x10, 0x05, 0x02, 0x10, 0x00, 0x30, 0x01, 0x00, 0xa1, 0xff, 0x19, 0x00, 0x02, 0x00, 0x04, 0x05,
+    0x06, 0x10, 0x00, 0xf0, 0x06, 0x05, 0x02, 0x10, 0x00, 0x30, 0xef, 0xff, 0xc4, 0xff, 0x44, 0x00,
+    0x02, 0x00, 0x0f, 0x00, 0x06, 0x10, 0x00, 0xf0, 0x11, 0x00, 0x02, 0x10, 0x00, 0x30, 0xc1, 0x00,
+    0xf9, 0xff, 0x27, 0xff, 0x02, 0x00, 0x03, 0x00, 0x06, 0x10, 0x00, 0xf0, 0x05, 0x00, 0x02, 0x10,
+    0x00, 0x30, 0x33, 0x00, 0x2f, 0x00, 0x71, 0xff, 0x02, 0x00, 0x00, 0x02, 0x18, 0x03, 0x00, 0xf0,
+    0x00, 0x03, 0x18, 0x01, 0x00, 0x30, 0xbc, 0x00, 0xd9, 0xff, 0xf8, 0x00, 0x02, 0x00, 0x07, 0x01,
+    0x0a, 0x04, 0x00, 0xf0, 0x07, 0x03, 0x0a, 0x02, 0x00, 0x20, 0x2d, 0x03, 0x26, 0x00, 0xe7, 0xfe,
+    0x02, 0x00, 0x01, 0x00, 0x17, 0x08, 0x00, 0xf0, 0x01, 0x04, 0x17, 0x04, 0x00, 0x20, 0x44, 0x00,
+    0xd6, 0xff, 0xd2, 0x00, 0x02, 0x00, 0x01, 0x11, 0x13, 0x03, 0x00, 0xf0, 0x01, 0x12, 0x13, 0x01,
+    0x00, 0x30, 0x08, 0x00, 0xee, 0xff, 0x49, 0x00, 0x02, 0x00, 0x06, 0x12, 0x12, 0x02, 0x00, 0xf0,
+    0x06, 0x13, 0x12, 0x01, 0x00, 0x20, 0x5b, 0x00, 0xfb, 0xff, 0x38, 0xff, 0x02, 0x00, 0x01, 0x11,
+    0x09, 0x06, 0x00, 0xf0, 0x01, 0x13, 0x09, 0x02, 0x00, 0x30, 0xc8, 0xff, 0xd2, 0xff, 0x34, 0x00,
+    0x02, 0x00, 0x0f, 0x0f, 0x06, 0x09, 0x00, 0xf0, 0x0f, 0x12, 0x06, 0x03, 0x00, 0x30, 0xe1, 0xff,
+    0x8c, 0xff, 0x10, 0x00, 0x02, 0x00, 0x03, 0x0f, 0x06, 0x09, 0x00, 0xf0, 0x03, 0x12, 0x06, 0x03,
+    0x00, 0x30, 0xca, 0xff, 0x44, 0x00, 0xd3, 0xff, 0x02, 0x00, 0x04, 0x0e, 0x14, 0x06, 0x00, 0xf0,
+    0x04, 0x11, 0x14, 0x03, 0x00, 0x20, 0xc8, 0x00, 0xd9, 0xff, 0x1b, 0x01, 0x03, 0x00, 0x00, 0x0a,
+    0x06, 0x0e, 0x00, 0xf0, 0x00, 0x0a, 0x03, 0x07, 0x00, 0x20, 0x03, 0x11, 0x03, 0x07, 0x00, 0x20,
+    0x53, 0x00, 0x11, 0x00, 0xb2, 0x00, 0x02, 0x00, 0x06, 0x12, 0x12, 0x03, 0x00, 0xf0, 0x06, 0x13,
+    0x12, 0x01, 0x00, 0x30, 0xbc, 0xff, 0x46, 0x00, 0xc0, 0xff, 0x02, 0x00, 0x04, 0x0c, 0x09, 0x07,
+    0x00, 0xf0, 0x07, 0x0c, 0x03, 0x07, 0x00, 0x30, 0x4b, 0xfd, 0xed, 0xfc, 0x1d, 0x00, 0x02, 0x00,
+    0x06, 0x0a, 0x12, 0x05, 0x00, 0xf0, 0x0c, 0x0a, 0x06, 0x05, 0x00, 0x30, 0x30, 0xfe, 0x8a, 0xfe,
+    0xf3, 0xff, 0x02, 0x00, 0x00, 0x0a, 0x12, 0x05, 0x00, 0xf0, 0x06, 0x0a, 0x06, 0x05, 0x00, 0x30,
+    0xc2, 0xfe, 0xe2, 0x00, 0x0b, 0x00, 0x02, 0x00, 0x03, 0x02, 0x12, 0x09, 0x00, 0xf0, 0x09, 0x02,
+    0x06, 0x09, 0x00, 0x30, 0xc1, 0xff, 0x23, 0x00, 0xa8, 0xff, 0x03, 0x00, 0x04, 0x06, 0x0a, 0x0a,
+    0x00, 0xf0, 0x04, 0x06, 0x05, 0x05, 0x00, 0x20, 0x09, 0x0b, 0x05, 0x05, 0x00, 0x20, 0xf2, 0xfe,
+    0xf9, 0xfe, 0x1d, 0x00, 0x02, 0x00, 0x14, 0x0e, 0x04, 0x09, 0x00, 0xf0, 0x14, 0x0e, 0x02, 0x09,
+    0x00, 0x20, 0x22, 0x00, 0x13, 0x00, 0x90, 0xff, 0x02, 0x00, 0x00, 0x0e, 0x04, 0x09, 0x00, 0xf0,
+    0x02, 0x0e, 0x02, 0x09, 0x00, 0x20, 0x91, 0x00, 0x1e, 0x00, 0x46, 0xff, 0x03, 0x00, 0x0b, 0x01,
+    0x04, 0x14, 0x00, 0xf0, 0x0d, 0x01, 0x02, 0x0a, 0x00, 0x20, 0x0b, 0x0b, 0x02, 0x0a, 0x00, 0x20,
+    0x61, 0xff, 0xac, 0x00, 0xd2, 0xff, 0x02, 0x00, 0x06, 0x15, 0x0c, 0x03, 0x00, 0xf0, 0x0c, 0x15,
+    0x06, 0x03, 0x00, 0x20, 0xd8, 0xff, 0x36, 0x00, 0x09, 0x00, 0x03, 0x00, 0x0b, 0x01, 0x04, 0x14,
+    0x00, 0xf0, 0x0d, 0x01, 0x02, 0x0a, 0x00, 0x20, 0x0b, 0x0b, 0x02, 0x0a, 0x00, 0x20, 0xa2, 0xff,
+    0x72, 0x00, 0xcb, 0xff, 0x03, 0x00, 0x01, 0x10, 0x0a, 0x08, 0x00, 0xf0, 0x01, 0x10, 0x05, 0x04,
+    0x00, 0x20, 0x06, 0x14, 0x05, 0x04, 0x00, 0x20, 0x0c, 0x00, 0x09, 0x00, 0x47, 0x00, 0x03, 0x00,
+    0x0b, 0x01, 0x04, 0x14, 0x00, 0xf0, 0x0d, 0x01, 0x02, 0x0a, 0x00, 0x20, 0x0b, 0x0b, 0x02, 0x0a,
+    0x00, 0x20, 0x35, 0x00, 0xce, 0xff, 0x8b, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0x13, 0x00, 0xf0,
+    0x02, 0x00, 0x01, 0x13, 0x00, 0x30, 0x3c, 0x00, 0x22, 0x00, 0xe4, 0xff, 0x03, 0x00, 0x0b, 0x01,
+    0x04, 0x14, 0x00, 0xf0, 0x0d, 0x01, 0x02, 0x0a, 0x00, 0x20, 0x0b, 0x0b, 0x02, 0x0a, 0x00, 0x20,
+    0x0a, 0xff, 0xd7, 0x00, 0xd6, 0xff, 0x02, 0x00, 0x00, 0x01, 0x06, 0x09, 0x00, 0xf0, 0x02, 0x01,
+    0x02, 0x09, 0x00, 0x30, 0xd4, 0x00, 0x2c, 0x00, 0x37, 0xff, 0x02, 0x00, 0x03, 0x07, 0x13, 0x04,
+    0x00, 0xf0, 0x03, 0x09, 0x13, 0x02, 0x00, 0x20, 0x65, 0x00, 0xd3, 0xff, 0xaa, 0x00, 0x02, 0x00,
+    0x07, 0x0e, 0x09, 0x06, 0x00, 0xf0, 0x07, 0x10, 0x09, 0x02, 0x00, 0x30, 0xcf, 0xff, 0xdc, 0xff,
+    0x29, 0x00, 0x02, 0x00, 0x11, 0x01, 0x07, 0x06, 0x00, 0xf0, 0x11, 0x04, 0x07, 0x03, 0x00, 0x20,
+    0x6c, 0xfe, 0x0b, 0x01, 0xd8, 0xff, 0x02, 0x00, 0x05, 0x00, 0x0e, 0x08, 0x00, 0xf0, 0x05, 0x04,
+    0x0e, 0x04, 0x00, 0x20, 0xe1, 0x01, 0x1c, 0x00, 0x83, 0xfb, 0x02, 0x00, 0x10, 0x01, 0x08, 0x06,
+    0x00, 0xf0, 0x10, 0x04, 0x08, 0x03, 0x00, 0x20, 0xb3, 0xff, 0x37, 0xff, 0x03, 0x00, 0x02, 0x00,
+    0x00, 0x01, 0x08, 0x06, 0x00, 0xf0, 0x00, 0x04, 0x08, 0x03, 0x00, 0x20, 0x8c, 0xff, 0x65, 0xff,
+    0x21, 0x00, 0x03, 0x00, 0x06, 0x00, 0x12, 0x04, 0x00, 0xf0, 0x0f, 0x00, 0x09, 0x02, 0x00, 0x20,
+    0x06, 0x02, 0x09, 0x02, 0x00, 0x20, 0x35, 0x00, 0xfd, 0xff, 0x45, 0xff, 0x02, 0x00, 0x00, 0x0e,
+    0x09, 0x06, 0x00, 0xf0, 0x00, 0x10, 0x09, 0x02, 0x00, 0x30, 0x23, 0xfe, 0xf5, 0xfd, 0x23, 0x00,
+    0x02, 0x00, 0x03, 0x07, 0x12, 0x08, 0x00, 0xf0, 0x09, 0x07, 0x06, 0x08, 0x00, 0x30, 0xf1, 0xff,
+    0x95, 0xff, 0x14, 0x00, 0x02, 0x00, 0x02, 0x0b, 0x06, 0x09, 0x00, 0xf0, 0x04, 0x0b, 0x02, 0x09,
+    0x00, 0x30, 0x7f, 0x00, 0x06, 0x00, 0x6b, 0x00, 0x02, 0x00, 0x0a, 0x05, 0x06, 0x09, 0x00, 0xf0,
+    0x0c, 0x05, 0x02, 0x09, 0x00, 0x30, 0x67, 0x00, 0xd4, 0xff, 0xa5, 0x00, 0x03, 0x00, 0x0a, 0x06,
+    0x04, 0x12, 0x00, 0xf0, 0x0a, 0x06, 0x02, 0x09, 0x00, 0x20, 0x0c, 0x0f, 0x02, 0x09, 0x00, 0x20,
+    0x8d, 0xff, 0xc8, 0xff, 0x24, 0x00, 0x03, 0x00, 0x0b, 0x01, 0x04, 0x14, 0x00, 0xf0, 0x0d, 0x01,
+    0x02, 0x0a, 0x00, 0x20, 0x0b, 0x0b, 0x02, 0x0a, 0x00, 0x20, 0x95, 0x00, 0xef, 0xff, 0xa9, 0xfd,
+    0x03, 0x00, 0x09, 0x01, 0x04, 0x14, 0x00, 0xf0, 0x09, 0x01, 0x02, 0x0a, 0x00, 0x20, 0x0b, 0x0b,
+    0x02, 0x0a, 0x00, 0x20, 0xd8, 0xfe, 0x4a, 0x01, 0x15, 0x00, 0x03, 0x00, 0x05, 0x09, 0x12, 0x06,
+    0x00, 0xf0, 0x0e, 0x09, 0x09, 0x03, 0x00, 0x20, 0x05, 0x0c, 0x09, 0x03, 0x00, 0x20, 0x56, 0xff,
+    0xd7, 0xfe, 0xf3, 0xff, 0x02, 0x00, 0x06, 0x04, 0x06, 0x09, 0x00, 0xf0, 0x08, 0x04, 0x02, 0x09,
+    0x00, 0x30, 0xc3, 0x00, 0x11, 0x00, 0xbc, 0x00, 0x02, 0x00, 0x0a, 0x10, 0x08, 0x06, 0x00, 0xf0,
+    0x0a, 0x10, 0x04, 0x06, 0x00, 0x20, 0x0d, 0x01, 0xd3, 0xff, 0xb2, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x12, 0x08, 0x00, 0xf0, 0x00, 0x00, 0x09, 0x04, 0x00, 0x20, 0x09, 0x04, 0x09, 0x04, 0x00, 0x20,
+    0x38, 0x00, 0x38, 0x00, 0xcc, 0xff, 0x03, 0x00, 0x06, 0x05, 0x0e, 0x0c, 0x00, 0xf0, 0x0d, 0x05,
+    0x07, 0x06, 0x00, 0x20, 0x06, 0x0b, 0x07, 0x06, 0x00, 0x20, 0x8f, 0xff, 0x9e, 0x00, 0xd3, 0xff,
+    0x02, 0x00, 0x04, 0x03, 0x0f, 0x07, 0x00, 0xf0, 0x09, 0x03, 0x05, 0x07, 0x00, 0x30, 0xbf, 0xff,
+    0x8a, 0xff, 0x30, 0x00, 0x02, 0x00, 0x0e, 0x0c, 0x0a, 0x06, 0x00, 0xf0, 0x0e, 0x0e, 0x0a, 0x02,
+    0x00, 0x30, 0x2f, 0x01, 0xe0, 0xff, 0x47, 0x03, 0x02, 0x00, 0x00, 0x0b, 0x04, 0x0a, 0x00, 0xf0,
+    0x00, 0x10, 0x04, 0x05, 0x00, 0x20, 0xfd, 0xff, 0xb3, 0xff, 0x3c, 0x00, 0x02, 0x00, 0x01, 0x0a,
+    0x16, 0x03, 0x00, 0xf0, 0x01, 0x0b, 0x16, 0x01, 0x00, 0x30, 0x49, 0x00, 0xc7, 0xff, 0x4c, 0x00,
+    0x02, 0x00, 0x08, 0x09, 0x06, 0x0a, 0x00, 0xf0, 0x0a, 0x09, 0x02, 0x0a, 0x00, 0x30, 0xf6, 0xff,
+    0x40, 0x00, 0xde, 0xff, 0x03, 0x00, 0x0d, 0x02, 0x06, 0x0c, 0x00, 0xf0, 0x10, 0x02, 0x03, 0x06,
+    0x00, 0x20, 0x0d, 0x08, 0x03, 0x06, 0x00, 0x20, 0xdb, 0xff, 0x4a, 0x00, 0xb6, 0xff, 0x03, 0x00,
+    0x0a, 0x06, 0x04, 0x12, 0x00, 0xf0, 0x0a, 0x06, 0x02, 0x09, 0x00, 0x20, 0x0c, 0x0f, 0x02, 0x09,
+    0x00, 0x20, 0xc9, 0x00, 0x31, 0x00, 0x52, 0xff, 0x03, 0x00, 0x07, 0x08, 0x0a, 0x10, 0x00, 0xf0,
+    0x0c, 0x08, 0x05, 0x08, 0x00, 0x20, 0x07, 0x10, 0x05, 0x08, 0x00, 0x20, 0x83, 0xff, 0x3f, 0xff,
+    0xfd, 0xff, 0x03, 0x00, 0x08, 0x01, 0x08, 0x0c, 0x00, 0xf0, 0x08, 0x01, 0x04, 0x06, 0x00, 0x20,
+    0x0c, 0x07, 0x04, 0x06, 0x00, 0x20, 0x9a, 0x01, 0x15, 0x00, 0x16, 0x01, 0x03, 0x00, 0x07, 0x01,
+    0x0c, 0x0e, 0x00, 0xf0, 0x0d, 0x01, 0x06, 0x07, 0x00, 0x20, 0x07, 0x08, 0x06, 0x07, 0x00, 0x20,
+    0x0d, 0x00, 0xbc, 0xff, 0x32, 0x00, 0x02, 0x00, 0x02, 0x0e, 0x0c, 0x06, 0x00, 0xf0, 0x02, 0x10,
+    0x0c, 0x02, 0x00, 0x30, 0x91, 0x00, 0x22, 0x00, 0x6f, 0xff, 0x02, 0x00, 0x0b, 0x10, 0x06, 0x06,
+    0x00, 0xf0, 0x0b, 0x13, 0x06, 0x03, 0x00, 0x20, 0x01, 0x00, 0x99, 0xff, 0x24, 0x00, 0x02, 0x00,
+    0x07, 0x10, 0x06, 0x06, 0x00, 0xf0, 0x07, 0x13, 0x06, 0x03, 0x00, 0x20, 0x67, 0x00, 0x29, 0x00,
+    0x72, 0xff, 0x02, 0x00, 0x0d, 0x04, 0x04, 0x0a, 0x00, 0xf0, 0x0d, 0x04, 0x02, 0x0a, 0x00, 0x20,
+    0xeb, 0xff, 0x4f, 0x00, 0xc6, 0xff, 0x02, 0x00, 0x00, 0x13, 0x13, 0x03, 0x00, 0xf0, 0x00, 0x14,
+    0x13, 0x01, 0x00, 0x30, 0x06, 0x00, 0xbc, 0xff, 0x32, 0x00, 0x02, 0x00, 0x0c, 0x08, 0x06, 0x08,
+    0x00, 0xf0, 0x0c, 0x0c, 0x06, 0x04, 0x00, 0x20, 0xbe, 0xff, 0x27, 0x00, 0xa9, 0xff, 0x02, 0x00,
+    0x08, 0x01, 0x08, 0x16, 0x00, 0xf0, 0x08, 0x0c, 0x08, 0x0b, 0x00, 0x20, 0x87, 0xff, 0x25, 0x01,
+    0x17, 0x00, 0x02, 0x00, 0x0c, 0x08, 0x06, 0x08, 0x00, 0xf0, 0x0c, 0x0c, 0x06, 0x04, 0x00, 0x20,
+    0xfa, 0xff, 0x4a, 0xff, 0x00, 0x00, 0x02, 0x00, 0x06, 0x08, 0x06, 0x08, 0x00, 0xf0, 0x06, 0x0c,
+    0x06, 0x04, 0x00, 0x20, 0x23, 0xff, 0x6a, 0x00, 0x06, 0x00, 0x02, 0x00, 0x0e, 0x05, 0x06, 0x09,
+    0x00, 0xf0, 0x0e, 0x08, 0x06, 0x03, 0x00, 0x30, 0xf1, 0xfe, 0xab, 0xfe, 0xf4, 0xff, 0x02, 0x00,
+    0x00, 0x06, 0x18, 0x04, 0x00, 0xf0, 0x00, 0x08, 0x18, 0x02, 0x00, 0x20, 0x72, 0x00, 0x24, 0x00,
+    0x7d, 0xff, 0x02, 0x00, 0x0e, 0x0c, 0x0a, 0x06, 0x00, 0xf0, 0x0e, 0x0e, 0x0a, 0x02, 0x00, 0x30,
+    0x76, 0x00, 0xf4, 0xff, 0xcf, 0xfe, 0x02, 0x00, 0x00, 0x0c, 0x0a, 0x06, 0x00, 0xf0, 0x00, 0x0e,
+    0x0a, 0x02, 0x00, 0x30, 0xad, 0xff, 0xa3, 0x00, 0x09, 0x00, 0x02, 0x00, 0x04, 0x06, 0x13, 0x03,
+    0x00, 0xf0, 0x04, 0x07, 0x13, 0x01, 0x00, 0x30, 0x32, 0x00, 0xc9, 0xff, 0x7e, 0x00, 0x02, 0x00,
+    0x01, 0x06, 0x13, 0x03, 0x00, 0xf0, 0x01, 0x07, 0x13, 0x01, 0x00, 0x30, 0xaf, 0xfc, 0xb5, 0x00,
+    0xb1, 0x00, 0x32, 0xff, 0x66, 0x00, 0x02, 0x00, 0x04, 0x00, 0x10, 0x09, 0x00, 0xf0, 0x04, 0x03,
+    0x10, 0x03, 0x00, 0x30, 0xfa, 0x02, 0xaf, 0xff, 0xb0, 0x00, 0x02, 0x00, 0x00, 0x01, 0x18, 0x05,
+    0x00, 0xf0, 0x08, 0x01, 0x08, 0x05, 0x00, 0x30, 0x82, 0x00, 0x5c, 0xff, 0x41, 0x00, 0x02, 0x00,
+    0x03, 0x06, 0x06, 0x0f, 0x00, 0xf0, 0x03, 0x0b, 0x06, 0x05, 0x00, 0x30, 0x39, 0x00, 0x8b, 0xff,
+    0x4f, 0x00, 0x02, 0x00, 0x09, 0x06, 0x06, 0x09, 0x00, 0xf0, 0x0b, 0x06, 0x02, 0x09, 0x00, 0x30,
+    0xe7, 0xff, 0x75, 0x00, 0xba, 0xff, 0x02, 0x00, 0x00, 0x11, 0x12, 0x03, 0x00, 0xf0, 0x00, 0x12,
+    0x12, 0x01, 0x00, 0x30, 0xea, 0xff, 0x5d, 0x00, 0xbb, 0xff, 0x02, 0x00, 0x06, 0x16, 0x12, 0x02,
+    0x00, 0xf0, 0x06, 0x17, 0x12, 0x01, 0x00, 0x20, 0x44, 0x00, 0x06, 0x00, 0x1e, 0xff, 0x02, 0x00,
+    0x02, 0x0c, 0x06, 0x09, 0x00, 0xf0, 0x02, 0x0f, 0x06, 0x03, 0x00, 0x30, 0x6a, 0x00, 0x2c, 0x00,
+    0x75, 0xff, 0x02, 0x00, 0x12, 0x0c, 0x06, 0x09, 0x00, 0xf0, 0x12, 0x0f, 0x06, 0x03, 0x00, 0x30,
+    0x93, 0xff, 0x0a, 0xff, 0x06, 0x00, 0x02, 0x00, 0x00, 0x0c, 0x06, 0x09, 0x00, 0xf0, 0x00, 0x0f,
+    0x06, 0x03, 0x00, 0x30, 0xbb, 0xff, 0x4b, 0xff, 0x36, 0x00, 0x02, 0x00, 0x0b, 0x0e, 0x04, 0x0a,
+    0x00, 0xf0, 0x0b, 0x13, 0x04, 0x05, 0x00, 0x20, 0x18, 0x00, 0x12, 0x00, 0x52, 0xff, 0x02, 0x00,
+    0x09, 0x06, 0x06, 0x10, 0x00, 0xf0, 0x09, 0x0e, 0x06, 0x08, 0x00, 0x20, 0xf5, 0xff, 0x41, 0xff,
+    0x3c, 0x00, 0x02, 0x00, 0x07, 0x07, 0x0a, 0x0a, 0x00, 0xf0, 0x07, 0x0c, 0x0a, 0x05, 0x00, 0x20,
+    0x4d, 0xff, 0xae, 0x00, 0xca, 0xff, 0x02, 0x00, 0x01, 0x03, 0x06, 0x0d, 0x00, 0xf0, 0x03, 0x03,
+    0x02, 0x0d, 0x00, 0x30, 0xd3, 0x00, 0xe0, 0xff, 0xac, 0x00, 0x02, 0x00, 0x12, 0x01, 0x06, 0x0d,
+    0x00, 0xf0, 0x12, 0x01, 0x03, 0x0d, 0x00, 0x20, 0x21, 0x00, 0x12, 0x00, 0x32, 0xff, 0x02, 0x00,
+    0x05, 0x01, 0x06, 0x09, 0x00, 0xf0, 0x07, 0x01, 0x02, 0x09, 0x00, 0x30, 0x28, 0xff, 0xf4, 0x00,
+    0x04, 0x00, 0x02, 0x00, 0x12, 0x02, 0x06, 0x0b, 0x00, 0xf0, 0x12, 0x02, 0x03, 0x0b, 0x00, 0x20,
+    0xd7, 0x00, 0xb8, 0xff, 0x78, 0x00, 0x02, 0x00, 0x00, 0x02, 0x06, 0x0b, 0x00, 0xf0, 0x03, 0x02,
+    0x03, 0x0b, 0x00, 0x20, 0xcd, 0xff, 0x62, 0x00, 0xf1, 0xff, 0x02, 0x00, 0x09, 0x0c, 0x0f, 0x06,
+    0x00, 0xf0, 0x09, 0x0e, 0x0f, 0x02, 0x00, 0x30, 0x2f, 0x00, 0x00, 0x00, 0xfc, 0xfe, 0x02, 0x00,
+    0x02, 0x02, 0x14, 0x03, 0x00, 0xf0, 0x02, 0x03, 0x14, 0x01, 0x00, 0x30, 0x9f, 0xff, 0xd9, 0x00,
+    0x01, 0x00, 0x02, 0x00, 0x0a, 0x06, 0x04, 0x09, 0x00, 0xf0, 0x0a, 0x06, 0x02, 0x09, 0x00, 0x20,
+    0x04, 0xff, 0x14, 0xff, 0x00, 0x00, 0x03, 0x00, 0x05, 0x06, 0x0c, 0x0e, 0x00, 0xf0, 0x05, 0x06,
+    0x06, 0x07, 0x00, 0x20, 0x0b, 0x0d, 0x06, 0x07, 0x00, 0x20, 0xf9, 0xff, 0x75, 0xff, 0x3f, 0x00,
+    0x02, 0x00, 0x09, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x0b, 0x00, 0x02, 0x09, 0x00, 0x30, 0x90, 0x00,
+    0xff, 0xff, 0x10, 0xff, 0x02, 0x00, 0x07, 0x00, 0x09, 0x06, 0x00, 0xf0, 0x0a, 0x00, 0x03, 0x06,
+    0x00, 0x30, 0xb5, 0xff, 0xb8, 0x00, 0x02, 0x00, 0x02, 0x00, 0x0a, 0x06, 0x06, 0x09, 0x00, 0xf0,
+    0x0c, 0x06, 0x02, 0x09, 0x00, 0x30, 0x63, 0xff, 0x31, 0x00, 0xa5, 0xff, 0x03, 0x00, 0x04, 0x01,
+    0x0c, 0x14, 0x00, 0xf0, 0x04, 0x01, 0x06, 0x0a, 0x00, 0x20, 0x0a, 0x0b, 0x06, 0x0a, 0x00, 0x20,
+    0x98, 0x01, 0x1d, 0x00, 0x5f, 0xfe, 0x02, 0x00, 0x06, 0x07, 0x12, 0x03, 0x00, 0xf0, 0x06, 0x07,
+    0x09, 0x03, 0x00, 0x20, 0x59, 0x01, 0xf3, 0xff, 0x4e, 0xfe, 0x02, 0x00, 0x00, 0x07, 0x12, 0x03,
+    0x00, 0xf0, 0x09, 0x07, 0x09, 0x03, 0x00, 0x20, 0xa4, 0x00, 0xe5, 0xff, 0x84, 0x00, 0x02, 0x00,
+    0x03, 0x14, 0x12, 0x03, 0x00, 0xf0, 0x09, 0x14, 0x06, 0x03, 0x00, 0x30, 0xf1, 0x00, 0xd2, 0xff,
+    0xf3, 0x00, 0x02, 0x00, 0x09, 0x06, 0x06, 0x09, 0x00, 0xf0, 0x0b, 0x06, 0x02, 0x09, 0x00, 0x30,
+    0x64, 0x02, 0x2a, 0x00, 0xd8, 0xfe, 0x02, 0x00, 0x06, 0x02, 0x0c, 0x0f, 0x00, 0xf0, 0x0a, 0x02,
+    0x04, 0x0f, 0x00, 0x30, 0x02, 0x00, 0x34, 0x00, 0xac, 0xff, 0x02, 0x00, 0x02, 0x03, 0x12, 0x03,
+    0x00, 0xf0, 0x02, 0x04, 0x12, 0x01, 0x00, 0x30, 0x78, 0xff, 0xef, 0x00, 0x00, 0x00, 0x03, 0x00,
+    0x13, 0x04, 0x04, 0x12, 0x00, 0xf0, 0x15, 0x04, 0x02, 0x09, 0x00, 0x20, 0x13, 0x0d, 0x02, 0x09,
+    0x00, 0x20, 0x26, 0x00, 0x00, 0x00, 0x3a, 0xff, 0x02, 0x00, 0x00, 0x01, 0x13, 0x03, 0x00, 0xf0,
+    0x00, 0x02, 0x13, 0x01, 0x00, 0x30, 0xb0, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x02, 0x00, 0x05, 0x00,
+    0x0f, 0x04, 0x00, 0xf0, 0x05, 0x02, 0x0f, 0x02, 0x00, 0x20, 0xec, 0xfe, 0xb9, 0x00, 0xd1, 0xff,
+    0x02, 0x00, 0x05, 0x02, 0x0e, 0x05, 0x00, 0xf0, 0x0c, 0x02, 0x07, 0x05, 0x00, 0x20, 0x04, 0xfb,
+    0x00, 0x01, 0x08, 0x00, 0x02, 0x00, 0x01, 0x02, 0x16, 0x0e, 0x00, 0xf0, 0x01, 0x02, 0x0b, 0x0e,
+    0x00, 0x20, 0x79, 0x00, 0xf5, 0xff, 0xb9, 0xfe, 0x02, 0x00, 0x08, 0x0f, 0x06, 0x09, 0x00, 0xf0,
+    0x0a, 0x0f, 0x02, 0x09, 0x00, 0x30, 0x2b, 0x00, 0x03, 0x00, 0xaa, 0x00, 0x02, 0x00, 0x06, 0x11,
+    0x12, 0x03, 0x00, 0xf0, 0x06, 0x12, 0x12, 0x01, 0x00, 0x30, 0x8a, 0xff, 0x0f, 0xff, 0xfb, 0xff,
+    0x02, 0x00, 0x09, 0x06, 0x03, 0x12, 0x00, 0xf0, 0x09, 0x0c, 0x03, 0x06, 0x00, 0x30, 0xe9, 0xff,
+    0x91, 0xff, 0x3b, 0x00, 0x02, 0x00, 0x02, 0x00, 0x14, 0x03, 0x00, 0xf0, 0x02, 0x01, 0x14, 0x01,
+    0x00, 0x30, 0x74, 0x00, 0xd3, 0xff, 0xdb, 0x00, 0x02, 0x00, 0x05, 0x04, 0x05, 0x0c, 0x00, 0xf0,
+    0x05, 0x08, 0x05, 0x04, 0x00, 0x30, 0x8a, 0xff, 0x94, 0x00, 0x07, 0x00, 0x02, 0x00, 0x08, 0x06,
+    0x0c, 0x05, 0x00, 0xf0, 0x0c, 0x06, 0x04, 0x05, 0x00, 0x30, 0x66, 0x00, 0xfb, 0xff, 0x09, 0xff,
+    0x03, 0x00, 0x09, 0x0c, 0x06, 0x0c, 0x00, 0xf0, 0x09, 0x0c, 0x03, 0x06, 0x00, 0x20, 0x0c, 0x12,
+    0x03, 0x06, 0x00, 0x20, 0x31, 0x00, 0xdc, 0xff, 0x84, 0x00, 0x03, 0x00, 0x0e, 0x0e, 0x08, 0x0a,
+    0x00, 0xf0, 0x12, 0x0e, 0x04, 0x05, 0x00, 0x20, 0x0e, 0x13, 0x04, 0x05, 0x00, 0x20, 0x52, 0xff,
+    0xf9, 0x00, 0xd2, 0xff, 0x03, 0x00, 0x02, 0x0e, 0x08, 0x0a, 0x00, 0xf0, 0x02, 0x0e, 0x04, 0x05,
+    0x00, 0x20, 0x06, 0x13, 0x04, 0x05, 0x00, 0x20, 0x2a, 0x00, 0xeb, 0xff, 0x51, 0x00, 0x03, 0x00,
+    0x0a, 0x12, 0x0c, 0x06, 0x00, 0xf0, 0x10, 0x12, 0x06, 0x03, 0x00, 0x20, 0x0a, 0x15, 0x06, 0x03,
+    0x00, 0x20, 0xe5, 0xfe, 0xef, 0xfd, 0xf1, 0xff, 0x02, 0x00, 0x01, 0x03, 0x06, 0x09, 0x00, 0xf0,
+    0x01, 0x06, 0x06, 0x03, 0x00, 0x30, 0xed, 0xff, 0x70, 0x00, 0x05, 0x00, 0x02, 0x00, 0x0b, 0x03,
+    0x03, 0x14, 0x00, 0xf0, 0x0c, 0x03, 0x01, 0x14, 0x00, 0x30, 0xc7, 0xff, 0x49, 0x00, 0xb6, 0xff,
+    0x03, 0x00, 0x04, 0x06, 0x0e, 0x06, 0x00, 0xf0, 0x04, 0x06, 0x07, 0x03, 0x00, 0x20, 0x0b, 0x09,
+    0x07, 0x03, 0x00, 0x20, 0xc2, 0xff, 0x6e, 0xff, 0x3b, 0x00, 0x02, 0x00, 0x06, 0x05, 0x0c, 0x0d,
+    0x00, 0xf0, 0x0a, 0x05, 0x04, 0x0d, 0x00, 0x30, 0xd7, 0xff, 0x58, 0x00, 0xbe, 0xff, 0x02, 0x00,
+    0x05, 0x04, 0x04, 0x0f, 0x00, 0xf0, 0x05, 0x09, 0x04, 0x05, 0x00, 0x30, 0x30, 0xff, 0x8f, 0x00,
+    0x0f, 0x00, 0x02, 0x00, 0x09, 0x10, 0x0f, 0x04, 0x00, 0xf0, 0x0e, 0x10, 0x05, 0x04, 0x00, 0x30,
+    0x7d, 0x00, 0xdb, 0xff, 0xa3, 0x01, 0x03, 0x00, 0x07, 0x08, 0x06, 0x0e, 0x00, 0xf0, 0x07, 0x08,
+    0x03, 0x07, 0x00, 0x20, 0x0a, 0x0f, 0x03, 0x07, 0x00, 0x20, 0xd3, 0xff, 0x3d, 0x00, 0x8e, 0xff,
+    0x02, 0x00, 0x07, 0x06, 0x0a, 0x06, 0x00, 0xf0, 0x07, 0x08, 0x0a, 0x02, 0x00, 0x30, 0xe7, 0xff,
+    0x6e, 0x00, 0xc4, 0xff, 0x02, 0x00, 0x02, 0x05, 0x12, 0x03, 0x00, 0xf0, 0x02, 0x06, 0x12, 0x01,
+    0x00, 0x30, 0x41, 0x01, 0x05, 0x00, 0xce, 0x00, 0x02, 0x00, 0x05, 0x01, 0x0f, 0x08, 0x00, 0xf0,
+    0x05, 0x05, 0x0f, 0x04, 0x00, 0x20, 0xd7, 0xff, 0x2e, 0x00, 0xac, 0xff, 0x02, 0x00, 0x07, 0x01,
+    0x08, 0x12, 0x00, 0xf0, 0x07, 0x0a, 0x08, 0x09, 0x00, 0x20, 0x7f, 0x00, 0x26, 0x00, 0x95, 0xfe,
+    0x02, 0x00, 0x00, 0x0a, 0x18, 0x03, 0x00, 0xf0, 0x00, 0x0b, 0x18, 0x01, 0x00, 0x30, 0xa4, 0x00,
+    0xce, 0xff, 0x95, 0x00, 0x02, 0x00, 0x00, 0x02, 0x06, 0x0d, 0x00, 0xf0, 0x02, 0x02, 0x02, 0x0d,
+    0x00, 0x30, 0x42, 0x00, 0x00, 0x00, 0x63, 0x00, 0x03, 0x00, 0x10, 0x00, 0x08, 0x0a, 0x00, 0xf0,
+    0x14, 0x00, 0x04, 0x05, 0x00, 0x20, 0x10, 0x05, 0x04, 0x05, 0x00, 0x20, 0x46, 0xff, 0x43, 0x01,
+    0xd8, 0xff, 0x02, 0x00, 0x05, 0x01, 0x0a, 0x09, 0x00, 0xf0, 0x05, 0x04, 0x0a, 0x03, 0x00, 0x30,
+    0xb6, 0xff, 0xa6, 0x00, 0x02, 0x00, 0x02, 0x00, 0x05, 0x06, 0x12, 0x03, 0x00, 0xf0, 0x05, 0x07,
+    0x12, 0x01, 0x00, 0x30, 0xc7, 0xff, 0xf8, 0xfe, 0xf8, 0xff, 0x02, 0x00, 0x00, 0x01, 0x18, 0x03,
+    0x00, 0xf0, 0x00, 0x02, 0x18, 0x01, 0x00, 0x30, 0x62, 0xff, 0x86, 0xff, 0x29, 0x00, 0x02, 0x00,
+    0x0b, 0x04, 0x06, 0x0b, 0x00, 0xf0, 0x0d, 0x04, 0x02, 0x0b, 0x00, 0x30, 0x81, 0x00, 0xcb, 0xff,
+    0x8b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x08, 0x0a, 0x00, 0xf0, 0x00, 0x00, 0x04, 0x05, 0x00, 0x20,
+    0x04, 0x05, 0x04, 0x05, 0x00, 0x20, 0xd4, 0xff, 0x84, 0x00, 0xfd, 0xff, 0x02, 0x00, 0x04, 0x10,
+    0x12, 0x03, 0x00, 0xf0, 0x04, 0x11, 0x12, 0x01, 0x00, 0x30, 0x31, 0x00, 0xca, 0xff, 0xc2, 0x00,
+    0x02, 0x00, 0x02, 0x10, 0x12, 0x03, 0x00, 0xf0, 0x02, 0x11, 0x12, 0x01, 0x00, 0x30, 0x21, 0x01,
+    0x2e, 0x00, 0x43, 0xff, 0x03, 0x00, 0x03, 0x00, 0x12, 0x0a, 0x00, 0xf0, 0x0c, 0x00, 0x09, 0x05,
+    0x00, 0x20, 0x03, 0x05, 0x09, 0x05, 0x00, 0x20, 0x80, 0x08, 0xdb, 0xff, 0x89, 0x01, 0x02, 0x00,
+    0x02, 0x03, 0x14, 0x15, 0x00, 0xf0, 0x0c, 0x03, 0x0a, 0x15, 0x00, 0x20, 0xc4, 0xff, 0xb8, 0xff,
+    0x34, 0x00, 0x02, 0x00, 0x06, 0x07, 0x0e, 0x03, 0x00, 0xf0, 0x06, 0x07, 0x07, 0x03, 0x00, 0x20,
+    0xf7, 0xff, 0x8e, 0xff, 0x0d, 0x00, 0x03, 0x00, 0x00, 0x09, 0x0c, 0x06, 0x00, 0xf0, 0x00, 0x09,
+    0x06, 0x03, 0x00, 0x20, 0x06, 0x0c, 0x06, 0x03, 0x00, 0x20, 0xcc, 0x00, 0x0a, 0x00, 0x4b, 0x00,
+    0x02, 0x00, 0x03, 0x0e, 0x15, 0x04, 0x00, 0xf0, 0x0a, 0x0e, 0x07, 0x04, 0x00, 0x30, 0x3d, 0xff,
+    0x65, 0x00, 0xb8, 0xff, 0x02, 0x00, 0x00, 0x0e, 0x15, 0x04, 0x00, 0xf0, 0x07, 0x0e, 0x07, 0x04,
+    0x00, 0x30, 0x8a, 0xfe, 0x33, 0x02, 0x16, 0x00, 0x02, 0x00, 0x05, 0x15, 0x12, 0x03, 0x00, 0xf0,
+    0x0b, 0x15, 0x06, 0x03, 0x00, 0x30, 0x9b, 0x00, 0xb9, 0xff, 0x40, 0x00, 0x02, 0x00, 0x01, 0x15,
+    0x12, 0x03, 0x00, 0xf0, 0x07, 0x15, 0x06, 0x03, 0x00, 0x30, 0xc1, 0xff, 0x57, 0x00, 0x04, 0x00,
+    0x03, 0x00, 0x13, 0x04, 0x04, 0x12, 0x00, 0xf0, 0x15, 0x04, 0x02, 0x09, 0x00, 0x20, 0x13, 0x0d,
+    0x02, 0x09, 0x00, 0x20, 0xc1, 0xff, 0x49, 0x00, 0xc0, 0xff, 0x02, 0x00, 0x03, 0x07, 0x12, 0x03,
+    0x00, 0xf0, 0x03, 0x08, 0x12, 0x01, 0x00, 0x30, 0x15, 0xff, 0xa3, 0x00, 0x16, 0x00, 0x03, 0x00,
+    0x13, 0x04, 0x04, 0x12, 0x00, 0xf0, 0x15, 0x04, 0x02, 0x09, 0x00, 0x20, 0x13, 0x0d, 0x02, 0x09,
+    0x00, 0x20, 0xe8, 0xff, 0x14, 0x00, 0x98, 0xff, 0x02, 0x00, 0x07, 0x0f, 0x0a, 0x06, 0x00, 0xf0,
+    0x07, 0x11, 0x0a, 0x02, 0x00, 0x30, 0xe2, 0xfe, 0x8e, 0xff, 0x2c, 0x00, 0x02, 0x00, 0x09, 0x0d,
+    0x0b, 0x09, 0x00, 0xf0, 0x09, 0x10, 0x0b, 0x03, 0x00, 0x30, 0x9a, 0xff, 0x05, 0xff, 0xf7, 0xff,
+    0x02, 0x00, 0x00, 0x06, 0x04, 0x0a, 0x00, 0xf0, 0x00, 0x0b, 0x04, 0x05, 0x00, 0x20, 0x46, 0x00,
+    0x3a, 0x00, 0x32, 0xff, 0x02, 0x00, 0x0f, 0x10, 0x09, 0x06, 0x00, 0xf0, 0x0f, 0x12, 0x09, 0x02,
+    0x00, 0x30, 0x4b, 0xff, 0xd6, 0x00, 0xd4, 0xff, 0x03, 0x00, 0x01, 0x05, 0x04, 0x12, 0x00, 0xf0,
+    0x01, 0x05, 0x02, 0x09, 0x00, 0x20, 0x03, 0x0e, 0x02, 0x09, 0x00, 0x20, 0xb4, 0x00, 0x1d, 0x00,
+    0x09, 0xfe, 0x03, 0x00, 0x09, 0x08, 0x08, 0x0a, 0x00, 0xf0, 0x0d, 0x08, 0x04, 0x05, 0x00, 0x20,
+    0x09, 0x0d, 0x04, 0x05, 0x00, 0x20, 0x41, 0x00, 0xf7, 0xff, 0xf9, 0xfe, 0x03, 0x00, 0x07, 0x08,
+    0x08, 0x0a, 0x00, 0xf0, 0x07, 0x08, 0x04, 0x05, 0x00, 0x20, 0x0b, 0x0d, 0x04, 0x05, 0x00, 0x20,
+    0x85, 0xfe, 0xa6, 0xfe, 0x1f, 0x00, 0x02, 0x00, 0x09, 0x08, 0x0c, 0x05, 0x00, 0xf0, 0x0d, 0x08,
+    0x04, 0x05, 0x00, 0x30, 0x22, 0x01, 0xd3, 0xff, 0xbe, 0x00, 0x02, 0x00, 0x07, 0x08, 0x09, 0x07,
+    0x00, 0xf0, 0x0a, 0x08, 0x03, 0x07, 0x00, 0x30, 0xec, 0x00, 0x20, 0x00, 0x8f, 0xff, 0x02, 0x00,
+    0x09, 0x08, 0x0c, 0x05, 0x00, 0xf0, 0x0d, 0x08, 0x04, 0x05, 0x00, 0x30, 0xbd, 0xff, 0xcd, 0x00,
+    0xd4, 0xff, 0x02, 0x00, 0x07, 0x06, 0x09, 0x07, 0x00, 0xf0, 0x0a, 0x06, 0x03, 0x07, 0x00, 0x30,
+    0x62, 0x00, 0x29, 0x00, 0xe1, 0xff, 0x02, 0x00, 0x09, 0x08, 0x0c, 0x05, 0x00, 0xf0, 0x0d, 0x08,
+    0x04, 0x05, 0x00, 0x30, 0x33, 0x00, 0x27, 0x00, 0xab, 0xff, 0x02, 0x00, 0x0a, 0x05, 0x04, 0x12,
+    0x00, 0xf0, 0x0a, 0x0b, 0x04, 0x06, 0x00, 0x30, 0x22, 0xff, 0x29, 0xfe, 0x25, 0x00, 0x02, 0x00,
+    0x05, 0x05, 0x0e, 0x0c, 0x00, 0xf0, 0x05, 0x0b, 0x0e, 0x06, 0x00, 0x20, 0xca, 0xff, 0x32, 0xff,
+    0xf9, 0xff, 0x02, 0x00, 0x00, 0x01, 0x0b, 0x04, 0x00, 0xf0, 0x00, 0x03, 0x0b, 0x02, 0x00, 0x20,
+    0x19, 0x00, 0xdd, 0xff, 0x54, 0x00, 0x02, 0x00, 0x09, 0x0a, 0x06, 0x0a, 0x00, 0xf0, 0x0b, 0x0a,
+    0x02, 0x0a, 0x00, 0x30, 0x76, 0x00, 0xfa, 0xff, 0x2b, 0xff, 0x02, 0x00, 0x02, 0x11, 0x0b, 0x06,
+    0x00, 0xf0, 0x02, 0x13, 0x0b, 0x02, 0x00, 0x30, 0xa6, 0xff, 0x44, 0xff, 0x2d, 0x00, 0x02, 0x00,
+    0x0f, 0x10, 0x09, 0x06, 0x00, 0xf0, 0x0f, 0x12, 0x09, 0x02, 0x00, 0x30, 0x15, 0x00, 0x8c, 0xff,
+    0x11, 0x00, 0x02, 0x00, 0x01, 0x0a, 0x12, 0x02, 0x00, 0xf0, 0x01, 0x0b, 0x12, 0x01, 0x00, 0x20,
+    0x60, 0x01, 0x35, 0x00, 0xa0, 0xff, 0x02, 0x00, 0x06, 0x04, 0x0c, 0x0d, 0x00, 0xf0, 0x0a, 0x04,
+    0x04, 0x0d, 0x00, 0x30, 0xdd, 0xff, 0x66, 0x00, 0xcb, 0xff, 0x02, 0x00, 0x00, 0x12, 0x12, 0x03,
+    0x00, 0xf0, 0x00, 0x13, 0x12, 0x01, 0x00, 0x30, 0x1b, 0x00, 0xfb, 0xff, 0x74, 0x00, 0x02, 0x00,
+    0x06, 0x12, 0x12, 0x03, 0x00, 0xf0, 0x06, 0x13, 0x12, 0x01, 0x00, 0x30, 0xe6, 0xff, 0x81, 0xff,
+    0x13, 0x00, 0x02, 0x00, 0x00, 0x10, 0x09, 0x06, 0x00, 0xf0, 0x00, 0x12, 0x09, 0x02, 0x00, 0x30,
+    0x24, 0x00, 0x2d, 0x00, 0xb8, 0xff, 0x02, 0x00, 0x0d, 0x0f, 0x09, 0x06, 0x00, 0xf0, 0x0d, 0x11,
+    0x09, 0x02, 0x00, 0x30, 0x0d, 0x00, 0x0b, 0x00, 0x73, 0xff, 0x02, 0x00, 0x02, 0x0f, 0x09, 0x06,
+    0x00, 0xf0, 0x02, 0x11, 0x09, 0x02, 0x00, 0x30, 0xa9, 0x00, 0x2c, 0x00, 0xcb, 0xff, 0x02, 0x00,
+    0x0d, 0x01, 0x06, 0x10, 0x00, 0xf0, 0x0d, 0x01, 0x03, 0x10, 0x00, 0x20, 0xe5, 0xff, 0x8a, 0xff,
+    0x11, 0x00, 0x02, 0x00, 0x05, 0x01, 0x06, 0x10, 0x00, 0xf0, 0x08, 0x01, 0x03, 0x10, 0x00, 0x20,
+    0x7d, 0x00, 0x0d, 0x00, 0xc1, 0x00, 0x02, 0x00, 0x0b, 0x05, 0x06, 0x0a, 0x00, 0xf0, 0x0d, 0x05,
+    0x02, 0x0a, 0x00, 0x30, 0xe2, 0xff, 0x26, 0x00, 0xaf, 0xff, 0x02, 0x00, 0x07, 0x05, 0x06, 0x0a,
+    0x00, 0xf0, 0x09, 0x05, 0x02, 0x0a, 0x00, 0x30, 0x6c, 0x01, 0x23, 0x00, 0xdd, 0xfe, 0x02, 0x00,
+    0x0a, 0x00, 0x06, 0x18, 0x00, 0xf0, 0x0c, 0x00, 0x02, 0x18, 0x00, 0x30, 0x1d, 0x00, 0xb7, 0xff,
+    0x30, 0x00, 0x03, 0x00, 0x03, 0x04, 0x04, 0x14, 0x00, 0xf0, 0x03, 0x04, 0x02, 0x0a, 0x00, 0x20,
+    0x05, 0x0e, 0x02, 0x0a, 0x00, 0x20, 0xb6, 0xff, 0xb3, 0xff, 0x2a, 0x00, 0x02, 0x00, 0x0e, 0x00,
+    0x06, 0x09, 0x00, 0xf0, 0x10, 0x00, 0x02, 0x09, 0x00, 0x30, 0x97, 0xff, 0x05, 0xff, 0xfb, 0xff,
+    0x02, 0x00, 0x04, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x06, 0x00, 0x02, 0x09, 0x00, 0x30, 0xbf, 0x01,
+    0x0c, 0x00, 0x87, 0x00, 0x02, 0x00, 0x04, 0x05, 0x12, 0x05, 0x00, 0xf0, 0x0a, 0x05, 0x06, 0x05,
+    0x00, 0x30, 0xd2, 0xff, 0x3c, 0x00, 0xb9, 0xff, 0x02, 0x00, 0x05, 0x06, 0x06, 0x09, 0x00, 0xf0,
+    0x07, 0x06, 0x02, 0x09, 0x00, 0x30, 0x15, 0xff, 0x78, 0x00, 0x10, 0x00, 0x02, 0x00, 0x07, 0x02,
+    0x0f, 0x08, 0x00, 0xf0, 0x0c, 0x02, 0x05, 0x08, 0x00, 0x30, 0xa4, 0x01, 0xcb, 0xff, 0x82, 0x00,
+    0x02, 0x00, 0x02, 0x02, 0x0f, 0x08, 0x00, 0xf0, 0x07, 0x02, 0x05, 0x08, 0x00, 0x30, 0x6e, 0x00,
+    0x2a, 0x00, 0x8d, 0xfe, 0x02, 0x00, 0x0a, 0x00, 0x04, 0x09, 0x00, 0xf0, 0x0a, 0x00, 0x02, 0x09,
+    0x00, 0x20, 0xc9, 0xff, 0x70, 0xff, 0x06, 0x00, 0x03, 0x00, 0x03, 0x04, 0x06, 0x0c, 0x00, 0xf0,
+    0x03, 0x04, 0x03, 0x06, 0x00, 0x20, 0x06, 0x0a, 0x03, 0x06, 0x00, 0x20, 0xdb, 0xfa, 0x71, 0xfc,
+    0x1e, 0x00, 0x02, 0x00, 0x10, 0x00, 0x08, 0x12, 0x00, 0xf0, 0x10, 0x00, 0x04, 0x12, 0x00, 0x20,
+    0x45, 0x03, 0xf7, 0xff, 0xfb, 0xfe, 0x02, 0x00, 0x00, 0x00, 0x08, 0x12, 0x00, 0xf0, 0x04, 0x00,
+    0x04, 0x12, 0x00, 0x20, 0xe0, 0xfe, 0x70, 0xff, 0x2f, 0x00, 0x02, 0x00, 0x00, 0x07, 0x18, 0x06,
+    0x00, 0xf0, 0x00, 0x09, 0x18, 0x02, 0x00, 0x30, 0x9a, 0x00, 0xf9, 0xff, 0x2c, 0xff, 0x02, 0x00,
+    0x04, 0x07, 0x0e, 0x03, 0x00, 0xf0, 0x0b, 0x07, 0x07, 0x03, 0x00, 0x20, 0xe1, 0xfe, 0x78, 0xff,
+    0x24, 0x00, 0x02, 0x00, 0x0a, 0x08, 0x08, 0x0f, 0x00, 0xf0, 0x0a, 0x08, 0x04, 0x0f, 0x00, 0x20,
+    0x02, 0x01, 0xc8, 0xff, 0x7a, 0x00, 0x02, 0x00, 0x07, 0x00, 0x0a, 0x0e, 0x00, 0xf0, 0x0c, 0x00,
+    0x05, 0x0e, 0x00, 0x20, 0x95, 0x00, 0x24, 0x00, 0x64, 0xff, 0x03, 0x00, 0x0d, 0x0a, 0x08, 0x0a,
+    0x00, 0xf0, 0x11, 0x0a, 0x04, 0x05, 0x00, 0x20, 0x0d, 0x0f, 0x04, 0x05, 0x00, 0x20, 0x10, 0x00,
+    0xa8, 0xff, 0x1e, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x09, 0x00, 0xf0, 0x05, 0x00, 0x02, 0x09,
+    0x00, 0x20, 0x37, 0xff, 0xf5, 0x00, 0x10, 0x00, 0x02, 0x00, 0x10, 0x01, 0x06, 0x08, 0x00, 0xf0,
+    0x10, 0x01, 0x03, 0x08, 0x00, 0x20, 0xdb, 0xfe, 0xbd, 0x01, 0xdc, 0xff, 0x02, 0x00, 0x02, 0x01,
+    0x06, 0x08, 0x00, 0xf0, 0x05, 0x01, 0x03, 0x08, 0x00, 0x20, 0x65, 0xff, 0x63, 0x01, 0x10, 0x00,
+    0x02, 0x00, 0x03, 0x06, 0x12, 0x0c, 0x00, 0xf0, 0x03, 0x0a, 0x12, 0x04, 0x00, 0x30, 0xf4, 0xff,
+    0x0d, 0x00, 0x76, 0xff, 0x02, 0x00, 0x04, 0x0c, 0x10, 0x04, 0x00, 0xf0, 0x04, 0x0e, 0x10, 0x02,
+    0x00, 0x20, 0x4f, 0x00, 0xe9, 0xff, 0x64, 0x00, 0x02, 0x00, 0x04, 0x09, 0x10, 0x0f, 0x00, 0xf0,
+    0x04, 0x0e, 0x10, 0x05, 0x00, 0x30, 0x2e, 0x00, 0x09, 0x00, 0x76, 0xff, 0x03, 0x00, 0x03, 0x0a,
+    0x08, 0x0a, 0x00, 0xf0, 0x03, 0x0a, 0x04, 0x05, 0x00, 0x20, 0x07, 0x0f, 0x04, 0x05, 0x00, 0x20,
+    0x77, 0xff, 0xf3, 0x00, 0x09, 0x00, 0x03, 0x00, 0x08, 0x12, 0x10, 0x06, 0x00, 0xf0, 0x10, 0x12,
+    0x08, 0x03, 0x00, 0x20, 0x08, 0x15, 0x08, 0x03, 0x00, 0x20, 0x78, 0x01, 0xde, 0xff, 0x4a, 0x02,
+    0x02, 0x00, 0x02, 0x10, 0x0c, 0x05, 0x00, 0xf0, 0x06, 0x10, 0x04, 0x05, 0x00, 0x30, 0x0f, 0x00,
+    0x3a, 0x00, 0x67, 0xff, 0x02, 0x00, 0x0e, 0x0e, 0x09, 0x04, 0x00, 0xf0, 0x0e, 0x10, 0x09, 0x02,
+    0x00, 0x20, 0x34, 0x00, 0xc8, 0xff, 0x5f, 0x00, 0x02, 0x00, 0x07, 0x0e, 0x09, 0x06, 0x00, 0xf0,
+    0x07, 0x10, 0x09, 0x02, 0x00, 0x30, 0xb6, 0xfd, 0x49, 0x01, 0x0c, 0x00, 0x02, 0x00, 0x04, 0x0a,
+    0x10, 0x0c, 0x00, 0xf0, 0x04, 0x0e, 0x10, 0x04, 0x00, 0x30, 0x74, 0xfe, 0x0c, 0xfc, 0xee, 0xff,
+    0x02, 0x00, 0x00, 0x0d, 0x13, 0x06, 0x00, 0xf0, 0x00, 0x0f, 0x13, 0x02, 0x00, 0x30, 0xdc, 0xff,
+    0x60, 0x00, 0xf5, 0xff, 0x02, 0x00, 0x0a, 0x0d, 0x09, 0x06, 0x00, 0xf0, 0x0a, 0x0f, 0x09, 0x02,
+    0x00, 0x30, 0x41, 0x00, 0xfa, 0xff, 0x34, 0xff, 0x02, 0x00, 0x05, 0x00, 0x03, 0x17, 0x00, 0xf0,
+    0x06, 0x00, 0x01, 0x17, 0x00, 0x30, 0x20, 0x01, 0x2b, 0x00, 0x5f, 0xff, 0x02, 0x00, 0x00, 0x08,
+    0x18, 0x06, 0x00, 0xf0, 0x00, 0x0a, 0x18, 0x02, 0x00, 0x30, 0x65, 0xff, 0x11, 0xff, 0xf6, 0xff,
+    0x02, 0x00, 0x00, 0x05, 0x05, 0x0c, 0x00, 0xf0, 0x00, 0x09, 0x05, 0x04, 0x00, 0x30, 0x41, 0x08,
+    0x21, 0x00, 0x6c, 0xfe, 0x02, 0x00, 0x03, 0x00, 0x13, 0x12, 0x00, 0xf0, 0x03, 0x09, 0x13, 0x09,
+    0x00, 0x20, 0x7a, 0xff, 0xdc, 0xfe, 0xf4, 0xff, 0x03, 0x00, 0x09, 0x0b, 0x06, 0x0c, 0x00, 0xf0,
+    0x09, 0x0b, 0x03, 0x06, 0x00, 0x20, 0x0c, 0x11, 0x03, 0x06, 0x00, 0x20, 0x6c, 0xff, 0x7e, 0x00,
+    0xf8, 0xff, 0x03, 0x00, 0x00, 0x05, 0x18, 0x08, 0x00, 0xf0, 0x0c, 0x05, 0x0c, 0x04, 0x00, 0x20,
+    0x00, 0x09, 0x0c, 0x04, 0x00, 0x20, 0x1b, 0x00, 0xb1, 0xff, 0x2b, 0x00, 0x02, 0x00, 0x06, 0x12,
+    0x09, 0x04, 0x00, 0xf0, 0x06, 0x14, 0x09, 0x02, 0x00, 0x20, 0xbe, 0xff, 0x9f, 0xff, 0x29, 0x00,
+    0x02, 0x00, 0x08, 0x08, 0x0a, 0x06, 0x00, 0xf0, 0x08, 0x0a, 0x0a, 0x02, 0x00, 0x30, 0x22, 0x00,
+    0xd1, 0xff, 0x90, 0x00, 0x02, 0x00, 0x02, 0x07, 0x14, 0x03, 0x00, 0xf0, 0x02, 0x08, 0x14, 0x01,
+    0x00, 0x30, 0xcd, 0xfd, 0x69, 0xff, 0x1e, 0x00, 0x02, 0x00, 0x0c, 0x00, 0x07, 0x14, 0x00, 0xf0,
+    0x0c, 0x0a, 0x07, 0x0a, 0x00, 0x20, 0xd4, 0x02, 0xd9, 0xff, 0xed, 0x00, 0x02, 0x00, 0x05, 0x00,
+    0x07, 0x14, 0x00, 0xf0, 0x05, 0x0a, 0x07, 0x0a, 0x00, 0x20, 0x20, 0x00, 0x52, 0x00, 0xd7, 0xff,
+    0x02, 0x00, 0x0e, 0x02, 0x02, 0x12, 0x00, 0xf0, 0x0e, 0x0b, 0x02, 0x09, 0x00, 0x20, 0xc1, 0x01,
+    0xd8, 0xff, 0x04, 0x01, 0x02, 0x00, 0x05, 0x08, 0x0a, 0x0c, 0x00, 0xf0, 0x0a, 0x08, 0x05, 0x0c,
+    0x00, 0x20, 0x84, 0xff, 0xc1, 0x00, 0x08, 0x00, 0x03, 0x00, 0x06, 0x09, 0x0c, 0x08, 0x00, 0xf0,
+    0x0c, 0x09, 0x06, 0x04, 0x00, 0x20, 0x06, 0x0d, 0x06, 0x04, 0x00, 0x20, 0xa2, 0xff, 0x1e, 0xff,
+    0xfe, 0xff, 0x02, 0x00, 0x07, 0x07, 0x03, 0x0e, 0x00, 0xf0, 0x07, 0x0e, 0x03, 0x07, 0x00, 0x20,
+    0xf4, 0xff, 0x3d, 0x00, 0xe3, 0xff, 0x03, 0x00, 0x0b, 0x02, 0x0c, 0x10, 0x00, 0xf0, 0x11, 0x02,
+    0x06, 0x08, 0x00, 0x20, 0x0b, 0x0a, 0x06, 0x08, 0x00, 0x20, 0x78, 0xff, 0x21, 0xfe, 0xef, 0xff,
+    0x02, 0x00, 0x07, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x09, 0x00, 0x02, 0x09, 0x00, 0x30, 0x36, 0x00,
+    0x21, 0x00, 0x54, 0xff, 0x02, 0x00, 0x0d, 0x0e, 0x09, 0x04, 0x00, 0xf0, 0x0d, 0x10, 0x09, 0x02,
+    0x00, 0x20, 0x3c, 0x00, 0xfa, 0xff, 0x42, 0xff, 0x03, 0x00, 0x00, 0x0c, 0x16, 0x04, 0x00, 0xf0,
+    0x00, 0x0c, 0x0b, 0x02, 0x00, 0x20, 0x0b, 0x0e, 0x0b, 0x02, 0x00, 0x20, 0xca, 0xff, 0x77, 0x00,
+    0xfa, 0xff, 0x03, 0x00, 0x01, 0x0c, 0x16, 0x06, 0x00, 0xf0, 0x0c, 0x0c, 0x0b, 0x03, 0x00, 0x20,
+    0x01, 0x0f, 0x0b, 0x03, 0x00, 0x20, 0xbe, 0xff, 0x66, 0x00, 0xca, 0xff, 0x02, 0x00, 0x06, 0x06,
+    0x09, 0x06, 0x00, 0xf0, 0x09, 0x06, 0x03, 0x06, 0x00, 0x30, 0x8a, 0xff, 0x70, 0xfe, 0x24, 0x00,
+    0x02, 0x00, 0x0a, 0x00, 0x04, 0x09, 0x00, 0xf0, 0x0a, 0x00, 0x02, 0x09, 0x00, 0x20, 0x61, 0xfe,
+    0x14, 0xfe, 0xef, 0xff, 0x02, 0x00, 0x03, 0x08, 0x12, 0x07, 0x00, 0xf0, 0x09, 0x08, 0x06, 0x07,
+    0x00, 0x30, 0x9a, 0x00, 0x22, 0x00, 0xbd, 0xfd, 0x02, 0x00, 0x00, 0x06, 0x18, 0x06, 0x00, 0xf0,
+    0x00, 0x08, 0x18, 0x02, 0x00, 0x30, 0x6f, 0xfb, 0x05, 0x01, 0xda, 0xff, 0x02, 0x00, 0x00, 0x0b,
+    0x18, 0x0a, 0x00, 0xf0, 0x08, 0x0b, 0x08, 0x0a, 0x00, 0x30, 0x75, 0x02, 0xe8, 0xff, 0x6a, 0x00,
+    0x02, 0x00, 0x03, 0x03, 0x12, 0x15, 0x00, 0xf0, 0x09, 0x03, 0x06, 0x15, 0x00, 0x30, 0x00, 0x00,
+    0x1c, 0x00, 0x96, 0xff, 0x02, 0x00, 0x07, 0x0c, 0x04, 0x0a, 0x00, 0xf0, 0x09, 0x0c, 0x02, 0x0a,
+    0x00, 0x20, 0xac, 0xff, 0x9a, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x0a, 0x10, 0x0a, 0x08, 0x00, 0xf0,
+    0x0f, 0x10, 0x05, 0x04, 0x00, 0x20, 0x0a, 0x14, 0x05, 0x04, 0x00, 0x20, 0x99, 0x00, 0xd0, 0xff,
+    0x76, 0x00, 0x02, 0x00, 0x08, 0x06, 0x06, 0x09, 0x00, 0xf0, 0x0a, 0x06, 0x02, 0x09, 0x00, 0x30,
+    0xea, 0x00, 0x1d, 0x00, 0xae, 0xfe, 0x03, 0x00, 0x0c, 0x0a, 0x06, 0x0c, 0x00, 0xf0, 0x0f, 0x0a,
+    0x03, 0x06, 0x00, 0x20, 0x0c, 0x10, 0x03, 0x06, 0x00, 0x20, 0x14, 0x00, 0xb9, 0xff, 0x31, 0x00,
+    0x03, 0x00, 0x06, 0x0a, 0x06, 0x0c, 0x00, 0xf0, 0x06, 0x0a, 0x03, 0x06, 0x00, 0x20, 0x09, 0x10,
+    0x03, 0x06, 0x00, 0x20, 0x21, 0xff, 0xb9, 0x00, 0x13, 0x00, 0x03, 0x00, 0x10, 0x0c, 0x06, 0x0c,
+    0x00, 0xf0, 0x13, 0x0c, 0x03, 0x06, 0x00, 0x20, 0x10, 0x12, 0x03, 0x06, 0x00, 0x20, 0x67, 0x00,
+    0xcf, 0xff, 0x75, 0x00, 0x03, 0x00, 0x02, 0x0c, 0x06, 0x0c, 0x00, 0xf0, 0x02, 0x0c, 0x03, 0x06,
+    0x00, 0x20, 0x05, 0x12, 0x03, 0x06, 0x00, 0x20, 0x63, 0x00, 0x27, 0x00, 0x81, 0xff, 0x02, 0x00,
+    0x0a, 0x0f, 0x06, 0x09, 0x00, 0xf0, 0x0c, 0x0f, 0x02, 0x09, 0x00, 0x30, 0x93, 0x00, 0xf2, 0xff,
+    0x76, 0xfe, 0x02, 0x00, 0x08, 0x0f, 0x06, 0x09, 0x00, 0xf0, 0x0a, 0x0f, 0x02, 0x09, 0x00, 0x30,
+    0x67, 0xfe, 0x64, 0xfe, 0x1d, 0x00, 0x02, 0x00, 0x0e, 0x14, 0x0a, 0x04, 0x00, 0xf0, 0x0e, 0x14,
+    0x05, 0x04, 0x00, 0x20, 0x59, 0x01, 0xf1, 0xff, 0x89, 0xfe, 0x02, 0x00, 0x00, 0x14, 0x0a, 0x04,
+    0x00, 0xf0, 0x05, 0x14, 0x05, 0x04, 0x00, 0x20, 0x41, 0x00, 0x29, 0x00, 0xe4, 0xff, 0x02, 0x00,
+    0x0b, 0x11, 0x09, 0x06, 0x00, 0xf0, 0x0b, 0x13, 0x09, 0x02, 0x00, 0x30, 0x8a, 0x00, 0xd3, 0xff,
+    0x92, 0x00, 0x02, 0x00, 0x03, 0x02, 0x0e, 0x04, 0x00, 0xf0, 0x03, 0x04, 0x0e, 0x02, 0x00, 0x20,
+    0x03, 0xff, 0xa6, 0x04, 0x18, 0x00, 0x02, 0x00, 0x0a, 0x01, 0x0a, 0x04, 0x00, 0xf0, 0x0a, 0x03,
+    0x0a, 0x02, 0x00, 0x20, 0x1e, 0x01, 0xd5, 0xff, 0xde, 0x00, 0x02, 0x00, 0x00, 0x0f, 0x0a, 0x04,
+    0x00, 0xf0, 0x05, 0x0f, 0x05, 0x04, 0x00, 0x20, 0x8e, 0xff, 0xe9, 0x00, 0x0e, 0x00, 0x02, 0x00,
+    0x13, 0x02, 0x03, 0x13, 0x00, 0xf0, 0x14, 0x02, 0x01, 0x13, 0x00, 0x30, 0xcc, 0xff, 0x38, 0x00,
+    0xb9, 0xff, 0x02, 0x00, 0x04, 0x0c, 0x09, 0x08, 0x00, 0xf0, 0x07, 0x0c, 0x03, 0x08, 0x00, 0x30,
+    0xbf, 0xfc, 0xc7, 0x00, 0x58, 0x00, 0x1a, 0xff, 0x4b, 0x00, 0x02, 0x00, 0x04, 0x07, 0x05, 0x0c,
+    0x00, 0xf0, 0x04, 0x0b, 0x05, 0x04, 0x00, 0x30, 0x9b, 0x01, 0xa0, 0xff, 0x9b, 0x00, 0x02, 0x00,
+    0x00, 0x01, 0x18, 0x03, 0x00, 0xf0, 0x08, 0x01, 0x08, 0x03, 0x00, 0x30, 0x6a, 0x00, 0x9f, 0xff,
+    0x64, 0x00, 0x02, 0x00, 0x06, 0x08, 0x0c, 0x04, 0x00, 0xf0, 0x06, 0x0a, 0x0c, 0x02, 0x00, 0x20,
+    0x74, 0x00, 0xd2, 0xff, 0x96, 0x00, 0x02, 0x00, 0x13, 0x03, 0x04, 0x0a, 0x00, 0xf0, 0x13, 0x03,
+    0x02, 0x0a, 0x00, 0x20, 0x9e, 0x00, 0xc7, 0xff, 0xa3, 0x00, 0x02, 0x00, 0x00, 0x06, 0x09, 0x06,
+    0x00, 0xf0, 0x03, 0x06, 0x03, 0x06, 0x00, 0x30, 0x42, 0xff, 0xb5, 0x00, 0xdb, 0xff, 0x02, 0x00,
+    0x12, 0x00, 0x06, 0x16, 0x00, 0xf0, 0x14, 0x00, 0x02, 0x16, 0x00, 0x30, 0x51, 0xff, 0x7a, 0x00,
+    0xb6, 0xff, 0x02, 0x00, 0x00, 0x00, 0x06, 0x16, 0x00, 0xf0, 0x02, 0x00, 0x02, 0x16, 0x00, 0x30,
+    0x0f, 0x00, 0xd1, 0xff, 0x86, 0x00, 0x02, 0x00, 0x05, 0x0f, 0x13, 0x03, 0x00, 0xf0, 0x05, 0x10,
+    0x13, 0x01, 0x00, 0x30, 0xad, 0x00, 0x0a, 0x00, 0x1c, 0xff, 0x02, 0x00, 0x0a, 0x07, 0x04, 0x0f,
+    0x00, 0xf0, 0x0a, 0x0c, 0x04, 0x05, 0x00, 0x30, 0x50, 0x00, 0xc5, 0xff, 0x71, 0x00, 0x02, 0x00,
+    0x09, 0x06, 0x06, 0x09, 0x00, 0xf0, 0x0b, 0x06, 0x02, 0x09, 0x00, 0x30, 0x03, 0x00, 0x8b, 0xff,
+    0x2d, 0x00, 0x02, 0x00, 0x00, 0x15, 0x12, 0x03, 0x00, 0xf0, 0x00, 0x16, 0x12, 0x01, 0x00, 0x30,
+    0xef, 0xff, 0x55, 0x00, 0xb4, 0xff, 0x02, 0x00, 0x07, 0x03, 0x0a, 0x0f, 0x00, 0xf0, 0x07, 0x08,
+    0x0a, 0x05, 0x00, 0x30, 0x45, 0x00, 0xd6, 0xff, 0x99, 0x01, 0x02, 0x00, 0x01, 0x07, 0x12, 0x03,
+    0x00, 0xf0, 0x01, 0x08, 0x12, 0x01, 0x00, 0x30, 0x93, 0x00, 0x39, 0x00, 0x78, 0xff, 0x02, 0x00,
+    0x08, 0x02, 0x09, 0x06, 0x00, 0xf0, 0x0b, 0x02, 0x03, 0x06, 0x00, 0x30, 0xde, 0xfe, 0x26, 0x00,
+    0x95, 0xff, 0x02, 0x00, 0x00, 0x0a, 0x18, 0x0e, 0x00, 0xf0, 0x00, 0x11, 0x18, 0x07, 0x00, 0x20,
+    0xfe, 0xfe, 0x84, 0xfe, 0x21, 0x00, 0x03, 0x00, 0x0d, 0x09, 0x08, 0x0a, 0x00, 0xf0, 0x11, 0x09,
+    0x04, 0x05, 0x00, 0x20, 0x0d, 0x0e, 0x04, 0x05, 0x00, 0x20, 0x79, 0x00, 0xcf, 0xff, 0xfb, 0x00,
+    0x02, 0x00, 0x0a, 0x05, 0x04, 0x09, 0x00, 0xf0, 0x0c, 0x05, 0x02, 0x09, 0x00, 0x20, 0x9b, 0x00,
+    0x22, 0x00, 0x70, 0xff, 0x03, 0x00, 0x0d, 0x09, 0x08, 0x0a, 0x00, 0xf0, 0x11, 0x09, 0x04, 0x05,
+    0x00, 0x20, 0x0d, 0x0e, 0x04, 0x05, 0x00, 0x20, 0x78, 0xff, 0xeb, 0xfe, 0xfe, 0xff, 0x03, 0x00,
+    0x07, 0x0b, 0x0a, 0x0a, 0x00, 0xf0, 0x07, 0x0b, 0x05, 0x05, 0x00, 0x20, 0x0c, 0x10, 0x05, 0x05,
+    0x00, 0x20, 0x7f, 0xff, 0x69, 0xff, 0x22, 0x00, 0x03, 0x00, 0x04, 0x0d, 0x12, 0x04, 0x00, 0xf0,
+    0x0d, 0x0d, 0x09, 0x02, 0x00, 0x20, 0x04, 0x0f, 0x09, 0x02, 0x00, 0x20, 0x04, 0x00, 0x83, 0xff,
+    0x18, 0x00, 0x02, 0x00, 0x00, 0x00, 0x13, 0x02, 0x00, 0xf0, 0x00, 0x01, 0x13, 0x01, 0x00, 0x20,
+    0xdb, 0xfe, 0x98, 0x00, 0xf6, 0xff, 0x02, 0x00, 0x00, 0x12, 0x18, 0x06, 0x00, 0xf0, 0x08, 0x12,
+    0x08, 0x06, 0x00, 0x30, 0xb4, 0xfe, 0xd2, 0xfe, 0xf9, 0xff, 0x02, 0x00, 0x06, 0x04, 0x08, 0x10,
+    0x00, 0xf0, 0x06, 0x0c, 0x08, 0x08, 0x00, 0x20, 0x12, 0x00, 0x64, 0xff, 0x39, 0x00, 0x02, 0x00,
+    0x07, 0x08, 0x0a, 0x04, 0x00, 0xf0, 0x07, 0x0a, 0x0a, 0x02, 0x00, 0x20, 0x54, 0xff, 0xdc, 0xfe,
+    0xf9, 0xff, 0x02, 0x00, 0x00, 0x03, 0x06, 0x09, 0x00, 0xf0, 0x00, 0x06, 0x06, 0x03, 0x00, 0x30,
+    0xf4, 0xfe, 0x5b, 0xfe, 0x20, 0x00, 0x02, 0x00, 0x0d, 0x0f, 0x07, 0x09, 0x00, 0xf0, 0x0d, 0x12,
+    0x07, 0x03, 0x00, 0x30, 0x4a, 0x00, 0xb1, 0xff, 0x41, 0x00, 0x03, 0x00, 0x03, 0x12, 0x0c, 0x06,
+    0x00, 0xf0, 0x03, 0x12, 0x06, 0x03, 0x00, 0x20, 0x09, 0x15, 0x06, 0x03, 0x00, 0x20, 0x2d, 0xff,
+    0x4f, 0xff, 0x27, 0x00, 0x02, 0x00, 0x0c, 0x0e, 0x06, 0x09, 0x00, 0xf0, 0x0c, 0x11, 0x06, 0x03,
+    0x00, 0x30, 0x3f, 0xff, 0x49, 0xff, 0x00, 0x00, 0x02, 0x00, 0x02, 0x0f, 0x0f, 0x08, 0x00, 0xf0,
+    0x02, 0x13, 0x0f, 0x04, 0x00, 0x20, 0x47, 0x00, 0x39, 0x00, 0x73, 0xff, 0x02, 0x00, 0x09, 0x06,
+    0x06, 0x10, 0x00, 0xf0, 0x09, 0x0e, 0x06, 0x08, 0x00, 0x20, 0x99, 0xff, 0x08, 0x01, 0xd4, 0xff,
+    0x02, 0x00, 0x06, 0x06, 0x07, 0x0c, 0x00, 0xf0, 0x06, 0x0a, 0x07, 0x04, 0x00, 0x30, 0x5a, 0xff,
+    0x73, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x0e, 0x06, 0x06, 0x09, 0x00, 0xf0, 0x0e, 0x09, 0x06, 0x03,
+    0x00, 0x30, 0x66, 0xff, 0x26, 0xff, 0xfd, 0xff, 0x02, 0x00, 0x05, 0x0e, 0x06, 0x09, 0x00, 0xf0,
+    0x05, 0x11, 0x06, 0x03, 0x00, 0x30, 0xca, 0xff, 0x94, 0x00, 0xfc, 0xff, 0x02, 0x00, 0x0a, 0x08,
+    0x06, 0x09, 0x00, 0xf0, 0x0c, 0x08, 0x02, 0x09, 0x00, 0x30, 0x00, 0x00, 0xa0, 0xff, 0x23, 0x00,
+    0x03, 0x00, 0x06, 0x06, 0x04, 0x12, 0x00, 0xf0, 0x06, 0x06, 0x02, 0x09, 0x00, 0x20, 0x08, 0x0f,
+    0x02, 0x09, 0x00, 0x20, 0xd2, 0xff, 0xbd, 0xff, 0x3c, 0x00, 0x03, 0x00, 0x0e, 0x09, 0x06, 0x0c,
+    0x00, 0xf0, 0x11, 0x09, 0x03, 0x06, 0x00, 0x20, 0x0e, 0x0f, 0x03, 0x06, 0x00, 0x20, 0x98, 0x00,
+    0xf9, 0xff, 0xb5, 0xfe, 0x03, 0x00, 0x04, 0x09, 0x06, 0x0c, 0x00, 0xf0, 0x04, 0x09, 0x03, 0x06,
+    0x00, 0x20, 0x07, 0x0f, 0x03, 0x06, 0x00, 0x20, 0x0d, 0x00, 0x34, 0x00, 0xd1, 0xff, 0x02, 0x00,
+    0x0e, 0x0f, 0x09, 0x06, 0x00, 0xf0, 0x0e, 0x11, 0x09, 0x02, 0x00, 0x30, 0xa4, 0xff, 0xab, 0x00,
+    0xce, 0xff, 0x03, 0x00, 0x00, 0x14, 0x12, 0x04, 0x00, 0xf0, 0x00, 0x14, 0x09, 0x02, 0x00, 0x20,
+    0x09, 0x16, 0x09, 0x02, 0x00, 0x20, 0x5f, 0x00, 0x2c, 0x00, 0xad, 0xff, 0x02, 0x00, 0x0d, 0x12,
+    0x09, 0x06, 0x00, 0xf0, 0x0d, 0x14, 0x09, 0x02, 0x00, 0x30, 0xc7, 0xff, 0x2a, 0xff, 0xff, 0xff,
+    0x02, 0x00, 0x02, 0x12, 0x09, 0x06, 0x00, 0xf0, 0x02, 0x14, 0x09, 0x02, 0x00, 0x30, 0x1e, 0x00,
+    0xf8, 0xff, 0x97, 0x00, 0x02, 0x00, 0x06, 0x10, 0x12, 0x03, 0x00, 0xf0, 0x06, 0x11, 0x12, 0x01,
+    0x00, 0x30, 0xd1, 0xff, 0x6b, 0x00, 0xc4, 0xff, 0x02, 0x00, 0x00, 0x10, 0x12, 0x03, 0x00, 0xf0,
+    0x00, 0x11, 0x12, 0x01, 0x00, 0x30, 0xd7, 0x00, 0x11, 0x00, 0xbb, 0x00, 0x03, 0x00, 0x13, 0x02,
+    0x04, 0x16, 0x00, 0xf0, 0x15, 0x02, 0x02, 0x0b, 0x00, 0x20, 0x13, 0x0d, 0x02, 0x0b, 0x00, 0x20,
+    0xd7, 0x00, 0xd8, 0xff, 0x17, 0x01, 0x03, 0x00, 0x01, 0x02, 0x04, 0x16, 0x00, 0xf0, 0x01, 0x02,
+    0x02, 0x0b, 0x00, 0x20, 0x03, 0x0d, 0x02, 0x0b, 0x00, 0x20, 0xd0, 0xff, 0x4b, 0xff, 0x2b, 0x00,
+    0x02, 0x00, 0x0f, 0x00, 0x02, 0x18, 0x00, 0xf0, 0x0f, 0x00, 0x01, 0x18, 0x00, 0x20, 0x88, 0x01,
+    0xd7, 0xff, 0x01, 0x01, 0x02, 0x00, 0x03, 0x14, 0x10, 0x04, 0x00, 0xf0, 0x0b, 0x14, 0x08, 0x04,
+    0x00, 0x20, 0xbf, 0xff, 0x63, 0x00, 0xf3, 0xff, 0x03, 0x00, 0x0b, 0x06, 0x04, 0x12, 0x00, 0xf0,
+    0x0d, 0x06, 0x02, 0x09, 0x00, 0x20, 0x0b, 0x0f, 0x02, 0x09, 0x00, 0x20, 0x8e, 0x00, 0x04, 0x00,
+    0x10, 0xff, 0x03, 0x00, 0x07, 0x09, 0x0a, 0x0e, 0x00, 0xf0, 0x07, 0x09, 0x05, 0x07, 0x00, 0x20,
+    0x0c, 0x10, 0x05, 0x07, 0x00, 0x20, 0x8e, 0x00, 0x0c, 0x00, 0x8b, 0x00, 0x02, 0x00, 0x0e, 0x06,
+    0x06, 0x09, 0x00, 0xf0, 0x0e, 0x09, 0x06, 0x03, 0x00, 0x30, 0x42, 0x00, 0xbb, 0xff, 0x67, 0x00,
+    0x02, 0x00, 0x03, 0x06, 0x07, 0x09, 0x00, 0xf0, 0x03, 0x09, 0x07, 0x03, 0x00, 0x30, 0x4b, 0xff,
+    0xd8, 0x00, 0x08, 0x00, 0x03, 0x00, 0x14, 0x04, 0x04, 0x14, 0x00, 0xf0, 0x16, 0x04, 0x02, 0x0a,
+    0x00, 0x20, 0x14, 0x0e, 0x02, 0x0a, 0x00, 0x20, 0xea, 0xff, 0x27, 0x00, 0xa7, 0xff, 0x02, 0x00,
+    0x07, 0x06, 0x06, 0x09, 0x00, 0xf0, 0x07, 0x09, 0x06, 0x03, 0x00, 0x30, 0xf3, 0xfe, 0x13, 0xff,
+    0x2b, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0a, 0x0e, 0x00, 0xf0, 0x0c, 0x00, 0x05, 0x07, 0x00, 0x20,
+    0x07, 0x07, 0x05, 0x07, 0x00, 0x20, 0xd4, 0xfe, 0x84, 0x00, 0xcd, 0xff, 0x02, 0x00, 0x02, 0x01,
+    0x12, 0x06, 0x00, 0xf0, 0x0b, 0x01, 0x09, 0x06, 0x00, 0x20, 0x43, 0x00, 0x23, 0x00, 0x82, 0xff,
+    0x02, 0x00, 0x0f, 0x00, 0x02, 0x18, 0x00, 0xf0, 0x0f, 0x00, 0x01, 0x18, 0x00, 0x20, 0xdb, 0xff,
+    0x1a, 0xff, 0xfc, 0xff, 0x02, 0x00, 0x07, 0x00, 0x02, 0x18, 0x00, 0xf0, 0x08, 0x00, 0x01, 0x18,
+    0x00, 0x20, 0x18, 0x00, 0x32, 0x00, 0xd6, 0xff, 0x02, 0x00, 0x0d, 0x0c, 0x06, 0x07, 0x00, 0xf0,
+    0x0d, 0x0c, 0x03, 0x07, 0x00, 0x20, 0xfd, 0xff, 0x18, 0x00, 0x96, 0xff, 0x02, 0x00, 0x05, 0x0c,
+    0x06, 0x07, 0x00, 0xf0, 0x08, 0x0c, 0x03, 0x07, 0x00, 0x20, 0x49, 0x03, 0xf1, 0xff, 0xb5, 0x00,
+    0x02, 0x00, 0x03, 0x05, 0x12, 0x13, 0x00, 0xf0, 0x09, 0x05, 0x06, 0x13, 0x00, 0x30, 0xbb, 0xff,
+    0x3e, 0x00, 0xb2, 0xff, 0x02, 0x00, 0x05, 0x06, 0x09, 0x06, 0x00, 0xf0, 0x08, 0x06, 0x03, 0x06,
+    0x00, 0x30, 0xb2, 0xff, 0x9c, 0x00, 0x06, 0x00, 0x02, 0x00, 0x09, 0x05, 0x09, 0x06, 0x00, 0xf0,
+    0x0c, 0x05, 0x03, 0x06, 0x00, 0x30, 0x96, 0xff, 0xe8, 0x00, 0xd6, 0xff, 0x03, 0x00, 0x03, 0x10,
+    0x0a, 0x08, 0x00, 0xf0, 0x03, 0x10, 0x05, 0x04, 0x00, 0x20, 0x08, 0x14, 0x05, 0x04, 0x00, 0x20,
+    0xa7, 0xff, 0xb0, 0xff, 0x33, 0x00, 0x02, 0x00, 0x13, 0x08, 0x05, 0x0f, 0x00, 0xf0, 0x13, 0x0d,
+    0x05, 0x05, 0x00, 0x30, 0x9e, 0xff, 0x56, 0xff, 0x01, 0x00, 0x02, 0x00, 0x00, 0x08, 0x05, 0x0f,
+    0x00, 0xf0, 0x00, 0x0d, 0x05, 0x05, 0x00, 0x30, 0xc1, 0x00, 0x0f, 0x00, 0xe0, 0x00, 0x03, 0x00,
+    0x14, 0x04, 0x04, 0x14, 0x00, 0xf0, 0x16, 0x04, 0x02, 0x0a, 0x00, 0x20, 0x14, 0x0e, 0x02, 0x0a,
+    0x00, 0x20, 0x44, 0xff, 0xcc, 0x00, 0xd4, 0xff, 0x03, 0x00, 0x00, 0x04, 0x04, 0x14, 0x00, 0xf0,
+    0x00, 0x04, 0x02, 0x0a, 0x00, 0x20, 0x02, 0x0e, 0x02, 0x0a, 0x00, 0x20, 0x6c, 0x00, 0x30, 0x00,
+    0x65, 0xff, 0x02, 0x00, 0x07, 0x07, 0x0a, 0x04, 0x00, 0xf0, 0x07, 0x07, 0x05, 0x04, 0x00, 0x20,
+    0x39, 0xff, 0x96, 0x00, 0xcf, 0xff, 0x02, 0x00, 0x04, 0x13, 0x0e, 0x04, 0x00, 0xf0, 0x0b, 0x13,
+    0x07, 0x04, 0x00, 0x20, 0xb4, 0xff, 0xbf, 0xff, 0x29, 0x00, 0x02, 0x00, 0x0a, 0x0b, 0x0c, 0x03,
+    0x00, 0xf0, 0x0a, 0x0b, 0x06, 0x03, 0x00, 0x20, 0x33, 0x00, 0xfd, 0xff, 0x3c, 0xff, 0x02, 0x00,
+    0x00, 0x01, 0x18, 0x03, 0x00, 0xf0, 0x00, 0x02, 0x18, 0x01, 0x00, 0x30, 0xfc, 0xff, 0x34, 0x00,
+    0xe3, 0xff, 0x03, 0x00, 0x07, 0x02, 0x0e, 0x14, 0x00, 0xf0, 0x0e, 0x02, 0x07, 0x0a, 0x00, 0x20,
+    0x07, 0x0c, 0x07, 0x0a, 0x00, 0x20, 0x37, 0xff, 0xee, 0xfe, 0xf7, 0xff, 0x02, 0x00, 0x00, 0x0d,
+    0x06, 0x09, 0x00, 0xf0, 0x02, 0x0d, 0x02, 0x09, 0x00, 0x30, 0xb9, 0xff, 0x6c, 0xff, 0x2f, 0x00,
+    0x02, 0x00, 0x0d, 0x00, 0x04, 0x13, 0x00, 0xf0, 0x0d, 0x00, 0x02, 0x13, 0x00, 0x20, 0xc4, 0xff,
+    0x57, 0xff, 0x01, 0x00, 0x02, 0x00, 0x01, 0x0b, 0x0e, 0x03, 0x00, 0xf0, 0x08, 0x0b, 0x07, 0x03,
+    0x00, 0x20, 0x56, 0xfc, 0x85, 0xff, 0x1f, 0x00, 0x03, 0x00, 0x07, 0x01, 0x10, 0x14, 0x00, 0xf0,
+    0x0f, 0x01, 0x08, 0x0a, 0x00, 0x20, 0x07, 0x0b, 0x08, 0x0a, 0x00, 0x20, 0xf8, 0xfd, 0x93, 0x00,
+    0xcf, 0xff, 0x02, 0x00, 0x00, 0x0a, 0x15, 0x09, 0x00, 0xf0, 0x07, 0x0a, 0x07, 0x09, 0x00, 0x30,
+    0x2a, 0x00, 0xf3, 0xff, 0x3e, 0x00, 0x02, 0x00, 0x06, 0x13, 0x0f, 0x05, 0x00, 0xf0, 0x0b, 0x13,
+    0x05, 0x05, 0x00, 0x30, 0x1c, 0x00, 0x1f, 0x00, 0x9d, 0xff, 0x02, 0x00, 0x08, 0x0a, 0x06, 0x06,
+    0x00, 0xf0, 0x0b, 0x0a, 0x03, 0x06, 0x00, 0x20, 0xa4, 0x04, 0x1c, 0x00, 0x00, 0xe2, 0x03, 0x00,
+    0x07, 0x01, 0x10, 0x14, 0x00, 0xf0, 0x0f, 0x01, 0x08, 0x0a, 0x00, 0x20, 0x07, 0x0b, 0x08, 0x0a,
+    0x00, 0x20, 0x31, 0xfc, 0x44, 0xfe, 0xf0, 0xff, 0x03, 0x00, 0x01, 0x01, 0x10, 0x14, 0x00, 0xf0,
+    0x01, 0x01, 0x08, 0x0a, 0x00, 0x20, 0x09, 0x0b, 0x08, 0x0a, 0x00, 0x20, 0xff, 0x00, 0x22, 0x00,
+    0x4d, 0xff, 0x02, 0x00, 0x10, 0x04, 0x03, 0x0c, 0x00, 0xf0, 0x10, 0x0a, 0x03, 0x06, 0x00, 0x20,
+    0x13, 0x00, 0x88, 0xff, 0x0f, 0x00, 0x02, 0x00, 0x05, 0x04, 0x03, 0x0c, 0x00, 0xf0, 0x05, 0x0a,
+    0x03, 0x06, 0x00, 0x20, 0x8f, 0xff, 0xb2, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07, 0x06, 0x0a, 0x08,
+    0x00, 0xf0, 0x0c, 0x06, 0x05, 0x04, 0x00, 0x20, 0x07, 0x0a, 0x05, 0x04, 0x00, 0x20, 0xbb, 0xff,
+    0xaf, 0x01, 0xdc, 0xff, 0x02, 0x00, 0x04, 0x09, 0x06, 0x06, 0x00, 0xf0, 0x04, 0x0c, 0x06, 0x03,
+    0x00, 0x20, 0x35, 0xff, 0xcb, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, 0x05, 0x0c, 0x04, 0x00, 0xf0,
+    0x06, 0x07, 0x0c, 0x02, 0x00, 0x20, 0xce, 0xfe, 0xfd, 0xfe, 0xfc, 0xff, 0x02, 0x00, 0x09, 0x02,
+    0x05, 0x0f, 0x00, 0xf0, 0x09, 0x07, 0x05, 0x05, 0x00, 0x30, 0x83, 0x00, 0x24, 0x00, 0x95, 0xff,
+    0x02, 0x00, 0x0f, 0x00, 0x09, 0x06, 0x00, 0xf0, 0x0f, 0x02, 0x09, 0x02, 0x00, 0x30, 0x7e, 0xfe,
+    0x81, 0x00, 0xcc, 0xff, 0x02, 0x00, 0x06, 0x00, 0x0b, 0x0a, 0x00, 0xf0, 0x06, 0x05, 0x0b, 0x05,
+    0x00, 0x20, 0xc1, 0xff, 0xd8, 0xff, 0x2d, 0x00, 0x02, 0x00, 0x0c, 0x07, 0x04, 0x0c, 0x00, 0xf0,
+    0x0c, 0x0d, 0x04, 0x06, 0x00, 0x20, 0xf0, 0xff, 0x75, 0xff, 0x07, 0x00, 0x02, 0x00, 0x07, 0x02,
+    0x09, 0x04, 0x00, 0xf0, 0x07, 0x04, 0x09, 0x02, 0x00, 0x20, 0x0c, 0x00, 0xd4, 0xff, 0x4d, 0x00,
+    0x02, 0x00, 0x06, 0x00, 0x0d, 0x06, 0x00, 0xf0, 0x06, 0x02, 0x0d, 0x02, 0x00, 0x30, 0xd7, 0xff,
+    0x40, 0x00, 0xbd, 0xff, 0x03, 0x00, 0x0a, 0x06, 0x04, 0x12, 0x00, 0xf0, 0x0a, 0x06, 0x02, 0x09,
+    0x00, 0x20, 0x0c, 0x0f, 0x02, 0x09, 0x00, 0x20, 0x62, 0xff, 0xee, 0x00, 0x12, 0x00, 0x02, 0x00,
+    0x0a, 0x08, 0x06, 0x09, 0x00, 0xf0, 0x0c, 0x08, 0x02, 0x09, 0x00, 0x30, 0x8d, 0x00, 0xf8, 0xff,
+    0x25, 0xff, 0x02, 0x00, 0x03, 0x12, 0x0a, 0x06, 0x00, 0xf0, 0x03, 0x14, 0x0a, 0x02, 0x00, 0x30,
+    0xed, 0xff, 0x59, 0x00, 0xf4, 0xff, 0x02, 0x00, 0x04, 0x0e, 0x14, 0x03, 0x00, 0xf0, 0x04, 0x0f,
+    0x14, 0x01, 0x00, 0x30, 0x02, 0x00, 0x11, 0x00, 0x8d, 0xff, 0x02, 0x00, 0x02, 0x0f, 0x09, 0x06,
+    0x00, 0xf0, 0x02, 0x11, 0x09, 0x02, 0x00, 0x30, 0x90, 0x00, 0x24, 0x00, 0x89, 0xff, 0x02, 0x00,
+    0x0d, 0x00, 0x04, 0x13, 0x00, 0xf0, 0x0d, 0x00, 0x02, 0x13, 0x00, 0x20, 0xa0, 0xff, 0xf9, 0xfe,
+    0xf5, 0xff, 0x02, 0x00, 0x07, 0x00, 0x04, 0x13, 0x00, 0xf0, 0x09, 0x00, 0x02, 0x13, 0x00, 0x20,
+    0xf9, 0xff, 0xce, 0xff, 0x49, 0x00, 0x02, 0x00, 0x01, 0x04, 0x16, 0x02, 0x00, 0xf0, 0x01, 0x05,
+    0x16, 0x01, 0x00, 0x20, 0xbc, 0xff, 0x3a, 0xff, 0xfe, 0xff, 0x02, 0x00, 0x00, 0x00, 0x09, 0x06,
+    0x00, 0xf0, 0x00, 0x02, 0x09, 0x02, 0x00, 0x30, 0x91, 0x0a, 0x21, 0x00, 0x7a, 0xfc, 0x02, 0x00,
+    0x00, 0x00, 0x18, 0x12, 0x00, 0xf0, 0x00, 0x09, 0x18, 0x09, 0x00, 0x20, 0xc1, 0x01, 0xd9, 0xff,
+    0x77, 0x01, 0x02, 0x00, 0x03, 0x02, 0x10, 0x08, 0x00, 0xf0, 0x03, 0x06, 0x10, 0x04, 0x00, 0x20,
+    0x37, 0x00, 0x26, 0x00, 0xb3, 0xfe, 0x02, 0x00, 0x03, 0x06, 0x12, 0x06, 0x00, 0xf0, 0x03, 0x08,
+    0x12, 0x02, 0x00, 0x30, 0xa3, 0xff, 0x4a, 0xff, 0xfe, 0xff, 0x02, 0x00, 0x03, 0x01, 0x06, 0x0a,
+    0x00, 0xf0, 0x05, 0x01, 0x02, 0x0a, 0x00, 0x30, 0xb1, 0xfe, 0x1c, 0x01, 0x15, 0x00, 0x02, 0x00,
+    0x0d, 0x00, 0x09, 0x06, 0x00, 0xf0, 0x10, 0x00, 0x03, 0x06, 0x00, 0x30, 0x29, 0xff, 0xee, 0x00,
+    0xd5, 0xff, 0x02, 0x00, 0x02, 0x00, 0x09, 0x06, 0x00, 0xf0, 0x05, 0x00, 0x03, 0x06, 0x00, 0x30,
+    0x99, 0xff, 0xce, 0xff, 0x40, 0x00, 0x02, 0x00, 0x0a, 0x02, 0x04, 0x0f, 0x00, 0xf0, 0x0a, 0x07,
+    0x04, 0x05, 0x00, 0x30, 0x4d, 0xff, 0x6b, 0x00, 0xc2, 0xff, 0x02, 0x00, 0x06, 0x00, 0x07, 0x0a,
+    0x00, 0xf0, 0x06, 0x05, 0x07, 0x05, 0x00, 0x20, 0xb6, 0xff, 0x7c, 0xff, 0x33, 0x00, 0x03, 0x00,
+    0x02, 0x02, 0x14, 0x04, 0x00, 0xf0, 0x0c, 0x02, 0x0a, 0x02, 0x00, 0x20, 0x02, 0x04, 0x0a, 0x02,
+    0x00, 0x20, 0x60, 0x00, 0xf5, 0xff, 0xf0, 0xfe, 0x02, 0x00, 0x02, 0x0b, 0x13, 0x03, 0x00, 0xf0,
+    0x02, 0x0c, 0x13, 0x01, 0x00, 0x30, 0x8c, 0x00, 0x0d, 0x00, 0x7f, 0x00, 0x02, 0x00, 0x0a, 0x08,
+    0x06, 0x09, 0x00, 0xf0, 0x0c, 0x08, 0x02, 0x09, 0x00, 0x30, 0x69, 0x00, 0xc4, 0xff, 0x6a, 0x00,
+    0x02, 0x00, 0x08, 0x08, 0x06, 0x09, 0x00, 0xf0, 0x0a, 0x08, 0x02, 0x09, 0x00, 0x30, 0x94, 0xff,
+    0x1e, 0xff, 0x22, 0x00, 0x02, 0x00, 0x0d, 0x08, 0x04, 0x09, 0x00, 0xf0, 0x0d, 0x08, 0x02, 0x09,
+    0x00, 0x20, 0xf9, 0x00, 0xcc, 0xff, 0x95, 0x00, 0x02, 0x00, 0x03, 0x0b, 0x09, 0x09, 0x00, 0xf0,
+    0x06, 0x0b, 0x03, 0x09, 0x00, 0x30, 0x50, 0x02, 0x22, 0x00, 0xdb, 0xfc, 0x02, 0x00, 0x03, 0x09,
+    0x12, 0x05, 0x00, 0xf0, 0x09, 0x09, 0x06, 0x05, 0x00, 0x30, 0xda, 0x00, 0xd4, 0xff, 0xb1, 0x00,
+    0x02, 0x00, 0x02, 0x04, 0x02, 0x14, 0x00, 0xf0, 0x02, 0x0e, 0x02, 0x0a, 0x00, 0x20, 0x2e, 0x00,
+    0x0e, 0x00, 0x4d, 0x00, 0x02, 0x00, 0x0e, 0x11, 0x08, 0x06, 0x00, 0xf0, 0x0e, 0x14, 0x08, 0x03,
+    0x00, 0x20, 0xf7, 0xff, 0x28, 0x00, 0xaf, 0xff, 0x02, 0x00, 0x03, 0x15, 0x12, 0x02, 0x00, 0xf0,
+    0x03, 0x16, 0x12, 0x01, 0x00, 0x20, 0x87, 0xff, 0xb6, 0x00, 0x0e, 0x00, 0x02, 0x00, 0x05, 0x04,
+    0x0f, 0x06, 0x00, 0xf0, 0x0a, 0x04, 0x05, 0x06, 0x00, 0x30, 0x6f, 0x00, 0xd8, 0xff, 0xeb, 0x00,
+    0x02, 0x00, 0x02, 0x0f, 0x0c, 0x06, 0x00, 0xf0, 0x02, 0x11, 0x0c, 0x02, 0x00, 0x30, 0xf2, 0xff,
+    0xa8, 0xff, 0x33, 0x00, 0x02, 0x00, 0x11, 0x08, 0x06, 0x09, 0x00, 0xf0, 0x11, 0x0b, 0x06, 0x03,
+    0x00, 0x30, 0xcd, 0xff, 0x72, 0xff, 0x05, 0x00, 0x03, 0x00, 0x02, 0x0c, 0x14, 0x04, 0x00, 0xf0,
+    0x02, 0x0c, 0x0a, 0x02, 0x00, 0x20, 0x0c, 0x0e, 0x0a, 0x02, 0x00, 0x20, 0x95, 0xfe, 0x64, 0xfc,
+    0x21, 0x00, 0x02, 0x00, 0x00, 0x11, 0x18, 0x06, 0x00, 0xf0, 0x00, 0x13, 0x18, 0x02, 0x00, 0x30,
+    0xb2, 0xff, 0x84, 0x00, 0xcf, 0xff, 0x02, 0x00, 0x07, 0x10, 0x09, 0x04, 0x00, 0xf0, 0x07, 0x12,
+    0x09, 0x02, 0x00, 0x20, 0xbc, 0xff, 0xea, 0xff, 0x28, 0x00, 0x03, 0x00, 0x0f, 0x01, 0x04, 0x16,
+    0x00, 0xf0, 0x11, 0x01, 0x02, 0x0b, 0x00, 0x20, 0x0f, 0x0c, 0x02, 0x0b, 0x00, 0x20, 0x34, 0x00,
+    0x07, 0x00, 0x73, 0xff, 0x03, 0x00, 0x05, 0x01, 0x04, 0x16, 0x00, 0xf0, 0x05, 0x01, 0x02, 0x0b,
+    0x00, 0x20, 0x07, 0x0c, 0x02, 0x0b, 0x00, 0x20, 0xc9, 0xff, 0x3c, 0x00, 0xf5, 0xff, 0x02, 0x00,
+    0x0b, 0x0d, 0x08, 0x09, 0x00, 0xf0, 0x0b, 0x10, 0x08, 0x03, 0x00, 0x30, 0x4d, 0x00, 0xf6, 0xff,
+    0x0f, 0xff, 0x02, 0x00, 0x06, 0x01, 0x06, 0x09, 0x00, 0xf0, 0x08, 0x01, 0x02, 0x09, 0x00, 0x30,
+    0xe6, 0xff, 0x75, 0x00, 0xff, 0xff, 0x02, 0x00, 0x0b, 0x04, 0x03, 0x12, 0x00, 0xf0, 0x0b, 0x0a,
+    0x03, 0x06, 0x00, 0x30, 0x9d, 0xff, 0x3d, 0xff, 0xfb, 0xff, 0x03, 0x00, 0x05, 0x08, 0x0c, 0x06,
+    0x00, 0xf0, 0x05, 0x08, 0x06, 0x03, 0x00, 0x20, 0x0b, 0x0b, 0x06, 0x03, 0x00, 0x20, 0x87, 0xff,
+    0x43, 0xfc, 0x1c, 0x00, 0x02, 0x00, 0x0f, 0x07, 0x05, 0x08, 0x00, 0xf0, 0x0f, 0x0b, 0x05, 0x04,
+    0x00, 0x20, 0x14, 0x00, 0x5d, 0xff, 0x02, 0x00, 0x02, 0x00, 0x04, 0x07, 0x05, 0x08, 0x00, 0xf0,
+    0x04, 0x0b, 0x05, 0x04, 0x00, 0x20, 0xe9, 0xff, 0x31, 0x00, 0xeb, 0xff, 0x03, 0x00, 0x0c, 0x06,
+    0x06, 0x0c, 0x00, 0xf0, 0x0f, 0x06, 0x03, 0x06, 0x00, 0x20, 0x0c, 0x0c, 0x03, 0x06, 0x00, 0x20,
+    0x44, 0x00, 0xd7, 0xff, 0x22, 0x01, 0x03, 0x00, 0x06, 0x06, 0x06, 0x0c, 0x00, 0xf0, 0x06, 0x06,
+    0x03, 0x06, 0x00, 0x20, 0x09, 0x0c, 0x03, 0x06, 0x00, 0x20, 0x9c, 0x00, 0x05, 0x00, 0xc3, 0x00,
+    0x03, 0x00, 0x05, 0x09, 0x0e, 0x08, 0x00, 0xf0, 0x0c, 0x09, 0x07, 0x04, 0x00, 0x20, 0x05, 0x0d,
+    0x07, 0x04, 0x00, 0x20, 0x17, 0xff, 0x4e, 0xfe, 0xf1, 0xff, 0x02, 0x00, 0x09, 0x01, 0x03, 0x0e,
+    0x00, 0xf0, 0x09, 0x08, 0x03, 0x07, 0x00, 0x20, 0x24, 0xff, 0x2f, 0x01, 0x17, 0x00, 0x02, 0x00,
+    0x0c, 0x06, 0x06, 0x0c, 0x00, 0xf0, 0x0c, 0x0a, 0x06, 0x04, 0x00, 0x30, 0xf6, 0xff, 0x98, 0xff,
+    0x15, 0x00, 0x03, 0x00, 0x04, 0x05, 0x04, 0x12, 0x00, 0xf0, 0x04, 0x05, 0x02, 0x09, 0x00, 0x20,
+    0x06, 0x0e, 0x02, 0x09, 0x00, 0x20, 0xc1, 0x04, 0x27, 0x00, 0xe7, 0xfe, 0x02, 0x00, 0x04, 0x06,
+    0x10, 0x12, 0x00, 0xf0, 0x04, 0x0c, 0x10, 0x06, 0x00, 0x30, 0x94, 0xfe, 0x7d, 0x00, 0xcd, 0xff,
+    0x02, 0x00, 0x05, 0x04, 0x07, 0x14, 0x00, 0xf0, 0x05, 0x0e, 0x07, 0x0a, 0x00, 0x20, 0x1a, 0xff,
+    0xc2, 0xff, 0x24, 0x00, 0x02, 0x00, 0x0e, 0x08, 0x08, 0x0c, 0x00, 0xf0, 0x0e, 0x0e, 0x08, 0x06,
+    0x00, 0x20, 0x97, 0x00, 0xf4, 0xff, 0xc5, 0xfe, 0x03, 0x00, 0x09, 0x0a, 0x06, 0x0e, 0x00, 0xf0,
+    0x09, 0x0a, 0x03, 0x07, 0x00, 0x20, 0x0c, 0x11, 0x03, 0x07, 0x00, 0x20, 0xde, 0xff, 0x6f, 0x00,
+    0x03, 0x00, 0x02, 0x00, 0x09, 0x05, 0x09, 0x06, 0x00, 0xf0, 0x0c, 0x05, 0x03, 0x06, 0x00, 0x30,
+    0xf7, 0xff, 0x30, 0x00, 0xae, 0xff, 0x02, 0x00, 0x09, 0x04, 0x03, 0x12, 0x00, 0xf0, 0x0a, 0x04,
+    0x01, 0x12, 0x00, 0x30, 0xdb, 0xfe, 0x90, 0xff, 0x3a, 0x00, 0x03, 0x00, 0x01, 0x04, 0x16, 0x0e,
+    0x00, 0xf0, 0x0c, 0x04, 0x0b, 0x07, 0x00, 0x20, 0x01, 0x0b, 0x0b, 0x07, 0x00, 0x20, 0x15, 0x00,
+    0xcc, 0xff, 0x82, 0x00, 0x02, 0x00, 0x02, 0x07, 0x12, 0x02, 0x00, 0xf0, 0x02, 0x08, 0x12, 0x01,
+    0x00, 0x20, 0xe7, 0xff, 0x4f, 0x00, 0x12, 0x00, 0x02, 0x00, 0x0c, 0x06, 0x06, 0x0c, 0x00, 0xf0,
+    0x0c, 0x0a, 0x06, 0x04, 0x00, 0x30, 0x3f, 0x00, 0xb1, 0xff, 0x28, 0x00, 0x02, 0x00, 0x06, 0x05,
+    0x09, 0x07, 0x00, 0xf0, 0x09, 0x05, 0x03, 0x07, 0x00, 0x30, 0x6a, 0x00, 0x23, 0x00, 0xd3, 0xff,
+    0x02, 0x00, 0x0c, 0x07, 0x04, 0x0c, 0x00, 0xf0, 0x0c, 0x0d, 0x04, 0x06, 0x00, 0x20, 0xcf, 0xff,
+    0x7e, 0xff, 0x0e, 0x00, 0x02, 0x00, 0x08, 0x07, 0x04, 0x0c, 0x00, 0xf0, 0x08, 0x0d, 0x04, 0x06,
+    0x00, 0x20, 0xeb, 0xfe, 0x7a, 0x00, 0xee, 0xff, 0x02, 0x00, 0x07, 0x02, 0x0a, 0x16, 0x00, 0xf0,
+    0x07, 0x0d, 0x0a, 0x0b, 0x00, 0x20, 0xc4, 0xff, 0x73, 0x00, 0xce, 0xff, 0x02, 0x00, 0x00, 0x01,
+    0x03, 0x14, 0x00, 0xf0, 0x01, 0x01, 0x01, 0x14, 0x00, 0x30, 0x66, 0x00, 0x21, 0x00, 0x24, 0xff,
+    0x03, 0x00, 0x04, 0x0d, 0x12, 0x04, 0x00, 0xf0, 0x0d, 0x0d, 0x09, 0x02, 0x00, 0x20, 0x04, 0x0f,
+    0x09, 0x02, 0x00, 0x20, 0x4d, 0x00, 0xf6, 0xff, 0xde, 0xfe, 0x03, 0x00, 0x02, 0x0d, 0x12, 0x04,
+    0x00, 0xf0, 0x02, 0x0d, 0x09, 0x02, 0x00, 0x20, 0x0b, 0x0f, 0x09, 0x02, 0x00, 0x20, 0xa9, 0xff,
+    0xa8, 0xff, 0x28, 0x00, 0x02, 0x00, 0x0f, 0x0f, 0x09, 0x06, 0x00, 0xf0, 0x0f, 0x11, 0x09, 0x02,
+    0x00, 0x30, 0x26, 0x00, 0x01, 0x00, 0x63, 0xff, 0x02, 0x00, 0x00, 0x0f, 0x09, 0x06, 0x00, 0xf0,
+    0x00, 0x11, 0x09, 0x02, 0x00, 0x30, 0xac, 0x03, 0x14, 0x00, 0xb2, 0x00, 0x03, 0x00, 0x06, 0x00,
+    0x12, 0x18, 0x00, 0xf0, 0x0f, 0x00, 0x09, 0x0c, 0x00, 0x20, 0x06, 0x0c, 0x09, 0x0c, 0x00, 0x20,
+    0x65, 0xff, 0x29, 0x01, 0xda, 0xff, 0x02, 0x00, 0x06, 0x06, 0x06, 0x0c, 0x00, 0xf0, 0x06, 0x0a,
+    0x06, 0x04, 0x00, 0x30, 0xc9, 0xff, 0xae, 0xff, 0x2c, 0x00, 0x02, 0x00, 0x08, 0x07, 0x0a, 0x04,
+    0x00, 0xf0, 0x08, 0x09, 0x0a, 0x02, 0x00, 0x20, 0x94, 0x00, 0xd2, 0xff, 0x9e, 0x00, 0x03, 0x00,
+    0x01, 0x09, 0x12, 0x06, 0x00, 0xf0, 0x01, 0x09, 0x09, 0x03, 0x00, 0x20, 0x0a, 0x0c, 0x09, 0x03,
+    0x00, 0x20, 0x1b, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x02, 0x00, 0x06, 0x06, 0x12, 0x03, 0x00, 0xf0,
+    0x06, 0x07, 0x12, 0x01, 0x00, 0x30, 0x8b, 0x01, 0xdb, 0xff, 0x40, 0x01, 0x02, 0x00, 0x07, 0x07,
+    0x09, 0x08, 0x00, 0xf0, 0x0a, 0x07, 0x03, 0x08, 0x00, 0x30, 0x6e, 0xff, 0x9b, 0xff, 0x24, 0x00,
+    0x02, 0x00, 0x0a, 0x0c, 0x06, 0x0c, 0x00, 0xf0, 0x0c, 0x0c, 0x02, 0x0c, 0x00, 0x30, 0x2c, 0x00,
+    0xd2, 0xff, 0x98, 0x00, 0x02, 0x00, 0x03, 0x0e, 0x12, 0x03, 0x00, 0xf0, 0x03, 0x0f, 0x12, 0x01,
+    0x00, 0x30, 0x44, 0x01, 0x25, 0x00, 0x37, 0xff, 0x02, 0x00, 0x0f, 0x11, 0x09, 0x07, 0x00, 0xf0,
+    0x12, 0x11, 0x03, 0x07, 0x00, 0x30, 0x86, 0x00, 0xf1, 0xff, 0x94, 0xfe, 0x02, 0x00, 0x01, 0x0c,
+    0x0a, 0x06, 0x00, 0xf0, 0x01, 0x0e, 0x0a, 0x02, 0x00, 0x30, 0x8f, 0xff, 0x57, 0x00, 0x07, 0x00,
+    0x02, 0x00, 0x0f, 0x11, 0x09, 0x07, 0x00, 0xf0, 0x12, 0x11, 0x03, 0x07, 0x00, 0x30, 0xf0, 0xff,
+    0x4f, 0x00, 0xc7, 0xff, 0x02, 0x00, 0x0a, 0x03, 0x03, 0x13, 0x00, 0xf0, 0x0b, 0x03, 0x01, 0x13,
+    0x00, 0x30, 0x1e, 0x00, 0xf7, 0xff, 0x51, 0x00, 0x02, 0x00, 0x0f, 0x11, 0x09, 0x07, 0x00, 0xf0,
+    0x12, 0x11, 0x03, 0x07, 0x00, 0x30, 0xcb, 0x01, 0xd3, 0xff, 0xa6, 0x00, 0x02, 0x00, 0x06, 0x01,
+    0x0b, 0x09, 0x00, 0xf0, 0x06, 0x04, 0x0b, 0x03, 0x00, 0x30, 0x1a, 0xfe, 0xfe, 0xfe, 0x1c, 0x00,
+    0x02, 0x00, 0x0f, 0x11, 0x09, 0x07, 0x00, 0xf0, 0x12, 0x11, 0x03, 0x07, 0x00, 0x30, 0x56, 0xff,
+    0x77, 0xff, 0x05, 0x00, 0x02, 0x00, 0x06, 0x05, 0x0b, 0x06, 0x00, 0xf0, 0x06, 0x08, 0x0b, 0x03,
+    0x00, 0x20, 0x8e, 0xff, 0x7b, 0x00, 0x08, 0x00, 0x02, 0x00, 0x10, 0x07, 0x08, 0x05, 0x00, 0xf0,
+    0x10, 0x07, 0x04, 0x05, 0x00, 0x20, 0x00, 0xfe, 0x43, 0x00, 0xbf, 0xff, 0x02, 0x00, 0x02, 0x04,
+    0x14, 0x13, 0x00, 0xf0, 0x0c, 0x04, 0x0a, 0x13, 0x00, 0x20, 0xc9, 0x03, 0x09, 0x00, 0xe8, 0x00,
+    0x02, 0x00, 0x02, 0x01, 0x15, 0x06, 0x00, 0xf0, 0x09, 0x01, 0x07, 0x06, 0x00, 0x30, 0x88, 0xff,
+    0x67, 0xff, 0x02, 0x00, 0x03, 0x00, 0x06, 0x05, 0x0c, 0x0e, 0x00, 0xf0, 0x06, 0x05, 0x06, 0x07,
+    0x00, 0x20, 0x0c, 0x0c, 0x06, 0x07, 0x00, 0x20, 0x9a, 0x00, 0x27, 0x00, 0x0b, 0xff, 0x02, 0x00,
+    0x09, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x0b, 0x00, 0x02, 0x09, 0x00, 0x30, 0x27, 0x01, 0xdb, 0xff,
+    0x5e, 0x01, 0x02, 0x00, 0x02, 0x0b, 0x08, 0x05, 0x00, 0xf0, 0x06, 0x0b, 0x04, 0x05, 0x00, 0x20,
+    0x28, 0x00, 0x03, 0x00, 0x37, 0x00, 0x02, 0x00, 0x10, 0x07, 0x08, 0x05, 0x00, 0xf0, 0x10, 0x07,
+    0x04, 0x05, 0x00, 0x20, 0xd5, 0x00, 0xfc, 0xff, 0x1e, 0xff, 0x02, 0x00, 0x00, 0x07, 0x08, 0x05,
+    0x00, 0xf0, 0x04, 0x07, 0x04, 0x05, 0x00, 0x20, 0x4d, 0xff, 0x5b, 0x00, 0x10, 0x00, 0x02, 0x00,
+    0x0f, 0x11, 0x09, 0x07, 0x00, 0xf0, 0x12, 0x11, 0x03, 0x07, 0x00, 0x30, 0x63, 0xff, 0x32, 0x01,
+    0xda, 0xff, 0x03, 0x00, 0x08, 0x06, 0x08, 0x0a, 0x00, 0xf0, 0x08, 0x06, 0x04, 0x05, 0x00, 0x20,
+    0x0c, 0x0b, 0x04, 0x05, 0x00, 0x20, 0x6c, 0xfe, 0x62, 0xff, 0x20, 0x00, 0x02, 0x00, 0x0f, 0x0f,
+    0x09, 0x09, 0x00, 0xf0, 0x12, 0x0f, 0x03, 0x09, 0x00, 0x30, 0x0d, 0xfe, 0x2d, 0xfe, 0xf0, 0xff,
+    0x02, 0x00, 0x00, 0x0f, 0x09, 0x09, 0x00, 0xf0, 0x03, 0x0f, 0x03, 0x09, 0x00, 0x30, 0x16, 0xfe,
+    0x00, 0xe2, 0x1c, 0x00, 0x02, 0x00, 0x0c, 0x0a, 0x09, 0x07, 0x00, 0xf0, 0x0f, 0x0a, 0x03, 0x07,
+    0x00, 0x30, 0x7e, 0x00, 0xc3, 0xff, 0x5d, 0x00, 0x02, 0x00, 0x03, 0x0a, 0x09, 0x07, 0x00, 0xf0,
+    0x06, 0x0a, 0x03, 0x07, 0x00, 0x30, 0x2c, 0x00, 0xf8, 0xff, 0x46, 0x00, 0x03, 0x00, 0x0d, 0x0f,
+    0x0a, 0x08, 0x00, 0xf0, 0x12, 0x0f, 0x05, 0x04, 0x00, 0x20, 0x0d, 0x13, 0x05, 0x04, 0x00, 0x20,
+    0xe8, 0x00, 0xd9, 0xff, 0x14, 0x01, 0x03, 0x00, 0x00, 0x01, 0x06, 0x0c, 0x00, 0xf0, 0x00, 0x01,
+    0x03, 0x06, 0x00, 0x20, 0x03, 0x07, 0x03, 0x06, 0x00, 0x20, 0x04, 0x00, 0xf1, 0xff, 0x34, 0x00,
+    0x03, 0x00, 0x0a, 0x00, 0x06, 0x0c, 0x00, 0xf0, 0x0d, 0x00, 0x03, 0x06, 0x00, 0x20, 0x0a, 0x06,
+    0x03, 0x06, 0x00, 0x20, 0x8d, 0xff, 0x5b, 0xff, 0x06, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0a, 0x0c,
+    0x00, 0xf0, 0x07, 0x00, 0x05, 0x06, 0x00, 0x20, 0x0c, 0x06, 0x05, 0x06, 0x00, 0x20, 0x71, 0xfd,
+    0x16, 0x01, 0x0e, 0x00, 0x02, 0x00, 0x04, 0x01, 0x10, 0x08, 0x00, 0xf0, 0x04, 0x01, 0x08, 0x08,
+    0x00, 0x20, 0x14, 0x00, 0xbe, 0xff, 0x35, 0x00, 0x02, 0x00, 0x00, 0x15, 0x13, 0x03, 0x00, 0xf0,
+    0x00, 0x16, 0x13, 0x01, 0x00, 0x30, 0xc0, 0x00, 0x23, 0x00, 0x70, 0xfe, 0x03, 0x00, 0x06, 0x09,
+    0x12, 0x04, 0x00, 0xf0, 0x0f, 0x09, 0x09, 0x02, 0x00, 0x20, 0x06, 0x0b, 0x09, 0x02, 0x00, 0x20,
+    0x63, 0x00, 0xcb, 0xff, 0x86, 0x00, 0x02, 0x00, 0x03, 0x04, 0x09, 0x06, 0x00, 0xf0, 0x03, 0x06,
+    0x09, 0x02, 0x00, 0x30, 0x1f, 0x01, 0x25, 0x00, 0xb1, 0xfe, 0x02, 0x00, 0x09, 0x01, 0x06, 0x0f,
+    0x00, 0xf0, 0x09, 0x06, 0x06, 0x05, 0x00, 0x30, 0x28, 0x00, 0x07, 0x00, 0x7e, 0xff, 0x02, 0x00,
+    0x05, 0x09, 0x06, 0x06, 0x00, 0xf0, 0x08, 0x09, 0x03, 0x06, 0x00, 0x20, 0x1a, 0xff, 0x43, 0x01,
+    0x10, 0x00, 0x02, 0x00, 0x05, 0x01, 0x0e, 0x09, 0x00, 0xf0, 0x05, 0x04, 0x0e, 0x03, 0x00, 0x30,
+    0xc1, 0x01, 0xe0, 0xff, 0x13, 0x03, 0x03, 0x00, 0x03, 0x00, 0x08, 0x14, 0x00, 0xf0, 0x03, 0x00,
+    0x04, 0x0a, 0x00, 0x20, 0x07, 0x0a, 0x04, 0x0a, 0x00, 0x20, 0xa2, 0xfc, 0xd3, 0x00, 0x55, 0x00,
+    0x51, 0xff, 0x63, 0x00, 0x02, 0x00, 0x05, 0x00, 0x07, 0x09, 0x00, 0xf0, 0x05, 0x03, 0x07, 0x03,
+    0x00, 0x30, 0x8f, 0x00, 0x86, 0xff, 0x73, 0x00, 0x02, 0x00, 0x06, 0x06, 0x0c, 0x05, 0x00, 0xf0,
+    0x0a, 0x06, 0x04, 0x05, 0x00, 0x30, 0xa3, 0x00, 0x88, 0xff, 0x6d, 0x00, 0x02, 0x00, 0x00, 0x01,
+    0x08, 0x0e, 0x00, 0xf0, 0x04, 0x01, 0x04, 0x0e, 0x00, 0x20, 0xed, 0xff, 0x41, 0x00, 0x56, 0xff,
+    0x02, 0x00, 0x02, 0x0c, 0x16, 0x04, 0x00, 0xf0, 0x02, 0x0e, 0x16, 0x02, 0x00, 0x20, 0x09, 0x00,
+    0x85, 0xff, 0x47, 0x00, 0x02, 0x00, 0x08, 0x11, 0x06, 0x06, 0x00, 0xf0, 0x08, 0x14, 0x06, 0x03,
+    0x00, 0x20, 0x67, 0x00, 0xc3, 0xff, 0x71, 0x00, 0x02, 0x00, 0x12, 0x01, 0x06, 0x07, 0x00, 0xf0,
+    0x12, 0x01, 0x03, 0x07, 0x00, 0x20, 0x7d, 0xff, 0xc2, 0x00, 0xc0, 0xff, 0x02, 0x00, 0x00, 0x00,
+    0x06, 0x06, 0x00, 0xf0, 0x03, 0x00, 0x03, 0x06, 0x00, 0x20, 0x34, 0x01, 0xa7, 0xff, 0x58, 0x00,
+    0x02, 0x00, 0x04, 0x06, 0x11, 0x12, 0x00, 0xf0, 0x04, 0x0c, 0x11, 0x06, 0x00, 0x30, 0xb5, 0xff,
+    0x36, 0xff, 0x08, 0x00, 0x03, 0x00, 0x06, 0x00, 0x0c, 0x06, 0x00, 0xf0, 0x06, 0x00, 0x06, 0x03,
+    0x00, 0x20, 0x0c, 0x03, 0x06, 0x03, 0x00, 0x20, 0xcc, 0xff, 0x78, 0x00, 0xf1, 0xff, 0x03, 0x00,
+    0x04, 0x07, 0x12, 0x04, 0x00, 0xf0, 0x0d, 0x07, 0x09, 0x02, 0x00, 0x20, 0x04, 0x09, 0x09, 0x02,
+    0x00, 0x20, 0x94, 0xff, 0xab, 0x00, 0xc2, 0xff, 0x02, 0x00, 0x04, 0x0c, 0x0a, 0x06, 0x00, 0xf0,
+    0x04, 0x0e, 0x0a, 0x02, 0x00, 0x30, 0x5a, 0x00, 0x3f, 0x00, 0x85, 0xff, 0x03, 0x00, 0x07, 0x09,
+    0x0a, 0x0c, 0x00, 0xf0, 0x0c, 0x09, 0x05, 0x06, 0x00, 0x20, 0x07, 0x0f, 0x05, 0x06, 0x00, 0x20,
+    0x58, 0x02, 0xc9, 0xff, 0xb8, 0x00, 0x02, 0x00, 0x00, 0x01, 0x18, 0x03, 0x00, 0xf0, 0x08, 0x01,
+    0x08, 0x03, 0x00, 0x30, 0x0e, 0x00, 0x47, 0x00, 0xa9, 0xff, 0x02, 0x00, 0x0d, 0x0b, 0x06, 0x06,
+    0x00, 0xf0, 0x0d, 0x0b, 0x03, 0x06, 0x00, 0x20, 0x26, 0x00, 0x0e, 0x00, 0x2e, 0xff, 0x02, 0x00,
+    0x05, 0x0b, 0x06, 0x06, 0x00, 0xf0, 0x08, 0x0b, 0x03, 0x06, 0x00, 0x20, 0xdd, 0xff, 0x01, 0xff,
+    0x30, 0x00, 0x02, 0x00, 0x03, 0x0a, 0x13, 0x03, 0x00, 0xf0, 0x03, 0x0b, 0x13, 0x01, 0x00, 0x30,
+    0x60, 0xff, 0xcf, 0xfe, 0xf9, 0xff, 0x02, 0x00, 0x00, 0x02, 0x06, 0x09, 0x00, 0xf0, 0x00, 0x05,
+    0x06, 0x03, 0x00, 0x30, 0x65, 0x00, 0x26, 0x00, 0x76, 0xff, 0x02, 0x00, 0x0e, 0x10, 0x0a, 0x06,
+    0x00, 0xf0, 0x0e, 0x12, 0x0a, 0x02, 0x00, 0x30, 0x71, 0xff, 0x95, 0xfe, 0xf6, 0xff, 0x02, 0x00,
+    0x00, 0x10, 0x0a, 0x06, 0x00, 0xf0, 0x00, 0x12, 0x0a, 0x02, 0x00, 0x30, 0xb5, 0xff, 0xb8, 0xff,
+    0x27, 0x00, 0x02, 0x00, 0x0e, 0x0d, 0x09, 0x06, 0x00, 0xf0, 0x0e, 0x0f, 0x09, 0x02, 0x00, 0x30,
+    0xc9, 0xff, 0x79, 0x00, 0xc8, 0xff, 0x02, 0x00, 0x00, 0x10, 0x12, 0x03, 0x00, 0xf0, 0x00, 0x11,
+    0x12, 0x01, 0x00, 0x30, 0x19, 0x00, 0xf1, 0xff, 0x9b, 0x00, 0x02, 0x00, 0x06, 0x10, 0x12, 0x03,
+    0x00, 0xf0, 0x06, 0x11, 0x12, 0x01, 0x00, 0x30, 0xb5, 0xff, 0x25, 0xff, 0xfd, 0xff, 0x02, 0x00,
+    0x00, 0x12, 0x09, 0x06, 0x00, 0xf0, 0x00, 0x14, 0x09, 0x02, 0x00, 0x30, 0x3a, 0x00, 0x2a, 0x00,
+    0xba, 0xff, 0x02, 0x00, 0x0e, 0x0d, 0x09, 0x06, 0x00, 0xf0, 0x0e, 0x0f, 0x09, 0x02, 0x00, 0x30,
+    0x7b, 0xff, 0xd4, 0xfe, 0xf6, 0xff, 0x02, 0x00, 0x06, 0x02, 0x06, 0x09, 0x00, 0xf0, 0x08, 0x02,
+    0x02, 0x09, 0x00, 0x30, 0xf6, 0xff, 0x43, 0x00, 0xf2, 0xff, 0x02, 0x00, 0x0f, 0x08, 0x04, 0x0c,
+    0x00, 0xf0, 0x0f, 0x08, 0x02, 0x0c, 0x00, 0x20, 0xfd, 0xff, 0x09, 0x00, 0x74, 0xff, 0x02, 0x00,
+    0x08, 0x0d, 0x08, 0x08, 0x00, 0xf0, 0x08, 0x11, 0x08, 0x04, 0x00, 0x20, 0xc2, 0x00, 0xf6, 0xff,
+    0x7b, 0x00, 0x02, 0x00, 0x04, 0x14, 0x12, 0x03, 0x00, 0xf0, 0x0a, 0x14, 0x06, 0x03, 0x00, 0x30,
+    0xe4, 0xff, 0x49, 0x00, 0xac, 0xff, 0x02, 0x00, 0x05, 0x08, 0x04, 0x0c, 0x00, 0xf0, 0x07, 0x08,
+    0x02, 0x0c, 0x00, 0x20, 0x50, 0xff, 0x98, 0xfe, 0x20, 0x00, 0x02, 0x00, 0x07, 0x07, 0x0c, 0x03,
+    0x00, 0xf0, 0x07, 0x07, 0x06, 0x03, 0x00, 0x20, 0x54, 0x00, 0xca, 0xff, 0x8a, 0x00, 0x02, 0x00,
+    0x0a, 0x06, 0x04, 0x09, 0x00, 0xf0, 0x0c, 0x06, 0x02, 0x09, 0x00, 0x20, 0xa5, 0xff, 0x56, 0x00,
+    0x0b, 0x00, 0x02, 0x00, 0x05, 0x14, 0x12, 0x03, 0x00, 0xf0, 0x0b, 0x14, 0x06, 0x03, 0x00, 0x30,
+    0xcc, 0x00, 0xc0, 0xff, 0x6a, 0x00, 0x02, 0x00, 0x01, 0x14, 0x12, 0x03, 0x00, 0xf0, 0x07, 0x14,
+    0x06, 0x03, 0x00, 0x30, 0xfd, 0x00, 0x0a, 0x00, 0xb0, 0x00, 0x03, 0x00, 0x12, 0x01, 0x06, 0x14,
+    0x00, 0xf0, 0x15, 0x01, 0x03, 0x0a, 0x00, 0x20, 0x12, 0x0b, 0x03, 0x0a, 0x00, 0x20, 0x55, 0xff,
+    0x87, 0x00, 0xc6, 0xff, 0x03, 0x00, 0x00, 0x01, 0x06, 0x14, 0x00, 0xf0, 0x00, 0x01, 0x03, 0x0a,
+    0x00, 0x20, 0x03, 0x0b, 0x03, 0x0a, 0x00, 0x20, 0xf3, 0xff, 0x40, 0x00, 0xc9, 0xff, 0x03, 0x00,
+    0x0d, 0x03, 0x04, 0x12, 0x00, 0xf0, 0x0f, 0x03, 0x02, 0x09, 0x00, 0x20, 0x0d, 0x0c, 0x02, 0x09,
+    0x00, 0x20, 0x63, 0x00, 0x01, 0x00, 0x47, 0xff, 0x02, 0x00, 0x00, 0x02, 0x06, 0x0c, 0x00, 0xf0,
+    0x00, 0x06, 0x06, 0x04, 0x00, 0x30, 0xba, 0xff, 0x81, 0xff, 0x2f, 0x00, 0x03, 0x00, 0x0c, 0x09,
+    0x0c, 0x06, 0x00, 0xf0, 0x12, 0x09, 0x06, 0x03, 0x00, 0x20, 0x0c, 0x0c, 0x06, 0x03, 0x00, 0x20,
+    0xf0, 0xff, 0x15, 0x00, 0x8a, 0xff, 0x03, 0x00, 0x07, 0x03, 0x04, 0x12, 0x00, 0xf0, 0x07, 0x03,
+    0x02, 0x09, 0x00, 0x20, 0x09, 0x0c, 0x02, 0x09, 0x00, 0x20, 0xc6, 0xff, 0x7b, 0xff, 0x3d, 0x00,
+    0x02, 0x00, 0x0e, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x10, 0x00, 0x02, 0x09, 0x00, 0x30, 0xdb, 0xff,
+    0x5f, 0xff, 0x08, 0x00, 0x03, 0x00, 0x00, 0x09, 0x0c, 0x06, 0x00, 0xf0, 0x00, 0x09, 0x06, 0x03,
+    0x00, 0x20, 0x06, 0x0c, 0x06, 0x03, 0x00, 0x20, 0x06, 0xfe, 0x49, 0x01, 0x13, 0x00, 0x03, 0x00,
+    0x0e, 0x04, 0x08, 0x14, 0x00, 0xf0, 0x12, 0x04, 0x04, 0x0a, 0x00, 0x20, 0x0e, 0x0e, 0x04, 0x0a,
+    0x00, 0x20, 0xb0, 0xfe, 0xd5, 0x00, 0xd1, 0xff, 0x03, 0x00, 0x02, 0x04, 0x08, 0x14, 0x00, 0xf0,
+    0x02, 0x04, 0x04, 0x0a, 0x00, 0x20, 0x06, 0x0e, 0x04, 0x0a, 0x00, 0x20, 0x0c, 0x01, 0x1c, 0x00,
+    0x00, 0xe2, 0x02, 0x00, 0x0e, 0x0d, 0x09, 0x06, 0x00, 0xf0, 0x0e, 0x0f, 0x09, 0x02, 0x00, 0x30,
+    0x7f, 0xff, 0xa7, 0xfe, 0xf4, 0xff, 0x02, 0x00, 0x01, 0x0d, 0x09, 0x06, 0x00, 0xf0, 0x01, 0x0f,
+    0x09, 0x02, 0x00, 0x30, 0xba, 0xfe, 0xa6, 0xfe, 0x28, 0x00, 0x02, 0x00, 0x03, 0x0f, 0x12, 0x03,
+    0x00, 0xf0, 0x09, 0x0f, 0x06, 0x03, 0x00, 0x30, 0xb3, 0xff, 0x67, 0x00, 0xc0, 0xff, 0x02, 0x00,
+    0x05, 0x0d, 0x09, 0x06, 0x00, 0xf0, 0x05, 0x0f, 0x09, 0x02, 0x00, 0x30, 0xec, 0xff, 0xbd, 0xff,
+    0x2f, 0x00, 0x02, 0x00, 0x05, 0x00, 0x12, 0x03, 0x00, 0xf0, 0x05, 0x01, 0x12, 0x01, 0x00, 0x30,
+    0xce, 0xff, 0x96, 0x00, 0xcf, 0xff, 0x02, 0x00, 0x08, 0x02, 0x06, 0x07, 0x00, 0xf0, 0x0b, 0x02,
+    0x03, 0x07, 0x00, 0x20, 0x05, 0x00, 0xd6, 0xff, 0x3a, 0x00, 0x02, 0x00, 0x09, 0x01, 0x09, 0x06,
+    0x00, 0xf0, 0x0c, 0x01, 0x03, 0x06, 0x00, 0x30, 0x79, 0x00, 0x03, 0x00, 0x56, 0xff, 0x02, 0x00,
+    0x06, 0x01, 0x09, 0x06, 0x00, 0xf0, 0x09, 0x01, 0x03, 0x06, 0x00, 0x30, 0x73, 0x00, 0xfc, 0xff,
+    0xa5, 0x00, 0x03, 0x00, 0x05, 0x06, 0x0e, 0x06, 0x00, 0xf0, 0x0c, 0x06, 0x07, 0x03, 0x00, 0x20,
+    0x05, 0x09, 0x07, 0x03, 0x00, 0x20, 0x7c, 0x00, 0xc3, 0xff, 0x59, 0x00, 0x02, 0x00, 0x08, 0x02,
+    0x06, 0x0d, 0x00, 0xf0, 0x0a, 0x02, 0x02, 0x0d, 0x00, 0x30, 0xba, 0xff, 0x77, 0xff, 0x35, 0x00,
+    0x03, 0x00, 0x06, 0x0b, 0x0c, 0x06, 0x00, 0xf0, 0x0c, 0x0b, 0x06, 0x03, 0x00, 0x20, 0x06, 0x0e,
+    0x06, 0x03, 0x00, 0x20, 0xa8, 0xfe, 0xc0, 0x00, 0xd3, 0xff, 0x02, 0x00, 0x03, 0x01, 0x12, 0x0f,
+    0x00, 0xf0, 0x09, 0x01, 0x06, 0x0f, 0x00, 0x30, 0x1e, 0x00, 0xd7, 0xff, 0x4e, 0x00, 0x02, 0x00,
+    0x0d, 0x00, 0x06, 0x07, 0x00, 0xf0, 0x0d, 0x00, 0x03, 0x07, 0x00, 0x20, 0xe7, 0x00, 0xd4, 0xff,
+    0x00, 0x01, 0x02, 0x00, 0x03, 0x03, 0x10, 0x06, 0x00, 0xf0, 0x03, 0x06, 0x10, 0x03, 0x00, 0x20,
+    0xeb, 0xff, 0x3b, 0x00, 0xf0, 0xff, 0x02, 0x00, 0x0c, 0x01, 0x03, 0x0c, 0x00, 0xf0, 0x0c, 0x07,
+    0x03, 0x06, 0x00, 0x20, 0xc3, 0xff, 0x40, 0x00, 0xb2, 0xff, 0x02, 0x00, 0x07, 0x07, 0x06, 0x09,
+    0x00, 0xf0, 0x09, 0x07, 0x02, 0x09, 0x00, 0x30, 0xe0, 0x00, 0x21, 0x00, 0x10, 0xff, 0x02, 0x00,
+    0x0d, 0x00, 0x04, 0x18, 0x00, 0xf0, 0x0d, 0x00, 0x02, 0x18, 0x00, 0x20, 0xb0, 0xff, 0x2a, 0xff,
+    0xfa, 0xff, 0x02, 0x00, 0x07, 0x00, 0x04, 0x18, 0x00, 0xf0, 0x09, 0x00, 0x02, 0x18, 0x00, 0x20,
+    0xed, 0xfe, 0x5b, 0x02, 0x15, 0x00, 0x02, 0x00, 0x0b, 0x09, 0x05, 0x0c, 0x00, 0xf0, 0x0b, 0x0d,
+    0x05, 0x04, 0x00, 0x30, 0xc6, 0xff, 0x30, 0x00, 0xb1, 0xff, 0x02, 0x00, 0x07, 0x0f, 0x09, 0x06,
+    0x00, 0xf0, 0x07, 0x11, 0x09, 0x02, 0x00, 0x30, 0x7a, 0x00, 0x25, 0x00, 0x28, 0xff, 0x02, 0x00,
+    0x05, 0x07, 0x12, 0x06, 0x00, 0xf0, 0x05, 0x09, 0x12, 0x02, 0x00, 0x30, 0xd4, 0x00, 0xf5, 0xff,
+    0xaa, 0xfe, 0x02, 0x00, 0x08, 0x09, 0x05, 0x0c, 0x00, 0xf0, 0x08, 0x0d, 0x05, 0x04, 0x00, 0x30,
+    0xa8, 0x00, 0x2d, 0x00, 0x65, 0xff, 0x02, 0x00, 0x04, 0x11, 0x11, 0x06, 0x00, 0xf0, 0x04, 0x13,
+    0x11, 0x02, 0x00, 0x30, 0xf2, 0xfd, 0x04, 0xff, 0xf7, 0xff, 0x03, 0x00, 0x00, 0x03, 0x12, 0x0e,
+    0x00, 0xf0, 0x00, 0x03, 0x09, 0x07, 0x00, 0x20, 0x09, 0x0a, 0x09, 0x07, 0x00, 0x20, 0x09, 0x00,
+    0xd7, 0xff, 0x53, 0x00, 0x02, 0x00, 0x00, 0x01, 0x18, 0x02, 0x00, 0xf0, 0x00, 0x02, 0x18, 0x01,
+    0x00, 0x20, 0x1f, 0x00, 0xc3, 0xff, 0x4b, 0x00, 0x02, 0x00, 0x00, 0x0f, 0x12, 0x03, 0x00, 0xf0,
+    0x00, 0x10, 0x12, 0x01, 0x00, 0x30, 0xba, 0x00, 0x24, 0x00, 0x80, 0xfe, 0x02, 0x00, 0x09, 0x00,
+    0x06, 0x09, 0x00, 0xf0, 0x0b, 0x00, 0x02, 0x09, 0x00, 0x30, 0xbe, 0xfe, 0xf6, 0xfe, 0xf5, 0xff,
+    0x02, 0x00, 0x03, 0x03, 0x0e, 0x0c, 0x00, 0xf0, 0x03, 0x09, 0x0e, 0x06, 0x00, 0x20, 0x20, 0x00,
+    0x32, 0x00, 0xdb, 0xff, 0x02, 0x00, 0x0c, 0x01, 0x03, 0x0c, 0x00, 0xf0, 0x0c, 0x07, 0x03, 0x06,
+    0x00, 0x20, 0xc9, 0xff, 0x18, 0xff, 0xf7, 0xff, 0x02, 0x00, 0x08, 0x00, 0x06, 0x09, 0x00, 0xf0,
+    0x0a, 0x00, 0x02, 0x09, 0x00, 0x30, 0x76, 0x00, 0xf9, 0xff, 0x99, 0x00, 0x02, 0x00, 0x0a, 0x06,
+    0x06, 0x0a, 0x00, 0xf0, 0x0c, 0x06, 0x02, 0x0a, 0x00, 0x30, 0x90, 0xff, 0x01, 0xff, 0xf7, 0xff,
+    0x02, 0x00, 0x05, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x07, 0x00, 0x02, 0x09, 0x00, 0x30, 0xd6, 0xfe,
+    0xbb, 0x00, 0x0e, 0x00, 0x02, 0x00, 0x02, 0x00, 0x15, 0x07, 0x00, 0xf0, 0x09, 0x00, 0x07, 0x07,
+    0x00, 0x30, 0xc7, 0xff, 0x47, 0x00, 0xbd, 0xff, 0x02, 0x00, 0x06, 0x0b, 0x0c, 0x05, 0x00, 0xf0,
+    0x0a, 0x0b, 0x04, 0x05, 0x00, 0x30, 0xb1, 0x00, 0x01, 0x00, 0x5b, 0x00, 0x02, 0x00, 0x08, 0x07,
+    0x09, 0x08, 0x00, 0xf0, 0x0b, 0x07, 0x03, 0x08, 0x00, 0x30, 0x78, 0x00, 0xcd, 0xff, 0x83, 0x00,
+    0x03, 0x00, 0x09, 0x06, 0x06, 0x12, 0x00, 0xf0, 0x09, 0x06, 0x03, 0x09, 0x00, 0x20, 0x0c, 0x0f,
+    0x03, 0x09, 0x00, 0x20, 0x7e, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0f, 0x0e, 0x08, 0x0a,
+    0x00, 0xf0, 0x13, 0x0e, 0x04, 0x05, 0x00, 0x20, 0x0f, 0x13, 0x04, 0x05, 0x00, 0x20, 0x9b, 0x00,
+    0xd1, 0xff, 0x9d, 0x00, 0x03, 0x00, 0x01, 0x0e, 0x08, 0x0a, 0x00, 0xf0, 0x01, 0x0e, 0x04, 0x05,
+    0x00, 0x20, 0x05, 0x13, 0x04, 0x05, 0x00, 0x20, 0xa5, 0xff, 0xb6, 0xff, 0x2e, 0x00, 0x03, 0x00,
+    0x0b, 0x00, 0x08, 0x0a, 0x00, 0xf0, 0x0f, 0x00, 0x04, 0x05, 0x00, 0x20, 0x0b, 0x05, 0x04, 0x05,
+    0x00, 0x20, 0xf1, 0x00, 0xef, 0xff, 0x13, 0xfe, 0x03, 0x00, 0x05, 0x00, 0x08, 0x0a, 0x00, 0xf0,
+    0x05, 0x00, 0x04, 0x05, 0x00, 0x20, 0x09, 0x05, 0x04, 0x05, 0x00, 0x20, 0x7f, 0x00, 0xfd, 0xff,
+    0x9d, 0x00, 0x02, 0x00, 0x06, 0x01, 0x0c, 0x05, 0x00, 0xf0, 0x06, 0x01, 0x06, 0x05, 0x00, 0x20,
+    0x99, 0x00, 0xcb, 0xff, 0x71, 0x00, 0x02, 0x00, 0x01, 0x0c, 0x12, 0x02, 0x00, 0xf0, 0x0a, 0x0c,
+    0x09, 0x02, 0x00, 0x20, 0xab, 0xff, 0xa5, 0xff, 0x3e, 0x00, 0x03, 0x00, 0x02, 0x08, 0x14, 0x06,
+    0x00, 0xf0, 0x0c, 0x08, 0x0a, 0x03, 0x00, 0x20, 0x02, 0x0b, 0x0a, 0x03, 0x00, 0x20, 0x98, 0xff,
+    0x15, 0x01, 0xda, 0xff, 0x02, 0x00, 0x07, 0x06, 0x09, 0x07, 0x00, 0xf0, 0x0a, 0x06, 0x03, 0x07,
+    0x00, 0x30, 0xe3, 0xff, 0x36, 0x00, 0xd2, 0xff, 0x03, 0x00, 0x0a, 0x05, 0x08, 0x10, 0x00, 0xf0,
+    0x0e, 0x05, 0x04, 0x08, 0x00, 0x20, 0x0a, 0x0d, 0x04, 0x08, 0x00, 0x20, 0x30, 0xff, 0x84, 0x00,
+    0xd0, 0xff, 0x03, 0x00, 0x03, 0x09, 0x10, 0x08, 0x00, 0xf0, 0x03, 0x09, 0x08, 0x04, 0x00, 0x20,
+    0x0b, 0x0d, 0x08, 0x04, 0x00, 0x20, 0xac, 0xff, 0x90, 0xff, 0x3a, 0x00, 0x02, 0x00, 0x07, 0x08,
+    0x0a, 0x04, 0x00, 0xf0, 0x07, 0x08, 0x05, 0x04, 0x00, 0x20, 0x2b, 0x00, 0x08, 0x00, 0x7c, 0xff,
+    0x03, 0x00, 0x07, 0x0c, 0x0a, 0x08, 0x00, 0xf0, 0x07, 0x0c, 0x05, 0x04, 0x00, 0x20, 0x0c, 0x10,
+    0x05, 0x04, 0x00, 0x20, 0x82, 0x00, 0x03, 0x00, 0x59, 0x00, 0x02, 0x00, 0x09, 0x13, 0x0f, 0x04,
+    0x00, 0xf0, 0x0e, 0x13, 0x05, 0x04, 0x00, 0x30, 0x9f, 0xff, 0x57, 0x00, 0xc9, 0xff, 0x02, 0x00,
+    0x01, 0x00, 0x12, 0x09, 0x00, 0xf0, 0x07, 0x00, 0x06, 0x09, 0x00, 0x30, 0xe8, 0xff, 0x54, 0x00,
+    0xb7, 0xff, 0x03, 0x00, 0x0d, 0x04, 0x0a, 0x08, 0x00, 0xf0, 0x12, 0x04, 0x05, 0x04, 0x00, 0x20,
+    0x0d, 0x08, 0x05, 0x04, 0x00, 0x20, 0x61, 0x00, 0xc0, 0xff, 0x43, 0x00, 0x02, 0x00, 0x03, 0x10,
+    0x12, 0x04, 0x00, 0xf0, 0x09, 0x10, 0x06, 0x04, 0x00, 0x30, 0x72, 0x00, 0x23, 0x00, 0x81, 0xff,
+    0x03, 0x00, 0x08, 0x07, 0x0a, 0x0c, 0x00, 0xf0, 0x0d, 0x07, 0x05, 0x06, 0x00, 0x20, 0x08, 0x0d,
+    0x05, 0x06, 0x00, 0x20, 0x3b, 0x00, 0xfd, 0xff, 0x3b, 0xff, 0x03, 0x00, 0x06, 0x07, 0x0a, 0x0c,
+    0x00, 0xf0, 0x06, 0x07, 0x05, 0x06, 0x00, 0x20, 0x0b, 0x0d, 0x05, 0x06, 0x00, 0x20, 0xbd, 0x01,
+    0x30, 0x00, 0xae, 0xff, 0x02, 0x00, 0x04, 0x06, 0x12, 0x07, 0x00, 0xf0, 0x0a, 0x06, 0x06, 0x07,
+    0x00, 0x30, 0xc7, 0xff, 0x59, 0x00, 0xc7, 0xff, 0x02, 0x00, 0x00, 0x11, 0x12, 0x03, 0x00, 0xf0,
+    0x00, 0x12, 0x12, 0x01, 0x00, 0x30, 0x10, 0x00, 0xf7, 0xff, 0x83, 0x00, 0x02, 0x00, 0x03, 0x11,
+    0x12, 0x03, 0x00, 0xf0, 0x03, 0x12, 0x12, 0x01, 0x00, 0x30, 0xec, 0xff, 0x93, 0xff, 0x0c, 0x00,
+    0x02, 0x00, 0x02, 0x04, 0x06, 0x0a, 0x00, 0xf0, 0x04, 0x04, 0x02, 0x0a, 0x00, 0x30, 0xa4, 0xfe,
+    0xaa, 0x00, 0x01, 0x00, 0x02, 0x00, 0x10, 0x00, 0x08, 0x18, 0x00, 0xf0, 0x10, 0x00, 0x04, 0x18,
+    0x00, 0x20, 0x08, 0x00, 0x83, 0xff, 0x11, 0x00, 0x02, 0x00, 0x04, 0x00, 0x08, 0x0f, 0x00, 0xf0,
+    0x08, 0x00, 0x04, 0x0f, 0x00, 0x20, 0xd2, 0x05, 0x21, 0x00, 0x1b, 0xfe, 0x02, 0x00, 0x10, 0x00,
+    0x08, 0x18, 0x00, 0xf0, 0x10, 0x00, 0x04, 0x18, 0x00, 0x20, 0x88, 0x03, 0xf2, 0xff, 0x93, 0xfe,
+    0x02, 0x00, 0x01, 0x04, 0x12, 0x09, 0x00, 0xf0, 0x07, 0x04, 0x06, 0x09, 0x00, 0x30, 0xbe, 0xff,
+    0x6d, 0xff, 0x2e, 0x00, 0x02, 0x00, 0x0f, 0x0c, 0x09, 0x06, 0x00, 0xf0, 0x0f, 0x0e, 0x09, 0x02,
+    0x00, 0x30, 0x3b, 0xff, 0xf9, 0x00, 0xd6, 0xff, 0x03, 0x00, 0x03, 0x09, 0x12, 0x06, 0x00, 0xf0,
+    0x03, 0x09, 0x09, 0x03, 0x00, 0x20, 0x0c, 0x0c, 0x09, 0x03, 0x00, 0x20, 0x47, 0x00, 0x2d, 0x00,
+    0xb9, 0xff, 0x02, 0x00, 0x12, 0x05, 0x06, 0x09, 0x00, 0xf0, 0x12, 0x08, 0x06, 0x03, 0x00, 0x30,
+    0x74, 0xff, 0x31, 0xff, 0xfc, 0xff, 0x02, 0x00, 0x00, 0x05, 0x06, 0x09, 0x00, 0xf0, 0x00, 0x08,
+    0x06, 0x03, 0x00, 0x30, 0xee, 0xff, 0x47, 0x00, 0xff, 0xff, 0x03, 0x00, 0x04, 0x07, 0x12, 0x04,
+    0x00, 0xf0, 0x0d, 0x07, 0x09, 0x02, 0x00, 0x20, 0x04, 0x09, 0x09, 0x02, 0x00, 0x20, 0x10, 0x02,
+    0xde, 0xff, 0x8a, 0x02, 0x03, 0x00, 0x02, 0x01, 0x0c, 0x14, 0x00, 0xf0, 0x02, 0x01, 0x06, 0x0a,
+    0x00, 0x20, 0x08, 0x0b, 0x06, 0x0a, 0x00, 0x20, 0x7c, 0x00, 0xef, 0xff, 0x49, 0x00, 0x02, 0x00,
+    0x11, 0x00, 0x06, 0x17, 0x00, 0xf0, 0x11, 0x00, 0x03, 0x17, 0x00, 0x20, 0xb4, 0x00, 0xd2, 0xff,
+    0xa7, 0x00, 0x02, 0x00, 0x01, 0x06, 0x02, 0x12, 0x00, 0xf0, 0x01, 0x0f, 0x02, 0x09, 0x00, 0x20,
+    0x0c, 0x00, 0xd8, 0xff, 0x45, 0x00, 0x02, 0x00, 0x08, 0x08, 0x0a, 0x06, 0x00, 0xf0, 0x08, 0x0a,
+    0x0a, 0x02, 0x00, 0x30, 0x95, 0xff, 0x4a, 0x00, 0xc0, 0xff, 0x03, 0x00, 0x00, 0x06, 0x14, 0x06,
+    0x00, 0xf0, 0x00, 0x06, 0x0a, 0x03, 0x00, 0x20, 0x0a, 0x09, 0x0a, 0x03, 0x00, 0x20, 0x8e, 0xff,
+    0x71, 0x00, 0x0e, 0x00, 0x02, 0x00, 0x0b, 0x0c, 0x0c, 0x05, 0x00, 0xf0, 0x0f, 0x0c, 0x04, 0x05,
+    0x00, 0x30, 0x30, 0x00, 0xcf, 0xff, 0x77, 0x00, 0x02, 0x00, 0x00, 0x04, 0x03, 0x13, 0x00, 0xf0,
+    0x01, 0x04, 0x01, 0x13, 0x00, 0x30, 0x06, 0x00, 0xfe, 0xff, 0x41, 0x00, 0x02, 0x00, 0x13, 0x01,
+    0x03, 0x12, 0x00, 0xf0, 0x14, 0x01, 0x01, 0x12, 0x00, 0x30, 0xf2, 0xff, 0x94, 0xff, 0x12, 0x00,
+    0x02, 0x00, 0x02, 0x01, 0x03, 0x12, 0x00, 0xf0, 0x03, 0x01, 0x01, 0x12, 0x00, 0x30, 0x7f, 0xff,
+    0x26, 0xff, 0x2b, 0x00, 0x02, 0x00, 0x03, 0x0a, 0x12, 0x03, 0x00, 0xf0, 0x09, 0x0a, 0x06, 0x03,
+    0x00, 0x30, 0x7d, 0xff, 0xd6, 0x00, 0xd3, 0xff, 0x02, 0x00, 0x04, 0x04, 0x0a, 0x09, 0x00, 0xf0,
+    0x09, 0x04, 0x05, 0x09, 0x00, 0x20, 0x7c, 0x02, 0x19, 0x00, 0x63, 0x02, 0x02, 0x00, 0x07, 0x0d,
+    0x0e, 0x07, 0x00, 0xf0, 0x07, 0x0d, 0x07, 0x07, 0x00, 0x20, 0x68, 0x01, 0xd1, 0xff, 0x9f, 0x00,
+    0x02, 0x00, 0x03, 0x0d, 0x0e, 0x07, 0x00, 0xf0, 0x0a, 0x0d, 0x07, 0x07, 0x00, 0x20, 0xfa, 0xff,
+    0x40, 0x00, 0xf0, 0xff, 0x02, 0x00, 0x08, 0x0f, 0x09, 0x06, 0x00, 0xf0, 0x0b, 0x0f, 0x03, 0x06,
+    0x00, 0x30, 0x26, 0x00, 0xa6, 0xff, 0x1b, 0x00, 0x03, 0x00, 0x04, 0x0e, 0x08, 0x0a, 0x00, 0xf0,
+    0x04, 0x0e, 0x04, 0x05, 0x00, 0x20, 0x08, 0x13, 0x04, 0x05, 0x00, 0x20, 0x98, 0x00, 0x29, 0x00,
+    0x16, 0xff, 0x02, 0x00, 0x0a, 0x0e, 0x04, 0x0a, 0x00, 0xf0, 0x0a, 0x13, 0x04, 0x05, 0x00, 0x20,
+    0x48, 0x01, 0xdb, 0xff, 0x7d, 0x01, 0x02, 0x00, 0x03, 0x08, 0x05, 0x10, 0x00, 0xf0, 0x03, 0x10,
+    0x05, 0x08, 0x00, 0x20, 0xfd, 0xff, 0xca, 0xff, 0x32, 0x00, 0x02, 0x00, 0x0f, 0x0a, 0x09, 0x06,
+    0x00, 0xf0, 0x0f, 0x0c, 0x09, 0x02, 0x00, 0x30, 0xec, 0xff, 0x4a, 0xff, 0x00, 0x00, 0x02, 0x00,
+    0x00, 0x0a, 0x09, 0x06, 0x00, 0xf0, 0x00, 0x0c, 0x09, 0x02, 0x00, 0x30, 0xe9, 0x01, 0x08, 0x00,
+    0x0b, 0x01, 0x02, 0x00, 0x06, 0x07, 0x0c, 0x09, 0x00, 0xf0, 0x06, 0x0a, 0x0c, 0x03, 0x00, 0x30,
+    0xee, 0xff, 0xbb, 0xff, 0x45, 0x00, 0x02, 0x00, 0x09, 0x0a, 0x05, 0x08, 0x00, 0xf0, 0x09, 0x0e,
+    0x05, 0x04, 0x00, 0x20, 0x87, 0xff, 0x5c, 0x00, 0x0e, 0x00, 0x02, 0x00, 0x0c, 0x01, 0x03, 0x0c,
+    0x00, 0xf0, 0x0c, 0x07, 0x03, 0x06, 0x00, 0x20, 0x6d, 0x00, 0xf4, 0xff, 0x09, 0xff, 0x02, 0x00,
+    0x08, 0x0f, 0x06, 0x09, 0x00, 0xf0, 0x0a, 0x0f, 0x02, 0x09, 0x00, 0x30, 0xb5, 0x00, 0x21, 0x00,
+    0xa7, 0xff, 0x02, 0x00, 0x10, 0x06, 0x07, 0x06, 0x00, 0xf0, 0x10, 0x09, 0x07, 0x03, 0x00, 0x20,
+    0x9d, 0xff, 0xed, 0xfe, 0xf3, 0xff, 0x02, 0x00, 0x08, 0x01, 0x04, 0x16, 0x00, 0xf0, 0x0a, 0x01,
+    0x02, 0x16, 0x00, 0x20, 0x50, 0x00, 0x06, 0x00, 0x47, 0x00, 0x02, 0x00, 0x06, 0x06, 0x0e, 0x03,
+    0x00, 0xf0, 0x06, 0x06, 0x07, 0x03, 0x00, 0x20, 0x16, 0x00, 0xbe, 0xff, 0x35, 0x00, 0x02, 0x00,
+    0x00, 0x12, 0x13, 0x03, 0x00, 0xf0, 0x00, 0x13, 0x13, 0x01, 0x00, 0x30, 0x4a, 0xfc, 0x3a, 0xfe,
+    0x1d, 0x00, 0x02, 0x00, 0x11, 0x00, 0x06, 0x18, 0x00, 0xf0, 0x11, 0x00, 0x03, 0x18, 0x00, 0x20,
+    0x98, 0xff, 0x4c, 0x00, 0xc7, 0xff, 0x02, 0x00, 0x00, 0x0d, 0x0f, 0x06, 0x00, 0xf0, 0x05, 0x0d,
+    0x05, 0x06, 0x00, 0x30, 0xe6, 0xff, 0x32, 0x00, 0xe7, 0xff, 0x03, 0x00, 0x09, 0x06, 0x0a, 0x0e,
+    0x00, 0xf0, 0x0e, 0x06, 0x05, 0x07, 0x00, 0x20, 0x09, 0x0d, 0x05, 0x07, 0x00, 0x20, 0x10, 0x00,
+    0x92, 0xff, 0x14, 0x00, 0x03, 0x00, 0x01, 0x06, 0x08, 0x0a, 0x00, 0xf0, 0x01, 0x06, 0x04, 0x05,
+    0x00, 0x20, 0x05, 0x0b, 0x04, 0x05, 0x00, 0x20, 0x6e, 0xff, 0x7e, 0xff, 0x29, 0x00, 0x02, 0x00,
+    0x07, 0x06, 0x0c, 0x05, 0x00, 0xf0, 0x07, 0x06, 0x06, 0x05, 0x00, 0x20, 0xc6, 0xff, 0xc7, 0x00,
+    0xd4, 0xff, 0x02, 0x00, 0x07, 0x07, 0x09, 0x06, 0x00, 0xf0, 0x0a, 0x07, 0x03, 0x06, 0x00, 0x30,
+    0xfb, 0xfd, 0x5f, 0xff, 0x20, 0x00, 0x03, 0x00, 0x07, 0x08, 0x0e, 0x0e, 0x00, 0xf0, 0x0e, 0x08,
+    0x07, 0x07, 0x00, 0x20, 0x07, 0x0f, 0x07, 0x07, 0x00, 0x20, 0x19, 0x01, 0xf5, 0xff, 0xe4, 0xfe,
+    0x03, 0x00, 0x03, 0x08, 0x0e, 0x0e, 0x00, 0xf0, 0x03, 0x08, 0x07, 0x07, 0x00, 0x20, 0x0a, 0x0f,
+    0x07, 0x07, 0x00, 0x20, 0x5f, 0x01, 0x1e, 0x00, 0x2e, 0xfb, 0x02, 0x00, 0x09, 0x08, 0x0d, 0x04,
+    0x00, 0xf0, 0x09, 0x0a, 0x0d, 0x02, 0x00, 0x20, 0x3f, 0x00, 0xfc, 0xff, 0x5d, 0xff, 0x03, 0x00,
+    0x03, 0x02, 0x06, 0x0c, 0x00, 0xf0, 0x03, 0x02, 0x03, 0x06, 0x00, 0x20, 0x06, 0x08, 0x03, 0x06,
+    0x00, 0x20, 0x4c, 0x01, 0x16, 0x00, 0x74, 0x02, 0x02, 0x00, 0x06, 0x0a, 0x11, 0x06, 0x00, 0xf0,
+    0x06, 0x0d, 0x11, 0x03, 0x00, 0x20, 0x4b, 0x00, 0x0a, 0x00, 0x7e, 0xff, 0x02, 0x00, 0x01, 0x0a,
+    0x11, 0x06, 0x00, 0xf0, 0x01, 0x0d, 0x11, 0x03, 0x00, 0x20, 0x9f, 0xfe, 0x1a, 0xfe, 0x1c, 0x00,
+    0x02, 0x00, 0x10, 0x07, 0x08, 0x09, 0x00, 0xf0, 0x10, 0x0a, 0x08, 0x03, 0x00, 0x30, 0x28, 0x01,
+    0xf1, 0xff, 0x96, 0xfe, 0x02, 0x00, 0x00, 0x07, 0x08, 0x09, 0x00, 0xf0, 0x00, 0x0a, 0x08, 0x03,
+    0x00, 0x30, 0xc0, 0xfe, 0xe3, 0x00, 0x0a, 0x00, 0x03, 0x00, 0x00, 0x09, 0x18, 0x0a, 0x00, 0xf0,
+    0x0c, 0x09, 0x0c, 0x05, 0x00, 0x20, 0x00, 0x0e, 0x0c, 0x05, 0x00, 0x20, 0x8c, 0x01, 0xc8, 0xff,
+    0x55, 0x00, 0x02, 0x00, 0x03, 0x02, 0x0f, 0x08, 0x00, 0xf0, 0x08, 0x02, 0x05, 0x08, 0x00, 0x30,
+    0x5d, 0xff, 0x93, 0x00, 0x0b, 0x00, 0x02, 0x00, 0x04, 0x02, 0x12, 0x08, 0x00, 0xf0, 0x0a, 0x02,
+    0x06, 0x08, 0x00, 0x30, 0xd9, 0xff, 0x76, 0xff, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x12, 0x04,
+    0x00, 0xf0, 0x00, 0x01, 0x09, 0x02, 0x00, 0x20, 0x09, 0x03, 0x09, 0x02, 0x00, 0x20, 0x01, 0x00,
+    0xec, 0xff, 0x5b, 0x00, 0x02, 0x00, 0x14, 0x02, 0x03, 0x12, 0x00, 0xf0, 0x15, 0x02, 0x01, 0x12,
+    0x00, 0x30, 0x31, 0x00, 0xcd, 0xff, 0x70, 0x00, 0x02, 0x00, 0x01, 0x03, 0x03, 0x13, 0x00, 0xf0,
+    0x02, 0x03, 0x01, 0x13, 0x00, 0x30, 0xab, 0xff, 0x6a, 0x00, 0xf5, 0xff, 0x02, 0x00, 0x12, 0x08,
+    0x06, 0x10, 0x00, 0xf0, 0x14, 0x08, 0x02, 0x10, 0x00, 0x30, 0xed, 0x00, 0xf9, 0xff, 0x15, 0xff,
+    0x02, 0x00, 0x00, 0x08, 0x06, 0x10, 0x00, 0xf0, 0x02, 0x08, 0x02, 0x10, 0x00, 0x30, 0x00, 0x00,
+    0xe2, 0xff, 0x33, 0x00, 0x02, 0x00, 0x08, 0x12, 0x0b, 0x06, 0x00, 0xf0, 0x08, 0x14, 0x0b, 0x02,
+    0x00, 0x30, 0xba, 0xff, 0x54, 0x00, 0xc5, 0xff, 0x02, 0x00, 0x04, 0x06, 0x0c, 0x05, 0x00, 0xf0,
+    0x08, 0x06, 0x04, 0x05, 0x00, 0x30, 0x7d, 0x00, 0xfb, 0xff, 0x44, 0x00, 0x02, 0x00, 0x07, 0x06,
+    0x0c, 0x05, 0x00, 0xf0, 0x0b, 0x06, 0x04, 0x05, 0x00, 0x30, 0xfd, 0xff, 0x90, 0xff, 0x0c, 0x00,
+    0x02, 0x00, 0x06, 0x03, 0x09, 0x06, 0x00, 0xf0, 0x09, 0x03, 0x03, 0x06, 0x00, 0x30, 0x68, 0x01,
+    0x1e, 0x00, 0x2c, 0xfd, 0x02, 0x00, 0x07, 0x06, 0x0c, 0x05, 0x00, 0xf0, 0x07, 0x06, 0x06, 0x05,
+    0x00, 0x20, 0x61, 0xff, 0xea, 0x00, 0xd8, 0xff, 0x02, 0x00, 0x09, 0x08, 0x06, 0x07, 0x00, 0xf0,
+    0x0c, 0x08, 0x03, 0x07, 0x00, 0x20, 0x48, 0x01, 0x1c, 0x00, 0x02, 0xfe, 0x02, 0x00, 0x08, 0x02,
+    0x09, 0x06, 0x00, 0xf0, 0x0b, 0x02, 0x03, 0x06, 0x00, 0x30, 0xa1, 0x00, 0xdc, 0xff, 0x4e, 0x01,
+    0x02, 0x00, 0x08, 0x0e, 0x06, 0x09, 0x00, 0xf0, 0x08, 0x11, 0x06, 0x03, 0x00, 0x30, 0x54, 0x00,
+    0x33, 0x00, 0xf5, 0xff, 0x02, 0x00, 0x08, 0x02, 0x09, 0x06, 0x00, 0xf0, 0x0b, 0x02, 0x03, 0x06,
+    0x00, 0x30, 0xee, 0xfe, 0x53, 0x00, 0xcc, 0xff, 0x03, 0x00, 0x04, 0x03, 0x10, 0x14, 0x00, 0xf0,
+    0x04, 0x03, 0x08, 0x0a, 0x00, 0x20, 0x0c, 0x0d, 0x08, 0x0a, 0x00, 0x20, 0xbf, 0x00, 0x28, 0x00,
+    0x0c, 0xff, 0x03, 0x00, 0x07, 0x06, 0x0a, 0x0c, 0x00, 0xf0, 0x0c, 0x06, 0x05, 0x06, 0x00, 0x20,
+    0x07, 0x0c, 0x05, 0x06, 0x00, 0x20, 0x41, 0x01, 0xed, 0xff, 0xe3, 0xfd, 0x02, 0x00, 0x00, 0x02,
+    0x07, 0x0c, 0x00, 0xf0, 0x00, 0x06, 0x07, 0x04, 0x00, 0x30, 0x0f, 0x01, 0x1d, 0x00, 0x64, 0xfe,
+    0x02, 0x00, 0x0c, 0x11, 0x0b, 0x06, 0x00, 0xf0, 0x0c, 0x13, 0x0b, 0x02, 0x00, 0x30, 0x7b, 0x00,
+    0xd6, 0xff, 0xb3, 0x00, 0x03, 0x00, 0x04, 0x07, 0x0c, 0x08, 0x00, 0xf0, 0x04, 0x07, 0x06, 0x04,
+    0x00, 0x20, 0x0a, 0x0b, 0x06, 0x04, 0x00, 0x20, 0x46, 0x00, 0x39, 0x00, 0x9a, 0xff, 0x03, 0x00,
+    0x08, 0x0b, 0x08, 0x0a, 0x00, 0xf0, 0x0c, 0x0b, 0x04, 0x05, 0x00, 0x20, 0x08, 0x10, 0x04, 0x05,
+    0x00, 0x20, 0x52, 0x00, 0xcf, 0xff, 0x71, 0x00, 0x02, 0x00, 0x09, 0x01, 0x04, 0x09, 0x00, 0xf0,
+    0x0b, 0x01, 0x02, 0x09, 0x00, 0x20, 0x87, 0x00, 0x1d, 0x00, 0x6d, 0xfe, 0x02, 0x00, 0x0e, 0x00,
+    0x03, 0x16, 0x00, 0xf0, 0x0f, 0x00, 0x01, 0x16, 0x00, 0x30, 0xc4, 0xff, 0x1b, 0xff, 0xf6, 0xff,
+    0x02, 0x00, 0x07, 0x00, 0x03, 0x16, 0x00, 0xf0, 0x08, 0x00, 0x01, 0x16, 0x00, 0x30, 0xd6, 0xff,
+    0x5b, 0x00, 0xfd, 0xff, 0x03, 0x00, 0x04, 0x07, 0x12, 0x04, 0x00, 0xf0, 0x0d, 0x07, 0x09, 0x02,
+    0x00, 0x20, 0x04, 0x09, 0x09, 0x02, 0x00, 0x20, 0x8b, 0xff, 0x8b, 0xff, 0x06, 0x00, 0x02, 0x00,
+    0x0a, 0x02, 0x04, 0x0f, 0x00, 0xf0, 0x0a, 0x07, 0x04, 0x05, 0x00, 0x30, 0xed, 0xff, 0x3c, 0x00,
+    0xf0, 0xff, 0x02, 0x00, 0x0c, 0x01, 0x03, 0x0c, 0x00, 0xf0, 0x0c, 0x07, 0x03, 0x06, 0x00, 0x20,
+    0x26, 0x05, 0xf9, 0xff, 0x29, 0xff, 0x02, 0x00, 0x00, 0x00, 0x12, 0x0d, 0x00, 0xf0, 0x09, 0x00,
+    0x09, 0x0d, 0x00, 0x20, 0xbb, 0xff, 0x7e, 0xff, 0x29, 0x00, 0x02, 0x00, 0x10, 0x00, 0x03, 0x18,
+    0x00, 0xf0, 0x11, 0x00, 0x01, 0x18, 0x00, 0x30, 0xe2, 0xff, 0x76, 0xff, 0x01, 0x00, 0x02, 0x00,
+    0x05, 0x00, 0x03, 0x18, 0x00, 0xf0, 0x06, 0x00, 0x01, 0x18, 0x00, 0x30, 0x86, 0xff, 0x1d, 0xff,
+    0x22, 0x00, 0x02, 0x00, 0x0a, 0x0f, 0x05, 0x08, 0x00, 0xf0, 0x0a, 0x13, 0x05, 0x04, 0x00, 0x20,
+    0xd2, 0xff, 0xce, 0x00, 0xd7, 0xff, 0x02, 0x00, 0x02, 0x12, 0x12, 0x02, 0x00, 0xf0, 0x02, 0x13,
+    0x12, 0x01, 0x00, 0x20, 0x13, 0x00, 0x03, 0x00, 0x8d, 0x00, 0x02, 0x00, 0x02, 0x08, 0x14, 0x03,
+    0x00, 0xf0, 0x02, 0x09, 0x14, 0x01, 0x00, 0x30, 0x14, 0x00, 0xf5, 0xff, 0xed, 0xfe, 0x02, 0x00,
+    0x07, 0x06, 0x09, 0x06, 0x00, 0xf0, 0x07, 0x08, 0x09, 0x02, 0x00, 0x30, 0x18, 0x03, 0x12, 0x00,
+    0x2b, 0x01, 0x02, 0x00, 0x03, 0x02, 0x13, 0x0a, 0x00, 0xf0, 0x03, 0x07, 0x13, 0x05, 0x00, 0x20,
+    0x16, 0x00, 0xce, 0xff, 0x61, 0x00, 0x02, 0x00, 0x02, 0x07, 0x13, 0x03, 0x00, 0xf0, 0x02, 0x08,
+    0x13, 0x01, 0x00, 0x30, 0xe9, 0xfe, 0x91, 0xfa, 0x1c, 0x00, 0x02, 0x00, 0x0f, 0x06, 0x09, 0x04,
+    0x00, 0xf0, 0x0f, 0x08, 0x09, 0x02, 0x00, 0x20, 0x71, 0xff, 0x72, 0x00, 0xd1, 0xff, 0x02, 0x00,
+    0x02, 0x02, 0x12, 0x08, 0x00, 0xf0, 0x08, 0x02, 0x06, 0x08, 0x00, 0x30, 0x14, 0x00, 0xfd, 0xff,
+    0x2f, 0x00, 0x02, 0x00, 0x0a, 0x09, 0x0e, 0x04, 0x00, 0xf0, 0x0a, 0x09, 0x07, 0x04, 0x00, 0x20,
+    0x86, 0x01, 0xda, 0xff, 0xf3, 0x00, 0x02, 0x00, 0x04, 0x04, 0x06, 0x10, 0x00, 0xf0, 0x07, 0x04,
+    0x03, 0x10, 0x00, 0x20, 0xff, 0xfe, 0x76, 0x00, 0x09, 0x00, 0x02, 0x00, 0x0f, 0x08, 0x09, 0x10,
+    0x00, 0xf0, 0x12, 0x08, 0x03, 0x10, 0x00, 0x30, 0x47, 0xfd, 0x5a, 0xfe, 0xf0, 0xff, 0x02, 0x00,
+    0x00, 0x08, 0x09, 0x10, 0x00, 0xf0, 0x03, 0x08, 0x03, 0x10, 0x00, 0x30, 0x2b, 0x00, 0xf7, 0xff,
+    0x6b, 0x00, 0x02, 0x00, 0x12, 0x00, 0x06, 0x0e, 0x00, 0xf0, 0x14, 0x00, 0x02, 0x0e, 0x00, 0x30,
+    0x56, 0xff, 0x58, 0x00, 0xca, 0xff, 0x02, 0x00, 0x00, 0x00, 0x06, 0x0e, 0x00, 0xf0, 0x02, 0x00,
+    0x02, 0x0e, 0x00, 0x30, 0x08, 0x02, 0x1f, 0x00, 0xe0, 0xfd, 0x02, 0x00, 0x0f, 0x00, 0x06, 0x16,
+    0x00, 0xf0, 0x11, 0x00, 0x02, 0x16, 0x00, 0x30, 0x52, 0x01, 0xf1, 0xff, 0x84, 0xfe, 0x02, 0x00,
+    0x03, 0x00, 0x06, 0x16, 0x00, 0xf0, 0x05, 0x00, 0x02, 0x16, 0x00, 0x30, 0x5d, 0x01, 0x04, 0x00,
+    0x52, 0x00, 0x02, 0x00, 0x0c, 0x02, 0x0c, 0x14, 0x00, 0xf0, 0x10, 0x02, 0x04, 0x14, 0x00, 0x30,
+    0xe3, 0x00, 0xba, 0xff, 0x30, 0x00, 0x02, 0x00, 0x00, 0x02, 0x0c, 0x14, 0x00, 0xf0, 0x04, 0x02,
+    0x04, 0x14, 0x00, 0x30, 0x12, 0x00, 0xd3, 0xff, 0x47, 0x00, 0x02, 0x00, 0x0b, 0x06, 0x04, 0x09,
+    0x00, 0xf0, 0x0b, 0x06, 0x02, 0x09, 0x00, 0x20, 0x35, 0x00, 0xae, 0xff, 0x44, 0x00, 0x02, 0x00,
+    0x09, 0x00, 0x06, 0x10, 0x00, 0xf0, 0x0c, 0x00, 0x03, 0x10, 0x00, 0x20, 0xed, 0x00, 0x20, 0x00,
+    0x65, 0xff, 0x02, 0x00, 0x0c, 0x01, 0x03, 0x0c, 0x00, 0xf0, 0x0c, 0x07, 0x03, 0x06, 0x00, 0x20,
+    0xa3, 0xff, 0x81, 0xff, 0x05, 0x00, 0x03, 0x00, 0x03, 0x04, 0x12, 0x06, 0x00, 0xf0, 0x03, 0x04,
+    0x09, 0x03, 0x00, 0x20, 0x0c, 0x07, 0x09, 0x03, 0x00, 0x20, 0xc5, 0x00, 0x0b, 0x00, 0x7c, 0x00,
+    0x03, 0x00, 0x05, 0x05, 0x10, 0x08, 0x00, 0xf0, 0x0d, 0x05, 0x08, 0x04, 0x00, 0x20, 0x05, 0x09,
+    0x08, 0x04, 0x00, 0x20, 0x69, 0x00, 0xf6, 0xff, 0x12, 0xff, 0x02, 0x00, 0x00, 0x0d, 0x0a, 0x06,
+    0x00, 0xf0, 0x00, 0x0f, 0x0a, 0x02, 0x00, 0x30, 0x1c, 0x00, 0x00, 0x00, 0x57, 0x00, 0x02, 0x00,
+    0x08, 0x0e, 0x09, 0x06, 0x00, 0xf0, 0x08, 0x10, 0x09, 0x02, 0x00, 0x30, 0x73, 0xff, 0x79, 0xfe,
+    0xf1, 0xff, 0x02, 0x00, 0x06, 0x02, 0x09, 0x06, 0x00, 0xf0, 0x09, 0x02, 0x03, 0x06, 0x00, 0x30,
+    0x78, 0x00, 0x09, 0x00, 0xa4, 0x00, 0x03, 0x00, 0x0e, 0x01, 0x0a, 0x08, 0x00, 0xf0, 0x13, 0x01,
+    0x05, 0x04, 0x00, 0x20, 0x0e, 0x05, 0x05, 0x04, 0x00, 0x20, 0xf7, 0xff, 0x19, 0x00, 0x9b, 0xff,
+    0x02, 0x00, 0x09, 0x01, 0x03, 0x0c, 0x00, 0xf0, 0x09, 0x07, 0x03, 0x06, 0x00, 0x20, 0x02, 0xfd,
+    0xc8, 0x00, 0x78, 0xfe, 0x9f, 0x00, 0x8b, 0xff, 0x02, 0x00, 0x06, 0x04, 0x0c, 0x09, 0x00, 0xf0,
+    0x06, 0x07, 0x0c, 0x03, 0x00, 0x30, 0x44, 0x00, 0x12, 0xff, 0x37, 0x00, 0x02, 0x00, 0x06, 0x05,
+    0x0c, 0x06, 0x00, 0xf0, 0x0a, 0x05, 0x04, 0x06, 0x00, 0x30, 0x6a, 0x00, 0x99, 0xff, 0x6c, 0x00,
+    0x02, 0x00, 0x01, 0x01, 0x08, 0x05, 0x00, 0xf0, 0x05, 0x01, 0x04, 0x05, 0x00, 0x20, 0x01, 0x00,
+    0x18, 0x00, 0x5e, 0xff, 0x02, 0x00, 0x0c, 0x0c, 0x06, 0x08, 0x00, 0xf0, 0x0c, 0x10, 0x06, 0x04,
+    0x00, 0x20, 0xe5, 0xff, 0x5f, 0x00, 0xb3, 0xff, 0x02, 0x00, 0x03, 0x0c, 0x0c, 0x06, 0x00, 0xf0,
+    0x03, 0x0e, 0x0c, 0x02, 0x00, 0x30, 0x4d, 0x00, 0xc5, 0xff, 0x67, 0x00, 0x03, 0x00, 0x09, 0x12,
+    0x0c, 0x06, 0x00, 0xf0, 0x0f, 0x12, 0x06, 0x03, 0x00, 0x20, 0x09, 0x15, 0x06, 0x03, 0x00, 0x20,
+    0x00, 0x00, 0x0a, 0x00, 0x39, 0xff, 0x02, 0x00, 0x04, 0x0d, 0x06, 0x06, 0x00, 0xf0, 0x04, 0x10,
+    0x06, 0x03, 0x00, 0x20, 0xc8, 0xfe, 0x81, 0xff, 0x29, 0x00, 0x02, 0x00, 0x0b, 0x03, 0x07, 0x12,
+    0x00, 0xf0, 0x0b, 0x0c, 0x07, 0x09, 0x00, 0x20, 0xcd, 0x00, 0x08, 0x00, 0x34, 0xff, 0x02, 0x00,
+    0x03, 0x09, 0x12, 0x03, 0x00, 0xf0, 0x09, 0x09, 0x06, 0x03, 0x00, 0x30, 0xf5, 0xff, 0x80, 0xff,
+    0x41, 0x00, 0x02, 0x00, 0x05, 0x03, 0x13, 0x02, 0x00, 0xf0, 0x05, 0x04, 0x13, 0x01, 0x00, 0x20,
+    0x42, 0x00, 0x09, 0x00, 0x4b, 0xff, 0x03, 0x00, 0x04, 0x02, 0x0c, 0x06, 0x00, 0xf0, 0x04, 0x02,
+    0x06, 0x03, 0x00, 0x20, 0x0a, 0x05, 0x06, 0x03, 0x00, 0x20, 0x9a, 0x00, 0xf0, 0xff, 0xbd, 0x00,
+    0x02, 0x00, 0x09, 0x06, 0x06, 0x09, 0x00, 0xf0, 0x0b, 0x06, 0x02, 0x09, 0x00, 0x30, 0xce, 0xff,
+    0x7c, 0x00, 0xc2, 0xff, 0x02, 0x00, 0x08, 0x06, 0x06, 0x09, 0x00, 0xf0, 0x0a, 0x06, 0x02, 0x09,
+    0x00, 0x30, 0xed, 0x00, 0x22, 0x00, 0xdf, 0xff, 0x02, 0x00, 0x10, 0x09, 0x05, 0x0f, 0x00, 0xf0,
+    0x10, 0x0e, 0x05, 0x05, 0x00, 0x30, 0x13, 0x00, 0x8f, 0xff, 0x23, 0x00, 0x02, 0x00, 0x03, 0x09,
+    0x05, 0x0f, 0x00, 0xf0, 0x03, 0x0e, 0x05, 0x05, 0x00, 0x30, 0xbb, 0x00, 0x07, 0x00, 0xe5, 0x00,
+    0x03, 0x00, 0x06, 0x06, 0x0e, 0x06, 0x00, 0xf0, 0x0d, 0x06, 0x07, 0x03, 0x00, 0x20, 0x06, 0x09,
+    0x07, 0x03, 0x00, 0x20, 0x57, 0x00, 0x03, 0x00, 0x24, 0xff, 0x02, 0x00, 0x08, 0x06, 0x03, 0x0e,
+    0x00, 0xf0, 0x08, 0x0d, 0x03, 0x07, 0x00, 0x20, 0x82, 0x02, 0x03, 0x00, 0xda, 0x00, 0x02, 0x00,
+    0x00, 0x10, 0x18, 0x05, 0x00, 0xf0, 0x08, 0x10, 0x08, 0x05, 0x00, 0x30, 0xd6, 0xff, 0x4a, 0x00,
+    0xb5, 0xff, 0x02, 0x00, 0x00, 0x14, 0x14, 0x03, 0x00, 0xf0, 0x0a, 0x14, 0x0a, 0x03, 0x00, 0x20,
+    0x09, 0x00, 0x99, 0xff, 0x31, 0x00, 0x02, 0x00, 0x05, 0x0a, 0x12, 0x02, 0x00, 0xf0, 0x05, 0x0b,
+    0x12, 0x01, 0x00, 0x20, 0xa1, 0xff, 0x54, 0x00, 0xbf, 0xff, 0x02, 0x00, 0x00, 0x06, 0x06, 0x0a,
+    0x00, 0xf0, 0x02, 0x06, 0x02, 0x0a, 0x00, 0x30, 0xe4, 0xff, 0x78, 0xff, 0x37, 0x00, 0x02, 0x00,
+    0x02, 0x01, 0x14, 0x03, 0x00, 0xf0, 0x02, 0x02, 0x14, 0x01, 0x00, 0x30, 0x74, 0xff, 0x8f, 0xfe,
+    0xf5, 0xff, 0x02, 0x00, 0x09, 0x0d, 0x06, 0x0b, 0x00, 0xf0, 0x0b, 0x0d, 0x02, 0x0b, 0x00, 0x30,
+    0xaa, 0xff, 0x36, 0xff, 0x30, 0x00, 0x02, 0x00, 0x09, 0x0f, 0x06, 0x08, 0x00, 0xf0, 0x09, 0x13,
+    0x06, 0x04, 0x00, 0x20, 0x08, 0x00, 0xbc, 0xff, 0x50, 0x00, 0x02, 0x00, 0x09, 0x0c, 0x06, 0x09,
+    0x00, 0xf0, 0x09, 0x0f, 0x06, 0x03, 0x00, 0x30, 0xef, 0xff, 0x75, 0xff, 0x2a, 0x00, 0x02, 0x00,
+    0x05, 0x0b, 0x12, 0x02, 0x00, 0xf0, 0x05, 0x0c, 0x12, 0x01, 0x00, 0x20, 0xc6, 0xff, 0x05, 0x00,
+    0x61, 0xff, 0x02, 0x00, 0x02, 0x06, 0x0f, 0x06, 0x00, 0xf0, 0x02, 0x08, 0x0f, 0x02, 0x00, 0x30,
+    0xdf, 0xff, 0x81, 0xff, 0x31, 0x00, 0x02, 0x00, 0x06, 0x00, 0x12, 0x03, 0x00, 0xf0, 0x06, 0x01,
+    0x12, 0x01, 0x00, 0x30, 0xda, 0xff, 0x36, 0xff, 0xfd, 0xff, 0x02, 0x00, 0x05, 0x00, 0x03, 0x12,
+    0x00, 0xf0, 0x06, 0x00, 0x01, 0x12, 0x00, 0x30, 0x65, 0xff, 0xcc, 0x00, 0xf8, 0xff, 0x02, 0x00,
+    0x12, 0x03, 0x06, 0x0a, 0x00, 0xf0, 0x14, 0x03, 0x02, 0x0a, 0x00, 0x30, 0x13, 0x00, 0xac, 0xff,
+    0x35, 0x00, 0x02, 0x00, 0x00, 0x03, 0x06, 0x0a, 0x00, 0xf0, 0x02, 0x03, 0x02, 0x0a, 0x00, 0x30,
+    0xee, 0xff, 0xbb, 0xff, 0x2f, 0x00, 0x02, 0x00, 0x0a, 0x05, 0x08, 0x09, 0x00, 0xf0, 0x0a, 0x05,
+    0x04, 0x09, 0x00, 0x20, 0x15, 0x00, 0x79, 0xff, 0x0d, 0x00, 0x02, 0x00, 0x06, 0x05, 0x08, 0x09,
+    0x00, 0xf0, 0x0a, 0x05, 0x04, 0x09, 0x00, 0x20, 0xd9, 0xff, 0x70, 0xff, 0x31, 0x00, 0x02, 0x00,
+    0x03, 0x02, 0x14, 0x03, 0x00, 0xf0, 0x03, 0x03, 0x14, 0x01, 0x00, 0x30, 0xb8, 0x00, 0xd4, 0xff,
+    0xf4, 0x00, 0x02, 0x00, 0x05, 0x02, 0x0d, 0x04, 0x00, 0xf0, 0x05, 0x04, 0x0d, 0x02, 0x00, 0x20,
+    0x3a, 0x00, 0xe9, 0xff, 0x3f, 0x00, 0x02, 0x00, 0x11, 0x00, 0x07, 0x0e, 0x00, 0xf0, 0x11, 0x07,
+    0x07, 0x07, 0x00, 0x20, 0x9e, 0x02, 0xf2, 0xff, 0x5d, 0xfe, 0x02, 0x00, 0x00, 0x00, 0x07, 0x0e,
+    0x00, 0xf0, 0x00, 0x07, 0x07, 0x07, 0x00, 0x20, 0x0a, 0x00, 0x3c, 0x00, 0xe9, 0xff, 0x02, 0x00,
+    0x09, 0x0b, 0x0a, 0x06, 0x00, 0xf0, 0x09, 0x0b, 0x05, 0x06, 0x00, 0x20, 0xf1, 0xff, 0x2d, 0x00,
+    0xa5, 0xff, 0x02, 0x00, 0x05, 0x0b, 0x0a, 0x06, 0x00, 0xf0, 0x0a, 0x0b, 0x05, 0x06, 0x00, 0x20,
+    0x99, 0xff, 0x93, 0xff, 0x33, 0x00, 0x02, 0x00, 0x0b, 0x06, 0x03, 0x12, 0x00, 0xf0, 0x0b, 0x0c,
+    0x03, 0x06, 0x00, 0x30, 0xb1, 0xff, 0x94, 0x00, 0xd0, 0xff, 0x02, 0x00, 0x00, 0x10, 0x12, 0x03,
+    0x00, 0xf0, 0x00, 0x11, 0x12, 0x01, 0x00, 0x30, 0x3b, 0x00, 0x08, 0x00, 0xd1, 0x00, 0x02, 0x00,
+    0x06, 0x10, 0x12, 0x03, 0x00, 0xf0, 0x06, 0x11, 0x12, 0x01, 0x00, 0x30, 0xd3, 0x00, 0x11, 0x00,
+    0x8b, 0xff, 0x02, 0x00, 0x04, 0x06, 0x09, 0x0a, 0x00, 0xf0, 0x04, 0x0b, 0x09, 0x05, 0x00, 0x20,
+    0x65, 0xff, 0xbf, 0xfe, 0x24, 0x00, 0x02, 0x00, 0x09, 0x07, 0x0f, 0x04, 0x00, 0xf0, 0x09, 0x09,
+    0x0f, 0x02, 0x00, 0x20, 0x87, 0xff, 0x88, 0x00, 0xcc, 0xff, 0x03, 0x00, 0x05, 0x06, 0x0c, 0x06,
+    0x00, 0xf0, 0x05, 0x06, 0x06, 0x03, 0x00, 0x20, 0x0b, 0x09, 0x06, 0x03, 0x00, 0x20, 0x60, 0xff,
+    0x2a, 0x01, 0x0d, 0x00, 0x02, 0x00, 0x06, 0x01, 0x0c, 0x09, 0x00, 0xf0, 0x06, 0x04, 0x0c, 0x03,
+    0x00, 0x30, 0x89, 0xff, 0x64, 0x00, 0xc8, 0xff, 0x03, 0x00, 0x07, 0x09, 0x06, 0x0c, 0x00, 0xf0,
+    0x07, 0x09, 0x03, 0x06, 0x00, 0x20, 0x0a, 0x0f, 0x03, 0x06, 0x00, 0x20, 0xaa, 0xfe, 0x44, 0xff,
+    0x24, 0x00, 0x02, 0x00, 0x0b, 0x05, 0x0d, 0x06, 0x00, 0xf0, 0x0b, 0x07, 0x0d, 0x02, 0x00, 0x30,
+    0xb8, 0x06, 0xdc, 0xff, 0xca, 0x01, 0x02, 0x00, 0x01, 0x0b, 0x16, 0x0d, 0x00, 0xf0, 0x0c, 0x0b,
+    0x0b, 0x0d, 0x00, 0x20, 0xf5, 0x00, 0x1e, 0x00, 0x1d, 0xfe, 0x02, 0x00, 0x12, 0x08, 0x06, 0x06,
+    0x00, 0xf0, 0x12, 0x0b, 0x06, 0x03, 0x00, 0x20, 0xb3, 0xff, 0x96, 0xfe, 0xf2, 0xff, 0x02, 0x00,
+    0x00, 0x08, 0x06, 0x06, 0x00, 0xf0, 0x00, 0x0b, 0x06, 0x03, 0x00, 0x20, 0xe8, 0xff, 0x71, 0x00,
+    0xe6, 0xff, 0x02, 0x00, 0x00, 0x06, 0x18, 0x03, 0x00, 0xf0, 0x00, 0x07, 0x18, 0x01, 0x00, 0x30,
+    0x12, 0xff, 0x9c, 0xfe, 0xf4, 0xff, 0x02, 0x00, 0x00, 0x05, 0x0a, 0x06, 0x00, 0xf0, 0x00, 0x07,
+    0x0a, 0x02, 0x00, 0x30, 0xce, 0xff, 0x83, 0x00, 0xe9, 0xff, 0x02, 0x00, 0x06, 0x07, 0x12, 0x03,
+    0x00, 0xf0, 0x06, 0x08, 0x12, 0x01, 0x00, 0x30, 0xbe, 0x00, 0xf2, 0xff, 0x93, 0xfe, 0x02, 0x00,
+    0x00, 0x00, 0x0a, 0x06, 0x00, 0xf0, 0x00, 0x02, 0x0a, 0x02, 0x00, 0x30, 0x04, 0x00, 0xec, 0xff,
+    0x52, 0x00, 0x02, 0x00, 0x13, 0x00, 0x03, 0x13, 0x00, 0xf0, 0x14, 0x00, 0x01, 0x13, 0x00, 0x30,
+    0x95, 0xfe, 0x23, 0xff, 0xf8, 0xff, 0x03, 0x00, 0x04, 0x06, 0x0c, 0x10, 0x00, 0xf0, 0x04, 0x06,
+    0x06, 0x08, 0x00, 0x20, 0x0a, 0x0e, 0x06, 0x08, 0x00, 0x20, 0xa2, 0xff, 0x85, 0x00, 0xfc, 0xff,
+    0x03, 0x00, 0x13, 0x06, 0x04, 0x12, 0x00, 0xf0, 0x15, 0x06, 0x02, 0x09, 0x00, 0x20, 0x13, 0x0f,
+    0x02, 0x09, 0x00, 0x20, 0xb0, 0x00, 0xd7, 0xff, 0x17, 0x01, 0x03, 0x00, 0x01, 0x06, 0x04, 0x12,
+    0x00, 0xf0, 0x01, 0x06, 0x02, 0x09, 0x00, 0x20, 0x03, 0x0f, 0x02, 0x09, 0x00, 0x20, 0x00, 0x00,
+    0xd5, 0xff, 0x4f, 0x00, 0x02, 0x00, 0x03, 0x15, 0x12, 0x03, 0x00, 0xf0, 0x03, 0x16, 0x12, 0x01,
+    0x00, 0x30, 0x24, 0x00, 0xff, 0xff, 0x50, 0xff, 0x02, 0x00, 0x00, 0x13, 0x09, 0x04, 0x00, 0xf0,
+    0x00, 0x15, 0x09, 0x02, 0x00, 0x20, 0xb8, 0xff, 0xa2, 0x00, 0xff, 0xff, 0x03, 0x00, 0x0c, 0x12,
+    0x0c, 0x06, 0x00, 0xf0, 0x12, 0x12, 0x06, 0x03, 0x00, 0x20, 0x0c, 0x15, 0x06, 0x03, 0x00, 0x20,
+    0x19, 0x00, 0xaa, 0xff, 0x20, 0x00, 0x02, 0x00, 0x07, 0x12, 0x09, 0x04, 0x00, 0xf0, 0x07, 0x14,
+    0x09, 0x02, 0x00, 0x20, 0x5d, 0x00, 0xf8, 0xff, 0x64, 0x00, 0x03, 0x00, 0x0c, 0x10, 0x0a, 0x08,
+    0x00, 0xf0, 0x11, 0x10, 0x05, 0x04, 0x00, 0x20, 0x0c, 0x14, 0x05, 0x04, 0x00, 0x20, 0xa8, 0xff,
+    0xa5, 0x00, 0xcd, 0xff, 0x03, 0x00, 0x02, 0x10, 0x0a, 0x08, 0x00, 0xf0, 0x02, 0x10, 0x05, 0x04,
+    0x00, 0x20, 0x07, 0x14, 0x05, 0x04, 0x00, 0x20, 0xfc, 0x00, 0x0d, 0x00, 0xe8, 0x00, 0x03, 0x00,
+    0x0e, 0x00, 0x0a, 0x0c, 0x00, 0xf0, 0x13, 0x00, 0x05, 0x06, 0x00, 0x20, 0x0e, 0x06, 0x05, 0x06,
+    0x00, 0x20, 0xc1, 0xfe, 0xa7, 0x00, 0xce, 0xff, 0x03, 0x00, 0x00, 0x00, 0x0a, 0x0c, 0x00, 0xf0,
+    0x00, 0x00, 0x05, 0x06, 0x00, 0x20, 0x05, 0x06, 0x05, 0x06, 0x00, 0x20, 0x2e, 0x00, 0x31, 0x00,
+    0x7c, 0xff, 0x02, 0x00, 0x0f, 0x0e, 0x09, 0x06, 0x00, 0xf0, 0x0f, 0x10, 0x09, 0x02, 0x00, 0x30,
+    0x98, 0xff, 0x12, 0xff, 0xf8, 0xff, 0x02, 0x00, 0x00, 0x0e, 0x09, 0x06, 0x00, 0xf0, 0x00, 0x10,
+    0x09, 0x02, 0x00, 0x30, 0x65, 0xff, 0x52, 0xff, 0x20, 0x00, 0x02, 0x00, 0x0e, 0x0e, 0x0a, 0x06,
+    0x00, 0xf0, 0x0e, 0x10, 0x0a, 0x02, 0x00, 0x30, 0x28, 0x00, 0x03, 0x00, 0x5e, 0xff, 0x02, 0x00,
+    0x00, 0x0e, 0x0a, 0x06, 0x00, 0xf0, 0x00, 0x10, 0x0a, 0x02, 0x00, 0x30, 0xc8, 0xff, 0x01, 0x01,
+    0x10, 0x00, 0x02, 0x00, 0x05, 0x12, 0x12, 0x02, 0x00, 0xf0, 0x05, 0x13, 0x12, 0x01, 0x00, 0x20,
+    0x22, 0x00, 0xc5, 0xff, 0x4f, 0x00, 0x02, 0x00, 0x00, 0x12, 0x12, 0x03, 0x00, 0xf0, 0x00, 0x13,
+    0x12, 0x01, 0x00, 0x30, 0xdc, 0xfe, 0x47, 0xff, 0x2b, 0x00, 0x03, 0x00, 0x03, 0x05, 0x12, 0x0c,
+    0x00, 0xf0, 0x0c, 0x05, 0x09, 0x06, 0x00, 0x20, 0x03, 0x0b, 0x09, 0x06, 0x00, 0x20, 0x28, 0x00,
+    0xc8, 0xff, 0x5a, 0x00, 0x02, 0x00, 0x05, 0x03, 0x07, 0x09, 0x00, 0xf0, 0x05, 0x06, 0x07, 0x03,
+    0x00, 0x30, 0xc2, 0x01, 0x2a, 0x00, 0x42, 0xff, 0x02, 0x00, 0x04, 0x00, 0x13, 0x0f, 0x00, 0xf0,
+    0x04, 0x05, 0x13, 0x05, 0x00, 0x30, 0x90, 0x00, 0xc3, 0xff, 0x6a, 0x00, 0x02, 0x00, 0x03, 0x00,
+    0x10, 0x04, 0x00, 0xf0, 0x03, 0x02, 0x10, 0x02, 0x00, 0x20, 0x37, 0xfe, 0x82, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x04, 0x0c, 0x10, 0x0c, 0x00, 0xf0, 0x04, 0x0c, 0x08, 0x0c, 0x00, 0x20, 0x2f, 0xfe,
+    0xe7, 0x00, 0xd6, 0xff, 0x02, 0x00, 0x04, 0x03, 0x0c, 0x0f, 0x00, 0xf0, 0x0a, 0x03, 0x06, 0x0f,
+    0x00, 0x20, 0x44, 0x00, 0x23, 0x00, 0x7b, 0xff, 0x02, 0x00, 0x10, 0x04, 0x02, 0x13, 0x00, 0xf0,
+    0x10, 0x04, 0x01, 0x13, 0x00, 0x20, 0xe0, 0xff, 0x57, 0xff, 0x00, 0x00, 0x02, 0x00, 0x06, 0x04,
+    0x02, 0x13, 0x00, 0xf0, 0x07, 0x04, 0x01, 0x13, 0x00, 0x20, 0x79, 0xff, 0xcd, 0x00, 0x0f, 0x00,
+    0x03, 0x00, 0x0d, 0x0e, 0x08, 0x0a, 0x00, 0xf0, 0x11, 0x0e, 0x04, 0x05, 0x00, 0x20, 0x0d, 0x13,
+    0x04, 0x05, 0x00, 0x20, 0x33, 0x00, 0xab, 0xff, 0x25, 0x00, 0x03, 0x00, 0x03, 0x0e, 0x08, 0x0a,
+    0x00, 0xf0, 0x03, 0x0e, 0x04, 0x05, 0x00, 0x20, 0x07, 0x13, 0x04, 0x05, 0x00, 0x20, 0x54, 0xff,
+    0x72, 0xff, 0x21, 0x00, 0x02, 0x00, 0x0c, 0x06, 0x03, 0x12, 0x00, 0xf0, 0x0c, 0x0c, 0x03, 0x06,
+    0x00, 0x30, 0x67, 0x00, 0xf1, 0xff, 0xa2, 0xfe, 0x03, 0x00, 0x05, 0x0b, 0x0c, 0x06, 0x00, 0xf0,
+    0x05, 0x0b, 0x06, 0x03, 0x00, 0x20, 0x0b, 0x0e, 0x06, 0x03, 0x00, 0x20, 0x9d, 0xff, 0x57, 0x00,
+    0xff, 0xff, 0x03, 0x00, 0x0a, 0x05, 0x08, 0x0a, 0x00, 0xf0, 0x0e, 0x05, 0x04, 0x05, 0x00, 0x20,
+    0x0a, 0x0a, 0x04, 0x05, 0x00, 0x20, 0xce, 0xff, 0x47, 0x00, 0xb1, 0xff, 0x03, 0x00, 0x06, 0x04,
+    0x0c, 0x0a, 0x00, 0xf0, 0x06, 0x04, 0x06, 0x05, 0x00, 0x20, 0x0c, 0x09, 0x06, 0x05, 0x00, 0x20,
+    0x2e, 0xfe, 0x2c, 0x01, 0x15, 0x00, 0x03, 0x00, 0x06, 0x08, 0x12, 0x0a, 0x00, 0xf0, 0x0f, 0x08,
+    0x09, 0x05, 0x00, 0x20, 0x06, 0x0d, 0x09, 0x05, 0x00, 0x20, 0xa5, 0xfe, 0xd1, 0x00, 0xd3, 0xff,
+    0x03, 0x00, 0x00, 0x08, 0x12, 0x0a, 0x00, 0xf0, 0x00, 0x08, 0x09, 0x05, 0x00, 0x20, 0x09, 0x0d,
+    0x09, 0x05, 0x00, 0x20, 0x9c, 0xff, 0xd1, 0xff, 0x24, 0x00, 0x02, 0x00, 0x0c, 0x06, 0x03, 0x12,
+    0x00, 0xf0, 0x0c, 0x0c, 0x03, 0x06, 0x00, 0x30, 0xdc, 0xff, 0x53, 0x00, 0xc4, 0xff, 0x02, 0x00,
+    0x00, 0x0e, 0x12, 0x03, 0x00, 0xf0, 0x00, 0x0f, 0x12, 0x01, 0x00, 0x30, 0x2d, 0x00, 0x32, 0x00,
+    0xfb, 0xff, 0x02, 0x00, 0x0c, 0x06, 0x03, 0x12, 0x00, 0xf0, 0x0c, 0x0c, 0x03, 0x06, 0x00, 0x30,
+    0x88, 0xff, 0x11, 0xff, 0xfb, 0xff, 0x02, 0x00, 0x09, 0x06, 0x03, 0x12, 0x00, 0xf0, 0x09, 0x0c,
+    0x03, 0x06, 0x00, 0x30, 0x1a, 0x00, 0x06, 0x00, 0x76, 0x00, 0x02, 0x00, 0x06, 0x0e, 0x12, 0x03,
+    0x00, 0xf0, 0x06, 0x0f, 0x12, 0x01, 0x00, 0x30, 0x39, 0x00, 0xca, 0xff, 0x66, 0x00, 0x02, 0x00,
+    0x00, 0x05, 0x12, 0x03, 0x00, 0xf0, 0x00, 0x06, 0x12, 0x01, 0x00, 0x30, 0xca, 0xff, 0xbd, 0x00,
+    0x07, 0x00, 0x02, 0x00, 0x02, 0x05, 0x16, 0x03, 0x00, 0xf0, 0x02, 0x06, 0x16, 0x01, 0x00, 0x30,
+    0x8c, 0x04, 0xcf, 0xff, 0x6f, 0x00, 0x02, 0x00, 0x00, 0x00, 0x15, 0x0a, 0x00, 0xf0, 0x07, 0x00,
+    0x07, 0x0a, 0x00, 0x30, 0x35, 0xfc, 0xb2, 0x00, 0x11, 0x00, 0x02, 0x00, 0x06, 0x03, 0x12, 0x11,
+    0x00, 0xf0, 0x0c, 0x03, 0x06, 0x11, 0x00, 0x30, 0x37, 0xfe, 0x64, 0x00, 0xcb, 0xff, 0x02, 0x00,
+    0x00, 0x03, 0x12, 0x11, 0x00, 0xf0, 0x06, 0x03, 0x06, 0x11, 0x00, 0x30, 0x0b, 0x02, 0xee, 0xff,
+    0x5c, 0x00, 0x02, 0x00, 0x00, 0x0c, 0x18, 0x0b, 0x00, 0xf0, 0x08, 0x0c, 0x08, 0x0b, 0x00, 0x30,
+    0xff, 0xfe, 0xf4, 0x00, 0xd9, 0xff, 0x02, 0x00, 0x04, 0x0a, 0x10, 0x06, 0x00, 0xf0, 0x04, 0x0d,
+    0x10, 0x03, 0x00, 0x20, 0x47, 0x00, 0xf3, 0xff, 0x47, 0x00, 0x02, 0x00, 0x0c, 0x08, 0x06, 0x08,
+    0x00, 0xf0, 0x0c, 0x0c, 0x06, 0x04, 0x00, 0x20, 0x05, 0x00, 0x13, 0x00, 0xa3, 0xff, 0x02, 0x00,
+    0x06, 0x0e, 0x08, 0x07, 0x00, 0xf0, 0x0a, 0x0e, 0x04, 0x07, 0x00, 0x20, 0x70, 0x00, 0x0d, 0x00,
+    0x6a, 0x00, 0x03, 0x00, 0x0f, 0x0a, 0x06, 0x0e, 0x00, 0xf0, 0x12, 0x0a, 0x03, 0x07, 0x00, 0x20,
+    0x0f, 0x11, 0x03, 0x07, 0x00, 0x20, 0x4e, 0xff, 0xb8, 0x00, 0xd5, 0xff, 0x03, 0x00, 0x03, 0x0a,
+    0x06, 0x0e, 0x00, 0xf0, 0x03, 0x0a, 0x03, 0x07, 0x00, 0x20, 0x06, 0x11, 0x03, 0x07, 0x00, 0x20,
+    0x2d, 0x00, 0x24, 0x00, 0x59, 0xff, 0x02, 0x00, 0x06, 0x0c, 0x12, 0x02, 0x00, 0xf0, 0x06, 0x0d,
+    0x12, 0x01, 0x00, 0x20, 0x55, 0x00, 0x0a, 0x00, 0x8b, 0xff, 0x02, 0x00, 0x05, 0x08, 0x0a, 0x06,
+    0x00, 0xf0, 0x05, 0x0a, 0x0a, 0x02, 0x00, 0x30, 0xa5, 0xff, 0x89, 0x00, 0x12, 0x00, 0x02, 0x00,
+    0x0c, 0x0b, 0x09, 0x04, 0x00, 0xf0, 0x0c, 0x0d, 0x09, 0x02, 0x00, 0x20, 0x85, 0x00, 0xf5, 0xff,
+    0xff, 0xfe, 0x02, 0x00, 0x00, 0x0b, 0x09, 0x06, 0x00, 0xf0, 0x00, 0x0d, 0x09, 0x02, 0x00, 0x30,
+    0x32, 0x00, 0x08, 0x00, 0x6c, 0x00, 0x02, 0x00, 0x0b, 0x02, 0x03, 0x12, 0x00, 0xf0, 0x0c, 0x02,
+    0x01, 0x12, 0x00, 0x30, 0x22, 0x00, 0xbe, 0xff, 0x43, 0x00, 0x02, 0x00, 0x0a, 0x02, 0x03, 0x12,
+    0x00, 0xf0, 0x0b, 0x02, 0x01, 0x12, 0x00, 0x30, 0x99, 0x00, 0x28, 0x00, 0xf6, 0xfe, 0x02, 0x00,
+    0x09, 0x0c, 0x06, 0x0a, 0x00, 0xf0, 0x0b, 0x0c, 0x02, 0x0a, 0x00, 0x30, 0xc7, 0xff, 0x45, 0xff,
+    0xfb, 0xff, 0x02, 0x00, 0x01, 0x0a, 0x06, 0x09, 0x00, 0xf0, 0x01, 0x0d, 0x06, 0x03, 0x00, 0x30,
+    0xe9, 0x00, 0x15, 0x00, 0x90, 0x01, 0x03, 0x00, 0x06, 0x09, 0x10, 0x06, 0x00, 0xf0, 0x0e, 0x09,
+    0x08, 0x03, 0x00, 0x20, 0x06, 0x0c, 0x08, 0x03, 0x00, 0x20, 0x14, 0x00, 0xa6, 0xff, 0x25, 0x00,
+    0x02, 0x00, 0x01, 0x08, 0x09, 0x06, 0x00, 0xf0, 0x01, 0x0a, 0x09, 0x02, 0x00, 0x30, 0x9c, 0xff,
+    0x48, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0x07, 0x10, 0x06, 0x00, 0xf0, 0x07, 0x09, 0x10, 0x02,
+    0x00, 0x30, 0xd2, 0xff, 0x29, 0xff, 0xf7, 0xff, 0x02, 0x00, 0x00, 0x00, 0x12, 0x03, 0x00, 0xf0,
+    0x00, 0x01, 0x12, 0x01, 0x00, 0x30, 0x8d, 0x00, 0x26, 0x00, 0x21, 0xff, 0x02, 0x00, 0x0a, 0x00,
+    0x06, 0x09, 0x00, 0xf0, 0x0c, 0x00, 0x02, 0x09, 0x00, 0x30, 0x63, 0x00, 0xd0, 0xff, 0x98, 0x00,
+    0x02, 0x00, 0x09, 0x05, 0x06, 0x06, 0x00, 0xf0, 0x0c, 0x05, 0x03, 0x06, 0x00, 0x20, 0xe0, 0xff,
+    0x71, 0x00, 0xf2, 0xff, 0x03, 0x00, 0x0a, 0x06, 0x04, 0x12, 0x00, 0xf0, 0x0c, 0x06, 0x02, 0x09,
+    0x00, 0x20, 0x0a, 0x0f, 0x02, 0x09, 0x00, 0x20, 0x8f, 0x00, 0xf2, 0xff, 0xa4, 0xfe, 0x02, 0x00,
+    0x08, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x0a, 0x00, 0x02, 0x09, 0x00, 0x30, 0x12, 0x00, 0xb1, 0xff,
+    0x41, 0x00, 0x02, 0x00, 0x09, 0x01, 0x06, 0x09, 0x00, 0xf0, 0x09, 0x04, 0x06, 0x03, 0x00, 0x30,
+    0xac, 0xfe, 0xa4, 0x01, 0xdc, 0xff, 0x02, 0x00, 0x01, 0x00, 0x12, 0x09, 0x00, 0xf0, 0x01, 0x03,
+    0x12, 0x03, 0x00, 0x30, 0xc7, 0xff, 0x39, 0xff, 0x2b, 0x00, 0x02, 0x00, 0x00, 0x03, 0x18, 0x03,
+    0x00, 0xf0, 0x00, 0x04, 0x18, 0x01, 0x00, 0x30, 0x05, 0x00, 0xc5, 0xff, 0x49, 0x00, 0x02, 0x00,
+    0x06, 0x0e, 0x09, 0x04, 0x00, 0xf0, 0x06, 0x10, 0x09, 0x02, 0x00, 0x20, 0xbc, 0xff, 0xa4, 0xff,
+    0x34, 0x00, 0x03, 0x00, 0x08, 0x09, 0x08, 0x0a, 0x00, 0xf0, 0x0c, 0x09, 0x04, 0x05, 0x00, 0x20,
+    0x08, 0x0e, 0x04, 0x05, 0x00, 0x20, 0xc6, 0xfe, 0xc7, 0x00, 0xd9, 0xff, 0x02, 0x00, 0x05, 0x02,
+    0x0d, 0x09, 0x00, 0xf0, 0x05, 0x05, 0x0d, 0x03, 0x00, 0x30, 0x37, 0xfc, 0x2e, 0x01, 0x13, 0x00,
+    0x02, 0x00, 0x04, 0x04, 0x10, 0x09, 0x00, 0xf0, 0x04, 0x07, 0x10, 0x03, 0x00, 0x30, 0x65, 0xfe,
+    0x88, 0xff, 0x14, 0x00, 0x02, 0x00, 0x04, 0x04, 0x0e, 0x09, 0x00, 0xf0, 0x04, 0x07, 0x0e, 0x03,
+    0x00, 0x30, 0x05, 0x00, 0x38, 0x00, 0xa2, 0xff, 0x02, 0x00, 0x08, 0x05, 0x09, 0x06, 0x00, 0xf0,
+    0x08, 0x07, 0x09, 0x02, 0x00, 0x30, 0x5a, 0x00, 0xf7, 0xff, 0x14, 0xff, 0x02, 0x00, 0x01, 0x07,
+    0x10, 0x06, 0x00, 0xf0, 0x01, 0x09, 0x10, 0x02, 0x00, 0x30, 0x34, 0xfe, 0x6b, 0x00, 0x14, 0x00,
+    0x02, 0x00, 0x0a, 0x05, 0x0d, 0x09, 0x00, 0xf0, 0x0a, 0x08, 0x0d, 0x03, 0x00, 0x30, 0x43, 0x00,
+    0xd6, 0xff, 0xb7, 0x00, 0x02, 0x00, 0x01, 0x05, 0x0d, 0x09, 0x00, 0xf0, 0x01, 0x08, 0x0d, 0x03,
+    0x00, 0x30, 0x16, 0x01, 0x28, 0x00, 0x20, 0xff, 0x03, 0x00, 0x00, 0x04, 0x18, 0x06, 0x00, 0xf0,
+    0x0c, 0x04, 0x0c, 0x03, 0x00, 0x20, 0x00, 0x07, 0x0c, 0x03, 0x00, 0x20, 0x41, 0x00, 0xff, 0xff,
+    0x69, 0xff, 0x02, 0x00, 0x01, 0x0e, 0x0a, 0x09, 0x00, 0xf0, 0x01, 0x11, 0x0a, 0x03, 0x00, 0x30,
+    0x13, 0x00, 0xf9, 0xff, 0x7b, 0x00, 0x02, 0x00, 0x05, 0x11, 0x12, 0x03, 0x00, 0xf0, 0x05, 0x12,
+    0x12, 0x01, 0x00, 0x30, 0x1b, 0x00, 0xc6, 0xff, 0x56, 0x00, 0x02, 0x00, 0x00, 0x10, 0x12, 0x03,
+    0x00, 0xf0, 0x00, 0x11, 0x12, 0x01, 0x00, 0x30, 0x13, 0x00, 0xf1, 0xff, 0x50, 0x00, 0x02, 0x00,
+    0x09, 0x11, 0x09, 0x06, 0x00, 0xf0, 0x09, 0x13, 0x09, 0x02, 0x00, 0x30, 0x0a, 0x00, 0xb4, 0xff,
+    0x2d, 0x00, 0x03, 0x00, 0x01, 0x14, 0x16, 0x04, 0x00, 0xf0, 0x01, 0x14, 0x0b, 0x02, 0x00, 0x20,
+    0x0c, 0x16, 0x0b, 0x02, 0x00, 0x20, 0x0b, 0x00, 0x38, 0x00, 0xb5, 0xff, 0x02, 0x00, 0x08, 0x0e,
+    0x08, 0x06, 0x00, 0xf0, 0x08, 0x11, 0x08, 0x03, 0x00, 0x20, 0x85, 0xff, 0x37, 0x01, 0xdc, 0xff,
+    0x02, 0x00, 0x08, 0x06, 0x08, 0x0f, 0x00, 0xf0, 0x08, 0x0b, 0x08, 0x05, 0x00, 0x30, 0x3a, 0x00,
+    0x03, 0x00, 0x8e, 0x00, 0x02, 0x00, 0x05, 0x04, 0x12, 0x03, 0x00, 0xf0, 0x05, 0x05, 0x12, 0x01,
+    0x00, 0x30, 0x09, 0xff, 0x82, 0xfe, 0xf0, 0xff, 0x02, 0x00, 0x09, 0x03, 0x05, 0x0a, 0x00, 0xf0,
+    0x09, 0x08, 0x05, 0x05, 0x00, 0x20, 0xaf, 0xff, 0x9e, 0xff, 0x32, 0x00, 0x02, 0x00, 0x06, 0x08,
+    0x0c, 0x03, 0x00, 0xf0, 0x06, 0x08, 0x06, 0x03, 0x00, 0x20, 0x7f, 0x00, 0xca, 0xff, 0x4b, 0x00,
+    0x03, 0x00, 0x02, 0x06, 0x12, 0x06, 0x00, 0xf0, 0x02, 0x06, 0x09, 0x03, 0x00, 0x20, 0x0b, 0x09,
+    0x09, 0x03, 0x00, 0x20, 0x4a, 0x00, 0x00, 0x00, 0xab, 0x00, 0x03, 0x00, 0x0a, 0x06, 0x04, 0x12,
+    0x00, 0xf0, 0x0c, 0x06, 0x02, 0x09, 0x00, 0x20, 0x0a, 0x0f, 0x02, 0x09, 0x00, 0x20, 0x04, 0x00,
+    0x61, 0xff, 0x00, 0x00, 0x02, 0x00, 0x07, 0x05, 0x06, 0x06, 0x00, 0xf0, 0x0a, 0x05, 0x03, 0x06,
+    0x00, 0x20, 0x6a, 0xff, 0x94, 0xff, 0x1e, 0x00, 0x02, 0x00, 0x0e, 0x05, 0x02, 0x12, 0x00, 0xf0,
+    0x0e, 0x0e, 0x02, 0x09, 0x00, 0x20, 0x31, 0x00, 0x06, 0x00, 0x7f, 0xff, 0x02, 0x00, 0x08, 0x05,
+    0x02, 0x12, 0x00, 0xf0, 0x08, 0x0e, 0x02, 0x09, 0x00, 0x20, 0x32, 0x01, 0x21, 0x00, 0xc9, 0xff,
+    0x02, 0x00, 0x09, 0x02, 0x0a, 0x06, 0x00, 0xf0, 0x09, 0x02, 0x05, 0x06, 0x00, 0x20, 0x3f, 0xfc,
+    0x2d, 0x01, 0xda, 0xff, 0x02, 0x00, 0x03, 0x01, 0x12, 0x0c, 0x00, 0xf0, 0x0c, 0x01, 0x09, 0x0c,
+    0x00, 0x20, 0x41, 0x02, 0x08, 0x00, 0x66, 0x00, 0x02, 0x00, 0x05, 0x02, 0x11, 0x16, 0x00, 0xf0,
+    0x05, 0x0d, 0x11, 0x0b, 0x00, 0x20, 0x19, 0x00, 0xaf, 0xff, 0x1d, 0x00, 0x02, 0x00, 0x04, 0x00,
+    0x0c, 0x06, 0x00, 0xf0, 0x04, 0x02, 0x0c, 0x02, 0x00, 0x30, 0x16, 0xff, 0xd8, 0x00, 0x15, 0x00,
+    0x03, 0x00, 0x06, 0x09, 0x10, 0x06, 0x00, 0xf0, 0x0e, 0x09, 0x08, 0x03, 0x00, 0x20, 0x06, 0x0c,
+    0x08, 0x03, 0x00, 0x20, 0x1e, 0xff, 0x5e, 0x00, 0xd0, 0xff, 0x02, 0x00, 0x09, 0x00, 0x05, 0x12,
+    0x00, 0xf0, 0x09, 0x09, 0x05, 0x09, 0x00, 0x20, 0xa8, 0xff, 0x7b, 0xff, 0x28, 0x00, 0x02, 0x00,
+    0x0c, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x0e, 0x00, 0x02, 0x09, 0x00, 0x30, 0x69, 0x00, 0xf1, 0xff,
+    0xef, 0xfe, 0x02, 0x00, 0x06, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x08, 0x00, 0x02, 0x09, 0x00, 0x30,
+    0xcb, 0xff, 0xca, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x09, 0x01, 0x06, 0x0c, 0x00, 0xf0, 0x0b, 0x01,
+    0x02, 0x0c, 0x00, 0x30, 0x09, 0x00, 0xd5, 0xfe, 0xf1, 0xff, 0x02, 0x00, 0x05, 0x09, 0x0d, 0x04,
+    0x00, 0xf0, 0x05, 0x0b, 0x0d, 0x02, 0x00, 0x20, 0x24, 0x00, 0x0a, 0x00, 0xa9, 0x00, 0x02, 0x00,
+    0x05, 0x08, 0x13, 0x03, 0x00, 0xf0, 0x05, 0x09, 0x13, 0x01, 0x00, 0x30, 0xdc, 0xff, 0xa5, 0xff,
+    0x0f, 0x00, 0x02, 0x00, 0x09, 0x09, 0x06, 0x08, 0x00, 0xf0, 0x09, 0x0d, 0x06, 0x04, 0x00, 0x20,
+    0x10, 0x00, 0x35, 0x00, 0xc1, 0xff, 0x02, 0x00, 0x0b, 0x09, 0x04, 0x0f, 0x00, 0xf0, 0x0b, 0x0e,
+    0x04, 0x05, 0x00, 0x30, 0x66, 0x00, 0xd0, 0xff, 0x65, 0x00, 0x03, 0x00, 0x02, 0x00, 0x06, 0x0e,
+    0x00, 0xf0, 0x02, 0x00, 0x03, 0x07, 0x00, 0x20, 0x05, 0x07, 0x03, 0x07, 0x00, 0x20, 0xe8, 0xff,
+    0x41, 0x00, 0xe8, 0xff, 0x03, 0x00, 0x0f, 0x01, 0x06, 0x0e, 0x00, 0xf0, 0x12, 0x01, 0x03, 0x07,
+    0x00, 0x20, 0x0f, 0x08, 0x03, 0x07, 0x00, 0x20, 0x11, 0x00, 0x08, 0x00, 0x8b, 0xff, 0x03, 0x00,
+    0x03, 0x01, 0x06, 0x0e, 0x00, 0xf0, 0x03, 0x01, 0x03, 0x07, 0x00, 0x20, 0x06, 0x08, 0x03, 0x07,
+    0x00, 0x20, 0x76, 0xff, 0x03, 0xff, 0x25, 0x00, 0x03, 0x00, 0x03, 0x14, 0x12, 0x04, 0x00, 0xf0,
+    0x0c, 0x14, 0x09, 0x02, 0x00, 0x20, 0x03, 0x16, 0x09, 0x02, 0x00, 0x20, 0xb6, 0x00, 0xde, 0xff,
+    0x94, 0x01, 0x03, 0x00, 0x05, 0x00, 0x04, 0x14, 0x00, 0xf0, 0x05, 0x00, 0x02, 0x0a, 0x00, 0x20,
+    0x07, 0x0a, 0x02, 0x0a, 0x00, 0x20, 0x59, 0xff, 0x56, 0x00, 0x13, 0x00, 0x03, 0x00, 0x10, 0x08,
+    0x08, 0x0c, 0x00, 0xf0, 0x14, 0x08, 0x04, 0x06, 0x00, 0x20, 0x10, 0x0e, 0x04, 0x06, 0x00, 0x20,
+    0xa1, 0x00, 0xd2, 0xff, 0x78, 0x00, 0x03, 0x00, 0x00, 0x08, 0x08, 0x0c, 0x00, 0xf0, 0x00, 0x08,
+    0x04, 0x06, 0x00, 0x20, 0x04, 0x0e, 0x04, 0x06, 0x00, 0x20, 0xe0, 0xfe, 0x05, 0xff, 0x1e, 0x00,
+    0x03, 0x00, 0x0d, 0x0d, 0x0a, 0x08, 0x00, 0xf0, 0x12, 0x0d, 0x05, 0x04, 0x00, 0x20, 0x0d, 0x11,
+    0x05, 0x04, 0x00, 0x20, 0x92, 0x00, 0xf8, 0xff, 0x2a, 0xff, 0x03, 0x00, 0x01, 0x0d, 0x0a, 0x08,
+    0x00, 0xf0, 0x01, 0x0d, 0x05, 0x04, 0x00, 0x20, 0x06, 0x11, 0x05, 0x04, 0x00, 0x20, 0x51, 0xff,
+    0x2a, 0x01, 0x14, 0x00, 0x02, 0x00, 0x0f, 0x08, 0x04, 0x0f, 0x00, 0xf0, 0x0f, 0x0d, 0x04, 0x05,
+    0x00, 0x30, 0xaa, 0xff, 0xa3, 0x00, 0xd3, 0xff, 0x02, 0x00, 0x05, 0x08, 0x04, 0x0f, 0x00, 0xf0,
+    0x05, 0x0d, 0x04, 0x05, 0x00, 0x30, 0x7c, 0xfd, 0xc5, 0xff, 0x20, 0x00, 0x02, 0x00, 0x06, 0x0b,
+    0x10, 0x0c, 0x00, 0xf0, 0x06, 0x0f, 0x10, 0x04, 0x00, 0x30, 0x20, 0x00, 0xc8, 0xff, 0x45, 0x00,
+    0x02, 0x00, 0x02, 0x0b, 0x10, 0x0c, 0x00, 0xf0, 0x02, 0x0f, 0x10, 0x04, 0x00, 0x30, 0x60, 0x00,
+    0x29, 0x00, 0x92, 0xff, 0x02, 0x00, 0x0e, 0x0c, 0x07, 0x09, 0x00, 0xf0, 0x0e, 0x0f, 0x07, 0x03,
+    0x00, 0x30, 0x31, 0x01, 0xd5, 0xff, 0x96, 0x00, 0x02, 0x00, 0x0a, 0x01, 0x03, 0x15, 0x00, 0xf0,
+    0x0a, 0x08, 0x03, 0x07, 0x00, 0x30, 0xfe, 0xff, 0x42, 0x00, 0xf7, 0xff, 0x02, 0x00, 0x0d, 0x0b,
+    0x09, 0x04, 0x00, 0xf0, 0x0d, 0x0d, 0x09, 0x02, 0x00, 0x20, 0xbe, 0xff, 0x3c, 0xff, 0xfb, 0xff,
+    0x02, 0x00, 0x03, 0x0a, 0x11, 0x09, 0x00, 0xf0, 0x03, 0x0d, 0x11, 0x03, 0x00, 0x30, 0x79, 0xff,
+    0xbb, 0xff, 0x24, 0x00, 0x02, 0x00, 0x0d, 0x08, 0x08, 0x0f, 0x00, 0xf0, 0x0d, 0x0d, 0x08, 0x05,
+    0x00, 0x30, 0xc7, 0x00, 0x13, 0x00, 0x96, 0xff, 0x02, 0x00, 0x03, 0x08, 0x08, 0x0f, 0x00, 0xf0,
+    0x03, 0x0d, 0x08, 0x05, 0x00, 0x30, 0x09, 0x00, 0xf7, 0xff, 0x35, 0x00, 0x03, 0x00, 0x0b, 0x0e,
+    0x0a, 0x08, 0x00, 0xf0, 0x10, 0x0e, 0x05, 0x04, 0x00, 0x20, 0x0b, 0x12, 0x05, 0x04, 0x00, 0x20,
+    0xb9, 0x00, 0xd3, 0xff, 0xa2, 0x00, 0x03, 0x00, 0x00, 0x12, 0x16, 0x06, 0x00, 0xf0, 0x00, 0x12,
+    0x0b, 0x03, 0x00, 0x20, 0x0b, 0x15, 0x0b, 0x03, 0x00, 0x20, 0xb6, 0x01, 0x30, 0x00, 0x7d, 0xff,
+    0x02, 0x00, 0x00, 0x10, 0x18, 0x04, 0x00, 0xf0, 0x00, 0x10, 0x0c, 0x04, 0x00, 0x20, 0x5b, 0xff,
+    0xb4, 0x00, 0xd3, 0xff, 0x02, 0x00, 0x06, 0x14, 0x0c, 0x03, 0x00, 0xf0, 0x0c, 0x14, 0x06, 0x03,
+    0x00, 0x20, 0x82, 0x00, 0x11, 0x00, 0xaf, 0x00, 0x03, 0x00, 0x12, 0x0c, 0x06, 0x0c, 0x00, 0xf0,
+    0x15, 0x0c, 0x03, 0x06, 0x00, 0x20, 0x12, 0x12, 0x03, 0x06, 0x00, 0x20, 0x15, 0xff, 0xc0, 0x00,
+    0xd8, 0xff, 0x03, 0x00, 0x00, 0x0c, 0x06, 0x0c, 0x00, 0xf0, 0x00, 0x0c, 0x03, 0x06, 0x00, 0x20,
+    0x03, 0x12, 0x03, 0x06, 0x00, 0x20, 0x37, 0x00, 0x31, 0x00, 0xc2, 0xff, 0x02, 0x00, 0x0f, 0x11,
+    0x09, 0x06, 0x00, 0xf0, 0x0f, 0x13, 0x09, 0x02, 0x00, 0x30, 0x24, 0x01, 0xf4, 0xff, 0x1f, 0xff,
+    0x03, 0x00, 0x01, 0x06, 0x16, 0x0a, 0x00, 0xf0, 0x01, 0x06, 0x0b, 0x05, 0x00, 0x20, 0x0c, 0x0b,
+    0x0b, 0x05, 0x00, 0x20, 0xc3, 0xff, 0x8e, 0xff, 0x2d, 0x00, 0x02, 0x00, 0x0f, 0x11, 0x09, 0x06,
+    0x00, 0xf0, 0x0f, 0x13, 0x09, 0x02, 0x00, 0x30, 0xd7, 0xff, 0xa6, 0x00, 0xd6, 0xff, 0x02, 0x00,
+    0x00, 0x12, 0x12, 0x02, 0x00, 0xf0, 0x00, 0x13, 0x12, 0x01, 0x00, 0x20, 0x0f, 0x00, 0xf2, 0xff,
+    0x58, 0x00, 0x02, 0x00, 0x03, 0x0f, 0x13, 0x03, 0x00, 0xf0, 0x03, 0x10, 0x13, 0x01, 0x00, 0x30,
+    0x42, 0x00, 0xd9, 0xff, 0xdd, 0x00, 0x02, 0x00, 0x00, 0x0d, 0x12, 0x03, 0x00, 0xf0, 0x00, 0x0e,
+    0x12, 0x01, 0x00, 0x30, 0x5c, 0xff, 0x64, 0xff, 0x1e, 0x00, 0x02, 0x00, 0x0f, 0x11, 0x09, 0x06,
+    0x00, 0xf0, 0x0f, 0x13, 0x09, 0x02, 0x00, 0x30, 0x6e, 0x00, 0xf4, 0xff, 0x1a, 0xff, 0x02, 0x00,
+    0x00, 0x11, 0x09, 0x06, 0x00, 0xf0, 0x00, 0x13, 0x09, 0x02, 0x00, 0x30, 0xd6, 0x00, 0x1c, 0x00,
+    0xeb, 0xfe, 0x02, 0x00, 0x0c, 0x11, 0x09, 0x06, 0x00, 0xf0, 0x0c, 0x13, 0x09, 0x02, 0x00, 0x30,
+    0xb2, 0xff, 0x34, 0xff, 0xf8, 0xff, 0x02, 0x00, 0x03, 0x11, 0x09, 0x06, 0x00, 0xf0, 0x03, 0x13,
+    0x09, 0x02, 0x00, 0x30, 0xf1, 0xff, 0xd0, 0xff, 0x37, 0x00, 0x02, 0x00, 0x10, 0x02, 0x03, 0x14,
+    0x00, 0xf0, 0x11, 0x02, 0x01, 0x14, 0x00, 0x30, 0x36, 0x01, 0xde, 0xff, 0xae, 0x01, 0x02, 0x00,
+    0x00, 0x0d, 0x18, 0x08, 0x00, 0xf0, 0x00, 0x11, 0x18, 0x04, 0x00, 0x20, 0xa6, 0xff, 0x7c, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0x09, 0x01, 0x06, 0x16, 0x00, 0xf0, 0x0c, 0x01, 0x03, 0x0b, 0x00, 0x20,
+    0x09, 0x0c, 0x03, 0x0b, 0x00, 0x20,
+};
 const int eye_window_w=20;
 const int eye_window_h=20;
 const int eye_n_stages=24;
-const uint8_t eye_stages_array[]={6, 12, 9, 16, 23, 27, 28, 36, 47, 48, 55, 32, 30, 44, 53, 51, 44, 72, 66, 69, 59, 88, 58, 93};
-const int16_t eye_stages_thresh_array[]={-372, -321, -351, -329, -311, -330, -296, -313, -329, -286, -292, -288, -300, -265, -268, -284, -320, -286, -278, -266, -270, -250, -259, -250};
-const int16_t eye_tree_thresh_array[]={531, -189, -66, -187, -220, 139, -889, 49, -73, 91, -374, 118, 32, 83, -48, -3, 0, -33, -483, -140, -88, -89, -117, -46, -92, -7, 0, 814, -147, -317, 0, 1, -76, 0, -75, -53, 0, 0, -13, 7, -103, 5, -30, -122, -514, 21, -33, -67, -8, -6, -20, -78, -50, 235, -39, -12, -17, -55, 0, -10, -289, 377, -36, 0, -12, -10, -196, 357, -69, -118, 10, -98, -134, -62, -1, 3, -43, -30, -437, 66, -84, 69, -23, 0, 32, -10, -91, -31, -4, 78, 23, -39, 45, -71, 125, -90, 0, -28, -28, -57, -196, 0, 4, -10, 0, 0, 1076, -96, -16, 0, -32, -6, -1, 0, 53, -53, 12, -24, -9, 64, 0, -114, 528, 99, -10, -14, 0, -66, -18, -89, -11, -18, 116, 340, -50, -19, -3, -80, 4, -106, -5, -204, -12, 19, 0, 0, -54, 9, -51, -11, 81, 19, -28, -53, -5, 11, 1, -59, -545, -41, -32, -58, -24, 44, 0, -23, -91, -20, 0, -2, 6, -49, 43, -126, 46, -50, -24, -4, -30, 11, 0, -20, 306, 82, 181, -3, -10, 0, -150, 12, -10, -57, 3, -29, -78, -20, -11, -101, 82, 7, 5, -44, 0, 15, -418, -212, -174, 1, 99, -97, -28, -2, 21, -54, -27, -17, -44, 1, -10, 5, -20, 108, -13, -12, 125, -39, 0, 20, 1, -35, 3, 4, -97, 0, 100, -583, -82, 0, -11, 0, -28, -153, -65, -12, 4, -6, 17, -44, -17, 30, 33, -136, 80, 90, -17, -3, 3, 37, -16, 0, -12, -90, -30, 3, -19, -62, 20, -7, -50, -53, -5, 24, 2, -7, -2, -24, -13, -249, -396, 16, -37, -19, -17, -39, -71, -27, 1, -9, -30, -21, -19, 6, -19, -5, 9, -1, 20, -37, -28, 4, -154, -27, 2, -17, -282, 25, 43, -257, 14, -32, -14, -38, 0, 7, -22, 30, -63, 117, 0, 214, -354, -172, 0, 21, -3, 0, 20, -6, 11, 9, -3, 8, 46, -4, 13, 0, -16, -6, 57, 672, 3, -7, -6, 7, -553, -16, -11, -5, -14, 170, -37, 25, -4, 47, -36, 2, 5, -44, 5, 9, 11, -27, -197, 62, -24, 27, -32, 15, -4, 14, 26, 0, -15, 15, -100, 193, 27, -5, -20, 14, 8, 120, -3, -443, -73, 25, -6, 3, 0, -85, -25, 44, 0, 0, 5, -3, 4, -4, -4, 31, -572, 8, -11, 21, -5, -15, 24, -21, 20, -2, 21, -60, -169, 3, -229, 4, 11, -30, -6, 18, 9, -347, -20, -8, -42, -55, -345, 10, 64, 265, 1, 5, -23, -605, -67, 12, -149, 0, -15, -16, 81, 3, -4, 64, -4, -449, -37, 60, -5, -17, 14, -15, 15, -8, -9, 4, 7, 24, -113, 192, -32, -52, 96, 65, 32, 23, 9, 18, -6, 10, 9, 23, 12, -355, 21, -81, 15, 42, -82, -21, -8, -1, 0, -1, 26, 45, -4, 9, -45, -1, 94, -9, -3, 6, 3, -84, -84, 88, 26, -36, -38, -8, -7, -55, -79, -13, 1, -31, -34, 113, -224, 10, 0, 20, -427, -2, 13, 21, -10, -11, -97, 82, -88, 11, 11, 13, -14, 7, -1, 0, -1, 82, 150, 5, -62, 19, 0, -14, 4, 0, 560, -48, 16, -1, -19, -1, 42, -3, 5, 70, 10, 5, 19, -25, -13, 13, -23, 0, -16, 5, -4, -13, 101, -31, 32, -44, -14, -127, 4, 13, -114, -94, -16, 12, -44, -74, 2, 44, -1, -14, -80, -44, -17, 6, 64, -45, 36, -3, -12, 25, 84, 408, -26, -249, -12, -40, -338, 20, 25, -13, -10, 3, -156, 0, 6, 5, 40, -6, 8, -14, 1, -2, -1, 28, 52, -6, 497, -205, 128, 7, -23, 0, -809, 0, 0, 41, -29, 993, 2, 14, 0, -2, -27, -108, 40, 132, -11, -45, 25, 356, 4, -3, -56, -310, -11, -16, 71, 90, -11, -41, -28, -15, -13, -32, 0, -13, -3, -2, -1, 5, -211, -62, 282, 5, -10, -6, -6, -27, -57, -9, 81, 10, -2, -71, -8, 10, -229, -6, -46, 95, -9, -118, -59, -21, 20, -17, 0, 1, -3, 0, -15, -164, 0, 0, 298, 41, 9, -14, -5, -39, -39, -39, -17, -39, -37, -35, -36, -58, 106, 0, 0, 28, -50, -15, 11, -31, 1, 13, -68, -26, 1, 61, 1, -1, 1, 33, -93, 0, -52, -4, 4, -183, 33, -47, 345, 58, 6, 40, -37, -1, 807, -29, 35, 36, 234, 15, -5, 4, -7, 44, 0, -22, -12, 26, 48, 55, -10, 6, 10, -31, 20, -11, 12, 12, 914, -391, 0, 0, -26, -4, -121, -53, -5, -14, -6, -25, -136, -93, -353, -8, 160, 14, 2, 2, -89, -13, 9, -1, 14, -89, 0, -6, 31, 15, 24, -7, 67, 19, -127, 2, 48, -30, -220, 63, 6, -1, 11, -269, 5, 3, 97, 112, -1, -5, -38, 31, 0, -6, 17, 0, -32, 700, -6, -43, -23, -76, -3, 43, 144, 3, 378, -12, -354, 0, -149, 10, -18, -21, 18, 59, 0, -24, -24, -45, -240, -18, -38, 5, 20, -31, -1594, -410, 3, -14, 34, 9, 30, 13, -320, 0, -39, -291, 1, -1, -16, 13, -22, -1, -5, -1, -29, -69, 122, 11, -7, 20, 336, -1, -7, -20, -34, -445, -39, -111, -26, -49, -687, -54, 314, 20, 13, -7, -1, 1, -1, 322, -3, 98, -6, -3, 1, 8, 109, -8, 23, 0, 0, 17, -8, 89, -60, -14, 7, -5, -16, -79, 53, -2, -54, 14, 25, 6, 1, -6, 14, -19, -47, -112, -216, -1222, -1, 0, 0, 8, -28, 33, 0, 6, -1, -126, -2, -48, 29, -8, 14, -551, -9, 17, -30, 2, 0, 27, 0, -832, 38, -9, 0, 61, 3, -17, 2, -68, -1, 1, -82, -59, -86, 86, 4, 0, -148, -37, -8, -93, 104, -10, -15, -68, 2, -150, 5, -34, 265, 124, 10, -28, -4, 0, -1, -7, -54, -7, -26, 0, 89, -112, 0, 287, -294, -441, 5, 279, -27, -2, -238, -25, -55, 5, 0, -317, 3, 4, -3, 341, -37, -1, 31, -510, 54, -27, -11, 3, -205, 30, -2, -7, -1, -290, -218, -82, 4, 0, 62, -852, 6, -216, -88, 0, 0, 0, -49, -72, -25, -3, -1, -69, 19, -42, -90, -28, -2, -9, -115, 8, -1, -68, 490, -1, -74, -1, 1, 3, 1764, 2, 0, -226};
-const int16_t eye_alpha1_array[]={-197, 146, 154, 164, 138, -59, 182, -72, 136, -44, 157, -31, 43, -32, 98, -163, -88, -162, 173, 171, 184, 170, 179, 151, 88, -203, -79, -135, 107, 122, -98, -67, 119, 75, 118, 106, -71, -69, 113, -41, 104, 21, 142, 91, 100, -112, 102, 107, -189, -194, 107, 120, 84, -94, -184, 91, 100, -150, -67, -200, 106, -33, 93, -76, 91, -139, 106, -99, 135, 91, 38, 143, 118, -189, -116, 24, 104, 103, 158, -33, -182, 32, -155, -68, -20, 94, -175, 60, -153, -40, -25, -155, -26, 80, -48, 93, 54, 101, 77, -195, 123, -64, 17, 109, -49, 77, -59, 49, 141, -61, 104, -147, 74, -50, -24, 120, -34, -199, 79, 16, -45, 116, -134, -38, 84, 121, -77, 58, 103, -175, -178, 64, 15, 16, -181, 131, 68, -172, 13, 144, -128, 45, 100, -30, -44, -59, 110, 18, 92, 72, 12, -27, -205, 47, 70, 23, -99, 96, 77, 94, 117, 114, 71, -38, -58, 116, -160, 67, -62, -109, -30, 71, 10, -160, 10, 51, 131, -185, 75, 11, 51, 75, -29, -26, -70, 62, -137, -53, 93, -33, -145, -124, -20, 114, -170, 44, -153, 59, -22, 12, -38, -148, -35, -26, 106, 84, 66, -88, -108, 81, 79, -153, -31, 86, -156, 64, 140, 21, 59, 15, -171, -18, -108, 41, -15, -155, -42, 11, -28, 103, 16, -24, -150, -38, -14, 38, 55, -43, -177, 48, 120, -194, 78, 67, -44, 91, 12, -163, 41, 8, 6, 85, -26, -63, 98, -160, 23, -18, 51, -71, 93, 100, 32, 18, 55, 93, -88, -158, -149, -152, -174, -24, 20, 60, -114, 111, 46, 120, 70, -31, 91, -105, -186, 141, -146, -118, -24, 58, -145, 89, -154, -26, 72, 59, 16, -97, -19, 36, 69, -39, -151, 65, 11, 63, -170, 6, -20, 71, -88, 61, -151, 47, -84, 25, 75, -37, -175, -37, -44, -17, 129, 116, -67, 19, -126, -54, -23, 65, -40, -38, 75, 12, -32, 63, 13, -55, 62, 72, 10, -125, -72, -183, -186, -79, 75, -170, -158, 57, -138, -16, -193, 23, 62, -30, -125, -55, -38, 109, 18, 12, -43, -202, -178, -27, 79, 20, -223, -29, 61, -60, -80, -70, -143, 10, 42, -27, -45, -138, 62, 17, -34, -73, -148, 101, 70, 5, -145, -38, -39, -161, 65, -25, 48, -38, 12, 46, -27, 69, -179, -23, 176, 24, 61, -29, -152, -118, -18, -189, -35, -140, -21, 53, -211, 21, 39, -52, -44, -152, 48, 8, -60, 59, 99, 46, -192, -184, -86, -30, -17, -19, 18, -43, 90, 110, 59, -34, -160, 42, -121, 46, -17, 14, -120, -31, 51, -221, 75, 8, 62, 55, 11, 38, -22, 44, 68, 11, -28, -39, 29, -10, -137, 59, -22, -31, -21, 9, -42, -31, 66, -27, -35, -19, -28, -94, -27, -136, -34, 22, 40, -175, 72, -94, -82, -83, -22, 18, 66, -21, 49, -81, -25, 116, -90, 25, 14, 80, 69, 10, -25, -134, 63, 68, 40, 104, 46, 74, -54, -116, 67, -25, 73, -28, -48, -19, 51, 45, 10, -31, 131, -129, 95, -44, -112, -32, -22, -21, -113, -28, -96, 19, -84, -15, -15, -90, 58, -14, -78, 98, -28, -51, -55, 111, -12, -97, 124, -91, 13, 115, -24, -20, -29, 17, -16, -181, 35, -33, 97, -79, 66, -14, 37, 85, -18, 118, -70, 57, 99, 61, -72, 8, 61, 99, 78, -35, 42, -161, -47, -6, -76, 67, -151, 41, -147, 15, -18, 100, 9, 45, -113, -13, 14, -9, 72, -130, -122, 103, -180, 7, -13, 23, 34, -17, 75, -42, -23, 16, 5, 65, 5, 69, -27, -76, -69, -14, 17, 52, -24, 72, -22, -29, 60, 45, 116, -60, 20, -10, 44, 13, -29, -10, 17, 87, 30, 52, -28, -25, 38, 131, -23, 7, -33, -128, -203, 78, 53, -168, -21, 16, 37, 126, 71, -148, -127, 88, 38, 58, -113, 35, -76, -41, -136, -200, -9, -24, 29, 45, 46, 64, 35, 102, -48, 12, -111, 168, 101, 15, -132, 38, -161, -14, 48, -139, -172, -110, -27, 61, -22, 11, -140, -28, 62, -161, 50, -23, 12, -23, 16, 33, 41, 156, -256, 256, 72, -256, 222, 116, 34, 82, -33, -31, 30, -16, 140, 61, -32, 76, 15, 12, 182, -89, 23, -13, 16, 45, 26, -16, 135, 20, -89, 59, 30, -164, 11, 106, 13, 11, 21, -14, 115, 46, -7, -228, -18, 18, 13, 8, 79, -33, 74, 8, 41, -111, 97, -40, -10, -13, 28, 17, 16, 50, 21, -121, -12, -26, -3, -189, -32, -42, 86, 57, 66, 48, 51, 61, -125, 79, -126, 83, -173, 57, 29, -29, -38, 25, -81, -97, -24, 56, 9, 75, 58, -129, 11, -22, -19, -90, -20, 10, 49, -53, 10, 40, -142, -10, 17, 45, 7, -118, -24, 29, -8, -16, -86, 37, -131, 5, 60, 49, -24, -80, -169, 8, 55, 62, -122, -153, 62, -35, -19, -24, -70, 58, 122, -57, 70, -11, 60, 38, -14, 9, -44, 79, -81, 62, -194, -116, 37, -25, 8, 23, -170, -147, 22, 66, -28, 9, -9, -25, -196, -34, 64, -102, 10, -66, 61, -18, 128, 63, 81, -69, 70, -89, 8, 9, 63, -21, -4, -63, 73, 32, 60, -66, -181, -149, -152, 33, -145, 29, -8, -13, -19, 50, -73, 17, 42, 6, 35, 7, 67, 39, 14, -23, 15, 75, -16, -43, 16, -25, 49, 9, -112, 50, 5, 25, 29, 121, -65, 49, 113, -34, -13, -51, 26, 72, -21, 50, -143, 127, 43, -165, 64, -22, 29, -12, -138, 6, -30, -15, -88, 51, -80, 51, -9, -72, -27, 127, 43, 22, 63, 17, -21, 7, -40, -177, -22, 54, 38, -8, 12, 55, -19, -173, 58, 14, 49, -175, 96, 7, -17, 46, -214, 106, -50, 62, -73, 74, 54, 67, 5, 138, -33, -242, -18, -21, -33, -164, 36, 40, -85, 43, -149, 36, 70, 33, -6, -61, -34, -14, -96, -95, 20, -9, 49, 33, -77, 56, -99, -24, -61, 143, 14, -15, 60, 13, -100, -79, -11, -209, 9, -91, 64, -18, -161, -17, -92, 36, 55, 115, -173, -111, -6, 46, -51, 171, -19, 63, -74, -56, -29, 40, 31, -89, 33, 44, -72, 100, -8, -145, -116, 40, -36, 42, 69, 10, 41, -109, -4, 40, 49, 20, 25, -18, -7, 29, -43, 116};
-const int16_t eye_alpha2_array[]={174, -125, -80, -39, -52, 123, -151, 151, -58, 162, -43, 190, -167, 211, -53, 33, 58, 33, -128, -91, -46, -70, -50, -56, -98, 40, 90, 90, -100, -64, 81, 83, -38, -64, -33, -45, 68, 61, -36, 109, -46, -204, -30, -98, -76, 49, -59, -58, 32, 22, -45, -36, -55, 62, 16, -42, -30, 22, 54, 20, -35, 129, -35, 52, -39, 26, -87, 61, -44, -57, -167, -37, -27, 14, 24, -140, -31, -41, -18, 95, 13, -79, 20, 37, 145, -34, 13, -45, 19, 76, 107, 18, 107, -86, 137, -41, -72, -33, -52, 25, -33, 62, -168, -33, 74, -50, 60, -72, -24, 55, -32, 24, -43, 70, 103, -22, 78, 14, -38, -185, 59, -46, 41, 108, -44, -18, 40, -52, -34, 20, 12, -41, -170, -137, 14, -22, -45, 18, -142, -18, 22, -57, -25, 108, 57, 42, -25, -147, -29, -31, -206, 86, 11, -45, -32, -109, 22, -63, -57, -45, -33, -26, -39, 102, 55, -32, 21, -37, 42, 23, 77, -31, -189, 12, -183, -49, -15, 12, -30, -178, -40, -29, 77, 104, 31, -34, 16, 41, -23, 64, 13, 14, 103, -16, 12, -43, 14, -30, 92, -161, 48, 11, 50, 64, -42, -53, -40, 35, 34, -42, -34, 22, 98, -25, 12, -36, -15, -113, -35, -126, 11, 113, 17, -46, 136, 13, 49, -147, 59, -15, -114, 77, 11, 45, 125, -48, -30, 42, 10, -38, -14, 8, -22, -23, 39, -19, -151, 8, -38, -192, -183, -18, 136, 53, -37, 30, -141, 142, -53, 35, -19, -28, -61, -112, -36, -21, 23, 12, 11, 10, 8, 77, -90, -30, 14, -17, -36, -15, -24, 53, -19, 17, 9, -13, 12, 12, 66, -26, 12, -21, 11, 59, -25, -29, -108, 15, 85, -43, -23, 50, 10, -24, -124, -24, 9, -186, 76, -75, 53, -49, 31, -63, 28, -127, -33, 85, 25, 79, 54, 126, -19, -23, 41, -138, 15, 36, 91, -36, 53, 68, -27, -183, 61, -34, -133, 32, -29, -27, -188, 45, 61, 22, 24, 46, -56, 21, 13, -51, 17, 158, 13, -113, -47, 94, 27, 47, 74, -26, -164, -185, 60, 11, 10, 93, -29, -119, 9, 84, -45, 63, 47, 42, 28, -148, -64, 100, 69, 12, -33, -180, 56, 34, 9, -20, -34, -205, 10, 48, 49, 9, -27, 77, -35, 55, -164, -35, 62, -30, 10, 79, -10, -73, -28, 62, 12, 13, 99, 10, 48, 12, 81, -31, 8, -143, -69, 51, 54, 12, -40, -175, 28, -35, -14, -45, 6, 8, 18, 57, 80, 104, -88, 39, -21, -14, -27, 67, 11, -42, 12, -36, 93, -114, 12, 52, -32, 7, -21, -198, -29, -35, -139, -38, 65, -36, -20, -120, 52, 40, -56, 137, 11, -26, 78, 45, 82, -174, 106, 103, -51, 93, 76, 124, 74, 18, 81, 18, 58, -122, -45, 9, -25, 20, 19, 22, 81, -103, -30, 79, -38, 22, 65, -13, 20, -55, -103, -20, -19, -152, 60, 11, -24, -23, -40, -16, -35, -20, 28, 13, -24, 53, -19, 55, 36, 75, -27, -30, -139, 164, -28, 29, -37, 122, 34, 119, 94, 132, 23, 100, 31, -104, 28, 143, 133, 27, -41, 123, 27, -23, 79, 39, 36, -19, 150, 23, -18, 27, -146, -21, 80, 92, 56, -94, 98, 9, -59, 58, -17, 21, -26, 122, -44, -42, 145, -23, 33, -38, -16, -29, 33, -131, -33, -20, -18, 48, -40, 10, 34, 156, 18, -20, 10, -32, 9, -77, 75, -12, -125, -28, 13, 95, -94, 148, -15, 9, 9, -12, 7, -135, 84, -55, -35, 85, -17, 31, 54, -92, -207, -17, -215, -19, 58, 16, 17, 93, -73, -25, 50, -17, 54, 42, -23, -27, -10, 19, -73, 122, -25, -82, 37, 136, -69, -14, -38, -67, 83, 81, -50, -11, 88, -212, 52, 23, -1, -20, -32, 12, 92, -181, -42, -6, -19, 9, 12, -17, -36, -23, 14, -37, 19, 35, 10, 6, 182, 55, -46, -31, -29, -23, -44, -12, 38, -110, 10, -8, -11, -83, 9, -32, 8, 98, -25, 10, 5, 11, 49, -26, 52, -99, 9, 44, -20, 6, -26, 50, -86, 51, -68, -32, -27, -16, 0, 0, -39, 11, 0, -22, -66, -24, 67, 53, -59, 105, -10, -24, 49, -24, -107, -161, -10, 18, -63, 144, -93, -29, -51, 77, -10, -63, 14, -23, -47, 7, -110, -12, -97, -110, -63, 88, -10, -27, 170, 6, 72, -77, -100, -130, -16, 37, -17, -122, -29, 11, -14, 31, 117, 89, -42, -78, -71, -27, -63, 8, 109, 43, 236, 7, 33, 25, -39, -49, -39, -42, -31, -33, 26, -29, 13, -16, 6, -32, -68, 65, 42, -56, 21, 15, 73, -24, -148, -20, -25, 11, -105, 63, 72, 14, 60, -124, -26, 24, -159, -31, 10, 159, -78, -28, -226, 8, 73, -42, 153, 76, 16, -33, 8, -178, -22, -26, 65, 15, 6, -116, -21, -21, 11, 5, -18, 67, 99, 74, 20, -20, -1, 22, -25, 80, -22, -32, 93, -137, 28, -17, 16, -20, 7, 7, -28, 50, -101, -40, 4, 6, -41, -15, 40, -121, 126, 40, 5, 28, -17, 10, -84, 17, -18, 61, -7, -14, -10, 14, -13, 11, -110, -94, -15, 56, 176, 16, -13, -32, -18, 15, 4, 5, 5, -25, 8, -30, 153, 59, 45, -20, 12, -57, -22, -142, -30, -118, -14, -28, -72, 45, -62, -13, 63, 24, -62, 46, -24, -115, 8, -19, -184, -38, -32, -30, 41, -44, -23, 46, 92, 30, -61, -17, 104, -29, 17, -15, -33, 10, -22, 61, -48, 147, 12, -158, 41, 90, 16, -25, 15, -22, 136, 18, 63, -10, -28, -70, -24, -86, 62, -176, 30, 7, 61, -33, -32, 129, -102, -22, 67, 8, -23, -91, -24, 6, -13, -228, 69, -25, 6, -13, 26, -37, 27, -26, -35, -11, -110, -11, 42, 5, 68, 70, 45, 10, -29, -28, 11, -27, 7, -28, -13, -28, 128, 15, 25, 63, 10, 10, -44, 104, -21, -36, 13, -19, 10, 38, 16, -6, -71, 63, -16, -79, 8, 12, 93, 4, -85, 10, -14, 58, 7, 71, 10, -27, -17, -10, 4, 8, 130, -21, 17, -5, 44, -16, 13, 16, 29, -21, -28, 8, -27, -22, 13, -10, 105, 7, 6, -23, 26, -21, -14, -81, -21, 7, 204, -21, -18, -53, -38, 55, 146, -32, 20, -7};
-const int8_t eye_num_rectangles_array[]={2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 3, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 2, 3, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2, 3, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 3, 2, 2, 2, 3, 3, 2, 3, 2, 2, 3, 2, 2, 3, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 2, 2, 2, 3, 2, 3, 2, 3, 2, 2, 3, 2, 3, 2, 3, 2, 3, 3, 2, 3, 2, 2, 2, 2, 2, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 3, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 3, 3, 2, 2, 3, 3, 3, 2, 3, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 3, 3, 3, 3, 3, 3, 2, 2, 3, 3, 2, 3, 2, 2, 2, 3, 3, 3, 2, 3, 3, 2, 2, 2, 3, 2, 3, 2, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 3, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 3, 2, 3, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2, 3, 2, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 3, 3, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 3, 3, 2, 2, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2, 3, 2, 3, 3, 2, 2, 2, 2, 2, 3, 3, 2, 2, 2, 2, 3, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 3, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2};
-const int8_t eye_weights_array[]={-1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 3, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 2, -1, 2, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 2, 2, -1, 2, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 3, -1, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 3, -1, 2, 2, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 2, 2, -1, 3, -1, 2, 2, -1, 3, -1, 2, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, -1, 2, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, -1, 2, -1, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, -1, 2, 2, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 2, -1, 2, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, 2, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, 2, -1, 3, -1, 2, 2, -1, 3, -1, 2, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, -1, 2, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, -1, 3, -1, 2, -1, 2, 2, -1, 2, -1, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 2, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, 2, -1, 2, -1, 2, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, 2, -1, 3, -1, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 2, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, 2, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 2, -1, 2, -1, 2, -1, 3, -1, 2, 2, -1, 2, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 2, 2, -1, 2, -1, 3, -1, 3, -1, 2, 2, -1, 3, -1, 3, -1, 2, -1, 3, -1, 3, -1, 3, -1, 2, -1, 2, -1, 3, -1, 2, -1, 2};
-const int8_t eye_rectangles_array[]={0, 8, 20, 12, 0, 14, 20, 6, 9, 1, 4, 15, 9, 6, 4, 5, 6, 10, 9, 2, 9, 10, 3, 2, 7, 0, 10, 9, 7, 3, 10, 3, 12, 2, 2, 18, 12, 8, 2, 6, 8, 6, 8, 6, 8, 9, 8, 3, 2, 0, 17, 18, 2, 6, 17, 6, 10, 10, 1, 8, 10, 14, 1, 4, 7, 10, 9, 2, 10, 10, 3, 2, 5, 1, 6, 6, 5, 3, 6, 2, 3, 1, 15, 9, 3, 4, 15, 3, 6, 3, 9, 6, 6, 5, 9, 2, 8, 17, 6, 3, 10, 17, 2, 3, 9, 10, 9, 1, 12, 10, 3, 1, 1, 7, 6, 11, 3, 7, 2, 11, 9, 18, 3, 1, 10, 18, 1, 1, 16, 16, 1, 2, 16, 17, 1, 1, 9, 17, 6, 3, 11, 17, 2, 3, 8, 0, 5, 18, 8, 6, 5, 6, 6, 7, 9, 7, 9, 7, 3, 7, 14, 6, 6, 10, 16, 6, 2, 10, 9, 8, 9, 5, 12, 8, 3, 5, 3, 7, 9, 6, 6, 7, 3, 6, 1, 7, 6, 6, 3, 7, 2, 6, 16, 0, 4, 18, 16, 6, 4, 6, 0, 17, 3, 3, 0, 18, 3, 1, 16, 0, 2, 1, 17, 0, 1, 1, 0, 8, 20, 12, 0, 14, 20, 6, 6, 6, 9, 8, 9, 6, 3, 8, 5, 3, 12, 9, 5, 6, 12, 3, 4, 16, 1, 2, 4, 17, 1, 1, 18, 10, 2, 1, 19, 10, 1, 1, 9, 8, 6, 5, 11, 8, 2, 5, 0, 0, 2, 1, 1, 0, 1, 1, 6, 8, 6, 6, 8, 8, 2, 6, 11, 7, 6, 7, 13, 7, 2, 7, 19, 14, 1, 2, 19, 15, 1, 1, 6, 17, 1, 2, 6, 18, 1, 1, 14, 7, 2, 7, 15, 7, 1, 7, 6, 8, 2, 4, 7, 8, 1, 4, 5, 8, 12, 6, 5, 10, 12, 2, 2, 17, 1, 3, 2, 18, 1, 1, 6, 7, 3, 6, 7, 7, 1, 6, 6, 7, 9, 12, 9, 7, 3, 12, 6, 2, 11, 12, 6, 6, 11, 4, 1, 12, 5, 8, 1, 16, 5, 4, 14, 7, 6, 7, 16, 7, 2, 7, 10, 8, 6, 6, 12, 8, 2, 6, 16, 18, 4, 2, 16, 19, 4, 1, 18, 17, 2, 3, 18, 18, 2, 1, 9, 7, 3, 7, 10, 7, 1, 7, 5, 6, 6, 8, 7, 6, 2, 8, 2, 6, 6, 11, 4, 6, 2, 11, 8, 10, 12, 8, 8, 14, 12, 4, 7, 17, 6, 3, 9, 17, 2, 3, 10, 9, 3, 3, 11, 9, 1, 3, 8, 8, 3, 6, 9, 8, 1, 6, 7, 0, 6, 5, 9, 0, 2, 5, 6, 17, 1, 3, 6, 18, 1, 1, 0, 18, 4, 2, 0, 19, 4, 1, 4, 1, 11, 9, 4, 4, 11, 3, 3, 1, 14, 9, 3, 4, 14, 3, 0, 9, 6, 4, 2, 9, 2, 4, 18, 13, 1, 2, 18, 14, 1, 1, 13, 5, 3, 11, 14, 5, 1, 11, 0, 18, 8, 2, 0, 18, 4, 1, 4, 19, 4, 1, 5, 8, 12, 5, 9, 8, 4, 5, 4, 7, 11, 10, 4, 12, 11, 5, 14, 9, 6, 4, 16, 9, 2, 4, 0, 7, 6, 8, 3, 7, 3, 8, 0, 16, 3, 3, 0, 17, 3, 1, 7, 11, 12, 1, 11, 11, 4, 1, 4, 8, 9, 4, 7, 8, 3, 4, 5, 16, 6, 4, 7, 16, 2, 4, 18, 17, 1, 3, 18, 18, 1, 1, 18, 17, 1, 3, 18, 18, 1, 1, 4, 9, 4, 10, 4, 9, 2, 5, 6, 14, 2, 5, 4, 8, 6, 4, 6, 8, 2, 4, 10, 2, 2, 18, 10, 8, 2, 6, 0, 5, 8, 6, 0, 5, 4, 3, 4, 8, 4, 3, 6, 0, 6, 5, 8, 0, 2, 5, 18, 0, 2, 14, 18, 7, 2, 7, 8, 18, 4, 2, 10, 18, 2, 2, 1, 17, 6, 3, 1, 18, 6, 1, 11, 8, 3, 5, 12, 8, 1, 5, 11, 8, 3, 4, 12, 8, 1, 4, 11, 0, 6, 5, 13, 0, 2, 5, 1, 7, 6, 7, 3, 7, 2, 7, 0, 13, 1, 3, 0, 14, 1, 1, 3, 2, 9, 6, 3, 4, 9, 2, 8, 6, 9, 2, 8, 7, 9, 1, 0, 14, 3, 6, 0, 16, 3, 2, 1, 11, 6, 4, 3, 11, 2, 4, 6, 9, 9, 3, 9, 9, 3, 3, 6, 0, 9, 6, 6, 2, 9, 2, 8, 5, 6, 6, 8, 7, 6, 2, 1, 12, 2, 1, 2, 12, 1, 1, 10, 10, 6, 2, 12, 10, 2, 2, 13, 8, 6, 6, 15, 8, 2, 6, 6, 16, 6, 4, 8, 16, 2, 4, 8, 0, 9, 9, 8, 3, 9, 3, 18, 17, 1, 3, 18, 18, 1, 1, 18, 17, 1, 3, 18, 18, 1, 1, 7, 10, 3, 3, 8, 10, 1, 3, 9, 14, 2, 2, 9, 14, 1, 1, 10, 15, 1, 1, 9, 14, 2, 2, 9, 14, 1, 1, 10, 15, 1, 1, 0, 8, 19, 12, 0, 14, 19, 6, 7, 6, 9, 14, 10, 6, 3, 14, 13, 8, 3, 4, 14, 8, 1, 4, 4, 17, 1, 3, 4, 18, 1, 1, 4, 9, 6, 3, 6, 9, 2, 3, 2, 18, 5, 2, 2, 19, 5, 1, 7, 8, 2, 2, 7, 8, 1, 1, 8, 9, 1, 1, 7, 8, 2, 2, 7, 8, 1, 1, 8, 9, 1, 1, 5, 10, 13, 2, 5, 11, 13, 1, 10, 8, 1, 9, 10, 11, 1, 3, 15, 8, 2, 12, 15, 8, 1, 6, 16, 14, 1, 6, 4, 0, 3, 5, 5, 0, 1, 5, 12, 6, 3, 7, 13, 6, 1, 7, 7, 16, 6, 4, 9, 16, 2, 4, 9, 16, 2, 1, 10, 16, 1, 1, 6, 10, 9, 2, 9, 10, 3, 2, 0, 6, 15, 14, 0, 13, 15, 7, 9, 1, 5, 6, 9, 3, 5, 2, 3, 9, 3, 4, 4, 9, 1, 4, 5, 7, 3, 6, 6, 7, 1, 6, 17, 16, 1, 2, 17, 17, 1, 1, 9, 8, 6, 12, 11, 8, 2, 12, 6, 10, 6, 1, 8, 10, 2, 1, 7, 17, 9, 3, 10, 17, 3, 3, 14, 18, 6, 2, 14, 19, 6, 1, 9, 5, 3, 14, 10, 5, 1, 14, 8, 16, 9, 4, 11, 16, 3, 4, 0, 0, 4, 14, 0, 7, 4, 7, 8, 1, 6, 3, 10, 1, 2, 3, 6, 8, 3, 4, 7, 8, 1, 4, 4, 8, 3, 4, 5, 8, 1, 4, 5, 1, 6, 5, 7, 1, 2, 5, 1, 18, 1, 2, 1, 19, 1, 1, 7, 0, 6, 6, 7, 2, 6, 2, 0, 18, 4, 2, 0, 19, 4, 1, 12, 3, 8, 12, 12, 7, 8, 4, 12, 9, 3, 4, 13, 9, 1, 4, 12, 8, 3, 5, 13, 8, 1, 5, 16, 0, 2, 1, 17, 0, 1, 1, 5, 17, 1, 3, 5, 18, 1, 1, 10, 2, 3, 6, 10, 4, 3, 2, 4, 17, 2, 3, 4, 18, 2, 1, 12, 7, 1, 9, 12, 10, 1, 3, 7, 6, 3, 9, 8, 6, 1, 9, 17, 13, 3, 6, 17, 15, 3, 2, 7, 7, 3, 8, 8, 7, 1, 8, 5, 0, 3, 5, 6, 0, 1, 5, 4, 6, 9, 8, 7, 6, 3, 8, 2, 9, 3, 3, 3, 9, 1, 3, 16, 18, 4, 2, 16, 19, 4, 1, 17, 10, 3, 10, 17, 15, 3, 5, 8, 9, 6, 4, 10, 9, 2, 4, 5, 2, 10, 12, 5, 6, 10, 4, 6, 9, 6, 3, 8, 9, 2, 3, 11, 7, 3, 7, 12, 7, 1, 7, 12, 8, 6, 4, 14, 8, 2, 4, 14, 8, 6, 5, 16, 8, 2, 5, 12, 12, 2, 4, 12, 14, 2, 2, 3, 15, 1, 2, 3, 16, 1, 1, 12, 7, 3, 4, 13, 7, 1, 4, 10, 0, 6, 6, 12, 0, 2, 6, 10, 6, 3, 8, 11, 6, 1, 8, 16, 17, 1, 2, 16, 18, 1, 1, 16, 16, 1, 3, 16, 17, 1, 1, 11, 11, 1, 2, 11, 12, 1, 1, 3, 7, 6, 9, 5, 7, 2, 9, 4, 18, 9, 1, 7, 18, 3, 1, 0, 11, 4, 9, 0, 14, 4, 3, 9, 17, 6, 3, 11, 17, 2, 3, 7, 8, 6, 12, 9, 8, 2, 12, 6, 8, 3, 4, 7, 8, 1, 4, 3, 17, 1, 3, 3, 18, 1, 1, 11, 9, 6, 4, 13, 9, 2, 4, 6, 1, 3, 2, 7, 1, 1, 2, 1, 0, 2, 1, 2, 0, 1, 1, 1, 0, 2, 14, 1, 0, 1, 7, 2, 7, 1, 7, 5, 5, 11, 8, 5, 9, 11, 4, 9, 3, 5, 6, 9, 5, 5, 2, 7, 9, 5, 10, 7, 14, 5, 5, 15, 10, 2, 2, 16, 10, 1, 2, 0, 18, 8, 2, 0, 19, 8, 1, 7, 17, 1, 3, 7, 18, 1, 1, 7, 2, 11, 6, 7, 4, 11, 2, 8, 3, 9, 3, 8, 4, 9, 1, 0, 9, 2, 2, 0, 10, 2, 1, 0, 5, 3, 6, 0, 7, 3, 2, 6, 7, 2, 2, 6, 7, 1, 1, 7, 8, 1, 1, 7, 6, 3, 6, 8, 6, 1, 6, 12, 1, 6, 4, 14, 1, 2, 4, 9, 11, 6, 8, 11, 11, 2, 8, 17, 15, 3, 3, 17, 16, 3, 1, 6, 6, 3, 9, 6, 9, 3, 3, 0, 5, 8, 6, 0, 5, 4, 3, 4, 8, 4, 3, 0, 6, 1, 3, 0, 7, 1, 1, 17, 0, 2, 6, 18, 0, 1, 6, 10, 17, 6, 3, 12, 17, 2, 3, 13, 15, 2, 2, 13, 15, 1, 1, 14, 16, 1, 1, 4, 0, 12, 3, 4, 1, 12, 1, 5, 3, 10, 9, 5, 6, 10, 3, 7, 7, 9, 7, 10, 7, 3, 7, 5, 8, 9, 6, 8, 8, 3, 6, 0, 16, 6, 2, 0, 17, 6, 1, 12, 6, 7, 14, 12, 13, 7, 7, 13, 7, 6, 8, 15, 7, 2, 8, 2, 10, 6, 3, 4, 10, 2, 3, 18, 17, 1, 3, 18, 18, 1, 1, 7, 1, 6, 2, 7, 2, 6, 1, 6, 0, 6, 4, 6, 2, 6, 2, 8, 18, 6, 2, 10, 18, 2, 2, 7, 6, 5, 2, 7, 7, 5, 1, 6, 7, 3, 6, 7, 7, 1, 6, 18, 18, 2, 2, 18, 18, 1, 1, 19, 19, 1, 1, 16, 8, 3, 7, 17, 8, 1, 7, 0, 16, 2, 3, 0, 17, 2, 1, 5, 19, 6, 1, 7, 19, 2, 1, 9, 5, 6, 6, 9, 7, 6, 2, 0, 10, 2, 4, 0, 12, 2, 2, 0, 9, 4, 3, 2, 9, 2, 3, 1, 10, 6, 9, 3, 10, 2, 9, 9, 0, 6, 2, 11, 0, 2, 2, 14, 1, 2, 1, 15, 1, 1, 1, 0, 8, 1, 4, 0, 10, 1, 2, 15, 6, 2, 2, 15, 6, 1, 1, 16, 7, 1, 1, 7, 5, 3, 6, 8, 5, 1, 6, 19, 17, 1, 3, 19, 18, 1, 1, 7, 10, 3, 1, 8, 10, 1, 1, 12, 1, 6, 6, 14, 1, 2, 6, 15, 5, 2, 1, 16, 5, 1, 1, 8, 2, 7, 4, 8, 4, 7, 2, 4, 0, 14, 15, 4, 5, 14, 5, 7, 8, 6, 6, 9, 8, 2, 6, 11, 17, 1, 3, 11, 18, 1, 1, 12, 16, 2, 4, 12, 16, 1, 2, 13, 18, 1, 2, 10, 13, 2, 1, 11, 13, 1, 1, 11, 8, 3, 3, 12, 8, 1, 3, 2, 0, 6, 8, 4, 0, 2, 8, 3, 5, 6, 6, 3, 5, 3, 3, 6, 8, 3, 3, 10, 8, 3, 3, 11, 8, 1, 3, 5, 17, 4, 2, 5, 18, 4, 1, 8, 16, 5, 2, 8, 17, 5, 1, 0, 4, 3, 3, 0, 5, 3, 1, 6, 3, 6, 2, 8, 3, 2, 2, 4, 4, 9, 3, 7, 4, 3, 3, 0, 13, 1, 4, 0, 15, 1, 2, 0, 17, 8, 3, 0, 18, 8, 1, 6, 1, 11, 6, 6, 3, 11, 2, 4, 10, 6, 2, 6, 10, 2, 2, 10, 8, 1, 12, 10, 14, 1, 6, 5, 8, 3, 4, 6, 8, 1, 4, 0, 17, 1, 3, 0, 18, 1, 1, 0, 17, 1, 3, 0, 18, 1, 1, 13, 8, 3, 4, 14, 8, 1, 4, 1, 5, 5, 4, 1, 7, 5, 2, 18, 14, 1, 2, 18, 15, 1, 1, 13, 8, 2, 4, 14, 8, 1, 4, 10, 6, 6, 8, 12, 6, 2, 8, 8, 6, 6, 10, 10, 6, 2, 10, 17, 16, 1, 3, 17, 17, 1, 1, 1, 7, 2, 10, 2, 7, 1, 10, 5, 9, 6, 3, 7, 9, 2, 3, 0, 8, 5, 12, 0, 14, 5, 6, 0, 11, 1, 3, 0, 12, 1, 1, 6, 16, 6, 4, 8, 16, 2, 4, 0, 6, 2, 6, 0, 8, 2, 2, 11, 18, 2, 1, 12, 18, 1, 1, 5, 1, 9, 2, 5, 2, 9, 1, 0, 0, 1, 2, 0, 1, 1, 1, 15, 9, 3, 3, 16, 9, 1, 3, 18, 16, 1, 3, 18, 17, 1, 1, 11, 10, 6, 1, 13, 10, 2, 1, 1, 3, 4, 4, 3, 3, 2, 4, 11, 2, 1, 18, 11, 8, 1, 6, 9, 1, 5, 12, 9, 5, 5, 4, 12, 0, 8, 1, 16, 0, 4, 1, 8, 6, 3, 10, 9, 6, 1, 10, 19, 2, 1, 6, 19, 4, 1, 2, 18, 6, 2, 2, 18, 7, 2, 1, 7, 7, 3, 4, 8, 7, 1, 4, 5, 0, 6, 5, 7, 0, 2, 5, 0, 3, 7, 3, 0, 4, 7, 1, 1, 6, 2, 1, 2, 6, 1, 1, 4, 8, 2, 10, 4, 8, 1, 5, 5, 13, 1, 5, 2, 18, 18, 2, 2, 18, 9, 1, 11, 19, 9, 1, 2, 7, 4, 4, 2, 7, 2, 2, 4, 9, 2, 2, 17, 3, 3, 4, 18, 3, 1, 4, 16, 9, 2, 8, 16, 9, 1, 4, 17, 13, 1, 4, 15, 7, 1, 6, 15, 9, 1, 2, 14, 2, 2, 2, 14, 3, 2, 1, 17, 0, 2, 3, 17, 1, 2, 1, 16, 18, 2, 2, 16, 18, 1, 1, 17, 19, 1, 1, 10, 4, 4, 3, 10, 5, 4, 1, 0, 2, 8, 6, 4, 2, 4, 6, 7, 14, 6, 6, 7, 16, 6, 2, 11, 15, 2, 2, 11, 16, 2, 1, 7, 1, 9, 4, 10, 1, 3, 4, 9, 7, 3, 7, 10, 7, 1, 7, 6, 17, 2, 2, 6, 17, 1, 1, 7, 18, 1, 1, 4, 6, 3, 9, 5, 6, 1, 9, 0, 10, 19, 10, 0, 15, 19, 5, 5, 17, 6, 1, 7, 17, 2, 1, 0, 12, 6, 3, 3, 12, 3, 3, 2, 5, 18, 5, 8, 5, 6, 5, 1, 15, 6, 4, 1, 17, 6, 2, 14, 10, 6, 6, 16, 10, 2, 6, 0, 14, 4, 3, 0, 15, 4, 1, 1, 7, 6, 11, 3, 7, 2, 11, 13, 17, 7, 2, 13, 18, 7, 1, 0, 14, 2, 3, 0, 15, 2, 1, 0, 0, 6, 2, 3, 0, 3, 2, 0, 1, 6, 3, 3, 1, 3, 3, 0, 8, 2, 6, 0, 10, 2, 2, 1, 2, 6, 14, 1, 2, 3, 7, 4, 9, 3, 7, 17, 5, 2, 2, 17, 5, 1, 1, 18, 6, 1, 1, 11, 10, 9, 4, 14, 10, 3, 4, 2, 9, 12, 4, 6, 9, 4, 4, 7, 10, 12, 2, 11, 10, 4, 2, 2, 13, 1, 2, 2, 14, 1, 1, 16, 7, 4, 3, 16, 8, 4, 1, 19, 16, 1, 3, 19, 17, 1, 1, 18, 11, 1, 2, 18, 12, 1, 1, 12, 7, 8, 2, 12, 7, 4, 1, 16, 8, 4, 1, 14, 9, 2, 4, 15, 9, 1, 4, 14, 2, 6, 4, 14, 2, 3, 2, 17, 4, 3, 2, 14, 0, 6, 1, 17, 0, 3, 1, 3, 12, 2, 1, 4, 12, 1, 1, 17, 2, 3, 1, 18, 2, 1, 1, 1, 16, 18, 2, 7, 16, 6, 2, 2, 19, 8, 1, 6, 19, 4, 1, 1, 17, 4, 3, 1, 18, 4, 1, 19, 13, 1, 2, 19, 14, 1, 1, 9, 16, 10, 4, 9, 16, 5, 2, 14, 18, 5, 2, 12, 9, 2, 4, 12, 9, 1, 2, 13, 11, 1, 2, 19, 11, 1, 9, 19, 14, 1, 3, 6, 6, 14, 14, 6, 13, 14, 7, 2, 17, 4, 2, 2, 18, 4, 1, 0, 2, 1, 3, 0, 3, 1, 1, 0, 12, 1, 3, 0, 13, 1, 1, 15, 15, 4, 4, 15, 17, 4, 2, 2, 5, 18, 7, 8, 5, 6, 7, 1, 16, 5, 3, 1, 17, 5, 1, 0, 4, 2, 3, 0, 5, 2, 1, 0, 6, 2, 6, 1, 6, 1, 6, 16, 14, 4, 3, 16, 15, 4, 1, 0, 0, 10, 6, 0, 0, 5, 3, 5, 3, 5, 3, 2, 2, 3, 6, 3, 2, 1, 6, 2, 0, 3, 10, 3, 0, 1, 10, 5, 5, 2, 2, 5, 6, 2, 1, 12, 6, 4, 4, 12, 8, 4, 2, 13, 5, 7, 3, 13, 6, 7, 1, 10, 13, 1, 2, 10, 14, 1, 1, 16, 16, 4, 2, 18, 16, 2, 2, 16, 12, 4, 7, 18, 12, 2, 7, 16, 17, 1, 3, 16, 18, 1, 1, 19, 9, 1, 3, 19, 10, 1, 1, 18, 7, 2, 6, 19, 7, 1, 6, 8, 1, 3, 4, 9, 1, 1, 4, 14, 0, 6, 9, 16, 0, 2, 9, 4, 2, 10, 2, 9, 2, 5, 2, 2, 12, 8, 4, 2, 12, 4, 2, 6, 14, 4, 2, 0, 4, 7, 3, 0, 5, 7, 1, 14, 14, 3, 3, 15, 14, 1, 3, 0, 3, 4, 3, 2, 3, 2, 3, 1, 0, 2, 7, 2, 0, 1, 7, 15, 16, 4, 4, 15, 18, 4, 2, 5, 8, 12, 4, 5, 10, 12, 2, 3, 17, 1, 2, 3, 18, 1, 1, 6, 1, 3, 4, 7, 1, 1, 4, 6, 2, 3, 4, 7, 2, 1, 4, 6, 8, 9, 12, 9, 8, 3, 12, 8, 1, 8, 6, 8, 3, 8, 2, 14, 2, 6, 3, 17, 2, 3, 3, 0, 6, 1, 3, 0, 7, 1, 1, 10, 0, 10, 2, 15, 0, 5, 2, 11, 0, 3, 2, 12, 0, 1, 2, 3, 19, 10, 1, 8, 19, 5, 1, 0, 4, 7, 16, 0, 12, 7, 8, 2, 16, 1, 3, 2, 17, 1, 1, 7, 8, 12, 6, 11, 8, 4, 6, 14, 9, 6, 7, 16, 9, 2, 7, 12, 17, 6, 1, 14, 17, 2, 1, 16, 1, 3, 1, 17, 1, 1, 1, 0, 17, 8, 2, 0, 17, 4, 1, 4, 18, 4, 1, 17, 0, 2, 1, 18, 0, 1, 1, 4, 15, 6, 5, 6, 15, 2, 5, 7, 2, 8, 2, 7, 3, 8, 1, 4, 1, 8, 4, 4, 3, 8, 2, 5, 19, 2, 1, 6, 19, 1, 1, 5, 19, 2, 1, 6, 19, 1, 1, 16, 17, 1, 3, 16, 18, 1, 1, 0, 11, 2, 3, 1, 11, 1, 3, 0, 19, 4, 1, 2, 19, 2, 1, 0, 18, 4, 2, 2, 18, 2, 2, 2, 17, 1, 3, 2, 18, 1, 1, 5, 7, 11, 2, 5, 8, 11, 1, 9, 2, 4, 10, 9, 7, 4, 5, 0, 2, 4, 3, 0, 3, 4, 1, 10, 19, 10, 1, 15, 19, 5, 1, 11, 17, 8, 3, 15, 17, 4, 3, 8, 19, 3, 1, 9, 19, 1, 1, 14, 0, 3, 4, 15, 0, 1, 4, 10, 6, 4, 3, 10, 7, 4, 1, 0, 8, 3, 2, 0, 9, 3, 1, 7, 12, 3, 6, 7, 14, 3, 2, 1, 18, 1, 2, 1, 19, 1, 1, 0, 12, 4, 4, 2, 12, 2, 4, 1, 8, 6, 7, 3, 8, 2, 7, 0, 8, 4, 5, 2, 8, 2, 5, 19, 16, 1, 3, 19, 17, 1, 1, 1, 5, 18, 6, 7, 5, 6, 6, 2, 15, 4, 2, 2, 16, 4, 1, 18, 6, 2, 11, 19, 6, 1, 11, 0, 12, 2, 6, 0, 14, 2, 2, 12, 5, 3, 2, 12, 6, 3, 1, 1, 3, 2, 3, 1, 4, 2, 1, 16, 14, 4, 4, 16, 16, 4, 2, 6, 8, 12, 5, 10, 8, 4, 5, 13, 7, 2, 7, 14, 7, 1, 7, 1, 8, 2, 6, 2, 8, 1, 6, 15, 0, 3, 7, 16, 0, 1, 7, 4, 2, 6, 2, 6, 2, 2, 2, 0, 9, 20, 9, 0, 12, 20, 3, 10, 14, 2, 2, 10, 15, 2, 1, 6, 5, 10, 4, 6, 7, 10, 2, 6, 1, 5, 9, 6, 4, 5, 3, 16, 18, 2, 2, 16, 18, 1, 1, 17, 19, 1, 1, 0, 14, 2, 4, 0, 16, 2, 2, 10, 8, 2, 5, 11, 8, 1, 5, 3, 7, 12, 7, 7, 7, 4, 7, 0, 0, 6, 6, 3, 0, 3, 6, 1, 0, 4, 4, 3, 0, 2, 4, 0, 0, 6, 8, 2, 0, 2, 8, 0, 0, 2, 1, 1, 0, 1, 1, 0, 0, 3, 3, 0, 1, 3, 1, 5, 4, 2, 4, 5, 6, 2, 2, 2, 10, 9, 1, 5, 10, 3, 1, 1, 17, 1, 3, 1, 18, 1, 1, 0, 17, 2, 3, 0, 18, 2, 1, 0, 15, 16, 3, 8, 15, 8, 3, 0, 5, 4, 1, 2, 5, 2, 1, 1, 0, 6, 20, 3, 0, 2, 20, 2, 5, 4, 6, 2, 5, 2, 3, 4, 8, 2, 3, 9, 16, 6, 3, 11, 16, 2, 3, 11, 17, 6, 1, 14, 17, 3, 1, 3, 17, 15, 2, 8, 17, 5, 2, 18, 0, 2, 3, 18, 1, 2, 1, 13, 1, 7, 4, 13, 3, 7, 2, 13, 6, 4, 4, 13, 6, 2, 2, 15, 8, 2, 2, 17, 6, 3, 4, 17, 8, 3, 2, 14, 9, 2, 2, 15, 9, 1, 2, 17, 17, 1, 3, 17, 18, 1, 1, 3, 19, 8, 1, 7, 19, 4, 1, 0, 9, 3, 6, 0, 12, 3, 3, 4, 7, 15, 5, 9, 7, 5, 5, 6, 9, 9, 5, 9, 9, 3, 5, 8, 1, 6, 2, 10, 1, 2, 2, 4, 0, 12, 2, 10, 0, 6, 2, 7, 0, 10, 3, 12, 0, 5, 3, 5, 0, 9, 6, 5, 2, 9, 2, 8, 3, 6, 4, 8, 5, 6, 2, 17, 4, 2, 3, 17, 5, 2, 1, 5, 2, 4, 3, 5, 3, 4, 1, 5, 9, 2, 6, 6, 9, 1, 6, 14, 10, 2, 6, 15, 10, 1, 6, 7, 4, 3, 3, 7, 5, 3, 1, 12, 4, 8, 2, 12, 4, 4, 1, 16, 5, 4, 1, 15, 8, 1, 6, 15, 10, 1, 2, 4, 17, 11, 3, 4, 18, 11, 1, 3, 0, 16, 20, 3, 10, 16, 10, 12, 4, 4, 6, 12, 6, 4, 2, 11, 0, 6, 6, 13, 0, 2, 6, 13, 1, 6, 4, 13, 1, 3, 2, 16, 3, 3, 2, 11, 0, 6, 4, 13, 0, 2, 4, 8, 6, 6, 9, 10, 6, 2, 9, 7, 0, 3, 4, 8, 0, 1, 4, 0, 17, 14, 2, 0, 17, 7, 1, 7, 18, 7, 1, 6, 18, 2, 2, 6, 18, 1, 1, 7, 19, 1, 1, 18, 17, 1, 3, 18, 18, 1, 1, 17, 18, 2, 2, 17, 18, 1, 1, 18, 19, 1, 1, 5, 7, 1, 9, 5, 10, 1, 3, 5, 3, 6, 4, 7, 3, 2, 4, 1, 9, 6, 2, 1, 9, 3, 1, 4, 10, 3, 1, 6, 9, 2, 3, 7, 9, 1, 3, 6, 8, 6, 12, 8, 8, 2, 12, 4, 18, 2, 2, 4, 18, 1, 1, 5, 19, 1, 1, 9, 1, 6, 6, 9, 3, 6, 2, 6, 17, 6, 2, 6, 18, 6, 1, 3, 18, 16, 2, 3, 19, 16, 1, 3, 0, 3, 11, 4, 0, 1, 11, 13, 18, 3, 1, 14, 18, 1, 1, 6, 0, 9, 6, 6, 2, 9, 2, 1, 2, 12, 4, 1, 2, 6, 2, 7, 4, 6, 2, 3, 3, 6, 4, 5, 3, 2, 4, 12, 0, 8, 1, 16, 0, 4, 1, 9, 0, 6, 2, 11, 0, 2, 2, 3, 3, 12, 1, 9, 3, 6, 1, 2, 7, 6, 2, 2, 7, 3, 1, 5, 8, 3, 1, 0, 8, 4, 6, 0, 10, 4, 2, 9, 6, 3, 7, 10, 6, 1, 7, 9, 6, 6, 13, 11, 6, 2, 13, 11, 12, 6, 1, 13, 12, 2, 1, 18, 9, 2, 6, 18, 12, 2, 3, 17, 2, 3, 9, 18, 2, 1, 9, 13, 8, 4, 6, 13, 8, 2, 3, 15, 11, 2, 3, 4, 2, 12, 6, 10, 2, 6, 6, 4, 14, 16, 6, 12, 14, 8, 6, 6, 19, 10, 1, 11, 19, 5, 1, 6, 17, 1, 3, 6, 18, 1, 1, 4, 14, 10, 3, 4, 15, 10, 1, 6, 0, 12, 12, 6, 4, 12, 4, 5, 7, 4, 2, 5, 7, 2, 1, 7, 8, 2, 1, 17, 5, 3, 2, 18, 5, 1, 2, 8, 13, 6, 3, 8, 14, 6, 1, 8, 13, 5, 3, 8, 14, 5, 1, 13, 2, 1, 18, 13, 11, 1, 9, 6, 10, 9, 2, 9, 10, 3, 2, 11, 0, 7, 4, 11, 2, 7, 2, 1, 0, 6, 8, 3, 0, 2, 8, 9, 15, 3, 3, 9, 16, 3, 1, 9, 17, 9, 3, 9, 18, 9, 1, 12, 12, 3, 3, 12, 13, 3, 1, 4, 1, 3, 5, 5, 1, 1, 5, 10, 14, 2, 3, 10, 15, 2, 1, 18, 17, 2, 2, 18, 17, 1, 1, 19, 18, 1, 1, 18, 18, 2, 2, 18, 18, 1, 1, 19, 19, 1, 1, 18, 18, 2, 2, 18, 18, 1, 1, 19, 19, 1, 1, 4, 10, 9, 1, 7, 10, 3, 1, 3, 9, 6, 5, 5, 9, 2, 5, 18, 8, 1, 12, 18, 14, 1, 6, 0, 2, 8, 6, 0, 2, 4, 3, 4, 5, 4, 3, 9, 4, 3, 3, 9, 5, 3, 1, 3, 18, 2, 2, 3, 18, 1, 1, 4, 19, 1, 1, 6, 4, 4, 3, 6, 5, 4, 1, 16, 7, 4, 2, 16, 7, 2, 1, 18, 8, 2, 1, 5, 17, 1, 3, 5, 18, 1, 1, 2, 0, 15, 20, 2, 10, 15, 10, 8, 11, 6, 4, 8, 11, 3, 2, 11, 13, 3, 2, 8, 16, 4, 3, 8, 17, 4, 1, 8, 18, 2, 2, 8, 18, 1, 1, 9, 19, 1, 1, 2, 16, 13, 3, 2, 17, 13, 1, 16, 16, 2, 2, 16, 16, 1, 1, 17, 17, 1, 1, 8, 1, 6, 3, 10, 1, 2, 3, 16, 7, 2, 2, 16, 7, 1, 1, 17, 8, 1, 1, 14, 7, 4, 2, 14, 7, 2, 1, 16, 8, 2, 1, 4, 0, 14, 1, 11, 0, 7, 1, 10, 4, 8, 2, 10, 4, 4, 1, 14, 5, 4, 1, 8, 2, 3, 2, 9, 2, 1, 2, 12, 11, 6, 3, 12, 12, 6, 1, 1, 5, 1, 4, 1, 7, 1, 2, 1, 1, 1, 18, 1, 7, 1, 6, 11, 13, 3, 2, 11, 14, 3, 1, 0, 1, 12, 2, 0, 1, 6, 1, 6, 2, 6, 1, 10, 18, 2, 2, 10, 18, 1, 1, 11, 19, 1, 1, 4, 5, 4, 4, 4, 5, 2, 2, 6, 7, 2, 2, 6, 7, 1, 3, 6, 8, 1, 1, 14, 10, 6, 2, 16, 10, 2, 2, 16, 8, 3, 6, 17, 8, 1, 6, 4, 10, 6, 2, 6, 10, 2, 2, 6, 5, 3, 7, 7, 5, 1, 7, 0, 13, 6, 6, 0, 16, 6, 3, 12, 5, 1, 9, 12, 8, 1, 3, 5, 9, 3, 3, 6, 9, 1, 3, 7, 5, 6, 13, 9, 5, 2, 13, 19, 8, 1, 10, 19, 13, 1, 5, 11, 18, 6, 1, 13, 18, 2, 1, 9, 7, 6, 12, 11, 7, 2, 12, 12, 7, 6, 6, 14, 7, 2, 6, 15, 8, 3, 4, 16, 8, 1, 4, 6, 11, 4, 2, 6, 12, 4, 1, 1, 6, 6, 8, 3, 6, 2, 8, 11, 15, 6, 5, 13, 15, 2, 5, 15, 17, 4, 2, 15, 18, 4, 1, 13, 11, 6, 1, 15, 11, 2, 1, 5, 18, 2, 2, 5, 18, 1, 1, 6, 19, 1, 1, 4, 8, 4, 4, 4, 8, 2, 2, 6, 10, 2, 2, 11, 7, 9, 3, 11, 8, 9, 1, 0, 3, 10, 4, 0, 3, 5, 2, 5, 5, 5, 2, 7, 18, 6, 1, 9, 18, 2, 1, 0, 8, 3, 3, 0, 9, 3, 1, 0, 0, 6, 8, 0, 0, 3, 4, 3, 4, 3, 4, 7, 6, 3, 8, 8, 6, 1, 8, 13, 7, 7, 3, 13, 8, 7, 1, 3, 3, 2, 2, 3, 4, 2, 1, 0, 3, 3, 3, 0, 4, 3, 1, 9, 3, 5, 2, 9, 4, 5, 1, 6, 5, 9, 4, 9, 5, 3, 4, 3, 10, 12, 3, 7, 10, 4, 3, 8, 7, 3, 6, 9, 7, 1, 6, 5, 5, 6, 5, 8, 5, 3, 5, 0, 5, 2, 3, 0, 6, 2, 1, 9, 7, 3, 4, 10, 7, 1, 4, 1, 0, 6, 15, 3, 0, 2, 15, 15, 1, 3, 5, 16, 1, 1, 5, 9, 2, 3, 10, 10, 2, 1, 10, 8, 8, 6, 12, 10, 8, 2, 12, 16, 4, 3, 4, 16, 6, 3, 2, 16, 7, 2, 2, 16, 7, 1, 1, 17, 8, 1, 1, 13, 0, 6, 9, 13, 3, 6, 3, 7, 17, 1, 3, 7, 18, 1, 1, 12, 1, 4, 2, 12, 2, 4, 1, 17, 3, 1, 3, 17, 4, 1, 1, 0, 16, 9, 3, 0, 17, 9, 1, 3, 6, 2, 4, 3, 6, 1, 2, 4, 8, 1, 2, 13, 18, 3, 1, 14, 18, 1, 1, 0, 18, 4, 2, 2, 18, 2, 2, 1, 19, 2, 1, 2, 19, 1, 1, 0, 18, 4, 2, 0, 19, 4, 1, 2, 17, 1, 3, 2, 18, 1, 1, 4, 8, 3, 5, 5, 8, 1, 5, 2, 1, 6, 7, 4, 1, 2, 7, 3, 6, 2, 8, 3, 6, 1, 4, 4, 10, 1, 4, 4, 5, 11, 10, 4, 10, 11, 5, 0, 13, 20, 2, 10, 13, 10, 2, 1, 13, 16, 3, 9, 13, 8, 3, 16, 4, 4, 4, 16, 4, 2, 2, 18, 6, 2, 2, 16, 0, 4, 12, 16, 0, 2, 6, 18, 6, 2, 6, 14, 15, 3, 1, 15, 15, 1, 1, 3, 4, 12, 10, 3, 9, 12, 5, 9, 18, 2, 2, 9, 18, 1, 1, 10, 19, 1, 1, 9, 18, 2, 2, 9, 18, 1, 1, 10, 19, 1, 1, 13, 4, 2, 14, 13, 4, 1, 7, 14, 11, 1, 7, 4, 2, 6, 4, 7, 2, 3, 4, 0, 0, 18, 20, 0, 0, 9, 10, 9, 10, 9, 10, 15, 11, 1, 2, 15, 12, 1, 1, 16, 10, 2, 4, 16, 10, 1, 2, 17, 12, 1, 2, 18, 17, 2, 2, 18, 17, 1, 1, 19, 18, 1, 1, 9, 17, 1, 2, 9, 18, 1, 1, 8, 4, 9, 6, 11, 4, 3, 6, 6, 9, 9, 10, 9, 9, 3, 10, 5, 0, 5, 4, 5, 2, 5, 2, 5, 7, 11, 4, 5, 9, 11, 2, 2, 4, 2, 14, 3, 4, 1, 14, 8, 6, 3, 5, 9, 6, 1, 5, 8, 4, 3, 9, 9, 4, 1, 9, 0, 8, 20, 6, 0, 10, 20, 2, 14, 16, 6, 1, 17, 16, 3, 1, 17, 18, 2, 2, 17, 19, 2, 1, 8, 17, 6, 3, 10, 17, 2, 3, 4, 1, 9, 15, 7, 1, 3, 15, 11, 5, 3, 12, 12, 5, 1, 12, 0, 15, 4, 3, 0, 16, 4, 1, 0, 0, 15, 1, 5, 0, 5, 1, 6, 0, 6, 4, 8, 0, 2, 4, 2, 0, 9, 3, 5, 0, 3, 3, 13, 6, 3, 7, 14, 6, 1, 7, 7, 6, 4, 2, 7, 7, 4, 1, 6, 18, 6, 1, 8, 18, 2, 1, 18, 6, 2, 2, 18, 7, 2, 1, 6, 4, 7, 3, 6, 5, 7, 1, 12, 7, 3, 1, 13, 7, 1, 1, 15, 1, 2, 10, 15, 1, 1, 5, 16, 6, 1, 5, 0, 18, 2, 2, 0, 19, 2, 1, 19, 4, 1, 8, 19, 8, 1, 4, 1, 17, 1, 3, 1, 18, 1, 1, 0, 15, 6, 4, 0, 15, 3, 2, 3, 17, 3, 2, 19, 0, 1, 18, 19, 6, 1, 6, 10, 2, 6, 2, 12, 2, 2, 2, 2, 8, 12, 2, 6, 8, 4, 2, 16, 0, 4, 1, 18, 0, 2, 1, 8, 4, 2, 6, 8, 7, 2, 3, 14, 5, 2, 10, 15, 5, 1, 10, 13, 4, 2, 2, 13, 5, 2, 1, 11, 1, 3, 6, 11, 3, 3, 2, 6, 9, 12, 2, 10, 9, 4, 2, 9, 16, 4, 2, 9, 17, 4, 1, 5, 14, 15, 4, 5, 16, 15, 2, 18, 16, 2, 2, 18, 17, 2, 1, 16, 18, 2, 2, 16, 18, 1, 1, 17, 19, 1, 1, 6, 4, 3, 8, 7, 4, 1, 8, 5, 9, 3, 1, 6, 9, 1, 1, 0, 8, 1, 6, 0, 10, 1, 2, 11, 2, 9, 6, 14, 2, 3, 6, 12, 2, 6, 4, 14, 2, 2, 4, 1, 7, 2, 4, 1, 9, 2, 2, 13, 1, 6, 4, 13, 3, 6, 2, 4, 10, 2, 10, 4, 10, 1, 5, 5, 15, 1, 5, 2, 16, 9, 3, 5, 16, 3, 3, 1, 2, 3, 9, 2, 2, 1, 9, 19, 7, 1, 4, 19, 9, 1, 2, 14, 11, 6, 8, 14, 11, 3, 4, 17, 15, 3, 4, 15, 12, 4, 6, 15, 12, 2, 3, 17, 15, 2, 3, 16, 15, 2, 2, 16, 15, 1, 1, 17, 16, 1, 1, 17, 16, 2, 2, 17, 16, 1, 1, 18, 17, 1, 1, 17, 16, 2, 2, 17, 16, 1, 1, 18, 17, 1, 1, 2, 3, 2, 2, 2, 3, 1, 1, 3, 4, 1, 1, 10, 10, 3, 3, 11, 10, 1, 3, 5, 9, 7, 8, 5, 13, 7, 4, 7, 16, 2, 2, 7, 16, 1, 1, 8, 17, 1, 1, 7, 16, 2, 2, 7, 16, 1, 1, 8, 17, 1, 1, 9, 8, 10, 3, 14, 8, 5, 3, 6, 7, 4, 8, 6, 7, 2, 4, 8, 11, 2, 4, 1, 6, 4, 3, 1, 7, 4, 1, 6, 10, 6, 10, 8, 10, 2, 10, 4, 6, 3, 6, 5, 6, 1, 6, 3, 10, 4, 4, 3, 10, 2, 2, 5, 12, 2, 2, 3, 10, 4, 4, 3, 10, 2, 2, 5, 12, 2, 2, 3, 10, 4, 4, 3, 10, 2, 2, 5, 12, 2, 2, 14, 8, 2, 6, 15, 8, 1, 6, 3, 10, 4, 4, 3, 10, 2, 2, 5, 12, 2, 2, 3, 10, 4, 4, 3, 10, 2, 2, 5, 12, 2, 2, 12, 4, 3, 9, 13, 4, 1, 9, 12, 3, 1, 12, 12, 7, 1, 4, 2, 0, 18, 1, 8, 0, 6, 1, 10, 0, 10, 6, 10, 0, 5, 3, 15, 3, 5, 3, 18, 16, 2, 2, 18, 17, 2, 1, 3, 5, 4, 2, 3, 5, 2, 1, 5, 6, 2, 1, 11, 8, 3, 3, 12, 8, 1, 3, 11, 7, 3, 5, 12, 7, 1, 5, 3, 19, 15, 1, 8, 19, 5, 1, 8, 13, 3, 2, 8, 14, 3, 1, 2, 12, 8, 4, 2, 12, 4, 2, 6, 14, 4, 2, 16, 16, 2, 2, 16, 16, 1, 1, 17, 17, 1, 1, 7, 0, 3, 2, 8, 0, 1, 2, 6, 7, 2, 5, 7, 7, 1, 5, 18, 0, 2, 17, 19, 0, 1, 17, 16, 16, 1, 3, 16, 17, 1, 1, 14, 8, 3, 7, 15, 8, 1, 7, 10, 17, 2, 2, 10, 17, 1, 1, 11, 18, 1, 1, 4, 9, 1, 3, 4, 10, 1, 1, 18, 10, 2, 3, 18, 11, 2, 1, 12, 1, 3, 10, 13, 1, 1, 10, 8, 12, 9, 1, 11, 12, 3, 1, 5, 18, 2, 2, 5, 18, 1, 1, 6, 19, 1, 1, 19, 6, 1, 9, 19, 9, 1, 3, 4, 7, 2, 4, 4, 7, 1, 2, 5, 9, 1, 2, 1, 4, 6, 14, 3, 4, 2, 14, 10, 5, 9, 3, 13, 5, 3, 3, 18, 7, 2, 6, 18, 9, 2, 2, 5, 6, 2, 7, 6, 6, 1, 7, 10, 4, 6, 8, 13, 4, 3, 8, 0, 8, 2, 9, 0, 11, 2, 3, 0, 7, 5, 3, 0, 8, 5, 1, 8, 1, 7, 2, 8, 2, 7, 1, 7, 5, 3, 5, 8, 5, 1, 5, 19, 2, 1, 2, 19, 3, 1, 1, 6, 7, 10, 11, 11, 7, 5, 11, 9, 19, 6, 1, 11, 19, 2, 1, 3, 0, 12, 1, 7, 0, 4, 1, 4, 1, 6, 5, 6, 1, 2, 5, 6, 12, 12, 6, 10, 12, 4, 6, 16, 13, 2, 3, 16, 14, 2, 1, 7, 14, 4, 2, 7, 15, 4, 1, 7, 14, 2, 2, 7, 15, 2, 1, 3, 10, 2, 4, 3, 10, 1, 2, 4, 12, 1, 2, 0, 3, 2, 6, 0, 5, 2, 2, 1, 10, 2, 2, 1, 10, 1, 1, 2, 11, 1, 1, 16, 4, 4, 3, 16, 5, 4, 1, 5, 10, 2, 4, 5, 10, 1, 2, 6, 12, 1, 2, 5, 11, 13, 2, 5, 12, 13, 1, 10, 2, 3, 11, 11, 2, 1, 11, 10, 2, 4, 4, 10, 4, 4, 2, 8, 8, 6, 2, 10, 8, 2, 2, 11, 2, 3, 3, 12, 2, 1, 3, 6, 18, 14, 2, 6, 18, 7, 1, 13, 19, 7, 1, 17, 7, 1, 12, 17, 11, 1, 4, 10, 5, 10, 3, 10, 6, 10, 1, 6, 1, 3, 3, 7, 1, 1, 3, 13, 8, 3, 1, 14, 8, 1, 1, 10, 14, 2, 6, 10, 16, 2, 2, 4, 1, 12, 14, 8, 1, 4, 14, 14, 1, 6, 14, 16, 1, 2, 14, 3, 16, 2, 2, 3, 16, 1, 1, 4, 17, 1, 1, 0, 16, 2, 2, 0, 17, 2, 1, 15, 6, 4, 6, 15, 6, 2, 3, 17, 9, 2, 3, 12, 5, 2, 2, 12, 6, 2, 1, 7, 6, 6, 13, 9, 6, 2, 13, 1, 9, 6, 5, 3, 9, 2, 5, 0, 5, 3, 4, 0, 7, 3, 2, 4, 1, 16, 2, 4, 1, 8, 1, 12, 2, 8, 1, 1, 18, 4, 2, 1, 18, 2, 1, 3, 19, 2, 1, 7, 7, 3, 4, 8, 7, 1, 4, 3, 4, 9, 3, 6, 4, 3, 3, 4, 6, 6, 10, 6, 6, 2, 10, 9, 0, 8, 10, 13, 0, 4, 10, 8, 0, 8, 1, 12, 0, 4, 1, 6, 2, 8, 16, 6, 2, 4, 8, 10, 10, 4, 8, 14, 10, 2, 10, 14, 10, 1, 5, 15, 15, 1, 5, 12, 11, 1, 2, 12, 12, 1, 1, 16, 0, 3, 8, 17, 0, 1, 8, 14, 0, 6, 10, 17, 0, 3, 10, 16, 0, 3, 5, 17, 0, 1, 5, 4, 5, 11, 2, 4, 6, 11, 1, 1, 0, 2, 1, 2, 0, 1, 1, 0, 0, 2, 3, 0, 1, 2, 1, 11, 6, 6, 11, 13, 6, 2, 11, 14, 0, 3, 1, 15, 0, 1, 1, 19, 7, 1, 2, 19, 8, 1, 1, 17, 0, 3, 9, 18, 0, 1, 9, 12, 7, 3, 4, 13, 7, 1, 4, 0, 1, 14, 2, 0, 1, 7, 1, 7, 2, 7, 1, 3, 1, 3, 2, 4, 1, 1, 2, 4, 0, 15, 2, 9, 0, 5, 2, 10, 2, 6, 1, 12, 2, 2, 1, 9, 4, 6, 11, 11, 4, 2, 11, 2, 16, 2, 4, 2, 18, 2, 2, 6, 17, 6, 3, 8, 17, 2, 3, 7, 9, 6, 2, 9, 9, 2, 2, 6, 8, 9, 2, 9, 8, 3, 2, 6, 6, 2, 10, 6, 6, 1, 5, 7, 11, 1, 5, 0, 11, 2, 3, 0, 12, 2, 1, 11, 15, 4, 1, 13, 15, 2, 1, 6, 17, 1, 2, 6, 18, 1, 1, 0, 0, 6, 20, 2, 0, 2, 20, 3, 10, 2, 2, 4, 10, 1, 2, 4, 7, 3, 5, 5, 7, 1, 5, 3, 12, 6, 2, 5, 12, 2, 2, 6, 15, 7, 4, 6, 17, 7, 2, 17, 16, 2, 2, 17, 16, 1, 1, 18, 17, 1, 1, 15, 1, 3, 16, 16, 1, 1, 16, 6, 16, 6, 3, 8, 16, 2, 3, 15, 14, 3, 2, 15, 15, 3, 1, 12, 16, 1, 2, 12, 17, 1, 1, 0, 2, 4, 4, 0, 2, 2, 2, 2, 4, 2, 2, 1, 1, 6, 4, 1, 1, 3, 2, 4, 3, 3, 2, 1, 18, 1, 2, 1, 19, 1, 1, 4, 7, 2, 3, 4, 8, 2, 1, 1, 0, 9, 14, 1, 7, 9, 7, 4, 9, 2, 6, 4, 9, 1, 3, 5, 12, 1, 3, 3, 9, 4, 3, 5, 9, 2, 3, 0, 9, 2, 4, 0, 11, 2, 2, 16, 6, 3, 10, 17, 6, 1, 10, 16, 11, 2, 1, 17, 11, 1, 1, 5, 7, 4, 4, 5, 9, 4, 2, 10, 11, 9, 2, 13, 11, 3, 2, 15, 10, 2, 2, 15, 10, 1, 1, 16, 11, 1, 1, 10, 6, 6, 14, 10, 13, 6, 7, 14, 7, 3, 5, 15, 7, 1, 5, 6, 11, 12, 3, 10, 11, 4, 3, 17, 16, 1, 2, 17, 17, 1, 1, 8, 5, 5, 4, 8, 7, 5, 2, 11, 6, 4, 2, 11, 7, 4, 1, 3, 4, 8, 2, 3, 4, 4, 1, 7, 5, 4, 1, 0, 8, 6, 6, 2, 8, 2, 6, 7, 4, 6, 2, 7, 5, 6, 1, 7, 3, 6, 3, 9, 3, 2, 3, 2, 17, 3, 3, 2, 18, 3, 1, 3, 10, 6, 1, 5, 10, 2, 1, 7, 2, 6, 2, 9, 2, 2, 2, 4, 11, 9, 1, 7, 11, 3, 1, 7, 7, 11, 12, 7, 13, 11, 6, 3, 2, 3, 4, 4, 2, 1, 4, 9, 7, 9, 3, 12, 7, 3, 3, 15, 11, 2, 6, 15, 11, 1, 3, 16, 14, 1, 3, 0, 5, 5, 3, 0, 6, 5, 1, 8, 1, 6, 12, 10, 1, 2, 12, 3, 7, 15, 13, 8, 7, 5, 13, 0, 9, 9, 9, 0, 12, 9, 3, 16, 0, 3, 8, 17, 0, 1, 8, 16, 2, 4, 2, 18, 2, 2, 2, 13, 0, 6, 5, 16, 0, 3, 5, 15, 1, 3, 2, 16, 1, 1, 2, 11, 8, 3, 2, 12, 8, 1, 2, 1, 8, 2, 12, 1, 8, 1, 6, 2, 14, 1, 6, 0, 1, 6, 12, 2, 1, 2, 12, 19, 17, 1, 3, 19, 18, 1, 1, 11, 3, 3, 10, 12, 3, 1, 10, 8, 1, 9, 8, 11, 1, 3, 8, 18, 16, 2, 2, 18, 16, 1, 1, 19, 17, 1, 1, 18, 16, 2, 2, 18, 16, 1, 1, 19, 17, 1, 1, 6, 13, 2, 6, 6, 15, 2, 2, 9, 14, 2, 2, 9, 15, 2, 1, 14, 10, 2, 4, 14, 10, 1, 2, 15, 12, 1, 2, 0, 15, 2, 2, 0, 15, 1, 1, 1, 16, 1, 1, 6, 7, 2, 2, 6, 7, 1, 1, 7, 8, 1, 1, 11, 18, 2, 2, 11, 18, 1, 1, 12, 19, 1, 1, 0, 0, 6, 4, 0, 0, 3, 2, 3, 2, 3, 2, 4, 1, 6, 6, 6, 1, 2, 6, 15, 13, 5, 4, 15, 15, 5, 2, 7, 17, 6, 1, 9, 17, 2, 1, 16, 19, 4, 1, 18, 19, 2, 1, 16, 16, 4, 4, 18, 16, 2, 4, 7, 8, 9, 4, 10, 8, 3, 4, 16, 18, 2, 2, 16, 18, 1, 1, 17, 19, 1, 1, 2, 9, 2, 4, 2, 9, 1, 2, 3, 11, 1, 2, 0, 3, 8, 4, 0, 3, 4, 2, 4, 5, 4, 2, 0, 1, 8, 1, 4, 1, 4, 1, 0, 5, 8, 9, 4, 5, 4, 9, 7, 18, 6, 2, 9, 18, 2, 2, 0, 4, 1, 12, 0, 8, 1, 4, 19, 13, 1, 6, 19, 15, 1, 2, 2, 8, 6, 8, 4, 8, 2, 8, 0, 0, 9, 17, 3, 0, 3, 17, 7, 9, 6, 8, 9, 9, 2, 8, 5, 10, 9, 4, 8, 10, 3, 4, 5, 0, 8, 3, 5, 1, 8, 1, 16, 6, 4, 4, 16, 6, 2, 2, 18, 8, 2, 2, 17, 4, 2, 8, 17, 4, 1, 4, 18, 8, 1, 4, 2, 16, 1, 3, 2, 17, 1, 1, 2, 16, 1, 3, 2, 17, 1, 1, 11, 0, 1, 3, 11, 1, 1, 1, 11, 2, 9, 7, 14, 2, 3, 7, 10, 2, 3, 6, 11, 2, 1, 6, 5, 9, 15, 2, 5, 10, 15, 1, 8, 16, 6, 2, 8, 17, 6, 1, 9, 16, 10, 2, 9, 16, 5, 1, 14, 17, 5, 1, 9, 17, 2, 2, 9, 17, 1, 1, 10, 18, 1, 1, 10, 15, 6, 4, 10, 15, 3, 2, 13, 17, 3, 2, 4, 5, 15, 12, 9, 5, 5, 12, 11, 13, 2, 3, 11, 14, 2, 1, 8, 13, 7, 3, 8, 14, 7, 1, 1, 12, 1, 2, 1, 13, 1, 1, 16, 18, 2, 2, 16, 18, 1, 1, 17, 19, 1, 1, 1, 19, 18, 1, 7, 19, 6, 1, 1, 17, 6, 1, 4, 17, 3, 1, 1, 3, 1, 12, 1, 9, 1, 6, 0, 9, 3, 6, 0, 11, 3, 2, 5, 4, 3, 10, 6, 4, 1, 10, 6, 17, 2, 1, 7, 17, 1, 1, 1, 0, 6, 12, 3, 0, 2, 12, 4, 7, 9, 2, 7, 7, 3, 2, 6, 11, 9, 1, 9, 11, 3, 1, 17, 10, 2, 10, 17, 15, 2, 5, 4, 10, 2, 10, 4, 10, 1, 5, 5, 15, 1, 5, 12, 3, 3, 12, 13, 3, 1, 12, 15, 3, 4, 6, 15, 3, 2, 3, 17, 6, 2, 3, 12, 8, 3, 3, 13, 8, 1, 3, 4, 14, 2, 4, 4, 16, 2, 2, 6, 16, 1, 3, 6, 17, 1, 1, 1, 1, 2, 3, 2, 1, 1, 3, 0, 2, 4, 1, 2, 2, 2, 1, 8, 17, 12, 3, 12, 17, 4, 3, 9, 16, 6, 4, 11, 16, 2, 4, 4, 6, 3, 6, 4, 9, 3, 3, 6, 2, 12, 9, 6, 5, 12, 3, 6, 0, 14, 20, 6, 0, 7, 10, 13, 10, 7, 10, 15, 16, 2, 2, 15, 16, 1, 1, 16, 17, 1, 1, 15, 16, 2, 2, 15, 16, 1, 1, 16, 17, 1, 1, 19, 8, 1, 3, 19, 9, 1, 1, 13, 4, 1, 2, 13, 5, 1, 1, 0, 4, 4, 2, 0, 5, 4, 1, 19, 5, 1, 6, 19, 7, 1, 2, 16, 0, 2, 1, 17, 0, 1, 1, 13, 1, 1, 3, 13, 2, 1, 1, 17, 17, 1, 3, 17, 18, 1, 1, 5, 4, 8, 8, 5, 4, 4, 4, 9, 8, 4, 4, 1, 2, 2, 2, 1, 2, 1, 1, 2, 3, 1, 1, 0, 0, 8, 6, 0, 0, 4, 3, 4, 3, 4, 3, 6, 3, 4, 2, 6, 4, 4, 1, 1, 0, 3, 3, 1, 1, 3, 1, 6, 1, 7, 2, 6, 2, 7, 1, 2, 6, 12, 6, 6, 6, 4, 6, 1, 16, 9, 2, 4, 16, 3, 2, 7, 15, 6, 4, 9, 15, 2, 4, 6, 15, 12, 1, 12, 15, 6, 1, 17, 17, 1, 3, 17, 18, 1, 1, 17, 15, 2, 2, 17, 15, 1, 1, 18, 16, 1, 1, 3, 13, 3, 3, 3, 14, 3, 1, 10, 17, 1, 3, 10, 18, 1, 1, 4, 0, 14, 8, 11, 0, 7, 8, 2, 0, 12, 2, 6, 0, 4, 2, 2, 0, 4, 3, 4, 0, 2, 3, 13, 1, 1, 2, 13, 2, 1, 1, 7, 5, 3, 6, 8, 5, 1, 6, 18, 2, 2, 2, 18, 2, 1, 1, 19, 3, 1, 1, 15, 1, 2, 14, 16, 1, 1, 14, 15, 6, 2, 2, 15, 6, 1, 1, 16, 7, 1, 1, 3, 1, 6, 3, 5, 1, 2, 3, 7, 16, 2, 2, 7, 16, 1, 1, 8, 17, 1, 1, 5, 17, 2, 2, 5, 17, 1, 1, 6, 18, 1, 1, 9, 10, 6, 10, 11, 10, 2, 10, 10, 17, 6, 3, 12, 17, 2, 3, 14, 5, 2, 10, 14, 10, 2, 5, 11, 12, 6, 2, 11, 13, 6, 1, 8, 1, 1, 3, 8, 2, 1, 1, 12, 15, 2, 2, 12, 15, 1, 1, 13, 16, 1, 1, 6, 8, 6, 4, 6, 8, 3, 2, 9, 10, 3, 2, 7, 5, 3, 5, 8, 5, 1, 5, 0, 5, 7, 3, 0, 6, 7, 1, 7, 9, 6, 6, 9, 9, 2, 6, 5, 7, 8, 8, 5, 11, 8, 4, 4, 9, 2, 6, 4, 9, 1, 3, 5, 12, 1, 3, 10, 11, 6, 1, 12, 11, 2, 1, 13, 6, 6, 11, 15, 6, 2, 11, 8, 17, 2, 2, 8, 17, 1, 1, 9, 18, 1, 1, 4, 12, 12, 1, 8, 12, 4, 1, 11, 17, 3, 2, 11, 18, 3, 1, 8, 17, 6, 1, 10, 17, 2, 1, 4, 1, 14, 6, 4, 3, 14, 2, 14, 2, 2, 12, 14, 8, 2, 6, 12, 13, 3, 2, 12, 14, 3, 1, 6, 1, 6, 1, 8, 1, 2, 1, 10, 6, 6, 1, 12, 6, 2, 1, 3, 19, 2, 1, 4, 19, 1, 1, 18, 16, 2, 2, 18, 16, 1, 1, 19, 17, 1, 1, 16, 11, 3, 7, 17, 11, 1, 7, 19, 5, 1, 6, 19, 8, 1, 3, 9, 8, 4, 3, 9, 9, 4, 1, 16, 8, 4, 4, 16, 8, 2, 2, 18, 10, 2, 2, 2, 8, 2, 2, 2, 8, 1, 1, 3, 9, 1, 1, 3, 5, 6, 4, 3, 5, 3, 2, 6, 7, 3, 2, 2, 3, 8, 16, 2, 3, 4, 8, 6, 11, 4, 8, 17, 17, 1, 3, 17, 18, 1, 1, 7, 2, 8, 11, 11, 2, 4, 11, 13, 3, 6, 14, 16, 3, 3, 14, 0, 9, 18, 2, 6, 9, 6, 2, 6, 10, 14, 3, 6, 11, 14, 1, 10, 9, 9, 3, 13, 9, 3, 3, 3, 5, 4, 6, 3, 5, 2, 3, 5, 8, 2, 3, 3, 7, 3, 7, 4, 7, 1, 7, 2, 8, 11, 6, 2, 10, 11, 2, 8, 9, 6, 3, 8, 10, 6, 1, 3, 3, 3, 11, 4, 3, 1, 11, 0, 19, 6, 1, 3, 19, 3, 1, 18, 18, 1, 2, 18, 19, 1, 1, 8, 0, 12, 6, 8, 0, 6, 3, 14, 3, 6, 3, 19, 5, 1, 3, 19, 6, 1, 1, 5, 8, 2, 1, 6, 8, 1, 1, 13, 11, 2, 1, 14, 11, 1, 1, 3, 6, 15, 13, 8, 6, 5, 13, 4, 3, 6, 2, 6, 3, 2, 2, 0, 18, 1, 2, 0, 19, 1, 1, 7, 8, 2, 6, 8, 8, 1, 6, 3, 0, 6, 19, 5, 0, 2, 19, 3, 1, 6, 5, 5, 1, 2, 5, 17, 14, 3, 6, 17, 16, 3, 2, 17, 13, 2, 6, 18, 13, 1, 6, 17, 18, 2, 2, 18, 18, 1, 2, 11, 14, 9, 4, 14, 14, 3, 4, 15, 8, 4, 6, 15, 8, 2, 3, 17, 11, 2, 3, 1, 16, 1, 3, 1, 17, 1, 1, 7, 0, 3, 14, 8, 0, 1, 14, 12, 0, 2, 1, 13, 0, 1, 1, 7, 9, 6, 5, 10, 9, 3, 5, 15, 5, 4, 9, 17, 5, 2, 9, 11, 0, 6, 6, 13, 0, 2, 6, 16, 15, 2, 2, 16, 15, 1, 1, 17, 16, 1, 1, 16, 15, 2, 2, 16, 15, 1, 1, 17, 16, 1, 1, 13, 2, 2, 18, 13, 11, 2, 9, 8, 4, 8, 10, 8, 9, 8, 5, 8, 3, 2, 3, 8, 4, 2, 1, 11, 1, 6, 9, 11, 4, 6, 3, 15, 4, 5, 6, 15, 6, 5, 2, 12, 18, 2, 2, 12, 18, 1, 1, 13, 19, 1, 1, 1, 17, 1, 3, 1, 18, 1, 1, 12, 19, 2, 1, 13, 19, 1, 1, 8, 10, 6, 6, 10, 10, 2, 6, 14, 2, 6, 5, 16, 2, 2, 5, 9, 5, 2, 6, 9, 7, 2, 2, 1, 15, 2, 2, 2, 15, 1, 2, 18, 17, 1, 3, 18, 18, 1, 1, 10, 14, 4, 6, 10, 16, 4, 2, 9, 7, 3, 2, 10, 7, 1, 2, 6, 9, 6, 2, 6, 9, 3, 1, 9, 10, 3, 1, 0, 2, 1, 12, 0, 6, 1, 4, 4, 0, 15, 1, 9, 0, 5, 1, 9, 0, 8, 2, 9, 0, 4, 1, 13, 1, 4, 1, 12, 2, 8, 1, 16, 2, 4, 1, 7, 1, 10, 6, 7, 3, 10, 2, 18, 6, 2, 3, 18, 7, 2, 1, 4, 12, 2, 2, 4, 12, 1, 1, 5, 13, 1, 1, 6, 6, 6, 2, 8, 6, 2, 2, 0, 9, 9, 6, 3, 9, 3, 6, 17, 18, 2, 2, 18, 18, 1, 2, 11, 2, 6, 16, 13, 2, 2, 16, 2, 4, 15, 13, 7, 4, 5, 13, 16, 2, 3, 10, 17, 2, 1, 10, 6, 10, 2, 1, 7, 10, 1, 1, 1, 1, 18, 16, 10, 1, 9, 16, 14, 4, 3, 15, 15, 4, 1, 15, 19, 13, 1, 2, 19, 14, 1, 1, 2, 6, 5, 8, 2, 10, 5, 4};
+const uint8_t eye_stages[] __attribute__((aligned(4))) = {
+    0x8c, 0xfe, 0x06, 0x00, 0x13, 0x02, 0x3b, 0xff, 0xae, 0x00, 0x02, 0x00, 0x00, 0x08, 0x14, 0x0c,
+    0x00, 0xf0, 0x00, 0x0e, 0x14, 0x06, 0x00, 0x20, 0x43, 0xff, 0x92, 0x00, 0x83, 0xff, 0x02, 0x00,
+    0x09, 0x01, 0x04, 0x0f, 0x00, 0xf0, 0x09, 0x06, 0x04, 0x05, 0x00, 0x30, 0xbe, 0xff, 0x9a, 0x00,
+    0xb0, 0xff, 0x02, 0x00, 0x06, 0x0a, 0x09, 0x02, 0x00, 0xf0, 0x09, 0x0a, 0x03, 0x02, 0x00, 0x30,
+    0x45, 0xff, 0xa4, 0x00, 0xd9, 0xff, 0x02, 0x00, 0x07, 0x00, 0x0a, 0x09, 0x00, 0xf0, 0x07, 0x03,
+    0x0a, 0x03, 0x00, 0x30, 0x24, 0xff, 0x8a, 0x00, 0xcc, 0xff, 0x02, 0x00, 0x0c, 0x02, 0x02, 0x12,
+    0x00, 0xf0, 0x0c, 0x08, 0x02, 0x06, 0x00, 0x30, 0x8b, 0x00, 0xc5, 0xff, 0x7b, 0x00, 0x02, 0x00,
+    0x08, 0x06, 0x08, 0x06, 0x00, 0xf0, 0x08, 0x09, 0x08, 0x03, 0x00, 0x20, 0xbf, 0xfe, 0x0c, 0x00,
+    0x87, 0xfc, 0xb6, 0x00, 0x69, 0xff, 0x02, 0x00, 0x02, 0x00, 0x11, 0x12, 0x00, 0xf0, 0x02, 0x06,
+    0x11, 0x06, 0x00, 0x30, 0x31, 0x00, 0xb8, 0xff, 0x97, 0x00, 0x02, 0x00, 0x0a, 0x0a, 0x01, 0x08,
+    0x00, 0xf0, 0x0a, 0x0e, 0x01, 0x04, 0x00, 0x20, 0xb7, 0xff, 0x88, 0x00, 0xc6, 0xff, 0x02, 0x00,
+    0x07, 0x0a, 0x09, 0x02, 0x00, 0xf0, 0x0a, 0x0a, 0x03, 0x02, 0x00, 0x30, 0x5b, 0x00, 0xd4, 0xff,
+    0xa2, 0x00, 0x02, 0x00, 0x05, 0x01, 0x06, 0x06, 0x00, 0xf0, 0x05, 0x03, 0x06, 0x02, 0x00, 0x30,
+    0x8a, 0xfe, 0x9d, 0x00, 0xd5, 0xff, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x09, 0x00, 0xf0, 0x03, 0x04,
+    0x0f, 0x03, 0x00, 0x30, 0x76, 0x00, 0xe1, 0xff, 0xbe, 0x00, 0x02, 0x00, 0x06, 0x03, 0x09, 0x06,
+    0x00, 0xf0, 0x06, 0x05, 0x09, 0x02, 0x00, 0x30, 0x20, 0x00, 0x2b, 0x00, 0x59, 0xff, 0x02, 0x00,
+    0x08, 0x11, 0x06, 0x03, 0x00, 0xf0, 0x0a, 0x11, 0x02, 0x03, 0x00, 0x30, 0x53, 0x00, 0xe0, 0xff,
+    0xd3, 0x00, 0x02, 0x00, 0x09, 0x0a, 0x09, 0x01, 0x00, 0xf0, 0x0c, 0x0a, 0x03, 0x01, 0x00, 0x30,
+    0xd0, 0xff, 0x62, 0x00, 0xcb, 0xff, 0x02, 0x00, 0x01, 0x07, 0x06, 0x0b, 0x00, 0xf0, 0x03, 0x07,
+    0x02, 0x0b, 0x00, 0x30, 0xfd, 0xff, 0x5d, 0xff, 0x21, 0x00, 0x02, 0x00, 0x09, 0x12, 0x03, 0x01,
+    0x00, 0xf0, 0x0a, 0x12, 0x01, 0x01, 0x00, 0x30, 0x00, 0x00, 0xa8, 0xff, 0x3a, 0x00, 0x02, 0x00,
+    0x10, 0x10, 0x01, 0x02, 0x00, 0xf0, 0x10, 0x11, 0x01, 0x01, 0x00, 0x20, 0xdf, 0xff, 0x5e, 0xff,
+    0x21, 0x00, 0x02, 0x00, 0x09, 0x11, 0x06, 0x03, 0x00, 0xf0, 0x0b, 0x11, 0x02, 0x03, 0x00, 0x30,
+    0xa1, 0xfe, 0x09, 0x00, 0x1d, 0xfe, 0xad, 0x00, 0x80, 0xff, 0x02, 0x00, 0x08, 0x00, 0x05, 0x12,
+    0x00, 0xf0, 0x08, 0x06, 0x05, 0x06, 0x00, 0x30, 0x74, 0xff, 0xab, 0x00, 0xa5, 0xff, 0x02, 0x00,
+    0x06, 0x07, 0x09, 0x07, 0x00, 0xf0, 0x09, 0x07, 0x03, 0x07, 0x00, 0x30, 0xa8, 0xff, 0xb8, 0x00,
+    0xd2, 0xff, 0x02, 0x00, 0x0e, 0x06, 0x06, 0x0a, 0x00, 0xf0, 0x10, 0x06, 0x02, 0x0a, 0x00, 0x30,
+    0xa7, 0xff, 0xaa, 0x00, 0xba, 0xff, 0x02, 0x00, 0x09, 0x08, 0x09, 0x05, 0x00, 0xf0, 0x0c, 0x08,
+    0x03, 0x05, 0x00, 0x30, 0x8b, 0xff, 0xb3, 0x00, 0xce, 0xff, 0x02, 0x00, 0x03, 0x07, 0x09, 0x06,
+    0x00, 0xf0, 0x06, 0x07, 0x03, 0x06, 0x00, 0x30, 0xd2, 0xff, 0x97, 0x00, 0xc8, 0xff, 0x02, 0x00,
+    0x01, 0x07, 0x06, 0x06, 0x00, 0xf0, 0x03, 0x07, 0x02, 0x06, 0x00, 0x30, 0xa4, 0xff, 0x58, 0x00,
+    0x9e, 0xff, 0x02, 0x00, 0x10, 0x00, 0x04, 0x12, 0x00, 0xf0, 0x10, 0x06, 0x04, 0x06, 0x00, 0x30,
+    0xf9, 0xff, 0x35, 0xff, 0x28, 0x00, 0x02, 0x00, 0x00, 0x11, 0x03, 0x03, 0x00, 0xf0, 0x00, 0x12,
+    0x03, 0x01, 0x00, 0x30, 0x00, 0x00, 0xb1, 0xff, 0x5a, 0x00, 0x02, 0x00, 0x10, 0x00, 0x02, 0x01,
+    0x00, 0xf0, 0x11, 0x00, 0x01, 0x01, 0x00, 0x20, 0xb7, 0xfe, 0x10, 0x00, 0x2e, 0x03, 0x79, 0xff,
+    0x5a, 0x00, 0x02, 0x00, 0x00, 0x08, 0x14, 0x0c, 0x00, 0xf0, 0x00, 0x0e, 0x14, 0x06, 0x00, 0x20,
+    0x6d, 0xff, 0x6b, 0x00, 0x9c, 0xff, 0x02, 0x00, 0x06, 0x06, 0x09, 0x08, 0x00, 0xf0, 0x09, 0x06,
+    0x03, 0x08, 0x00, 0x30, 0xc3, 0xfe, 0x7a, 0x00, 0xc0, 0xff, 0x02, 0x00, 0x05, 0x03, 0x0c, 0x09,
+    0x00, 0xf0, 0x05, 0x06, 0x0c, 0x03, 0x00, 0x30, 0x00, 0x00, 0x9e, 0xff, 0x51, 0x00, 0x02, 0x00,
+    0x04, 0x10, 0x01, 0x02, 0x00, 0xf0, 0x04, 0x11, 0x01, 0x01, 0x00, 0x20, 0x01, 0x00, 0xbd, 0xff,
+    0x53, 0x00, 0x02, 0x00, 0x12, 0x0a, 0x02, 0x01, 0x00, 0xf0, 0x13, 0x0a, 0x01, 0x01, 0x00, 0x20,
+    0xb4, 0xff, 0x77, 0x00, 0xda, 0xff, 0x02, 0x00, 0x09, 0x08, 0x06, 0x05, 0x00, 0xf0, 0x0b, 0x08,
+    0x02, 0x05, 0x00, 0x30, 0x00, 0x00, 0x4b, 0x00, 0xc0, 0xff, 0x02, 0x00, 0x00, 0x00, 0x02, 0x01,
+    0x00, 0xf0, 0x01, 0x00, 0x01, 0x01, 0x00, 0x20, 0xb5, 0xff, 0x76, 0x00, 0xdf, 0xff, 0x02, 0x00,
+    0x06, 0x08, 0x06, 0x06, 0x00, 0xf0, 0x08, 0x08, 0x02, 0x06, 0x00, 0x30, 0xcb, 0xff, 0x6a, 0x00,
+    0xd3, 0xff, 0x02, 0x00, 0x0b, 0x07, 0x06, 0x07, 0x00, 0xf0, 0x0d, 0x07, 0x02, 0x07, 0x00, 0x30,
+    0x00, 0x00, 0xb9, 0xff, 0x44, 0x00, 0x02, 0x00, 0x13, 0x0e, 0x01, 0x02, 0x00, 0xf0, 0x13, 0x0f,
+    0x01, 0x01, 0x00, 0x20, 0x00, 0x00, 0xbb, 0xff, 0x3d, 0x00, 0x02, 0x00, 0x06, 0x11, 0x01, 0x02,
+    0x00, 0xf0, 0x06, 0x12, 0x01, 0x01, 0x00, 0x20, 0xf3, 0xff, 0x71, 0x00, 0xdc, 0xff, 0x02, 0x00,
+    0x0e, 0x07, 0x02, 0x07, 0x00, 0xf0, 0x0f, 0x07, 0x01, 0x07, 0x00, 0x20, 0x07, 0x00, 0xd7, 0xff,
+    0x6d, 0x00, 0x02, 0x00, 0x06, 0x08, 0x02, 0x04, 0x00, 0xf0, 0x07, 0x08, 0x01, 0x04, 0x00, 0x20,
+    0x99, 0xff, 0x68, 0x00, 0xd2, 0xff, 0x02, 0x00, 0x05, 0x08, 0x0c, 0x06, 0x00, 0xf0, 0x05, 0x0a,
+    0x0c, 0x02, 0x00, 0x30, 0x05, 0x00, 0x15, 0x00, 0x34, 0xff, 0x02, 0x00, 0x02, 0x11, 0x01, 0x03,
+    0x00, 0xf0, 0x02, 0x12, 0x01, 0x01, 0x00, 0x30, 0xe2, 0xff, 0x8e, 0x00, 0xe2, 0xff, 0x02, 0x00,
+    0x06, 0x07, 0x03, 0x06, 0x00, 0xf0, 0x07, 0x07, 0x01, 0x06, 0x00, 0x30, 0xc9, 0xfe, 0x17, 0x00,
+    0x86, 0xff, 0x5b, 0x00, 0x9e, 0xff, 0x02, 0x00, 0x06, 0x07, 0x09, 0x0c, 0x00, 0xf0, 0x09, 0x07,
+    0x03, 0x0c, 0x00, 0x30, 0xfe, 0xfd, 0x64, 0x00, 0xb4, 0xff, 0x02, 0x00, 0x06, 0x02, 0x0b, 0x0c,
+    0x00, 0xf0, 0x06, 0x06, 0x0b, 0x04, 0x00, 0x30, 0x15, 0x00, 0x90, 0xff, 0x31, 0x00, 0x02, 0x00,
+    0x01, 0x0c, 0x05, 0x08, 0x00, 0xf0, 0x01, 0x10, 0x05, 0x04, 0x00, 0x20, 0xdf, 0xff, 0x66, 0x00,
+    0xc5, 0xff, 0x02, 0x00, 0x0e, 0x07, 0x06, 0x07, 0x00, 0xf0, 0x10, 0x07, 0x02, 0x07, 0x00, 0x30,
+    0xbd, 0xff, 0x6b, 0x00, 0xc6, 0xff, 0x02, 0x00, 0x0a, 0x08, 0x06, 0x06, 0x00, 0xf0, 0x0c, 0x08,
+    0x02, 0x06, 0x00, 0x30, 0xf8, 0xff, 0x43, 0xff, 0x20, 0x00, 0x02, 0x00, 0x10, 0x12, 0x04, 0x02,
+    0x00, 0xf0, 0x10, 0x13, 0x04, 0x01, 0x00, 0x20, 0xfa, 0xff, 0x3e, 0xff, 0x16, 0x00, 0x02, 0x00,
+    0x12, 0x11, 0x02, 0x03, 0x00, 0xf0, 0x12, 0x12, 0x02, 0x01, 0x00, 0x30, 0xec, 0xff, 0x6b, 0x00,
+    0xd3, 0xff, 0x02, 0x00, 0x09, 0x07, 0x03, 0x07, 0x00, 0xf0, 0x0a, 0x07, 0x01, 0x07, 0x00, 0x30,
+    0xb2, 0xff, 0x78, 0x00, 0xdc, 0xff, 0x02, 0x00, 0x05, 0x06, 0x06, 0x08, 0x00, 0xf0, 0x07, 0x06,
+    0x02, 0x08, 0x00, 0x30, 0xce, 0xff, 0x54, 0x00, 0xc9, 0xff, 0x02, 0x00, 0x02, 0x06, 0x06, 0x0b,
+    0x00, 0xf0, 0x04, 0x06, 0x02, 0x0b, 0x00, 0x30, 0xeb, 0x00, 0xa2, 0xff, 0x3e, 0x00, 0x02, 0x00,
+    0x08, 0x0a, 0x0c, 0x08, 0x00, 0xf0, 0x08, 0x0e, 0x0c, 0x04, 0x00, 0x20, 0xd9, 0xff, 0x48, 0xff,
+    0x10, 0x00, 0x02, 0x00, 0x07, 0x11, 0x06, 0x03, 0x00, 0xf0, 0x09, 0x11, 0x02, 0x03, 0x00, 0x30,
+    0xf4, 0xff, 0x5b, 0x00, 0xd6, 0xff, 0x02, 0x00, 0x0a, 0x09, 0x03, 0x03, 0x00, 0xf0, 0x0b, 0x09,
+    0x01, 0x03, 0x00, 0x30, 0xef, 0xff, 0x64, 0x00, 0xe2, 0xff, 0x02, 0x00, 0x08, 0x08, 0x03, 0x06,
+    0x00, 0xf0, 0x09, 0x08, 0x01, 0x06, 0x00, 0x30, 0xc9, 0xff, 0x6a, 0xff, 0x16, 0x00, 0x02, 0x00,
+    0x07, 0x00, 0x06, 0x05, 0x00, 0xf0, 0x09, 0x00, 0x02, 0x05, 0x00, 0x30, 0x00, 0x00, 0xbd, 0xff,
+    0x36, 0x00, 0x02, 0x00, 0x06, 0x11, 0x01, 0x03, 0x00, 0xf0, 0x06, 0x12, 0x01, 0x01, 0x00, 0x30,
+    0xf6, 0xff, 0x38, 0xff, 0x14, 0x00, 0x02, 0x00, 0x00, 0x12, 0x04, 0x02, 0x00, 0xf0, 0x00, 0x13,
+    0x04, 0x01, 0x00, 0x20, 0xdf, 0xfe, 0x6a, 0x00, 0xdd, 0xff, 0x02, 0x00, 0x04, 0x01, 0x0b, 0x09,
+    0x00, 0xf0, 0x04, 0x04, 0x0b, 0x03, 0x00, 0x30, 0x79, 0x01, 0xdf, 0xff, 0x81, 0x00, 0x02, 0x00,
+    0x03, 0x01, 0x0e, 0x09, 0x00, 0xf0, 0x03, 0x04, 0x0e, 0x03, 0x00, 0x30, 0xdc, 0xff, 0x5d, 0x00,
+    0xdd, 0xff, 0x02, 0x00, 0x00, 0x09, 0x06, 0x04, 0x00, 0xf0, 0x02, 0x09, 0x02, 0x04, 0x00, 0x30,
+    0x00, 0x00, 0xb4, 0xff, 0x34, 0x00, 0x02, 0x00, 0x12, 0x0d, 0x01, 0x02, 0x00, 0xf0, 0x12, 0x0e,
+    0x01, 0x01, 0x00, 0x20, 0xf4, 0xff, 0x5b, 0x00, 0xd9, 0xff, 0x02, 0x00, 0x0d, 0x05, 0x03, 0x0b,
+    0x00, 0xf0, 0x0e, 0x05, 0x01, 0x0b, 0x00, 0x30, 0xf6, 0xff, 0x75, 0xff, 0x1a, 0x00, 0x03, 0x00,
+    0x00, 0x12, 0x08, 0x02, 0x00, 0xf0, 0x00, 0x12, 0x04, 0x01, 0x00, 0x20, 0x04, 0x13, 0x04, 0x01,
+    0x00, 0x20, 0xb6, 0xfe, 0x1b, 0x00, 0x3c, 0xff, 0x6a, 0x00, 0xa9, 0xff, 0x02, 0x00, 0x05, 0x08,
+    0x0c, 0x05, 0x00, 0xf0, 0x09, 0x08, 0x04, 0x05, 0x00, 0x30, 0x65, 0x01, 0x9d, 0xff, 0x3d, 0x00,
+    0x02, 0x00, 0x04, 0x07, 0x0b, 0x0a, 0x00, 0xf0, 0x04, 0x0c, 0x0b, 0x05, 0x00, 0x20, 0xbb, 0xff,
+    0x87, 0x00, 0xd4, 0xff, 0x02, 0x00, 0x0e, 0x09, 0x06, 0x04, 0x00, 0xf0, 0x10, 0x09, 0x02, 0x04,
+    0x00, 0x30, 0x8a, 0xff, 0x5b, 0x00, 0xc7, 0xff, 0x02, 0x00, 0x00, 0x07, 0x06, 0x08, 0x00, 0xf0,
+    0x03, 0x07, 0x03, 0x08, 0x00, 0x20, 0x0a, 0x00, 0x26, 0x00, 0x59, 0xff, 0x02, 0x00, 0x00, 0x10,
+    0x03, 0x03, 0x00, 0xf0, 0x00, 0x11, 0x03, 0x01, 0x00, 0x30, 0x9e, 0xff, 0x8f, 0x00, 0xdb, 0xff,
+    0x02, 0x00, 0x07, 0x0b, 0x0c, 0x01, 0x00, 0xf0, 0x0b, 0x0b, 0x04, 0x01, 0x00, 0x30, 0x7a, 0xff,
+    0x76, 0x00, 0xe5, 0xff, 0x02, 0x00, 0x04, 0x08, 0x09, 0x04, 0x00, 0xf0, 0x07, 0x08, 0x03, 0x04,
+    0x00, 0x30, 0xc2, 0xff, 0x43, 0xff, 0x0e, 0x00, 0x02, 0x00, 0x05, 0x10, 0x06, 0x04, 0x00, 0xf0,
+    0x07, 0x10, 0x02, 0x04, 0x00, 0x30, 0xff, 0xff, 0x8c, 0xff, 0x18, 0x00, 0x02, 0x00, 0x12, 0x11,
+    0x01, 0x03, 0x00, 0xf0, 0x12, 0x12, 0x01, 0x01, 0x00, 0x30, 0x03, 0x00, 0x18, 0x00, 0x74, 0xff,
+    0x02, 0x00, 0x12, 0x11, 0x01, 0x03, 0x00, 0xf0, 0x12, 0x12, 0x01, 0x01, 0x00, 0x30, 0xd5, 0xff,
+    0x68, 0x00, 0xe1, 0xff, 0x03, 0x00, 0x04, 0x09, 0x04, 0x0a, 0x00, 0xf0, 0x04, 0x09, 0x02, 0x05,
+    0x00, 0x20, 0x06, 0x0e, 0x02, 0x05, 0x00, 0x20, 0xe2, 0xff, 0x67, 0x00, 0xd7, 0xff, 0x02, 0x00,
+    0x04, 0x08, 0x06, 0x04, 0x00, 0xf0, 0x06, 0x08, 0x02, 0x04, 0x00, 0x30, 0x4b, 0xfe, 0x9e, 0x00,
+    0xee, 0xff, 0x02, 0x00, 0x0a, 0x02, 0x02, 0x12, 0x00, 0xf0, 0x0a, 0x08, 0x02, 0x06, 0x00, 0x30,
+    0x42, 0x00, 0xdf, 0xff, 0x5f, 0x00, 0x03, 0x00, 0x00, 0x05, 0x08, 0x06, 0x00, 0xf0, 0x00, 0x05,
+    0x04, 0x03, 0x00, 0x20, 0x04, 0x08, 0x04, 0x03, 0x00, 0x20, 0xac, 0xff, 0x4a, 0xff, 0x0d, 0x00,
+    0x02, 0x00, 0x06, 0x00, 0x06, 0x05, 0x00, 0xf0, 0x08, 0x00, 0x02, 0x05, 0x00, 0x30, 0x45, 0x00,
+    0x20, 0x00, 0xb1, 0xff, 0x02, 0x00, 0x12, 0x00, 0x02, 0x0e, 0x00, 0xf0, 0x12, 0x07, 0x02, 0x07,
+    0x00, 0x20, 0xe9, 0xff, 0x65, 0xff, 0x14, 0x00, 0x02, 0x00, 0x08, 0x12, 0x04, 0x02, 0x00, 0xf0,
+    0x0a, 0x12, 0x02, 0x02, 0x00, 0x20, 0x00, 0x00, 0xbc, 0xff, 0x25, 0x00, 0x02, 0x00, 0x01, 0x11,
+    0x06, 0x03, 0x00, 0xf0, 0x01, 0x12, 0x06, 0x01, 0x00, 0x30, 0x20, 0x00, 0xec, 0xff, 0x91, 0x00,
+    0x02, 0x00, 0x0b, 0x08, 0x03, 0x05, 0x00, 0xf0, 0x0c, 0x08, 0x01, 0x05, 0x00, 0x30, 0xf6, 0xff,
+    0x5e, 0x00, 0xde, 0xff, 0x02, 0x00, 0x0b, 0x08, 0x03, 0x04, 0x00, 0xf0, 0x0c, 0x08, 0x01, 0x04,
+    0x00, 0x30, 0xa5, 0xff, 0x51, 0xff, 0x0d, 0x00, 0x02, 0x00, 0x0b, 0x00, 0x06, 0x05, 0x00, 0xf0,
+    0x0d, 0x00, 0x02, 0x05, 0x00, 0x30, 0xe1, 0xff, 0x3c, 0x00, 0xd3, 0xff, 0x02, 0x00, 0x01, 0x07,
+    0x06, 0x07, 0x00, 0xf0, 0x03, 0x07, 0x02, 0x07, 0x00, 0x30, 0xfc, 0xff, 0x67, 0xff, 0x13, 0x00,
+    0x02, 0x00, 0x00, 0x0d, 0x01, 0x03, 0x00, 0xf0, 0x00, 0x0e, 0x01, 0x01, 0x00, 0x30, 0x4e, 0x00,
+    0xd8, 0xff, 0x4c, 0x00, 0x02, 0x00, 0x03, 0x02, 0x09, 0x06, 0x00, 0xf0, 0x03, 0x04, 0x09, 0x02,
+    0x00, 0x30, 0x17, 0x00, 0xe7, 0xff, 0x6b, 0x00, 0x02, 0x00, 0x08, 0x06, 0x09, 0x02, 0x00, 0xf0,
+    0x08, 0x07, 0x09, 0x01, 0x00, 0x20, 0xd9, 0xff, 0x65, 0xff, 0x12, 0x00, 0x02, 0x00, 0x00, 0x0e,
+    0x03, 0x06, 0x00, 0xf0, 0x00, 0x10, 0x03, 0x02, 0x00, 0x30, 0x2d, 0x00, 0xe6, 0xff, 0x6b, 0x00,
+    0x02, 0x00, 0x01, 0x0b, 0x06, 0x04, 0x00, 0xf0, 0x03, 0x0b, 0x02, 0x04, 0x00, 0x30, 0xd8, 0xfe,
+    0x1c, 0x00, 0xb9, 0xff, 0x50, 0x00, 0xaa, 0xff, 0x02, 0x00, 0x06, 0x09, 0x09, 0x03, 0x00, 0xf0,
+    0x09, 0x09, 0x03, 0x03, 0x00, 0x30, 0x7d, 0x00, 0xd0, 0xff, 0x89, 0x00, 0x02, 0x00, 0x06, 0x00,
+    0x09, 0x06, 0x00, 0xf0, 0x06, 0x02, 0x09, 0x02, 0x00, 0x30, 0xa6, 0xff, 0x5d, 0x00, 0xd7, 0xff,
+    0x02, 0x00, 0x08, 0x05, 0x06, 0x06, 0x00, 0xf0, 0x08, 0x07, 0x06, 0x02, 0x00, 0x30, 0x00, 0x00,
+    0x36, 0x00, 0xb8, 0xff, 0x02, 0x00, 0x01, 0x0c, 0x02, 0x01, 0x00, 0xf0, 0x02, 0x0c, 0x01, 0x01,
+    0x00, 0x20, 0xe4, 0xff, 0x65, 0x00, 0xdf, 0xff, 0x02, 0x00, 0x0a, 0x0a, 0x06, 0x02, 0x00, 0xf0,
+    0x0c, 0x0a, 0x02, 0x02, 0x00, 0x30, 0xe4, 0xff, 0x4d, 0x00, 0xcc, 0xff, 0x02, 0x00, 0x0d, 0x08,
+    0x06, 0x06, 0x00, 0xf0, 0x0f, 0x08, 0x02, 0x06, 0x00, 0x30, 0xc7, 0xff, 0x3d, 0xff, 0x19, 0x00,
+    0x02, 0x00, 0x06, 0x10, 0x06, 0x04, 0x00, 0xf0, 0x08, 0x10, 0x02, 0x04, 0x00, 0x30, 0x3c, 0xff,
+    0x7b, 0x00, 0xdf, 0xff, 0x02, 0x00, 0x08, 0x00, 0x09, 0x09, 0x00, 0xf0, 0x08, 0x03, 0x09, 0x03,
+    0x00, 0x30, 0x00, 0x00, 0xc0, 0xff, 0x3e, 0x00, 0x02, 0x00, 0x12, 0x11, 0x01, 0x03, 0x00, 0xf0,
+    0x12, 0x12, 0x01, 0x01, 0x00, 0x30, 0x04, 0x00, 0x11, 0x00, 0x58, 0xff, 0x02, 0x00, 0x12, 0x11,
+    0x01, 0x03, 0x00, 0xf0, 0x12, 0x12, 0x01, 0x01, 0x00, 0x30, 0xf6, 0xff, 0x6d, 0x00, 0xdf, 0xff,
+    0x02, 0x00, 0x07, 0x0a, 0x03, 0x03, 0x00, 0xf0, 0x08, 0x0a, 0x01, 0x03, 0x00, 0x30, 0x00, 0x00,
+    0xcf, 0xff, 0x4a, 0x00, 0x03, 0x00, 0x09, 0x0e, 0x02, 0x02, 0x00, 0xf0, 0x09, 0x0e, 0x01, 0x01,
+    0x00, 0x20, 0x0a, 0x0f, 0x01, 0x01, 0x00, 0x20, 0x00, 0x00, 0x4d, 0x00, 0xce, 0xff, 0x03, 0x00,
+    0x09, 0x0e, 0x02, 0x02, 0x00, 0xf0, 0x09, 0x0e, 0x01, 0x01, 0x00, 0x20, 0x0a, 0x0f, 0x01, 0x01,
+    0x00, 0x20, 0x34, 0x04, 0xc5, 0xff, 0x3c, 0x00, 0x02, 0x00, 0x00, 0x08, 0x13, 0x0c, 0x00, 0xf0,
+    0x00, 0x0e, 0x13, 0x06, 0x00, 0x20, 0xa0, 0xff, 0x31, 0x00, 0xb8, 0xff, 0x02, 0x00, 0x07, 0x06,
+    0x09, 0x0e, 0x00, 0xf0, 0x0a, 0x06, 0x03, 0x0e, 0x00, 0x30, 0xf0, 0xff, 0x8d, 0x00, 0xe8, 0xff,
+    0x02, 0x00, 0x0d, 0x08, 0x03, 0x04, 0x00, 0xf0, 0x0e, 0x08, 0x01, 0x04, 0x00, 0x30, 0x00, 0x00,
+    0xc3, 0xff, 0x37, 0x00, 0x02, 0x00, 0x04, 0x11, 0x01, 0x03, 0x00, 0xf0, 0x04, 0x12, 0x01, 0x01,
+    0x00, 0x30, 0xe0, 0xff, 0x68, 0x00, 0xe0, 0xff, 0x02, 0x00, 0x04, 0x09, 0x06, 0x03, 0x00, 0xf0,
+    0x06, 0x09, 0x02, 0x03, 0x00, 0x30, 0xfa, 0xff, 0x6d, 0xff, 0x18, 0x00, 0x02, 0x00, 0x02, 0x12,
+    0x05, 0x02, 0x00, 0xf0, 0x02, 0x13, 0x05, 0x01, 0x00, 0x20, 0xff, 0xff, 0x4a, 0x00, 0xd5, 0xff,
+    0x03, 0x00, 0x07, 0x08, 0x02, 0x02, 0x00, 0xf0, 0x07, 0x08, 0x01, 0x01, 0x00, 0x20, 0x08, 0x09,
+    0x01, 0x01, 0x00, 0x20, 0x00, 0x00, 0xce, 0xff, 0x46, 0x00, 0x03, 0x00, 0x07, 0x08, 0x02, 0x02,
+    0x00, 0xf0, 0x07, 0x08, 0x01, 0x01, 0x00, 0x20, 0x08, 0x09, 0x01, 0x01, 0x00, 0x20, 0x35, 0x00,
+    0xe8, 0xff, 0x67, 0x00, 0x02, 0x00, 0x05, 0x0a, 0x0d, 0x02, 0x00, 0xf0, 0x05, 0x0b, 0x0d, 0x01,
+    0x00, 0x20, 0xcb, 0xff, 0x78, 0x00, 0xea, 0xff, 0x02, 0x00, 0x0a, 0x08, 0x01, 0x09, 0x00, 0xf0,
+    0x0a, 0x0b, 0x01, 0x03, 0x00, 0x30, 0x0c, 0x00, 0xde, 0xff, 0x4e, 0x00, 0x03, 0x00, 0x0f, 0x08,
+    0x02, 0x0c, 0x00, 0xf0, 0x0f, 0x08, 0x01, 0x06, 0x00, 0x20, 0x10, 0x0e, 0x01, 0x06, 0x00, 0x20,
+    0xe8, 0xff, 0x39, 0xff, 0x0e, 0x00, 0x02, 0x00, 0x04, 0x00, 0x03, 0x05, 0x00, 0xf0, 0x05, 0x00,
+    0x01, 0x05, 0x00, 0x30, 0xf7, 0xff, 0x4f, 0x00, 0xda, 0xff, 0x02, 0x00, 0x0c, 0x06, 0x03, 0x07,
+    0x00, 0xf0, 0x0d, 0x06, 0x01, 0x07, 0x00, 0x30, 0x40, 0x00, 0x10, 0x00, 0x47, 0xff, 0x02, 0x00,
+    0x07, 0x10, 0x06, 0x04, 0x00, 0xf0, 0x09, 0x10, 0x02, 0x04, 0x00, 0x30, 0x00, 0x00, 0xd3, 0xff,
+    0x3b, 0x00, 0x02, 0x00, 0x09, 0x10, 0x02, 0x01, 0x00, 0xf0, 0x0a, 0x10, 0x01, 0x01, 0x00, 0x20,
+    0xc7, 0xfe, 0x24, 0x00, 0x8e, 0xff, 0x74, 0x00, 0xd2, 0xff, 0x02, 0x00, 0x06, 0x0a, 0x09, 0x02,
+    0x00, 0xf0, 0x09, 0x0a, 0x03, 0x02, 0x00, 0x30, 0x10, 0x02, 0x7a, 0xff, 0x29, 0x00, 0x02, 0x00,
+    0x00, 0x06, 0x0f, 0x0e, 0x00, 0xf0, 0x00, 0x0d, 0x0f, 0x07, 0x00, 0x20, 0x63, 0x00, 0xda, 0xff,
+    0x6c, 0x00, 0x02, 0x00, 0x09, 0x01, 0x05, 0x06, 0x00, 0xf0, 0x09, 0x03, 0x05, 0x02, 0x00, 0x30,
+    0xf6, 0xff, 0x54, 0x00, 0xd4, 0xff, 0x02, 0x00, 0x03, 0x09, 0x03, 0x04, 0x00, 0xf0, 0x04, 0x09,
+    0x01, 0x04, 0x00, 0x30, 0xf2, 0xff, 0x79, 0x00, 0xee, 0xff, 0x02, 0x00, 0x05, 0x07, 0x03, 0x06,
+    0x00, 0xf0, 0x06, 0x07, 0x01, 0x06, 0x00, 0x30, 0x00, 0x00, 0xb3, 0xff, 0x28, 0x00, 0x02, 0x00,
+    0x11, 0x10, 0x01, 0x02, 0x00, 0xf0, 0x11, 0x11, 0x01, 0x01, 0x00, 0x20, 0xbe, 0xff, 0x3a, 0x00,
+    0xcc, 0xff, 0x02, 0x00, 0x09, 0x08, 0x06, 0x0c, 0x00, 0xf0, 0x0b, 0x08, 0x02, 0x0c, 0x00, 0x30,
+    0xee, 0xff, 0x67, 0x00, 0xde, 0xff, 0x02, 0x00, 0x06, 0x0a, 0x06, 0x01, 0x00, 0xf0, 0x08, 0x0a,
+    0x02, 0x01, 0x00, 0x30, 0xa7, 0xff, 0x51, 0xff, 0x14, 0x00, 0x02, 0x00, 0x07, 0x11, 0x09, 0x03,
+    0x00, 0xf0, 0x0a, 0x11, 0x03, 0x03, 0x00, 0x30, 0xf5, 0xff, 0x4e, 0xff, 0x0c, 0x00, 0x02, 0x00,
+    0x0e, 0x12, 0x06, 0x02, 0x00, 0xf0, 0x0e, 0x13, 0x06, 0x01, 0x00, 0x20, 0xee, 0xff, 0x40, 0x00,
+    0xd7, 0xff, 0x02, 0x00, 0x09, 0x05, 0x03, 0x0e, 0x00, 0xf0, 0x0a, 0x05, 0x01, 0x0e, 0x00, 0x30,
+    0x74, 0x00, 0x0f, 0x00, 0x56, 0xff, 0x02, 0x00, 0x08, 0x10, 0x09, 0x04, 0x00, 0xf0, 0x0b, 0x10,
+    0x03, 0x04, 0x00, 0x30, 0x54, 0x01, 0x10, 0x00, 0x77, 0xff, 0x02, 0x00, 0x00, 0x00, 0x04, 0x0e,
+    0x00, 0xf0, 0x00, 0x07, 0x04, 0x07, 0x00, 0x20, 0xce, 0xff, 0x4b, 0xff, 0x0e, 0x00, 0x02, 0x00,
+    0x08, 0x01, 0x06, 0x03, 0x00, 0xf0, 0x0a, 0x01, 0x02, 0x03, 0x00, 0x30, 0xed, 0xff, 0x83, 0x00,
+    0xea, 0xff, 0x02, 0x00, 0x06, 0x08, 0x03, 0x04, 0x00, 0xf0, 0x07, 0x08, 0x01, 0x04, 0x00, 0x30,
+    0xfd, 0xff, 0x44, 0x00, 0xd3, 0xff, 0x02, 0x00, 0x04, 0x08, 0x03, 0x04, 0x00, 0xf0, 0x05, 0x08,
+    0x01, 0x04, 0x00, 0x30, 0xb0, 0xff, 0x54, 0xff, 0x12, 0x00, 0x02, 0x00, 0x05, 0x01, 0x06, 0x05,
+    0x00, 0xf0, 0x07, 0x01, 0x02, 0x05, 0x00, 0x30, 0x04, 0x00, 0x0d, 0x00, 0x72, 0xff, 0x02, 0x00,
+    0x01, 0x12, 0x01, 0x02, 0x00, 0xf0, 0x01, 0x13, 0x01, 0x01, 0x00, 0x20, 0x96, 0xff, 0x90, 0x00,
+    0xee, 0xff, 0x02, 0x00, 0x07, 0x00, 0x06, 0x06, 0x00, 0xf0, 0x07, 0x02, 0x06, 0x02, 0x00, 0x30,
+    0xfb, 0xff, 0x80, 0xff, 0x16, 0x00, 0x02, 0x00, 0x00, 0x12, 0x04, 0x02, 0x00, 0xf0, 0x00, 0x13,
+    0x04, 0x01, 0x00, 0x20, 0x34, 0xff, 0x2d, 0x00, 0xc7, 0xff, 0x02, 0x00, 0x0c, 0x03, 0x08, 0x0c,
+    0x00, 0xf0, 0x0c, 0x07, 0x08, 0x04, 0x00, 0x30, 0xf4, 0xff, 0x64, 0x00, 0xe7, 0xff, 0x02, 0x00,
+    0x0c, 0x09, 0x03, 0x04, 0x00, 0xf0, 0x0d, 0x09, 0x01, 0x04, 0x00, 0x30, 0x13, 0x00, 0xe2, 0xff,
+    0x6c, 0x00, 0x02, 0x00, 0x0c, 0x08, 0x03, 0x05, 0x00, 0xf0, 0x0d, 0x08, 0x01, 0x05, 0x00, 0x30,
+    0x00, 0x00, 0xd4, 0xff, 0x39, 0x00, 0x02, 0x00, 0x10, 0x00, 0x02, 0x01, 0x00, 0xf0, 0x11, 0x00,
+    0x01, 0x01, 0x00, 0x20, 0x00, 0x00, 0xc5, 0xff, 0x2a, 0x00, 0x02, 0x00, 0x05, 0x11, 0x01, 0x03,
+    0x00, 0xf0, 0x05, 0x12, 0x01, 0x01, 0x00, 0x30, 0xca, 0xff, 0x6e, 0x00, 0xe7, 0xff, 0x02, 0x00,
+    0x0a, 0x02, 0x03, 0x06, 0x00, 0xf0, 0x0a, 0x04, 0x03, 0x02, 0x00, 0x30, 0x09, 0x00, 0x12, 0x00,
+    0x6d, 0xff, 0x02, 0x00, 0x04, 0x11, 0x02, 0x03, 0x00, 0xf0, 0x04, 0x12, 0x02, 0x01, 0x00, 0x30,
+    0xcd, 0xff, 0x5c, 0x00, 0xe3, 0xff, 0x02, 0x00, 0x0c, 0x07, 0x01, 0x09, 0x00, 0xf0, 0x0c, 0x0a,
+    0x01, 0x03, 0x00, 0x30, 0xf5, 0xff, 0x48, 0x00, 0xe1, 0xff, 0x02, 0x00, 0x07, 0x06, 0x03, 0x09,
+    0x00, 0xf0, 0x08, 0x06, 0x01, 0x09, 0x00, 0x30, 0x51, 0x00, 0x0c, 0x00, 0x32, 0xff, 0x02, 0x00,
+    0x11, 0x0d, 0x03, 0x06, 0x00, 0xf0, 0x11, 0x0f, 0x03, 0x02, 0x00, 0x30, 0x13, 0x00, 0xe5, 0xff,
+    0x56, 0x00, 0x02, 0x00, 0x07, 0x07, 0x03, 0x08, 0x00, 0xf0, 0x08, 0x07, 0x01, 0x08, 0x00, 0x30,
+    0xe4, 0xff, 0x33, 0xff, 0x0b, 0x00, 0x02, 0x00, 0x05, 0x00, 0x03, 0x05, 0x00, 0xf0, 0x06, 0x00,
+    0x01, 0x05, 0x00, 0x30, 0xcb, 0xff, 0x2f, 0x00, 0xd3, 0xff, 0x02, 0x00, 0x04, 0x06, 0x09, 0x08,
+    0x00, 0xf0, 0x07, 0x06, 0x03, 0x08, 0x00, 0x30, 0xfb, 0xff, 0x46, 0x00, 0xe0, 0xff, 0x02, 0x00,
+    0x02, 0x09, 0x03, 0x03, 0x00, 0xf0, 0x03, 0x09, 0x01, 0x03, 0x00, 0x30, 0x0b, 0x00, 0x17, 0x00,
+    0x93, 0xff, 0x02, 0x00, 0x10, 0x12, 0x04, 0x02, 0x00, 0xf0, 0x10, 0x13, 0x04, 0x01, 0x00, 0x20,
+    0x01, 0x00, 0x9d, 0xff, 0x16, 0x00, 0x02, 0x00, 0x11, 0x0a, 0x03, 0x0a, 0x00, 0xf0, 0x11, 0x0f,
+    0x03, 0x05, 0x00, 0x20, 0xb7, 0xfe, 0x2f, 0x00, 0xc5, 0xff, 0x60, 0x00, 0xc1, 0xff, 0x02, 0x00,
+    0x08, 0x09, 0x06, 0x04, 0x00, 0xf0, 0x0a, 0x09, 0x02, 0x04, 0x00, 0x30, 0xdf, 0xfd, 0x4d, 0x00,
+    0xc7, 0xff, 0x02, 0x00, 0x05, 0x02, 0x0a, 0x0c, 0x00, 0xf0, 0x05, 0x06, 0x0a, 0x04, 0x00, 0x30,
+    0xd7, 0xff, 0x5e, 0x00, 0xd3, 0xff, 0x02, 0x00, 0x06, 0x09, 0x06, 0x03, 0x00, 0xf0, 0x08, 0x09,
+    0x02, 0x03, 0x00, 0x30, 0xe0, 0xff, 0x75, 0x00, 0xdf, 0xff, 0x02, 0x00, 0x0b, 0x07, 0x03, 0x07,
+    0x00, 0xf0, 0x0c, 0x07, 0x01, 0x07, 0x00, 0x30, 0xc6, 0xff, 0x72, 0x00, 0xe6, 0xff, 0x02, 0x00,
+    0x0c, 0x08, 0x06, 0x04, 0x00, 0xf0, 0x0e, 0x08, 0x02, 0x04, 0x00, 0x30, 0xe8, 0xff, 0x47, 0x00,
+    0xd9, 0xff, 0x02, 0x00, 0x0e, 0x08, 0x06, 0x05, 0x00, 0xf0, 0x10, 0x08, 0x02, 0x05, 0x00, 0x30,
+    0x2c, 0x00, 0xda, 0xff, 0x66, 0x00, 0x02, 0x00, 0x0c, 0x0c, 0x02, 0x04, 0x00, 0xf0, 0x0c, 0x0e,
+    0x02, 0x02, 0x00, 0x20, 0x00, 0x00, 0xc6, 0xff, 0x37, 0x00, 0x02, 0x00, 0x03, 0x0f, 0x01, 0x02,
+    0x00, 0xf0, 0x03, 0x10, 0x01, 0x01, 0x00, 0x20, 0xe9, 0xff, 0x74, 0x00, 0xe0, 0xff, 0x02, 0x00,
+    0x0c, 0x07, 0x03, 0x04, 0x00, 0xf0, 0x0d, 0x07, 0x01, 0x04, 0x00, 0x30, 0xa5, 0xff, 0x60, 0xff,
+    0x15, 0x00, 0x02, 0x00, 0x0a, 0x00, 0x06, 0x06, 0x00, 0xf0, 0x0c, 0x00, 0x02, 0x06, 0x00, 0x30,
+    0xec, 0xff, 0x43, 0x00, 0xdb, 0xff, 0x02, 0x00, 0x0a, 0x06, 0x03, 0x08, 0x00, 0xf0, 0x0b, 0x06,
+    0x01, 0x08, 0x00, 0x30, 0x00, 0x00, 0xc2, 0xff, 0x2a, 0x00, 0x02, 0x00, 0x10, 0x11, 0x01, 0x02,
+    0x00, 0xf0, 0x10, 0x12, 0x01, 0x01, 0x00, 0x20, 0xfe, 0xff, 0x93, 0xff, 0x17, 0x00, 0x02, 0x00,
+    0x10, 0x10, 0x01, 0x03, 0x00, 0xf0, 0x10, 0x11, 0x01, 0x01, 0x00, 0x30, 0x06, 0x00, 0xe2, 0xff,
+    0x4d, 0x00, 0x02, 0x00, 0x0b, 0x0b, 0x01, 0x02, 0x00, 0xf0, 0x0b, 0x0c, 0x01, 0x01, 0x00, 0x20,
+    0xcf, 0xff, 0x47, 0x00, 0xe1, 0xff, 0x02, 0x00, 0x03, 0x07, 0x06, 0x09, 0x00, 0xf0, 0x05, 0x07,
+    0x02, 0x09, 0x00, 0x30, 0x2b, 0x00, 0x0a, 0x00, 0x43, 0xff, 0x02, 0x00, 0x04, 0x12, 0x09, 0x01,
+    0x00, 0xf0, 0x07, 0x12, 0x03, 0x01, 0x00, 0x30, 0x82, 0xff, 0x60, 0xff, 0x0c, 0x00, 0x02, 0x00,
+    0x00, 0x0b, 0x04, 0x09, 0x00, 0xf0, 0x00, 0x0e, 0x04, 0x03, 0x00, 0x30, 0x2e, 0x00, 0x0a, 0x00,
+    0x49, 0xff, 0x02, 0x00, 0x09, 0x11, 0x06, 0x03, 0x00, 0xf0, 0x0b, 0x11, 0x02, 0x03, 0x00, 0x30,
+    0xce, 0xff, 0x33, 0x00, 0xcf, 0xff, 0x02, 0x00, 0x07, 0x08, 0x06, 0x0c, 0x00, 0xf0, 0x09, 0x08,
+    0x02, 0x0c, 0x00, 0x30, 0xe8, 0xff, 0x83, 0x00, 0xf1, 0xff, 0x02, 0x00, 0x06, 0x08, 0x03, 0x04,
+    0x00, 0xf0, 0x07, 0x08, 0x01, 0x04, 0x00, 0x30, 0xfc, 0xff, 0x47, 0xff, 0x0c, 0x00, 0x02, 0x00,
+    0x03, 0x11, 0x01, 0x03, 0x00, 0xf0, 0x03, 0x12, 0x01, 0x01, 0x00, 0x30, 0xe2, 0xff, 0x4b, 0x00,
+    0xe2, 0xff, 0x02, 0x00, 0x0b, 0x09, 0x06, 0x04, 0x00, 0xf0, 0x0d, 0x09, 0x02, 0x04, 0x00, 0x30,
+    0x0b, 0x00, 0x0b, 0x00, 0x4e, 0xff, 0x02, 0x00, 0x06, 0x01, 0x03, 0x02, 0x00, 0xf0, 0x07, 0x01,
+    0x01, 0x02, 0x00, 0x30, 0x00, 0x00, 0x33, 0x00, 0xd8, 0xff, 0x02, 0x00, 0x01, 0x00, 0x02, 0x01,
+    0x00, 0xf0, 0x02, 0x00, 0x01, 0x01, 0x00, 0x20, 0xec, 0xff, 0x4b, 0x00, 0xe3, 0xff, 0x03, 0x00,
+    0x01, 0x00, 0x02, 0x0e, 0x00, 0xf0, 0x01, 0x00, 0x01, 0x07, 0x00, 0x20, 0x02, 0x07, 0x01, 0x07,
+    0x00, 0x20, 0x32, 0x01, 0xe3, 0xff, 0x4d, 0x00, 0x02, 0x00, 0x05, 0x05, 0x0b, 0x08, 0x00, 0xf0,
+    0x05, 0x09, 0x0b, 0x04, 0x00, 0x20, 0x52, 0x00, 0xe6, 0xff, 0x68, 0x00, 0x02, 0x00, 0x09, 0x03,
+    0x05, 0x06, 0x00, 0xf0, 0x09, 0x05, 0x05, 0x02, 0x00, 0x30, 0xb5, 0x00, 0xba, 0xff, 0x1f, 0x00,
+    0x02, 0x00, 0x07, 0x09, 0x05, 0x0a, 0x00, 0xf0, 0x07, 0x0e, 0x05, 0x05, 0x00, 0x20, 0xfd, 0xff,
+    0x3e, 0x00, 0xde, 0xff, 0x02, 0x00, 0x0f, 0x0a, 0x02, 0x02, 0x00, 0xf0, 0x10, 0x0a, 0x01, 0x02,
+    0x00, 0x20, 0xf6, 0xff, 0x77, 0xff, 0x10, 0x00, 0x02, 0x00, 0x00, 0x12, 0x08, 0x02, 0x00, 0xf0,
+    0x00, 0x13, 0x08, 0x01, 0x00, 0x20, 0x00, 0x00, 0xcb, 0xff, 0x29, 0x00, 0x02, 0x00, 0x07, 0x11,
+    0x01, 0x03, 0x00, 0xf0, 0x07, 0x12, 0x01, 0x01, 0x00, 0x30, 0x6a, 0xff, 0x5d, 0x00, 0xe9, 0xff,
+    0x02, 0x00, 0x07, 0x02, 0x0b, 0x06, 0x00, 0xf0, 0x07, 0x04, 0x0b, 0x02, 0x00, 0x30, 0x0c, 0x00,
+    0xdf, 0xff, 0x40, 0x00, 0x02, 0x00, 0x08, 0x03, 0x09, 0x03, 0x00, 0xf0, 0x08, 0x04, 0x09, 0x01,
+    0x00, 0x30, 0xf6, 0xff, 0x6f, 0xff, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x09, 0x02, 0x02, 0x00, 0xf0,
+    0x00, 0x0a, 0x02, 0x01, 0x00, 0x20, 0xc7, 0xff, 0x84, 0xff, 0x0e, 0x00, 0x02, 0x00, 0x00, 0x05,
+    0x03, 0x06, 0x00, 0xf0, 0x00, 0x07, 0x03, 0x02, 0x00, 0x30, 0x03, 0x00, 0xec, 0xff, 0x67, 0x00,
+    0x03, 0x00, 0x06, 0x07, 0x02, 0x02, 0x00, 0xf0, 0x06, 0x07, 0x01, 0x01, 0x00, 0x20, 0x07, 0x08,
+    0x01, 0x01, 0x00, 0x20, 0xe3, 0xff, 0x72, 0x00, 0xf0, 0xff, 0x02, 0x00, 0x07, 0x06, 0x03, 0x06,
+    0x00, 0xf0, 0x08, 0x06, 0x01, 0x06, 0x00, 0x30, 0xb2, 0xff, 0x56, 0xff, 0x0c, 0x00, 0x02, 0x00,
+    0x0c, 0x01, 0x06, 0x04, 0x00, 0xf0, 0x0e, 0x01, 0x02, 0x04, 0x00, 0x30, 0xec, 0xff, 0x2c, 0x00,
+    0xd5, 0xff, 0x02, 0x00, 0x09, 0x0b, 0x06, 0x08, 0x00, 0xf0, 0x0b, 0x0b, 0x02, 0x08, 0x00, 0x30,
+    0xf5, 0xff, 0x67, 0xff, 0x0e, 0x00, 0x02, 0x00, 0x11, 0x0f, 0x03, 0x03, 0x00, 0xf0, 0x11, 0x10,
+    0x03, 0x01, 0x00, 0x30, 0x9b, 0xff, 0x3b, 0x00, 0xe2, 0xff, 0x02, 0x00, 0x06, 0x06, 0x03, 0x09,
+    0x00, 0xf0, 0x06, 0x09, 0x03, 0x03, 0x00, 0x30, 0x52, 0x00, 0xea, 0xff, 0x5c, 0x00, 0x03, 0x00,
+    0x00, 0x05, 0x08, 0x06, 0x00, 0xf0, 0x00, 0x05, 0x04, 0x03, 0x00, 0x20, 0x04, 0x08, 0x04, 0x03,
+    0x00, 0x20, 0x07, 0x00, 0x0c, 0x00, 0x5f, 0xff, 0x02, 0x00, 0x00, 0x06, 0x01, 0x03, 0x00, 0xf0,
+    0x00, 0x07, 0x01, 0x01, 0x00, 0x30, 0x05, 0x00, 0xda, 0xff, 0x30, 0x00, 0x02, 0x00, 0x11, 0x00,
+    0x02, 0x06, 0x00, 0xf0, 0x12, 0x00, 0x01, 0x06, 0x00, 0x20, 0xd4, 0xff, 0x6c, 0xff, 0x0b, 0x00,
+    0x02, 0x00, 0x0a, 0x11, 0x06, 0x03, 0x00, 0xf0, 0x0c, 0x11, 0x02, 0x03, 0x00, 0x30, 0x00, 0x00,
+    0xdd, 0xff, 0x32, 0x00, 0x03, 0x00, 0x0d, 0x0f, 0x02, 0x02, 0x00, 0xf0, 0x0d, 0x0f, 0x01, 0x01,
+    0x00, 0x20, 0x0e, 0x10, 0x01, 0x01, 0x00, 0x20, 0x0f, 0x00, 0xe6, 0xff, 0x40, 0x00, 0x02, 0x00,
+    0x04, 0x00, 0x0c, 0x03, 0x00, 0xf0, 0x04, 0x01, 0x0c, 0x01, 0x00, 0x30, 0xe2, 0xfe, 0x30, 0x00,
+    0x5e, 0xfe, 0x6a, 0x00, 0xd6, 0xff, 0x02, 0x00, 0x05, 0x03, 0x0a, 0x09, 0x00, 0xf0, 0x05, 0x06,
+    0x0a, 0x03, 0x00, 0x30, 0x2c, 0xff, 0x54, 0x00, 0xcb, 0xff, 0x02, 0x00, 0x07, 0x07, 0x09, 0x07,
+    0x00, 0xf0, 0x0a, 0x07, 0x03, 0x07, 0x00, 0x30, 0x52, 0xff, 0x42, 0x00, 0xd8, 0xff, 0x02, 0x00,
+    0x05, 0x08, 0x09, 0x06, 0x00, 0xf0, 0x08, 0x08, 0x03, 0x06, 0x00, 0x30, 0x01, 0x00, 0xa8, 0xff,
+    0x23, 0x00, 0x02, 0x00, 0x00, 0x10, 0x06, 0x02, 0x00, 0xf0, 0x00, 0x11, 0x06, 0x01, 0x00, 0x20,
+    0x63, 0x00, 0x94, 0xff, 0x22, 0x00, 0x02, 0x00, 0x0c, 0x06, 0x07, 0x0e, 0x00, 0xf0, 0x0c, 0x0d,
+    0x07, 0x07, 0x00, 0x20, 0x9f, 0xff, 0x51, 0x00, 0xd6, 0xff, 0x02, 0x00, 0x0d, 0x07, 0x06, 0x08,
+    0x00, 0xf0, 0x0f, 0x07, 0x02, 0x08, 0x00, 0x30, 0xe4, 0xff, 0x4f, 0x00, 0xde, 0xff, 0x02, 0x00,
+    0x02, 0x0a, 0x06, 0x03, 0x00, 0xf0, 0x04, 0x0a, 0x02, 0x03, 0x00, 0x30, 0xfe, 0xff, 0x67, 0xff,
+    0x16, 0x00, 0x02, 0x00, 0x12, 0x11, 0x01, 0x03, 0x00, 0xf0, 0x12, 0x12, 0x01, 0x01, 0x00, 0x30,
+    0x15, 0x00, 0xe1, 0xff, 0x62, 0x00, 0x02, 0x00, 0x07, 0x01, 0x06, 0x02, 0x00, 0xf0, 0x07, 0x02,
+    0x06, 0x01, 0x00, 0x20, 0xca, 0xff, 0x56, 0x00, 0xe7, 0xff, 0x02, 0x00, 0x06, 0x00, 0x06, 0x04,
+    0x00, 0xf0, 0x06, 0x02, 0x06, 0x02, 0x00, 0x20, 0xe5, 0xff, 0x64, 0xff, 0x0c, 0x00, 0x02, 0x00,
+    0x08, 0x12, 0x06, 0x02, 0x00, 0xf0, 0x0a, 0x12, 0x02, 0x02, 0x00, 0x30, 0xef, 0xff, 0x40, 0x00,
+    0xdc, 0xff, 0x02, 0x00, 0x07, 0x06, 0x05, 0x02, 0x00, 0xf0, 0x07, 0x07, 0x05, 0x01, 0x00, 0x20,
+    0xd4, 0xff, 0x8c, 0x00, 0xf1, 0xff, 0x02, 0x00, 0x06, 0x07, 0x03, 0x06, 0x00, 0xf0, 0x07, 0x07,
+    0x01, 0x06, 0x00, 0x30, 0x01, 0x00, 0x15, 0x00, 0x8f, 0xff, 0x03, 0x00, 0x12, 0x12, 0x02, 0x02,
+    0x00, 0xf0, 0x12, 0x12, 0x01, 0x01, 0x00, 0x20, 0x13, 0x13, 0x01, 0x01, 0x00, 0x20, 0xf6, 0xff,
+    0x3b, 0x00, 0xdd, 0xff, 0x02, 0x00, 0x10, 0x08, 0x03, 0x07, 0x00, 0xf0, 0x11, 0x08, 0x01, 0x07,
+    0x00, 0x30, 0x05, 0x00, 0x0f, 0x00, 0x82, 0xff, 0x02, 0x00, 0x00, 0x10, 0x02, 0x03, 0x00, 0xf0,
+    0x00, 0x11, 0x02, 0x01, 0x00, 0x30, 0xec, 0xff, 0x55, 0xff, 0x0b, 0x00, 0x02, 0x00, 0x05, 0x13,
+    0x06, 0x01, 0x00, 0xf0, 0x07, 0x13, 0x02, 0x01, 0x00, 0x30, 0x6c, 0x00, 0xee, 0xff, 0x71, 0x00,
+    0x02, 0x00, 0x09, 0x05, 0x06, 0x06, 0x00, 0xf0, 0x09, 0x07, 0x06, 0x02, 0x00, 0x30, 0xf3, 0xff,
+    0x94, 0xff, 0x11, 0x00, 0x02, 0x00, 0x00, 0x0a, 0x02, 0x04, 0x00, 0xf0, 0x00, 0x0c, 0x02, 0x02,
+    0x00, 0x20, 0xf4, 0xff, 0x29, 0x00, 0xd2, 0xff, 0x02, 0x00, 0x00, 0x09, 0x04, 0x03, 0x00, 0xf0,
+    0x02, 0x09, 0x02, 0x03, 0x00, 0x20, 0x7d, 0x00, 0xf1, 0xff, 0x88, 0x00, 0x02, 0x00, 0x01, 0x0a,
+    0x06, 0x09, 0x00, 0xf0, 0x03, 0x0a, 0x02, 0x09, 0x00, 0x30, 0xd9, 0xff, 0x65, 0xff, 0x0d, 0x00,
+    0x02, 0x00, 0x09, 0x00, 0x06, 0x02, 0x00, 0xf0, 0x0b, 0x00, 0x02, 0x02, 0x00, 0x30, 0x00, 0x00,
+    0xd6, 0xff, 0x31, 0x00, 0x02, 0x00, 0x0e, 0x01, 0x02, 0x01, 0x00, 0xf0, 0x0f, 0x01, 0x01, 0x01,
+    0x00, 0x20, 0x14, 0x00, 0x0b, 0x00, 0x6d, 0xff, 0x02, 0x00, 0x00, 0x08, 0x01, 0x04, 0x00, 0xf0,
+    0x00, 0x0a, 0x01, 0x02, 0x00, 0x20, 0x01, 0x00, 0xe4, 0xff, 0x3b, 0x00, 0x03, 0x00, 0x0f, 0x06,
+    0x02, 0x02, 0x00, 0xf0, 0x0f, 0x06, 0x01, 0x01, 0x00, 0x20, 0x10, 0x07, 0x01, 0x01, 0x00, 0x20,
+    0xdd, 0xff, 0x67, 0x00, 0xf1, 0xff, 0x02, 0x00, 0x07, 0x05, 0x03, 0x06, 0x00, 0xf0, 0x08, 0x05,
+    0x01, 0x06, 0x00, 0x30, 0x03, 0x00, 0x10, 0x00, 0x8e, 0xff, 0x02, 0x00, 0x13, 0x11, 0x01, 0x03,
+    0x00, 0xf0, 0x13, 0x12, 0x01, 0x01, 0x00, 0x30, 0x04, 0x00, 0xe8, 0xff, 0x4d, 0x00, 0x02, 0x00,
+    0x07, 0x0a, 0x03, 0x01, 0x00, 0xf0, 0x08, 0x0a, 0x01, 0x01, 0x00, 0x30, 0x9f, 0xff, 0x6a, 0xff,
+    0x0b, 0x00, 0x02, 0x00, 0x0c, 0x01, 0x06, 0x06, 0x00, 0xf0, 0x0e, 0x01, 0x02, 0x06, 0x00, 0x30,
+    0x00, 0x00, 0xda, 0xff, 0x2d, 0x00, 0x02, 0x00, 0x0f, 0x05, 0x02, 0x01, 0x00, 0xf0, 0x10, 0x05,
+    0x01, 0x01, 0x00, 0x20, 0x64, 0x00, 0xf2, 0xff, 0x7d, 0x00, 0x02, 0x00, 0x08, 0x02, 0x07, 0x04,
+    0x00, 0xf0, 0x08, 0x04, 0x07, 0x02, 0x00, 0x20, 0xb9, 0xfd, 0x26, 0x00, 0xd0, 0xff, 0x02, 0x00,
+    0x04, 0x00, 0x0e, 0x0f, 0x00, 0xf0, 0x04, 0x05, 0x0e, 0x05, 0x00, 0x30, 0xae, 0xff, 0x37, 0x00,
+    0xe2, 0xff, 0x02, 0x00, 0x07, 0x08, 0x06, 0x06, 0x00, 0xf0, 0x09, 0x08, 0x02, 0x06, 0x00, 0x30,
+    0x00, 0x00, 0xd5, 0xff, 0x2a, 0x00, 0x02, 0x00, 0x0b, 0x11, 0x01, 0x03, 0x00, 0xf0, 0x0b, 0x12,
+    0x01, 0x01, 0x00, 0x30, 0xf5, 0xff, 0x4f, 0xff, 0x0a, 0x00, 0x03, 0x00, 0x0c, 0x10, 0x02, 0x04,
+    0x00, 0xf0, 0x0c, 0x10, 0x01, 0x02, 0x00, 0x20, 0x0d, 0x12, 0x01, 0x02, 0x00, 0x20, 0x00, 0x00,
+    0x30, 0x00, 0xda, 0xff, 0x02, 0x00, 0x0a, 0x0d, 0x02, 0x01, 0x00, 0xf0, 0x0b, 0x0d, 0x01, 0x01,
+    0x00, 0x20, 0xe4, 0xff, 0x78, 0x00, 0xf2, 0xff, 0x02, 0x00, 0x0b, 0x08, 0x03, 0x03, 0x00, 0xf0,
+    0x0c, 0x08, 0x01, 0x03, 0x00, 0x30, 0x67, 0xff, 0x3e, 0xff, 0x08, 0x00, 0x02, 0x00, 0x02, 0x00,
+    0x06, 0x08, 0x00, 0xf0, 0x04, 0x00, 0x02, 0x08, 0x00, 0x30, 0xbf, 0xff, 0x4e, 0x00, 0xea, 0xff,
+    0x03, 0x00, 0x03, 0x05, 0x06, 0x06, 0x00, 0xf0, 0x03, 0x05, 0x03, 0x03, 0x00, 0x20, 0x06, 0x08,
+    0x03, 0x03, 0x00, 0x20, 0xf4, 0xff, 0x43, 0x00, 0xe9, 0xff, 0x02, 0x00, 0x0a, 0x08, 0x03, 0x03,
+    0x00, 0xf0, 0x0b, 0x08, 0x01, 0x03, 0x00, 0x30, 0x04, 0x00, 0xd4, 0xff, 0x27, 0x00, 0x02, 0x00,
+    0x05, 0x11, 0x04, 0x02, 0x00, 0xf0, 0x05, 0x12, 0x04, 0x01, 0x00, 0x20, 0xfa, 0xff, 0x5b, 0x00,
+    0xed, 0xff, 0x02, 0x00, 0x08, 0x10, 0x05, 0x02, 0x00, 0xf0, 0x08, 0x11, 0x05, 0x01, 0x00, 0x20,
+    0x11, 0x00, 0x0c, 0x00, 0x69, 0xff, 0x02, 0x00, 0x00, 0x04, 0x03, 0x03, 0x00, 0xf0, 0x00, 0x05,
+    0x03, 0x01, 0x00, 0x30, 0xd4, 0xff, 0x5d, 0xff, 0x08, 0x00, 0x02, 0x00, 0x06, 0x03, 0x06, 0x02,
+    0x00, 0xf0, 0x08, 0x03, 0x02, 0x02, 0x00, 0x30, 0xef, 0xff, 0x29, 0x00, 0xda, 0xff, 0x02, 0x00,
+    0x04, 0x04, 0x09, 0x03, 0x00, 0xf0, 0x07, 0x04, 0x03, 0x03, 0x00, 0x30, 0x1e, 0x00, 0x08, 0x00,
+    0x40, 0xff, 0x02, 0x00, 0x00, 0x0d, 0x01, 0x04, 0x00, 0xf0, 0x00, 0x0f, 0x01, 0x02, 0x00, 0x20,
+    0x21, 0x00, 0x06, 0x00, 0x49, 0xff, 0x02, 0x00, 0x00, 0x11, 0x08, 0x03, 0x00, 0xf0, 0x00, 0x12,
+    0x08, 0x01, 0x00, 0x30, 0x78, 0xff, 0x55, 0x00, 0xee, 0xff, 0x02, 0x00, 0x06, 0x01, 0x0b, 0x06,
+    0x00, 0xf0, 0x06, 0x03, 0x0b, 0x02, 0x00, 0x30, 0xdc, 0xfe, 0x37, 0x00, 0x50, 0x00, 0xe6, 0xff,
+    0x88, 0x00, 0x02, 0x00, 0x04, 0x0a, 0x06, 0x02, 0x00, 0xf0, 0x06, 0x0a, 0x02, 0x02, 0x00, 0x30,
+    0x5a, 0x00, 0xc1, 0xff, 0x35, 0x00, 0x02, 0x00, 0x0a, 0x08, 0x01, 0x0c, 0x00, 0xf0, 0x0a, 0x0e,
+    0x01, 0x06, 0x00, 0x20, 0xef, 0xff, 0x62, 0x00, 0xdb, 0xff, 0x02, 0x00, 0x05, 0x08, 0x03, 0x04,
+    0x00, 0xf0, 0x06, 0x08, 0x01, 0x04, 0x00, 0x30, 0xfd, 0xff, 0x60, 0xff, 0x1e, 0x00, 0x02, 0x00,
+    0x00, 0x11, 0x01, 0x03, 0x00, 0xf0, 0x00, 0x12, 0x01, 0x01, 0x00, 0x30, 0x03, 0x00, 0x17, 0x00,
+    0x73, 0xff, 0x02, 0x00, 0x00, 0x11, 0x01, 0x03, 0x00, 0xf0, 0x00, 0x12, 0x01, 0x01, 0x00, 0x30,
+    0x25, 0x00, 0xee, 0xff, 0x8e, 0x00, 0x02, 0x00, 0x0d, 0x08, 0x03, 0x04, 0x00, 0xf0, 0x0e, 0x08,
+    0x01, 0x04, 0x00, 0x30, 0xf0, 0xff, 0x33, 0x00, 0xcb, 0xff, 0x02, 0x00, 0x01, 0x05, 0x05, 0x04,
+    0x00, 0xf0, 0x01, 0x07, 0x05, 0x02, 0x00, 0x20, 0x00, 0x00, 0xb9, 0xff, 0x23, 0x00, 0x02, 0x00,
+    0x12, 0x0e, 0x01, 0x02, 0x00, 0xf0, 0x12, 0x0f, 0x01, 0x01, 0x00, 0x20, 0xf4, 0xff, 0x5d, 0x00,
+    0xed, 0xff, 0x02, 0x00, 0x0d, 0x08, 0x02, 0x04, 0x00, 0xf0, 0x0e, 0x08, 0x01, 0x04, 0x00, 0x20,
+    0xa6, 0xff, 0x64, 0x00, 0xe4, 0xff, 0x02, 0x00, 0x0a, 0x06, 0x06, 0x08, 0x00, 0xf0, 0x0c, 0x06,
+    0x02, 0x08, 0x00, 0x30, 0xe2, 0xff, 0x20, 0x00, 0xc3, 0xff, 0x02, 0x00, 0x08, 0x06, 0x06, 0x0a,
+    0x00, 0xf0, 0x0a, 0x06, 0x02, 0x0a, 0x00, 0x30, 0x03, 0x00, 0x12, 0x00, 0x90, 0xff, 0x02, 0x00,
+    0x11, 0x10, 0x01, 0x03, 0x00, 0xf0, 0x11, 0x11, 0x01, 0x01, 0x00, 0x30, 0xed, 0xff, 0x37, 0x00,
+    0xdc, 0xff, 0x02, 0x00, 0x01, 0x07, 0x02, 0x0a, 0x00, 0xf0, 0x02, 0x07, 0x01, 0x0a, 0x00, 0x20,
+    0xc2, 0xff, 0x5d, 0x00, 0xeb, 0xff, 0x02, 0x00, 0x05, 0x09, 0x06, 0x03, 0x00, 0xf0, 0x07, 0x09,
+    0x02, 0x03, 0x00, 0x30, 0x14, 0x00, 0xa8, 0xff, 0x17, 0x00, 0x02, 0x00, 0x00, 0x08, 0x05, 0x0c,
+    0x00, 0xf0, 0x00, 0x0e, 0x05, 0x06, 0x00, 0x20, 0xf9, 0xff, 0x62, 0xff, 0x0c, 0x00, 0x02, 0x00,
+    0x00, 0x0b, 0x01, 0x03, 0x00, 0xf0, 0x00, 0x0c, 0x01, 0x01, 0x00, 0x30, 0xce, 0xff, 0x6b, 0xff,
+    0x0b, 0x00, 0x02, 0x00, 0x06, 0x10, 0x06, 0x04, 0x00, 0xf0, 0x08, 0x10, 0x02, 0x04, 0x00, 0x30,
+    0xcb, 0xff, 0x68, 0xff, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x06, 0x02, 0x06, 0x00, 0xf0, 0x00, 0x08,
+    0x02, 0x02, 0x00, 0x30, 0xfb, 0xff, 0x52, 0xff, 0x08, 0x00, 0x02, 0x00, 0x0b, 0x12, 0x02, 0x01,
+    0x00, 0xf0, 0x0c, 0x12, 0x01, 0x01, 0x00, 0x20, 0x18, 0x00, 0xe8, 0xff, 0x4d, 0x00, 0x02, 0x00,
+    0x05, 0x01, 0x09, 0x02, 0x00, 0xf0, 0x05, 0x02, 0x09, 0x01, 0x00, 0x20, 0x02, 0x00, 0x14, 0x00,
+    0xa6, 0xff, 0x02, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0xf0, 0x00, 0x01, 0x01, 0x01, 0x00, 0x20,
+    0xf9, 0xff, 0x3c, 0x00, 0xe2, 0xff, 0x02, 0x00, 0x0f, 0x09, 0x03, 0x03, 0x00, 0xf0, 0x10, 0x09,
+    0x01, 0x03, 0x00, 0x30, 0xfe, 0xff, 0x8e, 0xff, 0x0e, 0x00, 0x02, 0x00, 0x12, 0x10, 0x01, 0x03,
+    0x00, 0xf0, 0x12, 0x11, 0x01, 0x01, 0x00, 0x30, 0xe8, 0xff, 0x6f, 0x00, 0xef, 0xff, 0x02, 0x00,
+    0x0b, 0x0a, 0x06, 0x01, 0x00, 0xf0, 0x0d, 0x0a, 0x02, 0x01, 0x00, 0x30, 0xf3, 0xff, 0x2e, 0x00,
+    0xdc, 0xff, 0x02, 0x00, 0x01, 0x03, 0x04, 0x04, 0x00, 0xf0, 0x03, 0x03, 0x02, 0x04, 0x00, 0x20,
+    0x07, 0xff, 0x78, 0x00, 0xf1, 0xff, 0x02, 0x00, 0x0b, 0x02, 0x01, 0x12, 0x00, 0xf0, 0x0b, 0x08,
+    0x01, 0x06, 0x00, 0x30, 0x74, 0xfe, 0x46, 0x00, 0xe8, 0xff, 0x02, 0x00, 0x09, 0x01, 0x05, 0x0c,
+    0x00, 0xf0, 0x09, 0x05, 0x05, 0x04, 0x00, 0x30, 0x10, 0x00, 0xe1, 0xff, 0x35, 0x00, 0x02, 0x00,
+    0x0c, 0x00, 0x08, 0x01, 0x00, 0xf0, 0x10, 0x00, 0x04, 0x01, 0x00, 0x20, 0xdb, 0xff, 0x5b, 0x00,
+    0xed, 0xff, 0x02, 0x00, 0x08, 0x06, 0x03, 0x0a, 0x00, 0xf0, 0x09, 0x06, 0x01, 0x0a, 0x00, 0x30,
+    0xed, 0xff, 0x97, 0xff, 0x11, 0x00, 0x02, 0x00, 0x13, 0x02, 0x01, 0x06, 0x00, 0xf0, 0x13, 0x04,
+    0x01, 0x02, 0x00, 0x30, 0xef, 0xff, 0x46, 0xff, 0x09, 0x00, 0x02, 0x00, 0x12, 0x06, 0x02, 0x02,
+    0x00, 0xf0, 0x12, 0x07, 0x02, 0x01, 0x00, 0x20, 0xd9, 0xff, 0x8d, 0x00, 0xf3, 0xff, 0x02, 0x00,
+    0x07, 0x07, 0x03, 0x04, 0x00, 0xf0, 0x08, 0x07, 0x01, 0x04, 0x00, 0x30, 0xb9, 0xff, 0x6e, 0xff,
+    0x0c, 0x00, 0x02, 0x00, 0x05, 0x00, 0x06, 0x05, 0x00, 0xf0, 0x07, 0x00, 0x02, 0x05, 0x00, 0x30,
+    0xe5, 0xff, 0x8a, 0xff, 0x0c, 0x00, 0x02, 0x00, 0x00, 0x03, 0x07, 0x03, 0x00, 0xf0, 0x00, 0x04,
+    0x07, 0x01, 0x00, 0x30, 0x01, 0x00, 0xe8, 0xff, 0x42, 0x00, 0x02, 0x00, 0x01, 0x06, 0x02, 0x01,
+    0x00, 0xf0, 0x02, 0x06, 0x01, 0x01, 0x00, 0x20, 0xf7, 0xff, 0x3a, 0x00, 0xe6, 0xff, 0x03, 0x00,
+    0x04, 0x08, 0x02, 0x0a, 0x00, 0xf0, 0x04, 0x08, 0x01, 0x05, 0x00, 0x20, 0x05, 0x0d, 0x01, 0x05,
+    0x00, 0x20, 0xe2, 0xff, 0x6f, 0xff, 0x0c, 0x00, 0x03, 0x00, 0x02, 0x12, 0x12, 0x02, 0x00, 0xf0,
+    0x02, 0x12, 0x09, 0x01, 0x00, 0x20, 0x0b, 0x13, 0x09, 0x01, 0x00, 0x20, 0xeb, 0xff, 0x59, 0x00,
+    0xeb, 0xff, 0x03, 0x00, 0x02, 0x07, 0x04, 0x04, 0x00, 0xf0, 0x02, 0x07, 0x02, 0x02, 0x00, 0x20,
+    0x04, 0x09, 0x02, 0x02, 0x00, 0x20, 0xed, 0xff, 0x66, 0xff, 0x0b, 0x00, 0x02, 0x00, 0x11, 0x03,
+    0x03, 0x04, 0x00, 0xf0, 0x12, 0x03, 0x01, 0x04, 0x00, 0x30, 0x06, 0x00, 0xe6, 0xff, 0x3b, 0x00,
+    0x03, 0x00, 0x10, 0x09, 0x02, 0x08, 0x00, 0xf0, 0x10, 0x09, 0x01, 0x04, 0x00, 0x20, 0x11, 0x0d,
+    0x01, 0x04, 0x00, 0x20, 0xed, 0xff, 0x48, 0x00, 0xe7, 0xff, 0x02, 0x00, 0x0f, 0x07, 0x01, 0x06,
+    0x00, 0xf0, 0x0f, 0x09, 0x01, 0x02, 0x00, 0x30, 0xfb, 0xff, 0x3b, 0x00, 0xe3, 0xff, 0x02, 0x00,
+    0x0e, 0x02, 0x02, 0x02, 0x00, 0xf0, 0x0e, 0x03, 0x02, 0x01, 0x00, 0x20, 0x09, 0x00, 0x10, 0x00,
+    0x94, 0xff, 0x02, 0x00, 0x11, 0x00, 0x02, 0x03, 0x00, 0xf0, 0x11, 0x01, 0x02, 0x01, 0x00, 0x30,
+    0xff, 0xff, 0x9f, 0xff, 0x0f, 0x00, 0x03, 0x00, 0x10, 0x12, 0x02, 0x02, 0x00, 0xf0, 0x10, 0x12,
+    0x01, 0x01, 0x00, 0x20, 0x11, 0x13, 0x01, 0x01, 0x00, 0x20, 0x14, 0x00, 0xed, 0xff, 0x55, 0x00,
+    0x02, 0x00, 0x0a, 0x04, 0x04, 0x03, 0x00, 0xf0, 0x0a, 0x05, 0x04, 0x01, 0x00, 0x30, 0xdb, 0xff,
+    0x24, 0x00, 0xd5, 0xff, 0x02, 0x00, 0x00, 0x02, 0x08, 0x06, 0x00, 0xf0, 0x04, 0x02, 0x04, 0x06,
+    0x00, 0x20, 0xe4, 0xff, 0x45, 0x00, 0xe9, 0xff, 0x02, 0x00, 0x07, 0x0e, 0x06, 0x06, 0x00, 0xf0,
+    0x07, 0x10, 0x06, 0x02, 0x00, 0x30, 0x04, 0x00, 0xd9, 0xff, 0x32, 0x00, 0x02, 0x00, 0x0b, 0x0f,
+    0x02, 0x02, 0x00, 0xf0, 0x0b, 0x10, 0x02, 0x01, 0x00, 0x20, 0x66, 0xff, 0x69, 0xff, 0x0a, 0x00,
+    0x02, 0x00, 0x07, 0x01, 0x09, 0x04, 0x00, 0xf0, 0x0a, 0x01, 0x03, 0x04, 0x00, 0x30, 0xe5, 0xff,
+    0x41, 0x00, 0xe8, 0xff, 0x02, 0x00, 0x09, 0x07, 0x03, 0x07, 0x00, 0xf0, 0x0a, 0x07, 0x01, 0x07,
+    0x00, 0x30, 0x02, 0x00, 0x0b, 0x00, 0x84, 0xff, 0x03, 0x00, 0x06, 0x11, 0x02, 0x02, 0x00, 0xf0,
+    0x06, 0x11, 0x01, 0x01, 0x00, 0x20, 0x07, 0x12, 0x01, 0x01, 0x00, 0x20, 0xef, 0xff, 0x3f, 0x00,
+    0xe8, 0xff, 0x02, 0x00, 0x04, 0x06, 0x03, 0x09, 0x00, 0xf0, 0x05, 0x06, 0x01, 0x09, 0x00, 0x30,
+    0xe6, 0xfe, 0x56, 0xff, 0x09, 0x00, 0x02, 0x00, 0x00, 0x0a, 0x13, 0x0a, 0x00, 0xf0, 0x00, 0x0f,
+    0x13, 0x05, 0x00, 0x20, 0x19, 0x00, 0x06, 0x00, 0x46, 0xff, 0x02, 0x00, 0x05, 0x11, 0x06, 0x01,
+    0x00, 0xf0, 0x07, 0x11, 0x02, 0x01, 0x00, 0x30, 0x2b, 0x00, 0xec, 0xff, 0x4c, 0x00, 0x02, 0x00,
+    0x00, 0x0c, 0x06, 0x03, 0x00, 0xf0, 0x03, 0x0c, 0x03, 0x03, 0x00, 0x20, 0xe0, 0xfe, 0x20, 0x00,
+    0xff, 0xfe, 0x47, 0x00, 0xb5, 0xff, 0x02, 0x00, 0x02, 0x05, 0x12, 0x05, 0x00, 0xf0, 0x08, 0x05,
+    0x06, 0x05, 0x00, 0x30, 0x0e, 0x00, 0xa8, 0xff, 0x35, 0x00, 0x02, 0x00, 0x01, 0x0f, 0x06, 0x04,
+    0x00, 0xf0, 0x01, 0x11, 0x06, 0x02, 0x00, 0x20, 0xe0, 0xff, 0x3d, 0x00, 0xcf, 0xff, 0x02, 0x00,
+    0x0e, 0x0a, 0x06, 0x06, 0x00, 0xf0, 0x10, 0x0a, 0x02, 0x06, 0x00, 0x30, 0xf2, 0xff, 0x69, 0xff,
+    0x1f, 0x00, 0x02, 0x00, 0x00, 0x0e, 0x04, 0x03, 0x00, 0xf0, 0x00, 0x0f, 0x04, 0x01, 0x00, 0x30,
+    0xda, 0xff, 0x2f, 0x00, 0xc1, 0xff, 0x02, 0x00, 0x01, 0x07, 0x06, 0x0b, 0x00, 0xf0, 0x03, 0x07,
+    0x02, 0x0b, 0x00, 0x30, 0x00, 0x00, 0xac, 0xff, 0x1c, 0x00, 0x02, 0x00, 0x0d, 0x11, 0x07, 0x02,
+    0x00, 0xf0, 0x0d, 0x12, 0x07, 0x01, 0x00, 0x20, 0x07, 0x00, 0x19, 0x00, 0x81, 0xff, 0x02, 0x00,
+    0x00, 0x0e, 0x02, 0x03, 0x00, 0xf0, 0x00, 0x0f, 0x02, 0x01, 0x00, 0x30, 0xea, 0xff, 0x4b, 0x00,
+    0xdf, 0xff, 0x02, 0x00, 0x00, 0x00, 0x06, 0x02, 0x00, 0xf0, 0x03, 0x00, 0x03, 0x02, 0x00, 0x20,
+    0x1e, 0x00, 0xdb, 0xff, 0x55, 0x00, 0x02, 0x00, 0x00, 0x01, 0x06, 0x03, 0x00, 0xf0, 0x03, 0x01,
+    0x03, 0x03, 0x00, 0x20, 0xc1, 0xff, 0x51, 0xff, 0x19, 0x00, 0x02, 0x00, 0x00, 0x08, 0x02, 0x06,
+    0x00, 0xf0, 0x00, 0x0a, 0x02, 0x02, 0x00, 0x30, 0x75, 0x00, 0xdb, 0xff, 0x4f, 0x00, 0x03, 0x00,
+    0x01, 0x02, 0x06, 0x0e, 0x00, 0xf0, 0x01, 0x02, 0x03, 0x07, 0x00, 0x20, 0x04, 0x09, 0x03, 0x07,
+    0x00, 0x20, 0x00, 0x00, 0xd4, 0xff, 0x36, 0x00, 0x03, 0x00, 0x11, 0x05, 0x02, 0x02, 0x00, 0xf0,
+    0x11, 0x05, 0x01, 0x01, 0x00, 0x20, 0x12, 0x06, 0x01, 0x01, 0x00, 0x20, 0xd6, 0x00, 0xef, 0xff,
+    0x7e, 0x00, 0x02, 0x00, 0x0b, 0x0a, 0x09, 0x04, 0x00, 0xf0, 0x0e, 0x0a, 0x03, 0x04, 0x00, 0x30,
+    0x9e, 0xfe, 0x81, 0x00, 0xed, 0xff, 0x02, 0x00, 0x02, 0x09, 0x0c, 0x04, 0x00, 0xf0, 0x06, 0x09,
+    0x04, 0x04, 0x00, 0x30, 0x54, 0xff, 0x74, 0x00, 0xe9, 0xff, 0x02, 0x00, 0x07, 0x0a, 0x0c, 0x02,
+    0x00, 0xf0, 0x0b, 0x0a, 0x04, 0x02, 0x00, 0x30, 0x00, 0x00, 0xbd, 0xff, 0x29, 0x00, 0x02, 0x00,
+    0x02, 0x0d, 0x01, 0x02, 0x00, 0xf0, 0x02, 0x0e, 0x01, 0x01, 0x00, 0x20, 0x15, 0x00, 0x13, 0x00,
+    0x76, 0xff, 0x02, 0x00, 0x10, 0x07, 0x04, 0x03, 0x00, 0xf0, 0x10, 0x08, 0x04, 0x01, 0x00, 0x30,
+    0xfd, 0xff, 0x82, 0xff, 0x0f, 0x00, 0x02, 0x00, 0x13, 0x10, 0x01, 0x03, 0x00, 0xf0, 0x13, 0x11,
+    0x01, 0x01, 0x00, 0x30, 0x00, 0x00, 0xca, 0xff, 0x24, 0x00, 0x02, 0x00, 0x12, 0x0b, 0x01, 0x02,
+    0x00, 0xf0, 0x12, 0x0c, 0x01, 0x01, 0x00, 0x20, 0x14, 0x00, 0xe9, 0xff, 0x5b, 0x00, 0x03, 0x00,
+    0x0c, 0x07, 0x08, 0x02, 0x00, 0xf0, 0x0c, 0x07, 0x04, 0x01, 0x00, 0x20, 0x10, 0x08, 0x04, 0x01,
+    0x00, 0x20, 0xfa, 0xff, 0x41, 0x00, 0xdc, 0xff, 0x02, 0x00, 0x0e, 0x09, 0x02, 0x04, 0x00, 0xf0,
+    0x0f, 0x09, 0x01, 0x04, 0x00, 0x20, 0x0b, 0x00, 0xd8, 0xff, 0x35, 0x00, 0x03, 0x00, 0x0e, 0x02,
+    0x06, 0x04, 0x00, 0xf0, 0x0e, 0x02, 0x03, 0x02, 0x00, 0x20, 0x11, 0x04, 0x03, 0x02, 0x00, 0x20,
+    0x09, 0x00, 0xda, 0xff, 0x44, 0x00, 0x02, 0x00, 0x0e, 0x00, 0x06, 0x01, 0x00, 0xf0, 0x11, 0x00,
+    0x03, 0x01, 0x00, 0x20, 0xfd, 0xff, 0x4b, 0x00, 0xe5, 0xff, 0x02, 0x00, 0x03, 0x0c, 0x02, 0x01,
+    0x00, 0xf0, 0x04, 0x0c, 0x01, 0x01, 0x00, 0x20, 0x08, 0x00, 0x0c, 0x00, 0x49, 0xff, 0x02, 0x00,
+    0x11, 0x02, 0x03, 0x01, 0x00, 0xf0, 0x12, 0x02, 0x01, 0x01, 0x00, 0x30, 0x2e, 0x00, 0xe0, 0xff,
+    0x3d, 0x00, 0x02, 0x00, 0x01, 0x10, 0x12, 0x02, 0x00, 0xf0, 0x07, 0x10, 0x06, 0x02, 0x00, 0x30,
+    0xfc, 0xff, 0x3f, 0x00, 0xde, 0xff, 0x02, 0x00, 0x02, 0x13, 0x08, 0x01, 0x00, 0xf0, 0x06, 0x13,
+    0x04, 0x01, 0x00, 0x20, 0x0d, 0x00, 0x0d, 0x00, 0x7b, 0xff, 0x02, 0x00, 0x01, 0x11, 0x04, 0x03,
+    0x00, 0xf0, 0x01, 0x12, 0x04, 0x01, 0x00, 0x30, 0x00, 0x00, 0xc9, 0xff, 0x20, 0x00, 0x02, 0x00,
+    0x13, 0x0d, 0x01, 0x02, 0x00, 0xf0, 0x13, 0x0e, 0x01, 0x01, 0x00, 0x20, 0xf0, 0xff, 0x3e, 0x00,
+    0xe3, 0xff, 0x03, 0x00, 0x09, 0x10, 0x0a, 0x04, 0x00, 0xf0, 0x09, 0x10, 0x05, 0x02, 0x00, 0x20,
+    0x0e, 0x12, 0x05, 0x02, 0x00, 0x20, 0xfa, 0xff, 0x48, 0x00, 0xe5, 0xff, 0x03, 0x00, 0x0c, 0x09,
+    0x02, 0x04, 0x00, 0xf0, 0x0c, 0x09, 0x01, 0x02, 0x00, 0x20, 0x0d, 0x0b, 0x01, 0x02, 0x00, 0x20,
+    0x39, 0x00, 0x0a, 0x00, 0x44, 0xff, 0x02, 0x00, 0x13, 0x0b, 0x01, 0x09, 0x00, 0xf0, 0x13, 0x0e,
+    0x01, 0x03, 0x00, 0x30, 0xd4, 0xfe, 0x1e, 0x00, 0xa0, 0x02, 0x83, 0xff, 0x2d, 0x00, 0x02, 0x00,
+    0x06, 0x06, 0x0e, 0x0e, 0x00, 0xf0, 0x06, 0x0d, 0x0e, 0x07, 0x00, 0x20, 0x03, 0x00, 0xb8, 0xff,
+    0x3d, 0x00, 0x02, 0x00, 0x02, 0x11, 0x04, 0x02, 0x00, 0xf0, 0x02, 0x12, 0x04, 0x01, 0x00, 0x20,
+    0xf9, 0xff, 0x49, 0xff, 0x16, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x03, 0x00, 0xf0, 0x00, 0x03,
+    0x01, 0x01, 0x00, 0x30, 0xfa, 0xff, 0x46, 0xff, 0x18, 0x00, 0x02, 0x00, 0x00, 0x0c, 0x01, 0x03,
+    0x00, 0xf0, 0x00, 0x0d, 0x01, 0x01, 0x00, 0x30, 0x07, 0x00, 0xb1, 0xff, 0x2e, 0x00, 0x02, 0x00,
+    0x0f, 0x0f, 0x04, 0x04, 0x00, 0xf0, 0x0f, 0x11, 0x04, 0x02, 0x00, 0x20, 0xd7, 0xfd, 0x4b, 0x00,
+    0xc8, 0xff, 0x02, 0x00, 0x02, 0x05, 0x12, 0x07, 0x00, 0xf0, 0x08, 0x05, 0x06, 0x07, 0x00, 0x30,
+    0xf0, 0xff, 0x56, 0xff, 0x15, 0x00, 0x02, 0x00, 0x01, 0x10, 0x05, 0x03, 0x00, 0xf0, 0x01, 0x11,
+    0x05, 0x01, 0x00, 0x30, 0xf5, 0xff, 0x62, 0xff, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x04, 0x02, 0x03,
+    0x00, 0xf0, 0x00, 0x05, 0x02, 0x01, 0x00, 0x30, 0xfb, 0xff, 0x39, 0x00, 0xcd, 0xff, 0x02, 0x00,
+    0x00, 0x06, 0x02, 0x06, 0x00, 0xf0, 0x01, 0x06, 0x01, 0x06, 0x00, 0x20, 0xf2, 0xff, 0x76, 0xff,
+    0x11, 0x00, 0x02, 0x00, 0x10, 0x0e, 0x04, 0x03, 0x00, 0xf0, 0x10, 0x0f, 0x04, 0x01, 0x00, 0x30,
+    0xaa, 0x00, 0xf0, 0xff, 0x9e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0a, 0x06, 0x00, 0xf0, 0x00, 0x00,
+    0x05, 0x03, 0x00, 0x20, 0x05, 0x03, 0x05, 0x03, 0x00, 0x20, 0xdb, 0xff, 0x3f, 0xff, 0x0d, 0x00,
+    0x02, 0x00, 0x02, 0x02, 0x03, 0x06, 0x00, 0xf0, 0x03, 0x02, 0x01, 0x06, 0x00, 0x30, 0x19, 0x00,
+    0x17, 0x00, 0x8f, 0xff, 0x02, 0x00, 0x02, 0x00, 0x03, 0x0a, 0x00, 0xf0, 0x03, 0x00, 0x01, 0x0a,
+    0x00, 0x30, 0xfc, 0xff, 0x3e, 0x00, 0xd1, 0xff, 0x02, 0x00, 0x05, 0x05, 0x02, 0x02, 0x00, 0xf0,
+    0x05, 0x06, 0x02, 0x01, 0x00, 0x20, 0x2f, 0x00, 0xe2, 0xff, 0x5e, 0x00, 0x02, 0x00, 0x0c, 0x06,
+    0x04, 0x04, 0x00, 0xf0, 0x0c, 0x08, 0x04, 0x02, 0x00, 0x20, 0xdc, 0xff, 0x83, 0xff, 0x1b, 0x00,
+    0x02, 0x00, 0x0d, 0x05, 0x07, 0x03, 0x00, 0xf0, 0x0d, 0x06, 0x07, 0x01, 0x00, 0x30, 0x02, 0x00,
+    0xc9, 0xff, 0x2f, 0x00, 0x02, 0x00, 0x0a, 0x0d, 0x01, 0x02, 0x00, 0xf0, 0x0a, 0x0e, 0x01, 0x01,
+    0x00, 0x20, 0x05, 0x00, 0xda, 0xff, 0x4a, 0x00, 0x02, 0x00, 0x10, 0x10, 0x04, 0x02, 0x00, 0xf0,
+    0x12, 0x10, 0x02, 0x02, 0x00, 0x20, 0xd4, 0xff, 0x6d, 0x00, 0xe6, 0xff, 0x02, 0x00, 0x10, 0x0c,
+    0x04, 0x07, 0x00, 0xf0, 0x12, 0x0c, 0x02, 0x07, 0x00, 0x20, 0x05, 0x00, 0x12, 0x00, 0x5c, 0xff,
+    0x02, 0x00, 0x10, 0x11, 0x01, 0x03, 0x00, 0xf0, 0x10, 0x12, 0x01, 0x01, 0x00, 0x30, 0x09, 0x00,
+    0x0c, 0x00, 0x47, 0xff, 0x02, 0x00, 0x13, 0x09, 0x01, 0x03, 0x00, 0xf0, 0x13, 0x0a, 0x01, 0x01,
+    0x00, 0x30, 0x0b, 0x00, 0xd5, 0xff, 0x3c, 0x00, 0x02, 0x00, 0x12, 0x07, 0x02, 0x06, 0x00, 0xf0,
+    0x13, 0x07, 0x01, 0x06, 0x00, 0x20, 0xe5, 0xff, 0x36, 0xff, 0x0b, 0x00, 0x02, 0x00, 0x08, 0x01,
+    0x03, 0x04, 0x00, 0xf0, 0x09, 0x01, 0x01, 0x04, 0x00, 0x30, 0x3b, 0xff, 0x4e, 0xff, 0x0a, 0x00,
+    0x02, 0x00, 0x0e, 0x00, 0x06, 0x09, 0x00, 0xf0, 0x10, 0x00, 0x02, 0x09, 0x00, 0x30, 0x3e, 0x00,
+    0xe5, 0xff, 0x5d, 0x00, 0x02, 0x00, 0x04, 0x02, 0x0a, 0x02, 0x00, 0xf0, 0x09, 0x02, 0x05, 0x02,
+    0x00, 0x20, 0xe8, 0xff, 0x4f, 0x00, 0xe3, 0xff, 0x03, 0x00, 0x02, 0x0c, 0x08, 0x04, 0x00, 0xf0,
+    0x02, 0x0c, 0x04, 0x02, 0x00, 0x20, 0x06, 0x0e, 0x04, 0x02, 0x00, 0x20, 0x1b, 0x00, 0x14, 0x00,
+    0x89, 0xff, 0x02, 0x00, 0x00, 0x04, 0x07, 0x03, 0x00, 0xf0, 0x00, 0x05, 0x07, 0x01, 0x00, 0x30,
+    0xe0, 0xff, 0x21, 0xff, 0x09, 0x00, 0x02, 0x00, 0x0e, 0x0e, 0x03, 0x03, 0x00, 0xf0, 0x0f, 0x0e,
+    0x01, 0x03, 0x00, 0x30, 0x0f, 0x00, 0xe3, 0xff, 0x54, 0x00, 0x02, 0x00, 0x00, 0x03, 0x04, 0x03,
+    0x00, 0xf0, 0x02, 0x03, 0x02, 0x03, 0x00, 0x20, 0xfc, 0xff, 0x3d, 0x00, 0xd3, 0xff, 0x02, 0x00,
+    0x01, 0x00, 0x02, 0x07, 0x00, 0xf0, 0x02, 0x00, 0x01, 0x07, 0x00, 0x20, 0xf7, 0xfe, 0x2c, 0x00,
+    0x0e, 0x00, 0xc4, 0xff, 0x3f, 0x00, 0x02, 0x00, 0x0f, 0x10, 0x04, 0x04, 0x00, 0xf0, 0x0f, 0x12,
+    0x04, 0x02, 0x00, 0x20, 0x1a, 0x00, 0xb0, 0xff, 0x2f, 0x00, 0x02, 0x00, 0x05, 0x08, 0x0c, 0x04,
+    0x00, 0xf0, 0x05, 0x0a, 0x0c, 0x02, 0x00, 0x20, 0x00, 0x00, 0xba, 0xff, 0x2a, 0x00, 0x02, 0x00,
+    0x03, 0x11, 0x01, 0x02, 0x00, 0xf0, 0x03, 0x12, 0x01, 0x01, 0x00, 0x20, 0xf1, 0xff, 0x71, 0xff,
+    0x1c, 0x00, 0x02, 0x00, 0x06, 0x01, 0x03, 0x04, 0x00, 0xf0, 0x07, 0x01, 0x01, 0x04, 0x00, 0x30,
+    0x0f, 0x00, 0x0a, 0x00, 0x6c, 0xff, 0x02, 0x00, 0x06, 0x02, 0x03, 0x04, 0x00, 0xf0, 0x07, 0x02,
+    0x01, 0x04, 0x00, 0x30, 0x9c, 0xff, 0x2a, 0x00, 0xc0, 0xff, 0x02, 0x00, 0x06, 0x08, 0x09, 0x0c,
+    0x00, 0xf0, 0x09, 0x08, 0x03, 0x0c, 0x00, 0x30, 0xc1, 0x00, 0xe5, 0xff, 0x64, 0x00, 0x02, 0x00,
+    0x08, 0x01, 0x08, 0x06, 0x00, 0xf0, 0x08, 0x03, 0x08, 0x02, 0x00, 0x30, 0x1b, 0x00, 0xd3, 0xff,
+    0x45, 0x00, 0x02, 0x00, 0x0e, 0x02, 0x06, 0x03, 0x00, 0xf0, 0x11, 0x02, 0x03, 0x03, 0x00, 0x20,
+    0xfb, 0xff, 0x76, 0xff, 0x0c, 0x00, 0x02, 0x00, 0x00, 0x06, 0x01, 0x03, 0x00, 0xf0, 0x00, 0x07,
+    0x01, 0x01, 0x00, 0x30, 0xec, 0xff, 0x3e, 0x00, 0xdf, 0xff, 0x02, 0x00, 0x0a, 0x00, 0x0a, 0x02,
+    0x00, 0xf0, 0x0f, 0x00, 0x05, 0x02, 0x00, 0x20, 0x0e, 0x00, 0x11, 0x00, 0x4c, 0xff, 0x02, 0x00,
+    0x0b, 0x00, 0x03, 0x02, 0x00, 0xf0, 0x0c, 0x00, 0x01, 0x02, 0x00, 0x30, 0x08, 0x00, 0xde, 0xff,
+    0x38, 0x00, 0x02, 0x00, 0x03, 0x13, 0x0a, 0x01, 0x00, 0xf0, 0x08, 0x13, 0x05, 0x01, 0x00, 0x20,
+    0x78, 0x00, 0xb7, 0xff, 0x22, 0x00, 0x02, 0x00, 0x00, 0x04, 0x07, 0x10, 0x00, 0xf0, 0x00, 0x0c,
+    0x07, 0x08, 0x00, 0x20, 0xfd, 0xff, 0x6c, 0xff, 0x09, 0x00, 0x02, 0x00, 0x02, 0x10, 0x01, 0x03,
+    0x00, 0xf0, 0x02, 0x11, 0x01, 0x01, 0x00, 0x30, 0x45, 0xfe, 0x65, 0x00, 0xec, 0xff, 0x02, 0x00,
+    0x07, 0x08, 0x0c, 0x06, 0x00, 0xf0, 0x0b, 0x08, 0x04, 0x06, 0x00, 0x30, 0xb7, 0xff, 0x46, 0x00,
+    0xde, 0xff, 0x02, 0x00, 0x0e, 0x09, 0x06, 0x07, 0x00, 0xf0, 0x10, 0x09, 0x02, 0x07, 0x00, 0x30,
+    0x19, 0x00, 0x05, 0x00, 0x33, 0xff, 0x02, 0x00, 0x0c, 0x11, 0x06, 0x01, 0x00, 0xf0, 0x0e, 0x11,
+    0x02, 0x01, 0x00, 0x30, 0xfa, 0xff, 0x6f, 0xff, 0x0a, 0x00, 0x02, 0x00, 0x10, 0x01, 0x03, 0x01,
+    0x00, 0xf0, 0x11, 0x01, 0x01, 0x01, 0x00, 0x30, 0x03, 0x00, 0xda, 0xff, 0x30, 0x00, 0x03, 0x00,
+    0x00, 0x11, 0x08, 0x02, 0x00, 0xf0, 0x00, 0x11, 0x04, 0x01, 0x00, 0x20, 0x04, 0x12, 0x04, 0x01,
+    0x00, 0x20, 0x00, 0x00, 0xd9, 0xff, 0x31, 0x00, 0x02, 0x00, 0x11, 0x00, 0x02, 0x01, 0x00, 0xf0,
+    0x12, 0x00, 0x01, 0x01, 0x00, 0x20, 0xab, 0xff, 0x5f, 0xff, 0x09, 0x00, 0x02, 0x00, 0x04, 0x0f,
+    0x06, 0x05, 0x00, 0xf0, 0x06, 0x0f, 0x02, 0x05, 0x00, 0x30, 0xe7, 0xff, 0x41, 0x00, 0xe5, 0xff,
+    0x02, 0x00, 0x07, 0x02, 0x08, 0x02, 0x00, 0xf0, 0x07, 0x03, 0x08, 0x01, 0x00, 0x20, 0x2c, 0x00,
+    0xe7, 0xff, 0x4d, 0x00, 0x02, 0x00, 0x04, 0x01, 0x08, 0x04, 0x00, 0xf0, 0x04, 0x03, 0x08, 0x02,
+    0x00, 0x20, 0x00, 0x00, 0x30, 0x00, 0xdd, 0xff, 0x02, 0x00, 0x05, 0x13, 0x02, 0x01, 0x00, 0xf0,
+    0x06, 0x13, 0x01, 0x01, 0x00, 0x20, 0x00, 0x00, 0xda, 0xff, 0x37, 0x00, 0x02, 0x00, 0x05, 0x13,
+    0x02, 0x01, 0x00, 0xf0, 0x06, 0x13, 0x01, 0x01, 0x00, 0x20, 0x05, 0x00, 0x0c, 0x00, 0x5c, 0xff,
+    0x02, 0x00, 0x10, 0x11, 0x01, 0x03, 0x00, 0xf0, 0x10, 0x12, 0x01, 0x01, 0x00, 0x30, 0xfd, 0xff,
+    0x2e, 0x00, 0xdd, 0xff, 0x02, 0x00, 0x00, 0x0b, 0x02, 0x03, 0x00, 0xf0, 0x01, 0x0b, 0x01, 0x03,
+    0x00, 0x20, 0x04, 0x00, 0xe5, 0xff, 0x3e, 0x00, 0x02, 0x00, 0x00, 0x13, 0x04, 0x01, 0x00, 0xf0,
+    0x02, 0x13, 0x02, 0x01, 0x00, 0x20, 0xfc, 0xff, 0x45, 0x00, 0xe2, 0xff, 0x02, 0x00, 0x00, 0x12,
+    0x04, 0x02, 0x00, 0xf0, 0x02, 0x12, 0x02, 0x02, 0x00, 0x20, 0xfc, 0xff, 0x4d, 0xff, 0x0a, 0x00,
+    0x02, 0x00, 0x02, 0x11, 0x01, 0x03, 0x00, 0xf0, 0x02, 0x12, 0x01, 0x01, 0x00, 0x30, 0x1f, 0x00,
+    0xe9, 0xff, 0x4f, 0x00, 0x02, 0x00, 0x05, 0x07, 0x0b, 0x02, 0x00, 0xf0, 0x05, 0x08, 0x0b, 0x01,
+    0x00, 0x20, 0xc4, 0xfd, 0xb0, 0x00, 0xf6, 0xff, 0x02, 0x00, 0x09, 0x02, 0x04, 0x0a, 0x00, 0xf0,
+    0x09, 0x07, 0x04, 0x05, 0x00, 0x20, 0x08, 0x00, 0x18, 0x00, 0xb7, 0xff, 0x02, 0x00, 0x00, 0x02,
+    0x04, 0x03, 0x00, 0xf0, 0x00, 0x03, 0x04, 0x01, 0x00, 0x30, 0xf5, 0xff, 0x3d, 0x00, 0xe4, 0xff,
+    0x02, 0x00, 0x0a, 0x13, 0x0a, 0x01, 0x00, 0xf0, 0x0f, 0x13, 0x05, 0x01, 0x00, 0x20, 0x15, 0x00,
+    0xe3, 0xff, 0x3e, 0x00, 0x02, 0x00, 0x0b, 0x11, 0x08, 0x03, 0x00, 0xf0, 0x0f, 0x11, 0x04, 0x03,
+    0x00, 0x20, 0xfb, 0xff, 0x68, 0xff, 0x0c, 0x00, 0x02, 0x00, 0x08, 0x13, 0x03, 0x01, 0x00, 0xf0,
+    0x09, 0x13, 0x01, 0x01, 0x00, 0x30, 0xf1, 0xff, 0x8a, 0xff, 0x0d, 0x00, 0x02, 0x00, 0x0e, 0x00,
+    0x03, 0x04, 0x00, 0xf0, 0x0f, 0x00, 0x01, 0x04, 0x00, 0x30, 0x18, 0x00, 0xee, 0xff, 0x63, 0x00,
+    0x02, 0x00, 0x0a, 0x06, 0x04, 0x03, 0x00, 0xf0, 0x0a, 0x07, 0x04, 0x01, 0x00, 0x30, 0xeb, 0xff,
+    0x43, 0xff, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x08, 0x03, 0x02, 0x00, 0xf0, 0x00, 0x09, 0x03, 0x01,
+    0x00, 0x20, 0x14, 0x00, 0xdd, 0xff, 0x30, 0x00, 0x02, 0x00, 0x07, 0x0c, 0x03, 0x06, 0x00, 0xf0,
+    0x07, 0x0e, 0x03, 0x02, 0x00, 0x30, 0xfe, 0xff, 0x74, 0xff, 0x0c, 0x00, 0x02, 0x00, 0x01, 0x12,
+    0x01, 0x02, 0x00, 0xf0, 0x01, 0x13, 0x01, 0x01, 0x00, 0x20, 0x15, 0x00, 0xeb, 0xff, 0x51, 0x00,
+    0x02, 0x00, 0x00, 0x0c, 0x04, 0x04, 0x00, 0xf0, 0x02, 0x0c, 0x02, 0x04, 0x00, 0x20, 0xc4, 0xff,
+    0x35, 0x00, 0xe1, 0xff, 0x02, 0x00, 0x01, 0x08, 0x06, 0x07, 0x00, 0xf0, 0x03, 0x08, 0x02, 0x07,
+    0x00, 0x30, 0x57, 0xff, 0x2d, 0xff, 0x08, 0x00, 0x02, 0x00, 0x00, 0x08, 0x04, 0x05, 0x00, 0xf0,
+    0x02, 0x08, 0x02, 0x05, 0x00, 0x20, 0xf4, 0xfe, 0x35, 0x00, 0x03, 0x00, 0x15, 0x00, 0x71, 0xff,
+    0x02, 0x00, 0x13, 0x10, 0x01, 0x03, 0x00, 0xf0, 0x13, 0x11, 0x01, 0x01, 0x00, 0x30, 0x1b, 0xff,
+    0x27, 0x00, 0xbb, 0xff, 0x02, 0x00, 0x01, 0x05, 0x12, 0x06, 0x00, 0xf0, 0x07, 0x05, 0x06, 0x06,
+    0x00, 0x30, 0x04, 0x00, 0xcc, 0xff, 0x33, 0x00, 0x02, 0x00, 0x02, 0x0f, 0x04, 0x02, 0x00, 0xf0,
+    0x02, 0x10, 0x04, 0x01, 0x00, 0x20, 0x0b, 0x00, 0xd4, 0xff, 0x36, 0x00, 0x02, 0x00, 0x12, 0x06,
+    0x02, 0x0b, 0x00, 0xf0, 0x13, 0x06, 0x01, 0x0b, 0x00, 0x20, 0xe2, 0xff, 0x68, 0xff, 0x0c, 0x00,
+    0x02, 0x00, 0x00, 0x0c, 0x02, 0x06, 0x00, 0xf0, 0x00, 0x0e, 0x02, 0x02, 0x00, 0x30, 0xfa, 0xff,
+    0x30, 0x00, 0xd8, 0xff, 0x02, 0x00, 0x0c, 0x05, 0x03, 0x02, 0x00, 0xf0, 0x0c, 0x06, 0x03, 0x01,
+    0x00, 0x20, 0x12, 0x00, 0x08, 0x00, 0x51, 0xff, 0x02, 0x00, 0x01, 0x03, 0x02, 0x03, 0x00, 0xf0,
+    0x01, 0x04, 0x02, 0x01, 0x00, 0x30, 0x09, 0x00, 0xc4, 0xff, 0x1c, 0x00, 0x02, 0x00, 0x10, 0x0e,
+    0x04, 0x04, 0x00, 0xf0, 0x10, 0x10, 0x04, 0x02, 0x00, 0x20, 0xa5, 0xfe, 0x3b, 0x00, 0xdd, 0xff,
+    0x02, 0x00, 0x06, 0x08, 0x0c, 0x05, 0x00, 0xf0, 0x0a, 0x08, 0x04, 0x05, 0x00, 0x30, 0xec, 0xff,
+    0x63, 0x00, 0xf2, 0xff, 0x02, 0x00, 0x0d, 0x07, 0x02, 0x07, 0x00, 0xf0, 0x0e, 0x07, 0x01, 0x07,
+    0x00, 0x20, 0xf8, 0xff, 0x2e, 0x00, 0xd3, 0xff, 0x02, 0x00, 0x01, 0x08, 0x02, 0x06, 0x00, 0xf0,
+    0x02, 0x08, 0x01, 0x06, 0x00, 0x20, 0xd6, 0xff, 0x40, 0xff, 0x06, 0x00, 0x02, 0x00, 0x0f, 0x00,
+    0x03, 0x07, 0x00, 0xf0, 0x10, 0x00, 0x01, 0x07, 0x00, 0x30, 0xc9, 0xff, 0x48, 0xff, 0x08, 0x00,
+    0x02, 0x00, 0x04, 0x02, 0x06, 0x02, 0x00, 0xf0, 0x06, 0x02, 0x02, 0x02, 0x00, 0x30, 0xa7, 0xfe,
+    0xaa, 0xff, 0x12, 0x00, 0x02, 0x00, 0x00, 0x09, 0x14, 0x09, 0x00, 0xf0, 0x00, 0x0c, 0x14, 0x03,
+    0x00, 0x30, 0x0a, 0x00, 0xe2, 0xff, 0x39, 0x00, 0x02, 0x00, 0x0a, 0x0e, 0x02, 0x02, 0x00, 0xf0,
+    0x0a, 0x0f, 0x02, 0x01, 0x00, 0x20, 0x40, 0x00, 0xef, 0xff, 0x50, 0x00, 0x02, 0x00, 0x06, 0x05,
+    0x0a, 0x04, 0x00, 0xf0, 0x06, 0x07, 0x0a, 0x02, 0x00, 0x20, 0x09, 0x01, 0xed, 0xff, 0x68, 0x00,
+    0x02, 0x00, 0x06, 0x01, 0x05, 0x09, 0x00, 0xf0, 0x06, 0x04, 0x05, 0x03, 0x00, 0x30, 0x01, 0x00,
+    0x12, 0x00, 0xa8, 0xff, 0x03, 0x00, 0x10, 0x12, 0x02, 0x02, 0x00, 0xf0, 0x10, 0x12, 0x01, 0x01,
+    0x00, 0x20, 0x11, 0x13, 0x01, 0x01, 0x00, 0x20, 0x05, 0x00, 0xd5, 0xff, 0x27, 0x00, 0x02, 0x00,
+    0x00, 0x0e, 0x02, 0x04, 0x00, 0xf0, 0x00, 0x10, 0x02, 0x02, 0x00, 0x20, 0xe9, 0xff, 0x5a, 0x00,
+    0xeb, 0xff, 0x02, 0x00, 0x0a, 0x08, 0x02, 0x05, 0x00, 0xf0, 0x0b, 0x08, 0x01, 0x05, 0x00, 0x20,
+    0xa3, 0xfd, 0x6e, 0x00, 0xf2, 0xff, 0x02, 0x00, 0x03, 0x07, 0x0c, 0x07, 0x00, 0xf0, 0x07, 0x07,
+    0x04, 0x07, 0x00, 0x30, 0xbd, 0xff, 0x3b, 0x00, 0xe5, 0xff, 0x02, 0x00, 0x00, 0x00, 0x06, 0x06,
+    0x00, 0xf0, 0x03, 0x00, 0x03, 0x06, 0x00, 0x20, 0x0c, 0x00, 0xde, 0xff, 0x43, 0x00, 0x02, 0x00,
+    0x01, 0x00, 0x04, 0x04, 0x00, 0xf0, 0x03, 0x00, 0x02, 0x04, 0x00, 0x20, 0x6b, 0xff, 0x60, 0xff,
+    0x0b, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0x08, 0x00, 0xf0, 0x02, 0x00, 0x02, 0x08, 0x00, 0x30,
+    0x00, 0x00, 0x2a, 0x00, 0xd6, 0xff, 0x02, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0xf0, 0x01, 0x00,
+    0x01, 0x01, 0x00, 0x20, 0xf1, 0xff, 0x87, 0xff, 0x0c, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x03,
+    0x00, 0xf0, 0x00, 0x01, 0x03, 0x01, 0x00, 0x30, 0xf0, 0xff, 0x2e, 0x00, 0xdc, 0xff, 0x02, 0x00,
+    0x05, 0x04, 0x02, 0x04, 0x00, 0xf0, 0x05, 0x06, 0x02, 0x02, 0x00, 0x20, 0x51, 0x00, 0xef, 0xff,
+    0x5d, 0x00, 0x02, 0x00, 0x02, 0x0a, 0x09, 0x01, 0x00, 0xf0, 0x05, 0x0a, 0x03, 0x01, 0x00, 0x30,
+    0x03, 0x00, 0x0e, 0x00, 0x8e, 0xff, 0x02, 0x00, 0x01, 0x11, 0x01, 0x03, 0x00, 0xf0, 0x01, 0x12,
+    0x01, 0x01, 0x00, 0x30, 0xfc, 0xff, 0x88, 0xff, 0x0c, 0x00, 0x02, 0x00, 0x00, 0x11, 0x02, 0x03,
+    0x00, 0xf0, 0x00, 0x12, 0x02, 0x01, 0x00, 0x30, 0x40, 0x00, 0xe1, 0xff, 0x34, 0x00, 0x02, 0x00,
+    0x00, 0x0f, 0x10, 0x03, 0x00, 0xf0, 0x08, 0x0f, 0x08, 0x03, 0x00, 0x20, 0xfc, 0xff, 0x33, 0x00,
+    0xe0, 0xff, 0x02, 0x00, 0x00, 0x05, 0x04, 0x01, 0x00, 0xf0, 0x02, 0x05, 0x02, 0x01, 0x00, 0x20,
+    0x3f, 0xfe, 0x23, 0xff, 0x07, 0x00, 0x02, 0x00, 0x01, 0x00, 0x06, 0x14, 0x00, 0xf0, 0x03, 0x00,
+    0x02, 0x14, 0x00, 0x30, 0xdb, 0xff, 0x4b, 0x00, 0xeb, 0xff, 0x03, 0x00, 0x02, 0x05, 0x04, 0x06,
+    0x00, 0xf0, 0x02, 0x05, 0x02, 0x03, 0x00, 0x20, 0x04, 0x08, 0x02, 0x03, 0x00, 0x20, 0x3c, 0x00,
+    0x08, 0x00, 0x3a, 0xff, 0x02, 0x00, 0x09, 0x10, 0x06, 0x03, 0x00, 0xf0, 0x0b, 0x10, 0x02, 0x03,
+    0x00, 0x30, 0xfb, 0xff, 0x3e, 0x00, 0xe3, 0xff, 0x02, 0x00, 0x0b, 0x11, 0x06, 0x01, 0x00, 0xf0,
+    0x0e, 0x11, 0x03, 0x01, 0x00, 0x20, 0xef, 0xff, 0x37, 0x00, 0xdd, 0xff, 0x02, 0x00, 0x03, 0x11,
+    0x0f, 0x02, 0x00, 0xf0, 0x08, 0x11, 0x05, 0x02, 0x00, 0x30, 0x0e, 0x00, 0x0b, 0x00, 0x75, 0xff,
+    0x02, 0x00, 0x12, 0x00, 0x02, 0x03, 0x00, 0xf0, 0x12, 0x01, 0x02, 0x01, 0x00, 0x30, 0xf1, 0xff,
+    0x26, 0x00, 0xda, 0xff, 0x02, 0x00, 0x0d, 0x01, 0x07, 0x04, 0x00, 0xf0, 0x0d, 0x03, 0x07, 0x02,
+    0x00, 0x20, 0x0f, 0x00, 0xea, 0xff, 0x41, 0x00, 0x03, 0x00, 0x0d, 0x06, 0x04, 0x04, 0x00, 0xf0,
+    0x0d, 0x06, 0x02, 0x02, 0x00, 0x20, 0x0f, 0x08, 0x02, 0x02, 0x00, 0x20, 0xf8, 0xff, 0x2c, 0x00,
+    0xdc, 0xff, 0x02, 0x00, 0x11, 0x06, 0x03, 0x04, 0x00, 0xf0, 0x11, 0x08, 0x03, 0x02, 0x00, 0x20,
+    0xf7, 0xff, 0x44, 0x00, 0xec, 0xff, 0x02, 0x00, 0x0e, 0x09, 0x02, 0x02, 0x00, 0xf0, 0x0f, 0x09,
+    0x01, 0x02, 0x00, 0x20, 0x04, 0x00, 0x0b, 0x00, 0x88, 0xff, 0x02, 0x00, 0x11, 0x11, 0x01, 0x03,
+    0x00, 0xf0, 0x11, 0x12, 0x01, 0x01, 0x00, 0x30, 0x07, 0x00, 0xe4, 0xff, 0x34, 0x00, 0x02, 0x00,
+    0x03, 0x13, 0x08, 0x01, 0x00, 0xf0, 0x07, 0x13, 0x04, 0x01, 0x00, 0x20, 0x18, 0x00, 0xd9, 0xff,
+    0x28, 0x00, 0x02, 0x00, 0x00, 0x09, 0x03, 0x06, 0x00, 0xf0, 0x00, 0x0c, 0x03, 0x03, 0x00, 0x20,
+    0x8f, 0xff, 0x1d, 0x00, 0xc8, 0xff, 0x02, 0x00, 0x04, 0x07, 0x0f, 0x05, 0x00, 0xf0, 0x09, 0x07,
+    0x05, 0x05, 0x00, 0x30, 0xc0, 0x00, 0xf6, 0xff, 0x89, 0x00, 0x02, 0x00, 0x06, 0x09, 0x09, 0x05,
+    0x00, 0xf0, 0x09, 0x09, 0x03, 0x05, 0x00, 0x30, 0xe0, 0xff, 0x77, 0xff, 0x0b, 0x00, 0x02, 0x00,
+    0x08, 0x01, 0x06, 0x02, 0x00, 0xf0, 0x0a, 0x01, 0x02, 0x02, 0x00, 0x30, 0xcc, 0xff, 0x3b, 0x00,
+    0xe6, 0xff, 0x02, 0x00, 0x04, 0x00, 0x0c, 0x02, 0x00, 0xf0, 0x0a, 0x00, 0x06, 0x02, 0x00, 0x20,
+    0x60, 0x00, 0xea, 0xff, 0x4e, 0x00, 0x02, 0x00, 0x07, 0x00, 0x0a, 0x03, 0x00, 0xf0, 0x0c, 0x00,
+    0x05, 0x03, 0x00, 0x20, 0x41, 0x00, 0xe1, 0xff, 0x2d, 0x00, 0x02, 0x00, 0x05, 0x00, 0x09, 0x06,
+    0x00, 0xf0, 0x05, 0x02, 0x09, 0x02, 0x00, 0x30, 0x20, 0x00, 0xeb, 0xff, 0x52, 0x00, 0x02, 0x00,
+    0x08, 0x03, 0x06, 0x04, 0x00, 0xf0, 0x08, 0x05, 0x06, 0x02, 0x00, 0x20, 0x17, 0x00, 0x09, 0x00,
+    0x52, 0xff, 0x02, 0x00, 0x11, 0x04, 0x02, 0x03, 0x00, 0xf0, 0x11, 0x05, 0x02, 0x01, 0x00, 0x30,
+    0xe4, 0xfe, 0x33, 0x00, 0x09, 0x00, 0xd6, 0xff, 0x6a, 0x00, 0x02, 0x00, 0x05, 0x02, 0x04, 0x03,
+    0x00, 0xf0, 0x05, 0x03, 0x04, 0x01, 0x00, 0x30, 0x12, 0x00, 0xe1, 0xff, 0x67, 0x00, 0x02, 0x00,
+    0x05, 0x09, 0x02, 0x06, 0x00, 0xf0, 0x06, 0x09, 0x01, 0x06, 0x00, 0x20, 0xfa, 0xff, 0x42, 0x00,
+    0xcd, 0xff, 0x02, 0x00, 0x0e, 0x0a, 0x02, 0x06, 0x00, 0xf0, 0x0f, 0x0a, 0x01, 0x06, 0x00, 0x20,
+    0x0a, 0x00, 0xe5, 0xff, 0x5d, 0x00, 0x02, 0x00, 0x07, 0x04, 0x03, 0x03, 0x00, 0xf0, 0x07, 0x05,
+    0x03, 0x01, 0x00, 0x30, 0x09, 0x00, 0xdd, 0xff, 0x4c, 0x00, 0x03, 0x00, 0x0c, 0x04, 0x08, 0x02,
+    0x00, 0xf0, 0x0c, 0x04, 0x04, 0x01, 0x00, 0x20, 0x10, 0x05, 0x04, 0x01, 0x00, 0x20, 0x17, 0x00,
+    0xed, 0xff, 0x7c, 0x00, 0x02, 0x00, 0x0f, 0x08, 0x01, 0x06, 0x00, 0xf0, 0x0f, 0x0a, 0x01, 0x02,
+    0x00, 0x30, 0x0c, 0x00, 0xe4, 0xff, 0x4a, 0x00, 0x02, 0x00, 0x04, 0x11, 0x0b, 0x03, 0x00, 0xf0,
+    0x04, 0x12, 0x0b, 0x01, 0x00, 0x30, 0x9d, 0xfe, 0xa2, 0xff, 0x12, 0x00, 0x02, 0x00, 0x03, 0x00,
+    0x10, 0x14, 0x00, 0xf0, 0x03, 0x0a, 0x10, 0x0a, 0x00, 0x20, 0x15, 0x00, 0xe5, 0xff, 0x51, 0x00,
+    0x02, 0x00, 0x0c, 0x04, 0x04, 0x06, 0x00, 0xf0, 0x0c, 0x06, 0x04, 0x02, 0x00, 0x30, 0xaf, 0xff,
+    0x78, 0xff, 0x12, 0x00, 0x02, 0x00, 0x0b, 0x00, 0x06, 0x06, 0x00, 0xf0, 0x0d, 0x00, 0x02, 0x06,
+    0x00, 0x30, 0x0f, 0x00, 0xde, 0xff, 0x3a, 0x00, 0x03, 0x00, 0x0d, 0x01, 0x06, 0x04, 0x00, 0xf0,
+    0x0d, 0x01, 0x03, 0x02, 0x00, 0x20, 0x10, 0x03, 0x03, 0x02, 0x00, 0x20, 0x2a, 0x00, 0x16, 0x00,
+    0x86, 0xff, 0x02, 0x00, 0x0b, 0x00, 0x06, 0x04, 0x00, 0xf0, 0x0d, 0x00, 0x02, 0x04, 0x00, 0x30,
+    0xae, 0xff, 0x28, 0x00, 0xd3, 0xff, 0x02, 0x00, 0x08, 0x06, 0x06, 0x09, 0x00, 0xf0, 0x0a, 0x06,
+    0x02, 0x09, 0x00, 0x30, 0xeb, 0xff, 0x51, 0xff, 0x09, 0x00, 0x02, 0x00, 0x07, 0x00, 0x03, 0x04,
+    0x00, 0xf0, 0x08, 0x00, 0x01, 0x04, 0x00, 0x30, 0xf8, 0xff, 0x48, 0x00, 0xe7, 0xff, 0x03, 0x00,
+    0x00, 0x11, 0x0e, 0x02, 0x00, 0xf0, 0x00, 0x11, 0x07, 0x01, 0x00, 0x20, 0x07, 0x12, 0x07, 0x01,
+    0x00, 0x20, 0xff, 0xff, 0xa2, 0xff, 0x14, 0x00, 0x03, 0x00, 0x06, 0x12, 0x02, 0x02, 0x00, 0xf0,
+    0x06, 0x12, 0x01, 0x01, 0x00, 0x20, 0x07, 0x13, 0x01, 0x01, 0x00, 0x20, 0x00, 0x00, 0xae, 0xff,
+    0x13, 0x00, 0x02, 0x00, 0x12, 0x11, 0x01, 0x03, 0x00, 0xf0, 0x12, 0x12, 0x01, 0x01, 0x00, 0x30,
+    0xff, 0xff, 0xad, 0xff, 0x16, 0x00, 0x03, 0x00, 0x11, 0x12, 0x02, 0x02, 0x00, 0xf0, 0x11, 0x12,
+    0x01, 0x01, 0x00, 0x20, 0x12, 0x13, 0x01, 0x01, 0x00, 0x20, 0x1a, 0x00, 0xea, 0xff, 0x51, 0x00,
+    0x02, 0x00, 0x05, 0x07, 0x01, 0x09, 0x00, 0xf0, 0x05, 0x0a, 0x01, 0x03, 0x00, 0x30, 0x2d, 0x00,
+    0x12, 0x00, 0x99, 0xff, 0x02, 0x00, 0x05, 0x03, 0x06, 0x04, 0x00, 0xf0, 0x07, 0x03, 0x02, 0x04,
+    0x00, 0x30, 0xfc, 0xff, 0x42, 0x00, 0xe2, 0xff, 0x03, 0x00, 0x01, 0x09, 0x06, 0x02, 0x00, 0xf0,
+    0x01, 0x09, 0x03, 0x01, 0x00, 0x20, 0x04, 0x0a, 0x03, 0x01, 0x00, 0x20, 0x09, 0x00, 0xeb, 0xff,
+    0x4f, 0x00, 0x02, 0x00, 0x06, 0x09, 0x02, 0x03, 0x00, 0xf0, 0x07, 0x09, 0x01, 0x03, 0x00, 0x20,
+    0xd3, 0xff, 0x31, 0x00, 0xda, 0xff, 0x02, 0x00, 0x06, 0x08, 0x06, 0x0c, 0x00, 0xf0, 0x08, 0x08,
+    0x02, 0x0c, 0x00, 0x30, 0xff, 0xff, 0xaf, 0xff, 0x16, 0x00, 0x03, 0x00, 0x04, 0x12, 0x02, 0x02,
+    0x00, 0xf0, 0x04, 0x12, 0x01, 0x01, 0x00, 0x20, 0x05, 0x13, 0x01, 0x01, 0x00, 0x20, 0x5e, 0x00,
+    0xe7, 0xff, 0x41, 0x00, 0x02, 0x00, 0x09, 0x01, 0x06, 0x06, 0x00, 0xf0, 0x09, 0x03, 0x06, 0x02,
+    0x00, 0x30, 0xf7, 0xff, 0x74, 0x00, 0xf3, 0xff, 0x02, 0x00, 0x06, 0x11, 0x06, 0x02, 0x00, 0xf0,
+    0x06, 0x12, 0x06, 0x01, 0x00, 0x20, 0xfd, 0xff, 0xa6, 0xff, 0x14, 0x00, 0x02, 0x00, 0x03, 0x12,
+    0x10, 0x02, 0x00, 0xf0, 0x03, 0x13, 0x10, 0x01, 0x00, 0x20, 0x06, 0x00, 0x19, 0x00, 0xc9, 0xff,
+    0x02, 0x00, 0x03, 0x00, 0x03, 0x0b, 0x00, 0xf0, 0x04, 0x00, 0x01, 0x0b, 0x00, 0x30, 0x03, 0x00,
+    0x0e, 0x00, 0x99, 0xff, 0x02, 0x00, 0x0d, 0x12, 0x03, 0x01, 0x00, 0xf0, 0x0e, 0x12, 0x01, 0x01,
+    0x00, 0x30, 0xac, 0xff, 0x50, 0x00, 0xec, 0xff, 0x02, 0x00, 0x06, 0x00, 0x09, 0x06, 0x00, 0xf0,
+    0x06, 0x02, 0x09, 0x02, 0x00, 0x30, 0xac, 0xff, 0x45, 0x00, 0xed, 0xff, 0x03, 0x00, 0x01, 0x02,
+    0x0c, 0x04, 0x00, 0xf0, 0x01, 0x02, 0x06, 0x02, 0x00, 0x20, 0x07, 0x04, 0x06, 0x02, 0x00, 0x20,
+    0x58, 0x00, 0x0a, 0x00, 0x68, 0xff, 0x02, 0x00, 0x03, 0x03, 0x06, 0x04, 0x00, 0xf0, 0x05, 0x03,
+    0x02, 0x04, 0x00, 0x30, 0x1a, 0x00, 0xe7, 0xff, 0x3c, 0x00, 0x02, 0x00, 0x0c, 0x00, 0x08, 0x01,
+    0x00, 0xf0, 0x10, 0x00, 0x04, 0x01, 0x00, 0x20, 0xdc, 0xff, 0x7a, 0xff, 0x0b, 0x00, 0x02, 0x00,
+    0x09, 0x00, 0x06, 0x02, 0x00, 0xf0, 0x0b, 0x00, 0x02, 0x02, 0x00, 0x30, 0xda, 0xff, 0x3f, 0x00,
+    0xe8, 0xff, 0x02, 0x00, 0x03, 0x03, 0x0c, 0x01, 0x00, 0xf0, 0x09, 0x03, 0x06, 0x01, 0x00, 0x20,
+    0xf8, 0xff, 0x44, 0x00, 0xe9, 0xff, 0x03, 0x00, 0x02, 0x07, 0x06, 0x02, 0x00, 0xf0, 0x02, 0x07,
+    0x03, 0x01, 0x00, 0x20, 0x05, 0x08, 0x03, 0x01, 0x00, 0x20, 0xf9, 0xff, 0x28, 0x00, 0xd8, 0xff,
+    0x02, 0x00, 0x00, 0x08, 0x04, 0x06, 0x00, 0xf0, 0x00, 0x0a, 0x04, 0x02, 0x00, 0x30, 0xc9, 0xff,
+    0x68, 0x00, 0xf0, 0xff, 0x02, 0x00, 0x09, 0x06, 0x03, 0x07, 0x00, 0xf0, 0x0a, 0x06, 0x01, 0x07,
+    0x00, 0x30, 0xb1, 0xff, 0x2e, 0x00, 0xdd, 0xff, 0x02, 0x00, 0x09, 0x06, 0x06, 0x0d, 0x00, 0xf0,
+    0x0b, 0x06, 0x02, 0x0d, 0x00, 0x30, 0xf3, 0xff, 0x4a, 0x00, 0xec, 0xff, 0x02, 0x00, 0x0b, 0x0c,
+    0x06, 0x01, 0x00, 0xf0, 0x0d, 0x0c, 0x02, 0x01, 0x00, 0x30, 0x01, 0x00, 0xca, 0xff, 0x1c, 0x00,
+    0x02, 0x00, 0x12, 0x09, 0x02, 0x06, 0x00, 0xf0, 0x12, 0x0c, 0x02, 0x03, 0x00, 0x20, 0xe1, 0xff,
+    0x8c, 0xff, 0x0d, 0x00, 0x02, 0x00, 0x11, 0x02, 0x03, 0x09, 0x00, 0xf0, 0x12, 0x02, 0x01, 0x09,
+    0x00, 0x30, 0xde, 0xff, 0x43, 0x00, 0xe8, 0xff, 0x03, 0x00, 0x0d, 0x08, 0x04, 0x06, 0x00, 0xf0,
+    0x0d, 0x08, 0x02, 0x03, 0x00, 0x20, 0x0f, 0x0b, 0x02, 0x03, 0x00, 0x20, 0x71, 0x00, 0xe7, 0xff,
+    0x35, 0x00, 0x02, 0x00, 0x04, 0x02, 0x0c, 0x06, 0x00, 0xf0, 0x0a, 0x02, 0x06, 0x06, 0x00, 0x20,
+    0x20, 0xff, 0x49, 0x00, 0xed, 0xff, 0x02, 0x00, 0x04, 0x0e, 0x10, 0x06, 0x00, 0xf0, 0x0c, 0x0e,
+    0x08, 0x06, 0x00, 0x20, 0x0a, 0x00, 0xe4, 0xff, 0x37, 0x00, 0x02, 0x00, 0x06, 0x13, 0x0a, 0x01,
+    0x00, 0xf0, 0x0b, 0x13, 0x05, 0x01, 0x00, 0x20, 0x00, 0x00, 0xd0, 0xff, 0x24, 0x00, 0x02, 0x00,
+    0x06, 0x11, 0x01, 0x03, 0x00, 0xf0, 0x06, 0x12, 0x01, 0x01, 0x00, 0x30, 0x14, 0x00, 0xed, 0xff,
+    0x4b, 0x00, 0x02, 0x00, 0x04, 0x0e, 0x0a, 0x03, 0x00, 0xf0, 0x04, 0x0f, 0x0a, 0x01, 0x00, 0x30,
+    0x55, 0xfe, 0x33, 0x00, 0xe5, 0xff, 0x02, 0x00, 0x06, 0x00, 0x0c, 0x0c, 0x00, 0xf0, 0x06, 0x04,
+    0x0c, 0x04, 0x00, 0x30, 0xfe, 0xff, 0x2d, 0x00, 0xe2, 0xff, 0x03, 0x00, 0x05, 0x07, 0x04, 0x02,
+    0x00, 0xf0, 0x05, 0x07, 0x02, 0x01, 0x00, 0x20, 0x07, 0x08, 0x02, 0x01, 0x00, 0x20, 0x0d, 0x00,
+    0x0a, 0x00, 0x75, 0xff, 0x02, 0x00, 0x11, 0x05, 0x03, 0x02, 0x00, 0xf0, 0x12, 0x05, 0x01, 0x02,
+    0x00, 0x30, 0xc0, 0xfe, 0x2c, 0x00, 0x15, 0x00, 0xe1, 0xff, 0xa4, 0x00, 0x02, 0x00, 0x08, 0x0d,
+    0x06, 0x03, 0x00, 0xf0, 0x08, 0x0e, 0x06, 0x01, 0x00, 0x30, 0xf6, 0xff, 0x83, 0x00, 0xe4, 0xff,
+    0x02, 0x00, 0x08, 0x0d, 0x05, 0x03, 0x00, 0xf0, 0x08, 0x0e, 0x05, 0x01, 0x00, 0x30, 0xf5, 0xff,
+    0x7f, 0xff, 0x1d, 0x00, 0x02, 0x00, 0x0d, 0x02, 0x01, 0x12, 0x00, 0xf0, 0x0d, 0x0b, 0x01, 0x09,
+    0x00, 0x20, 0x9f, 0xff, 0x5f, 0x00, 0xdb, 0xff, 0x02, 0x00, 0x06, 0x0a, 0x09, 0x02, 0x00, 0xf0,
+    0x09, 0x0a, 0x03, 0x02, 0x00, 0x30, 0x52, 0x00, 0xd4, 0xff, 0x7a, 0x00, 0x02, 0x00, 0x0b, 0x00,
+    0x07, 0x04, 0x00, 0xf0, 0x0b, 0x02, 0x07, 0x02, 0x00, 0x20, 0xa8, 0xff, 0x90, 0xff, 0x22, 0x00,
+    0x02, 0x00, 0x01, 0x00, 0x06, 0x08, 0x00, 0xf0, 0x03, 0x00, 0x02, 0x08, 0x00, 0x30, 0x0b, 0x00,
+    0xe0, 0xff, 0x77, 0x00, 0x02, 0x00, 0x09, 0x0f, 0x03, 0x03, 0x00, 0xf0, 0x09, 0x10, 0x03, 0x01,
+    0x00, 0x30, 0x0b, 0x00, 0xea, 0xff, 0x5e, 0x00, 0x02, 0x00, 0x09, 0x11, 0x09, 0x03, 0x00, 0xf0,
+    0x09, 0x12, 0x09, 0x01, 0x00, 0x30, 0x0d, 0x00, 0xeb, 0xff, 0x84, 0x00, 0x02, 0x00, 0x0c, 0x0c,
+    0x03, 0x03, 0x00, 0xf0, 0x0c, 0x0d, 0x03, 0x01, 0x00, 0x30, 0xf2, 0xff, 0x8f, 0xff, 0x17, 0x00,
+    0x02, 0x00, 0x04, 0x01, 0x03, 0x05, 0x00, 0xf0, 0x05, 0x01, 0x01, 0x05, 0x00, 0x30, 0x07, 0x00,
+    0xe4, 0xff, 0x64, 0x00, 0x02, 0x00, 0x0a, 0x0e, 0x02, 0x03, 0x00, 0xf0, 0x0a, 0x0f, 0x02, 0x01,
+    0x00, 0x30, 0xff, 0xff, 0xa0, 0xff, 0x1f, 0x00, 0x03, 0x00, 0x12, 0x11, 0x02, 0x02, 0x00, 0xf0,
+    0x12, 0x11, 0x01, 0x01, 0x00, 0x20, 0x13, 0x12, 0x01, 0x01, 0x00, 0x20, 0x00, 0x00, 0x13, 0x00,
+    0x98, 0xff, 0x03, 0x00, 0x12, 0x12, 0x02, 0x02, 0x00, 0xf0, 0x12, 0x12, 0x01, 0x01, 0x00, 0x20,
+    0x13, 0x13, 0x01, 0x01, 0x00, 0x20, 0xff, 0xff, 0xac, 0xff, 0x1c, 0x00, 0x03, 0x00, 0x12, 0x12,
+    0x02, 0x02, 0x00, 0xf0, 0x12, 0x12, 0x01, 0x01, 0x00, 0x20, 0x13, 0x13, 0x01, 0x01, 0x00, 0x20,
+    0x52, 0x00, 0xf1, 0xff, 0x8f, 0x00, 0x02, 0x00, 0x04, 0x0a, 0x09, 0x01, 0x00, 0xf0, 0x07, 0x0a,
+    0x03, 0x01, 0x00, 0x30, 0x96, 0x00, 0xf1, 0xff, 0x85, 0x00, 0x02, 0x00, 0x03, 0x09, 0x06, 0x05,
+    0x00, 0xf0, 0x05, 0x09, 0x02, 0x05, 0x00, 0x30, 0x05, 0x00, 0xa6, 0xff, 0x1b, 0x00, 0x02, 0x00,
+    0x12, 0x08, 0x01, 0x0c, 0x00, 0xf0, 0x12, 0x0e, 0x01, 0x06, 0x00, 0x20, 0xc2, 0xff, 0x3a, 0x00,
+    0xd7, 0xff, 0x03, 0x00, 0x00, 0x02, 0x08, 0x06, 0x00, 0xf0, 0x00, 0x02, 0x04, 0x03, 0x00, 0x20,
+    0x04, 0x05, 0x04, 0x03, 0x00, 0x20, 0x13, 0x00, 0xf2, 0xff, 0x7b, 0x00, 0x02, 0x00, 0x09, 0x04,
+    0x03, 0x03, 0x00, 0xf0, 0x09, 0x05, 0x03, 0x01, 0x00, 0x30, 0x00, 0x00, 0xb2, 0xff, 0x1b, 0x00,
+    0x03, 0x00, 0x03, 0x12, 0x02, 0x02, 0x00, 0xf0, 0x03, 0x12, 0x01, 0x01, 0x00, 0x20, 0x04, 0x13,
+    0x01, 0x01, 0x00, 0x20, 0xf2, 0xff, 0x62, 0x00, 0xe9, 0xff, 0x02, 0x00, 0x06, 0x04, 0x04, 0x03,
+    0x00, 0xf0, 0x06, 0x05, 0x04, 0x01, 0x00, 0x30, 0x04, 0x00, 0xe4, 0xff, 0x4f, 0x00, 0x03, 0x00,
+    0x10, 0x07, 0x04, 0x02, 0x00, 0xf0, 0x10, 0x07, 0x02, 0x01, 0x00, 0x20, 0x12, 0x08, 0x02, 0x01,
+    0x00, 0x20, 0x00, 0x00, 0xcd, 0xff, 0x27, 0x00, 0x02, 0x00, 0x05, 0x11, 0x01, 0x03, 0x00, 0xf0,
+    0x05, 0x12, 0x01, 0x01, 0x00, 0x30, 0x30, 0x02, 0xc9, 0xff, 0x24, 0x00, 0x02, 0x00, 0x02, 0x00,
+    0x0f, 0x14, 0x00, 0xf0, 0x02, 0x0a, 0x0f, 0x0a, 0x00, 0x20, 0xd0, 0xff, 0x6f, 0x00, 0xed, 0xff,
+    0x03, 0x00, 0x08, 0x0b, 0x06, 0x04, 0x00, 0xf0, 0x08, 0x0b, 0x03, 0x02, 0x00, 0x20, 0x0b, 0x0d,
+    0x03, 0x02, 0x00, 0x20, 0x10, 0x00, 0xf4, 0xff, 0x96, 0x00, 0x02, 0x00, 0x08, 0x10, 0x04, 0x03,
+    0x00, 0xf0, 0x08, 0x11, 0x04, 0x01, 0x00, 0x30, 0xff, 0xff, 0x9f, 0xff, 0x17, 0x00, 0x03, 0x00,
+    0x08, 0x12, 0x02, 0x02, 0x00, 0xf0, 0x08, 0x12, 0x01, 0x01, 0x00, 0x20, 0x09, 0x13, 0x01, 0x01,
+    0x00, 0x20, 0xed, 0xff, 0x7c, 0x00, 0xee, 0xff, 0x02, 0x00, 0x02, 0x10, 0x0d, 0x03, 0x00, 0xf0,
+    0x02, 0x11, 0x0d, 0x01, 0x00, 0x30, 0xff, 0xff, 0xa5, 0xff, 0x1b, 0x00, 0x03, 0x00, 0x10, 0x10,
+    0x02, 0x02, 0x00, 0xf0, 0x10, 0x10, 0x01, 0x01, 0x00, 0x20, 0x11, 0x11, 0x01, 0x01, 0x00, 0x20,
+    0x2a, 0x00, 0x0d, 0x00, 0x6e, 0xff, 0x02, 0x00, 0x08, 0x01, 0x06, 0x03, 0x00, 0xf0, 0x0a, 0x01,
+    0x02, 0x03, 0x00, 0x30, 0xfd, 0xff, 0x73, 0x00, 0xeb, 0xff, 0x03, 0x00, 0x10, 0x07, 0x02, 0x02,
+    0x00, 0xf0, 0x10, 0x07, 0x01, 0x01, 0x00, 0x20, 0x11, 0x08, 0x01, 0x01, 0x00, 0x20, 0x05, 0x00,
+    0xe8, 0xff, 0x50, 0x00, 0x03, 0x00, 0x0e, 0x07, 0x04, 0x02, 0x00, 0xf0, 0x0e, 0x07, 0x02, 0x01,
+    0x00, 0x20, 0x10, 0x08, 0x02, 0x01, 0x00, 0x20, 0x46, 0x00, 0xec, 0xff, 0x5c, 0x00, 0x02, 0x00,
+    0x04, 0x00, 0x0e, 0x01, 0x00, 0xf0, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x20, 0x0a, 0x00, 0xe3, 0xff,
+    0x38, 0x00, 0x03, 0x00, 0x0a, 0x04, 0x08, 0x02, 0x00, 0xf0, 0x0a, 0x04, 0x04, 0x01, 0x00, 0x20,
+    0x0e, 0x05, 0x04, 0x01, 0x00, 0x20, 0x05, 0x00, 0x11, 0x00, 0xa2, 0xff, 0x02, 0x00, 0x08, 0x02,
+    0x03, 0x02, 0x00, 0xf0, 0x09, 0x02, 0x01, 0x02, 0x00, 0x30, 0x13, 0x00, 0xf0, 0xff, 0x62, 0x00,
+    0x02, 0x00, 0x0c, 0x0b, 0x06, 0x03, 0x00, 0xf0, 0x0c, 0x0c, 0x06, 0x01, 0x00, 0x30, 0xe7, 0xff,
+    0x4b, 0xff, 0x09, 0x00, 0x02, 0x00, 0x01, 0x05, 0x01, 0x04, 0x00, 0xf0, 0x01, 0x07, 0x01, 0x02,
+    0x00, 0x20, 0xf3, 0xff, 0x23, 0x00, 0xc5, 0xff, 0x02, 0x00, 0x01, 0x01, 0x01, 0x12, 0x00, 0xf0,
+    0x01, 0x07, 0x01, 0x06, 0x00, 0x30, 0x0d, 0x00, 0xdf, 0xff, 0x3a, 0x00, 0x02, 0x00, 0x0b, 0x0d,
+    0x03, 0x02, 0x00, 0xf0, 0x0b, 0x0e, 0x03, 0x01, 0x00, 0x20, 0xe9, 0xff, 0x61, 0x00, 0xef, 0xff,
+    0x03, 0x00, 0x00, 0x01, 0x0c, 0x02, 0x00, 0xf0, 0x00, 0x01, 0x06, 0x01, 0x00, 0x20, 0x06, 0x02,
+    0x06, 0x01, 0x00, 0x20, 0x00, 0x00, 0xb1, 0xff, 0x15, 0x00, 0x03, 0x00, 0x0a, 0x12, 0x02, 0x02,
+    0x00, 0xf0, 0x0a, 0x12, 0x01, 0x01, 0x00, 0x20, 0x0b, 0x13, 0x01, 0x01, 0x00, 0x20, 0xf0, 0xff,
+    0x42, 0x00, 0xe6, 0xff, 0x03, 0x00, 0x04, 0x05, 0x04, 0x04, 0x00, 0xf0, 0x04, 0x05, 0x02, 0x02,
+    0x00, 0x20, 0x06, 0x07, 0x02, 0x02, 0x00, 0x20, 0x05, 0x00, 0xf2, 0xff, 0x7a, 0x00, 0x02, 0x00,
+    0x06, 0x07, 0x01, 0x03, 0x00, 0xf0, 0x06, 0x08, 0x01, 0x01, 0x00, 0x30, 0xfc, 0xff, 0x25, 0x00,
+    0xd4, 0xff, 0x02, 0x00, 0x0e, 0x0a, 0x06, 0x02, 0x00, 0xf0, 0x10, 0x0a, 0x02, 0x02, 0x00, 0x30,
+    0xe2, 0xfe, 0x48, 0x00, 0xf3, 0xff, 0x55, 0x00, 0xd6, 0xff, 0x02, 0x00, 0x10, 0x08, 0x03, 0x06,
+    0x00, 0xf0, 0x11, 0x08, 0x01, 0x06, 0x00, 0x30, 0x65, 0x00, 0xee, 0xff, 0x91, 0x00, 0x02, 0x00,
+    0x04, 0x0a, 0x06, 0x02, 0x00, 0xf0, 0x06, 0x0a, 0x02, 0x02, 0x00, 0x30, 0xe1, 0xff, 0x76, 0x00,
+    0xe9, 0xff, 0x02, 0x00, 0x06, 0x05, 0x03, 0x07, 0x00, 0xf0, 0x07, 0x05, 0x01, 0x07, 0x00, 0x30,
+    0x20, 0x00, 0xba, 0xff, 0x21, 0x00, 0x02, 0x00, 0x00, 0x0d, 0x06, 0x06, 0x00, 0xf0, 0x00, 0x10,
+    0x06, 0x03, 0x00, 0x20, 0xd4, 0xff, 0x39, 0x00, 0xda, 0xff, 0x02, 0x00, 0x0c, 0x05, 0x01, 0x09,
+    0x00, 0xf0, 0x0c, 0x08, 0x01, 0x03, 0x00, 0x30, 0xf2, 0xff, 0x63, 0x00, 0xf0, 0xff, 0x02, 0x00,
+    0x05, 0x09, 0x03, 0x03, 0x00, 0xf0, 0x06, 0x09, 0x01, 0x03, 0x00, 0x30, 0x81, 0xff, 0x3d, 0x00,
+    0xe3, 0xff, 0x02, 0x00, 0x07, 0x05, 0x06, 0x0d, 0x00, 0xf0, 0x09, 0x05, 0x02, 0x0d, 0x00, 0x30,
+    0x04, 0x00, 0xb8, 0xff, 0x21, 0x00, 0x02, 0x00, 0x13, 0x08, 0x01, 0x0a, 0x00, 0xf0, 0x13, 0x0d,
+    0x01, 0x05, 0x00, 0x20, 0x0d, 0x00, 0x08, 0x00, 0x7d, 0xff, 0x02, 0x00, 0x0b, 0x12, 0x06, 0x01,
+    0x00, 0xf0, 0x0d, 0x12, 0x02, 0x01, 0x00, 0x30, 0x8e, 0xff, 0x3d, 0x00, 0xdf, 0xff, 0x02, 0x00,
+    0x09, 0x07, 0x06, 0x0c, 0x00, 0xf0, 0x0b, 0x07, 0x02, 0x0c, 0x00, 0x30, 0xa2, 0xff, 0x63, 0x00,
+    0xec, 0xff, 0x02, 0x00, 0x0c, 0x07, 0x06, 0x06, 0x00, 0xf0, 0x0e, 0x07, 0x02, 0x06, 0x00, 0x30,
+    0xf0, 0xff, 0x4e, 0x00, 0xee, 0xff, 0x02, 0x00, 0x0f, 0x08, 0x03, 0x04, 0x00, 0xf0, 0x10, 0x08,
+    0x01, 0x04, 0x00, 0x30, 0x0c, 0x00, 0xdd, 0xff, 0x30, 0x00, 0x02, 0x00, 0x06, 0x0b, 0x04, 0x02,
+    0x00, 0xf0, 0x06, 0x0c, 0x04, 0x01, 0x00, 0x20, 0xd4, 0xff, 0x2a, 0x00, 0xd8, 0xff, 0x02, 0x00,
+    0x01, 0x06, 0x06, 0x08, 0x00, 0xf0, 0x03, 0x06, 0x02, 0x08, 0x00, 0x30, 0xb6, 0xff, 0x5f, 0xff,
+    0x0a, 0x00, 0x02, 0x00, 0x0b, 0x0f, 0x06, 0x05, 0x00, 0xf0, 0x0d, 0x0f, 0x02, 0x05, 0x00, 0x30,
+    0x02, 0x00, 0xd1, 0xff, 0x22, 0x00, 0x02, 0x00, 0x0f, 0x11, 0x04, 0x02, 0x00, 0xf0, 0x0f, 0x12,
+    0x04, 0x01, 0x00, 0x20, 0x2c, 0x00, 0xfa, 0xff, 0x9c, 0x00, 0x02, 0x00, 0x0d, 0x0b, 0x06, 0x01,
+    0x00, 0xf0, 0x0f, 0x0b, 0x02, 0x01, 0x00, 0x30, 0xff, 0xff, 0xb4, 0xff, 0x12, 0x00, 0x03, 0x00,
+    0x05, 0x12, 0x02, 0x02, 0x00, 0xf0, 0x05, 0x12, 0x01, 0x01, 0x00, 0x20, 0x06, 0x13, 0x01, 0x01,
+    0x00, 0x20, 0xf2, 0xff, 0x43, 0x00, 0xec, 0xff, 0x03, 0x00, 0x04, 0x08, 0x04, 0x04, 0x00, 0xf0,
+    0x04, 0x08, 0x02, 0x02, 0x00, 0x20, 0x06, 0x0a, 0x02, 0x02, 0x00, 0x20, 0xb0, 0xff, 0x69, 0xff,
+    0x0a, 0x00, 0x02, 0x00, 0x0b, 0x07, 0x09, 0x03, 0x00, 0xf0, 0x0b, 0x08, 0x09, 0x01, 0x00, 0x30,
+    0xd4, 0xff, 0x29, 0x00, 0xe0, 0xff, 0x03, 0x00, 0x00, 0x03, 0x0a, 0x04, 0x00, 0xf0, 0x00, 0x03,
+    0x05, 0x02, 0x00, 0x20, 0x05, 0x05, 0x05, 0x02, 0x00, 0x20, 0xef, 0xff, 0x6d, 0xff, 0x09, 0x00,
+    0x02, 0x00, 0x07, 0x12, 0x06, 0x01, 0x00, 0xf0, 0x09, 0x12, 0x02, 0x01, 0x00, 0x30, 0x06, 0x00,
+    0x0f, 0x00, 0xb3, 0xff, 0x02, 0x00, 0x00, 0x08, 0x03, 0x03, 0x00, 0xf0, 0x00, 0x09, 0x03, 0x01,
+    0x00, 0x30, 0x40, 0x00, 0xee, 0xff, 0x4b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x06, 0x08, 0x00, 0xf0,
+    0x00, 0x00, 0x03, 0x04, 0x00, 0x20, 0x03, 0x04, 0x03, 0x04, 0x00, 0x20, 0xd3, 0xff, 0x64, 0x00,
+    0xf4, 0xff, 0x02, 0x00, 0x07, 0x06, 0x03, 0x08, 0x00, 0xf0, 0x08, 0x06, 0x01, 0x08, 0x00, 0x30,
+    0x24, 0x00, 0x09, 0x00, 0x83, 0xff, 0x02, 0x00, 0x0d, 0x07, 0x07, 0x03, 0x00, 0xf0, 0x0d, 0x08,
+    0x07, 0x01, 0x00, 0x30, 0xfd, 0xff, 0x2d, 0x00, 0xe4, 0xff, 0x02, 0x00, 0x03, 0x03, 0x02, 0x02,
+    0x00, 0xf0, 0x03, 0x04, 0x02, 0x01, 0x00, 0x20, 0xf4, 0xff, 0x8f, 0xff, 0x0d, 0x00, 0x02, 0x00,
+    0x00, 0x03, 0x03, 0x03, 0x00, 0xf0, 0x00, 0x04, 0x03, 0x01, 0x00, 0x30, 0x19, 0x00, 0xf3, 0xff,
+    0x5f, 0x00, 0x02, 0x00, 0x09, 0x03, 0x05, 0x02, 0x00, 0xf0, 0x09, 0x04, 0x05, 0x01, 0x00, 0x20,
+    0x54, 0x00, 0x0e, 0x00, 0xa2, 0xff, 0x02, 0x00, 0x06, 0x05, 0x09, 0x04, 0x00, 0xf0, 0x09, 0x05,
+    0x03, 0x04, 0x00, 0x30, 0x98, 0x01, 0xf7, 0xff, 0x94, 0x00, 0x02, 0x00, 0x03, 0x0a, 0x0c, 0x03,
+    0x00, 0xf0, 0x07, 0x0a, 0x04, 0x03, 0x00, 0x30, 0xe6, 0xff, 0x48, 0x00, 0xf1, 0xff, 0x02, 0x00,
+    0x08, 0x07, 0x03, 0x06, 0x00, 0xf0, 0x09, 0x07, 0x01, 0x06, 0x00, 0x30, 0x07, 0xff, 0x7e, 0xff,
+    0x09, 0x00, 0x02, 0x00, 0x05, 0x05, 0x06, 0x05, 0x00, 0xf0, 0x08, 0x05, 0x03, 0x05, 0x00, 0x20,
+    0xf4, 0xff, 0x86, 0xff, 0x09, 0x00, 0x02, 0x00, 0x00, 0x05, 0x02, 0x03, 0x00, 0xf0, 0x00, 0x06,
+    0x02, 0x01, 0x00, 0x30, 0xd8, 0xff, 0x67, 0x00, 0xf4, 0xff, 0x02, 0x00, 0x09, 0x07, 0x03, 0x04,
+    0x00, 0xf0, 0x0a, 0x07, 0x01, 0x04, 0x00, 0x30, 0xae, 0xfe, 0x4c, 0xff, 0x07, 0x00, 0x02, 0x00,
+    0x01, 0x00, 0x06, 0x0f, 0x00, 0xf0, 0x03, 0x00, 0x02, 0x0f, 0x00, 0x30, 0x14, 0x00, 0x07, 0x00,
+    0x79, 0xff, 0x02, 0x00, 0x0f, 0x01, 0x03, 0x05, 0x00, 0xf0, 0x10, 0x01, 0x01, 0x05, 0x00, 0x30,
+    0x19, 0x00, 0xf3, 0xff, 0x54, 0x00, 0x02, 0x00, 0x09, 0x02, 0x03, 0x0a, 0x00, 0xf0, 0x0a, 0x02,
+    0x01, 0x0a, 0x00, 0x30, 0xf3, 0xff, 0x17, 0x00, 0xc9, 0xff, 0x02, 0x00, 0x08, 0x08, 0x06, 0x0c,
+    0x00, 0xf0, 0x0a, 0x08, 0x02, 0x0c, 0x00, 0x30, 0xf6, 0xff, 0x22, 0x00, 0xdd, 0xff, 0x02, 0x00,
+    0x10, 0x04, 0x03, 0x04, 0x00, 0xf0, 0x10, 0x06, 0x03, 0x02, 0x00, 0x20, 0x03, 0x00, 0xef, 0xff,
+    0x55, 0x00, 0x03, 0x00, 0x10, 0x07, 0x02, 0x02, 0x00, 0xf0, 0x10, 0x07, 0x01, 0x01, 0x00, 0x20,
+    0x11, 0x08, 0x01, 0x01, 0x00, 0x20, 0x64, 0xff, 0x4b, 0x00, 0xef, 0xff, 0x02, 0x00, 0x0d, 0x00,
+    0x06, 0x09, 0x00, 0xf0, 0x0d, 0x03, 0x06, 0x03, 0x00, 0x30, 0x00, 0x00, 0xd6, 0xff, 0x1f, 0x00,
+    0x02, 0x00, 0x07, 0x11, 0x01, 0x03, 0x00, 0xf0, 0x07, 0x12, 0x01, 0x01, 0x00, 0x30, 0x06, 0x00,
+    0xe9, 0xff, 0x36, 0x00, 0x02, 0x00, 0x0c, 0x01, 0x04, 0x02, 0x00, 0xf0, 0x0c, 0x02, 0x04, 0x01,
+    0x00, 0x20, 0x05, 0x00, 0x10, 0x00, 0xa4, 0xff, 0x02, 0x00, 0x11, 0x03, 0x01, 0x03, 0x00, 0xf0,
+    0x11, 0x04, 0x01, 0x01, 0x00, 0x30, 0x28, 0x00, 0x05, 0x00, 0x31, 0xff, 0x02, 0x00, 0x00, 0x10,
+    0x09, 0x03, 0x00, 0xf0, 0x00, 0x11, 0x09, 0x01, 0x00, 0x30, 0xfa, 0xff, 0x41, 0x00, 0xef, 0xff,
+    0x03, 0x00, 0x03, 0x06, 0x02, 0x04, 0x00, 0xf0, 0x03, 0x06, 0x01, 0x02, 0x00, 0x20, 0x04, 0x08,
+    0x01, 0x02, 0x00, 0x20, 0x08, 0x00, 0x05, 0x00, 0x29, 0xff, 0x02, 0x00, 0x0d, 0x12, 0x03, 0x01,
+    0x00, 0xf0, 0x0e, 0x12, 0x01, 0x01, 0x00, 0x30, 0xf2, 0xff, 0x45, 0x00, 0xed, 0xff, 0x02, 0x00,
+    0x00, 0x12, 0x04, 0x02, 0x00, 0xf0, 0x02, 0x12, 0x02, 0x02, 0x00, 0x20, 0x01, 0x00, 0xe5, 0xff,
+    0x3a, 0x00, 0x02, 0x00, 0x01, 0x13, 0x02, 0x01, 0x00, 0xf0, 0x02, 0x13, 0x01, 0x01, 0x00, 0x20,
+    0xfe, 0xff, 0xb4, 0xff, 0x10, 0x00, 0x02, 0x00, 0x00, 0x12, 0x04, 0x02, 0x00, 0xf0, 0x00, 0x13,
+    0x04, 0x01, 0x00, 0x20, 0xff, 0xff, 0xbb, 0xff, 0x11, 0x00, 0x02, 0x00, 0x02, 0x11, 0x01, 0x03,
+    0x00, 0xf0, 0x02, 0x12, 0x01, 0x01, 0x00, 0x30, 0x1c, 0x00, 0xf2, 0xff, 0x5d, 0x00, 0x02, 0x00,
+    0x04, 0x08, 0x03, 0x05, 0x00, 0xf0, 0x05, 0x08, 0x01, 0x05, 0x00, 0x30, 0x34, 0x00, 0x11, 0x00,
+    0xb7, 0xff, 0x02, 0x00, 0x02, 0x01, 0x06, 0x07, 0x00, 0xf0, 0x04, 0x01, 0x02, 0x07, 0x00, 0x30,
+    0xfa, 0xff, 0x34, 0x00, 0xe7, 0xff, 0x03, 0x00, 0x03, 0x06, 0x02, 0x08, 0x00, 0xf0, 0x03, 0x06,
+    0x01, 0x04, 0x00, 0x20, 0x04, 0x0a, 0x01, 0x04, 0x00, 0x20, 0xf1, 0x01, 0xe8, 0xff, 0x32, 0x00,
+    0x02, 0x00, 0x04, 0x05, 0x0b, 0x0a, 0x00, 0xf0, 0x04, 0x0a, 0x0b, 0x05, 0x00, 0x20, 0x33, 0xff,
+    0x48, 0x00, 0xef, 0xff, 0x02, 0x00, 0x00, 0x0d, 0x14, 0x02, 0x00, 0xf0, 0x0a, 0x0d, 0x0a, 0x02,
+    0x00, 0x20, 0x80, 0x00, 0xea, 0xff, 0x36, 0x00, 0x02, 0x00, 0x01, 0x0d, 0x10, 0x03, 0x00, 0xf0,
+    0x09, 0x0d, 0x08, 0x03, 0x00, 0x20, 0x07, 0x00, 0xe3, 0xff, 0x2a, 0x00, 0x03, 0x00, 0x10, 0x04,
+    0x04, 0x04, 0x00, 0xf0, 0x10, 0x04, 0x02, 0x02, 0x00, 0x20, 0x12, 0x06, 0x02, 0x02, 0x00, 0x20,
+    0xe9, 0xff, 0x3c, 0x00, 0xe9, 0xff, 0x03, 0x00, 0x10, 0x00, 0x04, 0x0c, 0x00, 0xf0, 0x10, 0x00,
+    0x02, 0x06, 0x00, 0x20, 0x12, 0x06, 0x02, 0x06, 0x00, 0x20, 0x00, 0x00, 0x2d, 0x00, 0xe5, 0xff,
+    0x02, 0x00, 0x0e, 0x0f, 0x03, 0x01, 0x00, 0xf0, 0x0f, 0x0f, 0x01, 0x01, 0x00, 0x30, 0xd7, 0xfc,
+    0x74, 0x00, 0xf6, 0xff, 0x02, 0x00, 0x03, 0x04, 0x0c, 0x0a, 0x00, 0xf0, 0x03, 0x09, 0x0c, 0x05,
+    0x00, 0x20, 0x00, 0x00, 0xc4, 0xff, 0x13, 0x00, 0x03, 0x00, 0x09, 0x12, 0x02, 0x02, 0x00, 0xf0,
+    0x09, 0x12, 0x01, 0x01, 0x00, 0x20, 0x0a, 0x13, 0x01, 0x01, 0x00, 0x20, 0x00, 0x00, 0x14, 0x00,
+    0xb7, 0xff, 0x03, 0x00, 0x09, 0x12, 0x02, 0x02, 0x00, 0xf0, 0x09, 0x12, 0x01, 0x01, 0x00, 0x20,
+    0x0a, 0x13, 0x01, 0x01, 0x00, 0x20, 0x29, 0x00, 0xf6, 0xff, 0x7a, 0x00, 0x03, 0x00, 0x0d, 0x04,
+    0x02, 0x0e, 0x00, 0xf0, 0x0d, 0x04, 0x01, 0x07, 0x00, 0x20, 0x0e, 0x0b, 0x01, 0x07, 0x00, 0x20,
+    0xe3, 0xff, 0x2c, 0x00, 0xe7, 0xff, 0x02, 0x00, 0x04, 0x02, 0x06, 0x04, 0x00, 0xf0, 0x07, 0x02,
+    0x03, 0x04, 0x00, 0x20, 0xe1, 0x03, 0x0d, 0x00, 0xae, 0xff, 0x03, 0x00, 0x00, 0x00, 0x12, 0x14,
+    0x00, 0xf0, 0x00, 0x00, 0x09, 0x0a, 0x00, 0x20, 0x09, 0x0a, 0x09, 0x0a, 0x00, 0x20, 0x02, 0x00,
+    0xe3, 0xff, 0x25, 0x00, 0x02, 0x00, 0x0f, 0x0b, 0x01, 0x02, 0x00, 0xf0, 0x0f, 0x0c, 0x01, 0x01,
+    0x00, 0x20, 0x0e, 0x00, 0xf6, 0xff, 0x88, 0x00, 0x03, 0x00, 0x10, 0x0a, 0x02, 0x04, 0x00, 0xf0,
+    0x10, 0x0a, 0x01, 0x02, 0x00, 0x20, 0x11, 0x0c, 0x01, 0x02, 0x00, 0x20, 0x00, 0x00, 0x11, 0x00,
+    0xbb, 0xff, 0x03, 0x00, 0x12, 0x11, 0x02, 0x02, 0x00, 0xf0, 0x12, 0x11, 0x01, 0x01, 0x00, 0x20,
+    0x13, 0x12, 0x01, 0x01, 0x00, 0x20, 0xfe, 0xff, 0x57, 0x00, 0xf2, 0xff, 0x02, 0x00, 0x09, 0x11,
+    0x01, 0x02, 0x00, 0xf0, 0x09, 0x12, 0x01, 0x01, 0x00, 0x20, 0xe5, 0xff, 0x1e, 0x00, 0xda, 0xff,
+    0x02, 0x00, 0x08, 0x04, 0x09, 0x06, 0x00, 0xf0, 0x0b, 0x04, 0x03, 0x06, 0x00, 0x30, 0xea, 0xfe,
+    0x42, 0x00, 0x94, 0xff, 0x34, 0x00, 0xbd, 0xff, 0x02, 0x00, 0x06, 0x09, 0x09, 0x0a, 0x00, 0xf0,
+    0x09, 0x09, 0x03, 0x0a, 0x00, 0x30, 0x28, 0x00, 0xe4, 0xff, 0x53, 0x00, 0x02, 0x00, 0x05, 0x00,
+    0x05, 0x04, 0x00, 0xf0, 0x05, 0x02, 0x05, 0x02, 0x00, 0x20, 0x84, 0x00, 0xe7, 0xff, 0x51, 0x00,
+    0x02, 0x00, 0x05, 0x07, 0x0b, 0x04, 0x00, 0xf0, 0x05, 0x09, 0x0b, 0x02, 0x00, 0x20, 0xf5, 0xff,
+    0x26, 0x00, 0xce, 0xff, 0x02, 0x00, 0x02, 0x04, 0x02, 0x0e, 0x00, 0xf0, 0x03, 0x04, 0x01, 0x0e,
+    0x00, 0x20, 0xd3, 0xff, 0x83, 0x00, 0xf5, 0xff, 0x02, 0x00, 0x08, 0x06, 0x03, 0x05, 0x00, 0xf0,
+    0x09, 0x06, 0x01, 0x05, 0x00, 0x30, 0x19, 0x00, 0xe9, 0xff, 0x58, 0x00, 0x02, 0x00, 0x08, 0x04,
+    0x03, 0x09, 0x00, 0xf0, 0x09, 0x04, 0x01, 0x09, 0x00, 0x30, 0x64, 0x01, 0x07, 0x00, 0x2c, 0xff,
+    0x02, 0x00, 0x00, 0x08, 0x14, 0x06, 0x00, 0xf0, 0x00, 0x0a, 0x14, 0x02, 0x00, 0x30, 0x04, 0x00,
+    0xdf, 0xff, 0x34, 0x00, 0x02, 0x00, 0x0e, 0x10, 0x06, 0x01, 0x00, 0xf0, 0x11, 0x10, 0x03, 0x01,
+    0x00, 0x20, 0xfd, 0xff, 0x80, 0xff, 0x17, 0x00, 0x02, 0x00, 0x11, 0x12, 0x02, 0x02, 0x00, 0xf0,
+    0x11, 0x13, 0x02, 0x01, 0x00, 0x20, 0xc8, 0xff, 0x35, 0xff, 0xff, 0xff, 0x02, 0x00, 0x08, 0x11,
+    0x06, 0x03, 0x00, 0xf0, 0x0a, 0x11, 0x02, 0x03, 0x00, 0x30, 0xca, 0xfe, 0x4e, 0x00, 0xec, 0xff,
+    0x02, 0x00, 0x04, 0x01, 0x09, 0x0f, 0x00, 0xf0, 0x07, 0x01, 0x03, 0x0f, 0x00, 0x30, 0xf5, 0xff,
+    0x35, 0x00, 0xe0, 0xff, 0x02, 0x00, 0x0b, 0x05, 0x03, 0x0c, 0x00, 0xf0, 0x0c, 0x05, 0x01, 0x0c,
+    0x00, 0x30, 0xf0, 0xff, 0x58, 0xff, 0x0c, 0x00, 0x02, 0x00, 0x00, 0x0f, 0x04, 0x03, 0x00, 0xf0,
+    0x00, 0x10, 0x04, 0x01, 0x00, 0x30, 0x47, 0x00, 0xeb, 0xff, 0x5c, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x0f, 0x01, 0x00, 0xf0, 0x05, 0x00, 0x05, 0x01, 0x00, 0x30, 0x5a, 0x00, 0x10, 0x00, 0x4b, 0xff,
+    0x02, 0x00, 0x06, 0x00, 0x06, 0x04, 0x00, 0xf0, 0x08, 0x00, 0x02, 0x04, 0x00, 0x30, 0xf5, 0xff,
+    0x25, 0x00, 0xd6, 0xff, 0x02, 0x00, 0x02, 0x00, 0x09, 0x03, 0x00, 0xf0, 0x05, 0x00, 0x03, 0x03,
+    0x00, 0x30, 0xd7, 0xff, 0x7e, 0x00, 0xfa, 0xff, 0x02, 0x00, 0x0d, 0x06, 0x03, 0x07, 0x00, 0xf0,
+    0x0e, 0x06, 0x01, 0x07, 0x00, 0x30, 0xe4, 0xff, 0x47, 0x00, 0xed, 0xff, 0x02, 0x00, 0x07, 0x06,
+    0x04, 0x02, 0x00, 0xf0, 0x07, 0x07, 0x04, 0x01, 0x00, 0x20, 0xf1, 0xff, 0x6c, 0xff, 0x09, 0x00,
+    0x02, 0x00, 0x06, 0x12, 0x06, 0x01, 0x00, 0xf0, 0x08, 0x12, 0x02, 0x01, 0x00, 0x30, 0xf3, 0xff,
+    0x81, 0xff, 0x0c, 0x00, 0x02, 0x00, 0x12, 0x06, 0x02, 0x02, 0x00, 0xf0, 0x12, 0x07, 0x02, 0x01,
+    0x00, 0x20, 0xe0, 0xff, 0x58, 0x00, 0xef, 0xff, 0x02, 0x00, 0x06, 0x04, 0x07, 0x03, 0x00, 0xf0,
+    0x06, 0x05, 0x07, 0x01, 0x00, 0x30, 0x00, 0x00, 0x26, 0x00, 0xdc, 0xff, 0x02, 0x00, 0x0c, 0x07,
+    0x03, 0x01, 0x00, 0xf0, 0x0d, 0x07, 0x01, 0x01, 0x00, 0x30, 0xf3, 0xff, 0x3a, 0x00, 0xe9, 0xff,
+    0x03, 0x00, 0x0f, 0x01, 0x02, 0x0a, 0x00, 0xf0, 0x0f, 0x01, 0x01, 0x05, 0x00, 0x20, 0x10, 0x06,
+    0x01, 0x05, 0x00, 0x20, 0xfd, 0xff, 0x8f, 0xff, 0x0e, 0x00, 0x02, 0x00, 0x00, 0x12, 0x02, 0x02,
+    0x00, 0xf0, 0x00, 0x13, 0x02, 0x01, 0x00, 0x20, 0xfe, 0xff, 0x23, 0x00, 0xdb, 0xff, 0x02, 0x00,
+    0x13, 0x04, 0x01, 0x08, 0x00, 0xf0, 0x13, 0x08, 0x01, 0x04, 0x00, 0x20, 0xff, 0xff, 0xb4, 0xff,
+    0x13, 0x00, 0x02, 0x00, 0x01, 0x11, 0x01, 0x03, 0x00, 0xf0, 0x01, 0x12, 0x01, 0x01, 0x00, 0x30,
+    0x05, 0x00, 0xd7, 0xff, 0x23, 0x00, 0x03, 0x00, 0x00, 0x0f, 0x06, 0x04, 0x00, 0xf0, 0x00, 0x0f,
+    0x03, 0x02, 0x00, 0x20, 0x03, 0x11, 0x03, 0x02, 0x00, 0x20, 0x2d, 0xff, 0x78, 0xff, 0x0a, 0x00,
+    0x02, 0x00, 0x13, 0x00, 0x01, 0x12, 0x00, 0xf0, 0x13, 0x06, 0x01, 0x06, 0x00, 0x30, 0xc2, 0xff,
+    0x38, 0xff, 0x06, 0x00, 0x02, 0x00, 0x0a, 0x02, 0x06, 0x02, 0x00, 0xf0, 0x0c, 0x02, 0x02, 0x02,
+    0x00, 0x30, 0x1a, 0x01, 0xf7, 0xff, 0xb6, 0x00, 0x02, 0x00, 0x02, 0x08, 0x0c, 0x02, 0x00, 0xf0,
+    0x06, 0x08, 0x04, 0x02, 0x00, 0x30, 0x05, 0x00, 0xe8, 0xff, 0x37, 0x00, 0x02, 0x00, 0x10, 0x00,
+    0x04, 0x01, 0x00, 0xf0, 0x12, 0x00, 0x02, 0x01, 0x00, 0x20, 0xf6, 0xff, 0x1d, 0x00, 0xd2, 0xff,
+    0x02, 0x00, 0x08, 0x04, 0x02, 0x06, 0x00, 0xf0, 0x08, 0x07, 0x02, 0x03, 0x00, 0x20, 0xfa, 0xff,
+    0x2d, 0x00, 0xe1, 0xff, 0x02, 0x00, 0x0e, 0x05, 0x02, 0x0a, 0x00, 0xf0, 0x0f, 0x05, 0x01, 0x0a,
+    0x00, 0x20, 0xfa, 0xff, 0x2e, 0x00, 0xe3, 0xff, 0x02, 0x00, 0x0d, 0x04, 0x02, 0x02, 0x00, 0xf0,
+    0x0d, 0x05, 0x02, 0x01, 0x00, 0x20, 0xe5, 0xff, 0x40, 0x00, 0xe9, 0xff, 0x02, 0x00, 0x0b, 0x01,
+    0x03, 0x06, 0x00, 0xf0, 0x0b, 0x03, 0x03, 0x02, 0x00, 0x30, 0xc7, 0xff, 0x23, 0x00, 0xd4, 0xff,
+    0x02, 0x00, 0x06, 0x09, 0x0c, 0x02, 0x00, 0xf0, 0x0a, 0x09, 0x04, 0x02, 0x00, 0x30, 0xf7, 0xff,
+    0x66, 0x00, 0xf4, 0xff, 0x02, 0x00, 0x09, 0x10, 0x04, 0x02, 0x00, 0xf0, 0x09, 0x11, 0x04, 0x01,
+    0x00, 0x20, 0x51, 0x00, 0xd0, 0xff, 0x26, 0x00, 0x02, 0x00, 0x05, 0x0e, 0x0f, 0x04, 0x00, 0xf0,
+    0x05, 0x10, 0x0f, 0x02, 0x00, 0x20, 0x0a, 0x00, 0x0c, 0x00, 0x92, 0xff, 0x02, 0x00, 0x12, 0x10,
+    0x02, 0x02, 0x00, 0xf0, 0x12, 0x11, 0x02, 0x01, 0x00, 0x20, 0xfe, 0xff, 0x91, 0xff, 0x0a, 0x00,
+    0x03, 0x00, 0x10, 0x12, 0x02, 0x02, 0x00, 0xf0, 0x10, 0x12, 0x01, 0x01, 0x00, 0x20, 0x11, 0x13,
+    0x01, 0x01, 0x00, 0x20, 0xb9, 0xff, 0xa8, 0x00, 0xf8, 0xff, 0x02, 0x00, 0x06, 0x04, 0x03, 0x08,
+    0x00, 0xf0, 0x07, 0x04, 0x01, 0x08, 0x00, 0x30, 0xf8, 0xff, 0x65, 0x00, 0xf5, 0xff, 0x02, 0x00,
+    0x05, 0x09, 0x03, 0x01, 0x00, 0xf0, 0x06, 0x09, 0x01, 0x01, 0x00, 0x30, 0x0a, 0x00, 0x0f, 0x00,
+    0xad, 0xff, 0x02, 0x00, 0x00, 0x08, 0x01, 0x06, 0x00, 0xf0, 0x00, 0x0a, 0x01, 0x02, 0x00, 0x30,
+    0x1b, 0xff, 0x7c, 0xff, 0x09, 0x00, 0x02, 0x00, 0x0b, 0x02, 0x09, 0x06, 0x00, 0xf0, 0x0e, 0x02,
+    0x03, 0x06, 0x00, 0x30, 0xfa, 0xff, 0x26, 0x00, 0xe0, 0xff, 0x02, 0x00, 0x0c, 0x02, 0x06, 0x04,
+    0x00, 0xf0, 0x0e, 0x02, 0x02, 0x04, 0x00, 0x30, 0xd2, 0xff, 0x5f, 0xff, 0x08, 0x00, 0x02, 0x00,
+    0x01, 0x07, 0x02, 0x04, 0x00, 0xf0, 0x01, 0x09, 0x02, 0x02, 0x00, 0x20, 0x5f, 0x00, 0xf2, 0xff,
+    0x62, 0x00, 0x02, 0x00, 0x0d, 0x01, 0x06, 0x04, 0x00, 0xf0, 0x0d, 0x03, 0x06, 0x02, 0x00, 0x20,
+    0xf7, 0xff, 0x30, 0x00, 0xe7, 0xff, 0x03, 0x00, 0x04, 0x0a, 0x02, 0x0a, 0x00, 0xf0, 0x04, 0x0a,
+    0x01, 0x05, 0x00, 0x20, 0x05, 0x0f, 0x01, 0x05, 0x00, 0x20, 0x8a, 0xff, 0x75, 0xff, 0x0a, 0x00,
+    0x02, 0x00, 0x02, 0x10, 0x09, 0x03, 0x00, 0xf0, 0x05, 0x10, 0x03, 0x03, 0x00, 0x30, 0xc5, 0xff,
+    0x54, 0xff, 0x05, 0x00, 0x02, 0x00, 0x01, 0x02, 0x03, 0x09, 0x00, 0xf0, 0x02, 0x02, 0x01, 0x09,
+    0x00, 0x30, 0xeb, 0xff, 0x92, 0xff, 0x0b, 0x00, 0x02, 0x00, 0x13, 0x07, 0x01, 0x04, 0x00, 0xf0,
+    0x13, 0x09, 0x01, 0x02, 0x00, 0x20, 0x14, 0x00, 0xe5, 0xff, 0x31, 0x00, 0x03, 0x00, 0x0e, 0x0b,
+    0x06, 0x08, 0x00, 0xf0, 0x0e, 0x0b, 0x03, 0x04, 0x00, 0x20, 0x11, 0x0f, 0x03, 0x04, 0x00, 0x20,
+    0xef, 0xff, 0x3d, 0x00, 0xe6, 0xff, 0x03, 0x00, 0x0f, 0x0c, 0x04, 0x06, 0x00, 0xf0, 0x0f, 0x0c,
+    0x02, 0x03, 0x00, 0x20, 0x11, 0x0f, 0x02, 0x03, 0x00, 0x20, 0x00, 0x00, 0xea, 0xff, 0x34, 0x00,
+    0x03, 0x00, 0x10, 0x0f, 0x02, 0x02, 0x00, 0xf0, 0x10, 0x0f, 0x01, 0x01, 0x00, 0x20, 0x11, 0x10,
+    0x01, 0x01, 0x00, 0x20, 0x01, 0x00, 0x0b, 0x00, 0x9d, 0xff, 0x03, 0x00, 0x11, 0x10, 0x02, 0x02,
+    0x00, 0xf0, 0x11, 0x10, 0x01, 0x01, 0x00, 0x20, 0x12, 0x11, 0x01, 0x01, 0x00, 0x20, 0xfd, 0xff,
+    0x74, 0xff, 0x09, 0x00, 0x03, 0x00, 0x11, 0x10, 0x02, 0x02, 0x00, 0xf0, 0x11, 0x10, 0x01, 0x01,
+    0x00, 0x20, 0x12, 0x11, 0x01, 0x01, 0x00, 0x20, 0x00, 0x00, 0xe4, 0xff, 0x2c, 0x00, 0x03, 0x00,
+    0x02, 0x03, 0x02, 0x02, 0x00, 0xf0, 0x02, 0x03, 0x01, 0x01, 0x00, 0x20, 0x03, 0x04, 0x01, 0x01,
+    0x00, 0x20, 0xf1, 0xff, 0x3e, 0x00, 0xec, 0xff, 0x02, 0x00, 0x0a, 0x0a, 0x03, 0x03, 0x00, 0xf0,
+    0x0b, 0x0a, 0x01, 0x03, 0x00, 0x30, 0x5c, 0xff, 0x5f, 0xff, 0x06, 0x00, 0x02, 0x00, 0x05, 0x09,
+    0x07, 0x08, 0x00, 0xf0, 0x05, 0x0d, 0x07, 0x04, 0x00, 0x20, 0x00, 0x00, 0x32, 0x00, 0xe6, 0xff,
+    0x03, 0x00, 0x07, 0x10, 0x02, 0x02, 0x00, 0xf0, 0x07, 0x10, 0x01, 0x01, 0x00, 0x20, 0x08, 0x11,
+    0x01, 0x01, 0x00, 0x20, 0x00, 0x00, 0xe9, 0xff, 0x32, 0x00, 0x03, 0x00, 0x07, 0x10, 0x02, 0x02,
+    0x00, 0xf0, 0x07, 0x10, 0x01, 0x01, 0x00, 0x20, 0x08, 0x11, 0x01, 0x01, 0x00, 0x20, 0x2a, 0x01,
+    0x0c, 0x00, 0xaa, 0xff, 0x02, 0x00, 0x09, 0x08, 0x0a, 0x03, 0x00, 0xf0, 0x0e, 0x08, 0x05, 0x03,
+    0x00, 0x20, 0x29, 0x00, 0xe9, 0xff, 0x33, 0x00, 0x03, 0x00, 0x06, 0x07, 0x04, 0x08, 0x00, 0xf0,
+    0x06, 0x07, 0x02, 0x04, 0x00, 0x20, 0x08, 0x0b, 0x02, 0x04, 0x00, 0x20, 0x09, 0x00, 0x10, 0x00,
+    0xbc, 0xff, 0x02, 0x00, 0x01, 0x06, 0x04, 0x03, 0x00, 0xf0, 0x01, 0x07, 0x04, 0x01, 0x00, 0x30,
+    0xf2, 0xff, 0x21, 0x00, 0xe0, 0xff, 0x02, 0x00, 0x06, 0x0a, 0x06, 0x0a, 0x00, 0xf0, 0x08, 0x0a,
+    0x02, 0x0a, 0x00, 0x30, 0xfb, 0xff, 0x29, 0x00, 0xe5, 0xff, 0x02, 0x00, 0x04, 0x06, 0x03, 0x06,
+    0x00, 0xf0, 0x05, 0x06, 0x01, 0x06, 0x00, 0x30, 0xf6, 0xfe, 0x45, 0x00, 0xd9, 0xff, 0x9c, 0x00,
+    0xf0, 0xff, 0x03, 0x00, 0x03, 0x0a, 0x04, 0x04, 0x00, 0xf0, 0x03, 0x0a, 0x02, 0x02, 0x00, 0x20,
+    0x05, 0x0c, 0x02, 0x02, 0x00, 0x20, 0xd9, 0xff, 0x00, 0xff, 0x00, 0x00, 0x03, 0x00, 0x03, 0x0a,
+    0x04, 0x04, 0x00, 0xf0, 0x03, 0x0a, 0x02, 0x02, 0x00, 0x20, 0x05, 0x0c, 0x02, 0x02, 0x00, 0x20,
+    0xd9, 0xff, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x03, 0x0a, 0x04, 0x04, 0x00, 0xf0, 0x03, 0x0a,
+    0x02, 0x02, 0x00, 0x20, 0x05, 0x0c, 0x02, 0x02, 0x00, 0x20, 0xef, 0xff, 0x48, 0x00, 0xd9, 0xff,
+    0x02, 0x00, 0x0e, 0x08, 0x02, 0x06, 0x00, 0xf0, 0x0f, 0x08, 0x01, 0x06, 0x00, 0x20, 0xd9, 0xff,
+    0x00, 0xff, 0x0b, 0x00, 0x03, 0x00, 0x03, 0x0a, 0x04, 0x04, 0x00, 0xf0, 0x03, 0x0a, 0x02, 0x02,
+    0x00, 0x20, 0x05, 0x0c, 0x02, 0x02, 0x00, 0x20, 0xdb, 0xff, 0xde, 0x00, 0x00, 0x00, 0x03, 0x00,
+    0x03, 0x0a, 0x04, 0x04, 0x00, 0xf0, 0x03, 0x0a, 0x02, 0x02, 0x00, 0x20, 0x05, 0x0c, 0x02, 0x02,
+    0x00, 0x20, 0xdd, 0xff, 0x74, 0x00, 0xea, 0xff, 0x02, 0x00, 0x0c, 0x04, 0x03, 0x09, 0x00, 0xf0,
+    0x0d, 0x04, 0x01, 0x09, 0x00, 0x30, 0xdc, 0xff, 0x22, 0x00, 0xbe, 0xff, 0x02, 0x00, 0x0c, 0x03,
+    0x01, 0x0c, 0x00, 0xf0, 0x0c, 0x07, 0x01, 0x04, 0x00, 0x30, 0xc6, 0xff, 0x52, 0x00, 0xe8, 0xff,
+    0x02, 0x00, 0x02, 0x00, 0x12, 0x01, 0x00, 0xf0, 0x08, 0x00, 0x06, 0x01, 0x00, 0x30, 0x6a, 0x00,
+    0xdf, 0xff, 0x43, 0x00, 0x03, 0x00, 0x0a, 0x00, 0x0a, 0x06, 0x00, 0xf0, 0x0a, 0x00, 0x05, 0x03,
+    0x00, 0x20, 0x0f, 0x03, 0x05, 0x03, 0x00, 0x20, 0x00, 0x00, 0xe1, 0xff, 0x35, 0x00, 0x02, 0x00,
+    0x12, 0x10, 0x02, 0x02, 0x00, 0xf0, 0x12, 0x11, 0x02, 0x01, 0x00, 0x20, 0x00, 0x00, 0x1e, 0x00,
+    0xc5, 0xff, 0x03, 0x00, 0x03, 0x05, 0x04, 0x02, 0x00, 0xf0, 0x03, 0x05, 0x02, 0x01, 0x00, 0x20,
+    0x05, 0x06, 0x02, 0x01, 0x00, 0x20, 0x1c, 0x00, 0xf0, 0xff, 0x69, 0x00, 0x02, 0x00, 0x0b, 0x08,
+    0x03, 0x03, 0x00, 0xf0, 0x0c, 0x08, 0x01, 0x03, 0x00, 0x30, 0xce, 0xff, 0x8c, 0x00, 0xf6, 0xff,
+    0x02, 0x00, 0x0b, 0x07, 0x03, 0x05, 0x00, 0xf0, 0x0c, 0x07, 0x01, 0x05, 0x00, 0x30, 0xf1, 0xff,
+    0x3d, 0x00, 0xe8, 0xff, 0x02, 0x00, 0x03, 0x13, 0x0f, 0x01, 0x00, 0xf0, 0x08, 0x13, 0x05, 0x01,
+    0x00, 0x30, 0x0b, 0x00, 0xe0, 0xff, 0x31, 0x00, 0x02, 0x00, 0x08, 0x0d, 0x03, 0x02, 0x00, 0xf0,
+    0x08, 0x0e, 0x03, 0x01, 0x00, 0x20, 0xe1, 0xff, 0x4c, 0x00, 0xe8, 0xff, 0x03, 0x00, 0x02, 0x0c,
+    0x08, 0x04, 0x00, 0xf0, 0x02, 0x0c, 0x04, 0x02, 0x00, 0x20, 0x06, 0x0e, 0x04, 0x02, 0x00, 0x20,
+    0x01, 0x00, 0x0f, 0x00, 0x95, 0xff, 0x03, 0x00, 0x10, 0x10, 0x02, 0x02, 0x00, 0xf0, 0x10, 0x10,
+    0x01, 0x01, 0x00, 0x20, 0x11, 0x11, 0x01, 0x01, 0x00, 0x20, 0x0d, 0x00, 0x0c, 0x00, 0x5f, 0xff,
+    0x02, 0x00, 0x07, 0x00, 0x03, 0x02, 0x00, 0xf0, 0x08, 0x00, 0x01, 0x02, 0x00, 0x30, 0xbc, 0xff,
+    0xb6, 0x00, 0xf6, 0xff, 0x02, 0x00, 0x06, 0x07, 0x02, 0x05, 0x00, 0xf0, 0x07, 0x07, 0x01, 0x05,
+    0x00, 0x20, 0xe6, 0xff, 0xa7, 0xff, 0x12, 0x00, 0x02, 0x00, 0x12, 0x00, 0x02, 0x11, 0x00, 0xf0,
+    0x13, 0x00, 0x01, 0x11, 0x00, 0x20, 0x01, 0x00, 0x17, 0x00, 0xc1, 0xff, 0x02, 0x00, 0x10, 0x10,
+    0x01, 0x03, 0x00, 0xf0, 0x10, 0x11, 0x01, 0x01, 0x00, 0x30, 0x3d, 0x00, 0xf3, 0xff, 0x90, 0x00,
+    0x02, 0x00, 0x0e, 0x08, 0x03, 0x07, 0x00, 0xf0, 0x0f, 0x08, 0x01, 0x07, 0x00, 0x30, 0x01, 0x00,
+    0x10, 0x00, 0xa3, 0xff, 0x03, 0x00, 0x0a, 0x11, 0x02, 0x02, 0x00, 0xf0, 0x0a, 0x11, 0x01, 0x01,
+    0x00, 0x20, 0x0b, 0x12, 0x01, 0x01, 0x00, 0x20, 0xff, 0xff, 0x2d, 0x00, 0xe3, 0xff, 0x02, 0x00,
+    0x04, 0x09, 0x01, 0x03, 0x00, 0xf0, 0x04, 0x0a, 0x01, 0x01, 0x00, 0x30, 0x01, 0x00, 0x1a, 0x00,
+    0xcd, 0xff, 0x02, 0x00, 0x12, 0x0a, 0x02, 0x03, 0x00, 0xf0, 0x12, 0x0b, 0x02, 0x01, 0x00, 0x30,
+    0x21, 0x00, 0xf0, 0xff, 0x4d, 0x00, 0x02, 0x00, 0x0c, 0x01, 0x03, 0x0a, 0x00, 0xf0, 0x0d, 0x01,
+    0x01, 0x0a, 0x00, 0x30, 0xa3, 0xff, 0x87, 0x00, 0xf6, 0xff, 0x02, 0x00, 0x08, 0x0c, 0x09, 0x01,
+    0x00, 0xf0, 0x0b, 0x0c, 0x03, 0x01, 0x00, 0x30, 0x00, 0x00, 0x14, 0x00, 0xc1, 0xff, 0x03, 0x00,
+    0x05, 0x12, 0x02, 0x02, 0x00, 0xf0, 0x05, 0x12, 0x01, 0x01, 0x00, 0x20, 0x06, 0x13, 0x01, 0x01,
+    0x00, 0x20, 0xcc, 0xff, 0xa7, 0xff, 0x0e, 0x00, 0x02, 0x00, 0x13, 0x06, 0x01, 0x09, 0x00, 0xf0,
+    0x13, 0x09, 0x01, 0x03, 0x00, 0x30, 0xfc, 0xff, 0x3b, 0x00, 0xe9, 0xff, 0x03, 0x00, 0x04, 0x07,
+    0x02, 0x04, 0x00, 0xf0, 0x04, 0x07, 0x01, 0x02, 0x00, 0x20, 0x05, 0x09, 0x01, 0x02, 0x00, 0x20,
+    0x04, 0x00, 0x1e, 0x00, 0xd1, 0xff, 0x02, 0x00, 0x01, 0x04, 0x06, 0x0e, 0x00, 0xf0, 0x03, 0x04,
+    0x02, 0x0e, 0x00, 0x30, 0x49, 0xff, 0x5c, 0xff, 0x07, 0x00, 0x02, 0x00, 0x0a, 0x05, 0x09, 0x03,
+    0x00, 0xf0, 0x0d, 0x05, 0x03, 0x03, 0x00, 0x30, 0x21, 0x00, 0x0b, 0x00, 0x92, 0xff, 0x02, 0x00,
+    0x12, 0x07, 0x02, 0x06, 0x00, 0xf0, 0x12, 0x09, 0x02, 0x02, 0x00, 0x30, 0xd1, 0xff, 0x6a, 0x00,
+    0xf4, 0xff, 0x02, 0x00, 0x05, 0x06, 0x02, 0x07, 0x00, 0xf0, 0x06, 0x06, 0x01, 0x07, 0x00, 0x20,
+    0x59, 0x01, 0x0d, 0x00, 0x9f, 0xff, 0x02, 0x00, 0x0a, 0x04, 0x06, 0x08, 0x00, 0xf0, 0x0d, 0x04,
+    0x03, 0x08, 0x00, 0x20, 0x3a, 0x00, 0x0b, 0x00, 0x92, 0xff, 0x02, 0x00, 0x00, 0x08, 0x02, 0x09,
+    0x00, 0xf0, 0x00, 0x0b, 0x02, 0x03, 0x00, 0x30, 0x06, 0x00, 0x15, 0x00, 0xc1, 0xff, 0x02, 0x00,
+    0x00, 0x07, 0x05, 0x03, 0x00, 0xf0, 0x00, 0x08, 0x05, 0x01, 0x00, 0x30, 0x28, 0x00, 0xf2, 0xff,
+    0x58, 0x00, 0x02, 0x00, 0x08, 0x01, 0x07, 0x02, 0x00, 0xf0, 0x08, 0x02, 0x07, 0x01, 0x00, 0x20,
+    0xdb, 0xff, 0x73, 0x00, 0xf6, 0xff, 0x02, 0x00, 0x07, 0x05, 0x03, 0x05, 0x00, 0xf0, 0x08, 0x05,
+    0x01, 0x05, 0x00, 0x30, 0xff, 0xff, 0x2e, 0x00, 0xe5, 0xff, 0x02, 0x00, 0x13, 0x02, 0x01, 0x02,
+    0x00, 0xf0, 0x13, 0x03, 0x01, 0x01, 0x00, 0x20, 0x27, 0x03, 0xf9, 0xff, 0xaa, 0x00, 0x02, 0x00,
+    0x06, 0x07, 0x0a, 0x0b, 0x00, 0xf0, 0x0b, 0x07, 0x05, 0x0b, 0x00, 0x20, 0xe3, 0xff, 0x1c, 0xff,
+    0x06, 0x00, 0x02, 0x00, 0x09, 0x13, 0x06, 0x01, 0x00, 0xf0, 0x0b, 0x13, 0x02, 0x01, 0x00, 0x30,
+    0x23, 0x00, 0xee, 0xff, 0x48, 0x00, 0x02, 0x00, 0x03, 0x00, 0x0c, 0x01, 0x00, 0xf0, 0x07, 0x00,
+    0x04, 0x01, 0x00, 0x30, 0x24, 0x00, 0x12, 0x00, 0xb3, 0xff, 0x02, 0x00, 0x04, 0x01, 0x06, 0x05,
+    0x00, 0xf0, 0x06, 0x01, 0x02, 0x05, 0x00, 0x30, 0xea, 0x00, 0x0d, 0x00, 0x9c, 0xff, 0x02, 0x00,
+    0x06, 0x0c, 0x0c, 0x06, 0x00, 0xf0, 0x0a, 0x0c, 0x04, 0x06, 0x00, 0x30, 0x0f, 0x00, 0x08, 0x00,
+    0x7e, 0xff, 0x02, 0x00, 0x10, 0x0d, 0x02, 0x03, 0x00, 0xf0, 0x10, 0x0e, 0x02, 0x01, 0x00, 0x30,
+    0xfb, 0xff, 0x4f, 0x00, 0xf0, 0xff, 0x02, 0x00, 0x07, 0x0e, 0x04, 0x02, 0x00, 0xf0, 0x07, 0x0f,
+    0x04, 0x01, 0x00, 0x20, 0x04, 0x00, 0xdf, 0xff, 0x25, 0x00, 0x02, 0x00, 0x07, 0x0e, 0x02, 0x02,
+    0x00, 0xf0, 0x07, 0x0f, 0x02, 0x01, 0x00, 0x20, 0xf9, 0xff, 0x4a, 0x00, 0xef, 0xff, 0x03, 0x00,
+    0x03, 0x0a, 0x02, 0x04, 0x00, 0xf0, 0x03, 0x0a, 0x01, 0x02, 0x00, 0x20, 0x04, 0x0c, 0x01, 0x02,
+    0x00, 0x20, 0x2c, 0x00, 0x08, 0x00, 0x86, 0xff, 0x02, 0x00, 0x00, 0x03, 0x02, 0x06, 0x00, 0xf0,
+    0x00, 0x05, 0x02, 0x02, 0x00, 0x30, 0x00, 0x00, 0x29, 0x00, 0xe3, 0xff, 0x03, 0x00, 0x01, 0x0a,
+    0x02, 0x02, 0x00, 0xf0, 0x01, 0x0a, 0x01, 0x01, 0x00, 0x20, 0x02, 0x0b, 0x01, 0x01, 0x00, 0x20,
+    0xea, 0xff, 0x91, 0xff, 0x0b, 0x00, 0x02, 0x00, 0x10, 0x04, 0x04, 0x03, 0x00, 0xf0, 0x10, 0x05,
+    0x04, 0x01, 0x00, 0x30, 0xf4, 0xff, 0x61, 0x00, 0xf2, 0xff, 0x03, 0x00, 0x05, 0x0a, 0x02, 0x04,
+    0x00, 0xf0, 0x05, 0x0a, 0x01, 0x02, 0x00, 0x20, 0x06, 0x0c, 0x01, 0x02, 0x00, 0x20, 0x1a, 0x00,
+    0xd8, 0xff, 0x1f, 0x00, 0x02, 0x00, 0x05, 0x0b, 0x0d, 0x02, 0x00, 0xf0, 0x05, 0x0c, 0x0d, 0x01,
+    0x00, 0x20, 0x30, 0x00, 0xf6, 0xff, 0x75, 0x00, 0x02, 0x00, 0x0a, 0x02, 0x03, 0x0b, 0x00, 0xf0,
+    0x0b, 0x02, 0x01, 0x0b, 0x00, 0x30, 0x37, 0x00, 0xf3, 0xff, 0x59, 0x00, 0x02, 0x00, 0x0a, 0x02,
+    0x04, 0x04, 0x00, 0xf0, 0x0a, 0x04, 0x04, 0x02, 0x00, 0x20, 0xf6, 0xff, 0x1c, 0x00, 0xd6, 0xff,
+    0x02, 0x00, 0x08, 0x08, 0x06, 0x02, 0x00, 0xf0, 0x0a, 0x08, 0x02, 0x02, 0x00, 0x30, 0x06, 0x00,
+    0x11, 0x00, 0xb2, 0xff, 0x02, 0x00, 0x0b, 0x02, 0x03, 0x03, 0x00, 0xf0, 0x0c, 0x02, 0x01, 0x03,
+    0x00, 0x30, 0x0a, 0x00, 0x10, 0x00, 0xb9, 0xff, 0x03, 0x00, 0x06, 0x12, 0x0e, 0x02, 0x00, 0xf0,
+    0x06, 0x12, 0x07, 0x01, 0x00, 0x20, 0x0d, 0x13, 0x07, 0x01, 0x00, 0x20, 0xe1, 0xff, 0x32, 0x00,
+    0xe5, 0xff, 0x02, 0x00, 0x11, 0x07, 0x01, 0x0c, 0x00, 0xf0, 0x11, 0x0b, 0x01, 0x04, 0x00, 0x30,
+    0x14, 0x00, 0x15, 0x00, 0xc1, 0xff, 0x02, 0x00, 0x0a, 0x05, 0x0a, 0x03, 0x00, 0xf0, 0x0a, 0x06,
+    0x0a, 0x01, 0x00, 0x30, 0xf5, 0xff, 0x87, 0xff, 0x08, 0x00, 0x02, 0x00, 0x06, 0x01, 0x03, 0x03,
+    0x00, 0xf0, 0x07, 0x01, 0x01, 0x03, 0x00, 0x30, 0x0c, 0x00, 0xf4, 0xff, 0x6d, 0x00, 0x02, 0x00,
+    0x0d, 0x08, 0x03, 0x01, 0x00, 0xf0, 0x0e, 0x08, 0x01, 0x01, 0x00, 0x30, 0x0c, 0x00, 0xe6, 0xff,
+    0x2b, 0x00, 0x02, 0x00, 0x0a, 0x0e, 0x02, 0x06, 0x00, 0xf0, 0x0a, 0x10, 0x02, 0x02, 0x00, 0x30,
+    0x92, 0x03, 0xfd, 0xff, 0xec, 0x00, 0x02, 0x00, 0x04, 0x01, 0x0c, 0x0e, 0x00, 0xf0, 0x08, 0x01,
+    0x04, 0x0e, 0x00, 0x30, 0x79, 0xfe, 0x43, 0xff, 0x07, 0x00, 0x02, 0x00, 0x0e, 0x01, 0x06, 0x0e,
+    0x00, 0xf0, 0x10, 0x01, 0x02, 0x0e, 0x00, 0x30, 0x00, 0x00, 0xe0, 0xff, 0x21, 0x00, 0x03, 0x00,
+    0x03, 0x10, 0x02, 0x02, 0x00, 0xf0, 0x03, 0x10, 0x01, 0x01, 0x00, 0x20, 0x04, 0x11, 0x01, 0x01,
+    0x00, 0x20, 0x00, 0x00, 0xd6, 0xff, 0x19, 0x00, 0x02, 0x00, 0x00, 0x10, 0x02, 0x02, 0x00, 0xf0,
+    0x00, 0x11, 0x02, 0x01, 0x00, 0x20, 0xf2, 0xfe, 0x3b, 0x00, 0xe6, 0xff, 0x56, 0x00, 0xd9, 0xff,
+    0x03, 0x00, 0x0f, 0x06, 0x04, 0x06, 0x00, 0xf0, 0x0f, 0x06, 0x02, 0x03, 0x00, 0x20, 0x11, 0x09,
+    0x02, 0x03, 0x00, 0x20, 0xfc, 0xff, 0x39, 0x00, 0xcf, 0xff, 0x02, 0x00, 0x0c, 0x05, 0x02, 0x02,
+    0x00, 0xf0, 0x0c, 0x06, 0x02, 0x01, 0x00, 0x20, 0x87, 0xff, 0x42, 0x00, 0xd9, 0xff, 0x02, 0x00,
+    0x07, 0x06, 0x06, 0x0d, 0x00, 0xf0, 0x09, 0x06, 0x02, 0x0d, 0x00, 0x30, 0xcb, 0xff, 0x30, 0x00,
+    0xd6, 0xff, 0x02, 0x00, 0x01, 0x09, 0x06, 0x05, 0x00, 0xf0, 0x03, 0x09, 0x02, 0x05, 0x00, 0x30,
+    0xfb, 0xff, 0x33, 0x00, 0xe1, 0xff, 0x02, 0x00, 0x00, 0x05, 0x03, 0x04, 0x00, 0xf0, 0x00, 0x07,
+    0x03, 0x02, 0x00, 0x20, 0xf2, 0xff, 0x3d, 0x00, 0xdf, 0xff, 0x03, 0x00, 0x04, 0x01, 0x10, 0x02,
+    0x00, 0xf0, 0x04, 0x01, 0x08, 0x01, 0x00, 0x20, 0x0c, 0x02, 0x08, 0x01, 0x00, 0x20, 0xfa, 0xff,
+    0x83, 0xff, 0x1a, 0x00, 0x03, 0x00, 0x01, 0x12, 0x04, 0x02, 0x00, 0xf0, 0x01, 0x12, 0x02, 0x01,
+    0x00, 0x20, 0x03, 0x13, 0x02, 0x01, 0x00, 0x20, 0xe7, 0xff, 0x4f, 0x00, 0xe3, 0xff, 0x02, 0x00,
+    0x07, 0x07, 0x03, 0x04, 0x00, 0xf0, 0x08, 0x07, 0x01, 0x04, 0x00, 0x30, 0x78, 0xff, 0x82, 0xff,
+    0x0d, 0x00, 0x02, 0x00, 0x03, 0x04, 0x09, 0x03, 0x00, 0xf0, 0x06, 0x04, 0x03, 0x03, 0x00, 0x30,
+    0xa3, 0xff, 0x53, 0x00, 0xf0, 0xff, 0x02, 0x00, 0x04, 0x06, 0x06, 0x0a, 0x00, 0xf0, 0x06, 0x06,
+    0x02, 0x0a, 0x00, 0x30, 0x9f, 0xfe, 0x53, 0xff, 0x06, 0x00, 0x02, 0x00, 0x09, 0x00, 0x08, 0x0a,
+    0x00, 0xf0, 0x0d, 0x00, 0x04, 0x0a, 0x00, 0x20, 0xf8, 0xff, 0x39, 0x00, 0xe0, 0xff, 0x02, 0x00,
+    0x08, 0x00, 0x08, 0x01, 0x00, 0xf0, 0x0c, 0x00, 0x04, 0x01, 0x00, 0x20, 0xa0, 0x00, 0x1d, 0x00,
+    0xbc, 0xff, 0x03, 0x00, 0x06, 0x02, 0x08, 0x10, 0x00, 0xf0, 0x06, 0x02, 0x04, 0x08, 0x00, 0x20,
+    0x0a, 0x0a, 0x04, 0x08, 0x00, 0x20, 0x0e, 0x00, 0xe3, 0xff, 0x41, 0x00, 0x03, 0x00, 0x0e, 0x0a,
+    0x02, 0x0a, 0x00, 0xf0, 0x0e, 0x0a, 0x01, 0x05, 0x00, 0x20, 0x0f, 0x0f, 0x01, 0x05, 0x00, 0x20,
+    0x02, 0x00, 0xda, 0xff, 0x2a, 0x00, 0x02, 0x00, 0x0c, 0x0b, 0x01, 0x02, 0x00, 0xf0, 0x0c, 0x0c,
+    0x01, 0x01, 0x00, 0x20, 0x02, 0x00, 0x19, 0x00, 0xc8, 0xff, 0x02, 0x00, 0x10, 0x00, 0x03, 0x08,
+    0x00, 0xf0, 0x11, 0x00, 0x01, 0x08, 0x00, 0x30, 0xa7, 0xff, 0xaf, 0xff, 0x15, 0x00, 0x02, 0x00,
+    0x0e, 0x00, 0x06, 0x0a, 0x00, 0xf0, 0x11, 0x00, 0x03, 0x0a, 0x00, 0x20, 0xf3, 0xff, 0x9f, 0xff,
+    0x0f, 0x00, 0x02, 0x00, 0x10, 0x00, 0x03, 0x05, 0x00, 0xf0, 0x11, 0x00, 0x01, 0x05, 0x00, 0x30,
+    0x09, 0x00, 0xe8, 0xff, 0x49, 0x00, 0x02, 0x00, 0x04, 0x05, 0x0b, 0x02, 0x00, 0xf0, 0x04, 0x06,
+    0x0b, 0x01, 0x00, 0x20, 0xff, 0xff, 0x38, 0x00, 0xe8, 0xff, 0x02, 0x00, 0x01, 0x00, 0x02, 0x01,
+    0x00, 0xf0, 0x02, 0x00, 0x01, 0x01, 0x00, 0x20, 0x0e, 0x00, 0x09, 0x00, 0x6c, 0xff, 0x02, 0x00,
+    0x00, 0x00, 0x02, 0x03, 0x00, 0xf0, 0x00, 0x01, 0x02, 0x01, 0x00, 0x30, 0xa7, 0xff, 0x4b, 0x00,
+    0xec, 0xff, 0x02, 0x00, 0x0b, 0x06, 0x06, 0x0b, 0x00, 0xf0, 0x0d, 0x06, 0x02, 0x0b, 0x00, 0x30,
+    0x00, 0x00, 0x3a, 0x00, 0xe7, 0xff, 0x02, 0x00, 0x0e, 0x00, 0x03, 0x01, 0x00, 0xf0, 0x0f, 0x00,
+    0x01, 0x01, 0x00, 0x30, 0xfa, 0xff, 0x7f, 0xff, 0x0b, 0x00, 0x02, 0x00, 0x13, 0x07, 0x01, 0x02,
+    0x00, 0xf0, 0x13, 0x08, 0x01, 0x01, 0x00, 0x20, 0x1f, 0x00, 0x0b, 0x00, 0x97, 0xff, 0x02, 0x00,
+    0x11, 0x00, 0x03, 0x09, 0x00, 0xf0, 0x12, 0x00, 0x01, 0x09, 0x00, 0x30, 0x0f, 0x00, 0xea, 0xff,
+    0x3f, 0x00, 0x02, 0x00, 0x0c, 0x07, 0x03, 0x04, 0x00, 0xf0, 0x0d, 0x07, 0x01, 0x04, 0x00, 0x30,
+    0x18, 0x00, 0xed, 0xff, 0x48, 0x00, 0x03, 0x00, 0x00, 0x01, 0x0e, 0x02, 0x00, 0xf0, 0x00, 0x01,
+    0x07, 0x01, 0x00, 0x20, 0x07, 0x02, 0x07, 0x01, 0x00, 0x20, 0xf9, 0xff, 0xa6, 0xff, 0x0e, 0x00,
+    0x02, 0x00, 0x03, 0x01, 0x03, 0x02, 0x00, 0xf0, 0x04, 0x01, 0x01, 0x02, 0x00, 0x30, 0x43, 0x00,
+    0xec, 0xff, 0x3c, 0x00, 0x02, 0x00, 0x04, 0x00, 0x0f, 0x02, 0x00, 0xf0, 0x09, 0x00, 0x05, 0x02,
+    0x00, 0x30, 0x13, 0x00, 0x0a, 0x00, 0x84, 0xff, 0x02, 0x00, 0x0a, 0x02, 0x06, 0x01, 0x00, 0xf0,
+    0x0c, 0x02, 0x02, 0x01, 0x00, 0x30, 0x81, 0xff, 0x31, 0x00, 0xe6, 0xff, 0x02, 0x00, 0x09, 0x04,
+    0x06, 0x0b, 0x00, 0xf0, 0x0b, 0x04, 0x02, 0x0b, 0x00, 0x30, 0x02, 0x00, 0xcb, 0xff, 0x18, 0x00,
+    0x02, 0x00, 0x02, 0x10, 0x02, 0x04, 0x00, 0xf0, 0x02, 0x12, 0x02, 0x02, 0x00, 0x20, 0x30, 0x00,
+    0x0a, 0x00, 0x61, 0xff, 0x02, 0x00, 0x06, 0x11, 0x06, 0x03, 0x00, 0xf0, 0x08, 0x11, 0x02, 0x03,
+    0x00, 0x30, 0xe2, 0xff, 0x28, 0x00, 0xe1, 0xff, 0x02, 0x00, 0x07, 0x09, 0x06, 0x02, 0x00, 0xf0,
+    0x09, 0x09, 0x02, 0x02, 0x00, 0x30, 0x24, 0xff, 0x72, 0xff, 0x0a, 0x00, 0x02, 0x00, 0x06, 0x08,
+    0x09, 0x02, 0x00, 0xf0, 0x09, 0x08, 0x03, 0x02, 0x00, 0x30, 0x3f, 0x00, 0xf6, 0xff, 0x9f, 0x00,
+    0x03, 0x00, 0x06, 0x06, 0x02, 0x0a, 0x00, 0xf0, 0x06, 0x06, 0x01, 0x05, 0x00, 0x20, 0x07, 0x0b,
+    0x01, 0x05, 0x00, 0x20, 0x06, 0x00, 0x11, 0x00, 0xb2, 0xff, 0x02, 0x00, 0x00, 0x0b, 0x02, 0x03,
+    0x00, 0xf0, 0x00, 0x0c, 0x02, 0x01, 0x00, 0x30, 0xff, 0xff, 0x2d, 0x00, 0xe4, 0xff, 0x02, 0x00,
+    0x0b, 0x0f, 0x04, 0x01, 0x00, 0xf0, 0x0d, 0x0f, 0x02, 0x01, 0x00, 0x20, 0x0b, 0x00, 0x07, 0x00,
+    0x1e, 0xff, 0x02, 0x00, 0x06, 0x11, 0x01, 0x02, 0x00, 0xf0, 0x06, 0x12, 0x01, 0x01, 0x00, 0x20,
+    0xf3, 0xfe, 0x8a, 0xff, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0x14, 0x00, 0xf0, 0x02, 0x00,
+    0x02, 0x14, 0x00, 0x30, 0x05, 0x00, 0xe8, 0xff, 0x49, 0x00, 0x02, 0x00, 0x03, 0x0a, 0x02, 0x02,
+    0x00, 0xf0, 0x04, 0x0a, 0x01, 0x02, 0x00, 0x20, 0x03, 0x00, 0x1d, 0x00, 0xd6, 0xff, 0x02, 0x00,
+    0x04, 0x07, 0x03, 0x05, 0x00, 0xf0, 0x05, 0x07, 0x01, 0x05, 0x00, 0x30, 0x61, 0x00, 0xf8, 0xff,
+    0x99, 0x00, 0x02, 0x00, 0x03, 0x0c, 0x06, 0x02, 0x00, 0xf0, 0x05, 0x0c, 0x02, 0x02, 0x00, 0x30,
+    0x70, 0x00, 0xf0, 0xff, 0x4c, 0x00, 0x02, 0x00, 0x06, 0x0f, 0x07, 0x04, 0x00, 0xf0, 0x06, 0x11,
+    0x07, 0x02, 0x00, 0x20, 0xff, 0xff, 0xaa, 0xff, 0x10, 0x00, 0x03, 0x00, 0x11, 0x10, 0x02, 0x02,
+    0x00, 0xf0, 0x11, 0x10, 0x01, 0x01, 0x00, 0x20, 0x12, 0x11, 0x01, 0x01, 0x00, 0x20, 0xfb, 0xff,
+    0x25, 0x00, 0xdf, 0xff, 0x02, 0x00, 0x0f, 0x01, 0x03, 0x10, 0x00, 0xf0, 0x10, 0x01, 0x01, 0x10,
+    0x00, 0x30, 0xda, 0xff, 0x7d, 0xff, 0x08, 0x00, 0x02, 0x00, 0x06, 0x10, 0x06, 0x03, 0x00, 0xf0,
+    0x08, 0x10, 0x02, 0x03, 0x00, 0x30, 0x1f, 0x00, 0x05, 0x00, 0x4e, 0xff, 0x02, 0x00, 0x0f, 0x0e,
+    0x03, 0x02, 0x00, 0xf0, 0x0f, 0x0f, 0x03, 0x01, 0x00, 0x20, 0x00, 0x00, 0x3c, 0x00, 0xea, 0xff,
+    0x02, 0x00, 0x0c, 0x10, 0x01, 0x02, 0x00, 0xf0, 0x0c, 0x11, 0x01, 0x01, 0x00, 0x20, 0xfa, 0xff,
+    0x31, 0x00, 0xe6, 0xff, 0x03, 0x00, 0x00, 0x02, 0x04, 0x04, 0x00, 0xf0, 0x00, 0x02, 0x02, 0x02,
+    0x00, 0x20, 0x02, 0x04, 0x02, 0x02, 0x00, 0x20, 0x11, 0x00, 0xe8, 0xff, 0x41, 0x00, 0x03, 0x00,
+    0x01, 0x01, 0x06, 0x04, 0x00, 0xf0, 0x01, 0x01, 0x03, 0x02, 0x00, 0x20, 0x04, 0x03, 0x03, 0x02,
+    0x00, 0x20, 0x00, 0x00, 0xb0, 0xff, 0x0f, 0x00, 0x02, 0x00, 0x01, 0x12, 0x01, 0x02, 0x00, 0xf0,
+    0x01, 0x13, 0x01, 0x01, 0x00, 0x20, 0xe0, 0xff, 0x57, 0xff, 0x06, 0x00, 0x02, 0x00, 0x04, 0x07,
+    0x02, 0x03, 0x00, 0xf0, 0x04, 0x08, 0x02, 0x01, 0x00, 0x30, 0xbc, 0x02, 0x08, 0x00, 0x8c, 0xff,
+    0x02, 0x00, 0x01, 0x00, 0x09, 0x0e, 0x00, 0xf0, 0x01, 0x07, 0x09, 0x07, 0x00, 0x20, 0xfa, 0xff,
+    0x37, 0x00, 0xeb, 0xff, 0x03, 0x00, 0x04, 0x09, 0x02, 0x06, 0x00, 0xf0, 0x04, 0x09, 0x01, 0x03,
+    0x00, 0x20, 0x05, 0x0c, 0x01, 0x03, 0x00, 0x20, 0xd5, 0xff, 0x3e, 0x00, 0xeb, 0xff, 0x02, 0x00,
+    0x03, 0x09, 0x04, 0x03, 0x00, 0xf0, 0x05, 0x09, 0x02, 0x03, 0x00, 0x20, 0xe9, 0xff, 0x86, 0xff,
+    0x0b, 0x00, 0x02, 0x00, 0x00, 0x09, 0x02, 0x04, 0x00, 0xf0, 0x00, 0x0b, 0x02, 0x02, 0x00, 0x20,
+    0xb4, 0xff, 0x67, 0xff, 0x05, 0x00, 0x02, 0x00, 0x10, 0x06, 0x03, 0x0a, 0x00, 0xf0, 0x11, 0x06,
+    0x01, 0x0a, 0x00, 0x30, 0xfd, 0xff, 0x3e, 0x00, 0xee, 0xff, 0x02, 0x00, 0x10, 0x0b, 0x02, 0x01,
+    0x00, 0xf0, 0x11, 0x0b, 0x01, 0x01, 0x00, 0x20, 0x06, 0xff, 0x58, 0x00, 0x2b, 0x00, 0xdd, 0xff,
+    0x43, 0x00, 0x02, 0x00, 0x05, 0x07, 0x04, 0x04, 0x00, 0xf0, 0x05, 0x09, 0x04, 0x02, 0x00, 0x20,
+    0x90, 0x00, 0xed, 0xff, 0x63, 0x00, 0x02, 0x00, 0x0a, 0x0b, 0x09, 0x02, 0x00, 0xf0, 0x0d, 0x0b,
+    0x03, 0x02, 0x00, 0x30, 0x03, 0x00, 0xe8, 0xff, 0x4a, 0x00, 0x03, 0x00, 0x0f, 0x0a, 0x02, 0x02,
+    0x00, 0xf0, 0x0f, 0x0a, 0x01, 0x01, 0x00, 0x20, 0x10, 0x0b, 0x01, 0x01, 0x00, 0x20, 0x7a, 0x01,
+    0xba, 0xff, 0x14, 0x00, 0x02, 0x00, 0x0a, 0x06, 0x06, 0x0e, 0x00, 0xf0, 0x0a, 0x0d, 0x06, 0x07,
+    0x00, 0x20, 0xf4, 0xff, 0x3a, 0x00, 0xec, 0xff, 0x02, 0x00, 0x0e, 0x07, 0x03, 0x05, 0x00, 0xf0,
+    0x0f, 0x07, 0x01, 0x05, 0x00, 0x30, 0x9e, 0xfe, 0x7a, 0x00, 0xff, 0xff, 0x02, 0x00, 0x06, 0x0b,
+    0x0c, 0x03, 0x00, 0xf0, 0x0a, 0x0b, 0x04, 0x03, 0x00, 0x30, 0x00, 0x00, 0xc7, 0xff, 0x16, 0x00,
+    0x02, 0x00, 0x11, 0x10, 0x01, 0x02, 0x00, 0xf0, 0x11, 0x11, 0x01, 0x01, 0x00, 0x20, 0x6b, 0xff,
+    0x46, 0x00, 0xe7, 0xff, 0x02, 0x00, 0x08, 0x05, 0x05, 0x04, 0x00, 0xf0, 0x08, 0x07, 0x05, 0x02,
+    0x00, 0x20, 0x0a, 0x00, 0xf5, 0xff, 0x50, 0x00, 0x02, 0x00, 0x0b, 0x06, 0x04, 0x02, 0x00, 0xf0,
+    0x0b, 0x07, 0x04, 0x01, 0x00, 0x20, 0xee, 0xff, 0x3c, 0x00, 0xea, 0xff, 0x03, 0x00, 0x03, 0x04,
+    0x08, 0x02, 0x00, 0xf0, 0x03, 0x04, 0x04, 0x01, 0x00, 0x20, 0x07, 0x05, 0x04, 0x01, 0x00, 0x20,
+    0xeb, 0xff, 0x26, 0x00, 0xe0, 0xff, 0x02, 0x00, 0x00, 0x08, 0x06, 0x06, 0x00, 0xf0, 0x02, 0x08,
+    0x02, 0x06, 0x00, 0x30, 0x12, 0x00, 0xf2, 0xff, 0x5d, 0x00, 0x02, 0x00, 0x07, 0x04, 0x06, 0x02,
+    0x00, 0xf0, 0x07, 0x05, 0x06, 0x01, 0x00, 0x20, 0x3b, 0x00, 0x09, 0x00, 0x77, 0xff, 0x02, 0x00,
+    0x07, 0x03, 0x06, 0x03, 0x00, 0xf0, 0x09, 0x03, 0x02, 0x03, 0x00, 0x30, 0x00, 0x00, 0xd4, 0xff,
+    0x1c, 0x00, 0x02, 0x00, 0x02, 0x11, 0x03, 0x03, 0x00, 0xf0, 0x02, 0x12, 0x03, 0x01, 0x00, 0x30,
+    0xe8, 0xff, 0x4f, 0x00, 0xef, 0xff, 0x02, 0x00, 0x03, 0x0a, 0x06, 0x01, 0x00, 0xf0, 0x05, 0x0a,
+    0x02, 0x01, 0x00, 0x30, 0xe8, 0xff, 0xaf, 0xff, 0x10, 0x00, 0x02, 0x00, 0x07, 0x02, 0x06, 0x02,
+    0x00, 0xf0, 0x09, 0x02, 0x02, 0x02, 0x00, 0x30, 0xd3, 0xff, 0x3e, 0x00, 0xec, 0xff, 0x02, 0x00,
+    0x04, 0x0b, 0x09, 0x01, 0x00, 0xf0, 0x07, 0x0b, 0x03, 0x01, 0x00, 0x30, 0x10, 0xff, 0x3e, 0xff,
+    0x07, 0x00, 0x02, 0x00, 0x07, 0x07, 0x0b, 0x0c, 0x00, 0xf0, 0x07, 0x0d, 0x0b, 0x06, 0x00, 0x20,
+    0xee, 0xff, 0x8c, 0xff, 0x07, 0x00, 0x02, 0x00, 0x03, 0x02, 0x03, 0x04, 0x00, 0xf0, 0x04, 0x02,
+    0x01, 0x04, 0x00, 0x30, 0xda, 0xff, 0x25, 0x00, 0xe4, 0xff, 0x02, 0x00, 0x09, 0x07, 0x09, 0x03,
+    0x00, 0xf0, 0x0c, 0x07, 0x03, 0x03, 0x00, 0x30, 0x05, 0x00, 0xe7, 0xff, 0x32, 0x00, 0x03, 0x00,
+    0x0f, 0x0b, 0x02, 0x06, 0x00, 0xf0, 0x0f, 0x0b, 0x01, 0x03, 0x00, 0x20, 0x10, 0x0e, 0x01, 0x03,
+    0x00, 0x20, 0x14, 0x00, 0x08, 0x00, 0x9b, 0xff, 0x02, 0x00, 0x00, 0x05, 0x05, 0x03, 0x00, 0xf0,
+    0x00, 0x06, 0x05, 0x01, 0x00, 0x30, 0xe1, 0xff, 0x17, 0x00, 0xd8, 0xff, 0x02, 0x00, 0x08, 0x01,
+    0x06, 0x0c, 0x00, 0xf0, 0x0a, 0x01, 0x02, 0x0c, 0x00, 0x30, 0xc6, 0xf9, 0x56, 0xff, 0x04, 0x00,
+    0x02, 0x00, 0x03, 0x07, 0x0f, 0x0d, 0x00, 0xf0, 0x08, 0x07, 0x05, 0x0d, 0x00, 0x30, 0x66, 0xfe,
+    0x6d, 0xff, 0x06, 0x00, 0x02, 0x00, 0x00, 0x09, 0x09, 0x09, 0x00, 0xf0, 0x00, 0x0c, 0x09, 0x03,
+    0x00, 0x30, 0x03, 0x00, 0x16, 0x00, 0xd7, 0xff, 0x02, 0x00, 0x10, 0x00, 0x03, 0x08, 0x00, 0xf0,
+    0x11, 0x00, 0x01, 0x08, 0x00, 0x30, 0xf2, 0xff, 0x42, 0x00, 0xf1, 0xff, 0x02, 0x00, 0x10, 0x02,
+    0x04, 0x02, 0x00, 0xf0, 0x12, 0x02, 0x02, 0x02, 0x00, 0x20, 0x22, 0x00, 0xe4, 0xff, 0x28, 0x00,
+    0x02, 0x00, 0x0d, 0x00, 0x06, 0x05, 0x00, 0xf0, 0x10, 0x00, 0x03, 0x05, 0x00, 0x20, 0x09, 0x00,
+    0x09, 0x00, 0x87, 0xff, 0x02, 0x00, 0x0f, 0x01, 0x03, 0x02, 0x00, 0xf0, 0x10, 0x01, 0x01, 0x02,
+    0x00, 0x30, 0x1e, 0x00, 0xf7, 0xff, 0x7e, 0x00, 0x02, 0x00, 0x0b, 0x08, 0x03, 0x02, 0x00, 0xf0,
+    0x0c, 0x08, 0x01, 0x02, 0x00, 0x30, 0x0d, 0x00, 0xe7, 0xff, 0x28, 0x00, 0x03, 0x00, 0x01, 0x08,
+    0x02, 0x0c, 0x00, 0xf0, 0x01, 0x08, 0x01, 0x06, 0x00, 0x20, 0x02, 0x0e, 0x01, 0x06, 0x00, 0x20,
+    0xc0, 0xfe, 0x3c, 0xff, 0x05, 0x00, 0x02, 0x00, 0x00, 0x01, 0x06, 0x0c, 0x00, 0xf0, 0x02, 0x01,
+    0x02, 0x0c, 0x00, 0x30, 0x00, 0x00, 0xde, 0xff, 0x1c, 0x00, 0x02, 0x00, 0x13, 0x11, 0x01, 0x03,
+    0x00, 0xf0, 0x13, 0x12, 0x01, 0x01, 0x00, 0x30, 0xd9, 0xff, 0x40, 0x00, 0xef, 0xff, 0x02, 0x00,
+    0x0b, 0x03, 0x03, 0x0a, 0x00, 0xf0, 0x0c, 0x03, 0x01, 0x0a, 0x00, 0x30, 0xdd, 0xfe, 0x9a, 0xff,
+    0x0a, 0x00, 0x02, 0x00, 0x08, 0x01, 0x09, 0x08, 0x00, 0xf0, 0x0b, 0x01, 0x03, 0x08, 0x00, 0x30,
+    0x01, 0x00, 0x0a, 0x00, 0xac, 0xff, 0x03, 0x00, 0x12, 0x10, 0x02, 0x02, 0x00, 0xf0, 0x12, 0x10,
+    0x01, 0x01, 0x00, 0x20, 0x13, 0x11, 0x01, 0x01, 0x00, 0x20, 0xff, 0xff, 0xbe, 0xff, 0x11, 0x00,
+    0x03, 0x00, 0x12, 0x10, 0x02, 0x02, 0x00, 0xf0, 0x12, 0x10, 0x01, 0x01, 0x00, 0x20, 0x13, 0x11,
+    0x01, 0x01, 0x00, 0x20, 0xf0, 0xff, 0x3d, 0x00, 0xee, 0xff, 0x02, 0x00, 0x06, 0x0d, 0x02, 0x06,
+    0x00, 0xf0, 0x06, 0x0f, 0x02, 0x02, 0x00, 0x30, 0x0d, 0x00, 0xee, 0xff, 0x3d, 0x00, 0x02, 0x00,
+    0x09, 0x0e, 0x02, 0x02, 0x00, 0xf0, 0x09, 0x0f, 0x02, 0x01, 0x00, 0x20, 0xea, 0xff, 0x80, 0x00,
+    0xf9, 0xff, 0x03, 0x00, 0x0e, 0x0a, 0x02, 0x04, 0x00, 0xf0, 0x0e, 0x0a, 0x01, 0x02, 0x00, 0x20,
+    0x0f, 0x0c, 0x01, 0x02, 0x00, 0x20, 0xff, 0xff, 0x3f, 0x00, 0xf2, 0xff, 0x03, 0x00, 0x00, 0x0f,
+    0x02, 0x02, 0x00, 0xf0, 0x00, 0x0f, 0x01, 0x01, 0x00, 0x20, 0x01, 0x10, 0x01, 0x01, 0x00, 0x20,
+    0xfb, 0xff, 0x51, 0x00, 0xf6, 0xff, 0x03, 0x00, 0x06, 0x07, 0x02, 0x02, 0x00, 0xf0, 0x06, 0x07,
+    0x01, 0x01, 0x00, 0x20, 0x07, 0x08, 0x01, 0x01, 0x00, 0x20, 0xff, 0xff, 0xbb, 0xff, 0x0e, 0x00,
+    0x03, 0x00, 0x0b, 0x12, 0x02, 0x02, 0x00, 0xf0, 0x0b, 0x12, 0x01, 0x01, 0x00, 0x20, 0x0c, 0x13,
+    0x01, 0x01, 0x00, 0x20, 0xe3, 0xff, 0x46, 0x00, 0xf3, 0xff, 0x03, 0x00, 0x00, 0x00, 0x06, 0x04,
+    0x00, 0xf0, 0x00, 0x00, 0x03, 0x02, 0x00, 0x20, 0x03, 0x02, 0x03, 0x02, 0x00, 0x20, 0xbb, 0xff,
+    0xa7, 0xff, 0x0b, 0x00, 0x02, 0x00, 0x04, 0x01, 0x06, 0x06, 0x00, 0xf0, 0x06, 0x01, 0x02, 0x06,
+    0x00, 0x30, 0x7a, 0x00, 0x08, 0x00, 0x92, 0xff, 0x02, 0x00, 0x0f, 0x0d, 0x05, 0x04, 0x00, 0xf0,
+    0x0f, 0x0f, 0x05, 0x02, 0x00, 0x20, 0x0b, 0x00, 0x09, 0x00, 0xa2, 0xff, 0x02, 0x00, 0x07, 0x11,
+    0x06, 0x01, 0x00, 0xf0, 0x09, 0x11, 0x02, 0x01, 0x00, 0x30, 0xf9, 0xff, 0x3f, 0x00, 0xf1, 0xff,
+    0x02, 0x00, 0x10, 0x13, 0x04, 0x01, 0x00, 0xf0, 0x12, 0x13, 0x02, 0x01, 0x00, 0x20, 0x14, 0x00,
+    0xeb, 0xff, 0x38, 0x00, 0x02, 0x00, 0x10, 0x10, 0x04, 0x04, 0x00, 0xf0, 0x12, 0x10, 0x02, 0x04,
+    0x00, 0x20, 0x50, 0x01, 0xfc, 0xff, 0xb0, 0x00, 0x02, 0x00, 0x07, 0x08, 0x09, 0x04, 0x00, 0xf0,
+    0x0a, 0x08, 0x03, 0x04, 0x00, 0x30, 0xff, 0xff, 0xc1, 0xff, 0x10, 0x00, 0x03, 0x00, 0x10, 0x12,
+    0x02, 0x02, 0x00, 0xf0, 0x10, 0x12, 0x01, 0x01, 0x00, 0x20, 0x11, 0x13, 0x01, 0x01, 0x00, 0x20,
+    0xf9, 0xff, 0x49, 0x00, 0xf3, 0xff, 0x03, 0x00, 0x02, 0x09, 0x02, 0x04, 0x00, 0xf0, 0x02, 0x09,
+    0x01, 0x02, 0x00, 0x20, 0x03, 0x0b, 0x01, 0x02, 0x00, 0x20, 0xec, 0xff, 0x20, 0x00, 0xe0, 0xff,
+    0x03, 0x00, 0x00, 0x03, 0x08, 0x04, 0x00, 0xf0, 0x00, 0x03, 0x04, 0x02, 0x00, 0x20, 0x04, 0x05,
+    0x04, 0x02, 0x00, 0x20, 0xde, 0xff, 0x3c, 0x00, 0xee, 0xff, 0x02, 0x00, 0x00, 0x01, 0x08, 0x01,
+    0x00, 0xf0, 0x04, 0x01, 0x04, 0x01, 0x00, 0x20, 0x43, 0xfe, 0xbe, 0xff, 0x0f, 0x00, 0x02, 0x00,
+    0x00, 0x05, 0x08, 0x09, 0x00, 0xf0, 0x04, 0x05, 0x04, 0x09, 0x00, 0x20, 0xd9, 0xff, 0x4b, 0xff,
+    0x04, 0x00, 0x02, 0x00, 0x07, 0x12, 0x06, 0x02, 0x00, 0xf0, 0x09, 0x12, 0x02, 0x02, 0x00, 0x30,
+    0x91, 0xff, 0x6b, 0xff, 0x05, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x0c, 0x00, 0xf0, 0x00, 0x08,
+    0x01, 0x04, 0x00, 0x30, 0xe6, 0xff, 0x68, 0xff, 0x05, 0x00, 0x02, 0x00, 0x13, 0x0d, 0x01, 0x06,
+    0x00, 0xf0, 0x13, 0x0f, 0x01, 0x02, 0x00, 0x30, 0xcf, 0xff, 0x21, 0x00, 0xe7, 0xff, 0x02, 0x00,
+    0x02, 0x08, 0x06, 0x08, 0x00, 0xf0, 0x04, 0x08, 0x02, 0x08, 0x00, 0x30, 0x51, 0xfd, 0x6f, 0xff,
+    0x08, 0x00, 0x02, 0x00, 0x00, 0x00, 0x09, 0x11, 0x00, 0xf0, 0x03, 0x00, 0x03, 0x11, 0x00, 0x30,
+    0xca, 0xff, 0x1d, 0x00, 0xe2, 0xff, 0x02, 0x00, 0x07, 0x09, 0x06, 0x08, 0x00, 0xf0, 0x09, 0x09,
+    0x02, 0x08, 0x00, 0x30, 0x3a, 0x01, 0xf8, 0xff, 0x99, 0x00, 0x02, 0x00, 0x05, 0x0a, 0x09, 0x04,
+    0x00, 0xf0, 0x08, 0x0a, 0x03, 0x04, 0x00, 0x30, 0x14, 0x00, 0xf3, 0xff, 0x3b, 0x00, 0x02, 0x00,
+    0x05, 0x00, 0x08, 0x03, 0x00, 0xf0, 0x05, 0x01, 0x08, 0x01, 0x00, 0x30, 0x0d, 0x00, 0xed, 0xff,
+    0x2d, 0x00, 0x03, 0x00, 0x10, 0x06, 0x04, 0x04, 0x00, 0xf0, 0x10, 0x06, 0x02, 0x02, 0x00, 0x20,
+    0x12, 0x08, 0x02, 0x02, 0x00, 0x20, 0xf9, 0xff, 0x32, 0x00, 0xec, 0xff, 0x03, 0x00, 0x11, 0x04,
+    0x02, 0x08, 0x00, 0xf0, 0x11, 0x04, 0x01, 0x04, 0x00, 0x20, 0x12, 0x08, 0x01, 0x04, 0x00, 0x20,
+    0xff, 0xff, 0xb7, 0xff, 0x0c, 0x00, 0x02, 0x00, 0x02, 0x10, 0x01, 0x03, 0x00, 0xf0, 0x02, 0x11,
+    0x01, 0x01, 0x00, 0x30, 0x01, 0x00, 0x11, 0x00, 0xc7, 0xff, 0x02, 0x00, 0x02, 0x10, 0x01, 0x03,
+    0x00, 0xf0, 0x02, 0x11, 0x01, 0x01, 0x00, 0x30, 0xff, 0xff, 0x2a, 0x00, 0xea, 0xff, 0x02, 0x00,
+    0x0b, 0x00, 0x01, 0x03, 0x00, 0xf0, 0x0b, 0x01, 0x01, 0x01, 0x00, 0x30, 0x42, 0x01, 0x06, 0x00,
+    0x72, 0xff, 0x02, 0x00, 0x0b, 0x02, 0x09, 0x07, 0x00, 0xf0, 0x0e, 0x02, 0x03, 0x07, 0x00, 0x30,
+    0xfd, 0xff, 0x23, 0x00, 0xe2, 0xff, 0x02, 0x00, 0x0a, 0x02, 0x03, 0x06, 0x00, 0xf0, 0x0b, 0x02,
+    0x01, 0x06, 0x00, 0x30, 0x62, 0x00, 0x07, 0x00, 0x8a, 0xff, 0x02, 0x00, 0x05, 0x09, 0x0f, 0x02,
+    0x00, 0xf0, 0x05, 0x0a, 0x0f, 0x01, 0x00, 0x20, 0xfa, 0xff, 0x43, 0x00, 0xf2, 0xff, 0x02, 0x00,
+    0x08, 0x10, 0x06, 0x02, 0x00, 0xf0, 0x08, 0x11, 0x06, 0x01, 0x00, 0x20, 0xfd, 0xff, 0x27, 0x00,
+    0xe4, 0xff, 0x03, 0x00, 0x09, 0x10, 0x0a, 0x02, 0x00, 0xf0, 0x09, 0x10, 0x05, 0x01, 0x00, 0x20,
+    0x0e, 0x11, 0x05, 0x01, 0x00, 0x20, 0x01, 0x00, 0x0e, 0x00, 0xb8, 0xff, 0x03, 0x00, 0x09, 0x11,
+    0x02, 0x02, 0x00, 0xf0, 0x09, 0x11, 0x01, 0x01, 0x00, 0x20, 0x0a, 0x12, 0x01, 0x01, 0x00, 0x20,
+    0x08, 0x00, 0xe9, 0xff, 0x2d, 0x00, 0x03, 0x00, 0x0a, 0x0f, 0x06, 0x04, 0x00, 0xf0, 0x0a, 0x0f,
+    0x03, 0x02, 0x00, 0x20, 0x0d, 0x11, 0x03, 0x02, 0x00, 0x20, 0x6d, 0x00, 0x0f, 0x00, 0xc2, 0xff,
+    0x02, 0x00, 0x04, 0x05, 0x0f, 0x0c, 0x00, 0xf0, 0x09, 0x05, 0x05, 0x0c, 0x00, 0x30, 0xf8, 0xff,
+    0x4b, 0x00, 0xf3, 0xff, 0x02, 0x00, 0x0b, 0x0d, 0x02, 0x03, 0x00, 0xf0, 0x0b, 0x0e, 0x02, 0x01,
+    0x00, 0x30, 0x17, 0x00, 0xf0, 0xff, 0x3f, 0x00, 0x02, 0x00, 0x08, 0x0d, 0x07, 0x03, 0x00, 0xf0,
+    0x08, 0x0e, 0x07, 0x01, 0x00, 0x30, 0x00, 0x00, 0xd5, 0xff, 0x18, 0x00, 0x02, 0x00, 0x01, 0x0c,
+    0x01, 0x02, 0x00, 0xf0, 0x01, 0x0d, 0x01, 0x01, 0x00, 0x20, 0x00, 0x00, 0x10, 0x00, 0xc2, 0xff,
+    0x03, 0x00, 0x10, 0x12, 0x02, 0x02, 0x00, 0xf0, 0x10, 0x12, 0x01, 0x01, 0x00, 0x20, 0x11, 0x13,
+    0x01, 0x01, 0x00, 0x20, 0x11, 0x00, 0xe7, 0xff, 0x2e, 0x00, 0x02, 0x00, 0x01, 0x13, 0x12, 0x01,
+    0x00, 0xf0, 0x07, 0x13, 0x06, 0x01, 0x00, 0x30, 0xf8, 0xff, 0x31, 0x00, 0xe8, 0xff, 0x02, 0x00,
+    0x01, 0x11, 0x06, 0x01, 0x00, 0xf0, 0x04, 0x11, 0x03, 0x01, 0x00, 0x20, 0x59, 0x00, 0x09, 0x00,
+    0x8d, 0xff, 0x02, 0x00, 0x01, 0x03, 0x01, 0x0c, 0x00, 0xf0, 0x01, 0x09, 0x01, 0x06, 0x00, 0x20,
+    0xc4, 0xff, 0x90, 0xff, 0x08, 0x00, 0x02, 0x00, 0x00, 0x09, 0x03, 0x06, 0x00, 0xf0, 0x00, 0x0b,
+    0x03, 0x02, 0x00, 0x30, 0xf2, 0xff, 0x32, 0x00, 0xed, 0xff, 0x02, 0x00, 0x05, 0x04, 0x03, 0x0a,
+    0x00, 0xf0, 0x06, 0x04, 0x01, 0x0a, 0x00, 0x30, 0x07, 0x00, 0x05, 0x00, 0x48, 0xff, 0x02, 0x00,
+    0x06, 0x11, 0x02, 0x01, 0x00, 0xf0, 0x07, 0x11, 0x01, 0x01, 0x00, 0x20, 0xfb, 0xff, 0x19, 0x00,
+    0xda, 0xff, 0x02, 0x00, 0x01, 0x00, 0x06, 0x0c, 0x00, 0xf0, 0x03, 0x00, 0x02, 0x0c, 0x00, 0x30,
+    0xf0, 0xff, 0x1d, 0x00, 0xe0, 0xff, 0x02, 0x00, 0x04, 0x07, 0x09, 0x02, 0x00, 0xf0, 0x07, 0x07,
+    0x03, 0x02, 0x00, 0x30, 0xfd, 0xfe, 0x3a, 0x00, 0xb1, 0xff, 0x79, 0x00, 0xe2, 0xff, 0x02, 0x00,
+    0x06, 0x0b, 0x09, 0x01, 0x00, 0xf0, 0x09, 0x0b, 0x03, 0x01, 0x00, 0x30, 0x35, 0x00, 0xbf, 0xff,
+    0x29, 0x00, 0x02, 0x00, 0x11, 0x0a, 0x02, 0x0a, 0x00, 0xf0, 0x11, 0x0f, 0x02, 0x05, 0x00, 0x20,
+    0xfe, 0xff, 0x31, 0x00, 0xd4, 0xff, 0x03, 0x00, 0x04, 0x0a, 0x02, 0x0a, 0x00, 0xf0, 0x04, 0x0a,
+    0x01, 0x05, 0x00, 0x20, 0x05, 0x0f, 0x01, 0x05, 0x00, 0x20, 0xca, 0xff, 0x71, 0x00, 0xe9, 0xff,
+    0x02, 0x00, 0x0c, 0x03, 0x03, 0x0c, 0x00, 0xf0, 0x0d, 0x03, 0x01, 0x0c, 0x00, 0x30, 0x0e, 0x00,
+    0xde, 0xff, 0x2e, 0x00, 0x03, 0x00, 0x0f, 0x03, 0x04, 0x06, 0x00, 0xf0, 0x0f, 0x03, 0x02, 0x03,
+    0x00, 0x20, 0x11, 0x06, 0x02, 0x03, 0x00, 0x20, 0x19, 0x00, 0xf3, 0xff, 0x5c, 0x00, 0x02, 0x00,
+    0x0c, 0x08, 0x03, 0x03, 0x00, 0xf0, 0x0d, 0x08, 0x01, 0x03, 0x00, 0x30, 0x06, 0x00, 0xcd, 0xff,
+    0x1e, 0x00, 0x02, 0x00, 0x04, 0x0e, 0x02, 0x04, 0x00, 0xf0, 0x04, 0x10, 0x02, 0x02, 0x00, 0x20,
+    0x01, 0x00, 0x1a, 0x00, 0xc3, 0xff, 0x02, 0x00, 0x06, 0x10, 0x01, 0x03, 0x00, 0xf0, 0x06, 0x11,
+    0x01, 0x01, 0x00, 0x30, 0xfa, 0xff, 0x48, 0x00, 0xef, 0xff, 0x02, 0x00, 0x01, 0x01, 0x02, 0x03,
+    0x00, 0xf0, 0x02, 0x01, 0x01, 0x03, 0x00, 0x20, 0x0e, 0x00, 0xeb, 0xff, 0x68, 0x00, 0x02, 0x00,
+    0x00, 0x02, 0x04, 0x01, 0x00, 0xf0, 0x02, 0x02, 0x02, 0x01, 0x00, 0x20, 0xed, 0xff, 0x32, 0x00,
+    0xe3, 0xff, 0x02, 0x00, 0x08, 0x11, 0x0c, 0x03, 0x00, 0xf0, 0x0c, 0x11, 0x04, 0x03, 0x00, 0x30,
+    0xd1, 0xff, 0x71, 0xff, 0x11, 0x00, 0x02, 0x00, 0x09, 0x10, 0x06, 0x04, 0x00, 0xf0, 0x0b, 0x10,
+    0x02, 0x04, 0x00, 0x30, 0x90, 0xff, 0x7f, 0x00, 0xf1, 0xff, 0x02, 0x00, 0x04, 0x06, 0x03, 0x06,
+    0x00, 0xf0, 0x04, 0x09, 0x03, 0x03, 0x00, 0x20, 0x28, 0xff, 0x2b, 0x00, 0xdf, 0xff, 0x02, 0x00,
+    0x06, 0x02, 0x0c, 0x09, 0x00, 0xf0, 0x06, 0x05, 0x0c, 0x03, 0x00, 0x30, 0x3a, 0xfb, 0x5b, 0xff,
+    0x0a, 0x00, 0x03, 0x00, 0x06, 0x00, 0x0e, 0x14, 0x00, 0xf0, 0x06, 0x00, 0x07, 0x0a, 0x00, 0x20,
+    0x0d, 0x0a, 0x07, 0x0a, 0x00, 0x20, 0xff, 0xff, 0x40, 0x00, 0xea, 0xff, 0x03, 0x00, 0x0f, 0x10,
+    0x02, 0x02, 0x00, 0xf0, 0x0f, 0x10, 0x01, 0x01, 0x00, 0x20, 0x10, 0x11, 0x01, 0x01, 0x00, 0x20,
+    0x00, 0x00, 0xea, 0xff, 0x3d, 0x00, 0x03, 0x00, 0x0f, 0x10, 0x02, 0x02, 0x00, 0xf0, 0x0f, 0x10,
+    0x01, 0x01, 0x00, 0x20, 0x10, 0x11, 0x01, 0x01, 0x00, 0x20, 0x00, 0x00, 0x1d, 0x00, 0xd0, 0xff,
+    0x02, 0x00, 0x13, 0x08, 0x01, 0x03, 0x00, 0xf0, 0x13, 0x09, 0x01, 0x01, 0x00, 0x30, 0x08, 0x00,
+    0xf4, 0xff, 0x93, 0x00, 0x02, 0x00, 0x0d, 0x04, 0x01, 0x02, 0x00, 0xf0, 0x0d, 0x05, 0x01, 0x01,
+    0x00, 0x20, 0xe4, 0xff, 0x76, 0xff, 0x0c, 0x00, 0x02, 0x00, 0x00, 0x04, 0x04, 0x02, 0x00, 0xf0,
+    0x00, 0x05, 0x04, 0x01, 0x00, 0x20, 0x21, 0x00, 0x06, 0x00, 0x62, 0xff, 0x02, 0x00, 0x13, 0x05,
+    0x01, 0x06, 0x00, 0xf0, 0x13, 0x07, 0x01, 0x02, 0x00, 0x30, 0x00, 0x00, 0xe2, 0xff, 0x29, 0x00,
+    0x02, 0x00, 0x10, 0x00, 0x02, 0x01, 0x00, 0xf0, 0x11, 0x00, 0x01, 0x01, 0x00, 0x20, 0x06, 0x00,
+    0xf1, 0xff, 0x5a, 0x00, 0x02, 0x00, 0x0d, 0x01, 0x01, 0x03, 0x00, 0xf0, 0x0d, 0x02, 0x01, 0x01,
+    0x00, 0x30, 0xff, 0xff, 0xa8, 0xff, 0x10, 0x00, 0x02, 0x00, 0x11, 0x11, 0x01, 0x03, 0x00, 0xf0,
+    0x11, 0x12, 0x01, 0x01, 0x00, 0x30, 0x82, 0xff, 0x33, 0x00, 0xe7, 0xff, 0x03, 0x00, 0x05, 0x04,
+    0x08, 0x08, 0x00, 0xf0, 0x05, 0x04, 0x04, 0x04, 0x00, 0x20, 0x09, 0x08, 0x04, 0x04, 0x00, 0x20,
+    0xfe, 0xff, 0xb0, 0xff, 0x0f, 0x00, 0x03, 0x00, 0x01, 0x02, 0x02, 0x02, 0x00, 0xf0, 0x01, 0x02,
+    0x01, 0x01, 0x00, 0x20, 0x02, 0x03, 0x01, 0x01, 0x00, 0x20, 0xd0, 0xff, 0x33, 0x00, 0xea, 0xff,
+    0x03, 0x00, 0x00, 0x00, 0x08, 0x06, 0x00, 0xf0, 0x00, 0x00, 0x04, 0x03, 0x00, 0x20, 0x04, 0x03,
+    0x04, 0x03, 0x00, 0x20, 0x1d, 0x00, 0xf7, 0xff, 0x88, 0x00, 0x02, 0x00, 0x06, 0x03, 0x04, 0x02,
+    0x00, 0xf0, 0x06, 0x04, 0x04, 0x01, 0x00, 0x20, 0xf8, 0xff, 0xb8, 0xff, 0x12, 0x00, 0x02, 0x00,
+    0x01, 0x00, 0x03, 0x03, 0x00, 0xf0, 0x01, 0x01, 0x03, 0x01, 0x00, 0x30, 0x0e, 0x00, 0xe5, 0xff,
+    0x3f, 0x00, 0x02, 0x00, 0x06, 0x01, 0x07, 0x02, 0x00, 0xf0, 0x06, 0x02, 0x07, 0x01, 0x00, 0x20,
+    0xd9, 0xfd, 0x7f, 0x00, 0xf6, 0xff, 0x02, 0x00, 0x02, 0x06, 0x0c, 0x06, 0x00, 0xf0, 0x06, 0x06,
+    0x04, 0x06, 0x00, 0x30, 0xf7, 0xff, 0x2b, 0x00, 0xe4, 0xff, 0x02, 0x00, 0x01, 0x10, 0x09, 0x02,
+    0x00, 0xf0, 0x04, 0x10, 0x03, 0x02, 0x00, 0x30, 0x11, 0x00, 0x16, 0x00, 0xba, 0xff, 0x02, 0x00,
+    0x07, 0x0f, 0x06, 0x04, 0x00, 0xf0, 0x09, 0x0f, 0x02, 0x04, 0x00, 0x30, 0xe2, 0xff, 0x3f, 0x00,
+    0xe8, 0xff, 0x02, 0x00, 0x06, 0x0f, 0x0c, 0x01, 0x00, 0xf0, 0x0c, 0x0f, 0x06, 0x01, 0x00, 0x20,
+    0x02, 0x00, 0x11, 0x00, 0xaa, 0xff, 0x02, 0x00, 0x11, 0x11, 0x01, 0x03, 0x00, 0xf0, 0x11, 0x12,
+    0x01, 0x01, 0x00, 0x30, 0x00, 0x00, 0xeb, 0xff, 0x3e, 0x00, 0x03, 0x00, 0x11, 0x0f, 0x02, 0x02,
+    0x00, 0xf0, 0x11, 0x0f, 0x01, 0x01, 0x00, 0x20, 0x12, 0x10, 0x01, 0x01, 0x00, 0x20, 0x1b, 0x00,
+    0x07, 0x00, 0x50, 0xff, 0x02, 0x00, 0x03, 0x0d, 0x03, 0x03, 0x00, 0xf0, 0x03, 0x0e, 0x03, 0x01,
+    0x00, 0x30, 0x00, 0x00, 0xd8, 0xff, 0x1e, 0x00, 0x02, 0x00, 0x0a, 0x11, 0x01, 0x03, 0x00, 0xf0,
+    0x0a, 0x12, 0x01, 0x01, 0x00, 0x30, 0xc0, 0xfc, 0x4f, 0xff, 0x07, 0x00, 0x02, 0x00, 0x04, 0x00,
+    0x0e, 0x08, 0x00, 0xf0, 0x0b, 0x00, 0x07, 0x08, 0x00, 0x20, 0x26, 0x00, 0xea, 0xff, 0x3d, 0x00,
+    0x02, 0x00, 0x02, 0x00, 0x0c, 0x02, 0x00, 0xf0, 0x06, 0x00, 0x04, 0x02, 0x00, 0x30, 0xf7, 0xff,
+    0x36, 0x00, 0xdf, 0xff, 0x02, 0x00, 0x02, 0x00, 0x04, 0x03, 0x00, 0xf0, 0x04, 0x00, 0x02, 0x03,
+    0x00, 0x20, 0x00, 0x00, 0x26, 0x00, 0xe0, 0xff, 0x02, 0x00, 0x0d, 0x01, 0x01, 0x02, 0x00, 0xf0,
+    0x0d, 0x02, 0x01, 0x01, 0x00, 0x20, 0x3d, 0x00, 0xf8, 0xff, 0x81, 0x00, 0x02, 0x00, 0x07, 0x05,
+    0x03, 0x06, 0x00, 0xf0, 0x08, 0x05, 0x01, 0x06, 0x00, 0x30, 0x03, 0x00, 0x0c, 0x00, 0x9a, 0xff,
+    0x03, 0x00, 0x12, 0x02, 0x02, 0x02, 0x00, 0xf0, 0x12, 0x02, 0x01, 0x01, 0x00, 0x20, 0x13, 0x03,
+    0x01, 0x01, 0x00, 0x20, 0xef, 0xff, 0x37, 0x00, 0xea, 0xff, 0x02, 0x00, 0x0f, 0x01, 0x02, 0x0e,
+    0x00, 0xf0, 0x10, 0x01, 0x01, 0x0e, 0x00, 0x20, 0x02, 0x00, 0xed, 0xff, 0x43, 0x00, 0x03, 0x00,
+    0x0f, 0x06, 0x02, 0x02, 0x00, 0xf0, 0x0f, 0x06, 0x01, 0x01, 0x00, 0x20, 0x10, 0x07, 0x01, 0x01,
+    0x00, 0x20, 0xbc, 0xff, 0x53, 0xff, 0x08, 0x00, 0x02, 0x00, 0x03, 0x01, 0x06, 0x03, 0x00, 0xf0,
+    0x05, 0x01, 0x02, 0x03, 0x00, 0x30, 0xff, 0xff, 0x3a, 0x00, 0xe9, 0xff, 0x03, 0x00, 0x07, 0x10,
+    0x02, 0x02, 0x00, 0xf0, 0x07, 0x10, 0x01, 0x01, 0x00, 0x20, 0x08, 0x11, 0x01, 0x01, 0x00, 0x20,
+    0x01, 0x00, 0x0e, 0x00, 0xa5, 0xff, 0x03, 0x00, 0x05, 0x11, 0x02, 0x02, 0x00, 0xf0, 0x05, 0x11,
+    0x01, 0x01, 0x00, 0x20, 0x06, 0x12, 0x01, 0x01, 0x00, 0x20, 0xae, 0xff, 0x31, 0x00, 0xe8, 0xff,
+    0x02, 0x00, 0x09, 0x0a, 0x06, 0x0a, 0x00, 0xf0, 0x0b, 0x0a, 0x02, 0x0a, 0x00, 0x30, 0xc5, 0xff,
+    0x51, 0xff, 0x06, 0x00, 0x02, 0x00, 0x0a, 0x11, 0x06, 0x03, 0x00, 0xf0, 0x0c, 0x11, 0x02, 0x03,
+    0x00, 0x30, 0xaa, 0xff, 0x60, 0x00, 0xf3, 0xff, 0x02, 0x00, 0x0e, 0x05, 0x02, 0x0a, 0x00, 0xf0,
+    0x0e, 0x0a, 0x02, 0x05, 0x00, 0x20, 0x56, 0x00, 0x07, 0x00, 0x1c, 0xff, 0x02, 0x00, 0x0b, 0x0c,
+    0x06, 0x02, 0x00, 0xf0, 0x0b, 0x0d, 0x06, 0x01, 0x00, 0x20, 0x04, 0x00, 0xef, 0xff, 0x45, 0x00,
+    0x02, 0x00, 0x08, 0x01, 0x01, 0x03, 0x00, 0xf0, 0x08, 0x02, 0x01, 0x01, 0x00, 0x30, 0x00, 0x00,
+    0x2e, 0x00, 0xe7, 0xff, 0x03, 0x00, 0x0c, 0x0f, 0x02, 0x02, 0x00, 0xf0, 0x0c, 0x0f, 0x01, 0x01,
+    0x00, 0x20, 0x0d, 0x10, 0x01, 0x01, 0x00, 0x20, 0x6c, 0xff, 0x2a, 0xff, 0x06, 0x00, 0x03, 0x00,
+    0x06, 0x08, 0x06, 0x04, 0x00, 0xf0, 0x06, 0x08, 0x03, 0x02, 0x00, 0x20, 0x09, 0x0a, 0x03, 0x02,
+    0x00, 0x20, 0xdb, 0xff, 0x6a, 0x00, 0xf3, 0xff, 0x02, 0x00, 0x07, 0x05, 0x03, 0x05, 0x00, 0xf0,
+    0x08, 0x05, 0x01, 0x05, 0x00, 0x30, 0xf8, 0xff, 0xce, 0xff, 0x1a, 0x00, 0x02, 0x00, 0x00, 0x05,
+    0x07, 0x03, 0x00, 0xf0, 0x00, 0x06, 0x07, 0x01, 0x00, 0x30, 0x06, 0xff, 0x5d, 0x00, 0xa3, 0xff,
+    0x3e, 0x00, 0xdb, 0xff, 0x02, 0x00, 0x07, 0x09, 0x06, 0x06, 0x00, 0xf0, 0x09, 0x09, 0x02, 0x06,
+    0x00, 0x30, 0x68, 0x00, 0xb7, 0xff, 0x1b, 0x00, 0x02, 0x00, 0x05, 0x07, 0x08, 0x08, 0x00, 0xf0,
+    0x05, 0x0b, 0x08, 0x04, 0x00, 0x20, 0xf6, 0xff, 0x4a, 0x00, 0xe6, 0xff, 0x03, 0x00, 0x04, 0x09,
+    0x02, 0x06, 0x00, 0xf0, 0x04, 0x09, 0x01, 0x03, 0x00, 0x20, 0x05, 0x0c, 0x01, 0x03, 0x00, 0x20,
+    0xf1, 0xff, 0x36, 0x00, 0xdd, 0xff, 0x02, 0x00, 0x0a, 0x0b, 0x06, 0x01, 0x00, 0xf0, 0x0c, 0x0b,
+    0x02, 0x01, 0x00, 0x30, 0xbc, 0xff, 0x43, 0x00, 0xf5, 0xff, 0x02, 0x00, 0x0d, 0x06, 0x06, 0x0b,
+    0x00, 0xf0, 0x0f, 0x06, 0x02, 0x0b, 0x00, 0x30, 0x02, 0x00, 0x05, 0x00, 0x92, 0xff, 0x03, 0x00,
+    0x08, 0x11, 0x02, 0x02, 0x00, 0xf0, 0x08, 0x11, 0x01, 0x01, 0x00, 0x20, 0x09, 0x12, 0x01, 0x01,
+    0x00, 0x20, 0x6a, 0xff, 0x8a, 0x00, 0xf5, 0xff, 0x02, 0x00, 0x04, 0x0c, 0x0c, 0x01, 0x00, 0xf0,
+    0x08, 0x0c, 0x04, 0x01, 0x00, 0x30, 0x05, 0x00, 0xdf, 0xff, 0x2a, 0x00, 0x02, 0x00, 0x0b, 0x11,
+    0x03, 0x02, 0x00, 0xf0, 0x0b, 0x12, 0x03, 0x01, 0x00, 0x20, 0xde, 0xff, 0x0e, 0xff, 0x05, 0x00,
+    0x02, 0x00, 0x08, 0x11, 0x06, 0x01, 0x00, 0xf0, 0x0a, 0x11, 0x02, 0x01, 0x00, 0x30, 0x09, 0x01,
+    0xee, 0xff, 0x44, 0x00, 0x02, 0x00, 0x04, 0x01, 0x0e, 0x06, 0x00, 0xf0, 0x04, 0x03, 0x0e, 0x02,
+    0x00, 0x30, 0x7c, 0x00, 0xeb, 0xff, 0x46, 0x00, 0x02, 0x00, 0x0e, 0x02, 0x02, 0x0c, 0x00, 0xf0,
+    0x0e, 0x08, 0x02, 0x06, 0x00, 0x20, 0x0a, 0x00, 0xdf, 0xff, 0x2d, 0x00, 0x02, 0x00, 0x0c, 0x0d,
+    0x03, 0x02, 0x00, 0xf0, 0x0c, 0x0e, 0x03, 0x01, 0x00, 0x20, 0xe4, 0xff, 0x5c, 0xff, 0x0a, 0x00,
+    0x02, 0x00, 0x06, 0x01, 0x06, 0x01, 0x00, 0xf0, 0x08, 0x01, 0x02, 0x01, 0x00, 0x30, 0xfc, 0xff,
+    0x24, 0x00, 0xe3, 0xff, 0x02, 0x00, 0x0a, 0x06, 0x06, 0x01, 0x00, 0xf0, 0x0c, 0x06, 0x02, 0x01,
+    0x00, 0x30, 0x00, 0x00, 0x28, 0x00, 0xe4, 0xff, 0x02, 0x00, 0x03, 0x13, 0x02, 0x01, 0x00, 0xf0,
+    0x04, 0x13, 0x01, 0x01, 0x00, 0x20, 0xff, 0xff, 0xab, 0xff, 0x0b, 0x00, 0x03, 0x00, 0x12, 0x10,
+    0x02, 0x02, 0x00, 0xf0, 0x12, 0x10, 0x01, 0x01, 0x00, 0x20, 0x13, 0x11, 0x01, 0x01, 0x00, 0x20,
+    0xf9, 0xff, 0x2b, 0x00, 0xe5, 0xff, 0x02, 0x00, 0x10, 0x0b, 0x03, 0x07, 0x00, 0xf0, 0x11, 0x0b,
+    0x01, 0x07, 0x00, 0x30, 0xca, 0xff, 0x6b, 0xff, 0x07, 0x00, 0x02, 0x00, 0x13, 0x05, 0x01, 0x06,
+    0x00, 0xf0, 0x13, 0x08, 0x01, 0x03, 0x00, 0x20, 0xf9, 0xff, 0x24, 0x00, 0xe4, 0xff, 0x02, 0x00,
+    0x09, 0x08, 0x04, 0x03, 0x00, 0xf0, 0x09, 0x09, 0x04, 0x01, 0x00, 0x30, 0xe6, 0xff, 0x46, 0x00,
+    0xf3, 0xff, 0x03, 0x00, 0x10, 0x08, 0x04, 0x04, 0x00, 0xf0, 0x10, 0x08, 0x02, 0x02, 0x00, 0x20,
+    0x12, 0x0a, 0x02, 0x02, 0x00, 0x20, 0x00, 0x00, 0x21, 0x00, 0xe4, 0xff, 0x03, 0x00, 0x02, 0x08,
+    0x02, 0x02, 0x00, 0xf0, 0x02, 0x08, 0x01, 0x01, 0x00, 0x20, 0x03, 0x09, 0x01, 0x01, 0x00, 0x20,
+    0x59, 0x00, 0xfa, 0xff, 0x80, 0x00, 0x03, 0x00, 0x03, 0x05, 0x06, 0x04, 0x00, 0xf0, 0x03, 0x05,
+    0x03, 0x02, 0x00, 0x20, 0x06, 0x07, 0x03, 0x02, 0x00, 0x20, 0x90, 0xff, 0xc3, 0xff, 0x0f, 0x00,
+    0x03, 0x00, 0x02, 0x03, 0x08, 0x10, 0x00, 0xf0, 0x02, 0x03, 0x04, 0x08, 0x00, 0x20, 0x06, 0x0b,
+    0x04, 0x08, 0x00, 0x20, 0x00, 0x00, 0xde, 0xff, 0x19, 0x00, 0x02, 0x00, 0x11, 0x11, 0x01, 0x03,
+    0x00, 0xf0, 0x11, 0x12, 0x01, 0x01, 0x00, 0x30, 0x1f, 0x01, 0xf2, 0xff, 0x3f, 0x00, 0x02, 0x00,
+    0x07, 0x02, 0x08, 0x0b, 0x00, 0xf0, 0x0b, 0x02, 0x04, 0x0b, 0x00, 0x20, 0xda, 0xfe, 0xa0, 0xff,
+    0x0a, 0x00, 0x02, 0x00, 0x0d, 0x03, 0x06, 0x0e, 0x00, 0xf0, 0x10, 0x03, 0x03, 0x0e, 0x00, 0x20,
+    0x47, 0xfe, 0xa1, 0xff, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x09, 0x12, 0x02, 0x00, 0xf0, 0x06, 0x09,
+    0x06, 0x02, 0x00, 0x30, 0x05, 0x00, 0x14, 0x00, 0xd4, 0xff, 0x02, 0x00, 0x06, 0x0a, 0x0e, 0x03,
+    0x00, 0xf0, 0x06, 0x0b, 0x0e, 0x01, 0x00, 0x30, 0x17, 0x01, 0xf7, 0xff, 0x68, 0x00, 0x02, 0x00,
+    0x0a, 0x09, 0x09, 0x03, 0x00, 0xf0, 0x0d, 0x09, 0x03, 0x03, 0x00, 0x30, 0xe5, 0xff, 0x31, 0x00,
+    0xeb, 0xff, 0x03, 0x00, 0x03, 0x05, 0x04, 0x06, 0x00, 0xf0, 0x03, 0x05, 0x02, 0x03, 0x00, 0x20,
+    0x05, 0x08, 0x02, 0x03, 0x00, 0x20, 0xfe, 0xff, 0x21, 0x00, 0xdc, 0xff, 0x02, 0x00, 0x03, 0x07,
+    0x03, 0x07, 0x00, 0xf0, 0x04, 0x07, 0x01, 0x07, 0x00, 0x30, 0x12, 0xff, 0xb3, 0xff, 0x0d, 0x00,
+    0x02, 0x00, 0x02, 0x08, 0x0b, 0x06, 0x00, 0xf0, 0x02, 0x0a, 0x0b, 0x02, 0x00, 0x30, 0xe7, 0xff,
+    0x38, 0x00, 0xed, 0xff, 0x02, 0x00, 0x08, 0x09, 0x06, 0x03, 0x00, 0xf0, 0x08, 0x0a, 0x06, 0x01,
+    0x00, 0x30, 0xc9, 0xff, 0x9d, 0xff, 0x0a, 0x00, 0x02, 0x00, 0x03, 0x03, 0x03, 0x0b, 0x00, 0xf0,
+    0x04, 0x03, 0x01, 0x0b, 0x00, 0x30, 0x05, 0x00, 0xe8, 0xff, 0x26, 0x00, 0x02, 0x00, 0x00, 0x13,
+    0x06, 0x01, 0x00, 0xf0, 0x03, 0x13, 0x03, 0x01, 0x00, 0x20, 0x00, 0x00, 0xc3, 0xff, 0x10, 0x00,
+    0x02, 0x00, 0x12, 0x12, 0x01, 0x02, 0x00, 0xf0, 0x12, 0x13, 0x01, 0x01, 0x00, 0x20, 0xc3, 0xfe,
+    0x8f, 0x00, 0xfa, 0xff, 0x03, 0x00, 0x08, 0x00, 0x0c, 0x06, 0x00, 0xf0, 0x08, 0x00, 0x06, 0x03,
+    0x00, 0x20, 0x0e, 0x03, 0x06, 0x03, 0x00, 0x20, 0x03, 0x00, 0x0e, 0x00, 0xb9, 0xff, 0x02, 0x00,
+    0x13, 0x05, 0x01, 0x03, 0x00, 0xf0, 0x13, 0x06, 0x01, 0x01, 0x00, 0x30, 0x04, 0x00, 0xf1, 0xff,
+    0x3f, 0x00, 0x02, 0x00, 0x05, 0x08, 0x02, 0x01, 0x00, 0xf0, 0x06, 0x08, 0x01, 0x01, 0x00, 0x20,
+    0xfd, 0xff, 0x3c, 0x00, 0xf0, 0xff, 0x02, 0x00, 0x0d, 0x0b, 0x02, 0x01, 0x00, 0xf0, 0x0e, 0x0b,
+    0x01, 0x01, 0x00, 0x20, 0x55, 0x01, 0x0d, 0x00, 0xb1, 0xff, 0x02, 0x00, 0x03, 0x06, 0x0f, 0x0d,
+    0x00, 0xf0, 0x08, 0x06, 0x05, 0x0d, 0x00, 0x30, 0xdb, 0xff, 0x9c, 0xff, 0x08, 0x00, 0x02, 0x00,
+    0x04, 0x03, 0x06, 0x02, 0x00, 0xf0, 0x06, 0x03, 0x02, 0x02, 0x00, 0x30, 0xff, 0xff, 0xb1, 0xff,
+    0x0c, 0x00, 0x02, 0x00, 0x00, 0x12, 0x01, 0x02, 0x00, 0xf0, 0x00, 0x13, 0x01, 0x01, 0x00, 0x20,
+    0x1f, 0x00, 0xf5, 0xff, 0x5d, 0x00, 0x02, 0x00, 0x07, 0x08, 0x02, 0x06, 0x00, 0xf0, 0x08, 0x08,
+    0x01, 0x06, 0x00, 0x20, 0x02, 0xfe, 0x2f, 0xff, 0x04, 0x00, 0x02, 0x00, 0x03, 0x00, 0x06, 0x13,
+    0x00, 0xf0, 0x05, 0x00, 0x02, 0x13, 0x00, 0x30, 0x36, 0x00, 0x09, 0x00, 0xab, 0xff, 0x02, 0x00,
+    0x03, 0x01, 0x06, 0x05, 0x00, 0xf0, 0x05, 0x01, 0x02, 0x05, 0x00, 0x30, 0xe5, 0xff, 0xa5, 0xff,
+    0x0a, 0x00, 0x02, 0x00, 0x11, 0x0e, 0x03, 0x06, 0x00, 0xf0, 0x11, 0x10, 0x03, 0x02, 0x00, 0x30,
+    0xf5, 0xff, 0x40, 0x00, 0xf2, 0xff, 0x02, 0x00, 0x11, 0x0d, 0x02, 0x06, 0x00, 0xf0, 0x12, 0x0d,
+    0x01, 0x06, 0x00, 0x20, 0x03, 0x00, 0xee, 0xff, 0x3a, 0x00, 0x02, 0x00, 0x11, 0x12, 0x02, 0x02,
+    0x00, 0xf0, 0x12, 0x12, 0x01, 0x02, 0x00, 0x20, 0x33, 0xff, 0x5f, 0xff, 0x07, 0x00, 0x02, 0x00,
+    0x0b, 0x0e, 0x09, 0x04, 0x00, 0xf0, 0x0e, 0x0e, 0x03, 0x04, 0x00, 0x30, 0x1e, 0x00, 0xef, 0xff,
+    0x47, 0x00, 0x03, 0x00, 0x0f, 0x08, 0x04, 0x06, 0x00, 0xf0, 0x0f, 0x08, 0x02, 0x03, 0x00, 0x20,
+    0x11, 0x0b, 0x02, 0x03, 0x00, 0x20, 0xfe, 0xff, 0xa4, 0xff, 0x0a, 0x00, 0x02, 0x00, 0x01, 0x10,
+    0x01, 0x03, 0x00, 0xf0, 0x01, 0x11, 0x01, 0x01, 0x00, 0x30, 0xf9, 0xff, 0x24, 0x00, 0xe5, 0xff,
+    0x02, 0x00, 0x07, 0x00, 0x03, 0x0e, 0x00, 0xf0, 0x08, 0x00, 0x01, 0x0e, 0x00, 0x30, 0xff, 0xff,
+    0x37, 0x00, 0xef, 0xff, 0x02, 0x00, 0x0c, 0x00, 0x02, 0x01, 0x00, 0xf0, 0x0d, 0x00, 0x01, 0x01,
+    0x00, 0x20, 0xde, 0xfe, 0x73, 0x00, 0xf6, 0xff, 0x02, 0x00, 0x07, 0x09, 0x06, 0x05, 0x00, 0xf0,
+    0x0a, 0x09, 0x03, 0x05, 0x00, 0x20, 0x26, 0xff, 0x53, 0xff, 0x04, 0x00, 0x02, 0x00, 0x0f, 0x05,
+    0x04, 0x09, 0x00, 0xf0, 0x11, 0x05, 0x02, 0x09, 0x00, 0x20, 0xae, 0xff, 0x91, 0xff, 0x08, 0x00,
+    0x02, 0x00, 0x0b, 0x00, 0x06, 0x06, 0x00, 0xf0, 0x0d, 0x00, 0x02, 0x06, 0x00, 0x30, 0x04, 0x00,
+    0xfa, 0xff, 0x82, 0x00, 0x03, 0x00, 0x10, 0x0f, 0x02, 0x02, 0x00, 0xf0, 0x10, 0x0f, 0x01, 0x01,
+    0x00, 0x20, 0x11, 0x10, 0x01, 0x01, 0x00, 0x20, 0x00, 0x00, 0x2e, 0x00, 0xeb, 0xff, 0x03, 0x00,
+    0x10, 0x0f, 0x02, 0x02, 0x00, 0xf0, 0x10, 0x0f, 0x01, 0x01, 0x00, 0x20, 0x11, 0x10, 0x01, 0x01,
+    0x00, 0x20, 0x3e, 0x00, 0xcd, 0xff, 0x11, 0x00, 0x02, 0x00, 0x0d, 0x02, 0x02, 0x12, 0x00, 0xf0,
+    0x0d, 0x0b, 0x02, 0x09, 0x00, 0x20, 0xac, 0xfc, 0xab, 0x00, 0xfb, 0xff, 0x02, 0x00, 0x08, 0x04,
+    0x08, 0x0a, 0x00, 0xf0, 0x08, 0x09, 0x08, 0x05, 0x00, 0x20, 0x06, 0x00, 0xed, 0xff, 0x2c, 0x00,
+    0x02, 0x00, 0x08, 0x03, 0x02, 0x03, 0x00, 0xf0, 0x08, 0x04, 0x02, 0x01, 0x00, 0x30, 0x28, 0xff,
+    0x3f, 0x00, 0xf0, 0xff, 0x02, 0x00, 0x0b, 0x01, 0x06, 0x09, 0x00, 0xf0, 0x0b, 0x04, 0x06, 0x03,
+    0x00, 0x30, 0xa8, 0xff, 0xb6, 0xff, 0x0d, 0x00, 0x02, 0x00, 0x0f, 0x04, 0x05, 0x06, 0x00, 0xf0,
+    0x0f, 0x06, 0x05, 0x02, 0x00, 0x30, 0x00, 0x00, 0xc8, 0xff, 0x10, 0x00, 0x03, 0x00, 0x0c, 0x12,
+    0x02, 0x02, 0x00, 0xf0, 0x0c, 0x12, 0x01, 0x01, 0x00, 0x20, 0x0d, 0x13, 0x01, 0x01, 0x00, 0x20,
+    0x00, 0x00, 0xe3, 0xff, 0x1d, 0x00, 0x02, 0x00, 0x01, 0x11, 0x01, 0x03, 0x00, 0xf0, 0x01, 0x12,
+    0x01, 0x01, 0x00, 0x30, 0x00, 0x00, 0x28, 0x00, 0xeb, 0xff, 0x02, 0x00, 0x0c, 0x13, 0x02, 0x01,
+    0x00, 0xf0, 0x0d, 0x13, 0x01, 0x01, 0x00, 0x20, 0xcf, 0xff, 0x1f, 0x00, 0xe4, 0xff, 0x02, 0x00,
+    0x08, 0x0a, 0x06, 0x06, 0x00, 0xf0, 0x0a, 0x0a, 0x02, 0x06, 0x00, 0x30, 0xb8, 0xff, 0xa7, 0xff,
+    0x08, 0x00, 0x02, 0x00, 0x0e, 0x02, 0x06, 0x05, 0x00, 0xf0, 0x10, 0x02, 0x02, 0x05, 0x00, 0x30,
+    0xe7, 0xff, 0x21, 0x00, 0xe5, 0xff, 0x02, 0x00, 0x09, 0x05, 0x02, 0x06, 0x00, 0xf0, 0x09, 0x07,
+    0x02, 0x02, 0x00, 0x30, 0xfd, 0xff, 0x2c, 0x00, 0xea, 0xff, 0x02, 0x00, 0x01, 0x0f, 0x02, 0x02,
+    0x00, 0xf0, 0x02, 0x0f, 0x01, 0x02, 0x00, 0x20, 0xff, 0xff, 0xb8, 0xff, 0x0d, 0x00, 0x02, 0x00,
+    0x12, 0x11, 0x01, 0x03, 0x00, 0xf0, 0x12, 0x12, 0x01, 0x01, 0x00, 0x30, 0xbb, 0xff, 0x64, 0x00,
+    0xf6, 0xff, 0x02, 0x00, 0x0a, 0x0e, 0x04, 0x06, 0x00, 0xf0, 0x0a, 0x10, 0x04, 0x02, 0x00, 0x30,
+    0x13, 0x00, 0xf8, 0xff, 0x69, 0x00, 0x02, 0x00, 0x09, 0x07, 0x03, 0x02, 0x00, 0xf0, 0x0a, 0x07,
+    0x01, 0x02, 0x00, 0x30, 0xd6, 0xff, 0x6f, 0xff, 0x07, 0x00, 0x03, 0x00, 0x06, 0x09, 0x06, 0x02,
+    0x00, 0xf0, 0x06, 0x09, 0x03, 0x01, 0x00, 0x20, 0x09, 0x0a, 0x03, 0x01, 0x00, 0x20, 0xa6, 0xff,
+    0x8c, 0xff, 0x06, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x0c, 0x00, 0xf0, 0x00, 0x06, 0x01, 0x04,
+    0x00, 0x30, 0xe4, 0xff, 0x28, 0x00, 0xe9, 0xff, 0x02, 0x00, 0x04, 0x00, 0x0f, 0x01, 0x00, 0xf0,
+    0x09, 0x00, 0x05, 0x01, 0x00, 0x30, 0xfe, 0xff, 0xdc, 0xff, 0x1a, 0x00, 0x03, 0x00, 0x09, 0x00,
+    0x08, 0x02, 0x00, 0xf0, 0x09, 0x00, 0x04, 0x01, 0x00, 0x20, 0x0d, 0x01, 0x04, 0x01, 0x00, 0x20,
+    0xf7, 0xff, 0x2a, 0x00, 0xeb, 0xff, 0x02, 0x00, 0x0c, 0x02, 0x08, 0x01, 0x00, 0xf0, 0x10, 0x02,
+    0x04, 0x01, 0x00, 0x20, 0x8d, 0xff, 0x45, 0x00, 0xf2, 0xff, 0x02, 0x00, 0x07, 0x01, 0x0a, 0x06,
+    0x00, 0xf0, 0x07, 0x03, 0x0a, 0x02, 0x00, 0x30, 0x08, 0x00, 0x0a, 0x00, 0xaf, 0xff, 0x02, 0x00,
+    0x12, 0x06, 0x02, 0x03, 0x00, 0xf0, 0x12, 0x07, 0x02, 0x01, 0x00, 0x30, 0xff, 0xff, 0x29, 0x00,
+    0xeb, 0xff, 0x03, 0x00, 0x04, 0x0c, 0x02, 0x02, 0x00, 0xf0, 0x04, 0x0c, 0x01, 0x01, 0x00, 0x20,
+    0x05, 0x0d, 0x01, 0x01, 0x00, 0x20, 0xbc, 0xff, 0x93, 0xff, 0x07, 0x00, 0x02, 0x00, 0x06, 0x06,
+    0x06, 0x02, 0x00, 0xf0, 0x08, 0x06, 0x02, 0x02, 0x00, 0x30, 0xea, 0x01, 0xfc, 0xff, 0xcc, 0x00,
+    0x02, 0x00, 0x00, 0x09, 0x09, 0x06, 0x00, 0xf0, 0x03, 0x09, 0x03, 0x06, 0x00, 0x30, 0xff, 0xff,
+    0x28, 0x00, 0xeb, 0xff, 0x02, 0x00, 0x11, 0x12, 0x02, 0x02, 0x00, 0xf0, 0x12, 0x12, 0x01, 0x02,
+    0x00, 0x20, 0xb6, 0xff, 0x31, 0x00, 0xee, 0xff, 0x02, 0x00, 0x0b, 0x02, 0x06, 0x10, 0x00, 0xf0,
+    0x0d, 0x02, 0x02, 0x10, 0x00, 0x30, 0xff, 0xff, 0x14, 0x00, 0xcb, 0xff, 0x02, 0x00, 0x02, 0x04,
+    0x0f, 0x0d, 0x00, 0xf0, 0x07, 0x04, 0x05, 0x0d, 0x00, 0x30, 0x01, 0x00, 0x19, 0x00, 0xda, 0xff,
+    0x02, 0x00, 0x10, 0x02, 0x03, 0x0a, 0x00, 0xf0, 0x11, 0x02, 0x01, 0x0a, 0x00, 0x30, 0x03, 0x00,
+    0xee, 0xff, 0x37, 0x00, 0x02, 0x00, 0x06, 0x0a, 0x02, 0x01, 0x00, 0xf0, 0x07, 0x0a, 0x01, 0x01,
+    0x00, 0x20, 0xe4, 0x06, 0xf9, 0xff, 0x92, 0x00, 0x02, 0x00, 0x01, 0x01, 0x12, 0x10, 0x00, 0xf0,
+    0x0a, 0x01, 0x09, 0x10, 0x00, 0x20, 0x02, 0x00, 0x1d, 0x00, 0xe0, 0xff, 0x02, 0x00, 0x0e, 0x04,
+    0x03, 0x0f, 0x00, 0xf0, 0x0f, 0x04, 0x01, 0x0f, 0x00, 0x30, 0x00, 0x00, 0xd5, 0xff, 0x14, 0x00,
+    0x02, 0x00, 0x13, 0x0d, 0x01, 0x02, 0x00, 0xf0, 0x13, 0x0e, 0x01, 0x01, 0x00, 0x20, 0x1e, 0xff,
+    0x74, 0x00, 0xf9, 0xff, 0x02, 0x00, 0x02, 0x06, 0x05, 0x08, 0x00, 0xf0, 0x02, 0x0a, 0x05, 0x04,
+    0x00, 0x20,
+};
@@ -1,31 +1,53 @@
 #include <stdio.h>
+#include <string.h>
 #include "imlib.h"
 #include "xalloc.h"
 #include "fb_alloc.h"
-#include "gc.h"
 
 #define PATTERN_SCALE   (22)
-#define MAX_CORNERS     (1500)  // allocated on fb
+#define CELL_SIZE       (32)    // FREAK keypoints grid cell size
+#define CELL_CORNERS    (8)     // FREAK keypoints per grid cell
 #define Compare(X, Y) ((X)>=(Y))
 
+// Corners are bucketed in a grid and only the strongest cell_max corners of
+// each cell are kept, in a min-heap per cell. Only one row of cells (a band)
+// is kept, the band is written out when the detector moves past it.
 typedef struct {
-    uint16_t x;
-    uint16_t y;
-    uint8_t score;
-} corner_t;
+    int cell_size;
+    int cell_max;
+    int x_offs;         // First column of the grid.
+    int y_offs;         // First row of the current band.
+    int n_cells;        // Cells per band.
+    uint16_t *counts;   // Number of corners per cell.
+    corner_t *heaps;    // cell_max corners per cell.
+} corner_grid_t;
 
 static int pixel[16];
-static corner_t *fast9_detect(image_t *image, rectangle_t *roi, int *n_corners, int b);
-static void fast9_score(image_t *image, corner_t *corners, int num_corners, int b);
-static void nonmax_suppression(corner_t *corners, int num_corners, array_t *keypoints);
+static void fast9_detect(image_t *image, rectangle_t *roi, int b, int border, corner_grid_t *grid, arena_t *corners);
 
-static kp_t *alloc_keypoint(uint16_t x, uint16_t y)
+// Bytes per keypoint, the descriptor, x, y, match, score and angle.
+#define KP_SIZE (KP_DESC_SIZE + sizeof(uint16_t)*3 + sizeof(uint8_t)*2)
+
+void kp_set_alloc(kp_set_t *kpts, int n_kpts)
+{
+    // Note must set keypoint descriptors to zeros. The descriptors
+    // come first so they're word aligned, and so the set holds a
+    // pointer to the start of the block.
+    uint8_t *data = xalloc0(n_kpts * KP_SIZE);
+    kpts->n_kpts = n_kpts;
+    kpts->desc = data;
+    kpts->x = (uint16_t *) (data + (n_kpts * KP_DESC_SIZE));
+    kpts->y = kpts->x + n_kpts;
+    kpts->match = (int16_t *) (kpts->y + n_kpts);
+    kpts->score = (uint8_t *) (kpts->match + n_kpts);
+    kpts->angle = kpts->score + n_kpts;
+}
+
+void kp_set_free(kp_set_t *kpts)
 {
-    // Note must set keypoint descriptor to zeros
-    kp_t *kpt = xalloc0(sizeof*kpt);
-    kpt->x = x;
-    kpt->y = y;
-    return kpt;
+    xfree(kpts->desc);
+    kpts->desc = NULL;
+    kpts->n_kpts = 0;
 }
 
 static void make_offsets(int pixel[], int row_stride)
@@ -48,124 +70,127 @@ static void make_offsets(int pixel[], int row_stride)
     pixel[15] = -1 + row_stride * 3;
 }
 
-void fast_detect(image_t *image, array_t *keypoints, int threshold, rectangle_t *roi)
+void fast_find_corners(image_t *image, arena_t *corners, int threshold, int border,
+        int cell_size, int cell_max, rectangle_t *roi)
 {
-    int num_corners=0;
     make_offsets(pixel, image->w);
+    arena_alloc(corners, sizeof(corner_t), 16);
 
-    // Find corners
-    corner_t *corners = fast9_detect(image, roi, &num_corners, threshold);
-    if (num_corners) {
-        // Score corners
-        fast9_score(image, corners, num_corners, threshold);
-        // Non-max suppression
-        nonmax_suppression(corners, num_corners, keypoints);
+    int w = roi->w - (border*2);
+    if (w <= 0 || (roi->h - (border*2)) <= 0) {
+        return;
     }
-    // Free corners;
-    fb_free();
-}
 
-static void nonmax_suppression(corner_t *corners, int num_corners, array_t *keypoints)
-{
-    gc_info_t info;
+    corner_grid_t grid = {
+        .cell_size = cell_size,
+        .cell_max = cell_max,
+        .x_offs = roi->x + border,
+        .y_offs = roi->y + border,
+        .n_cells = (w + cell_size - 1) / cell_size,
+    };
+    grid.counts = fb_alloc0(grid.n_cells * sizeof(uint16_t));
+    grid.heaps = fb_alloc(grid.n_cells * cell_max * sizeof(corner_t));
 
-	int last_row;
-	int* row_start;
-	const int sz = num_corners;
+    // Find, score and suppress corners
+    fast9_detect(image, roi, threshold, border, &grid, corners);
 
-	/* Point above points (roughly) to the pixel above
-       the one of interest, if there is a feature there.*/
-	int point_above = 0;
-	int point_below = 0;
+    fb_free(); // heaps
+    fb_free(); // counts
+}
 
-	/* Find where each row begins (the corners are output in raster scan order).
-       A beginning of -1 signifies that there are no corners on that row. */
-	last_row  = corners[sz-1].y;
-	row_start = (int*) fb_alloc((last_row+1)*sizeof(int));
+void fast_detect(image_t *image, kp_set_t *kpts, int threshold, rectangle_t *roi)
+{
+    arena_t corners;
+    fast_find_corners(image, &corners, threshold, PATTERN_SCALE, CELL_SIZE, CELL_CORNERS, roi);
 
-	for(int i=0; i<last_row+1; i++) {
-		row_start[i] = -1;
+    // The number of corners is bounded by the grid, the keypoints are
+    // allocated at once (this raises a MemoryError if they don't fit).
+    int n_kpts = arena_length(&corners);
+    kp_set_alloc(kpts, n_kpts);
+    for (int i=0; i<n_kpts; i++) {
+        corner_t *c = arena_at(&corners, i);
+        kpts->x[i] = c->x;
+        kpts->y[i] = c->y;
+        kpts->score[i] = c->score;
+        kpts->match[i] = -1;
     }
 
-    for (int i=0, prev_row=-1; i<sz; i++) {
-        corner_t *c = &corners[i];
-        if (c->y != prev_row) {
-            row_start[c->y] = i;
-            prev_row = c->y;
-        }
-    }
+    arena_free(&corners);
+}
 
-    for(int i=0; i<sz; i++) {
-        corner_t pos = corners[i];
-        uint8_t score = pos.score;
+static void heap_sift_up(corner_t *heap, int i)
+{
+    for (int parent; i > 0 && heap[i].score < heap[(parent = (i-1)/2)].score; i=parent) {
+        corner_t t = heap[i]; heap[i] = heap[parent]; heap[parent] = t;
+    }
+}
 
-        /*Check left */
-        if (i > 0) {
-            if (corners[i-1].x == pos.x-1 && corners[i-1].y == pos.y && Compare(corners[i-1].score, score)) {
-                goto nonmax;
-            }
+static void heap_sift_down(corner_t *heap, int n, int i)
+{
+    for (int c; (c = (i*2)+1) < n; i=c) {
+        if ((c+1) < n && heap[c+1].score < heap[c].score) {
+            c++;
         }
-
-        /*Check right*/
-        if (i < (sz - 1)) {
-            if (corners[i+1].x == pos.x+1 && corners[i+1].y == pos.y && Compare(corners[i+1].score, score)) {
-                goto nonmax;
-            }
+        if (heap[i].score <= heap[c].score) {
+            break;
         }
+        corner_t t = heap[i]; heap[i] = heap[c]; heap[c] = t;
+    }
+}
 
-        /*Check above (if there is a valid row above)*/
-        if (pos.y != 0 && row_start[pos.y - 1] != -1)  {
-            /*Make sure that current point_above is one row above.*/
-            if(corners[point_above].y < pos.y - 1)
-                point_above = row_start[pos.y-1];
-
-            /*Make point_above point to the first of the pixels above the current point, if it exists.*/
-            for (; corners[point_above].y < pos.y && corners[point_above].x < pos.x - 1; point_above++) {
+static void grid_add_corner(corner_grid_t *grid, int x, int y, uint8_t score)
+{
+    int cell = (x - grid->x_offs) / grid->cell_size;
+    corner_t *heap = grid->heaps + (cell * grid->cell_max);
+    int count = grid->counts[cell];
 
-            }
+    if (count < grid->cell_max) {
+        heap[count] = (corner_t) {x, y, score};
+        heap_sift_up(heap, count);
+        grid->counts[cell]++;
+    } else if (score > heap[0].score) {
+        // Replace the weakest corner
+        heap[0] = (corner_t) {x, y, score};
+        heap_sift_down(heap, count, 0);
+    }
+}
 
-            for (int j=point_above; corners[j].y < pos.y && corners[j].x <= pos.x + 1; j++) {
-                int x = corners[j].x;
-                if( (x == pos.x - 1 || x ==pos.x || x == pos.x+1) && Compare(corners[j].score, score))
-                    goto nonmax;
+// Writes out the corners of the current band in raster order (by row) and starts the next band.
+static void grid_flush_band(corner_grid_t *grid, arena_t *corners)
+{
+    for (int y=grid->y_offs; y<(grid->y_offs + grid->cell_size); y++) {
+        for (int cell=0; cell<grid->n_cells; cell++) {
+            corner_t *heap = grid->heaps + (cell * grid->cell_max);
+            for (int i=0; i<grid->counts[cell]; i++) {
+                if (heap[i].y == y) {
+                    *((corner_t *) arena_push_back(corners)) = heap[i];
+                }
             }
         }
+    }
+    memset(grid->counts, 0, grid->n_cells * sizeof(uint16_t));
+    grid->y_offs += grid->cell_size;
+}
 
-        /*Check below (if there is anything below)*/
-        if (pos.y != last_row && row_start[pos.y + 1] != -1 && point_below < sz) /*Nothing below*/ {
-            if (corners[point_below].y < pos.y + 1)
-                point_below = row_start[pos.y+1];
-
-            /* Make point below point to one of the pixels belowthe current point, if it exists.*/
-            for (; point_below < sz && corners[point_below].y == pos.y+1 && corners[point_below].x < pos.x - 1; point_below++) {
-            }
-
-            for (int j=point_below; j < sz && corners[j].y == pos.y+1 && corners[j].x <= pos.x + 1; j++) {
-                int x = corners[j].x;
-                if( (x == pos.x - 1 || x ==pos.x || x == pos.x+1) && Compare(corners[j].score, score))
-                    goto nonmax;
-            }
-        }
+// 3x3 non-maximum suppression of a row of scores, a corner is kept
+// if it's stronger than all of its neighbours (0 means no corner).
+static void nonmax_suppression(const uint8_t *above, const uint8_t *row, const uint8_t *below,
+        int x0, int x1, int y, corner_grid_t *grid, arena_t *corners)
+{
+    if (y >= (grid->y_offs + grid->cell_size)) {
+        grid_flush_band(grid, corners);
+    }
 
-        gc_info(&info);
-        #define MIN_MEM (2*1024)
-        // Allocate keypoints until we're almost out of memory
-        if (info.free < MIN_MEM) {
-            // Try collecting memory
-            gc_collect();
-            // If it didn't work break
-            gc_info(&info);
-            if (info.free < MIN_MEM) {
-                break;
-            }
+    for (int x=x0; x<x1; x++) {
+        uint8_t score = row[x];
+        if (score == 0
+                || Compare(row[x-1], score)   || Compare(row[x+1], score)
+                || Compare(above[x-1], score) || Compare(above[x], score) || Compare(above[x+1], score)
+                || Compare(below[x-1], score) || Compare(below[x], score) || Compare(below[x+1], score)) {
+            continue;
         }
-        #undef MIN_MEM
-        array_push_back(keypoints, alloc_keypoint(pos.x, pos.y));
-        nonmax:
-        ;
+        grid_add_corner(grid, x, y, score);
     }
-
-    fb_free();
 }
 
 /* Auto-generated code*/
@@ -3100,55 +3125,63 @@ static uint8_t fast9_corner_score(const uint8_t* p, int bstart)
     }
 }
 
-static void fast9_score(image_t *image, corner_t *corners, int num_corners, int b)
-{	
-    for (int i=0; i<num_corners; i++) {
-        corner_t *c = &corners[i];
-        c->score = fast9_corner_score(image->pixels + c->y*image->w + c->x, b);
-    }
-}
-
-static corner_t *fast9_detect(image_t *image, rectangle_t *roi, int *n_corners, int b)
+static void fast9_detect(image_t *image, rectangle_t *roi, int b, int border, corner_grid_t *grid, arena_t *corners)
 {
-    int num_corners=0;
-    corner_t *corners = (corner_t*) fb_alloc(sizeof(corner_t)*MAX_CORNERS);
+    int x0 = roi->x+border, x1 = roi->x+roi->w-border;
+    int y0 = roi->y+border, y1 = roi->y+roi->h-border;
+    int stride = (x1 - x0) + 2;
+
+    // Scores of the last three rows, with a zero column on each side,
+    // the non-maximum suppression of a row runs once the next one is scored.
+    uint8_t *ring = fb_alloc0(stride * 3);
+    #define RING_ROW(i) (ring + (((i)%3) * stride) + 1 - x0)
 
-    for(int y=roi->y+PATTERN_SCALE; y < roi->y+roi->h-PATTERN_SCALE; y++) {
-            const uint8_t *r = image->pixels + y*image->w;
-        for(int x=roi->x+PATTERN_SCALE; x < roi->x+roi->w-PATTERN_SCALE; x++) {
+    for (int y=y0; y<y1; y++) {
+        const uint8_t *r = image->pixels + y*image->w;
+        uint8_t *s = RING_ROW(y-y0);
+        memset(s + x0 - 1, 0, stride);
+        for (int x=x0; x<x1; x++) {
             const uint8_t *p = r + x;
             int cb = *p + b;
             int c_b= *p - b;
-        if(p[pixel[0]] > cb)
-         if(p[pixel[1]] > cb)
-          if(p[pixel[2]] > cb)
-           if(p[pixel[3]] > cb)
-            if(p[pixel[4]] > cb)
-             if(p[pixel[5]] > cb)
-              if(p[pixel[6]] > cb)
-               if(p[pixel[7]] > cb)
-                if(p[pixel[8]] > cb)
-                 {}
-                else
-                 if(p[pixel[15]] > cb)
-                  {}
-                 else
-                  continue;
-               else if(p[pixel[7]] < c_b)
-                if(p[pixel[14]] > cb)
-                 if(p[pixel[15]] > cb)
-                  {}
-                 else
-                  continue;
-                else if(p[pixel[14]] < c_b)
-                 if(p[pixel[8]] < c_b)
-                  if(p[pixel[9]] < c_b)
-                   if(p[pixel[10]] < c_b)
-                    if(p[pixel[11]] < c_b)
-                     if(p[pixel[12]] < c_b)
-                      if(p[pixel[13]] < c_b)
-                       if(p[pixel[15]] < c_b)
-                        {}
+            if(p[pixel[0]] > cb)
+             if(p[pixel[1]] > cb)
+              if(p[pixel[2]] > cb)
+               if(p[pixel[3]] > cb)
+                if(p[pixel[4]] > cb)
+                 if(p[pixel[5]] > cb)
+                  if(p[pixel[6]] > cb)
+                   if(p[pixel[7]] > cb)
+                    if(p[pixel[8]] > cb)
+                     {}
+                    else
+                     if(p[pixel[15]] > cb)
+                      {}
+                     else
+                      continue;
+                   else if(p[pixel[7]] < c_b)
+                    if(p[pixel[14]] > cb)
+                     if(p[pixel[15]] > cb)
+                      {}
+                     else
+                      continue;
+                    else if(p[pixel[14]] < c_b)
+                     if(p[pixel[8]] < c_b)
+                      if(p[pixel[9]] < c_b)
+                       if(p[pixel[10]] < c_b)
+                        if(p[pixel[11]] < c_b)
+                         if(p[pixel[12]] < c_b)
+                          if(p[pixel[13]] < c_b)
+                           if(p[pixel[15]] < c_b)
+                            {}
+                           else
+                            continue;
+                          else
+                           continue;
+                         else
+                          continue;
+                        else
+                         continue;
                        else
                         continue;
                       else
@@ -3158,63 +3191,37 @@ static corner_t *fast9_detect(image_t *image, rectangle_t *roi, int *n_corners,
                     else
                      continue;
                    else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-               else
-                if(p[pixel[14]] > cb)
-                 if(p[pixel[15]] > cb)
-                  {}
-                 else
-                  continue;
-                else
-                 continue;
-              else if(p[pixel[6]] < c_b)
-               if(p[pixel[15]] > cb)
-                if(p[pixel[13]] > cb)
-                 if(p[pixel[14]] > cb)
-                  {}
-                 else
-                  continue;
-                else if(p[pixel[13]] < c_b)
-                 if(p[pixel[7]] < c_b)
-                  if(p[pixel[8]] < c_b)
-                   if(p[pixel[9]] < c_b)
-                    if(p[pixel[10]] < c_b)
-                     if(p[pixel[11]] < c_b)
-                      if(p[pixel[12]] < c_b)
-                       if(p[pixel[14]] < c_b)
-                        {}
-                       else
-                        continue;
-                      else
-                       continue;
+                    if(p[pixel[14]] > cb)
+                     if(p[pixel[15]] > cb)
+                      {}
                      else
                       continue;
                     else
                      continue;
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-               else
-                if(p[pixel[7]] < c_b)
-                 if(p[pixel[8]] < c_b)
-                  if(p[pixel[9]] < c_b)
-                   if(p[pixel[10]] < c_b)
-                    if(p[pixel[11]] < c_b)
-                     if(p[pixel[12]] < c_b)
-                      if(p[pixel[13]] < c_b)
-                       if(p[pixel[14]] < c_b)
-                        {}
+                  else if(p[pixel[6]] < c_b)
+                   if(p[pixel[15]] > cb)
+                    if(p[pixel[13]] > cb)
+                     if(p[pixel[14]] > cb)
+                      {}
+                     else
+                      continue;
+                    else if(p[pixel[13]] < c_b)
+                     if(p[pixel[7]] < c_b)
+                      if(p[pixel[8]] < c_b)
+                       if(p[pixel[9]] < c_b)
+                        if(p[pixel[10]] < c_b)
+                         if(p[pixel[11]] < c_b)
+                          if(p[pixel[12]] < c_b)
+                           if(p[pixel[14]] < c_b)
+                            {}
+                           else
+                            continue;
+                          else
+                           continue;
+                         else
+                          continue;
+                        else
+                         continue;
                        else
                         continue;
                       else
@@ -3224,32 +3231,23 @@ static corner_t *fast9_detect(image_t *image, rectangle_t *roi, int *n_corners,
                     else
                      continue;
                    else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-              else
-               if(p[pixel[13]] > cb)
-                if(p[pixel[14]] > cb)
-                 if(p[pixel[15]] > cb)
-                  {}
-                 else
-                  continue;
-                else
-                 continue;
-               else if(p[pixel[13]] < c_b)
-                if(p[pixel[7]] < c_b)
-                 if(p[pixel[8]] < c_b)
-                  if(p[pixel[9]] < c_b)
-                   if(p[pixel[10]] < c_b)
-                    if(p[pixel[11]] < c_b)
-                     if(p[pixel[12]] < c_b)
-                      if(p[pixel[14]] < c_b)
-                       if(p[pixel[15]] < c_b)
-                        {}
+                    if(p[pixel[7]] < c_b)
+                     if(p[pixel[8]] < c_b)
+                      if(p[pixel[9]] < c_b)
+                       if(p[pixel[10]] < c_b)
+                        if(p[pixel[11]] < c_b)
+                         if(p[pixel[12]] < c_b)
+                          if(p[pixel[13]] < c_b)
+                           if(p[pixel[14]] < c_b)
+                            {}
+                           else
+                            continue;
+                          else
+                           continue;
+                         else
+                          continue;
+                        else
+                         continue;
                        else
                         continue;
                       else
@@ -3258,30 +3256,33 @@ static corner_t *fast9_detect(image_t *image, rectangle_t *roi, int *n_corners,
                       continue;
                     else
                      continue;
-                   else
-                    continue;
                   else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-               else
-                continue;
-             else if(p[pixel[5]] < c_b)
-              if(p[pixel[14]] > cb)
-               if(p[pixel[12]] > cb)
-                if(p[pixel[13]] > cb)
-                 if(p[pixel[15]] > cb)
-                  {}
-                 else
-                  if(p[pixel[6]] > cb)
-                   if(p[pixel[7]] > cb)
-                    if(p[pixel[8]] > cb)
-                     if(p[pixel[9]] > cb)
-                      if(p[pixel[10]] > cb)
-                       if(p[pixel[11]] > cb)
-                        {}
+                   if(p[pixel[13]] > cb)
+                    if(p[pixel[14]] > cb)
+                     if(p[pixel[15]] > cb)
+                      {}
+                     else
+                      continue;
+                    else
+                     continue;
+                   else if(p[pixel[13]] < c_b)
+                    if(p[pixel[7]] < c_b)
+                     if(p[pixel[8]] < c_b)
+                      if(p[pixel[9]] < c_b)
+                       if(p[pixel[10]] < c_b)
+                        if(p[pixel[11]] < c_b)
+                         if(p[pixel[12]] < c_b)
+                          if(p[pixel[14]] < c_b)
+                           if(p[pixel[15]] < c_b)
+                            {}
+                           else
+                            continue;
+                          else
+                           continue;
+                         else
+                          continue;
+                        else
+                         continue;
                        else
                         continue;
                       else
@@ -3292,74 +3293,80 @@ static corner_t *fast9_detect(image_t *image, rectangle_t *roi, int *n_corners,
                      continue;
                    else
                     continue;
-                  else
-                   continue;
-                else
-                 continue;
-               else if(p[pixel[12]] < c_b)
-                if(p[pixel[6]] < c_b)
-                 if(p[pixel[7]] < c_b)
-                  if(p[pixel[8]] < c_b)
-                   if(p[pixel[9]] < c_b)
-                    if(p[pixel[10]] < c_b)
-                     if(p[pixel[11]] < c_b)
-                      if(p[pixel[13]] < c_b)
-                       {}
+                 else if(p[pixel[5]] < c_b)
+                  if(p[pixel[14]] > cb)
+                   if(p[pixel[12]] > cb)
+                    if(p[pixel[13]] > cb)
+                     if(p[pixel[15]] > cb)
+                      {}
+                     else
+                      if(p[pixel[6]] > cb)
+                       if(p[pixel[7]] > cb)
+                        if(p[pixel[8]] > cb)
+                         if(p[pixel[9]] > cb)
+                          if(p[pixel[10]] > cb)
+                           if(p[pixel[11]] > cb)
+                            {}
+                           else
+                            continue;
+                          else
+                           continue;
+                         else
+                          continue;
+                        else
+                         continue;
+                       else
+                        continue;
                       else
                        continue;
-                     else
-                      continue;
                     else
                      continue;
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-               else
-                continue;
-              else if(p[pixel[14]] < c_b)
-               if(p[pixel[7]] < c_b)
-                if(p[pixel[8]] < c_b)
-                 if(p[pixel[9]] < c_b)
-                  if(p[pixel[10]] < c_b)
-                   if(p[pixel[11]] < c_b)
-                    if(p[pixel[12]] < c_b)
-                     if(p[pixel[13]] < c_b)
-                      if(p[pixel[6]] < c_b)
-                       {}
-                      else
-                       if(p[pixel[15]] < c_b)
-                        {}
+                   else if(p[pixel[12]] < c_b)
+                    if(p[pixel[6]] < c_b)
+                     if(p[pixel[7]] < c_b)
+                      if(p[pixel[8]] < c_b)
+                       if(p[pixel[9]] < c_b)
+                        if(p[pixel[10]] < c_b)
+                         if(p[pixel[11]] < c_b)
+                          if(p[pixel[13]] < c_b)
+                           {}
+                          else
+                           continue;
+                         else
+                          continue;
+                        else
+                         continue;
                        else
                         continue;
+                      else
+                       continue;
                      else
                       continue;
                     else
                      continue;
                    else
                     continue;
-                  else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-               else
-                continue;
-              else
-               if(p[pixel[6]] < c_b)
-                if(p[pixel[7]] < c_b)
-                 if(p[pixel[8]] < c_b)
-                  if(p[pixel[9]] < c_b)
-                   if(p[pixel[10]] < c_b)
-                    if(p[pixel[11]] < c_b)
-                     if(p[pixel[12]] < c_b)
-                      if(p[pixel[13]] < c_b)
-                       {}
+                  else if(p[pixel[14]] < c_b)
+                   if(p[pixel[7]] < c_b)
+                    if(p[pixel[8]] < c_b)
+                     if(p[pixel[9]] < c_b)
+                      if(p[pixel[10]] < c_b)
+                       if(p[pixel[11]] < c_b)
+                        if(p[pixel[12]] < c_b)
+                         if(p[pixel[13]] < c_b)
+                          if(p[pixel[6]] < c_b)
+                           {}
+                          else
+                           if(p[pixel[15]] < c_b)
+                            {}
+                           else
+                            continue;
+                         else
+                          continue;
+                        else
+                         continue;
+                       else
+                        continue;
                       else
                        continue;
                      else
@@ -3369,27 +3376,21 @@ static corner_t *fast9_detect(image_t *image, rectangle_t *roi, int *n_corners,
                    else
                     continue;
                   else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-               else
-                continue;
-             else
-              if(p[pixel[12]] > cb)
-               if(p[pixel[13]] > cb)
-                if(p[pixel[14]] > cb)
-                 if(p[pixel[15]] > cb)
-                  {}
-                 else
-                  if(p[pixel[6]] > cb)
-                   if(p[pixel[7]] > cb)
-                    if(p[pixel[8]] > cb)
-                     if(p[pixel[9]] > cb)
-                      if(p[pixel[10]] > cb)
-                       if(p[pixel[11]] > cb)
-                        {}
+                   if(p[pixel[6]] < c_b)
+                    if(p[pixel[7]] < c_b)
+                     if(p[pixel[8]] < c_b)
+                      if(p[pixel[9]] < c_b)
+                       if(p[pixel[10]] < c_b)
+                        if(p[pixel[11]] < c_b)
+                         if(p[pixel[12]] < c_b)
+                          if(p[pixel[13]] < c_b)
+                           {}
+                          else
+                           continue;
+                         else
+                          continue;
+                        else
+                         continue;
                        else
                         continue;
                       else
@@ -3400,27 +3401,59 @@ static corner_t *fast9_detect(image_t *image, rectangle_t *roi, int *n_corners,
                      continue;
                    else
                     continue;
-                  else
-                   continue;
-                else
-                 continue;
-               else
-                continue;
-              else if(p[pixel[12]] < c_b)
-               if(p[pixel[7]] < c_b)
-                if(p[pixel[8]] < c_b)
-                 if(p[pixel[9]] < c_b)
-                  if(p[pixel[10]] < c_b)
-                   if(p[pixel[11]] < c_b)
-                    if(p[pixel[13]] < c_b)
-                     if(p[pixel[14]] < c_b)
-                      if(p[pixel[6]] < c_b)
-                       {}
+                 else
+                  if(p[pixel[12]] > cb)
+                   if(p[pixel[13]] > cb)
+                    if(p[pixel[14]] > cb)
+                     if(p[pixel[15]] > cb)
+                      {}
+                     else
+                      if(p[pixel[6]] > cb)
+                       if(p[pixel[7]] > cb)
+                        if(p[pixel[8]] > cb)
+                         if(p[pixel[9]] > cb)
+                          if(p[pixel[10]] > cb)
+                           if(p[pixel[11]] > cb)
+                            {}
+                           else
+                            continue;
+                          else
+                           continue;
+                         else
+                          continue;
+                        else
+                         continue;
+                       else
+                        continue;
                       else
-                       if(p[pixel[15]] < c_b)
-                        {}
+                       continue;
+                    else
+                     continue;
+                   else
+                    continue;
+                  else if(p[pixel[12]] < c_b)
+                   if(p[pixel[7]] < c_b)
+                    if(p[pixel[8]] < c_b)
+                     if(p[pixel[9]] < c_b)
+                      if(p[pixel[10]] < c_b)
+                       if(p[pixel[11]] < c_b)
+                        if(p[pixel[13]] < c_b)
+                         if(p[pixel[14]] < c_b)
+                          if(p[pixel[6]] < c_b)
+                           {}
+                          else
+                           if(p[pixel[15]] < c_b)
+                            {}
+                           else
+                            continue;
+                         else
+                          continue;
+                        else
+                         continue;
                        else
                         continue;
+                      else
+                       continue;
                      else
                       continue;
                     else
@@ -3429,28 +3462,67 @@ static corner_t *fast9_detect(image_t *image, rectangle_t *roi, int *n_corners,
                     continue;
                   else
                    continue;
-                 else
-                  continue;
-                else
-                 continue;
-               else
-                continue;
-              else
-               continue;
-            else if(p[pixel[4]] < c_b)
-             if(p[pixel[13]] > cb)
-              if(p[pixel[11]] > cb)
-               if(p[pixel[12]] > cb)
-                if(p[pixel[14]] > cb)
-                 if(p[pixel[15]] > cb)
-                  {}
-                 else
-                  if(p[pixel[6]] > cb)
-                   if(p[pixel[7]] > cb)
-                    if(p[pixel[8]] > cb)
-                     if(p[pixel[9]] > cb)
-                      if(p[pixel[10]] > cb)
-                       {}
+                else if(p[pixel[4]] < c_b)
+                 if(p[pixel[13]] > cb)
+                  if(p[pixel[11]] > cb)
+                   if(p[pixel[12]] > cb)
+                    if(p[pixel[14]] > cb)
+                     if(p[pixel[15]] > cb)
+                      {}
+                     else
+                      if(p[pixel[6]] > cb)
+                       if(p[pixel[7]] > cb)
+                        if(p[pixel[8]] > cb)
+                         if(p[pixel[9]] > cb)
+                          if(p[pixel[10]] > cb)
+                           {}
+                          else
+                           continue;
+                         else
+                          continue;
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
+                    else
+                     if(p[pixel[5]] > cb)
+                      if(p[pixel[6]] > cb)
+                       if(p[pixel[7]] > cb)
+                        if(p[pixel[8]] > cb)
+                         if(p[pixel[9]] > cb)
+                          if(p[pixel[10]] > cb)
+                           {}
+                          else
+                           continue;
+                         else
+                          continue;
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
+                   else
+                    continue;
+                  else if(p[pixel[11]] < c_b)
+                   if(p[pixel[5]] < c_b)
+                    if(p[pixel[6]] < c_b)
+                     if(p[pixel[7]] < c_b)
+                      if(p[pixel[8]] < c_b)
+                       if(p[pixel[9]] < c_b)
+                        if(p[pixel[10]] < c_b)
+                         if(p[pixel[12]] < c_b)
+                          {}
+                         else
+                          continue;
+                        else
+                         continue;
+                       else
+                        continue;
                       else
                        continue;
                      else
@@ -3461,14 +3533,31 @@ static corner_t *fast9_detect(image_t *image, rectangle_t *roi, int *n_corners,
                     continue;
                   else
                    continue;
-                else
-                 if(p[pixel[5]] > cb)
-                  if(p[pixel[6]] > cb)
-                   if(p[pixel[7]] > cb)
-                    if(p[pixel[8]] > cb)
-                     if(p[pixel[9]] > cb)
-                      if(p[pixel[10]] > cb)
-                       {}
+                 else if(p[pixel[13]] < c_b)
+                  if(p[pixel[7]] < c_b)
+                   if(p[pixel[8]] < c_b)
+                    if(p[pixel[9]] < c_b)
+                     if(p[pixel[10]] < c_b)
+                      if(p[pixel[11]] < c_b)
+                       if(p[pixel[12]] < c_b)
+                        if(p[pixel[6]] < c_b)
+                         if(p[pixel[5]] < c_b)
+                          {}
+                         else
+                          if(p[pixel[14]] < c_b)
+                           {}
+                          else
+                           continue;
+                        else
+                         if(p[pixel[14]] < c_b)
+                          if(p[pixel[15]] < c_b)
+                           {}
+                          else
+                           continue;
+                         else
+                          continue;
+                       else
+                        continue;
                       else
                        continue;
                      else
@@ -3480,18 +3569,23 @@ static corner_t *fast9_detect(image_t *image, rectangle_t *roi, int *n_corners,
                   else
                    continue;
                  else
-                  continue;
-               else
-                continue;
-              else if(p[pixel[11]] < c_b)
-               if(p[pixel[5]] < c_b)
-                if(p[pixel[6]] < c_b)
-                 if(p[pixel[7]] < c_b)
-                  if(p[pixel[8]] < c_b)
-                   if(p[pixel[9]] < c_b)
-                    if(p[pixel[10]] < c_b)
-                     if(p[pixel[12]] < c_b)
-                      {}
+                  if(p[pixel[5]] < c_b)
+                   if(p[pixel[6]] < c_b)
+                    if(p[pixel[7]] < c_b)
+                     if(p[pixel[8]] < c_b)
+                      if(p[pixel[9]] < c_b)
+                       if(p[pixel[10]] < c_b)
+                        if(p[pixel[11]] < c_b)
+                         if(p[pixel[12]] < c_b)
+                          {}
+                         else
+                          continue;
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
                      else
                       continue;
                     else
@@ -3500,33 +3594,46 @@ static corner_t *fast9_detect(image_t *image, rectangle_t *roi, int *n_corners,
                     continue;
                   else
                    continue;
-                 else
-                  continue;
                 else
-                 continue;
-               else
-                continue;
-              else
-               continue;
-             else if(p[pixel[13]] < c_b)
-              if(p[pixel[7]] < c_b)
-               if(p[pixel[8]] < c_b)
-                if(p[pixel[9]] < c_b)
-                 if(p[pixel[10]] < c_b)
-                  if(p[pixel[11]] < c_b)
-                   if(p[pixel[12]] < c_b)
-                    if(p[pixel[6]] < c_b)
-                     if(p[pixel[5]] < c_b)
+                 if(p[pixel[11]] > cb)
+                  if(p[pixel[12]] > cb)
+                   if(p[pixel[13]] > cb)
+                    if(p[pixel[14]] > cb)
+                     if(p[pixel[15]] > cb)
                       {}
                      else
-                      if(p[pixel[14]] < c_b)
-                       {}
+                      if(p[pixel[6]] > cb)
+                       if(p[pixel[7]] > cb)
+                        if(p[pixel[8]] > cb)
+                         if(p[pixel[9]] > cb)
+                          if(p[pixel[10]] > cb)
+                           {}
+                          else
+                           continue;
+                         else
+                          continue;
+                        else
+                         continue;
+                       else
+                        continue;
                       else
                        continue;
                     else
-                     if(p[pixel[14]] < c_b)
-                      if(p[pixel[15]] < c_b)
-                       {}
+                     if(p[pixel[5]] > cb)
+                      if(p[pixel[6]] > cb)
+                       if(p[pixel[7]] > cb)
+                        if(p[pixel[8]] > cb)
+                         if(p[pixel[9]] > cb)
+                          if(p[pixel[10]] > cb)
+                           {}
+                          else
+                           continue;
+                         else
+                          continue;
+                        else
+                         continue;
+                       else
+                        continue;
                       else
                        continue;
                      else
@@ -3535,24 +3642,33 @@ static corner_t *fast9_detect(image_t *image, rectangle_t *roi, int *n_corners,
                     continue;
                   else
                    continue;
-                 else
-                  continue;
-                else
-                 continue;
-               else
-                continue;
-              else
-               continue;
-             else
-              if(p[pixel[5]] < c_b)
-               if(p[pixel[6]] < c_b)
-                if(p[pixel[7]] < c_b)
-                 if(p[pixel[8]] < c_b)
-                  if(p[pixel[9]] < c_b)
-                   if(p[pixel[10]] < c_b)
-                    if(p[pixel[11]] < c_b)
-                     if(p[pixel[12]] < c_b)
-                      {}
+                 else if(p[pixel[11]] < c_b)
+                  if(p[pixel[7]] < c_b)
+                   if(p[pixel[8]] < c_b)
+                    if(p[pixel[9]] < c_b)
+                     if(p[pixel[10]] < c_b)
+                      if(p[pixel[12]] < c_b)
+                       if(p[pixel[13]] < c_b)
+                        if(p[pixel[6]] < c_b)
+                         if(p[pixel[5]] < c_b)
+                          {}
+                         else
+                          if(p[pixel[14]] < c_b)
+                           {}
+                          else
+                           continue;
+                        else
+                         if(p[pixel[14]] < c_b)
+                          if(p[pixel[15]] < c_b)
+                           {}
+                          else
+                           continue;
+                         else
+                          continue;
+                       else
+                        continue;
+                      else
+                       continue;
                      else
                       continue;
                     else
@@ -3563,83 +3679,113 @@ static corner_t *fast9_detect(image_t *image, rectangle_t *roi, int *n_corners,
                    continue;
                  else
                   continue;
-                else
-                 continue;
-               else
-                continue;
-              else
-               continue;
-            else
-             if(p[pixel[11]] > cb)
-              if(p[pixel[12]] > cb)
-               if(p[pixel[13]] > cb)
-                if(p[pixel[14]] > cb)
-                 if(p[pixel[15]] > cb)
-                  {}
-                 else
-                  if(p[pixel[6]] > cb)
-                   if(p[pixel[7]] > cb)
-                    if(p[pixel[8]] > cb)
-                     if(p[pixel[9]] > cb)
-                      if(p[pixel[10]] > cb)
-                       {}
+               else if(p[pixel[3]] < c_b)
+                if(p[pixel[10]] > cb)
+                 if(p[pixel[11]] > cb)
+                  if(p[pixel[12]] > cb)
+                   if(p[pixel[13]] > cb)
+                    if(p[pixel[14]] > cb)
+                     if(p[pixel[15]] > cb)
+                      {}
+                     else
+                      if(p[pixel[6]] > cb)
+                       if(p[pixel[7]] > cb)
+                        if(p[pixel[8]] > cb)
+                         if(p[pixel[9]] > cb)
+                          {}
+                         else
+                          continue;
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
+                    else
+                     if(p[pixel[5]] > cb)
+                      if(p[pixel[6]] > cb)
+                       if(p[pixel[7]] > cb)
+                        if(p[pixel[8]] > cb)
+                         if(p[pixel[9]] > cb)
+                          {}
+                         else
+                          continue;
+                        else
+                         continue;
+                       else
+                        continue;
                       else
                        continue;
                      else
                       continue;
-                    else
-                     continue;
                    else
-                    continue;
-                  else
-                   continue;
-                else
-                 if(p[pixel[5]] > cb)
-                  if(p[pixel[6]] > cb)
-                   if(p[pixel[7]] > cb)
-                    if(p[pixel[8]] > cb)
-                     if(p[pixel[9]] > cb)
-                      if(p[pixel[10]] > cb)
-                       {}
+                    if(p[pixel[4]] > cb)
+                     if(p[pixel[5]] > cb)
+                      if(p[pixel[6]] > cb)
+                       if(p[pixel[7]] > cb)
+                        if(p[pixel[8]] > cb)
+                         if(p[pixel[9]] > cb)
+                          {}
+                         else
+                          continue;
+                        else
+                         continue;
+                       else
+                        continue;
                       else
                        continue;
                      else
                       continue;
                     else
                      continue;
-                   else
-                    continue;
                   else
                    continue;
                  else
                   continue;
-               else
-                continue;
-              else
-               continue;
-             else if(p[pixel[11]] < c_b)
-              if(p[pixel[7]] < c_b)
-               if(p[pixel[8]] < c_b)
-                if(p[pixel[9]] < c_b)
-                 if(p[pixel[10]] < c_b)
-                  if(p[pixel[12]] < c_b)
-                   if(p[pixel[13]] < c_b)
-                    if(p[pixel[6]] < c_b)
-                     if(p[pixel[5]] < c_b)
-                      {}
+                else if(p[pixel[10]] < c_b)
+                 if(p[pixel[7]] < c_b)
+                  if(p[pixel[8]] < c_b)
+                   if(p[pixel[9]] < c_b)
+                    if(p[pixel[11]] < c_b)
+                     if(p[pixel[6]] < c_b)
+                      if(p[pixel[5]] < c_b)
+                       if(p[pixel[4]] < c_b)
+                        {}
+                       else
+                        if(p[pixel[12]] < c_b)
+                         if(p[pixel[13]] < c_b)
+                          {}
+                         else
+                          continue;
+                        else
+                         continue;
+                      else
+                       if(p[pixel[12]] < c_b)
+                        if(p[pixel[13]] < c_b)
+                         if(p[pixel[14]] < c_b)
+                          {}
+                         else
+                          continue;
+                        else
+                         continue;
+                       else
+                        continue;
                      else
-                      if(p[pixel[14]] < c_b)
-                       {}
+                      if(p[pixel[12]] < c_b)
+                       if(p[pixel[13]] < c_b)
+                        if(p[pixel[14]] < c_b)
+                         if(p[pixel[15]] < c_b)
+                          {}
+                         else
+                          continue;
+                        else
+                         continue;
+                       else
+                        continue;
                       else
                        continue;
                     else
-                     if(p[pixel[14]] < c_b)
-                      if(p[pixel[15]] < c_b)
-                       {}
-                      else
-                       continue;
-                     else
-                      continue;
+                     continue;
                    else
                     continue;
                   else
@@ -3649,58 +3795,102 @@ static corner_t *fast9_detect(image_t *image, rectangle_t *roi, int *n_corners,
                 else
                  continue;
                else
-                continue;
-              else
-               continue;
-             else
-              continue;
-           else if(p[pixel[3]] < c_b)
-            if(p[pixel[10]] > cb)
-             if(p[pixel[11]] > cb)
-              if(p[pixel[12]] > cb)
-               if(p[pixel[13]] > cb)
-                if(p[pixel[14]] > cb)
-                 if(p[pixel[15]] > cb)
-                  {}
-                 else
-                  if(p[pixel[6]] > cb)
-                   if(p[pixel[7]] > cb)
-                    if(p[pixel[8]] > cb)
-                     if(p[pixel[9]] > cb)
+                if(p[pixel[10]] > cb)
+                 if(p[pixel[11]] > cb)
+                  if(p[pixel[12]] > cb)
+                   if(p[pixel[13]] > cb)
+                    if(p[pixel[14]] > cb)
+                     if(p[pixel[15]] > cb)
                       {}
                      else
-                      continue;
-                    else
-                     continue;
+                      if(p[pixel[6]] > cb)
+                       if(p[pixel[7]] > cb)
+                        if(p[pixel[8]] > cb)
+                         if(p[pixel[9]] > cb)
+                          {}
+                         else
+                          continue;
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
+                    else
+                     if(p[pixel[5]] > cb)
+                      if(p[pixel[6]] > cb)
+                       if(p[pixel[7]] > cb)
+                        if(p[pixel[8]] > cb)
+                         if(p[pixel[9]] > cb)
+                          {}
+                         else
+                          continue;
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
                    else
-                    continue;
-                  else
-                   continue;
-                else
-                 if(p[pixel[5]] > cb)
-                  if(p[pixel[6]] > cb)
-                   if(p[pixel[7]] > cb)
-                    if(p[pixel[8]] > cb)
-                     if(p[pixel[9]] > cb)
-                      {}
+                    if(p[pixel[4]] > cb)
+                     if(p[pixel[5]] > cb)
+                      if(p[pixel[6]] > cb)
+                       if(p[pixel[7]] > cb)
+                        if(p[pixel[8]] > cb)
+                         if(p[pixel[9]] > cb)
+                          {}
+                         else
+                          continue;
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
                      else
                       continue;
                     else
                      continue;
-                   else
-                    continue;
                   else
                    continue;
                  else
                   continue;
-               else
-                if(p[pixel[4]] > cb)
-                 if(p[pixel[5]] > cb)
-                  if(p[pixel[6]] > cb)
-                   if(p[pixel[7]] > cb)
-                    if(p[pixel[8]] > cb)
-                     if(p[pixel[9]] > cb)
-                      {}
+                else if(p[pixel[10]] < c_b)
+                 if(p[pixel[7]] < c_b)
+                  if(p[pixel[8]] < c_b)
+                   if(p[pixel[9]] < c_b)
+                    if(p[pixel[11]] < c_b)
+                     if(p[pixel[12]] < c_b)
+                      if(p[pixel[6]] < c_b)
+                       if(p[pixel[5]] < c_b)
+                        if(p[pixel[4]] < c_b)
+                         {}
+                        else
+                         if(p[pixel[13]] < c_b)
+                          {}
+                         else
+                          continue;
+                       else
+                        if(p[pixel[13]] < c_b)
+                         if(p[pixel[14]] < c_b)
+                          {}
+                         else
+                          continue;
+                        else
+                         continue;
+                      else
+                       if(p[pixel[13]] < c_b)
+                        if(p[pixel[14]] < c_b)
+                         if(p[pixel[15]] < c_b)
+                          {}
+                         else
+                          continue;
+                        else
+                         continue;
+                       else
+                        continue;
                      else
                       continue;
                     else
@@ -3713,153 +3903,213 @@ static corner_t *fast9_detect(image_t *image, rectangle_t *roi, int *n_corners,
                   continue;
                 else
                  continue;
-              else
-               continue;
-             else
-              continue;
-            else if(p[pixel[10]] < c_b)
-             if(p[pixel[7]] < c_b)
-              if(p[pixel[8]] < c_b)
-               if(p[pixel[9]] < c_b)
-                if(p[pixel[11]] < c_b)
-                 if(p[pixel[6]] < c_b)
-                  if(p[pixel[5]] < c_b)
-                   if(p[pixel[4]] < c_b)
-                    {}
-                   else
-                    if(p[pixel[12]] < c_b)
-                     if(p[pixel[13]] < c_b)
+              else if(p[pixel[2]] < c_b)
+               if(p[pixel[9]] > cb)
+                if(p[pixel[10]] > cb)
+                 if(p[pixel[11]] > cb)
+                  if(p[pixel[12]] > cb)
+                   if(p[pixel[13]] > cb)
+                    if(p[pixel[14]] > cb)
+                     if(p[pixel[15]] > cb)
                       {}
                      else
-                      continue;
+                      if(p[pixel[6]] > cb)
+                       if(p[pixel[7]] > cb)
+                        if(p[pixel[8]] > cb)
+                         {}
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
                     else
-                     continue;
-                  else
-                   if(p[pixel[12]] < c_b)
-                    if(p[pixel[13]] < c_b)
-                     if(p[pixel[14]] < c_b)
-                      {}
+                     if(p[pixel[5]] > cb)
+                      if(p[pixel[6]] > cb)
+                       if(p[pixel[7]] > cb)
+                        if(p[pixel[8]] > cb)
+                         {}
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
                      else
                       continue;
-                    else
-                     continue;
                    else
-                    continue;
-                 else
-                  if(p[pixel[12]] < c_b)
-                   if(p[pixel[13]] < c_b)
-                    if(p[pixel[14]] < c_b)
-                     if(p[pixel[15]] < c_b)
-                      {}
+                    if(p[pixel[4]] > cb)
+                     if(p[pixel[5]] > cb)
+                      if(p[pixel[6]] > cb)
+                       if(p[pixel[7]] > cb)
+                        if(p[pixel[8]] > cb)
+                         {}
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
                      else
                       continue;
                     else
                      continue;
-                   else
-                    continue;
                   else
-                   continue;
-                else
-                 continue;
-               else
-                continue;
-              else
-               continue;
-             else
-              continue;
-            else
-             continue;
-           else
-            if(p[pixel[10]] > cb)
-             if(p[pixel[11]] > cb)
-              if(p[pixel[12]] > cb)
-               if(p[pixel[13]] > cb)
-                if(p[pixel[14]] > cb)
-                 if(p[pixel[15]] > cb)
-                  {}
-                 else
-                  if(p[pixel[6]] > cb)
-                   if(p[pixel[7]] > cb)
-                    if(p[pixel[8]] > cb)
-                     if(p[pixel[9]] > cb)
-                      {}
+                   if(p[pixel[3]] > cb)
+                    if(p[pixel[4]] > cb)
+                     if(p[pixel[5]] > cb)
+                      if(p[pixel[6]] > cb)
+                       if(p[pixel[7]] > cb)
+                        if(p[pixel[8]] > cb)
+                         {}
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
                      else
                       continue;
                     else
                      continue;
                    else
                     continue;
-                  else
-                   continue;
+                 else
+                  continue;
                 else
-                 if(p[pixel[5]] > cb)
-                  if(p[pixel[6]] > cb)
-                   if(p[pixel[7]] > cb)
-                    if(p[pixel[8]] > cb)
-                     if(p[pixel[9]] > cb)
-                      {}
+                 continue;
+               else if(p[pixel[9]] < c_b)
+                if(p[pixel[7]] < c_b)
+                 if(p[pixel[8]] < c_b)
+                  if(p[pixel[10]] < c_b)
+                   if(p[pixel[6]] < c_b)
+                    if(p[pixel[5]] < c_b)
+                     if(p[pixel[4]] < c_b)
+                      if(p[pixel[3]] < c_b)
+                       {}
+                      else
+                       if(p[pixel[11]] < c_b)
+                        if(p[pixel[12]] < c_b)
+                         {}
+                        else
+                         continue;
+                       else
+                        continue;
                      else
-                      continue;
+                      if(p[pixel[11]] < c_b)
+                       if(p[pixel[12]] < c_b)
+                        if(p[pixel[13]] < c_b)
+                         {}
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
                     else
-                     continue;
+                     if(p[pixel[11]] < c_b)
+                      if(p[pixel[12]] < c_b)
+                       if(p[pixel[13]] < c_b)
+                        if(p[pixel[14]] < c_b)
+                         {}
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
                    else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-               else
-                if(p[pixel[4]] > cb)
-                 if(p[pixel[5]] > cb)
-                  if(p[pixel[6]] > cb)
-                   if(p[pixel[7]] > cb)
-                    if(p[pixel[8]] > cb)
-                     if(p[pixel[9]] > cb)
-                      {}
+                    if(p[pixel[11]] < c_b)
+                     if(p[pixel[12]] < c_b)
+                      if(p[pixel[13]] < c_b)
+                       if(p[pixel[14]] < c_b)
+                        if(p[pixel[15]] < c_b)
+                         {}
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
                      else
                       continue;
                     else
                      continue;
-                   else
-                    continue;
                   else
                    continue;
                  else
                   continue;
                 else
                  continue;
+               else
+                continue;
               else
-               continue;
-             else
-              continue;
-            else if(p[pixel[10]] < c_b)
-             if(p[pixel[7]] < c_b)
-              if(p[pixel[8]] < c_b)
-               if(p[pixel[9]] < c_b)
-                if(p[pixel[11]] < c_b)
-                 if(p[pixel[12]] < c_b)
-                  if(p[pixel[6]] < c_b)
-                   if(p[pixel[5]] < c_b)
-                    if(p[pixel[4]] < c_b)
-                     {}
-                    else
-                     if(p[pixel[13]] < c_b)
+               if(p[pixel[9]] > cb)
+                if(p[pixel[10]] > cb)
+                 if(p[pixel[11]] > cb)
+                  if(p[pixel[12]] > cb)
+                   if(p[pixel[13]] > cb)
+                    if(p[pixel[14]] > cb)
+                     if(p[pixel[15]] > cb)
                       {}
+                     else
+                      if(p[pixel[6]] > cb)
+                       if(p[pixel[7]] > cb)
+                        if(p[pixel[8]] > cb)
+                         {}
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
+                    else
+                     if(p[pixel[5]] > cb)
+                      if(p[pixel[6]] > cb)
+                       if(p[pixel[7]] > cb)
+                        if(p[pixel[8]] > cb)
+                         {}
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
                      else
                       continue;
                    else
-                    if(p[pixel[13]] < c_b)
-                     if(p[pixel[14]] < c_b)
-                      {}
+                    if(p[pixel[4]] > cb)
+                     if(p[pixel[5]] > cb)
+                      if(p[pixel[6]] > cb)
+                       if(p[pixel[7]] > cb)
+                        if(p[pixel[8]] > cb)
+                         {}
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
                      else
                       continue;
                     else
                      continue;
                   else
-                   if(p[pixel[13]] < c_b)
-                    if(p[pixel[14]] < c_b)
-                     if(p[pixel[15]] < c_b)
-                      {}
+                   if(p[pixel[3]] > cb)
+                    if(p[pixel[4]] > cb)
+                     if(p[pixel[5]] > cb)
+                      if(p[pixel[6]] > cb)
+                       if(p[pixel[7]] > cb)
+                        if(p[pixel[8]] > cb)
+                         {}
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
                      else
                       continue;
                     else
@@ -3870,75 +4120,54 @@ static corner_t *fast9_detect(image_t *image, rectangle_t *roi, int *n_corners,
                   continue;
                 else
                  continue;
-               else
-                continue;
-              else
-               continue;
-             else
-              continue;
-            else
-             continue;
-          else if(p[pixel[2]] < c_b)
-           if(p[pixel[9]] > cb)
-            if(p[pixel[10]] > cb)
-             if(p[pixel[11]] > cb)
-              if(p[pixel[12]] > cb)
-               if(p[pixel[13]] > cb)
-                if(p[pixel[14]] > cb)
-                 if(p[pixel[15]] > cb)
-                  {}
-                 else
-                  if(p[pixel[6]] > cb)
-                   if(p[pixel[7]] > cb)
-                    if(p[pixel[8]] > cb)
-                     {}
-                    else
-                     continue;
-                   else
-                    continue;
-                  else
-                   continue;
-                else
-                 if(p[pixel[5]] > cb)
-                  if(p[pixel[6]] > cb)
-                   if(p[pixel[7]] > cb)
-                    if(p[pixel[8]] > cb)
-                     {}
-                    else
-                     continue;
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-               else
-                if(p[pixel[4]] > cb)
-                 if(p[pixel[5]] > cb)
-                  if(p[pixel[6]] > cb)
-                   if(p[pixel[7]] > cb)
-                    if(p[pixel[8]] > cb)
-                     {}
-                    else
-                     continue;
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-              else
-               if(p[pixel[3]] > cb)
-                if(p[pixel[4]] > cb)
-                 if(p[pixel[5]] > cb)
-                  if(p[pixel[6]] > cb)
-                   if(p[pixel[7]] > cb)
-                    if(p[pixel[8]] > cb)
-                     {}
+               else if(p[pixel[9]] < c_b)
+                if(p[pixel[7]] < c_b)
+                 if(p[pixel[8]] < c_b)
+                  if(p[pixel[10]] < c_b)
+                   if(p[pixel[11]] < c_b)
+                    if(p[pixel[6]] < c_b)
+                     if(p[pixel[5]] < c_b)
+                      if(p[pixel[4]] < c_b)
+                       if(p[pixel[3]] < c_b)
+                        {}
+                       else
+                        if(p[pixel[12]] < c_b)
+                         {}
+                        else
+                         continue;
+                      else
+                       if(p[pixel[12]] < c_b)
+                        if(p[pixel[13]] < c_b)
+                         {}
+                        else
+                         continue;
+                       else
+                        continue;
+                     else
+                      if(p[pixel[12]] < c_b)
+                       if(p[pixel[13]] < c_b)
+                        if(p[pixel[14]] < c_b)
+                         {}
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
                     else
-                     continue;
+                     if(p[pixel[12]] < c_b)
+                      if(p[pixel[13]] < c_b)
+                       if(p[pixel[14]] < c_b)
+                        if(p[pixel[15]] < c_b)
+                         {}
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
                    else
                     continue;
                   else
@@ -3949,180 +4178,249 @@ static corner_t *fast9_detect(image_t *image, rectangle_t *roi, int *n_corners,
                  continue;
                else
                 continue;
-             else
-              continue;
-            else
-             continue;
-           else if(p[pixel[9]] < c_b)
-            if(p[pixel[7]] < c_b)
-             if(p[pixel[8]] < c_b)
-              if(p[pixel[10]] < c_b)
-               if(p[pixel[6]] < c_b)
-                if(p[pixel[5]] < c_b)
-                 if(p[pixel[4]] < c_b)
-                  if(p[pixel[3]] < c_b)
-                   {}
-                  else
-                   if(p[pixel[11]] < c_b)
-                    if(p[pixel[12]] < c_b)
-                     {}
+             else if(p[pixel[1]] < c_b)
+              if(p[pixel[8]] > cb)
+               if(p[pixel[9]] > cb)
+                if(p[pixel[10]] > cb)
+                 if(p[pixel[11]] > cb)
+                  if(p[pixel[12]] > cb)
+                   if(p[pixel[13]] > cb)
+                    if(p[pixel[14]] > cb)
+                     if(p[pixel[15]] > cb)
+                      {}
+                     else
+                      if(p[pixel[6]] > cb)
+                       if(p[pixel[7]] > cb)
+                        {}
+                       else
+                        continue;
+                      else
+                       continue;
                     else
-                     continue;
+                     if(p[pixel[5]] > cb)
+                      if(p[pixel[6]] > cb)
+                       if(p[pixel[7]] > cb)
+                        {}
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
                    else
-                    continue;
-                 else
-                  if(p[pixel[11]] < c_b)
-                   if(p[pixel[12]] < c_b)
-                    if(p[pixel[13]] < c_b)
-                     {}
+                    if(p[pixel[4]] > cb)
+                     if(p[pixel[5]] > cb)
+                      if(p[pixel[6]] > cb)
+                       if(p[pixel[7]] > cb)
+                        {}
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
                     else
                      continue;
-                   else
-                    continue;
                   else
-                   continue;
-                else
-                 if(p[pixel[11]] < c_b)
-                  if(p[pixel[12]] < c_b)
-                   if(p[pixel[13]] < c_b)
-                    if(p[pixel[14]] < c_b)
-                     {}
+                   if(p[pixel[3]] > cb)
+                    if(p[pixel[4]] > cb)
+                     if(p[pixel[5]] > cb)
+                      if(p[pixel[6]] > cb)
+                       if(p[pixel[7]] > cb)
+                        {}
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
                     else
                      continue;
                    else
                     continue;
-                  else
-                   continue;
                  else
-                  continue;
-               else
-                if(p[pixel[11]] < c_b)
-                 if(p[pixel[12]] < c_b)
-                  if(p[pixel[13]] < c_b)
-                   if(p[pixel[14]] < c_b)
-                    if(p[pixel[15]] < c_b)
-                     {}
+                  if(p[pixel[2]] > cb)
+                   if(p[pixel[3]] > cb)
+                    if(p[pixel[4]] > cb)
+                     if(p[pixel[5]] > cb)
+                      if(p[pixel[6]] > cb)
+                       if(p[pixel[7]] > cb)
+                        {}
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
                     else
                      continue;
                    else
                     continue;
                   else
                    continue;
-                 else
-                  continue;
                 else
                  continue;
-              else
-               continue;
-             else
-              continue;
-            else
-             continue;
-           else
-            continue;
-          else
-           if(p[pixel[9]] > cb)
-            if(p[pixel[10]] > cb)
-             if(p[pixel[11]] > cb)
-              if(p[pixel[12]] > cb)
-               if(p[pixel[13]] > cb)
-                if(p[pixel[14]] > cb)
-                 if(p[pixel[15]] > cb)
-                  {}
-                 else
-                  if(p[pixel[6]] > cb)
-                   if(p[pixel[7]] > cb)
-                    if(p[pixel[8]] > cb)
-                     {}
+               else
+                continue;
+              else if(p[pixel[8]] < c_b)
+               if(p[pixel[7]] < c_b)
+                if(p[pixel[9]] < c_b)
+                 if(p[pixel[6]] < c_b)
+                  if(p[pixel[5]] < c_b)
+                   if(p[pixel[4]] < c_b)
+                    if(p[pixel[3]] < c_b)
+                     if(p[pixel[2]] < c_b)
+                      {}
+                     else
+                      if(p[pixel[10]] < c_b)
+                       if(p[pixel[11]] < c_b)
+                        {}
+                       else
+                        continue;
+                      else
+                       continue;
                     else
-                     continue;
+                     if(p[pixel[10]] < c_b)
+                      if(p[pixel[11]] < c_b)
+                       if(p[pixel[12]] < c_b)
+                        {}
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
                    else
-                    continue;
+                    if(p[pixel[10]] < c_b)
+                     if(p[pixel[11]] < c_b)
+                      if(p[pixel[12]] < c_b)
+                       if(p[pixel[13]] < c_b)
+                        {}
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
+                    else
+                     continue;
                   else
-                   continue;
-                else
-                 if(p[pixel[5]] > cb)
-                  if(p[pixel[6]] > cb)
-                   if(p[pixel[7]] > cb)
-                    if(p[pixel[8]] > cb)
-                     {}
+                   if(p[pixel[10]] < c_b)
+                    if(p[pixel[11]] < c_b)
+                     if(p[pixel[12]] < c_b)
+                      if(p[pixel[13]] < c_b)
+                       if(p[pixel[14]] < c_b)
+                        {}
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
                     else
                      continue;
                    else
                     continue;
-                  else
-                   continue;
                  else
-                  continue;
-               else
-                if(p[pixel[4]] > cb)
-                 if(p[pixel[5]] > cb)
-                  if(p[pixel[6]] > cb)
-                   if(p[pixel[7]] > cb)
-                    if(p[pixel[8]] > cb)
-                     {}
+                  if(p[pixel[10]] < c_b)
+                   if(p[pixel[11]] < c_b)
+                    if(p[pixel[12]] < c_b)
+                     if(p[pixel[13]] < c_b)
+                      if(p[pixel[14]] < c_b)
+                       if(p[pixel[15]] < c_b)
+                        {}
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
                     else
                      continue;
                    else
                     continue;
                   else
                    continue;
-                 else
-                  continue;
                 else
                  continue;
+               else
+                continue;
               else
-               if(p[pixel[3]] > cb)
-                if(p[pixel[4]] > cb)
-                 if(p[pixel[5]] > cb)
-                  if(p[pixel[6]] > cb)
-                   if(p[pixel[7]] > cb)
-                    if(p[pixel[8]] > cb)
-                     {}
-                    else
-                     continue;
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-               else
-                continue;
+               continue;
              else
-              continue;
-            else
-             continue;
-           else if(p[pixel[9]] < c_b)
-            if(p[pixel[7]] < c_b)
-             if(p[pixel[8]] < c_b)
-              if(p[pixel[10]] < c_b)
-               if(p[pixel[11]] < c_b)
-                if(p[pixel[6]] < c_b)
-                 if(p[pixel[5]] < c_b)
-                  if(p[pixel[4]] < c_b)
-                   if(p[pixel[3]] < c_b)
-                    {}
+              if(p[pixel[8]] > cb)
+               if(p[pixel[9]] > cb)
+                if(p[pixel[10]] > cb)
+                 if(p[pixel[11]] > cb)
+                  if(p[pixel[12]] > cb)
+                   if(p[pixel[13]] > cb)
+                    if(p[pixel[14]] > cb)
+                     if(p[pixel[15]] > cb)
+                      {}
+                     else
+                      if(p[pixel[6]] > cb)
+                       if(p[pixel[7]] > cb)
+                        {}
+                       else
+                        continue;
+                      else
+                       continue;
+                    else
+                     if(p[pixel[5]] > cb)
+                      if(p[pixel[6]] > cb)
+                       if(p[pixel[7]] > cb)
+                        {}
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
                    else
-                    if(p[pixel[12]] < c_b)
-                     {}
+                    if(p[pixel[4]] > cb)
+                     if(p[pixel[5]] > cb)
+                      if(p[pixel[6]] > cb)
+                       if(p[pixel[7]] > cb)
+                        {}
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
                     else
                      continue;
                   else
-                   if(p[pixel[12]] < c_b)
-                    if(p[pixel[13]] < c_b)
-                     {}
+                   if(p[pixel[3]] > cb)
+                    if(p[pixel[4]] > cb)
+                     if(p[pixel[5]] > cb)
+                      if(p[pixel[6]] > cb)
+                       if(p[pixel[7]] > cb)
+                        {}
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
                     else
                      continue;
                    else
                     continue;
                  else
-                  if(p[pixel[12]] < c_b)
-                   if(p[pixel[13]] < c_b)
-                    if(p[pixel[14]] < c_b)
-                     {}
+                  if(p[pixel[2]] > cb)
+                   if(p[pixel[3]] > cb)
+                    if(p[pixel[4]] > cb)
+                     if(p[pixel[5]] > cb)
+                      if(p[pixel[6]] > cb)
+                       if(p[pixel[7]] > cb)
+                        {}
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
                     else
                      continue;
                    else
@@ -4130,984 +4428,536 @@ static corner_t *fast9_detect(image_t *image, rectangle_t *roi, int *n_corners,
                   else
                    continue;
                 else
-                 if(p[pixel[12]] < c_b)
-                  if(p[pixel[13]] < c_b)
-                   if(p[pixel[14]] < c_b)
-                    if(p[pixel[15]] < c_b)
-                     {}
+                 continue;
+               else
+                continue;
+              else if(p[pixel[8]] < c_b)
+               if(p[pixel[7]] < c_b)
+                if(p[pixel[9]] < c_b)
+                 if(p[pixel[10]] < c_b)
+                  if(p[pixel[6]] < c_b)
+                   if(p[pixel[5]] < c_b)
+                    if(p[pixel[4]] < c_b)
+                     if(p[pixel[3]] < c_b)
+                      if(p[pixel[2]] < c_b)
+                       {}
+                      else
+                       if(p[pixel[11]] < c_b)
+                        {}
+                       else
+                        continue;
+                     else
+                      if(p[pixel[11]] < c_b)
+                       if(p[pixel[12]] < c_b)
+                        {}
+                       else
+                        continue;
+                      else
+                       continue;
+                    else
+                     if(p[pixel[11]] < c_b)
+                      if(p[pixel[12]] < c_b)
+                       if(p[pixel[13]] < c_b)
+                        {}
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
+                   else
+                    if(p[pixel[11]] < c_b)
+                     if(p[pixel[12]] < c_b)
+                      if(p[pixel[13]] < c_b)
+                       if(p[pixel[14]] < c_b)
+                        {}
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
+                    else
+                     continue;
+                  else
+                   if(p[pixel[11]] < c_b)
+                    if(p[pixel[12]] < c_b)
+                     if(p[pixel[13]] < c_b)
+                      if(p[pixel[14]] < c_b)
+                       if(p[pixel[15]] < c_b)
+                        {}
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
                     else
                      continue;
                    else
                     continue;
-                  else
-                   continue;
                  else
                   continue;
+                else
+                 continue;
                else
                 continue;
               else
                continue;
-             else
-              continue;
-            else
-             continue;
-           else
-            continue;
-         else if(p[pixel[1]] < c_b)
-          if(p[pixel[8]] > cb)
-           if(p[pixel[9]] > cb)
-            if(p[pixel[10]] > cb)
-             if(p[pixel[11]] > cb)
-              if(p[pixel[12]] > cb)
-               if(p[pixel[13]] > cb)
-                if(p[pixel[14]] > cb)
-                 if(p[pixel[15]] > cb)
-                  {}
-                 else
-                  if(p[pixel[6]] > cb)
-                   if(p[pixel[7]] > cb)
-                    {}
+            else if(p[pixel[0]] < c_b)
+             if(p[pixel[1]] > cb)
+              if(p[pixel[8]] > cb)
+               if(p[pixel[7]] > cb)
+                if(p[pixel[9]] > cb)
+                 if(p[pixel[6]] > cb)
+                  if(p[pixel[5]] > cb)
+                   if(p[pixel[4]] > cb)
+                    if(p[pixel[3]] > cb)
+                     if(p[pixel[2]] > cb)
+                      {}
+                     else
+                      if(p[pixel[10]] > cb)
+                       if(p[pixel[11]] > cb)
+                        {}
+                       else
+                        continue;
+                      else
+                       continue;
+                    else
+                     if(p[pixel[10]] > cb)
+                      if(p[pixel[11]] > cb)
+                       if(p[pixel[12]] > cb)
+                        {}
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
                    else
-                    continue;
+                    if(p[pixel[10]] > cb)
+                     if(p[pixel[11]] > cb)
+                      if(p[pixel[12]] > cb)
+                       if(p[pixel[13]] > cb)
+                        {}
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
+                    else
+                     continue;
                   else
-                   continue;
-                else
-                 if(p[pixel[5]] > cb)
-                  if(p[pixel[6]] > cb)
-                   if(p[pixel[7]] > cb)
-                    {}
+                   if(p[pixel[10]] > cb)
+                    if(p[pixel[11]] > cb)
+                     if(p[pixel[12]] > cb)
+                      if(p[pixel[13]] > cb)
+                       if(p[pixel[14]] > cb)
+                        {}
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
+                    else
+                     continue;
                    else
                     continue;
-                  else
-                   continue;
                  else
-                  continue;
-               else
-                if(p[pixel[4]] > cb)
-                 if(p[pixel[5]] > cb)
-                  if(p[pixel[6]] > cb)
-                   if(p[pixel[7]] > cb)
-                    {}
+                  if(p[pixel[10]] > cb)
+                   if(p[pixel[11]] > cb)
+                    if(p[pixel[12]] > cb)
+                     if(p[pixel[13]] > cb)
+                      if(p[pixel[14]] > cb)
+                       if(p[pixel[15]] > cb)
+                        {}
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
+                    else
+                     continue;
                    else
                     continue;
                   else
                    continue;
-                 else
-                  continue;
-                else
-                 continue;
-              else
-               if(p[pixel[3]] > cb)
-                if(p[pixel[4]] > cb)
-                 if(p[pixel[5]] > cb)
-                  if(p[pixel[6]] > cb)
-                   if(p[pixel[7]] > cb)
-                    {}
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
                 else
                  continue;
                else
                 continue;
-             else
-              if(p[pixel[2]] > cb)
-               if(p[pixel[3]] > cb)
-                if(p[pixel[4]] > cb)
-                 if(p[pixel[5]] > cb)
-                  if(p[pixel[6]] > cb)
-                   if(p[pixel[7]] > cb)
-                    {}
+              else if(p[pixel[8]] < c_b)
+               if(p[pixel[9]] < c_b)
+                if(p[pixel[10]] < c_b)
+                 if(p[pixel[11]] < c_b)
+                  if(p[pixel[12]] < c_b)
+                   if(p[pixel[13]] < c_b)
+                    if(p[pixel[14]] < c_b)
+                     if(p[pixel[15]] < c_b)
+                      {}
+                     else
+                      if(p[pixel[6]] < c_b)
+                       if(p[pixel[7]] < c_b)
+                        {}
+                       else
+                        continue;
+                      else
+                       continue;
+                    else
+                     if(p[pixel[5]] < c_b)
+                      if(p[pixel[6]] < c_b)
+                       if(p[pixel[7]] < c_b)
+                        {}
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
+                   else
+                    if(p[pixel[4]] < c_b)
+                     if(p[pixel[5]] < c_b)
+                      if(p[pixel[6]] < c_b)
+                       if(p[pixel[7]] < c_b)
+                        {}
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
+                    else
+                     continue;
+                  else
+                   if(p[pixel[3]] < c_b)
+                    if(p[pixel[4]] < c_b)
+                     if(p[pixel[5]] < c_b)
+                      if(p[pixel[6]] < c_b)
+                       if(p[pixel[7]] < c_b)
+                        {}
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
+                    else
+                     continue;
+                   else
+                    continue;
+                 else
+                  if(p[pixel[2]] < c_b)
+                   if(p[pixel[3]] < c_b)
+                    if(p[pixel[4]] < c_b)
+                     if(p[pixel[5]] < c_b)
+                      if(p[pixel[6]] < c_b)
+                       if(p[pixel[7]] < c_b)
+                        {}
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
+                    else
+                     continue;
                    else
                     continue;
                   else
                    continue;
-                 else
-                  continue;
                 else
                  continue;
                else
                 continue;
               else
                continue;
-            else
-             continue;
-           else
-            continue;
-          else if(p[pixel[8]] < c_b)
-           if(p[pixel[7]] < c_b)
-            if(p[pixel[9]] < c_b)
-             if(p[pixel[6]] < c_b)
-              if(p[pixel[5]] < c_b)
-               if(p[pixel[4]] < c_b)
-                if(p[pixel[3]] < c_b)
-                 if(p[pixel[2]] < c_b)
-                  {}
-                 else
-                  if(p[pixel[10]] < c_b)
-                   if(p[pixel[11]] < c_b)
-                    {}
-                   else
-                    continue;
-                  else
-                   continue;
-                else
-                 if(p[pixel[10]] < c_b)
-                  if(p[pixel[11]] < c_b)
-                   if(p[pixel[12]] < c_b)
-                    {}
+             else if(p[pixel[1]] < c_b)
+              if(p[pixel[2]] > cb)
+               if(p[pixel[9]] > cb)
+                if(p[pixel[7]] > cb)
+                 if(p[pixel[8]] > cb)
+                  if(p[pixel[10]] > cb)
+                   if(p[pixel[6]] > cb)
+                    if(p[pixel[5]] > cb)
+                     if(p[pixel[4]] > cb)
+                      if(p[pixel[3]] > cb)
+                       {}
+                      else
+                       if(p[pixel[11]] > cb)
+                        if(p[pixel[12]] > cb)
+                         {}
+                        else
+                         continue;
+                       else
+                        continue;
+                     else
+                      if(p[pixel[11]] > cb)
+                       if(p[pixel[12]] > cb)
+                        if(p[pixel[13]] > cb)
+                         {}
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
+                    else
+                     if(p[pixel[11]] > cb)
+                      if(p[pixel[12]] > cb)
+                       if(p[pixel[13]] > cb)
+                        if(p[pixel[14]] > cb)
+                         {}
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
                    else
-                    continue;
+                    if(p[pixel[11]] > cb)
+                     if(p[pixel[12]] > cb)
+                      if(p[pixel[13]] > cb)
+                       if(p[pixel[14]] > cb)
+                        if(p[pixel[15]] > cb)
+                         {}
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
+                    else
+                     continue;
                   else
                    continue;
                  else
                   continue;
-               else
+                else
+                 continue;
+               else if(p[pixel[9]] < c_b)
                 if(p[pixel[10]] < c_b)
                  if(p[pixel[11]] < c_b)
                   if(p[pixel[12]] < c_b)
                    if(p[pixel[13]] < c_b)
-                    {}
+                    if(p[pixel[14]] < c_b)
+                     if(p[pixel[15]] < c_b)
+                      {}
+                     else
+                      if(p[pixel[6]] < c_b)
+                       if(p[pixel[7]] < c_b)
+                        if(p[pixel[8]] < c_b)
+                         {}
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
+                    else
+                     if(p[pixel[5]] < c_b)
+                      if(p[pixel[6]] < c_b)
+                       if(p[pixel[7]] < c_b)
+                        if(p[pixel[8]] < c_b)
+                         {}
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
                    else
-                    continue;
+                    if(p[pixel[4]] < c_b)
+                     if(p[pixel[5]] < c_b)
+                      if(p[pixel[6]] < c_b)
+                       if(p[pixel[7]] < c_b)
+                        if(p[pixel[8]] < c_b)
+                         {}
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
+                    else
+                     continue;
                   else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-              else
-               if(p[pixel[10]] < c_b)
-                if(p[pixel[11]] < c_b)
-                 if(p[pixel[12]] < c_b)
-                  if(p[pixel[13]] < c_b)
-                   if(p[pixel[14]] < c_b)
-                    {}
+                   if(p[pixel[3]] < c_b)
+                    if(p[pixel[4]] < c_b)
+                     if(p[pixel[5]] < c_b)
+                      if(p[pixel[6]] < c_b)
+                       if(p[pixel[7]] < c_b)
+                        if(p[pixel[8]] < c_b)
+                         {}
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
+                    else
+                     continue;
                    else
                     continue;
-                  else
-                   continue;
                  else
                   continue;
                 else
                  continue;
                else
                 continue;
-             else
-              if(p[pixel[10]] < c_b)
-               if(p[pixel[11]] < c_b)
-                if(p[pixel[12]] < c_b)
-                 if(p[pixel[13]] < c_b)
-                  if(p[pixel[14]] < c_b)
-                   if(p[pixel[15]] < c_b)
-                    {}
+              else if(p[pixel[2]] < c_b)
+               if(p[pixel[3]] > cb)
+                if(p[pixel[10]] > cb)
+                 if(p[pixel[7]] > cb)
+                  if(p[pixel[8]] > cb)
+                   if(p[pixel[9]] > cb)
+                    if(p[pixel[11]] > cb)
+                     if(p[pixel[6]] > cb)
+                      if(p[pixel[5]] > cb)
+                       if(p[pixel[4]] > cb)
+                        {}
+                       else
+                        if(p[pixel[12]] > cb)
+                         if(p[pixel[13]] > cb)
+                          {}
+                         else
+                          continue;
+                        else
+                         continue;
+                      else
+                       if(p[pixel[12]] > cb)
+                        if(p[pixel[13]] > cb)
+                         if(p[pixel[14]] > cb)
+                          {}
+                         else
+                          continue;
+                        else
+                         continue;
+                       else
+                        continue;
+                     else
+                      if(p[pixel[12]] > cb)
+                       if(p[pixel[13]] > cb)
+                        if(p[pixel[14]] > cb)
+                         if(p[pixel[15]] > cb)
+                          {}
+                         else
+                          continue;
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
+                    else
+                     continue;
                    else
                     continue;
                   else
                    continue;
                  else
                   continue;
-                else
-                 continue;
-               else
-                continue;
-              else
-               continue;
-            else
-             continue;
-           else
-            continue;
-          else
-           continue;
-         else
-          if(p[pixel[8]] > cb)
-           if(p[pixel[9]] > cb)
-            if(p[pixel[10]] > cb)
-             if(p[pixel[11]] > cb)
-              if(p[pixel[12]] > cb)
-               if(p[pixel[13]] > cb)
-                if(p[pixel[14]] > cb)
-                 if(p[pixel[15]] > cb)
-                  {}
-                 else
-                  if(p[pixel[6]] > cb)
-                   if(p[pixel[7]] > cb)
-                    {}
+                else if(p[pixel[10]] < c_b)
+                 if(p[pixel[11]] < c_b)
+                  if(p[pixel[12]] < c_b)
+                   if(p[pixel[13]] < c_b)
+                    if(p[pixel[14]] < c_b)
+                     if(p[pixel[15]] < c_b)
+                      {}
+                     else
+                      if(p[pixel[6]] < c_b)
+                       if(p[pixel[7]] < c_b)
+                        if(p[pixel[8]] < c_b)
+                         if(p[pixel[9]] < c_b)
+                          {}
+                         else
+                          continue;
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
+                    else
+                     if(p[pixel[5]] < c_b)
+                      if(p[pixel[6]] < c_b)
+                       if(p[pixel[7]] < c_b)
+                        if(p[pixel[8]] < c_b)
+                         if(p[pixel[9]] < c_b)
+                          {}
+                         else
+                          continue;
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
                    else
-                    continue;
+                    if(p[pixel[4]] < c_b)
+                     if(p[pixel[5]] < c_b)
+                      if(p[pixel[6]] < c_b)
+                       if(p[pixel[7]] < c_b)
+                        if(p[pixel[8]] < c_b)
+                         if(p[pixel[9]] < c_b)
+                          {}
+                         else
+                          continue;
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
+                    else
+                     continue;
                   else
                    continue;
+                 else
+                  continue;
                 else
-                 if(p[pixel[5]] > cb)
-                  if(p[pixel[6]] > cb)
-                   if(p[pixel[7]] > cb)
-                    {}
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-               else
-                if(p[pixel[4]] > cb)
-                 if(p[pixel[5]] > cb)
-                  if(p[pixel[6]] > cb)
-                   if(p[pixel[7]] > cb)
-                    {}
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-              else
-               if(p[pixel[3]] > cb)
-                if(p[pixel[4]] > cb)
-                 if(p[pixel[5]] > cb)
-                  if(p[pixel[6]] > cb)
-                   if(p[pixel[7]] > cb)
-                    {}
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-               else
-                continue;
-             else
-              if(p[pixel[2]] > cb)
-               if(p[pixel[3]] > cb)
-                if(p[pixel[4]] > cb)
-                 if(p[pixel[5]] > cb)
-                  if(p[pixel[6]] > cb)
-                   if(p[pixel[7]] > cb)
-                    {}
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-               else
-                continue;
-              else
-               continue;
-            else
-             continue;
-           else
-            continue;
-          else if(p[pixel[8]] < c_b)
-           if(p[pixel[7]] < c_b)
-            if(p[pixel[9]] < c_b)
-             if(p[pixel[10]] < c_b)
-              if(p[pixel[6]] < c_b)
-               if(p[pixel[5]] < c_b)
-                if(p[pixel[4]] < c_b)
-                 if(p[pixel[3]] < c_b)
-                  if(p[pixel[2]] < c_b)
-                   {}
-                  else
-                   if(p[pixel[11]] < c_b)
-                    {}
-                   else
-                    continue;
-                 else
-                  if(p[pixel[11]] < c_b)
-                   if(p[pixel[12]] < c_b)
-                    {}
-                   else
-                    continue;
-                  else
-                   continue;
-                else
-                 if(p[pixel[11]] < c_b)
-                  if(p[pixel[12]] < c_b)
-                   if(p[pixel[13]] < c_b)
-                    {}
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-               else
-                if(p[pixel[11]] < c_b)
-                 if(p[pixel[12]] < c_b)
-                  if(p[pixel[13]] < c_b)
-                   if(p[pixel[14]] < c_b)
-                    {}
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-              else
-               if(p[pixel[11]] < c_b)
-                if(p[pixel[12]] < c_b)
-                 if(p[pixel[13]] < c_b)
-                  if(p[pixel[14]] < c_b)
-                   if(p[pixel[15]] < c_b)
-                    {}
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-               else
-                continue;
-             else
-              continue;
-            else
-             continue;
-           else
-            continue;
-          else
-           continue;
-        else if(p[pixel[0]] < c_b)
-         if(p[pixel[1]] > cb)
-          if(p[pixel[8]] > cb)
-           if(p[pixel[7]] > cb)
-            if(p[pixel[9]] > cb)
-             if(p[pixel[6]] > cb)
-              if(p[pixel[5]] > cb)
-               if(p[pixel[4]] > cb)
-                if(p[pixel[3]] > cb)
-                 if(p[pixel[2]] > cb)
-                  {}
-                 else
-                  if(p[pixel[10]] > cb)
-                   if(p[pixel[11]] > cb)
-                    {}
-                   else
-                    continue;
-                  else
-                   continue;
-                else
-                 if(p[pixel[10]] > cb)
-                  if(p[pixel[11]] > cb)
-                   if(p[pixel[12]] > cb)
-                    {}
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-               else
-                if(p[pixel[10]] > cb)
-                 if(p[pixel[11]] > cb)
-                  if(p[pixel[12]] > cb)
-                   if(p[pixel[13]] > cb)
-                    {}
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-              else
-               if(p[pixel[10]] > cb)
-                if(p[pixel[11]] > cb)
-                 if(p[pixel[12]] > cb)
-                  if(p[pixel[13]] > cb)
-                   if(p[pixel[14]] > cb)
-                    {}
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-               else
-                continue;
-             else
-              if(p[pixel[10]] > cb)
-               if(p[pixel[11]] > cb)
-                if(p[pixel[12]] > cb)
-                 if(p[pixel[13]] > cb)
-                  if(p[pixel[14]] > cb)
-                   if(p[pixel[15]] > cb)
-                    {}
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-               else
-                continue;
-              else
-               continue;
-            else
-             continue;
-           else
-            continue;
-          else if(p[pixel[8]] < c_b)
-           if(p[pixel[9]] < c_b)
-            if(p[pixel[10]] < c_b)
-             if(p[pixel[11]] < c_b)
-              if(p[pixel[12]] < c_b)
-               if(p[pixel[13]] < c_b)
-                if(p[pixel[14]] < c_b)
-                 if(p[pixel[15]] < c_b)
-                  {}
-                 else
-                  if(p[pixel[6]] < c_b)
-                   if(p[pixel[7]] < c_b)
-                    {}
-                   else
-                    continue;
-                  else
-                   continue;
-                else
-                 if(p[pixel[5]] < c_b)
-                  if(p[pixel[6]] < c_b)
-                   if(p[pixel[7]] < c_b)
-                    {}
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-               else
-                if(p[pixel[4]] < c_b)
-                 if(p[pixel[5]] < c_b)
-                  if(p[pixel[6]] < c_b)
-                   if(p[pixel[7]] < c_b)
-                    {}
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-              else
-               if(p[pixel[3]] < c_b)
-                if(p[pixel[4]] < c_b)
-                 if(p[pixel[5]] < c_b)
-                  if(p[pixel[6]] < c_b)
-                   if(p[pixel[7]] < c_b)
-                    {}
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-               else
-                continue;
-             else
-              if(p[pixel[2]] < c_b)
-               if(p[pixel[3]] < c_b)
-                if(p[pixel[4]] < c_b)
-                 if(p[pixel[5]] < c_b)
-                  if(p[pixel[6]] < c_b)
-                   if(p[pixel[7]] < c_b)
-                    {}
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-               else
-                continue;
-              else
-               continue;
-            else
-             continue;
-           else
-            continue;
-          else
-           continue;
-         else if(p[pixel[1]] < c_b)
-          if(p[pixel[2]] > cb)
-           if(p[pixel[9]] > cb)
-            if(p[pixel[7]] > cb)
-             if(p[pixel[8]] > cb)
-              if(p[pixel[10]] > cb)
-               if(p[pixel[6]] > cb)
-                if(p[pixel[5]] > cb)
-                 if(p[pixel[4]] > cb)
-                  if(p[pixel[3]] > cb)
-                   {}
-                  else
-                   if(p[pixel[11]] > cb)
-                    if(p[pixel[12]] > cb)
-                     {}
-                    else
-                     continue;
-                   else
-                    continue;
-                 else
-                  if(p[pixel[11]] > cb)
-                   if(p[pixel[12]] > cb)
-                    if(p[pixel[13]] > cb)
-                     {}
-                    else
-                     continue;
-                   else
-                    continue;
-                  else
-                   continue;
-                else
-                 if(p[pixel[11]] > cb)
-                  if(p[pixel[12]] > cb)
-                   if(p[pixel[13]] > cb)
-                    if(p[pixel[14]] > cb)
-                     {}
-                    else
-                     continue;
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-               else
-                if(p[pixel[11]] > cb)
-                 if(p[pixel[12]] > cb)
-                  if(p[pixel[13]] > cb)
-                   if(p[pixel[14]] > cb)
-                    if(p[pixel[15]] > cb)
-                     {}
-                    else
-                     continue;
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-              else
-               continue;
-             else
-              continue;
-            else
-             continue;
-           else if(p[pixel[9]] < c_b)
-            if(p[pixel[10]] < c_b)
-             if(p[pixel[11]] < c_b)
-              if(p[pixel[12]] < c_b)
-               if(p[pixel[13]] < c_b)
-                if(p[pixel[14]] < c_b)
-                 if(p[pixel[15]] < c_b)
-                  {}
-                 else
-                  if(p[pixel[6]] < c_b)
-                   if(p[pixel[7]] < c_b)
-                    if(p[pixel[8]] < c_b)
-                     {}
-                    else
-                     continue;
-                   else
-                    continue;
-                  else
-                   continue;
-                else
-                 if(p[pixel[5]] < c_b)
-                  if(p[pixel[6]] < c_b)
-                   if(p[pixel[7]] < c_b)
-                    if(p[pixel[8]] < c_b)
-                     {}
-                    else
-                     continue;
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-               else
-                if(p[pixel[4]] < c_b)
-                 if(p[pixel[5]] < c_b)
-                  if(p[pixel[6]] < c_b)
-                   if(p[pixel[7]] < c_b)
-                    if(p[pixel[8]] < c_b)
-                     {}
-                    else
-                     continue;
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-              else
-               if(p[pixel[3]] < c_b)
-                if(p[pixel[4]] < c_b)
-                 if(p[pixel[5]] < c_b)
-                  if(p[pixel[6]] < c_b)
-                   if(p[pixel[7]] < c_b)
-                    if(p[pixel[8]] < c_b)
-                     {}
-                    else
-                     continue;
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-               else
-                continue;
-             else
-              continue;
-            else
-             continue;
-           else
-            continue;
-          else if(p[pixel[2]] < c_b)
-           if(p[pixel[3]] > cb)
-            if(p[pixel[10]] > cb)
-             if(p[pixel[7]] > cb)
-              if(p[pixel[8]] > cb)
-               if(p[pixel[9]] > cb)
-                if(p[pixel[11]] > cb)
-                 if(p[pixel[6]] > cb)
-                  if(p[pixel[5]] > cb)
-                   if(p[pixel[4]] > cb)
-                    {}
-                   else
-                    if(p[pixel[12]] > cb)
-                     if(p[pixel[13]] > cb)
-                      {}
-                     else
-                      continue;
-                    else
-                     continue;
-                  else
-                   if(p[pixel[12]] > cb)
-                    if(p[pixel[13]] > cb)
-                     if(p[pixel[14]] > cb)
-                      {}
-                     else
-                      continue;
-                    else
-                     continue;
-                   else
-                    continue;
-                 else
-                  if(p[pixel[12]] > cb)
-                   if(p[pixel[13]] > cb)
-                    if(p[pixel[14]] > cb)
-                     if(p[pixel[15]] > cb)
-                      {}
-                     else
-                      continue;
-                    else
-                     continue;
-                   else
-                    continue;
-                  else
-                   continue;
-                else
-                 continue;
-               else
-                continue;
-              else
-               continue;
-             else
-              continue;
-            else if(p[pixel[10]] < c_b)
-             if(p[pixel[11]] < c_b)
-              if(p[pixel[12]] < c_b)
-               if(p[pixel[13]] < c_b)
-                if(p[pixel[14]] < c_b)
-                 if(p[pixel[15]] < c_b)
-                  {}
-                 else
-                  if(p[pixel[6]] < c_b)
-                   if(p[pixel[7]] < c_b)
-                    if(p[pixel[8]] < c_b)
-                     if(p[pixel[9]] < c_b)
-                      {}
-                     else
-                      continue;
-                    else
-                     continue;
-                   else
-                    continue;
-                  else
-                   continue;
-                else
-                 if(p[pixel[5]] < c_b)
-                  if(p[pixel[6]] < c_b)
-                   if(p[pixel[7]] < c_b)
-                    if(p[pixel[8]] < c_b)
-                     if(p[pixel[9]] < c_b)
-                      {}
-                     else
-                      continue;
-                    else
-                     continue;
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-               else
-                if(p[pixel[4]] < c_b)
-                 if(p[pixel[5]] < c_b)
-                  if(p[pixel[6]] < c_b)
-                   if(p[pixel[7]] < c_b)
-                    if(p[pixel[8]] < c_b)
-                     if(p[pixel[9]] < c_b)
-                      {}
-                     else
-                      continue;
-                    else
-                     continue;
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-              else
-               continue;
-             else
-              continue;
-            else
-             continue;
-           else if(p[pixel[3]] < c_b)
-            if(p[pixel[4]] > cb)
-             if(p[pixel[13]] > cb)
-              if(p[pixel[7]] > cb)
-               if(p[pixel[8]] > cb)
-                if(p[pixel[9]] > cb)
-                 if(p[pixel[10]] > cb)
-                  if(p[pixel[11]] > cb)
-                   if(p[pixel[12]] > cb)
-                    if(p[pixel[6]] > cb)
-                     if(p[pixel[5]] > cb)
-                      {}
-                     else
-                      if(p[pixel[14]] > cb)
-                       {}
-                      else
-                       continue;
-                    else
-                     if(p[pixel[14]] > cb)
-                      if(p[pixel[15]] > cb)
-                       {}
-                      else
-                       continue;
-                     else
-                      continue;
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-               else
-                continue;
-              else
-               continue;
-             else if(p[pixel[13]] < c_b)
-              if(p[pixel[11]] > cb)
-               if(p[pixel[5]] > cb)
-                if(p[pixel[6]] > cb)
-                 if(p[pixel[7]] > cb)
-                  if(p[pixel[8]] > cb)
-                   if(p[pixel[9]] > cb)
-                    if(p[pixel[10]] > cb)
-                     if(p[pixel[12]] > cb)
-                      {}
-                     else
-                      continue;
-                    else
-                     continue;
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-               else
-                continue;
-              else if(p[pixel[11]] < c_b)
-               if(p[pixel[12]] < c_b)
-                if(p[pixel[14]] < c_b)
-                 if(p[pixel[15]] < c_b)
-                  {}
-                 else
-                  if(p[pixel[6]] < c_b)
-                   if(p[pixel[7]] < c_b)
-                    if(p[pixel[8]] < c_b)
-                     if(p[pixel[9]] < c_b)
-                      if(p[pixel[10]] < c_b)
-                       {}
-                      else
-                       continue;
-                     else
-                      continue;
-                    else
-                     continue;
-                   else
-                    continue;
-                  else
-                   continue;
-                else
-                 if(p[pixel[5]] < c_b)
-                  if(p[pixel[6]] < c_b)
-                   if(p[pixel[7]] < c_b)
-                    if(p[pixel[8]] < c_b)
-                     if(p[pixel[9]] < c_b)
-                      if(p[pixel[10]] < c_b)
-                       {}
-                      else
-                       continue;
-                     else
-                      continue;
-                    else
-                     continue;
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-               else
-                continue;
-              else
-               continue;
-             else
-              if(p[pixel[5]] > cb)
-               if(p[pixel[6]] > cb)
-                if(p[pixel[7]] > cb)
-                 if(p[pixel[8]] > cb)
-                  if(p[pixel[9]] > cb)
-                   if(p[pixel[10]] > cb)
-                    if(p[pixel[11]] > cb)
-                     if(p[pixel[12]] > cb)
-                      {}
-                     else
-                      continue;
-                    else
-                     continue;
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-               else
-                continue;
-              else
-               continue;
-            else if(p[pixel[4]] < c_b)
-             if(p[pixel[5]] > cb)
-              if(p[pixel[14]] > cb)
-               if(p[pixel[7]] > cb)
-                if(p[pixel[8]] > cb)
-                 if(p[pixel[9]] > cb)
-                  if(p[pixel[10]] > cb)
-                   if(p[pixel[11]] > cb)
-                    if(p[pixel[12]] > cb)
-                     if(p[pixel[13]] > cb)
-                      if(p[pixel[6]] > cb)
-                       {}
-                      else
-                       if(p[pixel[15]] > cb)
-                        {}
-                       else
-                        continue;
-                     else
-                      continue;
-                    else
-                     continue;
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-               else
-                continue;
-              else if(p[pixel[14]] < c_b)
-               if(p[pixel[12]] > cb)
-                if(p[pixel[6]] > cb)
-                 if(p[pixel[7]] > cb)
-                  if(p[pixel[8]] > cb)
-                   if(p[pixel[9]] > cb)
-                    if(p[pixel[10]] > cb)
-                     if(p[pixel[11]] > cb)
-                      if(p[pixel[13]] > cb)
-                       {}
-                      else
-                       continue;
-                     else
-                      continue;
-                    else
-                     continue;
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-               else if(p[pixel[12]] < c_b)
-                if(p[pixel[13]] < c_b)
-                 if(p[pixel[15]] < c_b)
-                  {}
-                 else
-                  if(p[pixel[6]] < c_b)
-                   if(p[pixel[7]] < c_b)
-                    if(p[pixel[8]] < c_b)
-                     if(p[pixel[9]] < c_b)
-                      if(p[pixel[10]] < c_b)
-                       if(p[pixel[11]] < c_b)
-                        {}
+                 continue;
+               else if(p[pixel[3]] < c_b)
+                if(p[pixel[4]] > cb)
+                 if(p[pixel[13]] > cb)
+                  if(p[pixel[7]] > cb)
+                   if(p[pixel[8]] > cb)
+                    if(p[pixel[9]] > cb)
+                     if(p[pixel[10]] > cb)
+                      if(p[pixel[11]] > cb)
+                       if(p[pixel[12]] > cb)
+                        if(p[pixel[6]] > cb)
+                         if(p[pixel[5]] > cb)
+                          {}
+                         else
+                          if(p[pixel[14]] > cb)
+                           {}
+                          else
+                           continue;
+                        else
+                         if(p[pixel[14]] > cb)
+                          if(p[pixel[15]] > cb)
+                           {}
+                          else
+                           continue;
+                         else
+                          continue;
                        else
                         continue;
                       else
@@ -5120,48 +4970,20 @@ static corner_t *fast9_detect(image_t *image, rectangle_t *roi, int *n_corners,
                     continue;
                   else
                    continue;
-                else
-                 continue;
-               else
-                continue;
-              else
-               if(p[pixel[6]] > cb)
-                if(p[pixel[7]] > cb)
-                 if(p[pixel[8]] > cb)
-                  if(p[pixel[9]] > cb)
-                   if(p[pixel[10]] > cb)
-                    if(p[pixel[11]] > cb)
-                     if(p[pixel[12]] > cb)
-                      if(p[pixel[13]] > cb)
-                       {}
-                      else
-                       continue;
-                     else
-                      continue;
-                    else
-                     continue;
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-               else
-                continue;
-             else if(p[pixel[5]] < c_b)
-              if(p[pixel[6]] > cb)
-               if(p[pixel[15]] < c_b)
-                if(p[pixel[13]] > cb)
-                 if(p[pixel[7]] > cb)
-                  if(p[pixel[8]] > cb)
-                   if(p[pixel[9]] > cb)
-                    if(p[pixel[10]] > cb)
-                     if(p[pixel[11]] > cb)
-                      if(p[pixel[12]] > cb)
-                       if(p[pixel[14]] > cb)
-                        {}
+                 else if(p[pixel[13]] < c_b)
+                  if(p[pixel[11]] > cb)
+                   if(p[pixel[5]] > cb)
+                    if(p[pixel[6]] > cb)
+                     if(p[pixel[7]] > cb)
+                      if(p[pixel[8]] > cb)
+                       if(p[pixel[9]] > cb)
+                        if(p[pixel[10]] > cb)
+                         if(p[pixel[12]] > cb)
+                          {}
+                         else
+                          continue;
+                        else
+                         continue;
                        else
                         continue;
                       else
@@ -5172,102 +4994,66 @@ static corner_t *fast9_detect(image_t *image, rectangle_t *roi, int *n_corners,
                      continue;
                    else
                     continue;
-                  else
-                   continue;
-                 else
-                  continue;
-                else if(p[pixel[13]] < c_b)
-                 if(p[pixel[14]] < c_b)
-                  {}
-                 else
-                  continue;
-                else
-                 continue;
-               else
-                if(p[pixel[7]] > cb)
-                 if(p[pixel[8]] > cb)
-                  if(p[pixel[9]] > cb)
-                   if(p[pixel[10]] > cb)
-                    if(p[pixel[11]] > cb)
-                     if(p[pixel[12]] > cb)
-                      if(p[pixel[13]] > cb)
-                       if(p[pixel[14]] > cb)
-                        {}
+                  else if(p[pixel[11]] < c_b)
+                   if(p[pixel[12]] < c_b)
+                    if(p[pixel[14]] < c_b)
+                     if(p[pixel[15]] < c_b)
+                      {}
+                     else
+                      if(p[pixel[6]] < c_b)
+                       if(p[pixel[7]] < c_b)
+                        if(p[pixel[8]] < c_b)
+                         if(p[pixel[9]] < c_b)
+                          if(p[pixel[10]] < c_b)
+                           {}
+                          else
+                           continue;
+                         else
+                          continue;
+                        else
+                         continue;
                        else
                         continue;
                       else
                        continue;
-                     else
-                      continue;
                     else
-                     continue;
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-              else if(p[pixel[6]] < c_b)
-               if(p[pixel[7]] > cb)
-                if(p[pixel[14]] > cb)
-                 if(p[pixel[8]] > cb)
-                  if(p[pixel[9]] > cb)
-                   if(p[pixel[10]] > cb)
-                    if(p[pixel[11]] > cb)
-                     if(p[pixel[12]] > cb)
-                      if(p[pixel[13]] > cb)
-                       if(p[pixel[15]] > cb)
-                        {}
+                     if(p[pixel[5]] < c_b)
+                      if(p[pixel[6]] < c_b)
+                       if(p[pixel[7]] < c_b)
+                        if(p[pixel[8]] < c_b)
+                         if(p[pixel[9]] < c_b)
+                          if(p[pixel[10]] < c_b)
+                           {}
+                          else
+                           continue;
+                         else
+                          continue;
+                        else
+                         continue;
                        else
                         continue;
                       else
                        continue;
                      else
                       continue;
-                    else
-                     continue;
                    else
                     continue;
                   else
                    continue;
                  else
-                  continue;
-                else if(p[pixel[14]] < c_b)
-                 if(p[pixel[15]] < c_b)
-                  {}
-                 else
-                  continue;
-                else
-                 continue;
-               else if(p[pixel[7]] < c_b)
-                if(p[pixel[8]] < c_b)
-                 {}
-                else
-                 if(p[pixel[15]] < c_b)
-                  {}
-                 else
-                  continue;
-               else
-                if(p[pixel[14]] < c_b)
-                 if(p[pixel[15]] < c_b)
-                  {}
-                 else
-                  continue;
-                else
-                 continue;
-              else
-               if(p[pixel[13]] > cb)
-                if(p[pixel[7]] > cb)
-                 if(p[pixel[8]] > cb)
-                  if(p[pixel[9]] > cb)
-                   if(p[pixel[10]] > cb)
-                    if(p[pixel[11]] > cb)
-                     if(p[pixel[12]] > cb)
-                      if(p[pixel[14]] > cb)
-                       if(p[pixel[15]] > cb)
-                        {}
+                  if(p[pixel[5]] > cb)
+                   if(p[pixel[6]] > cb)
+                    if(p[pixel[7]] > cb)
+                     if(p[pixel[8]] > cb)
+                      if(p[pixel[9]] > cb)
+                       if(p[pixel[10]] > cb)
+                        if(p[pixel[11]] > cb)
+                         if(p[pixel[12]] > cb)
+                          {}
+                         else
+                          continue;
+                        else
+                         continue;
                        else
                         continue;
                       else
@@ -5280,63 +5066,53 @@ static corner_t *fast9_detect(image_t *image, rectangle_t *roi, int *n_corners,
                     continue;
                   else
                    continue;
-                 else
-                  continue;
-                else
-                 continue;
-               else if(p[pixel[13]] < c_b)
-                if(p[pixel[14]] < c_b)
-                 if(p[pixel[15]] < c_b)
-                  {}
-                 else
-                  continue;
-                else
-                 continue;
-               else
-                continue;
-             else
-              if(p[pixel[12]] > cb)
-               if(p[pixel[7]] > cb)
-                if(p[pixel[8]] > cb)
-                 if(p[pixel[9]] > cb)
-                  if(p[pixel[10]] > cb)
-                   if(p[pixel[11]] > cb)
-                    if(p[pixel[13]] > cb)
-                     if(p[pixel[14]] > cb)
-                      if(p[pixel[6]] > cb)
-                       {}
-                      else
-                       if(p[pixel[15]] > cb)
-                        {}
+                else if(p[pixel[4]] < c_b)
+                 if(p[pixel[5]] > cb)
+                  if(p[pixel[14]] > cb)
+                   if(p[pixel[7]] > cb)
+                    if(p[pixel[8]] > cb)
+                     if(p[pixel[9]] > cb)
+                      if(p[pixel[10]] > cb)
+                       if(p[pixel[11]] > cb)
+                        if(p[pixel[12]] > cb)
+                         if(p[pixel[13]] > cb)
+                          if(p[pixel[6]] > cb)
+                           {}
+                          else
+                           if(p[pixel[15]] > cb)
+                            {}
+                           else
+                            continue;
+                         else
+                          continue;
+                        else
+                         continue;
                        else
                         continue;
+                      else
+                       continue;
                      else
                       continue;
                     else
                      continue;
                    else
                     continue;
-                  else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-               else
-                continue;
-              else if(p[pixel[12]] < c_b)
-               if(p[pixel[13]] < c_b)
-                if(p[pixel[14]] < c_b)
-                 if(p[pixel[15]] < c_b)
-                  {}
-                 else
-                  if(p[pixel[6]] < c_b)
-                   if(p[pixel[7]] < c_b)
-                    if(p[pixel[8]] < c_b)
-                     if(p[pixel[9]] < c_b)
-                      if(p[pixel[10]] < c_b)
-                       if(p[pixel[11]] < c_b)
-                        {}
+                  else if(p[pixel[14]] < c_b)
+                   if(p[pixel[12]] > cb)
+                    if(p[pixel[6]] > cb)
+                     if(p[pixel[7]] > cb)
+                      if(p[pixel[8]] > cb)
+                       if(p[pixel[9]] > cb)
+                        if(p[pixel[10]] > cb)
+                         if(p[pixel[11]] > cb)
+                          if(p[pixel[13]] > cb)
+                           {}
+                          else
+                           continue;
+                         else
+                          continue;
+                        else
+                         continue;
                        else
                         continue;
                       else
@@ -5345,280 +5121,259 @@ static corner_t *fast9_detect(image_t *image, rectangle_t *roi, int *n_corners,
                       continue;
                     else
                      continue;
-                   else
-                    continue;
-                  else
-                   continue;
-                else
-                 continue;
-               else
-                continue;
-              else
-               continue;
-            else
-             if(p[pixel[11]] > cb)
-              if(p[pixel[7]] > cb)
-               if(p[pixel[8]] > cb)
-                if(p[pixel[9]] > cb)
-                 if(p[pixel[10]] > cb)
-                  if(p[pixel[12]] > cb)
-                   if(p[pixel[13]] > cb)
-                    if(p[pixel[6]] > cb)
-                     if(p[pixel[5]] > cb)
+                   else if(p[pixel[12]] < c_b)
+                    if(p[pixel[13]] < c_b)
+                     if(p[pixel[15]] < c_b)
                       {}
                      else
-                      if(p[pixel[14]] > cb)
-                       {}
-                      else
-                       continue;
-                    else
-                     if(p[pixel[14]] > cb)
-                      if(p[pixel[15]] > cb)
-                       {}
-                      else
-                       continue;
-                     else
-                      continue;
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-               else
-                continue;
-              else
-               continue;
-             else if(p[pixel[11]] < c_b)
-              if(p[pixel[12]] < c_b)
-               if(p[pixel[13]] < c_b)
-                if(p[pixel[14]] < c_b)
-                 if(p[pixel[15]] < c_b)
-                  {}
-                 else
-                  if(p[pixel[6]] < c_b)
-                   if(p[pixel[7]] < c_b)
-                    if(p[pixel[8]] < c_b)
-                     if(p[pixel[9]] < c_b)
-                      if(p[pixel[10]] < c_b)
-                       {}
+                      if(p[pixel[6]] < c_b)
+                       if(p[pixel[7]] < c_b)
+                        if(p[pixel[8]] < c_b)
+                         if(p[pixel[9]] < c_b)
+                          if(p[pixel[10]] < c_b)
+                           if(p[pixel[11]] < c_b)
+                            {}
+                           else
+                            continue;
+                          else
+                           continue;
+                         else
+                          continue;
+                        else
+                         continue;
+                       else
+                        continue;
                       else
                        continue;
-                     else
-                      continue;
                     else
                      continue;
                    else
                     continue;
                   else
-                   continue;
-                else
-                 if(p[pixel[5]] < c_b)
-                  if(p[pixel[6]] < c_b)
-                   if(p[pixel[7]] < c_b)
-                    if(p[pixel[8]] < c_b)
-                     if(p[pixel[9]] < c_b)
-                      if(p[pixel[10]] < c_b)
-                       {}
+                   if(p[pixel[6]] > cb)
+                    if(p[pixel[7]] > cb)
+                     if(p[pixel[8]] > cb)
+                      if(p[pixel[9]] > cb)
+                       if(p[pixel[10]] > cb)
+                        if(p[pixel[11]] > cb)
+                         if(p[pixel[12]] > cb)
+                          if(p[pixel[13]] > cb)
+                           {}
+                          else
+                           continue;
+                         else
+                          continue;
+                        else
+                         continue;
+                       else
+                        continue;
                       else
                        continue;
                      else
                       continue;
                     else
-                     continue;
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-               else
-                continue;
-              else
-               continue;
-             else
-              continue;
-           else
-            if(p[pixel[10]] > cb)
-             if(p[pixel[7]] > cb)
-              if(p[pixel[8]] > cb)
-               if(p[pixel[9]] > cb)
-                if(p[pixel[11]] > cb)
-                 if(p[pixel[12]] > cb)
-                  if(p[pixel[6]] > cb)
-                   if(p[pixel[5]] > cb)
-                    if(p[pixel[4]] > cb)
-                     {}
-                    else
-                     if(p[pixel[13]] > cb)
-                      {}
-                     else
-                      continue;
+                     continue;
                    else
+                    continue;
+                 else if(p[pixel[5]] < c_b)
+                  if(p[pixel[6]] > cb)
+                   if(p[pixel[15]] < c_b)
                     if(p[pixel[13]] > cb)
-                     if(p[pixel[14]] > cb)
+                     if(p[pixel[7]] > cb)
+                      if(p[pixel[8]] > cb)
+                       if(p[pixel[9]] > cb)
+                        if(p[pixel[10]] > cb)
+                         if(p[pixel[11]] > cb)
+                          if(p[pixel[12]] > cb)
+                           if(p[pixel[14]] > cb)
+                            {}
+                           else
+                            continue;
+                          else
+                           continue;
+                         else
+                          continue;
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
+                    else if(p[pixel[13]] < c_b)
+                     if(p[pixel[14]] < c_b)
                       {}
                      else
                       continue;
                     else
                      continue;
-                  else
-                   if(p[pixel[13]] > cb)
-                    if(p[pixel[14]] > cb)
-                     if(p[pixel[15]] > cb)
-                      {}
+                   else
+                    if(p[pixel[7]] > cb)
+                     if(p[pixel[8]] > cb)
+                      if(p[pixel[9]] > cb)
+                       if(p[pixel[10]] > cb)
+                        if(p[pixel[11]] > cb)
+                         if(p[pixel[12]] > cb)
+                          if(p[pixel[13]] > cb)
+                           if(p[pixel[14]] > cb)
+                            {}
+                           else
+                            continue;
+                          else
+                           continue;
+                         else
+                          continue;
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
                      else
                       continue;
                     else
                      continue;
-                   else
-                    continue;
-                 else
-                  continue;
-                else
-                 continue;
-               else
-                continue;
-              else
-               continue;
-             else
-              continue;
-            else if(p[pixel[10]] < c_b)
-             if(p[pixel[11]] < c_b)
-              if(p[pixel[12]] < c_b)
-               if(p[pixel[13]] < c_b)
-                if(p[pixel[14]] < c_b)
-                 if(p[pixel[15]] < c_b)
-                  {}
-                 else
-                  if(p[pixel[6]] < c_b)
-                   if(p[pixel[7]] < c_b)
-                    if(p[pixel[8]] < c_b)
-                     if(p[pixel[9]] < c_b)
+                  else if(p[pixel[6]] < c_b)
+                   if(p[pixel[7]] > cb)
+                    if(p[pixel[14]] > cb)
+                     if(p[pixel[8]] > cb)
+                      if(p[pixel[9]] > cb)
+                       if(p[pixel[10]] > cb)
+                        if(p[pixel[11]] > cb)
+                         if(p[pixel[12]] > cb)
+                          if(p[pixel[13]] > cb)
+                           if(p[pixel[15]] > cb)
+                            {}
+                           else
+                            continue;
+                          else
+                           continue;
+                         else
+                          continue;
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
+                    else if(p[pixel[14]] < c_b)
+                     if(p[pixel[15]] < c_b)
                       {}
                      else
                       continue;
                     else
                      continue;
-                   else
-                    continue;
-                  else
-                   continue;
-                else
-                 if(p[pixel[5]] < c_b)
-                  if(p[pixel[6]] < c_b)
-                   if(p[pixel[7]] < c_b)
+                   else if(p[pixel[7]] < c_b)
                     if(p[pixel[8]] < c_b)
-                     if(p[pixel[9]] < c_b)
+                     {}
+                    else
+                     if(p[pixel[15]] < c_b)
                       {}
                      else
                       continue;
-                    else
-                     continue;
                    else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-               else
-                if(p[pixel[4]] < c_b)
-                 if(p[pixel[5]] < c_b)
-                  if(p[pixel[6]] < c_b)
-                   if(p[pixel[7]] < c_b)
-                    if(p[pixel[8]] < c_b)
-                     if(p[pixel[9]] < c_b)
+                    if(p[pixel[14]] < c_b)
+                     if(p[pixel[15]] < c_b)
                       {}
                      else
                       continue;
                     else
                      continue;
-                   else
-                    continue;
                   else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-              else
-               continue;
-             else
-              continue;
-            else
-             continue;
-          else
-           if(p[pixel[9]] > cb)
-            if(p[pixel[7]] > cb)
-             if(p[pixel[8]] > cb)
-              if(p[pixel[10]] > cb)
-               if(p[pixel[11]] > cb)
-                if(p[pixel[6]] > cb)
-                 if(p[pixel[5]] > cb)
-                  if(p[pixel[4]] > cb)
-                   if(p[pixel[3]] > cb)
-                    {}
-                   else
-                    if(p[pixel[12]] > cb)
-                     {}
+                   if(p[pixel[13]] > cb)
+                    if(p[pixel[7]] > cb)
+                     if(p[pixel[8]] > cb)
+                      if(p[pixel[9]] > cb)
+                       if(p[pixel[10]] > cb)
+                        if(p[pixel[11]] > cb)
+                         if(p[pixel[12]] > cb)
+                          if(p[pixel[14]] > cb)
+                           if(p[pixel[15]] > cb)
+                            {}
+                           else
+                            continue;
+                          else
+                           continue;
+                         else
+                          continue;
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
                     else
                      continue;
-                  else
-                   if(p[pixel[12]] > cb)
-                    if(p[pixel[13]] > cb)
-                     {}
+                   else if(p[pixel[13]] < c_b)
+                    if(p[pixel[14]] < c_b)
+                     if(p[pixel[15]] < c_b)
+                      {}
+                     else
+                      continue;
                     else
                      continue;
                    else
                     continue;
                  else
                   if(p[pixel[12]] > cb)
-                   if(p[pixel[13]] > cb)
-                    if(p[pixel[14]] > cb)
-                     {}
-                    else
-                     continue;
-                   else
-                    continue;
-                  else
-                   continue;
-                else
-                 if(p[pixel[12]] > cb)
-                  if(p[pixel[13]] > cb)
-                   if(p[pixel[14]] > cb)
-                    if(p[pixel[15]] > cb)
-                     {}
+                   if(p[pixel[7]] > cb)
+                    if(p[pixel[8]] > cb)
+                     if(p[pixel[9]] > cb)
+                      if(p[pixel[10]] > cb)
+                       if(p[pixel[11]] > cb)
+                        if(p[pixel[13]] > cb)
+                         if(p[pixel[14]] > cb)
+                          if(p[pixel[6]] > cb)
+                           {}
+                          else
+                           if(p[pixel[15]] > cb)
+                            {}
+                           else
+                            continue;
+                         else
+                          continue;
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
                     else
                      continue;
                    else
                     continue;
-                  else
-                   continue;
-                 else
-                  continue;
-               else
-                continue;
-              else
-               continue;
-             else
-              continue;
-            else
-             continue;
-           else if(p[pixel[9]] < c_b)
-            if(p[pixel[10]] < c_b)
-             if(p[pixel[11]] < c_b)
-              if(p[pixel[12]] < c_b)
-               if(p[pixel[13]] < c_b)
-                if(p[pixel[14]] < c_b)
-                 if(p[pixel[15]] < c_b)
-                  {}
-                 else
-                  if(p[pixel[6]] < c_b)
-                   if(p[pixel[7]] < c_b)
-                    if(p[pixel[8]] < c_b)
-                     {}
+                  else if(p[pixel[12]] < c_b)
+                   if(p[pixel[13]] < c_b)
+                    if(p[pixel[14]] < c_b)
+                     if(p[pixel[15]] < c_b)
+                      {}
+                     else
+                      if(p[pixel[6]] < c_b)
+                       if(p[pixel[7]] < c_b)
+                        if(p[pixel[8]] < c_b)
+                         if(p[pixel[9]] < c_b)
+                          if(p[pixel[10]] < c_b)
+                           if(p[pixel[11]] < c_b)
+                            {}
+                           else
+                            continue;
+                          else
+                           continue;
+                         else
+                          continue;
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
                     else
                      continue;
                    else
@@ -5626,105 +5381,193 @@ static corner_t *fast9_detect(image_t *image, rectangle_t *roi, int *n_corners,
                   else
                    continue;
                 else
-                 if(p[pixel[5]] < c_b)
-                  if(p[pixel[6]] < c_b)
-                   if(p[pixel[7]] < c_b)
-                    if(p[pixel[8]] < c_b)
-                     {}
-                    else
-                     continue;
-                   else
-                    continue;
-                  else
-                   continue;
-                 else
-                  continue;
-               else
-                if(p[pixel[4]] < c_b)
-                 if(p[pixel[5]] < c_b)
-                  if(p[pixel[6]] < c_b)
-                   if(p[pixel[7]] < c_b)
-                    if(p[pixel[8]] < c_b)
-                     {}
+                 if(p[pixel[11]] > cb)
+                  if(p[pixel[7]] > cb)
+                   if(p[pixel[8]] > cb)
+                    if(p[pixel[9]] > cb)
+                     if(p[pixel[10]] > cb)
+                      if(p[pixel[12]] > cb)
+                       if(p[pixel[13]] > cb)
+                        if(p[pixel[6]] > cb)
+                         if(p[pixel[5]] > cb)
+                          {}
+                         else
+                          if(p[pixel[14]] > cb)
+                           {}
+                          else
+                           continue;
+                        else
+                         if(p[pixel[14]] > cb)
+                          if(p[pixel[15]] > cb)
+                           {}
+                          else
+                           continue;
+                         else
+                          continue;
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
                     else
                      continue;
                    else
                     continue;
                   else
                    continue;
-                 else
-                  continue;
-                else
-                 continue;
-              else
-               if(p[pixel[3]] < c_b)
-                if(p[pixel[4]] < c_b)
-                 if(p[pixel[5]] < c_b)
-                  if(p[pixel[6]] < c_b)
-                   if(p[pixel[7]] < c_b)
-                    if(p[pixel[8]] < c_b)
-                     {}
+                 else if(p[pixel[11]] < c_b)
+                  if(p[pixel[12]] < c_b)
+                   if(p[pixel[13]] < c_b)
+                    if(p[pixel[14]] < c_b)
+                     if(p[pixel[15]] < c_b)
+                      {}
+                     else
+                      if(p[pixel[6]] < c_b)
+                       if(p[pixel[7]] < c_b)
+                        if(p[pixel[8]] < c_b)
+                         if(p[pixel[9]] < c_b)
+                          if(p[pixel[10]] < c_b)
+                           {}
+                          else
+                           continue;
+                         else
+                          continue;
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
                     else
-                     continue;
+                     if(p[pixel[5]] < c_b)
+                      if(p[pixel[6]] < c_b)
+                       if(p[pixel[7]] < c_b)
+                        if(p[pixel[8]] < c_b)
+                         if(p[pixel[9]] < c_b)
+                          if(p[pixel[10]] < c_b)
+                           {}
+                          else
+                           continue;
+                         else
+                          continue;
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
                    else
                     continue;
                   else
                    continue;
                  else
                   continue;
-                else
-                 continue;
                else
-                continue;
-             else
-              continue;
-            else
-             continue;
-           else
-            continue;
-         else
-          if(p[pixel[8]] > cb)
-           if(p[pixel[7]] > cb)
-            if(p[pixel[9]] > cb)
-             if(p[pixel[10]] > cb)
-              if(p[pixel[6]] > cb)
-               if(p[pixel[5]] > cb)
-                if(p[pixel[4]] > cb)
-                 if(p[pixel[3]] > cb)
-                  if(p[pixel[2]] > cb)
-                   {}
-                  else
-                   if(p[pixel[11]] > cb)
-                    {}
-                   else
-                    continue;
-                 else
-                  if(p[pixel[11]] > cb)
-                   if(p[pixel[12]] > cb)
-                    {}
-                   else
-                    continue;
-                  else
-                   continue;
-                else
-                 if(p[pixel[11]] > cb)
-                  if(p[pixel[12]] > cb)
-                   if(p[pixel[13]] > cb)
-                    {}
+                if(p[pixel[10]] > cb)
+                 if(p[pixel[7]] > cb)
+                  if(p[pixel[8]] > cb)
+                   if(p[pixel[9]] > cb)
+                    if(p[pixel[11]] > cb)
+                     if(p[pixel[12]] > cb)
+                      if(p[pixel[6]] > cb)
+                       if(p[pixel[5]] > cb)
+                        if(p[pixel[4]] > cb)
+                         {}
+                        else
+                         if(p[pixel[13]] > cb)
+                          {}
+                         else
+                          continue;
+                       else
+                        if(p[pixel[13]] > cb)
+                         if(p[pixel[14]] > cb)
+                          {}
+                         else
+                          continue;
+                        else
+                         continue;
+                      else
+                       if(p[pixel[13]] > cb)
+                        if(p[pixel[14]] > cb)
+                         if(p[pixel[15]] > cb)
+                          {}
+                         else
+                          continue;
+                        else
+                         continue;
+                       else
+                        continue;
+                     else
+                      continue;
+                    else
+                     continue;
                    else
                     continue;
                   else
                    continue;
                  else
                   continue;
-               else
-                if(p[pixel[11]] > cb)
-                 if(p[pixel[12]] > cb)
-                  if(p[pixel[13]] > cb)
-                   if(p[pixel[14]] > cb)
-                    {}
+                else if(p[pixel[10]] < c_b)
+                 if(p[pixel[11]] < c_b)
+                  if(p[pixel[12]] < c_b)
+                   if(p[pixel[13]] < c_b)
+                    if(p[pixel[14]] < c_b)
+                     if(p[pixel[15]] < c_b)
+                      {}
+                     else
+                      if(p[pixel[6]] < c_b)
+                       if(p[pixel[7]] < c_b)
+                        if(p[pixel[8]] < c_b)
+                         if(p[pixel[9]] < c_b)
+                          {}
+                         else
+                          continue;
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
+                    else
+                     if(p[pixel[5]] < c_b)
+                      if(p[pixel[6]] < c_b)
+                       if(p[pixel[7]] < c_b)
+                        if(p[pixel[8]] < c_b)
+                         if(p[pixel[9]] < c_b)
+                          {}
+                         else
+                          continue;
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
                    else
-                    continue;
+                    if(p[pixel[4]] < c_b)
+                     if(p[pixel[5]] < c_b)
+                      if(p[pixel[6]] < c_b)
+                       if(p[pixel[7]] < c_b)
+                        if(p[pixel[8]] < c_b)
+                         if(p[pixel[9]] < c_b)
+                          {}
+                         else
+                          continue;
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
+                    else
+                     continue;
                   else
                    continue;
                  else
@@ -5732,12 +5575,54 @@ static corner_t *fast9_detect(image_t *image, rectangle_t *roi, int *n_corners,
                 else
                  continue;
               else
-               if(p[pixel[11]] > cb)
-                if(p[pixel[12]] > cb)
-                 if(p[pixel[13]] > cb)
-                  if(p[pixel[14]] > cb)
-                   if(p[pixel[15]] > cb)
-                    {}
+               if(p[pixel[9]] > cb)
+                if(p[pixel[7]] > cb)
+                 if(p[pixel[8]] > cb)
+                  if(p[pixel[10]] > cb)
+                   if(p[pixel[11]] > cb)
+                    if(p[pixel[6]] > cb)
+                     if(p[pixel[5]] > cb)
+                      if(p[pixel[4]] > cb)
+                       if(p[pixel[3]] > cb)
+                        {}
+                       else
+                        if(p[pixel[12]] > cb)
+                         {}
+                        else
+                         continue;
+                      else
+                       if(p[pixel[12]] > cb)
+                        if(p[pixel[13]] > cb)
+                         {}
+                        else
+                         continue;
+                       else
+                        continue;
+                     else
+                      if(p[pixel[12]] > cb)
+                       if(p[pixel[13]] > cb)
+                        if(p[pixel[14]] > cb)
+                         {}
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
+                    else
+                     if(p[pixel[12]] > cb)
+                      if(p[pixel[13]] > cb)
+                       if(p[pixel[14]] > cb)
+                        if(p[pixel[15]] > cb)
+                         {}
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
                    else
                     continue;
                   else
@@ -5746,87 +5631,233 @@ static corner_t *fast9_detect(image_t *image, rectangle_t *roi, int *n_corners,
                   continue;
                 else
                  continue;
-               else
-                continue;
-             else
-              continue;
-            else
-             continue;
-           else
-            continue;
-          else if(p[pixel[8]] < c_b)
-           if(p[pixel[9]] < c_b)
-            if(p[pixel[10]] < c_b)
-             if(p[pixel[11]] < c_b)
-              if(p[pixel[12]] < c_b)
-               if(p[pixel[13]] < c_b)
-                if(p[pixel[14]] < c_b)
-                 if(p[pixel[15]] < c_b)
-                  {}
-                 else
-                  if(p[pixel[6]] < c_b)
-                   if(p[pixel[7]] < c_b)
-                    {}
+               else if(p[pixel[9]] < c_b)
+                if(p[pixel[10]] < c_b)
+                 if(p[pixel[11]] < c_b)
+                  if(p[pixel[12]] < c_b)
+                   if(p[pixel[13]] < c_b)
+                    if(p[pixel[14]] < c_b)
+                     if(p[pixel[15]] < c_b)
+                      {}
+                     else
+                      if(p[pixel[6]] < c_b)
+                       if(p[pixel[7]] < c_b)
+                        if(p[pixel[8]] < c_b)
+                         {}
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
+                    else
+                     if(p[pixel[5]] < c_b)
+                      if(p[pixel[6]] < c_b)
+                       if(p[pixel[7]] < c_b)
+                        if(p[pixel[8]] < c_b)
+                         {}
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
                    else
-                    continue;
+                    if(p[pixel[4]] < c_b)
+                     if(p[pixel[5]] < c_b)
+                      if(p[pixel[6]] < c_b)
+                       if(p[pixel[7]] < c_b)
+                        if(p[pixel[8]] < c_b)
+                         {}
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
+                    else
+                     continue;
                   else
-                   continue;
-                else
-                 if(p[pixel[5]] < c_b)
-                  if(p[pixel[6]] < c_b)
-                   if(p[pixel[7]] < c_b)
-                    {}
+                   if(p[pixel[3]] < c_b)
+                    if(p[pixel[4]] < c_b)
+                     if(p[pixel[5]] < c_b)
+                      if(p[pixel[6]] < c_b)
+                       if(p[pixel[7]] < c_b)
+                        if(p[pixel[8]] < c_b)
+                         {}
+                        else
+                         continue;
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
+                    else
+                     continue;
                    else
                     continue;
-                  else
-                   continue;
                  else
                   continue;
+                else
+                 continue;
                else
-                if(p[pixel[4]] < c_b)
-                 if(p[pixel[5]] < c_b)
-                  if(p[pixel[6]] < c_b)
-                   if(p[pixel[7]] < c_b)
-                    {}
+                continue;
+             else
+              if(p[pixel[8]] > cb)
+               if(p[pixel[7]] > cb)
+                if(p[pixel[9]] > cb)
+                 if(p[pixel[10]] > cb)
+                  if(p[pixel[6]] > cb)
+                   if(p[pixel[5]] > cb)
+                    if(p[pixel[4]] > cb)
+                     if(p[pixel[3]] > cb)
+                      if(p[pixel[2]] > cb)
+                       {}
+                      else
+                       if(p[pixel[11]] > cb)
+                        {}
+                       else
+                        continue;
+                     else
+                      if(p[pixel[11]] > cb)
+                       if(p[pixel[12]] > cb)
+                        {}
+                       else
+                        continue;
+                      else
+                       continue;
+                    else
+                     if(p[pixel[11]] > cb)
+                      if(p[pixel[12]] > cb)
+                       if(p[pixel[13]] > cb)
+                        {}
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
                    else
-                    continue;
+                    if(p[pixel[11]] > cb)
+                     if(p[pixel[12]] > cb)
+                      if(p[pixel[13]] > cb)
+                       if(p[pixel[14]] > cb)
+                        {}
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
+                    else
+                     continue;
                   else
-                   continue;
+                   if(p[pixel[11]] > cb)
+                    if(p[pixel[12]] > cb)
+                     if(p[pixel[13]] > cb)
+                      if(p[pixel[14]] > cb)
+                       if(p[pixel[15]] > cb)
+                        {}
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
+                    else
+                     continue;
+                   else
+                    continue;
                  else
                   continue;
                 else
                  continue;
-              else
-               if(p[pixel[3]] < c_b)
-                if(p[pixel[4]] < c_b)
-                 if(p[pixel[5]] < c_b)
-                  if(p[pixel[6]] < c_b)
-                   if(p[pixel[7]] < c_b)
-                    {}
+               else
+                continue;
+              else if(p[pixel[8]] < c_b)
+               if(p[pixel[9]] < c_b)
+                if(p[pixel[10]] < c_b)
+                 if(p[pixel[11]] < c_b)
+                  if(p[pixel[12]] < c_b)
+                   if(p[pixel[13]] < c_b)
+                    if(p[pixel[14]] < c_b)
+                     if(p[pixel[15]] < c_b)
+                      {}
+                     else
+                      if(p[pixel[6]] < c_b)
+                       if(p[pixel[7]] < c_b)
+                        {}
+                       else
+                        continue;
+                      else
+                       continue;
+                    else
+                     if(p[pixel[5]] < c_b)
+                      if(p[pixel[6]] < c_b)
+                       if(p[pixel[7]] < c_b)
+                        {}
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
                    else
-                    continue;
+                    if(p[pixel[4]] < c_b)
+                     if(p[pixel[5]] < c_b)
+                      if(p[pixel[6]] < c_b)
+                       if(p[pixel[7]] < c_b)
+                        {}
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
+                    else
+                     continue;
                   else
-                   continue;
+                   if(p[pixel[3]] < c_b)
+                    if(p[pixel[4]] < c_b)
+                     if(p[pixel[5]] < c_b)
+                      if(p[pixel[6]] < c_b)
+                       if(p[pixel[7]] < c_b)
+                        {}
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
+                    else
+                     continue;
+                   else
+                    continue;
                  else
-                  continue;
-                else
-                 continue;
-               else
-                continue;
-             else
-              if(p[pixel[2]] < c_b)
-               if(p[pixel[3]] < c_b)
-                if(p[pixel[4]] < c_b)
-                 if(p[pixel[5]] < c_b)
-                  if(p[pixel[6]] < c_b)
-                   if(p[pixel[7]] < c_b)
-                    {}
+                  if(p[pixel[2]] < c_b)
+                   if(p[pixel[3]] < c_b)
+                    if(p[pixel[4]] < c_b)
+                     if(p[pixel[5]] < c_b)
+                      if(p[pixel[6]] < c_b)
+                       if(p[pixel[7]] < c_b)
+                        {}
+                       else
+                        continue;
+                      else
+                       continue;
+                     else
+                      continue;
+                    else
+                     continue;
                    else
                     continue;
                   else
                    continue;
-                 else
-                  continue;
                 else
                  continue;
                else
@@ -5834,204 +5865,204 @@ static corner_t *fast9_detect(image_t *image, rectangle_t *roi, int *n_corners,
               else
                continue;
             else
-             continue;
-           else
-            continue;
-          else
-           continue;
-        else
-         if(p[pixel[7]] > cb)
-          if(p[pixel[8]] > cb)
-           if(p[pixel[9]] > cb)
-            if(p[pixel[6]] > cb)
-             if(p[pixel[5]] > cb)
-              if(p[pixel[4]] > cb)
-               if(p[pixel[3]] > cb)
-                if(p[pixel[2]] > cb)
-                 if(p[pixel[1]] > cb)
-                  {}
+             if(p[pixel[7]] > cb)
+              if(p[pixel[8]] > cb)
+               if(p[pixel[9]] > cb)
+                if(p[pixel[6]] > cb)
+                 if(p[pixel[5]] > cb)
+                  if(p[pixel[4]] > cb)
+                   if(p[pixel[3]] > cb)
+                    if(p[pixel[2]] > cb)
+                     if(p[pixel[1]] > cb)
+                      {}
+                     else
+                      if(p[pixel[10]] > cb)
+                       {}
+                      else
+                       continue;
+                    else
+                     if(p[pixel[10]] > cb)
+                      if(p[pixel[11]] > cb)
+                       {}
+                      else
+                       continue;
+                     else
+                      continue;
+                   else
+                    if(p[pixel[10]] > cb)
+                     if(p[pixel[11]] > cb)
+                      if(p[pixel[12]] > cb)
+                       {}
+                      else
+                       continue;
+                     else
+                      continue;
+                    else
+                     continue;
+                  else
+                   if(p[pixel[10]] > cb)
+                    if(p[pixel[11]] > cb)
+                     if(p[pixel[12]] > cb)
+                      if(p[pixel[13]] > cb)
+                       {}
+                      else
+                       continue;
+                     else
+                      continue;
+                    else
+                     continue;
+                   else
+                    continue;
                  else
                   if(p[pixel[10]] > cb)
-                   {}
+                   if(p[pixel[11]] > cb)
+                    if(p[pixel[12]] > cb)
+                     if(p[pixel[13]] > cb)
+                      if(p[pixel[14]] > cb)
+                       {}
+                      else
+                       continue;
+                     else
+                      continue;
+                    else
+                     continue;
+                   else
+                    continue;
                   else
                    continue;
                 else
                  if(p[pixel[10]] > cb)
                   if(p[pixel[11]] > cb)
-                   {}
-                  else
-                   continue;
-                 else
-                  continue;
-               else
-                if(p[pixel[10]] > cb)
-                 if(p[pixel[11]] > cb)
-                  if(p[pixel[12]] > cb)
-                   {}
-                  else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-              else
-               if(p[pixel[10]] > cb)
-                if(p[pixel[11]] > cb)
-                 if(p[pixel[12]] > cb)
-                  if(p[pixel[13]] > cb)
-                   {}
-                  else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-               else
-                continue;
-             else
-              if(p[pixel[10]] > cb)
-               if(p[pixel[11]] > cb)
-                if(p[pixel[12]] > cb)
-                 if(p[pixel[13]] > cb)
-                  if(p[pixel[14]] > cb)
-                   {}
+                   if(p[pixel[12]] > cb)
+                    if(p[pixel[13]] > cb)
+                     if(p[pixel[14]] > cb)
+                      if(p[pixel[15]] > cb)
+                       {}
+                      else
+                       continue;
+                     else
+                      continue;
+                    else
+                     continue;
+                   else
+                    continue;
                   else
                    continue;
                  else
                   continue;
-                else
-                 continue;
                else
                 continue;
               else
                continue;
-            else
-             if(p[pixel[10]] > cb)
-              if(p[pixel[11]] > cb)
-               if(p[pixel[12]] > cb)
-                if(p[pixel[13]] > cb)
-                 if(p[pixel[14]] > cb)
-                  if(p[pixel[15]] > cb)
-                   {}
+             else if(p[pixel[7]] < c_b)
+              if(p[pixel[8]] < c_b)
+               if(p[pixel[9]] < c_b)
+                if(p[pixel[6]] < c_b)
+                 if(p[pixel[5]] < c_b)
+                  if(p[pixel[4]] < c_b)
+                   if(p[pixel[3]] < c_b)
+                    if(p[pixel[2]] < c_b)
+                     if(p[pixel[1]] < c_b)
+                      {}
+                     else
+                      if(p[pixel[10]] < c_b)
+                       {}
+                      else
+                       continue;
+                    else
+                     if(p[pixel[10]] < c_b)
+                      if(p[pixel[11]] < c_b)
+                       {}
+                      else
+                       continue;
+                     else
+                      continue;
+                   else
+                    if(p[pixel[10]] < c_b)
+                     if(p[pixel[11]] < c_b)
+                      if(p[pixel[12]] < c_b)
+                       {}
+                      else
+                       continue;
+                     else
+                      continue;
+                    else
+                     continue;
                   else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-               else
-                continue;
-              else
-               continue;
-             else
-              continue;
-           else
-            continue;
-          else
-           continue;
-         else if(p[pixel[7]] < c_b)
-          if(p[pixel[8]] < c_b)
-           if(p[pixel[9]] < c_b)
-            if(p[pixel[6]] < c_b)
-             if(p[pixel[5]] < c_b)
-              if(p[pixel[4]] < c_b)
-               if(p[pixel[3]] < c_b)
-                if(p[pixel[2]] < c_b)
-                 if(p[pixel[1]] < c_b)
-                  {}
+                   if(p[pixel[10]] < c_b)
+                    if(p[pixel[11]] < c_b)
+                     if(p[pixel[12]] < c_b)
+                      if(p[pixel[13]] < c_b)
+                       {}
+                      else
+                       continue;
+                     else
+                      continue;
+                    else
+                     continue;
+                   else
+                    continue;
                  else
                   if(p[pixel[10]] < c_b)
-                   {}
+                   if(p[pixel[11]] < c_b)
+                    if(p[pixel[12]] < c_b)
+                     if(p[pixel[13]] < c_b)
+                      if(p[pixel[14]] < c_b)
+                       {}
+                      else
+                       continue;
+                     else
+                      continue;
+                    else
+                     continue;
+                   else
+                    continue;
                   else
                    continue;
                 else
                  if(p[pixel[10]] < c_b)
                   if(p[pixel[11]] < c_b)
-                   {}
-                  else
-                   continue;
-                 else
-                  continue;
-               else
-                if(p[pixel[10]] < c_b)
-                 if(p[pixel[11]] < c_b)
-                  if(p[pixel[12]] < c_b)
-                   {}
-                  else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-              else
-               if(p[pixel[10]] < c_b)
-                if(p[pixel[11]] < c_b)
-                 if(p[pixel[12]] < c_b)
-                  if(p[pixel[13]] < c_b)
-                   {}
-                  else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-               else
-                continue;
-             else
-              if(p[pixel[10]] < c_b)
-               if(p[pixel[11]] < c_b)
-                if(p[pixel[12]] < c_b)
-                 if(p[pixel[13]] < c_b)
-                  if(p[pixel[14]] < c_b)
-                   {}
-                  else
-                   continue;
-                 else
-                  continue;
-                else
-                 continue;
-               else
-                continue;
-              else
-               continue;
-            else
-             if(p[pixel[10]] < c_b)
-              if(p[pixel[11]] < c_b)
-               if(p[pixel[12]] < c_b)
-                if(p[pixel[13]] < c_b)
-                 if(p[pixel[14]] < c_b)
-                  if(p[pixel[15]] < c_b)
-                   {}
+                   if(p[pixel[12]] < c_b)
+                    if(p[pixel[13]] < c_b)
+                     if(p[pixel[14]] < c_b)
+                      if(p[pixel[15]] < c_b)
+                       {}
+                      else
+                       continue;
+                     else
+                      continue;
+                    else
+                     continue;
+                   else
+                    continue;
                   else
                    continue;
                  else
                   continue;
-                else
-                 continue;
                else
                 continue;
               else
                continue;
              else
               continue;
-           else
-            continue;
-          else
-           continue;
-         else
-          continue;
 
             // Add corner
-			corners[num_corners].x = x;
-			corners[num_corners].y = y;
+            s[x] = fast9_corner_score(p, b);
+        }
+
+        // Suppress the previous row
+        if (y > y0) {
+            nonmax_suppression(RING_ROW(y-y0+1), RING_ROW(y-y0+2), s, x0, x1, y-1, grid, corners);
+        }
+    }
 
-			if (++num_corners == MAX_CORNERS) {
-                goto done;
-			}
-		}
+    // Suppress the last row, the row below it is cleared.
+    if (y1 > y0) {
+        memset(RING_ROW(y1-y0) + x0 - 1, 0, stride);
+        nonmax_suppression(RING_ROW(y1-y0+1), RING_ROW(y1-y0+2), RING_ROW(y1-y0), x0, x1, y1-1, grid, corners);
+        grid_flush_band(grid, corners);
     }
 
-done:
-    *n_corners = num_corners;
-    return corners;
+    #undef RING_ROW
+    fb_free(); // ring
 }
@@ -35,6 +35,7 @@
 #include "fmath.h"
 #include "arm_math.h"
 #include "ff.h"
+#include "ff_wrapper.h"
 #include "imlib.h"
 #include "xalloc.h"
 
@@ -63,45 +64,19 @@
 #define kSMALLEST_KP_SIZE   (7)
 #define kNB_ORIENPAIRS      (45)
 #define NUM_OCTAVES         (4)
-#define BIG_R               (2.0f/3.0f)                 // bigger radius
-#define SMALL_R             (2.0f/24.0f)                // smaller radius
-#define UNIT_SPACE          ((BIG_R-SMALL_R)/21.0f)     // spaces between concentric circles (from center to outer: 1,2,3,4,5,6)
 
 #define SCALE_IDX           (0)
 #define KP_SIZE             (23)
 #define SCALE_STEP          (1.0330248790212284f)       // 2 ^ ( (nbOctaves-1) /nbScales)
 #define SCALE_FACTOR        (1.0f)                      // SCALE_STEP ^ SCALE_IDX
 #define PATTERN_SCALE       (22)
+#define DESCRIPTOR_MAGIC    (0x314B5246) // "FRK1"
 
-#define MAX_KP_DIST         (512)
-#define KPT_DESC_SIZE       (kNB_PAIRS/8)
-
-// number of points on each concentric circle (from outer to inner)
-const static int n[8] = {6,6,6,6,6,6,6,1};
-
-// radii of the concentric cirles (from outer to inner)
-const static float radius[8] = {
-        BIG_R,
-        BIG_R-6*UNIT_SPACE,
-        BIG_R-11*UNIT_SPACE,
-        BIG_R-15*UNIT_SPACE,
-        BIG_R-18*UNIT_SPACE,
-        BIG_R-20*UNIT_SPACE,
-        SMALL_R,
-        0.0f
-};
-
-// sigma of pattern points (each group of 6 points on a concentric cirle has the same sigma)
-const static float sigma[8] = {
-        (BIG_R/2.0f),
-        (BIG_R-6*UNIT_SPACE)/2.0f,
-        (BIG_R-11*UNIT_SPACE)/2.0f,
-        (BIG_R-15*UNIT_SPACE)/2.0f,
-        (BIG_R-18*UNIT_SPACE)/2.0f,
-        (BIG_R-20*UNIT_SPACE)/2.0f,
-        (SMALL_R)/2.0f,
-        (SMALL_R)/2.0f
-};
+// Sampling pattern at PATTERN_SCALE for each orientation, the top-left corners of the
+// averaging boxes relative to the keypoint, and the box sizes (see gen_freak_pattern.py).
+// The smallest box is 2x2 at this scale, so no point needs bilinear interpolation.
+extern const int8_t freak_pattern[kNB_ORIENTATION][kNB_POINTS][2];
+extern const uint8_t freak_box_size[kNB_POINTS];
 
 const static int ORIENTATION_PAIRS[45][4] = {
 	{0, 3, 140, 0},	        {1, 4, 70, 121},
@@ -198,59 +173,19 @@ const static uint8_t DESCRIPTION_PAIRS[512][2] = {
 
 
 // simply take average on a square patch, not even gaussian approx
-static uint8_t mean_intensity(image_t *image, mw_image_t *i_image, int kp_x, int kp_y, uint32_t rot, uint32_t point)
+static void mean_intensity(mw_image_t *i_image, int kp_x, int kp_y, int rot, uint8_t *values)
 {
-    int ret_val;
-    int pidx = (point/6)%8;
-    float alpha, beta, theta = 0;
+    const int8_t (*pattern)[2] = freak_pattern[rot];
+    // keypoint y in the moving window
+    int y = kp_y - (i_image->y_offs - i_image->h);
 
-    if (rot) {
-        theta = rot*PI_2/(float)kNB_ORIENTATION; // orientation of the pattern
-    }
-    beta = PI/n[pidx]*(pidx%2); // orientation offset so that groups of points on each circles are staggered
-    alpha = (float)(point%n[pidx])*PI_2/(float)n[pidx]+beta+theta;
-
-    float px = radius[pidx] * PATTERN_SCALE * arm_cos_f32(alpha);
-    float py = radius[pidx] * PATTERN_SCALE * arm_sin_f32(alpha);
-    float psigma = sigma[pidx] * PATTERN_SCALE;
-
-    // get point position in image
-    float xf = px+kp_x;
-    float yf = py+kp_y;
-
-    // calculate output:
-    if (psigma < 0.5f) {
-        int x = (int) xf;
-        int y = (int) yf;
-        int imagecols = image->w;
-
-        // interpolation multipliers:
-        int r_x = (xf-x)*1024;
-        int r_y = (yf-y)*1024;
-        int r_x_1 = (1024-r_x);
-        int r_y_1 = (1024-r_y);
-        uint8_t* ptr = image->data+(y*imagecols+x);
-
-        // linear interpolation:
-        ret_val = (r_x_1*r_y_1*(int)(*ptr++));
-        ret_val += (r_x*r_y_1*(int)(*ptr));
-        ptr += imagecols;
-        ret_val += (r_x*r_y*(int)(*ptr--));
-        ret_val += (r_x_1*r_y*(int)(*ptr));
-        ret_val = (ret_val+512)/1024;
-    } else {
-        int x = (int) (xf-psigma+0.5f);
-        int y = (int) (yf-psigma+0.5f);
-        int w = (int) ((psigma+psigma)+0.5);
-        int h = (int) ((psigma+psigma)+0.5);
-        int shift = i_image->y_offs-i_image->h;
-        ret_val = imlib_integral_mw_lookup(i_image, x, y-shift, w, h)/(w*h);
+    for (int i=0; i<kNB_POINTS; i++) {
+        int size = freak_box_size[i];
+        values[i] = imlib_integral_mw_lookup(i_image, kp_x + pattern[i][0], y + pattern[i][1], size, size) / (size * size);
     }
-
-    return ret_val;
 }
 
-array_t *freak_find_keypoints(image_t *image, bool normalized, int threshold, rectangle_t *roi)
+void freak_find_keypoints(kp_set_t *kpts, image_t *image, bool normalized, int threshold, rectangle_t *roi)
 {
     int thetaIdx=0;
     int direction0;
@@ -258,13 +193,11 @@ array_t *freak_find_keypoints(image_t *image, bool normalized, int threshold, re
     uint8_t pointsValue[kNB_POINTS];
 
     mw_image_t i_image;
-    array_t *keypoints;
-    array_alloc(&keypoints, xfree);
 
     // Find keypoints
-    fast_detect(image, keypoints, threshold, roi);
+    fast_detect(image, kpts, threshold, roi);
 
-    if (array_length(keypoints)) {
+    if (kpts->n_kpts) {
         int n_lines;
         if (image->h <= 144) {
             // Allocate and compute the whole integral image if
@@ -282,12 +215,14 @@ array_t *freak_find_keypoints(image_t *image, bool normalized, int threshold, re
         // Compute integral image
         imlib_integral_mw(image, &i_image);
 
-        for (int i=0; i<array_length(keypoints); i++) {
-            kp_t *kpt = array_at(keypoints, i);
+        for (int i=0; i<kpts->n_kpts; i++) {
+            int kp_x = kpts->x[i];
+            int kp_y = kpts->y[i];
+            uint8_t *desc = kpts->desc + (i * KP_DESC_SIZE);
 
-            while (i_image.y_offs < (kpt->y+n_lines)) {
+            while (i_image.y_offs < (kp_y+n_lines)) {
                 // Shift image if needed.
-                int shift = (kpt->y+n_lines) - i_image.y_offs;
+                int shift = (kp_y+n_lines) - i_image.y_offs;
                 shift =  min(i_image.h-1, shift);
                 imlib_integral_mw_shift(image, &i_image, shift);
             }
@@ -297,9 +232,7 @@ array_t *freak_find_keypoints(image_t *image, bool normalized, int threshold, re
                 thetaIdx = 0; // Assign 0° to all kpts
             } else {
                 // Get the points intensity value in the un-rotated pattern
-                for (int i=kNB_POINTS; i--;) {
-                    pointsValue[i] = mean_intensity(image, &i_image, kpt->x, kpt->y, 0, i);
-                }
+                mean_intensity(&i_image, kp_x, kp_y, 0, pointsValue);
 
                 direction0 = 0;
                 direction1 = 0;
@@ -325,96 +258,32 @@ array_t *freak_find_keypoints(image_t *image, bool normalized, int threshold, re
             }
 
             // Extract descriptor at the computed orientation
-            for (int i=kNB_POINTS; i--;) {
-                pointsValue[i] = mean_intensity(image, &i_image, kpt->x, kpt->y, thetaIdx, i);
-            }
+            mean_intensity(&i_image, kp_x, kp_y, thetaIdx, pointsValue);
+            kpts->angle[i] = thetaIdx;
 
             for (int m=kNB_PAIRS; m--;) {
-                kpt->desc[m/8] |= (pointsValue[DESCRIPTION_PAIRS[m][0]]> pointsValue[DESCRIPTION_PAIRS[m][1]]) << (m%8);
+                desc[m/8] |= (pointsValue[DESCRIPTION_PAIRS[m][0]]> pointsValue[DESCRIPTION_PAIRS[m][1]]) << (m%8);
             }
         }
 
         imlib_integral_mw_free(&i_image);
     }
-
-    return keypoints;
-}
-
-int freak_match_keypoints(array_t *kpts1, array_t *kpts2, int threshold)
-{
-    int matches=0;
-    int kpts1_size = array_length(kpts1);
-    int kpts2_size = array_length(kpts2);
-
-    // Reset the second set of keypoints.
-    // Note: The first set will be cleared when matching.
-    for (int x=0; x<kpts2_size; x++) {
-        ((kp_t*)array_at(kpts2, x))->match = NULL;
-    }
-
-    // Match keypoints
-    for (int x=0; x<kpts1_size; x++) {
-        kp_t *min_kp=NULL;
-        int min_dist = MAX_KP_DIST;
-
-        kp_t *kp1 = array_at(kpts1, x);
-
-        for (int y=0; y<kpts2_size; y++) {
-            int dist = 0;
-            kp_t *kp2 = array_at(kpts2, y);
-
-            // If keypoint was matched skip it
-            if (kp2->match != NULL) {
-                continue;
-            }
-
-            // Check the first 128 bits of the descriptor
-            for (int m=0; m<4; m++) { //128 bits
-                uint32_t v = ((uint32_t*)(kp1->desc))[m] ^ ((uint32_t*)(kp2->desc))[m];
-                while (v) {
-                    dist++;
-                    v &= v - 1;
-                }
-            }
-
-            // FREAK descriptor works like a cascade, the first 128 bits are more
-            // important, if the distance is bigger than a threshold, discard descriptor.
-            if (dist > 32) {
-                continue;
-            }
-
-            for (int m=4; m<16; m++) {
-                uint32_t v = ((uint32_t*)(kp1->desc))[m] ^ ((uint32_t*)(kp2->desc))[m];
-                while (v) {
-                    dist++;
-                    v &= v - 1;
-                }
-            }
-
-            if (dist < min_dist) {
-                min_kp = kp2;
-                min_dist = dist;
-            }
-        }
-
-        if ((((MAX_KP_DIST-min_dist)*100/MAX_KP_DIST)) < threshold) {
-            kp1->match = NULL;
-            // No match
-        } else {
-            matches++;
-            kp1->match = min_kp;
-            min_kp->match = kp1;
-        }
-    }
-    return matches;
 }
 
-int freak_save_descriptor(FIL *fp, array_t *kpts)
+// The magic and the keypoint count followed by the x, y and descriptor arrays.
+int freak_save_descriptor(FIL *fp, kp_set_t *kpts)
 {
     UINT bytes;
     FRESULT res;
 
-    int kpts_size = array_length(kpts);
+    int kpts_size = kpts->n_kpts;
+    uint32_t magic = DESCRIPTOR_MAGIC;
+
+    // Write the magic
+    res = f_write(fp, &magic, sizeof(magic), &bytes);
+    if (res != FR_OK || bytes != sizeof(magic)) {
+        goto error;
+    }
 
     // Write the number of keypoints
     res = f_write(fp, &kpts_size, sizeof(kpts_size), &bytes);
@@ -422,39 +291,45 @@ int freak_save_descriptor(FIL *fp, array_t *kpts)
         goto error;
     }
 
-    // Write keypoints
-    for (int i=0; i<kpts_size; i++) {
-        kp_t *kp = array_at(kpts, i);
-
-        // Write X
-        res = f_write(fp, &kp->x, sizeof(kp->x), &bytes);
-        if (res != FR_OK || bytes != sizeof(kp->x)) {
-            goto error;
-        }
+    // Write X
+    res = f_write(fp, kpts->x, kpts_size * sizeof(*kpts->x), &bytes);
+    if (res != FR_OK || bytes != kpts_size * sizeof(*kpts->x)) {
+        goto error;
+    }
 
-        // Write Y
-        res = f_write(fp, &kp->y, sizeof(kp->y), &bytes);
-        if (res != FR_OK || bytes != sizeof(kp->y)) {
-            goto error;
-        }
+    // Write Y
+    res = f_write(fp, kpts->y, kpts_size * sizeof(*kpts->y), &bytes);
+    if (res != FR_OK || bytes != kpts_size * sizeof(*kpts->y)) {
+        goto error;
+    }
 
-        // Write descriptor
-        res = f_write(fp, kp->desc, KPT_DESC_SIZE, &bytes);
-        if (res != FR_OK || bytes != KPT_DESC_SIZE) {
-            goto error;
-        }
+    // Write descriptors
+    res = f_write(fp, kpts->desc, kpts_size * KP_DESC_SIZE, &bytes);
+    if (res != FR_OK || bytes != kpts_size * KP_DESC_SIZE) {
+        goto error;
     }
 
 error:
     return res;
 }
 
-int freak_load_descriptor(FIL *fp, array_t *kpts)
+int freak_load_descriptor(FIL *fp, kp_set_t *kpts)
 {
     UINT bytes;
     FRESULT res=FR_OK;
 
     int kpts_size=0;
+    uint32_t magic=0;
+
+    // Read the magic, descriptors saved before it was added are not supported.
+    res = f_read(fp, &magic, sizeof(magic), &bytes);
+    if (res != FR_OK) {
+        goto error;
+    }
+
+    if (bytes != sizeof(magic) || magic != DESCRIPTOR_MAGIC) {
+        ff_unsupported_format(fp);
+    }
 
     // Read number of keypoints
     res = f_read(fp, &kpts_size, sizeof(kpts_size), &bytes);
@@ -462,30 +337,33 @@ int freak_load_descriptor(FIL *fp, array_t *kpts)
         goto error;
     }
 
-    // Read keypoints
-    for (int i=0; i<kpts_size; i++) {
-        kp_t *kp = xalloc(sizeof(*kp));
+    if (kpts_size < 0 || kpts_size > INT16_MAX) {
+        res = FR_INVALID_OBJECT;
+        goto error;
+    }
 
-        // Read X
-        res = f_read(fp, &kp->x, sizeof(kp->x), &bytes);
-        if (res != FR_OK || bytes != sizeof(kp->x)) {
-            goto error;
-        }
+    kp_set_alloc(kpts, kpts_size);
 
-        // Read Y
-        res = f_read(fp, &kp->y, sizeof(kp->y), &bytes);
-        if (res != FR_OK || bytes != sizeof(kp->y)) {
-            goto error;
-        }
+    // Read X
+    res = f_read(fp, kpts->x, kpts_size * sizeof(*kpts->x), &bytes);
+    if (res != FR_OK || bytes != kpts_size * sizeof(*kpts->x)) {
+        goto error;
+    }
 
-        // Read descriptor
-        res = f_read(fp, kp->desc,  KPT_DESC_SIZE, &bytes);
-        if (res != FR_OK || bytes != KPT_DESC_SIZE) {
-            goto error;
-        }
+    // Read Y
+    res = f_read(fp, kpts->y, kpts_size * sizeof(*kpts->y), &bytes);
+    if (res != FR_OK || bytes != kpts_size * sizeof(*kpts->y)) {
+        goto error;
+    }
 
-        // Add keypoint to array
-        array_push_back(kpts, kp);
+    // Read descriptors
+    res = f_read(fp, kpts->desc, kpts_size * KP_DESC_SIZE, &bytes);
+    if (res != FR_OK || bytes != kpts_size * KP_DESC_SIZE) {
+        goto error;
+    }
+
+    for (int i=0; i<kpts_size; i++) {
+        kpts->match[i] = -1;
     }
 
 error:
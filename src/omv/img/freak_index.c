@@ -0,0 +1,198 @@
+/*
+ * This file is part of the OpenMV project.
+ * Copyright (c) 2013/2014 Ibrahim Abdelkader <i.abdalkader@gmail.com>
+ * This work is licensed under the MIT license, see the file LICENSE for details.
+ *
+ * FREAK descriptor index.
+ *
+ * Multi-index hashing: the descriptors are split into byte substrings and
+ * each substring is hashed into its own table. Only keypoints sharing at
+ * least one substring with a query are compared with it. The substrings
+ * come from the first 128 bits of the descriptors, the coarse pairs that
+ * matching keypoints agree on most. The tables are bucket sorted arrays of
+ * keypoint indices, so the index is built once with two passes over the
+ * reference keypoints.
+ *
+ */
+#include <string.h>
+#include "imlib.h"
+#include "xalloc.h"
+#include "fb_alloc.h"
+
+#define MAX_KP_DIST         (512)
+// Maximum distance of the first 128 bits of matching descriptors.
+#define MAX_COARSE_DIST     (32)
+#define COARSE_BYTES        (16)
+#define N_BUCKETS           (256)
+
+// Number of set bits in a byte.
+static const uint8_t popcount_table[256] = {
+    0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5,
+    1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
+    1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
+    2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7,
+    1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
+    2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7,
+    2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7,
+    3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8,
+};
+
+// Hamming distance of descriptor bytes [from, to).
+static int hamming_distance(const uint8_t *d1, const uint8_t *d2, int from, int to)
+{
+    int dist = 0;
+    for (int i=from; i<to; i++) {
+        dist += popcount_table[d1[i] ^ d2[i]];
+    }
+    return dist;
+}
+
+// Returns the descriptor distance, or MAX_KP_DIST if the coarse bits don't match.
+int freak_distance(const uint8_t *desc1, const uint8_t *desc2)
+{
+    int dist = hamming_distance(desc1, desc2, 0, COARSE_BYTES);
+    if (dist > MAX_COARSE_DIST) {
+        return MAX_KP_DIST;
+    }
+    return dist + hamming_distance(desc1, desc2, COARSE_BYTES, KP_DESC_SIZE);
+}
+
+void freak_index_build(freak_index_t *index, kp_set_t *kpts)
+{
+    int n_kpts = kpts->n_kpts;
+
+    // The index is only set once both blocks are allocated, a non-NULL
+    // offsets pointer marks a built index even after a MemoryError.
+    uint16_t *index_offsets = xalloc0(FREAK_INDEX_TABLES * (N_BUCKETS + 1) * sizeof(uint16_t));
+    uint16_t *index_entries = xalloc(FREAK_INDEX_TABLES * IM_MAX(n_kpts, 1) * sizeof(uint16_t));
+
+    for (int t=0; t<FREAK_INDEX_TABLES; t++) {
+        uint16_t *offsets = index_offsets + (t * (N_BUCKETS + 1));
+        uint16_t *entries = index_entries + (t * n_kpts);
+
+        // Count the keypoints in each bucket, then turn
+        // the counts into the offsets of the buckets.
+        for (int i=0; i<n_kpts; i++) {
+            offsets[kpts->desc[(i * KP_DESC_SIZE) + t] + 1]++;
+        }
+        for (int b=0; b<N_BUCKETS; b++) {
+            offsets[b + 1] += offsets[b];
+        }
+
+        // Fill the buckets, this advances each offset to the next bucket.
+        for (int i=0; i<n_kpts; i++) {
+            entries[offsets[kpts->desc[(i * KP_DESC_SIZE) + t]]++] = i;
+        }
+        memmove(offsets + 1, offsets, N_BUCKETS * sizeof(uint16_t));
+        offsets[0] = 0;
+    }
+
+    index->kpts = kpts;
+    index->entries = index_entries;
+    index->offsets = index_offsets;
+}
+
+void freak_index_free(freak_index_t *index)
+{
+    xfree(index->entries);
+    xfree(index->offsets);
+    index->entries = NULL;
+    index->offsets = NULL;
+}
+
+int freak_match_index(freak_index_t *index, kp_set_t *kpts, int threshold, float ratio, bool cross_check)
+{
+    int matches = 0;
+    int n_refs = index->kpts->n_kpts;
+    int n_kpts = kpts->n_kpts;
+    kp_set_t *refs = index->kpts;
+
+    // Reset both sets of keypoints.
+    for (int i=0; i<n_refs; i++) {
+        refs->match[i] = -1;
+    }
+    for (int i=0; i<n_kpts; i++) {
+        kpts->match[i] = -1;
+    }
+
+    if (n_refs == 0 || n_kpts == 0) {
+        return 0;
+    }
+
+    // Per indexed keypoint, the last query that compared it (so candidates
+    // found in several tables are only compared once) and its closest query.
+    uint16_t *seen = fb_alloc0(n_refs * sizeof(uint16_t));
+    uint16_t *ref_dist = fb_alloc(n_refs * sizeof(uint16_t));
+    uint16_t *ref_best = fb_alloc(n_refs * sizeof(uint16_t));
+    // Per query, its closest indexed keypoint and the two smallest distances.
+    uint16_t *query_best = fb_alloc(n_kpts * sizeof(uint16_t));
+    uint16_t *query_dist = fb_alloc(n_kpts * sizeof(uint16_t) * 2);
+
+    for (int i=0; i<n_refs; i++) {
+        ref_dist[i] = MAX_KP_DIST;
+    }
+
+    for (int q=0, stamp=1; q<n_kpts; q++, stamp++) {
+        const uint8_t *desc = kpts->desc + (q * KP_DESC_SIZE);
+        int d1 = MAX_KP_DIST, d2 = MAX_KP_DIST, best = 0;
+
+        if (stamp > UINT16_MAX) {
+            memset(seen, 0, n_refs * sizeof(uint16_t));
+            stamp = 1;
+        }
+
+        for (int t=0; t<FREAK_INDEX_TABLES; t++) {
+            const uint16_t *offsets = index->offsets + (t * (N_BUCKETS + 1));
+            const uint16_t *entries = index->entries + (t * n_refs);
+            for (int e=offsets[desc[t]], end=offsets[desc[t] + 1]; e<end; e++) {
+                int r = entries[e];
+                if (seen[r] == stamp) {
+                    continue;
+                }
+                seen[r] = stamp;
+
+                int dist = freak_distance(desc, refs->desc + (r * KP_DESC_SIZE));
+                if (dist < d1) {
+                    d2 = d1;
+                    d1 = dist;
+                    best = r;
+                } else if (dist < d2) {
+                    d2 = dist;
+                }
+                if (dist < ref_dist[r]) {
+                    ref_dist[r] = dist;
+                    ref_best[r] = q;
+                }
+            }
+        }
+
+        query_best[q] = best;
+        query_dist[q*2+0] = d1;
+        query_dist[q*2+1] = d2;
+    }
+
+    for (int q=0; q<n_kpts; q++) {
+        int r = query_best[q];
+        int d1 = query_dist[q*2+0];
+        int d2 = query_dist[q*2+1];
+
+        // Distance threshold, ratio test against the second closest keypoint,
+        // and optionally the query must be the closest one to its match too.
+        if (d1 == MAX_KP_DIST || (((MAX_KP_DIST - d1) * 100) / MAX_KP_DIST) < threshold
+                || d1 > (ratio * d2) || (cross_check && ref_best[r] != q) || refs->match[r] != -1) {
+            continue;
+        }
+
+        kpts->match[q] = r;
+        refs->match[r] = q;
+        matches++;
+    }
+
+    fb_free(); // query_dist
+    fb_free(); // query_best
+    fb_free(); // ref_best
+    fb_free(); // ref_dist
+    fb_free(); // seen
+
+    return matches;
+}
@@ -0,0 +1,2054 @@
+#include <stdint.h>
+const uint8_t freak_box_size[43] = {
+    15, 15, 15, 15, 15, 15, 11, 11, 11, 11, 11, 11, 8, 8, 8, 8, 8, 8, 6, 6, 6, 6, 6, 6, 4, 4, 4, 4, 4, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+};
+const int8_t freak_pattern[256][43][2] = {
+    { // 0
+        {   7,  -7}, {   0,   5}, { -15,   5}, { -22,  -7}, { -15, -20}, {   0, -20}, {   4,   0}, {  -5,   6},
+        { -15,   0}, { -15, -11}, {  -6, -16}, {   4, -11}, {   4,  -4}, {   0,   3}, {  -8,   3}, { -12,  -4},
+        {  -8, -11}, {   0, -11}, {   2,   0}, {  -3,   3}, {  -8,   0}, {  -8,  -5}, {  -3,  -8}, {   2,  -5},
+        {   2,  -2}, {   0,   1}, {  -4,   1}, {  -6,  -2}, {  -4,  -5}, {   0,  -5}, {   1,   0}, {  -1,   1},
+        {  -3,   0}, {  -3,  -2}, {  -1,  -4}, {   1,  -2}, {   1,  -1}, {   0,   1}, {  -2,   1}, {  -3,  -1},
+        {  -2,  -3}, {   0,  -3}, {  -1,  -1},
+    },
+    { // 1
+        {   7,  -7}, {   0,   6}, { -15,   5}, { -22,  -8}, { -14, -20}, {   0, -20}, {   4,   0}, {  -6,   5},
+        { -15,   0}, { -15, -11}, {  -5, -16}, {   4, -11}, {   4,  -4}, {   0,   3}, {  -8,   3}, { -12,  -4},
+        {  -8, -11}, {   0, -11}, {   2,   0}, {  -3,   3}, {  -8,   0}, {  -7,  -6}, {  -3,  -8}, {   2,  -5},
+        {   2,  -2}, {   0,   1}, {  -4,   1}, {  -5,  -2}, {  -4,  -5}, {   0,  -5}, {   1,   0}, {  -1,   1},
+        {  -3,   0}, {  -3,  -2}, {  -1,  -4}, {   1,  -2}, {   1,  -1}, {   0,   1}, {  -2,   1}, {  -3,  -1},
+        {  -2,  -3}, {   0,  -2}, {  -1,  -1},
+    },
+    { // 2
+        {   7,  -7}, {  -1,   6}, { -15,   5}, { -22,  -8}, { -14, -20}, {   1, -20}, {   4,   0}, {  -6,   5},
+        { -15,   0}, { -15, -11}, {  -5, -16}, {   4, -11}, {   4,  -4}, {   0,   3}, {  -8,   3}, { -12,  -4},
+        {  -8, -11}, {   0, -11}, {   2,   0}, {  -3,   3}, {  -8,   0}, {  -7,  -6}, {  -2,  -8}, {   2,  -5},
+        {   2,  -2}, {   0,   1}, {  -4,   1}, {  -5,  -2}, {  -4,  -5}, {   0,  -5}, {   1,   0}, {  -1,   1},
+        {  -3,   0}, {  -3,  -3}, {  -1,  -4}, {   1,  -2}, {   1,  -1}, {   0,   1}, {  -2,   1}, {  -3,  -1},
+        {  -2,  -3}, {   0,  -2}, {  -1,  -1},
+    },
+    { // 3
+        {   7,  -6}, {  -1,   6}, { -16,   5}, { -22,  -8}, { -14, -21}, {   1, -19}, {   4,   1}, {  -6,   5},
+        { -15,  -1}, { -15, -12}, {  -5, -16}, {   4, -10}, {   4,  -3}, {  -1,   3}, {  -8,   3}, { -12,  -5},
+        {  -7, -11}, {   0, -11}, {   2,   0}, {  -3,   3}, {  -8,   0}, {  -7,  -6}, {  -2,  -8}, {   2,  -5},
+        {   2,  -2}, {   0,   1}, {  -4,   1}, {  -5,  -2}, {  -3,  -5}, {   0,  -5}, {   1,   0}, {  -1,   1},
+        {  -3,   0}, {  -3,  -3}, {  -1,  -4}, {   1,  -2}, {   1,  -1}, {   0,   1}, {  -2,   1}, {  -3,  -1},
+        {  -2,  -3}, {   0,  -2}, {  -1,  -1},
+    },
+    { // 4
+        {   7,  -6}, {  -1,   6}, { -16,   5}, { -22,  -9}, { -13, -21}, {   1, -19}, {   3,   1}, {  -7,   5},
+        { -16,  -1}, { -14, -12}, {  -4, -16}, {   5, -10}, {   4,  -3}, {  -1,   3}, {  -9,   2}, { -12,  -5},
+        {  -7, -11}, {   1, -10}, {   2,   0}, {  -3,   3}, {  -8,   0}, {  -7,  -6}, {  -2,  -8}, {   2,  -5},
+        {   2,  -1}, {   0,   2}, {  -4,   1}, {  -5,  -2}, {  -3,  -5}, {   0,  -5}, {   1,   0}, {  -1,   1},
+        {  -3,   0}, {  -3,  -3}, {  -1,  -4}, {   1,  -2}, {   1,  -1}, {   0,   1}, {  -2,   1}, {  -3,  -1},
+        {  -2,  -3}, {   0,  -2}, {  -1,  -1},
+    },
+    { // 5
+        {   7,  -6}, {  -2,   6}, { -16,   4}, { -22,  -9}, { -13, -21}, {   1, -19}, {   3,   1}, {  -7,   5},
+        { -16,  -1}, { -14, -12}, {  -4, -16}, {   5, -10}, {   4,  -3}, {  -1,   3}, {  -9,   2}, { -12,  -5},
+        {  -7, -11}, {   1, -10}, {   2,   1}, {  -3,   3}, {  -8,  -1}, {  -7,  -6}, {  -2,  -8}, {   2,  -5},
+        {   2,  -1}, {   0,   2}, {  -4,   1}, {  -5,  -2}, {  -3,  -5}, {   0,  -5}, {   1,   0}, {  -2,   1},
+        {  -3,   0}, {  -3,  -3}, {  -1,  -4}, {   1,  -2}, {   1,  -1}, {   0,   1}, {  -2,   1}, {  -3,  -1},
+        {  -2,  -3}, {   0,  -2}, {  -1,  -1},
+    },
+    { // 6
+        {   7,  -5}, {  -2,   6}, { -16,   4}, { -22,  -9}, { -13, -21}, {   2, -19}, {   3,   1}, {  -7,   5},
+        { -16,  -1}, { -14, -12}, {  -4, -16}, {   5, -10}, {   4,  -3}, {  -1,   3}, {  -9,   2}, { -12,  -5},
+        {  -7, -11}, {   1, -10}, {   2,   1}, {  -4,   3}, {  -8,  -1}, {  -7,  -6}, {  -2,  -8}, {   2,  -5},
+        {   2,  -1}, {   0,   2}, {  -4,   1}, {  -5,  -2}, {  -3,  -5}, {   0,  -5}, {   1,   0}, {  -2,   1},
+        {  -3,   0}, {  -3,  -3}, {  -1,  -4}, {   1,  -2}, {   1,  -1}, {   0,   1}, {  -2,   1}, {  -3,  -1},
+        {  -2,  -3}, {   0,  -2}, {  -1,  -1},
+    },
+    { // 7
+        {   7,  -5}, {  -2,   6}, { -17,   4}, { -22, -10}, { -12, -21}, {   2, -19}, {   3,   2}, {  -7,   5},
+        { -16,  -2}, { -14, -13}, {  -4, -16}, {   5,  -9}, {   4,  -3}, {  -1,   3}, {  -9,   2}, { -12,  -5},
+        {  -7, -11}, {   1, -10}, {   1,   1}, {  -4,   3}, {  -8,  -1}, {  -7,  -6}, {  -2,  -8}, {   2,  -5},
+        {   2,  -1}, {  -1,   2}, {  -4,   1}, {  -5,  -2}, {  -3,  -5}, {   1,  -5}, {   1,   0}, {  -2,   1},
+        {  -4,   0}, {  -3,  -3}, {  -1,  -4}, {   1,  -2}, {   1,  -1}, {   0,   1}, {  -2,   0}, {  -3,  -1},
+        {  -2,  -3}, {   0,  -2}, {  -1,  -1},
+    },
+    { // 8
+        {   7,  -4}, {  -3,   7}, { -17,   4}, { -22, -10}, { -12, -21}, {   2, -18}, {   3,   2}, {  -8,   5},
+        { -16,  -2}, { -14, -13}, {  -3, -16}, {   5,  -9}, {   4,  -2}, {  -1,   4}, {  -9,   2}, { -12,  -6},
+        {  -7, -11}, {   1, -10}, {   1,   1}, {  -4,   3}, {  -8,  -1}, {  -7,  -6}, {  -2,  -8}, {   2,  -5},
+        {   2,  -1}, {  -1,   2}, {  -4,   1}, {  -5,  -3}, {  -3,  -5}, {   1,  -5}, {   1,   0}, {  -2,   1},
+        {  -4,   0}, {  -3,  -3}, {  -1,  -4}, {   1,  -2}, {   1,  -1}, {   0,   1}, {  -2,   0}, {  -3,  -1},
+        {  -2,  -3}, {   0,  -2}, {  -1,  -1},
+    },
+    { // 9
+        {   7,  -4}, {  -3,   7}, { -17,   3}, { -22, -11}, { -12, -21}, {   3, -18}, {   3,   2}, {  -8,   5},
+        { -16,  -2}, { -14, -13}, {  -3, -16}, {   5,  -9}, {   4,  -2}, {  -2,   4}, {  -9,   2}, { -12,  -6},
+        {  -6, -12}, {   1, -10}, {   1,   1}, {  -4,   3}, {  -8,  -1}, {  -7,  -6}, {  -2,  -8}, {   2,  -4},
+        {   2,  -1}, {  -1,   2}, {  -4,   1}, {  -5,  -3}, {  -3,  -5}, {   1,  -5}, {   1,   0}, {  -2,   1},
+        {  -4,   0}, {  -3,  -3}, {  -1,  -4}, {   1,  -2}, {   1,  -1}, {   0,   1}, {  -2,   0}, {  -3,  -1},
+        {  -1,  -3}, {   0,  -2}, {  -1,  -1},
+    },
+    { // 10
+        {   7,  -4}, {  -3,   7}, { -18,   3}, { -22, -11}, { -11, -21}, {   3, -18}, {   2,   2}, {  -8,   5},
+        { -16,  -2}, { -13, -13}, {  -3, -16}, {   5,  -9}, {   4,  -2}, {  -2,   4}, {  -9,   2}, { -12,  -6},
+        {  -6, -12}, {   2, -10}, {   1,   1}, {  -4,   3}, {  -8,  -1}, {  -7,  -7}, {  -1,  -8}, {   3,  -4},
+        {   2,  -1}, {  -1,   2}, {  -4,   1}, {  -5,  -3}, {  -3,  -5}, {   1,  -4}, {   1,   0}, {  -2,   1},
+        {  -4,  -1}, {  -3,  -3}, {  -1,  -4}, {   1,  -2}, {   1,   0}, {   0,   1}, {  -2,   0}, {  -3,  -1},
+        {  -1,  -3}, {   0,  -2}, {  -1,  -1},
+    },
+    { // 11
+        {   7,  -3}, {  -4,   7}, { -18,   3}, { -21, -11}, { -11, -22}, {   3, -18}, {   2,   2}, {  -8,   5},
+        { -16,  -3}, { -13, -13}, {  -3, -16}, {   5,  -8}, {   4,  -2}, {  -2,   4}, { -10,   2}, { -12,  -6},
+        {  -6, -12}, {   2, -10}, {   1,   1}, {  -4,   3}, {  -8,  -1}, {  -7,  -7}, {  -1,  -8}, {   3,  -4},
+        {   2,  -1}, {  -1,   2}, {  -4,   1}, {  -5,  -3}, {  -3,  -5}, {   1,  -4}, {   0,   1}, {  -2,   1},
+        {  -4,  -1}, {  -3,  -3}, {  -1,  -4}, {   1,  -2}, {   1,   0}, {   0,   1}, {  -2,   0}, {  -3,  -1},
+        {  -1,  -3}, {   0,  -2}, {  -1,  -1},
+    },
+    { // 12
+        {   7,  -3}, {  -4,   7}, { -18,   3}, { -21, -12}, { -11, -22}, {   3, -17}, {   2,   3}, {  -9,   5},
+        { -16,  -3}, { -13, -14}, {  -2, -16}, {   5,  -8}, {   4,  -2}, {  -2,   4}, { -10,   1}, { -12,  -6},
+        {  -6, -12}, {   2,  -9}, {   1,   1}, {  -4,   3}, {  -8,  -2}, {  -7,  -7}, {  -1,  -8}, {   3,  -4},
+        {   2,  -1}, {  -1,   2}, {  -5,   1}, {  -5,  -3}, {  -3,  -5}, {   1,  -4}, {   0,   1}, {  -2,   1},
+        {  -4,  -1}, {  -3,  -3}, {  -1,  -4}, {   1,  -2}, {   1,   0}, {  -1,   1}, {  -2,   0}, {  -3,  -1},
+        {  -1,  -3}, {   0,  -2}, {  -1,  -1},
+    },
+    { // 13
+        {   7,  -3}, {  -4,   7}, { -18,   2}, { -21, -12}, { -10, -22}, {   4, -17}, {   2,   3}, {  -9,   5},
+        { -16,  -3}, { -13, -14}, {  -2, -16}, {   5,  -8}, {   4,  -1}, {  -2,   4}, { -10,   1}, { -12,  -6},
+        {  -6, -12}, {   2,  -9}, {   1,   1}, {  -4,   2}, {  -8,  -2}, {  -6,  -7}, {  -1,  -8}, {   3,  -4},
+        {   2,  -1}, {  -1,   2}, {  -5,   1}, {  -5,  -3}, {  -3,  -5}, {   1,  -4}, {   0,   1}, {  -2,   1},
+        {  -4,  -1}, {  -3,  -3}, {   0,  -4}, {   1,  -2}, {   1,   0}, {  -1,   1}, {  -2,   0}, {  -3,  -1},
+        {  -1,  -3}, {   0,  -2}, {  -1,  -1},
+    },
+    { // 14
+        {   6,  -2}, {  -5,   7}, { -19,   2}, { -21, -12}, { -10, -22}, {   4, -17}, {   2,   3}, {  -9,   5},
+        { -16,  -4}, { -13, -14}, {  -2, -16}, {   5,  -7}, {   4,  -1}, {  -3,   4}, { -10,   1}, { -11,  -7},
+        {  -5, -12}, {   2,  -9}, {   1,   1}, {  -5,   2}, {  -8,  -2}, {  -6,  -7}, {  -1,  -8}, {   3,  -4},
+        {   2,  -1}, {  -1,   2}, {  -5,   1}, {  -5,  -3}, {  -2,  -5}, {   1,  -4}, {   0,   1}, {  -2,   1},
+        {  -4,  -1}, {  -3,  -3}, {   0,  -4}, {   1,  -2}, {   1,   0}, {  -1,   1}, {  -2,   0}, {  -3,  -2},
+        {  -1,  -3}, {   0,  -2}, {  -1,  -1},
+    },
+    { // 15
+        {   6,  -2}, {  -5,   7}, { -19,   2}, { -21, -13}, { -10, -22}, {   4, -17}, {   1,   3}, {  -9,   5},
+        { -16,  -4}, { -12, -14}, {  -2, -16}, {   5,  -7}, {   3,  -1}, {  -3,   4}, { -10,   1}, { -11,  -7},
+        {  -5, -12}, {   2,  -9}, {   1,   2}, {  -5,   2}, {  -8,  -2}, {  -6,  -7}, {  -1,  -8}, {   3,  -4},
+        {   2,  -1}, {  -1,   2}, {  -5,   0}, {  -5,  -3}, {  -2,  -5}, {   1,  -4}, {   0,   1}, {  -2,   1},
+        {  -4,  -1}, {  -3,  -3}, {   0,  -4}, {   1,  -2}, {   1,   0}, {  -1,   1}, {  -2,   0}, {  -3,  -2},
+        {  -1,  -3}, {   1,  -2}, {  -1,  -1},
+    },
+    { // 16
+        {   6,  -2}, {  -5,   7}, { -19,   2}, { -21, -13}, {  -9, -22}, {   4, -16}, {   1,   3}, { -10,   5},
+        { -16,  -4}, { -12, -14}, {  -1, -16}, {   5,  -7}, {   3,  -1}, {  -3,   4}, { -10,   1}, { -11,  -7},
+        {  -5, -12}, {   2,  -9}, {   1,   2}, {  -5,   2}, {  -8,  -2}, {  -6,  -7}, {  -1,  -8}, {   3,  -3},
+        {   2,   0}, {  -1,   2}, {  -5,   0}, {  -5,  -3}, {  -2,  -5}, {   1,  -4}, {   0,   1}, {  -2,   1},
+        {  -4,  -1}, {  -3,  -3}, {   0,  -3}, {   1,  -2}, {   1,   0}, {  -1,   1}, {  -2,   0}, {  -3,  -2},
+        {  -1,  -3}, {   1,  -2}, {  -1,  -1},
+    },
+    { // 17
+        {   6,  -1}, {  -6,   7}, { -19,   1}, { -21, -13}, {  -9, -22}, {   5, -16}, {   1,   3}, { -10,   5},
+        { -16,  -4}, { -12, -14}, {  -1, -16}, {   5,  -7}, {   3,  -1}, {  -3,   4}, { -10,   1}, { -11,  -7},
+        {  -5, -12}, {   2,  -9}, {   0,   2}, {  -5,   2}, {  -8,  -2}, {  -6,  -7}, {  -1,  -8}, {   3,  -3},
+        {   2,   0}, {  -1,   2}, {  -5,   0}, {  -5,  -3}, {  -2,  -5}, {   1,  -4}, {   0,   1}, {  -2,   1},
+        {  -4,  -1}, {  -3,  -3}, {   0,  -3}, {   1,  -1}, {   1,   0}, {  -1,   1}, {  -2,   0}, {  -3,  -2},
+        {  -1,  -3}, {   1,  -2}, {  -1,  -1},
+    },
+    { // 18
+        {   6,  -1}, {  -6,   7}, { -19,   1}, { -21, -14}, {  -9, -22}, {   5, -16}, {   1,   4}, { -10,   4},
+        { -16,  -5}, { -12, -15}, {  -1, -15}, {   5,  -6}, {   3,  -1}, {  -3,   4}, { -11,   1}, { -11,  -7},
+        {  -5, -12}, {   3,  -8}, {   0,   2}, {  -5,   2}, {  -8,  -2}, {  -6,  -7}, {   0,  -8}, {   3,  -3},
+        {   1,   0}, {  -2,   2}, {  -5,   0}, {  -5,  -3}, {  -2,  -5}, {   1,  -4}, {   0,   1}, {  -2,   1},
+        {  -4,  -1}, {  -3,  -3}, {   0,  -3}, {   1,  -1}, {   1,   0}, {  -1,   1}, {  -2,   0}, {  -3,  -2},
+        {  -1,  -3}, {   1,  -2}, {  -1,  -1},
+    },
+    { // 19
+        {   6,  -1}, {  -6,   7}, { -20,   1}, { -20, -14}, {  -8, -22}, {   5, -15}, {   1,   4}, { -10,   4},
+        { -16,  -5}, { -12, -15}, {  -1, -15}, {   5,  -6}, {   3,   0}, {  -4,   4}, { -11,   0}, { -11,  -8},
+        {  -4, -12}, {   3,  -8}, {   0,   2}, {  -5,   2}, {  -8,  -2}, {  -6,  -7}, {   0,  -8}, {   3,  -3},
+        {   1,   0}, {  -2,   2}, {  -5,   0}, {  -5,  -3}, {  -2,  -5}, {   1,  -4}, {   0,   1}, {  -2,   1},
+        {  -4,  -1}, {  -3,  -3}, {   0,  -3}, {   1,  -1}, {   1,   0}, {  -1,   1}, {  -2,   0}, {  -3,  -2},
+        {  -1,  -3}, {   1,  -2}, {  -1,  -1},
+    },
+    { // 20
+        {   6,   0}, {  -7,   7}, { -20,   0}, { -20, -14}, {  -8, -22}, {   5, -15}, {   0,   4}, { -11,   4},
+        { -16,  -5}, { -11, -15}, {   0, -15}, {   5,  -6}, {   3,   0}, {  -4,   4}, { -11,   0}, { -11,  -8},
+        {  -4, -12}, {   3,  -8}, {   0,   2}, {  -5,   2}, {  -8,  -3}, {  -6,  -7}, {   0,  -8}, {   3,  -3},
+        {   1,   0}, {  -2,   2}, {  -5,   0}, {  -5,  -4}, {  -2,  -5}, {   1,  -4}, {   0,   1}, {  -2,   1},
+        {  -4,  -1}, {  -3,  -3}, {   0,  -3}, {   1,  -1}, {   1,   0}, {  -1,   1}, {  -2,   0}, {  -3,  -2},
+        {  -1,  -3}, {   1,  -2}, {  -1,  -1},
+    },
+    { // 21
+        {   5,   0}, {  -7,   7}, { -20,   0}, { -20, -15}, {  -7, -22}, {   5, -15}, {   0,   4}, { -11,   4},
+        { -16,  -5}, { -11, -15}, {   0, -15}, {   5,  -6}, {   3,   0}, {  -4,   4}, { -11,   0}, { -11,  -8},
+        {  -4, -12}, {   3,  -8}, {   0,   2}, {  -5,   2}, {  -8,  -3}, {  -6,  -7}, {   0,  -8}, {   3,  -3},
+        {   1,   0}, {  -2,   2}, {  -5,   0}, {  -5,  -4}, {  -2,  -5}, {   1,  -4}, {   0,   1}, {  -2,   1},
+        {  -4,  -1}, {  -2,  -3}, {   0,  -3}, {   1,  -1}, {   1,   0}, {  -1,   1}, {  -2,   0}, {  -3,  -2},
+        {  -1,  -3}, {   1,  -2}, {  -1,  -1},
+    },
+    { // 22
+        {   5,   0}, {  -8,   7}, { -20,   0}, { -20, -15}, {  -7, -22}, {   5, -14}, {   0,   4}, { -11,   4},
+        { -16,  -6}, { -11, -15}, {   0, -15}, {   5,  -5}, {   3,   0}, {  -4,   4}, { -11,   0}, { -11,  -8},
+        {  -4, -12}, {   3,  -8}, {   0,   2}, {  -6,   2}, {  -8,  -3}, {  -5,  -8}, {   0,  -7}, {   3,  -3},
+        {   1,   0}, {  -2,   2}, {  -5,   0}, {  -5,  -4}, {  -2,  -5}, {   1,  -4}, {   0,   1}, {  -2,   1},
+        {  -4,  -1}, {  -2,  -3}, {   0,  -3}, {   1,  -1}, {   1,   0}, {  -1,   1}, {  -3,   0}, {  -2,  -2},
+        {  -1,  -3}, {   1,  -2}, {  -1,  -1},
+    },
+    { // 23
+        {   5,   1}, {  -8,   7}, { -20,  -1}, { -20, -15}, {  -7, -22}, {   6, -14}, {   0,   4}, { -11,   4},
+        { -16,  -6}, { -11, -15}, {   0, -15}, {   5,  -5}, {   3,   0}, {  -4,   4}, { -11,   0}, { -11,  -8},
+        {  -4, -12}, {   3,  -8}, {   0,   2}, {  -6,   2}, {  -8,  -3}, {  -5,  -8}, {   0,  -7}, {   3,  -3},
+        {   1,   0}, {  -2,   2}, {  -5,   0}, {  -5,  -4}, {  -2,  -5}, {   1,  -4}, {   0,   1}, {  -3,   1},
+        {  -4,  -1}, {  -2,  -3}, {   0,  -3}, {   1,  -1}, {   1,   0}, {  -1,   1}, {  -3,   0}, {  -2,  -2},
+        {  -1,  -3}, {   1,  -2}, {  -1,  -1},
+    },
+    { // 24
+        {   5,   1}, {  -8,   7}, { -20,  -1}, { -20, -15}, {  -6, -22}, {   6, -14}, {  -1,   4}, { -12,   4},
+        { -16,  -6}, { -10, -15}, {   1, -15}, {   5,  -5}, {   3,   0}, {  -4,   4}, { -11,   0}, { -11,  -8},
+        {  -3, -12}, {   3,  -7}, {   0,   2}, {  -6,   2}, {  -8,  -3}, {  -5,  -8}, {   0,  -7}, {   3,  -2},
+        {   1,   0}, {  -2,   2}, {  -5,   0}, {  -5,  -4}, {  -2,  -5}, {   1,  -3}, {   0,   1}, {  -3,   1},
+        {  -4,  -1}, {  -2,  -3}, {   0,  -3}, {   1,  -1}, {   1,   0}, {  -1,   1}, {  -3,   0}, {  -2,  -2},
+        {  -1,  -3}, {   1,  -2}, {  -1,  -1},
+    },
+    { // 25
+        {   5,   1}, {  -9,   7}, { -21,  -1}, { -19, -16}, {  -6, -22}, {   6, -13}, {  -1,   4}, { -12,   3},
+        { -16,  -6}, { -10, -15}, {   1, -14}, {   5,  -5}, {   3,   1}, {  -5,   4}, { -11,  -1}, { -10,  -9},
+        {  -3, -12}, {   3,  -7}, {   0,   2}, {  -6,   2}, {  -8,  -3}, {  -5,  -8}, {   0,  -7}, {   3,  -2},
+        {   1,   0}, {  -2,   2}, {  -5,   0}, {  -5,  -4}, {  -2,  -5}, {   1,  -3}, {   0,   1}, {  -3,   1},
+        {  -4,  -1}, {  -2,  -3}, {   0,  -3}, {   1,  -1}, {   1,   0}, {  -1,   1}, {  -3,   0}, {  -2,  -2},
+        {  -1,  -3}, {   1,  -2}, {  -1,  -1},
+    },
+    { // 26
+        {   4,   1}, {  -9,   7}, { -21,  -1}, { -19, -16}, {  -6, -22}, {   6, -13}, {  -1,   5}, { -12,   3},
+        { -16,  -7}, { -10, -16}, {   1, -14}, {   5,  -4}, {   2,   1}, {  -5,   4}, { -11,  -1}, { -10,  -9},
+        {  -3, -12}, {   3,  -7}, {  -1,   2}, {  -6,   2}, {  -8,  -3}, {  -5,  -8}, {   1,  -7}, {   3,  -2},
+        {   1,   0}, {  -2,   2}, {  -5,   0}, {  -5,  -4}, {  -1,  -5}, {   2,  -3}, {   0,   1}, {  -3,   1},
+        {  -4,  -2}, {  -2,  -3}, {   0,  -3}, {   1,  -1}, {   1,   0}, {  -1,   1}, {  -3,   0}, {  -2,  -2},
+        {  -1,  -3}, {   1,  -2}, {  -1,  -1},
+    },
+    { // 27
+        {   4,   2}, {  -9,   7}, { -21,  -2}, { -19, -16}, {  -5, -22}, {   6, -13}, {  -1,   5}, { -12,   3},
+        { -16,  -7}, { -10, -16}, {   1, -14}, {   5,  -4}, {   2,   1}, {  -5,   4}, { -11,  -1}, { -10,  -9},
+        {  -3, -12}, {   3,  -7}, {  -1,   2}, {  -6,   2}, {  -8,  -4}, {  -5,  -8}, {   1,  -7}, {   3,  -2},
+        {   1,   0}, {  -2,   2}, {  -5,   0}, {  -5,  -4}, {  -1,  -5}, {   2,  -3}, {   0,   1}, {  -3,   1},
+        {  -4,  -2}, {  -2,  -3}, {   0,  -3}, {   1,  -1}, {   1,   0}, {  -1,   1}, {  -3,   0}, {  -2,  -2},
+        {  -1,  -3}, {   1,  -2}, {  -1,  -1},
+    },
+    { // 28
+        {   4,   2}, { -10,   7}, { -21,  -2}, { -19, -17}, {  -5, -22}, {   6, -12}, {  -2,   5}, { -12,   3},
+        { -16,  -7}, {  -9, -16}, {   1, -14}, {   5,  -4}, {   2,   1}, {  -5,   4}, { -11,  -1}, { -10,  -9},
+        {  -3, -12}, {   3,  -7}, {  -1,   2}, {  -6,   2}, {  -8,  -4}, {  -5,  -8}, {   1,  -7}, {   3,  -2},
+        {   1,   0}, {  -2,   2}, {  -5,  -1}, {  -5,  -4}, {  -1,  -5}, {   2,  -3}, {   0,   1}, {  -3,   1},
+        {  -4,  -2}, {  -2,  -4}, {   0,  -3}, {   1,  -1}, {   1,   0}, {  -1,   1}, {  -3,   0}, {  -2,  -2},
+        {  -1,  -3}, {   1,  -2}, {  -1,  -1},
+    },
+    { // 29
+        {   4,   2}, { -10,   7}, { -21,  -3}, { -18, -17}, {  -5, -22}, {   7, -12}, {  -2,   5}, { -13,   3},
+        { -16,  -8}, {  -9, -16}, {   2, -14}, {   5,  -3}, {   2,   1}, {  -5,   4}, { -11,  -1}, { -10,  -9},
+        {  -2, -12}, {   4,  -7}, {  -1,   2}, {  -6,   1}, {  -8,  -4}, {  -5,  -8}, {   1,  -7}, {   3,  -2},
+        {   1,   1}, {  -3,   2}, {  -5,  -1}, {  -5,  -4}, {  -1,  -5}, {   2,  -3}, {   0,   1}, {  -3,   1},
+        {  -4,  -2}, {  -2,  -4}, {   0,  -3}, {   1,  -1}, {   0,   0}, {  -1,   1}, {  -3,   0}, {  -2,  -2},
+        {  -1,  -3}, {   1,  -2}, {  -1,  -1},
+    },
+    { // 30
+        {   4,   3}, { -10,   7}, { -21,  -3}, { -18, -17}, {  -4, -22}, {   7, -12}, {  -2,   5}, { -13,   3},
+        { -16,  -8}, {  -9, -16}, {   2, -14}, {   5,  -3}, {   2,   1}, {  -6,   4}, { -12,  -2}, { -10,  -9},
+        {  -2, -12}, {   4,  -6}, {  -1,   2}, {  -6,   1}, {  -8,  -4}, {  -4,  -8}, {   1,  -7}, {   3,  -2},
+        {   1,   1}, {  -3,   2}, {  -5,  -1}, {  -5,  -4}, {  -1,  -5}, {   2,  -3}, {   0,   1}, {  -3,   1},
+        {  -4,  -2}, {  -2,  -4}, {   0,  -3}, {   1,  -1}, {   0,   0}, {  -1,   1}, {  -3,   0}, {  -2,  -2},
+        {  -1,  -3}, {   1,  -1}, {  -1,  -1},
+    },
+    { // 31
+        {   3,   3}, { -11,   7}, { -21,  -3}, { -18, -17}, {  -4, -22}, {   7, -11}, {  -2,   5}, { -13,   2},
+        { -16,  -8}, {  -9, -16}, {   2, -13}, {   5,  -3}, {   2,   2}, {  -6,   4}, { -12,  -2}, { -10,  -9},
+        {  -2, -12}, {   4,  -6}, {  -1,   3}, {  -7,   1}, {  -8,  -4}, {  -4,  -8}, {   1,  -7}, {   3,  -1},
+        {   1,   1}, {  -3,   2}, {  -5,  -1}, {  -4,  -4}, {  -1,  -5}, {   2,  -3}, {  -1,   1}, {  -3,   1},
+        {  -4,  -2}, {  -2,  -4}, {   0,  -3}, {   1,  -1}, {   0,   0}, {  -1,   1}, {  -3,   0}, {  -2,  -2},
+        {   0,  -3}, {   1,  -1}, {  -1,  -1},
+    },
+    { // 32
+        {   3,   3}, { -11,   7}, { -22,  -4}, { -18, -18}, {  -4, -22}, {   7, -11}, {  -3,   5}, { -13,   2},
+        { -16,  -8}, {  -8, -16}, {   2, -13}, {   5,  -3}, {   2,   2}, {  -6,   4}, { -12,  -2}, { -10, -10},
+        {  -2, -12}, {   4,  -6}, {  -1,   3}, {  -7,   1}, {  -8,  -4}, {  -4,  -8}, {   1,  -7}, {   3,  -1},
+        {   1,   1}, {  -3,   2}, {  -5,  -1}, {  -4,  -4}, {  -1,  -5}, {   2,  -3}, {  -1,   1}, {  -3,   1},
+        {  -4,  -2}, {  -2,  -4}, {   1,  -3}, {   1,  -1}, {   0,   0}, {  -1,   1}, {  -3,   0}, {  -2,  -2},
+        {   0,  -3}, {   1,  -1}, {  -1,  -1},
+    },
+    { // 33
+        {   3,   3}, { -11,   7}, { -22,  -4}, { -17, -18}, {  -3, -21}, {   7, -11}, {  -3,   5}, { -13,   2},
+        { -16,  -9}, {  -8, -16}, {   2, -13}, {   5,  -2}, {   2,   2}, {  -6,   4}, { -12,  -2}, {  -9, -10},
+        {  -2, -12}, {   4,  -6}, {  -1,   3}, {  -7,   1}, {  -8,  -4}, {  -4,  -8}, {   1,  -7}, {   3,  -1},
+        {   1,   1}, {  -3,   2}, {  -5,  -1}, {  -4,  -4}, {  -1,  -5}, {   2,  -3}, {  -1,   1}, {  -3,   0},
+        {  -4,  -2}, {  -2,  -4}, {   1,  -3}, {   1,  -1}, {   0,   0}, {  -1,   1}, {  -3,   0}, {  -2,  -2},
+        {   0,  -3}, {   1,  -1}, {  -1,  -1},
+    },
+    { // 34
+        {   3,   4}, { -12,   7}, { -22,  -4}, { -17, -18}, {  -3, -21}, {   7, -10}, {  -3,   5}, { -14,   2},
+        { -16,  -9}, {  -8, -16}, {   3, -13}, {   5,  -2}, {   1,   2}, {  -6,   4}, { -12,  -2}, {  -9, -10},
+        {  -2, -12}, {   4,  -6}, {  -2,   3}, {  -7,   1}, {  -8,  -4}, {  -4,  -8}, {   1,  -6}, {   2,  -1},
+        {   1,   1}, {  -3,   2}, {  -5,  -1}, {  -4,  -5}, {  -1,  -5}, {   2,  -3}, {  -1,   1}, {  -3,   0},
+        {  -4,  -2}, {  -2,  -4}, {   1,  -3}, {   1,   0}, {   0,   0}, {  -1,   1}, {  -3,  -1}, {  -2,  -2},
+        {   0,  -3}, {   1,  -1}, {  -1,  -1},
+    },
+    { // 35
+        {   2,   4}, { -12,   7}, { -22,  -5}, { -17, -18}, {  -3, -21}, {   7, -10}, {  -3,   5}, { -14,   2},
+        { -16,  -9}, {  -8, -16}, {   3, -13}, {   5,  -2}, {   1,   2}, {  -7,   4}, { -12,  -2}, {  -9, -10},
+        {  -1, -11}, {   4,  -5}, {  -2,   3}, {  -7,   1}, {  -8,  -5}, {  -4,  -8}, {   1,  -6}, {   2,  -1},
+        {   1,   1}, {  -3,   2}, {  -5,  -1}, {  -4,  -5}, {  -1,  -5}, {   2,  -3}, {  -1,   1}, {  -3,   0},
+        {  -4,  -2}, {  -2,  -4}, {   1,  -3}, {   1,   0}, {   0,   0}, {  -2,   1}, {  -3,  -1}, {  -2,  -2},
+        {   0,  -3}, {   1,  -1}, {  -1,  -1},
+    },
+    { // 36
+        {   2,   4}, { -12,   6}, { -22,  -5}, { -17, -19}, {  -2, -21}, {   7, -10}, {  -4,   5}, { -14,   1},
+        { -16,  -9}, {  -7, -16}, {   3, -12}, {   5,  -2}, {   1,   2}, {  -7,   3}, { -12,  -3}, {  -9, -10},
+        {  -1, -11}, {   4,  -5}, {  -2,   3}, {  -7,   1}, {  -8,  -5}, {  -4,  -8}, {   2,  -6}, {   2,  -1},
+        {   0,   1}, {  -3,   2}, {  -5,  -1}, {  -4,  -5}, {  -1,  -5}, {   2,  -2}, {  -1,   1}, {  -3,   0},
+        {  -4,  -2}, {  -2,  -4}, {   1,  -3}, {   1,   0}, {   0,   1}, {  -2,   1}, {  -3,  -1}, {  -2,  -2},
+        {   0,  -3}, {   1,  -1}, {  -1,  -1},
+    },
+    { // 37
+        {   2,   4}, { -13,   6}, { -22,  -5}, { -16, -19}, {  -2, -21}, {   7,  -9}, {  -4,   5}, { -14,   1},
+        { -16, -10}, {  -7, -16}, {   3, -12}, {   5,  -1}, {   1,   2}, {  -7,   3}, { -12,  -3}, {  -9, -10},
+        {  -1, -11}, {   4,  -5}, {  -2,   3}, {  -7,   1}, {  -8,  -5}, {  -4,  -8}, {   2,  -6}, {   2,  -1},
+        {   0,   1}, {  -3,   2}, {  -5,  -1}, {  -4,  -5}, {   0,  -5}, {   2,  -2}, {  -1,   1}, {  -3,   0},
+        {  -3,  -2}, {  -2,  -4}, {   1,  -3}, {   1,   0}, {   0,   1}, {  -2,   1}, {  -3,  -1}, {  -2,  -2},
+        {   0,  -3}, {   1,  -1}, {  -1,  -1},
+    },
+    { // 38
+        {   1,   4}, { -13,   6}, { -22,  -6}, { -16, -19}, {  -1, -21}, {   7,  -9}, {  -4,   5}, { -14,   1},
+        { -16, -10}, {  -7, -16}, {   3, -12}, {   5,  -1}, {   1,   2}, {  -7,   3}, { -12,  -3}, {  -9, -10},
+        {  -1, -11}, {   4,  -5}, {  -2,   3}, {  -7,   1}, {  -8,  -5}, {  -3,  -8}, {   2,  -6}, {   2,  -1},
+        {   0,   1}, {  -3,   2}, {  -5,  -1}, {  -4,  -5}, {   0,  -5}, {   2,  -2}, {  -1,   1}, {  -3,   0},
+        {  -3,  -2}, {  -2,  -4}, {   1,  -3}, {   1,   0}, {   0,   1}, {  -2,   1}, {  -3,  -1}, {  -2,  -2},
+        {   0,  -3}, {   1,  -1}, {  -1,  -1},
+    },
+    { // 39
+        {   1,   5}, { -13,   6}, { -22,  -6}, { -16, -19}, {  -1, -21}, {   7,  -9}, {  -5,   5}, { -14,   1},
+        { -15, -10}, {  -6, -16}, {   3, -12}, {   4,  -1}, {   1,   3}, {  -7,   3}, { -12,  -3}, {  -9, -10},
+        {  -1, -11}, {   4,  -5}, {  -2,   3}, {  -7,   0}, {  -8,  -5}, {  -3,  -8}, {   2,  -6}, {   2,   0},
+        {   0,   1}, {  -3,   1}, {  -5,  -2}, {  -4,  -5}, {   0,  -5}, {   2,  -2}, {  -1,   1}, {  -3,   0},
+        {  -3,  -2}, {  -1,  -4}, {   1,  -3}, {   1,   0}, {   0,   1}, {  -2,   1}, {  -3,  -1}, {  -2,  -2},
+        {   0,  -3}, {   1,  -1}, {  -1,  -1},
+    },
+    { // 40
+        {   1,   5}, { -14,   6}, { -22,  -6}, { -15, -20}, {  -1, -20}, {   7,  -8}, {  -5,   5}, { -15,   1},
+        { -15, -10}, {  -6, -16}, {   4, -12}, {   4,  -1}, {   0,   3}, {  -7,   3}, { -12,  -3}, {  -8, -11},
+        {   0, -11}, {   4,  -4}, {  -2,   3}, {  -7,   0}, {  -8,  -5}, {  -3,  -8}, {   2,  -6}, {   2,   0},
+        {   0,   1}, {  -3,   1}, {  -5,  -2}, {  -4,  -5}, {   0,  -5}, {   2,  -2}, {  -1,   1}, {  -3,   0},
+        {  -3,  -2}, {  -1,  -4}, {   1,  -3}, {   1,   0}, {   0,   1}, {  -2,   1}, {  -3,  -1}, {  -2,  -2},
+        {   0,  -3}, {   1,  -1}, {  -1,  -1},
+    },
+    { // 41
+        {   1,   5}, { -14,   6}, { -22,  -7}, { -15, -20}, {  -1, -20}, {   7,  -8}, {  -5,   5}, { -15,   0},
+        { -15, -11}, {  -6, -16}, {   4, -11}, {   4,   0}, {   0,   3}, {  -8,   3}, { -12,  -4}, {  -8, -11},
+        {   0, -11}, {   4,  -4}, {  -3,   3}, {  -7,   0}, {  -8,  -5}, {  -3,  -8}, {   2,  -6}, {   2,   0},
+        {   0,   1}, {  -4,   1}, {  -5,  -2}, {  -4,  -5}, {   0,  -5}, {   2,  -2}, {  -1,   1}, {  -3,   0},
+        {  -3,  -2}, {  -1,  -4}, {   1,  -3}, {   1,   0}, {   0,   1}, {  -2,   1}, {  -3,  -1}, {  -2,  -2},
+        {   0,  -3}, {   1,  -1}, {  -1,  -1},
+    },
+    { // 42
+        {   0,   5}, { -14,   5}, { -22,  -7}, { -15, -20}, {   0, -20}, {   7,  -8}, {  -5,   5}, { -15,   0},
+        { -15, -11}, {  -6, -16}, {   4, -11}, {   4,   0}, {   0,   3}, {  -8,   3}, { -12,  -4}, {  -8, -11},
+        {   0, -11}, {   4,  -4}, {  -3,   3}, {  -7,   0}, {  -8,  -5}, {  -3,  -8}, {   2,  -6}, {   2,   0},
+        {   0,   1}, {  -4,   1}, {  -5,  -2}, {  -4,  -5}, {   0,  -5}, {   2,  -2}, {  -1,   1}, {  -3,   0},
+        {  -3,  -2}, {  -1,  -4}, {   1,  -2}, {   1,   0}, {   0,   1}, {  -2,   1}, {  -3,  -1}, {  -2,  -2},
+        {   0,  -3}, {   1,  -1}, {  -1,  -1},
+    },
+    { // 43
+        {   0,   5}, { -15,   5}, { -22,  -7}, { -15, -20}, {   0, -20}, {   7,  -7}, {  -6,   5}, { -15,   0},
+        { -15, -11}, {  -5, -16}, {   4, -11}, {   4,   0}, {   0,   3}, {  -8,   3}, { -12,  -4}, {  -8, -11},
+        {   0, -11}, {   4,  -4}, {  -3,   3}, {  -8,   0}, {  -7,  -6}, {  -3,  -8}, {   2,  -5}, {   2,   0},
+        {   0,   1}, {  -4,   1}, {  -5,  -2}, {  -4,  -5}, {   0,  -5}, {   2,  -2}, {  -1,   1}, {  -3,   0},
+        {  -3,  -2}, {  -1,  -4}, {   1,  -2}, {   1,   0}, {   0,   1}, {  -2,   1}, {  -3,  -1}, {  -2,  -3},
+        {   0,  -2}, {   1,  -1}, {  -1,  -1},
+    },
+    { // 44
+        {   0,   6}, { -15,   5}, { -22,  -8}, { -14, -20}, {   0, -20}, {   7,  -7}, {  -6,   5}, { -15,   0},
+        { -15, -11}, {  -5, -16}, {   4, -11}, {   4,   0}, {   0,   3}, {  -8,   3}, { -12,  -4}, {  -8, -11},
+        {   0, -11}, {   4,  -4}, {  -3,   3}, {  -8,   0}, {  -7,  -6}, {  -3,  -8}, {   2,  -5}, {   2,   0},
+        {   0,   1}, {  -4,   1}, {  -5,  -2}, {  -4,  -5}, {   0,  -5}, {   2,  -2}, {  -1,   1}, {  -3,   0},
+        {  -3,  -3}, {  -1,  -4}, {   1,  -2}, {   1,   0}, {   0,   1}, {  -2,   1}, {  -3,  -1}, {  -2,  -3},
+        {   0,  -2}, {   1,  -1}, {  -1,  -1},
+    },
+    { // 45
+        {  -1,   6}, { -15,   5}, { -22,  -8}, { -14, -20}, {   1, -20}, {   7,  -6}, {  -6,   5}, { -15,  -1},
+        { -15, -12}, {  -5, -16}, {   4, -10}, {   4,   1}, {   0,   3}, {  -8,   3}, { -12,  -4}, {  -8, -11},
+        {   0, -11}, {   4,  -4}, {  -3,   3}, {  -8,   0}, {  -7,  -6}, {  -2,  -8}, {   2,  -5}, {   2,   0},
+        {   0,   1}, {  -4,   1}, {  -5,  -2}, {  -3,  -5}, {   0,  -5}, {   2,  -2}, {  -1,   1}, {  -3,   0},
+        {  -3,  -3}, {  -1,  -4}, {   1,  -2}, {   1,   0}, {   0,   1}, {  -2,   1}, {  -3,  -1}, {  -2,  -3},
+        {   0,  -2}, {   1,  -1}, {  -1,  -1},
+    },
+    { // 46
+        {  -1,   6}, { -16,   5}, { -22,  -9}, { -14, -21}, {   1, -19}, {   7,  -6}, {  -6,   5}, { -15,  -1},
+        { -15, -12}, {  -5, -16}, {   4, -10}, {   4,   1}, {  -1,   3}, {  -8,   3}, { -12,  -5}, {  -7, -11},
+        {   1, -11}, {   4,  -3}, {  -3,   3}, {  -8,   0}, {  -7,  -6}, {  -2,  -8}, {   2,  -5}, {   2,   0},
+        {   0,   1}, {  -4,   1}, {  -5,  -2}, {  -3,  -5}, {   0,  -5}, {   2,  -2}, {  -1,   1}, {  -3,   0},
+        {  -3,  -3}, {  -1,  -4}, {   1,  -2}, {   1,   0}, {   0,   1}, {  -2,   1}, {  -3,  -1}, {  -2,  -3},
+        {   0,  -2}, {   1,  -1}, {  -1,  -1},
+    },
+    { // 47
+        {  -1,   6}, { -16,   5}, { -22,  -9}, { -13, -21}, {   1, -19}, {   7,  -6}, {  -7,   5}, { -16,  -1},
+        { -14, -12}, {  -4, -16}, {   5, -10}, {   3,   1}, {  -1,   3}, {  -9,   2}, { -12,  -5}, {  -7, -11},
+        {   1, -10}, {   4,  -3}, {  -3,   3}, {  -8,  -1}, {  -7,  -6}, {  -2,  -8}, {   2,  -5}, {   2,   0},
+        {   0,   2}, {  -4,   1}, {  -5,  -2}, {  -3,  -5}, {   0,  -5}, {   2,  -1}, {  -1,   1}, {  -3,   0},
+        {  -3,  -3}, {  -1,  -4}, {   1,  -2}, {   1,   0}, {   0,   1}, {  -2,   1}, {  -3,  -1}, {  -2,  -3},
+        {   0,  -2}, {   1,  -1}, {  -1,  -1},
+    },
+    { // 48
+        {  -2,   6}, { -16,   4}, { -22,  -9}, { -13, -21}, {   2, -19}, {   7,  -5}, {  -7,   5}, { -16,  -1},
+        { -14, -12}, {  -4, -16}, {   5, -10}, {   3,   1}, {  -1,   3}, {  -9,   2}, { -12,  -5}, {  -7, -11},
+        {   1, -10}, {   4,  -3}, {  -3,   3}, {  -8,  -1}, {  -7,  -6}, {  -2,  -8}, {   2,  -5}, {   2,   1},
+        {   0,   2}, {  -4,   1}, {  -5,  -2}, {  -3,  -5}, {   0,  -5}, {   2,  -1}, {  -2,   1}, {  -3,   0},
+        {  -3,  -3}, {  -1,  -4}, {   1,  -2}, {   1,   0}, {   0,   1}, {  -2,   1}, {  -3,  -1}, {  -2,  -3},
+        {   0,  -2}, {   1,  -1}, {  -1,  -1},
+    },
+    { // 49
+        {  -2,   6}, { -17,   4}, { -22, -10}, { -13, -21}, {   2, -19}, {   7,  -5}, {  -7,   5}, { -16,  -2},
+        { -14, -12}, {  -4, -16}, {   5,  -9}, {   3,   1}, {  -1,   3}, {  -9,   2}, { -12,  -5}, {  -7, -11},
+        {   1, -10}, {   4,  -3}, {  -4,   3}, {  -8,  -1}, {  -7,  -6}, {  -2,  -8}, {   2,  -5}, {   2,   1},
+        {  -1,   2}, {  -4,   1}, {  -5,  -2}, {  -3,  -5}, {   0,  -5}, {   2,  -1}, {  -2,   1}, {  -4,   0},
+        {  -3,  -3}, {  -1,  -4}, {   1,  -2}, {   1,   0}, {   0,   1}, {  -2,   1}, {  -3,  -1}, {  -2,  -3},
+        {   0,  -2}, {   1,  -1}, {  -1,  -1},
+    },
+    { // 50
+        {  -2,   6}, { -17,   4}, { -22, -10}, { -12, -21}, {   2, -19}, {   7,  -5}, {  -7,   5}, { -16,  -2},
+        { -14, -13}, {  -4, -16}, {   5,  -9}, {   3,   2}, {  -1,   4}, {  -9,   2}, { -12,  -5}, {  -7, -11},
+        {   1, -10}, {   4,  -3}, {  -4,   3}, {  -8,  -1}, {  -7,  -6}, {  -2,  -8}, {   2,  -5}, {   1,   1},
+        {  -1,   2}, {  -4,   1}, {  -5,  -2}, {  -3,  -5}, {   1,  -5}, {   2,  -1}, {  -2,   1}, {  -4,   0},
+        {  -3,  -3}, {  -1,  -4}, {   1,  -2}, {   1,   0}, {   0,   1}, {  -2,   0}, {  -3,  -1}, {  -2,  -3},
+        {   0,  -2}, {   1,  -1}, {  -1,  -1},
+    },
+    { // 51
+        {  -3,   7}, { -17,   4}, { -22, -10}, { -12, -21}, {   2, -18}, {   7,  -4}, {  -8,   5}, { -16,  -2},
+        { -14, -13}, {  -3, -16}, {   5,  -9}, {   3,   2}, {  -1,   4}, {  -9,   2}, { -12,  -6}, {  -6, -12},
+        {   1, -10}, {   4,  -2}, {  -4,   3}, {  -8,  -1}, {  -7,  -6}, {  -2,  -8}, {   2,  -4}, {   1,   1},
+        {  -1,   2}, {  -4,   1}, {  -5,  -3}, {  -3,  -5}, {   1,  -5}, {   2,  -1}, {  -2,   1}, {  -4,   0},
+        {  -3,  -3}, {  -1,  -4}, {   1,  -2}, {   1,   0}, {   0,   1}, {  -2,   0}, {  -3,  -1}, {  -1,  -3},
+        {   0,  -2}, {   1,  -1}, {  -1,  -1},
+    },
+    { // 52
+        {  -3,   7}, { -17,   3}, { -22, -11}, { -12, -21}, {   3, -18}, {   7,  -4}, {  -8,   5}, { -16,  -2},
+        { -14, -13}, {  -3, -16}, {   5,  -9}, {   3,   2}, {  -2,   4}, {  -9,   2}, { -12,  -6}, {  -6, -12},
+        {   1, -10}, {   4,  -2}, {  -4,   3}, {  -8,  -1}, {  -7,  -7}, {  -2,  -8}, {   3,  -4}, {   1,   1},
+        {  -1,   2}, {  -4,   1}, {  -5,  -3}, {  -3,  -5}, {   1,  -5}, {   2,  -1}, {  -2,   1}, {  -4,  -1},
+        {  -3,  -3}, {  -1,  -4}, {   1,  -2}, {   1,   0}, {   0,   1}, {  -2,   0}, {  -3,  -1}, {  -1,  -3},
+        {   0,  -2}, {   1,  -1}, {  -1,  -1},
+    },
+    { // 53
+        {  -3,   7}, { -18,   3}, { -22, -11}, { -11, -21}, {   3, -18}, {   7,  -4}, {  -8,   5}, { -16,  -3},
+        { -13, -13}, {  -3, -16}, {   5,  -8}, {   2,   2}, {  -2,   4}, { -10,   2}, { -12,  -6}, {  -6, -12},
+        {   2, -10}, {   4,  -2}, {  -4,   3}, {  -8,  -1}, {  -7,  -7}, {  -1,  -8}, {   3,  -4}, {   1,   1},
+        {  -1,   2}, {  -4,   1}, {  -5,  -3}, {  -3,  -5}, {   1,  -4}, {   2,  -1}, {  -2,   1}, {  -4,  -1},
+        {  -3,  -3}, {  -1,  -4}, {   1,  -2}, {   1,   0}, {   0,   1}, {  -2,   0}, {  -3,  -1}, {  -1,  -3},
+        {   0,  -2}, {   1,   0}, {  -1,  -1},
+    },
+    { // 54
+        {  -4,   7}, { -18,   3}, { -21, -11}, { -11, -22}, {   3, -18}, {   7,  -3}, {  -9,   5}, { -16,  -3},
+        { -13, -13}, {  -2, -16}, {   5,  -8}, {   2,   2}, {  -2,   4}, { -10,   2}, { -12,  -6}, {  -6, -12},
+        {   2,  -9}, {   4,  -2}, {  -4,   3}, {  -8,  -1}, {  -7,  -7}, {  -1,  -8}, {   3,  -4}, {   1,   1},
+        {  -1,   2}, {  -4,   1}, {  -5,  -3}, {  -3,  -5}, {   1,  -4}, {   2,  -1}, {  -2,   1}, {  -4,  -1},
+        {  -3,  -3}, {  -1,  -4}, {   1,  -2}, {   0,   1}, {   0,   1}, {  -2,   0}, {  -3,  -1}, {  -1,  -3},
+        {   0,  -2}, {   1,   0}, {  -1,  -1},
+    },
+    { // 55
+        {  -4,   7}, { -18,   3}, { -21, -12}, { -11, -22}, {   3, -17}, {   7,  -3}, {  -9,   5}, { -16,  -3},
+        { -13, -14}, {  -2, -16}, {   5,  -8}, {   2,   3}, {  -2,   4}, { -10,   1}, { -12,  -6}, {  -6, -12},
+        {   2,  -9}, {   4,  -2}, {  -4,   2}, {  -8,  -2}, {  -6,  -7}, {  -1,  -8}, {   3,  -4}, {   1,   1},
+        {  -1,   2}, {  -5,   1}, {  -5,  -3}, {  -3,  -5}, {   1,  -4}, {   2,  -1}, {  -2,   1}, {  -4,  -1},
+        {  -3,  -3}, {   0,  -4}, {   1,  -2}, {   0,   1}, {  -1,   1}, {  -2,   0}, {  -3,  -1}, {  -1,  -3},
+        {   0,  -2}, {   1,   0}, {  -1,  -1},
+    },
+    { // 56
+        {  -4,   7}, { -18,   2}, { -21, -12}, { -10, -22}, {   4, -17}, {   7,  -3}, {  -9,   5}, { -16,  -3},
+        { -13, -14}, {  -2, -16}, {   5,  -8}, {   2,   3}, {  -2,   4}, { -10,   1}, { -11,  -7}, {  -6, -12},
+        {   2,  -9}, {   4,  -1}, {  -5,   2}, {  -8,  -2}, {  -6,  -7}, {  -1,  -8}, {   3,  -4}, {   1,   1},
+        {  -1,   2}, {  -5,   1}, {  -5,  -3}, {  -3,  -5}, {   1,  -4}, {   2,  -1}, {  -2,   1}, {  -4,  -1},
+        {  -3,  -3}, {   0,  -4}, {   1,  -2}, {   0,   1}, {  -1,   1}, {  -2,   0}, {  -3,  -2}, {  -1,  -3},
+        {   0,  -2}, {   1,   0}, {  -1,  -1},
+    },
+    { // 57
+        {  -5,   7}, { -19,   2}, { -21, -12}, { -10, -22}, {   4, -17}, {   6,  -2}, {  -9,   5}, { -16,  -4},
+        { -13, -14}, {  -2, -16}, {   5,  -7}, {   2,   3}, {  -3,   4}, { -10,   1}, { -11,  -7}, {  -5, -12},
+        {   2,  -9}, {   3,  -1}, {  -5,   2}, {  -8,  -2}, {  -6,  -7}, {  -1,  -8}, {   3,  -4}, {   1,   1},
+        {  -1,   2}, {  -5,   1}, {  -5,  -3}, {  -2,  -5}, {   1,  -4}, {   2,  -1}, {  -2,   1}, {  -4,  -1},
+        {  -3,  -3}, {   0,  -4}, {   1,  -2}, {   0,   1}, {  -1,   1}, {  -2,   0}, {  -3,  -2}, {  -1,  -3},
+        {   0,  -2}, {   1,   0}, {  -1,  -1},
+    },
+    { // 58
+        {  -5,   7}, { -19,   2}, { -21, -13}, {  -9, -22}, {   4, -16}, {   6,  -2}, { -10,   5}, { -16,  -4},
+        { -12, -14}, {  -1, -16}, {   5,  -7}, {   1,   3}, {  -3,   4}, { -10,   1}, { -11,  -7}, {  -5, -12},
+        {   2,  -9}, {   3,  -1}, {  -5,   2}, {  -8,  -2}, {  -6,  -7}, {  -1,  -8}, {   3,  -4}, {   1,   2},
+        {  -1,   2}, {  -5,   0}, {  -5,  -3}, {  -2,  -5}, {   1,  -4}, {   2,   0}, {  -2,   1}, {  -4,  -1},
+        {  -3,  -3}, {   0,  -3}, {   1,  -2}, {   0,   1}, {  -1,   1}, {  -2,   0}, {  -3,  -2}, {  -1,  -3},
+        {   1,  -2}, {   1,   0}, {  -1,  -1},
+    },
+    { // 59
+        {  -6,   7}, { -19,   1}, { -21, -13}, {  -9, -22}, {   4, -16}, {   6,  -2}, { -10,   5}, { -16,  -4},
+        { -12, -14}, {  -1, -16}, {   5,  -7}, {   1,   3}, {  -3,   4}, { -10,   1}, { -11,  -7}, {  -5, -12},
+        {   2,  -9}, {   3,  -1}, {  -5,   2}, {  -8,  -2}, {  -6,  -7}, {  -1,  -8}, {   3,  -3}, {   1,   2},
+        {  -1,   2}, {  -5,   0}, {  -5,  -3}, {  -2,  -5}, {   1,  -4}, {   2,   0}, {  -2,   1}, {  -4,  -1},
+        {  -3,  -3}, {   0,  -3}, {   1,  -2}, {   0,   1}, {  -1,   1}, {  -2,   0}, {  -3,  -2}, {  -1,  -3},
+        {   1,  -2}, {   1,   0}, {  -1,  -1},
+    },
+    { // 60
+        {  -6,   7}, { -19,   1}, { -21, -13}, {  -9, -22}, {   5, -16}, {   6,  -1}, { -10,   5}, { -16,  -4},
+        { -12, -14}, {  -1, -16}, {   5,  -7}, {   1,   3}, {  -3,   4}, { -10,   1}, { -11,  -7}, {  -5, -12},
+        {   2,  -9}, {   3,  -1}, {  -5,   2}, {  -8,  -2}, {  -6,  -7}, {   0,  -8}, {   3,  -3}, {   0,   2},
+        {  -1,   2}, {  -5,   0}, {  -5,  -3}, {  -2,  -5}, {   1,  -4}, {   2,   0}, {  -2,   1}, {  -4,  -1},
+        {  -3,  -3}, {   0,  -3}, {   1,  -1}, {   0,   1}, {  -1,   1}, {  -2,   0}, {  -3,  -2}, {  -1,  -3},
+        {   1,  -2}, {   1,   0}, {  -1,  -1},
+    },
+    { // 61
+        {  -6,   7}, { -19,   1}, { -21, -14}, {  -8, -22}, {   5, -16}, {   6,  -1}, { -10,   4}, { -16,  -5},
+        { -12, -15}, {  -1, -15}, {   5,  -6}, {   1,   4}, {  -3,   4}, { -11,   0}, { -11,  -7}, {  -5, -12},
+        {   3,  -8}, {   3,  -1}, {  -5,   2}, {  -8,  -2}, {  -6,  -7}, {   0,  -8}, {   3,  -3}, {   0,   2},
+        {  -2,   2}, {  -5,   0}, {  -5,  -3}, {  -2,  -5}, {   1,  -4}, {   1,   0}, {  -2,   1}, {  -4,  -1},
+        {  -3,  -3}, {   0,  -3}, {   1,  -1}, {   0,   1}, {  -1,   1}, {  -2,   0}, {  -3,  -2}, {  -1,  -3},
+        {   1,  -2}, {   1,   0}, {  -1,  -1},
+    },
+    { // 62
+        {  -7,   7}, { -20,   1}, { -20, -14}, {  -8, -22}, {   5, -15}, {   6,  -1}, { -11,   4}, { -16,  -5},
+        { -11, -15}, {   0, -15}, {   5,  -6}, {   0,   4}, {  -4,   4}, { -11,   0}, { -11,  -8}, {  -4, -12},
+        {   3,  -8}, {   3,   0}, {  -5,   2}, {  -8,  -2}, {  -6,  -7}, {   0,  -8}, {   3,  -3}, {   0,   2},
+        {  -2,   2}, {  -5,   0}, {  -5,  -4}, {  -2,  -5}, {   1,  -4}, {   1,   0}, {  -2,   1}, {  -4,  -1},
+        {  -3,  -3}, {   0,  -3}, {   1,  -1}, {   0,   1}, {  -1,   1}, {  -2,   0}, {  -3,  -2}, {  -1,  -3},
+        {   1,  -2}, {   1,   0}, {  -1,  -1},
+    },
+    { // 63
+        {  -7,   7}, { -20,   0}, { -20, -14}, {  -8, -22}, {   5, -15}, {   6,   0}, { -11,   4}, { -16,  -5},
+        { -11, -15}, {   0, -15}, {   5,  -6}, {   0,   4}, {  -4,   4}, { -11,   0}, { -11,  -8}, {  -4, -12},
+        {   3,  -8}, {   3,   0}, {  -5,   2}, {  -8,  -3}, {  -6,  -7}, {   0,  -8}, {   3,  -3}, {   0,   2},
+        {  -2,   2}, {  -5,   0}, {  -5,  -4}, {  -2,  -5}, {   1,  -4}, {   1,   0}, {  -2,   1}, {  -4,  -1},
+        {  -2,  -3}, {   0,  -3}, {   1,  -1}, {   0,   1}, {  -1,   1}, {  -2,   0}, {  -3,  -2}, {  -1,  -3},
+        {   1,  -2}, {   1,   0}, {  -1,  -1},
+    },
+    { // 64
+        {  -7,   7}, { -20,   0}, { -20, -15}, {  -7, -22}, {   5, -15}, {   5,   0}, { -11,   4}, { -16,  -5},
+        { -11, -15}, {   0, -15}, {   6,  -6}, {   0,   4}, {  -4,   4}, { -11,   0}, { -11,  -8}, {  -4, -12},
+        {   3,  -8}, {   3,   0}, {  -5,   2}, {  -8,  -3}, {  -6,  -8}, {   0,  -8}, {   3,  -3}, {   0,   2},
+        {  -2,   2}, {  -5,   0}, {  -5,  -4}, {  -2,  -6}, {   1,  -4}, {   1,   0}, {  -2,   1}, {  -4,  -1},
+        {  -2,  -3}, {   0,  -3}, {   1,  -1}, {   0,   1}, {  -1,   1}, {  -3,   0}, {  -3,  -2}, {  -1,  -3},
+        {   1,  -2}, {   1,   0}, {  -1,  -1},
+    },
+    { // 65
+        {  -8,   7}, { -20,   0}, { -20, -15}, {  -7, -22}, {   6, -14}, {   5,   0}, { -11,   4}, { -16,  -6},
+        { -11, -15}, {   0, -15}, {   5,  -5}, {   0,   4}, {  -4,   4}, { -11,   0}, { -11,  -8}, {  -4, -12},
+        {   3,  -8}, {   3,   0}, {  -6,   2}, {  -8,  -3}, {  -5,  -8}, {   0,  -7}, {   3,  -3}, {   0,   2},
+        {  -2,   2}, {  -5,   0}, {  -5,  -4}, {  -2,  -5}, {   1,  -4}, {   1,   0}, {  -2,   1}, {  -4,  -1},
+        {  -2,  -3}, {   0,  -3}, {   1,  -1}, {   0,   1}, {  -1,   1}, {  -3,   0}, {  -2,  -2}, {  -1,  -3},
+        {   1,  -2}, {   1,   0}, {  -1,  -1},
+    },
+    { // 66
+        {  -8,   7}, { -20,  -1}, { -20, -15}, {  -7, -22}, {   6, -14}, {   5,   1}, { -11,   4}, { -16,  -6},
+        { -11, -15}, {   0, -15}, {   5,  -5}, {   0,   4}, {  -4,   4}, { -11,   0}, { -11,  -8}, {  -4, -12},
+        {   3,  -8}, {   3,   0}, {  -6,   2}, {  -8,  -3}, {  -5,  -8}, {   0,  -7}, {   3,  -2}, {   0,   2},
+        {  -2,   2}, {  -5,   0}, {  -5,  -4}, {  -2,  -5}, {   1,  -4}, {   1,   0}, {  -3,   1}, {  -4,  -1},
+        {  -2,  -3}, {   0,  -3}, {   1,  -1}, {   0,   1}, {  -1,   1}, {  -3,   0}, {  -2,  -2}, {  -1,  -3},
+        {   1,  -2}, {   1,   0}, {  -1,  -1},
+    },
+    { // 67
+        {  -8,   7}, { -21,  -1}, { -19, -16}, {  -6, -22}, {   6, -14}, {   5,   1}, { -12,   4}, { -16,  -6},
+        { -10, -15}, {   1, -15}, {   5,  -5}, {  -1,   4}, {  -5,   4}, { -11,  -1}, { -11,  -8}, {  -3, -12},
+        {   3,  -7}, {   3,   0}, {  -6,   2}, {  -8,  -3}, {  -5,  -8}, {   0,  -7}, {   3,  -2}, {   0,   2},
+        {  -2,   2}, {  -5,   0}, {  -5,  -4}, {  -2,  -5}, {   1,  -3}, {   1,   0}, {  -3,   1}, {  -4,  -1},
+        {  -2,  -3}, {   0,  -3}, {   1,  -1}, {   0,   1}, {  -1,   1}, {  -3,   0}, {  -2,  -2}, {  -1,  -3},
+        {   1,  -2}, {   1,   0}, {  -1,  -1},
+    },
+    { // 68
+        {  -9,   7}, { -21,  -1}, { -19, -16}, {  -6, -22}, {   6, -13}, {   5,   1}, { -12,   3}, { -16,  -7},
+        { -10, -16}, {   1, -14}, {   5,  -4}, {  -1,   5}, {  -5,   4}, { -11,  -1}, { -10,  -9}, {  -3, -12},
+        {   3,  -7}, {   2,   1}, {  -6,   2}, {  -8,  -3}, {  -5,  -8}, {   0,  -7}, {   3,  -2}, {   0,   2},
+        {  -2,   2}, {  -5,   0}, {  -5,  -4}, {  -1,  -5}, {   2,  -3}, {   1,   0}, {  -3,   1}, {  -4,  -1},
+        {  -2,  -3}, {   0,  -3}, {   1,  -1}, {   0,   1}, {  -1,   1}, {  -3,   0}, {  -2,  -2}, {  -1,  -3},
+        {   1,  -2}, {   1,   0}, {  -1,  -1},
+    },
+    { // 69
+        {  -9,   7}, { -21,  -2}, { -19, -16}, {  -6, -22}, {   6, -13}, {   4,   1}, { -12,   3}, { -16,  -7},
+        { -10, -16}, {   1, -14}, {   5,  -4}, {  -1,   5}, {  -5,   4}, { -11,  -1}, { -10,  -9}, {  -3, -12},
+        {   3,  -7}, {   2,   1}, {  -6,   2}, {  -8,  -3}, {  -5,  -8}, {   1,  -7}, {   3,  -2}, {  -1,   2},
+        {  -2,   2}, {  -5,   0}, {  -5,  -4}, {  -1,  -5}, {   2,  -3}, {   1,   0}, {  -3,   1}, {  -4,  -2},
+        {  -2,  -3}, {   0,  -3}, {   1,  -1}, {   0,   1}, {  -1,   1}, {  -3,   0}, {  -2,  -2}, {  -1,  -3},
+        {   1,  -2}, {   1,   0}, {  -1,  -1},
+    },
+    { // 70
+        {  -9,   7}, { -21,  -2}, { -19, -16}, {  -5, -22}, {   6, -13}, {   4,   2}, { -12,   3}, { -16,  -7},
+        { -10, -16}, {   1, -14}, {   5,  -4}, {  -1,   5}, {  -5,   4}, { -11,  -1}, { -10,  -9}, {  -3, -12},
+        {   3,  -7}, {   2,   1}, {  -6,   2}, {  -8,  -4}, {  -5,  -8}, {   1,  -7}, {   3,  -2}, {  -1,   2},
+        {  -2,   2}, {  -5,   0}, {  -5,  -4}, {  -1,  -5}, {   2,  -3}, {   1,   0}, {  -3,   1}, {  -4,  -2},
+        {  -2,  -3}, {   0,  -3}, {   1,  -1}, {   0,   1}, {  -1,   1}, {  -3,   0}, {  -2,  -2}, {  -1,  -3},
+        {   1,  -2}, {   1,   0}, {  -1,  -1},
+    },
+    { // 71
+        { -10,   7}, { -21,  -2}, { -19, -17}, {  -5, -22}, {   6, -12}, {   4,   2}, { -13,   3}, { -16,  -7},
+        {  -9, -16}, {   2, -14}, {   5,  -4}, {  -2,   5}, {  -5,   4}, { -11,  -1}, { -10,  -9}, {  -3, -12},
+        {   3,  -7}, {   2,   1}, {  -6,   1}, {  -8,  -4}, {  -5,  -8}, {   1,  -7}, {   3,  -2}, {  -1,   2},
+        {  -2,   2}, {  -5,  -1}, {  -5,  -4}, {  -1,  -5}, {   2,  -3}, {   1,   1}, {  -3,   1}, {  -4,  -2},
+        {  -2,  -4}, {   0,  -3}, {   1,  -1}, {   0,   1}, {  -1,   1}, {  -3,   0}, {  -2,  -2}, {  -1,  -3},
+        {   1,  -2}, {   0,   0}, {  -1,  -1},
+    },
+    { // 72
+        { -10,   7}, { -21,  -3}, { -18, -17}, {  -4, -22}, {   7, -12}, {   4,   2}, { -13,   3}, { -16,  -8},
+        {  -9, -16}, {   2, -14}, {   5,  -3}, {  -2,   5}, {  -6,   4}, { -11,  -1}, { -10,  -9}, {  -2, -12},
+        {   4,  -7}, {   2,   1}, {  -6,   1}, {  -8,  -4}, {  -5,  -8}, {   1,  -7}, {   3,  -2}, {  -1,   2},
+        {  -3,   2}, {  -5,  -1}, {  -5,  -4}, {  -1,  -5}, {   2,  -3}, {   1,   1}, {  -3,   1}, {  -4,  -2},
+        {  -2,  -4}, {   0,  -3}, {   1,  -1}, {   0,   1}, {  -1,   1}, {  -3,   0}, {  -2,  -2}, {  -1,  -3},
+        {   1,  -2}, {   0,   0}, {  -1,  -1},
+    },
+    { // 73
+        { -11,   7}, { -21,  -3}, { -18, -17}, {  -4, -22}, {   7, -12}, {   3,   3}, { -13,   3}, { -16,  -8},
+        {  -9, -16}, {   2, -14}, {   5,  -3}, {  -2,   5}, {  -6,   4}, { -12,  -2}, { -10,  -9}, {  -2, -12},
+        {   4,  -6}, {   2,   1}, {  -6,   1}, {  -8,  -4}, {  -4,  -8}, {   1,  -7}, {   3,  -2}, {  -1,   2},
+        {  -3,   2}, {  -5,  -1}, {  -5,  -4}, {  -1,  -5}, {   2,  -3}, {   1,   1}, {  -3,   1}, {  -4,  -2},
+        {  -2,  -4}, {   0,  -3}, {   1,  -1}, {   0,   1}, {  -1,   1}, {  -3,   0}, {  -2,  -2}, {  -1,  -3},
+        {   1,  -1}, {   0,   0}, {  -1,  -1},
+    },
+    { // 74
+        { -11,   7}, { -21,  -3}, { -18, -18}, {  -4, -22}, {   7, -11}, {   3,   3}, { -13,   2}, { -16,  -8},
+        {  -9, -16}, {   2, -13}, {   5,  -3}, {  -2,   5}, {  -6,   4}, { -12,  -2}, { -10,  -9}, {  -2, -12},
+        {   4,  -6}, {   2,   2}, {  -7,   1}, {  -8,  -4}, {  -4,  -8}, {   1,  -7}, {   3,  -1}, {  -1,   3},
+        {  -3,   2}, {  -5,  -1}, {  -4,  -4}, {  -1,  -5}, {   2,  -3}, {   1,   1}, {  -3,   1}, {  -4,  -2},
+        {  -2,  -4}, {   0,  -3}, {   1,  -1}, {  -1,   1}, {  -1,   1}, {  -3,   0}, {  -2,  -2}, {   0,  -3},
+        {   1,  -1}, {   0,   0}, {  -1,  -1},
+    },
+    { // 75
+        { -11,   7}, { -22,  -4}, { -18, -18}, {  -3, -21}, {   7, -11}, {   3,   3}, { -13,   2}, { -16,  -8},
+        {  -8, -16}, {   2, -13}, {   5,  -3}, {  -3,   5}, {  -6,   4}, { -12,  -2}, { -10, -10}, {  -2, -12},
+        {   4,  -6}, {   2,   2}, {  -7,   1}, {  -8,  -4}, {  -4,  -8}, {   1,  -7}, {   3,  -1}, {  -1,   3},
+        {  -3,   2}, {  -5,  -1}, {  -4,  -4}, {  -1,  -5}, {   2,  -3}, {   1,   1}, {  -3,   0}, {  -4,  -2},
+        {  -2,  -4}, {   1,  -3}, {   1,  -1}, {  -1,   1}, {  -1,   1}, {  -3,   0}, {  -2,  -2}, {   0,  -3},
+        {   1,  -1}, {   0,   0}, {  -1,  -1},
+    },
+    { // 76
+        { -12,   7}, { -22,  -4}, { -17, -18}, {  -3, -21}, {   7, -11}, {   3,   3}, { -14,   2}, { -16,  -9},
+        {  -8, -16}, {   3, -13}, {   5,  -2}, {  -3,   5}, {  -6,   4}, { -12,  -2}, {  -9, -10}, {  -2, -12},
+        {   4,  -6}, {   1,   2}, {  -7,   1}, {  -8,  -4}, {  -4,  -8}, {   1,  -7}, {   3,  -1}, {  -2,   3},
+        {  -3,   2}, {  -5,  -1}, {  -4,  -5}, {  -1,  -5}, {   2,  -3}, {   1,   1}, {  -3,   0}, {  -4,  -2},
+        {  -2,  -4}, {   1,  -3}, {   1,  -1}, {  -1,   1}, {  -1,   1}, {  -3,  -1}, {  -2,  -2}, {   0,  -3},
+        {   1,  -1}, {   0,   0}, {  -1,  -1},
+    },
+    { // 77
+        { -12,   7}, { -22,  -4}, { -17, -18}, {  -3, -21}, {   7, -10}, {   2,   4}, { -14,   2}, { -16,  -9},
+        {  -8, -16}, {   3, -13}, {   5,  -2}, {  -3,   5}, {  -6,   4}, { -12,  -2}, {  -9, -10}, {  -1, -12},
+        {   4,  -6}, {   1,   2}, {  -7,   1}, {  -8,  -4}, {  -4,  -8}, {   1,  -6}, {   2,  -1}, {  -2,   3},
+        {  -3,   2}, {  -5,  -1}, {  -4,  -5}, {  -1,  -5}, {   2,  -3}, {   1,   1}, {  -3,   0}, {  -4,  -2},
+        {  -2,  -4}, {   1,  -3}, {   1,   0}, {  -1,   1}, {  -1,   1}, {  -3,  -1}, {  -2,  -2}, {   0,  -3},
+        {   1,  -1}, {   0,   0}, {  -1,  -1},
+    },
+    { // 78
+        { -12,   6}, { -22,  -5}, { -17, -19}, {  -2, -21}, {   7, -10}, {   2,   4}, { -14,   2}, { -16,  -9},
+        {  -7, -16}, {   3, -13}, {   5,  -2}, {  -4,   5}, {  -7,   4}, { -12,  -3}, {  -9, -10}, {  -1, -11},
+        {   4,  -5}, {   1,   2}, {  -7,   1}, {  -8,  -5}, {  -4,  -8}, {   1,  -6}, {   2,  -1}, {  -2,   3},
+        {  -3,   2}, {  -5,  -1}, {  -4,  -5}, {  -1,  -5}, {   2,  -2}, {   1,   1}, {  -3,   0}, {  -4,  -2},
+        {  -2,  -4}, {   1,  -3}, {   1,   0}, {  -1,   1}, {  -2,   1}, {  -3,  -1}, {  -2,  -2}, {   0,  -3},
+        {   1,  -1}, {   0,   0}, {  -1,  -1},
+    },
+    { // 79
+        { -13,   6}, { -22,  -5}, { -17, -19}, {  -2, -21}, {   7, -10}, {   2,   4}, { -14,   1}, { -16,  -9},
+        {  -7, -16}, {   3, -12}, {   5,  -2}, {  -4,   5}, {  -7,   3}, { -12,  -3}, {  -9, -10}, {  -1, -11},
+        {   4,  -5}, {   1,   2}, {  -7,   1}, {  -8,  -5}, {  -4,  -8}, {   2,  -6}, {   2,  -1}, {  -2,   3},
+        {  -3,   2}, {  -5,  -1}, {  -4,  -5}, {  -1,  -5}, {   2,  -2}, {   0,   1}, {  -3,   0}, {  -4,  -2},
+        {  -2,  -4}, {   1,  -3}, {   1,   0}, {  -1,   1}, {  -2,   1}, {  -3,  -1}, {  -2,  -2}, {   0,  -3},
+        {   1,  -1}, {   0,   1}, {  -1,  -1},
+    },
+    { // 80
+        { -13,   6}, { -22,  -5}, { -16, -19}, {  -2, -21}, {   7,  -9}, {   2,   4}, { -14,   1}, { -16, -10},
+        {  -7, -16}, {   3, -12}, {   5,  -1}, {  -4,   5}, {  -7,   3}, { -12,  -3}, {  -9, -10}, {  -1, -11},
+        {   4,  -5}, {   1,   2}, {  -7,   1}, {  -8,  -5}, {  -3,  -8}, {   2,  -6}, {   2,  -1}, {  -2,   3},
+        {  -3,   2}, {  -5,  -1}, {  -4,  -5}, {   0,  -5}, {   2,  -2}, {   0,   1}, {  -3,   0}, {  -3,  -2},
+        {  -2,  -4}, {   1,  -3}, {   1,   0}, {  -1,   1}, {  -2,   1}, {  -3,  -1}, {  -2,  -2}, {   0,  -3},
+        {   1,  -1}, {   0,   1}, {  -1,  -1},
+    },
+    { // 81
+        { -13,   6}, { -22,  -6}, { -16, -19}, {  -1, -21}, {   7,  -9}, {   1,   5}, { -14,   1}, { -16, -10},
+        {  -7, -16}, {   3, -12}, {   5,  -1}, {  -4,   5}, {  -7,   3}, { -12,  -3}, {  -9, -10}, {  -1, -11},
+        {   4,  -5}, {   1,   2}, {  -7,   0}, {  -8,  -5}, {  -3,  -8}, {   2,  -6}, {   2,  -1}, {  -2,   3},
+        {  -3,   2}, {  -5,  -1}, {  -4,  -5}, {   0,  -5}, {   2,  -2}, {   0,   1}, {  -3,   0}, {  -3,  -2},
+        {  -1,  -4}, {   1,  -3}, {   1,   0}, {  -1,   1}, {  -2,   1}, {  -3,  -1}, {  -2,  -2}, {   0,  -3},
+        {   1,  -1}, {   0,   1}, {  -1,  -1},
+    },
+    { // 82
+        { -14,   6}, { -22,  -6}, { -16, -19}, {  -1, -21}, {   7,  -9}, {   1,   5}, { -15,   1}, { -15, -10},
+        {  -6, -16}, {   4, -12}, {   4,  -1}, {  -5,   5}, {  -7,   3}, { -12,  -3}, {  -8, -11}, {  -1, -11},
+        {   4,  -5}, {   1,   3}, {  -7,   0}, {  -8,  -5}, {  -3,  -8}, {   2,  -6}, {   2,   0}, {  -2,   3},
+        {  -3,   1}, {  -5,  -2}, {  -4,  -5}, {   0,  -5}, {   2,  -2}, {   0,   1}, {  -3,   0}, {  -3,  -2},
+        {  -1,  -4}, {   1,  -3}, {   1,   0}, {  -1,   1}, {  -2,   1}, {  -3,  -1}, {  -2,  -2}, {   0,  -3},
+        {   1,  -1}, {   0,   1}, {  -1,  -1},
+    },
+    { // 83
+        { -14,   6}, { -22,  -6}, { -15, -20}, {  -1, -20}, {   7,  -8}, {   1,   5}, { -15,   1}, { -15, -10},
+        {  -6, -16}, {   4, -12}, {   4,  -1}, {  -5,   5}, {  -8,   3}, { -12,  -4}, {  -8, -11}, {   0, -11},
+        {   4,  -4}, {   0,   3}, {  -7,   0}, {  -8,  -5}, {  -3,  -8}, {   2,  -6}, {   2,   0}, {  -2,   3},
+        {  -3,   1}, {  -5,  -2}, {  -4,  -5}, {   0,  -5}, {   2,  -2}, {   0,   1}, {  -3,   0}, {  -3,  -2},
+        {  -1,  -4}, {   1,  -3}, {   1,   0}, {  -1,   1}, {  -2,   1}, {  -3,  -1}, {  -2,  -2}, {   0,  -3},
+        {   1,  -1}, {   0,   1}, {  -1,  -1},
+    },
+    { // 84
+        { -14,   6}, { -22,  -7}, { -15, -20}, {   0, -20}, {   7,  -8}, {   0,   5}, { -15,   0}, { -15, -11},
+        {  -6, -16}, {   4, -11}, {   4,   0}, {  -5,   5}, {  -8,   3}, { -12,  -4}, {  -8, -11}, {   0, -11},
+        {   4,  -4}, {   0,   3}, {  -7,   0}, {  -8,  -5}, {  -3,  -8}, {   2,  -6}, {   2,   0}, {  -3,   3},
+        {  -4,   1}, {  -5,  -2}, {  -4,  -5}, {   0,  -5}, {   2,  -2}, {   0,   1}, {  -3,   0}, {  -3,  -2},
+        {  -1,  -4}, {   1,  -3}, {   1,   0}, {  -1,   1}, {  -2,   1}, {  -3,  -1}, {  -2,  -2}, {   0,  -3},
+        {   1,  -1}, {   0,   1}, {  -1,  -1},
+    },
+    { // 85
+        { -15,   5}, { -22,  -7}, { -15, -20}, {   0, -20}, {   7,  -7}, {   0,   5}, { -15,   0}, { -15, -11},
+        {  -6, -16}, {   4, -11}, {   4,   0}, {  -5,   5}, {  -8,   3}, { -12,  -4}, {  -8, -11}, {   0, -11},
+        {   4,  -4}, {   0,   3}, {  -7,   0}, {  -8,  -5}, {  -3,  -8}, {   2,  -6}, {   2,   0}, {  -3,   3},
+        {  -4,   1}, {  -5,  -2}, {  -4,  -5}, {   0,  -5}, {   2,  -2}, {   0,   1}, {  -3,   0}, {  -3,  -2},
+        {  -1,  -4}, {   1,  -2}, {   1,   0}, {  -1,   1}, {  -2,   1}, {  -3,  -1}, {  -2,  -2}, {   0,  -3},
+        {   1,  -1}, {   0,   1}, {  -1,  -1},
+    },
+    { // 86
+        { -15,   5}, { -22,  -8}, { -14, -20}, {   0, -20}, {   7,  -7}, {   0,   5}, { -15,   0}, { -15, -11},
+        {  -5, -16}, {   4, -11}, {   4,   0}, {  -6,   5}, {  -8,   3}, { -12,  -4}, {  -8, -11}, {   0, -11},
+        {   4,  -4}, {   0,   3}, {  -8,   0}, {  -7,  -6}, {  -3,  -8}, {   2,  -5}, {   2,   0}, {  -3,   3},
+        {  -4,   1}, {  -5,  -2}, {  -4,  -5}, {   0,  -5}, {   2,  -2}, {   0,   1}, {  -3,   0}, {  -3,  -2},
+        {  -1,  -4}, {   1,  -2}, {   1,   0}, {  -1,   1}, {  -2,   1}, {  -3,  -1}, {  -2,  -3}, {   0,  -2},
+        {   1,  -1}, {   0,   1}, {  -1,  -1},
+    },
+    { // 87
+        { -15,   5}, { -22,  -8}, { -14, -20}, {   1, -20}, {   7,  -7}, {  -1,   6}, { -15,   0}, { -15, -11},
+        {  -5, -16}, {   4, -11}, {   4,   0}, {  -6,   5}, {  -8,   3}, { -12,  -4}, {  -8, -11}, {   0, -11},
+        {   4,  -4}, {   0,   3}, {  -8,   0}, {  -7,  -6}, {  -3,  -8}, {   2,  -5}, {   2,   0}, {  -3,   3},
+        {  -4,   1}, {  -5,  -2}, {  -4,  -5}, {   0,  -5}, {   2,  -2}, {   0,   1}, {  -3,   0}, {  -3,  -3},
+        {  -1,  -4}, {   1,  -2}, {   1,   0}, {  -1,   1}, {  -2,   1}, {  -3,  -1}, {  -2,  -3}, {   0,  -2},
+        {   1,  -1}, {   0,   1}, {  -1,  -1},
+    },
+    { // 88
+        { -15,   5}, { -22,  -8}, { -14, -20}, {   1, -20}, {   7,  -6}, {  -1,   6}, { -15,  -1}, { -15, -12},
+        {  -5, -16}, {   4, -10}, {   4,   1}, {  -6,   5}, {  -8,   3}, { -12,  -4}, {  -7, -11}, {   0, -11},
+        {   4,  -3}, {   0,   3}, {  -8,   0}, {  -7,  -6}, {  -2,  -8}, {   2,  -5}, {   2,   0}, {  -3,   3},
+        {  -4,   1}, {  -5,  -2}, {  -3,  -5}, {   0,  -5}, {   2,  -2}, {   0,   1}, {  -3,   0}, {  -3,  -3},
+        {  -1,  -4}, {   1,  -2}, {   1,   0}, {  -1,   1}, {  -2,   1}, {  -3,  -1}, {  -2,  -3}, {   0,  -2},
+        {   1,  -1}, {   0,   1}, {  -1,  -1},
+    },
+    { // 89
+        { -16,   5}, { -22,  -9}, { -13, -21}, {   1, -19}, {   7,  -6}, {  -1,   6}, { -15,  -1}, { -14, -12},
+        {  -5, -16}, {   4, -10}, {   3,   1}, {  -6,   5}, {  -9,   3}, { -12,  -5}, {  -7, -11}, {   1, -10},
+        {   4,  -3}, {  -1,   3}, {  -8,   0}, {  -7,  -6}, {  -2,  -8}, {   2,  -5}, {   2,   0}, {  -3,   3},
+        {  -4,   1}, {  -5,  -2}, {  -3,  -5}, {   0,  -5}, {   2,  -2}, {   0,   1}, {  -3,   0}, {  -3,  -3},
+        {  -1,  -4}, {   1,  -2}, {   1,   0}, {  -1,   1}, {  -2,   1}, {  -3,  -1}, {  -2,  -3}, {   0,  -2},
+        {   1,  -1}, {   0,   1}, {  -1,  -1},
+    },
+    { // 90
+        { -16,   4}, { -22,  -9}, { -13, -21}, {   1, -19}, {   7,  -6}, {  -1,   6}, { -16,  -1}, { -14, -12},
+        {  -4, -16}, {   5, -10}, {   3,   1}, {  -7,   5}, {  -9,   2}, { -12,  -5}, {  -7, -11}, {   1, -10},
+        {   4,  -3}, {  -1,   3}, {  -8,  -1}, {  -7,  -6}, {  -2,  -8}, {   2,  -5}, {   2,   1}, {  -3,   3},
+        {  -4,   1}, {  -5,  -2}, {  -3,  -5}, {   0,  -5}, {   2,  -1}, {   0,   2}, {  -3,   0}, {  -3,  -3},
+        {  -1,  -4}, {   1,  -2}, {   1,   0}, {  -2,   1}, {  -2,   1}, {  -3,  -1}, {  -2,  -3}, {   0,  -2},
+        {   1,  -1}, {   0,   1}, {  -1,  -1},
+    },
+    { // 91
+        { -16,   4}, { -22,  -9}, { -13, -21}, {   2, -19}, {   7,  -5}, {  -2,   6}, { -16,  -1}, { -14, -12},
+        {  -4, -16}, {   5, -10}, {   3,   1}, {  -7,   5}, {  -9,   2}, { -12,  -5}, {  -7, -11}, {   1, -10},
+        {   4,  -3}, {  -1,   3}, {  -8,  -1}, {  -7,  -6}, {  -2,  -8}, {   2,  -5}, {   2,   1}, {  -4,   3},
+        {  -4,   1}, {  -5,  -2}, {  -3,  -5}, {   0,  -5}, {   2,  -1}, {   0,   2}, {  -3,   0}, {  -3,  -3},
+        {  -1,  -4}, {   1,  -2}, {   1,   0}, {  -2,   1}, {  -2,   1}, {  -3,  -1}, {  -2,  -3}, {   0,  -2},
+        {   1,  -1}, {   0,   1}, {  -1,  -1},
+    },
+    { // 92
+        { -17,   4}, { -22, -10}, { -12, -21}, {   2, -19}, {   7,  -5}, {  -2,   6}, { -16,  -2}, { -14, -12},
+        {  -4, -16}, {   5,  -9}, {   3,   1}, {  -7,   5}, {  -9,   2}, { -12,  -5}, {  -7, -11}, {   1, -10},
+        {   4,  -3}, {  -1,   3}, {  -8,  -1}, {  -7,  -6}, {  -2,  -8}, {   2,  -5}, {   2,   1}, {  -4,   3},
+        {  -4,   1}, {  -5,  -2}, {  -3,  -5}, {   0,  -5}, {   2,  -1}, {  -1,   2}, {  -4,   0}, {  -3,  -3},
+        {  -1,  -4}, {   1,  -2}, {   1,   0}, {  -2,   1}, {  -2,   1}, {  -3,  -1}, {  -2,  -3}, {   0,  -2},
+        {   1,  -1}, {   0,   1}, {  -1,  -1},
+    },
+    { // 93
+        { -17,   4}, { -22, -10}, { -12, -21}, {   2, -18}, {   7,  -5}, {  -3,   7}, { -16,  -2}, { -14, -13},
+        {  -3, -16}, {   5,  -9}, {   3,   2}, {  -8,   5}, {  -9,   2}, { -12,  -5}, {  -7, -11}, {   1, -10},
+        {   4,  -2}, {  -1,   4}, {  -8,  -1}, {  -7,  -6}, {  -2,  -8}, {   2,  -5}, {   1,   1}, {  -4,   3},
+        {  -4,   1}, {  -5,  -3}, {  -3,  -5}, {   1,  -5}, {   2,  -1}, {  -1,   2}, {  -4,   0}, {  -3,  -3},
+        {  -1,  -4}, {   1,  -2}, {   1,   0}, {  -2,   1}, {  -2,   0}, {  -3,  -1}, {  -2,  -3}, {   0,  -2},
+        {   1,  -1}, {   0,   1}, {  -1,  -1},
+    },
+    { // 94
+        { -17,   4}, { -22, -10}, { -12, -21}, {   3, -18}, {   7,  -4}, {  -3,   7}, { -16,  -2}, { -14, -13},
+        {  -3, -16}, {   5,  -9}, {   3,   2}, {  -8,   5}, {  -9,   2}, { -12,  -6}, {  -6, -12}, {   1, -10},
+        {   4,  -2}, {  -2,   4}, {  -8,  -1}, {  -7,  -6}, {  -2,  -8}, {   2,  -4}, {   1,   1}, {  -4,   3},
+        {  -4,   1}, {  -5,  -3}, {  -3,  -5}, {   1,  -5}, {   2,  -1}, {  -1,   2}, {  -4,   0}, {  -3,  -3},
+        {  -1,  -4}, {   1,  -2}, {   1,   0}, {  -2,   1}, {  -2,   0}, {  -3,  -1}, {  -1,  -3}, {   0,  -2},
+        {   1,  -1}, {   0,   1}, {  -1,  -1},
+    },
+    { // 95
+        { -17,   3}, { -22, -11}, { -11, -21}, {   3, -18}, {   7,  -4}, {  -3,   7}, { -16,  -2}, { -13, -13},
+        {  -3, -16}, {   5,  -9}, {   2,   2}, {  -8,   5}, {  -9,   2}, { -12,  -6}, {  -6, -12}, {   2, -10},
+        {   4,  -2}, {  -2,   4}, {  -8,  -1}, {  -7,  -7}, {  -1,  -8}, {   3,  -4}, {   1,   1}, {  -4,   3},
+        {  -4,   1}, {  -5,  -3}, {  -3,  -5}, {   1,  -4}, {   2,  -1}, {  -1,   2}, {  -4,  -1}, {  -3,  -3},
+        {  -1,  -4}, {   1,  -2}, {   1,   0}, {  -2,   1}, {  -2,   0}, {  -3,  -1}, {  -1,  -3}, {   0,  -2},
+        {   1,   0}, {   0,   1}, {  -1,  -1},
+    },
+    { // 96
+        { -18,   3}, { -22, -11}, { -11, -22}, {   3, -18}, {   7,  -4}, {  -4,   7}, { -16,  -3}, { -13, -13},
+        {  -3, -16}, {   5,  -8}, {   2,   2}, {  -8,   5}, { -10,   2}, { -12,  -6}, {  -6, -12}, {   2, -10},
+        {   4,  -2}, {  -2,   4}, {  -8,  -1}, {  -7,  -7}, {  -1,  -8}, {   3,  -4}, {   1,   1}, {  -4,   3},
+        {  -4,   1}, {  -5,  -3}, {  -3,  -5}, {   1,  -4}, {   2,  -1}, {  -1,   2}, {  -4,  -1}, {  -3,  -3},
+        {  -1,  -4}, {   1,  -2}, {   1,   1}, {  -2,   1}, {  -2,   0}, {  -3,  -1}, {  -1,  -3}, {   0,  -2},
+        {   1,   0}, {   0,   1}, {  -1,  -1},
+    },
+    { // 97
+        { -18,   3}, { -21, -11}, { -11, -22}, {   3, -17}, {   7,  -3}, {  -4,   7}, { -16,  -3}, { -13, -13},
+        {  -2, -16}, {   5,  -8}, {   2,   2}, {  -9,   5}, { -10,   2}, { -12,  -6}, {  -6, -12}, {   2,  -9},
+        {   4,  -2}, {  -2,   4}, {  -8,  -1}, {  -7,  -7}, {  -1,  -8}, {   3,  -4}, {   1,   1}, {  -4,   3},
+        {  -4,   1}, {  -5,  -3}, {  -3,  -5}, {   1,  -4}, {   2,  -1}, {  -1,   2}, {  -4,  -1}, {  -3,  -3},
+        {  -1,  -4}, {   1,  -2}, {   0,   1}, {  -2,   1}, {  -2,   0}, {  -3,  -1}, {  -1,  -3}, {   0,  -2},
+        {   1,   0}, {   0,   1}, {  -1,  -1},
+    },
+    { // 98
+        { -18,   3}, { -21, -12}, { -10, -22}, {   4, -17}, {   7,  -3}, {  -4,   7}, { -16,  -3}, { -13, -14},
+        {  -2, -16}, {   5,  -8}, {   2,   3}, {  -9,   5}, { -10,   1}, { -12,  -6}, {  -6, -12}, {   2,  -9},
+        {   4,  -2}, {  -2,   4}, {  -8,  -2}, {  -6,  -7}, {  -1,  -8}, {   3,  -4}, {   1,   1}, {  -4,   2},
+        {  -5,   1}, {  -5,  -3}, {  -3,  -5}, {   1,  -4}, {   2,  -1}, {  -1,   2}, {  -4,  -1}, {  -3,  -3},
+        {   0,  -4}, {   1,  -2}, {   0,   1}, {  -2,   1}, {  -2,   0}, {  -3,  -1}, {  -1,  -3}, {   0,  -2},
+        {   1,   0}, {  -1,   1}, {  -1,  -1},
+    },
+    { // 99
+        { -18,   2}, { -21, -12}, { -10, -22}, {   4, -17}, {   7,  -3}, {  -5,   7}, { -16,  -3}, { -13, -14},
+        {  -2, -16}, {   5,  -8}, {   2,   3}, {  -9,   5}, { -10,   1}, { -11,  -7}, {  -5, -12}, {   2,  -9},
+        {   4,  -1}, {  -2,   4}, {  -8,  -2}, {  -6,  -7}, {  -1,  -8}, {   3,  -4}, {   1,   1}, {  -5,   2},
+        {  -5,   1}, {  -5,  -3}, {  -3,  -5}, {   1,  -4}, {   2,  -1}, {  -1,   2}, {  -4,  -1}, {  -3,  -3},
+        {   0,  -4}, {   1,  -2}, {   0,   1}, {  -2,   1}, {  -2,   0}, {  -3,  -2}, {  -1,  -3}, {   0,  -2},
+        {   1,   0}, {  -1,   1}, {  -1,  -1},
+    },
+    { // 100
+        { -19,   2}, { -21, -12}, { -10, -22}, {   4, -17}, {   6,  -2}, {  -5,   7}, { -16,  -4}, { -12, -14},
+        {  -2, -16}, {   5,  -7}, {   1,   3}, {  -9,   5}, { -10,   1}, { -11,  -7}, {  -5, -12}, {   2,  -9},
+        {   3,  -1}, {  -3,   4}, {  -8,  -2}, {  -6,  -7}, {  -1,  -8}, {   3,  -4}, {   1,   2}, {  -5,   2},
+        {  -5,   0}, {  -5,  -3}, {  -2,  -5}, {   1,  -4}, {   2,  -1}, {  -1,   2}, {  -4,  -1}, {  -3,  -3},
+        {   0,  -4}, {   1,  -2}, {   0,   1}, {  -2,   1}, {  -2,   0}, {  -3,  -2}, {  -1,  -3}, {   1,  -2},
+        {   1,   0}, {  -1,   1}, {  -1,  -1},
+    },
+    { // 101
+        { -19,   2}, { -21, -13}, {  -9, -22}, {   4, -16}, {   6,  -2}, {  -5,   7}, { -16,  -4}, { -12, -14},
+        {  -1, -16}, {   5,  -7}, {   1,   3}, { -10,   5}, { -10,   1}, { -11,  -7}, {  -5, -12}, {   2,  -9},
+        {   3,  -1}, {  -3,   4}, {  -8,  -2}, {  -6,  -7}, {  -1,  -8}, {   3,  -4}, {   1,   2}, {  -5,   2},
+        {  -5,   0}, {  -5,  -3}, {  -2,  -5}, {   1,  -4}, {   2,   0}, {  -1,   2}, {  -4,  -1}, {  -3,  -3},
+        {   0,  -3}, {   1,  -2}, {   0,   1}, {  -2,   1}, {  -2,   0}, {  -3,  -2}, {  -1,  -3}, {   1,  -2},
+        {   1,   0}, {  -1,   1}, {  -1,  -1},
+    },
+    { // 102
+        { -19,   1}, { -21, -13}, {  -9, -22}, {   4, -16}, {   6,  -1}, {  -6,   7}, { -16,  -4}, { -12, -14},
+        {  -1, -16}, {   5,  -7}, {   1,   3}, { -10,   5}, { -10,   1}, { -11,  -7}, {  -5, -12}, {   2,  -9},
+        {   3,  -1}, {  -3,   4}, {  -8,  -2}, {  -6,  -7}, {  -1,  -8}, {   3,  -3}, {   1,   2}, {  -5,   2},
+        {  -5,   0}, {  -5,  -3}, {  -2,  -5}, {   1,  -4}, {   2,   0}, {  -1,   2}, {  -4,  -1}, {  -3,  -3},
+        {   0,  -3}, {   1,  -2}, {   0,   1}, {  -2,   1}, {  -2,   0}, {  -3,  -2}, {  -1,  -3}, {   1,  -2},
+        {   1,   0}, {  -1,   1}, {  -1,  -1},
+    },
+    { // 103
+        { -19,   1}, { -21, -13}, {  -9, -22}, {   5, -16}, {   6,  -1}, {  -6,   7}, { -16,  -5}, { -12, -14},
+        {  -1, -15}, {   5,  -6}, {   1,   3}, { -10,   4}, { -10,   1}, { -11,  -7}, {  -5, -12}, {   3,  -9},
+        {   3,  -1}, {  -3,   4}, {  -8,  -2}, {  -6,  -7}, {   0,  -8}, {   3,  -3}, {   0,   2}, {  -5,   2},
+        {  -5,   0}, {  -5,  -3}, {  -2,  -5}, {   1,  -4}, {   1,   0}, {  -2,   2}, {  -4,  -1}, {  -3,  -3},
+        {   0,  -3}, {   1,  -1}, {   0,   1}, {  -2,   1}, {  -2,   0}, {  -3,  -2}, {  -1,  -3}, {   1,  -2},
+        {   1,   0}, {  -1,   1}, {  -1,  -1},
+    },
+    { // 104
+        { -20,   1}, { -20, -14}, {  -8, -22}, {   5, -15}, {   6,  -1}, {  -6,   7}, { -16,  -5}, { -12, -15},
+        {  -1, -15}, {   5,  -6}, {   1,   4}, { -10,   4}, { -11,   0}, { -11,  -7}, {  -4, -12}, {   3,  -8},
+        {   3,   0}, {  -3,   4}, {  -8,  -2}, {  -6,  -7}, {   0,  -8}, {   3,  -3}, {   0,   2}, {  -5,   2},
+        {  -5,   0}, {  -5,  -3}, {  -2,  -5}, {   1,  -4}, {   1,   0}, {  -2,   2}, {  -4,  -1}, {  -3,  -3},
+        {   0,  -3}, {   1,  -1}, {   0,   1}, {  -2,   1}, {  -2,   0}, {  -3,  -2}, {  -1,  -3}, {   1,  -2},
+        {   1,   0}, {  -1,   1}, {  -1,  -1},
+    },
+    { // 105
+        { -20,   1}, { -20, -14}, {  -8, -22}, {   5, -15}, {   6,  -1}, {  -7,   7}, { -16,  -5}, { -11, -15},
+        {   0, -15}, {   5,  -6}, {   0,   4}, { -11,   4}, { -11,   0}, { -11,  -8}, {  -4, -12}, {   3,  -8},
+        {   3,   0}, {  -4,   4}, {  -8,  -3}, {  -6,  -7}, {   0,  -8}, {   3,  -3}, {   0,   2}, {  -5,   2},
+        {  -5,   0}, {  -5,  -4}, {  -2,  -5}, {   1,  -4}, {   1,   0}, {  -2,   2}, {  -4,  -1}, {  -3,  -3},
+        {   0,  -3}, {   1,  -1}, {   0,   1}, {  -2,   1}, {  -2,   0}, {  -3,  -2}, {  -1,  -3}, {   1,  -2},
+        {   1,   0}, {  -1,   1}, {  -1,  -1},
+    },
+    { // 106
+        { -20,   0}, { -20, -14}, {  -8, -22}, {   5, -15}, {   5,   0}, {  -7,   7}, { -16,  -5}, { -11, -15},
+        {   0, -15}, {   5,  -6}, {   0,   4}, { -11,   4}, { -11,   0}, { -11,  -8}, {  -4, -12}, {   3,  -8},
+        {   3,   0}, {  -4,   4}, {  -8,  -3}, {  -6,  -7}, {   0,  -8}, {   3,  -3}, {   0,   2}, {  -5,   2},
+        {  -5,   0}, {  -5,  -4}, {  -2,  -5}, {   1,  -4}, {   1,   0}, {  -2,   2}, {  -4,  -1}, {  -2,  -3},
+        {   0,  -3}, {   1,  -1}, {   0,   1}, {  -2,   1}, {  -2,   0}, {  -3,  -2}, {  -1,  -3}, {   1,  -2},
+        {   1,   0}, {  -1,   1}, {  -1,  -1},
+    },
+    { // 107
+        { -20,   0}, { -20, -15}, {  -7, -22}, {   5, -15}, {   5,   0}, {  -7,   7}, { -16,  -6}, { -11, -15},
+        {   0, -15}, {   5,  -5}, {   0,   4}, { -11,   4}, { -11,   0}, { -11,  -8}, {  -4, -12}, {   3,  -8},
+        {   3,   0}, {  -4,   4}, {  -8,  -3}, {  -5,  -8}, {   0,  -7}, {   3,  -3}, {   0,   2}, {  -6,   2},
+        {  -5,   0}, {  -5,  -4}, {  -2,  -5}, {   1,  -4}, {   1,   0}, {  -2,   2}, {  -4,  -1}, {  -2,  -3},
+        {   0,  -3}, {   1,  -1}, {   0,   1}, {  -2,   1}, {  -3,   0}, {  -2,  -2}, {  -1,  -3}, {   1,  -2},
+        {   1,   0}, {  -1,   1}, {  -1,  -1},
+    },
+    { // 108
+        { -20,   0}, { -20, -15}, {  -7, -22}, {   6, -14}, {   5,   0}, {  -8,   7}, { -16,  -6}, { -11, -15},
+        {   0, -15}, {   5,  -5}, {   0,   4}, { -11,   4}, { -11,   0}, { -11,  -8}, {  -4, -12}, {   3,  -8},
+        {   3,   0}, {  -4,   4}, {  -8,  -3}, {  -5,  -8}, {   0,  -7}, {   3,  -3}, {   0,   2}, {  -6,   2},
+        {  -5,   0}, {  -5,  -4}, {  -2,  -5}, {   1,  -4}, {   1,   0}, {  -2,   2}, {  -4,  -1}, {  -2,  -3},
+        {   0,  -3}, {   1,  -1}, {   0,   1}, {  -3,   1}, {  -3,   0}, {  -2,  -2}, {  -1,  -3}, {   1,  -2},
+        {   1,   0}, {  -1,   1}, {  -1,  -1},
+    },
+    { // 109
+        { -20,  -1}, { -20, -15}, {  -6, -22}, {   6, -14}, {   5,   1}, {  -8,   7}, { -16,  -6}, { -10, -15},
+        {   1, -15}, {   5,  -5}, {  -1,   4}, { -12,   4}, { -11,   0}, { -11,  -8}, {  -4, -12}, {   3,  -8},
+        {   3,   0}, {  -4,   4}, {  -8,  -3}, {  -5,  -8}, {   0,  -7}, {   3,  -2}, {   0,   2}, {  -6,   2},
+        {  -5,   0}, {  -5,  -4}, {  -2,  -5}, {   1,  -3}, {   1,   0}, {  -2,   2}, {  -4,  -1}, {  -2,  -3},
+        {   0,  -3}, {   1,  -1}, {   0,   1}, {  -3,   1}, {  -3,   0}, {  -2,  -2}, {  -1,  -3}, {   1,  -2},
+        {   1,   0}, {  -1,   1}, {  -1,  -1},
+    },
+    { // 110
+        { -21,  -1}, { -19, -16}, {  -6, -22}, {   6, -14}, {   5,   1}, {  -9,   7}, { -16,  -6}, { -10, -15},
+        {   1, -15}, {   5,  -5}, {  -1,   4}, { -12,   4}, { -11,  -1}, { -11,  -8}, {  -3, -12}, {   3,  -7},
+        {   3,   1}, {  -5,   4}, {  -8,  -3}, {  -5,  -8}, {   0,  -7}, {   3,  -2}, {   0,   2}, {  -6,   2},
+        {  -5,   0}, {  -5,  -4}, {  -2,  -5}, {   1,  -3}, {   1,   0}, {  -2,   2}, {  -4,  -1}, {  -2,  -3},
+        {   0,  -3}, {   1,  -1}, {   0,   1}, {  -3,   1}, {  -3,   0}, {  -2,  -2}, {  -1,  -3}, {   1,  -2},
+        {   1,   0}, {  -1,   1}, {  -1,  -1},
+    },
+    { // 111
+        { -21,  -1}, { -19, -16}, {  -6, -22}, {   6, -13}, {   5,   1}, {  -9,   7}, { -16,  -7}, { -10, -16},
+        {   1, -14}, {   5,  -4}, {  -1,   5}, { -12,   3}, { -11,  -1}, { -10,  -9}, {  -3, -12}, {   3,  -7},
+        {   2,   1}, {  -5,   4}, {  -8,  -3}, {  -5,  -8}, {   0,  -7}, {   3,  -2}, {  -1,   2}, {  -6,   2},
+        {  -5,   0}, {  -5,  -4}, {  -1,  -5}, {   2,  -3}, {   1,   0}, {  -2,   2}, {  -4,  -1}, {  -2,  -3},
+        {   0,  -3}, {   1,  -1}, {   0,   1}, {  -3,   1}, {  -3,   0}, {  -2,  -2}, {  -1,  -3}, {   1,  -2},
+        {   1,   0}, {  -1,   1}, {  -1,  -1},
+    },
+    { // 112
+        { -21,  -2}, { -19, -16}, {  -5, -22}, {   6, -13}, {   4,   2}, {  -9,   7}, { -16,  -7}, { -10, -16},
+        {   1, -14}, {   5,  -4}, {  -1,   5}, { -12,   3}, { -11,  -1}, { -10,  -9}, {  -3, -12}, {   3,  -7},
+        {   2,   1}, {  -5,   4}, {  -8,  -3}, {  -5,  -8}, {   1,  -7}, {   3,  -2}, {  -1,   2}, {  -6,   2},
+        {  -5,   0}, {  -5,  -4}, {  -1,  -5}, {   2,  -3}, {   1,   0}, {  -2,   2}, {  -4,  -2}, {  -2,  -3},
+        {   0,  -3}, {   1,  -1}, {   0,   1}, {  -3,   1}, {  -3,   0}, {  -2,  -2}, {  -1,  -3}, {   1,  -2},
+        {   1,   0}, {  -1,   1}, {  -1,  -1},
+    },
+    { // 113
+        { -21,  -2}, { -19, -17}, {  -5, -22}, {   6, -13}, {   4,   2}, { -10,   7}, { -16,  -7}, {  -9, -16},
+        {   1, -14}, {   5,  -4}, {  -2,   5}, { -12,   3}, { -11,  -1}, { -10,  -9}, {  -3, -12}, {   3,  -7},
+        {   2,   1}, {  -5,   4}, {  -8,  -4}, {  -5,  -8}, {   1,  -7}, {   3,  -2}, {  -1,   2}, {  -6,   2},
+        {  -5,  -1}, {  -5,  -4}, {  -1,  -5}, {   2,  -3}, {   1,   0}, {  -2,   2}, {  -4,  -2}, {  -2,  -4},
+        {   0,  -3}, {   1,  -1}, {   0,   1}, {  -3,   1}, {  -3,   0}, {  -2,  -2}, {  -1,  -3}, {   1,  -2},
+        {   1,   0}, {  -1,   1}, {  -1,  -1},
+    },
+    { // 114
+        { -21,  -2}, { -19, -17}, {  -5, -22}, {   6, -12}, {   4,   2}, { -10,   7}, { -16,  -7}, {  -9, -16},
+        {   2, -14}, {   5,  -4}, {  -2,   5}, { -13,   3}, { -11,  -1}, { -10,  -9}, {  -3, -12}, {   4,  -7},
+        {   2,   1}, {  -5,   4}, {  -8,  -4}, {  -5,  -8}, {   1,  -7}, {   3,  -2}, {  -1,   2}, {  -6,   1},
+        {  -5,  -1}, {  -5,  -4}, {  -1,  -5}, {   2,  -3}, {   1,   1}, {  -2,   2}, {  -4,  -2}, {  -2,  -4},
+        {   0,  -3}, {   1,  -1}, {   0,   1}, {  -3,   1}, {  -3,   0}, {  -2,  -2}, {  -1,  -3}, {   1,  -2},
+        {   0,   0}, {  -1,   1}, {  -1,  -1},
+    },
+    { // 115
+        { -21,  -3}, { -18, -17}, {  -4, -22}, {   7, -12}, {   4,   2}, { -10,   7}, { -16,  -8}, {  -9, -16},
+        {   2, -14}, {   5,  -3}, {  -2,   5}, { -13,   3}, { -12,  -1}, { -10,  -9}, {  -2, -12}, {   4,  -6},
+        {   2,   1}, {  -6,   4}, {  -8,  -4}, {  -4,  -8}, {   1,  -7}, {   3,  -2}, {  -1,   2}, {  -6,   1},
+        {  -5,  -1}, {  -5,  -4}, {  -1,  -5}, {   2,  -3}, {   1,   1}, {  -3,   2}, {  -4,  -2}, {  -2,  -4},
+        {   0,  -3}, {   1,  -1}, {   0,   1}, {  -3,   1}, {  -3,   0}, {  -2,  -2}, {  -1,  -3}, {   1,  -1},
+        {   0,   0}, {  -1,   1}, {  -1,  -1},
+    },
+    { // 116
+        { -21,  -3}, { -18, -17}, {  -4, -22}, {   7, -12}, {   3,   3}, { -11,   7}, { -16,  -8}, {  -9, -16},
+        {   2, -14}, {   5,  -3}, {  -2,   5}, { -13,   3}, { -12,  -2}, { -10,  -9}, {  -2, -12}, {   4,  -6},
+        {   2,   1}, {  -6,   4}, {  -8,  -4}, {  -4,  -8}, {   1,  -7}, {   3,  -2}, {  -1,   3}, {  -7,   1},
+        {  -5,  -1}, {  -5,  -4}, {  -1,  -5}, {   2,  -3}, {   1,   1}, {  -3,   2}, {  -4,  -2}, {  -2,  -4},
+        {   0,  -3}, {   1,  -1}, {  -1,   1}, {  -3,   1}, {  -3,   0}, {  -2,  -2}, {  -1,  -3}, {   1,  -1},
+        {   0,   0}, {  -1,   1}, {  -1,  -1},
+    },
+    { // 117
+        { -21,  -3}, { -18, -18}, {  -4, -22}, {   7, -11}, {   3,   3}, { -11,   7}, { -16,  -8}, {  -8, -16},
+        {   2, -13}, {   5,  -3}, {  -3,   5}, { -13,   2}, { -12,  -2}, { -10, -10}, {  -2, -12}, {   4,  -6},
+        {   2,   2}, {  -6,   4}, {  -8,  -4}, {  -4,  -8}, {   1,  -7}, {   3,  -1}, {  -1,   3}, {  -7,   1},
+        {  -5,  -1}, {  -4,  -4}, {  -1,  -5}, {   2,  -3}, {   1,   1}, {  -3,   2}, {  -4,  -2}, {  -2,  -4},
+        {   0,  -3}, {   1,  -1}, {  -1,   1}, {  -3,   1}, {  -3,   0}, {  -2,  -2}, {   0,  -3}, {   1,  -1},
+        {   0,   0}, {  -1,   1}, {  -1,  -1},
+    },
+    { // 118
+        { -22,  -4}, { -18, -18}, {  -3, -21}, {   7, -11}, {   3,   3}, { -11,   7}, { -16,  -9}, {  -8, -16},
+        {   2, -13}, {   5,  -2}, {  -3,   5}, { -13,   2}, { -12,  -2}, {  -9, -10}, {  -2, -12}, {   4,  -6},
+        {   2,   2}, {  -6,   4}, {  -8,  -4}, {  -4,  -8}, {   1,  -7}, {   3,  -1}, {  -1,   3}, {  -7,   1},
+        {  -5,  -1}, {  -4,  -4}, {  -1,  -5}, {   2,  -3}, {   1,   1}, {  -3,   2}, {  -4,  -2}, {  -2,  -4},
+        {   1,  -3}, {   1,  -1}, {  -1,   1}, {  -3,   0}, {  -3,   0}, {  -2,  -2}, {   0,  -3}, {   1,  -1},
+        {   0,   0}, {  -1,   1}, {  -1,  -1},
+    },
+    { // 119
+        { -22,  -4}, { -17, -18}, {  -3, -21}, {   7, -11}, {   3,   3}, { -12,   7}, { -16,  -9}, {  -8, -16},
+        {   3, -13}, {   5,  -2}, {  -3,   5}, { -14,   2}, { -12,  -2}, {  -9, -10}, {  -2, -12}, {   4,  -6},
+        {   1,   2}, {  -6,   4}, {  -8,  -4}, {  -4,  -8}, {   1,  -6}, {   2,  -1}, {  -2,   3}, {  -7,   1},
+        {  -5,  -1}, {  -4,  -5}, {  -1,  -5}, {   2,  -3}, {   1,   1}, {  -3,   2}, {  -4,  -2}, {  -2,  -4},
+        {   1,  -3}, {   1,   0}, {  -1,   1}, {  -3,   0}, {  -3,  -1}, {  -2,  -2}, {   0,  -3}, {   1,  -1},
+        {   0,   0}, {  -1,   1}, {  -1,  -1},
+    },
+    { // 120
+        { -22,  -4}, { -17, -18}, {  -3, -21}, {   7, -10}, {   2,   4}, { -12,   7}, { -16,  -9}, {  -8, -16},
+        {   3, -13}, {   5,  -2}, {  -3,   5}, { -14,   2}, { -12,  -2}, {  -9, -10}, {  -1, -11}, {   4,  -6},
+        {   1,   2}, {  -7,   4}, {  -8,  -5}, {  -4,  -8}, {   1,  -6}, {   2,  -1}, {  -2,   3}, {  -7,   1},
+        {  -5,  -1}, {  -4,  -5}, {  -1,  -5}, {   2,  -3}, {   1,   1}, {  -3,   2}, {  -4,  -2}, {  -2,  -4},
+        {   1,  -3}, {   1,   0}, {  -1,   1}, {  -3,   0}, {  -3,  -1}, {  -2,  -2}, {   0,  -3}, {   1,  -1},
+        {   0,   0}, {  -2,   1}, {  -1,  -1},
+    },
+    { // 121
+        { -22,  -5}, { -17, -19}, {  -2, -21}, {   7, -10}, {   2,   4}, { -12,   6}, { -16,  -9}, {  -7, -16},
+        {   3, -13}, {   5,  -2}, {  -4,   5}, { -14,   2}, { -12,  -3}, {  -9, -10}, {  -1, -11}, {   4,  -5},
+        {   1,   2}, {  -7,   3}, {  -8,  -5}, {  -4,  -8}, {   1,  -6}, {   2,  -1}, {  -2,   3}, {  -7,   1},
+        {  -5,  -1}, {  -4,  -5}, {  -1,  -5}, {   2,  -2}, {   1,   1}, {  -3,   2}, {  -4,  -2}, {  -2,  -4},
+        {   1,  -3}, {   1,   0}, {  -1,   1}, {  -3,   0}, {  -3,  -1}, {  -2,  -2}, {   0,  -3}, {   1,  -1},
+        {   0,   0}, {  -2,   1}, {  -1,  -1},
+    },
+    { // 122
+        { -22,  -5}, { -16, -19}, {  -2, -21}, {   7,  -9}, {   2,   4}, { -13,   6}, { -16, -10}, {  -7, -16},
+        {   3, -12}, {   5,  -1}, {  -4,   5}, { -14,   1}, { -12,  -3}, {  -9, -10}, {  -1, -11}, {   4,  -5},
+        {   1,   2}, {  -7,   3}, {  -8,  -5}, {  -4,  -8}, {   2,  -6}, {   2,  -1}, {  -2,   3}, {  -7,   1},
+        {  -5,  -1}, {  -4,  -5}, {   0,  -5}, {   2,  -2}, {   0,   1}, {  -3,   2}, {  -3,  -2}, {  -2,  -4},
+        {   1,  -3}, {   1,   0}, {  -1,   1}, {  -3,   0}, {  -3,  -1}, {  -2,  -2}, {   0,  -3}, {   1,  -1},
+        {   0,   1}, {  -2,   1}, {  -1,  -1},
+    },
+    { // 123
+        { -22,  -6}, { -16, -19}, {  -2, -21}, {   7,  -9}, {   1,   4}, { -13,   6}, { -16, -10}, {  -7, -16},
+        {   3, -12}, {   5,  -1}, {  -4,   5}, { -14,   1}, { -12,  -3}, {  -9, -10}, {  -1, -11}, {   4,  -5},
+        {   1,   2}, {  -7,   3}, {  -8,  -5}, {  -3,  -8}, {   2,  -6}, {   2,  -1}, {  -2,   3}, {  -7,   1},
+        {  -5,  -1}, {  -4,  -5}, {   0,  -5}, {   2,  -2}, {   0,   1}, {  -3,   2}, {  -3,  -2}, {  -2,  -4},
+        {   1,  -3}, {   1,   0}, {  -1,   1}, {  -3,   0}, {  -3,  -1}, {  -2,  -2}, {   0,  -3}, {   1,  -1},
+        {   0,   1}, {  -2,   1}, {  -1,  -1},
+    },
+    { // 124
+        { -22,  -6}, { -16, -19}, {  -1, -21}, {   7,  -9}, {   1,   5}, { -13,   6}, { -16, -10}, {  -7, -16},
+        {   3, -12}, {   5,  -1}, {  -4,   5}, { -14,   1}, { -12,  -3}, {  -9, -10}, {  -1, -11}, {   4,  -5},
+        {   1,   2}, {  -7,   3}, {  -8,  -5}, {  -3,  -8}, {   2,  -6}, {   2,   0}, {  -2,   3}, {  -7,   0},
+        {  -5,  -1}, {  -4,  -5}, {   0,  -5}, {   2,  -2}, {   0,   1}, {  -3,   2}, {  -3,  -2}, {  -1,  -4},
+        {   1,  -3}, {   1,   0}, {  -1,   1}, {  -3,   0}, {  -3,  -1}, {  -2,  -2}, {   0,  -3}, {   1,  -1},
+        {   0,   1}, {  -2,   1}, {  -1,  -1},
+    },
+    { // 125
+        { -22,  -6}, { -16, -19}, {  -1, -21}, {   7,  -8}, {   1,   5}, { -14,   6}, { -15, -10}, {  -6, -16},
+        {   4, -12}, {   4,  -1}, {  -5,   5}, { -15,   1}, { -12,  -3}, {  -8, -11}, {  -1, -11}, {   4,  -5},
+        {   0,   3}, {  -7,   3}, {  -8,  -5}, {  -3,  -8}, {   2,  -6}, {   2,   0}, {  -2,   3}, {  -7,   0},
+        {  -5,  -2}, {  -4,  -5}, {   0,  -5}, {   2,  -2}, {   0,   1}, {  -3,   1}, {  -3,  -2}, {  -1,  -4},
+        {   1,  -3}, {   1,   0}, {  -1,   1}, {  -3,   0}, {  -3,  -1}, {  -2,  -2}, {   0,  -3}, {   1,  -1},
+        {   0,   1}, {  -2,   1}, {  -1,  -1},
+    },
+    { // 126
+        { -22,  -7}, { -15, -20}, {  -1, -20}, {   7,  -8}, {   1,   5}, { -14,   6}, { -15, -11}, {  -6, -16},
+        {   4, -11}, {   4,   0}, {  -5,   5}, { -15,   0}, { -12,  -4}, {  -8, -11}, {   0, -11}, {   4,  -4},
+        {   0,   3}, {  -8,   3}, {  -8,  -5}, {  -3,  -8}, {   2,  -6}, {   2,   0}, {  -2,   3}, {  -7,   0},
+        {  -5,  -2}, {  -4,  -5}, {   0,  -5}, {   2,  -2}, {   0,   1}, {  -4,   1}, {  -3,  -2}, {  -1,  -4},
+        {   1,  -3}, {   1,   0}, {  -1,   1}, {  -3,   0}, {  -3,  -1}, {  -2,  -2}, {   0,  -3}, {   1,  -1},
+        {   0,   1}, {  -2,   1}, {  -1,  -1},
+    },
+    { // 127
+        { -22,  -7}, { -15, -20}, {   0, -20}, {   7,  -8}, {   0,   5}, { -14,   6}, { -15, -11}, {  -6, -16},
+        {   4, -11}, {   4,   0}, {  -5,   5}, { -15,   0}, { -12,  -4}, {  -8, -11}, {   0, -11}, {   4,  -4},
+        {   0,   3}, {  -8,   3}, {  -8,  -5}, {  -3,  -8}, {   2,  -6}, {   2,   0}, {  -3,   3}, {  -7,   0},
+        {  -5,  -2}, {  -4,  -5}, {   0,  -5}, {   2,  -2}, {   0,   1}, {  -4,   1}, {  -3,  -2}, {  -1,  -4},
+        {   1,  -2}, {   1,   0}, {  -1,   1}, {  -3,   0}, {  -3,  -1}, {  -2,  -2}, {   0,  -3}, {   1,  -1},
+        {   0,   1}, {  -2,   1}, {  -1,  -1},
+    },
+    { // 128
+        { -22,  -7}, { -15, -20}, {   0, -20}, {   7,  -7}, {   0,   5}, { -15,   5}, { -15, -11}, {  -6, -16},
+        {   4, -11}, {   4,   0}, {  -5,   6}, { -15,   0}, { -12,  -4}, {  -8, -11}, {   0, -11}, {   4,  -4},
+        {   0,   3}, {  -8,   3}, {  -8,  -5}, {  -3,  -8}, {   2,  -6}, {   2,   0}, {  -3,   3}, {  -8,   0},
+        {  -6,  -2}, {  -4,  -5}, {   0,  -5}, {   2,  -2}, {   0,   1}, {  -4,   1}, {  -3,  -2}, {  -1,  -4},
+        {   1,  -2}, {   1,   0}, {  -1,   1}, {  -3,   0}, {  -3,  -1}, {  -2,  -3}, {   0,  -3}, {   1,  -1},
+        {   0,   1}, {  -2,   1}, {  -1,  -1},
+    },
+    { // 129
+        { -22,  -8}, { -14, -20}, {   0, -20}, {   7,  -7}, {   0,   6}, { -15,   5}, { -15, -11}, {  -5, -16},
+        {   4, -11}, {   4,   0}, {  -6,   5}, { -15,   0}, { -12,  -4}, {  -8, -11}, {   0, -11}, {   4,  -4},
+        {   0,   3}, {  -8,   3}, {  -7,  -6}, {  -3,  -8}, {   2,  -5}, {   2,   0}, {  -3,   3}, {  -8,   0},
+        {  -5,  -2}, {  -4,  -5}, {   0,  -5}, {   2,  -2}, {   0,   1}, {  -4,   1}, {  -3,  -2}, {  -1,  -4},
+        {   1,  -2}, {   1,   0}, {  -1,   1}, {  -3,   0}, {  -3,  -1}, {  -2,  -3}, {   0,  -2}, {   1,  -1},
+        {   0,   1}, {  -2,   1}, {  -1,  -1},
+    },
+    { // 130
+        { -22,  -8}, { -14, -20}, {   1, -20}, {   7,  -7}, {  -1,   6}, { -15,   5}, { -15, -11}, {  -5, -16},
+        {   4, -11}, {   4,   0}, {  -6,   5}, { -15,   0}, { -12,  -4}, {  -8, -11}, {   0, -11}, {   4,  -4},
+        {   0,   3}, {  -8,   3}, {  -7,  -6}, {  -2,  -8}, {   2,  -5}, {   2,   0}, {  -3,   3}, {  -8,   0},
+        {  -5,  -2}, {  -4,  -5}, {   0,  -5}, {   2,  -2}, {   0,   1}, {  -4,   1}, {  -3,  -3}, {  -1,  -4},
+        {   1,  -2}, {   1,   0}, {  -1,   1}, {  -3,   0}, {  -3,  -1}, {  -2,  -3}, {   0,  -2}, {   1,  -1},
+        {   0,   1}, {  -2,   1}, {  -1,  -1},
+    },
+    { // 131
+        { -22,  -8}, { -14, -21}, {   1, -19}, {   7,  -6}, {  -1,   6}, { -16,   5}, { -15, -12}, {  -5, -16},
+        {   4, -10}, {   4,   1}, {  -6,   5}, { -15,  -1}, { -12,  -5}, {  -7, -11}, {   0, -11}, {   4,  -3},
+        {  -1,   3}, {  -8,   3}, {  -7,  -6}, {  -2,  -8}, {   2,  -5}, {   2,   0}, {  -3,   3}, {  -8,   0},
+        {  -5,  -2}, {  -3,  -5}, {   0,  -5}, {   2,  -2}, {   0,   1}, {  -4,   1}, {  -3,  -3}, {  -1,  -4},
+        {   1,  -2}, {   1,   0}, {  -1,   1}, {  -3,   0}, {  -3,  -1}, {  -2,  -3}, {   0,  -2}, {   1,  -1},
+        {   0,   1}, {  -2,   1}, {  -1,  -1},
+    },
+    { // 132
+        { -22,  -9}, { -13, -21}, {   1, -19}, {   7,  -6}, {  -1,   6}, { -16,   5}, { -14, -12}, {  -4, -16},
+        {   5, -10}, {   3,   1}, {  -7,   5}, { -16,  -1}, { -12,  -5}, {  -7, -11}, {   1, -10}, {   4,  -3},
+        {  -1,   3}, {  -9,   2}, {  -7,  -6}, {  -2,  -8}, {   2,  -5}, {   2,   0}, {  -3,   3}, {  -8,   0},
+        {  -5,  -2}, {  -3,  -5}, {   0,  -5}, {   2,  -1}, {   0,   2}, {  -4,   1}, {  -3,  -3}, {  -1,  -4},
+        {   1,  -2}, {   1,   0}, {  -1,   1}, {  -3,   0}, {  -3,  -1}, {  -2,  -3}, {   0,  -2}, {   1,  -1},
+        {   0,   1}, {  -2,   1}, {  -1,  -1},
+    },
+    { // 133
+        { -22,  -9}, { -13, -21}, {   1, -19}, {   7,  -6}, {  -2,   6}, { -16,   4}, { -14, -12}, {  -4, -16},
+        {   5, -10}, {   3,   1}, {  -7,   5}, { -16,  -1}, { -12,  -5}, {  -7, -11}, {   1, -10}, {   4,  -3},
+        {  -1,   3}, {  -9,   2}, {  -7,  -6}, {  -2,  -8}, {   2,  -5}, {   2,   1}, {  -3,   3}, {  -8,  -1},
+        {  -5,  -2}, {  -3,  -5}, {   0,  -5}, {   2,  -1}, {   0,   2}, {  -4,   1}, {  -3,  -3}, {  -1,  -4},
+        {   1,  -2}, {   1,   0}, {  -2,   1}, {  -3,   0}, {  -3,  -1}, {  -2,  -3}, {   0,  -2}, {   1,  -1},
+        {   0,   1}, {  -2,   1}, {  -1,  -1},
+    },
+    { // 134
+        { -22,  -9}, { -13, -21}, {   2, -19}, {   7,  -5}, {  -2,   6}, { -16,   4}, { -14, -12}, {  -4, -16},
+        {   5, -10}, {   3,   1}, {  -7,   5}, { -16,  -1}, { -12,  -5}, {  -7, -11}, {   1, -10}, {   4,  -3},
+        {  -1,   3}, {  -9,   2}, {  -7,  -6}, {  -2,  -8}, {   2,  -5}, {   2,   1}, {  -4,   3}, {  -8,  -1},
+        {  -5,  -2}, {  -3,  -5}, {   0,  -5}, {   2,  -1}, {   0,   2}, {  -4,   1}, {  -3,  -3}, {  -1,  -4},
+        {   1,  -2}, {   1,   0}, {  -2,   1}, {  -3,   0}, {  -3,  -1}, {  -2,  -3}, {   0,  -2}, {   1,  -1},
+        {   0,   1}, {  -2,   1}, {  -1,  -1},
+    },
+    { // 135
+        { -22, -10}, { -12, -21}, {   2, -19}, {   7,  -5}, {  -2,   6}, { -17,   4}, { -14, -13}, {  -4, -16},
+        {   5,  -9}, {   3,   2}, {  -7,   5}, { -16,  -2}, { -12,  -5}, {  -7, -11}, {   1, -10}, {   4,  -3},
+        {  -1,   3}, {  -9,   2}, {  -7,  -6}, {  -2,  -8}, {   2,  -5}, {   1,   1}, {  -4,   3}, {  -8,  -1},
+        {  -5,  -2}, {  -3,  -5}, {   1,  -5}, {   2,  -1}, {  -1,   2}, {  -4,   1}, {  -3,  -3}, {  -1,  -4},
+        {   1,  -2}, {   1,   0}, {  -2,   1}, {  -4,   0}, {  -3,  -1}, {  -2,  -3}, {   0,  -2}, {   1,  -1},
+        {   0,   1}, {  -2,   0}, {  -1,  -1},
+    },
+    { // 136
+        { -22, -10}, { -12, -21}, {   2, -18}, {   7,  -4}, {  -3,   7}, { -17,   4}, { -14, -13}, {  -3, -16},
+        {   5,  -9}, {   3,   2}, {  -8,   5}, { -16,  -2}, { -12,  -6}, {  -7, -11}, {   1, -10}, {   4,  -2},
+        {  -1,   4}, {  -9,   2}, {  -7,  -6}, {  -2,  -8}, {   2,  -5}, {   1,   1}, {  -4,   3}, {  -8,  -1},
+        {  -5,  -3}, {  -3,  -5}, {   1,  -5}, {   2,  -1}, {  -1,   2}, {  -4,   1}, {  -3,  -3}, {  -1,  -4},
+        {   1,  -2}, {   1,   0}, {  -2,   1}, {  -4,   0}, {  -3,  -1}, {  -2,  -3}, {   0,  -2}, {   1,  -1},
+        {   0,   1}, {  -2,   0}, {  -1,  -1},
+    },
+    { // 137
+        { -22, -11}, { -12, -21}, {   3, -18}, {   7,  -4}, {  -3,   7}, { -17,   3}, { -14, -13}, {  -3, -16},
+        {   5,  -9}, {   3,   2}, {  -8,   5}, { -16,  -2}, { -12,  -6}, {  -6, -12}, {   1, -10}, {   4,  -2},
+        {  -2,   4}, {  -9,   2}, {  -7,  -6}, {  -2,  -8}, {   2,  -4}, {   1,   1}, {  -4,   3}, {  -8,  -1},
+        {  -5,  -3}, {  -3,  -5}, {   1,  -5}, {   2,  -1}, {  -1,   2}, {  -4,   1}, {  -3,  -3}, {  -1,  -4},
+        {   1,  -2}, {   1,   0}, {  -2,   1}, {  -4,   0}, {  -3,  -1}, {  -1,  -3}, {   0,  -2}, {   1,  -1},
+        {   0,   1}, {  -2,   0}, {  -1,  -1},
+    },
+    { // 138
+        { -22, -11}, { -11, -21}, {   3, -18}, {   7,  -4}, {  -3,   7}, { -18,   3}, { -13, -13}, {  -3, -16},
+        {   5,  -9}, {   2,   2}, {  -8,   5}, { -16,  -2}, { -12,  -6}, {  -6, -12}, {   2, -10}, {   4,  -2},
+        {  -2,   4}, {  -9,   2}, {  -7,  -7}, {  -1,  -8}, {   3,  -4}, {   1,   1}, {  -4,   3}, {  -8,  -1},
+        {  -5,  -3}, {  -3,  -5}, {   1,  -4}, {   2,  -1}, {  -1,   2}, {  -4,   1}, {  -3,  -3}, {  -1,  -4},
+        {   1,  -2}, {   1,   0}, {  -2,   1}, {  -4,  -1}, {  -3,  -1}, {  -1,  -3}, {   0,  -2}, {   1,   0},
+        {   0,   1}, {  -2,   0}, {  -1,  -1},
+    },
+    { // 139
+        { -21, -11}, { -11, -22}, {   3, -18}, {   7,  -3}, {  -4,   7}, { -18,   3}, { -13, -13}, {  -3, -16},
+        {   5,  -8}, {   2,   2}, {  -8,   5}, { -16,  -3}, { -12,  -6}, {  -6, -12}, {   2, -10}, {   4,  -2},
+        {  -2,   4}, { -10,   2}, {  -7,  -7}, {  -1,  -8}, {   3,  -4}, {   1,   1}, {  -4,   3}, {  -8,  -1},
+        {  -5,  -3}, {  -3,  -5}, {   1,  -4}, {   2,  -1}, {  -1,   2}, {  -4,   1}, {  -3,  -3}, {  -1,  -4},
+        {   1,  -2}, {   0,   1}, {  -2,   1}, {  -4,  -1}, {  -3,  -1}, {  -1,  -3}, {   0,  -2}, {   1,   0},
+        {   0,   1}, {  -2,   0}, {  -1,  -1},
+    },
+    { // 140
+        { -21, -12}, { -11, -22}, {   3, -17}, {   7,  -3}, {  -4,   7}, { -18,   3}, { -13, -14}, {  -2, -16},
+        {   5,  -8}, {   2,   3}, {  -9,   5}, { -16,  -3}, { -12,  -6}, {  -6, -12}, {   2,  -9}, {   4,  -2},
+        {  -2,   4}, { -10,   1}, {  -7,  -7}, {  -1,  -8}, {   3,  -4}, {   1,   1}, {  -4,   3}, {  -8,  -2},
+        {  -5,  -3}, {  -3,  -5}, {   1,  -4}, {   2,  -1}, {  -1,   2}, {  -5,   1}, {  -3,  -3}, {  -1,  -4},
+        {   1,  -2}, {   0,   1}, {  -2,   1}, {  -4,  -1}, {  -3,  -1}, {  -1,  -3}, {   0,  -2}, {   1,   0},
+        {  -1,   1}, {  -2,   0}, {  -1,  -1},
+    },
+    { // 141
+        { -21, -12}, { -10, -22}, {   4, -17}, {   7,  -3}, {  -4,   7}, { -18,   2}, { -13, -14}, {  -2, -16},
+        {   5,  -8}, {   2,   3}, {  -9,   5}, { -16,  -3}, { -12,  -6}, {  -6, -12}, {   2,  -9}, {   4,  -1},
+        {  -2,   4}, { -10,   1}, {  -6,  -7}, {  -1,  -8}, {   3,  -4}, {   1,   1}, {  -4,   2}, {  -8,  -2},
+        {  -5,  -3}, {  -3,  -5}, {   1,  -4}, {   2,  -1}, {  -1,   2}, {  -5,   1}, {  -3,  -3}, {   0,  -4},
+        {   1,  -2}, {   0,   1}, {  -2,   1}, {  -4,  -1}, {  -3,  -1}, {  -1,  -3}, {   0,  -2}, {   1,   0},
+        {  -1,   1}, {  -2,   0}, {  -1,  -1},
+    },
+    { // 142
+        { -21, -12}, { -10, -22}, {   4, -17}, {   6,  -2}, {  -5,   7}, { -19,   2}, { -13, -14}, {  -2, -16},
+        {   5,  -7}, {   2,   3}, {  -9,   5}, { -16,  -4}, { -11,  -7}, {  -5, -12}, {   2,  -9}, {   4,  -1},
+        {  -3,   4}, { -10,   1}, {  -6,  -7}, {  -1,  -8}, {   3,  -4}, {   1,   1}, {  -5,   2}, {  -8,  -2},
+        {  -5,  -3}, {  -2,  -5}, {   1,  -4}, {   2,  -1}, {  -1,   2}, {  -5,   1}, {  -3,  -3}, {   0,  -4},
+        {   1,  -2}, {   0,   1}, {  -2,   1}, {  -4,  -1}, {  -3,  -2}, {  -1,  -3}, {   0,  -2}, {   1,   0},
+        {  -1,   1}, {  -2,   0}, {  -1,  -1},
+    },
+    { // 143
+        { -21, -13}, { -10, -22}, {   4, -17}, {   6,  -2}, {  -5,   7}, { -19,   2}, { -12, -14}, {  -2, -16},
+        {   5,  -7}, {   1,   3}, {  -9,   5}, { -16,  -4}, { -11,  -7}, {  -5, -12}, {   2,  -9}, {   3,  -1},
+        {  -3,   4}, { -10,   1}, {  -6,  -7}, {  -1,  -8}, {   3,  -4}, {   1,   2}, {  -5,   2}, {  -8,  -2},
+        {  -5,  -3}, {  -2,  -5}, {   1,  -4}, {   2,  -1}, {  -1,   2}, {  -5,   0}, {  -3,  -3}, {   0,  -4},
+        {   1,  -2}, {   0,   1}, {  -2,   1}, {  -4,  -1}, {  -3,  -2}, {  -1,  -3}, {   1,  -2}, {   1,   0},
+        {  -1,   1}, {  -2,   0}, {  -1,  -1},
+    },
+    { // 144
+        { -21, -13}, {  -9, -22}, {   4, -16}, {   6,  -2}, {  -5,   7}, { -19,   2}, { -12, -14}, {  -1, -16},
+        {   5,  -7}, {   1,   3}, { -10,   5}, { -16,  -4}, { -11,  -7}, {  -5, -12}, {   2,  -9}, {   3,  -1},
+        {  -3,   4}, { -10,   1}, {  -6,  -7}, {  -1,  -8}, {   3,  -3}, {   1,   2}, {  -5,   2}, {  -8,  -2},
+        {  -5,  -3}, {  -2,  -5}, {   1,  -4}, {   2,   0}, {  -1,   2}, {  -5,   0}, {  -3,  -3}, {   0,  -3},
+        {   1,  -2}, {   0,   1}, {  -2,   1}, {  -4,  -1}, {  -3,  -2}, {  -1,  -3}, {   1,  -2}, {   1,   0},
+        {  -1,   1}, {  -2,   0}, {  -1,  -1},
+    },
+    { // 145
+        { -21, -13}, {  -9, -22}, {   5, -16}, {   6,  -1}, {  -6,   7}, { -19,   1}, { -12, -14}, {  -1, -16},
+        {   5,  -7}, {   1,   3}, { -10,   5}, { -16,  -4}, { -11,  -7}, {  -5, -12}, {   2,  -9}, {   3,  -1},
+        {  -3,   4}, { -10,   1}, {  -6,  -7}, {  -1,  -8}, {   3,  -3}, {   0,   2}, {  -5,   2}, {  -8,  -2},
+        {  -5,  -3}, {  -2,  -5}, {   1,  -4}, {   2,   0}, {  -1,   2}, {  -5,   0}, {  -3,  -3}, {   0,  -3},
+        {   1,  -1}, {   0,   1}, {  -2,   1}, {  -4,  -1}, {  -3,  -2}, {  -1,  -3}, {   1,  -2}, {   1,   0},
+        {  -1,   1}, {  -2,   0}, {  -1,  -1},
+    },
+    { // 146
+        { -21, -14}, {  -9, -22}, {   5, -16}, {   6,  -1}, {  -6,   7}, { -19,   1}, { -12, -15}, {  -1, -15},
+        {   5,  -6}, {   1,   4}, { -10,   4}, { -16,  -5}, { -11,  -7}, {  -5, -12}, {   3,  -8}, {   3,  -1},
+        {  -3,   4}, { -11,   1}, {  -6,  -7}, {   0,  -8}, {   3,  -3}, {   0,   2}, {  -5,   2}, {  -8,  -2},
+        {  -5,  -3}, {  -2,  -5}, {   1,  -4}, {   1,   0}, {  -2,   2}, {  -5,   0}, {  -3,  -3}, {   0,  -3},
+        {   1,  -1}, {   0,   1}, {  -2,   1}, {  -4,  -1}, {  -3,  -2}, {  -1,  -3}, {   1,  -2}, {   1,   0},
+        {  -1,   1}, {  -2,   0}, {  -1,  -1},
+    },
+    { // 147
+        { -20, -14}, {  -8, -22}, {   5, -15}, {   6,  -1}, {  -6,   7}, { -20,   1}, { -12, -15}, {  -1, -15},
+        {   5,  -6}, {   1,   4}, { -10,   4}, { -16,  -5}, { -11,  -8}, {  -4, -12}, {   3,  -8}, {   3,   0},
+        {  -4,   4}, { -11,   0}, {  -6,  -7}, {   0,  -8}, {   3,  -3}, {   0,   2}, {  -5,   2}, {  -8,  -2},
+        {  -5,  -3}, {  -2,  -5}, {   1,  -4}, {   1,   0}, {  -2,   2}, {  -5,   0}, {  -3,  -3}, {   0,  -3},
+        {   1,  -1}, {   0,   1}, {  -2,   1}, {  -4,  -1}, {  -3,  -2}, {  -1,  -3}, {   1,  -2}, {   1,   0},
+        {  -1,   1}, {  -2,   0}, {  -1,  -1},
+    },
+    { // 148
+        { -20, -14}, {  -8, -22}, {   5, -15}, {   6,   0}, {  -7,   7}, { -20,   0}, { -11, -15}, {   0, -15},
+        {   5,  -6}, {   0,   4}, { -11,   4}, { -16,  -5}, { -11,  -8}, {  -4, -12}, {   3,  -8}, {   3,   0},
+        {  -4,   4}, { -11,   0}, {  -6,  -7}, {   0,  -8}, {   3,  -3}, {   0,   2}, {  -5,   2}, {  -8,  -3},
+        {  -5,  -4}, {  -2,  -5}, {   1,  -4}, {   1,   0}, {  -2,   2}, {  -5,   0}, {  -3,  -3}, {   0,  -3},
+        {   1,  -1}, {   0,   1}, {  -2,   1}, {  -4,  -1}, {  -3,  -2}, {  -1,  -3}, {   1,  -2}, {   1,   0},
+        {  -1,   1}, {  -2,   0}, {  -1,  -1},
+    },
+    { // 149
+        { -20, -15}, {  -7, -22}, {   5, -15}, {   5,   0}, {  -7,   7}, { -20,   0}, { -11, -15}, {   0, -15},
+        {   5,  -6}, {   0,   4}, { -11,   4}, { -16,  -5}, { -11,  -8}, {  -4, -12}, {   3,  -8}, {   3,   0},
+        {  -4,   4}, { -11,   0}, {  -6,  -7}, {   0,  -8}, {   3,  -3}, {   0,   2}, {  -5,   2}, {  -8,  -3},
+        {  -5,  -4}, {  -2,  -5}, {   1,  -4}, {   1,   0}, {  -2,   2}, {  -5,   0}, {  -2,  -3}, {   0,  -3},
+        {   1,  -1}, {   0,   1}, {  -2,   1}, {  -4,  -1}, {  -3,  -2}, {  -1,  -3}, {   1,  -2}, {   1,   0},
+        {  -1,   1}, {  -2,   0}, {  -1,  -1},
+    },
+    { // 150
+        { -20, -15}, {  -7, -22}, {   5, -14}, {   5,   0}, {  -8,   7}, { -20,   0}, { -11, -15}, {   0, -15},
+        {   5,  -5}, {   0,   4}, { -11,   4}, { -16,  -6}, { -11,  -8}, {  -4, -12}, {   3,  -8}, {   3,   0},
+        {  -4,   4}, { -11,   0}, {  -5,  -8}, {   0,  -7}, {   3,  -3}, {   0,   2}, {  -6,   2}, {  -8,  -3},
+        {  -5,  -4}, {  -2,  -5}, {   1,  -4}, {   1,   0}, {  -2,   2}, {  -5,   0}, {  -2,  -3}, {   0,  -3},
+        {   1,  -1}, {   0,   1}, {  -2,   1}, {  -4,  -1}, {  -2,  -2}, {  -1,  -3}, {   1,  -2}, {   1,   0},
+        {  -1,   1}, {  -3,   0}, {  -1,  -1},
+    },
+    { // 151
+        { -20, -15}, {  -7, -22}, {   6, -14}, {   5,   1}, {  -8,   7}, { -20,  -1}, { -11, -15}, {   0, -15},
+        {   5,  -5}, {   0,   4}, { -11,   4}, { -16,  -6}, { -11,  -8}, {  -4, -12}, {   3,  -8}, {   3,   0},
+        {  -4,   4}, { -11,   0}, {  -5,  -8}, {   0,  -7}, {   3,  -3}, {   0,   2}, {  -6,   2}, {  -8,  -3},
+        {  -5,  -4}, {  -2,  -5}, {   1,  -4}, {   1,   0}, {  -2,   2}, {  -5,   0}, {  -2,  -3}, {   0,  -3},
+        {   1,  -1}, {   0,   1}, {  -3,   1}, {  -4,  -1}, {  -2,  -2}, {  -1,  -3}, {   1,  -2}, {   1,   0},
+        {  -1,   1}, {  -3,   0}, {  -1,  -1},
+    },
+    { // 152
+        { -20, -15}, {  -6, -22}, {   6, -14}, {   5,   1}, {  -8,   7}, { -20,  -1}, { -10, -15}, {   1, -15},
+        {   5,  -5}, {  -1,   4}, { -12,   4}, { -16,  -6}, { -11,  -8}, {  -3, -12}, {   3,  -7}, {   3,   0},
+        {  -4,   4}, { -11,   0}, {  -5,  -8}, {   0,  -7}, {   3,  -2}, {   0,   2}, {  -6,   2}, {  -8,  -3},
+        {  -5,  -4}, {  -2,  -5}, {   1,  -3}, {   1,   0}, {  -2,   2}, {  -5,   0}, {  -2,  -3}, {   0,  -3},
+        {   1,  -1}, {   0,   1}, {  -3,   1}, {  -4,  -1}, {  -2,  -2}, {  -1,  -3}, {   1,  -2}, {   1,   0},
+        {  -1,   1}, {  -3,   0}, {  -1,  -1},
+    },
+    { // 153
+        { -19, -16}, {  -6, -22}, {   6, -13}, {   5,   1}, {  -9,   7}, { -21,  -1}, { -10, -15}, {   1, -14},
+        {   5,  -5}, {  -1,   4}, { -12,   3}, { -16,  -6}, { -10,  -9}, {  -3, -12}, {   3,  -7}, {   3,   1},
+        {  -5,   4}, { -11,  -1}, {  -5,  -8}, {   0,  -7}, {   3,  -2}, {   0,   2}, {  -6,   2}, {  -8,  -3},
+        {  -5,  -4}, {  -2,  -5}, {   1,  -3}, {   1,   0}, {  -2,   2}, {  -5,   0}, {  -2,  -3}, {   0,  -3},
+        {   1,  -1}, {   0,   1}, {  -3,   1}, {  -4,  -1}, {  -2,  -2}, {  -1,  -3}, {   1,  -2}, {   1,   0},
+        {  -1,   1}, {  -3,   0}, {  -1,  -1},
+    },
+    { // 154
+        { -19, -16}, {  -6, -22}, {   6, -13}, {   4,   1}, {  -9,   7}, { -21,  -1}, { -10, -16}, {   1, -14},
+        {   5,  -4}, {  -1,   5}, { -12,   3}, { -16,  -7}, { -10,  -9}, {  -3, -12}, {   3,  -7}, {   2,   1},
+        {  -5,   4}, { -11,  -1}, {  -5,  -8}, {   1,  -7}, {   3,  -2}, {  -1,   2}, {  -6,   2}, {  -8,  -3},
+        {  -5,  -4}, {  -1,  -5}, {   2,  -3}, {   1,   0}, {  -2,   2}, {  -5,   0}, {  -2,  -3}, {   0,  -3},
+        {   1,  -1}, {   0,   1}, {  -3,   1}, {  -4,  -2}, {  -2,  -2}, {  -1,  -3}, {   1,  -2}, {   1,   0},
+        {  -1,   1}, {  -3,   0}, {  -1,  -1},
+    },
+    { // 155
+        { -19, -16}, {  -5, -22}, {   6, -13}, {   4,   2}, {  -9,   7}, { -21,  -2}, { -10, -16}, {   1, -14},
+        {   5,  -4}, {  -1,   5}, { -12,   3}, { -16,  -7}, { -10,  -9}, {  -3, -12}, {   3,  -7}, {   2,   1},
+        {  -5,   4}, { -11,  -1}, {  -5,  -8}, {   1,  -7}, {   3,  -2}, {  -1,   2}, {  -6,   2}, {  -8,  -4},
+        {  -5,  -4}, {  -1,  -5}, {   2,  -3}, {   1,   0}, {  -2,   2}, {  -5,   0}, {  -2,  -3}, {   0,  -3},
+        {   1,  -1}, {   0,   1}, {  -3,   1}, {  -4,  -2}, {  -2,  -2}, {  -1,  -3}, {   1,  -2}, {   1,   0},
+        {  -1,   1}, {  -3,   0}, {  -1,  -1},
+    },
+    { // 156
+        { -19, -17}, {  -5, -22}, {   6, -12}, {   4,   2}, { -10,   7}, { -21,  -2}, {  -9, -16}, {   1, -14},
+        {   5,  -4}, {  -2,   5}, { -12,   3}, { -16,  -7}, { -10,  -9}, {  -3, -12}, {   3,  -7}, {   2,   1},
+        {  -5,   4}, { -11,  -1}, {  -5,  -8}, {   1,  -7}, {   3,  -2}, {  -1,   2}, {  -6,   2}, {  -8,  -4},
+        {  -5,  -4}, {  -1,  -5}, {   2,  -3}, {   1,   0}, {  -2,   2}, {  -5,  -1}, {  -2,  -4}, {   0,  -3},
+        {   1,  -1}, {   0,   1}, {  -3,   1}, {  -4,  -2}, {  -2,  -2}, {  -1,  -3}, {   1,  -2}, {   1,   0},
+        {  -1,   1}, {  -3,   0}, {  -1,  -1},
+    },
+    { // 157
+        { -18, -17}, {  -5, -22}, {   7, -12}, {   4,   2}, { -10,   7}, { -21,  -3}, {  -9, -16}, {   2, -14},
+        {   5,  -3}, {  -2,   5}, { -13,   3}, { -16,  -8}, { -10,  -9}, {  -2, -12}, {   4,  -7}, {   2,   1},
+        {  -5,   4}, { -11,  -1}, {  -5,  -8}, {   1,  -7}, {   3,  -2}, {  -1,   2}, {  -6,   1}, {  -8,  -4},
+        {  -5,  -4}, {  -1,  -5}, {   2,  -3}, {   1,   1}, {  -3,   2}, {  -5,  -1}, {  -2,  -4}, {   0,  -3},
+        {   1,  -1}, {   0,   1}, {  -3,   1}, {  -4,  -2}, {  -2,  -2}, {  -1,  -3}, {   1,  -2}, {   0,   0},
+        {  -1,   1}, {  -3,   0}, {  -1,  -1},
+    },
+    { // 158
+        { -18, -17}, {  -4, -22}, {   7, -12}, {   4,   3}, { -10,   7}, { -21,  -3}, {  -9, -16}, {   2, -14},
+        {   5,  -3}, {  -2,   5}, { -13,   3}, { -16,  -8}, { -10,  -9}, {  -2, -12}, {   4,  -6}, {   2,   1},
+        {  -6,   4}, { -12,  -2}, {  -4,  -8}, {   1,  -7}, {   3,  -2}, {  -1,   2}, {  -6,   1}, {  -8,  -4},
+        {  -5,  -4}, {  -1,  -5}, {   2,  -3}, {   1,   1}, {  -3,   2}, {  -5,  -1}, {  -2,  -4}, {   0,  -3},
+        {   1,  -1}, {   0,   1}, {  -3,   1}, {  -4,  -2}, {  -2,  -2}, {  -1,  -3}, {   1,  -1}, {   0,   0},
+        {  -1,   1}, {  -3,   0}, {  -1,  -1},
+    },
+    { // 159
+        { -18, -17}, {  -4, -22}, {   7, -11}, {   3,   3}, { -11,   7}, { -21,  -3}, {  -9, -16}, {   2, -13},
+        {   5,  -3}, {  -2,   5}, { -13,   2}, { -16,  -8}, { -10,  -9}, {  -2, -12}, {   4,  -6}, {   2,   2},
+        {  -6,   4}, { -12,  -2}, {  -4,  -8}, {   1,  -7}, {   3,  -1}, {  -1,   3}, {  -7,   1}, {  -8,  -4},
+        {  -4,  -4}, {  -1,  -5}, {   2,  -3}, {   1,   1}, {  -3,   2}, {  -5,  -1}, {  -2,  -4}, {   0,  -3},
+        {   1,  -1}, {  -1,   1}, {  -3,   1}, {  -4,  -2}, {  -2,  -2}, {   0,  -3}, {   1,  -1}, {   0,   0},
+        {  -1,   1}, {  -3,   0}, {  -1,  -1},
+    },
+    { // 160
+        { -18, -18}, {  -4, -22}, {   7, -11}, {   3,   3}, { -11,   7}, { -22,  -4}, {  -8, -16}, {   2, -13},
+        {   5,  -3}, {  -3,   5}, { -13,   2}, { -16,  -8}, { -10, -10}, {  -2, -12}, {   4,  -6}, {   2,   2},
+        {  -6,   4}, { -12,  -2}, {  -4,  -8}, {   1,  -7}, {   3,  -1}, {  -1,   3}, {  -7,   1}, {  -8,  -4},
+        {  -4,  -4}, {  -1,  -5}, {   2,  -3}, {   1,   1}, {  -3,   2}, {  -5,  -1}, {  -2,  -4}, {   1,  -3},
+        {   1,  -1}, {  -1,   1}, {  -3,   1}, {  -4,  -2}, {  -2,  -2}, {   0,  -3}, {   1,  -1}, {   0,   0},
+        {  -1,   1}, {  -3,   0}, {  -1,  -1},
+    },
+    { // 161
+        { -17, -18}, {  -3, -21}, {   7, -11}, {   3,   3}, { -11,   7}, { -22,  -4}, {  -8, -16}, {   2, -13},
+        {   5,  -2}, {  -3,   5}, { -13,   2}, { -16,  -9}, {  -9, -10}, {  -2, -12}, {   4,  -6}, {   2,   2},
+        {  -6,   4}, { -12,  -2}, {  -4,  -8}, {   1,  -7}, {   3,  -1}, {  -1,   3}, {  -7,   1}, {  -8,  -4},
+        {  -4,  -4}, {  -1,  -5}, {   2,  -3}, {   1,   1}, {  -3,   2}, {  -5,  -1}, {  -2,  -4}, {   1,  -3},
+        {   1,  -1}, {  -1,   1}, {  -3,   0}, {  -4,  -2}, {  -2,  -2}, {   0,  -3}, {   1,  -1}, {   0,   0},
+        {  -1,   1}, {  -3,   0}, {  -1,  -1},
+    },
+    { // 162
+        { -17, -18}, {  -3, -21}, {   7, -10}, {   3,   4}, { -12,   7}, { -22,  -4}, {  -8, -16}, {   3, -13},
+        {   5,  -2}, {  -3,   5}, { -14,   2}, { -16,  -9}, {  -9, -10}, {  -2, -12}, {   4,  -6}, {   1,   2},
+        {  -6,   4}, { -12,  -2}, {  -4,  -8}, {   1,  -6}, {   2,  -1}, {  -2,   3}, {  -7,   1}, {  -8,  -4},
+        {  -4,  -5}, {  -1,  -5}, {   2,  -3}, {   1,   1}, {  -3,   2}, {  -5,  -1}, {  -2,  -4}, {   1,  -3},
+        {   1,   0}, {  -1,   1}, {  -3,   0}, {  -4,  -2}, {  -2,  -2}, {   0,  -3}, {   1,  -1}, {   0,   0},
+        {  -1,   1}, {  -3,  -1}, {  -1,  -1},
+    },
+    { // 163
+        { -17, -18}, {  -3, -21}, {   7, -10}, {   2,   4}, { -12,   7}, { -22,  -5}, {  -8, -16}, {   3, -13},
+        {   5,  -2}, {  -3,   5}, { -14,   2}, { -16,  -9}, {  -9, -10}, {  -1, -11}, {   4,  -5}, {   1,   2},
+        {  -7,   4}, { -12,  -2}, {  -4,  -8}, {   1,  -6}, {   2,  -1}, {  -2,   3}, {  -7,   1}, {  -8,  -5},
+        {  -4,  -5}, {  -1,  -5}, {   2,  -3}, {   1,   1}, {  -3,   2}, {  -5,  -1}, {  -2,  -4}, {   1,  -3},
+        {   1,   0}, {  -1,   1}, {  -3,   0}, {  -4,  -2}, {  -2,  -2}, {   0,  -3}, {   1,  -1}, {   0,   0},
+        {  -2,   1}, {  -3,  -1}, {  -1,  -1},
+    },
+    { // 164
+        { -17, -19}, {  -2, -21}, {   7, -10}, {   2,   4}, { -12,   6}, { -22,  -5}, {  -7, -16}, {   3, -12},
+        {   5,  -2}, {  -4,   5}, { -14,   1}, { -16,  -9}, {  -9, -10}, {  -1, -11}, {   4,  -5}, {   1,   2},
+        {  -7,   3}, { -12,  -3}, {  -4,  -8}, {   2,  -6}, {   2,  -1}, {  -2,   3}, {  -7,   1}, {  -8,  -5},
+        {  -4,  -5}, {  -1,  -5}, {   2,  -2}, {   0,   1}, {  -3,   2}, {  -5,  -1}, {  -2,  -4}, {   1,  -3},
+        {   1,   0}, {  -1,   1}, {  -3,   0}, {  -4,  -2}, {  -2,  -2}, {   0,  -3}, {   1,  -1}, {   0,   1},
+        {  -2,   1}, {  -3,  -1}, {  -1,  -1},
+    },
+    { // 165
+        { -16, -19}, {  -2, -21}, {   7,  -9}, {   2,   4}, { -13,   6}, { -22,  -5}, {  -7, -16}, {   3, -12},
+        {   5,  -1}, {  -4,   5}, { -14,   1}, { -16, -10}, {  -9, -10}, {  -1, -11}, {   4,  -5}, {   1,   2},
+        {  -7,   3}, { -12,  -3}, {  -4,  -8}, {   2,  -6}, {   2,  -1}, {  -2,   3}, {  -7,   1}, {  -8,  -5},
+        {  -4,  -5}, {   0,  -5}, {   2,  -2}, {   0,   1}, {  -3,   2}, {  -5,  -1}, {  -2,  -4}, {   1,  -3},
+        {   1,   0}, {  -1,   1}, {  -3,   0}, {  -3,  -2}, {  -2,  -2}, {   0,  -3}, {   1,  -1}, {   0,   1},
+        {  -2,   1}, {  -3,  -1}, {  -1,  -1},
+    },
+    { // 166
+        { -16, -19}, {  -1, -21}, {   7,  -9}, {   1,   4}, { -13,   6}, { -22,  -6}, {  -7, -16}, {   3, -12},
+        {   5,  -1}, {  -4,   5}, { -14,   1}, { -16, -10}, {  -9, -10}, {  -1, -11}, {   4,  -5}, {   1,   2},
+        {  -7,   3}, { -12,  -3}, {  -3,  -8}, {   2,  -6}, {   2,  -1}, {  -2,   3}, {  -7,   1}, {  -8,  -5},
+        {  -4,  -5}, {   0,  -5}, {   2,  -2}, {   0,   1}, {  -3,   2}, {  -5,  -1}, {  -2,  -4}, {   1,  -3},
+        {   1,   0}, {  -1,   1}, {  -3,   0}, {  -3,  -2}, {  -2,  -2}, {   0,  -3}, {   1,  -1}, {   0,   1},
+        {  -2,   1}, {  -3,  -1}, {  -1,  -1},
+    },
+    { // 167
+        { -16, -19}, {  -1, -21}, {   7,  -9}, {   1,   5}, { -13,   6}, { -22,  -6}, {  -6, -16}, {   3, -12},
+        {   4,  -1}, {  -5,   5}, { -14,   1}, { -15, -10}, {  -9, -10}, {  -1, -11}, {   4,  -5}, {   1,   3},
+        {  -7,   3}, { -12,  -3}, {  -3,  -8}, {   2,  -6}, {   2,   0}, {  -2,   3}, {  -7,   0}, {  -8,  -5},
+        {  -4,  -5}, {   0,  -5}, {   2,  -2}, {   0,   1}, {  -3,   1}, {  -5,  -2}, {  -1,  -4}, {   1,  -3},
+        {   1,   0}, {  -1,   1}, {  -3,   0}, {  -3,  -2}, {  -2,  -2}, {   0,  -3}, {   1,  -1}, {   0,   1},
+        {  -2,   1}, {  -3,  -1}, {  -1,  -1},
+    },
+    { // 168
+        { -15, -20}, {  -1, -20}, {   7,  -8}, {   1,   5}, { -14,   6}, { -22,  -6}, {  -6, -16}, {   4, -12},
+        {   4,  -1}, {  -5,   5}, { -15,   1}, { -15, -10}, {  -8, -11}, {   0, -11}, {   4,  -4}, {   0,   3},
+        {  -7,   3}, { -12,  -3}, {  -3,  -8}, {   2,  -6}, {   2,   0}, {  -2,   3}, {  -7,   0}, {  -8,  -5},
+        {  -4,  -5}, {   0,  -5}, {   2,  -2}, {   0,   1}, {  -3,   1}, {  -5,  -2}, {  -1,  -4}, {   1,  -3},
+        {   1,   0}, {  -1,   1}, {  -3,   0}, {  -3,  -2}, {  -2,  -2}, {   0,  -3}, {   1,  -1}, {   0,   1},
+        {  -2,   1}, {  -3,  -1}, {  -1,  -1},
+    },
+    { // 169
+        { -15, -20}, {  -1, -20}, {   7,  -8}, {   1,   5}, { -14,   6}, { -22,  -7}, {  -6, -16}, {   4, -11},
+        {   4,   0}, {  -5,   5}, { -15,   0}, { -15, -11}, {  -8, -11}, {   0, -11}, {   4,  -4}, {   0,   3},
+        {  -8,   3}, { -12,  -4}, {  -3,  -8}, {   2,  -6}, {   2,   0}, {  -3,   3}, {  -7,   0}, {  -8,  -5},
+        {  -4,  -5}, {   0,  -5}, {   2,  -2}, {   0,   1}, {  -4,   1}, {  -5,  -2}, {  -1,  -4}, {   1,  -3},
+        {   1,   0}, {  -1,   1}, {  -3,   0}, {  -3,  -2}, {  -2,  -2}, {   0,  -3}, {   1,  -1}, {   0,   1},
+        {  -2,   1}, {  -3,  -1}, {  -1,  -1},
+    },
+    { // 170
+        { -15, -20}, {   0, -20}, {   7,  -8}, {   0,   5}, { -14,   5}, { -22,  -7}, {  -6, -16}, {   4, -11},
+        {   4,   0}, {  -5,   5}, { -15,   0}, { -15, -11}, {  -8, -11}, {   0, -11}, {   4,  -4}, {   0,   3},
+        {  -8,   3}, { -12,  -4}, {  -3,  -8}, {   2,  -6}, {   2,   0}, {  -3,   3}, {  -7,   0}, {  -8,  -5},
+        {  -4,  -5}, {   0,  -5}, {   2,  -2}, {   0,   1}, {  -4,   1}, {  -5,  -2}, {  -1,  -4}, {   1,  -2},
+        {   1,   0}, {  -1,   1}, {  -3,   0}, {  -3,  -2}, {  -2,  -2}, {   0,  -3}, {   1,  -1}, {   0,   1},
+        {  -2,   1}, {  -3,  -1}, {  -1,  -1},
+    },
+    { // 171
+        { -15, -20}, {   0, -20}, {   7,  -7}, {   0,   5}, { -15,   5}, { -22,  -7}, {  -5, -16}, {   4, -11},
+        {   4,   0}, {  -6,   5}, { -15,   0}, { -15, -11}, {  -8, -11}, {   0, -11}, {   4,  -4}, {   0,   3},
+        {  -8,   3}, { -12,  -4}, {  -3,  -8}, {   2,  -5}, {   2,   0}, {  -3,   3}, {  -8,   0}, {  -7,  -6},
+        {  -4,  -5}, {   0,  -5}, {   2,  -2}, {   0,   1}, {  -4,   1}, {  -5,  -2}, {  -1,  -4}, {   1,  -2},
+        {   1,   0}, {  -1,   1}, {  -3,   0}, {  -3,  -2}, {  -2,  -3}, {   0,  -2}, {   1,  -1}, {   0,   1},
+        {  -2,   1}, {  -3,  -1}, {  -1,  -1},
+    },
+    { // 172
+        { -14, -20}, {   0, -20}, {   7,  -7}, {   0,   6}, { -15,   5}, { -22,  -8}, {  -5, -16}, {   4, -11},
+        {   4,   0}, {  -6,   5}, { -15,   0}, { -15, -11}, {  -8, -11}, {   0, -11}, {   4,  -4}, {   0,   3},
+        {  -8,   3}, { -12,  -4}, {  -3,  -8}, {   2,  -5}, {   2,   0}, {  -3,   3}, {  -8,   0}, {  -7,  -6},
+        {  -4,  -5}, {   0,  -5}, {   2,  -2}, {   0,   1}, {  -4,   1}, {  -5,  -2}, {  -1,  -4}, {   1,  -2},
+        {   1,   0}, {  -1,   1}, {  -3,   0}, {  -3,  -3}, {  -2,  -3}, {   0,  -2}, {   1,  -1}, {   0,   1},
+        {  -2,   1}, {  -3,  -1}, {  -1,  -1},
+    },
+    { // 173
+        { -14, -20}, {   1, -20}, {   7,  -6}, {  -1,   6}, { -15,   5}, { -22,  -8}, {  -5, -16}, {   4, -10},
+        {   4,   1}, {  -6,   5}, { -15,  -1}, { -15, -12}, {  -8, -11}, {   0, -11}, {   4,  -4}, {   0,   3},
+        {  -8,   3}, { -12,  -4}, {  -2,  -8}, {   2,  -5}, {   2,   0}, {  -3,   3}, {  -8,   0}, {  -7,  -6},
+        {  -3,  -5}, {   0,  -5}, {   2,  -2}, {   0,   1}, {  -4,   1}, {  -5,  -2}, {  -1,  -4}, {   1,  -2},
+        {   1,   0}, {  -1,   1}, {  -3,   0}, {  -3,  -3}, {  -2,  -3}, {   0,  -2}, {   1,  -1}, {   0,   1},
+        {  -2,   1}, {  -3,  -1}, {  -1,  -1},
+    },
+    { // 174
+        { -14, -21}, {   1, -19}, {   7,  -6}, {  -1,   6}, { -16,   5}, { -22,  -9}, {  -5, -16}, {   4, -10},
+        {   4,   1}, {  -6,   5}, { -15,  -1}, { -15, -12}, {  -7, -11}, {   1, -11}, {   4,  -3}, {  -1,   3},
+        {  -8,   3}, { -12,  -5}, {  -2,  -8}, {   2,  -5}, {   2,   0}, {  -3,   3}, {  -8,   0}, {  -7,  -6},
+        {  -3,  -5}, {   0,  -5}, {   2,  -2}, {   0,   1}, {  -4,   1}, {  -5,  -2}, {  -1,  -4}, {   1,  -2},
+        {   1,   0}, {  -1,   1}, {  -3,   0}, {  -3,  -3}, {  -2,  -3}, {   0,  -2}, {   1,  -1}, {   0,   1},
+        {  -2,   1}, {  -3,  -1}, {  -1,  -1},
+    },
+    { // 175
+        { -13, -21}, {   1, -19}, {   7,  -6}, {  -1,   6}, { -16,   5}, { -22,  -9}, {  -4, -16}, {   5, -10},
+        {   3,   1}, {  -7,   5}, { -16,  -1}, { -14, -12}, {  -7, -11}, {   1, -10}, {   4,  -3}, {  -1,   3},
+        {  -9,   2}, { -12,  -5}, {  -2,  -8}, {   2,  -5}, {   2,   0}, {  -3,   3}, {  -8,  -1}, {  -7,  -6},
+        {  -3,  -5}, {   0,  -5}, {   2,  -1}, {   0,   2}, {  -4,   1}, {  -5,  -2}, {  -1,  -4}, {   1,  -2},
+        {   1,   0}, {  -1,   1}, {  -3,   0}, {  -3,  -3}, {  -2,  -3}, {   0,  -2}, {   1,  -1}, {   0,   1},
+        {  -2,   1}, {  -3,  -1}, {  -1,  -1},
+    },
+    { // 176
+        { -13, -21}, {   2, -19}, {   7,  -5}, {  -2,   6}, { -16,   4}, { -22,  -9}, {  -4, -16}, {   5, -10},
+        {   3,   1}, {  -7,   5}, { -16,  -1}, { -14, -12}, {  -7, -11}, {   1, -10}, {   4,  -3}, {  -1,   3},
+        {  -9,   2}, { -12,  -5}, {  -2,  -8}, {   2,  -5}, {   2,   1}, {  -3,   3}, {  -8,  -1}, {  -7,  -6},
+        {  -3,  -5}, {   0,  -5}, {   2,  -1}, {   0,   2}, {  -4,   1}, {  -5,  -2}, {  -1,  -4}, {   1,  -2},
+        {   1,   0}, {  -2,   1}, {  -3,   0}, {  -3,  -3}, {  -2,  -3}, {   0,  -2}, {   1,  -1}, {   0,   1},
+        {  -2,   1}, {  -3,  -1}, {  -1,  -1},
+    },
+    { // 177
+        { -13, -21}, {   2, -19}, {   7,  -5}, {  -2,   6}, { -17,   4}, { -22, -10}, {  -4, -16}, {   5,  -9},
+        {   3,   1}, {  -7,   5}, { -16,  -2}, { -14, -12}, {  -7, -11}, {   1, -10}, {   4,  -3}, {  -1,   3},
+        {  -9,   2}, { -12,  -5}, {  -2,  -8}, {   2,  -5}, {   2,   1}, {  -4,   3}, {  -8,  -1}, {  -7,  -6},
+        {  -3,  -5}, {   0,  -5}, {   2,  -1}, {  -1,   2}, {  -4,   1}, {  -5,  -2}, {  -1,  -4}, {   1,  -2},
+        {   1,   0}, {  -2,   1}, {  -4,   0}, {  -3,  -3}, {  -2,  -3}, {   0,  -2}, {   1,  -1}, {   0,   1},
+        {  -2,   1}, {  -3,  -1}, {  -1,  -1},
+    },
+    { // 178
+        { -12, -21}, {   2, -19}, {   7,  -5}, {  -2,   6}, { -17,   4}, { -22, -10}, {  -4, -16}, {   5,  -9},
+        {   3,   2}, {  -7,   5}, { -16,  -2}, { -14, -13}, {  -7, -11}, {   1, -10}, {   4,  -3}, {  -1,   4},
+        {  -9,   2}, { -12,  -5}, {  -2,  -8}, {   2,  -5}, {   1,   1}, {  -4,   3}, {  -8,  -1}, {  -7,  -6},
+        {  -3,  -5}, {   1,  -5}, {   2,  -1}, {  -1,   2}, {  -4,   1}, {  -5,  -2}, {  -1,  -4}, {   1,  -2},
+        {   1,   0}, {  -2,   1}, {  -4,   0}, {  -3,  -3}, {  -2,  -3}, {   0,  -2}, {   1,  -1}, {   0,   1},
+        {  -2,   0}, {  -3,  -1}, {  -1,  -1},
+    },
+    { // 179
+        { -12, -21}, {   2, -18}, {   7,  -4}, {  -3,   7}, { -17,   4}, { -22, -10}, {  -3, -16}, {   5,  -9},
+        {   3,   2}, {  -8,   5}, { -16,  -2}, { -14, -13}, {  -6, -12}, {   1, -10}, {   4,  -2}, {  -1,   4},
+        {  -9,   2}, { -12,  -6}, {  -2,  -8}, {   2,  -4}, {   1,   1}, {  -4,   3}, {  -8,  -1}, {  -7,  -6},
+        {  -3,  -5}, {   1,  -5}, {   2,  -1}, {  -1,   2}, {  -4,   1}, {  -5,  -3}, {  -1,  -4}, {   1,  -2},
+        {   1,   0}, {  -2,   1}, {  -4,   0}, {  -3,  -3}, {  -1,  -3}, {   0,  -2}, {   1,  -1}, {   0,   1},
+        {  -2,   0}, {  -3,  -1}, {  -1,  -1},
+    },
+    { // 180
+        { -12, -21}, {   3, -18}, {   7,  -4}, {  -3,   7}, { -17,   3}, { -22, -11}, {  -3, -16}, {   5,  -9},
+        {   3,   2}, {  -8,   5}, { -16,  -2}, { -14, -13}, {  -6, -12}, {   1, -10}, {   4,  -2}, {  -2,   4},
+        {  -9,   2}, { -12,  -6}, {  -2,  -8}, {   3,  -4}, {   1,   1}, {  -4,   3}, {  -8,  -1}, {  -7,  -7},
+        {  -3,  -5}, {   1,  -5}, {   2,  -1}, {  -1,   2}, {  -4,   1}, {  -5,  -3}, {  -1,  -4}, {   1,  -2},
+        {   1,   0}, {  -2,   1}, {  -4,  -1}, {  -3,  -3}, {  -1,  -3}, {   0,  -2}, {   1,  -1}, {   0,   1},
+        {  -2,   0}, {  -3,  -1}, {  -1,  -1},
+    },
+    { // 181
+        { -11, -21}, {   3, -18}, {   7,  -4}, {  -3,   7}, { -18,   3}, { -22, -11}, {  -3, -16}, {   5,  -8},
+        {   2,   2}, {  -8,   5}, { -16,  -3}, { -13, -13}, {  -6, -12}, {   2, -10}, {   4,  -2}, {  -2,   4},
+        { -10,   2}, { -12,  -6}, {  -1,  -8}, {   3,  -4}, {   1,   1}, {  -4,   3}, {  -8,  -1}, {  -7,  -7},
+        {  -3,  -5}, {   1,  -4}, {   2,  -1}, {  -1,   2}, {  -4,   1}, {  -5,  -3}, {  -1,  -4}, {   1,  -2},
+        {   1,   0}, {  -2,   1}, {  -4,  -1}, {  -3,  -3}, {  -1,  -3}, {   0,  -2}, {   1,   0}, {   0,   1},
+        {  -2,   0}, {  -3,  -1}, {  -1,  -1},
+    },
+    { // 182
+        { -11, -22}, {   3, -18}, {   7,  -3}, {  -4,   7}, { -18,   3}, { -21, -11}, {  -2, -16}, {   5,  -8},
+        {   2,   2}, {  -9,   5}, { -16,  -3}, { -13, -13}, {  -6, -12}, {   2,  -9}, {   4,  -2}, {  -2,   4},
+        { -10,   2}, { -12,  -6}, {  -1,  -8}, {   3,  -4}, {   1,   1}, {  -4,   3}, {  -8,  -1}, {  -7,  -7},
+        {  -3,  -5}, {   1,  -4}, {   2,  -1}, {  -1,   2}, {  -4,   1}, {  -5,  -3}, {  -1,  -4}, {   1,  -2},
+        {   0,   1}, {  -2,   1}, {  -4,  -1}, {  -3,  -3}, {  -1,  -3}, {   0,  -2}, {   1,   0}, {   0,   1},
+        {  -2,   0}, {  -3,  -1}, {  -1,  -1},
+    },
+    { // 183
+        { -11, -22}, {   3, -17}, {   7,  -3}, {  -4,   7}, { -18,   3}, { -21, -12}, {  -2, -16}, {   5,  -8},
+        {   2,   3}, {  -9,   5}, { -16,  -3}, { -13, -14}, {  -6, -12}, {   2,  -9}, {   4,  -2}, {  -2,   4},
+        { -10,   1}, { -12,  -6}, {  -1,  -8}, {   3,  -4}, {   1,   1}, {  -4,   2}, {  -8,  -2}, {  -6,  -7},
+        {  -3,  -5}, {   1,  -4}, {   2,  -1}, {  -1,   2}, {  -5,   1}, {  -5,  -3}, {   0,  -4}, {   1,  -2},
+        {   0,   1}, {  -2,   1}, {  -4,  -1}, {  -3,  -3}, {  -1,  -3}, {   0,  -2}, {   1,   0}, {  -1,   1},
+        {  -2,   0}, {  -3,  -1}, {  -1,  -1},
+    },
+    { // 184
+        { -10, -22}, {   4, -17}, {   7,  -3}, {  -4,   7}, { -18,   2}, { -21, -12}, {  -2, -16}, {   5,  -8},
+        {   2,   3}, {  -9,   5}, { -16,  -3}, { -13, -14}, {  -6, -12}, {   2,  -9}, {   4,  -1}, {  -2,   4},
+        { -10,   1}, { -11,  -7}, {  -1,  -8}, {   3,  -4}, {   1,   1}, {  -5,   2}, {  -8,  -2}, {  -6,  -7},
+        {  -3,  -5}, {   1,  -4}, {   2,  -1}, {  -1,   2}, {  -5,   1}, {  -5,  -3}, {   0,  -4}, {   1,  -2},
+        {   0,   1}, {  -2,   1}, {  -4,  -1}, {  -3,  -3}, {  -1,  -3}, {   0,  -2}, {   1,   0}, {  -1,   1},
+        {  -2,   0}, {  -3,  -2}, {  -1,  -1},
+    },
+    { // 185
+        { -10, -22}, {   4, -17}, {   6,  -2}, {  -5,   7}, { -19,   2}, { -21, -12}, {  -2, -16}, {   5,  -7},
+        {   2,   3}, {  -9,   5}, { -16,  -4}, { -13, -14}, {  -5, -12}, {   2,  -9}, {   3,  -1}, {  -3,   4},
+        { -10,   1}, { -11,  -7}, {  -1,  -8}, {   3,  -4}, {   1,   1}, {  -5,   2}, {  -8,  -2}, {  -6,  -7},
+        {  -2,  -5}, {   1,  -4}, {   2,  -1}, {  -1,   2}, {  -5,   1}, {  -5,  -3}, {   0,  -4}, {   1,  -2},
+        {   0,   1}, {  -2,   1}, {  -4,  -1}, {  -3,  -3}, {  -1,  -3}, {   0,  -2}, {   1,   0}, {  -1,   1},
+        {  -2,   0}, {  -3,  -2}, {  -1,  -1},
+    },
+    { // 186
+        {  -9, -22}, {   4, -16}, {   6,  -2}, {  -5,   7}, { -19,   2}, { -21, -13}, {  -1, -16}, {   5,  -7},
+        {   1,   3}, { -10,   5}, { -16,  -4}, { -12, -14}, {  -5, -12}, {   2,  -9}, {   3,  -1}, {  -3,   4},
+        { -10,   1}, { -11,  -7}, {  -1,  -8}, {   3,  -4}, {   1,   2}, {  -5,   2}, {  -8,  -2}, {  -6,  -7},
+        {  -2,  -5}, {   1,  -4}, {   2,   0}, {  -1,   2}, {  -5,   0}, {  -5,  -3}, {   0,  -3}, {   1,  -2},
+        {   0,   1}, {  -2,   1}, {  -4,  -1}, {  -3,  -3}, {  -1,  -3}, {   1,  -2}, {   1,   0}, {  -1,   1},
+        {  -2,   0}, {  -3,  -2}, {  -1,  -1},
+    },
+    { // 187
+        {  -9, -22}, {   4, -16}, {   6,  -2}, {  -6,   7}, { -19,   1}, { -21, -13}, {  -1, -16}, {   5,  -7},
+        {   1,   3}, { -10,   5}, { -16,  -4}, { -12, -14}, {  -5, -12}, {   2,  -9}, {   3,  -1}, {  -3,   4},
+        { -10,   1}, { -11,  -7}, {  -1,  -8}, {   3,  -3}, {   1,   2}, {  -5,   2}, {  -8,  -2}, {  -6,  -7},
+        {  -2,  -5}, {   1,  -4}, {   2,   0}, {  -1,   2}, {  -5,   0}, {  -5,  -3}, {   0,  -3}, {   1,  -2},
+        {   0,   1}, {  -2,   1}, {  -4,  -1}, {  -3,  -3}, {  -1,  -3}, {   1,  -2}, {   1,   0}, {  -1,   1},
+        {  -2,   0}, {  -3,  -2}, {  -1,  -1},
+    },
+    { // 188
+        {  -9, -22}, {   5, -16}, {   6,  -1}, {  -6,   7}, { -19,   1}, { -21, -13}, {  -1, -16}, {   5,  -7},
+        {   1,   3}, { -10,   5}, { -16,  -4}, { -12, -14}, {  -5, -12}, {   2,  -9}, {   3,  -1}, {  -3,   4},
+        { -10,   1}, { -11,  -7}, {   0,  -8}, {   3,  -3}, {   0,   2}, {  -5,   2}, {  -8,  -2}, {  -6,  -7},
+        {  -2,  -5}, {   1,  -4}, {   2,   0}, {  -1,   2}, {  -5,   0}, {  -5,  -3}, {   0,  -3}, {   1,  -1},
+        {   0,   1}, {  -2,   1}, {  -4,  -1}, {  -3,  -3}, {  -1,  -3}, {   1,  -2}, {   1,   0}, {  -1,   1},
+        {  -2,   0}, {  -3,  -2}, {  -1,  -1},
+    },
+    { // 189
+        {  -8, -22}, {   5, -16}, {   6,  -1}, {  -6,   7}, { -19,   1}, { -21, -14}, {  -1, -15}, {   5,  -6},
+        {   1,   4}, { -10,   4}, { -16,  -5}, { -12, -15}, {  -5, -12}, {   3,  -8}, {   3,  -1}, {  -3,   4},
+        { -11,   0}, { -11,  -7}, {   0,  -8}, {   3,  -3}, {   0,   2}, {  -5,   2}, {  -8,  -2}, {  -6,  -7},
+        {  -2,  -5}, {   1,  -4}, {   1,   0}, {  -2,   2}, {  -5,   0}, {  -5,  -3}, {   0,  -3}, {   1,  -1},
+        {   0,   1}, {  -2,   1}, {  -4,  -1}, {  -3,  -3}, {  -1,  -3}, {   1,  -2}, {   1,   0}, {  -1,   1},
+        {  -2,   0}, {  -3,  -2}, {  -1,  -1},
+    },
+    { // 190
+        {  -8, -22}, {   5, -15}, {   6,  -1}, {  -7,   7}, { -20,   1}, { -20, -14}, {   0, -15}, {   5,  -6},
+        {   0,   4}, { -11,   4}, { -16,  -5}, { -11, -15}, {  -4, -12}, {   3,  -8}, {   3,   0}, {  -4,   4},
+        { -11,   0}, { -11,  -8}, {   0,  -8}, {   3,  -3}, {   0,   2}, {  -5,   2}, {  -8,  -2}, {  -6,  -7},
+        {  -2,  -5}, {   1,  -4}, {   1,   0}, {  -2,   2}, {  -5,   0}, {  -5,  -4}, {   0,  -3}, {   1,  -1},
+        {   0,   1}, {  -2,   1}, {  -4,  -1}, {  -3,  -3}, {  -1,  -3}, {   1,  -2}, {   1,   0}, {  -1,   1},
+        {  -2,   0}, {  -3,  -2}, {  -1,  -1},
+    },
+    { // 191
+        {  -8, -22}, {   5, -15}, {   6,   0}, {  -7,   7}, { -20,   0}, { -20, -14}, {   0, -15}, {   5,  -6},
+        {   0,   4}, { -11,   4}, { -16,  -5}, { -11, -15}, {  -4, -12}, {   3,  -8}, {   3,   0}, {  -4,   4},
+        { -11,   0}, { -11,  -8}, {   0,  -8}, {   3,  -3}, {   0,   2}, {  -5,   2}, {  -8,  -3}, {  -6,  -7},
+        {  -2,  -5}, {   1,  -4}, {   1,   0}, {  -2,   2}, {  -5,   0}, {  -5,  -4}, {   0,  -3}, {   1,  -1},
+        {   0,   1}, {  -2,   1}, {  -4,  -1}, {  -2,  -3}, {  -1,  -3}, {   1,  -2}, {   1,   0}, {  -1,   1},
+        {  -2,   0}, {  -3,  -2}, {  -1,  -1},
+    },
+    { // 192
+        {  -7, -22}, {   5, -15}, {   5,   0}, {  -7,   7}, { -20,   0}, { -20, -15}, {   0, -15}, {   6,  -6},
+        {   0,   4}, { -11,   4}, { -16,  -5}, { -11, -15}, {  -4, -12}, {   3,  -8}, {   3,   0}, {  -4,   4},
+        { -11,   0}, { -11,  -8}, {   0,  -8}, {   3,  -3}, {   0,   2}, {  -5,   2}, {  -8,  -3}, {  -5,  -8},
+        {  -2,  -6}, {   1,  -4}, {   1,   0}, {  -2,   2}, {  -5,   0}, {  -5,  -4}, {   0,  -3}, {   1,  -1},
+        {   0,   1}, {  -2,   1}, {  -4,  -1}, {  -2,  -3}, {  -1,  -3}, {   1,  -2}, {   1,   0}, {  -1,   1},
+        {  -3,   0}, {  -3,  -2}, {  -1,  -1},
+    },
+    { // 193
+        {  -7, -22}, {   6, -14}, {   5,   0}, {  -8,   7}, { -20,   0}, { -20, -15}, {   0, -15}, {   5,  -5},
+        {   0,   4}, { -11,   4}, { -16,  -6}, { -11, -15}, {  -4, -12}, {   3,  -8}, {   3,   0}, {  -4,   4},
+        { -11,   0}, { -11,  -8}, {   0,  -7}, {   3,  -3}, {   0,   2}, {  -6,   2}, {  -8,  -3}, {  -5,  -8},
+        {  -2,  -5}, {   1,  -4}, {   1,   0}, {  -2,   2}, {  -5,   0}, {  -5,  -4}, {   0,  -3}, {   1,  -1},
+        {   0,   1}, {  -2,   1}, {  -4,  -1}, {  -2,  -3}, {  -1,  -3}, {   1,  -2}, {   1,   0}, {  -1,   1},
+        {  -3,   0}, {  -2,  -2}, {  -1,  -1},
+    },
+    { // 194
+        {  -7, -22}, {   6, -14}, {   5,   1}, {  -8,   7}, { -20,  -1}, { -20, -15}, {   0, -15}, {   5,  -5},
+        {   0,   4}, { -11,   4}, { -16,  -6}, { -11, -15}, {  -4, -12}, {   3,  -8}, {   3,   0}, {  -4,   4},
+        { -11,   0}, { -11,  -8}, {   0,  -7}, {   3,  -2}, {   0,   2}, {  -6,   2}, {  -8,  -3}, {  -5,  -8},
+        {  -2,  -5}, {   1,  -4}, {   1,   0}, {  -2,   2}, {  -5,   0}, {  -5,  -4}, {   0,  -3}, {   1,  -1},
+        {   0,   1}, {  -3,   1}, {  -4,  -1}, {  -2,  -3}, {  -1,  -3}, {   1,  -2}, {   1,   0}, {  -1,   1},
+        {  -3,   0}, {  -2,  -2}, {  -1,  -1},
+    },
+    { // 195
+        {  -6, -22}, {   6, -14}, {   5,   1}, {  -8,   7}, { -21,  -1}, { -19, -16}, {   1, -15}, {   5,  -5},
+        {  -1,   4}, { -12,   4}, { -16,  -6}, { -10, -15}, {  -3, -12}, {   3,  -7}, {   3,   0}, {  -5,   4},
+        { -11,  -1}, { -11,  -8}, {   0,  -7}, {   3,  -2}, {   0,   2}, {  -6,   2}, {  -8,  -3}, {  -5,  -8},
+        {  -2,  -5}, {   1,  -3}, {   1,   0}, {  -2,   2}, {  -5,   0}, {  -5,  -4}, {   0,  -3}, {   1,  -1},
+        {   0,   1}, {  -3,   1}, {  -4,  -1}, {  -2,  -3}, {  -1,  -3}, {   1,  -2}, {   1,   0}, {  -1,   1},
+        {  -3,   0}, {  -2,  -2}, {  -1,  -1},
+    },
+    { // 196
+        {  -6, -22}, {   6, -13}, {   5,   1}, {  -9,   7}, { -21,  -1}, { -19, -16}, {   1, -14}, {   5,  -4},
+        {  -1,   5}, { -12,   3}, { -16,  -7}, { -10, -16}, {  -3, -12}, {   3,  -7}, {   2,   1}, {  -5,   4},
+        { -11,  -1}, { -10,  -9}, {   0,  -7}, {   3,  -2}, {   0,   2}, {  -6,   2}, {  -8,  -3}, {  -5,  -8},
+        {  -1,  -5}, {   2,  -3}, {   1,   0}, {  -2,   2}, {  -5,   0}, {  -5,  -4}, {   0,  -3}, {   1,  -1},
+        {   0,   1}, {  -3,   1}, {  -4,  -1}, {  -2,  -3}, {  -1,  -3}, {   1,  -2}, {   1,   0}, {  -1,   1},
+        {  -3,   0}, {  -2,  -2}, {  -1,  -1},
+    },
+    { // 197
+        {  -6, -22}, {   6, -13}, {   4,   1}, {  -9,   7}, { -21,  -2}, { -19, -16}, {   1, -14}, {   5,  -4},
+        {  -1,   5}, { -12,   3}, { -16,  -7}, { -10, -16}, {  -3, -12}, {   3,  -7}, {   2,   1}, {  -5,   4},
+        { -11,  -1}, { -10,  -9}, {   1,  -7}, {   3,  -2}, {  -1,   2}, {  -6,   2}, {  -8,  -3}, {  -5,  -8},
+        {  -1,  -5}, {   2,  -3}, {   1,   0}, {  -2,   2}, {  -5,   0}, {  -5,  -4}, {   0,  -3}, {   1,  -1},
+        {   0,   1}, {  -3,   1}, {  -4,  -2}, {  -2,  -3}, {  -1,  -3}, {   1,  -2}, {   1,   0}, {  -1,   1},
+        {  -3,   0}, {  -2,  -2}, {  -1,  -1},
+    },
+    { // 198
+        {  -5, -22}, {   6, -13}, {   4,   2}, {  -9,   7}, { -21,  -2}, { -19, -16}, {   1, -14}, {   5,  -4},
+        {  -1,   5}, { -12,   3}, { -16,  -7}, { -10, -16}, {  -3, -12}, {   3,  -7}, {   2,   1}, {  -5,   4},
+        { -11,  -1}, { -10,  -9}, {   1,  -7}, {   3,  -2}, {  -1,   2}, {  -6,   2}, {  -8,  -4}, {  -5,  -8},
+        {  -1,  -5}, {   2,  -3}, {   1,   0}, {  -2,   2}, {  -5,   0}, {  -5,  -4}, {   0,  -3}, {   1,  -1},
+        {   0,   1}, {  -3,   1}, {  -4,  -2}, {  -2,  -3}, {  -1,  -3}, {   1,  -2}, {   1,   0}, {  -1,   1},
+        {  -3,   0}, {  -2,  -2}, {  -1,  -1},
+    },
+    { // 199
+        {  -5, -22}, {   6, -12}, {   4,   2}, { -10,   7}, { -21,  -2}, { -19, -17}, {   2, -14}, {   5,  -4},
+        {  -2,   5}, { -13,   3}, { -16,  -7}, {  -9, -16}, {  -3, -12}, {   3,  -7}, {   2,   1}, {  -5,   4},
+        { -11,  -1}, { -10,  -9}, {   1,  -7}, {   3,  -2}, {  -1,   2}, {  -6,   1}, {  -8,  -4}, {  -5,  -8},
+        {  -1,  -5}, {   2,  -3}, {   1,   1}, {  -2,   2}, {  -5,  -1}, {  -5,  -4}, {   0,  -3}, {   1,  -1},
+        {   0,   1}, {  -3,   1}, {  -4,  -2}, {  -2,  -4}, {  -1,  -3}, {   1,  -2}, {   0,   0}, {  -1,   1},
+        {  -3,   0}, {  -2,  -2}, {  -1,  -1},
+    },
+    { // 200
+        {  -4, -22}, {   7, -12}, {   4,   2}, { -10,   7}, { -21,  -3}, { -18, -17}, {   2, -14}, {   5,  -3},
+        {  -2,   5}, { -13,   3}, { -16,  -8}, {  -9, -16}, {  -2, -12}, {   4,  -7}, {   2,   1}, {  -6,   4},
+        { -11,  -1}, { -10,  -9}, {   1,  -7}, {   3,  -2}, {  -1,   2}, {  -6,   1}, {  -8,  -4}, {  -5,  -8},
+        {  -1,  -5}, {   2,  -3}, {   1,   1}, {  -3,   2}, {  -5,  -1}, {  -5,  -4}, {   0,  -3}, {   1,  -1},
+        {   0,   1}, {  -3,   1}, {  -4,  -2}, {  -2,  -4}, {  -1,  -3}, {   1,  -2}, {   0,   0}, {  -1,   1},
+        {  -3,   0}, {  -2,  -2}, {  -1,  -1},
+    },
+    { // 201
+        {  -4, -22}, {   7, -12}, {   3,   3}, { -11,   7}, { -21,  -3}, { -18, -17}, {   2, -14}, {   5,  -3},
+        {  -2,   5}, { -13,   3}, { -16,  -8}, {  -9, -16}, {  -2, -12}, {   4,  -6}, {   2,   1}, {  -6,   4},
+        { -12,  -2}, { -10,  -9}, {   1,  -7}, {   3,  -2}, {  -1,   2}, {  -6,   1}, {  -8,  -4}, {  -4,  -8},
+        {  -1,  -5}, {   2,  -3}, {   1,   1}, {  -3,   2}, {  -5,  -1}, {  -5,  -4}, {   0,  -3}, {   1,  -1},
+        {   0,   1}, {  -3,   1}, {  -4,  -2}, {  -2,  -4}, {  -1,  -3}, {   1,  -1}, {   0,   0}, {  -1,   1},
+        {  -3,   0}, {  -2,  -2}, {  -1,  -1},
+    },
+    { // 202
+        {  -4, -22}, {   7, -11}, {   3,   3}, { -11,   7}, { -21,  -3}, { -18, -18}, {   2, -13}, {   5,  -3},
+        {  -2,   5}, { -13,   2}, { -16,  -8}, {  -9, -16}, {  -2, -12}, {   4,  -6}, {   2,   2}, {  -6,   4},
+        { -12,  -2}, { -10,  -9}, {   1,  -7}, {   3,  -1}, {  -1,   3}, {  -7,   1}, {  -8,  -4}, {  -4,  -8},
+        {  -1,  -5}, {   2,  -3}, {   1,   1}, {  -3,   2}, {  -5,  -1}, {  -4,  -4}, {   0,  -3}, {   1,  -1},
+        {  -1,   1}, {  -3,   1}, {  -4,  -2}, {  -2,  -4}, {   0,  -3}, {   1,  -1}, {   0,   0}, {  -1,   1},
+        {  -3,   0}, {  -2,  -2}, {  -1,  -1},
+    },
+    { // 203
+        {  -3, -21}, {   7, -11}, {   3,   3}, { -11,   7}, { -22,  -4}, { -18, -18}, {   2, -13}, {   5,  -3},
+        {  -3,   5}, { -13,   2}, { -16,  -8}, {  -8, -16}, {  -2, -12}, {   4,  -6}, {   2,   2}, {  -6,   4},
+        { -12,  -2}, { -10, -10}, {   1,  -7}, {   3,  -1}, {  -1,   3}, {  -7,   1}, {  -8,  -4}, {  -4,  -8},
+        {  -1,  -5}, {   2,  -3}, {   1,   1}, {  -3,   2}, {  -5,  -1}, {  -4,  -4}, {   1,  -3}, {   1,  -1},
+        {  -1,   1}, {  -3,   0}, {  -4,  -2}, {  -2,  -4}, {   0,  -3}, {   1,  -1}, {   0,   0}, {  -1,   1},
+        {  -3,   0}, {  -2,  -2}, {  -1,  -1},
+    },
+    { // 204
+        {  -3, -21}, {   7, -11}, {   3,   3}, { -12,   7}, { -22,  -4}, { -17, -18}, {   3, -13}, {   5,  -2},
+        {  -3,   5}, { -14,   2}, { -16,  -9}, {  -8, -16}, {  -2, -12}, {   4,  -6}, {   1,   2}, {  -6,   4},
+        { -12,  -2}, {  -9, -10}, {   1,  -7}, {   3,  -1}, {  -2,   3}, {  -7,   1}, {  -8,  -4}, {  -4,  -8},
+        {  -1,  -5}, {   2,  -3}, {   1,   1}, {  -3,   2}, {  -5,  -1}, {  -4,  -5}, {   1,  -3}, {   1,  -1},
+        {  -1,   1}, {  -3,   0}, {  -4,  -2}, {  -2,  -4}, {   0,  -3}, {   1,  -1}, {   0,   0}, {  -1,   1},
+        {  -3,  -1}, {  -2,  -2}, {  -1,  -1},
+    },
+    { // 205
+        {  -3, -21}, {   7, -10}, {   2,   4}, { -12,   7}, { -22,  -4}, { -17, -18}, {   3, -13}, {   5,  -2},
+        {  -3,   5}, { -14,   2}, { -16,  -9}, {  -8, -16}, {  -1, -12}, {   4,  -6}, {   1,   2}, {  -6,   4},
+        { -12,  -2}, {  -9, -10}, {   1,  -6}, {   2,  -1}, {  -2,   3}, {  -7,   1}, {  -8,  -4}, {  -4,  -8},
+        {  -1,  -5}, {   2,  -3}, {   1,   1}, {  -3,   2}, {  -5,  -1}, {  -4,  -5}, {   1,  -3}, {   1,   0},
+        {  -1,   1}, {  -3,   0}, {  -4,  -2}, {  -2,  -4}, {   0,  -3}, {   1,  -1}, {   0,   0}, {  -1,   1},
+        {  -3,  -1}, {  -2,  -2}, {  -1,  -1},
+    },
+    { // 206
+        {  -2, -21}, {   7, -10}, {   2,   4}, { -12,   6}, { -22,  -5}, { -17, -19}, {   3, -13}, {   5,  -2},
+        {  -4,   5}, { -14,   2}, { -16,  -9}, {  -7, -16}, {  -1, -11}, {   4,  -5}, {   1,   2}, {  -7,   4},
+        { -12,  -3}, {  -9, -10}, {   1,  -6}, {   2,  -1}, {  -2,   3}, {  -7,   1}, {  -8,  -5}, {  -4,  -8},
+        {  -1,  -5}, {   2,  -2}, {   1,   1}, {  -3,   2}, {  -5,  -1}, {  -4,  -5}, {   1,  -3}, {   1,   0},
+        {  -1,   1}, {  -3,   0}, {  -4,  -2}, {  -2,  -4}, {   0,  -3}, {   1,  -1}, {   0,   0}, {  -2,   1},
+        {  -3,  -1}, {  -2,  -2}, {  -1,  -1},
+    },
+    { // 207
+        {  -2, -21}, {   7, -10}, {   2,   4}, { -13,   6}, { -22,  -5}, { -17, -19}, {   3, -12}, {   5,  -2},
+        {  -4,   5}, { -14,   1}, { -16,  -9}, {  -7, -16}, {  -1, -11}, {   4,  -5}, {   1,   2}, {  -7,   3},
+        { -12,  -3}, {  -9, -10}, {   2,  -6}, {   2,  -1}, {  -2,   3}, {  -7,   1}, {  -8,  -5}, {  -4,  -8},
+        {  -1,  -5}, {   2,  -2}, {   0,   1}, {  -3,   2}, {  -5,  -1}, {  -4,  -5}, {   1,  -3}, {   1,   0},
+        {  -1,   1}, {  -3,   0}, {  -4,  -2}, {  -2,  -4}, {   0,  -3}, {   1,  -1}, {   0,   1}, {  -2,   1},
+        {  -3,  -1}, {  -2,  -2}, {  -1,  -1},
+    },
+    { // 208
+        {  -2, -21}, {   7,  -9}, {   2,   4}, { -13,   6}, { -22,  -5}, { -16, -19}, {   3, -12}, {   5,  -1},
+        {  -4,   5}, { -14,   1}, { -16, -10}, {  -7, -16}, {  -1, -11}, {   4,  -5}, {   1,   2}, {  -7,   3},
+        { -12,  -3}, {  -9, -10}, {   2,  -6}, {   2,  -1}, {  -2,   3}, {  -7,   1}, {  -8,  -5}, {  -3,  -8},
+        {   0,  -5}, {   2,  -2}, {   0,   1}, {  -3,   2}, {  -5,  -1}, {  -4,  -5}, {   1,  -3}, {   1,   0},
+        {  -1,   1}, {  -3,   0}, {  -3,  -2}, {  -2,  -4}, {   0,  -3}, {   1,  -1}, {   0,   1}, {  -2,   1},
+        {  -3,  -1}, {  -2,  -2}, {  -1,  -1},
+    },
+    { // 209
+        {  -1, -21}, {   7,  -9}, {   1,   5}, { -13,   6}, { -22,  -6}, { -16, -19}, {   3, -12}, {   5,  -1},
+        {  -4,   5}, { -14,   1}, { -16, -10}, {  -7, -16}, {  -1, -11}, {   4,  -5}, {   1,   2}, {  -7,   3},
+        { -12,  -3}, {  -9, -10}, {   2,  -6}, {   2,  -1}, {  -2,   3}, {  -7,   0}, {  -8,  -5}, {  -3,  -8},
+        {   0,  -5}, {   2,  -2}, {   0,   1}, {  -3,   2}, {  -5,  -1}, {  -4,  -5}, {   1,  -3}, {   1,   0},
+        {  -1,   1}, {  -3,   0}, {  -3,  -2}, {  -1,  -4}, {   0,  -3}, {   1,  -1}, {   0,   1}, {  -2,   1},
+        {  -3,  -1}, {  -2,  -2}, {  -1,  -1},
+    },
+    { // 210
+        {  -1, -21}, {   7,  -9}, {   1,   5}, { -14,   6}, { -22,  -6}, { -16, -19}, {   4, -12}, {   4,  -1},
+        {  -5,   5}, { -15,   1}, { -15, -10}, {  -6, -16}, {  -1, -11}, {   4,  -5}, {   1,   3}, {  -7,   3},
+        { -12,  -3}, {  -8, -11}, {   2,  -6}, {   2,   0}, {  -2,   3}, {  -7,   0}, {  -8,  -5}, {  -3,  -8},
+        {   0,  -5}, {   2,  -2}, {   0,   1}, {  -3,   1}, {  -5,  -2}, {  -4,  -5}, {   1,  -3}, {   1,   0},
+        {  -1,   1}, {  -3,   0}, {  -3,  -2}, {  -1,  -4}, {   0,  -3}, {   1,  -1}, {   0,   1}, {  -2,   1},
+        {  -3,  -1}, {  -2,  -2}, {  -1,  -1},
+    },
+    { // 211
+        {  -1, -20}, {   7,  -8}, {   1,   5}, { -14,   6}, { -22,  -6}, { -15, -20}, {   4, -12}, {   4,  -1},
+        {  -5,   5}, { -15,   1}, { -15, -10}, {  -6, -16}, {   0, -11}, {   4,  -4}, {   0,   3}, {  -8,   3},
+        { -12,  -4}, {  -8, -11}, {   2,  -6}, {   2,   0}, {  -2,   3}, {  -7,   0}, {  -8,  -5}, {  -3,  -8},
+        {   0,  -5}, {   2,  -2}, {   0,   1}, {  -3,   1}, {  -5,  -2}, {  -4,  -5}, {   1,  -3}, {   1,   0},
+        {  -1,   1}, {  -3,   0}, {  -3,  -2}, {  -1,  -4}, {   0,  -3}, {   1,  -1}, {   0,   1}, {  -2,   1},
+        {  -3,  -1}, {  -2,  -2}, {  -1,  -1},
+    },
+    { // 212
+        {   0, -20}, {   7,  -8}, {   0,   5}, { -14,   6}, { -22,  -7}, { -15, -20}, {   4, -11}, {   4,   0},
+        {  -5,   5}, { -15,   0}, { -15, -11}, {  -6, -16}, {   0, -11}, {   4,  -4}, {   0,   3}, {  -8,   3},
+        { -12,  -4}, {  -8, -11}, {   2,  -6}, {   2,   0}, {  -3,   3}, {  -7,   0}, {  -8,  -5}, {  -3,  -8},
+        {   0,  -5}, {   2,  -2}, {   0,   1}, {  -4,   1}, {  -5,  -2}, {  -4,  -5}, {   1,  -3}, {   1,   0},
+        {  -1,   1}, {  -3,   0}, {  -3,  -2}, {  -1,  -4}, {   0,  -3}, {   1,  -1}, {   0,   1}, {  -2,   1},
+        {  -3,  -1}, {  -2,  -2}, {  -1,  -1},
+    },
+    { // 213
+        {   0, -20}, {   7,  -7}, {   0,   5}, { -15,   5}, { -22,  -7}, { -15, -20}, {   4, -11}, {   4,   0},
+        {  -5,   5}, { -15,   0}, { -15, -11}, {  -6, -16}, {   0, -11}, {   4,  -4}, {   0,   3}, {  -8,   3},
+        { -12,  -4}, {  -8, -11}, {   2,  -6}, {   2,   0}, {  -3,   3}, {  -7,   0}, {  -8,  -5}, {  -3,  -8},
+        {   0,  -5}, {   2,  -2}, {   0,   1}, {  -4,   1}, {  -5,  -2}, {  -4,  -5}, {   1,  -2}, {   1,   0},
+        {  -1,   1}, {  -3,   0}, {  -3,  -2}, {  -1,  -4}, {   0,  -3}, {   1,  -1}, {   0,   1}, {  -2,   1},
+        {  -3,  -1}, {  -2,  -2}, {  -1,  -1},
+    },
+    { // 214
+        {   0, -20}, {   7,  -7}, {   0,   5}, { -15,   5}, { -22,  -8}, { -14, -20}, {   4, -11}, {   4,   0},
+        {  -6,   5}, { -15,   0}, { -15, -11}, {  -5, -16}, {   0, -11}, {   4,  -4}, {   0,   3}, {  -8,   3},
+        { -12,  -4}, {  -8, -11}, {   2,  -5}, {   2,   0}, {  -3,   3}, {  -8,   0}, {  -7,  -6}, {  -3,  -8},
+        {   0,  -5}, {   2,  -2}, {   0,   1}, {  -4,   1}, {  -5,  -2}, {  -4,  -5}, {   1,  -2}, {   1,   0},
+        {  -1,   1}, {  -3,   0}, {  -3,  -2}, {  -1,  -4}, {   0,  -2}, {   1,  -1}, {   0,   1}, {  -2,   1},
+        {  -3,  -1}, {  -2,  -3}, {  -1,  -1},
+    },
+    { // 215
+        {   1, -20}, {   7,  -7}, {  -1,   6}, { -15,   5}, { -22,  -8}, { -14, -20}, {   4, -11}, {   4,   0},
+        {  -6,   5}, { -15,   0}, { -15, -11}, {  -5, -16}, {   0, -11}, {   4,  -4}, {   0,   3}, {  -8,   3},
+        { -12,  -4}, {  -8, -11}, {   2,  -5}, {   2,   0}, {  -3,   3}, {  -8,   0}, {  -7,  -6}, {  -3,  -8},
+        {   0,  -5}, {   2,  -2}, {   0,   1}, {  -4,   1}, {  -5,  -2}, {  -4,  -5}, {   1,  -2}, {   1,   0},
+        {  -1,   1}, {  -3,   0}, {  -3,  -3}, {  -1,  -4}, {   0,  -2}, {   1,  -1}, {   0,   1}, {  -2,   1},
+        {  -3,  -1}, {  -2,  -3}, {  -1,  -1},
+    },
+    { // 216
+        {   1, -20}, {   7,  -6}, {  -1,   6}, { -15,   5}, { -22,  -8}, { -14, -20}, {   4, -10}, {   4,   1},
+        {  -6,   5}, { -15,  -1}, { -15, -12}, {  -5, -16}, {   0, -11}, {   4,  -3}, {   0,   3}, {  -8,   3},
+        { -12,  -4}, {  -7, -11}, {   2,  -5}, {   2,   0}, {  -3,   3}, {  -8,   0}, {  -7,  -6}, {  -2,  -8},
+        {   0,  -5}, {   2,  -2}, {   0,   1}, {  -4,   1}, {  -5,  -2}, {  -3,  -5}, {   1,  -2}, {   1,   0},
+        {  -1,   1}, {  -3,   0}, {  -3,  -3}, {  -1,  -4}, {   0,  -2}, {   1,  -1}, {   0,   1}, {  -2,   1},
+        {  -3,  -1}, {  -2,  -3}, {  -1,  -1},
+    },
+    { // 217
+        {   1, -19}, {   7,  -6}, {  -1,   6}, { -16,   5}, { -22,  -9}, { -13, -21}, {   4, -10}, {   3,   1},
+        {  -6,   5}, { -15,  -1}, { -14, -12}, {  -5, -16}, {   1, -10}, {   4,  -3}, {  -1,   3}, {  -9,   3},
+        { -12,  -5}, {  -7, -11}, {   2,  -5}, {   2,   0}, {  -3,   3}, {  -8,   0}, {  -7,  -6}, {  -2,  -8},
+        {   0,  -5}, {   2,  -2}, {   0,   1}, {  -4,   1}, {  -5,  -2}, {  -3,  -5}, {   1,  -2}, {   1,   0},
+        {  -1,   1}, {  -3,   0}, {  -3,  -3}, {  -1,  -4}, {   0,  -2}, {   1,  -1}, {   0,   1}, {  -2,   1},
+        {  -3,  -1}, {  -2,  -3}, {  -1,  -1},
+    },
+    { // 218
+        {   1, -19}, {   7,  -6}, {  -1,   6}, { -16,   4}, { -22,  -9}, { -13, -21}, {   5, -10}, {   3,   1},
+        {  -7,   5}, { -16,  -1}, { -14, -12}, {  -4, -16}, {   1, -10}, {   4,  -3}, {  -1,   3}, {  -9,   2},
+        { -12,  -5}, {  -7, -11}, {   2,  -5}, {   2,   1}, {  -3,   3}, {  -8,  -1}, {  -7,  -6}, {  -2,  -8},
+        {   0,  -5}, {   2,  -1}, {   0,   2}, {  -4,   1}, {  -5,  -2}, {  -3,  -5}, {   1,  -2}, {   1,   0},
+        {  -2,   1}, {  -3,   0}, {  -3,  -3}, {  -1,  -4}, {   0,  -2}, {   1,  -1}, {   0,   1}, {  -2,   1},
+        {  -3,  -1}, {  -2,  -3}, {  -1,  -1},
+    },
+    { // 219
+        {   2, -19}, {   7,  -5}, {  -2,   6}, { -16,   4}, { -22,  -9}, { -13, -21}, {   5, -10}, {   3,   1},
+        {  -7,   5}, { -16,  -1}, { -14, -12}, {  -4, -16}, {   1, -10}, {   4,  -3}, {  -1,   3}, {  -9,   2},
+        { -12,  -5}, {  -7, -11}, {   2,  -5}, {   2,   1}, {  -4,   3}, {  -8,  -1}, {  -7,  -6}, {  -2,  -8},
+        {   0,  -5}, {   2,  -1}, {   0,   2}, {  -4,   1}, {  -5,  -2}, {  -3,  -5}, {   1,  -2}, {   1,   0},
+        {  -2,   1}, {  -3,   0}, {  -3,  -3}, {  -1,  -4}, {   0,  -2}, {   1,  -1}, {   0,   1}, {  -2,   1},
+        {  -3,  -1}, {  -2,  -3}, {  -1,  -1},
+    },
+    { // 220
+        {   2, -19}, {   7,  -5}, {  -2,   6}, { -17,   4}, { -22, -10}, { -12, -21}, {   5,  -9}, {   3,   1},
+        {  -7,   5}, { -16,  -2}, { -14, -12}, {  -4, -16}, {   1, -10}, {   4,  -3}, {  -1,   3}, {  -9,   2},
+        { -12,  -5}, {  -7, -11}, {   2,  -5}, {   2,   1}, {  -4,   3}, {  -8,  -1}, {  -7,  -6}, {  -2,  -8},
+        {   0,  -5}, {   2,  -1}, {  -1,   2}, {  -4,   1}, {  -5,  -2}, {  -3,  -5}, {   1,  -2}, {   1,   0},
+        {  -2,   1}, {  -4,   0}, {  -3,  -3}, {  -1,  -4}, {   0,  -2}, {   1,  -1}, {   0,   1}, {  -2,   1},
+        {  -3,  -1}, {  -2,  -3}, {  -1,  -1},
+    },
+    { // 221
+        {   2, -18}, {   7,  -5}, {  -3,   7}, { -17,   4}, { -22, -10}, { -12, -21}, {   5,  -9}, {   3,   2},
+        {  -8,   5}, { -16,  -2}, { -14, -13}, {  -3, -16}, {   1, -10}, {   4,  -2}, {  -1,   4}, {  -9,   2},
+        { -12,  -5}, {  -7, -11}, {   2,  -5}, {   1,   1}, {  -4,   3}, {  -8,  -1}, {  -7,  -6}, {  -2,  -8},
+        {   1,  -5}, {   2,  -1}, {  -1,   2}, {  -4,   1}, {  -5,  -3}, {  -3,  -5}, {   1,  -2}, {   1,   0},
+        {  -2,   1}, {  -4,   0}, {  -3,  -3}, {  -1,  -4}, {   0,  -2}, {   1,  -1}, {   0,   1}, {  -2,   0},
+        {  -3,  -1}, {  -2,  -3}, {  -1,  -1},
+    },
+    { // 222
+        {   3, -18}, {   7,  -4}, {  -3,   7}, { -17,   4}, { -22, -10}, { -12, -21}, {   5,  -9}, {   3,   2},
+        {  -8,   5}, { -16,  -2}, { -14, -13}, {  -3, -16}, {   1, -10}, {   4,  -2}, {  -2,   4}, {  -9,   2},
+        { -12,  -6}, {  -6, -12}, {   2,  -4}, {   1,   1}, {  -4,   3}, {  -8,  -1}, {  -7,  -6}, {  -2,  -8},
+        {   1,  -5}, {   2,  -1}, {  -1,   2}, {  -4,   1}, {  -5,  -3}, {  -3,  -5}, {   1,  -2}, {   1,   0},
+        {  -2,   1}, {  -4,   0}, {  -3,  -3}, {  -1,  -4}, {   0,  -2}, {   1,  -1}, {   0,   1}, {  -2,   0},
+        {  -3,  -1}, {  -1,  -3}, {  -1,  -1},
+    },
+    { // 223
+        {   3, -18}, {   7,  -4}, {  -3,   7}, { -17,   3}, { -22, -11}, { -11, -21}, {   5,  -9}, {   2,   2},
+        {  -8,   5}, { -16,  -2}, { -13, -13}, {  -3, -16}, {   2, -10}, {   4,  -2}, {  -2,   4}, {  -9,   2},
+        { -12,  -6}, {  -6, -12}, {   3,  -4}, {   1,   1}, {  -4,   3}, {  -8,  -1}, {  -7,  -7}, {  -1,  -8},
+        {   1,  -4}, {   2,  -1}, {  -1,   2}, {  -4,   1}, {  -5,  -3}, {  -3,  -5}, {   1,  -2}, {   1,   0},
+        {  -2,   1}, {  -4,  -1}, {  -3,  -3}, {  -1,  -4}, {   0,  -2}, {   1,   0}, {   0,   1}, {  -2,   0},
+        {  -3,  -1}, {  -1,  -3}, {  -1,  -1},
+    },
+    { // 224
+        {   3, -18}, {   7,  -4}, {  -4,   7}, { -18,   3}, { -22, -11}, { -11, -22}, {   5,  -8}, {   2,   2},
+        {  -8,   5}, { -16,  -3}, { -13, -13}, {  -3, -16}, {   2, -10}, {   4,  -2}, {  -2,   4}, { -10,   2},
+        { -12,  -6}, {  -6, -12}, {   3,  -4}, {   1,   1}, {  -4,   3}, {  -8,  -1}, {  -7,  -7}, {  -1,  -8},
+        {   1,  -4}, {   2,  -1}, {  -1,   2}, {  -4,   1}, {  -5,  -3}, {  -3,  -5}, {   1,  -2}, {   1,   1},
+        {  -2,   1}, {  -4,  -1}, {  -3,  -3}, {  -1,  -4}, {   0,  -2}, {   1,   0}, {   0,   1}, {  -2,   0},
+        {  -3,  -1}, {  -1,  -3}, {  -1,  -1},
+    },
+    { // 225
+        {   3, -17}, {   7,  -3}, {  -4,   7}, { -18,   3}, { -21, -11}, { -11, -22}, {   5,  -8}, {   2,   2},
+        {  -9,   5}, { -16,  -3}, { -13, -13}, {  -2, -16}, {   2,  -9}, {   4,  -2}, {  -2,   4}, { -10,   2},
+        { -12,  -6}, {  -6, -12}, {   3,  -4}, {   1,   1}, {  -4,   3}, {  -8,  -1}, {  -7,  -7}, {  -1,  -8},
+        {   1,  -4}, {   2,  -1}, {  -1,   2}, {  -4,   1}, {  -5,  -3}, {  -3,  -5}, {   1,  -2}, {   0,   1},
+        {  -2,   1}, {  -4,  -1}, {  -3,  -3}, {  -1,  -4}, {   0,  -2}, {   1,   0}, {   0,   1}, {  -2,   0},
+        {  -3,  -1}, {  -1,  -3}, {  -1,  -1},
+    },
+    { // 226
+        {   4, -17}, {   7,  -3}, {  -4,   7}, { -18,   3}, { -21, -12}, { -10, -22}, {   5,  -8}, {   2,   3},
+        {  -9,   5}, { -16,  -3}, { -13, -14}, {  -2, -16}, {   2,  -9}, {   4,  -2}, {  -2,   4}, { -10,   1},
+        { -12,  -6}, {  -6, -12}, {   3,  -4}, {   1,   1}, {  -4,   2}, {  -8,  -2}, {  -6,  -7}, {  -1,  -8},
+        {   1,  -4}, {   2,  -1}, {  -1,   2}, {  -5,   1}, {  -5,  -3}, {  -3,  -5}, {   1,  -2}, {   0,   1},
+        {  -2,   1}, {  -4,  -1}, {  -3,  -3}, {   0,  -4}, {   0,  -2}, {   1,   0}, {  -1,   1}, {  -2,   0},
+        {  -3,  -1}, {  -1,  -3}, {  -1,  -1},
+    },
+    { // 227
+        {   4, -17}, {   7,  -3}, {  -5,   7}, { -18,   2}, { -21, -12}, { -10, -22}, {   5,  -8}, {   2,   3},
+        {  -9,   5}, { -16,  -3}, { -13, -14}, {  -2, -16}, {   2,  -9}, {   4,  -1}, {  -2,   4}, { -10,   1},
+        { -11,  -7}, {  -5, -12}, {   3,  -4}, {   1,   1}, {  -5,   2}, {  -8,  -2}, {  -6,  -7}, {  -1,  -8},
+        {   1,  -4}, {   2,  -1}, {  -1,   2}, {  -5,   1}, {  -5,  -3}, {  -3,  -5}, {   1,  -2}, {   0,   1},
+        {  -2,   1}, {  -4,  -1}, {  -3,  -3}, {   0,  -4}, {   0,  -2}, {   1,   0}, {  -1,   1}, {  -2,   0},
+        {  -3,  -2}, {  -1,  -3}, {  -1,  -1},
+    },
+    { // 228
+        {   4, -17}, {   6,  -2}, {  -5,   7}, { -19,   2}, { -21, -12}, { -10, -22}, {   5,  -7}, {   1,   3},
+        {  -9,   5}, { -16,  -4}, { -12, -14}, {  -2, -16}, {   2,  -9}, {   3,  -1}, {  -3,   4}, { -10,   1},
+        { -11,  -7}, {  -5, -12}, {   3,  -4}, {   1,   2}, {  -5,   2}, {  -8,  -2}, {  -6,  -7}, {  -1,  -8},
+        {   1,  -4}, {   2,  -1}, {  -1,   2}, {  -5,   0}, {  -5,  -3}, {  -2,  -5}, {   1,  -2}, {   0,   1},
+        {  -2,   1}, {  -4,  -1}, {  -3,  -3}, {   0,  -4}, {   1,  -2}, {   1,   0}, {  -1,   1}, {  -2,   0},
+        {  -3,  -2}, {  -1,  -3}, {  -1,  -1},
+    },
+    { // 229
+        {   4, -16}, {   6,  -2}, {  -5,   7}, { -19,   2}, { -21, -13}, {  -9, -22}, {   5,  -7}, {   1,   3},
+        { -10,   5}, { -16,  -4}, { -12, -14}, {  -1, -16}, {   2,  -9}, {   3,  -1}, {  -3,   4}, { -10,   1},
+        { -11,  -7}, {  -5, -12}, {   3,  -4}, {   1,   2}, {  -5,   2}, {  -8,  -2}, {  -6,  -7}, {  -1,  -8},
+        {   1,  -4}, {   2,   0}, {  -1,   2}, {  -5,   0}, {  -5,  -3}, {  -2,  -5}, {   1,  -2}, {   0,   1},
+        {  -2,   1}, {  -4,  -1}, {  -3,  -3}, {   0,  -3}, {   1,  -2}, {   1,   0}, {  -1,   1}, {  -2,   0},
+        {  -3,  -2}, {  -1,  -3}, {  -1,  -1},
+    },
+    { // 230
+        {   4, -16}, {   6,  -1}, {  -6,   7}, { -19,   1}, { -21, -13}, {  -9, -22}, {   5,  -7}, {   1,   3},
+        { -10,   5}, { -16,  -4}, { -12, -14}, {  -1, -16}, {   2,  -9}, {   3,  -1}, {  -3,   4}, { -10,   1},
+        { -11,  -7}, {  -5, -12}, {   3,  -3}, {   1,   2}, {  -5,   2}, {  -8,  -2}, {  -6,  -7}, {  -1,  -8},
+        {   1,  -4}, {   2,   0}, {  -1,   2}, {  -5,   0}, {  -5,  -3}, {  -2,  -5}, {   1,  -2}, {   0,   1},
+        {  -2,   1}, {  -4,  -1}, {  -3,  -3}, {   0,  -3}, {   1,  -2}, {   1,   0}, {  -1,   1}, {  -2,   0},
+        {  -3,  -2}, {  -1,  -3}, {  -1,  -1},
+    },
+    { // 231
+        {   5, -16}, {   6,  -1}, {  -6,   7}, { -19,   1}, { -21, -13}, {  -9, -22}, {   5,  -6}, {   1,   3},
+        { -10,   4}, { -16,  -5}, { -12, -14}, {  -1, -15}, {   3,  -9}, {   3,  -1}, {  -3,   4}, { -10,   1},
+        { -11,  -7}, {  -5, -12}, {   3,  -3}, {   0,   2}, {  -5,   2}, {  -8,  -2}, {  -6,  -7}, {   0,  -8},
+        {   1,  -4}, {   1,   0}, {  -2,   2}, {  -5,   0}, {  -5,  -3}, {  -2,  -5}, {   1,  -1}, {   0,   1},
+        {  -2,   1}, {  -4,  -1}, {  -3,  -3}, {   0,  -3}, {   1,  -2}, {   1,   0}, {  -1,   1}, {  -2,   0},
+        {  -3,  -2}, {  -1,  -3}, {  -1,  -1},
+    },
+    { // 232
+        {   5, -15}, {   6,  -1}, {  -6,   7}, { -20,   1}, { -20, -14}, {  -8, -22}, {   5,  -6}, {   1,   4},
+        { -10,   4}, { -16,  -5}, { -12, -15}, {  -1, -15}, {   3,  -8}, {   3,   0}, {  -3,   4}, { -11,   0},
+        { -11,  -7}, {  -4, -12}, {   3,  -3}, {   0,   2}, {  -5,   2}, {  -8,  -2}, {  -6,  -7}, {   0,  -8},
+        {   1,  -4}, {   1,   0}, {  -2,   2}, {  -5,   0}, {  -5,  -3}, {  -2,  -5}, {   1,  -1}, {   0,   1},
+        {  -2,   1}, {  -4,  -1}, {  -3,  -3}, {   0,  -3}, {   1,  -2}, {   1,   0}, {  -1,   1}, {  -2,   0},
+        {  -3,  -2}, {  -1,  -3}, {  -1,  -1},
+    },
+    { // 233
+        {   5, -15}, {   6,  -1}, {  -7,   7}, { -20,   1}, { -20, -14}, {  -8, -22}, {   5,  -6}, {   0,   4},
+        { -11,   4}, { -16,  -5}, { -11, -15}, {   0, -15}, {   3,  -8}, {   3,   0}, {  -4,   4}, { -11,   0},
+        { -11,  -8}, {  -4, -12}, {   3,  -3}, {   0,   2}, {  -5,   2}, {  -8,  -3}, {  -6,  -7}, {   0,  -8},
+        {   1,  -4}, {   1,   0}, {  -2,   2}, {  -5,   0}, {  -5,  -4}, {  -2,  -5}, {   1,  -1}, {   0,   1},
+        {  -2,   1}, {  -4,  -1}, {  -3,  -3}, {   0,  -3}, {   1,  -2}, {   1,   0}, {  -1,   1}, {  -2,   0},
+        {  -3,  -2}, {  -1,  -3}, {  -1,  -1},
+    },
+    { // 234
+        {   5, -15}, {   5,   0}, {  -7,   7}, { -20,   0}, { -20, -14}, {  -8, -22}, {   5,  -6}, {   0,   4},
+        { -11,   4}, { -16,  -5}, { -11, -15}, {   0, -15}, {   3,  -8}, {   3,   0}, {  -4,   4}, { -11,   0},
+        { -11,  -8}, {  -4, -12}, {   3,  -3}, {   0,   2}, {  -5,   2}, {  -8,  -3}, {  -6,  -7}, {   0,  -8},
+        {   1,  -4}, {   1,   0}, {  -2,   2}, {  -5,   0}, {  -5,  -4}, {  -2,  -5}, {   1,  -1}, {   0,   1},
+        {  -2,   1}, {  -4,  -1}, {  -2,  -3}, {   0,  -3}, {   1,  -2}, {   1,   0}, {  -1,   1}, {  -2,   0},
+        {  -3,  -2}, {  -1,  -3}, {  -1,  -1},
+    },
+    { // 235
+        {   5, -15}, {   5,   0}, {  -7,   7}, { -20,   0}, { -20, -15}, {  -7, -22}, {   5,  -5}, {   0,   4},
+        { -11,   4}, { -16,  -6}, { -11, -15}, {   0, -15}, {   3,  -8}, {   3,   0}, {  -4,   4}, { -11,   0},
+        { -11,  -8}, {  -4, -12}, {   3,  -3}, {   0,   2}, {  -6,   2}, {  -8,  -3}, {  -5,  -8}, {   0,  -7},
+        {   1,  -4}, {   1,   0}, {  -2,   2}, {  -5,   0}, {  -5,  -4}, {  -2,  -5}, {   1,  -1}, {   0,   1},
+        {  -2,   1}, {  -4,  -1}, {  -2,  -3}, {   0,  -3}, {   1,  -2}, {   1,   0}, {  -1,   1}, {  -3,   0},
+        {  -2,  -2}, {  -1,  -3}, {  -1,  -1},
+    },
+    { // 236
+        {   6, -14}, {   5,   0}, {  -8,   7}, { -20,   0}, { -20, -15}, {  -7, -22}, {   5,  -5}, {   0,   4},
+        { -11,   4}, { -16,  -6}, { -11, -15}, {   0, -15}, {   3,  -8}, {   3,   0}, {  -4,   4}, { -11,   0},
+        { -11,  -8}, {  -4, -12}, {   3,  -3}, {   0,   2}, {  -6,   2}, {  -8,  -3}, {  -5,  -8}, {   0,  -7},
+        {   1,  -4}, {   1,   0}, {  -2,   2}, {  -5,   0}, {  -5,  -4}, {  -2,  -5}, {   1,  -1}, {   0,   1},
+        {  -3,   1}, {  -4,  -1}, {  -2,  -3}, {   0,  -3}, {   1,  -2}, {   1,   0}, {  -1,   1}, {  -3,   0},
+        {  -2,  -2}, {  -1,  -3}, {  -1,  -1},
+    },
+    { // 237
+        {   6, -14}, {   5,   1}, {  -8,   7}, { -20,  -1}, { -20, -15}, {  -6, -22}, {   5,  -5}, {  -1,   4},
+        { -12,   4}, { -16,  -6}, { -10, -15}, {   1, -15}, {   3,  -8}, {   3,   0}, {  -4,   4}, { -11,   0},
+        { -11,  -8}, {  -4, -12}, {   3,  -2}, {   0,   2}, {  -6,   2}, {  -8,  -3}, {  -5,  -8}, {   0,  -7},
+        {   1,  -3}, {   1,   0}, {  -2,   2}, {  -5,   0}, {  -5,  -4}, {  -2,  -5}, {   1,  -1}, {   0,   1},
+        {  -3,   1}, {  -4,  -1}, {  -2,  -3}, {   0,  -3}, {   1,  -2}, {   1,   0}, {  -1,   1}, {  -3,   0},
+        {  -2,  -2}, {  -1,  -3}, {  -1,  -1},
+    },
+    { // 238
+        {   6, -14}, {   5,   1}, {  -9,   7}, { -21,  -1}, { -19, -16}, {  -6, -22}, {   5,  -5}, {  -1,   4},
+        { -12,   4}, { -16,  -6}, { -10, -15}, {   1, -15}, {   3,  -7}, {   3,   1}, {  -5,   4}, { -11,  -1},
+        { -11,  -8}, {  -3, -12}, {   3,  -2}, {   0,   2}, {  -6,   2}, {  -8,  -3}, {  -5,  -8}, {   0,  -7},
+        {   1,  -3}, {   1,   0}, {  -2,   2}, {  -5,   0}, {  -5,  -4}, {  -2,  -5}, {   1,  -1}, {   0,   1},
+        {  -3,   1}, {  -4,  -1}, {  -2,  -3}, {   0,  -3}, {   1,  -2}, {   1,   0}, {  -1,   1}, {  -3,   0},
+        {  -2,  -2}, {  -1,  -3}, {  -1,  -1},
+    },
+    { // 239
+        {   6, -13}, {   5,   1}, {  -9,   7}, { -21,  -1}, { -19, -16}, {  -6, -22}, {   5,  -4}, {  -1,   5},
+        { -12,   3}, { -16,  -7}, { -10, -16}, {   1, -14}, {   3,  -7}, {   2,   1}, {  -5,   4}, { -11,  -1},
+        { -10,  -9}, {  -3, -12}, {   3,  -2}, {  -1,   2}, {  -6,   2}, {  -8,  -3}, {  -5,  -8}, {   0,  -7},
+        {   2,  -3}, {   1,   0}, {  -2,   2}, {  -5,   0}, {  -5,  -4}, {  -1,  -5}, {   1,  -1}, {   0,   1},
+        {  -3,   1}, {  -4,  -1}, {  -2,  -3}, {   0,  -3}, {   1,  -2}, {   1,   0}, {  -1,   1}, {  -3,   0},
+        {  -2,  -2}, {  -1,  -3}, {  -1,  -1},
+    },
+    { // 240
+        {   6, -13}, {   4,   2}, {  -9,   7}, { -21,  -2}, { -19, -16}, {  -5, -22}, {   5,  -4}, {  -1,   5},
+        { -12,   3}, { -16,  -7}, { -10, -16}, {   1, -14}, {   3,  -7}, {   2,   1}, {  -5,   4}, { -11,  -1},
+        { -10,  -9}, {  -3, -12}, {   3,  -2}, {  -1,   2}, {  -6,   2}, {  -8,  -3}, {  -5,  -8}, {   1,  -7},
+        {   2,  -3}, {   1,   0}, {  -2,   2}, {  -5,   0}, {  -5,  -4}, {  -1,  -5}, {   1,  -1}, {   0,   1},
+        {  -3,   1}, {  -4,  -2}, {  -2,  -3}, {   0,  -3}, {   1,  -2}, {   1,   0}, {  -1,   1}, {  -3,   0},
+        {  -2,  -2}, {  -1,  -3}, {  -1,  -1},
+    },
+    { // 241
+        {   6, -13}, {   4,   2}, { -10,   7}, { -21,  -2}, { -19, -17}, {  -5, -22}, {   5,  -4}, {  -2,   5},
+        { -12,   3}, { -16,  -7}, {  -9, -16}, {   1, -14}, {   3,  -7}, {   2,   1}, {  -5,   4}, { -11,  -1},
+        { -10,  -9}, {  -3, -12}, {   3,  -2}, {  -1,   2}, {  -6,   2}, {  -8,  -4}, {  -5,  -8}, {   1,  -7},
+        {   2,  -3}, {   1,   0}, {  -2,   2}, {  -5,  -1}, {  -5,  -4}, {  -1,  -5}, {   1,  -1}, {   0,   1},
+        {  -3,   1}, {  -4,  -2}, {  -2,  -4}, {   0,  -3}, {   1,  -2}, {   1,   0}, {  -1,   1}, {  -3,   0},
+        {  -2,  -2}, {  -1,  -3}, {  -1,  -1},
+    },
+    { // 242
+        {   6, -12}, {   4,   2}, { -10,   7}, { -21,  -2}, { -19, -17}, {  -5, -22}, {   5,  -4}, {  -2,   5},
+        { -13,   3}, { -16,  -7}, {  -9, -16}, {   2, -14}, {   4,  -7}, {   2,   1}, {  -5,   4}, { -11,  -1},
+        { -10,  -9}, {  -3, -12}, {   3,  -2}, {  -1,   2}, {  -6,   1}, {  -8,  -4}, {  -5,  -8}, {   1,  -7},
+        {   2,  -3}, {   1,   1}, {  -2,   2}, {  -5,  -1}, {  -5,  -4}, {  -1,  -5}, {   1,  -1}, {   0,   1},
+        {  -3,   1}, {  -4,  -2}, {  -2,  -4}, {   0,  -3}, {   1,  -2}, {   0,   0}, {  -1,   1}, {  -3,   0},
+        {  -2,  -2}, {  -1,  -3}, {  -1,  -1},
+    },
+    { // 243
+        {   7, -12}, {   4,   2}, { -10,   7}, { -21,  -3}, { -18, -17}, {  -4, -22}, {   5,  -3}, {  -2,   5},
+        { -13,   3}, { -16,  -8}, {  -9, -16}, {   2, -14}, {   4,  -6}, {   2,   1}, {  -6,   4}, { -12,  -1},
+        { -10,  -9}, {  -2, -12}, {   3,  -2}, {  -1,   2}, {  -6,   1}, {  -8,  -4}, {  -4,  -8}, {   1,  -7},
+        {   2,  -3}, {   1,   1}, {  -3,   2}, {  -5,  -1}, {  -5,  -4}, {  -1,  -5}, {   1,  -1}, {   0,   1},
+        {  -3,   1}, {  -4,  -2}, {  -2,  -4}, {   0,  -3}, {   1,  -1}, {   0,   0}, {  -1,   1}, {  -3,   0},
+        {  -2,  -2}, {  -1,  -3}, {  -1,  -1},
+    },
+    { // 244
+        {   7, -12}, {   3,   3}, { -11,   7}, { -21,  -3}, { -18, -17}, {  -4, -22}, {   5,  -3}, {  -2,   5},
+        { -13,   3}, { -16,  -8}, {  -9, -16}, {   2, -14}, {   4,  -6}, {   2,   1}, {  -6,   4}, { -12,  -2},
+        { -10,  -9}, {  -2, -12}, {   3,  -2}, {  -1,   3}, {  -7,   1}, {  -8,  -4}, {  -4,  -8}, {   1,  -7},
+        {   2,  -3}, {   1,   1}, {  -3,   2}, {  -5,  -1}, {  -5,  -4}, {  -1,  -5}, {   1,  -1}, {  -1,   1},
+        {  -3,   1}, {  -4,  -2}, {  -2,  -4}, {   0,  -3}, {   1,  -1}, {   0,   0}, {  -1,   1}, {  -3,   0},
+        {  -2,  -2}, {  -1,  -3}, {  -1,  -1},
+    },
+    { // 245
+        {   7, -11}, {   3,   3}, { -11,   7}, { -21,  -3}, { -18, -18}, {  -4, -22}, {   5,  -3}, {  -3,   5},
+        { -13,   2}, { -16,  -8}, {  -8, -16}, {   2, -13}, {   4,  -6}, {   2,   2}, {  -6,   4}, { -12,  -2},
+        { -10, -10}, {  -2, -12}, {   3,  -1}, {  -1,   3}, {  -7,   1}, {  -8,  -4}, {  -4,  -8}, {   1,  -7},
+        {   2,  -3}, {   1,   1}, {  -3,   2}, {  -5,  -1}, {  -4,  -4}, {  -1,  -5}, {   1,  -1}, {  -1,   1},
+        {  -3,   1}, {  -4,  -2}, {  -2,  -4}, {   0,  -3}, {   1,  -1}, {   0,   0}, {  -1,   1}, {  -3,   0},
+        {  -2,  -2}, {   0,  -3}, {  -1,  -1},
+    },
+    { // 246
+        {   7, -11}, {   3,   3}, { -11,   7}, { -22,  -4}, { -18, -18}, {  -3, -21}, {   5,  -2}, {  -3,   5},
+        { -13,   2}, { -16,  -9}, {  -8, -16}, {   2, -13}, {   4,  -6}, {   2,   2}, {  -6,   4}, { -12,  -2},
+        {  -9, -10}, {  -2, -12}, {   3,  -1}, {  -1,   3}, {  -7,   1}, {  -8,  -4}, {  -4,  -8}, {   1,  -7},
+        {   2,  -3}, {   1,   1}, {  -3,   2}, {  -5,  -1}, {  -4,  -4}, {  -1,  -5}, {   1,  -1}, {  -1,   1},
+        {  -3,   0}, {  -4,  -2}, {  -2,  -4}, {   1,  -3}, {   1,  -1}, {   0,   0}, {  -1,   1}, {  -3,   0},
+        {  -2,  -2}, {   0,  -3}, {  -1,  -1},
+    },
+    { // 247
+        {   7, -11}, {   3,   3}, { -12,   7}, { -22,  -4}, { -17, -18}, {  -3, -21}, {   5,  -2}, {  -3,   5},
+        { -14,   2}, { -16,  -9}, {  -8, -16}, {   3, -13}, {   4,  -6}, {   1,   2}, {  -6,   4}, { -12,  -2},
+        {  -9, -10}, {  -2, -12}, {   2,  -1}, {  -2,   3}, {  -7,   1}, {  -8,  -4}, {  -4,  -8}, {   1,  -6},
+        {   2,  -3}, {   1,   1}, {  -3,   2}, {  -5,  -1}, {  -4,  -5}, {  -1,  -5}, {   1,   0}, {  -1,   1},
+        {  -3,   0}, {  -4,  -2}, {  -2,  -4}, {   1,  -3}, {   1,  -1}, {   0,   0}, {  -1,   1}, {  -3,  -1},
+        {  -2,  -2}, {   0,  -3}, {  -1,  -1},
+    },
+    { // 248
+        {   7, -10}, {   2,   4}, { -12,   7}, { -22,  -4}, { -17, -18}, {  -3, -21}, {   5,  -2}, {  -3,   5},
+        { -14,   2}, { -16,  -9}, {  -8, -16}, {   3, -13}, {   4,  -6}, {   1,   2}, {  -7,   4}, { -12,  -2},
+        {  -9, -10}, {  -1, -11}, {   2,  -1}, {  -2,   3}, {  -7,   1}, {  -8,  -5}, {  -4,  -8}, {   1,  -6},
+        {   2,  -3}, {   1,   1}, {  -3,   2}, {  -5,  -1}, {  -4,  -5}, {  -1,  -5}, {   1,   0}, {  -1,   1},
+        {  -3,   0}, {  -4,  -2}, {  -2,  -4}, {   1,  -3}, {   1,  -1}, {   0,   0}, {  -2,   1}, {  -3,  -1},
+        {  -2,  -2}, {   0,  -3}, {  -1,  -1},
+    },
+    { // 249
+        {   7, -10}, {   2,   4}, { -12,   6}, { -22,  -5}, { -17, -19}, {  -2, -21}, {   5,  -2}, {  -4,   5},
+        { -14,   2}, { -16,  -9}, {  -7, -16}, {   3, -13}, {   4,  -5}, {   1,   2}, {  -7,   3}, { -12,  -3},
+        {  -9, -10}, {  -1, -11}, {   2,  -1}, {  -2,   3}, {  -7,   1}, {  -8,  -5}, {  -4,  -8}, {   1,  -6},
+        {   2,  -2}, {   1,   1}, {  -3,   2}, {  -5,  -1}, {  -4,  -5}, {  -1,  -5}, {   1,   0}, {  -1,   1},
+        {  -3,   0}, {  -4,  -2}, {  -2,  -4}, {   1,  -3}, {   1,  -1}, {   0,   0}, {  -2,   1}, {  -3,  -1},
+        {  -2,  -2}, {   0,  -3}, {  -1,  -1},
+    },
+    { // 250
+        {   7,  -9}, {   2,   4}, { -13,   6}, { -22,  -5}, { -16, -19}, {  -2, -21}, {   5,  -1}, {  -4,   5},
+        { -14,   1}, { -16, -10}, {  -7, -16}, {   3, -12}, {   4,  -5}, {   1,   2}, {  -7,   3}, { -12,  -3},
+        {  -9, -10}, {  -1, -11}, {   2,  -1}, {  -2,   3}, {  -7,   1}, {  -8,  -5}, {  -4,  -8}, {   2,  -6},
+        {   2,  -2}, {   0,   1}, {  -3,   2}, {  -5,  -1}, {  -4,  -5}, {   0,  -5}, {   1,   0}, {  -1,   1},
+        {  -3,   0}, {  -3,  -2}, {  -2,  -4}, {   1,  -3}, {   1,  -1}, {   0,   1}, {  -2,   1}, {  -3,  -1},
+        {  -2,  -2}, {   0,  -3}, {  -1,  -1},
+    },
+    { // 251
+        {   7,  -9}, {   1,   4}, { -13,   6}, { -22,  -6}, { -16, -19}, {  -2, -21}, {   5,  -1}, {  -4,   5},
+        { -14,   1}, { -16, -10}, {  -7, -16}, {   3, -12}, {   4,  -5}, {   1,   2}, {  -7,   3}, { -12,  -3},
+        {  -9, -10}, {  -1, -11}, {   2,  -1}, {  -2,   3}, {  -7,   1}, {  -8,  -5}, {  -3,  -8}, {   2,  -6},
+        {   2,  -2}, {   0,   1}, {  -3,   2}, {  -5,  -1}, {  -4,  -5}, {   0,  -5}, {   1,   0}, {  -1,   1},
+        {  -3,   0}, {  -3,  -2}, {  -2,  -4}, {   1,  -3}, {   1,  -1}, {   0,   1}, {  -2,   1}, {  -3,  -1},
+        {  -2,  -2}, {   0,  -3}, {  -1,  -1},
+    },
+    { // 252
+        {   7,  -9}, {   1,   5}, { -13,   6}, { -22,  -6}, { -16, -19}, {  -1, -21}, {   5,  -1}, {  -4,   5},
+        { -14,   1}, { -16, -10}, {  -7, -16}, {   3, -12}, {   4,  -5}, {   1,   2}, {  -7,   3}, { -12,  -3},
+        {  -9, -10}, {  -1, -11}, {   2,   0}, {  -2,   3}, {  -7,   0}, {  -8,  -5}, {  -3,  -8}, {   2,  -6},
+        {   2,  -2}, {   0,   1}, {  -3,   2}, {  -5,  -1}, {  -4,  -5}, {   0,  -5}, {   1,   0}, {  -1,   1},
+        {  -3,   0}, {  -3,  -2}, {  -1,  -4}, {   1,  -3}, {   1,  -1}, {   0,   1}, {  -2,   1}, {  -3,  -1},
+        {  -2,  -2}, {   0,  -3}, {  -1,  -1},
+    },
+    { // 253
+        {   7,  -8}, {   1,   5}, { -14,   6}, { -22,  -6}, { -16, -19}, {  -1, -21}, {   4,  -1}, {  -5,   5},
+        { -15,   1}, { -15, -10}, {  -6, -16}, {   4, -12}, {   4,  -5}, {   0,   3}, {  -7,   3}, { -12,  -3},
+        {  -8, -11}, {  -1, -11}, {   2,   0}, {  -2,   3}, {  -7,   0}, {  -8,  -5}, {  -3,  -8}, {   2,  -6},
+        {   2,  -2}, {   0,   1}, {  -3,   1}, {  -5,  -2}, {  -4,  -5}, {   0,  -5}, {   1,   0}, {  -1,   1},
+        {  -3,   0}, {  -3,  -2}, {  -1,  -4}, {   1,  -3}, {   1,  -1}, {   0,   1}, {  -2,   1}, {  -3,  -1},
+        {  -2,  -2}, {   0,  -3}, {  -1,  -1},
+    },
+    { // 254
+        {   7,  -8}, {   1,   5}, { -14,   6}, { -22,  -7}, { -15, -20}, {  -1, -20}, {   4,   0}, {  -5,   5},
+        { -15,   0}, { -15, -11}, {  -6, -16}, {   4, -11}, {   4,  -4}, {   0,   3}, {  -8,   3}, { -12,  -4},
+        {  -8, -11}, {   0, -11}, {   2,   0}, {  -2,   3}, {  -7,   0}, {  -8,  -5}, {  -3,  -8}, {   2,  -6},
+        {   2,  -2}, {   0,   1}, {  -4,   1}, {  -5,  -2}, {  -4,  -5}, {   0,  -5}, {   1,   0}, {  -1,   1},
+        {  -3,   0}, {  -3,  -2}, {  -1,  -4}, {   1,  -3}, {   1,  -1}, {   0,   1}, {  -2,   1}, {  -3,  -1},
+        {  -2,  -2}, {   0,  -3}, {  -1,  -1},
+    },
+    { // 255
+        {   7,  -8}, {   0,   5}, { -14,   6}, { -22,  -7}, { -15, -20}, {   0, -20}, {   4,   0}, {  -5,   5},
+        { -15,   0}, { -15, -11}, {  -6, -16}, {   4, -11}, {   4,  -4}, {   0,   3}, {  -8,   3}, { -12,  -4},
+        {  -8, -11}, {   0, -11}, {   2,   0}, {  -3,   3}, {  -7,   0}, {  -8,  -5}, {  -3,  -8}, {   2,  -6},
+        {   2,  -2}, {   0,   1}, {  -4,   1}, {  -5,  -2}, {  -4,  -5}, {   0,  -5}, {   1,   0}, {  -1,   1},
+        {  -3,   0}, {  -3,  -2}, {  -1,  -4}, {   1,  -2}, {   1,  -1}, {   0,   1}, {  -2,   1}, {  -3,  -1},
+        {  -2,  -2}, {   0,  -3}, {  -1,  -1},
+    },
+};
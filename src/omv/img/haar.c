@@ -9,34 +9,137 @@
  */
 #include <ff.h>
 #include <stdio.h>
+#include <float.h>
+#include <string.h>
+#include "mdefs.h"
 #include "xalloc.h"
 #include "imlib.h"
+#include "fb_alloc.h"
 #include <arm_math.h>
 // built-in cascades
 #include "cascade.h"
+#define DETECT_INIT_SIZE (16)
+// Relative size difference allowed when grouping detections.
+#define DETECT_GROUP_EPS (0.2f)
+// Detection window dilation for tracked objects, relative to their width.
+#define DETECTOR_MARGIN (0.5f)
+// Bytes kept free for fb_alloc bookkeeping.
+#define DETECT_FB_SLACK (64)
+
+#ifdef IMLIB_CASCADE_STATS
+#define CASCADE_STATS_WINDOW(c) \
+    do { if ((c)->stats) (c)->stats->windows++; } while (0)
+#define CASCADE_STATS_STAGE(c, i, n) \
+    do { if ((c)->stats) { (c)->stats->stage_windows[i]++; (c)->stats->stage_features[i] += (n); } } while (0)
+#else
+#define CASCADE_STATS_WINDOW(c)
+#define CASCADE_STATS_STAGE(c, i, n)
+#endif
+
+// Cascade rectangle scaled to a pyramid level.
+typedef struct haar_rect {
+    int32_t off;    // Top-left corner offset from the window in the integral image.
+    int32_t dx;     // Width.
+    int32_t dy;     // Height times the integral image stride.
+    int32_t weight; // Weight corrected for the rounded rectangle area.
+} haar_rect_t;
+
+// Cascade scaled to a pyramid level.
+typedef struct haar_scale {
+    int win_w, win_h;   // Scaled window size.
+    int win_dx, win_dy; // Window corner offsets in the integral image.
+    int win_n;          // Scaled window area.
+    float std_norm;     // Unscaled to scaled window area ratio.
+    int n_rects;
+    haar_rect_t *rects;
+} haar_scale_t;
+
+// Occupancy grid of a binary mask over the ROI. Each cell is set if any of
+// its mask pixels is set, and the grid is stored as a summed area table so
+// any window can be tested in constant time.
+typedef struct mask_grid {
+    int w, h;           // Grid size (in cells) plus one.
+    uint16_t *sat;      // Summed area table of occupied cells.
+} mask_grid_t;
+
+#define MASK_GRID_CELL  (8)  // Cell size in pixels.
+
+// Packed cascade file header, followed by the packed stages.
+typedef struct cascade_header {
+    uint32_t magic;
+    int32_t window_w;
+    int32_t window_h;
+    int32_t n_stages;
+    uint32_t size;      // Size of the packed stages in bytes.
+} cascade_header_t;
+
+#define CASCADE_MAGIC   (0x31434148) // "HAC1"
+
+// Returns the weak classifier following this one in a packed stage.
+ALWAYS_INLINE static const cascade_feature_t *cascade_next_feature(const cascade_feature_t *feature)
+{
+    return (const cascade_feature_t *) (((const cascade_rect_t *) (feature + 1)) + feature->n_rectangles);
+}
+
+static void mask_grid_init(mask_grid_t *grid, image_t *mask, rectangle_t *roi)
+{
+    grid->w = ((roi->w + MASK_GRID_CELL - 1) / MASK_GRID_CELL) + 1;
+    grid->h = ((roi->h + MASK_GRID_CELL - 1) / MASK_GRID_CELL) + 1;
+    grid->sat = fb_alloc0(grid->w * grid->h * sizeof(uint16_t));
+
+    for (int gy=1; gy<grid->h; gy++) {
+        uint16_t *row = grid->sat + (gy * grid->w);
+        int y1 = roi->y + ((gy - 1) * MASK_GRID_CELL);
+        int y2 = IM_MIN(y1 + MASK_GRID_CELL, roi->y + roi->h);
+        for (int s=0, gx=1; gx<grid->w; gx++) {
+            int x1 = roi->x + ((gx - 1) * MASK_GRID_CELL);
+            int x2 = IM_MIN(x1 + MASK_GRID_CELL, roi->x + roi->w);
+            int occupied = 0;
+            for (int y=y1; (y<y2) && !occupied; y++) {
+                for (int x=x1; x<x2; x++) {
+                    if (mask->pixels[(y * mask->w) + x]) {
+                        occupied = 1;
+                        break;
+                    }
+                }
+            }
+            s += occupied;
+            row[gx] = s + row[gx - grid->w];
+        }
+    }
+}
+
+// Returns true if the window (relative to the ROI) overlaps an occupied cell.
+static bool mask_grid_test(mask_grid_t *grid, int x, int y, int w, int h)
+{
+    int x1 = x / MASK_GRID_CELL;
+    int y1 = y / MASK_GRID_CELL;
+    int x2 = IM_MIN(((x + w - 1) / MASK_GRID_CELL) + 1, grid->w - 1);
+    int y2 = IM_MIN(((y + h - 1) / MASK_GRID_CELL) + 1, grid->h - 1);
+#define SAT_AT(x, y) (grid->sat[((y) * grid->w) + (x)])
+    return (SAT_AT(x2, y2) + SAT_AT(x1, y1) - SAT_AT(x2, y1) - SAT_AT(x1, y2)) != 0;
+#undef SAT_AT
+}
 
-static int eval_weak_classifier(cascade_t *cascade, point_t pt, int t_idx, int w_idx, int r_idx)
+static int eval_weak_classifier(cascade_t *cascade, point_t pt, const cascade_feature_t *feature)
 {
     int32_t sumw=0;
     mw_image_t *sum = cascade->sum;
+    const cascade_rect_t *r = (const cascade_rect_t *) (feature + 1);
 
     /* The node threshold is multiplied by the standard deviation of the sub window */
-    int32_t t = cascade->tree_thresh_array[t_idx] * cascade->std;
+    int32_t t = feature->threshold * cascade->std;
 
-    for (int i=0; i<cascade->num_rectangles_array[t_idx]; i++) {
-        int x = cascade->rectangles_array[r_idx + (i<<2) + 0];
-        int y = cascade->rectangles_array[r_idx + (i<<2) + 1];
-        int w = cascade->rectangles_array[r_idx + (i<<2) + 2];
-        int h = cascade->rectangles_array[r_idx + (i<<2) + 3];
+    for (int i=0; i<feature->n_rectangles; i++, r++) {
         // Lookup the feature
-        sumw += imlib_integral_mw_lookup(sum, pt.x+x, y, w, h) * (cascade->weights_array[w_idx + i]<<12);
+        sumw += imlib_integral_mw_lookup(sum, pt.x+r->x, r->y, r->w, r->h) * r->weight;
     }
 
     if (sumw >= t) {
-        return cascade->alpha2_array[t_idx];
+        return feature->alpha2;
     }
 
-    return cascade->alpha1_array[t_idx];
+    return feature->alpha1;
 }
 
 static int run_cascade_classifier(cascade_t* cascade, point_t pt)
@@ -44,39 +147,44 @@ static int run_cascade_classifier(cascade_t* cascade, point_t pt)
     int win_w = cascade->window.w;
     int win_h = cascade->window.h;
     int32_t n = (win_w * win_h);
+    CASCADE_STATS_WINDOW(cascade);
     int32_t i_s = imlib_integral_mw_lookup (cascade->sum, pt.x,   0, win_w, win_h);
     int32_t i_sq = imlib_integral_mw_lookup(cascade->ssq, pt.x, 0, win_w, win_h);
-    int32_t v = i_sq*n-(i_s*i_s);
-    cascade->std = fast_sqrtf(fast_fabsf(v));
+    int64_t v = ((int64_t) i_sq * n) - ((int64_t) i_s * i_s);
 
-    for (int i=0, w_idx=0, r_idx=0, t_idx=0; i<cascade->n_stages; i++) {
+    // Skip flat windows, v is the variance times n^2.
+    if (v < ((int64_t) cascade->min_variance * n * n)) {
+        return 0;
+    }
+
+    cascade->std = fast_sqrtf(fast_fabsf((float) v));
+
+    const cascade_stage_t *stage = (const cascade_stage_t *) cascade->stages;
+    for (int i=0; i<cascade->n_stages; i++) {
         int stage_sum = 0;
-        for (int j=0; j<cascade->stages_array[i]; j++, t_idx++) {
+        const cascade_feature_t *feature = (const cascade_feature_t *) (stage + 1);
+        CASCADE_STATS_STAGE(cascade, i, stage->n_features);
+        for (int j=0; j<stage->n_features; j++) {
             // Send the shifted window to a haar filter
-            stage_sum += eval_weak_classifier(cascade, pt, t_idx, w_idx, r_idx);
-            w_idx += cascade->num_rectangles_array[t_idx];
-            r_idx += cascade->num_rectangles_array[t_idx] * 4;
+            stage_sum += eval_weak_classifier(cascade, pt, feature);
+            feature = cascade_next_feature(feature);
         }
         // If the sum is below the stage threshold, no objects were detected
-        if (stage_sum < (cascade->threshold * cascade->stages_thresh_array[i])) {
+        if (stage_sum < (cascade->threshold * stage->threshold)) {
             return -i;
         }
+        stage = (const cascade_stage_t *) feature;
     }
     return 1;
 }
 
-array_t *imlib_detect_objects(image_t *image, cascade_t *cascade, rectangle_t *roi)
+static void detect_objects_mw(arena_t *rects, image_t *image, cascade_t *cascade, rectangle_t *roi,
+        mask_grid_t *grid, float min_factor, float max_factor)
 {
     // Integral images
     mw_image_t sum;
     mw_image_t ssq;
 
-    // Detected objects array
-    array_t *objects;
-
-    // Allocate the objects array
-    array_alloc(&objects, xfree);
-
     // Set cascade image pointers
     cascade->img = image;
     cascade->sum = &sum;
@@ -98,7 +206,7 @@ array_t *imlib_detect_objects(image_t *image, cascade_t *cascade, rectangle_t *r
     imlib_integral_mw_alloc(&ssq, roi->w, cascade->window.h+1);
 
     // Iterate over the image pyramid
-    for(float factor=1.0f; ; factor *= cascade->scale_factor) {
+    for(float factor=min_factor; factor<=max_factor; factor *= cascade->scale_factor) {
         // Set the scaled width and height
         int szw = roi->w/factor;
         int szh = roi->h/factor;
@@ -128,11 +236,18 @@ array_t *imlib_detect_objects(image_t *image, cascade_t *cascade, rectangle_t *r
         for (int y=0; y<y2; y+=cascade->step) {
             for (int x=0; x<x2; x+=cascade->step) {
                 point_t p = {x, y};
+                // Skip windows outside of the mask
+                if (grid && !mask_grid_test(grid, fast_roundf(x*factor), fast_roundf(y*factor),
+                            fast_roundf(cascade->window.w*factor), fast_roundf(cascade->window.h*factor))) {
+                    continue;
+                }
                 // If an object is detected, record the coordinates of the filter window
                 if (run_cascade_classifier(cascade, p) > 0) {
-                    array_push_back(objects,
-                                rectangle_alloc(fast_roundf(x*factor) + roi->x, fast_roundf(y*factor) + roi->y,
-                                fast_roundf(cascade->window.w*factor), fast_roundf(cascade->window.h*factor)));
+                    rectangle_t *r = arena_push_back(rects);
+                    r->x = fast_roundf(x*factor) + roi->x;
+                    r->y = fast_roundf(y*factor) + roi->y;
+                    r->w = fast_roundf(cascade->window.w*factor);
+                    r->h = fast_roundf(cascade->window.h*factor);
                 }
             }
 
@@ -145,190 +260,470 @@ array_t *imlib_detect_objects(image_t *image, cascade_t *cascade, rectangle_t *r
 
     imlib_integral_mw_free(&ssq);
     imlib_integral_mw_free(&sum);
+}
+
+static int run_cascade_classifier_scaled(cascade_t *cascade, haar_scale_t *scale, uint32_t *sum, uint32_t *ssq)
+{
+    CASCADE_STATS_WINDOW(cascade);
+
+    // Window sum and squared sum, the ssq difference can exceed 32 bits.
+    uint32_t i_s = sum[scale->win_dx+scale->win_dy] + sum[0] - sum[scale->win_dx] - sum[scale->win_dy];
+    uint32_t i_sq = ssq[scale->win_dx+scale->win_dy] + ssq[0] - ssq[scale->win_dx] - ssq[scale->win_dy];
+    int64_t v = ((int64_t) i_sq * scale->win_n) - ((int64_t) i_s * i_s);
+
+    // Skip flat windows, v is the variance times n^2.
+    if (v < ((int64_t) cascade->min_variance * scale->win_n * scale->win_n)) {
+        return 0;
+    }
 
-    if (array_length(objects) > 1)   {
-        // Merge objects detected at different scales
-        objects = rectangle_merge(objects);
+    // Normalize the standard deviation to the unscaled window area
+    // to match the area corrected rectangle weights.
+    int32_t std = fast_sqrtf(fast_fabsf((float) v)) * scale->std_norm;
+
+    haar_rect_t *r = scale->rects;
+    const cascade_stage_t *stage = (const cascade_stage_t *) cascade->stages;
+    for (int i=0; i<cascade->n_stages; i++) {
+        int stage_sum = 0;
+        const cascade_feature_t *feature = (const cascade_feature_t *) (stage + 1);
+        CASCADE_STATS_STAGE(cascade, i, stage->n_features);
+        for (int j=0; j<stage->n_features; j++) {
+            int32_t sumw = 0;
+            for (int k=0; k<feature->n_rectangles; k++, r++) {
+                uint32_t *p = sum + r->off;
+                sumw += (int32_t) (p[r->dx+r->dy] + p[0] - p[r->dx] - p[r->dy]) * r->weight;
+            }
+            /* The node threshold is multiplied by the standard deviation of the sub window */
+            if (sumw >= (feature->threshold * std)) {
+                stage_sum += feature->alpha2;
+            } else {
+                stage_sum += feature->alpha1;
+            }
+            feature = cascade_next_feature(feature);
+        }
+        // If the sum is below the stage threshold, no objects were detected
+        if (stage_sum < (cascade->threshold * stage->threshold)) {
+            return -i;
+        }
+        stage = (const cascade_stage_t *) feature;
     }
+    return 1;
+}
 
-    return objects;
+// Precomputes the cascade rectangles scaled by factor. Rectangle corners are
+// rounded to integers and stored as offsets from the window origin in the
+// integral image, and weights are corrected for the rounded rectangle areas.
+static void haar_scale_init(haar_scale_t *scale, cascade_t *cascade, float factor, int stride)
+{
+    int win_w = fast_roundf(cascade->window.w * factor);
+    int win_h = fast_roundf(cascade->window.h * factor);
+
+    scale->win_w = win_w;
+    scale->win_h = win_h;
+    scale->win_dx = win_w;
+    scale->win_dy = win_h * stride;
+    scale->win_n = win_w * win_h;
+    scale->std_norm = (cascade->window.w * cascade->window.h) / (float) (win_w * win_h);
+
+    haar_rect_t *r = scale->rects;
+    const cascade_stage_t *stage = (const cascade_stage_t *) cascade->stages;
+    for (int i=0; i<cascade->n_stages; i++) {
+        const cascade_feature_t *feature = (const cascade_feature_t *) (stage + 1);
+        for (int j=0; j<stage->n_features; j++) {
+            const cascade_rect_t *c = (const cascade_rect_t *) (feature + 1);
+            for (int k=0; k<feature->n_rectangles; k++, c++, r++) {
+                int sx = IM_MIN(fast_roundf(c->x * factor), win_w - 1);
+                int sy = IM_MIN(fast_roundf(c->y * factor), win_h - 1);
+                int sw = IM_MAX(IM_MIN(fast_roundf(c->w * factor), win_w - sx), 1);
+                int sh = IM_MAX(IM_MIN(fast_roundf(c->h * factor), win_h - sy), 1);
+
+                r->off = (sy * stride) + sx;
+                r->dx = sw;
+                r->dy = sh * stride;
+                // Same fixed point weight as eval_weak_classifier, per unscaled area.
+                r->weight = fast_roundf(c->weight * (c->w * c->h) / (float) (sw * sh));
+            }
+            feature = cascade_next_feature(feature);
+        }
+        stage = (const cascade_stage_t *) feature;
+    }
 }
 
-int imlib_load_cascade_from_file(cascade_t *cascade, const char *path)
+// Builds the integral images once and scales the features instead of the image.
+static void detect_objects_scaled(arena_t *rects, image_t *image, cascade_t *cascade, rectangle_t *roi,
+        mask_grid_t *grid, int n_rects, float min_factor, float max_factor)
 {
-    int i;
-    UINT n_out;
+    i_image_t sum;
+    i_image_t ssq;
+    haar_scale_t scale;
 
-    FIL fp;
-    FRESULT res=FR_OK;
+    imlib_integral_image_alloc(&sum, roi->w+1, roi->h+1);
+    imlib_integral_image_alloc(&ssq, roi->w+1, roi->h+1);
+    scale.n_rects = n_rects;
+    scale.rects = fb_alloc(n_rects * sizeof(haar_rect_t));
 
-    res = f_open(&fp, path, FA_READ|FA_OPEN_EXISTING);
-    if (res != FR_OK) {
-        return res;
-    }
+    imlib_integral_image_ss(image, roi, &sum, &ssq);
 
-    /* read detection window size */
-    res = f_read(&fp, &cascade->window, sizeof(cascade->window), &n_out);
-    if (res != FR_OK || n_out != sizeof(cascade->window)) {
-        goto error;
-    }
+    // Same scanning step schedule as the moving window detector.
+    int step = IM_MIN((roi->w*50)/1000, cascade->window.w);
+
+    for (float factor=min_factor; factor<=max_factor; factor *= cascade->scale_factor) {
+        // Break if the scaled window is bigger than the image
+        if ((roi->w/factor) < cascade->window.w || (roi->h/factor) < cascade->window.h) {
+            break;
+        }
+
+        haar_scale_init(&scale, cascade, factor, sum.w);
+
+        step = IM_MAX(step/factor, 1);
+        int scaled_step = IM_MAX(fast_roundf(step*factor), 1);
+
+        int y2 = roi->h - scale.win_h;
+        int x2 = roi->w - scale.win_w;
 
-    /* read num stages */
-    res = f_read(&fp, &cascade->n_stages, sizeof(cascade->n_stages), &n_out);
-    if (res != FR_OK || n_out != sizeof(cascade->n_stages)) {
-        goto error;
+        // Shift the filter window over the image.
+        for (int y=0; y<y2; y+=scaled_step) {
+            uint32_t *sum_row = sum.data + (y * sum.w);
+            uint32_t *ssq_row = ssq.data + (y * ssq.w);
+            for (int x=0; x<x2; x+=scaled_step) {
+                // Skip windows outside of the mask
+                if (grid && !mask_grid_test(grid, x, y, scale.win_w, scale.win_h)) {
+                    continue;
+                }
+                // If an object is detected, record the coordinates of the filter window
+                if (run_cascade_classifier_scaled(cascade, &scale, sum_row + x, ssq_row + x) > 0) {
+                    rectangle_t *r = arena_push_back(rects);
+                    r->x = x + roi->x;
+                    r->y = y + roi->y;
+                    r->w = scale.win_w;
+                    r->h = scale.win_h;
+                }
+            }
+        }
     }
 
-    cascade->stages_array = xalloc (sizeof(*cascade->stages_array) * cascade->n_stages);
-    cascade->stages_thresh_array = xalloc (sizeof(*cascade->stages_thresh_array) * cascade->n_stages);
+    fb_free(); // scale.rects
+    imlib_integral_image_free(&ssq);
+    imlib_integral_image_free(&sum);
+}
 
-    if (cascade->stages_array == NULL ||
-        cascade->stages_thresh_array == NULL) {
-        res = 20;
-        goto error;
+// Detects objects in the ROI at scales from min_factor to max_factor.
+static void detect_objects_range(arena_t *rects, image_t *image, cascade_t *cascade, rectangle_t *roi,
+        float min_factor, float max_factor)
+{
+    // Number of rectangles used by the (possibly truncated) cascade.
+    int n_rects = 0;
+    const cascade_stage_t *stage = (const cascade_stage_t *) cascade->stages;
+    for (int i=0; i<cascade->n_stages; i++) {
+        const cascade_feature_t *feature = (const cascade_feature_t *) (stage + 1);
+        for (int j=0; j<stage->n_features; j++) {
+            n_rects += feature->n_rectangles;
+            feature = cascade_next_feature(feature);
+        }
+        stage = (const cascade_stage_t *) feature;
     }
 
-    /* read num features in each stages */
-    res = f_read(&fp, cascade->stages_array, sizeof(uint8_t) * cascade->n_stages, &n_out);
-    if (res != FR_OK || n_out != sizeof(uint8_t) * cascade->n_stages) {
-        goto error;
+    // Only scan windows overlapping the mask
+    mask_grid_t grid;
+    if (cascade->mask) {
+        mask_grid_init(&grid, cascade->mask, roi);
     }
 
-    /* sum num of features in each stages*/
-    for (i=0, cascade->n_features=0; i<cascade->n_stages; i++) {
-        cascade->n_features += cascade->stages_array[i];
+    // Scale the features if the full integral images fit in memory,
+    // otherwise fall back to rescaling a moving window integral image.
+    uint32_t size = ((roi->w+1) * (roi->h+1) * sizeof(uint32_t) * 2)
+                  + (n_rects * sizeof(haar_rect_t)) + DETECT_FB_SLACK;
+    if (size <= fb_avail()) {
+        detect_objects_scaled(rects, image, cascade, roi, cascade->mask ? &grid : NULL,
+                n_rects, min_factor, max_factor);
+    } else {
+        detect_objects_mw(rects, image, cascade, roi, cascade->mask ? &grid : NULL,
+                min_factor, max_factor);
     }
 
-    /* alloc features thresh array, alpha1, alpha 2,rects weights and rects*/
-    cascade->tree_thresh_array = xalloc (sizeof(*cascade->tree_thresh_array) * cascade->n_features);
-    cascade->alpha1_array = xalloc (sizeof(*cascade->alpha1_array) * cascade->n_features);
-    cascade->alpha2_array = xalloc (sizeof(*cascade->alpha2_array) * cascade->n_features);
-    cascade->num_rectangles_array = xalloc (sizeof(*cascade->num_rectangles_array) * cascade->n_features);
-
-    if (cascade->tree_thresh_array == NULL ||
-        cascade->alpha1_array   == NULL ||
-        cascade->alpha2_array   == NULL ||
-        cascade->num_rectangles_array == NULL) {
-        res = 20;
-        goto error;
+    if (cascade->mask) {
+        fb_free(); // grid.sat
     }
+}
 
-    /* read stages thresholds */
-    res = f_read(&fp, cascade->stages_thresh_array, sizeof(int16_t)*cascade->n_stages, &n_out);
-    if (res != FR_OK || n_out != sizeof(int16_t)*cascade->n_stages) {
-        goto error;
+void imlib_detect_objects(arena_t *objects, image_t *image, cascade_t *cascade, rectangle_t *roi)
+{
+    // Raw detections, grouped into objects at the end.
+    arena_t rects;
+    arena_alloc(&rects, sizeof(rectangle_t), DETECT_INIT_SIZE);
+
+    detect_objects_range(&rects, image, cascade, roi, 1.0f, FLT_MAX);
+
+    // Group objects detected at neighbouring positions and scales
+    rectangle_merge(&rects, objects, cascade->min_neighbors, DETECT_GROUP_EPS);
+    arena_free(&rects);
+
+    arena_trim(objects);
+}
+
+void imlib_detector_init(detector_t *detector, cascade_t *cascade, int interval)
+{
+    detector->cascade = cascade;
+    detector->interval = interval;
+    detector->frames = 0;
+    detector->lost = false;
+    arena_alloc(&detector->objects, sizeof(detection_t), 0);
+}
+
+// Detects objects using the previous frame's detections. Most frames only
+// scan a dilated window around each previous detection at its neighbouring
+// scales. The whole ROI is scanned at all scales every interval frames,
+// when nothing is being tracked, or after a tracked object was lost.
+void imlib_detector_detect(arena_t *objects, detector_t *detector, image_t *image, rectangle_t *roi)
+{
+    cascade_t *cascade = detector->cascade;
+    int n_tracked = arena_length(&detector->objects);
+    bool full_scan = (n_tracked == 0) || detector->lost || (detector->frames >= detector->interval);
+
+    // Raw detections, grouped into objects at the end.
+    arena_t rects;
+    arena_alloc(&rects, sizeof(rectangle_t), DETECT_INIT_SIZE);
+
+    if (full_scan) {
+        detect_objects_range(&rects, image, cascade, roi, 1.0f, FLT_MAX);
+        detector->frames = 0;
+    } else {
+        for (int i=0; i<n_tracked; i++) {
+            detection_t *d = arena_at(&detector->objects, i);
+
+            // Dilate the previous detection and clip it to the ROI
+            int margin = IM_MAX(fast_roundf(d->rect.w * DETECTOR_MARGIN), 1);
+            int x1 = IM_MAX(d->rect.x - margin, roi->x);
+            int y1 = IM_MAX(d->rect.y - margin, roi->y);
+            int x2 = IM_MIN(d->rect.x + d->rect.w + margin, roi->x + roi->w);
+            int y2 = IM_MIN(d->rect.y + d->rect.h + margin, roi->y + roi->h);
+            rectangle_t window = {x1, y1, x2 - x1, y2 - y1};
+
+            if (window.w <= cascade->window.w || window.h <= cascade->window.h) {
+                continue;
+            }
+
+            // Scan one scale step below and above the previous scale
+            float factor = d->rect.w / (float) cascade->window.w;
+            float min_factor = IM_MAX(factor / cascade->scale_factor, 1.0f);
+            float max_factor = factor * cascade->scale_factor * 1.001f;
+            detect_objects_range(&rects, image, cascade, &window, min_factor, max_factor);
+        }
     }
+    // Counts the full scan frame too, so full scans are interval frames apart.
+    detector->frames += 1;
+
+    // Group objects detected at neighbouring positions and scales
+    rectangle_merge(&rects, objects, cascade->min_neighbors, DETECT_GROUP_EPS);
+    arena_free(&rects);
 
-    /* read features thresholds */
-    res = f_read(&fp, cascade->tree_thresh_array, sizeof(*cascade->tree_thresh_array)*cascade->n_features, &n_out);
-    if (res != FR_OK || n_out != sizeof(*cascade->tree_thresh_array)*cascade->n_features) {
-        goto error;
+    arena_trim(objects);
+
+    // A track is lost when fewer objects are found than were tracked,
+    // force a full scan on the next frame to find it again.
+    detector->lost = !full_scan && (arena_length(objects) < n_tracked);
+
+    // Remember the detections for the next frame
+    int n_objects = arena_length(objects);
+    arena_resize(&detector->objects, 0);
+    for (int i=0; i<n_objects; i++) {
+        detection_t *d = arena_push_back(&detector->objects);
+        *d = *((detection_t *) arena_at(objects, i));
     }
+}
+
+// Points the cascade to its packed stages and counts the features and
+// rectangles, checking that the stages fit in size bytes.
+static int cascade_init_stages(cascade_t *cascade, const uint8_t *stages, uint32_t size)
+{
+    const uint8_t *end = stages + size;
+    const cascade_stage_t *stage = (const cascade_stage_t *) stages;
+
+    cascade->stages = stages;
+    cascade->n_features = 0;
+    cascade->n_rectangles = 0;
 
-    /* read alpha 1 */
-    res = f_read(&fp, cascade->alpha1_array, sizeof(*cascade->alpha1_array)*cascade->n_features, &n_out);
-    if (res != FR_OK || n_out != sizeof(*cascade->alpha1_array)*cascade->n_features) {
-        goto error;
+    for (int i=0; i<cascade->n_stages; i++) {
+        if ((const uint8_t *) (stage + 1) > end) {
+            return FR_INVALID_OBJECT;
+        }
+        const cascade_feature_t *feature = (const cascade_feature_t *) (stage + 1);
+        for (int j=0; j<stage->n_features; j++) {
+            if (((const uint8_t *) (feature + 1) > end) ||
+                ((const uint8_t *) cascade_next_feature(feature) > end)) {
+                return FR_INVALID_OBJECT;
+            }
+            cascade->n_features += 1;
+            cascade->n_rectangles += feature->n_rectangles;
+            feature = cascade_next_feature(feature);
+        }
+        stage = (const cascade_stage_t *) feature;
     }
 
-    /* read alpha 2 */
-    res = f_read(&fp, cascade->alpha2_array, sizeof(*cascade->alpha2_array)*cascade->n_features, &n_out);
-    if (res != FR_OK || n_out != sizeof(*cascade->alpha2_array)*cascade->n_features) {
-        goto error;
+    return FR_OK;
+}
+
+// Reads a little endian value from a possibly unaligned legacy cascade field.
+static int16_t legacy_read_int16(const uint8_t *p)
+{
+    return (int16_t) (p[0] | (p[1] << 8));
+}
+
+// Packs a cascade in the old format (separate arrays per field) into a new
+// buffer. The old format is: window size, number of stages, features per
+// stage, stage thresholds, feature thresholds, alpha1, alpha2, rectangles
+// per feature, rectangle weights and the rectangles.
+static int cascade_pack_legacy(cascade_t *cascade, const uint8_t *data, uint32_t size)
+{
+    int n_stages, n_features=0, n_rectangles=0;
+    const uint8_t *end = data + size;
+
+    if (size < (sizeof(cascade->window) + sizeof(n_stages))) {
+        return FR_INVALID_OBJECT;
     }
+    memcpy(&cascade->window, data, sizeof(cascade->window));
+    memcpy(&n_stages, data + sizeof(cascade->window), sizeof(n_stages));
 
-    /* read num rectangles per feature*/
-    res = f_read(&fp, cascade->num_rectangles_array, sizeof(*cascade->num_rectangles_array)*cascade->n_features, &n_out);
-    if (res != FR_OK || n_out != sizeof(*cascade->num_rectangles_array)*cascade->n_features) {
-        goto error;
+    const uint8_t *stages_array = data + sizeof(cascade->window) + sizeof(n_stages);
+    if ((n_stages <= 0) || ((stages_array + (n_stages * 3)) > end)) {
+        return FR_INVALID_OBJECT;
     }
 
-    /* sum num of recatngles per feature*/
-    for (i=0, cascade->n_rectangles=0; i<cascade->n_features; i++) {
-        cascade->n_rectangles += cascade->num_rectangles_array[i];
+    for (int i=0; i<n_stages; i++) {
+        n_features += stages_array[i];
     }
 
-    cascade->weights_array = xalloc (sizeof(*cascade->weights_array) * cascade->n_rectangles);
-    cascade->rectangles_array = xalloc (sizeof(*cascade->rectangles_array) * cascade->n_rectangles * 4);
+    const uint8_t *stages_thresh_array = stages_array + n_stages;
+    const uint8_t *tree_thresh_array = stages_thresh_array + (n_stages * 2);
+    const uint8_t *alpha1_array = tree_thresh_array + (n_features * 2);
+    const uint8_t *alpha2_array = alpha1_array + (n_features * 2);
+    const int8_t *num_rectangles_array = (const int8_t *) (alpha2_array + (n_features * 2));
+    if (((const uint8_t *) (num_rectangles_array + n_features)) > end) {
+        return FR_INVALID_OBJECT;
+    }
 
-    if (cascade->weights_array  == NULL ||
-        cascade->rectangles_array == NULL) {
-        res = 20;
-        goto error;
+    for (int i=0; i<n_features; i++) {
+        n_rectangles += num_rectangles_array[i];
     }
 
-    /* read rectangles weights */
-    res =f_read(&fp, cascade->weights_array, sizeof(*cascade->weights_array)*cascade->n_rectangles, &n_out);
-    if (res != FR_OK || n_out != sizeof(*cascade->weights_array)*cascade->n_rectangles) {
-        goto error;
+    const int8_t *weights_array = num_rectangles_array + n_features;
+    const int8_t *rectangles_array = weights_array + n_rectangles;
+    if (((const uint8_t *) (rectangles_array + (n_rectangles * 4))) > end) {
+        return FR_INVALID_OBJECT;
     }
 
-    /* read rectangles num rectangles * 4 points */
-    res = f_read(&fp, cascade->rectangles_array, sizeof(*cascade->rectangles_array)*cascade->n_rectangles *4, &n_out);
-    if (res != FR_OK || n_out != sizeof(*cascade->rectangles_array)*cascade->n_rectangles *4) {
-        goto error;
+    uint32_t packed_size = (n_stages * sizeof(cascade_stage_t))
+                         + (n_features * sizeof(cascade_feature_t))
+                         + (n_rectangles * sizeof(cascade_rect_t));
+    uint8_t *stages = xalloc(packed_size);
+
+    cascade_stage_t *stage = (cascade_stage_t *) stages;
+    for (int i=0, t_idx=0; i<n_stages; i++) {
+        stage->threshold = legacy_read_int16(stages_thresh_array + (i * 2));
+        stage->n_features = stages_array[i];
+        cascade_feature_t *feature = (cascade_feature_t *) (stage + 1);
+        for (int j=0; j<stage->n_features; j++, t_idx++) {
+            feature->threshold = legacy_read_int16(tree_thresh_array + (t_idx * 2));
+            feature->alpha1 = legacy_read_int16(alpha1_array + (t_idx * 2));
+            feature->alpha2 = legacy_read_int16(alpha2_array + (t_idx * 2));
+            feature->n_rectangles = num_rectangles_array[t_idx];
+            cascade_rect_t *r = (cascade_rect_t *) (feature + 1);
+            for (int k=0; k<feature->n_rectangles; k++, r++) {
+                r->x = rectangles_array[0];
+                r->y = rectangles_array[1];
+                r->w = rectangles_array[2];
+                r->h = rectangles_array[3];
+                r->weight = (*weights_array) * 4096;
+                rectangles_array += 4;
+                weights_array += 1;
+            }
+            feature = (cascade_feature_t *) r;
+        }
+        stage = (cascade_stage_t *) feature;
     }
 
-error:
-    f_close(&fp);
-    return res;
+    cascade->n_stages = n_stages;
+    return cascade_init_stages(cascade, stages, packed_size);
 }
 
-int imlib_load_cascade_from_flash(cascade_t *cascade, const char *path)
+// Loads a packed cascade with one allocation and one read. Cascades in the
+// old format are packed after loading.
+int imlib_load_cascade_from_file(cascade_t *cascade, const char *path)
 {
-    FRESULT res=FR_OK;
+    FIL fp;
+    UINT n_out;
+    FRESULT res;
 
-    if (strcmp(path, "frontalface") == 0) {
-        cascade->window.w            = frontalface_window_w;
-        cascade->window.h            = frontalface_window_h;
-        cascade->n_stages            = frontalface_n_stages;
-        cascade->stages_array        = (uint8_t *)frontalface_stages_array;
-        cascade->stages_thresh_array = (int16_t *)frontalface_stages_thresh_array;
-        cascade->tree_thresh_array   = (int16_t *)frontalface_tree_thresh_array;
-        cascade->alpha1_array        = (int16_t *)frontalface_alpha1_array;
-        cascade->alpha2_array        = (int16_t *)frontalface_alpha2_array;
-        cascade->num_rectangles_array= (int8_t  *)frontalface_num_rectangles_array;
-        cascade->weights_array       = (int8_t  *)frontalface_weights_array;
-        cascade->rectangles_array    = (int8_t  *)frontalface_rectangles_array;
-    } else if (strcmp(path, "eye") == 0) {
-        cascade->window.w            = eye_window_w;
-        cascade->window.h            = eye_window_h;
-        cascade->n_stages            = eye_n_stages;
-        cascade->stages_array        = (uint8_t *)eye_stages_array;
-        cascade->stages_thresh_array = (int16_t *)eye_stages_thresh_array;
-        cascade->tree_thresh_array   = (int16_t *)eye_tree_thresh_array;
-        cascade->alpha1_array        = (int16_t *)eye_alpha1_array;
-        cascade->alpha2_array        = (int16_t *)eye_alpha2_array;
-        cascade->num_rectangles_array= (int8_t  *)eye_num_rectangles_array;
-        cascade->weights_array       = (int8_t  *)eye_weights_array;
-        cascade->rectangles_array    = (int8_t  *)eye_rectangles_array;
-    } else {
-        res = FR_NO_FILE;
+    res = f_open(&fp, path, FA_READ|FA_OPEN_EXISTING);
+    if (res != FR_OK) {
+        return res;
+    }
+
+    uint32_t size = f_size(&fp);
+    uint8_t *data = xalloc(size);
+
+    res = f_read(&fp, data, size, &n_out);
+    f_close(&fp);
+
+    if (res == FR_OK && n_out != size) {
+        res = FR_DISK_ERR;
     }
 
     if (res == FR_OK) {
-        int i;
-        // sum the number of features in all stages
-        for (i=0, cascade->n_features=0; i<cascade->n_stages; i++) {
-            cascade->n_features += cascade->stages_array[i];
+        cascade_header_t header;
+        if (size >= sizeof(header)) {
+            memcpy(&header, data, sizeof(header));
         }
 
-        // sum the number of recatngles in all features
-        for (i=0, cascade->n_rectangles=0; i<cascade->n_features; i++) {
-            cascade->n_rectangles += cascade->num_rectangles_array[i];
+        if (size >= sizeof(header) && header.magic == CASCADE_MAGIC) {
+            if (header.size > (size - sizeof(header))) {
+                res = FR_INVALID_OBJECT;
+            } else {
+                // Move the stages to the start of the buffer, the GC
+                // only keeps blocks referenced by their first byte.
+                memmove(data, data + sizeof(header), header.size);
+                cascade->window.w = header.window_w;
+                cascade->window.h = header.window_h;
+                cascade->n_stages = header.n_stages;
+                res = cascade_init_stages(cascade, data, header.size);
+            }
+        } else {
+            res = cascade_pack_legacy(cascade, data, size);
+            xfree(data);
+            data = NULL;
         }
     }
 
+    if (res != FR_OK && data != NULL) {
+        xfree(data);
+    }
+
     return res;
 }
 
+int imlib_load_cascade_from_flash(cascade_t *cascade, const char *path)
+{
+    if (strcmp(path, "frontalface") == 0) {
+        cascade->window.w = frontalface_window_w;
+        cascade->window.h = frontalface_window_h;
+        cascade->n_stages = frontalface_n_stages;
+        return cascade_init_stages(cascade, frontalface_stages, sizeof(frontalface_stages));
+    } else if (strcmp(path, "eye") == 0) {
+        cascade->window.w = eye_window_w;
+        cascade->window.h = eye_window_h;
+        cascade->n_stages = eye_n_stages;
+        return cascade_init_stages(cascade, eye_stages, sizeof(eye_stages));
+    }
+
+    return FR_NO_FILE;
+}
+
 int imlib_load_cascade(cascade_t *cascade, const char *path)
 {
     if (path[0] != '/') {
         // built-in cascade
         return imlib_load_cascade_from_flash(cascade, path);
     } else {
-        // xml cascade
+        // cascade file
         return imlib_load_cascade_from_file(cascade, path);
     }
 }
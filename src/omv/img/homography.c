@@ -0,0 +1,312 @@
+/*
+ * This file is part of the OpenMV project.
+ * Copyright (c) 2013/2014 Ibrahim Abdelkader <i.abdalkader@gmail.com>
+ * This work is licensed under the MIT license, see the file LICENSE for details.
+ *
+ * RANSAC transform estimation.
+ *
+ * Fits a homography (4-point DLT) or a similarity transform (2 points) to
+ * random minimal samples of the point pairs and keeps the model with the
+ * most inliers, the model is then refit to all of its inliers by least
+ * squares. Points are normalized (centroid at the origin, mean distance of
+ * sqrt(2)) so the DLT is well conditioned in single precision. Hypotheses
+ * are dropped as soon as they can't beat the best inlier count, and the
+ * number of iterations shrinks with the inlier ratio of the best model.
+ *
+ */
+#include <string.h>
+#include "imlib.h"
+#include "fmath.h"
+#include "fb_alloc.h"
+
+#define CONFIDENCE      (0.99f)
+#define MIN_PIVOT       (1e-7f)
+// Minimum area of the triangles of a homography sample, in pixels.
+#define MIN_AREA        (2.0f)
+
+extern uint32_t rng_randint(uint32_t min, uint32_t max);
+
+// Solves A x = b by Gaussian elimination with partial pivoting,
+// A is n x n and is overwritten, x is returned in b.
+static bool solve(float *A, float *b, int n)
+{
+    for (int c=0; c<n; c++) {
+        int pivot = c;
+        for (int r=c+1; r<n; r++) {
+            if (fast_fabsf(A[r*n+c]) > fast_fabsf(A[pivot*n+c])) {
+                pivot = r;
+            }
+        }
+        if (fast_fabsf(A[pivot*n+c]) < MIN_PIVOT) {
+            return false;
+        }
+        if (pivot != c) {
+            for (int k=0; k<n; k++) {
+                float t = A[c*n+k]; A[c*n+k] = A[pivot*n+k]; A[pivot*n+k] = t;
+            }
+            float t = b[c]; b[c] = b[pivot]; b[pivot] = t;
+        }
+        for (int r=c+1; r<n; r++) {
+            float f = A[r*n+c] / A[c*n+c];
+            for (int k=c; k<n; k++) {
+                A[r*n+k] -= f * A[c*n+k];
+            }
+            b[r] -= f * b[c];
+        }
+    }
+    for (int r=n-1; r>=0; r--) {
+        float s = b[r];
+        for (int k=r+1; k<n; k++) {
+            s -= A[r*n+k] * b[k];
+        }
+        b[r] = s / A[r*n+r];
+    }
+    return true;
+}
+
+// Similarity that moves the centroid of the points to the origin and scales
+// their mean distance to sqrt(2), as (scale, tx, ty): p' = s*p + t.
+static void normalize(point_t *p, uint16_t *idx, int n, float *norm)
+{
+    float cx=0.0f, cy=0.0f, d=0.0f;
+    for (int i=0; i<n; i++) {
+        cx += p[idx[i]].x;
+        cy += p[idx[i]].y;
+    }
+    cx /= n;
+    cy /= n;
+    for (int i=0; i<n; i++) {
+        float dx = p[idx[i]].x - cx;
+        float dy = p[idx[i]].y - cy;
+        d += fast_sqrtf(dx*dx + dy*dy);
+    }
+    float s = (d > 0.0f) ? (1.41421356f * n / d) : 1.0f;
+    norm[0] = s;
+    norm[1] = -s * cx;
+    norm[2] = -s * cy;
+}
+
+// Least squares DLT with H[8]=1, exact for 4 points.
+static bool fit_homography(point_t *src, point_t *dst, uint16_t *idx, int n, float *H)
+{
+    float ns[3], nd[3];
+    float A[8*8], b[8];
+    memset(A, 0, sizeof(A));
+    memset(b, 0, sizeof(b));
+
+    normalize(src, idx, n, ns);
+    normalize(dst, idx, n, nd);
+
+    // Accumulate the normal equations of the two rows of each pair.
+    for (int i=0; i<n; i++) {
+        float x = ns[0] * src[idx[i]].x + ns[1];
+        float y = ns[0] * src[idx[i]].y + ns[2];
+        float u = nd[0] * dst[idx[i]].x + nd[1];
+        float v = nd[0] * dst[idx[i]].y + nd[2];
+        float r0[8] = {x, y, 1.0f, 0.0f, 0.0f, 0.0f, -x*u, -y*u};
+        float r1[8] = {0.0f, 0.0f, 0.0f, x, y, 1.0f, -x*v, -y*v};
+        for (int j=0; j<8; j++) {
+            for (int k=j; k<8; k++) {
+                A[j*8+k] += r0[j]*r0[k] + r1[j]*r1[k];
+            }
+            b[j] += r0[j]*u + r1[j]*v;
+        }
+    }
+    for (int j=0; j<8; j++) {
+        for (int k=0; k<j; k++) {
+            A[j*8+k] = A[k*8+j];
+        }
+    }
+
+    if (!solve(A, b, 8)) {
+        return false;
+    }
+
+    // H = Td^-1 * Hn * Ts
+    float Hn[9] = {b[0], b[1], b[2], b[3], b[4], b[5], b[6], b[7], 1.0f};
+    for (int r=0; r<3; r++) {
+        // Row r of Hn * Ts
+        float *h = Hn + (r * 3);
+        h[2] += h[0] * ns[1] + h[1] * ns[2];
+        h[0] *= ns[0];
+        h[1] *= ns[0];
+    }
+    for (int c=0; c<3; c++) {
+        H[c]   = (Hn[c] - nd[1] * Hn[6+c]) / nd[0];
+        H[3+c] = (Hn[3+c] - nd[2] * Hn[6+c]) / nd[0];
+        H[6+c] = Hn[6+c];
+    }
+
+    if (fast_fabsf(H[8]) < MIN_PIVOT) {
+        return false;
+    }
+    for (int i=0; i<9; i++) {
+        H[i] /= H[8];
+    }
+    return true;
+}
+
+// Least squares similarity [a -b tx; b a ty], exact for 2 points.
+static bool fit_similarity(point_t *src, point_t *dst, uint16_t *idx, int n, float *H)
+{
+    float scx=0.0f, scy=0.0f, dcx=0.0f, dcy=0.0f;
+    for (int i=0; i<n; i++) {
+        scx += src[idx[i]].x; scy += src[idx[i]].y;
+        dcx += dst[idx[i]].x; dcy += dst[idx[i]].y;
+    }
+    scx /= n; scy /= n;
+    dcx /= n; dcy /= n;
+
+    float sa=0.0f, sb=0.0f, ss=0.0f;
+    for (int i=0; i<n; i++) {
+        float xs = src[idx[i]].x - scx, ys = src[idx[i]].y - scy;
+        float xd = dst[idx[i]].x - dcx, yd = dst[idx[i]].y - dcy;
+        sa += xs*xd + ys*yd;
+        sb += xs*yd - ys*xd;
+        ss += xs*xs + ys*ys;
+    }
+    if (ss < MIN_AREA) {
+        return false;
+    }
+
+    float a = sa / ss, b = sb / ss;
+    H[0] = a; H[1] = -b; H[2] = dcx - (a*scx - b*scy);
+    H[3] = b; H[4] = a;  H[5] = dcy - (b*scx + a*scy);
+    H[6] = 0.0f; H[7] = 0.0f; H[8] = 1.0f;
+    return true;
+}
+
+static inline float triangle_area(point_t *p, uint16_t *idx, int i, int j, int k)
+{
+    return fast_fabsf((float) (p[idx[j]].x - p[idx[i]].x) * (p[idx[k]].y - p[idx[i]].y)
+                    - (float) (p[idx[j]].y - p[idx[i]].y) * (p[idx[k]].x - p[idx[i]].x)) * 0.5f;
+}
+
+// A homography sample is degenerate if any three points are (nearly) collinear.
+static bool degenerate_sample(point_t *p, uint16_t *idx)
+{
+    return triangle_area(p, idx, 0, 1, 2) < MIN_AREA || triangle_area(p, idx, 0, 1, 3) < MIN_AREA
+        || triangle_area(p, idx, 0, 2, 3) < MIN_AREA || triangle_area(p, idx, 1, 2, 3) < MIN_AREA;
+}
+
+void imlib_transform_point(float *H, float x, float y, float *tx, float *ty)
+{
+    float w = H[6]*x + H[7]*y + H[8];
+    if (fast_fabsf(w) < MIN_PIVOT) {
+        w = MIN_PIVOT;
+    }
+    *tx = (H[0]*x + H[1]*y + H[2]) / w;
+    *ty = (H[3]*x + H[4]*y + H[5]) / w;
+}
+
+static inline bool is_inlier(float *H, point_t *src, point_t *dst, float max_error_sq)
+{
+    float x, y;
+    imlib_transform_point(H, src->x, src->y, &x, &y);
+    float dx = x - dst->x, dy = y - dst->y;
+    return (dx*dx + dy*dy) <= max_error_sq;
+}
+
+// Returns the number of inliers of the transform, and marks them in the
+// optional mask (one byte per point) if a transform is found.
+int imlib_find_transform(float *H, point_t *src, point_t *dst, int n_points,
+        transform_t type, float max_error, int max_iterations, uint8_t *mask)
+{
+    int n_samples = (type == TRANSFORM_HOMOGRAPHY) ? 4 : 2;
+    if (n_points <= n_samples) {
+        return 0;
+    }
+
+    n_points = IM_MIN(n_points, UINT16_MAX);
+    float max_error_sq = max_error * max_error;
+    int best_inliers = 0;
+    float model[9];
+    uint16_t sample[4];
+    uint16_t *inliers = fb_alloc(n_points * sizeof(uint16_t));
+
+    for (int it=0, iterations=max_iterations; it<iterations; it++) {
+        // Draw distinct pairs
+        for (int i=0; i<n_samples; i++) {
+            bool unique;
+            do {
+                sample[i] = rng_randint(0, n_points-1);
+                unique = true;
+                for (int j=0; j<i; j++) {
+                    unique &= (sample[i] != sample[j]);
+                }
+            } while (!unique);
+        }
+
+        if (type == TRANSFORM_HOMOGRAPHY) {
+            if (degenerate_sample(src, sample) || degenerate_sample(dst, sample)
+                    || !fit_homography(src, dst, sample, n_samples, model)) {
+                continue;
+            }
+        } else if (!fit_similarity(src, dst, sample, n_samples, model)) {
+            continue;
+        }
+
+        // Count inliers, stop once the best count can't be beaten.
+        int n_inliers = 0;
+        for (int i=0; i<n_points && (n_inliers + (n_points - i)) > best_inliers; i++) {
+            n_inliers += is_inlier(model, &src[i], &dst[i], max_error_sq);
+        }
+
+        if (n_inliers > best_inliers) {
+            best_inliers = n_inliers;
+            memcpy(H, model, sizeof(model));
+
+            // Iterations needed to draw an all-inlier sample with CONFIDENCE.
+            float w = (float) best_inliers / n_points, ws = w;
+            for (int i=1; i<n_samples; i++) {
+                ws *= w;
+            }
+            if (ws >= 1.0f) {
+                break;
+            } else if (ws > 0.0f) {
+                float needed = fast_log(1.0f - CONFIDENCE) / fast_log(1.0f - ws);
+                if (needed < iterations) {
+                    iterations = IM_MAX((int) needed + 1, it + 1);
+                }
+            }
+        }
+    }
+
+    // A model is only supported if more than its sample agrees with it.
+    if (best_inliers <= n_samples) {
+        fb_free();
+        return 0;
+    }
+
+    // Refit the best model to all of its inliers.
+    int n_inliers = 0;
+    for (int i=0; i<n_points; i++) {
+        if (is_inlier(H, &src[i], &dst[i], max_error_sq)) {
+            inliers[n_inliers++] = i;
+        }
+    }
+
+    bool fit = (type == TRANSFORM_HOMOGRAPHY) ?
+        fit_homography(src, dst, inliers, n_inliers, model) :
+        fit_similarity(src, dst, inliers, n_inliers, model);
+
+    if (fit) {
+        int n_refit = 0;
+        for (int i=0; i<n_points; i++) {
+            n_refit += is_inlier(model, &src[i], &dst[i], max_error_sq);
+        }
+        if (n_refit >= n_inliers) {
+            memcpy(H, model, sizeof(model));
+            n_inliers = n_refit;
+        }
+    }
+
+    if (mask) {
+        for (int i=0; i<n_points; i++) {
+            mask[i] = is_inlier(H, &src[i], &dst[i], max_error_sq);
+        }
+    }
+
+    fb_free(); // inliers
+    return n_inliers;
+}
@@ -174,6 +174,11 @@ static bool imlib_read_geometry(FIL *fp, image_t *img, const char *path, img_rea
         file_read_open(fp, path);
         file_buffer_on(fp); // REMEMBER TO TURN THIS OFF LATER!
         vflipped = bmp_read_geometry(fp, img, path, &rs->bmp_rs);
+    } else if ((magic[0]==0xFF) && (magic[1]==0xD8)) { // JPEG
+        rs->format = FORMAT_JPG;
+        file_read_open(fp, path);
+        jpeg_decode_geometry(fp, img, &rs->jpeg_rs);
+        file_buffer_on(fp); // REMEMBER TO TURN THIS OFF LATER!
     } else {
         ff_unsupported_format(NULL);
     }
@@ -192,7 +197,8 @@ static void imlib_read_pixels(FIL *fp, image_t *img, int line_start, int line_en
         case FORMAT_PNM:
             ppm_read_pixels(fp, img, line_start, line_end, &rs->ppm_rs);
             break;
-        case FORMAT_JPG: // won't happen
+        case FORMAT_JPG:
+            jpeg_decode_pixels(fp, img, line_start, line_end, &rs->jpeg_rs);
             break;
     }
 }
@@ -208,7 +214,8 @@ void imlib_image_operation(image_t *img, const char *path, image_t *other, line_
         // vertically flipped resulting in us reading the image backwards.
         FIL fp;
         image_t temp;
-        img_read_settings_t rs;
+        // JPEGs are decoded to the bpp of the image.
+        img_read_settings_t rs = { .jpeg_rs = { .scale = 1, .bpp = img->bpp } };
         bool vflipped = imlib_read_geometry(&fp, &temp, path, &rs);
         if (!IM_EQUAL(img, &temp)) {
             ff_not_equal(&fp);
@@ -236,6 +243,9 @@ void imlib_image_operation(image_t *img, const char *path, image_t *other, line_
             }
         }
         file_buffer_off(&fp);
+        if (rs.format == FORMAT_JPG) {
+            jpeg_decode_free(&rs.jpeg_rs);
+        }
         file_close(&fp);
         fb_free();
     } else {
@@ -248,7 +258,8 @@ void imlib_image_operation(image_t *img, const char *path, image_t *other, line_
     }
 }
 
-void imlib_load_image(image_t *img, const char *path)
+// JPEGs are decoded if rs is not NULL, otherwise they're loaded compressed.
+void imlib_load_image(image_t *img, const char *path, jpeg_read_settings_t *rs)
 {
     FIL fp;
     file_read_open(&fp, path);
@@ -263,7 +274,11 @@ void imlib_load_image(image_t *img, const char *path)
     } else if ((magic[0]=='B') && (magic[1]=='M')) { // BMP
         bmp_read(img, path);
     } else if ((magic[0]==0xFF) && (magic[1]==0xD8)) { // JPEG
-        jpeg_read(img, path);
+        if (rs) {
+            jpeg_decode(img, path, rs);
+        } else {
+            jpeg_read(img, path);
+        }
     } else {
         ff_unsupported_format(NULL);
     }
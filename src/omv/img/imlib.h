@@ -12,6 +12,7 @@
 #include <stdint.h>
 #include <ff.h>
 #include "array.h"
+#include "arena.h"
 #include "fmath.h"
 
 #define IM_SWAP16(x) __REV16(x) // Swap bottom two chars in short.
@@ -190,6 +191,11 @@ typedef struct rectangle {
     int16_t h;
 } rectangle_t;
 
+typedef struct detection {
+    rectangle_t rect;
+    int16_t neighbors;  // Number of raw detections merged into this one.
+} detection_t;
+
 typedef struct simple_color {
     uint8_t G;
     union {
@@ -278,13 +284,68 @@ typedef struct cluster {
     point_t centroid;
 } cluster_t;
 
-/* FAST/FREAK Keypoint */
-typedef struct kp {
+/* FAST corner */
+typedef struct corner {
+    uint16_t x;
+    uint16_t y;
+    uint8_t score;
+} corner_t;
+
+/* FAST/FREAK keypoint set, the keypoints are stored as arrays in
+ * a single block that starts with the descriptors (see kp_set_alloc). */
+#define KP_DESC_SIZE (64)
+typedef struct kp_set {
+    int n_kpts;
+    uint8_t *desc;      // KP_DESC_SIZE bytes per keypoint.
+    uint16_t *x;
+    uint16_t *y;
+    int16_t *match;     // Index of the matching keypoint in the other set, or -1.
+    uint8_t *score;     // FAST score.
+    uint8_t *angle;     // FREAK orientation, 0-255 for 0-360 degrees.
+} kp_set_t;
+
+/* ORB keypoint, the position is in image coordinates, the angle is
+ * quantised to ORB_ANGLES and level is the pyramid level it was found on. */
+#define ORB_ANGLES (30)
+typedef struct orb_kp {
     uint16_t x;
     uint16_t y;
-    struct kp *match;
-    uint8_t desc[64];
-} kp_t;
+    uint8_t angle;
+    uint8_t level;
+    int16_t match;      // Index of the matching keypoint, or -1.
+    uint8_t desc[32];
+} orb_kp_t;
+
+/* FREAK descriptor index, the keypoints are hashed into one table per
+ * descriptor byte for the first FREAK_INDEX_TABLES bytes (see freak_index.c). */
+#ifndef FREAK_INDEX_TABLES
+#define FREAK_INDEX_TABLES (16)
+#endif
+typedef struct freak_index {
+    kp_set_t *kpts;                 // Indexed keypoints.
+    uint16_t *offsets;              // Bucket offsets of each table.
+    uint16_t *entries;              // Keypoint indices of each table, sorted by bucket.
+} freak_index_t;
+
+/* Packed Haar cascade. Stages are stored back to back, each one is a
+ * cascade_stage_t followed by its weak classifiers, and each weak classifier
+ * is a cascade_feature_t followed by its rectangles. */
+typedef struct cascade_stage {
+    int16_t threshold;              // Stage threshold (Q8).
+    uint16_t n_features;            // Number of weak classifiers in the stage.
+} cascade_stage_t;
+
+typedef struct cascade_feature {
+    int16_t threshold;              // Feature threshold (Q12).
+    int16_t alpha1;                 // Left value (Q8).
+    int16_t alpha2;                 // Right value (Q8).
+    uint16_t n_rectangles;          // Number of rectangles that follow.
+} cascade_feature_t;
+
+typedef struct cascade_rect {
+    int8_t x, y, w, h;
+    int16_t weight;                 // Rectangle weight (Q12).
+} cascade_rect_t;
 
 /* Haar cascade struct */
 typedef struct cascade {
@@ -292,6 +353,9 @@ typedef struct cascade {
     int step;                       // Image scanning factor.
     float threshold;                // Detection threshold.
     float scale_factor;             // Image scaling factor.
+    int min_neighbors;              // Minimum raw detections per merged object.
+    int min_variance;               // Windows with a lower variance are skipped.
+    struct image *mask;             // Optional, windows outside the mask are skipped.
     int n_stages;                   // Number of stages in the cascade.
     int n_features;                 // Number of features in the cascade.
     int n_rectangles;               // Number of rectangles in the cascade.
@@ -299,16 +363,62 @@ typedef struct cascade {
     struct image *img;              // Grayscale image.
     mw_image_t *sum;                // Integral image.
     mw_image_t *ssq;                // Squared integral image.
-    uint8_t *stages_array;          // Number of features per stage.
-    int16_t *stages_thresh_array;   // Stages thresholds.
-    int16_t *tree_thresh_array;     // Features threshold (1 per feature).
-    int16_t *alpha1_array;          // Alpha1 array (1 per feature).
-    int16_t *alpha2_array;          // Alpha2 array (1 per feature).
-    int8_t *num_rectangles_array;   // Number of rectangles per features (1 per feature).
-    int8_t *weights_array;          // Rectangles weights (1 per rectangle).
-    int8_t *rectangles_array;       // Rectangles array.
+    const uint8_t *stages;          // Packed stages.
+#ifdef IMLIB_CASCADE_STATS
+    struct cascade_stats *stats;    // Optional evaluation counters.
+#endif
 } cascade_t;
 
+#ifdef IMLIB_CASCADE_STATS
+/* Cascade evaluation counters, only compiled into host builds
+ * (see util/cascade-bench). The arrays hold one entry per stage. */
+typedef struct cascade_stats {
+    uint32_t windows;               // Windows passed to the classifier.
+    uint32_t *stage_windows;        // Windows evaluated by each stage.
+    uint32_t *stage_features;       // Weak classifiers evaluated by each stage.
+} cascade_stats_t;
+#endif
+
+/* Packed LBP cascade. The MB-LBP feature rectangles are stored first, then
+ * the stages back to back, each one is an lbp_stage_t followed by its weak
+ * classifiers. */
+typedef struct lbp_feature {
+    int8_t x, y, w, h;              // Top-left block and block size.
+} lbp_feature_t;
+
+typedef struct lbp_stage {
+    int16_t threshold;              // Stage threshold (Q8).
+    uint16_t n_classifiers;         // Number of weak classifiers in the stage.
+} lbp_stage_t;
+
+typedef struct lbp_classifier {
+    uint32_t subset[8];             // LBP codes taking the left value.
+    uint16_t feature;               // Feature index.
+    int16_t alpha1;                 // Left value (Q8).
+    int16_t alpha2;                 // Right value (Q8).
+    uint16_t reserved;
+} lbp_classifier_t;
+
+/* LBP cascade struct */
+typedef struct lbp_cascade {
+    float scale_factor;             // Image scaling factor.
+    int min_neighbors;              // Minimum raw detections per merged object.
+    int n_stages;                   // Number of stages in the cascade.
+    int n_classifiers;              // Number of weak classifiers in the cascade.
+    int n_features;                 // Number of MB-LBP features.
+    struct size window;             // Detection window size.
+    const uint8_t *data;            // Packed features and stages.
+} lbp_cascade_t;
+
+/* Haar detector session, remembers detections between frames */
+typedef struct detector {
+    cascade_t *cascade;             // Cascade used for detection.
+    int interval;                   // Frames between full scans.
+    int frames;                     // Frames since the last full scan, including it.
+    bool lost;                      // A tracked object was lost last frame.
+    arena_t objects;                // Detections from the last frame.
+} detector_t;
+
 typedef struct bmp_read_settings {
     int32_t bmp_w;
     int32_t bmp_h;
@@ -323,6 +433,12 @@ typedef struct ppm_read_settings {
     uint8_t ppm_fmt;
 } ppm_read_settings_t;
 
+typedef struct jpeg_read_settings {
+    int scale;                  // Output size divider, 1, 2, 4 or 8.
+    int bpp;                    // Output bpp, 0 for grayscale or RGB565 like the JPEG.
+    struct jpeg_decoder *dec;
+} jpeg_read_settings_t;
+
 typedef enum save_image_format {
     FORMAT_DONT_CARE,
     FORMAT_BMP,
@@ -335,6 +451,7 @@ typedef struct img_read_settings {
     {
         bmp_read_settings_t bmp_rs;
         ppm_read_settings_t ppm_rs;
+        jpeg_read_settings_t jpeg_rs;
     };
     save_image_format_t format;
 } img_read_settings_t;
@@ -344,8 +461,38 @@ typedef void (*line_op_t)(image_t*, int, uint8_t*);
 typedef enum descriptor_type {
     DESC_LBP,
     DESC_FREAK,
+    DESC_ORB,
 } descriptor_t;
 
+typedef enum transform_type {
+    TRANSFORM_SIMILARITY,
+    TRANSFORM_HOMOGRAPHY,
+} transform_t;
+
+typedef enum lbp_metric {
+    LBP_CHI_SQUARE,
+    LBP_CORRELATION,
+} lbp_metric_t;
+
+/* LBP gallery match, lower distances are better. */
+#define LBP_MAX_MATCHES (256)   // Max number of matches returned by a gallery match.
+typedef struct lbp_match {
+    int id;
+    int distance;
+} lbp_match_t;
+
+/* JPEG output sink. The encoder writes into buf and calls flush with the number
+ * of bytes written when less than 8 bytes are left, and once more (last=true)
+ * at the end of the image. The sink consumes the bytes, or hands them off (i.e.
+ * to DMA), and points buf/size at the next chunk. Errors are raised by flush. */
+#define JPEG_SINK_CHUNK (4096)
+typedef struct jpeg_sink {
+    uint8_t *buf;
+    uint32_t size;
+    void (*flush)(struct jpeg_sink *sink, uint32_t len, bool last);
+    void *data;
+} jpeg_sink_t;
+
 /* Color space functions */
 void imlib_rgb_to_lab(simple_color_t *rgb, simple_color_t *lab);
 void imlib_lab_to_rgb(simple_color_t *lab, simple_color_t *rgb);
@@ -362,13 +509,20 @@ bool bmp_read_geometry(FIL *fp, image_t *img, const char *path, bmp_read_setting
 void bmp_read_pixels(FIL *fp, image_t *img, int line_start, int line_end, bmp_read_settings_t *rs);
 void bmp_read(image_t *img, const char *path);
 void bmp_write_subimg(image_t *img, const char *path, rectangle_t *r);
+uint32_t jpeg_encode(image_t *src, jpeg_sink_t *sink, int quality);
+void jpeg_sink_mem(jpeg_sink_t *sink, uint8_t *buf, uint32_t size);
+void jpeg_sink_file(jpeg_sink_t *sink, FIL *fp, uint8_t *buf, uint32_t size);
 void jpeg_compress(image_t *src, image_t *dst, int quality);
 void jpeg_read_geometry(FIL *fp, image_t *img, const char *path);
 void jpeg_read_pixels(FIL *fp, image_t *img);
 void jpeg_read(image_t *img, const char *path);
 void jpeg_write(image_t *img, const char *path, int quality);
+void jpeg_decode_geometry(FIL *fp, image_t *img, jpeg_read_settings_t *rs);
+void jpeg_decode_pixels(FIL *fp, image_t *img, int line_start, int line_end, jpeg_read_settings_t *rs);
+void jpeg_decode_free(jpeg_read_settings_t *rs);
+void jpeg_decode(image_t *img, const char *path, jpeg_read_settings_t *rs);
 void imlib_image_operation(image_t *img, const char *path, image_t *other, line_op_t op);
-void imlib_load_image(image_t *img, const char *path);
+void imlib_load_image(image_t *img, const char *path, jpeg_read_settings_t *rs);
 void imlib_save_image(image_t *img, const char *path, rectangle_t *roi, int quality);
 void imlib_copy_image(image_t *dst, image_t *src, rectangle_t *roi);
 
@@ -396,7 +550,7 @@ rectangle_t *rectangle_alloc(int16_t x, int16_t y, int16_t w, int16_t h);
 bool rectangle_equal(rectangle_t *r1, rectangle_t *r2);
 bool rectangle_intersects(rectangle_t *r1, rectangle_t *r2);
 bool rectangle_subimg(image_t *img, rectangle_t *r, rectangle_t *r_out);
-array_t *rectangle_merge(array_t *rectangles);
+void rectangle_merge(arena_t *rectangles, arena_t *detections, int min_neighbors, float eps);
 
 /* Drawing functions */
 void imlib_draw_line(image_t *img, int x0, int y0, int x1, int y1, int c);
@@ -441,12 +595,12 @@ void imlib_median_filter(image_t *img, const int ksize, const int percentile);
 void imlib_histeq(image_t *img);
 
 /* Color Tracking */
-array_t *imlib_find_blobs(image_t *img,
-                          int num_thresholds, simple_color_t *l_thresholds, simple_color_t *h_thresholds,
-                          bool invert, rectangle_t *r,
-                          bool (*f_fun)(void*,void*,color_blob_t*), void *f_fun_arg_0, void *f_fun_arg_1);
-array_t *imlib_find_markers(array_t *blobs_list, int margin,
-                            bool (*f_fun)(void*,void*,color_blob_t*), void *f_fun_arg_0, void *f_fun_arg_1);
+bool imlib_find_blobs(arena_t *blobs_list, image_t *img,
+                      int num_thresholds, simple_color_t *l_thresholds, simple_color_t *h_thresholds,
+                      bool invert, rectangle_t *r, int x_stride, int y_stride,
+                      bool (*f_fun)(void*,void*,color_blob_t*), void *f_fun_arg_0, void *f_fun_arg_1);
+bool imlib_find_markers(arena_t *blobs_list_ret, arena_t *blobs_list, int margin,
+                        bool (*f_fun)(void*,void*,color_blob_t*), void *f_fun_arg_0, void *f_fun_arg_1);
 
 /* Clustering functions */
 array_t *cluster_kmeans(array_t *points, int k);
@@ -457,6 +611,8 @@ void imlib_integral_image_free(struct integral_image *sum);
 void imlib_integral_image(struct image *src, struct integral_image *sum);
 void imlib_integral_image_sq(struct image *src, struct integral_image *sum);
 void imlib_integral_image_scaled(struct image *src, struct integral_image *sum);
+void imlib_integral_image_ss(struct image *src, struct rectangle *roi, struct integral_image *sum, struct integral_image *ssq);
+void imlib_integral_image_roi(struct image *src, struct rectangle *roi, struct integral_image *sum);
 uint32_t imlib_integral_lookup(struct integral_image *src, int x, int y, int w, int h);
 
 // Integral moving window
@@ -472,18 +628,42 @@ void imlib_integral_mw_shift_ss(image_t *src, mw_image_t *sum, mw_image_t *ssq,
 long imlib_integral_mw_lookup(mw_image_t *sum, int x, int y, int w, int h);
 
 /* Template matching */
-float imlib_template_match(struct image *image, struct image *template, struct rectangle *r);
+void imlib_template_match(struct image *image, struct image **templates, int n_templates, float threshold,
+        struct rectangle *roi, struct rectangle *r, float *corr);
 
 /* Haar/VJ */
 int imlib_load_cascade(struct cascade* cascade, const char *path);
-array_t *imlib_detect_objects(struct image *image, struct cascade *cascade, struct rectangle *roi);
-
-/* FAST/FREAK Feature Extractor */
-void fast_detect(image_t *image, array_t *keypoints, int threshold, rectangle_t *roi);
-array_t *freak_find_keypoints(image_t *image, bool normalized, int threshold, rectangle_t *roi);
-int freak_match_keypoints(array_t *kpts1, array_t *kpts2, int threshold);
-int freak_save_descriptor(FIL *fp, array_t *kpts);
-int freak_load_descriptor(FIL *fp, array_t *kpts);
+void imlib_detect_objects(arena_t *objects, struct image *image, struct cascade *cascade, struct rectangle *roi);
+void imlib_detector_init(detector_t *detector, struct cascade *cascade, int interval);
+void imlib_detector_detect(arena_t *objects, detector_t *detector, struct image *image, struct rectangle *roi);
+
+/* LBP cascade detector */
+int imlib_load_lbp_cascade(lbp_cascade_t *cascade, const char *path);
+void imlib_detect_lbp_objects(arena_t *objects, struct image *image, lbp_cascade_t *cascade, struct rectangle *roi);
+
+/* FAST/FREAK/ORB Feature Extractor */
+void kp_set_alloc(kp_set_t *kpts, int n_kpts);
+void kp_set_free(kp_set_t *kpts);
+void fast_detect(image_t *image, kp_set_t *kpts, int threshold, rectangle_t *roi);
+void fast_find_corners(image_t *image, arena_t *corners, int threshold, int border, int cell_size, int cell_max, rectangle_t *roi);
+void freak_find_keypoints(kp_set_t *kpts, image_t *image, bool normalized, int threshold, rectangle_t *roi);
+int freak_save_descriptor(FIL *fp, kp_set_t *kpts);
+int freak_load_descriptor(FIL *fp, kp_set_t *kpts);
+int freak_distance(const uint8_t *desc1, const uint8_t *desc2);
+void freak_index_build(freak_index_t *index, kp_set_t *kpts);
+void freak_index_free(freak_index_t *index);
+int freak_match_index(freak_index_t *index, kp_set_t *kpts, int threshold, float ratio, bool cross_check);
+void orb_find_keypoints(arena_t *kpts, image_t *image, int max_kpts, float scale_factor, int levels, int threshold, rectangle_t *roi);
+int orb_match_keypoints(arena_t *kpts1, arena_t *kpts2, int threshold);
+
+/* Phase correlation */
+void imlib_phase_correlate(image_t *img0, image_t *img1, rectangle_t *roi,
+        float *x_translation, float *y_translation, float *response);
+
+/* RANSAC transform estimation */
+int imlib_find_transform(float *H, point_t *src, point_t *dst, int n_points,
+        transform_t type, float max_error, int max_iterations, uint8_t *mask);
+void imlib_transform_point(float *H, float x, float y, float *tx, float *ty);
 
 /* LBP Operator */
 void imlib_lbp_desc(image_t *image, int div, uint8_t *desc, rectangle_t *roi);
@@ -491,6 +671,8 @@ uint8_t *imlib_lbp_cascade(image_t *image, rectangle_t *roi);
 int imlib_lbp_desc_distance(uint8_t *d0, uint8_t *d1);
 int imlib_lbp_desc_save(FIL *fp, uint8_t *desc);
 int imlib_lbp_desc_load(FIL *fp, uint8_t **desc);
+int imlib_lbp_gallery_add(FIL *fp, int id, uint8_t *desc);
+int imlib_lbp_gallery_match(FIL *fp, uint8_t *desc, lbp_metric_t metric, lbp_match_t *matches, int *k);
 
 /* Iris detector */
 void imlib_find_iris(image_t *src, point_t *iris, rectangle_t *roi);
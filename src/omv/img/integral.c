@@ -99,6 +99,65 @@ void imlib_integral_image_sq(image_t *src, i_image_t *sum)
 
 }
 
+// Computes the sum and squared sum integral images of the ROI in one pass.
+// Both integral images must be (roi->w+1) x (roi->h+1), the first row and
+// column are zero so a rectangle lookup needs no bounds checks. Sums wrap
+// modulo 2^32, which is exact for any rectangle with less than 2^32/255^2
+// pixels.
+void imlib_integral_image_ss(image_t *src, rectangle_t *roi, i_image_t *sum, i_image_t *ssq)
+{
+    typeof(*sum->data) *sum_data = sum->data;
+    typeof(*ssq->data) *ssq_data = ssq->data;
+
+    // Zero the first row
+    memset(sum_data, 0, sum->w * sizeof(*sum_data));
+    memset(ssq_data, 0, ssq->w * sizeof(*ssq_data));
+
+    for (int y=1; y<sum->h; y++) {
+        typeof(*src->data) *img_row = src->data + ((roi->y+y-1)*src->w) + roi->x;
+        typeof(*sum->data) *sum_row = sum_data + (y*sum->w);
+        typeof(*ssq->data) *ssq_row = ssq_data + (y*ssq->w);
+
+        // Zero the first column
+        sum_row[0] = 0;
+        ssq_row[0] = 0;
+
+        /* loop over the number of columns */
+        for (uint32_t s=0, sq=0, x=1; x<sum->w; x++) {
+            uint32_t p = img_row[x-1];
+            /* sum of the current row (integer) */
+            s += p;
+            sq += p * p;
+            sum_row[x] = s + sum_row[(int)x-sum->w];
+            ssq_row[x] = sq + ssq_row[(int)x-ssq->w];
+        }
+    }
+}
+
+// Same as imlib_integral_image_ss() without the squared sum.
+void imlib_integral_image_roi(image_t *src, rectangle_t *roi, i_image_t *sum)
+{
+    typeof(*sum->data) *sum_data = sum->data;
+
+    // Zero the first row
+    memset(sum_data, 0, sum->w * sizeof(*sum_data));
+
+    for (int y=1; y<sum->h; y++) {
+        typeof(*src->data) *img_row = src->data + ((roi->y+y-1)*src->w) + roi->x;
+        typeof(*sum->data) *sum_row = sum_data + (y*sum->w);
+
+        // Zero the first column
+        sum_row[0] = 0;
+
+        /* loop over the number of columns */
+        for (uint32_t s=0, x=1; x<sum->w; x++) {
+            /* sum of the current row (integer) */
+            s += img_row[x-1];
+            sum_row[x] = s + sum_row[(int)x-sum->w];
+        }
+    }
+}
+
 uint32_t imlib_integral_lookup(i_image_t *sum, int x, int y, int w, int h)
 {
 #define PIXEL_AT(x,y)\
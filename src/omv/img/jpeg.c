@@ -3,12 +3,13 @@
  * Copyright (c) 2013/2014 Ibrahim Abdelkader <i.abdalkader@gmail.com>
  * This work is licensed under the MIT license, see the file LICENSE for details.
  *
- * Minimalistic JPEG baseline encoder.
- * Ported from public domain JPEG writer by Jon Olick - http://jonolick.com
+ * Minimalistic JPEG baseline encoder and decoder.
+ * Encoder ported from public domain JPEG writer by Jon Olick - http://jonolick.com
  *
  */
 #include <arm_math.h>
 #include <stdio.h>
+#include <mp.h>
 #include <stm32f4xx_hal.h>
 #include "xalloc.h"
 #include "fb_alloc.h"
@@ -19,17 +20,17 @@
 typedef struct {
     int idx;
     int length;
-    uint8_t *buf;
-    int bitc, bitb;
+    uint8_t *buf;   // Current chunk of the sink.
+    int bitc;       // Number of bits in bitb.
+    uint32_t bitb;  // Bits to write, MSB first.
+    uint32_t total; // Bytes in the flushed chunks.
+    jpeg_sink_t *sink;
 } jpeg_buf_t;
 
-// Quantization tables
+// Quantization tables, fdtbl_Y/UV are in zigzag order
 static int fdtbl_Y[64], fdtbl_UV[64];
 static uint8_t YTable[64], UVTable[64];
 
-// RGB565 to YUV table
-extern const int8_t yuv_table[196608];
-
 static const uint8_t s_jpeg_ZigZag[] = {
     0,  1,   5,  6, 14, 15, 27, 28,
     2,  4,   7, 13, 16, 26, 29, 42,
@@ -41,6 +42,18 @@ static const uint8_t s_jpeg_ZigZag[] = {
     35, 36, 48, 49, 57, 58, 62, 63
 };
 
+// Zigzag order to natural order
+static const uint8_t s_jpeg_UnZigZag[] = {
+    0,  1,  8, 16,  9,  2,  3, 10,
+    17, 24, 32, 25, 18, 11,  4,  5,
+    12, 19, 26, 33, 40, 48, 41, 34,
+    27, 20, 13,  6,  7, 14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36,
+    29, 22, 15, 23, 30, 37, 44, 51,
+    58, 59, 52, 45, 38, 31, 39, 46,
+    53, 60, 61, 54, 47, 55, 62, 63
+};
+
 static const uint8_t YQT[] = {
     16, 11, 10, 16, 24,  40,  51,  61,
     12, 12, 14, 19, 26,  58,  60,  55,
@@ -167,11 +180,21 @@ static const uint16_t UVAC_HT[256][2] = {
     {0xFFFC, 0x0010},{0xFFFD, 0x0010},{0xFFFE, 0x0010},{0x0000, 0x0000},{0x0000, 0x0000},{0x0000, 0x0000},{0x0000, 0x0000},{0x0000, 0x0000},
 };
 
+// Hands the current chunk to the sink and continues in the next one.
+static void jpeg_flush_chunk(jpeg_buf_t *jpeg_buf, bool last)
+{
+    jpeg_sink_t *sink = jpeg_buf->sink;
+    sink->flush(sink, jpeg_buf->idx, last);
+    jpeg_buf->total += jpeg_buf->idx;
+    jpeg_buf->buf = sink->buf;
+    jpeg_buf->length = sink->size;
+    jpeg_buf->idx = 0;
+}
+
 static void jpeg_put_char(jpeg_buf_t *jpeg_buf, char c)
 {
     if (jpeg_buf->idx == jpeg_buf->length) {
-        jpeg_buf->length += 1024;
-        jpeg_buf->buf = xrealloc(jpeg_buf->buf, jpeg_buf->length);
+        jpeg_flush_chunk(jpeg_buf, false);
     }
 
     jpeg_buf->buf[jpeg_buf->idx++]=c;
@@ -179,188 +202,232 @@ static void jpeg_put_char(jpeg_buf_t *jpeg_buf, char c)
 
 static void jpeg_put_bytes(jpeg_buf_t *jpeg_buf, const void *data, int size)
 {
-    if (jpeg_buf->idx+size >= jpeg_buf->length) {
-        jpeg_buf->length += 1024;
-        jpeg_buf->buf = xrealloc(jpeg_buf->buf, jpeg_buf->length);
+    while (size) {
+        if (jpeg_buf->idx == jpeg_buf->length) {
+            jpeg_flush_chunk(jpeg_buf, false);
+        }
+
+        int n = IM_MIN(size, jpeg_buf->length - jpeg_buf->idx);
+        memcpy(jpeg_buf->buf+jpeg_buf->idx, data, n);
+        jpeg_buf->idx += n;
+        data += n;
+        size -= n;
+    }
+}
+
+// Writes a full bit buffer word, stuffing a zero after each 0xFF byte.
+static void jpeg_put_word(jpeg_buf_t *jpeg_buf, uint32_t w)
+{
+    // Near the end of the chunk the bytes are written one at a time, so the
+    // chunk is only flushed when it's full (the memory sink can't flush).
+    if (jpeg_buf->idx+8 > jpeg_buf->length) {
+        for (int i=24; i>=0; i-=8) {
+            uint8_t c = w >> i;
+            jpeg_put_char(jpeg_buf, c);
+            if (c == 0xFF) {
+                jpeg_put_char(jpeg_buf, 0);
+            }
+        }
+        return;
     }
 
-    memcpy(jpeg_buf->buf+jpeg_buf->idx, data, size);
-    jpeg_buf->idx += size;
+    uint8_t *buf = jpeg_buf->buf+jpeg_buf->idx;
+    // Fast path, none of the bytes is 0xFF (no byte of ~w is zero).
+    if (((~w - 0x01010101) & w & 0x80808080) == 0) {
+        buf[0] = w >> 24;
+        buf[1] = w >> 16;
+        buf[2] = w >> 8;
+        buf[3] = w;
+        jpeg_buf->idx += 4;
+    } else {
+        for (int i=24; i>=0; i-=8) {
+            uint8_t c = w >> i;
+            *buf++ = c;
+            if (c == 0xFF) {
+                *buf++ = 0;
+            }
+        }
+        jpeg_buf->idx = buf - jpeg_buf->buf;
+    }
 }
 
-static void jpeg_writeBits(jpeg_buf_t *jpeg_buf, const uint16_t *bs)
+// Writes the len (< 32) low bits of bits.
+static inline void jpeg_put_bits(jpeg_buf_t *jpeg_buf, uint32_t bits, int len)
 {
-    jpeg_buf->bitc += bs[1];
-    jpeg_buf->bitb |= bs[0] << (24 - jpeg_buf->bitc);
+    int free = 32 - jpeg_buf->bitc;
+    if (len < free) {
+        jpeg_buf->bitb |= bits << (free - len);
+        jpeg_buf->bitc += len;
+    } else {
+        jpeg_put_word(jpeg_buf, jpeg_buf->bitb | (bits >> (len - free)));
+        jpeg_buf->bitc = len - free;
+        jpeg_buf->bitb = (jpeg_buf->bitc) ? (bits << (32 - jpeg_buf->bitc)) : 0;
+    }
+}
 
-    while (jpeg_buf->bitc > 7) {
-        uint8_t c = (jpeg_buf->bitb >> 16) & 255;
+// Writes the Huffman code of the (run, size) symbol and the magnitude bits of
+// val with one jpeg_put_bits, the size of val is found with CLZ.
+static inline void jpeg_put_coef(jpeg_buf_t *jpeg_buf, const uint16_t (*HT)[2], int run, int val)
+{
+    int size = (val == 0) ? 0 : (32 - __CLZ((val < 0) ? -val : val));
+    const uint16_t *code = HT[(run << 4) + size];
+    // Negative values are written in one's complement.
+    val -= (val < 0);
+    jpeg_put_bits(jpeg_buf, (code[0] << size) | (val & ((1 << size) - 1)), code[1] + size);
+}
+
+// Writes the remaining whole bytes of the bit buffer.
+static void jpeg_flush_bits(jpeg_buf_t *jpeg_buf)
+{
+    for (; jpeg_buf->bitc >= 8; jpeg_buf->bitc -= 8, jpeg_buf->bitb <<= 8) {
+        uint8_t c = jpeg_buf->bitb >> 24;
         jpeg_put_char(jpeg_buf, c);
-        if(c == 255) {
+        if (c == 0xFF) {
             jpeg_put_char(jpeg_buf, 0);
         }
-        jpeg_buf->bitb <<= 8;
-        jpeg_buf->bitc -= 8;
     }
 }
 
-//Huffman-encoded magnitude value
-static void jpeg_calcBits(int val, uint16_t bits[2]) {
-    int t1=val;
-    if (val<0) {
-        t1 = -val;
-        val = val-1;
-    }
-    bits[1] = 32-__CLZ(t1);
-    bits[0] = val & ((1<<bits[1])-1);
+// Dual 16-bit lane arithmetic, the DCT transforms two rows (or columns) at
+// once with each one in a halfword. DCT_HALF is an arithmetic shift by one.
+#if defined(ARM_MATH_CM4)
+#define DCT_ADD(a, b)       __SADD16(a, b)
+#define DCT_SUB(a, b)       __SSUB16(a, b)
+#define DCT_HALF(a)         __SHADD16(a, 0)
+#define DCT_PACK(lo, hi)    __PKHBT(lo, hi, 16)
+#else
+static inline uint32_t DCT_ADD(uint32_t a, uint32_t b)
+{
+    return ((a + b) & 0xFFFF) | ((a & 0xFFFF0000) + (b & 0xFFFF0000));
+}
+
+static inline uint32_t DCT_SUB(uint32_t a, uint32_t b)
+{
+    return ((a - b) & 0xFFFF) | ((a & 0xFFFF0000) - (b & 0xFFFF0000));
+}
+
+static inline uint32_t DCT_HALF(uint32_t a)
+{
+    return (((int16_t) a >> 1) & 0xFFFF) | (((int32_t) (a & 0xFFFF0000) >> 1) & 0xFFFF0000);
+}
+
+static inline uint32_t DCT_PACK(int lo, int hi)
+{
+    return (lo & 0xFFFF) | ((uint32_t) hi << 16);
+}
+#endif
+
+// BinDCT-a1 of two lanes, in place. The outputs are within +/-8192 for
+// 8-bit inputs, so the lanes never overflow.
+static inline void jpeg_dct8(uint32_t *v)
+{
+    uint32_t t0, t1, t2, t3, t4, t5, t6, t7, t10, t11, t12, t13;
+
+    t0 = DCT_ADD(v[0], v[7]);
+    t1 = DCT_ADD(v[1], v[6]);
+    t2 = DCT_ADD(v[2], v[5]);
+    t3 = DCT_ADD(v[3], v[4]);
+
+    t7 = DCT_SUB(v[0], v[7]);
+    t6 = DCT_SUB(v[1], v[6]);
+    t5 = DCT_SUB(v[2], v[5]);
+    t4 = DCT_SUB(v[3], v[4]);
+
+    /* Even part */
+    t10 = DCT_ADD(t0, t3);  /* phase 2 */
+    t13 = DCT_SUB(t0, t3);
+    t11 = DCT_ADD(t1, t2);
+    t12 = DCT_SUB(t1, t2);
+
+    v[0] = DCT_ADD(t10, t11);                   /* phase 3 */
+    v[4] = DCT_SUB(DCT_HALF(v[0]), t11);        /* jie 05/18/00 */
+
+    /*1/2, -1/2: alter the sign to get positive scaling factor */
+    v[6] = DCT_SUB(DCT_HALF(t13), t12);
+    v[2] = DCT_SUB(t13, DCT_HALF(v[6]));
+
+    /* odd part */
+    /* pi/4 = -1/2u 3/4d -1/2u*/
+    t10 = DCT_SUB(t5, DCT_HALF(t6));
+    t6 = DCT_SUB(DCT_ADD(t6, t10), DCT_HALF(DCT_HALF(t10)));
+    t5 = DCT_SUB(DCT_HALF(t6), t10);
+
+    t10 = DCT_ADD(t4, t5);
+    t11 = DCT_SUB(t4, t5);
+    t12 = DCT_SUB(t7, t6);
+    t13 = DCT_ADD(t7, t6);
+
+    /* 7pi/16 = 1/4u -1/4d: alter the sign to get positive scaling factor */
+    v[7] = DCT_SUB(DCT_HALF(DCT_HALF(t13)), t10);
+    v[1] = DCT_SUB(t13, DCT_HALF(DCT_HALF(v[7])));
+
+    /* 3pi/16 = */
+    /* new version: 1, -1/2 */
+    v[5] = DCT_ADD(t11, t12);
+    v[3] = DCT_SUB(t12, DCT_HALF(v[5]));
 }
 
 static int jpeg_processDU(jpeg_buf_t *jpeg_buf, int8_t *CDU, int *fdtbl, int DC, const uint16_t (*HTDC)[2], const uint16_t (*HTAC)[2])
 {
-    int DU[64], DUQ[64];
-    int t0, t1, t2, t3, t4, t5, t6, t7, t10, t11, t12, t13;
-    const uint16_t EOB[2] = { HTAC[0x00][0], HTAC[0x00][1] };
-    const uint16_t M16zeroes[2] = { HTAC[0xF0][0], HTAC[0xF0][1] };
-
-    // BinDCT-a1
-    // DCT rows
-    int8_t *p=CDU;
-    for (int i=8, *du=DU; i>0; i--, p+=8, du+=8) {
-        t0 = p[0] + p[7];
-        t1 = p[1] + p[6];
-        t2 = p[2] + p[5];
-        t3 = p[3] + p[4];
-
-        t7 = p[0] - p[7];
-        t6 = p[1] - p[6];
-        t5 = p[2] - p[5];
-        t4 = p[3] - p[4];
-
-        /* Even part */
-        t10 = t0 + t3 ;	/* phase 2 */
-        t13 = t0 - t3;
-        t11 = t1 + t2 ;
-        t12 = t1 - t2;
-
-        du[0] = (t10 + t11);             /* phase 3 */
-        du[4] = ((du[0] ) >> 1) - t11;   /* jie 05/18/00 */
-
-        /*1/2, -1/2: alter the sign to get positive scaling factor */
-        du[6] = (( t13 ) >> 1) - t12;
-        du[2] = t13 - ((du[6] ) >> 1);
-
-        /* odd part */
-        /* pi/4 = -1/2u 3/4d -1/2u*/
-        t10 = t5 - (( t6 ) >> 1);
-        t6 = t6 + t10 - ((t10 ) >> 2);
-        t5 = ((t6 ) >> 1) - t10;
-
-        t10 = t4 + t5;
-        t11 = t4 - t5;
-        t12 = t7 - t6;
-        t13 = t7 + t6;
-
-        /* 7pi/16 = 1/4u -1/4d: alter the sign to get positive scaling factor */
-        du[7] = ((t13 ) >> 2) - t10;
-        du[1] = t13 - ((du[7] ) >> 2);
-
-        /* 3pi/16 = */
-        /* new version: 1, -1/2 */
-        du[5] = t11 + t12;
-        du[3] = t12 - ((du[5] ) >> 1);
-    }
-
-    // DCT columns
-    for (int i=8, *du=DU; i>0; i--, du++) {
-        t0 = (du[8*0] + du[8*7]);
-        t1 = (du[8*1] + du[8*6]);
-        t2 = (du[8*2] + du[8*5]);
-        t3 = (du[8*3] + du[8*4]);
-
-        t7 = (du[8*0] - du[8*7]);
-        t6 = (du[8*1] - du[8*6]);
-        t5 = (du[8*2] - du[8*5]);
-        t4 = (du[8*3] - du[8*4]);
-
-        /* Even part */
-        t10 = t0 + t3;	/* phase 2 */
-        t13 = t0 - t3;
-        t11 = t1 + t2;
-        t12 = t1 - t2;
-
-        du[8*0] = (t10 + t11); /* phase 3 */
-        du[8*4] = ((du[8*0] ) >> 1) - t11;   /* Jie 05/18/00 */
-
-        // 1/2, 1/2
-        du[8*6] = ((t13 ) >> 1) - t12;
-        du[8*2] = t13 - ((du[8*6] ) >> 1);
-
-        /* Odd part */
-        /* pi/4 = -1/2u 3/4d -1/2u*/
-        t10 = t5 - ((t6 ) >> 1);
-        t6 = t6 + t10 - ((t10 ) >> 2);
-        t5 = ((t6 ) >> 1) - t10;
-
-        t10 = t4 + t5;
-        t11 = t4 - t5;
-        t12 = t7 - t6;
-        t13 = t7 + t6;
-
-        /* 7pi/16 = 1/4u -1/4d: alter sign to get positive scaling factor */
-        du[8*7] = ((t13 ) >> 2) - t10;
-        du[8*1] = t13 - ((du[8*7] ) >> 2);
-
-        /* 3pi/16 = */
-        /* new : 1 and -1/2 */
-        du[8*5] = t11 + t12 ;
-        du[8*3] = t12 - ((du[8*5] ) >> 1);
-    }
-
-    // first non-zero element in reverse order
-    int end0pos = 0;
-    // Quantize/descale/zigzag the coefficients
-    for(int i=0; i<64; ++i) {
-        DUQ[s_jpeg_ZigZag[i]] = (DU[i]*fdtbl[i])/4096;
-        if (s_jpeg_ZigZag[i] > end0pos && DUQ[s_jpeg_ZigZag[i]]) {
-            end0pos = s_jpeg_ZigZag[i];
+    int16_t DU[64] __attribute__((aligned(4)));
+    int DUQ[64];
+    uint32_t v[8];
+
+    // DCT rows, two rows at a time
+    for (int r=0; r<64; r+=16) {
+        int8_t *p = CDU+r;
+        for (int i=0; i<8; i++) {
+            v[i] = DCT_PACK(p[i], p[i+8]);
+        }
+        jpeg_dct8(v);
+        for (int i=0; i<8; i++) {
+            DU[r+i]   = v[i];
+            DU[r+i+8] = v[i] >> 16;
         }
     }
 
-    // Encode DC
-    int diff = DUQ[0] - DC;
-    if (diff == 0) {
-        jpeg_writeBits(jpeg_buf, HTDC[0]);
-    } else {
-        uint16_t bits[2];
-        jpeg_calcBits(diff, bits);
-        jpeg_writeBits(jpeg_buf, HTDC[bits[1]]);
-        jpeg_writeBits(jpeg_buf, bits);
+    // DCT columns, two adjacent columns are one word
+    uint32_t *du = (uint32_t *) DU;
+    for (int c=0; c<4; c++) {
+        for (int i=0; i<8; i++) {
+            v[i] = du[i*4+c];
+        }
+        jpeg_dct8(v);
+        for (int i=0; i<8; i++) {
+            du[i*4+c] = v[i];
+        }
     }
 
-    // Encode ACs
-    if(end0pos == 0) {
-        jpeg_writeBits(jpeg_buf, EOB);
-        return DUQ[0];
+    // Quantize/descale in zigzag order, the quantization table is scaled by
+    // 4096 and the shift rounds toward zero like a division would.
+    int end0pos = 0;
+    for (int i=0; i<64; i++) {
+        int q = DU[s_jpeg_UnZigZag[i]] * fdtbl[i];
+        DUQ[i] = (q + ((q >> 31) & 4095)) >> 12;
+        if (DUQ[i]) {
+            end0pos = i;
+        }
     }
 
-    for(int i = 1; i <= end0pos; ++i) {
-        int startpos = i;
-        for (; DUQ[i]==0 && i<=end0pos ; ++i) {
+    // Encode DC
+    jpeg_put_coef(jpeg_buf, HTDC, 0, DUQ[0] - DC);
+
+    // Encode ACs
+    for (int i=1; i<=end0pos; i++) {
+        int run = 0;
+        // DUQ[end0pos] is non-zero
+        for (; DUQ[i]==0; i++) {
+            run++;
         }
-        int nrzeroes = i-startpos;
-        if ( nrzeroes >= 16 ) {
-            int lng = nrzeroes>>4;
-            for (int nrmarker=1; nrmarker <= lng; ++nrmarker)
-                jpeg_writeBits(jpeg_buf, M16zeroes);
-            nrzeroes &= 15;
+        for (; run >= 16; run -= 16) {
+            jpeg_put_bits(jpeg_buf, HTAC[0xF0][0], HTAC[0xF0][1]);
         }
-        uint16_t bits[2];
-        jpeg_calcBits(DUQ[i], bits);
-        jpeg_writeBits(jpeg_buf, HTAC[(nrzeroes<<4)+bits[1]]);
-        jpeg_writeBits(jpeg_buf, bits);
+        jpeg_put_coef(jpeg_buf, HTAC, run, DUQ[i]);
     }
-    if(end0pos != 63) {
-        jpeg_writeBits(jpeg_buf, EOB);
+
+    if (end0pos != 63) {
+        // EOB
+        jpeg_put_bits(jpeg_buf, HTAC[0x00][0], HTAC[0x00][1]);
     }
     return DUQ[0];
 }
@@ -383,8 +450,8 @@ static void jpeg_init(int quality)
 
         for(int r = 0, k = 0; r < 8; ++r) {
             for(int c = 0; c < 8; ++c, ++k) {
-                fdtbl_Y[k]  = (int)((aasf[r] * aasf[c] /(YTable [s_jpeg_ZigZag[k]] * 8.0f))*4096);
-                fdtbl_UV[k] = (int)((aasf[r] * aasf[c] /(UVTable[s_jpeg_ZigZag[k]] * 8.0f))*4096);
+                fdtbl_Y[s_jpeg_ZigZag[k]]  = (int)((aasf[r] * aasf[c] /(YTable [s_jpeg_ZigZag[k]] * 8.0f))*4096);
+                fdtbl_UV[s_jpeg_ZigZag[k]] = (int)((aasf[r] * aasf[c] /(UVTable[s_jpeg_ZigZag[k]] * 8.0f))*4096);
             }
         }
     }
@@ -496,7 +563,81 @@ static void jpeg_write_headers(jpeg_buf_t *jpeg_buf, int w, int h, int bpp)
     jpeg_put_bytes(jpeg_buf, (uint8_t [3]){0x00, 0x3F, 0x0}, 3);
 }
 
-void jpeg_compress(image_t *src, image_t *dst, int quality)
+// Loads an 8x8 grayscale MCU, pixels past the right and bottom edges of the
+// image repeat the last column and row.
+static void jpeg_load_mcu_gs(image_t *src, int x, int y, int8_t *YDU)
+{
+    uint8_t *pixels = src->pixels;
+    int cols[8];
+    for (int i=0; i<8; i++) {
+        cols[i] = IM_MIN(x+i, src->w-1);
+    }
+
+    for (int j=0; j<8; j++, YDU+=8) {
+        uint8_t *row = pixels+(IM_MIN(y+j, src->h-1)*src->w);
+        if (x+8 <= src->w) {
+            for (int i=0; i<8; i++) {
+                YDU[i] = row[x+i] - 128;
+            }
+        } else {
+            for (int i=0; i<8; i++) {
+                YDU[i] = row[cols[i]] - 128;
+            }
+        }
+    }
+}
+
+// BT.601 Y (offset by -128) of RGB565 channels, in Q8 with the 5/6-bit to
+// 8-bit expansion folded into the weights.
+#define JPEG_Y(r, g, b)     ((((630 * (r)) + (608 * (g)) + (240 * (b)) + 128) >> 8) - 128)
+// Cb and Cr of the sums of four RGB565 pixels (Q10). The 0.5 weight is rounded
+// down (1052 instead of 1053) so full blue/red stays within int8.
+#define JPEG_CB(r, g, b)    (((-355 * (r)) - (343 * (g)) + (1052 * (b)) + 512) >> 10)
+#define JPEG_CR(r, g, b)    (((1052 * (r)) - (434 * (g)) - (171 * (b)) + 512) >> 10)
+
+// Loads a 16x16 RGB565 MCU, two rows at a time, into four Y blocks and one
+// 4:2:0 Cb and Cr block. The chroma of each 2x2 pixel quad is computed from
+// its averaged RGB. Pixels past the right and bottom edges of the image
+// repeat the last column and row.
+static void jpeg_load_mcu_rgb565(image_t *src, int x, int y, int8_t *YDU, int8_t *UDU, int8_t *VDU)
+{
+    uint16_t *pixels = (uint16_t *) src->pixels;
+    int cols[16];
+    for (int i=0; i<16; i++) {
+        cols[i] = IM_MIN(x+i, src->w-1);
+    }
+
+    for (int j=0; j<16; j+=2, UDU+=8, VDU+=8) {
+        uint16_t *row0 = pixels+(IM_MIN(y+j+0, src->h-1)*src->w);
+        uint16_t *row1 = pixels+(IM_MIN(y+j+1, src->h-1)*src->w);
+        // Blocks 2 and 3 hold the bottom half of the MCU.
+        int8_t *y0 = YDU+((j&8)<<4)+((j&7)*8);
+        int8_t *y1 = y0+8;
+
+        for (int i=0; i<16; i+=2) {
+            uint16_t p0 = row0[cols[i]], p1 = row0[cols[i+1]];
+            uint16_t p2 = row1[cols[i]], p3 = row1[cols[i+1]];
+            int r0 = IM_R565(p0), g0 = IM_G565(p0), b0 = IM_B565(p0);
+            int r1 = IM_R565(p1), g1 = IM_G565(p1), b1 = IM_B565(p1);
+            int r2 = IM_R565(p2), g2 = IM_G565(p2), b2 = IM_B565(p2);
+            int r3 = IM_R565(p3), g3 = IM_G565(p3), b3 = IM_B565(p3);
+
+            // Block 1 holds the right half of the MCU.
+            int o = ((i&8)<<3)+(i&7);
+            y0[o+0] = JPEG_Y(r0, g0, b0);
+            y0[o+1] = JPEG_Y(r1, g1, b1);
+            y1[o+0] = JPEG_Y(r2, g2, b2);
+            y1[o+1] = JPEG_Y(r3, g3, b3);
+
+            int r = r0+r1+r2+r3, g = g0+g1+g2+g3, b = b0+b1+b2+b3;
+            UDU[i/2] = JPEG_CB(r, g, b);
+            VDU[i/2] = JPEG_CR(r, g, b);
+        }
+    }
+}
+
+// Encodes src and streams the JPEG to the sink, returns the size of the JPEG.
+uint32_t jpeg_encode(image_t *src, jpeg_sink_t *sink, int quality)
 {
     int DCY=0, DCU=0, DCV=0;
 
@@ -507,10 +648,12 @@ void jpeg_compress(image_t *src, image_t *dst, int quality)
     // JPEG buffer
     jpeg_buf_t  jpeg_buf = {
         .idx =0,
-        .buf = dst->pixels,
-        .length = dst->bpp,
+        .buf = sink->buf,
+        .length = sink->size,
         .bitc = 0,
         .bitb = 0,
+        .total = 0,
+        .sink = sink,
     };
 
     // Initialize quantization tables
@@ -522,91 +665,17 @@ void jpeg_compress(image_t *src, image_t *dst, int quality)
     // Encode 8x8 macroblocks
     if (src->bpp == 1) {
         int8_t YDU[64];
-        uint8_t *pixels = (uint8_t *)src->pixels;
-
-        // Copy 8x8 MCUs
         for (int y=0; y<src->h; y+=8) {
             for (int x=0; x<src->w; x+=8) {
-                for (int r=y, idx=0; r<y+8; ++r, idx+=8) {
-                    int ofs = r*src->w+x;
-                    YDU[idx + 0] = pixels[ofs + 0] - 128;
-                    YDU[idx + 1] = pixels[ofs + 1] - 128;
-                    YDU[idx + 2] = pixels[ofs + 2] - 128;
-                    YDU[idx + 3] = pixels[ofs + 3] - 128;
-                    YDU[idx + 4] = pixels[ofs + 4] - 128;
-                    YDU[idx + 5] = pixels[ofs + 5] - 128;
-                    YDU[idx + 6] = pixels[ofs + 6] - 128;
-                    YDU[idx + 7] = pixels[ofs + 7] - 128;
-                }
+                jpeg_load_mcu_gs(src, x, y, YDU);
                 DCY = jpeg_processDU(&jpeg_buf, YDU, fdtbl_Y, DCY, YDC_HT, YAC_HT);
             }
         }
     } else if (src->bpp == 2) {// TODO assuming RGB565
         int8_t YDU[256], UDU[64], VDU[64];
-        uint16_t *pixels = (uint16_t *)src->pixels;
-
         for (int y=0; y<src->h; y+=16) {
             for (int x=0; x<src->w; x+=16) {
-                for (int i=0, r=y, idx=0; r<y+8; i++, r++, idx+=8) {
-                    int ofs = r*src->w+x;
-                    YDU[idx + 0]       = yuv_table[pixels[ofs + 0] * 3 + 0];
-                    YDU[idx + 1]       = yuv_table[pixels[ofs + 1] * 3 + 0];
-                    YDU[idx + 2]       = yuv_table[pixels[ofs + 2] * 3 + 0];
-                    YDU[idx + 3]       = yuv_table[pixels[ofs + 3] * 3 + 0];
-                    YDU[idx + 4]       = yuv_table[pixels[ofs + 4] * 3 + 0];
-                    YDU[idx + 5]       = yuv_table[pixels[ofs + 5] * 3 + 0];
-                    YDU[idx + 6]       = yuv_table[pixels[ofs + 6] * 3 + 0];
-                    YDU[idx + 7]       = yuv_table[pixels[ofs + 7] * 3 + 0];
-
-                    YDU[idx + 0 + 64]  = yuv_table[pixels[ofs + 0 + 8] * 3 + 0];
-                    YDU[idx + 1 + 64]  = yuv_table[pixels[ofs + 1 + 8] * 3 + 0];
-                    YDU[idx + 2 + 64]  = yuv_table[pixels[ofs + 2 + 8] * 3 + 0];
-                    YDU[idx + 3 + 64]  = yuv_table[pixels[ofs + 3 + 8] * 3 + 0];
-                    YDU[idx + 4 + 64]  = yuv_table[pixels[ofs + 4 + 8] * 3 + 0];
-                    YDU[idx + 5 + 64]  = yuv_table[pixels[ofs + 5 + 8] * 3 + 0];
-                    YDU[idx + 6 + 64]  = yuv_table[pixels[ofs + 6 + 8] * 3 + 0];
-                    YDU[idx + 7 + 64]  = yuv_table[pixels[ofs + 7 + 8] * 3 + 0];
-
-                    ofs = (r+8)*src->w+x;
-                    YDU[idx + 0 + 128] = yuv_table[pixels[ofs + 0] * 3 + 0];
-                    YDU[idx + 1 + 128] = yuv_table[pixels[ofs + 1] * 3 + 0];
-                    YDU[idx + 2 + 128] = yuv_table[pixels[ofs + 2] * 3 + 0];
-                    YDU[idx + 3 + 128] = yuv_table[pixels[ofs + 3] * 3 + 0];
-                    YDU[idx + 4 + 128] = yuv_table[pixels[ofs + 4] * 3 + 0];
-                    YDU[idx + 5 + 128] = yuv_table[pixels[ofs + 5] * 3 + 0];
-                    YDU[idx + 6 + 128] = yuv_table[pixels[ofs + 6] * 3 + 0];
-                    YDU[idx + 7 + 128] = yuv_table[pixels[ofs + 7] * 3 + 0];
-
-                    YDU[idx + 0 + 192] = yuv_table[pixels[ofs + 0 + 8] * 3 + 0];
-                    YDU[idx + 1 + 192] = yuv_table[pixels[ofs + 1 + 8] * 3 + 0];
-                    YDU[idx + 2 + 192] = yuv_table[pixels[ofs + 2 + 8] * 3 + 0];
-                    YDU[idx + 3 + 192] = yuv_table[pixels[ofs + 3 + 8] * 3 + 0];
-                    YDU[idx + 4 + 192] = yuv_table[pixels[ofs + 4 + 8] * 3 + 0];
-                    YDU[idx + 5 + 192] = yuv_table[pixels[ofs + 5 + 8] * 3 + 0];
-                    YDU[idx + 6 + 192] = yuv_table[pixels[ofs + 6 + 8] * 3 + 0];
-                    YDU[idx + 7 + 192] = yuv_table[pixels[ofs + 7 + 8] * 3 + 0];
-
-                    ofs = (y+i*2)*src->w+x;
-                    // Just toss the odd U/V pixels (could average for better quality)
-                    UDU[idx + 0] = yuv_table[pixels[ofs + 0] * 3 + 1];
-                    UDU[idx + 1] = yuv_table[pixels[ofs + 2] * 3 + 1];
-                    UDU[idx + 2] = yuv_table[pixels[ofs + 4] * 3 + 1];
-                    UDU[idx + 3] = yuv_table[pixels[ofs + 6] * 3 + 1];
-                    UDU[idx + 4] = yuv_table[pixels[ofs + 8] * 3 + 1];
-                    UDU[idx + 5] = yuv_table[pixels[ofs +10] * 3 + 1];
-                    UDU[idx + 6] = yuv_table[pixels[ofs +12] * 3 + 1];
-                    UDU[idx + 7] = yuv_table[pixels[ofs +14] * 3 + 1];
-
-                    VDU[idx + 0] = yuv_table[pixels[ofs + 0] * 3 + 2];
-                    VDU[idx + 1] = yuv_table[pixels[ofs + 2] * 3 + 2];
-                    VDU[idx + 2] = yuv_table[pixels[ofs + 4] * 3 + 2];
-                    VDU[idx + 3] = yuv_table[pixels[ofs + 6] * 3 + 2];
-                    VDU[idx + 4] = yuv_table[pixels[ofs + 8] * 3 + 2];
-                    VDU[idx + 5] = yuv_table[pixels[ofs +10] * 3 + 2];
-                    VDU[idx + 6] = yuv_table[pixels[ofs +12] * 3 + 2];
-                    VDU[idx + 7] = yuv_table[pixels[ofs +14] * 3 + 2];
-                }
-
+                jpeg_load_mcu_rgb565(src, x, y, YDU, UDU, VDU);
                 DCY = jpeg_processDU(&jpeg_buf, YDU,     fdtbl_Y, DCY, YDC_HT, YAC_HT);
                 DCY = jpeg_processDU(&jpeg_buf, YDU+64,  fdtbl_Y, DCY, YDC_HT, YAC_HT);
                 DCY = jpeg_processDU(&jpeg_buf, YDU+128, fdtbl_Y, DCY, YDC_HT, YAC_HT);
@@ -618,19 +687,57 @@ void jpeg_compress(image_t *src, image_t *dst, int quality)
     }
 
     // Do the bit alignment of the EOI marker
-    static const uint16_t fillBits[] = {0x7F, 7};
-    jpeg_writeBits(&jpeg_buf, fillBits);
+    jpeg_put_bits(&jpeg_buf, 0x7F, 7);
+    jpeg_flush_bits(&jpeg_buf);
 
     // EOI
     jpeg_put_char(&jpeg_buf, 0xFF);
     jpeg_put_char(&jpeg_buf, 0xD9);
 
-    dst->bpp = jpeg_buf.idx;
-    dst->data = jpeg_buf.buf;
+    jpeg_flush_chunk(&jpeg_buf, true);
 
     #if (TIME_JPEG==1)
     printf("time: %lums\n", HAL_GetTick() - start);
     #endif
+
+    return jpeg_buf.total;
+}
+
+// The memory sink writes the whole JPEG to one buffer.
+static void jpeg_sink_mem_flush(jpeg_sink_t *sink, uint32_t len, bool last)
+{
+    if (!last) {
+        nlr_raise(mp_obj_new_exception_msg(&mp_type_MemoryError, "JPEG buffer overflow!"));
+    }
+}
+
+void jpeg_sink_mem(jpeg_sink_t *sink, uint8_t *buf, uint32_t size)
+{
+    sink->buf = buf;
+    sink->size = size;
+    sink->flush = jpeg_sink_mem_flush;
+    sink->data = NULL;
+}
+
+// The file sink writes each chunk to the file and reuses the buffer.
+static void jpeg_sink_file_flush(jpeg_sink_t *sink, uint32_t len, bool last)
+{
+    write_data((FIL *) sink->data, sink->buf, len);
+}
+
+void jpeg_sink_file(jpeg_sink_t *sink, FIL *fp, uint8_t *buf, uint32_t size)
+{
+    sink->buf = buf;
+    sink->size = size;
+    sink->flush = jpeg_sink_file_flush;
+    sink->data = fp;
+}
+
+void jpeg_compress(image_t *src, image_t *dst, int quality)
+{
+    jpeg_sink_t sink;
+    jpeg_sink_mem(&sink, dst->pixels, dst->bpp);
+    dst->bpp = jpeg_encode(src, &sink, quality);
 }
 
 // This function inits the geometry values of an image.
@@ -701,15 +808,652 @@ void jpeg_write(image_t *img, const char *path, int quality)
     if (IM_IS_JPEG(img)) {
         write_data(&fp, img->pixels, img->bpp);
     } else {
-        uint32_t size;
-        uint8_t *buffer = fb_alloc_all(&size);
-        image_t out = { .w=img->w, .h=img->h, .bpp=size, .pixels=buffer };
-        // When jpeg_compress needs more memory than in currently allocated it
-        // will try to realloc. MP will detect that the pointer is outside of
-        // the heap and return NULL which will cause an out of memory error.
-        jpeg_compress(img, &out, quality);
-        write_data(&fp, out.pixels, out.bpp);
+        jpeg_sink_t sink;
+        jpeg_sink_file(&sink, &fp, fb_alloc(JPEG_SINK_CHUNK), JPEG_SINK_CHUNK);
+        jpeg_encode(img, &sink, quality);
         fb_free();
     }
     file_close(&fp);
 }
+
+// Baseline JPEG decoder.
+//
+// The image is decoded one MCU row at a time into a plane per component, and
+// lines are converted to grayscale or RGB565 as they are read. The reduced
+// 4x4, 2x2 and 1x1 (DC) IDCTs output the box average of each full size block,
+// so a 1/2, 1/4 or 1/8 scale image skips the full IDCT. Chroma is upsampled
+// by pixel replication.
+#define JPEG_HUFF_LOOKUP    (8)
+
+typedef struct jpeg_huff {
+    uint16_t look[1 << JPEG_HUFF_LOOKUP]; // (length << 8) | value, 0 for longer codes.
+    int32_t maxcode[17];    // Largest code of each length, -1 if none.
+    int32_t valoff[17];     // Offset from a code of each length to its value.
+    uint8_t val[256];
+} jpeg_huff_t;
+
+typedef struct jpeg_component {
+    int id, h, v, tq, td, ta;
+    int pred;       // DC predictor.
+    int hs, vs;     // Subsampling shifts.
+    int stride;
+    uint8_t *plane; // Pixels of the current MCU row.
+} jpeg_component_t;
+
+struct jpeg_decoder {
+    jpeg_huff_t huff[4];    // DC 0, DC 1, AC 0, AC 1.
+    uint16_t qt[4][64];     // Natural order.
+    int16_t coef[64];       // Natural order.
+    jpeg_component_t comp[3];
+    int w, h, ncomp, nplanes, bpp;
+    int n;                  // Output size of a block.
+    int mcus_x, row_lines, row_line;
+    int restart, restart_left;
+    uint32_t bitb;          // Bits read, MSB first.
+    int bitc;               // Number of bits in bitb.
+    int marker;             // Marker found in the entropy coded data.
+    uint32_t bytes_left;
+};
+
+// The 8-point IDCT basis cos((2x+1)u*pi/16)*C(u)/2 averaged over each 2 or 4
+// output pixels in Q12, so the reduced IDCTs output the box average of the
+// full size block. The basis of some even coefficients averages to zero, only
+// the coefficients listed in jpeg_idct4_coefs and jpeg_idct2_coefs are used.
+static const int16_t jpeg_idct4_tab[4][8] = {
+    {1448,  1856,  1338,   652,     0,  -435,  -554,  -369},
+    {1448,   769, -1338, -1573,     0,  1051,   554,  -153},
+    {1448,  -769, -1338,  1573,     0, -1051,   554,   153},
+    {1448, -1856,  1338,  -652,     0,   435,  -554,   369},
+};
+
+static const int16_t jpeg_idct2_tab[2][8] = {
+    {1448,  1312,     0,  -461,     0,   308,     0,  -261},
+    {1448, -1312,     0,   461,     0,  -308,     0,   261},
+};
+
+static const uint8_t jpeg_idct4_coefs[] = {0, 1, 2, 3, 5, 6, 7};
+static const uint8_t jpeg_idct2_coefs[] = {0, 1, 3, 5, 7};
+
+static inline uint8_t jpeg_clamp(int x)
+{
+    return (x < 0) ? 0 : ((x > 255) ? 255 : x);
+}
+
+static bool jpeg_huff_build(jpeg_huff_t *huff, const uint8_t *bits, const uint8_t *vals, int count)
+{
+    memset(huff->look, 0, sizeof(huff->look));
+    memcpy(huff->val, vals, count);
+    for (int l=1, code=0, k=0; l<=16; l++, code<<=1) {
+        huff->valoff[l] = k - code;
+        for (int i=0; i<bits[l-1]; i++, k++, code++) {
+            if (code >= (1 << l)) {
+                return false;
+            }
+            if (l <= JPEG_HUFF_LOOKUP) {
+                int shift = JPEG_HUFF_LOOKUP - l;
+                for (int j=0; j<(1 << shift); j++) {
+                    huff->look[(code << shift) | j] = (l << 8) | vals[k];
+                }
+            }
+        }
+        huff->maxcode[l] = bits[l-1] ? (code - 1) : -1;
+    }
+    return true;
+}
+
+// Returns the next byte of entropy coded data, or zero after a marker.
+static uint8_t jpeg_get_byte(struct jpeg_decoder *dec, FIL *fp)
+{
+    uint8_t b, m = 0xFF;
+    if (dec->marker || !dec->bytes_left) {
+        return 0;
+    }
+    read_byte(fp, &b);
+    dec->bytes_left--;
+    if (b == 0xFF) {
+        while ((m == 0xFF) && dec->bytes_left) {
+            read_byte(fp, &m);
+            dec->bytes_left--;
+        }
+        if (m) {
+            dec->marker = m;
+            return 0;
+        }
+    }
+    return b;
+}
+
+static void jpeg_fill_bits(struct jpeg_decoder *dec, FIL *fp)
+{
+    for (; dec->bitc <= 24; dec->bitc += 8) {
+        dec->bitb |= ((uint32_t) jpeg_get_byte(dec, fp)) << (24 - dec->bitc);
+    }
+}
+
+static inline int jpeg_huff_decode(struct jpeg_decoder *dec, FIL *fp, jpeg_huff_t *huff)
+{
+    if (dec->bitc < 16) {
+        jpeg_fill_bits(dec, fp);
+    }
+    int e = huff->look[dec->bitb >> (32 - JPEG_HUFF_LOOKUP)];
+    int l = e >> 8;
+    if (!e) {
+        for (l=JPEG_HUFF_LOOKUP+1; ; l++) {
+            if (l > 16) {
+                ff_file_corrupted(fp);
+            }
+            int code = dec->bitb >> (32 - l);
+            if (code <= huff->maxcode[l]) {
+                e = huff->val[code + huff->valoff[l]];
+                break;
+            }
+        }
+    }
+    dec->bitb <<= l;
+    dec->bitc -= l;
+    return e & 0xFF;
+}
+
+// Reads an s bit magnitude, negative values are in one's complement.
+static inline int jpeg_receive_extend(struct jpeg_decoder *dec, FIL *fp, int s)
+{
+    if (!s) {
+        return 0;
+    }
+    if (dec->bitc < s) {
+        jpeg_fill_bits(dec, fp);
+    }
+    int v = dec->bitb >> (32 - s);
+    dec->bitb <<= s;
+    dec->bitc -= s;
+    return (v < (1 << (s - 1))) ? (v - (1 << s) + 1) : v;
+}
+
+// Decodes a block into coef, the AC coefficients are only stored if ac is set.
+static void jpeg_decode_block(struct jpeg_decoder *dec, FIL *fp, jpeg_component_t *comp, bool ac)
+{
+    int16_t *coef = dec->coef;
+    int s = jpeg_huff_decode(dec, fp, &dec->huff[comp->td]);
+    if (s > 11) {
+        ff_file_corrupted(fp);
+    }
+    comp->pred += jpeg_receive_extend(dec, fp, s);
+    if (ac) {
+        memset(coef, 0, sizeof(dec->coef));
+    }
+    coef[0] = comp->pred;
+
+    for (int k=1; k<64; k++) {
+        int rs = jpeg_huff_decode(dec, fp, &dec->huff[2 + comp->ta]);
+        int r = rs >> 4;
+        s = rs & 15;
+        if (s) {
+            k += r;
+            int v = jpeg_receive_extend(dec, fp, s);
+            if (ac && (k < 64)) {
+                coef[s_jpeg_UnZigZag[k]] = v;
+            }
+        } else if (r == 15) {
+            k += 15;
+        } else {
+            break;
+        }
+    }
+}
+
+// Integer 8x8 IDCT (the islow IDCT from libjpeg), CONST_BITS=13 PASS1_BITS=2.
+static void jpeg_idct8(const int16_t *coef, const uint16_t *qt, uint8_t *out, int stride)
+{
+    int32_t ws[64];
+
+    // Columns, the output is scaled up by 2^PASS1_BITS.
+    for (int c=0; c<8; c++) {
+        const int16_t *in = coef + c;
+        const uint16_t *q = qt + c;
+        int32_t *w = ws + c;
+        if (!(in[8] | in[16] | in[24] | in[32] | in[40] | in[48] | in[56])) {
+            int32_t dc = (in[0] * q[0]) * 4;
+            for (int i=0; i<64; i+=8) {
+                w[i] = dc;
+            }
+            continue;
+        }
+
+        // Even part
+        int32_t z2 = in[16] * q[16], z3 = in[48] * q[48];
+        int32_t z1 = (z2 + z3) * 4433;
+        int32_t tmp2 = z1 - (z3 * 15137);
+        int32_t tmp3 = z1 + (z2 * 6270);
+        z2 = in[0] * q[0];
+        z3 = in[32] * q[32];
+        int32_t tmp0 = (z2 + z3) * 8192;
+        int32_t tmp1 = (z2 - z3) * 8192;
+        int32_t tmp10 = tmp0 + tmp3, tmp13 = tmp0 - tmp3;
+        int32_t tmp11 = tmp1 + tmp2, tmp12 = tmp1 - tmp2;
+
+        // Odd part
+        tmp0 = in[56] * q[56];
+        tmp1 = in[40] * q[40];
+        tmp2 = in[24] * q[24];
+        tmp3 = in[8] * q[8];
+        z1 = tmp0 + tmp3;
+        z2 = tmp1 + tmp2;
+        z3 = tmp0 + tmp2;
+        int32_t z4 = tmp1 + tmp3;
+        int32_t z5 = (z3 + z4) * 9633;
+        tmp0 *= 2446; tmp1 *= 16819; tmp2 *= 25172; tmp3 *= 12299;
+        z1 *= -7373; z2 *= -20995; z3 *= -16069; z4 *= -3196;
+        z3 += z5; z4 += z5;
+        tmp0 += z1 + z3; tmp1 += z2 + z4; tmp2 += z2 + z3; tmp3 += z1 + z4;
+
+        w[0]  = (tmp10 + tmp3 + (1 << 10)) >> 11;
+        w[56] = (tmp10 - tmp3 + (1 << 10)) >> 11;
+        w[8]  = (tmp11 + tmp2 + (1 << 10)) >> 11;
+        w[48] = (tmp11 - tmp2 + (1 << 10)) >> 11;
+        w[16] = (tmp12 + tmp1 + (1 << 10)) >> 11;
+        w[40] = (tmp12 - tmp1 + (1 << 10)) >> 11;
+        w[24] = (tmp13 + tmp0 + (1 << 10)) >> 11;
+        w[32] = (tmp13 - tmp0 + (1 << 10)) >> 11;
+    }
+
+    // Rows, the output is scaled down by 2^(CONST_BITS+PASS1_BITS+3).
+    for (int r=0; r<8; r++, out+=stride) {
+        int32_t *w = ws + (r * 8);
+        if (!(w[1] | w[2] | w[3] | w[4] | w[5] | w[6] | w[7])) {
+            memset(out, jpeg_clamp(((w[0] + (1 << 4)) >> 5) + 128), 8);
+            continue;
+        }
+
+        // Even part
+        int32_t z2 = w[2], z3 = w[6];
+        int32_t z1 = (z2 + z3) * 4433;
+        int32_t tmp2 = z1 - (z3 * 15137);
+        int32_t tmp3 = z1 + (z2 * 6270);
+        int32_t tmp0 = (w[0] + w[4]) * 8192;
+        int32_t tmp1 = (w[0] - w[4]) * 8192;
+        int32_t tmp10 = tmp0 + tmp3, tmp13 = tmp0 - tmp3;
+        int32_t tmp11 = tmp1 + tmp2, tmp12 = tmp1 - tmp2;
+
+        // Odd part
+        tmp0 = w[7]; tmp1 = w[5]; tmp2 = w[3]; tmp3 = w[1];
+        z1 = tmp0 + tmp3;
+        z2 = tmp1 + tmp2;
+        z3 = tmp0 + tmp2;
+        int32_t z4 = tmp1 + tmp3;
+        int32_t z5 = (z3 + z4) * 9633;
+        tmp0 *= 2446; tmp1 *= 16819; tmp2 *= 25172; tmp3 *= 12299;
+        z1 *= -7373; z2 *= -20995; z3 *= -16069; z4 *= -3196;
+        z3 += z5; z4 += z5;
+        tmp0 += z1 + z3; tmp1 += z2 + z4; tmp2 += z2 + z3; tmp3 += z1 + z4;
+
+        out[0] = jpeg_clamp(((tmp10 + tmp3 + (1 << 17)) >> 18) + 128);
+        out[7] = jpeg_clamp(((tmp10 - tmp3 + (1 << 17)) >> 18) + 128);
+        out[1] = jpeg_clamp(((tmp11 + tmp2 + (1 << 17)) >> 18) + 128);
+        out[6] = jpeg_clamp(((tmp11 - tmp2 + (1 << 17)) >> 18) + 128);
+        out[2] = jpeg_clamp(((tmp12 + tmp1 + (1 << 17)) >> 18) + 128);
+        out[5] = jpeg_clamp(((tmp12 - tmp1 + (1 << 17)) >> 18) + 128);
+        out[3] = jpeg_clamp(((tmp13 + tmp0 + (1 << 17)) >> 18) + 128);
+        out[4] = jpeg_clamp(((tmp13 - tmp0 + (1 << 17)) >> 18) + 128);
+    }
+}
+
+// Reduced NxN IDCT (N = 4 or 2) of the ncoefs coefficients listed in coefs.
+static void jpeg_idct_reduced(const int16_t *coef, const uint16_t *qt, const int16_t *tab,
+        const uint8_t *coefs, int ncoefs, int n, uint8_t *out, int stride)
+{
+    int32_t ws[32];
+
+    // Columns, the output is in Q2.
+    for (int i=0; i<ncoefs; i++) {
+        int u = coefs[i];
+        int32_t col[8];
+        int32_t nz = 0;
+        for (int j=0; j<ncoefs; j++) {
+            int v = coefs[j];
+            col[v] = coef[(v * 8) + u] * qt[(v * 8) + u];
+            nz |= col[v];
+        }
+        for (int y=0; y<n; y++) {
+            int32_t s = 0;
+            if (nz) {
+                for (int j=0; j<ncoefs; j++) {
+                    int v = coefs[j];
+                    s += tab[(y * 8) + v] * col[v];
+                }
+            }
+            ws[(y * 8) + u] = (s + (1 << 9)) >> 10;
+        }
+    }
+
+    // Rows
+    for (int y=0; y<n; y++, out+=stride) {
+        const int32_t *w = ws + (y * 8);
+        for (int x=0; x<n; x++) {
+            int32_t s = 0;
+            for (int i=0; i<ncoefs; i++) {
+                int u = coefs[i];
+                s += tab[(x * 8) + u] * w[u];
+            }
+            out[x] = jpeg_clamp(((s + (1 << 13)) >> 14) + 128);
+        }
+    }
+}
+
+static void jpeg_idct(struct jpeg_decoder *dec, jpeg_component_t *comp, uint8_t *out)
+{
+    const uint16_t *qt = dec->qt[comp->tq];
+    switch (dec->n) {
+        case 8:
+            jpeg_idct8(dec->coef, qt, out, comp->stride);
+            break;
+        case 4:
+            jpeg_idct_reduced(dec->coef, qt, jpeg_idct4_tab[0], jpeg_idct4_coefs,
+                    sizeof(jpeg_idct4_coefs), 4, out, comp->stride);
+            break;
+        case 2:
+            jpeg_idct_reduced(dec->coef, qt, jpeg_idct2_tab[0], jpeg_idct2_coefs,
+                    sizeof(jpeg_idct2_coefs), 2, out, comp->stride);
+            break;
+        default:
+            out[0] = jpeg_clamp(((dec->coef[0] * qt[0] + 4) >> 3) + 128);
+            break;
+    }
+}
+
+// Skips to the restart marker and resets the decoder.
+static void jpeg_restart(struct jpeg_decoder *dec, FIL *fp)
+{
+    dec->bitb = 0;
+    dec->bitc = 0;
+    while (!dec->marker && dec->bytes_left) {
+        jpeg_get_byte(dec, fp);
+    }
+    if ((dec->marker & 0xF8) == 0xD0) { // RSTn
+        dec->marker = 0;
+    }
+    for (int c=0; c<dec->ncomp; c++) {
+        dec->comp[c].pred = 0;
+    }
+}
+
+static void jpeg_decode_mcu_row(struct jpeg_decoder *dec, FIL *fp)
+{
+    for (int mx=0; mx<dec->mcus_x; mx++) {
+        if (dec->restart) {
+            if (!dec->restart_left) {
+                jpeg_restart(dec, fp);
+                dec->restart_left = dec->restart;
+            }
+            dec->restart_left--;
+        }
+        for (int c=0; c<dec->ncomp; c++) {
+            jpeg_component_t *comp = &dec->comp[c];
+            bool store = (c < dec->nplanes);
+            for (int by=0; by<comp->v; by++) {
+                for (int bx=0; bx<comp->h; bx++) {
+                    jpeg_decode_block(dec, fp, comp, store && (dec->n > 1));
+                    if (store) {
+                        jpeg_idct(dec, comp, comp->plane + (by * dec->n * comp->stride)
+                                + (((mx * comp->h) + bx) * dec->n));
+                    }
+                }
+            }
+        }
+    }
+}
+
+static int jpeg_read_u8(FIL *fp)
+{
+    uint8_t b;
+    read_byte(fp, &b);
+    return b;
+}
+
+static int jpeg_read_u16(FIL *fp)
+{
+    uint16_t w;
+    read_word(fp, &w);
+    return IM_SWAP16(w);
+}
+
+static void jpeg_read_dqt(FIL *fp, struct jpeg_decoder *dec, int len)
+{
+    while (len > 0) {
+        int pq_tq = jpeg_read_u8(fp);
+        if ((pq_tq & 15) > 3) {
+            ff_file_corrupted(fp);
+        }
+        uint16_t *qt = dec->qt[pq_tq & 15];
+        for (int i=0; i<64; i++) {
+            qt[s_jpeg_UnZigZag[i]] = (pq_tq >> 4) ? jpeg_read_u16(fp) : jpeg_read_u8(fp);
+        }
+        len -= (pq_tq >> 4) ? 129 : 65;
+    }
+}
+
+static void jpeg_read_dht(FIL *fp, struct jpeg_decoder *dec, int len)
+{
+    while (len > 0) {
+        uint8_t bits[16], vals[256];
+        int tc_th = jpeg_read_u8(fp), count = 0;
+        read_data(fp, bits, sizeof(bits));
+        for (int i=0; i<16; i++) {
+            count += bits[i];
+        }
+        if (((tc_th & 15) > 1) || ((tc_th >> 4) > 1) || (count > 256)) {
+            ff_file_corrupted(fp);
+        }
+        read_data(fp, vals, count);
+        if (!jpeg_huff_build(&dec->huff[((tc_th >> 4) * 2) + (tc_th & 15)], bits, vals, count)) {
+            ff_file_corrupted(fp);
+        }
+        len -= 17 + count;
+    }
+}
+
+static void jpeg_read_sof(FIL *fp, struct jpeg_decoder *dec)
+{
+    if (jpeg_read_u8(fp) != 8) {
+        ff_unsupported_format(fp);
+    }
+    dec->h = jpeg_read_u16(fp);
+    dec->w = jpeg_read_u16(fp);
+    dec->ncomp = jpeg_read_u8(fp);
+    if (!dec->w || !dec->h || ((dec->ncomp != 1) && (dec->ncomp != 3))) {
+        ff_unsupported_format(fp);
+    }
+    for (int c=0; c<dec->ncomp; c++) {
+        jpeg_component_t *comp = &dec->comp[c];
+        comp->id = jpeg_read_u8(fp);
+        int hv = jpeg_read_u8(fp);
+        comp->h = hv >> 4;
+        comp->v = hv & 15;
+        comp->tq = jpeg_read_u8(fp) & 3;
+        if ((comp->h < 1) || (comp->h > 2) || (comp->v < 1) || (comp->v > 2)) {
+            ff_unsupported_format(fp);
+        }
+    }
+}
+
+static void jpeg_read_sos(FIL *fp, struct jpeg_decoder *dec)
+{
+    if (!dec->ncomp) {
+        ff_file_corrupted(fp);
+    }
+    // Only single scan (interleaved) images are supported.
+    if (jpeg_read_u8(fp) != dec->ncomp) {
+        ff_unsupported_format(fp);
+    }
+    for (int i=0; i<dec->ncomp; i++) {
+        int id = jpeg_read_u8(fp), td_ta = jpeg_read_u8(fp);
+        jpeg_component_t *comp = NULL;
+        for (int c=0; c<dec->ncomp; c++) {
+            if (dec->comp[c].id == id) {
+                comp = &dec->comp[c];
+            }
+        }
+        if (!comp || ((td_ta >> 4) > 1) || ((td_ta & 15) > 1)) {
+            ff_file_corrupted(fp);
+        }
+        comp->td = td_ta >> 4;
+        comp->ta = td_ta & 15;
+    }
+    read_byte_ignore(fp); // Ss
+    read_byte_ignore(fp); // Se
+    read_byte_ignore(fp); // Ah/Al
+}
+
+// Parses the headers up to the scan and allocates the decoder (fb_alloc), the
+// output size and bpp are set from the read settings.
+void jpeg_decode_geometry(FIL *fp, image_t *img, jpeg_read_settings_t *rs)
+{
+    struct jpeg_decoder *dec = fb_alloc0(sizeof(struct jpeg_decoder));
+    rs->dec = dec;
+
+    // Huffman tables default to the standard tables, MJPEG omits them.
+    jpeg_huff_build(&dec->huff[0], std_dc_luminance_nrcodes+1, std_dc_luminance_values, sizeof(std_dc_luminance_values));
+    jpeg_huff_build(&dec->huff[1], std_dc_chrominance_nrcodes+1, std_dc_chrominance_values, sizeof(std_dc_chrominance_values));
+    jpeg_huff_build(&dec->huff[2], std_ac_luminance_nrcodes+1, std_ac_luminance_values, sizeof(std_ac_luminance_values));
+    jpeg_huff_build(&dec->huff[3], std_ac_chrominance_nrcodes+1, std_ac_chrominance_values, sizeof(std_ac_chrominance_values));
+
+    if ((jpeg_read_u8(fp) != 0xFF) || (jpeg_read_u8(fp) != 0xD8)) {
+        ff_unsupported_format(fp);
+    }
+
+    for (bool scan = false; !scan;) {
+        int marker = jpeg_read_u8(fp);
+        if (marker != 0xFF) {
+            ff_file_corrupted(fp);
+        }
+        while (marker == 0xFF) { // Fill bytes
+            marker = jpeg_read_u8(fp);
+        }
+        if ((marker == 0x01) || ((0xD0 <= marker) && (marker <= 0xD8))) {
+            continue;
+        }
+        int len = jpeg_read_u16(fp) - 2;
+        if ((marker == 0xD9) || (len < 0)) {
+            ff_file_corrupted(fp);
+        }
+        UINT end = f_tell(fp) + len;
+        switch (marker) {
+            case 0xC0: // Baseline
+            case 0xC1: // Extended sequential
+                jpeg_read_sof(fp, dec);
+                break;
+            case 0xC4:
+                jpeg_read_dht(fp, dec, len);
+                break;
+            case 0xDB:
+                jpeg_read_dqt(fp, dec, len);
+                break;
+            case 0xDD:
+                dec->restart = jpeg_read_u16(fp);
+                break;
+            case 0xDA:
+                jpeg_read_sos(fp, dec);
+                scan = true;
+                break;
+            default:
+                // Progressive, lossless and arithmetic coding.
+                if ((marker & 0xF0) == 0xC0) {
+                    ff_unsupported_format(fp);
+                }
+                break;
+        }
+        if (f_tell(fp) != end) {
+            file_seek(fp, end);
+        }
+    }
+
+    int hmax = 1, vmax = 1;
+    if (dec->ncomp == 1) { // Not interleaved, an MCU is one block.
+        dec->comp[0].h = dec->comp[0].v = 1;
+    }
+    for (int c=0; c<dec->ncomp; c++) {
+        hmax = IM_MAX(hmax, dec->comp[c].h);
+        vmax = IM_MAX(vmax, dec->comp[c].v);
+    }
+
+    dec->n = 8 / rs->scale;
+    dec->bpp = (rs->bpp == 1 || rs->bpp == 2) ? rs->bpp : ((dec->ncomp == 1) ? 1 : 2);
+    dec->nplanes = (dec->bpp == 1) ? 1 : dec->ncomp;
+    dec->mcus_x = (dec->w + (8 * hmax) - 1) / (8 * hmax);
+    dec->row_lines = vmax * dec->n;
+    dec->row_line = dec->row_lines;
+    dec->restart_left = dec->restart;
+    dec->bytes_left = f_size(fp) - f_tell(fp);
+
+    int size = 0;
+    for (int c=0; c<dec->nplanes; c++) {
+        jpeg_component_t *comp = &dec->comp[c];
+        comp->hs = (comp->h < hmax);
+        comp->vs = (comp->v < vmax);
+        comp->stride = dec->mcus_x * comp->h * dec->n;
+        size += comp->stride * comp->v * dec->n;
+    }
+    uint8_t *planes = fb_alloc(size);
+    for (int c=0; c<dec->nplanes; c++) {
+        dec->comp[c].plane = planes;
+        planes += dec->comp[c].stride * dec->comp[c].v * dec->n;
+    }
+
+    img->w = (dec->w + rs->scale - 1) / rs->scale;
+    img->h = (dec->h + rs->scale - 1) / rs->scale;
+    img->bpp = dec->bpp;
+}
+
+// This function decodes the next lines of the image into line_start to line_end.
+void jpeg_decode_pixels(FIL *fp, image_t *img, int line_start, int line_end, jpeg_read_settings_t *rs)
+{
+    struct jpeg_decoder *dec = rs->dec;
+    jpeg_component_t *y = &dec->comp[0], *cb = &dec->comp[1], *cr = &dec->comp[2];
+
+    for (int i=line_start; i<line_end; i++, dec->row_line++) {
+        if (dec->row_line == dec->row_lines) {
+            jpeg_decode_mcu_row(dec, fp);
+            dec->row_line = 0;
+        }
+
+        const uint8_t *yp = y->plane + ((dec->row_line >> y->vs) * y->stride);
+        if (dec->bpp == 1) {
+            uint8_t *p = img->pixels + (i * img->w);
+            for (int x=0; x<img->w; x++) {
+                p[x] = yp[x >> y->hs];
+            }
+        } else if (dec->ncomp == 1) {
+            uint16_t *p = ((uint16_t *) img->pixels) + (i * img->w);
+            for (int x=0; x<img->w; x++) {
+                p[x] = IM_RGB565(IM_R825(yp[x]), IM_G826(yp[x]), IM_B825(yp[x]));
+            }
+        } else {
+            uint16_t *p = ((uint16_t *) img->pixels) + (i * img->w);
+            const uint8_t *up = cb->plane + ((dec->row_line >> cb->vs) * cb->stride);
+            const uint8_t *vp = cr->plane + ((dec->row_line >> cr->vs) * cr->stride);
+            for (int x=0; x<img->w; x++) {
+                p[x] = imlib_yuv_to_rgb(yp[x >> y->hs], up[x >> cb->hs] - 128, vp[x >> cr->hs] - 128);
+            }
+        }
+    }
+}
+
+// Frees the decoder, after the file buffer.
+void jpeg_decode_free(jpeg_read_settings_t *rs)
+{
+    fb_free(); // planes
+    fb_free(); // decoder
+    rs->dec = NULL;
+}
+
+void jpeg_decode(image_t *img, const char *path, jpeg_read_settings_t *rs)
+{
+    FIL fp;
+    file_read_open(&fp, path);
+    jpeg_decode_geometry(&fp, img, rs);
+    if (!img->pixels) img->pixels = xalloc(img->w * img->h * img->bpp);
+    file_buffer_on(&fp);
+    jpeg_decode_pixels(&fp, img, 0, img->h, rs);
+    file_buffer_off(&fp);
+    jpeg_decode_free(rs);
+    file_close(&fp);
+}
@@ -10,9 +10,13 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <limits.h>
+#include <arm_math.h>
 
 #include "imlib.h"
 #include "xalloc.h"
+#include "fb_alloc.h"
+#include "fmath.h"
 #include "ff.h"
 
 #define min(a,b) \
@@ -27,6 +31,30 @@
 
 #define LBP_HIST_SIZE   (59)    //58 uniform hist + 1
 #define LBP_DESC_SIZE   (4956)
+// Division levels of the descriptor, 1x1, 3x3, 5x5 and 7x7 cells.
+#define LBP_MIN_DIV     (1)
+#define LBP_MAX_DIV     (7)
+// Max cell boundaries along an axis, over all levels (0, the inner ones and the ends).
+#define LBP_GRID_BOUNDS (1+(2+4+6)+4)
+// Gallery file magic, "LBPG".
+#define LBP_GALLERY_MAGIC   (0x4750424C)
+// Size of a gallery record, the record header is followed by the descriptor.
+#define LBP_RECORD_SIZE     (sizeof(lbp_record_t)+LBP_DESC_SIZE)
+
+// A gallery file is a header followed by one record per enrolled descriptor.
+typedef struct {
+    uint32_t magic;
+    uint32_t desc_size;
+    uint32_t n_records;
+} lbp_gallery_header_t;
+
+// The sums of the descriptor are stored for the correlation distance.
+typedef struct {
+    uint16_t id;
+    uint16_t reserved;
+    uint32_t sum;
+    uint32_t sum_sq;
+} lbp_record_t;
 
 //const static float lbp_weights [49]= {
 //    2.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 2.0f,
@@ -88,16 +116,98 @@ void imlib_lbp_desc(image_t *image, int div, uint8_t *desc, rectangle_t *roi)
     }
 }
 
+// Adds v to the sorted cell boundaries, returns the new count.
+static int lbp_grid_add(int *bounds, int n, int v)
+{
+    int i = n;
+    for (; i>0 && bounds[i-1] > v; i--);
+    if (i > 0 && bounds[i-1] == v) {
+        return n;
+    }
+    memmove(bounds+i+1, bounds+i, (n-i)*sizeof(int));
+    bounds[i] = v;
+    return n+1;
+}
+
+// Cell boundaries of all division levels along an axis of the given size,
+// the fine grid cells are the intervals between them.
+static int lbp_grid(int size, int *bounds)
+{
+    int n = lbp_grid_add(bounds, 0, 0);
+    for (int div=LBP_MIN_DIV; div<=LBP_MAX_DIV; div+=2) {
+        int cell = size/div;
+        int end = max(cell*div-3, 0);
+        for (int i=1; i<div; i++) {
+            n = lbp_grid_add(bounds, n, min(i*cell, end));
+        }
+        n = lbp_grid_add(bounds, n, end);
+    }
+    return n;
+}
+
+static int lbp_grid_index(int *bounds, int n, int v)
+{
+    int i = 0;
+    for (; i<n-1 && bounds[i]<v; i++);
+    return i;
+}
+
+// Computes the LBP code of each pixel once, into the histograms of the fine
+// grid cells, then builds the histograms of every division level by merging
+// the fine cells they cover. The counts wrap around like the descriptor's, so
+// the result matches calling imlib_lbp_desc for each level.
 uint8_t *imlib_lbp_cascade(image_t *image, rectangle_t *roi)
 {
     uint8_t *desc = xalloc0(LBP_DESC_SIZE);
 
-    int offset =0;
-    for (int i=1, c=0; i<=7; i+=2, c++) {
-        imlib_lbp_desc(image, i, desc+offset, roi);
-        offset += i*i*LBP_HIST_SIZE;
+    int bx[LBP_GRID_BOUNDS], by[LBP_GRID_BOUNDS];
+    int nx = lbp_grid(roi->w, bx);
+    int ny = lbp_grid(roi->h, by);
+    int cells_x = nx-1;
+    uint8_t *hist = fb_alloc0(cells_x*(ny-1)*LBP_HIST_SIZE);
+
+    int s = image->w; //stride
+    for (int cy=0; cy<ny-1; cy++) {
+        for (int y=roi->y+by[cy]; y<roi->y+by[cy+1]; y++) {
+            uint8_t *r0 = image->data+(y*s)+roi->x;
+            uint8_t *r1 = r0+s, *r2 = r1+s;
+            for (int cx=0; cx<cells_x; cx++) {
+                uint8_t *h = hist+((cy*cells_x+cx)*LBP_HIST_SIZE);
+                for (int x=bx[cx]; x<bx[cx+1]; x++) {
+                    uint8_t p = r1[x+1];
+                    uint8_t lbp = ((r0[x+0] >= p) << 0) | ((r0[x+1] >= p) << 1)
+                                | ((r0[x+2] >= p) << 2) | ((r1[x+2] >= p) << 3)
+                                | ((r2[x+2] >= p) << 4) | ((r2[x+1] >= p) << 5)
+                                | ((r2[x+0] >= p) << 6) | ((r1[x+0] >= p) << 7);
+                    h[uniform_tbl[lbp]]++;
+                }
+            }
+        }
+    }
+
+    uint8_t *d = desc;
+    for (int div=LBP_MIN_DIV; div<=LBP_MAX_DIV; div+=2) {
+        int RX = roi->w/div, end_x = max(RX*div-3, 0);
+        int RY = roi->h/div, end_y = max(RY*div-3, 0);
+        for (int i=0; i<div; i++) {
+            int y0 = lbp_grid_index(by, ny, min(i*RY, end_y));
+            int y1 = lbp_grid_index(by, ny, min((i+1)*RY, end_y));
+            for (int j=0; j<div; j++, d+=LBP_HIST_SIZE) {
+                int x0 = lbp_grid_index(bx, nx, min(j*RX, end_x));
+                int x1 = lbp_grid_index(bx, nx, min((j+1)*RX, end_x));
+                for (int cy=y0; cy<y1; cy++) {
+                    for (int cx=x0; cx<x1; cx++) {
+                        uint8_t *h = hist+((cy*cells_x+cx)*LBP_HIST_SIZE);
+                        for (int k=0; k<LBP_HIST_SIZE; k++) {
+                            d[k] += h[k];
+                        }
+                    }
+                }
+            }
+        }
     }
 
+    fb_free();
     return desc;
 }
 
@@ -173,3 +283,225 @@ int imlib_lbp_desc_load(FIL *fp, uint8_t **desc)
 
     return res;
 }
+
+// Sum of d0[i]*d1[i], two bins per SMLAD on the camera.
+static uint32_t lbp_dot(const uint8_t *d0, const uint8_t *d1)
+{
+    uint32_t sum = 0;
+#if defined(ARM_MATH_CM4)
+    const uint32_t *w0 = (const uint32_t *) d0;
+    const uint32_t *w1 = (const uint32_t *) d1;
+    for (int i=0; i<LBP_DESC_SIZE/4; i++) {
+        uint32_t a = w0[i], b = w1[i];
+        sum = __SMLAD(__UXTB16(a), __UXTB16(b), sum);
+        sum = __SMLAD(__UXTB16(__ROR(a, 8)), __UXTB16(__ROR(b, 8)), sum);
+    }
+#else
+    for (int i=0; i<LBP_DESC_SIZE; i++) {
+        sum += d0[i] * d1[i];
+    }
+#endif
+    return sum;
+}
+
+static uint32_t lbp_sum(const uint8_t *d)
+{
+    uint32_t sum = 0;
+    for (int i=0; i<LBP_DESC_SIZE; i++) {
+        sum += d[i];
+    }
+    return sum;
+}
+
+// Chi-square distance, sum of (a-b)^2/(a+b). Most cell histograms are sparse,
+// so equal words are skipped 4 bins at a time. The distance is checked after
+// each cell histogram (at the last word boundary in it), and returned as soon
+// as it exceeds bound.
+static int lbp_chi_square(const uint8_t *d0, const uint8_t *d1, int bound)
+{
+    const uint32_t *w0 = (const uint32_t *) d0;
+    const uint32_t *w1 = (const uint32_t *) d1;
+    uint32_t dist = 0; // In 1/256ths.
+
+    for (int c=1, i=0; c<=LBP_DESC_SIZE/LBP_HIST_SIZE; c++) {
+        for (int end=(c*LBP_HIST_SIZE)/4; i<end; i++) {
+            if (w0[i] != w1[i]) {
+                for (int j=i*4; j<(i*4+4); j++) {
+                    int d = d0[j] - d1[j];
+                    if (d) {
+                        dist += ((d * d) << 8) / (d0[j] + d1[j]);
+                    }
+                }
+            }
+        }
+        if ((int) (dist >> 8) > bound) {
+            break;
+        }
+    }
+    return dist >> 8;
+}
+
+// Correlation distance, (1 - r) * 1000.
+static int lbp_correlation(const uint8_t *desc, uint32_t sum, uint32_t sum_sq, lbp_record_t *rec)
+{
+    int64_t n = LBP_DESC_SIZE;
+    int64_t num = (n * lbp_dot(desc, (uint8_t *) (rec + 1))) - ((int64_t) sum * rec->sum);
+    int64_t var0 = (n * sum_sq) - ((int64_t) sum * sum);
+    int64_t var1 = (n * rec->sum_sq) - ((int64_t) rec->sum * rec->sum);
+    if (var0 <= 0 || var1 <= 0) {
+        return 1000;
+    }
+    float r = num / (fast_sqrtf(var0) * fast_sqrtf(var1));
+    return (1.0f - r) * 1000.0f;
+}
+
+// The distance a match of this identity has to beat to change the top k.
+static int lbp_match_bound(lbp_match_t *matches, int n, int k, int id)
+{
+    for (int i=0; i<n; i++) {
+        if (matches[i].id == id) {
+            return matches[i].distance;
+        }
+    }
+    return (n == k) ? matches[k-1].distance : INT_MAX;
+}
+
+// Inserts a match into the sorted top k, keeping the best match of each identity.
+static void lbp_match_insert(lbp_match_t *matches, int *n, int k, int id, int distance)
+{
+    int i = 0;
+    for (; i<*n && matches[i].id != id; i++);
+    if (i < *n) {
+        if (matches[i].distance <= distance) {
+            return;
+        }
+        memmove(matches+i, matches+i+1, (*n-i-1)*sizeof(lbp_match_t));
+        (*n)--;
+    } else if (*n == k) {
+        if (matches[k-1].distance <= distance) {
+            return;
+        }
+        (*n)--;
+    }
+
+    for (i=*n; i>0 && matches[i-1].distance > distance; i--) {
+        matches[i] = matches[i-1];
+    }
+    matches[i].id = id;
+    matches[i].distance = distance;
+    (*n)++;
+}
+
+static int lbp_gallery_read_header(FIL *fp, lbp_gallery_header_t *header)
+{
+    UINT bytes;
+    FRESULT res = f_read(fp, header, sizeof(*header), &bytes);
+    if (res == FR_OK && (bytes != sizeof(*header) || header->magic != LBP_GALLERY_MAGIC
+                || header->desc_size != LBP_DESC_SIZE)) {
+        res = FR_INVALID_OBJECT;
+    }
+    return res;
+}
+
+int imlib_lbp_gallery_add(FIL *fp, int id, uint8_t *desc)
+{
+    UINT bytes;
+    FRESULT res = FR_OK;
+    lbp_gallery_header_t header = {LBP_GALLERY_MAGIC, LBP_DESC_SIZE, 0};
+
+    // Append to an existing gallery
+    if (f_size(fp) != 0) {
+        res = lbp_gallery_read_header(fp, &header);
+        if (res != FR_OK) {
+            goto error;
+        }
+    }
+
+    lbp_record_t rec = {
+        .id = id,
+        .sum = lbp_sum(desc),
+        .sum_sq = lbp_dot(desc, desc),
+    };
+
+    // Write the record after the last one
+    res = f_lseek(fp, sizeof(header) + (header.n_records * LBP_RECORD_SIZE));
+    if (res != FR_OK) {
+        goto error;
+    }
+
+    res = f_write(fp, &rec, sizeof(rec), &bytes);
+    if (res != FR_OK || bytes != sizeof(rec)) {
+        goto error;
+    }
+
+    res = f_write(fp, desc, LBP_DESC_SIZE, &bytes);
+    if (res != FR_OK || bytes != LBP_DESC_SIZE) {
+        goto error;
+    }
+
+    // Update the header
+    header.n_records++;
+    res = f_lseek(fp, 0);
+    if (res != FR_OK) {
+        goto error;
+    }
+
+    res = f_write(fp, &header, sizeof(header), &bytes);
+
+error:
+    return res;
+}
+
+// Reads the gallery in blocks of as many records as fit in the frame buffer,
+// and keeps the k best identities.
+int imlib_lbp_gallery_match(FIL *fp, uint8_t *desc, lbp_metric_t metric, lbp_match_t *matches, int *k)
+{
+    UINT bytes;
+    lbp_gallery_header_t header;
+    int n_matches = 0;
+
+    FRESULT res = lbp_gallery_read_header(fp, &header);
+    if (res != FR_OK || header.n_records == 0) {
+        *k = 0;
+        return res;
+    }
+
+    uint32_t sum = lbp_sum(desc);
+    uint32_t sum_sq = lbp_dot(desc, desc);
+
+    uint32_t size;
+    uint8_t *buf = fb_alloc_all(&size);
+    int block = IM_MIN(size / LBP_RECORD_SIZE, header.n_records);
+    if (block == 0) {
+        if (size) {
+            fb_free();
+        }
+        *k = 0;
+        return FR_NOT_ENOUGH_CORE;
+    }
+
+    for (int r=0; r<header.n_records; r+=block) {
+        int n = IM_MIN(block, header.n_records - r);
+        res = f_read(fp, buf, n * LBP_RECORD_SIZE, &bytes);
+        if (res != FR_OK || bytes != n * LBP_RECORD_SIZE) {
+            res = (res != FR_OK) ? res : FR_INVALID_OBJECT;
+            break;
+        }
+
+        for (int i=0; i<n; i++) {
+            lbp_record_t *rec = (lbp_record_t *) (buf + (i * LBP_RECORD_SIZE));
+            int distance;
+            if (metric == LBP_CHI_SQUARE) {
+                int bound = lbp_match_bound(matches, n_matches, *k, rec->id);
+                distance = lbp_chi_square(desc, (uint8_t *) (rec + 1), bound);
+            } else {
+                distance = lbp_correlation(desc, sum, sum_sq, rec);
+            }
+            lbp_match_insert(matches, &n_matches, *k, rec->id, distance);
+        }
+    }
+
+    fb_free();
+    *k = n_matches;
+    return res;
+}
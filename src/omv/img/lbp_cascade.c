@@ -0,0 +1,292 @@
+/*
+ * This file is part of the OpenMV project.
+ * Copyright (c) 2013/2014 Ibrahim Abdelkader <i.abdalkader@gmail.com>
+ * This work is licensed under the MIT license, see the file LICENSE for details.
+ *
+ * LBP cascade object detector.
+ *
+ * Evaluates OpenCV style LBP cascades. Each weak classifier computes a
+ * multi-block LBP code, comparing the sum of the centre block of a 3x3 grid
+ * of blocks against its 8 neighbours, and looks the code up in a 256-bit
+ * subset to pick one of two leaf values. Everything is integer, and unlike
+ * Haar cascades there's no variance normalisation.
+ *
+ */
+#include <ff.h>
+#include <string.h>
+#include "mdefs.h"
+#include "xalloc.h"
+#include "fb_alloc.h"
+#include "imlib.h"
+#include <arm_math.h>
+
+#define DETECT_INIT_SIZE (16)
+// Relative size difference allowed when grouping detections.
+#define DETECT_GROUP_EPS (0.2f)
+// Bytes kept free for fb_alloc bookkeeping.
+#define DETECT_FB_SLACK (64)
+
+// Packed LBP cascade file header, followed by the packed features and stages.
+typedef struct lbp_cascade_header {
+    uint32_t magic;
+    int32_t window_w;
+    int32_t window_h;
+    int32_t n_stages;
+    int32_t n_features;
+    uint32_t size;      // Size of the packed features and stages in bytes.
+} lbp_cascade_header_t;
+
+#define LBP_CASCADE_MAGIC   (0x3143424C) // "LBC1"
+
+// MB-LBP feature scaled to a pyramid level.
+typedef struct lbp_scaled_feature {
+    int32_t off;    // Top-left corner offset from the window in the integral image.
+    int32_t dx;     // Block width.
+    int32_t dy;     // Block height times the integral image stride.
+} lbp_scaled_feature_t;
+
+// Cascade scaled to a pyramid level.
+typedef struct lbp_scale {
+    int win_w, win_h;
+    lbp_scaled_feature_t *features;
+} lbp_scale_t;
+
+// Returns the weak classifiers of a packed stage.
+ALWAYS_INLINE static const lbp_classifier_t *lbp_stage_classifiers(const lbp_stage_t *stage)
+{
+    return (const lbp_classifier_t *) (stage + 1);
+}
+
+// Computes the MB-LBP code of a feature. The integral image sums wrap
+// modulo 2^32, so block sums are computed and compared unsigned.
+ALWAYS_INLINE static int lbp_code(const uint32_t *sum, const lbp_scaled_feature_t *f)
+{
+    const int dx = f->dx;
+    const uint32_t *r0 = sum + f->off;
+    const uint32_t *r1 = r0 + f->dy;
+    const uint32_t *r2 = r1 + f->dy;
+    const uint32_t *r3 = r2 + f->dy;
+
+    // Block corners, row by row.
+    uint32_t p0 = r0[0], p1 = r0[dx], p2 = r0[dx*2], p3 = r0[dx*3];
+    uint32_t p4 = r1[0], p5 = r1[dx], p6 = r1[dx*2], p7 = r1[dx*3];
+    uint32_t p8 = r2[0], p9 = r2[dx], p10 = r2[dx*2], p11 = r2[dx*3];
+    uint32_t p12 = r3[0], p13 = r3[dx], p14 = r3[dx*2], p15 = r3[dx*3];
+
+    uint32_t c = p10 - p9 - p6 + p5;
+
+    // Clockwise from the top-left block, same bit order as OpenCV.
+    return (((p5 - p4 - p1 + p0) >= c) << 7)
+         | (((p6 - p5 - p2 + p1) >= c) << 6)
+         | (((p7 - p6 - p3 + p2) >= c) << 5)
+         | (((p11 - p10 - p7 + p6) >= c) << 4)
+         | (((p15 - p14 - p11 + p10) >= c) << 3)
+         | (((p14 - p13 - p10 + p9) >= c) << 2)
+         | (((p13 - p12 - p9 + p8) >= c) << 1)
+         | (((p9 - p8 - p5 + p4) >= c) << 0);
+}
+
+static int run_lbp_cascade_classifier(lbp_cascade_t *cascade, lbp_scale_t *scale, const uint32_t *sum)
+{
+    const lbp_stage_t *stage = (const lbp_stage_t *) (cascade->data + (cascade->n_features * sizeof(lbp_feature_t)));
+    for (int i=0; i<cascade->n_stages; i++) {
+        int stage_sum = 0;
+        const lbp_classifier_t *c = lbp_stage_classifiers(stage);
+        for (int j=0; j<stage->n_classifiers; j++, c++) {
+            int code = lbp_code(sum, &scale->features[c->feature]);
+            stage_sum += (c->subset[code>>5] & (1 << (code&31))) ? c->alpha1 : c->alpha2;
+        }
+        // If the sum is below the stage threshold, no objects were detected
+        if (stage_sum < stage->threshold) {
+            return -i;
+        }
+        stage = (const lbp_stage_t *) c;
+    }
+    return 1;
+}
+
+// Precomputes the feature blocks scaled by factor, stored as offsets
+// from the window origin in the integral image.
+static void lbp_scale_init(lbp_scale_t *scale, lbp_cascade_t *cascade, float factor, int stride)
+{
+    const lbp_feature_t *f = (const lbp_feature_t *) cascade->data;
+
+    scale->win_w = fast_roundf(cascade->window.w * factor);
+    scale->win_h = fast_roundf(cascade->window.h * factor);
+
+    for (int i=0; i<cascade->n_features; i++, f++) {
+        // Keep the 3x3 blocks inside the scaled window.
+        int sx = fast_roundf(f->x * factor);
+        int sy = fast_roundf(f->y * factor);
+        int sw = IM_MAX(IM_MIN(fast_roundf(f->w * factor), (scale->win_w - sx) / 3), 1);
+        int sh = IM_MAX(IM_MIN(fast_roundf(f->h * factor), (scale->win_h - sy) / 3), 1);
+
+        scale->features[i].off = (sy * stride) + sx;
+        scale->features[i].dx = sw;
+        scale->features[i].dy = sh * stride;
+    }
+}
+
+// Scans windows starting at rows y to y2 (relative to the ROI) of an integral
+// image holding the ROI rows starting at band_y. Returns the next row to scan.
+static int lbp_scan(arena_t *rects, lbp_cascade_t *cascade, lbp_scale_t *scale, i_image_t *sum,
+        rectangle_t *roi, int band_y, int y, int y2, int step)
+{
+    for (; y<=y2; y+=step) {
+        const uint32_t *sum_row = sum->data + ((y - band_y) * sum->w);
+        for (int x=0; (x + scale->win_w) <= roi->w; x+=step) {
+            // If an object is detected, record the coordinates of the filter window
+            if (run_lbp_cascade_classifier(cascade, scale, sum_row + x) > 0) {
+                rectangle_t *r = arena_push_back(rects);
+                r->x = x + roi->x;
+                r->y = y + roi->y;
+                r->w = scale->win_w;
+                r->h = scale->win_h;
+            }
+        }
+    }
+    return y;
+}
+
+void imlib_detect_lbp_objects(arena_t *objects, image_t *image, lbp_cascade_t *cascade, rectangle_t *roi)
+{
+    i_image_t sum;
+    lbp_scale_t scale;
+
+    // Raw detections, grouped into objects at the end.
+    arena_t rects;
+    arena_alloc(&rects, sizeof(rectangle_t), DETECT_INIT_SIZE);
+
+    scale.features = fb_alloc(cascade->n_features * sizeof(lbp_scaled_feature_t));
+
+    // Use an integral image of the whole ROI if it fits in memory, otherwise
+    // compute it in horizontal bands of as many rows as fit.
+    int stride = roi->w + 1;
+    int rows = (IM_MAX((int) fb_avail() - DETECT_FB_SLACK, 0) / (stride * sizeof(uint32_t)));
+    rows = IM_MIN(IM_MAX(rows, cascade->window.h + 2), roi->h + 1);
+    imlib_integral_image_alloc(&sum, stride, rows);
+
+    bool whole = (rows == (roi->h + 1));
+    if (whole) {
+        imlib_integral_image_roi(image, roi, &sum);
+    }
+
+    for (float factor=1.0f; ; factor *= cascade->scale_factor) {
+        lbp_scale_init(&scale, cascade, factor, stride);
+
+        // Break if the scaled window is bigger than the image or a band
+        if (scale.win_w > roi->w || scale.win_h > roi->h || scale.win_h >= rows) {
+            break;
+        }
+
+        // Same step as OpenCV, 2 pixels at small scales and 1 at larger ones.
+        int step = IM_MAX(fast_roundf(((factor > 2.0f) ? 1.0f : 2.0f) * factor), 1);
+        int y2 = roi->h - scale.win_h;
+
+        if (whole) {
+            lbp_scan(&rects, cascade, &scale, &sum, roi, 0, 0, y2, step);
+        } else {
+            for (int y=0; y<=y2;) {
+                // The band starts at the next window row to scan.
+                rectangle_t band = {roi->x, roi->y + y, roi->w, IM_MIN(rows - 1, roi->h - y)};
+                sum.h = band.h + 1;
+                imlib_integral_image_roi(image, &band, &sum);
+                y = lbp_scan(&rects, cascade, &scale, &sum, roi, y, y, IM_MIN(y + band.h - scale.win_h, y2), step);
+            }
+        }
+    }
+
+    imlib_integral_image_free(&sum);
+    fb_free(); // scale.features
+
+    // Group objects detected at neighbouring positions and scales
+    rectangle_merge(&rects, objects, cascade->min_neighbors, DETECT_GROUP_EPS);
+    arena_free(&rects);
+
+    arena_trim(objects);
+}
+
+// Counts the weak classifiers and checks the packed stages fit in size bytes
+// and only reference existing features.
+static int lbp_cascade_init(lbp_cascade_t *cascade, const uint8_t *data, uint32_t size)
+{
+    const uint8_t *end = data + size;
+    const lbp_stage_t *stage = (const lbp_stage_t *) (data + (cascade->n_features * sizeof(lbp_feature_t)));
+
+    cascade->data = data;
+    cascade->n_classifiers = 0;
+
+    for (int i=0; i<cascade->n_stages; i++) {
+        if ((const uint8_t *) (stage + 1) > end) {
+            return FR_INVALID_OBJECT;
+        }
+        const lbp_classifier_t *c = lbp_stage_classifiers(stage);
+        if ((const uint8_t *) (c + stage->n_classifiers) > end) {
+            return FR_INVALID_OBJECT;
+        }
+        for (int j=0; j<stage->n_classifiers; j++, c++) {
+            if (c->feature >= cascade->n_features) {
+                return FR_INVALID_OBJECT;
+            }
+        }
+        cascade->n_classifiers += stage->n_classifiers;
+        stage = (const lbp_stage_t *) c;
+    }
+
+    return FR_OK;
+}
+
+// Loads a packed LBP cascade (see openmv-cascade.py) with one allocation and one read.
+int imlib_load_lbp_cascade(lbp_cascade_t *cascade, const char *path)
+{
+    FIL fp;
+    UINT n_out;
+    FRESULT res;
+    lbp_cascade_header_t header;
+
+    res = f_open(&fp, path, FA_READ|FA_OPEN_EXISTING);
+    if (res != FR_OK) {
+        return res;
+    }
+
+    uint32_t size = f_size(&fp);
+    if (size < sizeof(header)) {
+        f_close(&fp);
+        return FR_INVALID_OBJECT;
+    }
+
+    uint8_t *data = xalloc(size);
+
+    res = f_read(&fp, data, size, &n_out);
+    f_close(&fp);
+
+    if (res == FR_OK && n_out != size) {
+        res = FR_DISK_ERR;
+    }
+
+    if (res == FR_OK) {
+        memcpy(&header, data, sizeof(header));
+        if (header.magic != LBP_CASCADE_MAGIC || header.n_features < 0 ||
+            header.size > (size - sizeof(header)) ||
+            (header.n_features * sizeof(lbp_feature_t)) > header.size) {
+            res = FR_INVALID_OBJECT;
+        }
+    }
+
+    if (res == FR_OK) {
+        // Move the data to the start of the buffer, the GC
+        // only keeps blocks referenced by their first byte.
+        memmove(data, data + sizeof(header), header.size);
+        cascade->window.w = header.window_w;
+        cascade->window.h = header.window_h;
+        cascade->n_stages = header.n_stages;
+        cascade->n_features = header.n_features;
+        res = lbp_cascade_init(cascade, data, header.size);
+    }
+
+    if (res != FR_OK) {
+        xfree(data);
+    }
+
+    return res;
+}
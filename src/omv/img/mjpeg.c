@@ -99,18 +99,19 @@ void mjpeg_add_frame(FIL *fp, uint32_t *frames, uint32_t *bytes, image_t *img, i
         write_data(fp, img->pixels, img->bpp + pad); // reading past okay
         *bytes += img->bpp + pad;
     } else {
-        uint32_t size;
-        uint8_t *buffer = fb_alloc_all(&size);
-        image_t out = { .w=img->w, .h=img->h, .bpp=size, .pixels=buffer };
-        // When jpeg_compress needs more memory than in currently allocated it
-        // will try to realloc. MP will detect that the pointer is outside of
-        // the heap and return NULL which will cause an out of memory error.
-        jpeg_compress(img, &out, quality);
-        int pad = (((out.bpp + 3) / 4) * 4) - out.bpp;
-        write_long(fp, out.bpp + pad); // DWORD cb;
-        write_data(fp, out.pixels, out.bpp + pad); // reading past okay
-        *bytes += out.bpp + pad;
+        // Stream the frame to the file and patch the chunk size afterwards.
+        uint32_t cb_offset = f_tell(fp);
+        write_long(fp, 0); // DWORD cb; updated below
+        jpeg_sink_t sink;
+        jpeg_sink_file(&sink, fp, fb_alloc(JPEG_SINK_CHUNK), JPEG_SINK_CHUNK);
+        uint32_t size = jpeg_encode(img, &sink, quality);
         fb_free();
+        int pad = (((size + 3) / 4) * 4) - size;
+        write_data(fp, (uint8_t [4]){0}, pad);
+        file_seek(fp, cb_offset);
+        write_long(fp, size + pad);
+        file_seek(fp, cb_offset + 4 + size + pad);
+        *bytes += size + pad;
     }
 }
 
@@ -0,0 +1,420 @@
+/*
+ * This file is part of the OpenMV project.
+ * Copyright (c) 2013/2014 Ibrahim Abdelkader <i.abdalkader@gmail.com>
+ * This work is licensed under the MIT license, see the file LICENSE for details.
+ *
+ * ORB keypoints: oriented FAST and rotated BRIEF.
+ *
+ * FAST-9 corners are found on each level of a Gaussian pyramid and the best
+ * ones by Harris response are kept, the number kept per level shrinks by
+ * the scale factor from one level to the next. The orientation is the
+ * direction of the intensity centroid of a circular patch, quantised to
+ * ORB_ANGLES, and selects a pre-rotated copy of the 256 BRIEF tests (see
+ * gen_orb_pattern.py). Each test compares two 5x5 box sums, looked up in a
+ * moving window integral image. Everything is integer math, and the
+ * keypoints are written back to back in an arena.
+ *
+ */
+#include <string.h>
+#include "imlib.h"
+#include "xalloc.h"
+#include "fb_alloc.h"
+
+#define ORB_DESC_BITS       (256)
+#define ORB_PATCH_RADIUS    (15)
+// FAST border, the patch and the descriptor boxes must be inside the image.
+#define ORB_EDGE            (ORB_PATCH_RADIUS+1)
+// Rows kept before and after the keypoint in the moving window.
+#define ORB_MW_LINES        (ORB_EDGE+1)
+#define ORB_BOX_SIZE        (5)
+#define ORB_CELL_SIZE       (32)    // FAST corners grid cell size
+#define ORB_CANDIDATES      (4)     // FAST corners per keypoint
+#define ORB_BLUR_RADIUS     (4)     // Max radius of the pyramid's Gaussian
+#define MAX_KP_DIST         (ORB_DESC_BITS)
+
+// Pre-rotated tests (x1, y1, x2, y2), the orientation unit vectors (Q14)
+// and the half widths of the circular patch rows (see gen_orb_pattern.py).
+extern const int8_t orb_pattern[ORB_ANGLES][ORB_DESC_BITS][4];
+extern const int16_t orb_angles[ORB_ANGLES][2];
+extern const uint8_t orb_umax[ORB_PATCH_RADIUS+1];
+
+// Harris corner response over a 7x7 window of Sobel gradients,
+// scaled by 25 so k=0.04 stays an integer: 25*det - trace^2.
+static int64_t harris_response(image_t *img, int x, int y)
+{
+    int w = img->w;
+    int a=0, b=0, c=0;
+    const uint8_t *row = img->pixels + (y-3)*w + (x-3);
+
+    for (int j=0; j<7; j++, row+=w) {
+        for (int i=0; i<7; i++) {
+            const uint8_t *p = row + i;
+            int dx = (p[-w+1] + 2*p[1] + p[w+1]) - (p[-w-1] + 2*p[-1] + p[w-1]);
+            int dy = (p[w-1] + 2*p[w] + p[w+1]) - (p[-w-1] + 2*p[-w] + p[-w+1]);
+            a += dx*dx;
+            b += dy*dy;
+            c += dx*dy;
+        }
+    }
+
+    return 25*((int64_t)a*b - (int64_t)c*c) - (int64_t)(a+b)*(a+b);
+}
+
+// Orientation of the intensity centroid, returns the closest angle index.
+static int centroid_angle(image_t *img, int x, int y)
+{
+    int w = img->w;
+    int m01=0, m10=0;
+    const uint8_t *center = img->pixels + y*w + x;
+
+    // The center row, then the rows above and below it in pairs.
+    for (int u=-ORB_PATCH_RADIUS; u<=ORB_PATCH_RADIUS; u++) {
+        m10 += u * center[u];
+    }
+
+    for (int v=1; v<=ORB_PATCH_RADIUS; v++) {
+        int v_sum = 0;
+        int d = orb_umax[v];
+        for (int u=-d; u<=d; u++) {
+            int val_plus = center[u + v*w];
+            int val_minus = center[u - v*w];
+            v_sum += (val_plus - val_minus);
+            m10 += u * (val_plus + val_minus);
+        }
+        m01 += v * v_sum;
+    }
+
+    // The closest angle has the largest projection of the centroid vector.
+    int angle = 0;
+    int64_t max_dot = INT64_MIN;
+    for (int i=0; i<ORB_ANGLES; i++) {
+        int64_t dot = (int64_t)m10*orb_angles[i][0] + (int64_t)m01*orb_angles[i][1];
+        if (dot > max_dot) {
+            max_dot = dot;
+            angle = i;
+        }
+    }
+    return angle;
+}
+
+static void brief_descriptor(mw_image_t *i_image, int kp_x, int kp_y, int angle, uint8_t *desc)
+{
+    const int8_t (*pattern)[4] = orb_pattern[angle];
+    // keypoint y in the moving window, and the top-left corners of
+    // the boxes are offset by one (see imlib_integral_mw_lookup).
+    int x = kp_x - (ORB_BOX_SIZE/2) - 1;
+    int y = kp_y - (i_image->y_offs - i_image->h) - (ORB_BOX_SIZE/2) - 1;
+
+    memset(desc, 0, ORB_DESC_BITS/8);
+    for (int i=0; i<ORB_DESC_BITS; i++) {
+        long s1 = imlib_integral_mw_lookup(i_image, x + pattern[i][0], y + pattern[i][1], ORB_BOX_SIZE, ORB_BOX_SIZE);
+        long s2 = imlib_integral_mw_lookup(i_image, x + pattern[i][2], y + pattern[i][3], ORB_BOX_SIZE, ORB_BOX_SIZE);
+        desc[i/8] |= (s1 < s2) << (i%8);
+    }
+}
+
+// Min-heap of corner indices ordered by score.
+static void heap_sift_down(int64_t *scores, uint16_t *heap, int n, int i)
+{
+    for (int c; (c = (i*2)+1) < n; i=c) {
+        if ((c+1) < n && scores[heap[c+1]] < scores[heap[c]]) {
+            c++;
+        }
+        if (scores[heap[i]] <= scores[heap[c]]) {
+            break;
+        }
+        uint16_t t = heap[i]; heap[i] = heap[c]; heap[c] = t;
+    }
+}
+
+// Marks the n_best corners with the largest scores.
+static void select_best(int64_t *scores, int n_scores, uint8_t *keep, int n_best)
+{
+    if (n_scores <= n_best) {
+        memset(keep, 1, n_scores);
+        return;
+    }
+
+    uint16_t *heap = fb_alloc(n_best * sizeof(uint16_t));
+    for (int i=0; i<n_best; i++) {
+        heap[i] = i;
+    }
+    for (int i=(n_best/2)-1; i>=0; i--) {
+        heap_sift_down(scores, heap, n_best, i);
+    }
+    // Replace the smallest kept score with any larger one.
+    for (int i=n_best; i<n_scores; i++) {
+        if (scores[i] > scores[heap[0]]) {
+            heap[0] = i;
+            heap_sift_down(scores, heap, n_best, 0);
+        }
+    }
+
+    memset(keep, 0, n_scores);
+    for (int i=0; i<n_best; i++) {
+        keep[heap[i]] = 1;
+    }
+    fb_free();
+}
+
+// Finds up to max_kpts keypoints in the roi of a pyramid level. The
+// keypoints are scaled by ratio (Q16) and offset back to the image.
+static void find_level_keypoints(arena_t *kpts, image_t *img, rectangle_t *roi,
+        int level, int max_kpts, int threshold, int ratio, int x_offs, int y_offs)
+{
+    if (max_kpts == 0) {
+        return;
+    }
+
+    // Keep a few times more corners than keypoints, spread over the grid, for the Harris ranking.
+    int n_cells = ((roi->w - (ORB_EDGE*2) + ORB_CELL_SIZE - 1) / ORB_CELL_SIZE)
+                * ((roi->h - (ORB_EDGE*2) + ORB_CELL_SIZE - 1) / ORB_CELL_SIZE);
+    int cell_max = ((max_kpts * ORB_CANDIDATES) + n_cells - 1) / IM_MAX(n_cells, 1);
+
+    arena_t corners;
+    fast_find_corners(img, &corners, threshold, ORB_EDGE, ORB_CELL_SIZE, cell_max, roi);
+
+    int n_corners = IM_MIN(arena_length(&corners), UINT16_MAX);
+    if (n_corners == 0) {
+        arena_free(&corners);
+        return;
+    }
+
+    int64_t *scores = fb_alloc(n_corners * sizeof(int64_t));
+    uint8_t *keep = fb_alloc(n_corners);
+
+    for (int i=0; i<n_corners; i++) {
+        corner_t *p = arena_at(&corners, i);
+        scores[i] = harris_response(img, p->x, p->y);
+    }
+    select_best(scores, n_corners, keep, max_kpts);
+
+    mw_image_t i_image;
+    imlib_integral_mw_alloc(&i_image, img->w, ORB_MW_LINES*2);
+    imlib_integral_mw(img, &i_image);
+
+    // The corners are in raster order, so the window only moves down.
+    for (int i=0; i<n_corners; i++) {
+        if (!keep[i]) {
+            continue;
+        }
+
+        corner_t *p = arena_at(&corners, i);
+        while (i_image.y_offs < (p->y+ORB_MW_LINES)) {
+            // Shift image if needed.
+            int shift = (p->y+ORB_MW_LINES) - i_image.y_offs;
+            shift = IM_MIN(i_image.h-1, shift);
+            imlib_integral_mw_shift(img, &i_image, shift);
+        }
+
+        orb_kp_t *kp = arena_push_back(kpts);
+        kp->x = x_offs + ((p->x * ratio + (ratio/2)) >> 16);
+        kp->y = y_offs + ((p->y * ratio + (ratio/2)) >> 16);
+        kp->angle = centroid_angle(img, p->x, p->y);
+        kp->level = level;
+        kp->match = -1;
+        brief_descriptor(&i_image, p->x, p->y, kp->angle, kp->desc);
+    }
+
+    imlib_integral_mw_free(&i_image);
+    fb_free(); // keep
+    fb_free(); // scores
+    arena_free(&corners);
+}
+
+// Gaussian downscaling of the roi. The roi is low-pass filtered with a Gaussian
+// of sigma 0.6*sqrt(s^2-1) for the scale s before it's decimated, so the
+// levels don't alias. The filter is separable: each source row is filtered
+// once at the sampled columns into a ring of rows, which is then filtered
+// vertically at the sampled rows.
+static void downscale(image_t *src, rectangle_t *roi, image_t *dst, int ratio)
+{
+    float scale = ratio / 65536.0f;
+    float sigma = 0.6f * fast_sqrtf(IM_MAX((scale * scale) - 1.0f, 0.01f));
+    int radius = IM_MIN(IM_MAX(fast_ceilf(2.0f * sigma), 1), ORB_BLUR_RADIUS);
+    int taps = (radius * 2) + 1;
+
+    // Kernel weights in Q8, the center weight makes them sum to 256.
+    int kernel[(ORB_BLUR_RADIUS * 2) + 1];
+    float weights[(ORB_BLUR_RADIUS * 2) + 1], total = 0.0f;
+    for (int k=0; k<taps; k++) {
+        weights[k] = fast_expf(-((k - radius) * (k - radius)) / (2.0f * sigma * sigma));
+        total += weights[k];
+    }
+    int sum = 0;
+    for (int k=0; k<taps; k++) {
+        kernel[k] = fast_roundf((weights[k] * 256.0f) / total);
+        sum += kernel[k];
+    }
+    kernel[radius] += 256 - sum;
+
+    // Horizontally filtered source rows in Q8, and the source row in each slot.
+    uint16_t *ring = fb_alloc(taps * dst->w * sizeof(uint16_t));
+    int ring_rows[(ORB_BLUR_RADIUS * 2) + 1];
+    for (int k=0; k<taps; k++) {
+        ring_rows[k] = -1;
+    }
+
+    uint8_t *pixels = dst->pixels;
+    for (int y=0; y<dst->h; y++) {
+        int cy = ((y * ratio) + (ratio / 2)) >> 16;
+        uint16_t *rows[(ORB_BLUR_RADIUS * 2) + 1];
+
+        // The rows of the window are consecutive, so they never share a slot.
+        for (int k=0; k<taps; k++) {
+            int sy = IM_MIN(IM_MAX(cy + k - radius, 0), roi->h - 1);
+            int slot = sy % taps;
+            rows[k] = ring + (slot * dst->w);
+            if (ring_rows[slot] != sy) {
+                ring_rows[slot] = sy;
+                const uint8_t *src_row = src->pixels + ((roi->y + sy) * src->w) + roi->x;
+                for (int x=0; x<dst->w; x++) {
+                    int cx = ((x * ratio) + (ratio / 2)) >> 16;
+                    int acc = 0;
+                    for (int j=0; j<taps; j++) {
+                        acc += kernel[j] * src_row[IM_MIN(IM_MAX(cx + j - radius, 0), roi->w - 1)];
+                    }
+                    rows[k][x] = acc;
+                }
+            }
+        }
+
+        for (int x=0; x<dst->w; x++) {
+            int acc = 0;
+            for (int k=0; k<taps; k++) {
+                acc += kernel[k] * rows[k][x];
+            }
+            *pixels++ = (acc + (1 << 15)) >> 16;
+        }
+    }
+
+    fb_free(); // ring
+}
+
+void orb_find_keypoints(arena_t *kpts, image_t *image, int max_kpts, float scale_factor, int levels, int threshold, rectangle_t *roi)
+{
+    arena_alloc(kpts, sizeof(orb_kp_t), IM_MAX(max_kpts, 1));
+
+    // Keypoints per level, geometric in the level scale.
+    float factor = 1.0f / scale_factor, factor_n = 1.0f;
+    for (int i=0; i<levels; i++) {
+        factor_n *= factor;
+    }
+    float n_level = max_kpts * (1.0f - factor) / (1.0f - factor_n);
+
+    float scale = 1.0f;
+    for (int level=0, n_kpts=0; level<levels; level++, scale*=scale_factor) {
+        int level_kpts = (level == (levels-1)) ? (max_kpts - n_kpts) : IM_MIN((int) (n_level + 0.5f), max_kpts - n_kpts);
+        n_level *= factor;
+
+        if (level == 0) {
+            // The first level is the image itself.
+            find_level_keypoints(kpts, image, roi, 0, level_kpts, threshold, 1<<16, 0, 0);
+        } else {
+            int ratio = (int) (scale * 65536.0f);
+            image_t img = {
+                .w = (roi->w << 16) / ratio,
+                .h = (roi->h << 16) / ratio,
+                .bpp = 1,
+            };
+
+            // Stop when the level is smaller than the moving window.
+            if (img.w < (ORB_MW_LINES*2) || img.h < (ORB_MW_LINES*2)) {
+                break;
+            }
+
+            img.pixels = fb_alloc(img.w * img.h);
+            downscale(image, roi, &img, ratio);
+            rectangle_t level_roi = {0, 0, img.w, img.h};
+            find_level_keypoints(kpts, &img, &level_roi, level, level_kpts, threshold, ratio, roi->x, roi->y);
+            fb_free();
+        }
+
+        n_kpts = arena_length(kpts);
+    }
+}
+
+// Number of set bits in a 32-bit word.
+static inline int popcount(uint32_t v)
+{
+    v = v - ((v >> 1) & 0x55555555);
+    v = (v & 0x33333333) + ((v >> 2) & 0x33333333);
+    return (((v + (v >> 4)) & 0x0F0F0F0F) * 0x01010101) >> 24;
+}
+
+static int hamming_distance(const uint8_t *d1, const uint8_t *d2)
+{
+    int dist = 0;
+    for (int i=0; i<(ORB_DESC_BITS/8); i+=4) {
+        uint32_t v1, v2;
+        memcpy(&v1, d1+i, 4);
+        memcpy(&v2, d2+i, 4);
+        dist += popcount(v1 ^ v2);
+    }
+    return dist;
+}
+
+// Matches each keypoint with its nearest neighbour in the other set, a pair
+// is accepted when both keypoints are each other's nearest neighbour and the
+// descriptors are at least threshold percent similar.
+int orb_match_keypoints(arena_t *kpts1, arena_t *kpts2, int threshold)
+{
+    int matches = 0;
+    int n_kpts1 = arena_length(kpts1);
+    int n_kpts2 = arena_length(kpts2);
+
+    for (int i=0; i<n_kpts1; i++) {
+        ((orb_kp_t *) arena_at(kpts1, i))->match = -1;
+    }
+    for (int i=0; i<n_kpts2; i++) {
+        ((orb_kp_t *) arena_at(kpts2, i))->match = -1;
+    }
+
+    if (n_kpts1 == 0 || n_kpts2 == 0) {
+        return 0;
+    }
+
+    // The closest keypoint of the first set to each keypoint of the second set.
+    uint16_t *best2 = fb_alloc(n_kpts2 * sizeof(uint16_t));
+    uint16_t *dist2 = fb_alloc(n_kpts2 * sizeof(uint16_t));
+    for (int j=0; j<n_kpts2; j++) {
+        dist2[j] = MAX_KP_DIST+1;
+    }
+
+    for (int i=0; i<n_kpts1; i++) {
+        orb_kp_t *kp1 = arena_at(kpts1, i);
+        int min_dist = MAX_KP_DIST+1;
+        int best1 = 0;
+        for (int j=0; j<n_kpts2; j++) {
+            int dist = hamming_distance(kp1->desc, ((orb_kp_t *) arena_at(kpts2, j))->desc);
+            if (dist < min_dist) {
+                min_dist = dist;
+                best1 = j;
+            }
+            if (dist < dist2[j]) {
+                dist2[j] = dist;
+                best2[j] = i;
+            }
+        }
+        // Keep the nearest neighbour, it's checked once the second set is done.
+        kp1->match = (((MAX_KP_DIST - min_dist) * 100) / MAX_KP_DIST) >= threshold ? best1 : -1;
+    }
+
+    for (int i=0; i<n_kpts1; i++) {
+        orb_kp_t *kp1 = arena_at(kpts1, i);
+        if (kp1->match == -1) {
+            continue;
+        }
+        orb_kp_t *kp2 = arena_at(kpts2, kp1->match);
+        if (best2[kp1->match] != i) {
+            kp1->match = -1;
+            continue;
+        }
+        kp2->match = i;
+        matches++;
+    }
+
+    fb_free(); // dist2
+    fb_free(); // best2
+    return matches;
+}
@@ -0,0 +1,259 @@
+/*
+ * This file is part of the OpenMV project.
+ * Copyright (c) 2013/2014 Ibrahim Abdelkader <i.abdalkader@gmail.com>
+ * This work is licensed under the MIT license, see the file LICENSE for details.
+ *
+ * Phase correlation.
+ *
+ * Estimates the translation between two images. The ROI of each image is
+ * downsampled to PC_SIZE x PC_SIZE, the mean is removed and a Hann window
+ * is applied, then both are transformed with a Q15 2D FFT. The inverse FFT
+ * of the normalized cross power spectrum has a peak at the translation,
+ * which is interpolated to sub-pixel accuracy.
+ *
+ * The images are real, so two rows are transformed at once as the real and
+ * imaginary parts of one complex FFT, and only the PC_BINS non-redundant
+ * columns of the spectrum are kept and transformed. The FFTs scale their
+ * output by 1/PC_SIZE, so the row spectrum is renormalized (block floating
+ * point) before the column FFTs to keep its precision.
+ *
+ * The FFT uses the CMSIS radix-4 Q15 CFFT on the camera and a portable
+ * radix-2 Q15 FFT with the same scaling elsewhere.
+ *
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <arm_math.h>
+#include "imlib.h"
+#include "fmath.h"
+#include "fb_alloc.h"
+
+#define PC_SIZE         (64)
+#define PC_BINS         ((PC_SIZE/2)+1)
+// Magnitude of the normalized cross power spectrum (Q15).
+#define PC_AMPLITUDE    (16384)
+
+// cos(2*pi*n/PC_SIZE) in Q15.
+static const int16_t pc_cos[PC_SIZE] = {
+     32767,  32610,  32138,  31357,  30274,  28899,  27246,  25330,
+     23170,  20788,  18205,  15447,  12540,   9512,   6393,   3212,
+         0,  -3212,  -6393,  -9512, -12540, -15447, -18205, -20788,
+    -23170, -25330, -27246, -28899, -30274, -31357, -32138, -32610,
+    -32768, -32610, -32138, -31357, -30274, -28899, -27246, -25330,
+    -23170, -20788, -18205, -15447, -12540,  -9512,  -6393,  -3212,
+         0,   3212,   6393,   9512,  12540,  15447,  18205,  20788,
+     23170,  25330,  27246,  28899,  30274,  31357,  32138,  32610,
+};
+
+// In place complex FFT of PC_SIZE interleaved Q15 values, scaled by 1/PC_SIZE.
+#if defined(ARM_MATH_CM4)
+static void fft(int16_t *buf, bool inverse)
+{
+    arm_cfft_radix4_instance_q15 S;
+    arm_cfft_radix4_init_q15(&S, PC_SIZE, inverse, 1);
+    arm_cfft_radix4_q15(&S, (q15_t *) buf);
+}
+#else
+static void fft(int16_t *buf, bool inverse)
+{
+    // Bit reversal
+    for (int i=1, j=0; i<PC_SIZE; i++) {
+        int bit = PC_SIZE >> 1;
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j) {
+            int16_t re = buf[i*2], im = buf[i*2+1];
+            buf[i*2] = buf[j*2]; buf[i*2+1] = buf[j*2+1];
+            buf[j*2] = re; buf[j*2+1] = im;
+        }
+    }
+
+    // Radix-2 butterflies, each stage is scaled by 1/2.
+    for (int len=2; len<=PC_SIZE; len<<=1) {
+        int half = len >> 1, step = PC_SIZE / len;
+        for (int i=0; i<PC_SIZE; i+=len) {
+            for (int j=0; j<half; j++) {
+                int k = j * step;
+                // sin(x) = cos(x - pi/2)
+                int wr = pc_cos[k], wi = pc_cos[(k + (PC_SIZE*3/4)) % PC_SIZE];
+                if (!inverse) {
+                    wi = -wi;
+                }
+                int16_t *a = buf + ((i + j) * 2), *b = buf + ((i + j + half) * 2);
+                int tr = ((wr * b[0]) - (wi * b[1])) >> 15;
+                int ti = ((wr * b[1]) + (wi * b[0])) >> 15;
+                b[0] = (a[0] - tr) >> 1; b[1] = (a[1] - ti) >> 1;
+                a[0] = (a[0] + tr) >> 1; a[1] = (a[1] + ti) >> 1;
+            }
+        }
+    }
+}
+#endif
+
+// Transforms the columns of the spectrum.
+static void fft_columns(int16_t *spec, int16_t *line, bool inverse)
+{
+    for (int k=0; k<PC_BINS; k++) {
+        for (int y=0; y<PC_SIZE; y++) {
+            line[y*2+0] = spec[(y*PC_BINS+k)*2+0];
+            line[y*2+1] = spec[(y*PC_BINS+k)*2+1];
+        }
+        fft(line, inverse);
+        for (int y=0; y<PC_SIZE; y++) {
+            spec[(y*PC_BINS+k)*2+0] = line[y*2+0];
+            spec[(y*PC_BINS+k)*2+1] = line[y*2+1];
+        }
+    }
+}
+
+// Downsamples, windows and transforms the roi of the image into spec.
+static void load_spectrum(image_t *img, rectangle_t *roi, int16_t *spec, int16_t *line)
+{
+    uint8_t *pixels = fb_alloc(PC_SIZE * PC_SIZE);
+    uint32_t sum = 0;
+
+    // Box downsampling
+    for (int y=0; y<PC_SIZE; y++) {
+        int y0 = roi->y + ((y * roi->h) / PC_SIZE);
+        int y1 = IM_MAX(roi->y + (((y + 1) * roi->h) / PC_SIZE), y0 + 1);
+        for (int x=0; x<PC_SIZE; x++) {
+            int x0 = roi->x + ((x * roi->w) / PC_SIZE);
+            int x1 = IM_MAX(roi->x + (((x + 1) * roi->w) / PC_SIZE), x0 + 1);
+            uint32_t s = 0;
+            for (int i=y0; i<y1; i++) {
+                for (int j=x0; j<x1; j++) {
+                    s += img->data[i*img->w+j];
+                }
+            }
+            pixels[y*PC_SIZE+x] = s / ((y1 - y0) * (x1 - x0));
+            sum += pixels[y*PC_SIZE+x];
+        }
+    }
+
+    int mean = sum / (PC_SIZE * PC_SIZE);
+    int max = 0;
+
+    // Transform two rows at a time: z = a + ib, then A[k] = (Z[k] + conj(Z[-k]))/2
+    // and B[k] = (Z[k] - conj(Z[-k]))/2i.
+    for (int y=0; y<PC_SIZE; y+=2) {
+        // Hann window, (1 - cos)/2 in Q15
+        int wy0 = (32768 - pc_cos[y]) >> 1;
+        int wy1 = (32768 - pc_cos[y+1]) >> 1;
+        for (int x=0; x<PC_SIZE; x++) {
+            int wx = (32768 - pc_cos[x]) >> 1;
+            int a = ((pixels[y*PC_SIZE+x] - mean) * 64 * wx) >> 15;
+            int b = ((pixels[(y+1)*PC_SIZE+x] - mean) * 64 * wx) >> 15;
+            line[x*2+0] = (a * wy0) >> 15;
+            line[x*2+1] = (b * wy1) >> 15;
+        }
+
+        fft(line, false);
+
+        int16_t *a = spec + (y * PC_BINS * 2);
+        int16_t *b = a + (PC_BINS * 2);
+        for (int k=0; k<PC_BINS; k++) {
+            int16_t *z = line + (k * 2), *zn = line + (((PC_SIZE - k) % PC_SIZE) * 2);
+            a[k*2+0] = (z[0] + zn[0]) >> 1;
+            a[k*2+1] = (z[1] - zn[1]) >> 1;
+            b[k*2+0] = (z[1] + zn[1]) >> 1;
+            b[k*2+1] = (zn[0] - z[0]) >> 1;
+        }
+    }
+
+    fb_free(); // pixels
+
+    // Renormalize the row spectrum to use the full range.
+    for (int i=0; i<(PC_SIZE * PC_BINS * 2); i++) {
+        max = IM_MAX(max, abs(spec[i]));
+    }
+    int shift = 0;
+    while (max && (max << (shift + 1)) < 32768) {
+        shift++;
+    }
+    for (int i=0; i<(PC_SIZE * PC_BINS * 2); i++) {
+        spec[i] = spec[i] * (1 << shift);
+    }
+
+    fft_columns(spec, line, false);
+}
+
+// Parabolic interpolation of a peak at c between l and r.
+static float peak_offset(int l, int c, int r)
+{
+    int den = l - (2 * c) + r;
+    return (den < 0) ? (0.5f * (l - r) / den) : 0.0f;
+}
+
+void imlib_phase_correlate(image_t *img0, image_t *img1, rectangle_t *roi,
+        float *x_translation, float *y_translation, float *response)
+{
+    int16_t *spec0 = fb_alloc(PC_SIZE * PC_BINS * 2 * sizeof(int16_t));
+    int16_t *spec1 = fb_alloc(PC_SIZE * PC_BINS * 2 * sizeof(int16_t));
+    int16_t *line = fb_alloc(PC_SIZE * 2 * sizeof(int16_t));
+
+    load_spectrum(img0, roi, spec0, line);
+    load_spectrum(img1, roi, spec1, line);
+
+    // Normalized cross power spectrum, F1 * conj(F0) / |F1 * conj(F0)|.
+    for (int i=0; i<(PC_SIZE * PC_BINS); i++) {
+        float re = ((float) spec1[i*2+0] * spec0[i*2+0]) + ((float) spec1[i*2+1] * spec0[i*2+1]);
+        float im = ((float) spec1[i*2+1] * spec0[i*2+0]) - ((float) spec1[i*2+0] * spec0[i*2+1]);
+        float mag = fast_sqrtf((re * re) + (im * im));
+        if (mag > 0.0f && i != 0) {
+            spec0[i*2+0] = (re * PC_AMPLITUDE) / mag;
+            spec0[i*2+1] = (im * PC_AMPLITUDE) / mag;
+        } else {
+            spec0[i*2+0] = 0;
+            spec0[i*2+1] = 0;
+        }
+    }
+
+    fft_columns(spec0, line, true);
+
+    // Inverse row FFTs, two real rows at a time: z = A + iB. The spectrum of
+    // each row is completed with X[-k] = conj(X[k]), and halved to fit.
+    int16_t *surface = spec1; // spec1 isn't needed anymore, and is large enough.
+    for (int y=0; y<PC_SIZE; y+=2) {
+        int16_t *a = spec0 + (y * PC_BINS * 2);
+        int16_t *b = a + (PC_BINS * 2);
+        for (int k=0; k<PC_SIZE; k++) {
+            int ka = (k < PC_BINS) ? k : (PC_SIZE - k);
+            int sign = (k < PC_BINS) ? 1 : -1;
+            int ar = a[ka*2+0], ai = sign * a[ka*2+1];
+            int br = b[ka*2+0], bi = sign * b[ka*2+1];
+            line[k*2+0] = (ar - bi) >> 1;
+            line[k*2+1] = (ai + br) >> 1;
+        }
+        fft(line, true);
+        for (int x=0; x<PC_SIZE; x++) {
+            surface[y*PC_SIZE+x] = line[x*2+0];
+            surface[(y+1)*PC_SIZE+x] = line[x*2+1];
+        }
+    }
+
+    // Find the peak, the surface wraps around.
+    int px = 0, py = 0;
+    for (int i=0; i<(PC_SIZE * PC_SIZE); i++) {
+        if (surface[i] > surface[py*PC_SIZE+px]) {
+            px = i % PC_SIZE;
+            py = i / PC_SIZE;
+        }
+    }
+
+    #define SURFACE(x, y) surface[(((y) + PC_SIZE) % PC_SIZE) * PC_SIZE + (((x) + PC_SIZE) % PC_SIZE)]
+    int peak = SURFACE(px, py);
+    float sx = peak_offset(SURFACE(px-1, py), peak, SURFACE(px+1, py));
+    float sy = peak_offset(SURFACE(px, py-1), peak, SURFACE(px, py+1));
+    #undef SURFACE
+
+    // A pure translation gives a peak of PC_AMPLITUDE/2 (halved above).
+    *response = IM_MIN(IM_MAX(peak / (PC_AMPLITUDE / 2.0f), 0.0f), 1.0f);
+    *x_translation = (((px < (PC_SIZE/2)) ? px : (px - PC_SIZE)) + sx) * roi->w / PC_SIZE;
+    *y_translation = (((py < (PC_SIZE/2)) ? py : (py - PC_SIZE)) + sy) * roi->h / PC_SIZE;
+
+    fb_free(); // line
+    fb_free(); // spec1
+    fb_free(); // spec0
+}
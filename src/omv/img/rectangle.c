@@ -6,9 +6,11 @@
  * Rectangle functions.
  *
  */
+#include <stdlib.h>
 #include "imlib.h"
-#include "array.h"
+#include "arena.h"
 #include "xalloc.h"
+#include "fb_alloc.h"
 
 rectangle_t *rectangle_alloc(int16_t x, int16_t y, int16_t w, int16_t h)
 {
@@ -55,51 +57,161 @@ bool rectangle_subimg(image_t *img, rectangle_t *r, rectangle_t *r_out)
     return result;
 }
 
-// This isn't for actually combining the rects standardly, but, to instead
-// find the average rectangle between a bunch of overlapping rectangles.
-static void rectangle_add(rectangle_t *r1, rectangle_t *r2)
+// Rectangles are similar if all their edges are within eps times the
+// average size of the smaller rectangle (same as OpenCV's SimilarRects).
+static bool rectangle_similar(rectangle_t *r1, rectangle_t *r2, float eps)
 {
-    r1->x += r2->x;
-    r1->y += r2->y;
-    r1->w += r2->w;
-    r1->h += r2->h;
+    float delta = eps * (IM_MIN(r1->w, r2->w) + IM_MIN(r1->h, r2->h)) * 0.5f;
+    return (abs(r1->x - r2->x) <= delta) &&
+           (abs(r1->y - r2->y) <= delta) &&
+           (abs((r1->x + r1->w) - (r2->x + r2->w)) <= delta) &&
+           (abs((r1->y + r1->h) - (r2->y + r2->h)) <= delta);
 }
 
-// This isn't for actually combining the rects standardly, but, to instead
-// find the average rectangle between a bunch of overlapping rectangles.
-static void rectangle_div(rectangle_t *r, int c)
+// In place heap sort of rectangles by x (no recursion, no extra memory).
+static void rectangle_sift_down(rectangle_t *rects, int root, int n)
 {
-    r->x /= c;
-    r->y /= c;
-    r->w /= c;
-    r->h /= c;
+    for (int child; (child = (root * 2) + 1) < n; root = child) {
+        if (((child + 1) < n) && (rects[child].x < rects[child + 1].x)) {
+            child += 1;
+        }
+        if (rects[root].x >= rects[child].x) {
+            break;
+        }
+        rectangle_t tmp = rects[root];
+        rects[root] = rects[child];
+        rects[child] = tmp;
+    }
+}
+
+static void rectangle_sort_x(rectangle_t *rects, int n)
+{
+    for (int i = (n / 2) - 1; i >= 0; i--) {
+        rectangle_sift_down(rects, i, n);
+    }
+    for (int i = n - 1; i > 0; i--) {
+        rectangle_t tmp = rects[0];
+        rects[0] = rects[i];
+        rects[i] = tmp;
+        rectangle_sift_down(rects, 0, i);
+    }
 }
 
-array_t *rectangle_merge(array_t *rectangles)
+// Union-find with path halving.
+static int uf_find(int *parent, int i)
 {
-    array_t *objects; array_alloc(&objects, xfree);
-    array_t *overlap; array_alloc(&overlap, xfree);
-    /* merge overlaping detections */
-    while (array_length(rectangles)) {
-        /* check for overlaping detections */
-        rectangle_t *rect = (rectangle_t *) array_take(rectangles, 0);
-        for (int j=0; j<array_length(rectangles); j++) { // do not cache bound
-            if (rectangle_intersects(rect, (rectangle_t *) array_at(rectangles, j))) {
-                array_push_back(overlap, array_take(rectangles, j--));
+    while (parent[i] != i) {
+        parent[i] = parent[parent[i]];
+        i = parent[i];
+    }
+    return i;
+}
+
+typedef struct rectangle_acc {
+    int x, y, w, h;
+    int n;
+} rectangle_acc_t;
+
+// Groups similar rectangles and averages each group, in the same way as
+// OpenCV's groupRectangles(). Rectangles are sorted by x and only compared
+// with neighbours whose x is close enough to possibly be similar, then joined
+// with union-find, so this runs in O(n log n) for typical detections instead
+// of O(n^2). Groups with min_neighbors or fewer rectangles are dropped, as are
+// small groups that lie inside a stronger group. The number of rectangles in
+// each group is returned in the detection's neighbors field.
+//
+// Note: The rectangles array is reordered.
+void rectangle_merge(arena_t *rectangles, arena_t *detections, int min_neighbors, float eps)
+{
+    rectangle_t *rects = (rectangle_t *) rectangles->data;
+    int n = arena_length(rectangles);
+
+    arena_alloc(detections, sizeof(detection_t), n);
+    if (n == 0) {
+        return;
+    }
+
+    int *parent = fb_alloc(n * sizeof(int));
+    rectangle_acc_t *acc = fb_alloc0(n * sizeof(rectangle_acc_t));
+
+    /* partition similar rectangles */
+    rectangle_sort_x(rects, n);
+    for (int i=0; i<n; i++) {
+        parent[i] = i;
+    }
+    for (int i=0; i<n; i++) {
+        // delta <= eps * (w + h) / 2 of either rectangle, past that x is too far.
+        int x_max = rects[i].x + (int) (eps * (rects[i].w + rects[i].h) * 0.5f);
+        for (int j=i+1; (j<n) && (rects[j].x <= x_max); j++) {
+            if (rectangle_similar(&rects[i], &rects[j], eps)) {
+                int ri = uf_find(parent, i);
+                int rj = uf_find(parent, j);
+                if (ri != rj) {
+                    parent[IM_MAX(ri, rj)] = IM_MIN(ri, rj);
+                }
             }
         }
-        /* add the overlaping detections */
-        int count = array_length(overlap);
-        for (int i=0; i<count; i++) {
-            rectangle_t *overlap_rect = (rectangle_t *) array_pop_back(overlap);
-            rectangle_add(rect, overlap_rect);
-            xfree(overlap_rect);
+    }
+
+    /* accumulate each group at its root */
+    int n_groups = 0;
+    for (int i=0; i<n; i++) {
+        int root = uf_find(parent, i);
+        if (acc[root].n == 0) {
+            n_groups += 1;
+        }
+        acc[root].x += rects[i].x;
+        acc[root].y += rects[i].y;
+        acc[root].w += rects[i].w;
+        acc[root].h += rects[i].h;
+        acc[root].n += 1;
+    }
+
+    /* average the groups, compact them to the front of acc */
+    for (int i=0, k=0; i<n; i++) {
+        if (acc[i].n) {
+            int c = acc[i].n;
+            acc[k].x = ((acc[i].x * 2) + c) / (c * 2); // rounded
+            acc[k].y = ((acc[i].y * 2) + c) / (c * 2);
+            acc[k].w = ((acc[i].w * 2) + c) / (c * 2);
+            acc[k].h = ((acc[i].h * 2) + c) / (c * 2);
+            acc[k].n = c;
+            k += 1;
         }
-        /* average the overlaping detections */
-        rectangle_div(rect, count + 1);
-        array_push_back(objects, rect);
     }
-    array_free(rectangles);
-    array_free(overlap);
-    return objects;
+
+    /* filter weak groups and groups inside stronger ones */
+    for (int i=0; i<n_groups; i++) {
+        rectangle_acc_t *r1 = &acc[i];
+        if (r1->n <= min_neighbors) {
+            continue;
+        }
+        int j;
+        for (j=0; j<n_groups; j++) {
+            rectangle_acc_t *r2 = &acc[j];
+            if ((j == i) || (r2->n <= min_neighbors)) {
+                continue;
+            }
+            int dx = (int) (r2->w * eps);
+            int dy = (int) (r2->h * eps);
+            if ((r1->x >= (r2->x - dx)) &&
+                (r1->y >= (r2->y - dy)) &&
+                ((r1->x + r1->w) <= (r2->x + r2->w + dx)) &&
+                ((r1->y + r1->h) <= (r2->y + r2->h + dy)) &&
+                ((r2->n > IM_MAX(3, r1->n)) || (r1->n < 3))) {
+                break;
+            }
+        }
+        if (j == n_groups) {
+            detection_t *d = arena_push_back(detections);
+            d->rect.x = r1->x;
+            d->rect.y = r1->y;
+            d->rect.w = r1->w;
+            d->rect.h = r1->h;
+            d->neighbors = r1->n;
+        }
+    }
+
+    fb_free(); // acc
+    fb_free(); // parent
 }
@@ -5,58 +5,395 @@
  *
  * Template matching with NCC (Normalized Cross Correlation).
  *
+ * The image and the templates are downscaled by 2 (2x2 box average) up to
+ * TEMPLATE_LEVELS-1 times and every position is scored on the coarsest
+ * level of each template. The best TEMPLATE_CANDIDATES positions are then
+ * refined level by level, searching REFINE_RADIUS pixels around each one,
+ * and the final scores are computed on the full resolution image. Several
+ * templates share the image pyramid and the coarse integral images. On the
+ * coarse level, a window is rejected as soon as a bound of its correlation
+ * shows it can't be a candidate, and each template stops refining once its
+ * candidates fall below the threshold.
+ *
+ * The window sums and squared sums come from integral images, so the
+ * denominator is O(1) per position. On the coarse level the integral images
+ * are computed for bands of TEMPLATE_BAND rows of positions, and around the
+ * candidate on the finer levels, to keep them small. The sums are computed
+ * with integers and combined in 64 bits:
+ *
+ *   NCC = (N*Sft - Sf*St) / sqrt((N*Sff - Sf*Sf) * (N*Stt - St*St))
+ *
+ * which is exact as long as the template has less than 2^32/255^2 pixels.
+ *
  */
-#include "xalloc.h"
+#include <stdlib.h>
+#include <string.h>
 #include "imlib.h"
-#include <arm_math.h>
-float imlib_template_match(struct image *f,  struct image *t, struct rectangle *r)
+#include "fmath.h"
+#include "fb_alloc.h"
+
+#define TEMPLATE_LEVELS     (3)
+#define TEMPLATE_CANDIDATES (16)
+#define TEMPLATE_BAND       (16)
+// Minimum template width/height on the coarse level.
+#define TEMPLATE_MIN_SIZE   (8)
+#define REFINE_RADIUS       (2)
+// Candidates with a lower score than the threshold minus the margin are
+// dropped, downscaled images correlate better than the full resolution ones.
+#define TEMPLATE_MARGIN     (0.1f)
+// Rows after which the bound of a partial correlation is checked, in quarters.
+#define TEMPLATE_SPLITS     (3)
+
+typedef struct {
+    int x, y;
+    float corr;
+} candidate_t;
+
+typedef struct {
+    int n;          // Number of pixels.
+    int64_t sum;    // Sum of the pixels.
+    int64_t den;    // N*Stt - St*St
+} template_stats_t;
+
+// The template rows below a split, see match_bounded().
+typedef struct {
+    int row;        // First row.
+    int n;          // Number of pixels.
+    float mean;     // Mean of the pixels.
+    float var;      // Sum of the squared deviations of the pixels.
+} template_split_t;
+
+typedef struct {
+    image_t levels[TEMPLATE_LEVELS];    // Template pyramid.
+    int n_levels;                       // Coarsest level, -1 if the template doesn't fit.
+    template_stats_t stats;             // Statistics of the coarsest level.
+    template_split_t splits[TEMPLATE_SPLITS];
+    int n_candidates;
+    candidate_t candidates[TEMPLATE_CANDIDATES];
+} template_state_t;
+
+static void template_stats(image_t *t, template_stats_t *stats)
+{
+    uint32_t s=0, sq=0;
+    for (int i=0; i<(t->w*t->h); i++) {
+        s += t->data[i];
+        sq += t->data[i] * t->data[i];
+    }
+    stats->n = t->w*t->h;
+    stats->sum = s;
+    stats->den = ((int64_t) stats->n * sq) - ((int64_t) s * s);
+}
+
+// Downscales the rectangle r of src by 2 into dst, each pixel is the mean of 2x2 pixels.
+static void downscale(image_t *src, rectangle_t *r, image_t *dst)
+{
+    for (int y=0; y<dst->h; y++) {
+        uint8_t *row0 = src->data + ((r->y + y*2) * src->w) + r->x;
+        uint8_t *row1 = row0 + src->w;
+        uint8_t *dst_row = dst->data + (y * dst->w);
+        for (int x=0; x<dst->w; x++) {
+            dst_row[x] = (row0[x*2] + row0[x*2+1] + row1[x*2] + row1[x*2+1] + 2) >> 2;
+        }
+    }
+}
+
+static void template_splits(image_t *t, template_split_t *splits)
+{
+    for (int i=0; i<TEMPLATE_SPLITS; i++) {
+        image_t rest = {t->w, t->h - (t->h * (i+1) / (TEMPLATE_SPLITS+1)), 1, {NULL}};
+        rest.data = t->data + ((t->h - rest.h) * t->w);
+        template_stats_t stats;
+        template_stats(&rest, &stats);
+        splits[i].row = t->h - rest.h;
+        splits[i].n = stats.n;
+        splits[i].mean = (float) stats.sum / stats.n;
+        splits[i].var = (float) stats.den / stats.n;
+    }
+}
+
+// Sum of the products of rows [y0, y1) of the template and the window at (u, v).
+static uint32_t correlate_rows(image_t *f, image_t *t, int u, int v, int y0, int y1)
 {
-    int den_b=0;
-    float corr =0.0;
+    uint32_t s = 0;
+    for (int y=y0; y<y1; y++) {
+        uint8_t *f_row = f->data + ((v + y) * f->w) + u;
+        uint8_t *t_row = t->data + (y * t->w);
+        for (int x=0; x<t->w; x++) {
+            s += f_row[x] * t_row[x];
+        }
+    }
+    return s;
+}
 
-    struct integral_image sum;
-    struct integral_image *f_imgs=&sum;
+static inline uint32_t correlate(image_t *f, image_t *t, int u, int v)
+{
+    return correlate_rows(f, t, u, v, 0, t->h);
+}
 
-    /* get integeral image */
-    imlib_integral_image_alloc(f_imgs, f->w, f->h);
-    imlib_integral_image(f, f_imgs);
+static float ncc(template_stats_t *t, uint32_t sf, uint32_t sff, uint32_t sft)
+{
+    int64_t den_f = ((int64_t) t->n * sff) - ((int64_t) sf * sf);
+    if (den_f <= 0 || t->den <= 0) {
+        // Flat window or template
+        return 0.0f;
+    }
+    int64_t num = ((int64_t) t->n * sft) - ((int64_t) sf * t->sum);
+    return num / (fast_sqrtf(den_f) * fast_sqrtf(t->den));
+}
 
-    /* get normalized template sum of squares */
-    int t_mean = imlib_image_mean(t);
-    for (int i=0; i < (t->w*t->h); i++) {
-        int c = (int)t->data[i]-t_mean;
-        den_b += c*c;
+// Scores the window at (u, v), which is at (x, y) in the integral images,
+// or returns -1 as soon as its score can't reach min_corr. After each split
+// the correlation of the remaining rows is bounded with Cauchy-Schwarz:
+//
+//   Sft_rest <= Sf_rest*mean_t + sqrt(var_f * var_t)
+//
+// where the window statistics of the remaining rows come from the integral
+// images, so most windows are rejected after a fraction of the products.
+static float match_bounded(template_state_t *ts, image_t *f, image_t *t, i_image_t *sum, i_image_t *ssq,
+        int u, int v, int x, int y, float min_corr)
+{
+    template_stats_t *stats = &ts->stats;
+    uint32_t sf  = imlib_integral_lookup(sum, x, y, t->w, t->h);
+    uint32_t sff = imlib_integral_lookup(ssq, x, y, t->w, t->h);
+    int64_t den_f = ((int64_t) stats->n * sff) - ((int64_t) sf * sf);
+    if (den_f <= 0 || stats->den <= 0) {
+        return 0.0f;
     }
 
-    for (int v=0; v < f->h - t->h; v+=3) {
-    for (int u=0; u < f->w - t->w; u+=3) {
-        int num = 0;
-        int den_a=0;
-        uint32_t f_sum  =imlib_integral_lookup(f_imgs, u, v, t->w, t->h);
-        int f_mean = f_sum / (t->w*t->h);
+    // The numerator needed to reach min_corr.
+    float min_num = min_corr * fast_sqrtf(den_f) * fast_sqrtf(stats->den);
+    uint32_t sft = 0;
+    for (int i=0, row=0; i<TEMPLATE_SPLITS; row=ts->splits[i++].row) {
+        template_split_t *split = &ts->splits[i];
+        sft += correlate_rows(f, t, u, v, row, split->row);
+
+        uint32_t sf_rest  = imlib_integral_lookup(sum, x, y + split->row, t->w, t->h - split->row);
+        uint32_t sff_rest = imlib_integral_lookup(ssq, x, y + split->row, t->w, t->h - split->row);
+        float var_f = sff_rest - ((float) sf_rest * sf_rest / split->n);
+        float bound = (sf_rest * split->mean) + fast_sqrtf(IM_MAX(var_f, 0.0f) * split->var);
+        float num = (((int64_t) stats->n * sft) - ((int64_t) sf * stats->sum)) + (stats->n * bound);
+        // Some slack for the rounding of the bound
+        if ((num + fast_fabsf(num) * 1e-4f) < min_num) {
+            return -1.0f;
+        }
+    }
 
-        for (int y=v; y<t->h+v; y++) {
-            for (int x=u; x<t->w+u; x++) {
-                int a = (int)f->data[y*f->w+x]-f_mean;
-                int b = (int)t->data[(y-v)*t->w+(x-u)]-t_mean;
-                num += a*b;
-                den_a += a*a;
+    sft += correlate_rows(f, t, u, v, ts->splits[TEMPLATE_SPLITS-1].row, t->h);
+    return ncc(stats, sf, sff, sft);
+}
+
+// Keeps the best candidates, a candidate next to a better one is dropped.
+static void add_candidate(candidate_t *candidates, int *n, int x, int y, float corr)
+{
+    int i = 0;
+    for (; i<*n; i++) {
+        if (abs(candidates[i].x - x) <= 1 && abs(candidates[i].y - y) <= 1) {
+            if (candidates[i].corr >= corr) {
+                return;
             }
+            break;
         }
+    }
 
-        /* this overflows */
-        float c = num/(fast_sqrtf(den_a) *fast_sqrtf(den_b));
+    if (i == *n) {
+        if (*n < TEMPLATE_CANDIDATES) {
+            (*n)++;
+        } else if (candidates[*n-1].corr >= corr) {
+            return;
+        } else {
+            i = *n - 1;
+        }
+    }
 
-        if (c > corr) {
-            corr = c;
-            r->x = u;
-            r->y = v;
-            r->w = t->w;
-            r->h = t->h;
+    // Insert in order of decreasing correlation
+    for (; i>0 && candidates[i-1].corr < corr; i--) {
+        candidates[i] = candidates[i-1];
+    }
+    candidates[i] = (candidate_t) {x, y, corr};
+}
+
+// Scores every position of the templates with n_levels == level in the
+// rectangle r of f. The integral images of each band are shared by all of
+// them and sized for the tallest one. Scores below the threshold margin
+// aren't needed, nor scores below the worst candidate of a full list.
+static void match_all(image_t *f, rectangle_t *r, template_state_t *templates, int n_templates,
+        int level, float threshold)
+{
+    int t_min_h = r->h + 1, t_max_h = 0;
+    for (int i=0; i<n_templates; i++) {
+        if (templates[i].n_levels == level) {
+            t_min_h = IM_MIN(t_min_h, templates[i].levels[level].h);
+            t_max_h = IM_MAX(t_max_h, templates[i].levels[level].h);
         }
     }
+
+    if (t_max_h == 0) {
+        return;
     }
 
-    imlib_integral_image_free(f_imgs);
-    return corr;
+    i_image_t sum, ssq;
+    imlib_integral_image_alloc(&sum, r->w+1, TEMPLATE_BAND+t_max_h);
+    imlib_integral_image_alloc(&ssq, r->w+1, TEMPLATE_BAND+t_max_h);
+
+    for (int v0=r->y; v0<=(r->y + r->h - t_min_h); v0+=TEMPLATE_BAND) {
+        rectangle_t band = {r->x, v0, r->w, IM_MIN(TEMPLATE_BAND+t_max_h-1, r->y + r->h - v0)};
+        sum.h = ssq.h = band.h+1;
+        imlib_integral_image_ss(f, &band, &sum, &ssq);
+
+        for (int i=0; i<n_templates; i++) {
+            template_state_t *ts = &templates[i];
+            image_t *t = &ts->levels[level];
+            if (ts->n_levels != level) {
+                continue;
+            }
+
+            int u_end = r->x + r->w - t->w;
+            int v_end = IM_MIN(v0 + TEMPLATE_BAND - 1, r->y + r->h - t->h);
+            for (int v=v0; v<=v_end; v++) {
+                for (int u=r->x; u<=u_end; u++) {
+                    // Windows that can't be a candidate are rejected early.
+                    float min_corr = threshold - TEMPLATE_MARGIN;
+                    if (ts->n_candidates == TEMPLATE_CANDIDATES) {
+                        min_corr = IM_MAX(min_corr, ts->candidates[TEMPLATE_CANDIDATES-1].corr);
+                    }
+                    float c = match_bounded(ts, f, t, &sum, &ssq, u, v, u-r->x, v-v0, min_corr);
+                    if (c >= min_corr) {
+                        add_candidate(ts->candidates, &ts->n_candidates, u, v, c);
+                    }
+                }
+            }
+        }
+    }
+
+    imlib_integral_image_free(&ssq);
+    imlib_integral_image_free(&sum);
+}
+
+// Scores the positions of t around (c->x, c->y) that are inside the
+// rectangle r of f and moves c to the best one.
+static void refine(image_t *f, image_t *t, rectangle_t *r, candidate_t *c)
+{
+    template_stats_t stats;
+    template_stats(t, &stats);
+
+    int u0 = IM_MAX(c->x - REFINE_RADIUS, r->x);
+    int v0 = IM_MAX(c->y - REFINE_RADIUS, r->y);
+    int u1 = IM_MIN(c->x + REFINE_RADIUS, r->x + r->w - t->w);
+    int v1 = IM_MIN(c->y + REFINE_RADIUS, r->y + r->h - t->h);
+
+    rectangle_t area = {u0, v0, u1-u0+t->w, v1-v0+t->h};
+    i_image_t sum, ssq;
+    imlib_integral_image_alloc(&sum, area.w+1, area.h+1);
+    imlib_integral_image_alloc(&ssq, area.w+1, area.h+1);
+    imlib_integral_image_ss(f, &area, &sum, &ssq);
+
+    c->corr = -1.0f;
+    for (int v=v0; v<=v1; v++) {
+        for (int u=u0; u<=u1; u++) {
+            uint32_t sf  = imlib_integral_lookup(&sum, u-u0, v-v0, t->w, t->h);
+            uint32_t sff = imlib_integral_lookup(&ssq, u-u0, v-v0, t->w, t->h);
+            float corr = ncc(&stats, sf, sff, correlate(f, t, u, v));
+            if (corr > c->corr) {
+                *c = (candidate_t) {u, v, corr};
+            }
+        }
+    }
+
+    imlib_integral_image_free(&ssq);
+    imlib_integral_image_free(&sum);
+}
+
+void imlib_template_match(image_t *f, image_t **templates, int n_templates, float threshold,
+        rectangle_t *roi, rectangle_t *r, float *corr)
+{
+    int levels = 0, allocs = 0;
+    template_state_t *states = fb_alloc(n_templates * sizeof(template_state_t));
+
+    for (int i=0; i<n_templates; i++) {
+        template_state_t *ts = &states[i];
+        image_t *t = templates[i];
+        ts->levels[0] = *t;
+        ts->n_candidates = 0;
+        ts->n_levels = -1;
+
+        if (t->w <= roi->w && t->h <= roi->h) {
+            // Number of downscaled levels, the template must keep some detail.
+            ts->n_levels = 0;
+            while ((ts->n_levels+1) < TEMPLATE_LEVELS
+                    && (t->w >> (ts->n_levels+1)) >= TEMPLATE_MIN_SIZE
+                    && (t->h >> (ts->n_levels+1)) >= TEMPLATE_MIN_SIZE) {
+                ts->n_levels++;
+            }
+            levels = IM_MAX(levels, ts->n_levels);
+        }
+    }
+
+    // Pyramid of the search area, level 0 is the image. It's shared by all
+    // templates, each one is scored on its own coarsest level.
+    image_t f_levels[TEMPLATE_LEVELS];
+    rectangle_t rects[TEMPLATE_LEVELS];
+    f_levels[0] = *f;
+    rects[0] = *roi;
+    for (int l=1; l<=levels; l++) {
+        f_levels[l] = (image_t) {rects[l-1].w / 2, rects[l-1].h / 2, 1, {NULL}};
+        f_levels[l].data = fb_alloc(f_levels[l].w * f_levels[l].h);
+        downscale(&f_levels[l-1], &rects[l-1], &f_levels[l]);
+        rects[l] = (rectangle_t) {0, 0, f_levels[l].w, f_levels[l].h};
+    }
+
+    // Template pyramids
+    for (int i=0; i<n_templates; i++) {
+        template_state_t *ts = &states[i];
+        for (int l=1; l<=ts->n_levels; l++, allocs++) {
+            image_t *t = &ts->levels[l-1];
+            rectangle_t t_rect = {0, 0, t->w, t->h};
+            ts->levels[l] = (image_t) {t->w / 2, t->h / 2, 1, {NULL}};
+            ts->levels[l].data = fb_alloc(ts->levels[l].w * ts->levels[l].h);
+            downscale(t, &t_rect, &ts->levels[l]);
+        }
+        if (ts->n_levels >= 0) {
+            template_stats(&ts->levels[ts->n_levels], &ts->stats);
+            template_splits(&ts->levels[ts->n_levels], ts->splits);
+        }
+    }
+
+    for (int l=0; l<=levels; l++) {
+        match_all(&f_levels[l], &rects[l], states, n_templates, l, threshold);
+    }
+
+    for (int i=0; i<n_templates; i++) {
+        template_state_t *ts = &states[i];
+        candidate_t best = {roi->x, roi->y, 0.0f};
+
+        for (int c_i=0; c_i<ts->n_candidates; c_i++) {
+            candidate_t c = ts->candidates[c_i];
+            // The candidates are sorted, the rest can't reach the threshold.
+            if (c.corr < (threshold - TEMPLATE_MARGIN)) {
+                break;
+            }
+            for (int l=ts->n_levels-1; l>=0; l--) {
+                // Level l+1 is relative to the rectangle of level l.
+                c.x = rects[l].x + (c.x * 2);
+                c.y = rects[l].y + (c.y * 2);
+                refine(&f_levels[l], &ts->levels[l], &rects[l], &c);
+                if (c.corr < (threshold - TEMPLATE_MARGIN)) {
+                    break;
+                }
+            }
+            if (c.corr > best.corr) {
+                best = c;
+            }
+        }
+
+        r[i] = (rectangle_t) {best.x, best.y, templates[i]->w, templates[i]->h};
+        corr[i] = best.corr;
+    }
+
+    for (int i=0; i<allocs; i++) {
+        fb_free(); // template levels
+    }
+    for (int l=levels; l>0; l--) {
+        fb_free(); // f_levels[l]
+    }
+    fb_free(); // states
 }
@@ -8,7 +8,9 @@
  */
 #include <arm_math.h>
 #include <mp.h>
+#include "runtime0.h"
 #include "imlib.h"
+#include "fmath.h"
 #include "array.h"
 #include "sensor.h"
 #include "ff.h"
@@ -21,6 +23,7 @@
 
 static const mp_obj_type_t py_cascade_type;
 static const mp_obj_type_t py_image_type;
+static const mp_obj_type_t py_arena_type;
 
 extern const char *ffs_strerror(FRESULT res);
 
@@ -51,19 +54,62 @@ static const mp_obj_type_t py_cascade_type = {
     .print = py_cascade_print,
 };
 
+// LBP Cascade ////////////////////////////////////////////////////////////////
+
+typedef struct _py_lbp_cascade_obj_t {
+    mp_obj_base_t base;
+    struct lbp_cascade _cobj;
+} py_lbp_cascade_obj_t;
+
+static void py_lbp_cascade_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind)
+{
+    py_lbp_cascade_obj_t *self = self_in;
+    mp_printf(print, "width:%d height:%d n_stages:%d n_classifiers:%d n_features:%d\n",
+            self->_cobj.window.w, self->_cobj.window.h, self->_cobj.n_stages,
+            self->_cobj.n_classifiers, self->_cobj.n_features);
+}
+
+static const mp_obj_type_t py_lbp_cascade_type = {
+    { &mp_type_type },
+    .name  = MP_QSTR_LBPCascade,
+    .print = py_lbp_cascade_print,
+};
+
+// Haar Detector //////////////////////////////////////////////////////////////
+
+typedef struct _py_detector_obj_t {
+    mp_obj_base_t base;
+    mp_obj_t cascade;
+    struct detector _cobj;
+} py_detector_obj_t;
+
+static void py_detector_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind)
+{
+    py_detector_obj_t *self = self_in;
+    mp_printf(print, "interval:%d tracked:%d\n",
+            self->_cobj.interval, arena_length(&self->_cobj.objects));
+}
+
+static const mp_obj_type_t py_detector_type = {
+    { &mp_type_type },
+    .name  = MP_QSTR_Detector,
+    .print = py_detector_print,
+};
+
 // Keypoints object ///////////////////////////////////////////////////////////
 
 typedef struct _py_kp_obj_t {
     mp_obj_base_t base;
-    array_t *kpts;
+    kp_set_t kpts;
     int threshold;
     bool normalized;
+    freak_index_t index;    // Built on the first match against these keypoints.
 } py_kp_obj_t;
 
 static void py_kp_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind)
 {
     py_kp_obj_t *self = self_in;
-    mp_printf(print, "size:%d threshold:%d normalized:%d\n", array_length(self->kpts), self->threshold, self->normalized);
+    mp_printf(print, "size:%d threshold:%d normalized:%d\n", self->kpts.n_kpts, self->threshold, self->normalized);
 }
 
 static const mp_obj_type_t py_kp_type = {
@@ -90,6 +136,211 @@ static const mp_obj_type_t py_lbp_type = {
     .print = py_lbp_print,
 };
 
+// Results arena //////////////////////////////////////////////////////////////
+// Blob/detection results are kept in the arena they were written to. Element
+// tuples are only built on access so a busy frame costs one heap block instead
+// of a tuple (and its ints) per result. The raw records are exposed through
+// the buffer protocol for code that wants to avoid tuples altogether.
+
+typedef mp_obj_t (*py_arena_elem_fun_t)(void *elem);
+
+typedef struct _py_arena_obj_t {
+    mp_obj_base_t base;
+    arena_t arena;
+    char typecode;
+    py_arena_elem_fun_t elem_fun;
+} py_arena_obj_t;
+
+typedef struct _py_arena_it_obj_t {
+    mp_obj_base_t base;
+    mp_fun_1_t iternext;
+    py_arena_obj_t *arena_obj;
+    int cur;
+} py_arena_it_obj_t;
+
+static mp_obj_t py_blob_obj(void *elem)
+{
+    color_blob_t *cb = elem;
+    mp_obj_t blob_obj[10] = {
+        mp_obj_new_int(cb->x),
+        mp_obj_new_int(cb->y),
+        mp_obj_new_int(cb->w),
+        mp_obj_new_int(cb->h),
+        mp_obj_new_int(cb->pixels),
+        mp_obj_new_int(cb->cx),
+        mp_obj_new_int(cb->cy),
+        mp_obj_new_float(cb->rotation),
+        mp_obj_new_int(cb->code),
+        mp_obj_new_int(cb->count)
+    };
+    return mp_obj_new_tuple(10, blob_obj);
+}
+
+static mp_obj_t py_detection_obj(void *elem)
+{
+    detection_t *d = elem;
+    mp_obj_t rec_obj[4] = {
+        mp_obj_new_int(d->rect.x),
+        mp_obj_new_int(d->rect.y),
+        mp_obj_new_int(d->rect.w),
+        mp_obj_new_int(d->rect.h),
+    };
+    return mp_obj_new_tuple(4, rec_obj);
+}
+
+static mp_obj_t py_orb_kp_obj(void *elem)
+{
+    orb_kp_t *kp = elem;
+    mp_obj_t kp_obj[4] = {
+        mp_obj_new_int(kp->x),
+        mp_obj_new_int(kp->y),
+        mp_obj_new_float(kp->angle * (2.0f * PI / ORB_ANGLES)),
+        mp_obj_new_int(kp->level),
+    };
+    return mp_obj_new_tuple(4, kp_obj);
+}
+
+static mp_obj_t py_detection_neighbors_obj(void *elem)
+{
+    detection_t *d = elem;
+    mp_obj_t rec_obj[5] = {
+        mp_obj_new_int(d->rect.x),
+        mp_obj_new_int(d->rect.y),
+        mp_obj_new_int(d->rect.w),
+        mp_obj_new_int(d->rect.h),
+        mp_obj_new_int(d->neighbors),
+    };
+    return mp_obj_new_tuple(5, rec_obj);
+}
+
+static void py_arena_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind)
+{
+    py_arena_obj_t *self = self_in;
+    mp_printf(print, "[");
+    for (int i=0; i<arena_length(&self->arena); i++) {
+        if (i) mp_printf(print, ", ");
+        mp_obj_print_helper(print, self->elem_fun(arena_at(&self->arena, i)), kind);
+    }
+    mp_printf(print, "]");
+}
+
+static mp_obj_t py_arena_unary_op(mp_uint_t op, mp_obj_t self_in)
+{
+    py_arena_obj_t *self = self_in;
+    switch (op) {
+        case MP_UNARY_OP_BOOL: return mp_obj_new_bool(arena_length(&self->arena) != 0);
+        case MP_UNARY_OP_LEN: return MP_OBJ_NEW_SMALL_INT(arena_length(&self->arena));
+        default: return MP_OBJ_NULL; // op not supported
+    }
+}
+
+// Returns the results [start, stop) as a list.
+static mp_obj_t py_arena_list(py_arena_obj_t *self, int start, int stop)
+{
+    mp_uint_t len;
+    mp_obj_t *items;
+    mp_obj_t list = mp_obj_new_list(stop - start, NULL);
+    mp_obj_list_get(list, &len, &items);
+    for (int i=start; i<stop; i++) {
+        items[i - start] = self->elem_fun(arena_at(&self->arena, i));
+    }
+    return list;
+}
+
+static mp_obj_t py_arena_binary_op(mp_uint_t op, mp_obj_t lhs_in, mp_obj_t rhs_in)
+{
+    py_arena_obj_t *self = lhs_in;
+    switch (op) {
+        case MP_BINARY_OP_ADD: {
+            // Concatenated as lists, the right side can be a list or results.
+            mp_obj_t rhs = rhs_in;
+            if (MP_OBJ_IS_TYPE(rhs_in, &py_arena_type)) {
+                rhs = py_arena_list(rhs_in, 0, arena_length(&((py_arena_obj_t *) rhs_in)->arena));
+            }
+            return mp_binary_op(MP_BINARY_OP_ADD, py_arena_list(self, 0, arena_length(&self->arena)), rhs);
+        }
+        default: return MP_OBJ_NULL; // op not supported
+    }
+}
+
+static mp_obj_t py_arena_subscr(mp_obj_t self_in, mp_obj_t index, mp_obj_t value)
+{
+    py_arena_obj_t *self = self_in;
+    if (value == MP_OBJ_SENTINEL) {
+        // load
+        int len = arena_length(&self->arena);
+        if (MP_OBJ_IS_TYPE(index, &mp_type_slice)) {
+            // Slices are lists, slices with a step are taken from all the results.
+            mp_bound_slice_t slice;
+            if (mp_seq_get_fast_slice_indexes(len, index, &slice)) {
+                return py_arena_list(self, slice.start, slice.stop);
+            }
+            return mp_obj_subscr(py_arena_list(self, 0, len), index, MP_OBJ_SENTINEL);
+        }
+        int i = mp_get_index(self->base.type, len, index, false);
+        return self->elem_fun(arena_at(&self->arena, i));
+    }
+    // store/delete not supported
+    return MP_OBJ_NULL;
+}
+
+static mp_obj_t py_arena_it_iternext(mp_obj_t self_in)
+{
+    py_arena_it_obj_t *self = self_in;
+    if (self->cur < arena_length(&self->arena_obj->arena)) {
+        return self->arena_obj->elem_fun(arena_at(&self->arena_obj->arena, self->cur++));
+    }
+    return MP_OBJ_STOP_ITERATION;
+}
+
+static mp_obj_t py_arena_getiter(mp_obj_t self_in)
+{
+    py_arena_it_obj_t *o = m_new_obj(py_arena_it_obj_t);
+    o->base.type = &mp_type_polymorph_iter;
+    o->iternext = py_arena_it_iternext;
+    o->arena_obj = self_in;
+    o->cur = 0;
+    return o;
+}
+
+static mp_int_t py_arena_get_buffer(mp_obj_t self_in, mp_buffer_info_t *bufinfo, mp_uint_t flags)
+{
+    py_arena_obj_t *self = self_in;
+    if (flags == MP_BUFFER_READ) {
+        bufinfo->buf = self->arena.data;
+        bufinfo->len = arena_length(&self->arena) * self->arena.size;
+        bufinfo->typecode = self->typecode;
+        return 0;
+    } else {
+        // not supported
+        bufinfo->buf = NULL;
+        bufinfo->len = 0;
+        bufinfo->typecode = -1;
+        return 1;
+    }
+}
+
+static const mp_obj_type_t py_arena_type = {
+    { &mp_type_type },
+    .name  = MP_QSTR_results,
+    .print = py_arena_print,
+    .unary_op = py_arena_unary_op,
+    .binary_op = py_arena_binary_op,
+    .subscr = py_arena_subscr,
+    .getiter = py_arena_getiter,
+    .buffer_p = { .get_buffer = py_arena_get_buffer },
+};
+
+static mp_obj_t py_arena(arena_t *arena, char typecode, py_arena_elem_fun_t elem_fun)
+{
+    py_arena_obj_t *o = m_new_obj(py_arena_obj_t);
+    o->base.type = &py_arena_type;
+    o->arena = *arena;
+    o->typecode = typecode;
+    o->elem_fun = elem_fun;
+    return o;
+}
+
 // Image //////////////////////////////////////////////////////////////////////
 
 typedef struct _py_image_obj_t {
@@ -226,9 +477,7 @@ static mp_obj_t py_image_compress(uint n_args, const mp_obj_t *args, mp_map_t *k
         uint32_t size;
         uint8_t *buffer = fb_alloc_all(&size);
         image_t out = { .w=arg_img->w, .h=arg_img->h, .bpp=size, .pixels=buffer };
-        // When jpeg_compress needs more memory than in currently allocated it
-        // will try to realloc. MP will detect that the pointer is outside of
-        // the heap and return NULL which will cause an out of memory error.
+        // jpeg_compress raises a MemoryError if the JPEG doesn't fit.
         jpeg_compress(arg_img, &out, arg_q);
         if (out.bpp <= (arg_img->w * arg_img->h * arg_img->bpp)) {
             memcpy(arg_img->pixels, out.pixels, out.bpp);
@@ -263,9 +512,7 @@ static mp_obj_t py_image_compressed(uint n_args, const mp_obj_t *args, mp_map_t
     uint32_t size;
     uint8_t *buffer = fb_alloc_all(&size);
     image_t out = { .w=arg_img->w, .h=arg_img->h, .bpp=size, .pixels=buffer };
-    // When jpeg_compress needs more memory than in currently allocated it
-    // will try to realloc. MP will detect that the pointer is outside of
-    // the heap and return NULL which will cause an out of memory error.
+    // jpeg_compress raises a MemoryError if the JPEG doesn't fit.
     jpeg_compress(arg_img, &out, arg_q);
     uint8_t *temp = xalloc(out.bpp);
     memcpy(temp, out.pixels, out.bpp);
@@ -275,6 +522,53 @@ static mp_obj_t py_image_compressed(uint n_args, const mp_obj_t *args, mp_map_t
     return py_image_from_struct(&out);
 }
 
+// Writes each chunk of the JPEG with the write() or send() method of the
+// stream (i.e. a file, socket or USB VCP), retrying partial writes. The chunk
+// is passed as a copy because its buffer is reused for the next chunk.
+static void py_image_stream_flush(jpeg_sink_t *sink, uint32_t len, bool last)
+{
+    mp_obj_t *dest = sink->data;
+    for (uint32_t i=0; i<len;) {
+        dest[2] = mp_obj_new_bytes(sink->buf + i, len - i);
+        mp_obj_t ret = mp_call_method_n_kw(1, 0, dest);
+        // None (would block) or 0 bytes means the stream can't take the chunk.
+        mp_int_t bytes = (ret == mp_const_none) ? 0 : mp_obj_get_int(ret);
+        if (bytes <= 0) {
+            nlr_raise(mp_obj_new_exception_msg(&mp_type_OSError, "Failed to write to stream!"));
+        }
+        i += bytes;
+    }
+}
+
+static mp_obj_t py_image_compress_stream(uint n_args, const mp_obj_t *args, mp_map_t *kw_args)
+{
+    image_t *arg_img = py_image_cobj(args[0]);
+
+    int arg_q = py_helper_lookup_int(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_quality), 50);
+    arg_q = IM_MIN(IM_MAX(arg_q, 1), 100);
+
+    mp_obj_t dest[3];
+    mp_load_method_maybe(args[1], MP_QSTR_write, dest);
+    if (dest[0] == MP_OBJ_NULL) {
+        mp_load_method(args[1], MP_QSTR_send, dest);
+    }
+
+    jpeg_sink_t sink = { .flush = py_image_stream_flush, .data = dest };
+    if (IM_IS_JPEG(arg_img)) {
+        sink.buf = arg_img->pixels;
+        py_image_stream_flush(&sink, arg_img->bpp, true);
+        return mp_obj_new_int(arg_img->bpp);
+    }
+
+    // The JPEG is encoded and sent one chunk at a time.
+    sink.buf = fb_alloc(JPEG_SINK_CHUNK);
+    sink.size = JPEG_SINK_CHUNK;
+    uint32_t size = jpeg_encode(arg_img, &sink, arg_q);
+    fb_free();
+
+    return mp_obj_new_int(size);
+}
+
 static mp_obj_t py_image_width(mp_obj_t img_obj)
 {
     image_t *arg_img = py_image_cobj(img_obj);
@@ -467,12 +761,21 @@ static mp_obj_t py_image_draw_keypoints(uint n_args, const mp_obj_t *args, mp_ma
             imlib_draw_line(arg_img, x, y, x+(co*arg_s), y+(si*arg_s), arg_c);
             imlib_draw_circle(arg_img, x, y, (arg_s-2)/2, arg_c);
         }
+    } else if (MP_OBJ_IS_TYPE(args[1], &py_arena_type)) {
+        // ORB keypoints
+        py_arena_obj_t *kpts_obj = args[1];
+        PY_ASSERT_TRUE_MSG(kpts_obj->elem_fun == py_orb_kp_obj, "Expected ORB keypoints");
+        for (int i=0; i<arena_length(&kpts_obj->arena); i++) {
+            orb_kp_t *kp = arena_at(&kpts_obj->arena, i);
+            float angle = kp->angle * (2.0f * PI / ORB_ANGLES);
+            imlib_draw_line(arg_img, kp->x, kp->y, kp->x+(arm_cos_f32(angle)*arg_s), kp->y+(arm_sin_f32(angle)*arg_s), arg_c);
+            imlib_draw_circle(arg_img, kp->x, kp->y, (arg_s-2)/2, arg_c);
+        }
     } else {
         py_kp_obj_t *kpts_obj = ((py_kp_obj_t*)args[1]);
         PY_ASSERT_TYPE(kpts_obj, &py_kp_type);
-        for (int i=0; i<array_length(kpts_obj->kpts); i++) {
-            kp_t *kp = array_at(kpts_obj->kpts, i);
-            imlib_draw_circle(arg_img, kp->x, kp->y, (arg_s-2)/2, arg_c);
+        for (int i=0; i<kpts_obj->kpts.n_kpts; i++) {
+            imlib_draw_circle(arg_img, kpts_obj->kpts.x[i], kpts_obj->kpts.y[i], (arg_s-2)/2, arg_c);
         }
     }
     return mp_const_none;
@@ -848,19 +1151,7 @@ static mp_obj_t py_image_histeq(mp_obj_t img_obj)
 
 static bool py_image_find_blobs_f_fun(void *fun_obj, void *img_obj, color_blob_t *cb)
 {
-    mp_obj_t blob_obj[10] = {
-        mp_obj_new_int(cb->x),
-        mp_obj_new_int(cb->y),
-        mp_obj_new_int(cb->w),
-        mp_obj_new_int(cb->h),
-        mp_obj_new_int(cb->pixels),
-        mp_obj_new_int(cb->cx),
-        mp_obj_new_int(cb->cy),
-        mp_obj_new_float(cb->rotation),
-        mp_obj_new_int(cb->code),
-        mp_obj_new_int(cb->count)
-    };
-    return mp_obj_is_true(mp_call_function_2(fun_obj, img_obj, mp_obj_new_tuple(10, blob_obj)));
+    return mp_obj_is_true(mp_call_function_2(fun_obj, img_obj, py_blob_obj(cb)));
 }
 
 static mp_obj_t py_image_find_blobs(uint n_args, const mp_obj_t *args, mp_map_t *kw_args)
@@ -912,47 +1203,20 @@ static mp_obj_t py_image_find_blobs(uint n_args, const mp_obj_t *args, mp_map_t
     mp_obj_t kw_val = (kw_arg != NULL) ? kw_arg->value : NULL;
 
     int arg_invert = py_helper_lookup_int(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_invert), 0);
-    array_t *blobs_list = imlib_find_blobs(arg_img, arg_t_len, l_t, u_t, arg_invert ? 1 : 0, &arg_r,
-                                           py_image_find_blobs_f_fun, kw_val, args[0]);
-    if (blobs_list == NULL) {
+    int arg_x_stride = py_helper_lookup_int(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_x_stride), 1);
+    int arg_y_stride = py_helper_lookup_int(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_y_stride), 1);
+    PY_ASSERT_TRUE_MSG((arg_x_stride > 0) && (arg_y_stride > 0), "Stride must be > 0");
+    arena_t blobs_list;
+    if (!imlib_find_blobs(&blobs_list, arg_img, arg_t_len, l_t, u_t, arg_invert ? 1 : 0, &arg_r,
+                          arg_x_stride, arg_y_stride, py_image_find_blobs_f_fun, kw_val, args[0])) {
         return mp_obj_new_list(0, NULL); // return an empty array to be iteratable
     }
-    mp_obj_t objects_list = mp_obj_new_list(0, NULL);
-    for (int i=0, j=array_length(blobs_list); i<j; i++) {
-        color_blob_t *cb = array_at(blobs_list, i);
-        mp_obj_t blob_obj[10] = {
-            mp_obj_new_int(cb->x),
-            mp_obj_new_int(cb->y),
-            mp_obj_new_int(cb->w),
-            mp_obj_new_int(cb->h),
-            mp_obj_new_int(cb->pixels),
-            mp_obj_new_int(cb->cx),
-            mp_obj_new_int(cb->cy),
-            mp_obj_new_float(cb->rotation),
-            mp_obj_new_int(cb->code),
-            mp_obj_new_int(cb->count)
-        };
-        mp_obj_list_append(objects_list, mp_obj_new_tuple(10, blob_obj));
-    }
-    array_free(blobs_list);
-    return objects_list;
+    return py_arena(&blobs_list, 'B', py_blob_obj);
 }
 
 static bool py_image_find_markers_f_fun(void *fun_obj, void *img_obj, color_blob_t *cb)
 {
-    mp_obj_t blob_obj[10] = {
-        mp_obj_new_int(cb->x),
-        mp_obj_new_int(cb->y),
-        mp_obj_new_int(cb->w),
-        mp_obj_new_int(cb->h),
-        mp_obj_new_int(cb->pixels),
-        mp_obj_new_int(cb->cx),
-        mp_obj_new_int(cb->cy),
-        mp_obj_new_float(cb->rotation),
-        mp_obj_new_int(cb->code),
-        mp_obj_new_int(cb->count)
-    };
-    return mp_obj_is_true(mp_call_function_2(fun_obj, img_obj, mp_obj_new_tuple(10, blob_obj)));
+    return mp_obj_is_true(mp_call_function_2(fun_obj, img_obj, py_blob_obj(cb)));
 }
 
 static mp_obj_t py_image_find_markers(uint n_args, const mp_obj_t *args, mp_map_t *kw_args)
@@ -966,54 +1230,46 @@ static mp_obj_t py_image_find_markers(uint n_args, const mp_obj_t *args, mp_map_
     mp_map_elem_t *kw_arg = mp_map_lookup(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_feature_filter), MP_MAP_LOOKUP);
     mp_obj_t kw_val = (kw_arg != NULL) ? kw_arg->value : NULL;
 
-    mp_uint_t arg_t_len;
-    mp_obj_t *arg_t;
-    mp_obj_get_array(args[1], &arg_t_len, &arg_t);
-    if (!arg_t_len) return mp_obj_new_list(0, NULL); // return an empty array to be iteratable
+    arena_t blobs_list_ret;
+    if (MP_OBJ_IS_TYPE(args[1], &py_arena_type)) {
+        // Blobs returned by find_blobs() are used in place.
+        py_arena_obj_t *arg_blobs = args[1];
+        PY_ASSERT_TRUE_MSG(arg_blobs->elem_fun == py_blob_obj, "Expected a list of blobs");
+        if (!imlib_find_markers(&blobs_list_ret, &arg_blobs->arena, margin,
+                                py_image_find_markers_f_fun, kw_val, args[0])) {
+            return mp_obj_new_list(0, NULL); // return an empty array to be iteratable
+        }
+    } else {
+        mp_uint_t arg_t_len;
+        mp_obj_t *arg_t;
+        mp_obj_get_array(args[1], &arg_t_len, &arg_t);
+        if (!arg_t_len) return mp_obj_new_list(0, NULL); // return an empty array to be iteratable
 
-    array_t *blobs_list;
-    array_alloc_init(&blobs_list, xfree, arg_t_len);
-    for (int i=0; i<arg_t_len; i++) {
-        mp_obj_t *temp;
-        mp_obj_get_array_fixed_n(arg_t[i], 10, &temp);
-        color_blob_t *cb = xalloc(sizeof(color_blob_t));
-        cb->x = mp_obj_get_int(temp[0]);
-        cb->y = mp_obj_get_int(temp[1]);
-        cb->w = mp_obj_get_int(temp[2]);
-        cb->h = mp_obj_get_int(temp[3]);
-        cb->pixels = mp_obj_get_int(temp[4]);
-        cb->cx = mp_obj_get_int(temp[5]);
-        cb->cy = mp_obj_get_int(temp[6]);
-        cb->rotation = mp_obj_get_float(temp[7]);
-        cb->code = mp_obj_get_int(temp[8]);
-        cb->count = mp_obj_get_int(temp[9]);
-        array_push_back(blobs_list, cb);
-    }
-    array_t *blobs_list_ret = imlib_find_markers(blobs_list, margin,
-                                                 py_image_find_markers_f_fun, kw_val, args[0]);
-    if (blobs_list_ret == NULL) {
-        return mp_obj_new_list(0, NULL); // return an empty array to be iteratable
-    }
-    array_free(blobs_list);
-    mp_obj_t objects_list = mp_obj_new_list(0, NULL);
-    for (int i=0, j=array_length(blobs_list_ret); i<j; i++) {
-        color_blob_t *cb = array_at(blobs_list_ret, i);
-        mp_obj_t blob_obj[10] = {
-            mp_obj_new_int(cb->x),
-            mp_obj_new_int(cb->y),
-            mp_obj_new_int(cb->w),
-            mp_obj_new_int(cb->h),
-            mp_obj_new_int(cb->pixels),
-            mp_obj_new_int(cb->cx),
-            mp_obj_new_int(cb->cy),
-            mp_obj_new_float(cb->rotation),
-            mp_obj_new_int(cb->code),
-            mp_obj_new_int(cb->count)
-        };
-        mp_obj_list_append(objects_list, mp_obj_new_tuple(10, blob_obj));
+        arena_t blobs_list;
+        arena_alloc(&blobs_list, sizeof(color_blob_t), arg_t_len);
+        for (int i=0; i<arg_t_len; i++) {
+            mp_obj_t *temp;
+            mp_obj_get_array_fixed_n(arg_t[i], 10, &temp);
+            color_blob_t *cb = arena_push_back(&blobs_list);
+            cb->x = mp_obj_get_int(temp[0]);
+            cb->y = mp_obj_get_int(temp[1]);
+            cb->w = mp_obj_get_int(temp[2]);
+            cb->h = mp_obj_get_int(temp[3]);
+            cb->pixels = mp_obj_get_int(temp[4]);
+            cb->cx = mp_obj_get_int(temp[5]);
+            cb->cy = mp_obj_get_int(temp[6]);
+            cb->rotation = mp_obj_get_float(temp[7]);
+            cb->code = mp_obj_get_int(temp[8]);
+            cb->count = mp_obj_get_int(temp[9]);
+        }
+        bool found = imlib_find_markers(&blobs_list_ret, &blobs_list, margin,
+                                        py_image_find_markers_f_fun, kw_val, args[0]);
+        arena_free(&blobs_list);
+        if (!found) {
+            return mp_obj_new_list(0, NULL); // return an empty array to be iteratable
+        }
     }
-    array_free(blobs_list_ret);
-    return objects_list;
+    return py_arena(&blobs_list_ret, 'B', py_blob_obj);
 }
 
 static mp_obj_t py_image_find_features(uint n_args, const mp_obj_t *args, mp_map_t *kw_args)
@@ -1022,9 +1278,43 @@ static mp_obj_t py_image_find_features(uint n_args, const mp_obj_t *args, mp_map
     PY_ASSERT_TRUE_MSG(IM_IS_GS(arg_img),
             "This function is only supported on GRAYSCALE images");
 
-    cascade_t *cascade = py_cascade_cobj(args[1]);
-    cascade->threshold = py_helper_lookup_float(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_threshold), 0.5f);
-    cascade->scale_factor = py_helper_lookup_float(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_scale), 1.5f);
+    float arg_scale = py_helper_lookup_float(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_scale), 1.5f);
+    int arg_min_neighbors = py_helper_lookup_int(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_min_neighbors), 0);
+    bool arg_neighbors = py_helper_lookup_int(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_neighbors), false);
+
+    // LBP cascades, Haar detector sessions (which track detections
+    // between frames) or Haar cascades.
+    lbp_cascade_t *lbp_cascade = NULL;
+    detector_t *detector = NULL;
+    cascade_t *cascade = NULL;
+    wsize_t window;
+
+    if (MP_OBJ_IS_TYPE(args[1], &py_lbp_cascade_type)) {
+        lbp_cascade = &((py_lbp_cascade_obj_t *)args[1])->_cobj;
+        lbp_cascade->scale_factor = arg_scale;
+        lbp_cascade->min_neighbors = arg_min_neighbors;
+        window = lbp_cascade->window;
+    } else {
+        if (MP_OBJ_IS_TYPE(args[1], &py_detector_type)) {
+            detector = &((py_detector_obj_t *)args[1])->_cobj;
+        }
+        cascade = (detector != NULL) ? detector->cascade : py_cascade_cobj(args[1]);
+        cascade->threshold = py_helper_lookup_float(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_threshold), 0.5f);
+        cascade->scale_factor = arg_scale;
+        cascade->min_neighbors = arg_min_neighbors;
+        // Skip windows with a lower variance, or outside of the mask.
+        cascade->min_variance = py_helper_lookup_int(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_variance), 0);
+        cascade->mask = NULL;
+        mp_map_elem_t *kw_mask = mp_map_lookup(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_mask), MP_MAP_LOOKUP);
+        if (kw_mask != NULL && kw_mask->value != mp_const_none) {
+            cascade->mask = py_image_cobj(kw_mask->value);
+            PY_ASSERT_TRUE_MSG(IM_IS_GS(cascade->mask),
+                    "Mask must be a GRAYSCALE image");
+            PY_ASSERT_TRUE_MSG(cascade->mask->w == arg_img->w && cascade->mask->h == arg_img->h,
+                    "Mask must be the same size as the image");
+        }
+        window = cascade->window;
+    }
 
     rectangle_t arg_r;
     py_helper_lookup_rectangle(kw_args, arg_img, &arg_r);
@@ -1035,26 +1325,21 @@ static mp_obj_t py_image_find_features(uint n_args, const mp_obj_t *args, mp_map
     }
 
     // Make sure ROI is bigger than feature size
-    PY_ASSERT_TRUE_MSG((rect.w > cascade->window.w && rect.h > cascade->window.h),
+    PY_ASSERT_TRUE_MSG((rect.w > window.w && rect.h > window.h),
             "Region of interest is smaller than detector window!");
 
     // Detect objects
-    array_t *objects_array = imlib_detect_objects(arg_img, cascade, &rect);
-
-    // Add detected objects to a new Python list...
-    mp_obj_t objects_list = mp_obj_new_list(0, NULL);
-    for (int i=0; i<array_length(objects_array); i++) {
-        rectangle_t *r = array_at(objects_array, i);
-        mp_obj_t rec_obj[4] = {
-            mp_obj_new_int(r->x),
-            mp_obj_new_int(r->y),
-            mp_obj_new_int(r->w),
-            mp_obj_new_int(r->h),
-        };
-        mp_obj_list_append(objects_list, mp_obj_new_tuple(4, rec_obj));
+    arena_t objects;
+    if (lbp_cascade != NULL) {
+        imlib_detect_lbp_objects(&objects, arg_img, lbp_cascade, &rect);
+    } else if (detector != NULL) {
+        imlib_detector_detect(&objects, detector, arg_img, &rect);
+    } else {
+        imlib_detect_objects(&objects, arg_img, cascade, &rect);
     }
-    array_free(objects_array);
-    return objects_list;
+
+    // (x, y, w, h) or (x, y, w, h, neighbors) tuples are built on access.
+    return py_arena(&objects, 'h', arg_neighbors ? py_detection_neighbors_obj : py_detection_obj);
 }
 
 static mp_obj_t py_image_find_eye(mp_obj_t img_obj, mp_obj_t roi_obj)
@@ -1089,20 +1374,30 @@ static mp_obj_t py_image_find_eye(mp_obj_t img_obj, mp_obj_t roi_obj)
     return mp_obj_new_tuple(2, eye_obj);
 }
 
-static mp_obj_t py_image_find_template(mp_obj_t img_obj, mp_obj_t template_obj, mp_obj_t threshold)
+static mp_obj_t py_image_find_template(uint n_args, const mp_obj_t *args, mp_map_t *kw_args)
 {
-    image_t *arg_img = py_image_cobj(img_obj);
+    image_t *arg_img = py_image_cobj(args[0]);
     PY_ASSERT_TRUE_MSG(IM_IS_GS(arg_img),
             "This function is only supported on GRAYSCALE images");
 
-    image_t *arg_template = py_image_cobj(template_obj);
+    image_t *arg_template = py_image_cobj(args[1]);
     PY_ASSERT_TRUE_MSG(IM_IS_GS(arg_template),
             "This function is only supported on GRAYSCALE images");
+    PY_ASSERT_TRUE_MSG((arg_template->w * arg_template->h) <= UINT16_MAX,
+            "Template is too large");
+
+    float t = mp_obj_get_float(args[2]);
 
-    float t = mp_obj_get_float(threshold);
+    // Optional search area
+    rectangle_t roi;
+    py_helper_lookup_rectangle(kw_args, arg_img, &roi);
+    PY_ASSERT_TRUE_MSG(roi.x >= 0 && roi.y >= 0 && roi.w > 0 && roi.h > 0
+            && (roi.x + roi.w) <= arg_img->w && (roi.y + roi.h) <= arg_img->h,
+            "Invalid ROI");
 
     rectangle_t r;
-    float corr = imlib_template_match(arg_img, arg_template, &r);
+    float corr;
+    imlib_template_match(arg_img, &arg_template, 1, t, &roi, &r, &corr);
 
     if (corr > t) {
         mp_obj_t rec_obj[4] = {
@@ -1116,6 +1411,97 @@ static mp_obj_t py_image_find_template(mp_obj_t img_obj, mp_obj_t template_obj,
     return mp_const_none;
 }
 
+static mp_obj_t py_image_find_templates(uint n_args, const mp_obj_t *args, mp_map_t *kw_args)
+{
+    image_t *arg_img = py_image_cobj(args[0]);
+    PY_ASSERT_TRUE_MSG(IM_IS_GS(arg_img),
+            "This function is only supported on GRAYSCALE images");
+
+    mp_uint_t n_templates;
+    mp_obj_t *templates_obj;
+    mp_obj_get_array(args[1], &n_templates, &templates_obj);
+    PY_ASSERT_TRUE_MSG(n_templates > 0, "Expected a list of templates");
+
+    float t = mp_obj_get_float(args[2]);
+
+    // Optional search area
+    rectangle_t roi;
+    py_helper_lookup_rectangle(kw_args, arg_img, &roi);
+    PY_ASSERT_TRUE_MSG(roi.x >= 0 && roi.y >= 0 && roi.w > 0 && roi.h > 0
+            && (roi.x + roi.w) <= arg_img->w && (roi.y + roi.h) <= arg_img->h,
+            "Invalid ROI");
+
+    // Check the templates before allocating anything.
+    for (int i=0; i<n_templates; i++) {
+        image_t *arg_template = py_image_cobj(templates_obj[i]);
+        PY_ASSERT_TRUE_MSG(IM_IS_GS(arg_template),
+                "This function is only supported on GRAYSCALE images");
+        PY_ASSERT_TRUE_MSG((arg_template->w * arg_template->h) <= UINT16_MAX,
+                "Template is too large");
+    }
+
+    image_t **templates = fb_alloc(n_templates * sizeof(image_t*));
+    rectangle_t *r = fb_alloc(n_templates * sizeof(rectangle_t));
+    float *corr = fb_alloc(n_templates * sizeof(float));
+
+    for (int i=0; i<n_templates; i++) {
+        templates[i] = py_image_cobj(templates_obj[i]);
+    }
+
+    imlib_template_match(arg_img, templates, n_templates, t, &roi, r, corr);
+
+    // The best match of each template, or None.
+    mp_obj_t matches_obj = mp_obj_new_list(0, NULL);
+    for (int i=0; i<n_templates; i++) {
+        mp_obj_t match_obj = mp_const_none;
+        if (corr[i] > t) {
+            mp_obj_t rec_obj[5] = {
+                mp_obj_new_int(r[i].x),
+                mp_obj_new_int(r[i].y),
+                mp_obj_new_int(r[i].w),
+                mp_obj_new_int(r[i].h),
+                mp_obj_new_float(corr[i])
+            };
+            match_obj = mp_obj_new_tuple(5, rec_obj);
+        }
+        mp_obj_list_append(matches_obj, match_obj);
+    }
+
+    fb_free(); // corr
+    fb_free(); // r
+    fb_free(); // templates
+    return matches_obj;
+}
+
+static mp_obj_t py_image_find_displacement(uint n_args, const mp_obj_t *args, mp_map_t *kw_args)
+{
+    image_t *arg_img = py_image_cobj(args[0]);
+    PY_ASSERT_TRUE_MSG(IM_IS_GS(arg_img),
+            "This function is only supported on GRAYSCALE images");
+
+    image_t *arg_prev = py_image_cobj(args[1]);
+    PY_ASSERT_TRUE_MSG(IM_IS_GS(arg_prev),
+            "This function is only supported on GRAYSCALE images");
+    PY_ASSERT_TRUE_MSG(arg_img->w == arg_prev->w && arg_img->h == arg_prev->h,
+            "Images must have the same size");
+
+    rectangle_t roi;
+    py_helper_lookup_rectangle(kw_args, arg_img, &roi);
+    PY_ASSERT_TRUE_MSG(roi.x >= 0 && roi.y >= 0 && roi.w > 0 && roi.h > 0
+            && (roi.x + roi.w) <= arg_img->w && (roi.y + roi.h) <= arg_img->h,
+            "Invalid ROI");
+
+    float x, y, response;
+    imlib_phase_correlate(arg_prev, arg_img, &roi, &x, &y, &response);
+
+    mp_obj_t tuple[3] = {
+        mp_obj_new_float(x),
+        mp_obj_new_float(y),
+        mp_obj_new_float(response)
+    };
+    return mp_obj_new_tuple(3, tuple);
+}
+
 static mp_obj_t py_image_find_lbp(mp_obj_t img_obj, mp_obj_t roi_obj)
 {
     image_t *arg_img = py_image_cobj(img_obj);
@@ -1152,17 +1538,40 @@ static mp_obj_t py_image_find_keypoints(uint n_args, const mp_obj_t *args, mp_ma
         return mp_const_none;
     }
 
+    descriptor_t method = py_helper_lookup_int(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_method), DESC_FREAK);
+    if (method == DESC_ORB) {
+        int threshold = py_helper_lookup_int(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_threshold), 20);
+        int max_keypoints = py_helper_lookup_int(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_max_keypoints), 100);
+        float scale_factor = py_helper_lookup_float(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_scale_factor), 1.5f);
+        int levels = py_helper_lookup_int(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_levels), 3);
+        PY_ASSERT_TRUE_MSG((max_keypoints > 0 && max_keypoints <= INT16_MAX), "Expected max_keypoints between 1 and 32767");
+        PY_ASSERT_TRUE_MSG(scale_factor > 1.0f, "Expected scale_factor > 1.0");
+        PY_ASSERT_TRUE_MSG(levels > 0, "Expected levels > 0");
+
+        arena_t kpts;
+        orb_find_keypoints(&kpts, arg_img, max_keypoints, scale_factor, levels, threshold, &rect);
+        if (arena_length(&kpts) == 0) {
+            arena_free(&kpts);
+            return mp_const_none;
+        }
+        // (x, y, angle, level) tuples are built on access, the
+        // descriptors are only used by match_descriptor.
+        return py_arena(&kpts, 'B', py_orb_kp_obj);
+    }
+
     int threshold = py_helper_lookup_int(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_threshold), 32);
     bool normalized = py_helper_lookup_int(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_normalized), false);
 
-    array_t *kpts = freak_find_keypoints(arg_img, normalized, threshold, &rect);
+    kp_set_t kpts;
+    freak_find_keypoints(&kpts, arg_img, normalized, threshold, &rect);
 
-    if (array_length(kpts)) {
+    if (kpts.n_kpts) {
         py_kp_obj_t *kp_obj = m_new_obj(py_kp_obj_t);
         kp_obj->base.type = &py_kp_type;
         kp_obj->kpts = kpts;
         kp_obj->threshold = threshold;
         kp_obj->normalized = normalized;
+        kp_obj->index.offsets = NULL;
         return kp_obj;
     }
     return mp_const_none;
@@ -1173,6 +1582,7 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_KW(py_image_copy_obj, 1, py_image_copy);
 STATIC MP_DEFINE_CONST_FUN_OBJ_KW(py_image_save_obj, 2, py_image_save);
 STATIC MP_DEFINE_CONST_FUN_OBJ_KW(py_image_compress_obj, 1, py_image_compress);
 STATIC MP_DEFINE_CONST_FUN_OBJ_KW(py_image_compressed_obj, 1, py_image_compressed);
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(py_image_compress_stream_obj, 2, py_image_compress_stream);
 /* Basic image functions */
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(py_image_width_obj, py_image_width);
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(py_image_height_obj, py_image_height);
@@ -1219,7 +1629,9 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_KW(py_image_find_markers_obj, 2, py_image_find_ma
 /* Feature Detection */
 STATIC MP_DEFINE_CONST_FUN_OBJ_KW(py_image_find_features_obj, 2, py_image_find_features);
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(py_image_find_eye_obj, py_image_find_eye);
-STATIC MP_DEFINE_CONST_FUN_OBJ_3(py_image_find_template_obj, py_image_find_template);
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(py_image_find_template_obj, 3, py_image_find_template);
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(py_image_find_templates_obj, 3, py_image_find_templates);
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(py_image_find_displacement_obj, 2, py_image_find_displacement);
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(py_image_find_lbp_obj, py_image_find_lbp);
 STATIC MP_DEFINE_CONST_FUN_OBJ_KW(py_image_find_keypoints_obj, 1, py_image_find_keypoints);
 static const mp_map_elem_t locals_dict_table[] = {
@@ -1228,6 +1640,7 @@ static const mp_map_elem_t locals_dict_table[] = {
     {MP_OBJ_NEW_QSTR(MP_QSTR_save),                (mp_obj_t)&py_image_save_obj},
     {MP_OBJ_NEW_QSTR(MP_QSTR_compress),            (mp_obj_t)&py_image_compress_obj},
     {MP_OBJ_NEW_QSTR(MP_QSTR_compressed),          (mp_obj_t)&py_image_compressed_obj},
+    {MP_OBJ_NEW_QSTR(MP_QSTR_compress_stream),     (mp_obj_t)&py_image_compress_stream_obj},
     /* Basic image functions */
     {MP_OBJ_NEW_QSTR(MP_QSTR_width),               (mp_obj_t)&py_image_width_obj},
     {MP_OBJ_NEW_QSTR(MP_QSTR_height),              (mp_obj_t)&py_image_height_obj},
@@ -1275,6 +1688,8 @@ static const mp_map_elem_t locals_dict_table[] = {
     {MP_OBJ_NEW_QSTR(MP_QSTR_find_features),       (mp_obj_t)&py_image_find_features_obj},
     {MP_OBJ_NEW_QSTR(MP_QSTR_find_eye),            (mp_obj_t)&py_image_find_eye_obj},
     {MP_OBJ_NEW_QSTR(MP_QSTR_find_template),       (mp_obj_t)&py_image_find_template_obj},
+    {MP_OBJ_NEW_QSTR(MP_QSTR_find_templates),      (mp_obj_t)&py_image_find_templates_obj},
+    {MP_OBJ_NEW_QSTR(MP_QSTR_find_displacement),   (mp_obj_t)&py_image_find_displacement_obj},
     {MP_OBJ_NEW_QSTR(MP_QSTR_find_lbp),            (mp_obj_t)&py_image_find_lbp_obj},
     {MP_OBJ_NEW_QSTR(MP_QSTR_find_keypoints),      (mp_obj_t)&py_image_find_keypoints_obj},
     { NULL, NULL },
@@ -1369,10 +1784,22 @@ mp_obj_t py_image_grayscale_to_rgb(mp_obj_t not_tuple)
              mp_obj_new_int(rgb_color.blue)});
 }
 
-mp_obj_t py_image_load_image(mp_obj_t path_obj)
+mp_obj_t py_image_load_image(uint n_args, const mp_obj_t *args, mp_map_t *kw_args)
 {
     mp_obj_t image_obj = py_image(0, 0, 0, 0);
-    imlib_load_image(py_image_cobj(image_obj), mp_obj_str_get_str(path_obj));
+    const char *path = mp_obj_str_get_str(args[0]);
+
+    // JPEGs are kept compressed unless decode is set.
+    if (py_helper_lookup_int(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_decode), 0)) {
+        int arg_scale = py_helper_lookup_int(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_scale), 1);
+        PY_ASSERT_TRUE_MSG((arg_scale == 1) || (arg_scale == 2) || (arg_scale == 4) || (arg_scale == 8),
+                "Scale must be 1, 2, 4 or 8");
+        bool arg_gs = py_helper_lookup_int(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_grayscale), 0);
+        jpeg_read_settings_t rs = { .scale = arg_scale, .bpp = arg_gs ? 1 : 0 };
+        imlib_load_image(py_image_cobj(image_obj), path, &rs);
+    } else {
+        imlib_load_image(py_image_cobj(image_obj), path, NULL);
+    }
     return image_obj;
 }
 
@@ -1401,6 +1828,45 @@ mp_obj_t py_image_load_cascade(uint n_args, const mp_obj_t *args, mp_map_t *kw_a
     return o;
 }
 
+mp_obj_t py_image_load_lbp_cascade(uint n_args, const mp_obj_t *args, mp_map_t *kw_args)
+{
+    lbp_cascade_t cascade;
+    const char *path = mp_obj_str_get_str(args[0]);
+
+    // Load cascade from file
+    int res = imlib_load_lbp_cascade(&cascade, path);
+    if (res != FR_OK) {
+        nlr_raise(mp_obj_new_exception_msg(&mp_type_OSError, ffs_strerror(res)));
+    }
+
+    // Read the number of stages
+    int stages = py_helper_lookup_int(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_stages), cascade.n_stages);
+    // Check the number of stages
+    if (stages > 0 && stages < cascade.n_stages) {
+        cascade.n_stages = stages;
+    }
+
+    // Return micropython cascade object
+    py_lbp_cascade_obj_t *o = m_new_obj(py_lbp_cascade_obj_t);
+    o->base.type = &py_lbp_cascade_type;
+    o->_cobj = cascade;
+    return o;
+}
+
+mp_obj_t py_image_detector(uint n_args, const mp_obj_t *args, mp_map_t *kw_args)
+{
+    cascade_t *cascade = py_cascade_cobj(args[0]);
+    int interval = py_helper_lookup_int(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_interval), 10);
+    PY_ASSERT_TRUE_MSG(interval > 0, "interval must be > 0");
+
+    // Return micropython detector object, it keeps the cascade alive.
+    py_detector_obj_t *o = m_new_obj(py_detector_obj_t);
+    o->base.type = &py_detector_type;
+    o->cascade = args[0];
+    imlib_detector_init(&o->_cobj, cascade, interval);
+    return o;
+}
+
 mp_obj_t py_image_load_descriptor(uint n_args, const mp_obj_t *args, mp_map_t *kw_args)
 {
     FIL fp;
@@ -1424,10 +1890,8 @@ mp_obj_t py_image_load_descriptor(uint n_args, const mp_obj_t *args, mp_map_t *k
             }
 
             case DESC_FREAK: {
-                array_t *kpts = NULL;
-                array_alloc(&kpts, xfree);
-
-                res = freak_load_descriptor(&fp, kpts);
+                kp_set_t kpts;
+                res = freak_load_descriptor(&fp, &kpts);
                 if (res == FR_OK) {
                     // Return keypoints MP object
                     py_kp_obj_t *kp_obj = m_new_obj(py_kp_obj_t);
@@ -1435,6 +1899,7 @@ mp_obj_t py_image_load_descriptor(uint n_args, const mp_obj_t *args, mp_map_t *k
                     kp_obj->kpts = kpts;
                     kp_obj->threshold = 10;
                     kp_obj->normalized = false;
+                    kp_obj->index.offsets = NULL;
                     desc = kp_obj;
                 }
                 break;
@@ -1474,7 +1939,7 @@ mp_obj_t py_image_save_descriptor(uint n_args, const mp_obj_t *args, mp_map_t *k
 
             case DESC_FREAK: {
                 py_kp_obj_t *kpts = ((py_kp_obj_t*)args[2]);
-                res = freak_save_descriptor(&fp, kpts->kpts);
+                res = freak_save_descriptor(&fp, &kpts->kpts);
                 break;
             }
         }
@@ -1490,6 +1955,69 @@ mp_obj_t py_image_save_descriptor(uint n_args, const mp_obj_t *args, mp_map_t *k
     return mp_const_true;
 }
 
+mp_obj_t py_image_gallery_add(uint n_args, const mp_obj_t *args, mp_map_t *kw_args)
+{
+    FIL fp;
+    FRESULT res;
+
+    const char *path = mp_obj_str_get_str(args[0]);
+    int id = mp_obj_get_int(args[1]);
+    py_lbp_obj_t *lbp = ((py_lbp_obj_t*)args[2]);
+
+    // Sanity checks
+    PY_ASSERT_TRUE_MSG((id >= 0 && id <= UINT16_MAX), "Expected id between 0 and 65535");
+    PY_ASSERT_TYPE(lbp, &py_lbp_type);
+
+    if ((res = f_open(&fp, path, FA_READ|FA_WRITE|FA_OPEN_ALWAYS)) == FR_OK) {
+        res = imlib_lbp_gallery_add(&fp, id, lbp->hist);
+        f_close(&fp);
+    }
+
+    // File open, read or write error
+    if (res != FR_OK) {
+        nlr_raise(mp_obj_new_exception_msg(&mp_type_OSError, ffs_strerror(res)));
+    }
+    return mp_const_true;
+}
+
+mp_obj_t py_image_gallery_match(uint n_args, const mp_obj_t *args, mp_map_t *kw_args)
+{
+    FIL fp;
+    FRESULT res;
+
+    const char *path = mp_obj_str_get_str(args[0]);
+    py_lbp_obj_t *lbp = ((py_lbp_obj_t*)args[1]);
+    int k = py_helper_lookup_int(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_k), 1);
+    lbp_metric_t metric = py_helper_lookup_int(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_method), LBP_CHI_SQUARE);
+
+    // Sanity checks
+    PY_ASSERT_TYPE(lbp, &py_lbp_type);
+    PY_ASSERT_TRUE_MSG((k > 0 && k <= LBP_MAX_MATCHES), "Expected k between 1 and 256");
+    PY_ASSERT_TRUE_MSG((metric == LBP_CHI_SQUARE || metric == LBP_CORRELATION),
+            "Expected CHI_SQUARE or CORRELATION");
+
+    mp_obj_t list = mp_obj_new_list(0, NULL);
+    if ((res = f_open(&fp, path, FA_READ|FA_OPEN_EXISTING)) == FR_OK) {
+        lbp_match_t *matches = fb_alloc(k * sizeof(lbp_match_t));
+        res = imlib_lbp_gallery_match(&fp, lbp->hist, metric, matches, &k);
+        for (int i=0; i<k; i++) {
+            mp_obj_t match_obj[2] = {
+                mp_obj_new_int(matches[i].id),
+                mp_obj_new_int(matches[i].distance)
+            };
+            mp_obj_list_append(list, mp_obj_new_tuple(2, match_obj));
+        }
+        fb_free();
+        f_close(&fp);
+    }
+
+    // File open or read error
+    if (res != FR_OK) {
+        nlr_raise(mp_obj_new_exception_msg(&mp_type_OSError, ffs_strerror(res)));
+    }
+    return list;
+}
+
 static mp_obj_t py_image_match_descriptor(uint n_args, const mp_obj_t *args, mp_map_t *kw_args)
 {
     mp_obj_t match_obj = mp_const_none;
@@ -1512,53 +2040,183 @@ static mp_obj_t py_image_match_descriptor(uint n_args, const mp_obj_t *args, mp_
             py_kp_obj_t *kpts1 = ((py_kp_obj_t*)args[1]);
             py_kp_obj_t *kpts2 = ((py_kp_obj_t*)args[2]);
             int threshold = py_helper_lookup_int(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_threshold), 60);
+            float ratio = py_helper_lookup_float(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_ratio), 1.0f);
+            bool cross_check = py_helper_lookup_int(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_cross_check), false);
 
             // Sanity checks
             PY_ASSERT_TYPE(kpts1, &py_kp_type);
             PY_ASSERT_TYPE(kpts2, &py_kp_type);
             PY_ASSERT_TRUE_MSG((threshold >=0 && threshold <= 100), "Expected threshold between 0 and 100");
 
+            // The first set is usually the reference set, index it once.
+            if (kpts1->index.offsets == NULL) {
+                freak_index_build(&kpts1->index, &kpts1->kpts);
+            }
+
             int match=0, cx=0, cy=0;
             // Match the two keypoint sets
             // Returns the number of matches
-            match = freak_match_keypoints(kpts1->kpts, kpts2->kpts, threshold);
-
-            if (match) {
-                for (int i=0; i<array_length(kpts1->kpts); i++) {
-                    kp_t *kp = array_at(kpts1->kpts, i);
-                    if (kp->match != NULL) {
-                        cx += kp->match->x;
-                        cy += kp->match->y;
-                    }
+            match = freak_match_index(&kpts1->index, &kpts2->kpts, threshold, ratio, cross_check);
+
+            for (int i=0; i<kpts1->kpts.n_kpts; i++) {
+                int m = kpts1->kpts.match[i];
+                if (m != -1) {
+                    cx += kpts2->kpts.x[m];
+                    cy += kpts2->kpts.y[m];
                 }
             }
 
             mp_obj_t rec_obj[3] = {
-                mp_obj_new_int(cx/match),
-                mp_obj_new_int(cy/match),
-                mp_obj_new_int(match*100/IM_MAX(array_length(kpts1->kpts), 1))
+                mp_obj_new_int(cx/IM_MAX(match, 1)),
+                mp_obj_new_int(cy/IM_MAX(match, 1)),
+                mp_obj_new_int(match*100/IM_MAX(kpts1->kpts.n_kpts, 1))
             };
             match_obj = mp_obj_new_tuple(3, rec_obj);
+            break;
+        }
+
+        case DESC_ORB: {
+            py_arena_obj_t *kpts1 = ((py_arena_obj_t*)args[1]);
+            py_arena_obj_t *kpts2 = ((py_arena_obj_t*)args[2]);
+            int threshold = py_helper_lookup_int(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_threshold), 75);
+
+            // Sanity checks
+            PY_ASSERT_TRUE_MSG(MP_OBJ_IS_TYPE(kpts1, &py_arena_type) && kpts1->elem_fun == py_orb_kp_obj
+                    && MP_OBJ_IS_TYPE(kpts2, &py_arena_type) && kpts2->elem_fun == py_orb_kp_obj,
+                    "Expected ORB keypoints");
+            PY_ASSERT_TRUE_MSG((threshold >=0 && threshold <= 100), "Expected threshold between 0 and 100");
+
+            int match=0, cx=0, cy=0;
+            // Match the two keypoint sets
+            // Returns the number of matches
+            match = orb_match_keypoints(&kpts1->arena, &kpts2->arena, threshold);
+
+            for (int i=0; i<arena_length(&kpts1->arena); i++) {
+                orb_kp_t *kp = arena_at(&kpts1->arena, i);
+                if (kp->match != -1) {
+                    orb_kp_t *kp_match = arena_at(&kpts2->arena, kp->match);
+                    cx += kp_match->x;
+                    cy += kp_match->y;
+                }
+            }
+
+            mp_obj_t rec_obj[3] = {
+                mp_obj_new_int(cx/IM_MAX(match, 1)),
+                mp_obj_new_int(cy/IM_MAX(match, 1)),
+                mp_obj_new_int(match*100/IM_MAX(arena_length(&kpts1->arena), 1))
+            };
+            match_obj = mp_obj_new_tuple(3, rec_obj);
+            break;
         }
     }
 
     return match_obj;
 }
 
+static mp_obj_t py_image_find_transform(uint n_args, const mp_obj_t *args, mp_map_t *kw_args)
+{
+    int n_kpts = 0, n_pairs = 0;
+    transform_t type = py_helper_lookup_int(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_method), TRANSFORM_HOMOGRAPHY);
+    float max_error = py_helper_lookup_float(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_max_error), 3.0f);
+    int iterations = py_helper_lookup_int(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_iterations), 100);
+
+    // Sanity checks
+    PY_ASSERT_TRUE_MSG(type == TRANSFORM_HOMOGRAPHY || type == TRANSFORM_SIMILARITY,
+            "Expected image.HOMOGRAPHY or image.SIMILARITY");
+    PY_ASSERT_TRUE_MSG(max_error > 0.0f && iterations > 0, "Expected a positive max_error and iterations");
+
+    if (MP_OBJ_IS_TYPE(args[0], &py_kp_type)) {
+        PY_ASSERT_TYPE(args[1], &py_kp_type);
+        n_kpts = ((py_kp_obj_t*)args[0])->kpts.n_kpts;
+    } else {
+        PY_ASSERT_TRUE_MSG(MP_OBJ_IS_TYPE(args[0], &py_arena_type) && ((py_arena_obj_t*)args[0])->elem_fun == py_orb_kp_obj
+                && MP_OBJ_IS_TYPE(args[1], &py_arena_type) && ((py_arena_obj_t*)args[1])->elem_fun == py_orb_kp_obj,
+                "Expected FREAK or ORB keypoints");
+        n_kpts = arena_length(&((py_arena_obj_t*)args[0])->arena);
+    }
+
+    // The pairs matched by the last match_descriptor() call on these keypoints.
+    point_t *src = fb_alloc(IM_MAX(n_kpts, 1) * sizeof(point_t));
+    point_t *dst = fb_alloc(IM_MAX(n_kpts, 1) * sizeof(point_t));
+    if (MP_OBJ_IS_TYPE(args[0], &py_kp_type)) {
+        kp_set_t *kpts1 = &((py_kp_obj_t*)args[0])->kpts;
+        kp_set_t *kpts2 = &((py_kp_obj_t*)args[1])->kpts;
+        for (int i=0; i<n_kpts; i++) {
+            int m = kpts1->match[i];
+            if (m != -1 && m < kpts2->n_kpts) {
+                src[n_pairs] = (point_t) {kpts1->x[i], kpts1->y[i]};
+                dst[n_pairs++] = (point_t) {kpts2->x[m], kpts2->y[m]};
+            }
+        }
+    } else {
+        arena_t *kpts1 = &((py_arena_obj_t*)args[0])->arena;
+        arena_t *kpts2 = &((py_arena_obj_t*)args[1])->arena;
+        for (int i=0; i<n_kpts; i++) {
+            orb_kp_t *kp = arena_at(kpts1, i);
+            if (kp->match != -1 && kp->match < arena_length(kpts2)) {
+                orb_kp_t *kp_match = arena_at(kpts2, kp->match);
+                src[n_pairs] = (point_t) {kp->x, kp->y};
+                dst[n_pairs++] = (point_t) {kp_match->x, kp_match->y};
+            }
+        }
+    }
+
+    float H[9];
+    uint8_t *mask = fb_alloc0(IM_MAX(n_pairs, 1));
+    int inliers = imlib_find_transform(H, src, dst, n_pairs, type, max_error, iterations, mask);
+
+    // The reference rectangle defaults to the bounding box of the inliers.
+    rectangle_t roi = {0, 0, 0, 0};
+    if (mp_map_lookup(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_roi), MP_MAP_LOOKUP) != NULL) {
+        py_helper_lookup_rectangle(kw_args, NULL, &roi);
+    } else if (inliers) {
+        int x1 = INT16_MAX, y1 = INT16_MAX, x2 = INT16_MIN, y2 = INT16_MIN;
+        for (int i=0; i<n_pairs; i++) {
+            if (mask[i]) {
+                x1 = IM_MIN(x1, src[i].x); x2 = IM_MAX(x2, src[i].x);
+                y1 = IM_MIN(y1, src[i].y); y2 = IM_MAX(y2, src[i].y);
+            }
+        }
+        roi = (rectangle_t) {x1, y1, x2-x1+1, y2-y1+1};
+    }
+    fb_free(); // mask
+    fb_free(); // dst
+    fb_free(); // src
+
+    if (inliers == 0) {
+        return mp_const_none;
+    }
+
+    // Project the corners of the reference rectangle.
+    mp_obj_t corners[4];
+    for (int i=0; i<4; i++) {
+        float x, y;
+        imlib_transform_point(H, roi.x + ((i == 1 || i == 2) ? roi.w : 0),
+                                 roi.y + ((i >= 2) ? roi.h : 0), &x, &y);
+        corners[i] = mp_obj_new_tuple(2, (mp_obj_t[2])
+                {mp_obj_new_int(fast_roundf(x)), mp_obj_new_int(fast_roundf(y))});
+    }
+
+    return mp_obj_new_tuple(2, (mp_obj_t[2])
+            {mp_obj_new_int(inliers), mp_obj_new_tuple(4, corners)});
+}
+
 int py_image_descriptor_from_roi(image_t *img, const char *path, rectangle_t *roi)
 {
     FIL fp;
     FRESULT res = FR_OK;
 
     printf("Save Descriptor: ROI(%d %d %d %d)\n", roi->x, roi->y, roi->w, roi->h);
-    array_t *kpts = freak_find_keypoints(img, false, 10, roi);
-    printf("Save Descriptor: KPTS(%d)\n", array_length(kpts));
+    kp_set_t kpts;
+    freak_find_keypoints(&kpts, img, false, 10, roi);
+    printf("Save Descriptor: KPTS(%d)\n", kpts.n_kpts);
 
-    if (array_length(kpts)) {
+    if (kpts.n_kpts) {
         if ((res = f_open(&fp, path, FA_WRITE|FA_CREATE_ALWAYS)) == FR_OK) {
-            res = freak_save_descriptor(&fp, kpts);
+            res = freak_save_descriptor(&fp, &kpts);
             f_close(&fp);
         }
+        kp_set_free(&kpts);
         // File open/write error
         if (res != FR_OK) {
             nlr_raise(mp_obj_new_exception_msg(&mp_type_OSError, ffs_strerror(res)));
@@ -1573,15 +2231,25 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_1(py_image_lab_to_rgb_obj, py_image_lab_to_rgb);
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(py_image_rgb_to_grayscale_obj, py_image_rgb_to_grayscale);
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(py_image_grayscale_to_rgb_obj, py_image_grayscale_to_rgb);
 /* Image Module Functions */
-STATIC MP_DEFINE_CONST_FUN_OBJ_1(py_image_load_image_obj, py_image_load_image);
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(py_image_load_image_obj, 1, py_image_load_image);
 STATIC MP_DEFINE_CONST_FUN_OBJ_KW(py_image_load_cascade_obj, 1, py_image_load_cascade);
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(py_image_load_lbp_cascade_obj, 1, py_image_load_lbp_cascade);
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(py_image_detector_obj, 1, py_image_detector);
 STATIC MP_DEFINE_CONST_FUN_OBJ_KW(py_image_load_descriptor_obj, 2, py_image_load_descriptor);
 STATIC MP_DEFINE_CONST_FUN_OBJ_KW(py_image_save_descriptor_obj, 3, py_image_save_descriptor);
 STATIC MP_DEFINE_CONST_FUN_OBJ_KW(py_image_match_descriptor_obj, 3, py_image_match_descriptor);
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(py_image_gallery_add_obj, 3, py_image_gallery_add);
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(py_image_gallery_match_obj, 2, py_image_gallery_match);
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(py_image_find_transform_obj, 2, py_image_find_transform);
 static const mp_map_elem_t globals_dict_table[] = {
     {MP_OBJ_NEW_QSTR(MP_QSTR___name__),            MP_OBJ_NEW_QSTR(MP_QSTR_image)},
     {MP_OBJ_NEW_QSTR(MP_QSTR_LBP),                 MP_OBJ_NEW_SMALL_INT(DESC_LBP)},
     {MP_OBJ_NEW_QSTR(MP_QSTR_FREAK),               MP_OBJ_NEW_SMALL_INT(DESC_FREAK)},
+    {MP_OBJ_NEW_QSTR(MP_QSTR_ORB),                 MP_OBJ_NEW_SMALL_INT(DESC_ORB)},
+    {MP_OBJ_NEW_QSTR(MP_QSTR_SIMILARITY),          MP_OBJ_NEW_SMALL_INT(TRANSFORM_SIMILARITY)},
+    {MP_OBJ_NEW_QSTR(MP_QSTR_HOMOGRAPHY),          MP_OBJ_NEW_SMALL_INT(TRANSFORM_HOMOGRAPHY)},
+    {MP_OBJ_NEW_QSTR(MP_QSTR_CHI_SQUARE),          MP_OBJ_NEW_SMALL_INT(LBP_CHI_SQUARE)},
+    {MP_OBJ_NEW_QSTR(MP_QSTR_CORRELATION),         MP_OBJ_NEW_SMALL_INT(LBP_CORRELATION)},
     /* Color space functions */
     {MP_OBJ_NEW_QSTR(MP_QSTR_rgb_to_lab),          (mp_obj_t)&py_image_rgb_to_lab_obj},
     {MP_OBJ_NEW_QSTR(MP_QSTR_lab_to_rgb),          (mp_obj_t)&py_image_lab_to_rgb_obj},
@@ -1590,9 +2258,14 @@ static const mp_map_elem_t globals_dict_table[] = {
     /* Image Module Functions */
     {MP_OBJ_NEW_QSTR(MP_QSTR_Image),               (mp_obj_t)&py_image_load_image_obj},
     {MP_OBJ_NEW_QSTR(MP_QSTR_HaarCascade),         (mp_obj_t)&py_image_load_cascade_obj},
+    {MP_OBJ_NEW_QSTR(MP_QSTR_HaarDetector),        (mp_obj_t)&py_image_detector_obj},
+    {MP_OBJ_NEW_QSTR(MP_QSTR_LBPCascade),          (mp_obj_t)&py_image_load_lbp_cascade_obj},
     {MP_OBJ_NEW_QSTR(MP_QSTR_load_descriptor),     (mp_obj_t)&py_image_load_descriptor_obj},
     {MP_OBJ_NEW_QSTR(MP_QSTR_save_descriptor),     (mp_obj_t)&py_image_save_descriptor_obj},
     {MP_OBJ_NEW_QSTR(MP_QSTR_match_descriptor),    (mp_obj_t)&py_image_match_descriptor_obj},
+    {MP_OBJ_NEW_QSTR(MP_QSTR_gallery_add),         (mp_obj_t)&py_image_gallery_add_obj},
+    {MP_OBJ_NEW_QSTR(MP_QSTR_gallery_match),       (mp_obj_t)&py_image_gallery_match_obj},
+    {MP_OBJ_NEW_QSTR(MP_QSTR_find_transform),      (mp_obj_t)&py_image_find_transform_obj},
     { NULL, NULL }
 };
 STATIC MP_DEFINE_CONST_DICT(globals_dict, globals_dict_table);
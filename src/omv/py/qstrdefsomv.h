@@ -15,17 +15,31 @@ Q(lab_to_rgb)
 Q(rgb_to_grayscale)
 Q(grayscale_to_rgb)
 Q(HaarCascade)
+Q(HaarDetector)
+Q(LBPCascade)
 Q(FREAK)
+Q(ORB)
 Q(LBP)
 Q(load_descriptor)
 Q(save_descriptor)
 Q(match_descriptor)
+Q(find_transform)
+Q(SIMILARITY)
+Q(HOMOGRAPHY)
+Q(CHI_SQUARE)
+Q(CORRELATION)
+Q(gallery_add)
+Q(gallery_match)
+Q(k)
 
 // Image class
 Q(copy)
 Q(save)
 Q(compress)
 Q(compressed)
+Q(compress_stream)
+Q(decode)
+Q(grayscale)
 Q(width)
 Q(height)
 Q(format)
@@ -61,10 +75,14 @@ Q(median)
 Q(find_blobs)
 Q(find_markers)
 Q(kp_desc)
+Q(results)
 Q(lbp_desc)
 Q(Cascade)
+Q(Detector)
 Q(histeq)
 Q(find_template)
+Q(find_templates)
+Q(find_displacement)
 Q(find_features)
 Q(find_keypoints)
 Q(find_lbp)
@@ -81,6 +99,22 @@ Q(percentile)
 Q(feature_filter)
 Q(margin)
 Q(normalized)
+Q(x_stride)
+Q(y_stride)
+Q(min_neighbors)
+Q(neighbors)
+Q(variance)
+Q(mask)
+Q(interval)
+Q(stages)
+Q(ratio)
+Q(cross_check)
+Q(method)
+Q(max_keypoints)
+Q(scale_factor)
+Q(levels)
+Q(max_error)
+Q(iterations)
 
 // Lcd Module
 Q(lcd)
@@ -0,0 +1,38 @@
+# JPEG Frame Differencing Example
+#
+# Note: You will need an SD card to run this example.
+#
+# This example demonstrates frame differencing against a background image that
+# is saved as a JPEG to save card space. JPEGs passed to image operations are
+# decoded a few lines at a time while the operation runs, and image.Image() can
+# decode a JPEG (optionally at 1/2, 1/4 or 1/8 size for a fast thumbnail).
+
+import sensor, image, os, time
+
+sensor.reset() # Initialize the camera sensor.
+sensor.set_pixformat(sensor.GRAYSCALE) # or sensor.RGB565
+sensor.set_framesize(sensor.QVGA) # or sensor.QQVGA (or others)
+sensor.skip_frames(10) # Let new settings take affect.
+sensor.set_whitebal(False) # Turn off white balance.
+clock = time.clock() # Tracks FPS.
+
+if not "temp" in os.listdir(): os.mkdir("temp") # Make a temp directory
+
+print("About to save background image...")
+sensor.skip_frames(60) # Give the user time to get ready.
+sensor.snapshot().save("temp/bg.jpg", quality=90)
+print("Saved background image - Now frame differencing!")
+
+# Decode a 1/4 size grayscale thumbnail of the background.
+thumb = image.Image("temp/bg.jpg", decode=True, scale=4, grayscale=True)
+print("Thumbnail: %dx%d" % (thumb.width(), thumb.height()))
+
+while(True):
+    clock.tick() # Track elapsed milliseconds between snapshots().
+    img = sensor.snapshot() # Take a picture and return the image.
+
+    # Replace the image with the "abs(NEW-OLD)" frame difference.
+    img.difference("temp/bg.jpg")
+
+    print(clock.fps()) # Note: Your OpenMV Cam runs about half as fast while
+    # connected to your computer. The FPS should increase once disconnected.
@@ -0,0 +1,48 @@
+# Displacement Example
+#
+# This script estimates the translation of the camera between frames with
+# phase correlation. The image is downsampled to 64x64 and the translation
+# is found to sub-pixel accuracy in the original image's pixels.
+#
+# find_displacement() returns (x, y, response). The response is between 0
+# and 1, and is low when the frames don't overlap well (fast motion,
+# rotation or blur).
+
+import sensor, time
+
+# Minimum response of a valid displacement.
+RESPONSE_THRESH=0.2
+
+# Reset sensor
+sensor.reset()
+
+# Sensor settings
+sensor.set_contrast(1)
+sensor.set_gainceiling(16)
+sensor.set_framesize(sensor.QQVGA)
+sensor.set_pixformat(sensor.GRAYSCALE)
+
+# Skip a few frames to allow the sensor settle down
+# Note: This takes more time when exec from the IDE.
+for i in range(0, 30):
+    img = sensor.snapshot()
+    img.draw_string(0, 0, "Please wait...")
+
+prev = sensor.snapshot().copy()
+x, y = 0.0, 0.0
+clock = time.clock()
+
+while (True):
+    clock.tick()
+    img = sensor.snapshot()
+    d = img.find_displacement(prev)
+    prev = img.copy()
+
+    if (d[2] > RESPONSE_THRESH):
+        # Accumulate the translation of the camera
+        x += d[0]
+        y += d[1]
+        print("dx:%.2f dy:%.2f response:%.2f (x:%.1f y:%.1f)"%(d[0], d[1], d[2], x, y))
+
+    # Draw FPS
+    img.draw_string(0, 0, "FPS:%.2f"%(clock.fps()))
@@ -0,0 +1,59 @@
+# LBP Gallery Example
+#
+# This example identifies faces against a gallery of enrolled LBP descriptors.
+# The gallery is a single file on the SD card, faces are added to it with an
+# id and gallery_match() returns the k closest ids as (id, distance) tuples,
+# the lowest distance first.
+#
+# Set ENROLL_ID to enroll the first face found under that id, or to None to
+# identify faces.
+
+import sensor, time, image
+
+GALLERY="/faces.lbg"
+# Id of the face to enroll, or None.
+ENROLL_ID=None
+# Number of ids to return.
+TOP_K=3
+
+# Reset sensor
+sensor.reset()
+
+# Sensor settings
+sensor.set_contrast(1)
+sensor.set_gainceiling(16)
+sensor.set_framesize(sensor.HQVGA)
+sensor.set_pixformat(sensor.GRAYSCALE)
+
+# Load Haar Cascade
+face_cascade = image.HaarCascade("frontalface", stages=25)
+
+# Skip a few frames to allow the sensor settle down
+# Note: This takes more time when exec from the IDE.
+for i in range(0, 30):
+    img = sensor.snapshot()
+    img.draw_string(0, 0, "Please wait...")
+
+clock = time.clock()
+
+while (True):
+    clock.tick()
+    img = sensor.snapshot()
+
+    objects = img.find_features(face_cascade, threshold=0.5, scale=1.25)
+    if objects:
+        face = objects[0]
+        d = img.find_lbp(face)
+        if (ENROLL_ID != None):
+            image.gallery_add(GALLERY, ENROLL_ID, d)
+            print("Enrolled id %d"%(ENROLL_ID))
+            ENROLL_ID = None
+        else:
+            matches = image.gallery_match(GALLERY, d, k=TOP_K, method=image.CHI_SQUARE)
+            print(matches)
+            if matches:
+                img.draw_string(0, 10, "Id %d"%(matches[0][0]))
+
+        img.draw_rectangle(face)
+    # Draw FPS
+    img.draw_string(0, 0, "FPS:%.2f"%(clock.fps()))
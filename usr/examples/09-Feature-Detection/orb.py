@@ -0,0 +1,71 @@
+# ORB Example
+#
+# This script shows off ORB keypoint tracking. Like the FREAK example, the
+# first set of keypoints is learned from the first frame and every following
+# frame is matched against it.
+#
+# ORB keypoints are found on a pyramid of downscaled images, so objects are
+# matched at different scales, and each keypoint has an orientation so they
+# are matched when rotated. The keypoints are (x, y, angle, level) tuples.
+#
+# image.find_transform() fits a homography to the matched keypoints with
+# RANSAC and returns the number of inliers and the corners of the learned
+# inlier keypoints' bounding box projected into the current frame.
+#
+# NOTE: LOTS OF KEYPOINTS MAY CAUSE THE SYSTEM TO RUN OUT OF MEMORY!
+
+import sensor, time, image
+
+# Maximum number of keypoints, the best ones by corner strength are kept.
+MAX_KEYPOINTS=100
+# FAST corner threshold, the lower the threshold the more corners are found.
+KEYPOINTS_THRESH=20
+# Keypoint-level threshold, range from 0 to 100.
+# The minimum matching percentage between 2 keypoints.
+MATCHING_THRESH=75
+# Maximum reprojection error of an inlier, in pixels.
+MAX_ERROR=3.0
+
+# Reset sensor
+sensor.reset()
+
+# Sensor settings
+sensor.set_contrast(1)
+sensor.set_gainceiling(16)
+sensor.set_framesize(sensor.QQVGA)
+sensor.set_pixformat(sensor.GRAYSCALE)
+
+# Skip a few frames to allow the sensor settle down
+# Note: This takes more time when exec from the IDE.
+for i in range(0, 30):
+    img = sensor.snapshot()
+    img.draw_string(0, 0, "Please wait...")
+
+kpts1 = None
+clock = time.clock()
+
+while (True):
+    clock.tick()
+    img = sensor.snapshot()
+    kpts2 = img.find_keypoints(method=image.ORB, max_keypoints=MAX_KEYPOINTS,
+                               threshold=KEYPOINTS_THRESH, scale_factor=1.5, levels=3)
+
+    if (kpts1==None):
+        kpts1 = kpts2
+        print(kpts1)
+    elif kpts2:
+        img.draw_keypoints(kpts2, size=8)
+        c = image.match_descriptor(image.ORB, kpts1, kpts2, threshold=MATCHING_THRESH)
+        # c[2] contains the percentage of matching keypoints.
+        if (c[2]>25):
+            img.draw_cross(c[0], c[1], size=15)
+            img.draw_string(0, 10, "Match %d%%"%(c[2]))
+            t = image.find_transform(kpts1, kpts2, method=image.HOMOGRAPHY, max_error=MAX_ERROR)
+            if (t):
+                # Outline the learned object
+                for i in range(0, 4):
+                    p0, p1 = t[1][i], t[1][(i+1)%4]
+                    img.draw_line((p0[0], p0[1], p1[0], p1[1]))
+
+    # Draw FPS
+    img.draw_string(0, 0, "FPS:%.2f"%(clock.fps()))
@@ -1,12 +1,14 @@
 # Template Matching Example - Normalized Cross Correlation (NCC)
 #
 # This example shows off how to use the NCC feature of your OpenMV Cam to match
-# image patches to parts of an image... expect for extremely controlled enviorments
-# NCC is not all to useful.
+# image patches to parts of an image. NCC is robust to brightness and contrast
+# changes but not to rotation or scaling of the template.
 #
-# WARNING: NCC supports needs to be reworked! As of right now this feature needs
-# a lot of work to be made into somethin useful. This script will reamin to show
-# that the functionality exists, but, in its current state is inadequate.
+# The template is searched on downscaled images first and the best positions
+# are refined on the full image. The optional roi limits the search area.
+#
+# To look for several templates use img.find_templates([t1, t2, ...], 0.75),
+# it returns a list with the best (x, y, w, h, score) of each template, or None.
 
 import time, sensor, image
 
@@ -28,6 +30,7 @@ template = image.Image("/template.bmp") # Image should be like 32x32 grayscale.
 while (True):
     img = sensor.snapshot()
 
+    # find_template(template, threshold, [roi=(x, y, w, h)])
     r = img.find_template(template, 0.75)
     if r:
         img.draw_rectangle(r)
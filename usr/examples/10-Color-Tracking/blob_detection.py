@@ -2,6 +2,10 @@
 #
 # This example shows off how to use the find_blobs function to find color
 # blobs in the image. This example in particular looks for dark green objects.
+#
+# find_blobs() returns a read-only sequence of blob tuples: it supports len(),
+# indexing, slicing (which returns a list), iteration and "+". Use list(blobs)
+# or sorted(blobs, key=...) when you need a list to modify or sort in place.
 
 import sensor, image, time
 
@@ -1,62 +1,110 @@
 #!/usr/bin/env python2.7
+# Haar and LBP cascade converter.
+#
+# Converts OpenCV xml cascades and cascades in the old OpenMV binary format
+# (one array per field) to the packed binary format, where each stage's weak
+# classifiers are stored contiguously with their rectangles:
+#
+#   header:  uint32 magic, int32 window_w, int32 window_h, int32 n_stages,
+#            uint32 size (bytes of stage data that follow)
+#   stage:   int16 threshold (Q8), uint16 n_features, then the features
+#   feature: int16 threshold (Q12), int16 alpha1 (Q8), int16 alpha2 (Q8),
+#            uint16 n_rectangles, then the rectangles
+#   rect:    int8 x, int8 y, int8 w, int8 h, int16 weight (Q12)
+#
+# OpenCV LBP cascades (stumps only) are converted to the packed LBP format:
+#
+#   header:  uint32 magic, int32 window_w, int32 window_h, int32 n_stages,
+#            int32 n_features, uint32 size (bytes of data that follow)
+#   feature: int8 x, int8 y, int8 w, int8 h (n_features of them)
+#   stage:   int16 threshold (Q8), uint16 n_classifiers, then the classifiers
+#   classifier: uint32 subset[8], uint16 feature, int16 alpha1 (Q8),
+#            int16 alpha2 (Q8), uint16 reserved
+#
+# All values are little endian.
 import sys,os
+import math
 import struct
 import argparse
 from xml.dom import minidom
 
-
-def cascade_info(path):
+CASCADE_MAGIC = 0x31434148 # "HAC1"
+LBP_CASCADE_MAGIC = 0x3143424C # "LBC1"
+
+def xml_children(node, tag):
+    return [n for n in node.childNodes if n.nodeType == n.ELEMENT_NODE and n.tagName == tag]
+
+def xml_text(node, tag):
+    return xml_children(node, tag)[0].childNodes[0].nodeValue
+
+def lbp_cascade_from_xml(xmldoc):
+    root = xmldoc.getElementsByTagName('cascade')[0]
+    size = [int(xml_text(root, 'width')), int(xml_text(root, 'height'))]
+
+    stages = []
+    for s in xml_children(xml_children(root, 'stages')[0], '_'):
+        classifiers = []
+        for c in xml_children(xml_children(s, 'weakClassifiers')[0], '_'):
+            nodes = [int(x) for x in xml_text(c, 'internalNodes').split()]
+            leaves = [float(x) for x in xml_text(c, 'leafValues').split()]
+            if len(nodes) != 11 or len(leaves) != 2:
+                raise Exception("Only LBP cascades of stumps are supported")
+            subset = [x & 0xffffffff for x in nodes[3:11]]
+            classifiers.append((nodes[2], int(round(leaves[0]*256)), int(round(leaves[1]*256)), subset))
+        # round the threshold down to keep borderline windows
+        stages.append((int(math.floor(float(xml_text(s, 'stageThreshold'))*256)), classifiers))
+
+    features = []
+    for f in xml_children(xml_children(root, 'features')[0], '_'):
+        features.append(tuple(int(x) for x in xml_text(f, 'rect').split()))
+
+    return {'type':'lbp', 'size':size, 'stages':stages, 'features':features}
+
+def lbp_cascade_from_packed(data):
+    magic, w, h, n_stages, n_features, size = struct.unpack_from('<IiiiiI', data, 0)
+    offs = 24
+
+    features = []
+    for i in range(n_features):
+        features.append(struct.unpack_from('<bbbb', data, offs))
+        offs += 4
+
+    stages = []
+    for s in range(n_stages):
+        t, n = struct.unpack_from('<hH', data, offs)
+        offs += 4
+        classifiers = []
+        for i in range(n):
+            v = struct.unpack_from('<8IHhhH', data, offs)
+            offs += 40
+            classifiers.append((v[8], v[9], v[10], list(v[0:8])))
+        stages.append((t, classifiers))
+
+    return {'type':'lbp', 'size':[w, h], 'stages':stages, 'features':features}
+
+def lbp_cascade_pack(cascade):
+    data = b''
+    for f in cascade['features']:
+        data += struct.pack('<bbbb', *f)
+    for t, classifiers in cascade['stages']:
+        data += struct.pack('<hH', t, len(classifiers))
+        for feature, a1, a2, subset in classifiers:
+            data += struct.pack('<8IHhhH', *(list(subset) + [feature, a1, a2, 0]))
+    return data
+
+def cascade_from_xml(path):
     #parse xml file
     xmldoc = minidom.parse(path)
 
-    trees = xmldoc.getElementsByTagName('trees')
-    n_stages = len(trees)
-
-    # read stages
-    stages = [len(t.childNodes)/2 for t in trees][0:n_stages]
-    stage_threshold = xmldoc.getElementsByTagName('stage_threshold')[0:n_stages]
-
-    # total number of features
-    n_features = sum(stages)
-    # read features threshold
-    threshold = xmldoc.getElementsByTagName('threshold')[0:n_features]
-    #theres one of each per feature
-    alpha1 = xmldoc.getElementsByTagName('left_val')[0:n_features]
-    alpha2 = xmldoc.getElementsByTagName('right_val')[0:n_features]
-
-    #read rectangles
-    feature = xmldoc.getElementsByTagName('rects')[0:n_features]
-
-    #read cascade size
-    size = (map(int, xmldoc.getElementsByTagName('size')[0].childNodes[0].nodeValue.split()))
-    fout = open(os.path.basename(path).split('.')[0]+".cascade", "w")
-
-    n_rectangles = 0
-    for f in feature:
-        rects = f.getElementsByTagName('_')
-        n_rectangles = n_rectangles + len(rects)
-
-    #print some cascade info
-    print("size:%dx%d"%(size[0], size[1]))
-    print("stages:%d"%len(stages))
-    print("features:%d"%n_features)
-    print("rectangles:%d"%n_rectangles)
-
-def cascade_binary(path, n_stages, name):
-    #parse xml file
-    xmldoc = minidom.parse(path)
+    feature_type = xmldoc.getElementsByTagName('featureType')
+    if feature_type and feature_type[0].childNodes[0].nodeValue.strip() == 'LBP':
+        return lbp_cascade_from_xml(xmldoc)
 
     trees = xmldoc.getElementsByTagName('trees')
-    max_stages = len(trees)
-    if n_stages > max_stages:
-        raise Exception("The max number of stages is: %d"%(max_stages))
-
-    if n_stages == 0:
-        n_stages = max_stages
 
     # read stages
-    stages = [len(t.childNodes)/2 for t in trees][0:n_stages]
-    stage_threshold = xmldoc.getElementsByTagName('stage_threshold')[0:n_stages]
+    stages = [len(t.childNodes)//2 for t in trees]
+    stage_threshold = xmldoc.getElementsByTagName('stage_threshold')
 
     # total number of features
     n_features = sum(stages)
@@ -72,160 +120,167 @@ def cascade_binary(path, n_stages, name):
     feature = xmldoc.getElementsByTagName('rects')[0:n_features]
 
     # read cascade size
-    size = (map(int, xmldoc.getElementsByTagName('size')[0].childNodes[0].nodeValue.split()))
-
-    # open output file with the specified name or xml file name
-    if not name:
-        name = os.path.basename(path).split('.')[0]
-    fout = open(name+".cascade", "w")
-
-    n_rectangles = 0
-    for f in feature:
-        rects = f.getElementsByTagName('_')
-        n_rectangles = n_rectangles + len(rects)
-
-    # write detection window size
-    fout.write(struct.pack('i', size[0]))
-    fout.write(struct.pack('i', size[1]))
-
-    # write num stages
-    fout.write(struct.pack('i', len(stages)))
-
-    # write num feat in stages
-    for s in stages:
-        fout.write(struct.pack('B', s)) # uint8_t
-
-    # write stages thresholds
-    for t in stage_threshold:
-        fout.write(struct.pack('h', int(float(t.childNodes[0].nodeValue)*256))) #int16_t
-
-    # write features threshold 1 per feature
-    for t in threshold:
-        fout.write(struct.pack('h', int(float(t.childNodes[0].nodeValue)*4096))) #int16_t
-
-    # write alpha1 1 per feature
-    for a in alpha1:
-        fout.write(struct.pack('h', int(float(a.childNodes[0].nodeValue)*256))) #int16_t
-
-    # write alpha2 1 per feature
-    for a in alpha2:
-        fout.write(struct.pack('h', int(float(a.childNodes[0].nodeValue)*256))) #int16_t
-
-    # write num_rects per feature
-    for f in feature:
-        rects = f.getElementsByTagName('_')
-        fout.write(struct.pack('B', len(rects))) # uint8_t
-
-    # write rects weights 1 per rectangle
-    for f in feature:
-        rects = f.getElementsByTagName('_')
-        for r in rects:
-            l = map(int, r.childNodes[0].nodeValue[:-1].split())
-            fout.write(struct.pack('b', l[4])) #int8_t NOTE: multiply by 4096
-
-    # write rects
-    for f in feature:
-        rects = f.getElementsByTagName('_')
-        for r in rects:
-            l = map(int, r.childNodes[0].nodeValue[:-1].split())
-            fout.write(struct.pack('BBBB',l[0], l[1], l[2], l[3])) #uint8_t
-
-    # print cascade info
-    print("size:%dx%d"%(size[0], size[1]))
-    print("stages:%d"%len(stages))
-    print("features:%d"%n_features)
-    print("rectangles:%d"%n_rectangles)
-    print("binary cascade generated")
-
-def cascade_header(path, n_stages, name):
-    #parse xml file
-    xmldoc = minidom.parse(path)
+    size = list(map(int, xmldoc.getElementsByTagName('size')[0].childNodes[0].nodeValue.split()))
+
+    value = lambda n: float(n.childNodes[0].nodeValue)
+
+    cascade = {'type':'haar', 'size':size, 'stages':[]}
+    f_idx = 0
+    for n, t in zip(stages, stage_threshold):
+        features = []
+        for i in range(f_idx, f_idx+n):
+            rects = []
+            for r in feature[i].getElementsByTagName('_'):
+                l = r.childNodes[0].nodeValue.split()
+                rects.append(tuple(int(x) for x in l[0:4]) + (int(round(float(l[4])*4096)),))
+            features.append((int(value(threshold[i])*4096), int(value(alpha1[i])*256), int(value(alpha2[i])*256), rects))
+        cascade['stages'].append((int(value(t)*256), features))
+        f_idx += n
+    return cascade
+
+def cascade_from_legacy(data):
+    # window size and number of stages
+    w, h, n_stages = struct.unpack_from('<iii', data, 0)
+    offs = 12
+
+    stages = struct.unpack_from('<%dB'%n_stages, data, offs)
+    offs += n_stages
+    n_features = sum(stages)
 
-    trees = xmldoc.getElementsByTagName('trees')
-    max_stages = len(trees)
+    stage_threshold = struct.unpack_from('<%dh'%n_stages, data, offs)
+    offs += n_stages*2
+    threshold = struct.unpack_from('<%dh'%n_features, data, offs)
+    offs += n_features*2
+    alpha1 = struct.unpack_from('<%dh'%n_features, data, offs)
+    offs += n_features*2
+    alpha2 = struct.unpack_from('<%dh'%n_features, data, offs)
+    offs += n_features*2
+    num_rects = struct.unpack_from('<%db'%n_features, data, offs)
+    offs += n_features
+    n_rectangles = sum(num_rects)
+    weights = struct.unpack_from('<%db'%n_rectangles, data, offs)
+    offs += n_rectangles
+    rects = struct.unpack_from('<%db'%(n_rectangles*4), data, offs)
+
+    cascade = {'type':'haar', 'size':[w, h], 'stages':[]}
+    f_idx = 0
+    r_idx = 0
+    for n, t in zip(stages, stage_threshold):
+        features = []
+        for i in range(f_idx, f_idx+n):
+            r = [tuple(rects[j*4:j*4+4]) + (weights[j]*4096,) for j in range(r_idx, r_idx+num_rects[i])]
+            features.append((threshold[i], alpha1[i], alpha2[i], r))
+            r_idx += num_rects[i]
+        cascade['stages'].append((t, features))
+        f_idx += n
+    return cascade
+
+def cascade_from_packed(data):
+    magic, w, h, n_stages, size = struct.unpack_from('<IiiiI', data, 0)
+    offs = 20
+
+    cascade = {'type':'haar', 'size':[w, h], 'stages':[]}
+    for s in range(n_stages):
+        t, n = struct.unpack_from('<hH', data, offs)
+        offs += 4
+        features = []
+        for i in range(n):
+            ft, a1, a2, nr = struct.unpack_from('<hhhH', data, offs)
+            offs += 8
+            rects = []
+            for j in range(nr):
+                rects.append(struct.unpack_from('<bbbbh', data, offs))
+                offs += 6
+            features.append((ft, a1, a2, rects))
+        cascade['stages'].append((t, features))
+    return cascade
+
+def cascade_load(path, n_stages):
+    if path.endswith('.xml'):
+        cascade = cascade_from_xml(path)
+    else:
+        data = open(path, "rb").read()
+        magic = struct.unpack_from('<I', data, 0)[0]
+        if magic == CASCADE_MAGIC:
+            cascade = cascade_from_packed(data)
+        elif magic == LBP_CASCADE_MAGIC:
+            cascade = lbp_cascade_from_packed(data)
+        else:
+            cascade = cascade_from_legacy(data)
+
+    max_stages = len(cascade['stages'])
     if n_stages > max_stages:
         raise Exception("The max number of stages is: %d"%(max_stages))
 
-    if n_stages == 0:
-        n_stages = max_stages
+    if n_stages:
+        cascade['stages'] = cascade['stages'][0:n_stages]
+    return cascade
+
+def cascade_pack(cascade):
+    data = b''
+    for t, features in cascade['stages']:
+        data += struct.pack('<hH', t, len(features))
+        for ft, a1, a2, rects in features:
+            data += struct.pack('<hhhH', ft, a1, a2, len(rects))
+            for r in rects:
+                data += struct.pack('<bbbbh', *r)
+    return data
+
+def cascade_info(cascade):
+    if cascade['type'] == 'lbp':
+        print("size:%dx%d"%(cascade['size'][0], cascade['size'][1]))
+        print("stages:%d"%len(cascade['stages']))
+        print("classifiers:%d"%sum(len(c) for t, c in cascade['stages']))
+        print("features:%d"%len(cascade['features']))
+        return
 
-    # read stages
-    stages = [len(t.childNodes)/2 for t in trees][0:n_stages]
-    stage_threshold = xmldoc.getElementsByTagName('stage_threshold')[0:n_stages]
+    n_features = sum(len(f) for t, f in cascade['stages'])
+    n_rectangles = sum(len(r[3]) for t, f in cascade['stages'] for r in f)
 
-    # total number of features
-    n_features = sum(stages)
+    print("size:%dx%d"%(cascade['size'][0], cascade['size'][1]))
+    print("stages:%d"%len(cascade['stages']))
+    print("features:%d"%n_features)
+    print("rectangles:%d"%n_rectangles)
 
-    # read features threshold
-    threshold = xmldoc.getElementsByTagName('threshold')[0:n_features]
+def cascade_binary(cascade, name):
+    fout = open(name+".cascade", "wb")
+    if cascade['type'] == 'lbp':
+        data = lbp_cascade_pack(cascade)
+        fout.write(struct.pack('<IiiiiI', LBP_CASCADE_MAGIC, cascade['size'][0], cascade['size'][1],
+                    len(cascade['stages']), len(cascade['features']), len(data)))
+    else:
+        data = cascade_pack(cascade)
+        fout.write(struct.pack('<IiiiI', CASCADE_MAGIC, cascade['size'][0], cascade['size'][1],
+                    len(cascade['stages']), len(data)))
+    fout.write(data)
+    fout.close()
+
+    cascade_info(cascade)
+    print("binary cascade generated")
 
-    # theres one of each per feature
-    alpha1 = xmldoc.getElementsByTagName('left_val')[0:n_features]
-    alpha2 = xmldoc.getElementsByTagName('right_val')[0:n_features]
+def cascade_header(cascade, name):
+    if cascade['type'] == 'lbp':
+        raise Exception("C headers are only supported for Haar cascades")
 
-    # read rectangles
-    feature = xmldoc.getElementsByTagName('rects')[0:n_features]
+    data = bytearray(cascade_pack(cascade))
 
-    # read cascade size
-    size = (map(int, xmldoc.getElementsByTagName('size')[0].childNodes[0].nodeValue.split()))
-
-    # open output file with the specified name or xml file name
-    if not name:
-        name = os.path.basename(path).split('.')[0]
     fout = open(name+".h", "w")
 
-    n_rectangles = 0
-    for f in feature:
-        rects = f.getElementsByTagName('_')
-        n_rectangles = n_rectangles + len(rects)
-
     # write detection window size
-    fout.write("const int %s_window_w=%d;\n" %( name, size[0]))
-    fout.write("const int %s_window_h=%d;\n" %(name, size[1]))
+    fout.write("const int %s_window_w=%d;\n" %(name, cascade['size'][0]))
+    fout.write("const int %s_window_h=%d;\n" %(name, cascade['size'][1]))
 
     # write num stages
-    fout.write("const int %s_n_stages=%d;\n" %(name, len(stages)))
-
-    # write num feat in stages
-    fout.write("const uint8_t %s_stages_array[]={%s};\n"
-            %(name, ", ".join(str(x) for x in stages)))
-
-    # write stages thresholds
-    fout.write("const int16_t %s_stages_thresh_array[]={%s};\n"
-            %(name, ", ".join(str(int(float(t.childNodes[0].nodeValue)*256)) for t in stage_threshold)))
-
-    # write features threshold 1 per feature
-    fout.write("const int16_t %s_tree_thresh_array[]={%s};\n"
-            %(name, ", ".join(str(int(float(t.childNodes[0].nodeValue)*4096)) for t in threshold)))
-
-    # write alpha1 1 per feature
-    fout.write("const int16_t %s_alpha1_array[]={%s};\n"
-            %(name, ", ".join(str(int(float(t.childNodes[0].nodeValue)*256)) for t in alpha1)))
-
-    # write alpha2 1 per feature
-    fout.write("const int16_t %s_alpha2_array[]={%s};\n"
-            %(name, ", ".join(str(int(float(t.childNodes[0].nodeValue)*256)) for t in alpha2)))
+    fout.write("const int %s_n_stages=%d;\n" %(name, len(cascade['stages'])))
 
-    # write num_rects per feature
-    fout.write("const int8_t %s_num_rectangles_array[]={%s};\n"
-            %(name, ", ".join(str(len(f.getElementsByTagName('_'))) for f in feature)))
+    # write packed stages
+    fout.write("const uint8_t %s_stages[] __attribute__((aligned(4))) = {\n" %(name))
+    for i in range(0, len(data), 16):
+        fout.write("    %s,\n" %(", ".join("0x%02x"%x for x in data[i:i+16])))
+    fout.write("};\n")
+    fout.close()
 
-    # write rects weights 1 per rectangle
-    rect_weights = lambda rects:", ".join(r.childNodes[0].nodeValue[:-1].split()[4] for r in rects)
-    fout.write("const int8_t %s_weights_array[]={%s};\n"
-            %(name, ", ".join(rect_weights(f.getElementsByTagName('_')) for f in feature)))
-
-
-    # write rects
-    rect = lambda rects:", ".join(", ".join(r.childNodes[0].nodeValue.split()[:-1]) for r in rects)
-    fout.write("const int8_t %s_rectangles_array[]={%s};\n"
-            %(name, ", ".join(rect(f.getElementsByTagName('_')) for f in feature)))
-
-    # print cascade info
-    print("size:%dx%d"%(size[0], size[1]))
-    print("stages:%d"%len(stages))
-    print("features:%d"%n_features)
-    print("rectangles:%d"%n_rectangles)
+    cascade_info(cascade)
     print("C header cascade generated")
 
 def main():
@@ -235,23 +290,30 @@ def main():
     parser.add_argument("-n", "--name",     action = "store",       help = "set cascade name", default = "")
     parser.add_argument("-s", "--stages",   action = "store",       help = "set the maximum number of stages", type = int, default=0)
     parser.add_argument("-c", "--header",   action = "store_true",  help = "generate a C header")
-    parser.add_argument("file", action = "store", help = "OpenCV xml cascade file path")
+    parser.add_argument("file", action = "store", help = "OpenCV xml (Haar or LBP) or OpenMV binary cascade file path")
 
     # Parse CMD args
     args = parser.parse_args()
 
+    cascade = cascade_load(args.file, args.stages)
+
     if args.info:
         # print cascade info and exit
-        cascade_info(args.file)
+        cascade_info(cascade)
         return
 
+    # output file with the specified name or input file name
+    name = args.name
+    if not name:
+        name = os.path.basename(args.file).split('.')[0]
+
     if args.header:
-        # generate a C header from the xml cascade
-        cascade_header(args.file, args.stages, args.name)
+        # generate a C header from the cascade
+        cascade_header(cascade, name)
         return
 
-    # generate a binary cascade from the xml cascade
-    cascade_binary(args.file, args.stages, args.name)
+    # generate a packed binary cascade
+    cascade_binary(cascade, name)
 
 if __name__ == '__main__':
     main()
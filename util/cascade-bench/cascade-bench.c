@@ -0,0 +1,435 @@
+/*
+ * This file is part of the OpenMV project.
+ * Copyright (c) 2013/2014 Ibrahim Abdelkader <i.abdalkader@gmail.com>
+ * This work is licensed under the MIT license, see the file LICENSE for details.
+ *
+ * Host cascade benchmark.
+ *
+ * Runs imlib_detect_objects, built from the firmware sources, over a
+ * directory of PGM/PPM images and reports the time per image, the windows
+ * and weak classifiers evaluated by each stage, and the precision and recall
+ * against annotations. Annotations are read from a text file next to each
+ * image with the same name and a .txt extension, holding one "x y w h"
+ * object per line. Images are processed in parallel by a pool of threads.
+ *
+ * Usage: cascade-bench [options] <image directory>
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <limits.h>
+#include <unistd.h>
+#include <glob.h>
+#include <pthread.h>
+#include <time.h>
+#include "imlib.h"
+#include "fb_alloc.h"
+#include "host.h"
+
+#define MAX_STAGES      (64)
+#define MAX_OBJECTS     (256)
+
+typedef struct bench_image {
+    char path[PATH_MAX];
+    int n_truth;                    // Annotated objects, -1 if not annotated.
+    rectangle_t truth[MAX_OBJECTS];
+    int n_objects;                  // Detected objects.
+    rectangle_t objects[MAX_OBJECTS];
+    int tp, fp, fn;
+    double ms;                      // Thread CPU time.
+    int w, h;
+    bool error;
+    uint32_t windows;
+    uint32_t stage_windows[MAX_STAGES];
+    uint32_t stage_features[MAX_STAGES];
+} bench_image_t;
+
+typedef struct bench {
+    cascade_t cascade;
+    float overlap;                  // Minimum IoU to match an annotation.
+    int n_images;
+    bench_image_t *images;
+    int next;                       // Next image to process.
+    pthread_mutex_t lock;
+} bench_t;
+
+static void usage()
+{
+    fprintf(stderr,
+        "usage: cascade-bench [options] <image directory>\n"
+        "  -c cascade   built-in cascade name or cascade file (frontalface)\n"
+        "  -s scale     scale factor (1.5)\n"
+        "  -t threshold detection threshold (0.5)\n"
+        "  -n neighbors minimum neighbors per object (0)\n"
+        "  -v variance  minimum window variance (0)\n"
+        "  -o overlap   minimum IoU to match an annotation (0.5)\n"
+        "  -j threads   number of threads (number of CPUs)\n"
+        "  -m kbytes    frame buffer per thread, in KB (8192)\n"
+        "  -q           only print the summary\n");
+    exit(1);
+}
+
+static double cpu_ms()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (ts.tv_sec * 1000.0) + (ts.tv_nsec / 1000000.0);
+}
+
+static double wall_ms()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec * 1000.0) + (ts.tv_nsec / 1000000.0);
+}
+
+// Reads a PNM header integer, skipping whitespace and comments.
+static int pnm_int(FILE *fp)
+{
+    int c, v = 0;
+    while ((c = fgetc(fp)) != EOF) {
+        if (c == '#') {
+            while ((c = fgetc(fp)) != EOF && c != '\n');
+        } else if (c >= '0' && c <= '9') {
+            break;
+        }
+    }
+    for (; c >= '0' && c <= '9'; c = fgetc(fp)) {
+        v = (v * 10) + (c - '0');
+    }
+    return v;
+}
+
+// Loads an 8-bit binary PGM or PPM image as grayscale.
+static bool pnm_load(const char *path, image_t *img)
+{
+    FILE *fp = fopen(path, "rb");
+    if (fp == NULL) {
+        return false;
+    }
+
+    char magic[2];
+    bool ok = (fread(magic, 1, 2, fp) == 2) && magic[0] == 'P' && (magic[1] == '5' || magic[1] == '6');
+    int bpp = (magic[1] == '6') ? 3 : 1;
+
+    img->w = ok ? pnm_int(fp) : 0;
+    img->h = ok ? pnm_int(fp) : 0;
+    img->bpp = 1;
+    ok = ok && img->w > 0 && img->h > 0 && pnm_int(fp) == 255;
+
+    uint8_t *data = NULL;
+    if (ok) {
+        data = malloc(img->w * img->h * bpp);
+        ok = (fread(data, bpp, img->w * img->h, fp) == (size_t) (img->w * img->h));
+    }
+    fclose(fp);
+
+    if (!ok) {
+        free(data);
+        return false;
+    }
+
+    if (bpp == 3) {
+        for (int i=0; i<(img->w * img->h); i++) {
+            uint8_t *p = data + (i * 3);
+            data[i] = ((p[0] * 77) + (p[1] * 150) + (p[2] * 29)) >> 8;
+        }
+    }
+
+    img->pixels = data;
+    return true;
+}
+
+// Loads the annotations of an image, returns -1 if there are none.
+static int annotations_load(const char *path, rectangle_t *truth)
+{
+    char txt[PATH_MAX];
+    snprintf(txt, sizeof(txt), "%s", path);
+    char *ext = strrchr(txt, '.');
+    strcpy(ext, ".txt");
+
+    FILE *fp = fopen(txt, "r");
+    if (fp == NULL) {
+        return -1;
+    }
+
+    int n = 0;
+    char line[256];
+    while (n < MAX_OBJECTS && fgets(line, sizeof(line), fp) != NULL) {
+        int x, y, w, h;
+        if (line[0] != '#' && sscanf(line, "%d %d %d %d", &x, &y, &w, &h) == 4) {
+            truth[n++] = (rectangle_t) {x, y, w, h};
+        }
+    }
+    fclose(fp);
+    return n;
+}
+
+static float rectangle_iou(rectangle_t *a, rectangle_t *b)
+{
+    int x1 = IM_MAX(a->x, b->x);
+    int y1 = IM_MAX(a->y, b->y);
+    int x2 = IM_MIN(a->x + a->w, b->x + b->w);
+    int y2 = IM_MIN(a->y + a->h, b->y + b->h);
+    if (x2 <= x1 || y2 <= y1) {
+        return 0.0f;
+    }
+    float i = (x2 - x1) * (y2 - y1);
+    return i / ((a->w * a->h) + (b->w * b->h) - i);
+}
+
+// Greedily matches each annotation to the unmatched detection with the highest IoU.
+static void match(bench_image_t *im, float overlap)
+{
+    bool used[MAX_OBJECTS] = {false};
+    im->tp = 0;
+    for (int i=0; i<im->n_truth; i++) {
+        int best = -1;
+        float best_iou = overlap;
+        for (int j=0; j<im->n_objects; j++) {
+            float iou = rectangle_iou(&im->truth[i], &im->objects[j]);
+            if (!used[j] && iou >= best_iou) {
+                best = j;
+                best_iou = iou;
+            }
+        }
+        if (best >= 0) {
+            used[best] = true;
+            im->tp++;
+        }
+    }
+    im->fp = im->n_objects - im->tp;
+    im->fn = im->n_truth - im->tp;
+}
+
+static void bench_image(bench_t *bench, bench_image_t *im)
+{
+    image_t img;
+    if (!pnm_load(im->path, &img)) {
+        im->error = true;
+        return;
+    }
+    im->w = img.w;
+    im->h = img.h;
+
+    // Each thread works on its own copy of the cascade.
+    cascade_t cascade = bench->cascade;
+    cascade_stats_t stats = {0, im->stage_windows, im->stage_features};
+    cascade.stats = &stats;
+
+    rectangle_t roi = {0, 0, img.w, img.h};
+    if (img.w > cascade.window.w && img.h > cascade.window.h) {
+        arena_t objects;
+        double t = cpu_ms();
+        imlib_detect_objects(&objects, &img, &cascade, &roi);
+        im->ms = cpu_ms() - t;
+
+        im->n_objects = IM_MIN(arena_length(&objects), MAX_OBJECTS);
+        for (int i=0; i<im->n_objects; i++) {
+            im->objects[i] = ((detection_t *) arena_at(&objects, i))->rect;
+        }
+        arena_free(&objects);
+    }
+
+    im->windows = stats.windows;
+    im->n_truth = annotations_load(im->path, im->truth);
+    if (im->n_truth >= 0) {
+        match(im, bench->overlap);
+    }
+    free(img.pixels);
+}
+
+static void *bench_thread(void *arg)
+{
+    bench_t *bench = arg;
+    for (;;) {
+        pthread_mutex_lock(&bench->lock);
+        int i = bench->next++;
+        pthread_mutex_unlock(&bench->lock);
+        if (i >= bench->n_images) {
+            break;
+        }
+        bench_image(bench, &bench->images[i]);
+    }
+    fb_release();
+    return NULL;
+}
+
+// Lists the PGM and PPM images of a directory, in file name order.
+// The FatFs DIR type clashes with dirent.h, so this uses glob.
+static int images_list(bench_t *bench, const char *dir)
+{
+    glob_t g;
+    char pattern[PATH_MAX];
+    snprintf(pattern, sizeof(pattern), "%s/*.p[gp]m", dir);
+    if (glob(pattern, 0, NULL, &g) != 0) {
+        return -1;
+    }
+
+    bench->n_images = g.gl_pathc;
+    bench->images = calloc(g.gl_pathc, sizeof(bench_image_t));
+    for (int i=0; i<bench->n_images; i++) {
+        snprintf(bench->images[i].path, PATH_MAX, "%s", g.gl_pathv[i]);
+    }
+
+    globfree(&g);
+    return bench->n_images;
+}
+
+int main(int argc, char **argv)
+{
+    bench_t bench;
+    memset(&bench, 0, sizeof(bench));
+    pthread_mutex_init(&bench.lock, NULL);
+
+    const char *cascade_path = "frontalface";
+    float scale = 1.5f, threshold = 0.5f;
+    int neighbors = 0, variance = 0;
+    int n_threads = sysconf(_SC_NPROCESSORS_ONLN);
+    bool quiet = false;
+    bench.overlap = 0.5f;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "c:s:t:n:v:o:j:m:q")) != -1) {
+        switch (opt) {
+            case 'c': cascade_path = optarg; break;
+            case 's': scale = atof(optarg); break;
+            case 't': threshold = atof(optarg); break;
+            case 'n': neighbors = atoi(optarg); break;
+            case 'v': variance = atoi(optarg); break;
+            case 'o': bench.overlap = atof(optarg); break;
+            case 'j': n_threads = atoi(optarg); break;
+            case 'm': fb_size = atoi(optarg) * 1024; break;
+            case 'q': quiet = true; break;
+            default: usage();
+        }
+    }
+
+    if (optind != argc - 1 || scale <= 1.0f || n_threads < 1 || fb_size == 0) {
+        usage();
+    }
+
+    // Cascade files are loaded by absolute path, anything else is a built-in cascade.
+    char path[PATH_MAX];
+    if (strchr(cascade_path, '/') || strchr(cascade_path, '.')) {
+        if (realpath(cascade_path, path) == NULL) {
+            fprintf(stderr, "cascade-bench: %s not found\n", cascade_path);
+            return 1;
+        }
+        cascade_path = path;
+    }
+
+    int res = imlib_load_cascade(&bench.cascade, cascade_path);
+    if (res != FR_OK) {
+        fprintf(stderr, "cascade-bench: failed to load %s (FatFs error %d)\n", cascade_path, res);
+        return 1;
+    }
+    if (bench.cascade.n_stages > MAX_STAGES) {
+        fprintf(stderr, "cascade-bench: more than %d stages\n", MAX_STAGES);
+        return 1;
+    }
+    bench.cascade.scale_factor = scale;
+    bench.cascade.threshold = threshold;
+    bench.cascade.min_neighbors = neighbors;
+    bench.cascade.min_variance = variance;
+    bench.cascade.mask = NULL;
+
+    if (images_list(&bench, argv[optind]) <= 0) {
+        fprintf(stderr, "cascade-bench: no PGM/PPM images in %s\n", argv[optind]);
+        return 1;
+    }
+
+    double t = wall_ms();
+    pthread_t *threads = malloc(n_threads * sizeof(pthread_t));
+    for (int i=0; i<n_threads; i++) {
+        pthread_create(&threads[i], NULL, bench_thread, &bench);
+    }
+    for (int i=0; i<n_threads; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    t = wall_ms() - t;
+    free(threads);
+
+    // Per image results, in file name order.
+    int n_images = 0, n_annotated = 0;
+    int tp = 0, fp = 0, fn = 0;
+    double ms = 0.0;
+    uint64_t windows = 0;
+    uint64_t stage_windows[MAX_STAGES] = {0};
+    uint64_t stage_features[MAX_STAGES] = {0};
+
+    if (!quiet) {
+        printf("%-32s %9s %9s %9s %7s %4s %4s %4s\n",
+                "image", "size", "ms", "windows", "objects", "tp", "fp", "fn");
+    }
+
+    for (int i=0; i<bench.n_images; i++) {
+        bench_image_t *im = &bench.images[i];
+        const char *name = strrchr(im->path, '/') + 1;
+        if (im->error) {
+            fprintf(stderr, "cascade-bench: failed to load %s\n", im->path);
+            continue;
+        }
+
+        n_images++;
+        ms += im->ms;
+        windows += im->windows;
+        for (int j=0; j<bench.cascade.n_stages; j++) {
+            stage_windows[j] += im->stage_windows[j];
+            stage_features[j] += im->stage_features[j];
+        }
+        if (im->n_truth >= 0) {
+            n_annotated++;
+            tp += im->tp;
+            fp += im->fp;
+            fn += im->fn;
+        }
+
+        if (!quiet) {
+            char size[32];
+            snprintf(size, sizeof(size), "%dx%d", im->w, im->h);
+            printf("%-32s %9s %9.2f %9u %7d", name, size, im->ms, im->windows, im->n_objects);
+            if (im->n_truth >= 0) {
+                printf(" %4d %4d %4d\n", im->tp, im->fp, im->fn);
+            } else {
+                printf(" %4s %4s %4s\n", "-", "-", "-");
+            }
+        }
+    }
+
+    if (n_images == 0) {
+        return 1;
+    }
+
+    // Stage statistics, the pass rate is the fraction of windows reaching the next stage.
+    printf("\n%5s %12s %12s %9s %9s\n", "stage", "windows", "features", "pass", "feat/win");
+    for (int j=0; j<bench.cascade.n_stages; j++) {
+        uint64_t next = (j < bench.cascade.n_stages - 1) ? stage_windows[j+1] : 0;
+        printf("%5d %12llu %12llu %8.2f%% %9.2f\n", j,
+                (unsigned long long) stage_windows[j], (unsigned long long) stage_features[j],
+                stage_windows[j] ? ((100.0 * next) / stage_windows[j]) : 0.0,
+                windows ? ((double) stage_features[j] / windows) : 0.0);
+    }
+
+    uint64_t features = 0;
+    for (int j=0; j<bench.cascade.n_stages; j++) {
+        features += stage_features[j];
+    }
+
+    printf("\nimages:     %d (%d threads, %.1f ms wall time)\n", n_images, n_threads, t);
+    printf("time:       %.2f ms per image\n", ms / n_images);
+    printf("windows:    %.0f per image, %.2f features per window\n",
+            (double) windows / n_images, windows ? ((double) features / windows) : 0.0);
+
+    if (n_annotated) {
+        printf("annotated:  %d images, %d objects\n", n_annotated, tp + fn);
+        printf("precision:  %.4f (%d/%d)\n", (tp + fp) ? ((double) tp / (tp + fp)) : 0.0, tp, tp + fp);
+        printf("recall:     %.4f (%d/%d)\n", (tp + fn) ? ((double) tp / (tp + fn)) : 0.0, tp, tp + fn);
+    }
+
+    free(bench.images);
+    fb_release();
+    return 0;
+}
@@ -0,0 +1,184 @@
+/*
+ * This file is part of the OpenMV project.
+ * Copyright (c) 2013/2014 Ibrahim Abdelkader <i.abdalkader@gmail.com>
+ * This work is licensed under the MIT license, see the file LICENSE for details.
+ *
+ * Host implementations of the firmware services used by the detector:
+ * xalloc, fb_alloc, the FatFs calls used to load cascades and fmath.
+ *
+ * The frame buffer allocator is a per-thread stack, so every worker thread
+ * gets its own frame buffer of fb_size bytes, like the camera has.
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <ff.h>
+#include "xalloc.h"
+#include "fb_alloc.h"
+#include "fmath.h"
+#include "host.h"
+
+uint32_t fb_size = (8 * 1024 * 1024);
+
+static __thread char *fb_mem = NULL;
+static __thread char *fb_ptr = NULL;
+
+static void fail(const char *msg)
+{
+    fprintf(stderr, "cascade-bench: %s\n", msg);
+    exit(1);
+}
+
+void *xalloc(uint32_t size)
+{
+    void *mem = malloc(size ? size : 1);
+    if (mem == NULL) {
+        fail("xalloc: out of memory");
+    }
+    return mem;
+}
+
+void *xalloc0(uint32_t size)
+{
+    void *mem = xalloc(size);
+    memset(mem, 0, size);
+    return mem;
+}
+
+void xfree(void *mem)
+{
+    free(mem);
+}
+
+void *xrealloc(void *mem, uint32_t size)
+{
+    mem = realloc(mem, size ? size : 1);
+    if (mem == NULL) {
+        fail("xrealloc: out of memory");
+    }
+    return mem;
+}
+
+// Same layout as the firmware, the frame buffer grows down from
+// the end and each block is preceded by its size.
+static void fb_init()
+{
+    if (fb_mem == NULL) {
+        fb_mem = malloc(fb_size);
+        if (fb_mem == NULL) {
+            fail("fb_alloc: out of memory");
+        }
+        fb_ptr = fb_mem + fb_size;
+    }
+}
+
+uint32_t fb_avail()
+{
+    fb_init();
+    int avail = (fb_ptr - fb_mem) - sizeof(uint32_t);
+    return (avail > 0) ? avail : 0;
+}
+
+void *fb_alloc(uint32_t size)
+{
+    if (!size) {
+        return NULL;
+    }
+
+    fb_init();
+    size = ((size + sizeof(uint32_t) - 1) / sizeof(uint32_t)) * sizeof(uint32_t);
+    if ((size + sizeof(uint32_t)) > (uint32_t) (fb_ptr - fb_mem)) {
+        fail("fb_alloc: out of frame buffer memory, use -m to add more");
+    }
+
+    fb_ptr -= size;
+    void *mem = fb_ptr;
+    fb_ptr -= sizeof(uint32_t);
+    *((uint32_t *) fb_ptr) = size + sizeof(uint32_t);
+    return mem;
+}
+
+void *fb_alloc0(uint32_t size)
+{
+    void *mem = fb_alloc(size);
+    memset(mem, 0, size);
+    return mem;
+}
+
+void *fb_alloc_all(uint32_t *size)
+{
+    *size = fb_avail() & ~(sizeof(uint32_t) - 1);
+    return (*size) ? fb_alloc(*size) : NULL;
+}
+
+void *fb_alloc0_all(uint32_t *size)
+{
+    void *mem = fb_alloc_all(size);
+    memset(mem, 0, *size);
+    return mem;
+}
+
+void fb_free()
+{
+    if (fb_ptr != NULL && fb_ptr < (fb_mem + fb_size)) {
+        fb_ptr += *((uint32_t *) fb_ptr);
+    }
+}
+
+void fb_free_all()
+{
+    while (fb_ptr != NULL && fb_ptr < (fb_mem + fb_size)) {
+        fb_free();
+    }
+}
+
+// Frees the frame buffer of the calling thread, call it before the thread exits.
+void fb_release()
+{
+    free(fb_mem);
+    fb_mem = NULL;
+    fb_ptr = NULL;
+}
+
+// The FIL file system pointer holds the stdio stream.
+FRESULT f_open(FIL *fp, const TCHAR *path, BYTE mode)
+{
+    FILE *fd = fopen(path, (mode & FA_WRITE) ? "wb" : "rb");
+    if (fd == NULL) {
+        return FR_NO_FILE;
+    }
+    fseek(fd, 0, SEEK_END);
+    fp->fsize = ftell(fd);
+    fp->fptr = 0;
+    fseek(fd, 0, SEEK_SET);
+    fp->fs = (FATFS *) fd;
+    return FR_OK;
+}
+
+FRESULT f_read(FIL *fp, void *buff, UINT btr, UINT *br)
+{
+    *br = fread(buff, 1, btr, (FILE *) fp->fs);
+    fp->fptr += *br;
+    return ferror((FILE *) fp->fs) ? FR_DISK_ERR : FR_OK;
+}
+
+FRESULT f_close(FIL *fp)
+{
+    fclose((FILE *) fp->fs);
+    return FR_OK;
+}
+
+// fmath, fast_roundf rounds to nearest even like vcvtr.
+float fast_sqrtf(float x)           { return sqrtf(x); }
+int fast_floorf(float x)            { return floorf(x); }
+int fast_ceilf(float x)             { return ceilf(x); }
+int fast_roundf(float x)            { return lrintf(x); }
+float fast_atanf(float x)           { return atanf(x); }
+float fast_atan2f(float y, float x) { return atan2f(y, x); }
+float fast_expf(float x)            { return expf(x); }
+float fast_cbrtf(float x)           { return cbrtf(x); }
+float fast_fabsf(float x)           { return fabsf(x); }
+float fast_log(float x)             { return logf(x); }
+float fast_log2(float x)            { return log2f(x); }
@@ -0,0 +1,16 @@
+/*
+ * This file is part of the OpenMV project.
+ * Copyright (c) 2013/2014 Ibrahim Abdelkader <i.abdalkader@gmail.com>
+ * This work is licensed under the MIT license, see the file LICENSE for details.
+ *
+ * Host implementations of the firmware services used by the detector.
+ *
+ */
+#ifndef __HOST_H__
+#define __HOST_H__
+#include <stdint.h>
+// Frame buffer size of each thread, set before the first fb_alloc.
+extern uint32_t fb_size;
+// Frees the frame buffer of the calling thread.
+void fb_release();
+#endif // __HOST_H__
@@ -0,0 +1,12 @@
+/*
+ * This file is part of the OpenMV project.
+ * Copyright (c) 2013/2014 Ibrahim Abdelkader <i.abdalkader@gmail.com>
+ * This work is licensed under the MIT license, see the file LICENSE for details.
+ *
+ * Empty CMSIS DSP header for host builds, the imlib sources
+ * used by the benchmark don't call any CMSIS functions.
+ *
+ */
+#ifndef __ARM_MATH_H
+#define __ARM_MATH_H
+#endif // __ARM_MATH_H
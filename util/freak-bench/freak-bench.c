@@ -0,0 +1,218 @@
+/*
+ * This file is part of the OpenMV project.
+ * Copyright (c) 2013/2014 Ibrahim Abdelkader <i.abdalkader@gmail.com>
+ * This work is licensed under the MIT license, see the file LICENSE for details.
+ *
+ * Host FREAK matching benchmark.
+ *
+ * Matches synthetic descriptor sets with freak_match_index, built from the
+ * firmware sources, and with an exhaustive search using the same acceptance
+ * rules. Queries are either noisy copies of reference descriptors, with
+ * each bit flipped with the given probability, or random descriptors.
+ * Reports the time of both, the matches the index misses compared to the
+ * exhaustive search, and the precision and recall against the true pairs.
+ *
+ * Usage: freak-bench [options]
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include "imlib.h"
+#include "xalloc.h"
+#include "fb_alloc.h"
+
+#define MAX_KP_DIST (512)
+
+static void usage()
+{
+    fprintf(stderr,
+        "usage: freak-bench [options]\n"
+        "  -n kpts      reference keypoints (500)\n"
+        "  -q kpts      query keypoints (500)\n"
+        "  -p fraction  queries copied from reference keypoints (0.5)\n"
+        "  -e rate      bit error rate of the copies (0.1)\n"
+        "  -t threshold matching threshold (60)\n"
+        "  -r ratio     ratio test (1.0)\n"
+        "  -x           cross-check matches\n"
+        "  -i count     iterations (10)\n"
+        "  -s seed      random seed (1)\n");
+    exit(1);
+}
+
+static double cpu_ms()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return (ts.tv_sec * 1000.0) + (ts.tv_nsec / 1000000.0);
+}
+
+static void kpts_alloc(kp_set_t *kpts, int n)
+{
+    kp_set_alloc(kpts, n);
+    for (int i=0; i<(n * KP_DESC_SIZE); i++) {
+        kpts->desc[i] = rand();
+    }
+}
+
+// Same acceptance rules as freak_match_index, comparing every pair.
+static int match_exhaustive(kp_set_t *refs, kp_set_t *kpts, int threshold, float ratio, bool cross_check)
+{
+    int n_refs = refs->n_kpts, n_kpts = kpts->n_kpts, matches = 0;
+    int *ref_best = xalloc(n_refs * sizeof(int));
+    int *ref_dist = xalloc(n_refs * sizeof(int));
+    int *query_best = xalloc(n_kpts * sizeof(int));
+    int *query_dist = xalloc(n_kpts * sizeof(int) * 2);
+
+    for (int r=0; r<n_refs; r++) {
+        ref_dist[r] = MAX_KP_DIST;
+        refs->match[r] = -1;
+    }
+
+    for (int q=0; q<n_kpts; q++) {
+        int d1 = MAX_KP_DIST, d2 = MAX_KP_DIST, best = 0;
+        kpts->match[q] = -1;
+        for (int r=0; r<n_refs; r++) {
+            int dist = freak_distance(kpts->desc + (q * KP_DESC_SIZE), refs->desc + (r * KP_DESC_SIZE));
+            if (dist < d1) {
+                d2 = d1;
+                d1 = dist;
+                best = r;
+            } else if (dist < d2) {
+                d2 = dist;
+            }
+            if (dist < ref_dist[r]) {
+                ref_dist[r] = dist;
+                ref_best[r] = q;
+            }
+        }
+        query_best[q] = best;
+        query_dist[q*2+0] = d1;
+        query_dist[q*2+1] = d2;
+    }
+
+    for (int q=0; q<n_kpts; q++) {
+        int r = query_best[q], d1 = query_dist[q*2+0], d2 = query_dist[q*2+1];
+        if (d1 == MAX_KP_DIST || (((MAX_KP_DIST - d1) * 100) / MAX_KP_DIST) < threshold
+                || d1 > (ratio * d2) || (cross_check && ref_best[r] != q) || refs->match[r] != -1) {
+            continue;
+        }
+        kpts->match[q] = r;
+        refs->match[r] = q;
+        matches++;
+    }
+
+    xfree(query_dist);
+    xfree(query_best);
+    xfree(ref_dist);
+    xfree(ref_best);
+    return matches;
+}
+
+int main(int argc, char **argv)
+{
+    int n_refs = 500, n_kpts = 500, threshold = 60, iterations = 10, seed = 1;
+    float fraction = 0.5f, error = 0.1f, ratio = 1.0f;
+    bool cross_check = false;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "n:q:p:e:t:r:xi:s:")) != -1) {
+        switch (opt) {
+            case 'n': n_refs = atoi(optarg); break;
+            case 'q': n_kpts = atoi(optarg); break;
+            case 'p': fraction = atof(optarg); break;
+            case 'e': error = atof(optarg); break;
+            case 't': threshold = atoi(optarg); break;
+            case 'r': ratio = atof(optarg); break;
+            case 'x': cross_check = true; break;
+            case 'i': iterations = atoi(optarg); break;
+            case 's': seed = atoi(optarg); break;
+            default: usage();
+        }
+    }
+
+    if (optind != argc || n_refs < 1 || n_kpts < 1 || iterations < 1) {
+        usage();
+    }
+
+    srand(seed);
+    kp_set_t refs, kpts;
+    kpts_alloc(&refs, n_refs);
+    kpts_alloc(&kpts, n_kpts);
+
+    // The true match of each query, or -1. Each reference keypoint is copied at most once.
+    int *truth = xalloc(n_kpts * sizeof(int));
+    for (int q=0; q<n_kpts; q++) {
+        truth[q] = -1;
+    }
+    int *order = xalloc(n_refs * sizeof(int));
+    for (int r=0; r<n_refs; r++) {
+        int j = rand() % (r + 1);
+        order[r] = order[j];
+        order[j] = r;
+    }
+    for (int q=0; q<IM_MIN(n_kpts * fraction, n_refs); q++) {
+        uint8_t *desc = kpts.desc + (q * KP_DESC_SIZE);
+        truth[q] = order[q];
+        memcpy(desc, refs.desc + (truth[q] * KP_DESC_SIZE), KP_DESC_SIZE);
+        for (int b=0; b<(KP_DESC_SIZE * 8); b++) {
+            if (rand() < (error * RAND_MAX)) {
+                desc[b/8] ^= (1 << (b%8));
+            }
+        }
+    }
+    xfree(order);
+
+    // Exhaustive search.
+    int exhaustive = 0;
+    double t_exhaustive = cpu_ms();
+    for (int i=0; i<iterations; i++) {
+        exhaustive = match_exhaustive(&refs, &kpts, threshold, ratio, cross_check);
+    }
+    t_exhaustive = (cpu_ms() - t_exhaustive) / iterations;
+
+    int16_t *exhaustive_match = xalloc(n_kpts * sizeof(int16_t));
+    memcpy(exhaustive_match, kpts.match, n_kpts * sizeof(int16_t));
+
+    // Index.
+    freak_index_t index;
+    double t_build = cpu_ms();
+    for (int i=0; i<iterations; i++) {
+        freak_index_build(&index, &refs);
+        if (i != iterations - 1) {
+            freak_index_free(&index);
+        }
+    }
+    t_build = (cpu_ms() - t_build) / iterations;
+
+    int indexed = 0;
+    double t_index = cpu_ms();
+    for (int i=0; i<iterations; i++) {
+        indexed = freak_match_index(&index, &kpts, threshold, ratio, cross_check);
+    }
+    t_index = (cpu_ms() - t_index) / iterations;
+
+    int missed = 0, correct = 0, n_truth = 0;
+    for (int q=0; q<n_kpts; q++) {
+        int match = kpts.match[q];
+        missed += (exhaustive_match[q] != -1 && match != exhaustive_match[q]);
+        correct += (truth[q] != -1 && match == truth[q]);
+        n_truth += (truth[q] != -1);
+    }
+
+    printf("keypoints:  %d reference, %d queries (%d copies, %.0f%% bit errors)\n",
+            n_refs, n_kpts, n_truth, error * 100.0f);
+    printf("index:      %d tables, %u bytes, built in %.3f ms\n", FREAK_INDEX_TABLES,
+            (unsigned) (FREAK_INDEX_TABLES * ((257 + n_refs) * sizeof(uint16_t))), t_build);
+    printf("exhaustive: %.3f ms, %d matches\n", t_exhaustive, exhaustive);
+    printf("indexed:    %.3f ms, %d matches, %d exhaustive matches missed (%.2fx faster)\n",
+            t_index, indexed, missed, t_exhaustive / t_index);
+    printf("precision:  %.4f (%d/%d)\n", indexed ? ((double) correct / indexed) : 0.0, correct, indexed);
+    printf("recall:     %.4f (%d/%d)\n", n_truth ? ((double) correct / n_truth) : 0.0, correct, n_truth);
+
+    freak_index_free(&index);
+    return 0;
+}
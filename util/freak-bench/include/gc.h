@@ -0,0 +1,31 @@
+/*
+ * This file is part of the OpenMV project.
+ * Copyright (c) 2013/2014 Ibrahim Abdelkader <i.abdalkader@gmail.com>
+ * This work is licensed under the MIT license, see the file LICENSE for details.
+ *
+ * MicroPython GC stubs for host builds, xalloc uses the C heap.
+ *
+ */
+#ifndef __GC_H__
+#define __GC_H__
+#include <stddef.h>
+#include <string.h>
+typedef struct _gc_info_t {
+    size_t total;
+    size_t used;
+    size_t free;
+    size_t num_1block;
+    size_t num_2block;
+    size_t max_block;
+} gc_info_t;
+
+static inline void gc_info(gc_info_t *info)
+{
+    memset(info, 0, sizeof(*info));
+    info->free = ((size_t) -1) >> 1;
+}
+
+static inline void gc_collect()
+{
+}
+#endif // __GC_H__
@@ -0,0 +1,14 @@
+/*
+ * This file is part of the OpenMV project.
+ * Copyright (c) 2013/2014 Ibrahim Abdelkader <i.abdalkader@gmail.com>
+ * This work is licensed under the MIT license, see the file LICENSE for details.
+ *
+ * MicroPython definitions used by array.c, for host builds.
+ *
+ */
+#ifndef __MP_H__
+#define __MP_H__
+#include <stddef.h>
+#include <string.h>
+#define MP_STACK_CHECK()
+#endif // __MP_H__
@@ -0,0 +1,11 @@
+/*
+ * This file is part of the OpenMV project.
+ * Copyright (c) 2013/2014 Ibrahim Abdelkader <i.abdalkader@gmail.com>
+ * This work is licensed under the MIT license, see the file LICENSE for details.
+ *
+ * Empty MicroPython stack control header, for host builds.
+ *
+ */
+#ifndef __STACKCTRL_H__
+#define __STACKCTRL_H__
+#endif // __STACKCTRL_H__
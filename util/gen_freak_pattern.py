@@ -0,0 +1,49 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+# FREAK sampling pattern for every quantised orientation, see freak.c.
+# Each point is the top-left corner of its averaging box relative to the
+# keypoint, the box size only depends on the point's ring.
+
+import sys, math
+
+NB_ORIENTATION=256
+PATTERN_SCALE=22
+BIG_R=2.0/3.0
+SMALL_R=2.0/24.0
+UNIT_SPACE=(BIG_R-SMALL_R)/21.0
+
+# number of points, radii and sigmas of the concentric circles (from outer to inner)
+n = [6,6,6,6,6,6,6,1]
+radius = [BIG_R, BIG_R-6*UNIT_SPACE, BIG_R-11*UNIT_SPACE, BIG_R-15*UNIT_SPACE,
+          BIG_R-18*UNIT_SPACE, BIG_R-20*UNIT_SPACE, SMALL_R, 0.0]
+sigma = [BIG_R/2.0, (BIG_R-6*UNIT_SPACE)/2.0, (BIG_R-11*UNIT_SPACE)/2.0, (BIG_R-15*UNIT_SPACE)/2.0,
+         (BIG_R-18*UNIT_SPACE)/2.0, (BIG_R-20*UNIT_SPACE)/2.0, SMALL_R/2.0, SMALL_R/2.0]
+
+points = [(ring, i) for ring in range(8) for i in range(n[ring])]
+
+sys.stdout.write("#include <stdint.h>\n")
+
+sys.stdout.write("const uint8_t freak_box_size[%d] = {\n   " % len(points))
+for ring, i in points:
+    sys.stdout.write(" %d," % int(2.0*sigma[ring]*PATTERN_SCALE+0.5))
+sys.stdout.write("\n};\n")
+
+sys.stdout.write("const int8_t freak_pattern[%d][%d][2] = {\n" % (NB_ORIENTATION, len(points)))
+for rot in range(NB_ORIENTATION):
+    theta = rot*2.0*math.pi/NB_ORIENTATION
+    sys.stdout.write("    { // %d\n" % rot)
+    for j, (ring, i) in enumerate(points):
+        # orientation offset so that groups of points on each circles are staggered
+        beta = math.pi/n[ring]*(ring%2)
+        alpha = i*2.0*math.pi/n[ring]+beta+theta
+        psigma = sigma[ring]*PATTERN_SCALE
+        x = int(math.floor(radius[ring]*PATTERN_SCALE*math.cos(alpha)-psigma+0.5))
+        y = int(math.floor(radius[ring]*PATTERN_SCALE*math.sin(alpha)-psigma+0.5))
+        if not (j % 8):
+            sys.stdout.write("       ")
+        sys.stdout.write(" {%4d,%4d}," % (x, y))
+        if (j % 8) == 7 or j == len(points)-1:
+            sys.stdout.write("\n")
+    sys.stdout.write("    },\n")
+sys.stdout.write("};\n")
@@ -0,0 +1,71 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+# ORB tables, see orb.c: the BRIEF test pattern rotated to every quantised
+# orientation, the unit vectors of the orientations (Q14) and the half widths
+# of the circular patch used for the intensity centroid.
+#
+# The test points are drawn from an isotropic Gaussian (BRIEF G II) with
+# sigma = S/5 for a patch of S=31, and kept within a radius of 13 so every
+# rotation of the pattern stays inside the 31x31 patch with its 5x5 boxes.
+
+import sys, math, random
+
+ORB_ANGLES=30
+ORB_DESC_BITS=256
+PATCH_RADIUS=15
+PATTERN_RADIUS=13
+SIGMA=31.0/5.0
+SEED=0x0DB
+
+rng = random.Random(SEED)
+
+def gauss_point():
+    while True:
+        # Box-Muller, so the pattern doesn't depend on the random module's gauss()
+        u1 = 1.0 - rng.random()
+        u2 = rng.random()
+        r = SIGMA * math.sqrt(-2.0 * math.log(u1))
+        x, y = r*math.cos(2.0*math.pi*u2), r*math.sin(2.0*math.pi*u2)
+        if math.hypot(x, y) <= PATTERN_RADIUS:
+            return x, y
+
+tests = []
+while len(tests) < ORB_DESC_BITS:
+    x1, y1 = gauss_point()
+    x2, y2 = gauss_point()
+    # skip tests comparing a box with itself
+    if (round(x1), round(y1)) != (round(x2), round(y2)):
+        tests.append((x1, y1, x2, y2))
+
+def rotate(x, y, theta):
+    c, s = math.cos(theta), math.sin(theta)
+    return int(round(x*c - y*s)), int(round(x*s + y*c))
+
+sys.stdout.write("#include <stdint.h>\n")
+
+sys.stdout.write("const uint8_t orb_umax[%d] = {\n   " % (PATCH_RADIUS+1))
+for v in range(PATCH_RADIUS+1):
+    sys.stdout.write(" %d," % int(math.sqrt(PATCH_RADIUS*PATCH_RADIUS - v*v)))
+sys.stdout.write("\n};\n")
+
+sys.stdout.write("const int16_t orb_angles[%d][2] = {\n" % ORB_ANGLES)
+for a in range(ORB_ANGLES):
+    theta = a*2.0*math.pi/ORB_ANGLES
+    sys.stdout.write("    {%6d,%6d}, // %d\n" % (int(round(math.cos(theta)*16384)), int(round(math.sin(theta)*16384)), a*360//ORB_ANGLES))
+sys.stdout.write("};\n")
+
+sys.stdout.write("const int8_t orb_pattern[%d][%d][4] = {\n" % (ORB_ANGLES, ORB_DESC_BITS))
+for a in range(ORB_ANGLES):
+    theta = a*2.0*math.pi/ORB_ANGLES
+    sys.stdout.write("    { // %d\n" % (a*360//ORB_ANGLES))
+    for j, (x1, y1, x2, y2) in enumerate(tests):
+        p1 = rotate(x1, y1, theta)
+        p2 = rotate(x2, y2, theta)
+        if not (j % 4):
+            sys.stdout.write("       ")
+        sys.stdout.write(" {%4d,%4d,%4d,%4d}," % (p1 + p2))
+        if (j % 4) == 3:
+            sys.stdout.write("\n")
+    sys.stdout.write("    },\n")
+sys.stdout.write("};\n")